@@ -0,0 +1,166 @@
+#*********************************************************************
+#
+# (C) Copyright Broadcom Corporation 2013-2015
+#
+#  Licensed under the Apache License, Version 2.0 (the 'License');
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an 'AS IS' BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+#*********************************************************************
+
+
+import logging
+import struct
+
+LOG = logging.getLogger('ofdpa')
+
+'''
+Batched sending of flow and group mods.
+
+Mods are serialized into one buffer and handed to the datapath in a
+single write instead of one send_msg() per mod. A barrier request is
+inserted every barrier_interval mods so errors can be bounded to a
+window, and each mod's xid is remembered so an error reply can be
+traced back to the mod that caused it.
+
+With use_bundle the mods are wrapped in the agent's bundle messages
+(BSN experimenter messages mirroring OpenFlow 1.4 bundles) and
+committed together, so a failure applies none of them.
+'''
+
+BSN_EXPERIMENTER_ID = 0x5c16c7
+
+BUNDLE_CTRL_SUBTYPE = 0x100
+BUNDLE_ADD_SUBTYPE = 0x101
+
+BUNDLE_OPEN_REQUEST = 0
+BUNDLE_CLOSE_REQUEST = 2
+BUNDLE_COMMIT_REQUEST = 4
+
+# Agent side limits per bundle
+BUNDLE_MAX_MSGS = 16384
+BUNDLE_MAX_BYTES = 16 * 1024 * 1024
+
+class ModBatch(object):
+
+    def __init__(self, dp, barrier_interval=64, use_bundle=False):
+        self.dp = dp
+        self.barrier_interval = barrier_interval
+        self.use_bundle = use_bundle
+        self.buf = bytearray()
+        self.pending = 0
+        self.since_barrier = 0
+        self.outstanding = {}
+        self.errors = []
+        self.bundle_id = 0
+        self.bundle_msgs = 0
+        self.bundle_bytes = 0
+        self.bundle_open = False
+        self.barrier_xid = None
+
+    def _append(self, msg):
+        self.dp.set_xid(msg)
+        msg.serialize()
+        self.buf += msg.buf
+        return msg.xid
+
+    def _experimenter(self, subtype, data):
+        parser = self.dp.ofproto_parser
+        return parser.OFPExperimenter(self.dp, BSN_EXPERIMENTER_ID,
+                                      subtype, bytes(data))
+
+    def _bundle_ctrl(self, ctrl_type):
+        data = struct.pack('!IHH', self.bundle_id, ctrl_type, 0)
+        return self._append(self._experimenter(BUNDLE_CTRL_SUBTYPE, data))
+
+    def _bundle_start(self):
+        self.bundle_id += 1
+        self.bundle_msgs = 0
+        self.bundle_bytes = 0
+        self.bundle_open = True
+        self._bundle_ctrl(BUNDLE_OPEN_REQUEST)
+
+    def _bundle_finish(self):
+        if not self.bundle_open:
+            return
+        self._bundle_ctrl(BUNDLE_CLOSE_REQUEST)
+        self._bundle_ctrl(BUNDLE_COMMIT_REQUEST)
+        self.bundle_open = False
+
+    def _barrier(self):
+        parser = self.dp.ofproto_parser
+        self.barrier_xid = self._append(parser.OFPBarrierRequest(self.dp))
+        self.since_barrier = 0
+
+    def add(self, mod):
+        '''
+        Queue a flow or group mod. Returns its xid.
+        '''
+        if not self.use_bundle:
+            xid = self._append(mod)
+            self.since_barrier += 1
+            if self.barrier_interval and self.since_barrier >= self.barrier_interval:
+                self._barrier()
+        else:
+            self.dp.set_xid(mod)
+            mod.serialize()
+            if (self.bundle_open and
+                (self.bundle_msgs >= BUNDLE_MAX_MSGS or
+                 self.bundle_bytes + len(mod.buf) > BUNDLE_MAX_BYTES)):
+                self._bundle_finish()
+            if not self.bundle_open:
+                self._bundle_start()
+            data = struct.pack('!IHH', self.bundle_id, 0, 0) + bytes(mod.buf)
+            self._append(self._experimenter(BUNDLE_ADD_SUBTYPE, data))
+            self.bundle_msgs += 1
+            self.bundle_bytes += len(mod.buf)
+            xid = mod.xid
+
+        self.outstanding[xid] = mod
+        self.pending += 1
+        return xid
+
+    def flush(self):
+        '''
+        Send everything queued so far in one write, ending with a
+        barrier whose xid is left in barrier_xid. Returns the number
+        of mods sent.
+        '''
+        count = self.pending
+        if count == 0:
+            return 0
+        if self.use_bundle:
+            self._bundle_finish()
+        if self.since_barrier or self.use_bundle:
+            self._barrier()
+        LOG.debug("batch: sending %i mods in %i bytes", count, len(self.buf))
+        self.dp.send(bytes(self.buf))
+        self.buf = bytearray()
+        self.pending = 0
+        return count
+
+    def error(self, msg):
+        '''
+        Record an OFPErrorMsg. Returns the mod it refers to, or None
+        if the xid is not one of ours.
+        '''
+        mod = self.outstanding.get(msg.xid)
+        if mod is not None:
+            LOG.error("batch: mod xid 0x%x failed: type %i code %i: %s",
+                      msg.xid, msg.type, msg.code, mod)
+            self.errors.append((mod, msg))
+        return mod
+
+    def forget(self):
+        '''
+        Drop the xid table, e.g. once all barrier replies have arrived.
+        '''
+        self.outstanding = {}
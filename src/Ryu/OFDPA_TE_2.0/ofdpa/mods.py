@@ -16,7 +16,10 @@
 #
 #*********************************************************************
 
+import hashlib
+import json
 import logging
+import struct
 
 import ofdpa.flow_description as FlowDescription
 import ofdpa.matches as Matches
@@ -30,6 +33,18 @@ LOG = logging.getLogger('ofdpa')
 Creating flow or group mod object according to JSON config 
 '''
 
+def flow_checksum(config):
+    '''
+    Checksum of a flow description, used as the flow's cookie so the
+    agent's table and bucket checksums can be compared with the
+    intended state (see ofdpa.reconcile). The command is left out, so
+    adding or modifying the same flow gives the same checksum.
+    '''
+    desc = dict((key, value) for key, value in config.items() if key != 'cmd')
+    digest = hashlib.sha1(json.dumps(desc, sort_keys=True).encode('utf-8')).digest()
+    # Zero is the cookie of flows installed without a checksum
+    return struct.unpack('!Q', digest[:8])[0] or 1
+
 def create_flow_mod(dp, config):
 
     matches_config = FlowDescription.get_matches(config)
@@ -40,7 +55,7 @@ def create_flow_mod(dp, config):
 
     mod = dp.ofproto_parser.OFPFlowMod (
         dp,
-        cookie = 0,
+        cookie = flow_checksum(config),
         cookie_mask = 0,
         table_id = Utils.get_table(config['table']),
         command = Utils.get_mod_command(dp, config['cmd']),
@@ -56,6 +71,23 @@ def create_flow_mod(dp, config):
     )
     return mod
 
+def create_flow_delete(dp, table_id, cookie):
+    '''
+    Delete every flow in a table carrying the given cookie
+    '''
+    ofp = dp.ofproto
+    mod = dp.ofproto_parser.OFPFlowMod(
+        dp,
+        cookie = cookie,
+        cookie_mask = 0xffffffffffffffff,
+        table_id = table_id,
+        command = ofp.OFPFC_DELETE,
+        out_port = ofp.OFPP_ANY,
+        out_group = ofp.OFPG_ANY,
+        match = dp.ofproto_parser.OFPMatch()
+    )
+    return mod
+
 def create_group_mod(dp, config):
 
     buckets_config= FlowDescription.get_buckets_config(config)
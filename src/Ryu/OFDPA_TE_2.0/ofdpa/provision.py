@@ -0,0 +1,247 @@
+#*********************************************************************
+#
+# (C) Copyright Broadcom Corporation 2013-2015
+#
+#  Licensed under the Apache License, Version 2.0 (the 'License');
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an 'AS IS' BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+#*********************************************************************
+
+import logging
+from collections import deque
+
+import ofdpa.flow_description as FlowDescription
+import ofdpa.mods as Mods
+import ofdpa.batch as Batch
+
+LOG = logging.getLogger('ofdpa')
+
+'''
+Dependency ordered provisioning.
+
+The files of a working set are read as a set of objects rather than
+a sequence. Every group or flow that refers to a group (a "group"
+action or a bucket's watch_group) depends on the group mod defining
+it; when the referenced group is being deleted the edge is reversed so
+referrers go first. Mods of the same group id keep their file order.
+
+Objects whose dependencies are all acknowledged are sent together,
+one barrier per chunk, with up to `window' barriers outstanding. A
+barrier reply releases the objects depending on its chunk, so bring-up
+takes one round trip per level of the graph instead of one per object.
+An error reply fails its object and everything depending on it.
+'''
+
+PENDING = 'pending'
+SENT = 'sent'
+DONE = 'done'
+FAILED = 'failed'
+
+class Node(object):
+
+    def __init__(self, index, name, kind, config):
+        self.index = index
+        self.name = name
+        self.kind = kind
+        self.config = config
+        self.cmd = config.get('cmd', 'add')
+        self.group_id = None
+        if kind == 'group_mod':
+            self.group_id = int(config['group_id'], 0)
+        self.refs = set()
+        collect_group_refs(config, self.refs)
+        self.refs.discard(self.group_id)
+        self.mod = None
+        self.deps = set()
+        self.users = set()
+        self.level = 0
+        self.state = PENDING
+
+    def deleting(self):
+        return self.cmd in ('del', 'dels')
+
+    def __repr__(self):
+        return self.name
+
+def collect_group_refs(config, refs):
+    if isinstance(config, dict):
+        for key, value in config.items():
+            if key == 'group' and isinstance(value, dict) and 'group_id' in value:
+                refs.add(int(value['group_id'], 0))
+            elif key == 'watch_group' and value not in ('any', 'all'):
+                refs.add(int(value, 0))
+            else:
+                collect_group_refs(value, refs)
+    elif isinstance(config, list):
+        for value in config:
+            collect_group_refs(value, refs)
+
+def load_nodes(config_dir, working_set):
+    nodes = []
+    for filename in working_set:
+        if filename[0] == '#':
+            continue
+        config = FlowDescription.get_config(config_dir + '/' + filename)
+        for config_type in FlowDescription.get_config_type(config):
+            if config_type not in ('flow_mod', 'group_mod'):
+                raise Exception("Wrong configuration type name: %s in %s" %
+                                (config_type, filename))
+            nodes.append(Node(len(nodes), filename, config_type,
+                              config[config_type]))
+    return nodes
+
+def _depend(node, dep):
+    node.deps.add(dep)
+    dep.users.add(node)
+
+def build_graph(nodes):
+    '''
+    Link the nodes and assign levels. Returns the graph depth.
+    '''
+    groups = {}
+    for node in nodes:
+        if node.group_id is None:
+            continue
+        prev = groups.get(node.group_id)
+        if prev:
+            _depend(node, prev[-1])
+        groups.setdefault(node.group_id, []).append(node)
+
+    for node in nodes:
+        for group_id in node.refs:
+            owners = groups.get(group_id)
+            if not owners:
+                LOG.debug("%s: group 0x%x not in working set", node, group_id)
+                continue
+            for owner in owners:
+                if owner.deleting():
+                    _depend(owner, node)
+                else:
+                    _depend(node, owner)
+
+    waiting = dict((node, len(node.deps)) for node in nodes)
+    ready = deque(node for node in nodes if not node.deps)
+    seen = 0
+    depth = 0
+    while ready:
+        node = ready.popleft()
+        seen += 1
+        depth = max(depth, node.level + 1)
+        for user in node.users:
+            user.level = max(user.level, node.level + 1)
+            waiting[user] -= 1
+            if waiting[user] == 0:
+                ready.append(user)
+
+    if seen != len(nodes):
+        cycle = [node.name for node in nodes if waiting[node]]
+        raise Exception("Dependency cycle between: %s" % ', '.join(cycle))
+    return depth
+
+class Provisioner(object):
+
+    def __init__(self, dp, nodes, window=4, chunk=64):
+        self.dp = dp
+        self.nodes = nodes
+        self.window = window
+        self.chunk = chunk
+        self.depth = build_graph(nodes)
+        self.batch = Batch.ModBatch(dp, barrier_interval=0)
+        self.ready = deque(node for node in nodes if not node.deps)
+        self.inflight = {}
+        self.by_xid = {}
+        self.done = 0
+        self.failed = 0
+        LOG.info("provisioning %i objects in %i levels", len(nodes), self.depth)
+
+    def finished(self):
+        return self.done + self.failed == len(self.nodes)
+
+    def _create_mod(self, node):
+        if node.mod is not None:
+            return node.mod
+        if node.kind == 'flow_mod':
+            return Mods.create_flow_mod(self.dp, node.config)
+        return Mods.create_group_mod(self.dp, node.config)
+
+    def _pump(self):
+        while self.ready and len(self.inflight) < self.window:
+            sent = []
+            while self.ready and len(sent) < self.chunk:
+                node = self.ready.popleft()
+                if node.state != PENDING:
+                    continue
+                node.state = SENT
+                self.by_xid[self.batch.add(self._create_mod(node))] = node
+                sent.append(node)
+            if sent:
+                self.batch.flush()
+                self.inflight[self.batch.barrier_xid] = sent
+                LOG.debug("sent %i objects, barrier xid 0x%x",
+                          len(sent), self.batch.barrier_xid)
+
+    def _fail(self, node):
+        stack = [node]
+        while stack:
+            node = stack.pop()
+            if node.state in (DONE, FAILED):
+                continue
+            if node.state == PENDING:
+                LOG.error("skipping %s", node)
+            node.state = FAILED
+            self.failed += 1
+            stack.extend(node.users)
+
+    def start(self):
+        self._pump()
+        if self.finished():
+            self._report()
+
+    def barrier_reply(self, msg):
+        '''
+        Handle an OFPBarrierReply. Returns False if the xid is not ours.
+        '''
+        sent = self.inflight.pop(msg.xid, None)
+        if sent is None:
+            return False
+        for node in sent:
+            if node.state != SENT:
+                continue
+            node.state = DONE
+            self.done += 1
+            for user in node.users:
+                if (user.state == PENDING and
+                    all(dep.state == DONE for dep in user.deps)):
+                    self.ready.append(user)
+        self._pump()
+        if self.finished():
+            self._report()
+        return True
+
+    def error(self, msg):
+        '''
+        Handle an OFPErrorMsg. Returns the node it refers to, or None
+        if the xid is not one of ours.
+        '''
+        node = self.by_xid.get(msg.xid)
+        if node is None:
+            return None
+        self.batch.error(msg)
+        LOG.error("%s failed: type %i code %i", node, msg.type, msg.code)
+        self._fail(node)
+        return node
+
+    def _report(self):
+        self.batch.forget()
+        self.by_xid = {}
+        LOG.info("provisioning finished: %i done, %i failed",
+                 self.done, self.failed)
@@ -0,0 +1,219 @@
+#*********************************************************************
+#
+# (C) Copyright Broadcom Corporation 2013-2015
+#
+#  Licensed under the Apache License, Version 2.0 (the 'License');
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an 'AS IS' BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+#*********************************************************************
+
+import logging
+import struct
+
+import ofdpa.mods as Mods
+import ofdpa.provision as Provision
+import ofdpa.utils as Utils
+
+LOG = logging.getLogger('ofdpa')
+
+'''
+Checksum driven reconciliation.
+
+Every flow carries its checksum as cookie (see Mods.flow_checksum).
+The agent keeps the XOR of the cookies of each table, and of each
+bucket of a table with the bucket picked by the top bits of the
+cookie, and serves them as BSN table checksum and flow checksum
+bucket stats. On connect the same XORs are computed over the working
+set; bucket checksums are fetched only for the tables that differ and
+flows only for the buckets that differ. The Provisioner is then left
+with the missing flows, deletes for the flows not in the working set,
+and the groups that are missing or differ.
+
+Only working sets made of adds describe an intended state, so any
+other working set, or an agent refusing a request, falls back to
+pushing everything. Tables the working set does not use are left
+alone, as are groups it does not define.
+'''
+
+BSN_EXPERIMENTER_ID = 0x5c16c7
+
+FLOW_CHECKSUM_BUCKET_STATS_SUBTYPE = 10
+TABLE_CHECKSUM_STATS_SUBTYPE = 11
+
+def applicable(nodes):
+    return all(node.cmd == 'add' for node in nodes)
+
+def _xor(cookies):
+    checksum = 0
+    for cookie in cookies:
+        checksum ^= cookie
+    return checksum
+
+def _buckets_bytes(buckets):
+    buf = bytearray()
+    for bucket in buckets:
+        bucket.serialize(buf, len(buf))
+    return bytes(buf)
+
+class Reconciler(object):
+
+    def __init__(self, dp, nodes, finish):
+        '''
+        finish is called once with the nodes to provision
+        '''
+        self.dp = dp
+        self.nodes = nodes
+        self.finish = finish
+        self.flows = {}
+        self.groups = {}
+        for node in nodes:
+            if node.kind == 'flow_mod':
+                table_id = Utils.get_table(node.config['table'])
+                cookie = Mods.flow_checksum(node.config)
+                self.flows.setdefault(table_id, {})[cookie] = node
+            else:
+                self.groups[node.group_id] = node
+        self.pending = {}
+        self.parts = {}
+        self.send = []
+        self.stale = []
+        self.finished = False
+
+    def _request(self, req, handler):
+        self.dp.set_xid(req)
+        self.pending[req.xid] = handler
+        self.parts[req.xid] = []
+        self.dp.send_msg(req)
+
+    def _experimenter_request(self, subtype, data, handler):
+        parser = self.dp.ofproto_parser
+        req = parser.OFPExperimenterStatsRequest(self.dp, 0, BSN_EXPERIMENTER_ID,
+                                                 subtype, data)
+        self._request(req, handler)
+
+    def start(self):
+        parser = self.dp.ofproto_parser
+        self._experimenter_request(TABLE_CHECKSUM_STATS_SUBTYPE, b'',
+                                   self._table_checksums)
+        self._request(parser.OFPGroupDescStatsRequest(self.dp, 0),
+                      self._group_descs)
+
+    def _table_checksums(self, parts):
+        data = b''.join(bytes(part.body.data) for part in parts)
+        installed = {}
+        for offset in range(0, len(data) - len(data) % 9, 9):
+            table_id, checksum = struct.unpack_from('!BQ', data, offset)
+            installed[table_id] = checksum
+
+        for table_id, flows in self.flows.items():
+            if _xor(flows) == installed.get(table_id, 0):
+                LOG.debug("reconcile: table %i in sync", table_id)
+                continue
+            LOG.debug("reconcile: table %i differs", table_id)
+            self._experimenter_request(
+                FLOW_CHECKSUM_BUCKET_STATS_SUBTYPE, struct.pack('!B', table_id),
+                lambda parts, table_id=table_id: self._bucket_checksums(table_id, parts))
+
+    def _bucket_checksums(self, table_id, parts):
+        data = b''.join(bytes(part.body.data) for part in parts)
+        installed = struct.unpack('!%iQ' % (len(data) // 8),
+                                  data[:len(data) - len(data) % 8])
+        count = max(len(installed), 1)
+        # The bucket count is a power of 2; one bucket holds everything
+        shift = 64 - (count.bit_length() - 1)
+
+        intended = [0] * count
+        for cookie in self.flows[table_id]:
+            intended[cookie >> shift] ^= cookie
+
+        parser = self.dp.ofproto_parser
+        ofp = self.dp.ofproto
+        for index in range(count):
+            if index < len(installed) and installed[index] == intended[index]:
+                continue
+            cookie = index << shift
+            mask = (count - 1) << shift
+            req = parser.OFPFlowStatsRequest(self.dp, 0, table_id, ofp.OFPP_ANY,
+                                             ofp.OFPG_ANY, cookie, mask,
+                                             parser.OFPMatch())
+            self._request(req, lambda parts, table_id=table_id, cookie=cookie, mask=mask:
+                          self._flows(table_id, cookie, mask, parts))
+
+    def _flows(self, table_id, cookie, mask, parts):
+        installed = set(stats.cookie for part in parts for stats in part.body
+                        if stats.table_id == table_id)
+        intended = dict((key, node) for key, node in self.flows[table_id].items()
+                        if key & mask == cookie)
+
+        for key in installed - set(intended):
+            node = Provision.Node(len(self.nodes), "stale flow 0x%x in table %i" %
+                                  (key, table_id), 'flow_mod', {'cmd': 'del'})
+            node.mod = Mods.create_flow_delete(self.dp, table_id, key)
+            self.stale.append(node)
+        for key in set(intended) - installed:
+            self.send.append(intended[key])
+
+    def _group_descs(self, parts):
+        installed = dict((stats.group_id, stats) for part in parts
+                         for stats in part.body)
+        for group_id, node in self.groups.items():
+            stats = installed.get(group_id)
+            if stats is None:
+                self.send.append(node)
+                continue
+            mod = Mods.create_group_mod(self.dp, node.config)
+            if (stats.type == mod.type and
+                _buckets_bytes(stats.buckets) == _buckets_bytes(mod.buckets)):
+                continue
+            LOG.debug("reconcile: group 0x%x differs", group_id)
+            self.send.append(Provision.Node(node.index, node.name, 'group_mod',
+                                            dict(node.config, cmd='mod')))
+
+    def _finish(self, nodes):
+        if self.finished:
+            return
+        self.finished = True
+        self.pending = {}
+        self.parts = {}
+        self.finish(nodes)
+
+    def reply(self, msg):
+        '''
+        Handle a multipart reply. Returns False if the xid is not ours.
+        '''
+        handler = self.pending.get(msg.xid)
+        if handler is None:
+            return False
+        self.parts[msg.xid].append(msg)
+        if msg.flags & self.dp.ofproto.OFPMPF_REPLY_MORE:
+            return True
+
+        del self.pending[msg.xid]
+        handler(self.parts.pop(msg.xid))
+        if not self.pending:
+            # Keep the working set order among what is left to send
+            nodes = sorted(self.send, key=lambda node: node.index)
+            LOG.info("reconcile: %i of %i objects to send, %i stale flows",
+                     len(nodes), len(self.nodes), len(self.stale))
+            self._finish(self.stale + nodes)
+        return True
+
+    def error(self, msg):
+        '''
+        Handle an OFPErrorMsg. Returns False if the xid is not ours.
+        '''
+        if msg.xid not in self.pending:
+            return False
+        LOG.warning("reconcile: request failed: type %i code %i, pushing everything",
+                    msg.type, msg.code)
+        self._finish(self.nodes)
+        return True
@@ -23,10 +23,12 @@ import logging
 
 from ryu.base import app_manager
 from ryu.controller import dpset
-from ryu.controller.handler import set_ev_cls
+from ryu.controller import ofp_event
+from ryu.controller.handler import MAIN_DISPATCHER, set_ev_cls
 from ryu.ofproto import ofproto_v1_3
 
 import ofdpa.mods as Mods
+import ofdpa.provision as Provision
 import ofdpa.flow_description as FlowDescriptionReader
 
 ryu_loggers = logging.Logger.manager.loggerDict
@@ -62,6 +64,7 @@ class OfdpaTe2(app_manager.RyuApp):
 
     def __init__(self, *args, **kwargs):
         super(OfdpaTe2, self).__init__(*args, **kwargs)
+        self.provisioners = {}
 
     @set_ev_cls(dpset.EventDP, dpset.DPSET_EV_DISPATCHER)
     def handler_datapath(self, ev):
@@ -72,39 +75,29 @@ class OfdpaTe2(app_manager.RyuApp):
         LOG.info("===============================================================================")        
         if ev.enter:
             self.build_packets(ev.dp)
+        else:
+            self.provisioners.pop(ev.dp.id, None)
+
+    @set_ev_cls(ofp_event.EventOFPErrorMsg, MAIN_DISPATCHER)
+    def handler_error(self, ev):
+        provisioner = self.provisioners.get(ev.msg.datapath.id)
+        if provisioner is None or provisioner.error(ev.msg) is None:
+            LOG.error("error type 0x%x code 0x%x xid 0x%x",
+                      ev.msg.type, ev.msg.code, ev.msg.xid)
+
+    @set_ev_cls(ofp_event.EventOFPBarrierReply, MAIN_DISPATCHER)
+    def handler_barrier_reply(self, ev):
+        provisioner = self.provisioners.get(ev.msg.datapath.id)
+        if provisioner is not None:
+            provisioner.barrier_reply(ev.msg)
 
     def build_packets(self, dp):
         config_dir, working_set = FlowDescriptionReader.get_working_set(self.CONFIG_FILE)
-        
-        for filename in working_set:
-            if filename[0] == '#':
-                continue
-            #ryu_loggers_on(False)
-            full_filename = config_dir + '/' + filename
-            LOG.info("processing file: %s",  full_filename)
-
-            config = FlowDescriptionReader.get_config(full_filename)
-
-            for config_type in FlowDescriptionReader.get_config_type(config):
-                
-                if (config_type == "flow_mod"):
-                    mod_config = FlowDescriptionReader.get_flow_mod(config)
-                    mod = Mods.create_flow_mod(dp, mod_config)
-                    
-                elif (config_type == "group_mod"):
-                    mod_config = FlowDescriptionReader.get_group_mod(config)
-                    mod = Mods.create_group_mod(dp, mod_config)
-                    
-                else:
-                    raise Exception()
-                    LOG.exception("Wrong configuration type name:", config_type)
-                
-            LOG.debug("mod length: %i", sys.getsizeof(mod))
-            dp.send_msg(mod)
-            LOG.info("message sent")
-            LOG.info("===============================================================================")
-            
-            #ryu_loggers_on(True)            
+        nodes = Provision.load_nodes(config_dir, working_set)
+        provisioner = Provision.Provisioner(dp, nodes)
+        self.provisioners[dp.id] = provisioner
+        provisioner.start()
+        LOG.info("===============================================================================")
             
 if __name__ == '__main__':
     pass
@@ -23,10 +23,13 @@ import logging
 
 from ryu.base import app_manager
 from ryu.controller import dpset
-from ryu.controller.handler import set_ev_cls
+from ryu.controller import ofp_event
+from ryu.controller.handler import MAIN_DISPATCHER, set_ev_cls
 from ryu.ofproto import ofproto_v1_3
 
 import ofdpa.mods as Mods
+import ofdpa.provision as Provision
+import ofdpa.reconcile as Reconcile
 import ofdpa.flow_description as FlowDescriptionReader
 
 ryu_loggers = logging.Logger.manager.loggerDict
@@ -60,8 +63,13 @@ class OfdpaTe2(app_manager.RyuApp):
 
     CONFIG_FILE = 'conf/ofdpa_te.json'
 
+    # Send only what differs from the agent's flow checksums on connect
+    RECONCILE = True
+
     def __init__(self, *args, **kwargs):
         super(OfdpaTe2, self).__init__(*args, **kwargs)
+        self.provisioners = {}
+        self.reconcilers = {}
 
     @set_ev_cls(dpset.EventDP, dpset.DPSET_EV_DISPATCHER)
     def handler_datapath(self, ev):
@@ -72,39 +80,51 @@ class OfdpaTe2(app_manager.RyuApp):
         LOG.info("===============================================================================")        
         if ev.enter:
             self.build_packets(ev.dp)
+        else:
+            self.provisioners.pop(ev.dp.id, None)
+            self.reconcilers.pop(ev.dp.id, None)
+
+    @set_ev_cls(ofp_event.EventOFPErrorMsg, MAIN_DISPATCHER)
+    def handler_error(self, ev):
+        reconciler = self.reconcilers.get(ev.msg.datapath.id)
+        if reconciler is not None and reconciler.error(ev.msg):
+            return
+        provisioner = self.provisioners.get(ev.msg.datapath.id)
+        if provisioner is None or provisioner.error(ev.msg) is None:
+            LOG.error("error type 0x%x code 0x%x xid 0x%x",
+                      ev.msg.type, ev.msg.code, ev.msg.xid)
+
+    @set_ev_cls(ofp_event.EventOFPBarrierReply, MAIN_DISPATCHER)
+    def handler_barrier_reply(self, ev):
+        provisioner = self.provisioners.get(ev.msg.datapath.id)
+        if provisioner is not None:
+            provisioner.barrier_reply(ev.msg)
+
+    @set_ev_cls([ofp_event.EventOFPExperimenterStatsReply,
+                 ofp_event.EventOFPFlowStatsReply,
+                 ofp_event.EventOFPGroupDescStatsReply], MAIN_DISPATCHER)
+    def handler_stats_reply(self, ev):
+        reconciler = self.reconcilers.get(ev.msg.datapath.id)
+        if reconciler is not None:
+            reconciler.reply(ev.msg)
 
     def build_packets(self, dp):
         config_dir, working_set = FlowDescriptionReader.get_working_set(self.CONFIG_FILE)
-        
-        for filename in working_set:
-            if filename[0] == '#':
-                continue
-            #ryu_loggers_on(False)
-            full_filename = config_dir + '/' + filename
-            LOG.info("processing file: %s",  full_filename)
-
-            config = FlowDescriptionReader.get_config(full_filename)
-
-            for config_type in FlowDescriptionReader.get_config_type(config):
-                
-                if (config_type == "flow_mod"):
-                    mod_config = FlowDescriptionReader.get_flow_mod(config)
-                    mod = Mods.create_flow_mod(dp, mod_config)
-                    
-                elif (config_type == "group_mod"):
-                    mod_config = FlowDescriptionReader.get_group_mod(config)
-                    mod = Mods.create_group_mod(dp, mod_config)
-                    
-                else:
-                    raise Exception()
-                    LOG.exception("Wrong configuration type name:", config_type)
-                
-            LOG.debug("mod length: %i", sys.getsizeof(mod))
-            dp.send_msg(mod)
-            LOG.info("message sent")
-            LOG.info("===============================================================================")
-            
-            #ryu_loggers_on(True)            
+        nodes = Provision.load_nodes(config_dir, working_set)
+        if self.RECONCILE and Reconcile.applicable(nodes):
+            reconciler = Reconcile.Reconciler(
+                dp, nodes, lambda nodes: self.provision(dp, nodes))
+            self.reconcilers[dp.id] = reconciler
+            reconciler.start()
+        else:
+            self.provision(dp, nodes)
+
+    def provision(self, dp, nodes):
+        self.reconcilers.pop(dp.id, None)
+        provisioner = Provision.Provisioner(dp, nodes)
+        self.provisioners[dp.id] = provisioner
+        provisioner.start()
+        LOG.info("===============================================================================")
             
 if __name__ == '__main__':
     pass
@@ -34,10 +34,48 @@
 #include <stdlib.h>
 #include <string.h>
 #include <argp.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 #define DEFAULT_COUNT        0
 
-const char *argp_program_version = "client_flowtable_dump v1.1";
+/* Output formats */
+#define DUMP_FORMAT_TEXT     0
+#define DUMP_FORMAT_JSON     1
+#define DUMP_FORMAT_BINARY   2
+
+/* Binary record flags */
+#define DUMP_RECORD_F_STATS  0x1
+
+/*
+ * Binary record: this header, then the ofdpaFlowEntry_t, then an
+ * ofdpaFlowEntryStats_t if DUMP_RECORD_F_STATS is set.  Host byte
+ * order and structure layout, so records are only meant to be read
+ * back on the platform that wrote them.
+ */
+typedef struct
+{
+  uint32_t length;                      /* whole record, header included */
+  uint32_t tableId;
+  uint32_t flags;
+} dumpRecordHeader_t;
+
+/*
+ * Records are collected into a buffer no larger than PIPE_BUF and
+ * written out only on record boundaries, so records from concurrent
+ * table walkers sharing stdout never interleave.
+ */
+#define DUMP_RECORD_BUF_SIZE 4096
+
+typedef struct
+{
+  char buf[DUMP_RECORD_BUF_SIZE];
+  int  len;
+} dumpRecordBuf_t;
+
+const char *argp_program_version = "client_flowtable_dump v1.2";
 
 /* The options we understand. */
 static struct argp_option options[] =
@@ -45,6 +83,9 @@ static struct argp_option options[] =
   { "count",               'c', "COUNT",     0, "Number of entries from start of table. (0 for all)",       0 },
   { "verbose",             'v',       0,     0, "Print stats for empty flow tables.",                       0 },
   { "list",                'l',       0,     0, "Lists table IDs for supported flow tables and exits.",     0 },
+  { "format",              'f', "FORMAT",    0, "Output format: text, json (one object per line) or binary.", 0 },
+  { "parallel",            'p',       0,     0, "Walk all tables concurrently, one client per table. Requires json or binary format.", 0 },
+  { "stats",               's',       0,     0, "Include per-entry statistics in json or binary records.", 0 },
   { 0 }
 };
 
@@ -53,6 +94,9 @@ static OFDPA_FLOW_TABLE_ID_t tableId;
 static int tableIdSpecified = 0;
 static int showEmptyTables = 0;
 static int showValidTableIds = 0;
+static int outputFormat = DUMP_FORMAT_TEXT;
+static int parallelDump = 0;
+static int includeStats = 0;
 
 /* Parse a single option. */
 static error_t parse_opt(int key, char *arg, struct argp_state *state)
@@ -79,6 +123,34 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
       showEmptyTables = 1;
       break;
 
+    case 'f':
+      if (strcmp(arg, "text") == 0)
+      {
+        outputFormat = DUMP_FORMAT_TEXT;
+      }
+      else if (strcmp(arg, "json") == 0)
+      {
+        outputFormat = DUMP_FORMAT_JSON;
+      }
+      else if (strcmp(arg, "binary") == 0)
+      {
+        outputFormat = DUMP_FORMAT_BINARY;
+      }
+      else
+      {
+        argp_error(state, "Invalid format \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case 'p':
+      parallelDump = 1;
+      break;
+
+    case 's':
+      includeStats = 1;
+      break;
+
     case ARGP_KEY_ARG:
       errno = 0;
       tableId = strtoul(arg, NULL, 0);
@@ -101,6 +173,11 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
       break;
 
     case ARGP_KEY_END:
+      if (parallelDump && (outputFormat == DUMP_FORMAT_TEXT))
+      {
+        argp_error(state, "--parallel requires --format json or binary");
+        return EINVAL;
+      }
       break;
 
     default:
@@ -183,6 +260,237 @@ void dumpFlowTable(OFDPA_FLOW_TABLE_ID_t tableId, int entryPrintLimit, int *entr
   *entriesPrinted = i;
 }
 
+static void recordFlush(dumpRecordBuf_t *rb)
+{
+  int offset = 0;
+  ssize_t n;
+
+  while (offset < rb->len)
+  {
+    n = write(STDOUT_FILENO, &rb->buf[offset], rb->len - offset);
+    if (n < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      break;
+    }
+    offset += n;
+  }
+  rb->len = 0;
+}
+
+static void recordEmit(dumpRecordBuf_t *rb, const void *data, int len)
+{
+  if (rb->len + len > sizeof(rb->buf))
+  {
+    recordFlush(rb);
+  }
+  memcpy(&rb->buf[rb->len], data, len);
+  rb->len += len;
+}
+
+/* Append s to out as a JSON string body; returns the new length */
+static int jsonEscape(char *out, int len, int size, const char *s)
+{
+  for (; *s != '\0' && len < size - 7; s++)
+  {
+    unsigned char c = (unsigned char)*s;
+
+    if ((c == '"') || (c == '\\'))
+    {
+      out[len++] = '\\';
+      out[len++] = c;
+    }
+    else if (c < 0x20)
+    {
+      len += sprintf(&out[len], "\\u%04x", c);
+    }
+    else
+    {
+      out[len++] = c;
+    }
+  }
+  out[len] = '\0';
+  return len;
+}
+
+static void recordFlowEntry(dumpRecordBuf_t *rb, ofdpaFlowEntry_t *flow,
+                            ofdpaFlowEntryStats_t *flowStats)
+{
+  char decode[700];
+  char line[2048];
+  int len;
+  OFDPA_ERROR_t rc;
+
+  if (outputFormat == DUMP_FORMAT_BINARY)
+  {
+    dumpRecordHeader_t hdr;
+
+    hdr.length = sizeof(hdr) + sizeof(*flow) + (flowStats ? sizeof(*flowStats) : 0);
+    hdr.tableId = flow->tableId;
+    hdr.flags = flowStats ? DUMP_RECORD_F_STATS : 0;
+    if (rb->len + hdr.length > sizeof(rb->buf))
+    {
+      recordFlush(rb);
+    }
+    recordEmit(rb, &hdr, sizeof(hdr));
+    recordEmit(rb, flow, sizeof(*flow));
+    if (flowStats)
+    {
+      recordEmit(rb, flowStats, sizeof(*flowStats));
+    }
+    return;
+  }
+
+  rc = ofdpaFlowEntryDecode(flow, decode, sizeof(decode));
+
+  len = sprintf(line, "{\"table\":%d,\"priority\":%u,\"cookie\":%llu,"
+                "\"hard_time\":%u,\"idle_time\":%u,",
+                flow->tableId, flow->priority,
+                (unsigned long long)flow->cookie,
+                flow->hard_time, flow->idle_time);
+  if (flowStats)
+  {
+    len += sprintf(&line[len], "\"duration\":%u,\"packets\":%llu,\"bytes\":%llu,",
+                   flowStats->durationSec,
+                   (unsigned long long)flowStats->receivedPackets,
+                   (unsigned long long)flowStats->receivedBytes);
+  }
+  if (rc == OFDPA_E_FULL)
+  {
+    len += sprintf(&line[len], "\"truncated\":true,");
+  }
+  len += sprintf(&line[len], "\"entry\":\"");
+  len = jsonEscape(line, len, sizeof(line) - 3, decode);
+  len += sprintf(&line[len], "\"}\n");
+
+  /* Whole lines only */
+  if (rb->len + len > sizeof(rb->buf))
+  {
+    recordFlush(rb);
+  }
+  recordEmit(rb, line, len);
+}
+
+/*
+ * Walk one table emitting json or binary records.  Per-entry stats
+ * cost an extra RPC per entry, so they are fetched only when asked for.
+ */
+static int dumpFlowTableRecords(OFDPA_FLOW_TABLE_ID_t tableId, int entryLimit)
+{
+  int i;
+  OFDPA_ERROR_t rc;
+  ofdpaFlowEntry_t flow;
+  ofdpaFlowEntryStats_t flowStats;
+  dumpRecordBuf_t *rb;
+
+  rc = ofdpaFlowEntryInit(tableId, &flow);
+  if (rc != OFDPA_E_NONE)
+  {
+    fprintf(stderr, "Bad return code trying to initialize flow for table %d. rc = %d.\r\n", tableId, rc);
+    return 0;
+  }
+
+  rb = calloc(1, sizeof(*rb));
+  if (rb == NULL)
+  {
+    return 0;
+  }
+
+  rc = ofdpaFlowStatsGet(&flow, &flowStats);
+  if (rc != OFDPA_E_NONE)
+  {
+    rc = ofdpaFlowNextGet(&flow, &flow);
+    if ((rc == OFDPA_E_NONE) && includeStats)
+    {
+      rc = ofdpaFlowStatsGet(&flow, &flowStats);
+    }
+  }
+
+  i = 0;
+
+  while ((rc == OFDPA_E_NONE) &&
+         ((entryLimit == 0) || (i < entryLimit)))
+  {
+    recordFlowEntry(rb, &flow, includeStats ? &flowStats : NULL);
+    i++;
+
+    rc = ofdpaFlowNextGet(&flow, &flow);
+    if ((rc == OFDPA_E_NONE) && includeStats &&
+        (ofdpaFlowStatsGet(&flow, &flowStats) != OFDPA_E_NONE))
+    {
+      /* Removed since NextGet; report it without counters */
+      memset(&flowStats, 0, sizeof(flowStats));
+    }
+  }
+
+  recordFlush(rb);
+  free(rb);
+  return i;
+}
+
+/*
+ * Dump every supported table concurrently.  Each table gets its own
+ * process and OF-DPA client so that the walks don't share an RPC
+ * channel; the parent only waits.  COUNT applies to each table.
+ */
+static int dumpFlowTablesParallel(char *clientName, int entryLimit)
+{
+  int j;
+  int failed = 0;
+  int status;
+  pid_t pid;
+  ofdpaFlowTableInfo_t info;
+  char name[64];
+
+  fflush(stdout);
+
+  for (j = 0; j < 256; j++)
+  {
+    if (ofdpaFlowTableSupported(j) != OFDPA_E_NONE)
+    {
+      continue;
+    }
+
+    memset(&info, 0, sizeof(info));
+    if ((ofdpaFlowTableInfoGet(j, &info) == OFDPA_E_NONE) &&
+        (info.numEntries == 0))
+    {
+      continue;
+    }
+
+    pid = fork();
+    if (pid < 0)
+    {
+      perror("fork");
+      failed = 1;
+      break;
+    }
+    if (pid == 0)
+    {
+      snprintf(name, sizeof(name), "%s %d", clientName, j);
+      if (ofdpaClientInitialize(name) != OFDPA_E_NONE)
+      {
+        _exit(1);
+      }
+      dumpFlowTableRecords(j, entryLimit);
+      _exit(0);
+    }
+  }
+
+  while ((pid = wait(&status)) > 0)
+  {
+    if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+    {
+      failed = 1;
+    }
+  }
+
+  return failed;
+}
+
 int main(int argc, char *argv[])
 {
   int i, j, entriesPrinted, totalPrinted, remainingCount;
@@ -205,7 +513,9 @@ int main(int argc, char *argv[])
   strcpy(argsDocBuffer, "[table_ID]");
 
   strcpy(docBuffer, "Prints entries in the OF-DPA flow tables. Specify table ID to print content of a single table. "
-         "If no argument given, content of all tables are printed.\vDefault values:\n");
+         "If no argument given, content of all tables are printed. "
+         "The json and binary formats emit one record per entry for tooling; with --parallel, COUNT applies to each table."
+         "\vDefault values:\n");
   i = strlen(docBuffer);
   i += sprintf(&docBuffer[i], "COUNT     = %d\n", DEFAULT_COUNT);
   i += sprintf(&docBuffer[i], "\n");
@@ -236,6 +546,43 @@ int main(int argc, char *argv[])
 
   totalPrinted = 0;
 
+  if (parallelDump && !tableIdSpecified)
+  {
+    return dumpFlowTablesParallel(client_name, count);
+  }
+
+  if (outputFormat != DUMP_FORMAT_TEXT)
+  {
+    if (tableIdSpecified)
+    {
+      dumpFlowTableRecords(tableId, count);
+    }
+    else
+    {
+      remainingCount = count;
+
+      for (j = 0; j < 256; j++)
+      {
+        if (ofdpaFlowTableSupported(j) == OFDPA_E_NONE)
+        {
+          entriesPrinted = dumpFlowTableRecords(j, remainingCount);
+          if (count != 0)
+          {
+            if (remainingCount > entriesPrinted)
+            {
+              remainingCount -= entriesPrinted;
+            }
+            else
+            {
+              break;
+            }
+          }
+        }
+      }
+    }
+    return 0;
+  }
+
   if (tableIdSpecified)
   {
     dumpFlowTable(tableId, count, &totalPrinted);
@@ -0,0 +1,91 @@
+#! /usr/bin/env python
+
+"""
+Bulk programming helpers for the OF-DPA example scripts.
+
+Each OF-DPA client call adds one flow or group over RPC, and every field
+of a SWIG entry struct written from Python is a separate call into the
+wrapper. Scripts loading large test tables can hand these helpers a whole
+array of rows instead: the entry struct is set up once as a template, the
+proxies of the fields that vary are looked up once, and only those fields
+are written per row before each add.
+
+Rows may be any sequence of tuples, or a buffer (bytes, array.array, a
+numpy array, ...) of fixed-size records described by a struct format,
+e.g. fmt='=I' for an array of IPv4 addresses.
+
+"""
+from OFDPA_python import *
+import struct
+
+def _resolve(entry, path):
+    names = path.split('.')
+    parent = entry
+    for name in names[:-1]:
+        parent = getattr(parent, name)
+    return parent, names[-1]
+
+def _buffer_bytes(rows):
+    for name in ('tobytes', 'tostring'):
+        if hasattr(rows, name):
+            return getattr(rows, name)()
+    return memoryview(rows).tobytes()
+
+def _rows(rows, fmt):
+    if fmt is None:
+        for row in rows:
+            yield row
+        return
+    record = struct.Struct(fmt)
+    data = _buffer_bytes(rows)
+    for offset in range(0, len(data) - len(data) % record.size, record.size):
+        yield record.unpack_from(data, offset)
+
+def flowAddBulk(template, fields, rows, fmt=None):
+    """
+    Add one flow per row to the template's table
+
+    template is an ofdpaFlowEntry_t already set up with ofdpaFlowEntryInit
+    and the fields shared by every row; it is overwritten. fields names the
+    fields a row sets, as dotted paths below the entry, e.g.
+    'flowData.unicastRoutingFlowEntry.match_criteria.dstIp4'.
+
+    Returns the number of flows added and a list of (row index, rc) for the
+    rows that failed.
+    """
+    targets = [_resolve(template, path) for path in fields]
+    failures = []
+    added = 0
+    for index, row in enumerate(_rows(rows, fmt)):
+        for (parent, name), value in zip(targets, row):
+            setattr(parent, name, value)
+        rc = ofdpaFlowAdd(template)
+        if rc == OFDPA_E_NONE:
+            added += 1
+        else:
+            failures.append((index, rc))
+    return added, failures
+
+def groupAddBulk(groups):
+    """
+    Add groups and their buckets
+
+    groups is a sequence of (ofdpaGroupEntry_t, [ofdpaGroupBucketEntry_t])
+    in dependency order. The buckets of a group that failed are not added.
+
+    Returns the number of groups added and a list of (group id, rc) for the
+    groups or buckets that failed.
+    """
+    failures = []
+    added = 0
+    for group, buckets in groups:
+        rc = ofdpaGroupAdd(group)
+        if rc != OFDPA_E_NONE:
+            failures.append((group.groupId, rc))
+            continue
+        added += 1
+        for bucket in buckets:
+            rc = ofdpaGroupBucketEntryAdd(bucket)
+            if rc != OFDPA_E_NONE:
+                failures.append((group.groupId, rc))
+    return added, failures
@@ -7,10 +7,16 @@ script sets up forwarding in one direction.
 This script invokes OF-DPA API services via RPC. The RPC calls are served by the ofdpa
 process running on the switch.
 
+An optional argument loads that many additional /32 routes starting at 10.0.0.0
+through the same next hop, using the bulk helpers in ofdpa_bulk.
+
 """
 from OFDPA_python import *
+import array
 import socket
 import struct
+import sys
+import ofdpa_bulk
 
 def ip2int(addr):
     return struct.unpack("!L", socket.inet_aton(addr))[0]
@@ -101,6 +107,16 @@ def main():
 
         ofdpaFlowAdd(l3UcastRoutingFlowEntry)
 
+        # optionally load a block of routes, reusing the entry as template
+        if len(sys.argv) > 1:
+            firstRoute = ip2int('10.0.0.0')
+            routes = array.array('I', range(firstRoute, firstRoute + int(sys.argv[1])))
+            added, failures = ofdpa_bulk.flowAddBulk(
+                l3UcastRoutingFlowEntry,
+                ['flowData.unicastRoutingFlowEntry.match_criteria.dstIp4'],
+                routes, fmt='=I')
+            print "Added %d routes, %d failed" % (added, len(failures))
+
         # clean up
         delete_uint32_tp(l2IfaceGroupId_p)
         delete_uint32_tp(l3UcastGroupId_p)
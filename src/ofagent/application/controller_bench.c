@@ -0,0 +1,1504 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2015
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     controller_bench.c
+*
+* @purpose      Controller-side OpenFlow load generator for the OF Agent
+*
+* @component    OF-DPA
+*
+* @comments     Acts as the controller for an agent started with
+*               --listen: opens --connections connections to it, and
+*               once each has answered the features request drives a
+*               mix of messages built with loci at --rate messages per
+*               second, spread over the connections in turn.
+*
+*               Flow-mods are OF-DPA valid adds and strict deletes for
+*               the tables given with --tables. Each connection keeps up
+*               to --flows flows of its own per table, adding until it
+*               has them and then deleting its oldest before each add.
+*               Group-mods add and delete L2 interface groups on VLANs
+*               of the connection's own. A barrier follows every
+*               --barrier-every flow-mods, besides the barriers in the
+*               mix; since the agent answers a barrier only after the
+*               messages before it, its reply gives the latency of each
+*               of those flow-mods.
+*
+*               Reported per message kind: messages sent and errors
+*               returned (matched by xid), and histograms of flow-mod to
+*               barrier reply latency, barrier, echo and multipart round
+*               trip times. Messages the agent did not read in time to
+*               keep the rate are counted as stalls, not sent later.
+*
+*               Links with loci and AIM only; nothing of the agent.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <argp.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+#include <AIM/aim.h>
+#include <loci/loci.h>
+#include "ofdpa_datatypes.h"
+
+#define AIM_LOG_MODULE_NAME controller_bench
+
+#include <AIM/aim_log.h>
+
+AIM_LOG_STRUCT_DEFINE(
+                      AIM_LOG_OPTIONS_DEFAULT,
+                      AIM_LOG_BITS_DEFAULT,
+                      NULL,     /* Custom Log Map */
+                      0
+                      );
+
+#define CONTROLLER_BENCH_CONNECTIONS_MAX  64
+
+/* Stop queueing on a connection with this much output not yet written */
+#define CONTROLLER_BENCH_OUTPUT_MAX  (1024 * 1024)
+
+#define CONTROLLER_BENCH_INPUT_SIZE  (128 * 1024)
+
+/* Send times kept per connection, by xid sequence; a power of 2 */
+#define CONTROLLER_BENCH_XID_WINDOW  4096
+
+/* Flow-mods per connection waiting for a barrier reply; a power of 2 */
+#define CONTROLLER_BENCH_PENDING_MAX  65536
+
+/* Barriers per connection waiting for a reply; a power of 2 */
+#define CONTROLLER_BENCH_BARRIERS_MAX  1024
+
+/* How long to wait for the last barrier replies after the run */
+#define CONTROLLER_BENCH_DRAIN_MS  2000
+
+/* Power of 2 microsecond buckets */
+#define CONTROLLER_BENCH_HIST_BUCKETS  32
+
+/* VLAN and port of the L2 interface group bridging flows point at */
+#define CONTROLLER_BENCH_VLAN  1
+
+/* VLANs the group-mods use, split between the connections */
+#define CONTROLLER_BENCH_GROUP_VLAN_FIRST  2
+#define CONTROLLER_BENCH_GROUP_VLANS       4000
+
+#define CONTROLLER_BENCH_PRIORITY  1000
+
+typedef enum
+{
+  CONTROLLER_BENCH_FLOW,
+  CONTROLLER_BENCH_GROUP,
+  CONTROLLER_BENCH_BARRIER,
+  CONTROLLER_BENCH_ECHO,
+  CONTROLLER_BENCH_PACKET_OUT,
+  CONTROLLER_BENCH_MULTIPART,
+  CONTROLLER_BENCH_KIND_COUNT,
+} controller_bench_kind_t;
+
+static const char *controller_bench_kind_names[CONTROLLER_BENCH_KIND_COUNT] =
+{
+  [CONTROLLER_BENCH_FLOW]       = "flow",
+  [CONTROLLER_BENCH_GROUP]      = "group",
+  [CONTROLLER_BENCH_BARRIER]    = "barrier",
+  [CONTROLLER_BENCH_ECHO]       = "echo",
+  [CONTROLLER_BENCH_PACKET_OUT] = "packet_out",
+  [CONTROLLER_BENCH_MULTIPART]  = "multipart",
+};
+
+/* The kind of a request travels in the top byte of its xid */
+#define CONTROLLER_BENCH_XID(kind, seq)  (((uint32_t)(kind) << 24) | ((seq) & 0xffffff))
+#define CONTROLLER_BENCH_XID_KIND(xid)   ((xid) >> 24)
+#define CONTROLLER_BENCH_XID_SEQ(xid)    ((xid) & 0xffffff)
+
+/* Setup messages, whose errors are not counted against a kind */
+#define CONTROLLER_BENCH_XID_SETUP  CONTROLLER_BENCH_XID(0xff, 0)
+
+typedef enum
+{
+  CONTROLLER_BENCH_BRIDGING,
+  CONTROLLER_BENCH_UNICAST,
+  CONTROLLER_BENCH_ACL,
+  CONTROLLER_BENCH_MPLS,
+  CONTROLLER_BENCH_TABLE_COUNT,
+} controller_bench_table_t;
+
+static const struct
+{
+  const char *name;
+  uint8_t     table_id;
+} controller_bench_tables[CONTROLLER_BENCH_TABLE_COUNT] =
+{
+  [CONTROLLER_BENCH_BRIDGING] = { "bridging", OFDPA_FLOW_TABLE_ID_BRIDGING },
+  [CONTROLLER_BENCH_UNICAST]  = { "unicast",  OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING },
+  [CONTROLLER_BENCH_ACL]      = { "acl",      OFDPA_FLOW_TABLE_ID_ACL_POLICY },
+  [CONTROLLER_BENCH_MPLS]     = { "mpls",     OFDPA_FLOW_TABLE_ID_MPLS_1 },
+};
+
+typedef struct
+{
+  char     *agent;
+  uint32_t connections;
+  uint32_t rate;
+  uint32_t duration;
+  uint32_t flows;
+  uint32_t barrier_every;
+  uint32_t port;
+  uint32_t mix[CONTROLLER_BENCH_KIND_COUNT];
+  int      tables[CONTROLLER_BENCH_TABLE_COUNT];
+  uint32_t table_count;
+} arguments_t;
+
+typedef struct
+{
+  uint64_t count;
+  uint64_t sum_us;
+  uint64_t max_us;
+  uint64_t buckets[CONTROLLER_BENCH_HIST_BUCKETS];
+} controller_bench_hist_t;
+
+/* Flows a connection has added to and deleted from a table */
+typedef struct
+{
+  uint32_t added;
+  uint32_t deleted;
+} controller_bench_table_state_t;
+
+typedef struct
+{
+  uint32_t id;
+  uint32_t flow_mark;   /* pending_tail when the barrier was sent */
+} controller_bench_barrier_t;
+
+typedef struct
+{
+  int       fd;
+  uint32_t  index;
+  int       ready;                  /* Features reply seen */
+
+  uint8_t   *out;
+  uint32_t  out_len;
+  uint32_t  out_size;
+  uint8_t   *in;
+  uint32_t  in_len;
+
+  uint32_t  seq;
+  uint64_t  *sent_ns;               /* By xid sequence */
+
+  uint64_t  *pending;               /* Send times of flow-mods */
+  uint32_t  pending_head;
+  uint32_t  pending_tail;
+  uint32_t  flow_mods_unbarriered;
+  controller_bench_barrier_t barriers[CONTROLLER_BENCH_BARRIERS_MAX];
+  uint32_t  barrier_head;
+  uint32_t  barrier_tail;
+
+  controller_bench_table_state_t tables[CONTROLLER_BENCH_TABLE_COUNT];
+  uint32_t  next_table;
+  uint32_t  groups;                 /* Group-mods sent */
+  uint32_t  multiparts;             /* Multipart requests sent */
+} controller_bench_cxn_t;
+
+static struct argp_option options[] =
+{
+  { "agent",         'a', "IP:PORT", 0, "Address the agent listens on for controllers." },
+  { "connections",   'c', "COUNT",   0, "Number of controller connections." },
+  { "rate",          'r', "MSGS",    0, "Messages per second over all connections." },
+  { "duration",      'd', "SECS",    0, "Length of the run." },
+  { "tables",        't', "LIST",    0, "Comma separated flow tables: bridging, unicast, acl, mpls." },
+  { "flows",         'n', "COUNT",   0, "Flows each connection keeps per table." },
+  { "barrier-every", 'b', "COUNT",   0, "Send a barrier after every COUNT flow-mods." },
+  { "port",          'p', "PORT",    0, "Port the groups and packet-outs use." },
+  { "mix",           'm', "KIND=WEIGHT,...", 0, "Message mix over flow, group, barrier, echo, packet_out and multipart." },
+  { 0 }
+};
+
+static controller_bench_cxn_t controller_bench_cxns[CONTROLLER_BENCH_CONNECTIONS_MAX];
+static of_list_instruction_t *controller_bench_insts[CONTROLLER_BENCH_TABLE_COUNT];
+
+static uint64_t controller_bench_sent[CONTROLLER_BENCH_KIND_COUNT];
+static uint64_t controller_bench_errors[CONTROLLER_BENCH_KIND_COUNT];
+static uint64_t controller_bench_setup_errors;
+static uint64_t controller_bench_stalls;
+static uint64_t controller_bench_received;
+static uint64_t controller_bench_packet_ins;
+
+static controller_bench_hist_t controller_bench_flow_hist;
+static controller_bench_hist_t controller_bench_barrier_hist;
+static controller_bench_hist_t controller_bench_echo_hist;
+static controller_bench_hist_t controller_bench_multipart_hist;
+
+static int
+controller_bench_mix_parse(char *arg, arguments_t *arguments)
+{
+  char *item, *value, *endptr, *state = NULL;
+  int kind;
+
+  memset(arguments->mix, 0, sizeof(arguments->mix));
+
+  for (item = strtok_r(arg, ",", &state); item != NULL; item = strtok_r(NULL, ",", &state))
+  {
+    if ((value = strchr(item, '=')) == NULL)
+    {
+      return -1;
+    }
+    *value++ = '\0';
+
+    for (kind = 0; kind < CONTROLLER_BENCH_KIND_COUNT; kind++)
+    {
+      if (strcmp(item, controller_bench_kind_names[kind]) == 0)
+      {
+        break;
+      }
+    }
+    if (kind == CONTROLLER_BENCH_KIND_COUNT)
+    {
+      return -1;
+    }
+
+    errno = 0;
+    arguments->mix[kind] = strtoul(value, &endptr, 0);
+    if ((errno != 0) || (*endptr != '\0') || (arguments->mix[kind] > 1000))
+    {
+      return -1;
+    }
+  }
+
+  for (kind = 0; kind < CONTROLLER_BENCH_KIND_COUNT; kind++)
+  {
+    if (arguments->mix[kind] != 0)
+    {
+      return 0;
+    }
+  }
+  return -1;
+}
+
+static int
+controller_bench_tables_parse(char *arg, arguments_t *arguments)
+{
+  char *item, *state = NULL;
+  int i;
+
+  arguments->table_count = 0;
+
+  for (item = strtok_r(arg, ",", &state); item != NULL; item = strtok_r(NULL, ",", &state))
+  {
+    for (i = 0; i < CONTROLLER_BENCH_TABLE_COUNT; i++)
+    {
+      if (strcmp(item, controller_bench_tables[i].name) == 0)
+      {
+        break;
+      }
+    }
+    if ((i == CONTROLLER_BENCH_TABLE_COUNT) ||
+        (arguments->table_count == CONTROLLER_BENCH_TABLE_COUNT))
+    {
+      return -1;
+    }
+    arguments->tables[arguments->table_count++] = i;
+  }
+
+  return (arguments->table_count > 0) ? 0 : -1;
+}
+
+/* Parse a single option. */
+static error_t parse_opt(int key, char *arg, struct argp_state *state)
+{
+  arguments_t *arguments = state->input;
+  unsigned long long value;
+  char *endptr;
+
+  switch (key)
+  {
+    case 'a':                           /* agent */
+      arguments->agent = arg;
+      return 0;
+
+    case 't':                           /* tables */
+      if (controller_bench_tables_parse(arg, arguments) < 0)
+      {
+        argp_error(state, "Invalid tables \"%s\"", arg);
+        return EINVAL;
+      }
+      return 0;
+
+    case 'm':                           /* mix */
+      if (controller_bench_mix_parse(arg, arguments) < 0)
+      {
+        argp_error(state, "Invalid mix \"%s\"", arg);
+        return EINVAL;
+      }
+      return 0;
+
+    case 'c':
+    case 'r':
+    case 'd':
+    case 'n':
+    case 'b':
+    case 'p':
+      errno = 0;
+      value = strtoull(arg, &endptr, 0);
+      if ((errno != 0) || (*endptr != '\0') || (value == 0) || (value > 0xffffffff))
+      {
+        argp_error(state, "Invalid value \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case ARGP_KEY_NO_ARGS:
+    case ARGP_KEY_END:
+      return 0;
+
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+
+  switch (key)
+  {
+    case 'c':                           /* connections */
+      if (value > CONTROLLER_BENCH_CONNECTIONS_MAX)
+      {
+        argp_error(state, "At most %d connections", CONTROLLER_BENCH_CONNECTIONS_MAX);
+        return EINVAL;
+      }
+      arguments->connections = value;
+      break;
+
+    case 'r':                           /* rate */
+      arguments->rate = value;
+      break;
+
+    case 'd':                           /* duration */
+      arguments->duration = value;
+      break;
+
+    case 'n':                           /* flows */
+      if (value > 0xfffff)
+      {
+        argp_error(state, "At most %d flows per table", 0xfffff);
+        return EINVAL;
+      }
+      arguments->flows = value;
+      break;
+
+    case 'b':                           /* barrier-every */
+      if (value >= CONTROLLER_BENCH_PENDING_MAX / CONTROLLER_BENCH_BARRIERS_MAX)
+      {
+        argp_error(state, "At most %d flow-mods between barriers",
+                   CONTROLLER_BENCH_PENDING_MAX / CONTROLLER_BENCH_BARRIERS_MAX - 1);
+        return EINVAL;
+      }
+      arguments->barrier_every = value;
+      break;
+
+    case 'p':                           /* port */
+      if (value > 0xffff)
+      {
+        argp_error(state, "Invalid port \"%s\"", arg);
+        return EINVAL;
+      }
+      arguments->port = value;
+      break;
+  }
+  return 0;
+}
+
+/****************************************************************
+ * Measurement
+ ****************************************************************/
+
+static uint64_t
+controller_bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void
+controller_bench_hist_add(controller_bench_hist_t *hist, uint64_t ns)
+{
+  uint64_t us = ns / 1000;
+  int bucket = 0;
+
+  while ((bucket < CONTROLLER_BENCH_HIST_BUCKETS - 1) && (us >> (bucket + 1)) != 0)
+  {
+    bucket++;
+  }
+
+  hist->buckets[bucket]++;
+  hist->count++;
+  hist->sum_us += us;
+  if (us > hist->max_us)
+  {
+    hist->max_us = us;
+  }
+}
+
+/* Upper bound, in microseconds, of the bucket holding the given percentile */
+static uint64_t
+controller_bench_hist_percentile(const controller_bench_hist_t *hist, int percent)
+{
+  uint64_t want = (hist->count * percent + 99) / 100;
+  uint64_t seen = 0;
+  int bucket;
+
+  for (bucket = 0; bucket < CONTROLLER_BENCH_HIST_BUCKETS; bucket++)
+  {
+    seen += hist->buckets[bucket];
+    if (seen >= want)
+    {
+      break;
+    }
+  }
+  return 2ULL << bucket;
+}
+
+static void
+controller_bench_hist_show(const char *name, const controller_bench_hist_t *hist)
+{
+  uint64_t peak = 0;
+  int bucket, first = -1, last = -1;
+
+  printf("%s: %" PRIu64 " samples", name, hist->count);
+  if (hist->count == 0)
+  {
+    printf("\n");
+    return;
+  }
+  printf(", mean %" PRIu64 " us, p50 < %" PRIu64 " us, p99 < %" PRIu64 " us, max %" PRIu64 " us\n",
+         hist->sum_us / hist->count,
+         controller_bench_hist_percentile(hist, 50),
+         controller_bench_hist_percentile(hist, 99),
+         hist->max_us);
+
+  for (bucket = 0; bucket < CONTROLLER_BENCH_HIST_BUCKETS; bucket++)
+  {
+    if (hist->buckets[bucket] != 0)
+    {
+      if (first < 0)
+      {
+        first = bucket;
+      }
+      last = bucket;
+      if (hist->buckets[bucket] > peak)
+      {
+        peak = hist->buckets[bucket];
+      }
+    }
+  }
+
+  for (bucket = first; bucket <= last; bucket++)
+  {
+    printf("  %10llu - %-10llu us %10" PRIu64 " %.*s\n",
+           bucket ? 1ULL << bucket : 0ULL, (2ULL << bucket) - 1,
+           hist->buckets[bucket],
+           (int)(hist->buckets[bucket] * 50 / peak),
+           "##################################################");
+  }
+}
+
+/****************************************************************
+ * Message building
+ ****************************************************************/
+
+static of_match_t *
+controller_bench_match_build(controller_bench_table_t table, uint32_t i,
+                             of_match_t *match)
+{
+  memset(match, 0, sizeof(*match));
+  match->version = OF_VERSION_1_3;
+
+  switch (table)
+  {
+    case CONTROLLER_BENCH_BRIDGING:
+      match->fields.vlan_vid = OFDPA_VID_PRESENT | CONTROLLER_BENCH_VLAN;
+      match->masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+      match->fields.eth_dst.addr[0] = 0x02;
+      match->fields.eth_dst.addr[2] = i >> 24;
+      match->fields.eth_dst.addr[3] = i >> 16;
+      match->fields.eth_dst.addr[4] = i >> 8;
+      match->fields.eth_dst.addr[5] = i;
+      memset(match->masks.eth_dst.addr, 0xff, OF_MAC_ADDR_BYTES);
+      break;
+
+    case CONTROLLER_BENCH_UNICAST:
+      match->fields.eth_type = 0x0800;
+      match->masks.eth_type = 0xffff;
+      match->fields.ipv4_dst = 0x0a000000 | (i & 0xffffff);
+      match->masks.ipv4_dst = 0xffffffff;
+      break;
+
+    case CONTROLLER_BENCH_ACL:
+      match->fields.eth_type = 0x0800;
+      match->masks.eth_type = 0xffff;
+      match->fields.ipv4_src = 0x0a000000 | (i & 0xffffff);
+      match->masks.ipv4_src = 0xffffffff;
+      match->fields.ip_proto = 6;
+      match->masks.ip_proto = 0xff;
+      break;
+
+    case CONTROLLER_BENCH_MPLS:
+    default:
+      match->fields.eth_type = 0x8847;
+      match->masks.eth_type = 0xffff;
+      match->fields.mpls_label = 16 + (i & 0xfffff);
+      match->masks.mpls_label = 0xfffff;
+      match->fields.mpls_bos = 1;
+      match->masks.mpls_bos = 1;
+      break;
+  }
+
+  return match;
+}
+
+/* The same instructions as flowmod_bench, built once per table */
+static of_list_instruction_t *
+controller_bench_instructions_build(controller_bench_table_t table, uint32_t port)
+{
+  of_list_instruction_t *insts;
+  of_object_t *inst = NULL;
+  of_object_t *action = NULL;
+  of_list_action_t *actions = NULL;
+  int rv = -1;
+
+  if ((insts = of_list_instruction_new(OF_VERSION_1_3)) == NULL)
+  {
+    return NULL;
+  }
+
+  switch (table)
+  {
+    case CONTROLLER_BENCH_BRIDGING:
+      if ((inst = of_instruction_write_actions_new(OF_VERSION_1_3)) == NULL ||
+          (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+          (action = of_action_group_new(OF_VERSION_1_3)) == NULL)
+      {
+        goto done;
+      }
+      of_action_group_group_id_set(action, (CONTROLLER_BENCH_VLAN << 16) | port);
+      if (of_list_append(actions, action) < 0 ||
+          of_instruction_write_actions_actions_set(inst, actions) < 0 ||
+          of_list_append(insts, inst) < 0)
+      {
+        goto done;
+      }
+      break;
+
+    case CONTROLLER_BENCH_ACL:
+      /* Drop */
+      if ((inst = of_instruction_clear_actions_new(OF_VERSION_1_3)) == NULL ||
+          of_list_append(insts, inst) < 0)
+      {
+        goto done;
+      }
+      break;
+
+    case CONTROLLER_BENCH_MPLS:
+      if ((inst = of_instruction_apply_actions_new(OF_VERSION_1_3)) == NULL ||
+          (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+          (action = of_action_pop_mpls_new(OF_VERSION_1_3)) == NULL)
+      {
+        goto done;
+      }
+      of_action_pop_mpls_ethertype_set(action, 0x0800);
+      if (of_list_append(actions, action) < 0 ||
+          of_instruction_apply_actions_actions_set(inst, actions) < 0 ||
+          of_list_append(insts, inst) < 0)
+      {
+        goto done;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  if (inst != NULL)
+  {
+    of_object_delete(inst);
+    inst = NULL;
+  }
+
+  if (table != CONTROLLER_BENCH_ACL)
+  {
+    if ((inst = of_instruction_goto_table_new(OF_VERSION_1_3)) == NULL)
+    {
+      goto done;
+    }
+    of_instruction_goto_table_table_id_set(inst,
+        table == CONTROLLER_BENCH_MPLS ? OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING :
+                                         OFDPA_FLOW_TABLE_ID_ACL_POLICY);
+    if (of_list_append(insts, inst) < 0)
+    {
+      goto done;
+    }
+  }
+
+  rv = 0;
+
+done:
+  if (action != NULL)
+  {
+    of_object_delete(action);
+  }
+  if (actions != NULL)
+  {
+    of_object_delete(actions);
+  }
+  if (inst != NULL)
+  {
+    of_object_delete(inst);
+  }
+  if (rv < 0)
+  {
+    of_object_delete(insts);
+    return NULL;
+  }
+  return insts;
+}
+
+/* Flow index of a connection's n'th flow in a table */
+#define CONTROLLER_BENCH_FLOW_INDEX(cxn, n, flows) \
+  (((cxn)->index << 20) | ((n) % (flows)))
+
+static of_object_t *
+controller_bench_flow_build(controller_bench_cxn_t *cxn, const arguments_t *arguments)
+{
+  controller_bench_table_t table = arguments->tables[cxn->next_table++ % arguments->table_count];
+  controller_bench_table_state_t *state = &cxn->tables[table];
+  uint8_t table_id = controller_bench_tables[table].table_id;
+  of_flow_delete_strict_t *flow_del;
+  of_flow_add_t *flow_add;
+  of_match_t match;
+  uint32_t i;
+
+  if (state->added - state->deleted >= arguments->flows)
+  {
+    i = CONTROLLER_BENCH_FLOW_INDEX(cxn, state->deleted, arguments->flows);
+    if ((flow_del = of_flow_delete_strict_new(OF_VERSION_1_3)) == NULL)
+    {
+      return NULL;
+    }
+    of_flow_delete_strict_table_id_set(flow_del, table_id);
+    of_flow_delete_strict_priority_set(flow_del, CONTROLLER_BENCH_PRIORITY);
+    of_flow_delete_strict_buffer_id_set(flow_del, OF_BUFFER_ID_NO_BUFFER);
+    of_flow_delete_strict_out_port_set(flow_del, OF_PORT_DEST_WILDCARD);
+    of_flow_delete_strict_out_group_set(flow_del, OF_GROUP_ANY);
+    if (of_flow_delete_strict_match_set(flow_del, controller_bench_match_build(table, i, &match)) < 0)
+    {
+      of_object_delete(flow_del);
+      return NULL;
+    }
+    state->deleted++;
+    return flow_del;
+  }
+
+  i = CONTROLLER_BENCH_FLOW_INDEX(cxn, state->added, arguments->flows);
+  if ((flow_add = of_flow_add_new(OF_VERSION_1_3)) == NULL)
+  {
+    return NULL;
+  }
+  of_flow_add_table_id_set(flow_add, table_id);
+  of_flow_add_priority_set(flow_add, CONTROLLER_BENCH_PRIORITY);
+  of_flow_add_cookie_set(flow_add, i);
+  of_flow_add_buffer_id_set(flow_add, OF_BUFFER_ID_NO_BUFFER);
+  of_flow_add_out_port_set(flow_add, OF_PORT_DEST_WILDCARD);
+  of_flow_add_out_group_set(flow_add, OF_GROUP_ANY);
+  if (of_flow_add_match_set(flow_add, controller_bench_match_build(table, i, &match)) < 0 ||
+      of_flow_add_instructions_set(flow_add, controller_bench_insts[table]) < 0)
+  {
+    of_object_delete(flow_add);
+    return NULL;
+  }
+  state->added++;
+  return flow_add;
+}
+
+/* An L2 interface group: output to port */
+static of_object_t *
+controller_bench_group_add_build(uint32_t vlan, uint32_t port)
+{
+  of_group_add_t *group_add;
+  of_list_bucket_t *buckets = NULL;
+  of_bucket_t *bucket = NULL;
+  of_list_action_t *actions = NULL;
+  of_action_output_t *output = NULL;
+  int rv = -1;
+
+  if ((group_add = of_group_add_new(OF_VERSION_1_3)) == NULL ||
+      (buckets = of_list_bucket_new(OF_VERSION_1_3)) == NULL ||
+      (bucket = of_bucket_new(OF_VERSION_1_3)) == NULL ||
+      (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+      (output = of_action_output_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto done;
+  }
+
+  of_group_add_group_type_set(group_add, OF_GROUP_TYPE_INDIRECT);
+  of_group_add_group_id_set(group_add, (vlan << 16) | port);
+  of_action_output_port_set(output, port);
+  of_bucket_watch_port_set(bucket, OF_PORT_DEST_WILDCARD);
+  of_bucket_watch_group_set(bucket, OF_GROUP_ANY);
+  if (of_list_append(actions, output) < 0 ||
+      of_bucket_actions_set(bucket, actions) < 0 ||
+      of_list_append(buckets, bucket) < 0 ||
+      of_group_add_buckets_set(group_add, buckets) < 0)
+  {
+    goto done;
+  }
+  rv = 0;
+
+done:
+  if (output != NULL)
+  {
+    of_object_delete(output);
+  }
+  if (actions != NULL)
+  {
+    of_object_delete(actions);
+  }
+  if (bucket != NULL)
+  {
+    of_object_delete(bucket);
+  }
+  if (buckets != NULL)
+  {
+    of_object_delete(buckets);
+  }
+  if (rv < 0 && group_add != NULL)
+  {
+    of_object_delete(group_add);
+    group_add = NULL;
+  }
+  return group_add;
+}
+
+/* Add a group on the connection's next VLAN, then delete it again */
+static of_object_t *
+controller_bench_group_build(controller_bench_cxn_t *cxn, const arguments_t *arguments)
+{
+  uint32_t span = CONTROLLER_BENCH_GROUP_VLANS / arguments->connections;
+  uint32_t vlan = CONTROLLER_BENCH_GROUP_VLAN_FIRST + cxn->index * span +
+                  (cxn->groups / 2) % span;
+  of_group_delete_t *group_del;
+
+  if ((cxn->groups++ % 2) == 0)
+  {
+    return controller_bench_group_add_build(vlan, arguments->port);
+  }
+
+  if ((group_del = of_group_delete_new(OF_VERSION_1_3)) != NULL)
+  {
+    of_group_delete_group_type_set(group_del, OF_GROUP_TYPE_INDIRECT);
+    of_group_delete_group_id_set(group_del, (vlan << 16) | arguments->port);
+  }
+  return group_del;
+}
+
+/* A 64 byte UDP frame out of the port */
+static of_object_t *
+controller_bench_packet_out_build(const arguments_t *arguments)
+{
+  static uint8_t frame[64] =
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02,       /* eth_dst */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01,       /* eth_src */
+    0x08, 0x00,                               /* IPv4 */
+    0x45, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x11, 0x00, 0x00,                   /* TTL 64, UDP */
+    0x0a, 0x00, 0x00, 0x01,                   /* 10.0.0.1 */
+    0x0a, 0x00, 0x00, 0x02,                   /* 10.0.0.2 */
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x1e, 0x00, 0x00,
+  };
+  of_packet_out_t *packet_out;
+  of_list_action_t *actions = NULL;
+  of_action_output_t *output = NULL;
+  of_octets_t data = { .data = frame, .bytes = sizeof(frame) };
+  int rv = -1;
+
+  if ((packet_out = of_packet_out_new(OF_VERSION_1_3)) == NULL ||
+      (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+      (output = of_action_output_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto done;
+  }
+
+  of_packet_out_buffer_id_set(packet_out, OF_BUFFER_ID_NO_BUFFER);
+  of_packet_out_in_port_set(packet_out, OF_PORT_DEST_CONTROLLER);
+  of_action_output_port_set(output, arguments->port);
+  if (of_list_append(actions, output) < 0 ||
+      of_packet_out_actions_set(packet_out, actions) < 0 ||
+      of_packet_out_data_set(packet_out, &data) < 0)
+  {
+    goto done;
+  }
+  rv = 0;
+
+done:
+  if (output != NULL)
+  {
+    of_object_delete(output);
+  }
+  if (actions != NULL)
+  {
+    of_object_delete(actions);
+  }
+  if (rv < 0 && packet_out != NULL)
+  {
+    of_object_delete(packet_out);
+    packet_out = NULL;
+  }
+  return packet_out;
+}
+
+/* Port stats for all ports and flow stats for a table, in turn */
+static of_object_t *
+controller_bench_multipart_build(controller_bench_cxn_t *cxn, const arguments_t *arguments)
+{
+  of_port_stats_request_t *port_stats;
+  of_flow_stats_request_t *flow_stats;
+  of_match_t match;
+
+  if ((cxn->multiparts++ % 2) == 0)
+  {
+    if ((port_stats = of_port_stats_request_new(OF_VERSION_1_3)) != NULL)
+    {
+      of_port_stats_request_port_no_set(port_stats, OF_PORT_DEST_WILDCARD);
+    }
+    return port_stats;
+  }
+
+  if ((flow_stats = of_flow_stats_request_new(OF_VERSION_1_3)) == NULL)
+  {
+    return NULL;
+  }
+  memset(&match, 0, sizeof(match));
+  match.version = OF_VERSION_1_3;
+  of_flow_stats_request_table_id_set(flow_stats,
+      controller_bench_tables[arguments->tables[cxn->multiparts / 2 % arguments->table_count]].table_id);
+  of_flow_stats_request_out_port_set(flow_stats, OF_PORT_DEST_WILDCARD);
+  of_flow_stats_request_out_group_set(flow_stats, OF_GROUP_ANY);
+  if (of_flow_stats_request_match_set(flow_stats, &match) < 0)
+  {
+    of_object_delete(flow_stats);
+    return NULL;
+  }
+  return flow_stats;
+}
+
+/****************************************************************
+ * Connections
+ ****************************************************************/
+
+/* Queue the wire form of obj with the given xid and free obj */
+static int
+controller_bench_queue(controller_bench_cxn_t *cxn, of_object_t *obj, uint32_t xid)
+{
+  uint8_t *data;
+  uint32_t size;
+
+  if (cxn->out_len + obj->length > cxn->out_size)
+  {
+    size = cxn->out_size ? cxn->out_size : 65536;
+    while (size < cxn->out_len + obj->length)
+    {
+      size *= 2;
+    }
+    if ((data = realloc(cxn->out, size)) == NULL)
+    {
+      of_object_delete(obj);
+      return -1;
+    }
+    cxn->out = data;
+    cxn->out_size = size;
+  }
+
+  data = cxn->out + cxn->out_len;
+  memcpy(data, OF_OBJECT_BUFFER_INDEX(obj, 0), obj->length);
+  xid = htonl(xid);
+  memcpy(data + OF_MESSAGE_XID_OFFSET, &xid, sizeof(xid));
+  cxn->out_len += obj->length;
+  of_object_delete(obj);
+  return 0;
+}
+
+static void
+controller_bench_barrier_send(controller_bench_cxn_t *cxn, uint64_t now)
+{
+  of_object_t *obj;
+  uint32_t seq = cxn->seq++;
+
+  if ((cxn->barrier_tail - cxn->barrier_head == CONTROLLER_BENCH_BARRIERS_MAX) ||
+      (obj = of_barrier_request_new(OF_VERSION_1_3)) == NULL ||
+      controller_bench_queue(cxn, obj, CONTROLLER_BENCH_XID(CONTROLLER_BENCH_BARRIER, seq)) < 0)
+  {
+    return;
+  }
+
+  cxn->sent_ns[seq & (CONTROLLER_BENCH_XID_WINDOW - 1)] = now;
+  cxn->barriers[cxn->barrier_tail % CONTROLLER_BENCH_BARRIERS_MAX].id = CONTROLLER_BENCH_XID_SEQ(seq);
+  cxn->barriers[cxn->barrier_tail % CONTROLLER_BENCH_BARRIERS_MAX].flow_mark = cxn->pending_tail;
+  cxn->barrier_tail++;
+  cxn->flow_mods_unbarriered = 0;
+  controller_bench_sent[CONTROLLER_BENCH_BARRIER]++;
+}
+
+/* Build and queue one message of the given kind */
+static int
+controller_bench_send(controller_bench_cxn_t *cxn, controller_bench_kind_t kind,
+                      const arguments_t *arguments, uint64_t now)
+{
+  of_object_t *obj = NULL;
+  uint32_t seq;
+
+  if (kind == CONTROLLER_BENCH_BARRIER)
+  {
+    controller_bench_barrier_send(cxn, now);
+    return 0;
+  }
+
+  /* Room for the flow-mod and the barrier that may follow it */
+  if ((kind == CONTROLLER_BENCH_FLOW) &&
+      ((cxn->pending_tail - cxn->pending_head == CONTROLLER_BENCH_PENDING_MAX) ||
+       (cxn->barrier_tail - cxn->barrier_head == CONTROLLER_BENCH_BARRIERS_MAX)))
+  {
+    return -1;
+  }
+
+  switch (kind)
+  {
+    case CONTROLLER_BENCH_FLOW:
+      obj = controller_bench_flow_build(cxn, arguments);
+      break;
+    case CONTROLLER_BENCH_GROUP:
+      obj = controller_bench_group_build(cxn, arguments);
+      break;
+    case CONTROLLER_BENCH_ECHO:
+      obj = of_echo_request_new(OF_VERSION_1_3);
+      break;
+    case CONTROLLER_BENCH_PACKET_OUT:
+      obj = controller_bench_packet_out_build(arguments);
+      break;
+    case CONTROLLER_BENCH_MULTIPART:
+      obj = controller_bench_multipart_build(cxn, arguments);
+      break;
+    default:
+      break;
+  }
+
+  seq = cxn->seq++;
+  if (obj == NULL || controller_bench_queue(cxn, obj, CONTROLLER_BENCH_XID(kind, seq)) < 0)
+  {
+    AIM_LOG_ERROR("Failed to build a %s message", controller_bench_kind_names[kind]);
+    return -1;
+  }
+  cxn->sent_ns[seq & (CONTROLLER_BENCH_XID_WINDOW - 1)] = now;
+  controller_bench_sent[kind]++;
+
+  if (kind == CONTROLLER_BENCH_FLOW)
+  {
+    cxn->pending[cxn->pending_tail++ % CONTROLLER_BENCH_PENDING_MAX] = now;
+    if (++cxn->flow_mods_unbarriered >= arguments->barrier_every)
+    {
+      controller_bench_barrier_send(cxn, now);
+    }
+  }
+  return 0;
+}
+
+/* Barrier replies come in order; each settles the flow-mods before it */
+static void
+controller_bench_barrier_reply(controller_bench_cxn_t *cxn, uint32_t xid, uint64_t now)
+{
+  controller_bench_barrier_t *barrier;
+
+  if (cxn->barrier_head == cxn->barrier_tail)
+  {
+    return;
+  }
+  barrier = &cxn->barriers[cxn->barrier_head % CONTROLLER_BENCH_BARRIERS_MAX];
+  if (barrier->id != CONTROLLER_BENCH_XID_SEQ(xid))
+  {
+    AIM_LOG_ERROR("Connection %u: barrier reply out of order", cxn->index);
+    return;
+  }
+  cxn->barrier_head++;
+
+  controller_bench_hist_add(&controller_bench_barrier_hist,
+                            now - cxn->sent_ns[xid & (CONTROLLER_BENCH_XID_WINDOW - 1)]);
+  while (cxn->pending_head != barrier->flow_mark)
+  {
+    controller_bench_hist_add(&controller_bench_flow_hist,
+                              now - cxn->pending[cxn->pending_head++ % CONTROLLER_BENCH_PENDING_MAX]);
+  }
+}
+
+static void
+controller_bench_message(controller_bench_cxn_t *cxn, uint8_t *msg, uint64_t now)
+{
+  uint32_t xid = of_message_xid_get(msg);
+  uint8_t type = of_message_type_get(msg);
+  uint16_t flags;
+  of_object_t *obj;
+
+  controller_bench_received++;
+
+  if (type == OF_OBJ_TYPE_ECHO_REQUEST)
+  {
+    if ((obj = of_echo_reply_new(OF_VERSION_1_3)) != NULL)
+    {
+      (void)controller_bench_queue(cxn, obj, xid);
+    }
+  }
+  else if (type == OF_OBJ_TYPE_ECHO_REPLY)
+  {
+    controller_bench_hist_add(&controller_bench_echo_hist,
+                              now - cxn->sent_ns[xid & (CONTROLLER_BENCH_XID_WINDOW - 1)]);
+  }
+  else if (type == OF_OBJ_TYPE_FEATURES_REPLY)
+  {
+    cxn->ready = 1;
+  }
+  else if (type == OF_OBJ_TYPE_ERROR)
+  {
+    if (CONTROLLER_BENCH_XID_KIND(xid) < CONTROLLER_BENCH_KIND_COUNT)
+    {
+      controller_bench_errors[CONTROLLER_BENCH_XID_KIND(xid)]++;
+    }
+    else
+    {
+      controller_bench_setup_errors++;
+    }
+  }
+  else if (type == OF_OBJ_TYPE_BARRIER_REPLY_BY_VERSION(OF_VERSION_1_3))
+  {
+    controller_bench_barrier_reply(cxn, xid, now);
+  }
+  else if (type == OF_OBJ_TYPE_STATS_REPLY_BY_VERSION(OF_VERSION_1_3))
+  {
+    buf_u16_get(msg + OF_MESSAGE_STATS_TYPE_OFFSET + 2, &flags);
+    if (!(flags & OF_STATS_REPLY_FLAG_REPLY_MORE))
+    {
+      controller_bench_hist_add(&controller_bench_multipart_hist,
+                                now - cxn->sent_ns[xid & (CONTROLLER_BENCH_XID_WINDOW - 1)]);
+    }
+  }
+  else if (type == OF_OBJ_TYPE_PACKET_IN)
+  {
+    controller_bench_packet_ins++;
+  }
+}
+
+/* Read what the agent sent and handle every whole message */
+static int
+controller_bench_read(controller_bench_cxn_t *cxn, uint64_t now)
+{
+  uint32_t off, len;
+  int n;
+
+  n = recv(cxn->fd, cxn->in + cxn->in_len, CONTROLLER_BENCH_INPUT_SIZE - cxn->in_len, 0);
+  if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR))
+  {
+    AIM_LOG_ERROR("Connection %u closed by the agent", cxn->index);
+    return -1;
+  }
+  if (n < 0)
+  {
+    return 0;
+  }
+  cxn->in_len += n;
+
+  for (off = 0; cxn->in_len - off >= OF_MESSAGE_HEADER_LENGTH; off += len)
+  {
+    len = of_message_length_get(cxn->in + off);
+    if (len < OF_MESSAGE_HEADER_LENGTH)
+    {
+      AIM_LOG_ERROR("Connection %u: bad message length %u", cxn->index, len);
+      return -1;
+    }
+    if (cxn->in_len - off < len)
+    {
+      break;
+    }
+    controller_bench_message(cxn, cxn->in + off, now);
+  }
+
+  memmove(cxn->in, cxn->in + off, cxn->in_len - off);
+  cxn->in_len -= off;
+  return 0;
+}
+
+static int
+controller_bench_write(controller_bench_cxn_t *cxn)
+{
+  int n;
+
+  if (cxn->out_len == 0)
+  {
+    return 0;
+  }
+
+  n = send(cxn->fd, cxn->out, cxn->out_len, MSG_NOSIGNAL | MSG_DONTWAIT);
+  if (n < 0)
+  {
+    return (errno == EAGAIN || errno == EINTR) ? 0 : -1;
+  }
+  memmove(cxn->out, cxn->out + n, cxn->out_len - n);
+  cxn->out_len -= n;
+  return 0;
+}
+
+static int
+controller_bench_connect(controller_bench_cxn_t *cxn, uint32_t index,
+                         const struct sockaddr_in *sa, int bridging)
+{
+  of_object_t *obj;
+  int one = 1;
+
+  cxn->index = index;
+  if ((cxn->in = malloc(CONTROLLER_BENCH_INPUT_SIZE)) == NULL ||
+      (cxn->sent_ns = calloc(CONTROLLER_BENCH_XID_WINDOW, sizeof(*cxn->sent_ns))) == NULL ||
+      (cxn->pending = calloc(CONTROLLER_BENCH_PENDING_MAX, sizeof(*cxn->pending))) == NULL)
+  {
+    return -1;
+  }
+
+  if ((cxn->fd = socket(AF_INET, SOCK_STREAM, 0)) < 0 ||
+      connect(cxn->fd, (const struct sockaddr *)sa, sizeof(*sa)) < 0)
+  {
+    AIM_LOG_ERROR("Failed to connect to the agent: %s", strerror(errno));
+    return -1;
+  }
+  (void)setsockopt(cxn->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  (void)fcntl(cxn->fd, F_SETFL, fcntl(cxn->fd, F_GETFL) | O_NONBLOCK);
+
+  if ((obj = of_hello_new(OF_VERSION_1_3)) == NULL ||
+      controller_bench_queue(cxn, obj, CONTROLLER_BENCH_XID_SETUP) < 0 ||
+      (obj = of_features_request_new(OF_VERSION_1_3)) == NULL ||
+      controller_bench_queue(cxn, obj, CONTROLLER_BENCH_XID_SETUP) < 0)
+  {
+    return -1;
+  }
+
+  /* The group the bridging flows of every connection write to */
+  if (bridging &&
+      ((obj = controller_bench_group_add_build(CONTROLLER_BENCH_VLAN, bridging)) == NULL ||
+       controller_bench_queue(cxn, obj, CONTROLLER_BENCH_XID_SETUP) < 0))
+  {
+    return -1;
+  }
+
+  return 0;
+}
+
+/* Handle connection events until the deadline or an error */
+static int
+controller_bench_poll(uint32_t connections, int timeout_ms, uint64_t now)
+{
+  struct pollfd fds[CONTROLLER_BENCH_CONNECTIONS_MAX];
+  controller_bench_cxn_t *cxn;
+  uint32_t i;
+
+  for (i = 0; i < connections; i++)
+  {
+    fds[i].fd = controller_bench_cxns[i].fd;
+    fds[i].events = POLLIN | (controller_bench_cxns[i].out_len ? POLLOUT : 0);
+    fds[i].revents = 0;
+  }
+
+  if (poll(fds, connections, timeout_ms) < 0 && errno != EINTR)
+  {
+    return -1;
+  }
+
+  for (i = 0; i < connections; i++)
+  {
+    cxn = &controller_bench_cxns[i];
+    if ((fds[i].revents & (POLLIN | POLLHUP | POLLERR)) &&
+        controller_bench_read(cxn, now) < 0)
+    {
+      return -1;
+    }
+    if ((fds[i].revents & POLLOUT) && controller_bench_write(cxn) < 0)
+    {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/* Smooth weighted round robin over the mix */
+static controller_bench_kind_t
+controller_bench_kind_next(const arguments_t *arguments)
+{
+  static int32_t current[CONTROLLER_BENCH_KIND_COUNT];
+  int32_t total = 0;
+  int kind, best = -1;
+
+  for (kind = 0; kind < CONTROLLER_BENCH_KIND_COUNT; kind++)
+  {
+    current[kind] += arguments->mix[kind];
+    total += arguments->mix[kind];
+    if (arguments->mix[kind] && (best < 0 || current[kind] > current[best]))
+    {
+      best = kind;
+    }
+  }
+  current[best] -= total;
+  return best;
+}
+
+int main(int argc, char *argv[])
+{
+  struct sockaddr_in sa;
+  controller_bench_cxn_t *cxn;
+  uint64_t start, now, end, due, issued = 0, drain_end, sent = 0, errors = 0;
+  uint32_t i, next = 0, tries, ready;
+  char addr[64], *colon;
+  double secs;
+  int kind;
+
+  struct argp argp =
+    {
+      .doc      = "Drives an OF Agent as its controllers, at a set rate and mix of messages, and reports latencies.",
+      .options  = options,
+      .parser   = parse_opt,
+    };
+
+  arguments_t arguments =
+  {
+    .agent = "127.0.0.1:6653",
+    .connections = 1,
+    .rate = 1000,
+    .duration = 10,
+    .flows = 1000,
+    .barrier_every = 32,
+    .port = 1,
+    .mix =
+    {
+      [CONTROLLER_BENCH_FLOW]       = 80,
+      [CONTROLLER_BENCH_GROUP]      = 4,
+      [CONTROLLER_BENCH_BARRIER]    = 4,
+      [CONTROLLER_BENCH_ECHO]       = 4,
+      [CONTROLLER_BENCH_PACKET_OUT] = 4,
+      [CONTROLLER_BENCH_MULTIPART]  = 4,
+    },
+    .tables = { CONTROLLER_BENCH_BRIDGING },
+    .table_count = 1,
+  };
+
+  AIM_LOG_STRUCT_REGISTER();
+
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  aim_log_fid_set_all(AIM_LOG_FLAG_FATAL, 1);
+  aim_log_fid_set_all(AIM_LOG_FLAG_ERROR, 1);
+
+  strncpy(addr, arguments.agent, sizeof(addr) - 1);
+  addr[sizeof(addr) - 1] = '\0';
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  if ((colon = strchr(addr, ':')) == NULL ||
+      (*colon = '\0', inet_pton(AF_INET, addr, &sa.sin_addr)) != 1 ||
+      (sa.sin_port = htons(atoi(colon + 1))) == 0)
+  {
+    AIM_LOG_FATAL("Invalid agent address \"%s\"", arguments.agent);
+    return 1;
+  }
+
+  for (i = 0; i < arguments.table_count; i++)
+  {
+    kind = arguments.tables[i];
+    if (controller_bench_insts[kind] == NULL &&
+        (controller_bench_insts[kind] = controller_bench_instructions_build(kind, arguments.port)) == NULL)
+    {
+      AIM_LOG_FATAL("Failed to build the %s instructions", controller_bench_tables[kind].name);
+      return 1;
+    }
+  }
+
+  for (i = 0; i < arguments.connections; i++)
+  {
+    if (controller_bench_connect(&controller_bench_cxns[i], i, &sa,
+                                 i == 0 && controller_bench_insts[CONTROLLER_BENCH_BRIDGING] ? arguments.port : 0) < 0)
+    {
+      AIM_LOG_FATAL("Failed to open connection %u to %s", i, arguments.agent);
+      return 1;
+    }
+  }
+
+  /* Wait for every features reply */
+  for (tries = 0; tries < 5000; tries++)
+  {
+    for (i = 0, ready = 0; i < arguments.connections; i++)
+    {
+      ready += controller_bench_cxns[i].ready;
+    }
+    if (ready == arguments.connections)
+    {
+      break;
+    }
+    if (controller_bench_poll(arguments.connections, 1, controller_bench_now_ns()) < 0)
+    {
+      return 1;
+    }
+  }
+  if (tries == 5000)
+  {
+    AIM_LOG_FATAL("The agent did not complete the handshake on every connection");
+    return 1;
+  }
+
+  printf("%u connections to %s, %u msgs/s for %u s, %u flows per table per connection\n",
+         arguments.connections, arguments.agent, arguments.rate, arguments.duration,
+         arguments.flows);
+  fflush(stdout);
+
+  start = now = controller_bench_now_ns();
+  end = start + (uint64_t)arguments.duration * 1000000000;
+
+  while (now < end)
+  {
+    due = (now - start) * arguments.rate / 1000000000;
+
+    /* Messages more than 100 ms late are not caught up on */
+    if (due - issued > arguments.rate / 10 + 1)
+    {
+      controller_bench_stalls += due - issued - (arguments.rate / 10 + 1);
+      issued = due - (arguments.rate / 10 + 1);
+    }
+
+    while (issued < due)
+    {
+      for (tries = 0; tries < arguments.connections; tries++)
+      {
+        cxn = &controller_bench_cxns[next++ % arguments.connections];
+        if (cxn->out_len < CONTROLLER_BENCH_OUTPUT_MAX)
+        {
+          break;
+        }
+      }
+      if (tries == arguments.connections)
+      {
+        /* Every connection is backed up */
+        break;
+      }
+      if (controller_bench_send(cxn, controller_bench_kind_next(&arguments), &arguments, now) < 0)
+      {
+        controller_bench_stalls++;
+      }
+      issued++;
+    }
+
+    if (controller_bench_poll(arguments.connections, 1, now) < 0)
+    {
+      return 1;
+    }
+    now = controller_bench_now_ns();
+  }
+
+  /* Barrier every connection and wait for the replies */
+  for (i = 0; i < arguments.connections; i++)
+  {
+    controller_bench_barrier_send(&controller_bench_cxns[i], now);
+  }
+  drain_end = now + (uint64_t)CONTROLLER_BENCH_DRAIN_MS * 1000000;
+  while (now < drain_end)
+  {
+    for (i = 0, ready = 0; i < arguments.connections; i++)
+    {
+      cxn = &controller_bench_cxns[i];
+      ready += (cxn->barrier_head == cxn->barrier_tail);
+    }
+    if (ready == arguments.connections ||
+        controller_bench_poll(arguments.connections, 1, now) < 0)
+    {
+      break;
+    }
+    now = controller_bench_now_ns();
+  }
+
+  secs = (now - start) / 1e9;
+  for (kind = 0; kind < CONTROLLER_BENCH_KIND_COUNT; kind++)
+  {
+    sent += controller_bench_sent[kind];
+    errors += controller_bench_errors[kind];
+  }
+
+  printf("sent %" PRIu64 " msgs in %.3f s, %.0f msgs/s, %" PRIu64 " stalls, "
+         "received %" PRIu64 " msgs (%" PRIu64 " packet-ins), %" PRIu64 " setup errors\n",
+         sent, secs, secs > 0 ? sent / secs : 0, controller_bench_stalls,
+         controller_bench_received, controller_bench_packet_ins,
+         controller_bench_setup_errors);
+  for (kind = 0; kind < CONTROLLER_BENCH_KIND_COUNT; kind++)
+  {
+    printf("  %-10s %10" PRIu64 " sent %8" PRIu64 " errors (%.3f%%)\n",
+           controller_bench_kind_names[kind], controller_bench_sent[kind],
+           controller_bench_errors[kind],
+           controller_bench_sent[kind] ?
+             100.0 * controller_bench_errors[kind] / controller_bench_sent[kind] : 0.0);
+  }
+  for (i = 0, ready = 0; i < arguments.connections; i++)
+  {
+    cxn = &controller_bench_cxns[i];
+    ready += cxn->pending_tail - cxn->pending_head;
+  }
+  if (ready)
+  {
+    printf("  %u flow-mods still waiting for a barrier reply\n", ready);
+  }
+
+  controller_bench_hist_show("flow-mod to barrier reply", &controller_bench_flow_hist);
+  controller_bench_hist_show("barrier round trip", &controller_bench_barrier_hist);
+  controller_bench_hist_show("echo round trip", &controller_bench_echo_hist);
+  controller_bench_hist_show("multipart round trip", &controller_bench_multipart_hist);
+
+  for (i = 0; i < arguments.connections; i++)
+  {
+    cxn = &controller_bench_cxns[i];
+    close(cxn->fd);
+    free(cxn->in);
+    free(cxn->out);
+    free(cxn->sent_ns);
+    free(cxn->pending);
+  }
+  for (kind = 0; kind < CONTROLLER_BENCH_TABLE_COUNT; kind++)
+  {
+    if (controller_bench_insts[kind] != NULL)
+    {
+      of_object_delete(controller_bench_insts[kind]);
+    }
+  }
+
+  return errors ? 2 : 0;
+}
@@ -0,0 +1,1092 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2015
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     flowmod_bench.c
+*
+* @purpose      Flow-mod replay benchmark for the OF Agent
+*
+* @component    OF-DPA
+*
+* @comments     Messages are built (or read from a recording) up front
+*               and then handed to indigo_core_receive_controller_message()
+*               one at a time, the way OFConnectionManager delivers them,
+*               so only the state manager and forwarding are measured.
+*               There is no controller connection; the indigo_cxn_*
+*               calls the core makes are answered here.
+*
+*               By default the real OF-DPA driver is the forwarding
+*               backend: link with the ofdpadriver objects and the OF-DPA
+*               client library, as for ofagent, or with ofdpasim in
+*               place of the client library to run without a switch.
+*               Build with -DFLOWMOD_BENCH_NULL_FWD and without them to measure the
+*               core alone against a forwarding layer that does nothing.
+*
+*               The latency of a message is the time it takes to return
+*               from the core. Flow adds queued by the driver are pushed
+*               by the next message that is not a flow add, so that cost
+*               lands on it, and on the final flush that ends each run.
+*
+* @create       14 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <argp.h>
+
+#include <SocketManager/socketmanager.h>
+#include <AIM/aim.h>
+#include <indigo/types.h>
+#include <indigo/forwarding.h>
+#include <indigo/port_manager.h>
+#include <indigo/of_state_manager.h>
+#include <indigo/of_connection_manager.h>
+#include <OFStateManager/ofstatemanager.h>
+#include <OFConnectionManager/ofconnectionmanager.h>
+#include <loci/loci.h>
+#include "ofdpa_datatypes.h"
+#ifndef FLOWMOD_BENCH_NULL_FWD
+#include "ofdpa_api.h"
+#endif
+
+#define AIM_LOG_MODULE_NAME flowmod_bench
+
+#include <AIM/aim_log.h>
+
+AIM_LOG_STRUCT_DEFINE(
+                      AIM_LOG_OPTIONS_DEFAULT,
+                      AIM_LOG_BITS_DEFAULT,
+                      NULL,     /* Custom Log Map */
+                      0
+                      );
+
+/* VLAN and port of the L2 interface group bridging flows point at */
+#define FLOWMOD_BENCH_VLAN  1
+#define FLOWMOD_BENCH_PORT  1
+
+#define FLOWMOD_BENCH_PRIORITY_BASE  1000
+
+int ofagent_of_version = OF_VERSION_1_3;
+
+typedef enum
+{
+  FLOWMOD_BENCH_BRIDGING,
+  FLOWMOD_BENCH_UNICAST,
+  FLOWMOD_BENCH_ACL,
+  FLOWMOD_BENCH_MPLS,
+} flowmod_bench_workload_t;
+
+static const struct
+{
+  const char *name;
+  uint8_t     table_id;
+} flowmod_bench_workloads[] =
+{
+  [FLOWMOD_BENCH_BRIDGING] = { "bridging", OFDPA_FLOW_TABLE_ID_BRIDGING },
+  [FLOWMOD_BENCH_UNICAST]  = { "unicast",  OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING },
+  [FLOWMOD_BENCH_ACL]      = { "acl",      OFDPA_FLOW_TABLE_ID_ACL_POLICY },
+  [FLOWMOD_BENCH_MPLS]     = { "mpls",     OFDPA_FLOW_TABLE_ID_MPLS_1 },
+};
+
+typedef struct
+{
+  flowmod_bench_workload_t workload;
+  uint32_t                 count;
+  uint32_t                 priorities;
+  int                      check_overlap;
+  int                      delete;
+  char                     *replay;
+} arguments_t;
+
+/* A run of wire-format OpenFlow messages laid end to end */
+typedef struct
+{
+  uint8_t  *data;
+  uint32_t bytes;
+  uint32_t size;
+  uint32_t count;
+} flowmod_bench_stream_t;
+
+static struct argp_option options[] =
+{
+  { "table",         't', "TABLE",  0, "Synthesize flows for TABLE: bridging, unicast, acl or mpls." },
+  { "count",         'n', "COUNT",  0, "Number of flows to synthesize." },
+  { "priorities",    'P', "COUNT",  0, "Spread the synthesized flows over COUNT priorities." },
+  { "check-overlap", 'o', 0,        0, "Set the check-overlap flag on every flow add." },
+  { "delete",        'd', 0,        0, "Delete the synthesized flows again as a second run." },
+  { "replay",        'r', "FILE",   0, "Replay the OpenFlow messages recorded back to back in FILE." },
+  { 0 }
+};
+
+extern void __ofstatemanager_module_init__(void);
+extern void __biglist_module_init__(void);
+extern void __socketmanager_module_init__(void);
+#ifndef FLOWMOD_BENCH_NULL_FWD
+extern void __ind_ofdpa_driver_module_init__(void);
+#endif
+
+static ind_soc_config_t soc_cfg;
+static ind_core_config_t core_cfg;
+
+/* Replies the core sent back, and how many of them were errors */
+static uint32_t flowmod_bench_replies;
+static uint32_t flowmod_bench_errors;
+
+/* Parse a single option. */
+static error_t parse_opt(int key, char *arg, struct argp_state *state)
+{
+  arguments_t *arguments = state->input;
+  char *endptr;
+  int i;
+
+  switch (key)
+  {
+    case 't':                           /* table */
+      for (i = 0; i < AIM_ARRAYSIZE(flowmod_bench_workloads); i++)
+      {
+        if (strcmp(arg, flowmod_bench_workloads[i].name) == 0)
+        {
+          break;
+        }
+      }
+      if (i == AIM_ARRAYSIZE(flowmod_bench_workloads))
+      {
+        argp_error(state, "Invalid table \"%s\"", arg);
+        return EINVAL;
+      }
+      arguments->workload = i;
+      break;
+
+    case 'n':                           /* count */
+      errno = 0;
+      arguments->count = strtoul(arg, &endptr, 0);
+      if ((errno != 0) || (*endptr != '\0') || (arguments->count == 0))
+      {
+        argp_error(state, "Invalid count \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case 'P':                           /* priorities */
+      errno = 0;
+      arguments->priorities = strtoul(arg, &endptr, 0);
+      if ((errno != 0) || (*endptr != '\0') ||
+          (arguments->priorities == 0) || (arguments->priorities > 0xffff - FLOWMOD_BENCH_PRIORITY_BASE))
+      {
+        argp_error(state, "Invalid priorities \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case 'o':                           /* check-overlap */
+      arguments->check_overlap = 1;
+      break;
+
+    case 'd':                           /* delete */
+      arguments->delete = 1;
+      break;
+
+    case 'r':                           /* replay */
+      arguments->replay = arg;
+      break;
+
+    case ARGP_KEY_NO_ARGS:
+    case ARGP_KEY_END:
+      break;
+
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+  return 0;
+}
+
+/****************************************************************
+ * Connection manager
+ *
+ * The core answers on the connection a message came from. Count the
+ * replies and errors and drop them.
+ ****************************************************************/
+
+void
+indigo_cxn_send_controller_message(indigo_cxn_id_t cxn_id, of_object_t *obj)
+{
+  flowmod_bench_replies++;
+  if (of_message_type_get(OF_OBJECT_TO_MESSAGE(obj)) == OF_OBJ_TYPE_ERROR)
+  {
+    flowmod_bench_errors++;
+  }
+  of_object_delete(obj);
+}
+
+void
+indigo_cxn_send_error_reply(indigo_cxn_id_t cxn_id, of_object_t *orig,
+                            uint16_t type, uint16_t code)
+{
+  flowmod_bench_replies++;
+  flowmod_bench_errors++;
+}
+
+void
+indigo_cxn_message_parse_error(indigo_cxn_id_t cxn_id, of_object_t *obj)
+{
+  flowmod_bench_errors++;
+}
+
+void
+indigo_cxn_send_async_message(of_object_t *obj)
+{
+  of_object_delete(obj);
+}
+
+int
+indigo_cxn_output_blocked(indigo_cxn_id_t cxn_id)
+{
+  return 0;
+}
+
+indigo_error_t
+indigo_cxn_output_ready_register(indigo_cxn_id_t cxn_id,
+                                 indigo_cxn_output_ready_f callback,
+                                 void *cookie)
+{
+  return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
+indigo_error_t
+indigo_cxn_get_async_version(of_version_t *of_version)
+{
+  *of_version = OF_VERSION_1_3;
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+ind_cxn_message_track_setup(indigo_cxn_id_t cxn_id, of_object_t *obj)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+void
+ind_cxn_reset(indigo_cxn_id_t cxn_id)
+{
+}
+
+void
+ind_cxn_flight_fwd_error(const char *api, int rv)
+{
+}
+
+#ifdef FLOWMOD_BENCH_NULL_FWD
+/****************************************************************
+ * Null forwarding backend
+ *
+ * Accepts every request without doing anything, so the numbers are
+ * those of the state manager alone.
+ ****************************************************************/
+
+indigo_error_t
+indigo_fwd_flow_create(indigo_cookie_t flow_id,
+                       of_flow_add_t *flow_add,
+                       uint8_t *table_id)
+{
+  of_flow_add_table_id_get(flow_add, table_id);
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_flow_modify(indigo_cookie_t flow_id,
+                       of_flow_modify_t *flow_modify)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_flow_delete(indigo_cookie_t flow_id,
+                       indigo_fi_flow_stats_t *flow_stats)
+{
+  if (flow_stats != NULL)
+  {
+    memset(flow_stats, 0, sizeof(*flow_stats));
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_flow_stats_get(indigo_cookie_t flow_id,
+                          indigo_fi_flow_stats_t *flow_stats)
+{
+  memset(flow_stats, 0, sizeof(*flow_stats));
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_table_stats_get(of_table_stats_request_t *request,
+                           of_table_stats_reply_t **reply)
+{
+  *reply = of_table_stats_reply_new(request->version);
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_packet_out(of_packet_out_t *of_packet_out)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_forwarding_features_get(of_features_reply_t *features)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_experimenter(of_experimenter_t *experimenter,
+                        indigo_cxn_id_t cxn_id)
+{
+  return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
+indigo_error_t
+indigo_fwd_expiration_enable_set(int is_enabled)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_expiration_enable_get(int *is_enabled)
+{
+  *is_enabled = 1;
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_group_add(uint32_t id, uint8_t group_type, of_list_bucket_t *buckets)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+#ifdef OFDPA_FIXUP
+indigo_error_t
+indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *old_buckets,
+                        of_list_bucket_t *buckets)
+#else
+indigo_error_t
+indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *buckets)
+#endif
+{
+  return INDIGO_ERROR_NONE;
+}
+
+#ifdef OFDPA_FIXUP
+indigo_error_t
+indigo_fwd_group_delete(uint32_t id)
+{
+  return INDIGO_ERROR_NONE;
+}
+#else
+void
+indigo_fwd_group_delete(uint32_t id)
+{
+}
+#endif
+
+void
+indigo_fwd_group_stats_get(uint32_t id, of_group_stats_entry_t *entry)
+{
+}
+
+#ifdef OFDPA_FIXUP
+indigo_error_t
+indigo_fwd_meter_add(uint32_t id, uint16_t flag, of_list_meter_band_t *meters)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_meter_modify(uint32_t id, uint16_t flag, of_list_meter_band_t *meters)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_meter_delete(uint32_t id)
+{
+  return INDIGO_ERROR_NONE;
+}
+#endif
+
+void
+indigo_fwd_pipeline_get(of_desc_str_t pipeline)
+{
+  strcpy(pipeline, "null");
+}
+
+indigo_error_t
+indigo_fwd_pipeline_set(of_desc_str_t pipeline)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+void
+indigo_fwd_pipeline_stats_get(of_desc_str_t **pipelines, int *num_pipelines)
+{
+  *num_pipelines = 0;
+}
+
+indigo_error_t
+indigo_port_features_get(of_features_reply_t *features)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_port_desc_stats_get(of_port_desc_stats_reply_t *port_desc_stats_reply)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_port_modify(of_port_mod_t *port_mod)
+{
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_port_stats_get(of_port_stats_request_t *request,
+                      of_port_stats_reply_t **reply_ptr)
+{
+  *reply_ptr = of_port_stats_reply_new(request->version);
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_port_queue_config_get(of_queue_get_config_request_t *request,
+                             of_queue_get_config_reply_t **reply_ptr)
+{
+  *reply_ptr = of_queue_get_config_reply_new(request->version);
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_port_queue_stats_get(of_queue_stats_request_t *request,
+                            of_queue_stats_reply_t **reply_ptr)
+{
+  *reply_ptr = of_queue_stats_reply_new(request->version);
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_port_experimenter(of_experimenter_t *experimenter,
+                         indigo_cxn_id_t cxn_id)
+{
+  return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
+indigo_error_t
+indigo_port_interface_list(indigo_port_info_t **list)
+{
+  *list = NULL;
+  return INDIGO_ERROR_NONE;
+}
+
+void
+indigo_port_interface_list_destroy(indigo_port_info_t *list)
+{
+}
+#endif /* FLOWMOD_BENCH_NULL_FWD */
+
+/****************************************************************
+ * Message streams
+ ****************************************************************/
+
+/* Copy the wire form of obj to the end of the stream and free obj */
+static int
+flowmod_bench_stream_append(flowmod_bench_stream_t *stream, of_object_t *obj)
+{
+  uint8_t *data;
+  uint32_t size;
+
+  if (stream->bytes + obj->length > stream->size)
+  {
+    size = stream->size ? stream->size * 2 : 65536;
+    while (size < stream->bytes + obj->length)
+    {
+      size *= 2;
+    }
+    if ((data = realloc(stream->data, size)) == NULL)
+    {
+      of_object_delete(obj);
+      return -1;
+    }
+    stream->data = data;
+    stream->size = size;
+  }
+
+  memcpy(stream->data + stream->bytes, OF_OBJECT_BUFFER_INDEX(obj, 0), obj->length);
+  stream->bytes += obj->length;
+  stream->count++;
+  of_object_delete(obj);
+  return 0;
+}
+
+/* Load a recording made of OpenFlow messages laid back to back */
+static int
+flowmod_bench_stream_read(flowmod_bench_stream_t *stream, const char *path)
+{
+  FILE *fp;
+  long len;
+  uint32_t offset, msg_len;
+
+  if ((fp = fopen(path, "rb")) == NULL)
+  {
+    AIM_LOG_ERROR("Failed to open %s: %s", path, strerror(errno));
+    return -1;
+  }
+
+  if (fseek(fp, 0, SEEK_END) < 0 || (len = ftell(fp)) < 0 ||
+      fseek(fp, 0, SEEK_SET) < 0 ||
+      (stream->data = malloc(len ? len : 1)) == NULL ||
+      fread(stream->data, 1, len, fp) != len)
+  {
+    AIM_LOG_ERROR("Failed to read %s", path);
+    fclose(fp);
+    return -1;
+  }
+  fclose(fp);
+  stream->bytes = stream->size = len;
+
+  for (offset = 0; offset < stream->bytes; offset += msg_len)
+  {
+    if (stream->bytes - offset < OF_MESSAGE_HEADER_LENGTH ||
+        (msg_len = of_message_length_get(stream->data + offset)) < OF_MESSAGE_HEADER_LENGTH ||
+        msg_len > stream->bytes - offset)
+    {
+      AIM_LOG_ERROR("Truncated message at offset %u of %s", offset, path);
+      return -1;
+    }
+    stream->count++;
+  }
+
+  return 0;
+}
+
+static of_match_t *
+flowmod_bench_match_build(flowmod_bench_workload_t workload, uint32_t i,
+                          of_match_t *match)
+{
+  memset(match, 0, sizeof(*match));
+  match->version = OF_VERSION_1_3;
+
+  switch (workload)
+  {
+    case FLOWMOD_BENCH_BRIDGING:
+      match->fields.vlan_vid = OFDPA_VID_PRESENT | FLOWMOD_BENCH_VLAN;
+      match->masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+      match->fields.eth_dst.addr[0] = 0x02;
+      match->fields.eth_dst.addr[2] = i >> 24;
+      match->fields.eth_dst.addr[3] = i >> 16;
+      match->fields.eth_dst.addr[4] = i >> 8;
+      match->fields.eth_dst.addr[5] = i;
+      memset(match->masks.eth_dst.addr, 0xff, OF_MAC_ADDR_BYTES);
+      break;
+
+    case FLOWMOD_BENCH_UNICAST:
+      match->fields.eth_type = 0x0800;
+      match->masks.eth_type = 0xffff;
+      match->fields.ipv4_dst = 0x0a000000 | (i & 0xffffff);
+      match->masks.ipv4_dst = 0xffffffff;
+      break;
+
+    case FLOWMOD_BENCH_ACL:
+      match->fields.eth_type = 0x0800;
+      match->masks.eth_type = 0xffff;
+      match->fields.ipv4_src = 0x0a000000 | (i & 0xffffff);
+      match->masks.ipv4_src = 0xffffffff;
+      match->fields.ip_proto = 6;
+      match->masks.ip_proto = 0xff;
+      break;
+
+    case FLOWMOD_BENCH_MPLS:
+      match->fields.eth_type = 0x8847;
+      match->masks.eth_type = 0xffff;
+      match->fields.mpls_label = 16 + (i & 0xfffff);
+      match->masks.mpls_label = 0xfffff;
+      match->fields.mpls_bos = 1;
+      match->masks.mpls_bos = 1;
+      break;
+  }
+
+  return match;
+}
+
+static int
+flowmod_bench_instructions_build(flowmod_bench_workload_t workload,
+                                 of_list_instruction_t *insts)
+{
+  of_object_t *inst = NULL;
+  of_object_t *action = NULL;
+  of_list_action_t *actions = NULL;
+  int rv = -1;
+
+  switch (workload)
+  {
+    case FLOWMOD_BENCH_BRIDGING:
+      if ((inst = of_instruction_write_actions_new(OF_VERSION_1_3)) == NULL ||
+          (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+          (action = of_action_group_new(OF_VERSION_1_3)) == NULL)
+      {
+        goto done;
+      }
+      of_action_group_group_id_set(action, (FLOWMOD_BENCH_VLAN << 16) | FLOWMOD_BENCH_PORT);
+      if (of_list_append(actions, action) < 0 ||
+          of_instruction_write_actions_actions_set(inst, actions) < 0 ||
+          of_list_append(insts, inst) < 0)
+      {
+        goto done;
+      }
+      of_object_delete(inst);
+      inst = NULL;
+      break;
+
+    case FLOWMOD_BENCH_ACL:
+      /* Drop */
+      if ((inst = of_instruction_clear_actions_new(OF_VERSION_1_3)) == NULL ||
+          of_list_append(insts, inst) < 0)
+      {
+        goto done;
+      }
+      of_object_delete(inst);
+      inst = NULL;
+      break;
+
+    case FLOWMOD_BENCH_MPLS:
+      if ((inst = of_instruction_apply_actions_new(OF_VERSION_1_3)) == NULL ||
+          (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+          (action = of_action_pop_mpls_new(OF_VERSION_1_3)) == NULL)
+      {
+        goto done;
+      }
+      of_action_pop_mpls_ethertype_set(action, 0x0800);
+      if (of_list_append(actions, action) < 0 ||
+          of_instruction_apply_actions_actions_set(inst, actions) < 0 ||
+          of_list_append(insts, inst) < 0)
+      {
+        goto done;
+      }
+      of_object_delete(inst);
+      inst = NULL;
+      break;
+
+    default:
+      break;
+  }
+
+  if (workload != FLOWMOD_BENCH_ACL)
+  {
+    if ((inst = of_instruction_goto_table_new(OF_VERSION_1_3)) == NULL)
+    {
+      goto done;
+    }
+    of_instruction_goto_table_table_id_set(inst,
+        workload == FLOWMOD_BENCH_MPLS ? OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING :
+                                         OFDPA_FLOW_TABLE_ID_ACL_POLICY);
+    if (of_list_append(insts, inst) < 0)
+    {
+      goto done;
+    }
+  }
+
+  rv = 0;
+
+done:
+  if (action != NULL)
+  {
+    of_object_delete(action);
+  }
+  if (actions != NULL)
+  {
+    of_object_delete(actions);
+  }
+  if (inst != NULL)
+  {
+    of_object_delete(inst);
+  }
+  return rv;
+}
+
+/* The L2 interface group the bridging flows forward to */
+static int
+flowmod_bench_setup_build(const arguments_t *arguments,
+                          flowmod_bench_stream_t *stream)
+{
+  of_group_add_t *group_add;
+  of_list_bucket_t *buckets = NULL;
+  of_bucket_t *bucket = NULL;
+  of_list_action_t *actions = NULL;
+  of_action_output_t *output = NULL;
+  int rv = -1;
+
+  if (arguments->workload != FLOWMOD_BENCH_BRIDGING)
+  {
+    return 0;
+  }
+
+  if ((group_add = of_group_add_new(OF_VERSION_1_3)) == NULL ||
+      (buckets = of_list_bucket_new(OF_VERSION_1_3)) == NULL ||
+      (bucket = of_bucket_new(OF_VERSION_1_3)) == NULL ||
+      (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+      (output = of_action_output_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto done;
+  }
+
+  of_group_add_group_type_set(group_add, OF_GROUP_TYPE_INDIRECT);
+  of_group_add_group_id_set(group_add, (FLOWMOD_BENCH_VLAN << 16) | FLOWMOD_BENCH_PORT);
+  of_action_output_port_set(output, FLOWMOD_BENCH_PORT);
+  of_bucket_watch_port_set(bucket, OF_PORT_DEST_WILDCARD);
+  of_bucket_watch_group_set(bucket, OF_GROUP_ANY);
+  if (of_list_append(actions, output) < 0 ||
+      of_bucket_actions_set(bucket, actions) < 0 ||
+      of_list_append(buckets, bucket) < 0 ||
+      of_group_add_buckets_set(group_add, buckets) < 0)
+  {
+    goto done;
+  }
+
+  rv = flowmod_bench_stream_append(stream, group_add);
+  group_add = NULL;
+
+done:
+  if (output != NULL)
+  {
+    of_object_delete(output);
+  }
+  if (actions != NULL)
+  {
+    of_object_delete(actions);
+  }
+  if (bucket != NULL)
+  {
+    of_object_delete(bucket);
+  }
+  if (buckets != NULL)
+  {
+    of_object_delete(buckets);
+  }
+  if (group_add != NULL)
+  {
+    of_object_delete(group_add);
+  }
+  return rv;
+}
+
+static int
+flowmod_bench_add_build(const arguments_t *arguments,
+                        flowmod_bench_stream_t *stream)
+{
+  of_flow_add_t *flow_add;
+  of_list_instruction_t *insts;
+  of_match_t match;
+  uint32_t i;
+
+  if ((insts = of_list_instruction_new(OF_VERSION_1_3)) == NULL ||
+      flowmod_bench_instructions_build(arguments->workload, insts) < 0)
+  {
+    return -1;
+  }
+
+  for (i = 0; i < arguments->count; i++)
+  {
+    if ((flow_add = of_flow_add_new(OF_VERSION_1_3)) == NULL)
+    {
+      break;
+    }
+    of_flow_add_table_id_set(flow_add, flowmod_bench_workloads[arguments->workload].table_id);
+    of_flow_add_priority_set(flow_add, FLOWMOD_BENCH_PRIORITY_BASE + i % arguments->priorities);
+    of_flow_add_cookie_set(flow_add, i);
+    of_flow_add_buffer_id_set(flow_add, OF_BUFFER_ID_NO_BUFFER);
+    of_flow_add_out_port_set(flow_add, OF_PORT_DEST_WILDCARD);
+    of_flow_add_out_group_set(flow_add, OF_GROUP_ANY);
+    if (arguments->check_overlap)
+    {
+      of_flow_add_flags_set(flow_add, OF_FLOW_MOD_FLAG_CHECK_OVERLAP);
+    }
+    if (of_flow_add_match_set(flow_add, flowmod_bench_match_build(arguments->workload, i, &match)) < 0 ||
+        of_flow_add_instructions_set(flow_add, insts) < 0)
+    {
+      of_object_delete(flow_add);
+      break;
+    }
+    if (flowmod_bench_stream_append(stream, flow_add) < 0)
+    {
+      break;
+    }
+  }
+
+  of_object_delete(insts);
+  return (i == arguments->count) ? 0 : -1;
+}
+
+static int
+flowmod_bench_delete_build(const arguments_t *arguments,
+                           flowmod_bench_stream_t *stream)
+{
+  of_flow_delete_strict_t *flow_del;
+  of_match_t match;
+  uint32_t i;
+
+  for (i = 0; i < arguments->count; i++)
+  {
+    if ((flow_del = of_flow_delete_strict_new(OF_VERSION_1_3)) == NULL)
+    {
+      return -1;
+    }
+    of_flow_delete_strict_table_id_set(flow_del, flowmod_bench_workloads[arguments->workload].table_id);
+    of_flow_delete_strict_priority_set(flow_del, FLOWMOD_BENCH_PRIORITY_BASE + i % arguments->priorities);
+    of_flow_delete_strict_buffer_id_set(flow_del, OF_BUFFER_ID_NO_BUFFER);
+    of_flow_delete_strict_out_port_set(flow_del, OF_PORT_DEST_WILDCARD);
+    of_flow_delete_strict_out_group_set(flow_del, OF_GROUP_ANY);
+    if (of_flow_delete_strict_match_set(flow_del, flowmod_bench_match_build(arguments->workload, i, &match)) < 0)
+    {
+      of_object_delete(flow_del);
+      return -1;
+    }
+    if (flowmod_bench_stream_append(stream, flow_del) < 0)
+    {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+/****************************************************************
+ * Measurement
+ ****************************************************************/
+
+static uint64_t
+flowmod_bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Resident set size in KB */
+static long
+flowmod_bench_rss_kb(void)
+{
+  FILE *fp;
+  long size, resident = 0;
+
+  if ((fp = fopen("/proc/self/statm", "r")) != NULL)
+  {
+    if (fscanf(fp, "%ld %ld", &size, &resident) != 2)
+    {
+      resident = 0;
+    }
+    fclose(fp);
+  }
+  return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static int
+flowmod_bench_ns_compare(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+/*
+ * Hand every message of the stream to the core and report the rate,
+ * the per-message latency and how much the process grew. latency must
+ * have room for one entry per message.
+ */
+static void
+flowmod_bench_run(const char *name, flowmod_bench_stream_t *stream,
+                  uint64_t *latency)
+{
+  of_object_storage_t obj_storage;
+  of_object_t *obj;
+  uint64_t start, end, t;
+  uint32_t offset, len, n = 0;
+  uint32_t replies = flowmod_bench_replies;
+  uint32_t errors = flowmod_bench_errors;
+  long rss = flowmod_bench_rss_kb();
+  double secs;
+
+  start = flowmod_bench_now_ns();
+  for (offset = 0; offset < stream->bytes; offset += len)
+  {
+    len = of_message_length_get(stream->data + offset);
+    obj = of_object_new_from_message_preallocated(&obj_storage, stream->data + offset, len);
+    if (obj == NULL)
+    {
+      flowmod_bench_errors++;
+      continue;
+    }
+    t = flowmod_bench_now_ns();
+    indigo_core_receive_controller_message(0, obj);
+    latency[n++] = flowmod_bench_now_ns() - t;
+  }
+  indigo_fwd_pending_flush();
+  end = flowmod_bench_now_ns();
+
+  secs = (end - start) / 1e9;
+  qsort(latency, n, sizeof(*latency), flowmod_bench_ns_compare);
+
+  printf("%-8s %8u msgs %6u errors %8.3f s %10.0f msgs/s  p50 %8.1f us  p99 %8.1f us  rss %+8ld KB  replies %u\n",
+         name, stream->count, flowmod_bench_errors - errors, secs,
+         secs > 0 ? stream->count / secs : 0,
+         n ? latency[n / 2] / 1e3 : 0,
+         n ? latency[(uint64_t)n * 99 / 100] / 1e3 : 0,
+         flowmod_bench_rss_kb() - rss,
+         flowmod_bench_replies - replies);
+  fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+  flowmod_bench_stream_t setup = { 0 }, add = { 0 }, del = { 0 };
+  uint64_t *latency;
+  uint32_t max_count;
+#ifndef FLOWMOD_BENCH_NULL_FWD
+  OFDPA_ERROR_t rc;
+#endif
+
+  struct argp argp =
+    {
+      .doc      = "Replays flow-mods through the OF Agent core and reports their rate and latency.",
+      .options  = options,
+      .parser   = parse_opt,
+    };
+
+  arguments_t arguments =
+  {
+    .workload = FLOWMOD_BENCH_BRIDGING,
+    .count = 10000,
+    .priorities = 1,
+    .check_overlap = 0,
+    .delete = 0,
+    .replay = NULL,
+  };
+
+  AIM_LOG_STRUCT_REGISTER();
+
+#ifndef FLOWMOD_BENCH_NULL_FWD
+  __ind_ofdpa_driver_module_init__();
+#endif
+  __ofstatemanager_module_init__();
+  __biglist_module_init__();
+  __socketmanager_module_init__();
+
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  aim_log_fid_set_all(AIM_LOG_FLAG_FATAL, 1);
+  aim_log_fid_set_all(AIM_LOG_FLAG_ERROR, 1);
+
+  /* Build everything before starting, so only replay is measured */
+  if (arguments.replay)
+  {
+    if (flowmod_bench_stream_read(&add, arguments.replay) < 0)
+    {
+      return 1;
+    }
+  }
+  else if (flowmod_bench_setup_build(&arguments, &setup) < 0 ||
+           flowmod_bench_add_build(&arguments, &add) < 0 ||
+           (arguments.delete && flowmod_bench_delete_build(&arguments, &del) < 0))
+  {
+    AIM_LOG_FATAL("Failed to build the flow-mods");
+    return 1;
+  }
+
+  max_count = add.count > setup.count ? add.count : setup.count;
+  max_count = del.count > max_count ? del.count : max_count;
+  if ((latency = malloc((max_count ? max_count : 1) * sizeof(*latency))) == NULL)
+  {
+    AIM_LOG_FATAL("Failed to allocate latency samples");
+    return 1;
+  }
+  /* Fault the samples in now so they do not count as growth */
+  memset(latency, 0, (max_count ? max_count : 1) * sizeof(*latency));
+
+#ifndef FLOWMOD_BENCH_NULL_FWD
+  rc = ofdpaClientInitialize("flowmod_bench");
+  if (rc != OFDPA_E_NONE)
+  {
+    return rc;
+  }
+#endif
+
+  if (ind_soc_init(&soc_cfg) < 0)
+  {
+    AIM_LOG_FATAL("Failed to initialize Indigo socket manager");
+    return 1;
+  }
+
+  /* Flows never age out during a run */
+  core_cfg.expire_flows = 0;
+
+  if (ind_core_init(&core_cfg) < 0)
+  {
+    AIM_LOG_FATAL("Failed to initialize Indigo core module");
+    return 1;
+  }
+
+  if (ind_soc_enable_set(1) < 0 || ind_core_enable_set(1) < 0)
+  {
+    AIM_LOG_FATAL("Failed to enable Indigo modules");
+    return 1;
+  }
+
+  printf("%s, %s backend, %s\n",
+         arguments.replay ? arguments.replay : flowmod_bench_workloads[arguments.workload].name,
+#ifdef FLOWMOD_BENCH_NULL_FWD
+         "null",
+#else
+         "OF-DPA",
+#endif
+         arguments.check_overlap ? "overlap checks" : "no overlap checks");
+
+  if (setup.count)
+  {
+    flowmod_bench_run("setup", &setup, latency);
+  }
+  flowmod_bench_run(arguments.replay ? "replay" : "add", &add, latency);
+  if (del.count)
+  {
+    flowmod_bench_run("delete", &del, latency);
+  }
+
+  ind_core_finish();
+  ind_soc_finish();
+
+  free(latency);
+  free(setup.data);
+  free(add.data);
+  free(del.data);
+  return 0;
+}
@@ -0,0 +1,662 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2015
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     loci_bench.c
+*
+* @purpose      Microbenchmarks for the LOCI operations on the OF Agent
+*               fast paths
+*
+* @component    OF-DPA
+*
+* @comments     Each case repeats one LOCI operation the way the agent
+*               uses it: match conversion and comparison as done by the
+*               flowtable, object duplication, flow_add parsing as done
+*               on receipt, flow_stats entry append as done by the flow
+*               stats handler and packet_in construction as done by the
+*               driver. Only LOCI needs to be linked; build with the same
+*               defines as ofagent (OFDPA_FIXUP in particular), as they
+*               change the layout of of_match_t.
+*
+*               Results are written to stdout as JSON, one result per
+*               line, with the keys always in the same order so runs can
+*               be compared with a line diff or loaded by a script. The
+*               "format" key changes if the layout ever does. Each case
+*               is warmed up, then timed several times, and the median
+*               and fastest run are reported.
+*
+* @create       14 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <argp.h>
+
+#include <loci/loci.h>
+
+#define LOCI_BENCH_FORMAT  1
+
+#define LOCI_BENCH_REPEATS_MAX  64
+
+/* Flow table entries compared against the query by match_more_specific */
+#define LOCI_BENCH_MATCH_ENTRIES  64
+
+/* Entries in each flow_stats reply before it is freed and a new one started */
+#define LOCI_BENCH_STATS_ENTRIES  64
+
+#define LOCI_BENCH_PACKET_SIZE  128
+
+typedef struct
+{
+  uint32_t iterations;
+  uint32_t repeats;
+  char     *filter;
+} arguments_t;
+
+/* Objects the cases work on, built once before anything is timed */
+typedef struct
+{
+  of_match_t            match;
+  of_octets_t           match_wire;
+  of_match_t            entries[LOCI_BENCH_MATCH_ENTRIES];
+  of_match_t            query;
+  of_list_instruction_t *insts;
+  of_flow_add_t         *flow_add;
+  uint8_t               *flow_add_wire;
+  int                   flow_add_len;
+  uint8_t               packet[LOCI_BENCH_PACKET_SIZE];
+} loci_bench_fixture_t;
+
+typedef int (*loci_bench_fn_t)(loci_bench_fixture_t *fixture, uint32_t iterations);
+
+/* Keeps the compiler from discarding results the cases never use */
+static volatile uint64_t loci_bench_sink;
+
+static struct argp_option options[] =
+{
+  { "iterations", 'n', "COUNT",   0, "Operations in each timed run." },
+  { "repeats",    'R', "COUNT",   0, "Timed runs of each case." },
+  { "filter",     'f', "NAME",    0, "Only run the cases whose name contains NAME." },
+  { 0 }
+};
+
+/* Parse a single option. */
+static error_t parse_opt(int key, char *arg, struct argp_state *state)
+{
+  arguments_t *arguments = state->input;
+  char *endptr;
+
+  switch (key)
+  {
+    case 'n':                           /* iterations */
+      errno = 0;
+      arguments->iterations = strtoul(arg, &endptr, 0);
+      if ((errno != 0) || (*endptr != '\0') || (arguments->iterations == 0))
+      {
+        argp_error(state, "Invalid iterations \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case 'R':                           /* repeats */
+      errno = 0;
+      arguments->repeats = strtoul(arg, &endptr, 0);
+      if ((errno != 0) || (*endptr != '\0') ||
+          (arguments->repeats == 0) || (arguments->repeats > LOCI_BENCH_REPEATS_MAX))
+      {
+        argp_error(state, "Invalid repeats \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case 'f':                           /* filter */
+      arguments->filter = arg;
+      break;
+
+    case ARGP_KEY_NO_ARGS:
+    case ARGP_KEY_END:
+      break;
+
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+  return 0;
+}
+
+/****************************************************************
+ * Fixture
+ ****************************************************************/
+
+/* An ACL policy match, the widest the agent commonly installs */
+static void
+loci_bench_match_build(uint32_t i, of_match_t *match)
+{
+  memset(match, 0, sizeof(*match));
+  match->version = OF_VERSION_1_3;
+
+  match->fields.in_port = 1 + (i & 0x1f);
+  OF_MATCH_MASK_IN_PORT_EXACT_SET(match);
+  match->fields.vlan_vid = 0x1000 | 10;
+  match->masks.vlan_vid = 0x1fff;
+  match->fields.eth_type = 0x0800;
+  match->masks.eth_type = 0xffff;
+  match->fields.ipv4_src = 0x0a000000 | (i & 0xffffff);
+  match->masks.ipv4_src = 0xffffffff;
+  match->fields.ipv4_dst = 0xc0a80000 | (i & 0xffff);
+  match->masks.ipv4_dst = 0xffffff00;
+  match->fields.ip_proto = 6;
+  match->masks.ip_proto = 0xff;
+  match->fields.tcp_dst = 80;
+  match->masks.tcp_dst = 0xffff;
+}
+
+/* Apply an output action and go to the next table */
+static int
+loci_bench_instructions_build(of_list_instruction_t *insts)
+{
+  of_object_t *inst = NULL;
+  of_object_t *action = NULL;
+  of_list_action_t *actions = NULL;
+  int rv = -1;
+
+  if ((inst = of_instruction_apply_actions_new(OF_VERSION_1_3)) == NULL ||
+      (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+      (action = of_action_output_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto done;
+  }
+  of_action_output_port_set(action, 2);
+  of_action_output_max_len_set(action, 0);
+  if (of_list_append(actions, action) < 0 ||
+      of_instruction_apply_actions_actions_set(inst, actions) < 0 ||
+      of_list_append(insts, inst) < 0)
+  {
+    goto done;
+  }
+  of_object_delete(inst);
+
+  if ((inst = of_instruction_goto_table_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto done;
+  }
+  of_instruction_goto_table_table_id_set(inst, 60);
+  if (of_list_append(insts, inst) < 0)
+  {
+    goto done;
+  }
+  rv = 0;
+
+done:
+  if (inst)
+  {
+    of_object_delete(inst);
+  }
+  if (actions)
+  {
+    of_object_delete(actions);
+  }
+  if (action)
+  {
+    of_object_delete(action);
+  }
+  return rv;
+}
+
+static int
+loci_bench_fixture_init(loci_bench_fixture_t *fixture)
+{
+  uint32_t i;
+
+  memset(fixture, 0, sizeof(*fixture));
+
+  loci_bench_match_build(0, &fixture->match);
+  if (of_match_serialize(OF_VERSION_1_3, &fixture->match, &fixture->match_wire) < 0)
+  {
+    return -1;
+  }
+
+  /* Half the entries fall inside the query's 10.0.0.0/26 */
+  for (i = 0; i < LOCI_BENCH_MATCH_ENTRIES; i++)
+  {
+    loci_bench_match_build(i * 2, &fixture->entries[i]);
+  }
+  memset(&fixture->query, 0, sizeof(fixture->query));
+  fixture->query.version = OF_VERSION_1_3;
+  fixture->query.fields.eth_type = 0x0800;
+  fixture->query.masks.eth_type = 0xffff;
+  fixture->query.fields.ipv4_src = 0x0a000000;
+  fixture->query.masks.ipv4_src = 0xffffffc0;
+
+  if ((fixture->insts = of_list_instruction_new(OF_VERSION_1_3)) == NULL ||
+      loci_bench_instructions_build(fixture->insts) < 0)
+  {
+    return -1;
+  }
+
+  if ((fixture->flow_add = of_flow_add_new(OF_VERSION_1_3)) == NULL)
+  {
+    return -1;
+  }
+  of_flow_add_table_id_set(fixture->flow_add, 60);
+  of_flow_add_priority_set(fixture->flow_add, 1000);
+  of_flow_add_cookie_set(fixture->flow_add, 1);
+  of_flow_add_buffer_id_set(fixture->flow_add, OF_BUFFER_ID_NO_BUFFER);
+  of_flow_add_out_port_set(fixture->flow_add, OF_PORT_DEST_WILDCARD);
+  of_flow_add_out_group_set(fixture->flow_add, OF_GROUP_ANY);
+  if (of_flow_add_match_set(fixture->flow_add, &fixture->match) < 0 ||
+      of_flow_add_instructions_set(fixture->flow_add, fixture->insts) < 0)
+  {
+    return -1;
+  }
+
+  fixture->flow_add_len = fixture->flow_add->length;
+  if ((fixture->flow_add_wire = malloc(fixture->flow_add_len)) == NULL)
+  {
+    return -1;
+  }
+  memcpy(fixture->flow_add_wire, OF_OBJECT_BUFFER_INDEX(fixture->flow_add, 0),
+         fixture->flow_add_len);
+
+  for (i = 0; i < sizeof(fixture->packet); i++)
+  {
+    fixture->packet[i] = i;
+  }
+
+  return 0;
+}
+
+static void
+loci_bench_fixture_finish(loci_bench_fixture_t *fixture)
+{
+  if (fixture->match_wire.data)
+  {
+    of_alloc_free(fixture->match_wire.data);
+  }
+  if (fixture->insts)
+  {
+    of_object_delete(fixture->insts);
+  }
+  if (fixture->flow_add)
+  {
+    of_object_delete(fixture->flow_add);
+  }
+  free(fixture->flow_add_wire);
+}
+
+/****************************************************************
+ * Cases
+ ****************************************************************/
+
+static int
+loci_bench_match_serialize(loci_bench_fixture_t *fixture, uint32_t iterations)
+{
+  of_octets_t octets;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    if (of_match_serialize(OF_VERSION_1_3, &fixture->match, &octets) < 0)
+    {
+      return -1;
+    }
+    loci_bench_sink += octets.bytes;
+    of_alloc_free(octets.data);
+  }
+  return 0;
+}
+
+static int
+loci_bench_match_deserialize(loci_bench_fixture_t *fixture, uint32_t iterations)
+{
+  of_match_t match;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    if (of_match_deserialize(OF_VERSION_1_3, &match, &fixture->match_wire) < 0)
+    {
+      return -1;
+    }
+    loci_bench_sink += match.fields.ipv4_src;
+  }
+  return 0;
+}
+
+static int
+loci_bench_match_more_specific(loci_bench_fixture_t *fixture, uint32_t iterations)
+{
+  uint32_t i, hits = 0;
+
+  for (i = 0; i < iterations; i++)
+  {
+    hits += of_match_more_specific(&fixture->entries[i % LOCI_BENCH_MATCH_ENTRIES],
+                                   &fixture->query);
+  }
+  loci_bench_sink += hits;
+  return 0;
+}
+
+static int
+loci_bench_object_dup(loci_bench_fixture_t *fixture, uint32_t iterations)
+{
+  of_object_t *obj;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    if ((obj = of_object_dup(fixture->flow_add)) == NULL)
+    {
+      return -1;
+    }
+    loci_bench_sink += obj->length;
+    of_object_delete(obj);
+  }
+  return 0;
+}
+
+/* Parse a received flow_add and pull out the parts the core uses */
+static int
+loci_bench_flow_add_use(of_flow_add_t *flow_add)
+{
+  of_list_instruction_t insts;
+  of_instruction_t inst;
+  of_match_t match;
+  int rv;
+
+  if (of_flow_add_match_get(flow_add, &match) < 0)
+  {
+    return -1;
+  }
+  loci_bench_sink += match.fields.ipv4_src;
+
+  of_flow_add_instructions_bind(flow_add, &insts);
+  OF_LIST_INSTRUCTION_ITER(&insts, &inst, rv)
+  {
+    loci_bench_sink += inst.header.object_id;
+  }
+  return 0;
+}
+
+static int
+loci_bench_flow_add_parse(loci_bench_fixture_t *fixture, uint32_t iterations)
+{
+  of_object_storage_t storage;
+  of_object_t *obj;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    obj = of_object_new_from_message_preallocated(&storage, fixture->flow_add_wire,
+                                                  fixture->flow_add_len);
+    if (obj == NULL || loci_bench_flow_add_use(obj) < 0)
+    {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static int
+loci_bench_flow_add_parse_light(loci_bench_fixture_t *fixture, uint32_t iterations)
+{
+  of_object_storage_t storage;
+  of_object_t *obj;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    obj = of_object_new_from_message_preallocated_light(&storage, fixture->flow_add_wire,
+                                                        fixture->flow_add_len);
+    if (obj == NULL || loci_bench_flow_add_use(obj) < 0)
+    {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/* Append entries the way the flow stats handler does; one op per entry */
+static int
+loci_bench_flow_stats_entry_append(loci_bench_fixture_t *fixture, uint32_t iterations)
+{
+  of_flow_stats_reply_t *reply = NULL;
+  of_list_flow_stats_entry_t list;
+  of_flow_stats_entry_t entry;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    if (i % LOCI_BENCH_STATS_ENTRIES == 0)
+    {
+      if (reply)
+      {
+        loci_bench_sink += reply->length;
+        of_object_delete(reply);
+      }
+      if ((reply = of_flow_stats_reply_new(OF_VERSION_1_3)) == NULL)
+      {
+        return -1;
+      }
+    }
+
+    of_flow_stats_reply_entries_bind(reply, &list);
+    of_flow_stats_entry_init(&entry, OF_VERSION_1_3, -1, 1);
+    if (of_list_flow_stats_entry_append_bind(&list, &entry) < 0)
+    {
+      of_object_delete(reply);
+      return -1;
+    }
+
+    of_flow_stats_entry_cookie_set(&entry, i);
+    of_flow_stats_entry_priority_set(&entry, 1000);
+    of_flow_stats_entry_idle_timeout_set(&entry, 0);
+    of_flow_stats_entry_hard_timeout_set(&entry, 0);
+    of_flow_stats_entry_flags_set(&entry, 0);
+    if (of_flow_stats_entry_match_set(&entry, &fixture->match) < 0 ||
+        of_flow_stats_entry_instructions_set(&entry, fixture->insts) < 0)
+    {
+      of_object_delete(reply);
+      return -1;
+    }
+    of_flow_stats_entry_table_id_set(&entry, 60);
+    of_flow_stats_entry_duration_sec_set(&entry, i);
+    of_flow_stats_entry_duration_nsec_set(&entry, 0);
+    of_flow_stats_entry_packet_count_set(&entry, i);
+    of_flow_stats_entry_byte_count_set(&entry, (uint64_t)i * 64);
+  }
+
+  if (reply)
+  {
+    loci_bench_sink += reply->length;
+    of_object_delete(reply);
+  }
+  return 0;
+}
+
+/* Build a packet_in the way ind_ofdpa_fwd_pkt_in() does */
+static int
+loci_bench_packet_in_build(loci_bench_fixture_t *fixture, uint32_t iterations)
+{
+  of_octets_t octets = { .data = fixture->packet, .bytes = sizeof(fixture->packet) };
+  of_packet_in_t *packet_in;
+  of_match_t match;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    memset(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.in_port = 1 + (i & 0x1f);
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+
+    if ((packet_in = of_packet_in_new(OF_VERSION_1_3)) == NULL)
+    {
+      return -1;
+    }
+    of_packet_in_total_len_set(packet_in, octets.bytes);
+    of_packet_in_reason_set(packet_in, OF_PACKET_IN_REASON_ACTION);
+    of_packet_in_table_id_set(packet_in, 60);
+    of_packet_in_cookie_set(packet_in, 0xffffffffffffffffLL);
+    if (of_packet_in_match_set(packet_in, &match) != OF_ERROR_NONE ||
+        of_packet_in_data_set(packet_in, &octets) != OF_ERROR_NONE)
+    {
+      of_packet_in_delete(packet_in);
+      return -1;
+    }
+    loci_bench_sink += packet_in->length;
+    of_packet_in_delete(packet_in);
+  }
+  return 0;
+}
+
+static const struct
+{
+  const char      *name;
+  loci_bench_fn_t fn;
+} loci_bench_cases[] =
+{
+  { "match_serialize",          loci_bench_match_serialize },
+  { "match_deserialize",        loci_bench_match_deserialize },
+  { "match_more_specific",      loci_bench_match_more_specific },
+  { "object_dup",               loci_bench_object_dup },
+  { "flow_add_parse",           loci_bench_flow_add_parse },
+  { "flow_add_parse_light",     loci_bench_flow_add_parse_light },
+  { "flow_stats_entry_append",  loci_bench_flow_stats_entry_append },
+  { "packet_in_build",          loci_bench_packet_in_build },
+};
+
+/****************************************************************
+ * Driver
+ ****************************************************************/
+
+static uint64_t
+loci_bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int
+loci_bench_ns_compare(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+/*
+ * Warm a case up, time it arguments->repeats times and write its result
+ * line. Returns -1 if an operation failed.
+ */
+static int
+loci_bench_case_run(const arguments_t *arguments, loci_bench_fixture_t *fixture,
+                    int index, int first)
+{
+  uint64_t total[LOCI_BENCH_REPEATS_MAX];
+  uint64_t start, median;
+  uint32_t r;
+
+  if (loci_bench_cases[index].fn(fixture, arguments->iterations / 10 + 1) < 0)
+  {
+    fprintf(stderr, "%s failed\n", loci_bench_cases[index].name);
+    return -1;
+  }
+
+  for (r = 0; r < arguments->repeats; r++)
+  {
+    start = loci_bench_now_ns();
+    if (loci_bench_cases[index].fn(fixture, arguments->iterations) < 0)
+    {
+      fprintf(stderr, "%s failed\n", loci_bench_cases[index].name);
+      return -1;
+    }
+    total[r] = loci_bench_now_ns() - start;
+  }
+
+  qsort(total, arguments->repeats, sizeof(*total), loci_bench_ns_compare);
+  median = total[arguments->repeats / 2];
+
+  printf("%s    {\"name\": \"%s\", \"iterations\": %u, \"repeats\": %u, "
+         "\"ns_per_op\": %.2f, \"ns_per_op_min\": %.2f, \"ops_per_sec\": %.0f}",
+         first ? "" : ",\n",
+         loci_bench_cases[index].name, arguments->iterations, arguments->repeats,
+         (double)median / arguments->iterations,
+         (double)total[0] / arguments->iterations,
+         median ? arguments->iterations * 1e9 / median : 0);
+  fflush(stdout);
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  loci_bench_fixture_t fixture;
+  int i, first = 1, rv = 0;
+
+  struct argp argp =
+    {
+      .doc      = "Times the LOCI operations on the OF Agent fast paths and writes the results as JSON.",
+      .options  = options,
+      .parser   = parse_opt,
+    };
+
+  arguments_t arguments =
+  {
+    .iterations = 1000000,
+    .repeats = 5,
+    .filter = NULL,
+  };
+
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  if (loci_bench_fixture_init(&fixture) < 0)
+  {
+    fprintf(stderr, "Failed to build the benchmark objects\n");
+    loci_bench_fixture_finish(&fixture);
+    return 1;
+  }
+
+  printf("{\n  \"benchmark\": \"loci_bench\",\n  \"format\": %d,\n"
+         "  \"of_version\": \"1.3\",\n  \"results\": [\n",
+         LOCI_BENCH_FORMAT);
+
+  for (i = 0; i < sizeof(loci_bench_cases) / sizeof(loci_bench_cases[0]); i++)
+  {
+    if (arguments.filter && strstr(loci_bench_cases[i].name, arguments.filter) == NULL)
+    {
+      continue;
+    }
+    if (loci_bench_case_run(&arguments, &fixture, i, first) < 0)
+    {
+      rv = 1;
+      break;
+    }
+    first = 0;
+  }
+
+  printf("%s  ]\n}\n", first ? "" : "\n");
+
+  loci_bench_fixture_finish(&fixture);
+  return rv;
+}
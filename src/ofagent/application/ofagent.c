@@ -58,7 +58,10 @@
 #include <SocketManager/socketmanager.h>
 #include <OFConnectionManager/ofconnectionmanager.h>
 #include <OFStateManager/ofstatemanager.h>
+#include <Configuration/configuration.h>
 #include <indigo/forwarding.h>
+#include <indigo/mem_budget.h>
+#include <indigo/mem_arena.h>
 #include <ind_ofdpa_util.h>
 
 #define PIDFILE "/var/run/ofagent/.pid"
@@ -99,6 +102,37 @@ typedef struct
   int           debugComps[10]; // 10: TODO: update from OF Agent debug levels
 #endif
   of_dpid_t     dpid;
+  int           flowworker;
+  int           flowwindow;
+  int           ofdpaclients;
+  int           portstatsinterval;
+  int           portstatuswindow;
+  int           meterstatsinterval;
+  int           groupstatsinterval;
+  int           queuestatsinterval;
+  int           oamstatsinterval;
+  int           aggstatsinterval;
+  int           statscoalesce;
+  int           scrubinterval;
+  int           scrubrepair;
+  int           pktinclassify;
+  int           pduoffload;
+  int           arpresponder;
+  int           maclearn;
+  int           ffassist;
+  int           resilientecmp;
+  int           pktbuffers;
+  int           rxthread;
+  int           rxcpu;
+  int           rpcstats;
+  int           syslog;
+  int           cli;
+  int           logrecords;
+  int           membudget;
+  int           arena;
+  int           warmstart;
+  char          *snapshot;
+  char          *config;
 } arguments_t;
 
 /* The options we understand. */
@@ -112,6 +146,37 @@ static struct argp_option options[] =
   { "controller", 't', "IP:PORT", 0,  "Controller" },
   { "listen",   'l',  "IP:PORT", 0,  "Listen" },
   { "dpid", 'i',  "DATAPATHID", 0,  "Specify Datapath ID." },
+  { "flowworker", 'w', 0, 0,  "Program flow adds on a worker thread." },
+  { "flowwindow", 'W', "MS", 0,  "Hold flow adds for MS milliseconds so modifies and deletes of them from a pipelined controller never reach OF-DPA." },
+  { "ofdpaclients", 'C', "THREADS", 0,  "Run OF-DPA calls that can complete later, such as the port stats cache sweep, on THREADS client threads." },
+  { "portstatsinterval", 'r', "MS", 0,  "Answer all-port stats requests from a cache refreshed every MS milliseconds." },
+  { "portstatuswindow", 'e', "MS", 0,  "Send one port status per port for the events of each MS millisecond window." },
+  { "meterstatsinterval", 'm', "MS", 0,  "Refresh meter stats in the background every MS milliseconds." },
+  { "groupstatsinterval", 'G', "MS", 0,  "Answer group stats requests from a cache refreshed every MS milliseconds." },
+  { "queuestatsinterval", 'q', "MS", 0,  "Answer queue stats requests from a cache refreshed every MS milliseconds." },
+  { "oamstatsinterval", 'o', "MS", 0,  "Collect OAM MEP counters in the background every MS milliseconds." },
+  { "aggstatsinterval", 'g', "MS", 0,  "Answer table and cookie aggregate stats requests from flow counters refreshed every MS milliseconds." },
+  { "statscoalesce", 'j', "MS", 0,  "Answer port, table and group stats requests identical to one answered in the last MS milliseconds with the same reply." },
+  { "scrubinterval", 'S', "MS", 0,  "Check a few OF-DPA flows against the agent's flows every MS milliseconds." },
+  { "scrubrepair", 'R', 0, 0,  "Delete OF-DPA flows the scrubber finds the agent does not know, and report flows missing from OF-DPA as removed." },
+  { "pktinclassify", 'k', 0, 0,  "Classify packet-ins and apply per-class rate limits before the controller." },
+  { "pduoffload", 'u', 0, 0,  "Send and check controller-programmed LLDP/LACP PDUs in the agent." },
+  { "arpresponder", 'A', 0, 0,  "Answer ARP requests for the addresses in the arp_responder gentable in the agent." },
+  { "maclearn", 'L', "AGING_SEC", 0,  "Learn source MACs in the agent, installing Bridging flows that age out after AGING_SEC idle seconds." },
+  { "ffassist", 'f', 0, 0,  "Switch fast failover group buckets in the agent when a watched port goes down." },
+  { "resilientecmp", 'b', "SIZE", 0,  "Program L3 ECMP groups as SIZE bucket tables that only remap changed members." },
+  { "pktbuffers", 'n', "COUNT", 0,  "Keep up to COUNT punted frames so packet-ins carry a buffer_id and only miss_send_len bytes." },
+  { "rxthread", 'x', "CPU", OPTION_ARG_OPTIONAL,  "Receive punted packets on a thread of their own, pinned to CPU if given." },
+  { "rpcstats", 'O', 0, 0,  "Count OF-DPA API calls from startup, as the ucli rpcstats command does, and report them as ofdpa.rpc.* debug counters." },
+  { "syslog", 'y', 0, 0,  "Send log messages to syslog." },
+  { "cli", 'K', 0, 0,  "Run ucli commands read from standard input, such as ofdpa pktcap." },
+  { "logwriter", 'z', "RECORDS", 0,  "Queue up to RECORDS log messages for a writer thread instead of logging in place." },
+  { "thread", 'T', "ROLE@PLACEMENT", 0,  "Place the ROLE threads (event_loop, rx, flow_worker, ofdpa_client, log, pcap) on CPUS[/POLICY[/PRIORITY]], e.g. rx@2/fifo/20. Repeatable." },
+  { "membudget", 'M', "MB", 0,  "Refuse new multipart requests and flow adds once queued output and pending requests reach MB megabytes." },
+  { "arena", 'H', "MB", 0,  "Carve the flow table pools and connection output rings out of MB megabytes of 2 MiB huge pages, or of 2 MiB aligned pages where none are reserved." },
+  { "warmstart", 's', 0, 0,  "Adopt the flows and groups already in OF-DPA, in the background at startup." },
+  { "snapshot", 'p', "PATH", OPTION_ARG_OPTIONAL,  "Keep a snapshot of the tables to restore them from at startup." },
+  { "config", 'F', "PATH", 0,  "Load the JSON configuration in PATH at startup and again on SIGHUP." },
   { 0 }
 };
 
@@ -284,6 +349,328 @@ static error_t parse_opt(int key, char *arg, struct argp_state *state)
 
     break;
 
+    case 'w':                           /* flowworker */
+      arguments->flowworker = 1;
+      break;
+
+    case 'r':                           /* portstatsinterval */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->portstatsinterval = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->portstatsinterval <= 0)
+        {
+          argp_error(state, "Invalid port stats interval \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'W':                           /* flowwindow */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->flowwindow = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->flowwindow < 0)
+        {
+          argp_error(state, "Invalid flow window \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'C':                           /* ofdpaclients */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->ofdpaclients = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->ofdpaclients <= 0)
+        {
+          argp_error(state, "Invalid OF-DPA client thread count \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'e':                           /* portstatuswindow */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->portstatuswindow = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->portstatuswindow < 0)
+        {
+          argp_error(state, "Invalid port status window \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'm':                           /* meterstatsinterval */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->meterstatsinterval = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->meterstatsinterval <= 0)
+        {
+          argp_error(state, "Invalid meter stats interval \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'T':                           /* thread */
+      if (ind_ofdpa_thread_option_parse(arg) < 0)
+      {
+        argp_error(state, "Invalid thread placement \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case 'G':                           /* groupstatsinterval */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->groupstatsinterval = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->groupstatsinterval <= 0)
+        {
+          argp_error(state, "Invalid group stats interval \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'S':                           /* scrubinterval */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->scrubinterval = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->scrubinterval <= 0)
+        {
+          argp_error(state, "Invalid scrub interval \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'R':                           /* scrubrepair */
+      arguments->scrubrepair = 1;
+      break;
+
+    case 'q':                           /* queuestatsinterval */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->queuestatsinterval = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->queuestatsinterval <= 0)
+        {
+          argp_error(state, "Invalid queue stats interval \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'o':                           /* oamstatsinterval */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->oamstatsinterval = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->oamstatsinterval <= 0)
+        {
+          argp_error(state, "Invalid OAM stats interval \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'g':                           /* aggstatsinterval */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->aggstatsinterval = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->aggstatsinterval <= 0)
+        {
+          argp_error(state, "Invalid aggregate stats interval \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'j':                           /* statscoalesce */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->statscoalesce = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->statscoalesce <= 0)
+        {
+          argp_error(state, "Invalid stats coalescing window \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'k':                           /* pktinclassify */
+      arguments->pktinclassify = 1;
+      break;
+
+    case 'u':                           /* pduoffload */
+      arguments->pduoffload = 1;
+      break;
+
+    case 'A':                           /* arpresponder */
+      arguments->arpresponder = 1;
+      break;
+
+    case 'f':                           /* ffassist */
+      arguments->ffassist = 1;
+      break;
+
+    case 'L':                           /* maclearn */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->maclearn = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->maclearn <= 0)
+        {
+          argp_error(state, "Invalid MAC aging time \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'b':                           /* resilientecmp */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->resilientecmp = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->resilientecmp <= 0)
+        {
+          argp_error(state, "Invalid resilient ECMP table size \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'n':                           /* pktbuffers */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->pktbuffers = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->pktbuffers <= 0)
+        {
+          argp_error(state, "Invalid packet buffer count \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'x':                           /* rxthread */
+      arguments->rxthread = 1;
+      if (arg)
+      {
+        char *end;
+
+        errno = 0;
+        arguments->rxcpu = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->rxcpu < 0)
+        {
+          argp_error(state, "Invalid receive thread CPU \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'O':                           /* rpcstats */
+      arguments->rpcstats = 1;
+      break;
+
+    case 'y':                           /* syslog */
+#if AIM_CONFIG_INCLUDE_PVS_SYSLOG == 1
+      arguments->syslog = 1;
+      break;
+#else
+      argp_error(state, "syslog is not supported in this build");
+      return EINVAL;
+#endif
+
+    case 'K':                           /* cli */
+#if IND_OFDPA_CONFIG_INCLUDE_UCLI == 1
+      arguments->cli = 1;
+      break;
+#else
+      argp_error(state, "ucli is not supported in this build");
+      return EINVAL;
+#endif
+
+    case 'z':                           /* logwriter */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->logrecords = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->logrecords <= 0 ||
+            arguments->logrecords > INDIGO_LOG_ASYNC_RECORDS_MAX)
+        {
+          argp_error(state, "Invalid log record count \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'M':                           /* membudget */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->membudget = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' || arguments->membudget <= 0)
+        {
+          argp_error(state, "Invalid memory budget \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 'H':                           /* arena */
+      {
+        char *end;
+
+        errno = 0;
+        arguments->arena = strtol(arg, &end, 0);
+        if (errno != 0 || *end != '\0' ||
+            arguments->arena < INDIGO_MEM_ARENA_CHUNK_BYTES / (1024 * 1024))
+        {
+          argp_error(state, "Invalid arena size \"%s\"", arg);
+          return EINVAL;
+        }
+      }
+      break;
+
+    case 's':                           /* warmstart */
+      arguments->warmstart = 1;
+      break;
+
+    case 'p':                           /* snapshot */
+      arguments->snapshot = arg ? arg : IND_CORE_SNAPSHOT_PATH_DEFAULT;
+      break;
+
+    case 'F':                           /* config */
+      arguments->config = arg;
+      break;
+
     case ARGP_KEY_NO_ARGS:
     case ARGP_KEY_END:
       break;
@@ -413,6 +800,7 @@ ind_ofdpa_event_socket_ready(int socket_id, void *cookie, int read_ready,
   {
     ind_ofdpa_flow_event_receive();
     ind_ofdpa_port_event_receive();
+    ind_ofdpa_oam_event_receive();
   }
   return;
 }
@@ -438,6 +826,99 @@ ind_ofdpa_pkt_socket_ready(int socket_id, void *cookie, int read_ready,
   return;
 }
 
+#if IND_OFDPA_CONFIG_INCLUDE_UCLI == 1
+/*
+ * Commands read from standard input run on the main loop, so they see
+ * the driver and flowtable state from its own thread.
+ */
+static ucli_t *ofagent_ucli;
+static char ofagent_cli_line[512];
+static int ofagent_cli_len;
+
+static void
+ofagent_cli_ready(int socket_id, void *cookie, int read_ready,
+                  int write_ready, int error_seen)
+{
+  char *nl;
+  int len;
+
+  len = read(socket_id, ofagent_cli_line + ofagent_cli_len,
+             sizeof(ofagent_cli_line) - 1 - ofagent_cli_len);
+  if (len <= 0)
+  {
+    ind_soc_socket_unregister(socket_id);
+    return;
+  }
+  ofagent_cli_len += len;
+  ofagent_cli_line[ofagent_cli_len] = '\0';
+
+  while ((nl = strchr(ofagent_cli_line, '\n')) != NULL)
+  {
+    *nl = '\0';
+    ucli_dispatch_string(ofagent_ucli, &aim_pvs_stdout, ofagent_cli_line);
+    ofagent_cli_len -= nl + 1 - ofagent_cli_line;
+    memmove(ofagent_cli_line, nl + 1, ofagent_cli_len + 1);
+  }
+
+  if (ofagent_cli_len == sizeof(ofagent_cli_line) - 1)
+  {
+    AIM_LOG_ERROR("Dropping ucli command longer than %d bytes", ofagent_cli_len);
+    ofagent_cli_len = 0;
+  }
+}
+
+static int
+ofagent_cli_start(void)
+{
+  ucli_init();
+  if ((ofagent_ucli = ucli_create("ofagent", NULL, NULL)) == NULL ||
+      ucli_node_add(ofagent_ucli, ind_ofdpa_ucli_node_create()) < 0)
+  {
+    AIM_LOG_ERROR("Failed to create the ucli");
+    return -1;
+  }
+
+  return ind_soc_socket_register(STDIN_FILENO, ofagent_cli_ready, NULL);
+}
+
+static void
+ofagent_cli_stop(void)
+{
+  if (ofagent_ucli != NULL)
+  {
+    ind_soc_socket_unregister(STDIN_FILENO);
+    ucli_destroy(ofagent_ucli);
+    ucli_denit();
+    ofagent_ucli = NULL;
+  }
+}
+#endif /* IND_OFDPA_CONFIG_INCLUDE_UCLI */
+
+/*
+ * Keep a snapshot of the tables. It is taken from the adopted state, so
+ * after a background warm start this runs only once that has finished.
+ */
+static char *ofagent_snapshot_path;
+
+static void ofagent_snapshot_start(void)
+{
+  char *snapshotdir = strdup(ofagent_snapshot_path);
+
+  errno = 0;
+  if ((0 != mkdir(dirname(snapshotdir), S_IRWXU | S_IRWXG | S_IRWXO)) &&
+      (EEXIST != errno))
+  {
+    AIM_LOG_ERROR("Failed to create directory for %s: %s",
+                  ofagent_snapshot_path, strerror(errno));
+  }
+  else if (ind_core_snapshot_start(ofagent_snapshot_path) < 0)
+  {
+    AIM_LOG_ERROR("Failed to start the snapshot in %s",
+                  ofagent_snapshot_path);
+  }
+  free(snapshotdir);
+}
+
 int main(int argc, char *argv[])
 {
   char *programName = basename(strdup(argv[0]));
@@ -451,6 +932,8 @@ int main(int argc, char *argv[])
   int i;
   static char docBuffer[600];
   OFDPA_ERROR_t     rc;
+  aim_pvs_t        *log_pvs = &aim_pvs_stderr;
+  aim_pvs_t        *async_pvs;
 
   /* Our argp parser. */
   struct argp argp =
@@ -468,6 +951,36 @@ int main(int argc, char *argv[])
     .debugComps = { 0 },
 #endif
     .dpid = OFSTATEMANAGER_CONFIG_DPID_DEFAULT,
+    .flowworker = 0,
+    .flowwindow = 0,
+    .ofdpaclients = 0,
+    .portstatsinterval = 0,
+    .portstatuswindow = 0,
+    .meterstatsinterval = 0,
+    .groupstatsinterval = 0,
+    .queuestatsinterval = 0,
+    .oamstatsinterval = 0,
+    .aggstatsinterval = 0,
+    .statscoalesce = 0,
+    .scrubinterval = 0,
+    .scrubrepair = 0,
+    .pktinclassify = 0,
+    .pduoffload = 0,
+    .arpresponder = 0,
+    .maclearn = 0,
+    .ffassist = 0,
+    .resilientecmp = 0,
+    .pktbuffers = 0,
+    .rxthread = 0,
+    .rxcpu = -1,
+    .rpcstats = 0,
+    .syslog = 0,
+    .logrecords = 0,
+    .membudget = 0,
+    .arena = 0,
+    .warmstart = 0,
+    .snapshot = NULL,
+    .config = NULL,
   };
 
   argp_program_version = ""; 
@@ -492,6 +1005,7 @@ int main(int argc, char *argv[])
   }
 #endif
   i += snprintf(&docBuffer[i], sizeof(docBuffer) - i, "DATAPATHID = 0x%016llX\n", (long long unsigned int)OFSTATEMANAGER_CONFIG_DPID_DEFAULT);
+  i += snprintf(&docBuffer[i], sizeof(docBuffer) - i, "PATH = %s\n", IND_CORE_SNAPSHOT_PATH_DEFAULT);
 
   i += snprintf(&docBuffer[i], sizeof(docBuffer) - i, "\n");
 
@@ -513,6 +1027,12 @@ int main(int argc, char *argv[])
      `arguments'. */
   argp_parse(&argp, argc, argv, 0, 0, &arguments);
 
+  /* The threads started from here on are placed as they start */
+  ind_ofdpa_thread_register(INDIGO_THREAD_EVENT_LOOP, pthread_self());
+
+  /* Before the flow table and connections allocate anything */
+  indigo_mem_arena_limit_set((uint64_t)arguments.arena * 1024 * 1024);
+
   if (is_already_running(programName))
   {
     exit(EXIT_FAILURE);
@@ -569,6 +1089,24 @@ int main(int argc, char *argv[])
       aim_log_fid_set_all(AIM_LOG_FLAG_TRACE, 1);
   }
 
+  /* Set up where the log messages go */
+#if AIM_CONFIG_INCLUDE_PVS_SYSLOG == 1
+  if (arguments.syslog) {
+      log_pvs = aim_pvs_syslog_get();
+  }
+#endif
+
+  if (arguments.logrecords) {
+      async_pvs = indigo_log_async_start(log_pvs, arguments.logrecords);
+      if (async_pvs == NULL) {
+          AIM_LOG_ERROR("Failed to start the log writer");
+          return 1;
+      }
+      aim_log_pvs_set_all(async_pvs);
+  } else if (log_pvs != &aim_pvs_stderr) {
+      aim_log_pvs_set_all(log_pvs);
+  }
+
   /* Setup Indigo DPID */
   printf("OF Datapath ID: 0x%016llX\n", (long long unsigned int)arguments.dpid);
   (void)indigo_core_dpid_set(arguments.dpid);
@@ -576,6 +1114,12 @@ int main(int argc, char *argv[])
   /* Initialize all modules */
   printf("Initializing the system.\r\n");
 
+  /* Before the first OF-DPA call, so those made at startup are counted */
+  if (arguments.rpcstats)
+  {
+    ind_ofdpa_rpc_stats_enable_set(1);
+  }
+
   rc = ofdpaClientInitialize(programName);
   if (rc != OFDPA_E_NONE)
   {
@@ -602,6 +1146,11 @@ int main(int argc, char *argv[])
       return 1;
   }
 
+  /* OF-DPA expires flows itself and reports them as flow events */
+  core_cfg.expire_flows = 0;
+  core_cfg.aggregate_stats_refresh_ms = arguments.aggstatsinterval;
+  core_cfg.stats_reply_cache_ms = arguments.statscoalesce;
+
   if (ind_core_init(&core_cfg) < 0) {
       AIM_LOG_FATAL("Failed to initialize Indigo core module");
       return 1;
@@ -624,6 +1173,28 @@ int main(int argc, char *argv[])
       return 1;
   }
 
+  /*
+   * Adopt the existing tables.  A snapshot that still matches OF-DPA is
+   * replayed from memory before any controller can connect.  Otherwise a
+   * warm start reads every entry back in the background once the event
+   * loop runs, so the handshake is not held up; the core holds requests
+   * for each table until it has been read back.
+   */
+  ofagent_snapshot_path = arguments.snapshot;
+  if (arguments.snapshot &&
+      ind_core_snapshot_restore(arguments.snapshot) == INDIGO_ERROR_NONE) {
+      AIM_LOG_MSG("Restored the tables from %s", arguments.snapshot);
+      ofagent_snapshot_start();
+  } else if (arguments.warmstart) {
+      if (ind_ofdpa_warm_start(arguments.snapshot ?
+                               ofagent_snapshot_start : NULL) < 0) {
+          AIM_LOG_FATAL("Failed to adopt the existing OF-DPA state");
+          return 1;
+      }
+  } else if (arguments.snapshot) {
+      ofagent_snapshot_start();
+  }
+
   /* Add controllers from command line */
   {
       biglist_t *element;
@@ -735,17 +1306,158 @@ int main(int argc, char *argv[])
     return 1;
   }
 
-  if (ind_soc_socket_register(ofdpaClientPktSockFdGet(), ind_ofdpa_pkt_socket_ready, NULL) < 0)
+  if (arguments.rxthread)
+  {
+    if (ind_ofdpa_rx_thread_start(arguments.rxcpu) < 0)
+    {
+      return 1;
+    }
+  }
+  else if (ind_soc_socket_register(ofdpaClientPktSockFdGet(), ind_ofdpa_pkt_socket_ready, NULL) < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.flowworker && ind_ofdpa_flow_worker_start() < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.ofdpaclients && ind_ofdpa_async_start(arguments.ofdpaclients) < 0)
+  {
+    return 1;
+  }
+
+  ind_ofdpa_port_status_window_set(arguments.portstatuswindow);
+  ind_ofdpa_flow_window_set(arguments.flowwindow);
+
+  if (arguments.portstatsinterval &&
+      ind_ofdpa_port_stats_cache_start(arguments.portstatsinterval) < 0)
   {
     return 1;
   }
 
+  if (arguments.meterstatsinterval &&
+      ind_ofdpa_meter_stats_start(arguments.meterstatsinterval) < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.groupstatsinterval &&
+      ind_ofdpa_group_stats_start(arguments.groupstatsinterval) < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.queuestatsinterval &&
+      ind_ofdpa_queue_stats_cache_start(arguments.queuestatsinterval) < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.scrubinterval &&
+      ind_ofdpa_flow_scrub_start(arguments.scrubinterval, arguments.scrubrepair) < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.oamstatsinterval &&
+      ind_ofdpa_oam_collector_start(arguments.oamstatsinterval) < 0)
+  {
+    return 1;
+  }
+
+  ind_ofdpa_host_gentables_register();
+  ind_ofdpa_experimenter_register();
+  ind_ofdpa_pimu_init();
+  ind_ofdpa_threads_init();
+  ind_ofdpa_preload_init();
+
+  if (arguments.config)
+  {
+    if (ind_cfg_filename_set(arguments.config) < 0 ||
+        ind_cfg_load() < 0)
+    {
+      AIM_LOG_ERROR("Failed to load the configuration in %s", arguments.config);
+      return 1;
+    }
+    if (ind_cfg_install_sighup_handler() < 0)
+    {
+      AIM_LOG_ERROR("Failed to install the configuration reload handler");
+    }
+  }
+
+  if (arguments.pktinclassify && ind_ofdpa_pktin_classifier_start() < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.pduoffload && ind_ofdpa_pdu_offload_start() < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.arpresponder && ind_ofdpa_arp_responder_start() < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.maclearn && ind_ofdpa_learn_start(arguments.maclearn) < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.ffassist && ind_ofdpa_ff_assist_start() < 0)
+  {
+    return 1;
+  }
+
+  if (arguments.resilientecmp &&
+      ind_ofdpa_resilient_ecmp_set(arguments.resilientecmp) < 0)
+  {
+    AIM_LOG_ERROR("Resilient ECMP table size must be at most 1024");
+    return 1;
+  }
+
+  indigo_mem_budget_limit_set((uint64_t)arguments.membudget * 1024 * 1024);
+
+  if (arguments.pktbuffers &&
+      ind_ofdpa_pktbuf_config(arguments.pktbuffers, 0) != INDIGO_ERROR_NONE)
+  {
+    AIM_LOG_ERROR("Packet buffer count must be at most 32768");
+    return 1;
+  }
+
+#if IND_OFDPA_CONFIG_INCLUDE_UCLI == 1
+  if (arguments.cli && ofagent_cli_start() < 0)
+  {
+    return 1;
+  }
+#endif
+
   ind_soc_select_and_run(-1);
 
   AIM_LOG_MSG("Stopping %s", argp_program_version);
 
+#if IND_OFDPA_CONFIG_INCLUDE_UCLI == 1
+  ofagent_cli_stop();
+#endif
+
+  ind_ofdpa_rx_thread_stop();
+  ind_ofdpa_flow_scrub_stop();
+  ind_ofdpa_oam_collector_stop();
+  ind_ofdpa_queue_stats_cache_stop();
+  ind_ofdpa_meter_stats_stop();
+  ind_ofdpa_group_stats_stop();
+  ind_ofdpa_port_stats_cache_stop();
+  ind_ofdpa_async_stop();
+  ind_ofdpa_flow_worker_stop();
+
   ind_core_finish();
   ind_cxn_finish();
   ind_soc_finish();
+
+  aim_log_pvs_set_all(log_pvs);
+  indigo_log_async_stop();
   return 0;
 }
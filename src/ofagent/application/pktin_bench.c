@@ -0,0 +1,699 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2015
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     pktin_bench.c
+*
+* @purpose      Packet-in throughput benchmark for the OF Agent
+*
+* @component    OF-DPA
+*
+* @comments     Synthetic frames are fed to ind_ofdpa_pkt_receive() by a
+*               fake OF-DPA packet socket: ofdpaPktReceive() and
+*               ofdpaMaxPktSizeGet() are defined here and take the place
+*               of those in the shared OF-DPA client library. The packet
+*               socket is never bound, so no traffic has to reach the
+*               switch. Everything after that is the code ofagent runs:
+*               the driver builds the packet_in, indigo_core_packet_in()
+*               notifies the listeners, and indigo_cxn_send_async_message()
+*               queues it on each controller connection.
+*
+*               The controllers are threads in this process. Each listens
+*               on a loopback port, completes the handshake and then
+*               counts the packet_ins it reads. A delay per packet_in slows
+*               a controller down so its output queue fills and packet_ins
+*               are dropped at PACKET_IN_DROP_QUEUE_MAX.
+*
+*               Built with -DPKTIN_BENCH_COUNT_COPIES and linked with
+*               -Wl,--wrap=memcpy, the bytes passed to memcpy() between
+*               the packet socket and the controller socket are counted.
+*               Copies the compiler inlines are not seen.
+*
+* @create       14 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <argp.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "ofdpa_api.h"
+#include <SocketManager/socketmanager.h>
+#include <AIM/aim.h>
+#include <indigo/types.h>
+#include <indigo/of_state_manager.h>
+#include <indigo/of_connection_manager.h>
+#include <OFStateManager/ofstatemanager.h>
+#include <OFConnectionManager/ofconnectionmanager.h>
+#include <ind_ofdpa_util.h>
+
+#define AIM_LOG_MODULE_NAME pktin_bench
+
+#include <AIM/aim_log.h>
+
+AIM_LOG_STRUCT_DEFINE(
+                      AIM_LOG_OPTIONS_DEFAULT,
+                      AIM_LOG_BITS_DEFAULT,
+                      NULL,     /* Custom Log Map */
+                      0
+                      );
+
+#define PKTIN_BENCH_CONTROLLERS_MAX  8
+
+/* Size of the OF-DPA frame check sequence the driver strips */
+#define PKTIN_BENCH_FCS_BYTES  4
+
+/* Give up waiting for the controllers after this long without progress */
+#define PKTIN_BENCH_IDLE_MS  2000
+
+int ofagent_of_version = OF_VERSION_1_3;
+
+typedef struct
+{
+  uint32_t controllers;
+  uint64_t count;
+  uint32_t size;
+  uint32_t burst;
+  uint32_t ports;
+  uint32_t delay_us;
+} arguments_t;
+
+typedef struct
+{
+  int             listen_fd;
+  int             fd;
+  uint16_t        port;
+  pthread_t       thread;
+  uint32_t        delay_us;
+  indigo_cxn_id_t cxn_id;
+  uint64_t        packet_ins;   /* Written by the controller thread */
+} pktin_bench_controller_t;
+
+static struct argp_option options[] =
+{
+  { "controllers", 'c', "COUNT",   0, "Number of loopback controllers." },
+  { "count",       'n', "COUNT",   0, "Number of packets to feed." },
+  { "size",        's', "BYTES",   0, "Frame size, without FCS." },
+  { "burst",       'b', "COUNT",   0, "Packets the packet socket holds per wakeup." },
+  { "ports",       'p', "COUNT",   0, "Spread the packets over COUNT input ports." },
+  { "delay",       'd', "USEC",    0, "Time each controller spends on a packet_in." },
+  { 0 }
+};
+
+extern void __ofstatemanager_module_init__(void);
+extern void __biglist_module_init__(void);
+extern void __configuration_module_init__(void);
+extern void __ofconnectionmanager_module_init__(void);
+extern void __socketmanager_module_init__(void);
+extern void __ind_ofdpa_driver_module_init__(void);
+
+static ind_soc_config_t soc_cfg;
+static ind_cxn_config_t cxn_cfg;
+static ind_core_config_t core_cfg;
+
+static pktin_bench_controller_t pktin_bench_controllers[PKTIN_BENCH_CONTROLLERS_MAX];
+
+/* Fake packet socket state */
+static uint8_t *pktin_bench_frame;
+static uint32_t pktin_bench_frame_size;
+static uint32_t pktin_bench_ports;
+static uint32_t pktin_bench_queued;
+static uint64_t pktin_bench_fed;
+
+#ifdef PKTIN_BENCH_COUNT_COPIES
+static uint64_t pktin_bench_copied;
+
+extern void *__real_memcpy(void *dst, const void *src, size_t n);
+
+void *
+__wrap_memcpy(void *dst, const void *src, size_t n)
+{
+  pktin_bench_copied += n;
+  return __real_memcpy(dst, src, n);
+}
+#define PKTIN_BENCH_FILL(dst, src, n) __real_memcpy((dst), (src), (n))
+#else
+#define PKTIN_BENCH_FILL(dst, src, n) memcpy((dst), (src), (n))
+#endif
+
+/* Parse a single option. */
+static error_t parse_opt(int key, char *arg, struct argp_state *state)
+{
+  arguments_t *arguments = state->input;
+  unsigned long long value;
+  char *endptr;
+
+  switch (key)
+  {
+    case 'c':
+    case 'n':
+    case 's':
+    case 'b':
+    case 'p':
+    case 'd':
+      errno = 0;
+      value = strtoull(arg, &endptr, 0);
+      if ((errno != 0) || (*endptr != '\0') || ((value == 0) && (key != 'd')))
+      {
+        argp_error(state, "Invalid value \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case ARGP_KEY_NO_ARGS:
+    case ARGP_KEY_END:
+      return 0;
+
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+
+  switch (key)
+  {
+    case 'c':                           /* controllers */
+      if (value > PKTIN_BENCH_CONTROLLERS_MAX)
+      {
+        argp_error(state, "At most %d controllers", PKTIN_BENCH_CONTROLLERS_MAX);
+        return EINVAL;
+      }
+      arguments->controllers = value;
+      break;
+
+    case 'n':                           /* count */
+      arguments->count = value;
+      break;
+
+    case 's':                           /* size */
+      if ((value < 60) || (value > 9216))
+      {
+        argp_error(state, "Frame size must be 60 to 9216 bytes");
+        return EINVAL;
+      }
+      arguments->size = value;
+      break;
+
+    case 'b':                           /* burst */
+      arguments->burst = value;
+      break;
+
+    case 'p':                           /* ports */
+      arguments->ports = value;
+      break;
+
+    case 'd':                           /* delay */
+      arguments->delay_us = value;
+      break;
+  }
+  return 0;
+}
+
+/****************************************************************
+ * Fake OF-DPA packet socket
+ *
+ * Holds pktin_bench_queued copies of the synthetic frame, then reports
+ * that no packet is waiting, just as the real socket does when drained.
+ ****************************************************************/
+
+OFDPA_ERROR_t ofdpaMaxPktSizeGet(uint32_t *pktSize)
+{
+  *pktSize = pktin_bench_frame_size + PKTIN_BENCH_FCS_BYTES;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPktReceive(struct timeval *timeout, ofdpaPacket_t *pkt)
+{
+  uint32_t len = pktin_bench_frame_size + PKTIN_BENCH_FCS_BYTES;
+
+  if (pktin_bench_queued == 0)
+  {
+    return OFDPA_E_TIMEOUT;
+  }
+  if (pkt->pktData.size < len)
+  {
+    return OFDPA_E_FULL;
+  }
+
+  PKTIN_BENCH_FILL(pkt->pktData.pstart, pktin_bench_frame, len);
+  pkt->pktData.size = len;
+  pkt->reason = OFDPA_PACKET_IN_REASON_ACTION;
+  pkt->tableId = OFDPA_FLOW_TABLE_ID_ACL_POLICY;
+  pkt->inPortNum = 1 + (pktin_bench_fed % pktin_bench_ports);
+
+  pktin_bench_queued--;
+  pktin_bench_fed++;
+  return OFDPA_E_NONE;
+}
+
+/* An IPv4/UDP frame padded to size, followed by an FCS */
+static int
+pktin_bench_frame_init(uint32_t size)
+{
+  static const uint8_t header[] =
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02,       /* eth_dst */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01,       /* eth_src */
+    0x08, 0x00,                               /* IPv4 */
+    0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x11, 0x00, 0x00,                   /* TTL 64, UDP */
+    0x0a, 0x00, 0x00, 0x01,                   /* 10.0.0.1 */
+    0x0a, 0x00, 0x00, 0x02,                   /* 10.0.0.2 */
+    0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  };
+  uint32_t ip_len = size - 14;
+
+  if ((pktin_bench_frame = calloc(1, size + PKTIN_BENCH_FCS_BYTES)) == NULL)
+  {
+    return -1;
+  }
+  PKTIN_BENCH_FILL(pktin_bench_frame, header, sizeof(header));
+  pktin_bench_frame[16] = ip_len >> 8;
+  pktin_bench_frame[17] = ip_len;
+  pktin_bench_frame[38] = (ip_len - 20) >> 8;
+  pktin_bench_frame[39] = ip_len - 20;
+  pktin_bench_frame_size = size;
+  return 0;
+}
+
+/****************************************************************
+ * Loopback controllers
+ ****************************************************************/
+
+static int
+pktin_bench_write(int fd, const uint8_t *buf, int len)
+{
+  int n;
+
+  while (len > 0)
+  {
+    if ((n = send(fd, buf, len, MSG_NOSIGNAL)) < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      return -1;
+    }
+    buf += n;
+    len -= n;
+  }
+  return 0;
+}
+
+static void *
+pktin_bench_controller_main(void *cookie)
+{
+  pktin_bench_controller_t *ctrl = cookie;
+  static const uint8_t hello[] = { OF_VERSION_1_3, 0, 0, 8, 0, 0, 0, 1 };
+  static const uint8_t features_request[] = { OF_VERSION_1_3, 5, 0, 8, 0, 0, 0, 2 };
+  uint8_t buf[65536];
+  uint8_t echo_reply[8];
+  struct timespec delay;
+  int have = 0, n, off, len;
+
+  delay.tv_sec = ctrl->delay_us / 1000000;
+  delay.tv_nsec = (ctrl->delay_us % 1000000) * 1000;
+
+  if ((ctrl->fd = accept(ctrl->listen_fd, NULL, NULL)) < 0)
+  {
+    return NULL;
+  }
+
+  if (pktin_bench_write(ctrl->fd, hello, sizeof(hello)) < 0 ||
+      pktin_bench_write(ctrl->fd, features_request, sizeof(features_request)) < 0)
+  {
+    return NULL;
+  }
+
+  for (;;)
+  {
+    if ((n = recv(ctrl->fd, buf + have, sizeof(buf) - have, 0)) <= 0)
+    {
+      if (n < 0 && errno == EINTR)
+      {
+        continue;
+      }
+      break;
+    }
+    have += n;
+
+    for (off = 0; have - off >= OF_MESSAGE_HEADER_LENGTH; off += len)
+    {
+      len = (buf[off + 2] << 8) | buf[off + 3];
+      if (len < OF_MESSAGE_HEADER_LENGTH)
+      {
+        return NULL;
+      }
+      if (have - off < len)
+      {
+        break;
+      }
+
+      switch (buf[off + 1])
+      {
+        case OF_OBJ_TYPE_ECHO_REQUEST:
+          memcpy(echo_reply, buf + off, sizeof(echo_reply));
+          echo_reply[1] = OF_OBJ_TYPE_ECHO_REPLY;
+          echo_reply[2] = 0;
+          echo_reply[3] = sizeof(echo_reply);
+          (void)pktin_bench_write(ctrl->fd, echo_reply, sizeof(echo_reply));
+          break;
+
+        case OF_OBJ_TYPE_PACKET_IN:
+          __atomic_add_fetch(&ctrl->packet_ins, 1, __ATOMIC_RELAXED);
+          if (ctrl->delay_us)
+          {
+            nanosleep(&delay, NULL);
+          }
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    memmove(buf, buf + off, have - off);
+    have -= off;
+  }
+
+  return NULL;
+}
+
+static int
+pktin_bench_controller_start(pktin_bench_controller_t *ctrl, uint32_t delay_us)
+{
+  struct sockaddr_in sa;
+  socklen_t sa_len = sizeof(sa);
+  indigo_cxn_protocol_params_t proto;
+  indigo_cxn_config_params_t config =
+  {
+    .version = OF_VERSION_1_3,
+    .cxn_priority = 0,
+    .local = 0,
+    .listen = 0,
+    .periodic_echo_ms = 0,
+    .reset_echo_count = 0,
+  };
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  sa.sin_port = 0;
+
+  if ((ctrl->listen_fd = socket(AF_INET, SOCK_STREAM, 0)) < 0 ||
+      bind(ctrl->listen_fd, (struct sockaddr *)&sa, sizeof(sa)) < 0 ||
+      listen(ctrl->listen_fd, 1) < 0 ||
+      getsockname(ctrl->listen_fd, (struct sockaddr *)&sa, &sa_len) < 0)
+  {
+    AIM_LOG_ERROR("Failed to open a controller socket: %s", strerror(errno));
+    return -1;
+  }
+  ctrl->port = ntohs(sa.sin_port);
+  ctrl->delay_us = delay_us;
+  ctrl->fd = -1;
+
+  if (pthread_create(&ctrl->thread, NULL, pktin_bench_controller_main, ctrl) != 0)
+  {
+    return -1;
+  }
+
+  memset(&proto, 0, sizeof(proto));
+  proto.tcp_over_ipv4.protocol = INDIGO_CXN_PROTO_TCP_OVER_IPV4;
+  strncpy(proto.tcp_over_ipv4.controller_ip, "127.0.0.1",
+          sizeof(proto.tcp_over_ipv4.controller_ip));
+  proto.tcp_over_ipv4.controller_port = ctrl->port;
+
+  if (indigo_cxn_connection_add(&proto, &config, &ctrl->cxn_id) < 0)
+  {
+    AIM_LOG_ERROR("Failed to add controller on port %u", ctrl->port);
+    return -1;
+  }
+  return 0;
+}
+
+/* Look up the connection status of every controller */
+static int
+pktin_bench_status_get(uint32_t controllers, indigo_cxn_status_t *status)
+{
+  indigo_cxn_info_t *list, *info;
+  uint32_t i, found = 0;
+
+  if (indigo_cxn_list(&list) != INDIGO_ERROR_NONE)
+  {
+    return -1;
+  }
+  for (info = list; info != NULL; info = info->next)
+  {
+    for (i = 0; i < controllers; i++)
+    {
+      if (info->cxn_id == pktin_bench_controllers[i].cxn_id)
+      {
+        status[i] = info->cxn_status;
+        found++;
+      }
+    }
+  }
+  indigo_cxn_list_destroy(list);
+  return (found == controllers) ? 0 : -1;
+}
+
+/****************************************************************
+ * Measurement
+ ****************************************************************/
+
+static uint64_t
+pktin_bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* Packets accounted for at every controller: delivered or dropped */
+static int
+pktin_bench_settled(uint32_t controllers, indigo_cxn_status_t *status,
+                    uint64_t *seen)
+{
+  uint64_t total = 0;
+  int done = 1;
+  uint32_t i;
+
+  if (pktin_bench_status_get(controllers, status) < 0)
+  {
+    return 1;
+  }
+  for (i = 0; i < controllers; i++)
+  {
+    uint64_t n = __atomic_load_n(&pktin_bench_controllers[i].packet_ins, __ATOMIC_RELAXED) +
+                 status[i].packet_in_drop + status[i].packet_in_rate_drop;
+    total += n;
+    if (n < pktin_bench_fed)
+    {
+      done = 0;
+    }
+  }
+  *seen = total;
+  return done;
+}
+
+int main(int argc, char *argv[])
+{
+  indigo_cxn_status_t status[PKTIN_BENCH_CONTROLLERS_MAX];
+  uint64_t start, fed, end, progress, seen = 0, last_seen = 0;
+  uint64_t delivered = 0, dropped = 0;
+  double secs;
+  uint32_t i;
+  int ready;
+
+  struct argp argp =
+    {
+      .doc      = "Feeds synthetic packets through the OF Agent packet-in path to loopback controllers.",
+      .options  = options,
+      .parser   = parse_opt,
+    };
+
+  arguments_t arguments =
+  {
+    .controllers = 1,
+    .count = 1000000,
+    .size = 128,
+    .burst = 64,
+    .ports = 1,
+    .delay_us = 0,
+  };
+
+  AIM_LOG_STRUCT_REGISTER();
+
+  __ind_ofdpa_driver_module_init__();
+  __ofstatemanager_module_init__();
+  __biglist_module_init__();
+  __configuration_module_init__();
+  __ofconnectionmanager_module_init__();
+  __socketmanager_module_init__();
+
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  aim_log_fid_set_all(AIM_LOG_FLAG_FATAL, 1);
+  aim_log_fid_set_all(AIM_LOG_FLAG_ERROR, 1);
+
+  if (pktin_bench_frame_init(arguments.size) < 0)
+  {
+    AIM_LOG_FATAL("Failed to allocate the frame");
+    return 1;
+  }
+  pktin_bench_ports = arguments.ports;
+
+  /* The features reply to each controller comes from OF-DPA */
+  if (ofdpaClientInitialize("pktin_bench") != OFDPA_E_NONE)
+  {
+    AIM_LOG_FATAL("Failed to initialize the OF-DPA client");
+    return 1;
+  }
+
+  if (ind_soc_init(&soc_cfg) < 0 ||
+      ind_cxn_init(&cxn_cfg) < 0 ||
+      ind_core_init(&core_cfg) < 0)
+  {
+    AIM_LOG_FATAL("Failed to initialize Indigo modules");
+    return 1;
+  }
+
+  if (ind_soc_enable_set(1) < 0 ||
+      ind_cxn_enable_set(1) < 0 ||
+      ind_core_enable_set(1) < 0)
+  {
+    AIM_LOG_FATAL("Failed to enable Indigo modules");
+    return 1;
+  }
+
+  for (i = 0; i < arguments.controllers; i++)
+  {
+    if (pktin_bench_controller_start(&pktin_bench_controllers[i], arguments.delay_us) < 0)
+    {
+      return 1;
+    }
+  }
+
+  /* Wait for every controller to finish its handshake */
+  start = pktin_bench_now_ns();
+  do
+  {
+    ind_soc_select_and_run(10);
+    ready = (pktin_bench_status_get(arguments.controllers, status) == 0);
+    for (i = 0; ready && i < arguments.controllers; i++)
+    {
+      ready = (status[i].state == INDIGO_CXN_S_HANDSHAKE_COMPLETE);
+    }
+  } while (!ready && pktin_bench_now_ns() - start < PKTIN_BENCH_IDLE_MS * 1000000ULL);
+
+  if (!ready)
+  {
+    AIM_LOG_FATAL("Controllers did not connect");
+    return 1;
+  }
+
+#ifdef PKTIN_BENCH_COUNT_COPIES
+  pktin_bench_copied = 0;
+#endif
+
+  /* One burst per wakeup, as if the packet socket had polled readable */
+  start = pktin_bench_now_ns();
+  while (pktin_bench_fed < arguments.count)
+  {
+    pktin_bench_queued = arguments.burst;
+    if (pktin_bench_queued > arguments.count - pktin_bench_fed)
+    {
+      pktin_bench_queued = arguments.count - pktin_bench_fed;
+    }
+    ind_ofdpa_pkt_receive();
+    ind_soc_select_and_run(0);
+  }
+  fed = pktin_bench_now_ns();
+
+  /* Let the output queues drain */
+  progress = fed;
+  while (!pktin_bench_settled(arguments.controllers, status, &seen))
+  {
+    if (seen != last_seen)
+    {
+      last_seen = seen;
+      progress = pktin_bench_now_ns();
+    }
+    else if (pktin_bench_now_ns() - progress > PKTIN_BENCH_IDLE_MS * 1000000ULL)
+    {
+      break;
+    }
+    ind_soc_select_and_run(1);
+  }
+  end = pktin_bench_now_ns();
+
+  printf("%u controllers, %u byte frames, burst %u, delay %u us\n",
+         arguments.controllers, arguments.size, arguments.burst,
+         arguments.delay_us);
+  for (i = 0; i < arguments.controllers; i++)
+  {
+    uint64_t n = __atomic_load_n(&pktin_bench_controllers[i].packet_ins, __ATOMIC_RELAXED);
+
+    printf("controller %u: %llu received, %llu dropped at queue limit, %llu over rate limit, %llu bytes out\n",
+           i, (unsigned long long)n,
+           (unsigned long long)status[i].packet_in_drop,
+           (unsigned long long)status[i].packet_in_rate_drop,
+           (unsigned long long)status[i].bytes_out);
+    delivered += n;
+    dropped += status[i].packet_in_drop + status[i].packet_in_rate_drop;
+  }
+
+  secs = (fed - start) / 1e9;
+  printf("fed       %llu packets in %.3f s, %.0f pps\n",
+         (unsigned long long)pktin_bench_fed, secs,
+         secs > 0 ? pktin_bench_fed / secs : 0);
+  secs = (end - start) / 1e9;
+  printf("delivered %llu packet_ins in %.3f s, %.0f pps, %llu dropped, %llu lost\n",
+         (unsigned long long)delivered, secs,
+         secs > 0 ? delivered / secs : 0,
+         (unsigned long long)dropped,
+         (unsigned long long)(pktin_bench_fed * arguments.controllers - delivered - dropped));
+#ifdef PKTIN_BENCH_COUNT_COPIES
+  printf("copied    %.1f bytes per packet\n",
+         pktin_bench_fed ? (double)pktin_bench_copied / pktin_bench_fed : 0);
+#endif
+
+  ind_core_finish();
+  ind_cxn_finish();
+  ind_soc_finish();
+
+  for (i = 0; i < arguments.controllers; i++)
+  {
+    if (pktin_bench_controllers[i].fd >= 0)
+    {
+      shutdown(pktin_bench_controllers[i].fd, SHUT_RDWR);
+    }
+    pthread_join(pktin_bench_controllers[i].thread, NULL);
+    close(pktin_bench_controllers[i].listen_fd);
+  }
+  free(pktin_bench_frame);
+  return 0;
+}
@@ -0,0 +1,1235 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2015
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     restart_bench.c
+*
+* @purpose      Agent restart and resync benchmark for the OF Agent
+*
+* @component    OF-DPA
+*
+* @comments     Starts the agent with --command, run by /bin/sh in a
+*               process group of its own, and acts as its controller
+*               (the agent is to be started with --listen on --agent).
+*               Once connected it adds --groups L2 interface groups on
+*               VLANs 1 and up and --flows bridging flows on VLAN 1
+*               writing to the VLAN 1 group, in batches each closed by
+*               a barrier. It then stops the agent with SIGTERM, starts
+*               it again and, from the moment it does, times:
+*
+*                 connect      the agent accepting the connection
+*                 handshake    the features reply
+*                 first flow   the first of the flows being back
+*                 full sync    all of the flows and groups being back
+*
+*               Flows are counted with aggregate stats on the cookie
+*               they were added with and groups with group stats,
+*               every --poll-ms. By default the agent is left to bring
+*               its tables back on its own, from --snapshot or
+*               --warmstart. With --resync the benchmark pushes the
+*               same flows and groups again once the handshake is done,
+*               as a controller reconciling would, and counts after
+*               each batch.
+*
+*               When the agent runs with --rpcstats, the OF-DPA calls
+*               that change the tables from its start until --settle-ms
+*               after the full sync are read back from its ofdpa.rpc.*
+*               debug counters: the dataplane operations the recovery
+*               cost. With the in-process ofdpasim nothing survives the
+*               restart, so a restored agent programs every entry again;
+*               on hardware that keeps its tables, a warm start should
+*               program none.
+*
+*               Writes the results as JSON to stdout and progress to
+*               stderr. Links with loci and AIM only.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <argp.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include <AIM/aim.h>
+#include <loci/loci.h>
+#include "ofdpa_datatypes.h"
+
+#define AIM_LOG_MODULE_NAME restart_bench
+
+#include <AIM/aim_log.h>
+
+AIM_LOG_STRUCT_DEFINE(
+                      AIM_LOG_OPTIONS_DEFAULT,
+                      AIM_LOG_BITS_DEFAULT,
+                      NULL,     /* Custom Log Map */
+                      0
+                      );
+
+#define RESTART_BENCH_FORMAT  1
+
+#define RESTART_BENCH_INPUT_SIZE  (128 * 1024)
+
+/* Messages between barriers while adding flows and groups */
+#define RESTART_BENCH_BATCH  1024
+
+/* VLAN and port of the group the bridging flows write to */
+#define RESTART_BENCH_VLAN  1
+
+#define RESTART_BENCH_PRIORITY  1000
+
+/* Top half of the benchmark's flow cookies, to count only its own flows */
+#define RESTART_BENCH_COOKIE       0x7265737400000000ULL
+#define RESTART_BENCH_COOKIE_MASK  0xffffffff00000000ULL
+
+/* How long the agent has to exit after SIGTERM before SIGKILL */
+#define RESTART_BENCH_STOP_MS  10000
+
+/* Longest wait for a barrier or multipart reply */
+#define RESTART_BENCH_REPLY_MS  30000
+
+#define RESTART_BENCH_COUNTERS_MAX  256
+
+typedef struct
+{
+  char     *agent;
+  char     *command;
+  char     *log;
+  uint32_t flows;
+  uint32_t groups;
+  uint32_t port;
+  int      resync;
+  uint32_t timeout;
+  uint32_t poll_ms;
+  uint32_t settle_ms;
+} arguments_t;
+
+typedef struct
+{
+  int       fd;
+  uint8_t   *in;
+  uint32_t  in_len;
+  uint32_t  xid;
+} restart_bench_cxn_t;
+
+/* Called with each message read; returns 1 once the wait is over */
+typedef int (*restart_bench_msg_f)(uint8_t *msg, void *cookie);
+
+/* Called with each part of a multipart reply */
+typedef void (*restart_bench_part_f)(of_object_t *reply, void *cookie);
+
+typedef struct
+{
+  uint32_t             xid;
+  restart_bench_part_f part;
+  void                 *cookie;
+  int                  failed;
+} restart_bench_multipart_t;
+
+typedef struct
+{
+  uint64_t id;
+  char     name[64];
+  uint64_t value;
+  int      seen;
+} restart_bench_counter_t;
+
+typedef struct
+{
+  int      connected;
+  int      handshaken;
+  int      first_flow;
+  int      synced;
+  uint64_t stop_ms;
+  uint64_t connect_ms;
+  uint64_t handshake_ms;
+  uint64_t first_flow_ms;
+  uint64_t full_sync_ms;
+  uint64_t flows_seen;
+  uint32_t groups_seen;
+  uint64_t errors;
+} restart_bench_result_t;
+
+static struct argp_option options[] =
+{
+  { "agent",     'a', "IP:PORT", 0, "Address the agent listens on for controllers." },
+  { "command",   'c', "CMD",     0, "Shell command that starts the agent." },
+  { "log",       'l', "PATH",    0, "File for the agent's output; it is discarded by default." },
+  { "flows",     'n', "COUNT",   0, "Bridging flows to add before the restart." },
+  { "groups",    'g', "COUNT",   0, "L2 interface groups to add before the restart, on VLANs 1 to COUNT." },
+  { "port",      'p', "PORT",    0, "Port the groups output to." },
+  { "resync",    'r', 0,         0, "Push the flows and groups again after the restart instead of waiting for the agent to restore them." },
+  { "timeout",   't', "SECS",    0, "Longest wait for the agent to be back in sync." },
+  { "poll-ms",   'i', "MS",      0, "Interval between flow and group counts while waiting." },
+  { "settle-ms", 's', "MS",      0, "Wait after the sync before reading the OF-DPA call counters." },
+  { 0 }
+};
+
+static uint64_t restart_bench_errors;
+static of_list_instruction_t *restart_bench_insts;
+
+/* Parse a single option. */
+static error_t parse_opt(int key, char *arg, struct argp_state *state)
+{
+  arguments_t *arguments = state->input;
+  unsigned long long value;
+  char *endptr;
+
+  switch (key)
+  {
+    case 'a':                           /* agent */
+      arguments->agent = arg;
+      return 0;
+
+    case 'c':                           /* command */
+      arguments->command = arg;
+      return 0;
+
+    case 'l':                           /* log */
+      arguments->log = arg;
+      return 0;
+
+    case 'r':                           /* resync */
+      arguments->resync = 1;
+      return 0;
+
+    case 'n':
+    case 'g':
+    case 'p':
+    case 't':
+    case 'i':
+    case 's':
+      errno = 0;
+      value = strtoull(arg, &endptr, 0);
+      if ((errno != 0) || (*endptr != '\0') || (value > 0xffffffff) ||
+          (value == 0 && key != 's'))
+      {
+        argp_error(state, "Invalid value \"%s\"", arg);
+        return EINVAL;
+      }
+      break;
+
+    case ARGP_KEY_END:
+      if (arguments->command == NULL)
+      {
+        argp_error(state, "--command is required");
+        return EINVAL;
+      }
+      return 0;
+
+    case ARGP_KEY_NO_ARGS:
+      return 0;
+
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+
+  switch (key)
+  {
+    case 'n':                           /* flows */
+      if (value > 0xffffff)
+      {
+        argp_error(state, "At most %d flows", 0xffffff);
+        return EINVAL;
+      }
+      arguments->flows = value;
+      break;
+
+    case 'g':                           /* groups */
+      if (value > OFDPA_VID_EXACT_MASK - 1)
+      {
+        argp_error(state, "At most %d groups", OFDPA_VID_EXACT_MASK - 1);
+        return EINVAL;
+      }
+      arguments->groups = value;
+      break;
+
+    case 'p':                           /* port */
+      if (value > 0xffff)
+      {
+        argp_error(state, "Invalid port \"%s\"", arg);
+        return EINVAL;
+      }
+      arguments->port = value;
+      break;
+
+    case 't':                           /* timeout */
+      arguments->timeout = value;
+      break;
+
+    case 'i':                           /* poll-ms */
+      arguments->poll_ms = value;
+      break;
+
+    case 's':                           /* settle-ms */
+      arguments->settle_ms = value;
+      break;
+  }
+  return 0;
+}
+
+static uint64_t
+restart_bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+#define RESTART_BENCH_MS(ns)  ((ns) / 1000000)
+
+/****************************************************************
+ * The agent
+ ****************************************************************/
+
+static pid_t
+restart_bench_agent_start(const arguments_t *arguments)
+{
+  pid_t pid;
+  int fd;
+
+  if ((pid = fork()) < 0)
+  {
+    AIM_LOG_ERROR("Failed to fork: %s", strerror(errno));
+    return -1;
+  }
+
+  if (pid == 0)
+  {
+    /* Its own process group, so stopping it reaches whatever sh starts */
+    (void)setpgid(0, 0);
+    fd = open(arguments->log ? arguments->log : "/dev/null",
+              O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd >= 0)
+    {
+      (void)dup2(fd, STDOUT_FILENO);
+      (void)dup2(fd, STDERR_FILENO);
+      close(fd);
+    }
+    execl("/bin/sh", "sh", "-c", arguments->command, (char *)NULL);
+    _exit(127);
+  }
+
+  (void)setpgid(pid, pid);
+  return pid;
+}
+
+/* SIGTERM, then SIGKILL if it has not exited in time */
+static void
+restart_bench_agent_stop(pid_t pid)
+{
+  uint64_t deadline = restart_bench_now_ns() + (uint64_t)RESTART_BENCH_STOP_MS * 1000000;
+  int status;
+
+  (void)kill(-pid, SIGTERM);
+  while (waitpid(pid, &status, WNOHANG) == 0)
+  {
+    if (restart_bench_now_ns() > deadline)
+    {
+      AIM_LOG_ERROR("The agent did not exit on SIGTERM, killing it");
+      (void)kill(-pid, SIGKILL);
+      (void)waitpid(pid, &status, 0);
+      break;
+    }
+    (void)poll(NULL, 0, 10);
+  }
+
+  /* Anything sh left behind in the group */
+  (void)kill(-pid, SIGKILL);
+}
+
+/****************************************************************
+ * Messages
+ ****************************************************************/
+
+/* Write the wire form of obj with the given xid, free obj and return the xid */
+static uint32_t
+restart_bench_send_xid(restart_bench_cxn_t *cxn, of_object_t *obj, uint32_t xid)
+{
+  uint8_t *data = OF_OBJECT_BUFFER_INDEX(obj, 0);
+  uint32_t wire_xid = htonl(xid), off = 0;
+  int n;
+
+  memcpy(data + OF_MESSAGE_XID_OFFSET, &wire_xid, sizeof(wire_xid));
+  while (off < obj->length)
+  {
+    n = send(cxn->fd, data + off, obj->length - off, MSG_NOSIGNAL);
+    if (n < 0 && errno != EINTR)
+    {
+      of_object_delete(obj);
+      return 0;
+    }
+    off += (n > 0) ? n : 0;
+  }
+  of_object_delete(obj);
+  return xid;
+}
+
+static uint32_t
+restart_bench_send(restart_bench_cxn_t *cxn, of_object_t *obj)
+{
+  return restart_bench_send_xid(cxn, obj, ++cxn->xid);
+}
+
+/*
+ * Handle what the agent sends until handler says the wait is over (1),
+ * the deadline passes (0) or the connection fails (-1). Echo requests are
+ * answered and errors counted along the way.
+ */
+static int
+restart_bench_wait(restart_bench_cxn_t *cxn, uint64_t deadline,
+                   restart_bench_msg_f handler, void *cookie)
+{
+  struct pollfd pfd = { .fd = cxn->fd, .events = POLLIN };
+  uint32_t off, len;
+  uint64_t now;
+  of_object_t *obj;
+  uint8_t *msg;
+  int n, done = 0;
+
+  while (!done)
+  {
+    for (off = 0; !done && cxn->in_len - off >= OF_MESSAGE_HEADER_LENGTH; off += len)
+    {
+      msg = cxn->in + off;
+      len = of_message_length_get(msg);
+      if (len < OF_MESSAGE_HEADER_LENGTH)
+      {
+        AIM_LOG_ERROR("Bad message length %u", len);
+        return -1;
+      }
+      if (cxn->in_len - off < len)
+      {
+        break;
+      }
+
+      if (of_message_type_get(msg) == OF_OBJ_TYPE_ECHO_REQUEST)
+      {
+        if ((obj = of_echo_reply_new(OF_VERSION_1_3)) != NULL)
+        {
+          (void)restart_bench_send_xid(cxn, obj, of_message_xid_get(msg));
+        }
+        continue;
+      }
+      if (of_message_type_get(msg) == OF_OBJ_TYPE_ERROR)
+      {
+        restart_bench_errors++;
+      }
+      done = handler ? handler(msg, cookie) : 0;
+    }
+    memmove(cxn->in, cxn->in + off, cxn->in_len - off);
+    cxn->in_len -= off;
+    if (done)
+    {
+      return 1;
+    }
+
+    now = restart_bench_now_ns();
+    if (now >= deadline)
+    {
+      return 0;
+    }
+    n = poll(&pfd, 1, deadline - now > 1000000000 ? 1000 : (deadline - now + 999999) / 1000000);
+    if (n < 0 && errno != EINTR)
+    {
+      return -1;
+    }
+    if (n <= 0)
+    {
+      continue;
+    }
+
+    if (cxn->in_len == RESTART_BENCH_INPUT_SIZE)
+    {
+      AIM_LOG_ERROR("Message too long");
+      return -1;
+    }
+    n = recv(cxn->fd, cxn->in + cxn->in_len, RESTART_BENCH_INPUT_SIZE - cxn->in_len, 0);
+    if (n == 0 || (n < 0 && errno != EINTR && errno != EAGAIN))
+    {
+      AIM_LOG_ERROR("Connection closed by the agent");
+      return -1;
+    }
+    cxn->in_len += (n > 0) ? n : 0;
+  }
+  return 1;
+}
+
+static int
+restart_bench_features_reply(uint8_t *msg, void *cookie)
+{
+  return of_message_type_get(msg) == OF_OBJ_TYPE_FEATURES_REPLY;
+}
+
+static int
+restart_bench_barrier_reply(uint8_t *msg, void *cookie)
+{
+  return of_message_type_get(msg) == OF_OBJ_TYPE_BARRIER_REPLY_BY_VERSION(OF_VERSION_1_3) &&
+         of_message_xid_get(msg) == *(uint32_t *)cookie;
+}
+
+static int
+restart_bench_multipart_reply(uint8_t *msg, void *cookie)
+{
+  restart_bench_multipart_t *multipart = cookie;
+  of_object_storage_t storage;
+  of_object_t *reply;
+  uint16_t flags;
+
+  if (of_message_xid_get(msg) != multipart->xid)
+  {
+    return 0;
+  }
+  if (of_message_type_get(msg) != OF_OBJ_TYPE_STATS_REPLY_BY_VERSION(OF_VERSION_1_3))
+  {
+    multipart->failed = 1;
+    return 1;
+  }
+
+  if ((reply = of_object_new_from_message_preallocated(&storage, msg,
+                                                       of_message_length_get(msg))) == NULL)
+  {
+    multipart->failed = 1;
+    return 1;
+  }
+  multipart->part(reply, multipart->cookie);
+
+  buf_u16_get(msg + OF_MESSAGE_STATS_TYPE_OFFSET + 2, &flags);
+  return !(flags & OF_STATS_REPLY_FLAG_REPLY_MORE);
+}
+
+/* Send a barrier and wait for its reply */
+static int
+restart_bench_barrier(restart_bench_cxn_t *cxn)
+{
+  of_object_t *obj;
+  uint32_t xid;
+
+  if ((obj = of_barrier_request_new(OF_VERSION_1_3)) == NULL ||
+      (xid = restart_bench_send(cxn, obj)) == 0)
+  {
+    return -1;
+  }
+  return restart_bench_wait(cxn,
+                            restart_bench_now_ns() + (uint64_t)RESTART_BENCH_REPLY_MS * 1000000,
+                            restart_bench_barrier_reply, &xid) == 1 ? 0 : -1;
+}
+
+/* Send a multipart request and pass each part of the reply to part */
+static int
+restart_bench_multipart(restart_bench_cxn_t *cxn, of_object_t *request,
+                        restart_bench_part_f part, void *cookie)
+{
+  restart_bench_multipart_t multipart = { .part = part, .cookie = cookie };
+
+  if (request == NULL || (multipart.xid = restart_bench_send(cxn, request)) == 0)
+  {
+    return -1;
+  }
+  if (restart_bench_wait(cxn,
+                         restart_bench_now_ns() + (uint64_t)RESTART_BENCH_REPLY_MS * 1000000,
+                         restart_bench_multipart_reply, &multipart) != 1)
+  {
+    return -1;
+  }
+  return multipart.failed ? -1 : 0;
+}
+
+/****************************************************************
+ * Flows and groups
+ ****************************************************************/
+
+/* Write the VLAN 1 group, then go to the ACL policy table */
+static of_list_instruction_t *
+restart_bench_instructions_build(uint32_t port)
+{
+  of_list_instruction_t *insts;
+  of_object_t *inst = NULL;
+  of_object_t *action = NULL;
+  of_list_action_t *actions = NULL;
+  int rv = -1;
+
+  if ((insts = of_list_instruction_new(OF_VERSION_1_3)) == NULL ||
+      (inst = of_instruction_write_actions_new(OF_VERSION_1_3)) == NULL ||
+      (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+      (action = of_action_group_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto done;
+  }
+  of_action_group_group_id_set(action, (RESTART_BENCH_VLAN << 16) | port);
+  if (of_list_append(actions, action) < 0 ||
+      of_instruction_write_actions_actions_set(inst, actions) < 0 ||
+      of_list_append(insts, inst) < 0)
+  {
+    goto done;
+  }
+  of_object_delete(inst);
+
+  if ((inst = of_instruction_goto_table_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto done;
+  }
+  of_instruction_goto_table_table_id_set(inst, OFDPA_FLOW_TABLE_ID_ACL_POLICY);
+  if (of_list_append(insts, inst) < 0)
+  {
+    goto done;
+  }
+  rv = 0;
+
+done:
+  if (action != NULL)
+  {
+    of_object_delete(action);
+  }
+  if (actions != NULL)
+  {
+    of_object_delete(actions);
+  }
+  if (inst != NULL)
+  {
+    of_object_delete(inst);
+  }
+  if (rv < 0 && insts != NULL)
+  {
+    of_object_delete(insts);
+    insts = NULL;
+  }
+  return insts;
+}
+
+static of_object_t *
+restart_bench_flow_build(uint32_t i)
+{
+  of_flow_add_t *flow_add;
+  of_match_t match;
+
+  memset(&match, 0, sizeof(match));
+  match.version = OF_VERSION_1_3;
+  match.fields.vlan_vid = OFDPA_VID_PRESENT | RESTART_BENCH_VLAN;
+  match.masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+  match.fields.eth_dst.addr[0] = 0x02;
+  match.fields.eth_dst.addr[3] = i >> 16;
+  match.fields.eth_dst.addr[4] = i >> 8;
+  match.fields.eth_dst.addr[5] = i;
+  memset(match.masks.eth_dst.addr, 0xff, OF_MAC_ADDR_BYTES);
+
+  if ((flow_add = of_flow_add_new(OF_VERSION_1_3)) == NULL)
+  {
+    return NULL;
+  }
+  of_flow_add_table_id_set(flow_add, OFDPA_FLOW_TABLE_ID_BRIDGING);
+  of_flow_add_priority_set(flow_add, RESTART_BENCH_PRIORITY);
+  of_flow_add_cookie_set(flow_add, RESTART_BENCH_COOKIE | i);
+  of_flow_add_buffer_id_set(flow_add, OF_BUFFER_ID_NO_BUFFER);
+  of_flow_add_out_port_set(flow_add, OF_PORT_DEST_WILDCARD);
+  of_flow_add_out_group_set(flow_add, OF_GROUP_ANY);
+  if (of_flow_add_match_set(flow_add, &match) < 0 ||
+      of_flow_add_instructions_set(flow_add, restart_bench_insts) < 0)
+  {
+    of_object_delete(flow_add);
+    return NULL;
+  }
+  return flow_add;
+}
+
+/* An L2 interface group: output to port */
+static of_object_t *
+restart_bench_group_build(uint32_t vlan, uint32_t port)
+{
+  of_group_add_t *group_add;
+  of_list_bucket_t *buckets = NULL;
+  of_bucket_t *bucket = NULL;
+  of_list_action_t *actions = NULL;
+  of_action_output_t *output = NULL;
+  int rv = -1;
+
+  if ((group_add = of_group_add_new(OF_VERSION_1_3)) == NULL ||
+      (buckets = of_list_bucket_new(OF_VERSION_1_3)) == NULL ||
+      (bucket = of_bucket_new(OF_VERSION_1_3)) == NULL ||
+      (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+      (output = of_action_output_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto done;
+  }
+
+  of_group_add_group_type_set(group_add, OF_GROUP_TYPE_INDIRECT);
+  of_group_add_group_id_set(group_add, (vlan << 16) | port);
+  of_action_output_port_set(output, port);
+  of_bucket_watch_port_set(bucket, OF_PORT_DEST_WILDCARD);
+  of_bucket_watch_group_set(bucket, OF_GROUP_ANY);
+  if (of_list_append(actions, output) < 0 ||
+      of_bucket_actions_set(bucket, actions) < 0 ||
+      of_list_append(buckets, bucket) < 0 ||
+      of_group_add_buckets_set(group_add, buckets) < 0)
+  {
+    goto done;
+  }
+  rv = 0;
+
+done:
+  if (output != NULL)
+  {
+    of_object_delete(output);
+  }
+  if (actions != NULL)
+  {
+    of_object_delete(actions);
+  }
+  if (bucket != NULL)
+  {
+    of_object_delete(bucket);
+  }
+  if (buckets != NULL)
+  {
+    of_object_delete(buckets);
+  }
+  if (rv < 0 && group_add != NULL)
+  {
+    of_object_delete(group_add);
+    group_add = NULL;
+  }
+  return group_add;
+}
+
+static void
+restart_bench_aggregate_part(of_object_t *reply, void *cookie)
+{
+  uint32_t flow_count;
+
+  of_aggregate_stats_reply_flow_count_get(reply, &flow_count);
+  *(uint64_t *)cookie += flow_count;
+}
+
+typedef struct
+{
+  uint32_t port;
+  uint32_t groups;
+  uint32_t count;
+} restart_bench_group_count_t;
+
+static void
+restart_bench_group_part(of_object_t *reply, void *cookie)
+{
+  restart_bench_group_count_t *count = cookie;
+  of_object_t list, entry;
+  uint32_t group_id, vlan;
+  int rv;
+
+  of_group_stats_reply_entries_bind(reply, &list);
+  OF_LIST_GROUP_STATS_ENTRY_ITER(&list, &entry, rv)
+  {
+    of_group_stats_entry_group_id_get(&entry, &group_id);
+    vlan = (group_id >> 16) & 0xfff;
+    if ((group_id >> 28) == OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE &&
+        (group_id & 0xffff) == count->port &&
+        vlan >= RESTART_BENCH_VLAN && vlan < RESTART_BENCH_VLAN + count->groups)
+    {
+      count->count++;
+    }
+  }
+}
+
+/* How many of the benchmark's flows and groups the agent has */
+static int
+restart_bench_count(restart_bench_cxn_t *cxn, const arguments_t *arguments,
+                    uint64_t *flows, uint32_t *groups)
+{
+  restart_bench_group_count_t group_count = { .port = arguments->port, .groups = arguments->groups };
+  of_aggregate_stats_request_t *aggregate;
+  of_group_stats_request_t *group_stats;
+  of_match_t match;
+
+  memset(&match, 0, sizeof(match));
+  match.version = OF_VERSION_1_3;
+  if ((aggregate = of_aggregate_stats_request_new(OF_VERSION_1_3)) != NULL)
+  {
+    of_aggregate_stats_request_table_id_set(aggregate, OF_TABLE_ALL);
+    of_aggregate_stats_request_out_port_set(aggregate, OF_PORT_DEST_WILDCARD);
+    of_aggregate_stats_request_out_group_set(aggregate, OF_GROUP_ANY);
+    of_aggregate_stats_request_cookie_set(aggregate, RESTART_BENCH_COOKIE);
+    of_aggregate_stats_request_cookie_mask_set(aggregate, RESTART_BENCH_COOKIE_MASK);
+    if (of_aggregate_stats_request_match_set(aggregate, &match) < 0)
+    {
+      of_object_delete(aggregate);
+      aggregate = NULL;
+    }
+  }
+  *flows = 0;
+  if (restart_bench_multipart(cxn, aggregate, restart_bench_aggregate_part, flows) < 0)
+  {
+    return -1;
+  }
+
+  if ((group_stats = of_group_stats_request_new(OF_VERSION_1_3)) != NULL)
+  {
+    of_group_stats_request_group_id_set(group_stats, OF_GROUP_ALL);
+  }
+  if (restart_bench_multipart(cxn, group_stats, restart_bench_group_part, &group_count) < 0)
+  {
+    return -1;
+  }
+  *groups = group_count.count;
+  return 0;
+}
+
+/* Note the first flow and the full sync, by ms since start */
+static void
+restart_bench_count_check(restart_bench_result_t *result, const arguments_t *arguments,
+                          uint64_t start)
+{
+  uint64_t ms = RESTART_BENCH_MS(restart_bench_now_ns() - start);
+
+  if (result->flows_seen > 0 && !result->first_flow)
+  {
+    result->first_flow_ms = ms;
+    result->first_flow = 1;
+  }
+  if (!result->synced &&
+      result->flows_seen >= arguments->flows && result->groups_seen >= arguments->groups)
+  {
+    result->full_sync_ms = ms;
+    result->synced = 1;
+  }
+}
+
+/*
+ * Add the groups and then the flows, a barrier after every batch. With
+ * result set, count after each batch as well.
+ */
+static int
+restart_bench_push(restart_bench_cxn_t *cxn, const arguments_t *arguments,
+                   restart_bench_result_t *result, uint64_t start)
+{
+  uint32_t i, total = arguments->groups + arguments->flows;
+  of_object_t *obj;
+
+  for (i = 0; i < total; i++)
+  {
+    obj = (i < arguments->groups) ?
+          restart_bench_group_build(RESTART_BENCH_VLAN + i, arguments->port) :
+          restart_bench_flow_build(i - arguments->groups);
+    if (obj == NULL || restart_bench_send(cxn, obj) == 0)
+    {
+      AIM_LOG_ERROR("Failed to send %s %u", i < arguments->groups ? "group" : "flow", i);
+      return -1;
+    }
+
+    if ((i + 1) % RESTART_BENCH_BATCH == 0 || i + 1 == total)
+    {
+      if (restart_bench_barrier(cxn) < 0)
+      {
+        AIM_LOG_ERROR("No barrier reply after %u messages", i + 1);
+        return -1;
+      }
+      if (result != NULL)
+      {
+        if (restart_bench_count(cxn, arguments, &result->flows_seen, &result->groups_seen) < 0)
+        {
+          return -1;
+        }
+        restart_bench_count_check(result, arguments, start);
+      }
+    }
+  }
+  return 0;
+}
+
+/****************************************************************
+ * Connections
+ ****************************************************************/
+
+/* Connect as soon as the agent listens and complete the handshake */
+static int
+restart_bench_connect(restart_bench_cxn_t *cxn, const struct sockaddr_in *sa,
+                      uint64_t start, uint64_t deadline, restart_bench_result_t *result)
+{
+  of_object_t *obj;
+  int one = 1;
+
+  cxn->in_len = 0;
+  for (;;)
+  {
+    if ((cxn->fd = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+    {
+      return -1;
+    }
+    if (connect(cxn->fd, (const struct sockaddr *)sa, sizeof(*sa)) == 0)
+    {
+      break;
+    }
+    close(cxn->fd);
+    cxn->fd = -1;
+    if (restart_bench_now_ns() >= deadline)
+    {
+      AIM_LOG_ERROR("The agent did not accept a connection in time");
+      return -1;
+    }
+    (void)poll(NULL, 0, 1);
+  }
+  result->connected = 1;
+  result->connect_ms = RESTART_BENCH_MS(restart_bench_now_ns() - start);
+  (void)setsockopt(cxn->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+  if ((obj = of_hello_new(OF_VERSION_1_3)) == NULL ||
+      restart_bench_send(cxn, obj) == 0 ||
+      (obj = of_features_request_new(OF_VERSION_1_3)) == NULL ||
+      restart_bench_send(cxn, obj) == 0 ||
+      restart_bench_wait(cxn, deadline, restart_bench_features_reply, NULL) != 1)
+  {
+    AIM_LOG_ERROR("The agent did not complete the handshake");
+    return -1;
+  }
+  result->handshake_ms = RESTART_BENCH_MS(restart_bench_now_ns() - start);
+  result->handshaken = 1;
+  return 0;
+}
+
+/****************************************************************
+ * Dataplane operations
+ ****************************************************************/
+
+/* OF-DPA calls that change what the dataplane does, by name suffix */
+static int
+restart_bench_counter_mutates(const char *name)
+{
+  static const char *suffixes[] = { "Add", "Delete", "DeleteAll", "Modify", "Create", "Set" };
+  size_t len = strlen(name), suffix_len;
+  int i;
+
+  for (i = 0; i < sizeof(suffixes) / sizeof(suffixes[0]); i++)
+  {
+    suffix_len = strlen(suffixes[i]);
+    if (len > suffix_len && strcmp(name + len - suffix_len, suffixes[i]) == 0)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+typedef struct
+{
+  restart_bench_counter_t counters[RESTART_BENCH_COUNTERS_MAX];
+  uint32_t count;
+} restart_bench_counters_t;
+
+static void
+restart_bench_counter_desc_part(of_object_t *reply, void *cookie)
+{
+  restart_bench_counters_t *counters = cookie;
+  restart_bench_counter_t *counter;
+  of_object_t list, entry;
+  of_str64_t name;
+  int rv;
+
+  of_bsn_debug_counter_desc_stats_reply_entries_bind(reply, &list);
+  OF_LIST_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY_ITER(&list, &entry, rv)
+  {
+    of_bsn_debug_counter_desc_stats_entry_name_get(&entry, &name);
+    name[sizeof(name) - 1] = '\0';
+    if (strncmp(name, "ofdpa.rpc.", 10) != 0 ||
+        !restart_bench_counter_mutates(name + 10) ||
+        counters->count == RESTART_BENCH_COUNTERS_MAX)
+    {
+      continue;
+    }
+    counter = &counters->counters[counters->count++];
+    of_bsn_debug_counter_desc_stats_entry_counter_id_get(&entry, &counter->id);
+    strcpy(counter->name, name + 10);
+  }
+}
+
+static void
+restart_bench_counter_stats_part(of_object_t *reply, void *cookie)
+{
+  restart_bench_counters_t *counters = cookie;
+  of_object_t list, entry;
+  uint64_t id, value;
+  uint32_t i;
+  int rv;
+
+  of_bsn_debug_counter_stats_reply_entries_bind(reply, &list);
+  OF_LIST_BSN_DEBUG_COUNTER_STATS_ENTRY_ITER(&list, &entry, rv)
+  {
+    of_bsn_debug_counter_stats_entry_counter_id_get(&entry, &id);
+    of_bsn_debug_counter_stats_entry_value_get(&entry, &value);
+    for (i = 0; i < counters->count; i++)
+    {
+      if (counters->counters[i].id == id)
+      {
+        counters->counters[i].value = value;
+        counters->counters[i].seen = 1;
+        break;
+      }
+    }
+  }
+}
+
+/* Read the agent's ofdpa.rpc.* debug counters; none without --rpcstats */
+static int
+restart_bench_counters_read(restart_bench_cxn_t *cxn, restart_bench_counters_t *counters)
+{
+  counters->count = 0;
+  if (restart_bench_multipart(cxn, of_bsn_debug_counter_desc_stats_request_new(OF_VERSION_1_3),
+                              restart_bench_counter_desc_part, counters) < 0)
+  {
+    return -1;
+  }
+  if (counters->count == 0)
+  {
+    return 0;
+  }
+  return restart_bench_multipart(cxn, of_bsn_debug_counter_stats_request_new(OF_VERSION_1_3),
+                                 restart_bench_counter_stats_part, counters);
+}
+
+/****************************************************************
+ * Results
+ ****************************************************************/
+
+static void
+restart_bench_ms_show(const char *name, uint64_t ms, int valid, int last)
+{
+  if (valid)
+  {
+    printf("    \"%s\": %" PRIu64 "%s\n", name, ms, last ? "" : ",");
+  }
+  else
+  {
+    printf("    \"%s\": null%s\n", name, last ? "" : ",");
+  }
+}
+
+static void
+restart_bench_results_show(const arguments_t *arguments, uint64_t preload_ms,
+                           uint64_t preload_errors, const restart_bench_result_t *result,
+                           const restart_bench_counters_t *counters)
+{
+  uint64_t total = 0;
+  uint32_t i;
+  int first = 1;
+
+  printf("{\n  \"benchmark\": \"restart_bench\",\n  \"format\": %d,\n"
+         "  \"mode\": \"%s\",\n  \"flows\": %u,\n  \"groups\": %u,\n",
+         RESTART_BENCH_FORMAT, arguments->resync ? "resync" : "reload",
+         arguments->flows, arguments->groups);
+  printf("  \"preload\": {\"ms\": %" PRIu64 ", \"errors\": %" PRIu64 "},\n",
+         preload_ms, preload_errors);
+
+  printf("  \"restart\": {\n");
+  restart_bench_ms_show("stop_ms", result->stop_ms, 1, 0);
+  restart_bench_ms_show("connect_ms", result->connect_ms, result->connected, 0);
+  restart_bench_ms_show("handshake_ms", result->handshake_ms, result->handshaken, 0);
+  restart_bench_ms_show("first_flow_ms", result->first_flow_ms, result->first_flow, 0);
+  restart_bench_ms_show("full_sync_ms", result->full_sync_ms, result->synced, 0);
+  printf("    \"synced\": %s,\n    \"flows_seen\": %" PRIu64 ",\n    \"groups_seen\": %u,\n"
+         "    \"errors\": %" PRIu64 "\n  },\n",
+         result->synced ? "true" : "false", result->flows_seen, result->groups_seen,
+         result->errors);
+
+  if (counters == NULL || counters->count == 0)
+  {
+    printf("  \"dataplane_ops\": null\n}\n");
+    return;
+  }
+
+  printf("  \"dataplane_ops\": {\n    \"calls\": {");
+  for (i = 0; i < counters->count; i++)
+  {
+    if (counters->counters[i].seen && counters->counters[i].value != 0)
+    {
+      printf("%s\n      \"%s\": %" PRIu64, first ? "" : ",",
+             counters->counters[i].name, counters->counters[i].value);
+      total += counters->counters[i].value;
+      first = 0;
+    }
+  }
+  printf("%s},\n    \"total\": %" PRIu64 "\n  }\n}\n", first ? "" : "\n    ", total);
+}
+
+int main(int argc, char *argv[])
+{
+  static restart_bench_counters_t counters;
+  restart_bench_cxn_t cxn = { .fd = -1 };
+  restart_bench_result_t result;
+  struct sockaddr_in sa;
+  uint64_t start, deadline, preload_ms, preload_errors, next;
+  char addr[64], *colon;
+  int counters_read = 0;
+  pid_t pid;
+
+  struct argp argp =
+    {
+      .doc      = "Restarts an OF Agent holding a set of flows and groups and times how soon it is back in sync, as JSON.",
+      .options  = options,
+      .parser   = parse_opt,
+    };
+
+  arguments_t arguments =
+  {
+    .agent = "127.0.0.1:6653",
+    .command = NULL,
+    .log = NULL,
+    .flows = 10000,
+    .groups = 16,
+    .port = 1,
+    .resync = 0,
+    .timeout = 120,
+    .poll_ms = 50,
+    .settle_ms = 1000,
+  };
+
+  AIM_LOG_STRUCT_REGISTER();
+
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  aim_log_fid_set_all(AIM_LOG_FLAG_FATAL, 1);
+  aim_log_fid_set_all(AIM_LOG_FLAG_ERROR, 1);
+
+  strncpy(addr, arguments.agent, sizeof(addr) - 1);
+  addr[sizeof(addr) - 1] = '\0';
+  memset(&sa, 0, sizeof(sa));
+  sa.sin_family = AF_INET;
+  if ((colon = strchr(addr, ':')) == NULL ||
+      (*colon = '\0', inet_pton(AF_INET, addr, &sa.sin_addr)) != 1 ||
+      (sa.sin_port = htons(atoi(colon + 1))) == 0)
+  {
+    AIM_LOG_FATAL("Invalid agent address \"%s\"", arguments.agent);
+    return 1;
+  }
+
+  if ((cxn.in = malloc(RESTART_BENCH_INPUT_SIZE)) == NULL ||
+      (restart_bench_insts = restart_bench_instructions_build(arguments.port)) == NULL)
+  {
+    AIM_LOG_FATAL("Failed to build the benchmark objects");
+    return 1;
+  }
+
+  /* Start the agent and give it the flows and groups */
+  memset(&result, 0, sizeof(result));
+  if ((pid = restart_bench_agent_start(&arguments)) < 0)
+  {
+    return 1;
+  }
+  start = restart_bench_now_ns();
+  deadline = start + (uint64_t)arguments.timeout * 1000000000;
+  if (restart_bench_connect(&cxn, &sa, start, deadline, &result) < 0 ||
+      restart_bench_push(&cxn, &arguments, NULL, start) < 0)
+  {
+    restart_bench_agent_stop(pid);
+    return 1;
+  }
+  preload_ms = RESTART_BENCH_MS(restart_bench_now_ns() - start);
+  preload_errors = restart_bench_errors;
+  fprintf(stderr, "Added %u groups and %u flows in %" PRIu64 " ms, %" PRIu64 " errors\n",
+          arguments.groups, arguments.flows, preload_ms, preload_errors);
+
+  /* Restart it */
+  close(cxn.fd);
+  memset(&result, 0, sizeof(result));
+  start = restart_bench_now_ns();
+  restart_bench_agent_stop(pid);
+  result.stop_ms = RESTART_BENCH_MS(restart_bench_now_ns() - start);
+
+  restart_bench_errors = 0;
+  if ((pid = restart_bench_agent_start(&arguments)) < 0)
+  {
+    return 1;
+  }
+  start = restart_bench_now_ns();
+  deadline = start + (uint64_t)arguments.timeout * 1000000000;
+  if (restart_bench_connect(&cxn, &sa, start, deadline, &result) < 0)
+  {
+    goto done;
+  }
+  fprintf(stderr, "Connected in %" PRIu64 " ms, handshake in %" PRIu64 " ms\n",
+          result.connect_ms, result.handshake_ms);
+
+  if (arguments.resync)
+  {
+    if (restart_bench_push(&cxn, &arguments, &result, start) < 0)
+    {
+      goto done;
+    }
+  }
+
+  /* Count until everything is back */
+  while (!result.synced && restart_bench_now_ns() < deadline)
+  {
+    next = restart_bench_now_ns() + (uint64_t)arguments.poll_ms * 1000000;
+    if (restart_bench_count(&cxn, &arguments, &result.flows_seen, &result.groups_seen) < 0)
+    {
+      goto done;
+    }
+    restart_bench_count_check(&result, &arguments, start);
+    if (!result.synced && restart_bench_wait(&cxn, next, NULL, NULL) < 0)
+    {
+      goto done;
+    }
+  }
+  if (result.synced)
+  {
+    fprintf(stderr, "Back in sync in %" PRIu64 " ms\n", result.full_sync_ms);
+  }
+  else
+  {
+    fprintf(stderr, "Not in sync after %u s: %" PRIu64 " flows, %u groups\n",
+            arguments.timeout, result.flows_seen, result.groups_seen);
+  }
+
+  /* Let anything the agent does after the sync show in its counters */
+  if (restart_bench_wait(&cxn,
+                         restart_bench_now_ns() + (uint64_t)arguments.settle_ms * 1000000,
+                         NULL, NULL) >= 0 &&
+      restart_bench_counters_read(&cxn, &counters) == 0)
+  {
+    counters_read = 1;
+    if (counters.count == 0)
+    {
+      fprintf(stderr, "No ofdpa.rpc.* debug counters; start the agent with --rpcstats\n");
+    }
+  }
+
+done:
+  result.errors = restart_bench_errors;
+  restart_bench_results_show(&arguments, preload_ms, preload_errors, &result,
+                             counters_read ? &counters : NULL);
+
+  if (cxn.fd >= 0)
+  {
+    close(cxn.fd);
+  }
+  restart_bench_agent_stop(pid);
+  of_object_delete(restart_bench_insts);
+  free(cxn.in);
+
+  return result.synced ? 0 : 2;
+}
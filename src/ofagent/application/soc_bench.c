@@ -0,0 +1,540 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2015
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     soc_bench.c
+*
+* @purpose      Event loop latency benchmark for the socket manager
+*
+* @component    OF-DPA
+*
+* @comments     Loads ind_soc_select_and_run() the way the OF Agent does
+*               and measures how long events wait. A task at the default
+*               priority stands in for a flow stats dump or an expiration
+*               burst: it is started every interval, spins for a fixed
+*               time per entry and checks ind_soc_should_yield() every so
+*               many entries. Meanwhile
+*
+*               - a timer at the connection priority stands in for the
+*                 echo timer, and its lateness against repeat_time_ms is
+*                 measured;
+*               - a thread writes timestamps into a pipe at each of the
+*                 connection, default and low priorities, and the time
+*                 from write to callback is measured.
+*
+*               These measurements use a microsecond clock. The socket
+*               manager's own latency probe runs too and its results,
+*               in milliseconds, are printed after the benchmark's.
+*
+* @create       14 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <argp.h>
+#include <pthread.h>
+#include <inttypes.h>
+
+#include <SocketManager/socketmanager.h>
+#include <AIM/aim.h>
+#include <indigo/types.h>
+
+#define AIM_LOG_MODULE_NAME soc_bench
+
+#include <AIM/aim_log.h>
+
+AIM_LOG_STRUCT_DEFINE(
+                      AIM_LOG_OPTIONS_DEFAULT,
+                      AIM_LOG_BITS_DEFAULT,
+                      NULL,     /* Custom Log Map */
+                      0
+                      );
+
+/* The connection manager's socket and timer priority */
+#define SOC_BENCH_CXN_PRIORITY  10
+
+/* Samples kept per measurement; later ones still count toward the maximum */
+#define SOC_BENCH_SAMPLES_MAX  (1 << 20)
+
+typedef struct
+{
+  uint32_t duration_s;
+  uint32_t work_us;
+  uint32_t yield_every;
+  uint32_t burst;
+  uint32_t interval_ms;
+  uint32_t timer_ms;
+  uint32_t ping_us;
+} arguments_t;
+
+/* One measured interval, in microseconds */
+typedef struct
+{
+  const char *name;
+  uint64_t   *samples;
+  uint32_t   count;
+  uint64_t   total;
+  uint64_t   max;
+} soc_bench_series_t;
+
+/* A pipe the pinger writes timestamps into, read at one priority */
+typedef struct
+{
+  int                priority;
+  int                fds[2];
+  soc_bench_series_t latency;
+} soc_bench_pipe_t;
+
+static struct argp_option options[] =
+{
+  { "duration",    'd', "SECONDS", 0, "Run for SECONDS." },
+  { "work",        'w', "USEC",    0, "Time the dump task spends on each entry." },
+  { "yield-every", 'k', "COUNT",   0, "Entries between the dump task's checks of ind_soc_should_yield()." },
+  { "burst",       'b', "COUNT",   0, "Entries in each dump." },
+  { "interval",    'i', "MSEC",    0, "Start a dump every MSEC, unless one is still running." },
+  { "timer",       't', "MSEC",    0, "repeat_time_ms of the echo timer." },
+  { "ping",        'p', "USEC",    0, "Time between timestamps written to each pipe." },
+  { 0 }
+};
+
+extern void __socketmanager_module_init__(void);
+
+static ind_soc_config_t soc_cfg;
+static arguments_t arguments;
+
+static soc_bench_pipe_t soc_bench_pipes[] =
+{
+  { .priority = SOC_BENCH_CXN_PRIORITY,   .latency = { .name = "socket_ready[10]" } },
+  { .priority = IND_SOC_DEFAULT_PRIORITY, .latency = { .name = "socket_ready[0]" } },
+  { .priority = -1,                       .latency = { .name = "socket_ready[-1]" } },
+};
+
+static soc_bench_series_t soc_bench_timer_late = { .name = "timer_late" };
+static soc_bench_series_t soc_bench_yield_gap = { .name = "task_yield_gap" };
+
+static uint64_t soc_bench_timer_last;
+static int soc_bench_dump_running;
+static uint32_t soc_bench_dump_left;
+static uint32_t soc_bench_dumps;
+static volatile int soc_bench_stop;
+
+static uint32_t
+soc_bench_arg_parse(struct argp_state *state, const char *name, const char *arg)
+{
+  char *endptr;
+  unsigned long value;
+
+  errno = 0;
+  value = strtoul(arg, &endptr, 0);
+  if ((errno != 0) || (*endptr != '\0') || (value == 0) || (value > UINT32_MAX))
+  {
+    argp_error(state, "Invalid %s \"%s\"", name, arg);
+  }
+  return value;
+}
+
+/* Parse a single option. */
+static error_t parse_opt(int key, char *arg, struct argp_state *state)
+{
+  arguments_t *arguments = state->input;
+
+  switch (key)
+  {
+    case 'd':                           /* duration */
+      arguments->duration_s = soc_bench_arg_parse(state, "duration", arg);
+      break;
+
+    case 'w':                           /* work */
+      arguments->work_us = soc_bench_arg_parse(state, "work", arg);
+      break;
+
+    case 'k':                           /* yield-every */
+      arguments->yield_every = soc_bench_arg_parse(state, "yield-every", arg);
+      break;
+
+    case 'b':                           /* burst */
+      arguments->burst = soc_bench_arg_parse(state, "burst", arg);
+      break;
+
+    case 'i':                           /* interval */
+      arguments->interval_ms = soc_bench_arg_parse(state, "interval", arg);
+      break;
+
+    case 't':                           /* timer */
+      arguments->timer_ms = soc_bench_arg_parse(state, "timer", arg);
+      break;
+
+    case 'p':                           /* ping */
+      arguments->ping_us = soc_bench_arg_parse(state, "ping", arg);
+      break;
+
+    case ARGP_KEY_NO_ARGS:
+    case ARGP_KEY_END:
+      break;
+
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+  return 0;
+}
+
+static uint64_t
+soc_bench_now_us(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void
+soc_bench_record(soc_bench_series_t *series, int64_t us)
+{
+  if (us < 0)
+  {
+    us = 0;
+  }
+  if (series->count < SOC_BENCH_SAMPLES_MAX)
+  {
+    series->samples[series->count++] = us;
+  }
+  series->total += us;
+  if (us > series->max)
+  {
+    series->max = us;
+  }
+}
+
+static int
+soc_bench_us_compare(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+static void
+soc_bench_report(soc_bench_series_t *series)
+{
+  uint32_t n = series->count;
+
+  qsort(series->samples, n, sizeof(*series->samples), soc_bench_us_compare);
+  printf("%-20s %10u samples  avg %10.1f us  p50 %10.1f us  p99 %10.1f us  max %10.1f us\n",
+         series->name, n,
+         n ? (double)series->total / n : 0.0,
+         n ? (double)series->samples[n / 2] : 0.0,
+         n ? (double)series->samples[(uint64_t)n * 99 / 100] : 0.0,
+         (double)series->max);
+}
+
+/****************************************************************
+ * Load: the dump task and the timer that starts it
+ ****************************************************************/
+
+static void
+soc_bench_spin(uint32_t us)
+{
+  uint64_t end = soc_bench_now_us() + us;
+
+  while (soc_bench_now_us() < end);
+}
+
+static ind_soc_task_status_t
+soc_bench_dump_task(void *cookie)
+{
+  uint64_t last = soc_bench_now_us(), now;
+  uint32_t i = 0;
+
+  (void)cookie;
+
+  while (soc_bench_dump_left > 0)
+  {
+    soc_bench_spin(arguments.work_us);
+    soc_bench_dump_left--;
+
+    if (++i % arguments.yield_every == 0)
+    {
+      now = soc_bench_now_us();
+      soc_bench_record(&soc_bench_yield_gap, now - last);
+      last = now;
+      if (ind_soc_should_yield())
+      {
+        return IND_SOC_TASK_CONTINUE;
+      }
+    }
+  }
+
+  soc_bench_record(&soc_bench_yield_gap, soc_bench_now_us() - last);
+  soc_bench_dump_running = 0;
+  return IND_SOC_TASK_FINISHED;
+}
+
+static void
+soc_bench_dump_start(void *cookie)
+{
+  (void)cookie;
+
+  if (soc_bench_dump_running)
+  {
+    return;
+  }
+
+  if (ind_soc_task_register(soc_bench_dump_task, NULL, IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    AIM_LOG_ERROR("Failed to start dump task");
+    return;
+  }
+  soc_bench_dump_running = 1;
+  soc_bench_dump_left = arguments.burst;
+  soc_bench_dumps++;
+}
+
+/****************************************************************
+ * Probes: the echo timer and the timestamp pipes
+ ****************************************************************/
+
+static void
+soc_bench_timer(void *cookie)
+{
+  uint64_t now = soc_bench_now_us();
+
+  (void)cookie;
+
+  /* The socket manager schedules the next run repeat_time_ms after this one */
+  if (soc_bench_timer_last != 0)
+  {
+    soc_bench_record(&soc_bench_timer_late,
+                     (int64_t)(now - soc_bench_timer_last) - (int64_t)arguments.timer_ms * 1000);
+  }
+  soc_bench_timer_last = now;
+}
+
+static void
+soc_bench_pipe_ready(int socket_id, void *cookie,
+                     int read_ready, int write_ready, int error_seen)
+{
+  soc_bench_pipe_t *ping = cookie;
+  uint64_t stamps[64], now;
+  ssize_t len;
+  int i;
+
+  (void)write_ready;
+  (void)error_seen;
+
+  if (!read_ready)
+  {
+    return;
+  }
+
+  now = soc_bench_now_us();
+  while ((len = read(socket_id, stamps, sizeof(stamps))) > 0)
+  {
+    for (i = 0; i < len / sizeof(stamps[0]); i++)
+    {
+      soc_bench_record(&ping->latency, now - stamps[i]);
+    }
+  }
+}
+
+static void *
+soc_bench_pinger_main(void *arg)
+{
+  uint64_t stamp;
+  int i;
+
+  (void)arg;
+
+  while (!soc_bench_stop)
+  {
+    for (i = 0; i < AIM_ARRAYSIZE(soc_bench_pipes); i++)
+    {
+      stamp = soc_bench_now_us();
+      if (write(soc_bench_pipes[i].fds[1], &stamp, sizeof(stamp)) != sizeof(stamp))
+      {
+        AIM_LOG_ERROR("Failed to write timestamp: %s", strerror(errno));
+        return NULL;
+      }
+    }
+    usleep(arguments.ping_us);
+  }
+
+  return NULL;
+}
+
+/****************************************************************
+ * Reporting the socket manager's probe
+ ****************************************************************/
+
+static void
+soc_bench_probe_report(const char *name, const ind_soc_probe_latency_t *latency)
+{
+  int i, last;
+
+  printf("%-20s %10"PRIu64" samples  avg %10.1f ms  max %6u ms ",
+         name, latency->count,
+         latency->count ? (double)latency->total_ms / latency->count : 0.0,
+         latency->max_ms);
+  for (last = IND_SOC_PROBE_BUCKETS - 1; last > 0 && latency->buckets[last] == 0; last--);
+  for (i = 0; i <= last; i++)
+  {
+    printf(" %"PRIu64, latency->buckets[i]);
+  }
+  printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+  ind_soc_probe_stats_t stats;
+  pthread_t pinger;
+  uint64_t end;
+  char name[32];
+  int i;
+
+  struct argp argp =
+    {
+      .doc      = "Measures how long timers and sockets wait in the socket manager event loop "
+                  "while a dump task runs.",
+      .options  = options,
+      .parser   = parse_opt,
+    };
+
+  arguments.duration_s = 10;
+  arguments.work_us = 20;
+  arguments.yield_every = 1;
+  arguments.burst = 50000;
+  arguments.interval_ms = 1000;
+  arguments.timer_ms = 100;
+  arguments.ping_us = 1000;
+
+  AIM_LOG_STRUCT_REGISTER();
+
+  __socketmanager_module_init__();
+
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  aim_log_fid_set_all(AIM_LOG_FLAG_FATAL, 1);
+  aim_log_fid_set_all(AIM_LOG_FLAG_ERROR, 1);
+
+  if ((soc_bench_timer_late.samples = malloc(SOC_BENCH_SAMPLES_MAX * sizeof(uint64_t))) == NULL ||
+      (soc_bench_yield_gap.samples = malloc(SOC_BENCH_SAMPLES_MAX * sizeof(uint64_t))) == NULL)
+  {
+    AIM_LOG_FATAL("Failed to allocate samples");
+    return 1;
+  }
+  for (i = 0; i < AIM_ARRAYSIZE(soc_bench_pipes); i++)
+  {
+    if ((soc_bench_pipes[i].latency.samples = malloc(SOC_BENCH_SAMPLES_MAX * sizeof(uint64_t))) == NULL)
+    {
+      AIM_LOG_FATAL("Failed to allocate samples");
+      return 1;
+    }
+  }
+
+  if (ind_soc_init(&soc_cfg) < 0 || ind_soc_enable_set(1) < 0)
+  {
+    AIM_LOG_FATAL("Failed to initialize Indigo socket manager");
+    return 1;
+  }
+
+  for (i = 0; i < AIM_ARRAYSIZE(soc_bench_pipes); i++)
+  {
+    if (pipe(soc_bench_pipes[i].fds) < 0 ||
+        fcntl(soc_bench_pipes[i].fds[0], F_SETFL, O_NONBLOCK) < 0 ||
+        ind_soc_socket_register_with_priority(soc_bench_pipes[i].fds[0], soc_bench_pipe_ready,
+                                              &soc_bench_pipes[i],
+                                              soc_bench_pipes[i].priority) < 0)
+    {
+      AIM_LOG_FATAL("Failed to set up pipe at priority %d", soc_bench_pipes[i].priority);
+      return 1;
+    }
+  }
+
+  if (ind_soc_timer_event_register_with_priority(soc_bench_timer, NULL, arguments.timer_ms,
+                                                 SOC_BENCH_CXN_PRIORITY) < 0 ||
+      ind_soc_timer_event_register_with_priority(soc_bench_dump_start, NULL, arguments.interval_ms,
+                                                 IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    AIM_LOG_FATAL("Failed to register timers");
+    return 1;
+  }
+
+  if (pthread_create(&pinger, NULL, soc_bench_pinger_main, NULL) != 0)
+  {
+    AIM_LOG_FATAL("Failed to start pinger thread");
+    return 1;
+  }
+
+  printf("%u s, dump of %u entries every %u ms at %u us per entry, yield check every %u, "
+         "timer %u ms, ping every %u us\n",
+         arguments.duration_s, arguments.burst, arguments.interval_ms, arguments.work_us,
+         arguments.yield_every, arguments.timer_ms, arguments.ping_us);
+  fflush(stdout);
+
+  ind_soc_probe_stats_clear();
+  ind_soc_probe_enable_set(1);
+
+  end = soc_bench_now_us() + (uint64_t)arguments.duration_s * 1000000;
+  while (soc_bench_now_us() < end)
+  {
+    ind_soc_select_and_run(100);
+  }
+
+  ind_soc_probe_enable_set(0);
+  ind_soc_probe_stats_get(&stats);
+  soc_bench_stop = 1;
+  pthread_join(pinger, NULL);
+
+  printf("dumps started %u\n", soc_bench_dumps);
+  soc_bench_report(&soc_bench_timer_late);
+  soc_bench_report(&soc_bench_yield_gap);
+  for (i = 0; i < AIM_ARRAYSIZE(soc_bench_pipes); i++)
+  {
+    soc_bench_report(&soc_bench_pipes[i].latency);
+  }
+
+  printf("socket manager probe (ms; buckets 0, <2, <4, ...)\n");
+  soc_bench_probe_report("loop_busy", &stats.loop_busy);
+  soc_bench_probe_report("timer_late", &stats.timer_late);
+  soc_bench_probe_report("timer_run", &stats.timer_run);
+  soc_bench_probe_report("socket_run", &stats.socket_run);
+  soc_bench_probe_report("task_run", &stats.task_run);
+  soc_bench_probe_report("task_yield_gap", &stats.task_yield_gap);
+  for (i = 0; i < stats.num_priorities; i++)
+  {
+    snprintf(name, sizeof(name), "socket_ready[%d]", stats.priorities[i].priority);
+    soc_bench_probe_report(name, &stats.priorities[i].socket_ready);
+  }
+  fflush(stdout);
+
+  for (i = 0; i < AIM_ARRAYSIZE(soc_bench_pipes); i++)
+  {
+    ind_soc_socket_unregister(soc_bench_pipes[i].fds[0]);
+    close(soc_bench_pipes[i].fds[0]);
+    close(soc_bench_pipes[i].fds[1]);
+  }
+  ind_soc_finish();
+
+  return 0;
+}
@@ -0,0 +1,769 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2015
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     translate_bench.c
+*
+* @purpose      OF-DPA driver translation microbenchmark
+*
+* @component    OF-DPA
+*
+* @comments     Measures the driver's translation of OpenFlow into
+*               OF-DPA entries alone. Representative flow adds for the
+*               VLAN, Termination MAC, MPLS 1, Unicast Routing, Bridging
+*               and ACL Policy tables are built up front and translated
+*               with ind_ofdpa_flow_translate(), which does the match
+*               and instruction translation of indigo_fwd_flow_create();
+*               bucket lists for the common group types are translated
+*               with ind_ofdpa_group_bucket_entries_build(). Nothing is
+*               added to a table. Each kind is reported in ns per flow
+*               or group, with its translation errors.
+*
+*               --objects distinct messages of each kind are translated
+*               in turn, so that a translator cache sees about as many
+*               repeats as it would from a controller. The bucket cache
+*               hits and misses of each group kind are reported.
+*
+*               Link with the ofdpadriver objects as for flowmod_bench,
+*               with ofdpasim in place of the OF-DPA client library: the
+*               only OF-DPA calls on the translation path decode group
+*               ids.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <argp.h>
+#include <inttypes.h>
+
+#include <AIM/aim.h>
+#include <loci/loci.h>
+#include "ofdpa_datatypes.h"
+#include "ind_ofdpa_util.h"
+
+#define AIM_LOG_MODULE_NAME translate_bench
+
+#include <AIM/aim_log.h>
+
+AIM_LOG_STRUCT_DEFINE(
+                      AIM_LOG_OPTIONS_DEFAULT,
+                      AIM_LOG_BITS_DEFAULT,
+                      NULL,     /* Custom Log Map */
+                      0
+                      );
+
+/* OF-DPA group ids: type in the top 4 bits */
+#define TRANSLATE_BENCH_L2_INTERFACE(vlan, port) \
+  ((OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE << 28) | ((vlan) << 16) | (port))
+#define TRANSLATE_BENCH_L2_REWRITE(index) \
+  ((OFDPA_GROUP_ENTRY_TYPE_L2_REWRITE << 28) | ((index) & 0xfffffff))
+#define TRANSLATE_BENCH_L3_UNICAST(index) \
+  ((OFDPA_GROUP_ENTRY_TYPE_L3_UNICAST << 28) | ((index) & 0xfffffff))
+#define TRANSLATE_BENCH_L3_ECMP(index) \
+  ((OFDPA_GROUP_ENTRY_TYPE_L3_ECMP << 28) | ((index) & 0xfffffff))
+
+#define TRANSLATE_BENCH_PORTS        48
+#define TRANSLATE_BENCH_ECMP_BUCKETS 8
+
+typedef enum
+{
+  TRANSLATE_BENCH_VLAN,
+  TRANSLATE_BENCH_TERMINATION_MAC,
+  TRANSLATE_BENCH_MPLS_1,
+  TRANSLATE_BENCH_UNICAST,
+  TRANSLATE_BENCH_BRIDGING,
+  TRANSLATE_BENCH_ACL,
+  TRANSLATE_BENCH_TABLE_COUNT,
+} translate_bench_table_t;
+
+static const struct
+{
+  const char *name;
+  uint8_t     table_id;
+} translate_bench_tables[TRANSLATE_BENCH_TABLE_COUNT] =
+{
+  [TRANSLATE_BENCH_VLAN]            = { "vlan",            OFDPA_FLOW_TABLE_ID_VLAN },
+  [TRANSLATE_BENCH_TERMINATION_MAC] = { "termination_mac", OFDPA_FLOW_TABLE_ID_TERMINATION_MAC },
+  [TRANSLATE_BENCH_MPLS_1]          = { "mpls_1",          OFDPA_FLOW_TABLE_ID_MPLS_1 },
+  [TRANSLATE_BENCH_UNICAST]         = { "unicast_routing", OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING },
+  [TRANSLATE_BENCH_BRIDGING]        = { "bridging",        OFDPA_FLOW_TABLE_ID_BRIDGING },
+  [TRANSLATE_BENCH_ACL]             = { "acl_policy",      OFDPA_FLOW_TABLE_ID_ACL_POLICY },
+};
+
+typedef enum
+{
+  TRANSLATE_BENCH_GROUP_L2_INTERFACE,
+  TRANSLATE_BENCH_GROUP_L2_REWRITE,
+  TRANSLATE_BENCH_GROUP_L3_UNICAST,
+  TRANSLATE_BENCH_GROUP_L3_ECMP,
+  TRANSLATE_BENCH_GROUP_COUNT,
+} translate_bench_group_t;
+
+static const char *translate_bench_group_names[TRANSLATE_BENCH_GROUP_COUNT] =
+{
+  [TRANSLATE_BENCH_GROUP_L2_INTERFACE] = "l2_interface",
+  [TRANSLATE_BENCH_GROUP_L2_REWRITE]   = "l2_rewrite",
+  [TRANSLATE_BENCH_GROUP_L3_UNICAST]   = "l3_unicast",
+  [TRANSLATE_BENCH_GROUP_L3_ECMP]      = "l3_ecmp",
+};
+
+typedef struct
+{
+  uint32_t iterations;
+  uint32_t objects;
+} arguments_t;
+
+static struct argp_option options[] =
+{
+  { "iterations", 'i', "COUNT", 0, "Translations of each kind." },
+  { "objects",    'n', "COUNT", 0, "Distinct messages of each kind." },
+  { 0 }
+};
+
+extern void __ind_ofdpa_driver_module_init__(void);
+
+/* Parse a single option. */
+static error_t parse_opt(int key, char *arg, struct argp_state *state)
+{
+  arguments_t *arguments = state->input;
+  unsigned long value;
+  char *endptr;
+
+  switch (key)
+  {
+    case 'i':
+    case 'n':
+      errno = 0;
+      value = strtoul(arg, &endptr, 0);
+      if ((errno != 0) || (*endptr != '\0') || (value == 0) || (value > 0xffffffff))
+      {
+        argp_error(state, "Invalid count \"%s\"", arg);
+        return EINVAL;
+      }
+      if (key == 'i')
+      {
+        arguments->iterations = value;
+      }
+      else
+      {
+        arguments->objects = value;
+      }
+      break;
+
+    case ARGP_KEY_NO_ARGS:
+    case ARGP_KEY_END:
+      break;
+
+    default:
+      return ARGP_ERR_UNKNOWN;
+  }
+  return 0;
+}
+
+static uint64_t
+translate_bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/****************************************************************
+ * Message building
+ ****************************************************************/
+
+/* Append obj to list and free obj */
+static int
+translate_bench_append(of_object_t *list, of_object_t *obj)
+{
+  int rv;
+
+  if (obj == NULL)
+  {
+    return -1;
+  }
+  rv = of_list_append(list, obj);
+  of_object_delete(obj);
+  return rv;
+}
+
+static of_object_t *
+translate_bench_group_action(uint32_t group_id)
+{
+  of_action_group_t *action = of_action_group_new(OF_VERSION_1_3);
+
+  if (action != NULL)
+  {
+    of_action_group_group_id_set(action, group_id);
+  }
+  return action;
+}
+
+static of_object_t *
+translate_bench_output_action(uint32_t port)
+{
+  of_action_output_t *action = of_action_output_new(OF_VERSION_1_3);
+
+  if (action != NULL)
+  {
+    of_action_output_port_set(action, port);
+  }
+  return action;
+}
+
+/* A set-field action carrying the wire form of oxm, which is freed */
+static of_object_t *
+translate_bench_set_field_action(of_object_t *oxm)
+{
+  of_action_set_field_t *action = NULL;
+  of_octets_t octets;
+
+  if (oxm == NULL)
+  {
+    return NULL;
+  }
+  octets.data = OF_OBJECT_BUFFER_INDEX(oxm, 0);
+  octets.bytes = oxm->length;
+  if ((action = of_action_set_field_new(OF_VERSION_1_3)) != NULL &&
+      of_action_set_field_field_set(action, &octets) < 0)
+  {
+    of_object_delete(action);
+    action = NULL;
+  }
+  of_object_delete(oxm);
+  return action;
+}
+
+static of_object_t *
+translate_bench_set_vlan_vid_action(uint16_t vlan_vid)
+{
+  of_oxm_vlan_vid_t *oxm = of_oxm_vlan_vid_new(OF_VERSION_1_3);
+
+  if (oxm != NULL)
+  {
+    of_oxm_vlan_vid_value_set(oxm, vlan_vid);
+  }
+  return translate_bench_set_field_action(oxm);
+}
+
+static of_object_t *
+translate_bench_set_mac_action(int dst, uint32_t i)
+{
+  of_object_t *oxm;
+  of_mac_addr_t mac = { { 0x02, dst ? 0x01 : 0x00, i >> 24, i >> 16, i >> 8, i } };
+
+  if (dst)
+  {
+    if ((oxm = of_oxm_eth_dst_new(OF_VERSION_1_3)) != NULL)
+    {
+      of_oxm_eth_dst_value_set(oxm, mac);
+    }
+  }
+  else
+  {
+    if ((oxm = of_oxm_eth_src_new(OF_VERSION_1_3)) != NULL)
+    {
+      of_oxm_eth_src_value_set(oxm, mac);
+    }
+  }
+  return translate_bench_set_field_action(oxm);
+}
+
+/* An instruction holding the given actions, which are freed */
+static of_object_t *
+translate_bench_actions_instruction(int write, of_list_action_t *actions)
+{
+  of_object_t *inst;
+  int rv;
+
+  if (actions == NULL)
+  {
+    return NULL;
+  }
+  if (write)
+  {
+    if ((inst = of_instruction_write_actions_new(OF_VERSION_1_3)) != NULL)
+    {
+      rv = of_instruction_write_actions_actions_set(inst, actions);
+    }
+  }
+  else
+  {
+    if ((inst = of_instruction_apply_actions_new(OF_VERSION_1_3)) != NULL)
+    {
+      rv = of_instruction_apply_actions_actions_set(inst, actions);
+    }
+  }
+  of_object_delete(actions);
+  if (inst != NULL && rv < 0)
+  {
+    of_object_delete(inst);
+    inst = NULL;
+  }
+  return inst;
+}
+
+static of_list_action_t *
+translate_bench_actions(of_object_t *first, of_object_t *second)
+{
+  of_list_action_t *actions = of_list_action_new(OF_VERSION_1_3);
+
+  if (actions == NULL ||
+      translate_bench_append(actions, first) < 0 ||
+      (second != NULL && translate_bench_append(actions, second) < 0))
+  {
+    if (actions != NULL)
+    {
+      of_object_delete(actions);
+    }
+    return NULL;
+  }
+  return actions;
+}
+
+static of_object_t *
+translate_bench_goto(uint8_t table_id)
+{
+  of_instruction_goto_table_t *inst = of_instruction_goto_table_new(OF_VERSION_1_3);
+
+  if (inst != NULL)
+  {
+    of_instruction_goto_table_table_id_set(inst, table_id);
+  }
+  return inst;
+}
+
+/* The i'th flow of a table, the way a controller programs that table */
+static of_flow_add_t *
+translate_bench_flow_build(translate_bench_table_t table, uint32_t i)
+{
+  of_flow_add_t *flow_add;
+  of_list_instruction_t *insts;
+  of_match_t match;
+  uint16_t vlan = 1 + i % 4094;
+  uint32_t port = 1 + i % TRANSLATE_BENCH_PORTS;
+  int rv = -1;
+
+  memset(&match, 0, sizeof(match));
+  match.version = OF_VERSION_1_3;
+
+  if ((flow_add = of_flow_add_new(OF_VERSION_1_3)) == NULL ||
+      (insts = of_list_instruction_new(OF_VERSION_1_3)) == NULL)
+  {
+    if (flow_add != NULL)
+    {
+      of_object_delete(flow_add);
+    }
+    return NULL;
+  }
+
+  switch (table)
+  {
+    case TRANSLATE_BENCH_VLAN:
+      /* Untagged frames on a port get their VLAN */
+      match.fields.in_port = port;
+      OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+      match.fields.vlan_vid = 0;
+      match.masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+      if (translate_bench_append(insts, translate_bench_actions_instruction(0,
+              translate_bench_actions(translate_bench_set_vlan_vid_action(OFDPA_VID_PRESENT | vlan), NULL))) < 0 ||
+          translate_bench_append(insts, translate_bench_goto(OFDPA_FLOW_TABLE_ID_TERMINATION_MAC)) < 0)
+      {
+        goto done;
+      }
+      break;
+
+    case TRANSLATE_BENCH_TERMINATION_MAC:
+      match.fields.in_port = port;
+      OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+      match.fields.eth_type = 0x0800;
+      match.masks.eth_type = 0xffff;
+      match.fields.vlan_vid = OFDPA_VID_PRESENT | vlan;
+      match.masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+      match.fields.eth_dst.addr[0] = 0x02;
+      match.fields.eth_dst.addr[1] = 0x01;
+      memset(match.masks.eth_dst.addr, 0xff, OF_MAC_ADDR_BYTES);
+      if (translate_bench_append(insts, translate_bench_goto(OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING)) < 0)
+      {
+        goto done;
+      }
+      break;
+
+    case TRANSLATE_BENCH_MPLS_1:
+      match.fields.eth_type = 0x8847;
+      match.masks.eth_type = 0xffff;
+      match.fields.mpls_label = 16 + (i & 0xfffff);
+      match.masks.mpls_label = 0xfffff;
+      match.fields.mpls_bos = 1;
+      match.masks.mpls_bos = 1;
+      if (translate_bench_append(insts, translate_bench_actions_instruction(0,
+              translate_bench_actions(of_action_pop_mpls_new(OF_VERSION_1_3), NULL))) < 0 ||
+          translate_bench_append(insts, translate_bench_goto(OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING)) < 0)
+      {
+        goto done;
+      }
+      break;
+
+    case TRANSLATE_BENCH_UNICAST:
+      match.fields.eth_type = 0x0800;
+      match.masks.eth_type = 0xffff;
+      match.fields.ipv4_dst = 0x0a000000 | ((i & 0xffff) << 8);
+      match.masks.ipv4_dst = 0xffffff00;
+      if (translate_bench_append(insts, translate_bench_actions_instruction(1,
+              translate_bench_actions(translate_bench_group_action(TRANSLATE_BENCH_L3_UNICAST(i)), NULL))) < 0 ||
+          translate_bench_append(insts, translate_bench_goto(OFDPA_FLOW_TABLE_ID_ACL_POLICY)) < 0)
+      {
+        goto done;
+      }
+      break;
+
+    case TRANSLATE_BENCH_BRIDGING:
+      match.fields.vlan_vid = OFDPA_VID_PRESENT | vlan;
+      match.masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+      match.fields.eth_dst.addr[0] = 0x02;
+      match.fields.eth_dst.addr[2] = i >> 24;
+      match.fields.eth_dst.addr[3] = i >> 16;
+      match.fields.eth_dst.addr[4] = i >> 8;
+      match.fields.eth_dst.addr[5] = i;
+      memset(match.masks.eth_dst.addr, 0xff, OF_MAC_ADDR_BYTES);
+      if (translate_bench_append(insts, translate_bench_actions_instruction(1,
+              translate_bench_actions(translate_bench_group_action(TRANSLATE_BENCH_L2_INTERFACE(vlan, port)), NULL))) < 0 ||
+          translate_bench_append(insts, translate_bench_goto(OFDPA_FLOW_TABLE_ID_ACL_POLICY)) < 0)
+      {
+        goto done;
+      }
+      break;
+
+    case TRANSLATE_BENCH_ACL:
+    default:
+      /* Redirect a 5-tuple */
+      match.fields.in_port = port;
+      OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+      match.fields.eth_type = 0x0800;
+      match.masks.eth_type = 0xffff;
+      match.fields.ipv4_src = 0x0a000000 | (i & 0xffffff);
+      match.masks.ipv4_src = 0xffffffff;
+      match.fields.ipv4_dst = 0x0b000000 | (i & 0xffffff);
+      match.masks.ipv4_dst = 0xffffffff;
+      match.fields.ip_proto = 6;
+      match.masks.ip_proto = 0xff;
+      match.fields.tcp_dst = 1024 + (i & 0x7fff);
+      match.masks.tcp_dst = 0xffff;
+      if (translate_bench_append(insts, translate_bench_actions_instruction(1,
+              translate_bench_actions(translate_bench_group_action(TRANSLATE_BENCH_L2_INTERFACE(vlan, port)), NULL))) < 0)
+      {
+        goto done;
+      }
+      break;
+  }
+
+  of_flow_add_table_id_set(flow_add, translate_bench_tables[table].table_id);
+  of_flow_add_priority_set(flow_add, 1000);
+  of_flow_add_cookie_set(flow_add, i);
+  of_flow_add_buffer_id_set(flow_add, OF_BUFFER_ID_NO_BUFFER);
+  of_flow_add_out_port_set(flow_add, OF_PORT_DEST_WILDCARD);
+  of_flow_add_out_group_set(flow_add, OF_GROUP_ANY);
+  if (of_flow_add_match_set(flow_add, &match) < 0 ||
+      of_flow_add_instructions_set(flow_add, insts) < 0)
+  {
+    goto done;
+  }
+  rv = 0;
+
+done:
+  of_object_delete(insts);
+  if (rv < 0)
+  {
+    of_object_delete(flow_add);
+    return NULL;
+  }
+  return flow_add;
+}
+
+static int
+translate_bench_bucket_append(of_list_bucket_t *buckets, of_list_action_t *actions)
+{
+  of_bucket_t *bucket;
+  int rv = -1;
+
+  if (actions == NULL)
+  {
+    return -1;
+  }
+  if ((bucket = of_bucket_new(OF_VERSION_1_3)) != NULL)
+  {
+    of_bucket_watch_port_set(bucket, OF_PORT_DEST_WILDCARD);
+    of_bucket_watch_group_set(bucket, OF_GROUP_ANY);
+    if (of_bucket_actions_set(bucket, actions) == 0)
+    {
+      rv = of_list_append(buckets, bucket);
+    }
+    of_object_delete(bucket);
+  }
+  of_object_delete(actions);
+  return rv;
+}
+
+/* The buckets of the i'th group of a kind, and its id */
+static of_list_bucket_t *
+translate_bench_buckets_build(translate_bench_group_t kind, uint32_t i, uint32_t *group_id)
+{
+  of_list_bucket_t *buckets;
+  of_list_action_t *actions;
+  uint16_t vlan = 1 + i % 4094;
+  uint32_t port = 1 + i % TRANSLATE_BENCH_PORTS;
+  int b, rv = 0;
+
+  if ((buckets = of_list_bucket_new(OF_VERSION_1_3)) == NULL)
+  {
+    return NULL;
+  }
+
+  switch (kind)
+  {
+    case TRANSLATE_BENCH_GROUP_L2_INTERFACE:
+      *group_id = TRANSLATE_BENCH_L2_INTERFACE(vlan, port);
+      rv = translate_bench_bucket_append(buckets,
+             translate_bench_actions(translate_bench_output_action(port),
+                                     of_action_pop_vlan_new(OF_VERSION_1_3)));
+      break;
+
+    case TRANSLATE_BENCH_GROUP_L2_REWRITE:
+      *group_id = TRANSLATE_BENCH_L2_REWRITE(i);
+      if ((actions = translate_bench_actions(translate_bench_set_mac_action(1, i),
+                                             translate_bench_set_mac_action(0, i))) == NULL ||
+          translate_bench_append(actions, translate_bench_set_vlan_vid_action(OFDPA_VID_PRESENT | vlan)) < 0 ||
+          translate_bench_append(actions, translate_bench_group_action(TRANSLATE_BENCH_L2_INTERFACE(vlan, port))) < 0)
+      {
+        rv = -1;
+        if (actions != NULL)
+        {
+          of_object_delete(actions);
+        }
+        break;
+      }
+      rv = translate_bench_bucket_append(buckets, actions);
+      break;
+
+    case TRANSLATE_BENCH_GROUP_L3_UNICAST:
+      *group_id = TRANSLATE_BENCH_L3_UNICAST(i);
+      if ((actions = translate_bench_actions(translate_bench_set_mac_action(0, port),
+                                             translate_bench_set_mac_action(1, i))) == NULL ||
+          translate_bench_append(actions, translate_bench_set_vlan_vid_action(OFDPA_VID_PRESENT | vlan)) < 0 ||
+          translate_bench_append(actions, translate_bench_group_action(TRANSLATE_BENCH_L2_INTERFACE(vlan, port))) < 0)
+      {
+        rv = -1;
+        if (actions != NULL)
+        {
+          of_object_delete(actions);
+        }
+        break;
+      }
+      rv = translate_bench_bucket_append(buckets, actions);
+      break;
+
+    case TRANSLATE_BENCH_GROUP_L3_ECMP:
+    default:
+      *group_id = TRANSLATE_BENCH_L3_ECMP(i);
+      for (b = 0; b < TRANSLATE_BENCH_ECMP_BUCKETS && rv == 0; b++)
+      {
+        rv = translate_bench_bucket_append(buckets,
+               translate_bench_actions(translate_bench_group_action(
+                 TRANSLATE_BENCH_L3_UNICAST(i * TRANSLATE_BENCH_ECMP_BUCKETS + b)), NULL));
+      }
+      break;
+  }
+
+  if (rv < 0)
+  {
+    of_object_delete(buckets);
+    return NULL;
+  }
+  return buckets;
+}
+
+/****************************************************************
+ * Runs
+ ****************************************************************/
+
+static int
+translate_bench_flows_run(translate_bench_table_t table, const arguments_t *arguments)
+{
+  of_flow_add_t **flows;
+  ofdpaFlowEntry_t flow;
+  uint64_t start, elapsed;
+  uint32_t i, built, errors = 0;
+  int rv = -1;
+
+  if ((flows = calloc(arguments->objects, sizeof(*flows))) == NULL)
+  {
+    return -1;
+  }
+  for (built = 0; built < arguments->objects; built++)
+  {
+    if ((flows[built] = translate_bench_flow_build(table, built)) == NULL)
+    {
+      AIM_LOG_ERROR("Failed to build a %s flow", translate_bench_tables[table].name);
+      goto done;
+    }
+  }
+
+  start = translate_bench_now_ns();
+  for (i = 0; i < arguments->iterations; i++)
+  {
+    memset(&flow, 0, sizeof(flow));
+    flow.tableId = translate_bench_tables[table].table_id;
+    if (ind_ofdpa_flow_translate(flows[i % arguments->objects], &flow) != INDIGO_ERROR_NONE)
+    {
+      errors++;
+    }
+  }
+  elapsed = translate_bench_now_ns() - start;
+
+  printf("  %-16s %8u %10.1f %10u\n", translate_bench_tables[table].name,
+         translate_bench_tables[table].table_id,
+         (double)elapsed / arguments->iterations, errors);
+  rv = 0;
+
+done:
+  for (i = 0; i < built; i++)
+  {
+    of_object_delete(flows[i]);
+  }
+  free(flows);
+  return rv;
+}
+
+static int
+translate_bench_groups_run(translate_bench_group_t kind, const arguments_t *arguments)
+{
+  of_list_bucket_t **buckets;
+  uint32_t *group_ids;
+  ofdpaGroupBucketEntry_t *entries;
+  ind_ofdpa_bucket_cache_stats_t stats;
+  uint64_t start, elapsed;
+  uint32_t i, built, errors = 0;
+  int count, rv = -1;
+
+  buckets = calloc(arguments->objects, sizeof(*buckets));
+  group_ids = calloc(arguments->objects, sizeof(*group_ids));
+  if (buckets == NULL || group_ids == NULL)
+  {
+    free(buckets);
+    free(group_ids);
+    return -1;
+  }
+  for (built = 0; built < arguments->objects; built++)
+  {
+    if ((buckets[built] = translate_bench_buckets_build(kind, built, &group_ids[built])) == NULL)
+    {
+      AIM_LOG_ERROR("Failed to build %s buckets", translate_bench_group_names[kind]);
+      goto done;
+    }
+  }
+
+  ind_ofdpa_bucket_cache_clear();
+
+  start = translate_bench_now_ns();
+  for (i = 0; i < arguments->iterations; i++)
+  {
+    if (ind_ofdpa_group_bucket_entries_build(group_ids[i % arguments->objects],
+                                             buckets[i % arguments->objects],
+                                             &entries, &count) != INDIGO_ERROR_NONE)
+    {
+      errors++;
+      continue;
+    }
+    aim_free(entries);
+  }
+  elapsed = translate_bench_now_ns() - start;
+
+  ind_ofdpa_bucket_cache_stats_get(&stats);
+  printf("  %-16s %8u %10.1f %10u %10" PRIu64 " %10" PRIu64 "\n",
+         translate_bench_group_names[kind],
+         kind == TRANSLATE_BENCH_GROUP_L3_ECMP ? TRANSLATE_BENCH_ECMP_BUCKETS : 1,
+         (double)elapsed / arguments->iterations, errors,
+         stats.hits, stats.misses + stats.bypass);
+  rv = 0;
+
+done:
+  for (i = 0; i < built; i++)
+  {
+    of_object_delete(buckets[i]);
+  }
+  free(buckets);
+  free(group_ids);
+  return rv;
+}
+
+int main(int argc, char *argv[])
+{
+  int i;
+
+  struct argp argp =
+    {
+      .doc      = "Times the OF-DPA driver's translation of flows and group buckets, per table and group type.",
+      .options  = options,
+      .parser   = parse_opt,
+    };
+
+  arguments_t arguments =
+  {
+    .iterations = 1000000,
+    .objects = 1024,
+  };
+
+  AIM_LOG_STRUCT_REGISTER();
+
+  argp_parse(&argp, argc, argv, 0, 0, &arguments);
+
+  aim_log_fid_set_all(AIM_LOG_FLAG_FATAL, 1);
+  aim_log_fid_set_all(AIM_LOG_FLAG_ERROR, 1);
+
+  __ind_ofdpa_driver_module_init__();
+
+  printf("%u translations of each kind over %u distinct messages\n",
+         arguments.iterations, arguments.objects);
+
+  printf("  %-16s %8s %10s %10s\n", "flow table", "id", "ns/flow", "errors");
+  for (i = 0; i < TRANSLATE_BENCH_TABLE_COUNT; i++)
+  {
+    if (translate_bench_flows_run(i, &arguments) < 0)
+    {
+      return 1;
+    }
+  }
+
+  printf("  %-16s %8s %10s %10s %10s %10s\n",
+         "group type", "buckets", "ns/group", "errors", "cache hits", "misses");
+  for (i = 0; i < TRANSLATE_BENCH_GROUP_COUNT; i++)
+  {
+    if (translate_bench_groups_run(i, &arguments) < 0)
+    {
+      return 1;
+    }
+  }
+
+  return 0;
+}
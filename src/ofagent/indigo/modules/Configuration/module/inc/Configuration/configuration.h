@@ -85,6 +85,17 @@ struct ind_cfg_ops {
      * for this entry.
      */
     const char *filename;
+
+    /**
+     * Config paths this module reads, NULL terminated
+     *
+     * This is an optional parameter.  If set, a reload skips this
+     * module's stage and commit calls when none of these paths (in
+     * ind_cfg_lookup syntax) changed since its last commit, so modules
+     * are not reapplied because an unrelated section was edited.  If
+     * NULL the module is staged and committed on every reload.
+     */
+    const char * const *paths;
 };
 
 /* If entry's filename is NULL or empty string, use default config */
@@ -23,9 +23,23 @@
 #include <cjson/cJSON.h>
 #include <BigList/biglist.h>
 
-/* List of struct ind_cfg_ops pointers */
+/* A registered module and the state needed to diff its config */
+struct cfg_registration {
+    const struct ind_cfg_ops *ops;
+    /* Tree from the module's own file at its last commit */
+    cJSON *last_root;
+    /* Staged in the reload in progress */
+    int staged;
+    /* Committed from the default file at least once */
+    int committed;
+};
+
+/* List of struct cfg_registration pointers */
 static biglist_t *cfg_registration_list;
 
+/* Default config tree at the last successful commit */
+static cJSON *current_root;
+
 /* Filename that current_cfg was read from. */
 static char *current_filename;
 
@@ -75,7 +89,9 @@ ind_cfg_register(const struct ind_cfg_ops *ops)
     if (!IND_CFG_ENTRY_USES_DEFAULT(ops)) {
         AIM_LOG_INFO("Registering cfg client for %s", ops->filename);
     }
-    cfg_registration_list = biglist_append(cfg_registration_list, (void *)ops);
+    struct cfg_registration *reg = aim_zmalloc(sizeof(*reg));
+    reg->ops = ops;
+    cfg_registration_list = biglist_append(cfg_registration_list, reg);
 }
 
 /*
@@ -161,6 +177,81 @@ parse_json_file(const char *filename)
     return root;
 }
 
+/*
+ * Are two cJSON trees equal?  Object members may appear in any order.
+ */
+static int
+json_equal(const cJSON *a, const cJSON *b)
+{
+    const cJSON *ca, *cb;
+    int na = 0, nb = 0;
+
+    if ((a->type & 0xff) != (b->type & 0xff)) {
+        return 0;
+    }
+
+    switch (a->type & 0xff) {
+    case cJSON_Number:
+        return a->valuedouble == b->valuedouble;
+    case cJSON_String:
+        return !strcmp(a->valuestring, b->valuestring);
+    case cJSON_Array:
+        for (ca = a->child, cb = b->child; ca && cb; ca = ca->next, cb = cb->next) {
+            if (!json_equal(ca, cb)) {
+                return 0;
+            }
+        }
+        return ca == NULL && cb == NULL;
+    case cJSON_Object:
+        for (cb = b->child; cb; cb = cb->next) {
+            nb++;
+        }
+        for (ca = a->child; ca; ca = ca->next) {
+            na++;
+            for (cb = b->child; cb; cb = cb->next) {
+                if (!strcmp(ca->string, cb->string)) {
+                    break;
+                }
+            }
+            if (cb == NULL || !json_equal(ca, cb)) {
+                return 0;
+            }
+        }
+        return na == nb;
+    default:
+        return 1;
+    }
+}
+
+/*
+ * Does a module need to see the new tree?  True unless it lists the
+ * paths it reads and all of them are the same in both trees.
+ */
+static int
+config_changed(const struct ind_cfg_ops *ops, cJSON *old_root, cJSON *new_root)
+{
+    const char * const *path;
+    cJSON *old_node, *new_node;
+    indigo_error_t old_err, new_err;
+
+    if (ops->paths == NULL || old_root == NULL) {
+        return 1;
+    }
+
+    for (path = ops->paths; *path != NULL; path++) {
+        old_err = ind_cfg_lookup(old_root, *path, &old_node);
+        new_err = ind_cfg_lookup(new_root, *path, &new_node);
+        if (old_err != new_err) {
+            return 1;
+        }
+        if (old_err == INDIGO_ERROR_NONE && !json_equal(old_node, new_node)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
 /*
  * Iterate thru the registered users and process any entries which
  * use a non-default configuration file
@@ -173,7 +264,8 @@ update_nondefault_config(void)
     biglist_t *el;
 
     BIGLIST_FOREACH(el, cfg_registration_list) {
-        struct ind_cfg_ops *ops = el->data;
+        struct cfg_registration *reg = el->data;
+        const struct ind_cfg_ops *ops = reg->ops;
         if (!IND_CFG_ENTRY_USES_DEFAULT(ops)) {
             AIM_LOG_VERBOSE("Loading non-default cfg file %s", ops->filename);
             root = parse_json_file(ops->filename);
@@ -181,14 +273,22 @@ update_nondefault_config(void)
                 /* parse_json_file() logged a detailed message. */
                 AIM_LOG_ERROR("Could not load non-default cfg file %s",
                               ops->filename);
+            } else if (!config_changed(ops, reg->last_root, root)) {
+                AIM_LOG_VERBOSE("Non-default cfg file %s unchanged",
+                                ops->filename);
+                cJSON_Delete(root);
             } else {
                 if (ops->stage(root) < 0) {
                     AIM_LOG_ERROR("Failed to stage non-default cfg file %s",
                                   ops->filename);
+                    cJSON_Delete(root);
                 } else {
                     ops->commit();
+                    if (reg->last_root) {
+                        cJSON_Delete(reg->last_root);
+                    }
+                    reg->last_root = root;
                 }
-                cJSON_Delete(root);
             }
         }
     }
@@ -208,6 +308,7 @@ ind_cfg_load(void)
     cJSON *root;
     biglist_t *el;
     int failed = 0;
+    int skipped = 0;
 
     /* Update any entries that use a non-default config file */
     update_nondefault_config();
@@ -228,29 +329,42 @@ ind_cfg_load(void)
     AIM_LOG_INFO("Staging new configuration");
 
     BIGLIST_FOREACH(el, cfg_registration_list) {
-        struct ind_cfg_ops *ops = el->data;
+        struct cfg_registration *reg = el->data;
+        const struct ind_cfg_ops *ops = reg->ops;
+        reg->staged = 0;
         if (IND_CFG_ENTRY_USES_DEFAULT(ops)) {
+            if (reg->committed && !config_changed(ops, current_root, root)) {
+                skipped++;
+                continue;
+            }
+            reg->staged = 1;
             if (ops->stage(root) < 0) {
                 failed = 1;
             }
         }
     }
 
-    cJSON_Delete(root);
-
     if (failed == 0) {
         AIM_LOG_INFO("Committing new configuration");
 
         BIGLIST_FOREACH(el, cfg_registration_list) {
-            struct ind_cfg_ops *ops = el->data;
-            if (IND_CFG_ENTRY_USES_DEFAULT(ops)) {
-                ops->commit();
+            struct cfg_registration *reg = el->data;
+            if (reg->staged) {
+                reg->ops->commit();
+                reg->committed = 1;
             }
         }
 
-        AIM_LOG_INFO("Finished reconfiguration");
+        /* Keep the tree to diff the next reload against */
+        if (current_root) {
+            cJSON_Delete(current_root);
+        }
+        current_root = root;
+
+        AIM_LOG_INFO("Finished reconfiguration; %d modules unchanged", skipped);
         return INDIGO_ERROR_NONE;
     } else {
+        cJSON_Delete(root);
         AIM_LOG_WARN("Reconfiguration failed, new configuration not applied");
         return INDIGO_ERROR_UNKNOWN;
     }
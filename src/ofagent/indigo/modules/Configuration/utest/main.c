@@ -340,7 +340,8 @@ static void
 test_non_dflt_reconfiguration(void)
 {
     FILE *file;
-    char filename_non_dflt[] = "non_dflt_XXXXXX";
+    /* Static: ops_non_dflt stays registered after this test */
+    static char filename_non_dflt[] = "non_dflt_XXXXXX";
 
     file = fdopen(mkstemp(filename_non_dflt), "w");
     fwrite(sample_json_non_dflt, strlen(sample_json_non_dflt), 1, file);
@@ -355,6 +356,94 @@ test_non_dflt_reconfiguration(void)
     unlink(filename_non_dflt);
 }
 
+/* Diffed reloads; ops_diff only reads "int" */
+
+static int stage_diff_count;
+static int commit_diff_count;
+
+static indigo_error_t
+stage_diff(cJSON *cjson)
+{
+    stage_diff_count++;
+    return INDIGO_ERROR_NONE;
+}
+
+static void
+commit_diff(void)
+{
+    commit_diff_count++;
+}
+
+static const char * const diff_paths[] = { "int", NULL };
+
+static const struct ind_cfg_ops ops_diff = {
+    .stage = stage_diff,
+    .commit = commit_diff,
+    .paths = diff_paths,
+};
+
+static void
+write_config(const char *filename, const char *json)
+{
+    FILE *file = fopen(filename, "w");
+    fwrite(json, strlen(json), 1, file);
+    fclose(file);
+}
+
+static int
+load_diff(void)
+{
+    stage1_retval = stage2_retval = INDIGO_ERROR_NONE;
+    stage1_count = stage2_count = 0;
+    stage_diff_count = commit_diff_count = 0;
+    INDIGO_ASSERT(ind_cfg_load() == INDIGO_ERROR_NONE);
+    INDIGO_ASSERT(stage_diff_count == commit_diff_count);
+    return stage_diff_count;
+}
+
+static void
+test_diff_reconfiguration(void)
+{
+    char filename[] = "tmpXXXXXX";
+
+    close(mkstemp(filename));
+    write_config(filename, sample_json);
+    ind_cfg_filename_set(filename);
+    ind_cfg_register(&ops_diff);
+
+    /* First load always reaches a newly registered module */
+    INDIGO_ASSERT(load_diff() == 1);
+
+    /* Nothing changed */
+    INDIGO_ASSERT(load_diff() == 0);
+
+    /* Unrelated section changed; modules without paths still run */
+    write_config(filename, "{ \"int\": 5, \"logging\": { \"dataplane\": \"verbose\" } }");
+    INDIGO_ASSERT(load_diff() == 0);
+    INDIGO_ASSERT(stage1_count == 1 && stage2_count == 1);
+
+    /* Same value, different layout */
+    write_config(filename, "{ \"logging\": {}, \"int\": 5.0 }");
+    INDIGO_ASSERT(load_diff() == 0);
+
+    write_config(filename, "{ \"int\": 6 }");
+    INDIGO_ASSERT(load_diff() == 1);
+
+    /* Removed */
+    write_config(filename, "{ }");
+    INDIGO_ASSERT(load_diff() == 1);
+    INDIGO_ASSERT(load_diff() == 0);
+
+    /* A failed reload is diffed against the last committed tree */
+    write_config(filename, "{ \"int\": 7 }");
+    stage1_retval = INDIGO_ERROR_PARAM;
+    stage1_count = stage2_count = 0;
+    INDIGO_ASSERT(ind_cfg_load() < 0);
+    INDIGO_ASSERT(load_diff() == 1);
+
+    unlink(filename);
+}
+
 int main(int argc, char* argv[])
 {
     char filename[256];
@@ -365,6 +454,7 @@ int main(int argc, char* argv[])
     test_json_parse_failure();
     test_reconfiguration(1);
     test_non_dflt_reconfiguration();
+    test_diff_reconfiguration();
 
     return 0;
 }
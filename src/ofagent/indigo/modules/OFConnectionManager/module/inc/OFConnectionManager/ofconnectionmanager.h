@@ -103,13 +103,31 @@ extern indigo_error_t
 ind_cxn_message_track_setup(indigo_cxn_id_t cxn_id, of_object_t *obj);
 
 /**
- * Set the pvs (I/O mgmt structure) to the given value
+ * Does a connection pipeline flow mods?
+ *
+ * @param cxn_id The connection to check
+ *
+ * On a pipelined connection flow mods and packet outs do not wait for
+ * earlier deferred flow adds to be programmed, and a barrier request
+ * hands them to forwarding without blocking the event loop. The reply
+ * waits for them through the outstanding op count; failures are
+ * reported as they complete, with the xid of the failed flow mod.
+ * OpenFlow only orders messages against barriers, so this is legal
+ * for any controller that does not rely on stricter ordering.
+ */
+
+extern int
+ind_cxn_pipelined(indigo_cxn_id_t cxn_id);
+
+/**
+ * Turn message tracing on or off for a connection
  *
  * @param cxn_id The Connection ID to set.
- * @param pvs Pointer to the I/O mgmt structure
+ * @param pvs Non-NULL to trace all message types, NULL to stop tracing
  *
- * cxn_id may be -1 which will apply to all active connections.  Copies the
- * pointer to the pvs object; not a deep copy.
+ * cxn_id may be -1 which will apply to all active connections. Messages
+ * are recorded in binary form and decoded by the "trace" ucli command;
+ * nothing is written to pvs.
  */
 extern indigo_error_t
 ind_cxn_message_trace(indigo_cxn_id_t cxn_id, aim_pvs_t* pvs);
@@ -128,6 +146,18 @@ ind_cxn_message_trace(indigo_cxn_id_t cxn_id, aim_pvs_t* pvs);
 extern void
 ind_cxn_reset(indigo_cxn_id_t cxn_id);
 
+/**
+ * Note a failed forwarding call in the flight recorder
+ *
+ * @param api Name of the call; must stay valid, as only the pointer is kept
+ * @param rv The call's return code
+ *
+ * May be called from any thread. A failure on the event loop thread while
+ * a controller message is being handled is also noted on that message.
+ */
+extern void
+ind_cxn_flight_fwd_error(const char *api, int rv);
+
 
 #endif /* __OFCONNECTIONMANAGER_H__ */
 /** @} */
@@ -129,6 +129,16 @@
 #define OFCONNECTIONMANAGER_CONFIG_OF_VERSION OF_VERSION_1_0
 #endif
 
+/**
+ * OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS
+ *
+ * Include native TLS controller connections. Requires linking with libssl and libcrypto. */
+
+
+#ifndef OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS
+#define OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS 0
+#endif
+
 
 
 /**
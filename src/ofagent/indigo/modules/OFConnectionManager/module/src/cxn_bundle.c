@@ -0,0 +1,411 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+
+/**
+ * @file
+ * @brief Message bundles for connection instances
+ *
+ * A bundle collects modification messages from a controller and applies
+ * them together on commit. LOCI has no OpenFlow 1.4 bundle messages, so
+ * bundles are carried in BSN experimenter messages that mirror the 1.4
+ * encoding:
+ *
+ * Bundle control (subtype IND_CXN_BUNDLE_CTRL_SUBTYPE), data is
+ *     uint32_t bundle_id; uint16_t type; uint16_t flags;
+ * with type one of the IND_CXN_BUNDLE_* requests. The switch answers
+ * with the same message and the matching reply type.
+ *
+ * Bundle add (subtype IND_CXN_BUNDLE_ADD_SUBTYPE), data is
+ *     uint32_t bundle_id; uint16_t pad; uint16_t flags; message...
+ * No reply is sent on success.
+ *
+ * One bundle may be open per connection. An add that cannot be buffered
+ * gets an error and marks the bundle failed, so its commit is refused
+ * rather than applying the bundle without that message. On commit every
+ * message is validated before any is applied; if one fails, the bundle
+ * is discarded and an error is returned for the commit. The messages are
+ * then dispatched in order and deferred flow adds are flushed to the
+ * forwarding module as one batch.
+ */
+
+#include "ofconnectionmanager_log.h"
+
+#include <string.h>
+
+#include "cxn_instance.h"
+#include "ofconnectionmanager_int.h"
+
+#include <indigo/memory.h>
+#include <indigo/forwarding.h>
+
+/* Short hand logging macros */
+#define LOG_ERROR(cxn, fmt, ...)                                        \
+    AIM_LOG_ERROR("cxn %s: " fmt, cxn_ip_string(cxn), ##__VA_ARGS__)
+#define LOG_VERBOSE(cxn, fmt, ...)                                      \
+    AIM_LOG_VERBOSE("cxn %s: " fmt, cxn_ip_string(cxn), ##__VA_ARGS__)
+#define LOG_TRACE(cxn, fmt, ...)                                        \
+    AIM_LOG_TRACE("cxn %s: " fmt, cxn_ip_string(cxn), ##__VA_ARGS__)
+
+/* Bytes of bundle header in front of the payload */
+#define BUNDLE_DATA_HEADER_LEN 8
+
+/* Initial slots in the message array; doubles when full */
+#define BUNDLE_INITIAL_SIZE 64
+
+static inline uint32_t
+get_u32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+        ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline uint16_t
+get_u16(const uint8_t *p)
+{
+    return ((uint16_t)p[0] << 8) | p[1];
+}
+
+static inline void
+put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static inline void
+put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8; p[1] = v;
+}
+
+/**
+ * Free all buffered messages and close the bundle
+ */
+
+void
+ind_cxn_bundle_discard(connection_t *cxn)
+{
+    int i;
+
+    for (i = 0; i < cxn->bundle.count; i++) {
+        aim_free(cxn->bundle.msgs[i]);
+    }
+    aim_free(cxn->bundle.msgs);
+
+    cxn->bundle.msgs = NULL;
+    cxn->bundle.count = 0;
+    cxn->bundle.size = 0;
+    cxn->bundle.bytes = 0;
+    cxn->bundle.failed = 0;
+    cxn->bundle.state = IND_CXN_BUNDLE_STATE_NONE;
+}
+
+/* Answer a bundle control request with the matching reply */
+static void
+bundle_ctrl_reply(connection_t *cxn, uint32_t xid, uint32_t bundle_id,
+                  uint16_t type, uint16_t flags)
+{
+    of_experimenter_t *reply;
+    uint8_t data[BUNDLE_DATA_HEADER_LEN];
+    of_octets_t octets = { .data = data, .bytes = sizeof(data) };
+
+    if ((reply = of_experimenter_new(cxn->status.negotiated_version)) == NULL) {
+        LOG_ERROR(cxn, "Failed to allocate bundle reply");
+        return;
+    }
+
+    put_u32(data, bundle_id);
+    put_u16(data + 4, type + 1);
+    put_u16(data + 6, flags);
+
+    of_experimenter_xid_set(reply, xid);
+    of_experimenter_experimenter_set(reply, OF_EXPERIMENTER_ID_BSN);
+    of_experimenter_subtype_set(reply, IND_CXN_BUNDLE_CTRL_SUBTYPE);
+    if (of_experimenter_data_set(reply, &octets) < 0) {
+        LOG_ERROR(cxn, "Failed to set bundle reply data");
+        of_object_delete(reply);
+        return;
+    }
+
+    indigo_cxn_send_controller_message(cxn->cxn_id, reply);
+}
+
+/**
+ * Can a message be part of a bundle?
+ *
+ * Only state changes are bundled; requests that expect an immediate
+ * answer or that the connection handles itself are not.
+ */
+static int
+bundle_msg_allowed(of_object_t *obj)
+{
+    switch (obj->object_id) {
+    case OF_FLOW_ADD:
+    case OF_FLOW_MODIFY:
+    case OF_FLOW_MODIFY_STRICT:
+    case OF_FLOW_DELETE:
+    case OF_FLOW_DELETE_STRICT:
+    case OF_GROUP_MOD:
+    case OF_GROUP_ADD:
+    case OF_GROUP_MODIFY:
+    case OF_GROUP_DELETE:
+    case OF_METER_MOD:
+    case OF_METER_ADD:
+    case OF_METER_MODIFY:
+    case OF_METER_DELETE:
+    case OF_PORT_MOD:
+    case OF_TABLE_MOD:
+    case OF_PACKET_OUT:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* Reject an add to the open bundle and mark the bundle failed */
+static void
+bundle_add_fail(connection_t *cxn, of_object_t *obj, uint16_t code)
+{
+    cxn->bundle.failed = 1;
+    indigo_cxn_send_error_reply(cxn->cxn_id, obj,
+                                OF_ERROR_TYPE_BAD_REQUEST, code);
+}
+
+/* Buffer a copy of one message for the open bundle */
+static void
+bundle_add(connection_t *cxn, of_object_t *obj, const uint8_t *data, int len)
+{
+    uint32_t bundle_id = get_u32(data);
+    const uint8_t *msg = data + BUNDLE_DATA_HEADER_LEN;
+    int msg_len = len - BUNDLE_DATA_HEADER_LEN;
+    uint8_t *copy;
+
+    if (cxn->bundle.state != IND_CXN_BUNDLE_STATE_OPEN ||
+        cxn->bundle.id != bundle_id) {
+        LOG_VERBOSE(cxn, "Bundle add for bundle %u which is not open",
+                    bundle_id);
+        indigo_cxn_send_error_reply(cxn->cxn_id, obj,
+                                    OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_EPERM);
+        return;
+    }
+
+    if (msg_len < OF_MESSAGE_HEADER_LENGTH ||
+        of_message_length_get((of_message_t)msg) != msg_len ||
+        of_message_version_get((of_message_t)msg) !=
+        cxn->status.negotiated_version) {
+        bundle_add_fail(cxn, obj, OF_REQUEST_FAILED_BAD_LEN);
+        return;
+    }
+
+    if (cxn->bundle.count >= IND_CXN_BUNDLE_MAX_MSGS ||
+        cxn->bundle.bytes + msg_len > IND_CXN_BUNDLE_MAX_BYTES) {
+        LOG_VERBOSE(cxn, "Bundle %u is full", bundle_id);
+        bundle_add_fail(cxn, obj, OF_REQUEST_FAILED_MULTIPART_BUFFER_OVERFLOW);
+        return;
+    }
+
+    if (cxn->bundle.count == cxn->bundle.size) {
+        int new_size = cxn->bundle.size ? cxn->bundle.size * 2 :
+            BUNDLE_INITIAL_SIZE;
+        uint8_t **msgs = aim_realloc(cxn->bundle.msgs,
+                                     new_size * sizeof(*msgs));
+        if (msgs == NULL) {
+            LOG_ERROR(cxn, "Failed to grow bundle %u", bundle_id);
+            bundle_add_fail(cxn, obj,
+                            OF_REQUEST_FAILED_MULTIPART_BUFFER_OVERFLOW);
+            return;
+        }
+        cxn->bundle.msgs = msgs;
+        cxn->bundle.size = new_size;
+    }
+
+    if ((copy = aim_malloc(msg_len)) == NULL) {
+        LOG_ERROR(cxn, "Failed to allocate bundle message");
+        bundle_add_fail(cxn, obj, OF_REQUEST_FAILED_MULTIPART_BUFFER_OVERFLOW);
+        return;
+    }
+    INDIGO_MEM_COPY(copy, msg, msg_len);
+
+    cxn->bundle.msgs[cxn->bundle.count++] = copy;
+    cxn->bundle.bytes += msg_len;
+}
+
+/* Validate and apply every message of the bundle */
+static int
+bundle_commit(connection_t *cxn, of_object_t *request)
+{
+    of_object_storage_t obj_storage;
+    of_object_t *obj;
+    int i, len;
+
+    if (cxn->bundle.failed) {
+        LOG_VERBOSE(cxn, "Bundle %u lost a message; not committing",
+                    cxn->bundle.id);
+        indigo_cxn_send_error_reply(cxn->cxn_id, request,
+                                    OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_EPERM);
+        return -1;
+    }
+
+    /* Validation pass; nothing is applied if a message is rejected */
+    for (i = 0; i < cxn->bundle.count; i++) {
+        len = of_message_length_get((of_message_t)cxn->bundle.msgs[i]);
+        obj = of_object_new_from_message_preallocated(
+            &obj_storage, cxn->bundle.msgs[i], len);
+        if (obj == NULL || !bundle_msg_allowed(obj)) {
+            LOG_VERBOSE(cxn, "Bundle %u message %d is not allowed",
+                        cxn->bundle.id, i);
+            indigo_cxn_send_error_reply(cxn->cxn_id, request,
+                                        OF_ERROR_TYPE_BAD_REQUEST,
+                                        OF_REQUEST_FAILED_BAD_TYPE);
+            return -1;
+        }
+    }
+
+    if (cxn->bundle.count > 0 && cxn->status.role == INDIGO_CXN_R_SLAVE) {
+        indigo_cxn_send_error_reply(
+            cxn->cxn_id, request, OF_ERROR_TYPE_BAD_REQUEST,
+            cxn->status.negotiated_version < OF_VERSION_1_2 ?
+            OF_REQUEST_FAILED_EPERM : OF_REQUEST_FAILED_IS_SLAVE);
+        return -1;
+    }
+
+    LOG_TRACE(cxn, "Committing bundle %u, %d messages, %d bytes",
+              cxn->bundle.id, cxn->bundle.count, cxn->bundle.bytes);
+
+    for (i = 0; i < cxn->bundle.count; i++) {
+        len = of_message_length_get((of_message_t)cxn->bundle.msgs[i]);
+        obj = of_object_new_from_message_preallocated(
+            &obj_storage, cxn->bundle.msgs[i], len);
+        ind_cxn_msg_process(cxn, obj);
+    }
+
+    /* Send the deferred flow adds down as one batch */
+    indigo_fwd_pending_flush();
+
+    return 0;
+}
+
+/* Handle a bundle control request */
+static void
+bundle_ctrl(connection_t *cxn, of_object_t *obj, const uint8_t *data)
+{
+    uint32_t xid;
+    uint32_t bundle_id = get_u32(data);
+    uint16_t type = get_u16(data + 4);
+    uint16_t flags = get_u16(data + 6);
+    int state = cxn->bundle.state;
+
+    of_experimenter_xid_get(obj, &xid);
+
+    LOG_TRACE(cxn, "Bundle %u control type %u", bundle_id, type);
+
+    if (type != IND_CXN_BUNDLE_OPEN_REQUEST &&
+        (state == IND_CXN_BUNDLE_STATE_NONE || cxn->bundle.id != bundle_id)) {
+        indigo_cxn_send_error_reply(cxn->cxn_id, obj,
+                                    OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_EPERM);
+        return;
+    }
+
+    switch (type) {
+    case IND_CXN_BUNDLE_OPEN_REQUEST:
+        if (state != IND_CXN_BUNDLE_STATE_NONE) {
+            indigo_cxn_send_error_reply(cxn->cxn_id, obj,
+                                        OF_ERROR_TYPE_BAD_REQUEST,
+                                        OF_REQUEST_FAILED_EPERM);
+            return;
+        }
+        cxn->bundle.state = IND_CXN_BUNDLE_STATE_OPEN;
+        cxn->bundle.id = bundle_id;
+        cxn->bundle.flags = flags;
+        break;
+
+    case IND_CXN_BUNDLE_CLOSE_REQUEST:
+        if (state != IND_CXN_BUNDLE_STATE_OPEN) {
+            indigo_cxn_send_error_reply(cxn->cxn_id, obj,
+                                        OF_ERROR_TYPE_BAD_REQUEST,
+                                        OF_REQUEST_FAILED_EPERM);
+            return;
+        }
+        cxn->bundle.state = IND_CXN_BUNDLE_STATE_CLOSED;
+        break;
+
+    case IND_CXN_BUNDLE_COMMIT_REQUEST:
+        if (bundle_commit(cxn, obj) < 0) {
+            ind_cxn_bundle_discard(cxn);
+            return;
+        }
+        ind_cxn_bundle_discard(cxn);
+        break;
+
+    case IND_CXN_BUNDLE_DISCARD_REQUEST:
+        ind_cxn_bundle_discard(cxn);
+        break;
+
+    default:
+        indigo_cxn_send_error_reply(cxn->cxn_id, obj,
+                                    OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_BAD_SUBTYPE);
+        return;
+    }
+
+    bundle_ctrl_reply(cxn, xid, bundle_id, type, flags);
+}
+
+/**
+ * Handle an experimenter message if it is a bundle message
+ *
+ * @returns 1 if the message was consumed, 0 to pass it on
+ */
+
+int
+ind_cxn_bundle_handle(connection_t *cxn, of_object_t *obj)
+{
+    uint32_t experimenter, subtype;
+    of_octets_t data;
+
+    of_experimenter_experimenter_get(obj, &experimenter);
+    if (experimenter != OF_EXPERIMENTER_ID_BSN) {
+        return 0;
+    }
+
+    of_experimenter_subtype_get(obj, &subtype);
+    if (subtype != IND_CXN_BUNDLE_CTRL_SUBTYPE &&
+        subtype != IND_CXN_BUNDLE_ADD_SUBTYPE) {
+        return 0;
+    }
+
+    of_experimenter_data_get(obj, &data);
+    if (data.bytes < BUNDLE_DATA_HEADER_LEN) {
+        indigo_cxn_send_error_reply(cxn->cxn_id, obj,
+                                    OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_BAD_LEN);
+        return 1;
+    }
+
+    if (subtype == IND_CXN_BUNDLE_CTRL_SUBTYPE) {
+        bundle_ctrl(cxn, obj, data.data);
+    } else {
+        bundle_add(cxn, obj, data.data, data.bytes);
+    }
+
+    return 1;
+}
@@ -0,0 +1,351 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+
+/**
+ * @file
+ * @brief Flight recorder of recent control plane events
+ *
+ * The last CXN_FLIGHT_EVENTS events are kept in a ring: messages handled
+ * (type, xid, handler time and the first forwarding error seen while the
+ * handler ran), error replies sent, connection state changes and failed
+ * forwarding calls. It is always on; recording an event takes a clock
+ * read and a few stores, and never allocates or locks.
+ *
+ * Forwarding errors may come from threads other than the event loop, so
+ * writers claim slots with an atomic increment. Each slot carries its
+ * sequence number, cleared while the slot is being written, so a reader
+ * can skip slots that are torn or were reused under it.
+ *
+ * The ring is shown by the "flight" ucli command, and the latest events
+ * of a connection are logged when it is disconnected.
+ */
+
+#include "ofconnectionmanager_log.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "cxn_instance.h"
+#include "ofconnectionmanager_int.h"
+
+enum {
+    CXN_FLIGHT_MSG_IN,
+    CXN_FLIGHT_ERROR_OUT,
+    CXN_FLIGHT_STATE,
+    CXN_FLIGHT_FWD_ERROR,
+};
+
+typedef struct cxn_flight_event_s {
+    uint64_t seq;           /* Slot index + 1, or 0 while being written */
+    uint64_t time_us;
+    const char *fwd_api;    /* CXN_FLIGHT_FWD_ERROR */
+    int32_t rv;             /* Forwarding return code or error code */
+    uint32_t xid;
+    uint32_t duration_us;   /* CXN_FLIGHT_MSG_IN handler time */
+    int16_t cxn_id;         /* -1 if not tied to a connection */
+    uint16_t type;          /* Object id, state or error type */
+    uint8_t kind;
+} cxn_flight_event_t;
+
+static cxn_flight_event_t flight_ring[CXN_FLIGHT_EVENTS];
+static uint64_t flight_next;
+
+/* First forwarding error on this thread since the handler started */
+static __thread int flight_in_handler;
+static __thread int32_t flight_handler_rv;
+
+static inline cxn_flight_event_t *
+flight_claim(uint64_t *seq)
+{
+    cxn_flight_event_t *event;
+
+    *seq = __atomic_fetch_add(&flight_next, 1, __ATOMIC_RELAXED) + 1;
+    event = &flight_ring[(*seq - 1) & (CXN_FLIGHT_EVENTS - 1)];
+    __atomic_store_n(&event->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return event;
+}
+
+static inline void
+flight_publish(cxn_flight_event_t *event, uint64_t seq)
+{
+    __atomic_store_n(&event->seq, seq, __ATOMIC_RELEASE);
+}
+
+/**
+ * Note the start of a message handler on this thread
+ */
+
+void
+ind_cxn_flight_handler_start(void)
+{
+    flight_in_handler = 1;
+    flight_handler_rv = 0;
+}
+
+/**
+ * Record a handled message
+ */
+
+void
+ind_cxn_flight_msg(connection_t *cxn, of_object_id_t object_id, uint32_t xid,
+                   uint64_t start_us, uint64_t end_us)
+{
+    cxn_flight_event_t *event;
+    uint64_t seq;
+
+    event = flight_claim(&seq);
+    event->time_us = end_us;
+    event->fwd_api = NULL;
+    event->rv = flight_handler_rv;
+    event->xid = xid;
+    event->duration_us = end_us - start_us;
+    event->cxn_id = cxn->cxn_id;
+    event->type = object_id;
+    event->kind = CXN_FLIGHT_MSG_IN;
+    flight_publish(event, seq);
+
+    flight_in_handler = 0;
+}
+
+/**
+ * Record an error reply sent to a controller
+ */
+
+void
+ind_cxn_flight_error_out(indigo_cxn_id_t cxn_id, uint32_t xid,
+                         uint16_t type, uint16_t code)
+{
+    cxn_flight_event_t *event;
+    uint64_t seq;
+
+    event = flight_claim(&seq);
+    event->time_us = ind_cxn_latency_now_us();
+    event->fwd_api = NULL;
+    event->rv = code;
+    event->xid = xid;
+    event->duration_us = 0;
+    event->cxn_id = cxn_id;
+    event->type = type;
+    event->kind = CXN_FLIGHT_ERROR_OUT;
+    flight_publish(event, seq);
+}
+
+/**
+ * Record a connection state change
+ */
+
+void
+ind_cxn_flight_state(connection_t *cxn, indigo_cxn_state_t state)
+{
+    cxn_flight_event_t *event;
+    uint64_t seq;
+
+    event = flight_claim(&seq);
+    event->time_us = ind_cxn_latency_now_us();
+    event->fwd_api = NULL;
+    event->rv = 0;
+    event->xid = 0;
+    event->duration_us = 0;
+    event->cxn_id = cxn->cxn_id;
+    event->type = state;
+    event->kind = CXN_FLIGHT_STATE;
+    flight_publish(event, seq);
+}
+
+/**
+ * Record a failed forwarding call
+ */
+
+void
+ind_cxn_flight_fwd_error(const char *api, int rv)
+{
+    cxn_flight_event_t *event;
+    uint64_t seq;
+
+    if (flight_in_handler && flight_handler_rv == 0) {
+        flight_handler_rv = rv;
+    }
+
+    event = flight_claim(&seq);
+    event->time_us = ind_cxn_latency_now_us();
+    event->fwd_api = api;
+    event->rv = rv;
+    event->xid = 0;
+    event->duration_us = 0;
+    event->cxn_id = -1;
+    event->type = 0;
+    event->kind = CXN_FLIGHT_FWD_ERROR;
+    flight_publish(event, seq);
+}
+
+/**
+ * Forget all recorded events
+ */
+
+void
+ind_cxn_flight_clear(void)
+{
+    int i;
+
+    for (i = 0; i < CXN_FLIGHT_EVENTS; i++) {
+        __atomic_store_n(&flight_ring[i].seq, 0, __ATOMIC_RELAXED);
+    }
+}
+
+/* Copy out the event with the given sequence number, if it is still there */
+static int
+flight_read(uint64_t seq, cxn_flight_event_t *out)
+{
+    cxn_flight_event_t *event = &flight_ring[(seq - 1) & (CXN_FLIGHT_EVENTS - 1)];
+
+    if (__atomic_load_n(&event->seq, __ATOMIC_ACQUIRE) != seq) {
+        return 0;
+    }
+    memcpy(out, event, sizeof(*out));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&event->seq, __ATOMIC_RELAXED) == seq &&
+        out->seq == seq;
+}
+
+static void
+flight_format(char *buf, int size, const cxn_flight_event_t *event,
+              uint64_t now_us)
+{
+    char cxn[16];
+    double ago_ms = (int64_t)(now_us - event->time_us) / 1000.0;
+    int len;
+
+    if (event->cxn_id < 0) {
+        snprintf(cxn, sizeof(cxn), "-");
+    } else {
+        snprintf(cxn, sizeof(cxn), "%d", event->cxn_id);
+    }
+
+    len = snprintf(buf, size, "%12.3f ms ago  cxn %-3s ", ago_ms, cxn);
+    if (len < 0 || len >= size) {
+        return;
+    }
+    buf += len;
+    size -= len;
+
+    switch (event->kind) {
+    case CXN_FLIGHT_MSG_IN:
+        len = snprintf(buf, size, "in    %s xid %u handler %u us",
+                       event->type < OF_MESSAGE_OBJECT_COUNT ?
+                       of_object_id_str[event->type] : "unknown",
+                       event->xid, event->duration_us);
+        if (event->rv && len > 0 && len < size) {
+            snprintf(buf + len, size - len, " fwd rv %d", event->rv);
+        }
+        break;
+    case CXN_FLIGHT_ERROR_OUT:
+        snprintf(buf, size, "error type %u code %d xid %u",
+                 event->type, event->rv, event->xid);
+        break;
+    case CXN_FLIGHT_STATE:
+        snprintf(buf, size, "state %s",
+                 event->type < INDIGO_CXN_S_COUNT ?
+                 CXN_STATE_NAME(event->type) : "unknown");
+        break;
+    case CXN_FLIGHT_FWD_ERROR:
+        snprintf(buf, size, "fwd   %s rv %d",
+                 event->fwd_api ? event->fwd_api : "unknown", event->rv);
+        break;
+    default:
+        snprintf(buf, size, "kind %u", event->kind);
+        break;
+    }
+}
+
+/*
+ * Walk back from the newest event, passing up to max events of the
+ * connection (or all, if cxn_id is negative) to the callback oldest first
+ */
+typedef void (*flight_line_f)(void *cookie, const char *line);
+
+static void
+flight_walk(indigo_cxn_id_t cxn_id, int max, flight_line_f cb, void *cookie)
+{
+    static cxn_flight_event_t events[CXN_FLIGHT_EVENTS];
+    uint64_t newest, seq, now_us;
+    char line[160];
+    int count = 0, i;
+
+    newest = __atomic_load_n(&flight_next, __ATOMIC_ACQUIRE);
+    if (max <= 0 || max > CXN_FLIGHT_EVENTS) {
+        max = CXN_FLIGHT_EVENTS;
+    }
+
+    for (seq = newest; seq > 0 && newest - seq < CXN_FLIGHT_EVENTS &&
+             count < max; seq--) {
+        cxn_flight_event_t event;
+        if (!flight_read(seq, &event)) {
+            continue;
+        }
+        if (cxn_id >= 0 && event.cxn_id != cxn_id) {
+            continue;
+        }
+        events[count++] = event;
+    }
+
+    now_us = ind_cxn_latency_now_us();
+    for (i = count - 1; i >= 0; i--) {
+        flight_format(line, sizeof(line), &events[i], now_us);
+        cb(cookie, line);
+    }
+}
+
+static void
+flight_pvs_line(void *cookie, const char *line)
+{
+    aim_printf((aim_pvs_t *)cookie, "%s\n", line);
+}
+
+/**
+ * Show recorded events, oldest first
+ *
+ * @param cxn_id Only events of this connection, or all if negative
+ * @param max Show at most this many of the newest events; 0 for all
+ */
+
+void
+ind_cxn_flight_show(aim_pvs_t *pvs, indigo_cxn_id_t cxn_id, int max)
+{
+    flight_walk(cxn_id, max, flight_pvs_line, pvs);
+}
+
+static void
+flight_log_line(void *cookie, const char *line)
+{
+    AIM_LOG_INFO("cxn %s flight: %s", (const char *)cookie, line);
+}
+
+/**
+ * Log the latest events of a connection, for a disconnect
+ */
+
+void
+ind_cxn_flight_log(connection_t *cxn)
+{
+    flight_walk(cxn->cxn_id, CXN_FLIGHT_DUMP_ON_DISCONNECT,
+                flight_log_line, cxn_ip_string(cxn));
+}
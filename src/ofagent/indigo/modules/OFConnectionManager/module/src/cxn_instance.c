@@ -28,6 +28,9 @@
 #include <string.h>
 #include <errno.h>
 #include <unistd.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/uio.h>
 
 #include "cxn_instance.h"
 #include "ofconnectionmanager_int.h"
@@ -37,6 +40,9 @@
 
 #include <indigo/memory.h>
 #include <indigo/assert.h>
+#include <indigo/forwarding.h>
+#include <indigo/mem_budget.h>
+#include <indigo/mem_arena.h>
 
 #include <loci/loci_dump.h>
 #include <loci/loci_show.h>
@@ -72,9 +78,35 @@ state_info_t state_info[INDIGO_CXN_S_COUNT] = {
 };
 
 
+/*
+ * Reconnect backoff; see connection_retry_ms. A connect in progress is
+ * polled every CXN_CONNECT_POLL_MS for up to CXN_CONNECT_TIMEOUT_MS.
+ */
+#define CXN_RETRY_MIN_MS 100
+#define CXN_RETRY_MAX_MS 4000
+#define CXN_RETRY_SHIFT_MAX 16
+#define CXN_CONNECT_POLL_MS 20
+#define CXN_CONNECT_TIMEOUT_MS 5000
+
 /* Maximum number of messages to send per write callback */
 #define MAX_WRITE_MSGS 32
 
+/*
+ * On a plain TCP connection, messages up to WRITE_COALESCE_MAX bytes are
+ * copied into a slab and sent as one iovec, so a write callback can take
+ * up to MAX_WRITE_BATCH_MSGS messages in at most IOV_MAX iovecs.
+ */
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+#define MAX_WRITE_BATCH_MSGS 4096
+#define WRITE_COALESCE_MAX 256
+#define WRITE_SLAB_SIZE (64 * 1024)
+
+/* The i'th oldest message in an output queue */
+#define OUTPUT_QUEUE_MSG(q, i) \
+    (&(q)->ring[((q)->head + (i)) & ((q)->size - 1)])
+
 
 /**
  * Dump data buffer
@@ -122,9 +154,39 @@ cxn_data_hexdump(unsigned char *buf, int bytes)
  ****************************************************************/
 
 static void periodic_keepalive(void *cookie);
+static int connection_retry_ms(const connection_t *cxn);
+static void read_continue_schedule(connection_t *cxn);
 
 #define VERSION_IS_SET(cxn) ((cxn)->status.negotiated_version > 0)
 
+/**
+ * Release the data of an output queue entry
+ */
+static void
+output_msg_free(cxn_output_msg_t *msg)
+{
+    if (msg->shared != NULL) {
+        ind_cxn_shared_msg_unref(msg->shared);
+    } else {
+        of_alloc_free(msg->data);
+    }
+    msg->data = NULL;
+    msg->shared = NULL;
+}
+
+/**
+ * Free an output ring of size slots, from the memory arena or the heap
+ */
+static void
+output_ring_free(cxn_output_msg_t *ring, int size)
+{
+    if (indigo_mem_arena_contains(ring)) {
+        indigo_mem_arena_free(ring, size * sizeof(*ring));
+    } else {
+        aim_free(ring);
+    }
+}
+
 /**
  * Disconnect and clean up
  *
@@ -133,14 +195,19 @@ static void periodic_keepalive(void *cookie);
 static void
 cleanup_disconnect(connection_t *cxn)
 {
-    uint8_t *data;
-    biglist_t *ble;
+    int i, c;
 
     cxn->status.disconnect_count++;
 
+    /* What led up to the disconnect */
+    ind_cxn_flight_log(cxn);
+
     /* Close this socket. */
     if (cxn->sd >= 0) {
         ind_soc_socket_unregister(cxn->sd);
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+        ind_cxn_tls_close(cxn);
+#endif
         close(cxn->sd);
     }
     cxn->sd = -1;
@@ -151,17 +218,35 @@ cleanup_disconnect(connection_t *cxn)
     LOG_VERBOSE(cxn, "Closing connection, current read buf has %d bytes",
                 cxn->read_bytes);
     cxn->read_bytes = 0;
-    /* Clear write queue */
-    BIGLIST_FOREACH_DATA(ble, cxn->output_list, uint8_t *, data) {
-        LOG_TRACE(cxn, "Freeing outgoing msg %p", data);
-        aim_free(data);
+    cxn->read_offset = 0;
+    cxn->echo_peek_offset = 0;
+    cxn->echo_answered_early = 0;
+    /* Clear write queues */
+    for (c = 0; c < CXN_OUTPUT_CLASS_COUNT; c++) {
+        cxn_output_queue_t *q = &cxn->output_queues[c];
+        for (i = 0; i < q->count; i++) {
+            cxn_output_msg_t *msg = OUTPUT_QUEUE_MSG(q, i);
+            LOG_TRACE(cxn, "Freeing outgoing msg %p", msg->data);
+            output_msg_free(msg);
+        }
+        output_ring_free(q->ring, q->size);
+        q->ring = NULL;
+        q->size = 0;
+        q->head = 0;
+        q->count = 0;
     }
-    biglist_free(cxn->output_list);
-    cxn->output_list = NULL;
-
+    cxn->output_head_class = -1;
+    indigo_mem_budget_release(INDIGO_MEM_BUDGET_OUTPUT, cxn->bytes_enqueued);
     cxn->bytes_enqueued = 0;
     cxn->pkts_enqueued = 0;
     cxn->output_head_offset = 0;
+
+    /* An uncommitted bundle does not survive the connection */
+    ind_cxn_bundle_discard(cxn);
+
+    /* Nothing queued any more; let waiting producers find out */
+    ind_cxn_output_waiters_run(cxn);
+    ind_cxn_flow_removed_waiters_run();
 }
 
 
@@ -300,6 +385,7 @@ cxn_state_set(connection_t *cxn, indigo_cxn_state_t new_state)
 
     LOG_INFO(cxn, "%s->%s", CXN_STATE_NAME(old_state),
              CXN_STATE_NAME(new_state));
+    ind_cxn_flight_state(cxn, new_state);
 
     /****************************************************************
      *
@@ -362,14 +448,17 @@ cxn_state_set(connection_t *cxn, indigo_cxn_state_t new_state)
     case INDIGO_CXN_S_DISCONNECTED:
         if (cxn->flags & CXN_TO_BE_REMOVED) {
             LOG_VERBOSE(cxn, "Completing cxn removal");
-            cxn->active = 0;
+            ind_cxn_active_set(cxn, 0);
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+            ind_cxn_tls_session_clear(cxn);
+#endif
         } else if (CXN_LOCAL(cxn)) {
-            cxn->active = 0;
+            ind_cxn_active_set(cxn, 0);
         } else {
             /* Disconnected but still active - start connecting again */
             ind_soc_timer_event_register_with_priority(
                 ind_cxn_connection_retry_timer, cxn,
-                IND_SOC_TIMER_IMMEDIATE, IND_CXN_EVENT_PRIORITY);
+                connection_retry_ms(cxn), IND_CXN_EVENT_PRIORITY);
         }
         ind_cxn_disconnected_init(cxn);
         break;
@@ -379,6 +468,13 @@ cxn_state_set(connection_t *cxn, indigo_cxn_state_t new_state)
         ind_soc_socket_register_with_priority(
             cxn->sd, indigo_cxn_socket_ready_callback,
             cxn, IND_CXN_EVENT_PRIORITY);
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+        if (CXN_TLS(cxn) && ind_cxn_tls_start(cxn) < 0) {
+            LOG_ERROR(cxn, "Could not start TLS");
+            cxn_state_set(cxn, INDIGO_CXN_S_CLOSING);
+            break;
+        }
+#endif
         ind_cxn_send_hello(cxn);
         if (CXN_LOCAL(cxn)) {
             /* Recursive call; transition to connected */
@@ -396,13 +492,17 @@ cxn_state_set(connection_t *cxn, indigo_cxn_state_t new_state)
             cxn_closing_timeout, (void *)cxn,
             CXN_STATE_TIMEOUT(new_state), IND_CXN_EVENT_PRIORITY);
         cleanup_disconnect(cxn);
+        if (!CXN_AUXILIARY(cxn)) {
+            ind_cxn_auxiliaries_disconnect(cxn);
+        }
         break;
     case INDIGO_CXN_S_HANDSHAKE_COMPLETE:
+        cxn->fail_count = 0;
         if (cxn->keepalive.period_ms > 0) {
             /* Set up periodic echo request */
             ind_soc_timer_event_register_with_priority(
                 periodic_keepalive, (void *)cxn,
-                cxn->keepalive.period_ms, IND_CXN_EVENT_PRIORITY);
+                cxn->keepalive.period_ms, IND_CXN_KEEPALIVE_PRIORITY);
         }
 
         break;
@@ -460,6 +560,9 @@ check_for_hello(connection_t *cxn, of_object_t *obj)
  *
  * Any time a message is received from the controller, the timer for
  * this function should be reset and the outstanding count set to 0.
+ *
+ * The timer runs above IND_CXN_EVENT_PRIORITY and the request goes out
+ * on the echo output class, so a busy connection still sends it on time.
  */
 
 static void
@@ -477,6 +580,11 @@ periodic_keepalive(void *cookie)
         return;
     }
 
+    /* A full read buffer hides replies still in the socket */
+    if (cxn->read_bytes == READ_BUFFER_SIZE) {
+        cxn->keepalive.outstanding_echo_cnt = 0;
+    }
+
     if (cxn->keepalive.outstanding_echo_cnt > cxn->keepalive.threshold) {
         LOG_INFO(cxn, "Exceeded outstanding echo requests.  Resetting cxn");
         ind_cxn_disconnect(cxn);
@@ -519,13 +627,12 @@ send_barrier_reply(connection_t *cxn)
 }
 
 /**
- * Handle an echo request
+ * Reply to an echo request
  */
 
 static indigo_error_t
-echo_request_handle(connection_t *cxn, of_object_t *_obj)
+echo_reply_send(connection_t *cxn, of_echo_request_t *echo)
 {
-    of_echo_request_t *echo = _obj;
     of_echo_reply_t *reply = NULL;
     of_octets_t data;
     uint32_t xid;
@@ -552,6 +659,23 @@ echo_request_handle(connection_t *cxn, of_object_t *_obj)
     return INDIGO_ERROR_NONE;
 }
 
+/**
+ * Handle an echo request
+ *
+ * Requests that echo_peek found in the read buffer were answered then.
+ */
+
+static indigo_error_t
+echo_request_handle(connection_t *cxn, of_object_t *_obj)
+{
+    if (cxn->echo_answered_early > 0) {
+        cxn->echo_answered_early--;
+        return INDIGO_ERROR_NONE;
+    }
+
+    return echo_reply_send(cxn, _obj);
+}
+
 /**
  * Handle an echo reply
  */
@@ -589,6 +713,17 @@ barrier_request_handle(connection_t *cxn, of_object_t *_obj)
     of_barrier_request_xid_get(obj, &cxn->barrier.xid);
     LOG_TRACE(cxn, "Got barrier req with xid %u", cxn->barrier.xid);
 
+    /*
+     * Program deferred flow adds; their tracked copies are released as
+     * they complete. A pipelined connection leaves them to finish in the
+     * background and the outstanding op count holds the reply.
+     */
+    if (cxn->config_params.pipelined) {
+        indigo_fwd_pending_submit();
+    } else {
+        indigo_fwd_pending_flush();
+    }
+
     /* No outstanding operations; send reply immediately */
     if (cxn->outstanding_op_cnt == 0)  {
         return (send_barrier_reply(cxn));
@@ -671,7 +806,7 @@ nicira_controller_role_request_handle(connection_t *cxn, of_object_t *_obj)
             ind_cxn_change_master(cxn->cxn_id);
         } else {
             LOG_INFO(cxn, "Setting role to %s", role_to_string(role));
-            cxn->status.role = role;
+            ind_cxn_role_set(cxn, role);
         }
     }
 
@@ -761,7 +896,7 @@ role_request_handle(connection_t *cxn, of_object_t *_obj)
                 ind_cxn_change_master(cxn->cxn_id);
             } else {
                 LOG_INFO(cxn, "Setting role to %s", role_to_string(role));
-                cxn->status.role = role;
+                ind_cxn_role_set(cxn, role);
             }
         }
     }
@@ -842,6 +977,8 @@ cxn_object_delete_cb(of_object_t *obj)
 {
     connection_t *cxn;
 
+    indigo_mem_budget_release(INDIGO_MEM_BUDGET_REQUEST, obj->length);
+
     cxn = cookie_to_cxn(obj->track_info.delete_cookie);
     if (cxn == NULL) {
         NO_CXN_LOG_VERBOSE("Connection invalid, "
@@ -853,6 +990,8 @@ cxn_object_delete_cb(of_object_t *obj)
     LOG_TRACE(cxn, "Delete message object %p of type %s",
               obj, of_object_id_str[obj->object_id]);
 
+    ind_cxn_latency_object_delete(cxn, obj);
+
     INDIGO_ASSERT(cxn->outstanding_op_cnt > 0);
     cxn->outstanding_op_cnt -= 1;
 
@@ -868,6 +1007,14 @@ cxn_object_delete_cb(of_object_t *obj)
             send_barrier_reply(cxn);
             cxn->barrier.pendingf = 0;
             (void)ind_soc_data_in_resume(cxn->sd);
+            /* Messages that arrived behind the barrier are already buffered */
+            if (cxn->read_bytes > cxn->read_offset
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+                || ind_cxn_tls_pending(cxn) > 0
+#endif
+                ) {
+                read_continue_schedule(cxn);
+            }
         }
     }
 }
@@ -889,6 +1036,65 @@ cxn_message_track_setup(connection_t *cxn, of_object_t *obj)
     obj->track_info.delete_cb = cxn_object_delete_cb;
     obj->track_info.delete_cookie = cxn_to_cookie(cxn);
     cxn->outstanding_op_cnt++;
+    indigo_mem_budget_charge(INDIGO_MEM_BUDGET_REQUEST, obj->length);
+    ind_cxn_latency_defer(cxn, obj);
+}
+
+
+/**
+ * Take ownership of a message being handled
+ *
+ * @param cxn The connection the message arrived on
+ * @param obj The message passed to the handler
+ * @returns A heap object with the same contents, or NULL on allocation failure
+ *
+ * When the message is the only one in the read buffer the buffer itself
+ * is handed over, trimmed to the message, and the connection reads into
+ * a new one; this is the usual case for a lone flow mod or stats request.
+ * Otherwise the message is copied with of_object_dup.
+ *
+ * In both cases obj stays valid for the rest of the handler, and in the
+ * first for as long as the returned object.
+ */
+
+of_object_t *
+cxn_message_claim(connection_t *cxn, of_object_t *obj)
+{
+    of_object_t *claimed;
+    uint8_t *buf;
+
+    if (obj != cxn->dispatch_obj ||
+        OF_OBJECT_BUFFER_INDEX(obj, 0) != cxn->read_buffer ||
+        obj->length != cxn->read_bytes) {
+        return of_object_dup(obj);
+    }
+
+    if ((claimed = of_object_new(-1)) == NULL) {
+        return NULL;
+    }
+
+    if (of_object_buffer_bind(claimed, cxn->read_buffer, obj->length,
+                              aim_free) < 0) {
+        of_object_delete(claimed);
+        return of_object_dup(obj);
+    }
+
+    /* Shrinking does not fail; repoint both objects in case it moved */
+    buf = aim_realloc(cxn->read_buffer, obj->length);
+    claimed->wire_object.wbuf->buf = buf;
+    obj->wire_object.wbuf->buf = buf;
+
+    claimed->version = obj->version;
+    of_object_init_map[obj->object_id](claimed, obj->version, obj->length, 0);
+
+    cxn->read_buffer = aim_malloc(READ_BUFFER_SIZE);
+    cxn->read_bytes = 0;
+    cxn->read_offset = 0;
+    cxn->echo_peek_offset = 0;
+    cxn->dispatch_obj = NULL;
+    cxn->messages_in_claimed++;
+
+    return claimed;
 }
 
 
@@ -900,8 +1106,8 @@ cxn_message_track_setup(connection_t *cxn, of_object_t *obj)
  *
  * Handle echo request, echo reply and barrier request locally
  */
-static void
-of_msg_process(connection_t *cxn, of_object_t *obj)
+void
+ind_cxn_msg_process(connection_t *cxn, of_object_t *obj)
 {
     /* Note that the messages handled in cxn_instance are not tracked */
     switch (obj->object_id) {
@@ -933,6 +1139,12 @@ of_msg_process(connection_t *cxn, of_object_t *obj)
         bsn_controller_connections_request_handle(cxn, obj);
         return;
 
+    case OF_EXPERIMENTER:
+        if (ind_cxn_bundle_handle(cxn, obj)) {
+            return;
+        }
+        break;
+
     /* Check permissions and fall through */
     case OF_FLOW_ADD:
     case OF_FLOW_DELETE:
@@ -969,10 +1181,11 @@ of_msg_process(connection_t *cxn, of_object_t *obj)
 #define IS_MSG_OBJ(obj) \
     ((obj)->object_id >= 0 && (obj)->object_id < OF_MESSAGE_OBJECT_COUNT)
 
-#define READING_HEADER(cxn) (((cxn)->read_bytes) < OF_MESSAGE_HEADER_LENGTH)
-
 /**
- * Read from the cxn, up to cxn->bytes_needed bytes; update bytes needed
+ * Read from the cxn into the free space at the end of the read buffer
+ *
+ * Already-processed bytes at the front of the buffer are discarded first
+ * so a single read can pull in as many queued messages as fit.
  *
  * Return number of bytes read if no error
  * Return < 0, error number, if error.
@@ -988,8 +1201,38 @@ read_from_cxn(connection_t *cxn)
     ssize_t bytes_in;
     uint8_t *inbuf_start;
 
+    if (cxn->read_offset > 0) {
+        memmove(cxn->read_buffer, &cxn->read_buffer[cxn->read_offset],
+                cxn->read_bytes - cxn->read_offset);
+        cxn->read_bytes -= cxn->read_offset;
+        cxn->echo_peek_offset = aim_imax(cxn->echo_peek_offset - cxn->read_offset, 0);
+        cxn->read_offset = 0;
+    }
+
+    /* Buffer holds a full message already; leave the rest in the socket */
+    if (cxn->read_bytes == READ_BUFFER_SIZE) {
+        return 0;
+    }
+
+    /* A datagram is truncated to the space left, so only read into an empty buffer */
+    if (CXN_UDP(cxn) && cxn->read_bytes > 0) {
+        return 0;
+    }
+
     inbuf_start = &cxn->read_buffer[cxn->read_bytes];
-    bytes_in = read(cxn->sd, inbuf_start, cxn->bytes_needed);
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    if (cxn->tls != NULL) {
+        bytes_in = ind_cxn_tls_read(cxn, inbuf_start,
+                                    READ_BUFFER_SIZE - cxn->read_bytes);
+        if (bytes_in <= 0) {
+            return bytes_in;
+        }
+        goto done;
+    }
+#endif
+
+    bytes_in = read(cxn->sd, inbuf_start, READ_BUFFER_SIZE - cxn->read_bytes);
 
     /*
      * Reading 0 bytes indicates connection has closed, although we allow
@@ -997,6 +1240,10 @@ read_from_cxn(connection_t *cxn)
      */
 
     if (bytes_in <= 0) {
+        if (bytes_in == 0 && CXN_UDP(cxn)) { /* Empty datagram */
+            return 0;
+        }
+
         if (bytes_in == 0) { /* Socket is closed */
             LOG_INFO(cxn, "Connection closed by remote host");
             return INDIGO_ERROR_CONNECTION;
@@ -1012,81 +1259,53 @@ read_from_cxn(connection_t *cxn)
         return INDIGO_ERROR_CONNECTION;
     }
 
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+ done:
+#endif
     cxn->status.bytes_in += bytes_in;
 #if defined(DUMP_OBJECTS_AND_DATA)
-    cxn_data_hexdump(&cxn->read_buffer[cxn->read_bytes], bytes_in);
+    cxn_data_hexdump(inbuf_start, bytes_in);
 #endif
 
-    INDIGO_ASSERT((int)bytes_in <= cxn->bytes_needed);
     cxn->read_bytes += bytes_in;
-    cxn->bytes_needed -= bytes_in;
 
     return bytes_in;
 }
 
 /**
- * Try to read a full message from the connnection
+ * Find the next complete message in the read buffer
  *
- * @returns INDIGO_ERROR_NONE if message is ready
- * @returns INDIGO_ERROR_PENDING if message is not ready
- * @returns INDIGO_ERROR_CONNECTION if a read error has occurred
- * @returns INDIGO_ERROR_PROTOCOL if the data stream has illegal values
+ * @param cxn The connection
+ * @param msg_bytes [out] Length of the message at read_offset
  *
- * If INDIGO_ERROR_NONE is returned, a message is ready to be processed
- * in the connection's read buffer.
+ * @returns INDIGO_ERROR_NONE if a full message is buffered
+ * @returns INDIGO_ERROR_PENDING if more bytes are needed
+ * @returns INDIGO_ERROR_PROTOCOL if the data stream has illegal values
  */
 
 static inline int
-read_message(connection_t *cxn)
+next_message(connection_t *cxn, int *msg_bytes)
 {
-    of_message_t msg = NULL;
-    int msg_bytes;
-    int rv = INDIGO_ERROR_NONE;
+    int avail = cxn->read_bytes - cxn->read_offset;
 
-    /* No bytes needed; must be stuck. */
-    if (cxn->bytes_needed == 0) {
-        LOG_TRACE(cxn, "Processing appears to be blocked");
+    if (avail < OF_MESSAGE_HEADER_LENGTH) {
         return INDIGO_ERROR_PENDING;
     }
 
-    if (READING_HEADER(cxn)) {
-        INDIGO_ASSERT(cxn->bytes_needed + cxn->read_bytes ==
-                      OF_MESSAGE_HEADER_LENGTH);
-        if ((rv = read_from_cxn(cxn)) < 0) {
-            return rv;
-        }
-
-        if (cxn->bytes_needed != 0) {
-            LOG_TRACE(cxn, "Still need %d bytes for msg hdr",
-                      cxn->bytes_needed);
-            return INDIGO_ERROR_PENDING;
-        }
-
-        msg = (of_message_t)(cxn->read_buffer);
-        msg_bytes = of_message_length_get(msg);
-        if (msg_bytes < OF_MESSAGE_HEADER_LENGTH) {
-            LOG_TRACE(cxn, "Illegal msg length %d. Framing error?", msg_bytes);
-            ++ind_cxn_internal_errors;
-            return INDIGO_ERROR_PROTOCOL;
-        }
-        cxn->bytes_needed = msg_bytes - OF_MESSAGE_HEADER_LENGTH;
-    }
-
-    /* Check if the message only needed the header */
-    if (cxn->bytes_needed == 0) {
-        return INDIGO_ERROR_NONE;
+    *msg_bytes = of_message_length_get(
+        (of_message_t)&cxn->read_buffer[cxn->read_offset]);
+    if (*msg_bytes < OF_MESSAGE_HEADER_LENGTH) {
+        LOG_TRACE(cxn, "Illegal msg length %d. Framing error?", *msg_bytes);
+        ++ind_cxn_internal_errors;
+        return INDIGO_ERROR_PROTOCOL;
     }
 
-    /* Read the rest of the message; return if error */
-    if ((rv = read_from_cxn(cxn)) < 0) {
-        return rv;
-    }
-    if (cxn->bytes_needed == 0) { /* Read full message, return ready */
-        return INDIGO_ERROR_NONE;
+    if (avail < *msg_bytes) {
+        LOG_TRACE(cxn, "Still need %d bytes for msg", *msg_bytes - avail);
+        return INDIGO_ERROR_PENDING;
     }
 
-    /* Still need more bytes; return pending */
-    return INDIGO_ERROR_PENDING;
+    return INDIGO_ERROR_NONE;
 }
 
 /**
@@ -1095,8 +1314,8 @@ read_message(connection_t *cxn)
  * This is trickier than usual because we can't trust the message
  * (it failed validation).
  */
-static void
-send_parse_error_message(connection_t *cxn, uint8_t *buf, int len)
+void
+ind_cxn_parse_error_send(connection_t *cxn, uint8_t *buf, int len)
 {
     of_object_t *error_msg;
     uint32_t xid;
@@ -1140,38 +1359,48 @@ send_parse_error_message(connection_t *cxn, uint8_t *buf, int len)
 /**
  * Process a message from the read buffer
  *
- * The read buffer must have a valid message in it to be processed
+ * @param buf Start of a complete message in the read buffer
+ * @param len Length of the message
  *
  * The LOCI object is created on the stack and points directly to the read
  * buffer, so its lifetime is limited to this stack frame. Message handlers
- * that need to keep it around for longer must copy it with of_object_dup.
+ * that need to keep it around for longer must take it with
+ * indigo_cxn_message_claim.
+ *
+ * On trusted connections the hot message types only get header and length
+ * checks here; a handler that then fails to decode one reports it through
+ * indigo_cxn_message_parse_error.
  */
 
 static inline void
-process_message(connection_t *cxn)
+process_message(connection_t *cxn, uint8_t *buf, int len)
 {
-    of_object_t *obj;
-    int len;
+    of_object_t *obj = NULL;
     int rv;
     of_object_storage_t obj_storage;
+    uint64_t start_us = ind_cxn_latency_now_us();
+    uint64_t end_us;
+    uint32_t xid;
 
-    /* Clear read buffer for next read */
-    len = cxn->read_bytes;
-    cxn->read_bytes = 0;
-    cxn->bytes_needed = OF_MESSAGE_HEADER_LENGTH;
+    if (cxn->config_params.trusted) {
+        obj = of_object_new_from_message_preallocated_light(&obj_storage,
+                                                            buf, len);
+        if (obj != NULL) {
+            cxn->messages_in_unvalidated++;
+        }
+    }
 
-    obj = of_object_new_from_message_preallocated(&obj_storage, cxn->read_buffer, len);
+    if (obj == NULL) {
+        obj = of_object_new_from_message_preallocated(&obj_storage, buf, len);
+    }
     if (obj == NULL) {
         LOG_ERROR(cxn, "Could not parse msg to OF object, len %d", len);
-        send_parse_error_message(cxn, cxn->read_buffer, len);
+        ind_cxn_parse_error_send(cxn, buf, len);
         return;
     }
 
-    if(cxn->trace_pvs) {
-        aim_printf(cxn->trace_pvs, "** of_msg_trace: received from cxn %s\n",
-                   cxn_ip_string(cxn));
-        of_object_dump((loci_writer_f)aim_printf, cxn->trace_pvs, obj);
-        aim_printf(cxn->trace_pvs, "**\n\n");
+    if (CXN_TRACED(cxn, obj->object_id)) {
+        ind_cxn_trace_record(cxn, CXN_TRACE_IN, buf, len);
     }
 
     if (CXN_HANDSHAKE_COMPLETE(cxn)) {
@@ -1182,15 +1411,16 @@ process_message(connection_t *cxn)
         if (cxn->keepalive.period_ms > 0) {
             ind_soc_timer_event_register_with_priority(
                 periodic_keepalive, (void *)cxn,
-                cxn->keepalive.period_ms, IND_CXN_EVENT_PRIORITY);
+                cxn->keepalive.period_ms, IND_CXN_KEEPALIVE_PRIORITY);
         }
 #endif
 
     }
 
+    xid = of_message_xid_get(OF_BUFFER_TO_MESSAGE(
+        OF_OBJECT_BUFFER_INDEX(obj, 0)));
+
     {       /***** Debug info about message *****/
-        uint32_t xid = of_message_xid_get(OF_BUFFER_TO_MESSAGE(
-            OF_OBJECT_BUFFER_INDEX(obj, 0)));
         LOG_VERBOSE(cxn, "Received %s message xid %u",
                     of_object_id_str[obj->object_id], xid);
         LOG_OBJECT(obj);
@@ -1212,27 +1442,274 @@ process_message(connection_t *cxn)
         }
     } else {
         /* Process received message */
-        of_msg_process(cxn, obj);
+        of_object_id_t object_id = obj->object_id;
+        cxn->latency.start_us = start_us;
+        ind_cxn_flight_handler_start();
+        cxn->dispatch_obj = obj;
+        ind_cxn_msg_process(cxn, obj);
+        cxn->dispatch_obj = NULL;
+        end_us = ind_cxn_latency_now_us();
+        ind_cxn_latency_handler_done(cxn, object_id, end_us);
+        ind_cxn_flight_msg(cxn, object_id, xid, start_us, end_us);
+    }
+}
+
+/**
+ * Start a turn of message processing by refilling the read quota
+ */
+
+static void
+read_quota_refill(connection_t *cxn)
+{
+    uint32_t weight = cxn->config_params.weight;
+    int quota;
+
+    if (weight == 0) {
+        weight = 1;
+    } else if (weight > CXN_WEIGHT_MAX) {
+        weight = CXN_WEIGHT_MAX;
+    }
+
+    quota = weight * CXN_READ_QUANTUM;
+    if (cxn->status.role == INDIGO_CXN_R_SLAVE) {
+        quota /= CXN_SLAVE_WEIGHT_DIVISOR;
+    }
+
+    cxn->read_quota = quota > 0 ? quota : 1;
+}
+
+/**
+ * Process every complete message in the read buffer
+ *
+ * Stops early if the socket manager wants the event loop back, if the
+ * connection used up its read quota, if a barrier paused input, or if a
+ * handler closed the connection. Whatever is left stays buffered;
+ * read_continue_schedule picks it up later since the socket will not
+ * poll readable for bytes we already consumed.
+ *
+ * @returns INDIGO_ERROR_NONE if no framing error
+ * @returns INDIGO_ERROR_PROTOCOL if the data stream has illegal values
+ */
+
+static int
+process_buffered_messages(connection_t *cxn)
+{
+    uint32_t generation_id = cxn->generation_id;
+    int msg_bytes;
+    int rv;
+
+    while ((rv = next_message(cxn, &msg_bytes)) == INDIGO_ERROR_NONE) {
+        uint8_t *buf = &cxn->read_buffer[cxn->read_offset];
+
+        cxn->read_offset += msg_bytes;
+        process_message(cxn, buf, msg_bytes);
+
+        if (cxn->generation_id != generation_id || !CXN_TCP_CONNECTED(cxn)) {
+            return INDIGO_ERROR_NONE;
+        }
+
+        if (cxn->barrier.pendingf) {
+            /* Resumed from cxn_object_delete_cb */
+            return INDIGO_ERROR_NONE;
+        }
+
+        if (--cxn->read_quota <= 0 || ind_soc_should_yield()) {
+            if (next_message(cxn, &msg_bytes) == INDIGO_ERROR_NONE) {
+                if (cxn->read_quota <= 0) {
+                    cxn->read_quota_yields++;
+                }
+                read_continue_schedule(cxn);
+            }
+            return INDIGO_ERROR_NONE;
+        }
+    }
+
+    if (rv == INDIGO_ERROR_PENDING) {
+        /* Messages do not span datagrams; a partial one is dropped */
+        if (CXN_UDP(cxn) && cxn->read_offset < cxn->read_bytes) {
+            LOG_INFO(cxn, "Dropping %d bytes of a truncated message",
+                     cxn->read_bytes - cxn->read_offset);
+            cxn->read_offset = cxn->read_bytes;
+        }
+
+        /* Nothing left to parse; rewind so the next read uses the whole buffer */
+        if (cxn->read_offset == cxn->read_bytes) {
+            cxn->read_offset = 0;
+            cxn->read_bytes = 0;
+            cxn->echo_peek_offset = 0;
+        }
+        return INDIGO_ERROR_NONE;
+    }
+
+    return rv;
+}
+
+/**
+ * Task to process messages left in the read buffer
+ *
+ * Tasks run in the order they were registered, so connections that
+ * yielded take turns at the leftovers round robin.
+ */
+
+static ind_soc_task_status_t
+read_continue_task(void *cookie)
+{
+    connection_t *cxn = cookie;
+
+    cxn->read_task_pending = 0;
+
+    if (!CXN_TCP_CONNECTED(cxn) || cxn->barrier.pendingf) {
+        return IND_SOC_TASK_FINISHED;
+    }
+
+    read_quota_refill(cxn);
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    /* Decrypted data held by OpenSSL needs a read, not just processing */
+    if (ind_cxn_tls_pending(cxn) > 0) {
+        if (ind_cxn_process_read_buffer(cxn) < 0) {
+            LOG_VERBOSE(cxn, "Error processing read buffer, resetting");
+            ind_cxn_disconnect(cxn);
+        }
+        return IND_SOC_TASK_FINISHED;
+    }
+#endif
+
+    if (process_buffered_messages(cxn) < 0) {
+        LOG_VERBOSE(cxn, "Error processing read buffer, resetting");
+        ind_cxn_disconnect(cxn);
+    }
+
+    return IND_SOC_TASK_FINISHED;
+}
+
+static void
+read_continue_schedule(connection_t *cxn)
+{
+    if (cxn->read_task_pending) {
+        return;
+    }
+
+    if (ind_soc_task_register(read_continue_task, cxn,
+                              IND_CXN_EVENT_PRIORITY) < 0) {
+        LOG_ERROR(cxn, "Failed to schedule read buffer processing");
+        return;
+    }
+
+    cxn->read_task_pending = 1;
+}
+
+/**
+ * Answer echo requests waiting in the read buffer
+ *
+ * Runs after each read, ahead of the messages queued for processing, so
+ * a connection with a backlog of flow mods or stuck at a barrier still
+ * answers the controller's keepalives in time. Replies go out on the echo
+ * output class. Echo replies are handled here too, so our own keepalive
+ * does not time out behind the backlog. Each message is checked once;
+ * echo_request_handle skips the requests answered here when their turn
+ * comes.
+ */
+
+static void
+echo_peek(connection_t *cxn)
+{
+    of_object_storage_t obj_storage;
+    of_object_t *obj;
+    uint8_t *buf;
+    int offset = aim_imax(cxn->echo_peek_offset, cxn->read_offset);
+    int len;
+
+    if (!CXN_HANDSHAKE_COMPLETE(cxn)) {
+        return;
     }
+
+    while (cxn->read_bytes - offset >= OF_MESSAGE_HEADER_LENGTH) {
+        buf = &cxn->read_buffer[offset];
+        len = of_message_length_get(buf);
+        if (len < OF_MESSAGE_HEADER_LENGTH || cxn->read_bytes - offset < len) {
+            /* Partial message; framing errors are left to processing */
+            break;
+        }
+        offset += len;
+
+        switch (of_message_type_get(buf)) {
+        case OF_OBJ_TYPE_ECHO_REQUEST:
+            obj = of_object_new_from_message_preallocated(&obj_storage,
+                                                          buf, len);
+            if (obj != NULL && obj->object_id == OF_ECHO_REQUEST &&
+                echo_reply_send(cxn, obj) == INDIGO_ERROR_NONE) {
+                cxn->echo_answered_early++;
+                cxn->echo_requests_early++;
+            }
+            break;
+        case OF_OBJ_TYPE_ECHO_REPLY:
+            obj = of_object_new_from_message_preallocated(&obj_storage,
+                                                          buf, len);
+            if (obj != NULL && obj->object_id == OF_ECHO_REPLY) {
+                echo_reply_handle(cxn, obj);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    cxn->echo_peek_offset = offset;
 }
 
 /**
  * Process the connection socket for reading
  *
+ * Reads as much as the read buffer can hold and then processes the
+ * complete messages in it, up to the connection's read quota, so a
+ * burst from the controller is handled with one syscall rather than two
+ * per message.
+ *
+ * A connection that already has a turn queued in read_continue_task
+ * is only read into the free space of its buffer, for echo_peek, until
+ * that turn runs; otherwise the connection polled first would be served
+ * twice per loop while others wait.
+ *
  * @returns INDIGO_ERROR_NONE if no socket error
  * @returns INDIGO_ERROR_CONNECTION if socket error
+ * @returns INDIGO_ERROR_PROTOCOL if the data stream has illegal values
  */
 
 int
 ind_cxn_process_read_buffer(connection_t *cxn)
 {
-    int rv = INDIGO_ERROR_NONE;
+    int rv;
 
-    if ((rv = read_message(cxn)) == INDIGO_ERROR_NONE) {
-        process_message(cxn);
+    if ((rv = read_from_cxn(cxn)) < 0) {
+        return rv;
     }
 
-    return rv;
+    echo_peek(cxn);
+
+    if (cxn->read_task_pending) {
+        return INDIGO_ERROR_NONE;
+    }
+
+    read_quota_refill(cxn);
+
+    if (cxn->barrier.pendingf) {
+        return INDIGO_ERROR_NONE;
+    }
+
+    if ((rv = process_buffered_messages(cxn)) < 0) {
+        return rv;
+    }
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    /* poll() won't report data already decrypted by OpenSSL */
+    if (CXN_TCP_CONNECTED(cxn) && !cxn->barrier.pendingf &&
+        ind_cxn_tls_pending(cxn) > 0) {
+        read_continue_schedule(cxn);
+    }
+#endif
+
+    return INDIGO_ERROR_NONE;
 }
 
 /**
@@ -1288,80 +1765,246 @@ write_chunk(connection_t *cxn, uint8_t *start, ssize_t bytes)
     return bytes_out;
 }
 
+/**
+ * Send each message as its own datagram
+ *
+ * A datagram goes out whole or not at all, so the caller's accounting of
+ * fully sent messages still holds. A message too big for a datagram is
+ * counted as sent and lost, as UDP would lose it anyway.
+ *
+ * @returns The number of bytes consumed or an error code
+ */
+static int
+write_datagrams(connection_t *cxn, struct iovec *iovecs, int num_iovecs)
+{
+    int written = 0;
+    int i;
+
+    for (i = 0; i < num_iovecs; i++) {
+        if (send(cxn->sd, iovecs[i].iov_base, iovecs[i].iov_len,
+                 MSG_NOSIGNAL) < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                break;
+            } else if (errno == EMSGSIZE) {
+                LOG_ERROR(cxn, "Dropping %d byte message, too big for a datagram",
+                          (int)iovecs[i].iov_len);
+            } else {
+                LOG_ERROR(cxn, "Error writing to socket: %s", strerror(errno));
+                return INDIGO_ERROR_UNKNOWN;
+            }
+        }
+        written += iovecs[i].iov_len;
+    }
+
+    return written;
+}
+
+/**
+ * The messages offered to one write
+ *
+ * Only one write is built at a time, so a single static batch is used.
+ */
+typedef struct write_batch_s {
+    struct iovec iovecs[IOV_MAX];
+    int num_iovecs;
+    uint8_t msg_class[MAX_WRITE_BATCH_MSGS]; /* Per message, in send order */
+    int msg_len[MAX_WRITE_BATCH_MSGS];
+    int num_msgs;
+    int slab_iovec;     /* Iovec covering the end of the slab, or -1 */
+    int slab_used;
+    uint8_t slab[WRITE_SLAB_SIZE];
+} write_batch_t;
+
+static write_batch_t write_batch;
+
+/**
+ * Add a message to the write batch
+ *
+ * A small message is copied to the slab and merged into the previous
+ * iovec when that one also ends in the slab; anything else is sent in
+ * place with its own iovec.
+ *
+ * @returns 1 if added, 0 if the batch is full
+ */
+static int
+write_batch_add(write_batch_t *b, uint8_t *data, int len,
+                int output_class, int coalesce)
+{
+    struct iovec *iov;
+
+    if (coalesce && len <= WRITE_COALESCE_MAX &&
+        b->slab_used + len <= WRITE_SLAB_SIZE) {
+        if (b->slab_iovec < 0 || b->slab_iovec != b->num_iovecs - 1) {
+            if (b->num_iovecs == IOV_MAX) {
+                return 0;
+            }
+            b->slab_iovec = b->num_iovecs++;
+            iov = &b->iovecs[b->slab_iovec];
+            iov->iov_base = &b->slab[b->slab_used];
+            iov->iov_len = 0;
+        }
+        memcpy(&b->slab[b->slab_used], data, len);
+        b->iovecs[b->slab_iovec].iov_len += len;
+        b->slab_used += len;
+    } else {
+        if (b->num_iovecs == IOV_MAX) {
+            return 0;
+        }
+        iov = &b->iovecs[b->num_iovecs++];
+        iov->iov_base = data;
+        iov->iov_len = len;
+    }
+
+    b->msg_class[b->num_msgs] = output_class;
+    b->msg_len[b->num_msgs] = len;
+    b->num_msgs++;
+
+    return 1;
+}
+
 /**
  * Process messages waiting to be sent to a connection socket
  *
+ * Plain TCP connections coalesce small messages; see write_batch_add.
+ * When the batch could not take everything queued, it goes out with
+ * MSG_MORE so the kernel fills segments as if the socket were corked
+ * until the last batch of the burst. TLS and UDP send message by
+ * message, MAX_WRITE_MSGS at a time, since a TLS write retry must offer
+ * the same buffer and a datagram carries a single message.
+ *
  * @returns The number of bytes written or an error code
  */
 
 int
 ind_cxn_process_write_buffer(connection_t *cxn)
 {
+    write_batch_t *b = &write_batch;
     int written, left;
-    int num_iovecs = 0;
-    struct iovec iovecs[MAX_WRITE_MSGS];
-    biglist_t *cur_node;
-    struct iovec *iov;
+    int blocked = -1;
+    int coalesce = !CXN_UDP(cxn);
+    int max_msgs;
+    int more = 0;
+    int c, i;
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    if (cxn->tls != NULL) {
+        coalesce = 0;
+    }
+#endif
+    max_msgs = coalesce ? MAX_WRITE_BATCH_MSGS : MAX_WRITE_MSGS;
+
+    b->num_iovecs = 0;
+    b->num_msgs = 0;
+    b->slab_iovec = -1;
+    b->slab_used = 0;
+
+    /* A partially sent message must go out first to keep the stream framed */
+    if (cxn->output_head_class >= 0) {
+        cxn_output_msg_t *msg = OUTPUT_QUEUE_MSG(
+            &cxn->output_queues[cxn->output_head_class], 0);
+        write_batch_add(b, msg->data + cxn->output_head_offset,
+                        msg->len - cxn->output_head_offset,
+                        cxn->output_head_class, coalesce);
+    }
 
-    /* Iterate over cxn->output_list adding buffers to iovecs */
-    cur_node = cxn->output_list;
-    while (cur_node != NULL && num_iovecs < MAX_WRITE_MSGS) {
-        iov = &iovecs[num_iovecs];
-        iov->iov_base = BIGLIST_CAST(void *, cur_node);
-        iov->iov_len = of_message_length_get(iov->iov_base);
-        if (num_iovecs == 0) {
-            /* First buffer may be partially written */
-            iov->iov_base += cxn->output_head_offset;
-            iov->iov_len -= cxn->output_head_offset;
+    /* Add the queued messages to the batch, by class, oldest first */
+    for (c = 0; c < CXN_OUTPUT_CLASS_COUNT && !more; c++) {
+        cxn_output_queue_t *q = &cxn->output_queues[c];
+        i = (c == cxn->output_head_class) ? 1 : 0;
+        for (; i < q->count; i++) {
+            cxn_output_msg_t *msg = OUTPUT_QUEUE_MSG(q, i);
+            if (b->num_msgs == max_msgs ||
+                !write_batch_add(b, msg->data, msg->len, c, coalesce)) {
+                more = 1;
+                break;
+            }
         }
-        num_iovecs++;
-        cur_node = biglist_next(cur_node);
     }
 
-    written = writev(cxn->sd, iovecs, num_iovecs);
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    if (cxn->tls != NULL) {
+        written = ind_cxn_tls_writev(cxn, b->iovecs, b->num_iovecs, &blocked);
+        if (written < 0) {
+            return written;
+        }
+    } else
+#endif
+    if (CXN_UDP(cxn)) {
+        written = write_datagrams(cxn, b->iovecs, b->num_iovecs);
+        if (written < 0) {
+            return written;
+        }
+    } else {
+        struct msghdr mh = {
+            .msg_iov = b->iovecs,
+            .msg_iovlen = b->num_iovecs,
+        };
 
-    if (written < 0) {
-        /* Error writing to connection socket */
-        LOG_ERROR(cxn, "Error writing to socket: %s", strerror(errno));
-        return INDIGO_ERROR_UNKNOWN;
+        written = sendmsg(cxn->sd, &mh, MSG_NOSIGNAL | (more ? MSG_MORE : 0));
+
+        if (written < 0) {
+            /* Error writing to connection socket */
+            LOG_ERROR(cxn, "Error writing to socket: %s", strerror(errno));
+            return INDIGO_ERROR_UNKNOWN;
+        }
     }
 
+    cxn->status.bytes_out += written;
+
     /*
-     * Iterate over cxn->output_list and iovecs together, freeing completely
-     * sent messages.
+     * Walk the batch, freeing completely sent messages. Each message was
+     * taken from the head of its class queue at the time, so popping the
+     * heads in batch order matches.
      */
     left = written;
-    iov = iovecs;
-    while (left > 0) {
+    for (i = 0; left > 0; i++) {
         int to_write, bytes_out;
-        cur_node = cxn->output_list;
+        cxn_output_queue_t *q = &cxn->output_queues[b->msg_class[i]];
+        cxn_output_msg_t *msg = OUTPUT_QUEUE_MSG(q, 0);
 
         /* Number of bytes we attempted to send in this message */
-        to_write = iov->iov_len;
+        to_write = b->msg_len[i];
 
         /* Number of bytes we actually sent in this message */
         bytes_out = aim_imin(left, to_write);
         cxn->bytes_enqueued -= bytes_out;
+        indigo_mem_budget_release(INDIGO_MEM_BUDGET_OUTPUT, bytes_out);
 
         if (bytes_out == to_write) { /* Completed this message */
-            aim_free(BIGLIST_CAST(void *, cur_node));
-            cxn->output_list =
-                biglist_remove_link_free(cxn->output_list, cur_node);
+            output_msg_free(msg);
+            q->head = (q->head + 1) & (q->size - 1);
+            q->count--;
             cxn->pkts_enqueued--;
             cxn->status.messages_out++;
+            cxn->output_head_class = -1;
             cxn->output_head_offset = 0;
         } else {
             /* Partial write */
             INDIGO_ASSERT(bytes_out < to_write);
+            cxn->output_head_class = b->msg_class[i];
             cxn->output_head_offset += bytes_out;
             break;
         }
 
         left -= bytes_out;
-        iov++;
     }
 
-    if (cxn->output_list == NULL) { /* Nothing (more) to send */
+    /* A TLS write retry must offer the same message again, so pin it */
+    if (blocked >= 0 && cxn->output_head_class < 0) {
+        cxn->output_head_class = b->msg_class[blocked];
+    }
+
+    if (cxn->output_waiter_count > 0 &&
+        cxn->bytes_enqueued <= CXN_OUTPUT_LOW_WATERMARK) {
+        ind_cxn_output_waiters_run(cxn);
+    }
+
+    if (cxn->output_queues[CXN_OUTPUT_CLASS_FLOW_REMOVED].count <=
+        FLOW_REMOVED_LOW_WATERMARK) {
+        ind_cxn_flow_removed_waiters_run();
+    }
+
+    if (cxn->pkts_enqueued == 0) { /* Nothing (more) to send */
         LOG_TRACE(cxn, "No more data to write");
         INDIGO_ASSERT(cxn->bytes_enqueued == 0);
         INDIGO_ASSERT(cxn->pkts_enqueued == 0);
@@ -1372,28 +2015,120 @@ ind_cxn_process_write_buffer(connection_t *cxn)
 }
 
 /**
- * Enqueue data into the write buffer for transmission to a controller
+ * Call and forget everything waiting for the output to drain
  *
- * @param cxn The connection handle
- * @param data Pointer to a message to be sent
- * @param len Number of bytes to be sent out
+ * The list is detached first because callbacks may register again.
+ */
+
+void
+ind_cxn_output_waiters_run(connection_t *cxn)
+{
+    cxn_output_waiter_t *waiters = cxn->output_waiters;
+    int count = cxn->output_waiter_count;
+    int i;
+
+    cxn->output_waiters = NULL;
+    cxn->output_waiter_count = 0;
+    cxn->output_waiter_size = 0;
+
+    for (i = 0; i < count; i++) {
+        waiters[i].callback(waiters[i].cookie);
+    }
+
+    aim_free(waiters);
+}
+
+/**
+ * Double the size of an output ring, keeping queued messages in order
+ */
+
+static int
+output_queue_grow(cxn_output_queue_t *q)
+{
+    int new_size, i;
+    cxn_output_msg_t *new_ring;
+
+    new_size = q->size ? q->size * 2 : OUTPUT_RING_INITIAL_SIZE;
+    new_ring = indigo_mem_arena_alloc(new_size * sizeof(*new_ring));
+    if (new_ring == NULL) {
+        new_ring = aim_malloc(new_size * sizeof(*new_ring));
+        if (new_ring == NULL) {
+            return INDIGO_ERROR_RESOURCE;
+        }
+    }
+    INDIGO_MEM_SET(new_ring, 0, new_size * sizeof(*new_ring));
+
+    for (i = 0; i < q->count; i++) {
+        new_ring[i] = *OUTPUT_QUEUE_MSG(q, i);
+    }
+
+    output_ring_free(q->ring, q->size);
+    q->ring = new_ring;
+    q->size = new_size;
+    q->head = 0;
+
+    return INDIGO_ERROR_NONE;
+}
+
+/**
+ * Wrap a serialized message for enqueueing on several connections
  *
- * @returns Error code
+ * @param data Pointer to a message; ownership passes to the new object
+ * @param len Number of bytes in the message
  *
- * Takes ownership of data unless an error is returned.
+ * @returns The shared message with one reference held by the caller, or
+ * NULL if allocation failed (data is not freed in that case)
  */
 
-int
-ind_cxn_instance_enqueue(connection_t *cxn, uint8_t *data, int len)
+cxn_shared_msg_t *
+ind_cxn_shared_msg_new(uint8_t *data, int len)
+{
+    cxn_shared_msg_t *shared;
+
+    if ((shared = aim_zmalloc(sizeof(*shared))) == NULL) {
+        return NULL;
+    }
+
+    shared->refcount = 1;
+    shared->len = len;
+    shared->data = data;
+
+    return shared;
+}
+
+/**
+ * Drop a reference to a shared message, freeing it with the last one
+ */
+
+void
+ind_cxn_shared_msg_unref(cxn_shared_msg_t *shared)
+{
+    INDIGO_ASSERT(shared->refcount > 0);
+    if (--shared->refcount == 0) {
+        of_alloc_free(shared->data);
+        aim_free(shared);
+    }
+}
+
+/**
+ * Add a message to one of the connection's output queues
+ */
+
+static int
+output_enqueue(connection_t *cxn, uint8_t *data, int len,
+               cxn_shared_msg_t *shared, cxn_output_class_t output_class)
 {
     int msg_len;
+    cxn_output_msg_t *msg;
+    cxn_output_queue_t *q = &cxn->output_queues[output_class];
 
     LOG_TRACE(cxn, "Enqueuing %d bytes", len);
     LOG_TRACE(cxn, "Cur len %d bytes, %d pkts",
               cxn->bytes_enqueued, cxn->pkts_enqueued);
 
     /* See notes about WRITE_BUFFER_SIZE in cxn_instance.h */
-    if (len > CXN_WRITE_BYTES_AVAIL(cxn)) {
+    if (len > CXN_WRITE_BYTES_AVAIL(cxn) -
+        (output_class == CXN_OUTPUT_CLASS_ECHO ? 0 : CXN_OUTPUT_ECHO_RESERVE)) {
         return INDIGO_ERROR_RESOURCE;
     }
 
@@ -1404,9 +2139,27 @@ ind_cxn_instance_enqueue(connection_t *cxn, uint8_t *data, int len)
                   len, msg_len);
         return INDIGO_ERROR_UNKNOWN;
     }
-    cxn->output_list = biglist_append(cxn->output_list, (void *)data);
+    if (q->count == q->size) {
+        if (output_queue_grow(q) < 0) {
+            return INDIGO_ERROR_RESOURCE;
+        }
+    }
+
+    msg = OUTPUT_QUEUE_MSG(q, q->count);
+    msg->data = data;
+    msg->len = len;
+    msg->shared = shared;
+    q->count += 1;
     cxn->bytes_enqueued += len;
     cxn->pkts_enqueued += 1;
+    indigo_mem_budget_charge(INDIGO_MEM_BUDGET_OUTPUT, len);
+
+    if (cxn->bytes_enqueued > cxn->status.output_bytes_high) {
+        cxn->status.output_bytes_high = cxn->bytes_enqueued;
+    }
+    if (cxn->pkts_enqueued > cxn->status.output_msgs_high) {
+        cxn->status.output_msgs_high = cxn->pkts_enqueued;
+    }
 
     /* Indicate data is ready to the socket manager */
     INDIGO_ASSERT(cxn->bytes_enqueued > 0);
@@ -1416,6 +2169,50 @@ ind_cxn_instance_enqueue(connection_t *cxn, uint8_t *data, int len)
     return INDIGO_ERROR_NONE;
 }
 
+/**
+ * Enqueue data into the write buffer for transmission to a controller
+ *
+ * @param cxn The connection handle
+ * @param data Pointer to a message to be sent
+ * @param len Number of bytes to be sent out
+ * @param output_class Queue to place the message on
+ *
+ * @returns Error code
+ *
+ * Takes ownership of data unless an error is returned.
+ */
+
+int
+ind_cxn_instance_enqueue(connection_t *cxn, uint8_t *data, int len,
+                         cxn_output_class_t output_class)
+{
+    return output_enqueue(cxn, data, len, NULL, output_class);
+}
+
+/**
+ * Enqueue a shared message for transmission to a controller
+ *
+ * @param cxn The connection handle
+ * @param shared The message; a reference is taken unless an error is returned
+ * @param output_class Queue to place the message on
+ *
+ * @returns Error code
+ */
+
+int
+ind_cxn_instance_enqueue_shared(connection_t *cxn, cxn_shared_msg_t *shared,
+                                cxn_output_class_t output_class)
+{
+    int rv;
+
+    rv = output_enqueue(cxn, shared->data, shared->len, shared, output_class);
+    if (rv == INDIGO_ERROR_NONE) {
+        shared->refcount++;
+    }
+
+    return rv;
+}
+
 /**
  * Send a hello message to the given connection
  */
@@ -1446,8 +2243,13 @@ ind_cxn_send_hello(connection_t *cxn)
  * Attempt to connect to a controller instance.
  * @param cxn The instance control block
  * @returns 0 if TCP connection is successful and state is now CONNECTING
+ * @returns 1 if the connect is still in progress
  * @returns -1 if no connection established
  *
+ * Each new socket counts as an attempt in fail_count; polling a connect
+ * in progress does not. A connect still pending after
+ * CXN_CONNECT_TIMEOUT_MS is abandoned as failed.
+ *
  * Assumes connection is not local
  */
 int
@@ -1456,7 +2258,6 @@ ind_cxn_try_to_connect(connection_t *cxn)
     int rv;
     indigo_cxn_params_tcp_over_ipv4_t *params;
     struct sockaddr_in cxn_addr;
-    cxn->fail_count++;
 
     if (CONNECTION_STATE(cxn) != INDIGO_CXN_S_DISCONNECTED) {
         LOG_ERROR(cxn, "Called try to connect when state is %s",
@@ -1466,11 +2267,19 @@ ind_cxn_try_to_connect(connection_t *cxn)
 
     params = &cxn->protocol_params.tcp_over_ipv4;
 
+    if (CXN_AUXILIARY(cxn)) {
+        connection_t *main_cxn = ind_cxn_main_get(cxn);
+        if (main_cxn == NULL || !CXN_HANDSHAKE_COMPLETE(main_cxn)) {
+            LOG_TRACE(cxn, "Waiting for the main connection");
+            return -1;
+        }
+    }
+
     if (cxn->sd < 0) {
         /* Attempt to create the socket */
         int soc_flags;
 
-        cxn->sd = socket(AF_INET, SOCK_STREAM, 0);
+        cxn->sd = socket(AF_INET, CXN_UDP(cxn) ? SOCK_DGRAM : SOCK_STREAM, 0);
         if (cxn->sd < 0) {
             LOG_ERROR(cxn, "Failed to create controller connection socket: %s",
                       strerror(errno));
@@ -1488,11 +2297,14 @@ ind_cxn_try_to_connect(connection_t *cxn)
         }
 
         /* Disable Nagle's algorithm */
-        {
+        if (!CXN_UDP(cxn)) {
             int flag = 1;
             (void) setsockopt(cxn->sd, IPPROTO_TCP, TCP_NODELAY,
                               (char *) &flag, sizeof(int));
         }
+
+        cxn->fail_count++;
+        cxn->connect_start = INDIGO_CURRENT_TIME;
     }
 
     LOG_TRACE(cxn, "Attempting to connect");
@@ -1525,11 +2337,19 @@ ind_cxn_try_to_connect(connection_t *cxn)
     }
 
     if (rv == 0) {
-        cxn->fail_count = 0;
         cxn_state_set(cxn, INDIGO_CXN_S_CONNECTING);
+        return 0;
     }
 
-    return rv;
+    if (INDIGO_TIME_DIFF_ms(cxn->connect_start, INDIGO_CURRENT_TIME) >
+        CXN_CONNECT_TIMEOUT_MS) {
+        LOG_VERBOSE(cxn, "Connect timed out");
+        close(cxn->sd);
+        cxn->sd = -1;
+        return -1;
+    }
+
+    return 1;
 }
 
 /**
@@ -1543,33 +2363,54 @@ ind_cxn_disconnected_init(connection_t *cxn)
     cxn->status.state = INDIGO_CXN_S_DISCONNECTED;
     cxn->status.role = INDIGO_CXN_R_EQUAL;
     cxn->status.negotiated_version = OF_VERSION_UNKNOWN;
-    cxn->bytes_needed = OF_MESSAGE_HEADER_LENGTH;
+    cxn->read_bytes = 0;
+    cxn->read_offset = 0;
+    cxn->echo_peek_offset = 0;
+    cxn->echo_answered_early = 0;
     cxn->flags = 0;
     cxn->outstanding_op_cnt = 0;
+    ind_cxn_latency_reset(cxn);
     cxn->barrier.pendingf = 0;
     cxn->keepalive.outstanding_echo_cnt = 0;
     cxn->status.bytes_in = 0;
     cxn->status.bytes_out = 0;
     cxn->status.messages_in = 0;
     cxn->status.messages_out = 0;
-    cxn->fail_count = 0;
+    cxn->status.output_bytes_high = 0;
+    cxn->status.output_msgs_high = 0;
+    cxn->output_head_class = -1;
+    memset(cxn->packet_in_buckets, 0, sizeof(cxn->packet_in_buckets));
     cxn->hello_time = 0;
 }
 
 /**
  * @brief Calculate timeout between connection attempts.
  *
- * Exponential backoff up to a limit of 1 second.
+ * Exponential backoff with full jitter: after n attempts without a
+ * handshake, the delay is drawn uniformly from
+ * [0, min(CXN_RETRY_MIN_MS << n, CXN_RETRY_MAX_MS)]. Switches that lose
+ * the same controller at once therefore spread their reconnects out
+ * instead of arriving in lockstep, and a controller that accepts and
+ * then drops connections is backed off from as well.
  */
 
 static int
 connection_retry_ms(const connection_t *cxn)
 {
-    if (cxn->fail_count < 10) {
-        return 1 << cxn->fail_count;
+    static unsigned int seed;
+    int limit;
+
+    if (seed == 0) {
+        seed = (unsigned int)INDIGO_PRECISE_TIME ^ (unsigned int)getpid();
+    }
+
+    if (cxn->fail_count >= CXN_RETRY_SHIFT_MAX) {
+        limit = CXN_RETRY_MAX_MS;
     } else {
-        return 1000;
+        limit = aim_imin(CXN_RETRY_MIN_MS << cxn->fail_count, CXN_RETRY_MAX_MS);
     }
+
+    return rand_r(&seed) % (limit + 1);
 }
 
 /**
@@ -1582,13 +2423,17 @@ void
 ind_cxn_connection_retry_timer(void *cookie)
 {
     connection_t *cxn = cookie;
+    int rv;
+
     INDIGO_ASSERT(CXN_ACTIVE(cxn));
     INDIGO_ASSERT(CONNECTION_STATE(cxn) == INDIGO_CXN_S_DISCONNECTED);
-    if (ind_cxn_try_to_connect(cxn) == 0) {
+    rv = ind_cxn_try_to_connect(cxn);
+    if (rv == 0) {
         ind_soc_timer_event_unregister(ind_cxn_connection_retry_timer, cxn);
     } else {
         ind_soc_timer_event_register_with_priority(
             ind_cxn_connection_retry_timer, cxn,
-            connection_retry_ms(cxn), IND_CXN_EVENT_PRIORITY);
+            rv > 0 ? CXN_CONNECT_POLL_MS : connection_retry_ms(cxn),
+            IND_CXN_EVENT_PRIORITY);
     }
 }
@@ -31,9 +31,20 @@
 #include <loci/loci.h>
 #include <OFConnectionManager/ofconnectionmanager.h>
 #include <BigList/biglist.h>
+#include <indigo/mem_budget.h>
 
 #define READ_BUFFER_SIZE (64 * 1024)
 
+/**
+ * Messages a connection of weight 1 may process per turn of the event
+ * loop before yielding to other connections. A connection's quantum is
+ * its weight times this, divided by CXN_SLAVE_WEIGHT_DIVISOR while it
+ * is a slave, and never less than one message.
+ */
+#define CXN_READ_QUANTUM 16
+#define CXN_WEIGHT_MAX 16
+#define CXN_SLAVE_WEIGHT_DIVISOR 4
+
 /**
  * The write buffer size is artificial in that the original data
  * is buffered rather than copying into a local buffer.  This value
@@ -49,11 +60,114 @@
  */
 #define WRITE_BUFFER_SIZE (16 * 1024 * 1024)
 
+/**
+ * Output watermarks for bulk producers; see indigo_cxn_output_blocked.
+ * Kept well below WRITE_BUFFER_SIZE so a stats dump never pushes the
+ * connection into the enqueue failure path.
+ */
+#define CXN_OUTPUT_HIGH_WATERMARK (1024 * 1024)
+#define CXN_OUTPUT_LOW_WATERMARK (256 * 1024)
+
+/**
+ * Output space held back for echo traffic, so a full write buffer cannot
+ * keep the connection from answering keepalives.
+ */
+#define CXN_OUTPUT_ECHO_RESERVE (64 * 1024)
+
+/**
+ * Initial number of slots in each of a connection's output rings. A ring
+ * doubles when full.
+ */
+#define OUTPUT_RING_INITIAL_SIZE 64
+
+/**
+ * Output queue classes. Queues are drained in strict priority order,
+ * lowest value first, so replies and port status are never stuck behind
+ * a backlog of packet-ins, and echoes go out ahead of everything.
+ */
+typedef enum cxn_output_class_e {
+    CXN_OUTPUT_CLASS_ECHO,          /* Echo requests and replies */
+    CXN_OUTPUT_CLASS_CONTROL,       /* Replies and anything not listed below */
+    CXN_OUTPUT_CLASS_PORT_STATUS,
+    CXN_OUTPUT_CLASS_FLOW_REMOVED,
+    CXN_OUTPUT_CLASS_PACKET_IN,
+    CXN_OUTPUT_CLASS_COUNT
+} cxn_output_class_t;
+
+/**
+ * A serialized message referenced from several connections' output queues,
+ * so async fan-out does not copy it per controller. The data is freed when
+ * the last queue releases it.
+ */
+typedef struct cxn_shared_msg_s {
+    int refcount;
+    int len;
+    uint8_t *data;
+} cxn_shared_msg_t;
+
+/* An outgoing message in an output ring */
+typedef struct cxn_output_msg_s {
+    uint8_t *data;
+    int len;
+    cxn_shared_msg_t *shared; /* If not NULL, data belongs to shared */
+} cxn_output_msg_t;
+
+/* One output class's queue */
+typedef struct cxn_output_queue_s {
+    cxn_output_msg_t *ring; /* Circular array of outgoing messages */
+    int size;               /* Slots in ring, a power of 2 */
+    int head;               /* Index of the oldest message */
+    int count;              /* Messages queued */
+} cxn_output_queue_t;
+
+/**
+ * Packet-in token buckets, one per reason or table ID. Tokens are kept
+ * in thousandths of a message so the refill is exact at ms resolution.
+ */
+#define CXN_PACKET_IN_BUCKETS 256
+
+typedef struct cxn_token_bucket_s {
+    uint64_t tokens;
+    indigo_time_t last;     /* Last refill; 0 if never used */
+} cxn_token_bucket_t;
+
+/**
+ * Requests timed until their tracked copy is deleted, per connection;
+ * beyond this they are timed to their handler's return
+ */
+#define CXN_LATENCY_PENDING_MAX 16
+
+/**
+ * Flight recorder size, a power of 2, and how many of a connection's
+ * latest events are logged when it is disconnected
+ */
+#define CXN_FLIGHT_EVENTS 1024
+#define CXN_FLIGHT_DUMP_ON_DISCONNECT 32
+
+/**
+ * Message trace ring size, a power of 2, and how many bytes of each
+ * traced message are kept
+ */
+#define CXN_TRACE_RECORDS 1024
+#define CXN_TRACE_SNAPLEN 128
+
+/* Message trace directions */
+#define CXN_TRACE_IN 0
+#define CXN_TRACE_OUT 1
+
 /**
  * Connection flag, connection is to be removed pending op completion
  */
 #define CXN_TO_BE_REMOVED 0x1
 
+/**
+ * A callback waiting for the connection's output to drain
+ */
+typedef struct cxn_output_waiter_s {
+    indigo_cxn_output_ready_f callback;
+    void *cookie;
+} cxn_output_waiter_t;
+
 /* Connection control block */
 typedef struct connection_s {
     indigo_cxn_protocol_params_t protocol_params;
@@ -63,33 +177,64 @@ typedef struct connection_s {
 
     /* Internal configuration below */
     int active; /* Has this connection instance been configured? */
-    int fail_count; /* How may failed connection tries */
+    int fail_count; /* Connect attempts since the last handshake */
+    indigo_time_t connect_start; /* When the pending connect was started */
     indigo_cxn_id_t cxn_id; /* For back tracking */
 
     int sd; /* The socket descriptor */
 
     /*
-     * The read buffer is used to buffer a single message.  There
-     * are two steps to the operation: Read the header, then use that
-     * to determine the number of bytes remaining in the message.
-     * Once a message is read in, it is processed and the read buffer
-     * is cleared.
+     * The read buffer holds whatever the last reads returned, possibly
+     * several messages and a partial one at the end.  Complete messages
+     * are processed in place starting at read_offset; the unprocessed
+     * tail is moved to the front before the next read.  A handler may
+     * take the buffer along with the message it holds; see
+     * cxn_message_claim.
      */
-    uint8_t read_buffer[READ_BUFFER_SIZE];
+    uint8_t *read_buffer; /* READ_BUFFER_SIZE bytes */
     int read_bytes; /* Number of bytes currently in read buffer */
-    int bytes_needed; /* Num bytes needed for next process step */
-
-    /* Write queue */
-    biglist_t *output_list; /* List of outgoing messages */
-    int output_head_offset; /* Bytes already sent out from head of output_list */
+    int read_offset; /* Start of the first unprocessed message */
+    int read_task_pending; /* read_continue_task is registered */
+    int read_quota; /* Messages left in this turn; see CXN_READ_QUANTUM */
+    int echo_peek_offset; /* End of the messages checked by echo_peek */
+    int echo_answered_early; /* Buffered echo requests already answered */
+    of_object_t *dispatch_obj; /* Message from read_buffer being handled */
+
+    /* Write queues, indexed by cxn_output_class_t */
+    cxn_output_queue_t output_queues[CXN_OUTPUT_CLASS_COUNT];
+    int output_head_class;  /* Class of the partially sent message, or -1 */
+    int output_head_offset; /* Bytes already sent out from that message */
     int bytes_enqueued;     /* Total bytes queued */
     int pkts_enqueued;      /* Total pkts queued */
 
+    /* Waiting for output to drain; see indigo_cxn_output_ready_register */
+    cxn_output_waiter_t *output_waiters;
+    int output_waiter_count;
+    int output_waiter_size;
+
+    /* Packet-in rate limiting; see ind_cxn_packet_in_limit_set */
+    cxn_token_bucket_t packet_in_buckets[CXN_PACKET_IN_BUCKETS];
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    /* TLS state, only used for INDIGO_CXN_PROTO_TLS_OVER_IPV4 */
+    struct ssl_st *tls;                 /* NULL when not connected */
+    struct ssl_session_st *tls_session; /* Kept across reconnects to resume */
+    int tls_established;    /* Handshake finished on the current socket */
+    int tls_write_wants_read; /* Writes stalled until the next read */
+    uint32_t tls_handshakes;  /* Completed handshakes */
+    uint32_t tls_resumed;     /* Handshakes that resumed a session */
+#endif
+
     /* Additional debug info */
     uint64_t messages_in_by_type[OF_MESSAGE_OBJECT_COUNT];
     uint64_t messages_out_by_type[OF_MESSAGE_OBJECT_COUNT];
     uint64_t messages_in_unknown;
     uint64_t messages_out_unknown;
+    uint64_t messages_in_unvalidated; /* Trusted fast path; see process_message */
+    uint64_t messages_in_malformed;   /* Reported by handlers after dispatch */
+    uint64_t read_quota_yields;       /* Turns ended by an empty read_quota */
+    uint64_t echo_requests_early;     /* Answered ahead of the backlog */
+    uint64_t messages_in_claimed;     /* Handed to handlers without a copy */
 
     uint64_t packet_ins;
 
@@ -108,33 +253,68 @@ typedef struct connection_s {
     } keepalive;
 
 
-    /* Message Tracing */
-    aim_pvs_t* trace_pvs;
+    /* Message tracing; see cxn_trace.c */
+    uint8_t trace_on;   /* Set if any bit in trace_types is */
+    uint8_t trace_types[(OF_MESSAGE_OBJECT_COUNT + 7) / 8];
 
     /* To detect object staleness */
     uint32_t generation_id;
 
     /* Used by the bsn_time_request message handler */
     indigo_time_t hello_time;
+
+    /* Bundle being collected; see cxn_bundle.c */
+    struct {
+        int state;              /* IND_CXN_BUNDLE_STATE_* */
+        uint32_t id;            /* Controller-chosen id of the bundle */
+        uint16_t flags;         /* Flags from the open request */
+        uint8_t **msgs;         /* Copies of the added messages */
+        int count;              /* Messages in msgs */
+        int size;               /* Slots allocated in msgs */
+        int bytes;              /* Total length of the added messages */
+        int failed;             /* An add was rejected; commit is refused */
+    } bundle;
+
+    /* Timing of the message being handled; see cxn_latency.c */
+    struct {
+        uint64_t start_us;      /* Nonzero while a handler is running */
+        int deferred;           /* Timed until its tracked copy is deleted */
+        int pending_count;      /* Deferred messages still outstanding */
+        struct {
+            of_object_t *obj;   /* The tracked copy */
+            uint64_t start_us;
+        } pending[CXN_LATENCY_PENDING_MAX];
+    } latency;
 } connection_t;
 
 
 
 /**
- * Should a packet in be dropped based on connection state?
+ * Should a packet in be dropped based on connection state or the
+ * memory budget?
  * @TODO This may need tuning
  */
 #define PACKET_IN_DROP_QUEUE_MAX 64
-#define CXN_DROP_PACKET_IN(cxn, obj)                    \
-    ((cxn)->pkts_enqueued > PACKET_IN_DROP_QUEUE_MAX)
+#define CXN_PACKET_IN_QUEUE_MAX(cxn)                                    \
+    ((cxn)->config_params.packet_in_queue_max > 0 ?                     \
+     (cxn)->config_params.packet_in_queue_max : PACKET_IN_DROP_QUEUE_MAX)
+#define CXN_DROP_PACKET_IN(cxn, obj)                                    \
+    ((cxn)->output_queues[CXN_OUTPUT_CLASS_PACKET_IN].count >           \
+     CXN_PACKET_IN_QUEUE_MAX(cxn) || !indigo_mem_budget_admit())
 
 /**
- * Should a flow removed message be dropped based on connection state?
- * @TODO This may need tuning
+ * Flow removed flow control; see indigo_cxn_flow_removed_blocked.
+ * Producers that check stop once a connection queues the high watermark
+ * and resume when every connection is down to the low one. A message is
+ * only dropped past the drop limit, which leaves room for producers that
+ * do not check.
  */
-#define FLOW_REMOVED_DROP_QUEUE_MAX 64
-#define CXN_DROP_FLOW_REMOVED(cxn, obj)                \
-    ((cxn)->pkts_enqueued > FLOW_REMOVED_DROP_QUEUE_MAX)
+#define FLOW_REMOVED_HIGH_WATERMARK 64
+#define FLOW_REMOVED_LOW_WATERMARK 16
+#define FLOW_REMOVED_DROP_QUEUE_MAX 4096
+#define CXN_DROP_FLOW_REMOVED(cxn, obj)                                 \
+    ((cxn)->output_queues[CXN_OUTPUT_CLASS_FLOW_REMOVED].count >        \
+     FLOW_REMOVED_DROP_QUEUE_MAX)
 
 /**
  * How many bytes in buffer are free
@@ -158,6 +338,23 @@ typedef struct connection_s {
  */
 #define CXN_LISTEN(cxn) ((cxn)->config_params.listen)
 
+/**
+ * Does the connection use TLS?
+ */
+#define CXN_TLS(cxn) \
+    ((cxn)->protocol_params.header.protocol == INDIGO_CXN_PROTO_TLS_OVER_IPV4)
+
+/**
+ * Does the connection use UDP?
+ */
+#define CXN_UDP(cxn) \
+    ((cxn)->protocol_params.header.protocol == INDIGO_CXN_PROTO_UDP_OVER_IPV4)
+
+/**
+ * Is the connection an OpenFlow 1.3 auxiliary connection?
+ */
+#define CXN_AUXILIARY(cxn) ((cxn)->config_params.auxiliary_id != 0)
+
 /**
  * The connection state of connection
  *
@@ -191,7 +388,16 @@ extern state_info_t state_info[INDIGO_CXN_S_COUNT];
     (CXN_ACTIVE(cxn) &&                                                 \
      (CONNECTION_STATE(cxn) == INDIGO_CXN_S_HANDSHAKE_COMPLETE))
 
-extern int ind_cxn_instance_enqueue(connection_t *cxn, uint8_t *data, int len);
+extern int ind_cxn_instance_enqueue(connection_t *cxn, uint8_t *data, int len,
+                                    cxn_output_class_t output_class);
+
+extern int ind_cxn_instance_enqueue_shared(connection_t *cxn,
+                                           cxn_shared_msg_t *shared,
+                                           cxn_output_class_t output_class);
+
+extern cxn_shared_msg_t *ind_cxn_shared_msg_new(uint8_t *data, int len);
+
+extern void ind_cxn_shared_msg_unref(cxn_shared_msg_t *shared);
 
 extern int ind_cxn_send_hello(connection_t *cxn);
 
@@ -207,6 +413,96 @@ extern void ind_cxn_disconnected_init(connection_t *cxn);
 
 extern void ind_cxn_state_set(connection_t *cxn, indigo_cxn_state_t new_state);
 
+extern void ind_cxn_msg_process(connection_t *cxn, of_object_t *obj);
+
+extern void ind_cxn_output_waiters_run(connection_t *cxn);
+
+extern void ind_cxn_flow_removed_waiters_run(void);
+
+/****************************************************************
+ * Bundles
+ ****************************************************************/
+
+/* BSN experimenter subtypes carrying bundle messages */
+#define IND_CXN_BUNDLE_CTRL_SUBTYPE 0x100
+#define IND_CXN_BUNDLE_ADD_SUBTYPE 0x101
+
+/* Bundle control types, as in OpenFlow 1.4; replies are request + 1 */
+#define IND_CXN_BUNDLE_OPEN_REQUEST 0
+#define IND_CXN_BUNDLE_CLOSE_REQUEST 2
+#define IND_CXN_BUNDLE_COMMIT_REQUEST 4
+#define IND_CXN_BUNDLE_DISCARD_REQUEST 6
+
+#define IND_CXN_BUNDLE_STATE_NONE 0
+#define IND_CXN_BUNDLE_STATE_OPEN 1
+#define IND_CXN_BUNDLE_STATE_CLOSED 2
+
+/* Per-bundle limits; an add beyond these is rejected */
+#define IND_CXN_BUNDLE_MAX_MSGS 16384
+#define IND_CXN_BUNDLE_MAX_BYTES (16 * 1024 * 1024)
+
+extern int ind_cxn_bundle_handle(connection_t *cxn, of_object_t *obj);
+
+extern void ind_cxn_parse_error_send(connection_t *cxn, uint8_t *buf, int len);
+
+extern void ind_cxn_bundle_discard(connection_t *cxn);
+
+
+/****************************************************************
+ * Message latency
+ ****************************************************************/
+
+extern uint64_t ind_cxn_latency_now_us(void);
+extern void ind_cxn_latency_handler_done(connection_t *cxn,
+                                         of_object_id_t object_id,
+                                         uint64_t end_us);
+extern void ind_cxn_latency_defer(connection_t *cxn, of_object_t *obj);
+extern void ind_cxn_latency_object_delete(connection_t *cxn,
+                                          of_object_t *obj);
+extern void ind_cxn_latency_reset(connection_t *cxn);
+extern void ind_cxn_latency_clear(void);
+extern void ind_cxn_latency_show(aim_pvs_t *pvs);
+
+
+/****************************************************************
+ * Flight recorder
+ ****************************************************************/
+
+extern void ind_cxn_flight_handler_start(void);
+extern void ind_cxn_flight_msg(connection_t *cxn, of_object_id_t object_id,
+                               uint32_t xid, uint64_t start_us,
+                               uint64_t end_us);
+extern void ind_cxn_flight_error_out(indigo_cxn_id_t cxn_id, uint32_t xid,
+                                     uint16_t type, uint16_t code);
+extern void ind_cxn_flight_state(connection_t *cxn, indigo_cxn_state_t state);
+extern void ind_cxn_flight_clear(void);
+extern void ind_cxn_flight_show(aim_pvs_t *pvs, indigo_cxn_id_t cxn_id,
+                                int max);
+extern void ind_cxn_flight_log(connection_t *cxn);
+
+
+/****************************************************************
+ * Message trace
+ ****************************************************************/
+
+/* Is this message type traced on this connection? */
+#define CXN_TRACED(cxn, object_id)                                      \
+    ((cxn)->trace_on && (unsigned)(object_id) < OF_MESSAGE_OBJECT_COUNT && \
+     ((cxn)->trace_types[(object_id) >> 3] & (1 << ((object_id) & 7))))
+
+extern void ind_cxn_trace_types_set(connection_t *cxn, int object_id,
+                                    int enable);
+extern indigo_error_t ind_cxn_trace_set(indigo_cxn_id_t cxn_id,
+                                        int object_id, int enable);
+extern indigo_error_t ind_cxn_trace_set_by_name(indigo_cxn_id_t cxn_id,
+                                                const char *name, int enable);
+extern void ind_cxn_trace_record(connection_t *cxn, int dir,
+                                 const uint8_t *buf, int len);
+extern void ind_cxn_trace_clear(void);
+extern void ind_cxn_trace_show(aim_pvs_t *pvs, indigo_cxn_id_t cxn_id);
+extern indigo_error_t ind_cxn_trace_save(const char *path);
+extern indigo_error_t ind_cxn_trace_decode(aim_pvs_t *pvs, const char *path);
+
 
 /****************************************************************
  * Debug and logging routines
@@ -237,6 +533,24 @@ cxn_ip_string(connection_t *cxn)
 extern int ind_cxn_process_write_buffer(connection_t *cxn);
 extern int ind_cxn_process_read_buffer(connection_t *cxn);
 
+extern connection_t *ind_cxn_main_get(const connection_t *aux);
+extern void ind_cxn_auxiliaries_disconnect(connection_t *main_cxn);
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+struct iovec;
+
+extern indigo_error_t ind_cxn_tls_config_set(const char *ca_cert_file,
+                                             const char *cert_file,
+                                             const char *key_file);
+extern indigo_error_t ind_cxn_tls_start(connection_t *cxn);
+extern void ind_cxn_tls_close(connection_t *cxn);
+extern void ind_cxn_tls_session_clear(connection_t *cxn);
+extern int ind_cxn_tls_read(connection_t *cxn, uint8_t *buf, int len);
+extern int ind_cxn_tls_writev(connection_t *cxn, struct iovec *iov,
+                              int iovcnt, int *blocked);
+extern int ind_cxn_tls_pending(connection_t *cxn);
+#endif
+
 #if 0 /* TBD */
 /**
  * Flags for a connection instance
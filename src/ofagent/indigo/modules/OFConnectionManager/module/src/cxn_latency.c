@@ -0,0 +1,371 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+
+/**
+ * @file
+ * @brief Per message type latency histograms
+ *
+ * A message is timed from the start of its parse in process_message to
+ * the return of its handler; any reply the handler sends is enqueued by
+ * then. Handlers that finish the request later from a task (flow stats,
+ * for example) keep a tracked duplicate of it, and those messages are
+ * timed until that duplicate is deleted instead.
+ *
+ * The histograms are shared by all connections. Buckets are log-linear
+ * in microseconds: each power of two is split into
+ * CXN_LATENCY_SUB_BUCKETS equal parts, so a reported percentile is at
+ * most 25% above the true value.
+ *
+ * The results are shown by the "latency" ucli command and registered as
+ * debug counters when a message type is first timed. The counter names
+ * look like "cxn.latency.flow_add.p99_us".
+ */
+
+#include "ofconnectionmanager_log.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+
+#include "cxn_instance.h"
+#include "ofconnectionmanager_int.h"
+
+#include <indigo/memory.h>
+#include <indigo/debug_counter.h>
+
+#define CXN_LATENCY_SUB_BUCKET_BITS 2
+#define CXN_LATENCY_SUB_BUCKETS (1 << CXN_LATENCY_SUB_BUCKET_BITS)
+
+/* Values below CXN_LATENCY_SUB_BUCKETS get a bucket each */
+#define CXN_LATENCY_BUCKETS \
+    (CXN_LATENCY_SUB_BUCKETS * (32 - CXN_LATENCY_SUB_BUCKET_BITS + 1))
+
+enum {
+    CXN_LATENCY_STAT_COUNT,
+    CXN_LATENCY_STAT_TOTAL_US,
+    CXN_LATENCY_STAT_P50_US,
+    CXN_LATENCY_STAT_P90_US,
+    CXN_LATENCY_STAT_P99_US,
+    CXN_LATENCY_STAT_MAX_US,
+    CXN_LATENCY_NUM_STATS,
+};
+
+static const struct {
+    const char *name;
+    const char *description;
+} latency_stats[CXN_LATENCY_NUM_STATS] = {
+    { "count", "Messages timed" },
+    { "total_us", "Sum of message latencies in microseconds" },
+    { "p50_us", "Median message latency in microseconds" },
+    { "p90_us", "90th percentile message latency in microseconds" },
+    { "p99_us", "99th percentile message latency in microseconds" },
+    { "max_us", "Largest message latency in microseconds" },
+};
+
+typedef struct cxn_latency_hist_s {
+    uint64_t count;
+    uint64_t total_us;
+    uint32_t max_us;
+    uint64_t buckets[CXN_LATENCY_BUCKETS];
+    debug_counter_t counters[CXN_LATENCY_NUM_STATS];
+    char counter_names[CXN_LATENCY_NUM_STATS][64];
+    char counter_descriptions[CXN_LATENCY_NUM_STATS][128];
+} cxn_latency_hist_t;
+
+/* Allocated on the first message of each type */
+static cxn_latency_hist_t *latency_hists[OF_MESSAGE_OBJECT_COUNT];
+
+uint64_t
+ind_cxn_latency_now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int
+latency_bucket(uint32_t us)
+{
+    int msb;
+
+    if (us < CXN_LATENCY_SUB_BUCKETS) {
+        return us;
+    }
+
+    msb = 31 - __builtin_clz(us);
+    return CXN_LATENCY_SUB_BUCKETS * (msb - CXN_LATENCY_SUB_BUCKET_BITS + 1) +
+        ((us >> (msb - CXN_LATENCY_SUB_BUCKET_BITS)) &
+         (CXN_LATENCY_SUB_BUCKETS - 1));
+}
+
+/* Largest value that falls in the given bucket */
+static uint32_t
+latency_bucket_high(int bucket)
+{
+    int shift;
+    uint64_t low;
+
+    if (bucket < CXN_LATENCY_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    shift = bucket / CXN_LATENCY_SUB_BUCKETS - 1;
+    low = (uint64_t)(CXN_LATENCY_SUB_BUCKETS +
+                     bucket % CXN_LATENCY_SUB_BUCKETS) << shift;
+    return low + (1ULL << shift) - 1;
+}
+
+static uint32_t
+latency_percentile(const cxn_latency_hist_t *hist, int percent)
+{
+    uint64_t rank, seen = 0;
+    int i;
+
+    if (hist->count == 0) {
+        return 0;
+    }
+
+    rank = (hist->count * percent + 99) / 100;
+    for (i = 0; i < CXN_LATENCY_BUCKETS; i++) {
+        seen += hist->buckets[i];
+        if (seen >= rank) {
+            uint32_t high = latency_bucket_high(i);
+            return high < hist->max_us ? high : hist->max_us;
+        }
+    }
+
+    return hist->max_us;
+}
+
+static uint64_t
+latency_stat(const cxn_latency_hist_t *hist, int stat)
+{
+    switch (stat) {
+    case CXN_LATENCY_STAT_COUNT: return hist->count;
+    case CXN_LATENCY_STAT_TOTAL_US: return hist->total_us;
+    case CXN_LATENCY_STAT_P50_US: return latency_percentile(hist, 50);
+    case CXN_LATENCY_STAT_P90_US: return latency_percentile(hist, 90);
+    case CXN_LATENCY_STAT_P99_US: return latency_percentile(hist, 99);
+    case CXN_LATENCY_STAT_MAX_US: return hist->max_us;
+    default: return 0;
+    }
+}
+
+/* Message type name without the "of_" prefix */
+static const char *
+latency_type_name(of_object_id_t object_id)
+{
+    const char *name = of_object_id_str[object_id];
+
+    return strncmp(name, "of_", 3) ? name : name + 3;
+}
+
+static uint64_t
+latency_counter_get(debug_counter_t *counter)
+{
+    const cxn_latency_hist_t *hist = counter->cookie;
+
+    return latency_stat(hist, counter - hist->counters);
+}
+
+static cxn_latency_hist_t *
+latency_hist_alloc(of_object_id_t object_id)
+{
+    cxn_latency_hist_t *hist;
+    int stat;
+
+    if ((hist = aim_zmalloc(sizeof(*hist))) == NULL) {
+        return NULL;
+    }
+
+    for (stat = 0; stat < CXN_LATENCY_NUM_STATS; stat++) {
+        snprintf(hist->counter_names[stat], sizeof(hist->counter_names[stat]),
+                 "cxn.latency.%s.%s", latency_type_name(object_id),
+                 latency_stats[stat].name);
+        snprintf(hist->counter_descriptions[stat],
+                 sizeof(hist->counter_descriptions[stat]), "%s: %s",
+                 of_object_id_str[object_id], latency_stats[stat].description);
+        debug_counter_register_get(&hist->counters[stat],
+                                   hist->counter_names[stat],
+                                   hist->counter_descriptions[stat],
+                                   latency_counter_get, hist);
+    }
+
+    return hist;
+}
+
+static void
+latency_record(of_object_id_t object_id, uint64_t start_us, uint64_t end_us)
+{
+    cxn_latency_hist_t *hist;
+    uint64_t elapsed;
+    uint32_t us;
+
+    if (object_id < 0 || object_id >= OF_MESSAGE_OBJECT_COUNT) {
+        return;
+    }
+
+    hist = latency_hists[object_id];
+    if (hist == NULL) {
+        if ((hist = latency_hist_alloc(object_id)) == NULL) {
+            return;
+        }
+        latency_hists[object_id] = hist;
+    }
+
+    elapsed = end_us - start_us;
+    us = elapsed > UINT32_MAX ? UINT32_MAX : elapsed;
+
+    hist->count++;
+    hist->total_us += us;
+    if (us > hist->max_us) {
+        hist->max_us = us;
+    }
+    hist->buckets[latency_bucket(us)]++;
+}
+
+/**
+ * Record the latency of a message once its handler returns
+ *
+ * @param cxn The connection the message arrived on
+ * @param object_id Type of the message
+ * @param end_us When the handler returned
+ *
+ * Does nothing if the handler deferred the message with
+ * ind_cxn_latency_defer.
+ */
+
+void
+ind_cxn_latency_handler_done(connection_t *cxn, of_object_id_t object_id,
+                             uint64_t end_us)
+{
+    if (!cxn->latency.deferred) {
+        latency_record(object_id, cxn->latency.start_us, end_us);
+    }
+    cxn->latency.start_us = 0;
+    cxn->latency.deferred = 0;
+}
+
+/**
+ * Defer timing of the message being handled until obj is deleted
+ *
+ * Called when a handler sets up tracking for a copy of its message.
+ * Only the first tracked copy counts. If too many are outstanding the
+ * message is timed to its handler's return as usual.
+ */
+
+void
+ind_cxn_latency_defer(connection_t *cxn, of_object_t *obj)
+{
+    int idx;
+
+    if (cxn->latency.start_us == 0 || cxn->latency.deferred) {
+        return;
+    }
+
+    if (cxn->latency.pending_count == CXN_LATENCY_PENDING_MAX) {
+        return;
+    }
+
+    idx = cxn->latency.pending_count++;
+    cxn->latency.pending[idx].obj = obj;
+    cxn->latency.pending[idx].start_us = cxn->latency.start_us;
+    cxn->latency.deferred = 1;
+}
+
+/**
+ * Record the latency of a deferred message whose tracked copy is deleted
+ */
+
+void
+ind_cxn_latency_object_delete(connection_t *cxn, of_object_t *obj)
+{
+    int idx;
+
+    for (idx = 0; idx < cxn->latency.pending_count; idx++) {
+        if (cxn->latency.pending[idx].obj == obj) {
+            latency_record(obj->object_id, cxn->latency.pending[idx].start_us,
+                           ind_cxn_latency_now_us());
+            cxn->latency.pending[idx] =
+                cxn->latency.pending[--cxn->latency.pending_count];
+            return;
+        }
+    }
+}
+
+/**
+ * Forget deferred messages, for a connection being reset
+ */
+
+void
+ind_cxn_latency_reset(connection_t *cxn)
+{
+    cxn->latency.start_us = 0;
+    cxn->latency.deferred = 0;
+    cxn->latency.pending_count = 0;
+}
+
+/**
+ * Discard all latency results
+ */
+
+void
+ind_cxn_latency_clear(void)
+{
+    int i, stat;
+
+    for (i = 0; i < OF_MESSAGE_OBJECT_COUNT; i++) {
+        if (latency_hists[i] == NULL) {
+            continue;
+        }
+        for (stat = 0; stat < CXN_LATENCY_NUM_STATS; stat++) {
+            debug_counter_unregister(&latency_hists[i]->counters[stat]);
+        }
+        aim_free(latency_hists[i]);
+        latency_hists[i] = NULL;
+    }
+}
+
+/**
+ * Display the latency histograms
+ */
+
+void
+ind_cxn_latency_show(aim_pvs_t *pvs)
+{
+    int i;
+
+    aim_printf(pvs, "%-36s %10s %8s %8s %8s %8s %8s\n", "message", "count",
+               "avg_us", "p50_us", "p90_us", "p99_us", "max_us");
+
+    for (i = 0; i < OF_MESSAGE_OBJECT_COUNT; i++) {
+        const cxn_latency_hist_t *hist = latency_hists[i];
+        if (hist == NULL || hist->count == 0) {
+            continue;
+        }
+        aim_printf(pvs, "%-36s %10"PRIu64" %8"PRIu64" %8u %8u %8u %8u\n",
+                   latency_type_name(i), hist->count,
+                   hist->total_us / hist->count,
+                   latency_percentile(hist, 50), latency_percentile(hist, 90),
+                   latency_percentile(hist, 99), hist->max_us);
+    }
+}
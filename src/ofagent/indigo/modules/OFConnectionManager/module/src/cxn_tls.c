@@ -0,0 +1,408 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+
+/**
+ * @file
+ * @brief TLS transport for connection instances
+ *
+ * The connection instance keeps using its own read buffer and output
+ * queues; this file only replaces the read() and writev() calls on the
+ * socket with their OpenSSL equivalents.
+ *
+ * Client sessions are cached per connection so that reconnecting to the
+ * same controller resumes the session instead of doing a full handshake.
+ */
+
+#include <OFConnectionManager/ofconnectionmanager_config.h>
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+
+#include "ofconnectionmanager_log.h"
+
+#include <string.h>
+#include <sys/uio.h>
+
+#include "cxn_instance.h"
+#include "ofconnectionmanager_int.h"
+
+#include <SocketManager/socketmanager.h>
+#include <indigo/assert.h>
+
+#include <openssl/ssl.h>
+#include <openssl/err.h>
+#include <openssl/x509v3.h>
+
+/* Short hand logging macros */
+#define LOG_ERROR(cxn, fmt, ...)                                        \
+    AIM_LOG_ERROR("cxn %s: " fmt, cxn_ip_string(cxn), ##__VA_ARGS__)
+#define LOG_VERBOSE(cxn, fmt, ...)                                      \
+    AIM_LOG_VERBOSE("cxn %s: " fmt, cxn_ip_string(cxn), ##__VA_ARGS__)
+#define LOG_TRACE(cxn, fmt, ...)                                        \
+    AIM_LOG_TRACE("cxn %s: " fmt, cxn_ip_string(cxn), ##__VA_ARGS__)
+
+/* Session ID context so the server side can resume sessions too */
+#define TLS_SESSION_ID_CONTEXT "indigo"
+
+static SSL_CTX *tls_ctx;
+
+/* Log and clear the OpenSSL error queue */
+static void
+tls_log_errors(const char *what)
+{
+    unsigned long err;
+    char buf[256];
+
+    while ((err = ERR_get_error()) != 0) {
+        ERR_error_string_n(err, buf, sizeof(buf));
+        AIM_LOG_ERROR("%s: %s", what, buf);
+    }
+}
+
+/**
+ * Called by OpenSSL when a client session (or TLS 1.3 ticket) arrives
+ *
+ * Returning 1 keeps the reference, which the connection then owns.
+ */
+static int
+tls_new_session(SSL *ssl, SSL_SESSION *session)
+{
+    connection_t *cxn = SSL_get_app_data(ssl);
+
+    if (cxn == NULL || CXN_LISTEN(cxn)) {
+        return 0;
+    }
+
+    if (cxn->tls_session != NULL) {
+        SSL_SESSION_free(cxn->tls_session);
+    }
+    cxn->tls_session = session;
+    LOG_TRACE(cxn, "Cached TLS session");
+
+    return 1;
+}
+
+static SSL_CTX *
+tls_ctx_create(const char *ca_cert_file, const char *cert_file,
+               const char *key_file)
+{
+    SSL_CTX *ctx;
+
+    if ((ctx = SSL_CTX_new(SSLv23_method())) == NULL) {
+        tls_log_errors("TLS context");
+        return NULL;
+    }
+
+    SSL_CTX_set_options(ctx, SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 |
+                        SSL_OP_NO_TLSv1 | SSL_OP_NO_TLSv1_1 |
+                        SSL_OP_NO_COMPRESSION);
+
+    /* Output queue entries are retried from a moving offset */
+    SSL_CTX_set_mode(ctx, SSL_MODE_ENABLE_PARTIAL_WRITE |
+                     SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_BOTH);
+    SSL_CTX_sess_set_new_cb(ctx, tls_new_session);
+    SSL_CTX_set_session_id_context(
+        ctx, (const unsigned char *)TLS_SESSION_ID_CONTEXT,
+        strlen(TLS_SESSION_ID_CONTEXT));
+
+    if (ca_cert_file != NULL && ca_cert_file[0] != '\0') {
+        if (SSL_CTX_load_verify_locations(ctx, ca_cert_file, NULL) != 1) {
+            tls_log_errors(ca_cert_file);
+            goto error;
+        }
+        SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER |
+                           SSL_VERIFY_FAIL_IF_NO_PEER_CERT, NULL);
+    } else {
+        AIM_LOG_WARN("No TLS CA certificate configured; "
+                     "controller certificates are not verified");
+    }
+
+    if (cert_file != NULL && cert_file[0] != '\0') {
+        if (SSL_CTX_use_certificate_chain_file(ctx, cert_file) != 1) {
+            tls_log_errors(cert_file);
+            goto error;
+        }
+    }
+
+    if (key_file != NULL && key_file[0] != '\0') {
+        if (SSL_CTX_use_PrivateKey_file(ctx, key_file,
+                                        SSL_FILETYPE_PEM) != 1 ||
+            SSL_CTX_check_private_key(ctx) != 1) {
+            tls_log_errors(key_file);
+            goto error;
+        }
+    }
+
+    return ctx;
+
+ error:
+    SSL_CTX_free(ctx);
+    return NULL;
+}
+
+/**
+ * Set the certificates used for new TLS connections
+ *
+ * @param ca_cert_file PEM file of CAs trusted to sign controller
+ * certificates; NULL or empty disables verification
+ * @param cert_file PEM certificate chain presented by the switch
+ * @param key_file PEM private key for cert_file
+ *
+ * Existing connections keep the context they were created with.
+ */
+
+indigo_error_t
+ind_cxn_tls_config_set(const char *ca_cert_file, const char *cert_file,
+                       const char *key_file)
+{
+    SSL_CTX *ctx;
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+    SSL_library_init();
+    SSL_load_error_strings();
+#endif
+
+    if ((ctx = tls_ctx_create(ca_cert_file, cert_file, key_file)) == NULL) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (tls_ctx != NULL) {
+        SSL_CTX_free(tls_ctx);
+    }
+    tls_ctx = ctx;
+
+    return INDIGO_ERROR_NONE;
+}
+
+/**
+ * Start TLS on a newly connected or accepted socket
+ *
+ * The handshake itself is driven by the first reads and writes.
+ */
+
+indigo_error_t
+ind_cxn_tls_start(connection_t *cxn)
+{
+    SSL *ssl;
+
+    INDIGO_ASSERT(cxn->tls == NULL);
+
+    if (tls_ctx == NULL &&
+        ind_cxn_tls_config_set(NULL, NULL, NULL) != INDIGO_ERROR_NONE) {
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    if ((ssl = SSL_new(tls_ctx)) == NULL) {
+        tls_log_errors("TLS connection");
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    if (SSL_set_fd(ssl, cxn->sd) != 1) {
+        tls_log_errors("TLS connection");
+        SSL_free(ssl);
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    SSL_set_app_data(ssl, cxn);
+
+    if (CXN_LISTEN(cxn)) {
+        SSL_set_accept_state(ssl);
+    } else {
+        const char *ip = cxn->protocol_params.tcp_over_ipv4.controller_ip;
+        X509_VERIFY_PARAM_set1_ip_asc(SSL_get0_param(ssl), ip);
+        if (cxn->tls_session != NULL) {
+            SSL_set_session(ssl, cxn->tls_session);
+        }
+        SSL_set_connect_state(ssl);
+    }
+
+    cxn->tls = ssl;
+    cxn->tls_established = 0;
+    cxn->tls_write_wants_read = 0;
+
+    return INDIGO_ERROR_NONE;
+}
+
+/**
+ * Tear down TLS on a connection whose socket is about to be closed
+ */
+
+void
+ind_cxn_tls_close(connection_t *cxn)
+{
+    if (cxn->tls == NULL) {
+        return;
+    }
+
+    /* Best effort close_notify; the socket is non-blocking */
+    if (cxn->tls_established) {
+        (void)SSL_shutdown(cxn->tls);
+    }
+    SSL_free(cxn->tls);
+    ERR_clear_error();
+    cxn->tls = NULL;
+    cxn->tls_established = 0;
+    cxn->tls_write_wants_read = 0;
+}
+
+/**
+ * Forget the cached session, e.g. when the connection is removed
+ */
+
+void
+ind_cxn_tls_session_clear(connection_t *cxn)
+{
+    if (cxn->tls_session != NULL) {
+        SSL_SESSION_free(cxn->tls_session);
+        cxn->tls_session = NULL;
+    }
+}
+
+/* Note the end of the handshake for stats */
+static void
+tls_check_established(connection_t *cxn)
+{
+    if (cxn->tls_established || !SSL_is_init_finished(cxn->tls)) {
+        return;
+    }
+
+    cxn->tls_established = 1;
+    cxn->tls_handshakes++;
+    if (SSL_session_reused(cxn->tls)) {
+        cxn->tls_resumed++;
+    }
+    LOG_VERBOSE(cxn, "TLS established with %s%s", SSL_get_cipher(cxn->tls),
+                SSL_session_reused(cxn->tls) ? ", session resumed" : "");
+}
+
+/**
+ * Read decrypted data from a TLS connection
+ *
+ * @returns Bytes read, 0 if no data is available yet, or
+ * INDIGO_ERROR_CONNECTION if the connection closed or failed
+ */
+
+int
+ind_cxn_tls_read(connection_t *cxn, uint8_t *buf, int len)
+{
+    int rv;
+
+    ERR_clear_error();
+    rv = SSL_read(cxn->tls, buf, len);
+    tls_check_established(cxn);
+
+    if (cxn->tls_write_wants_read) {
+        /* The handshake or a renegotiation may have moved on */
+        cxn->tls_write_wants_read = 0;
+        if (cxn->pkts_enqueued > 0) {
+            CXN_WRITE_READY(cxn->sd);
+        }
+    }
+
+    if (rv > 0) {
+        return rv;
+    }
+
+    switch (SSL_get_error(cxn->tls, rv)) {
+    case SSL_ERROR_WANT_READ:
+        return 0;
+    case SSL_ERROR_WANT_WRITE:
+        CXN_WRITE_READY(cxn->sd);
+        return 0;
+    case SSL_ERROR_ZERO_RETURN:
+        AIM_LOG_INFO("cxn %s: TLS connection closed by remote host",
+                     cxn_ip_string(cxn));
+        return INDIGO_ERROR_CONNECTION;
+    default:
+        LOG_ERROR(cxn, "TLS read failed");
+        tls_log_errors("TLS read");
+        return INDIGO_ERROR_CONNECTION;
+    }
+}
+
+/**
+ * Write a batch of output queue entries over TLS
+ *
+ * @param blocked [out] Index of the iovec OpenSSL holds a partial record
+ * for, or -1. The caller must offer that same data first on the next call.
+ *
+ * @returns Bytes written, or INDIGO_ERROR_UNKNOWN on failure
+ */
+
+int
+ind_cxn_tls_writev(connection_t *cxn, struct iovec *iov, int iovcnt,
+                   int *blocked)
+{
+    int total = 0;
+    int i, rv;
+
+    *blocked = -1;
+
+    for (i = 0; i < iovcnt; i++) {
+        ERR_clear_error();
+        rv = SSL_write(cxn->tls, iov[i].iov_base, iov[i].iov_len);
+        tls_check_established(cxn);
+
+        if (rv > 0) {
+            total += rv;
+            if (rv < (int)iov[i].iov_len) {
+                break;
+            }
+            continue;
+        }
+
+        switch (SSL_get_error(cxn->tls, rv)) {
+        case SSL_ERROR_WANT_WRITE:
+            *blocked = i;
+            break;
+        case SSL_ERROR_WANT_READ:
+            /* Wait for the peer rather than spinning on write ready */
+            *blocked = i;
+            cxn->tls_write_wants_read = 1;
+            CXN_WRITE_CLEAR(cxn->sd);
+            break;
+        default:
+            LOG_ERROR(cxn, "TLS write failed");
+            tls_log_errors("TLS write");
+            if (total == 0) {
+                return INDIGO_ERROR_UNKNOWN;
+            }
+            break;
+        }
+        break;
+    }
+
+    LOG_TRACE(cxn, "TLS wrote %d bytes", total);
+
+    return total;
+}
+
+/**
+ * Decrypted bytes OpenSSL holds that poll() will not report
+ */
+
+int
+ind_cxn_tls_pending(connection_t *cxn)
+{
+    return cxn->tls != NULL ? SSL_pending(cxn->tls) : 0;
+}
+
+#endif /* OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1 */
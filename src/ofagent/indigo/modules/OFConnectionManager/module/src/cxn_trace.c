@@ -0,0 +1,319 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+
+/**
+ * @file
+ * @brief Binary message trace
+ *
+ * Each connection has a bitmap of the message types to trace. A traced
+ * message is copied as received or sent, up to CXN_TRACE_SNAPLEN bytes,
+ * into a ring of the last CXN_TRACE_RECORDS messages along with the time,
+ * connection, direction and full length. Nothing is formatted when a
+ * message is recorded; with tracing off the cost is a flag test.
+ *
+ * The ring is allocated the first time tracing is turned on. It is
+ * written only from the event loop, so it takes no locks.
+ *
+ * Records are decoded with of_object_dump, either from the ring or from
+ * a file written by ind_cxn_trace_save, so a trace taken on a switch can
+ * be read elsewhere. The file is a cxn_trace_file_header_t followed by
+ * the records, oldest first, in host byte order.
+ */
+
+#include "ofconnectionmanager_log.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <loci/loci_obj_dump.h>
+
+#include "cxn_instance.h"
+#include "ofconnectionmanager_int.h"
+
+#define CXN_TRACE_MAGIC "CXNTRACE"
+#define CXN_TRACE_VERSION 1
+
+typedef struct cxn_trace_record_s {
+    uint64_t time_us;
+    uint32_t length;        /* Length of the whole message */
+    uint16_t caplen;        /* Bytes kept in data */
+    int16_t cxn_id;
+    uint8_t dir;            /* CXN_TRACE_IN or CXN_TRACE_OUT */
+    uint8_t pad[7];
+    uint8_t data[CXN_TRACE_SNAPLEN];
+} cxn_trace_record_t;
+
+typedef struct cxn_trace_file_header_s {
+    char magic[8];
+    uint32_t version;
+    uint32_t snaplen;
+    uint32_t count;
+    uint32_t pad;
+} cxn_trace_file_header_t;
+
+static cxn_trace_record_t *trace_ring;
+static uint64_t trace_next;
+
+/* Find the message type with the given name */
+static int
+trace_object_id_lookup(const char *name)
+{
+    int i;
+
+    for (i = 0; i < OF_MESSAGE_OBJECT_COUNT; i++) {
+        if (of_object_id_str[i] && !strcmp(of_object_id_str[i], name)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Turn tracing of a message type on or off for a connection
+ *
+ * @param object_id The message type, or -1 for all types
+ * @param enable Trace if nonzero
+ */
+
+void
+ind_cxn_trace_types_set(connection_t *cxn, int object_id, int enable)
+{
+    int i;
+
+    if (enable && trace_ring == NULL) {
+        trace_ring = aim_zmalloc(CXN_TRACE_RECORDS * sizeof(*trace_ring));
+    }
+
+    if (object_id < 0) {
+        memset(cxn->trace_types, enable ? 0xff : 0, sizeof(cxn->trace_types));
+    } else if (enable) {
+        cxn->trace_types[object_id >> 3] |= 1 << (object_id & 7);
+    } else {
+        cxn->trace_types[object_id >> 3] &= ~(1 << (object_id & 7));
+    }
+
+    cxn->trace_on = 0;
+    for (i = 0; i < sizeof(cxn->trace_types); i++) {
+        if (cxn->trace_types[i]) {
+            cxn->trace_on = 1;
+            break;
+        }
+    }
+}
+
+/**
+ * Same as ind_cxn_trace_set, taking the message type by name
+ */
+
+indigo_error_t
+ind_cxn_trace_set_by_name(indigo_cxn_id_t cxn_id, const char *name,
+                          int enable)
+{
+    int object_id = trace_object_id_lookup(name);
+
+    if (object_id < 0) {
+        return INDIGO_ERROR_NOT_FOUND;
+    }
+    return ind_cxn_trace_set(cxn_id, object_id, enable);
+}
+
+/**
+ * Record a message; the caller has checked CXN_TRACED
+ */
+
+void
+ind_cxn_trace_record(connection_t *cxn, int dir, const uint8_t *buf, int len)
+{
+    cxn_trace_record_t *record;
+
+    if (trace_ring == NULL) {
+        return;
+    }
+
+    record = &trace_ring[trace_next++ & (CXN_TRACE_RECORDS - 1)];
+    record->time_us = ind_cxn_latency_now_us();
+    record->length = len;
+    record->caplen = len < CXN_TRACE_SNAPLEN ? len : CXN_TRACE_SNAPLEN;
+    record->cxn_id = cxn->cxn_id;
+    record->dir = dir;
+    memcpy(record->data, buf, record->caplen);
+}
+
+/**
+ * Forget all recorded messages
+ */
+
+void
+ind_cxn_trace_clear(void)
+{
+    trace_next = 0;
+}
+
+/* Number of records in the ring and the index of the oldest */
+static int
+trace_span(int *first)
+{
+    int count = trace_next < CXN_TRACE_RECORDS ? trace_next : CXN_TRACE_RECORDS;
+
+    *first = (trace_next - count) & (CXN_TRACE_RECORDS - 1);
+    return trace_ring ? count : 0;
+}
+
+static void
+trace_record_dump(aim_pvs_t *pvs, cxn_trace_record_t *record)
+{
+    of_object_storage_t obj_storage;
+    of_object_t *obj = NULL;
+    uint8_t buf[CXN_TRACE_SNAPLEN];
+    of_object_id_t object_id;
+
+    aim_printf(pvs, "%" PRIu64 ".%06" PRIu64 " cxn %d %s len %u",
+               record->time_us / 1000000, record->time_us % 1000000,
+               record->cxn_id, record->dir == CXN_TRACE_IN ? "in " : "out",
+               record->length);
+
+    if (record->caplen < OF_MESSAGE_MIN_LENGTH) {
+        aim_printf(pvs, " (truncated)\n\n");
+        return;
+    }
+
+    memcpy(buf, record->data, record->caplen);
+    object_id = of_message_to_object_id(buf, record->caplen);
+    aim_printf(pvs, " %s xid %u\n",
+               object_id < OF_MESSAGE_OBJECT_COUNT ?
+               of_object_id_str[object_id] : "unknown",
+               of_message_xid_get(buf));
+
+    if (record->caplen == record->length) {
+        obj = of_object_new_from_message_preallocated(&obj_storage, buf,
+                                                      record->caplen);
+    }
+    if (obj != NULL) {
+        of_object_dump((loci_writer_f)aim_printf, pvs, obj);
+    } else {
+        aim_printf(pvs, "  %u of %u bytes captured\n",
+                   record->caplen, record->length);
+    }
+    aim_printf(pvs, "\n");
+}
+
+/**
+ * Decode recorded messages, oldest first
+ *
+ * @param cxn_id Only messages of this connection, or all if negative
+ */
+
+void
+ind_cxn_trace_show(aim_pvs_t *pvs, indigo_cxn_id_t cxn_id)
+{
+    int count, first, i;
+
+    count = trace_span(&first);
+    for (i = 0; i < count; i++) {
+        cxn_trace_record_t *record =
+            &trace_ring[(first + i) & (CXN_TRACE_RECORDS - 1)];
+        if (cxn_id >= 0 && record->cxn_id != cxn_id) {
+            continue;
+        }
+        trace_record_dump(pvs, record);
+    }
+}
+
+/**
+ * Write the recorded messages to a file for ind_cxn_trace_decode
+ */
+
+indigo_error_t
+ind_cxn_trace_save(const char *path)
+{
+    cxn_trace_file_header_t header;
+    int count, first, i;
+    FILE *f;
+
+    if ((f = fopen(path, "w")) == NULL) {
+        AIM_LOG_ERROR("Failed to open trace file %s: %s", path, strerror(errno));
+        return INDIGO_ERROR_UNKNOWN;
+    }
+
+    count = trace_span(&first);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CXN_TRACE_MAGIC, sizeof(header.magic));
+    header.version = CXN_TRACE_VERSION;
+    header.snaplen = CXN_TRACE_SNAPLEN;
+    header.count = count;
+    fwrite(&header, sizeof(header), 1, f);
+
+    for (i = 0; i < count; i++) {
+        fwrite(&trace_ring[(first + i) & (CXN_TRACE_RECORDS - 1)],
+               sizeof(cxn_trace_record_t), 1, f);
+    }
+
+    if (fclose(f) != 0) {
+        AIM_LOG_ERROR("Failed to write trace file %s: %s", path, strerror(errno));
+        return INDIGO_ERROR_UNKNOWN;
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+/**
+ * Decode a file written by ind_cxn_trace_save
+ */
+
+indigo_error_t
+ind_cxn_trace_decode(aim_pvs_t *pvs, const char *path)
+{
+    cxn_trace_file_header_t header;
+    cxn_trace_record_t record;
+    indigo_error_t rv = INDIGO_ERROR_NONE;
+    uint32_t i;
+    FILE *f;
+
+    if ((f = fopen(path, "r")) == NULL) {
+        aim_printf(pvs, "Failed to open %s: %s\n", path, strerror(errno));
+        return INDIGO_ERROR_NOT_FOUND;
+    }
+
+    if (fread(&header, sizeof(header), 1, f) != 1 ||
+        memcmp(header.magic, CXN_TRACE_MAGIC, sizeof(header.magic)) ||
+        header.version != CXN_TRACE_VERSION ||
+        header.snaplen != CXN_TRACE_SNAPLEN) {
+        aim_printf(pvs, "%s is not a trace file of this version\n", path);
+        fclose(f);
+        return INDIGO_ERROR_PARSE;
+    }
+
+    for (i = 0; i < header.count; i++) {
+        if (fread(&record, sizeof(record), 1, f) != 1) {
+            aim_printf(pvs, "%s is truncated after %u records\n", path, i);
+            rv = INDIGO_ERROR_PARSE;
+            break;
+        }
+        if (record.caplen > CXN_TRACE_SNAPLEN) {
+            record.caplen = CXN_TRACE_SNAPLEN;
+        }
+        trace_record_dump(pvs, &record);
+    }
+
+    fclose(f);
+    return rv;
+}
@@ -33,9 +33,11 @@
 #include <indigo/of_state_manager.h>
 #include <indigo/memory.h>
 #include <indigo/assert.h>
+#include <indigo/debug_counter.h>
 
 #include <loci/loci_dump.h>
 #include <loci/loci_show.h>
+#include <loci/loci_validator.h>
 
 #include <cjson/cJSON.h>
 
@@ -79,6 +81,12 @@ int successful_handshakes; /* Number of times handshake completes */
 
 uint32_t ind_cxn_internal_errors;
 
+/* Async message drops summed over all connections */
+static debug_counter_t packet_in_drop_counter;
+static debug_counter_t packet_in_rate_drop_counter;
+static debug_counter_t flow_removed_drop_counter;
+static debug_counter_t internal_errors_counter;
+
 uint64_t ind_cxn_generation_id;
 
 /****************************************************************
@@ -86,16 +94,69 @@ uint64_t ind_cxn_generation_id;
  ****************************************************************/
 static ind_cxn_config_t cxn_config;
 
-/* @fixme Make this a module parameter */
-#define MAX_CONTROLLER_CONNECTIONS 32
+/* Connection ids are packed into 16 bits in cookies; see cxn_to_cookie */
+#define MAX_CONTROLLER_CONNECTIONS 0x10000
 
 /**
  * Connection control blocks, indexed by connection index
+ *
+ * The table grows as connections are added. A control block is never
+ * freed or moved once allocated, since timers and socket callbacks hold
+ * pointers to it; an inactive one is reused by the next connection.
+ */
+static connection_t **connection;
+static int connection_slots;
+
+/**
+ * Dense lists of connections, sorted by connection id
+ *
+ * active_cxns holds the active connections and async_cxns the remote ones
+ * that completed their handshake, which are the only ones async messages
+ * can go to. Both are kept up to date on activation and state change, so
+ * walking them costs nothing for the unused slots of the table.
  */
-static connection_t connection[MAX_CONTROLLER_CONNECTIONS];
+typedef struct cxn_list_s {
+    connection_t **items;
+    int count;
+    int size;
+} cxn_list_t;
 
-#define CXN_ID_ACTIVE(cxn_id) CXN_ACTIVE(&connection[cxn_id])
-#define CXN_ID_TCP_CONNECTED(cxn_id) CXN_TCP_CONNECTED(&connection[cxn_id])
+static cxn_list_t active_cxns;
+static cxn_list_t async_cxns;
+
+/**
+ * Connections subscribed to each kind of async message
+ *
+ * Computed from async_cxns with ind_cxn_accepts_async_message and
+ * rebuilt on first use after anything it depends on changes: a state
+ * change, activation, or a role change. Fan-out then walks only the
+ * subscribers rather than deciding per connection per message.
+ */
+enum {
+    CXN_ASYNC_PACKET_IN,
+    CXN_ASYNC_FLOW_REMOVED,
+    CXN_ASYNC_OTHER,
+    CXN_ASYNC_COUNT
+};
+
+static cxn_list_t async_subscribers[CXN_ASYNC_COUNT];
+static int async_subscribers_stale = 1;
+
+/* Scratch target list for indigo_cxn_send_async_message */
+static connection_t **async_targets;
+static int async_targets_size;
+
+/**
+ * Packet-in rate limit applied to every connection; set from config
+ */
+static struct {
+    uint32_t rate;      /* Packets per second per bucket; 0 for no limit */
+    uint32_t burst;     /* Bucket depth in packets */
+    int by_table;       /* Key buckets on table ID rather than reason */
+} packet_in_limit;
+
+#define CXN_ID_ACTIVE(cxn_id) CXN_ACTIVE(connection[cxn_id])
+#define CXN_ID_TCP_CONNECTED(cxn_id) CXN_TCP_CONNECTED(connection[cxn_id])
 
 #if 0
 /**
@@ -120,44 +181,128 @@ static int preferred_cxn_id = -1;
 #define INVALID_CXN_ID -1
 
 #define CXN_ID_VALID(cxn_id)                                        \
-    (((cxn_id) >= 0) && ((cxn_id) < MAX_CONTROLLER_CONNECTIONS))
+    (((cxn_id) >= 0) && ((cxn_id) < connection_slots))
 
 #define CXN_TO_CXN_ID(cxn) ((cxn)->cxn_id)
 
 #define ACTIVE_ENTRY(cxn_id)                                \
-    (CXN_ID_VALID(cxn_id) && (connection[cxn_id].active))
+    (CXN_ID_VALID(cxn_id) && (connection[cxn_id]->active))
 
 #define TCP_CONNECTED_ENTRY(cxn_id)                                     \
-    (ACTIVE_ENTRY(cxn_id) && (CXN_TCP_CONNECTED(&connection[cxn_id])))
+    (ACTIVE_ENTRY(cxn_id) && (CXN_TCP_CONNECTED(connection[cxn_id])))
+
+/*
+ * Walk a connection list in id order. The next entry is looked up by id,
+ * so the body may add or remove connections, including the current one.
+ */
+#define FOREACH_CXN_IN_LIST(list, cxn_id, cxn)                          \
+    for (cxn = cxn_list_next(list, INVALID_CXN_ID);                     \
+         cxn != NULL && ((cxn_id) = CXN_TO_CXN_ID(cxn)) >= 0;           \
+         cxn = cxn_list_next(list, cxn_id))
 
 /* Includes local connection */
 #define FOREACH_ACTIVE_CXN(cxn_id, cxn)                                 \
-    for (cxn_id = 0, cxn = &connection[0];                              \
-         cxn_id < MAX_CONTROLLER_CONNECTIONS;                           \
-         ++cxn_id, cxn = &connection[cxn_id])                           \
-        if (CXN_ACTIVE(cxn))
+    FOREACH_CXN_IN_LIST(&active_cxns, cxn_id, cxn)
 
 /* Only remote connections */
 #define FOREACH_REMOTE_ACTIVE_CXN(cxn_id, cxn)                          \
-    for (cxn_id = 0, cxn = &connection[0];                              \
-         cxn_id < MAX_CONTROLLER_CONNECTIONS;                           \
-         ++cxn_id, cxn = &connection[cxn_id])                           \
-        if (CXN_ACTIVE(cxn) && !((cxn)->config_params.local))
+    FOREACH_CXN_IN_LIST(&active_cxns, cxn_id, cxn)                      \
+        if (!((cxn)->config_params.local))
+
+/* Remote connections which completed hand-shake */
+#define FOREACH_ASYNC_CXN(cxn_id, cxn)                                  \
+    FOREACH_CXN_IN_LIST(&async_cxns, cxn_id, cxn)
 
 /* All remote connections which completed hand-shake and with requested role */
 #define FOREACH_HS_COMPLETE_CXN_WITH_ROLE(cxn_id, cxn, cxn_role)        \
-    for (cxn_id = 0, cxn = &connection[0];                              \
-         cxn_id < MAX_CONTROLLER_CONNECTIONS;                           \
-         ++cxn_id, cxn = &connection[cxn_id])                           \
-        if (CXN_ACTIVE(cxn) && !(cxn->config_params.local) &&           \
-            (cxn->status.role == cxn_role) &&                           \
-            (cxn->status.state == INDIGO_CXN_S_HANDSHAKE_COMPLETE))
+    FOREACH_ASYNC_CXN(cxn_id, cxn)                                      \
+        if (cxn->status.role == cxn_role)
 
 /**
  * Convert connection ID to pointer to cxn block
  */
 
-#define CXN_ID_TO_CONNECTION(cxn_id) (&connection[cxn_id])
+#define CXN_ID_TO_CONNECTION(cxn_id) (connection[cxn_id])
+
+/* Index of the first entry with an id not below cxn_id */
+static int
+cxn_list_search(const cxn_list_t *list, indigo_cxn_id_t cxn_id)
+{
+    int lo = 0, hi = list->count;
+
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (list->items[mid]->cxn_id < cxn_id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/* First connection in the list with an id above cxn_id, or NULL */
+static connection_t *
+cxn_list_next(const cxn_list_t *list, indigo_cxn_id_t cxn_id)
+{
+    int idx = cxn_list_search(list, cxn_id + 1);
+
+    return idx < list->count ? list->items[idx] : NULL;
+}
+
+static void
+cxn_list_add(cxn_list_t *list, connection_t *cxn)
+{
+    int idx = cxn_list_search(list, cxn->cxn_id);
+
+    if (idx < list->count && list->items[idx] == cxn) {
+        return;
+    }
+
+    if (list->count == list->size) {
+        list->size = list->size ? list->size * 2 : 8;
+        list->items = aim_realloc(list->items,
+                                  list->size * sizeof(list->items[0]));
+    }
+
+    memmove(&list->items[idx + 1], &list->items[idx],
+            (list->count - idx) * sizeof(list->items[0]));
+    list->items[idx] = cxn;
+    list->count++;
+}
+
+static void
+cxn_list_remove(cxn_list_t *list, connection_t *cxn)
+{
+    int idx = cxn_list_search(list, cxn->cxn_id);
+
+    if (idx == list->count || list->items[idx] != cxn) {
+        return;
+    }
+
+    list->count--;
+    memmove(&list->items[idx], &list->items[idx + 1],
+            (list->count - idx) * sizeof(list->items[0]));
+}
+
+/**
+ * Mark a connection active or inactive
+ *
+ * All changes to cxn->active go through here to keep the lists current.
+ */
+void
+ind_cxn_active_set(connection_t *cxn, int active)
+{
+    async_subscribers_stale = 1;
+    cxn->active = active;
+    if (active) {
+        cxn_list_add(&active_cxns, cxn);
+    } else {
+        cxn_list_remove(&active_cxns, cxn);
+        cxn_list_remove(&async_cxns, cxn);
+    }
+}
 
 
 #define GEN_ID_SHIFT 16
@@ -201,7 +346,7 @@ connection_t* cookie_to_cxn(void* cookie)
 static inline char *
 cxn_id_ip_string(indigo_cxn_id_t cxn_id)
 {
-    return proto_ip_string(&connection[cxn_id].protocol_params);
+    return proto_ip_string(&connection[cxn_id]->protocol_params);
 }
 
 /**
@@ -345,6 +490,14 @@ ind_cxn_status_change(connection_t *cxn)
     int idx;
     indigo_cxn_status_change_f callback;
 
+    async_subscribers_stale = 1;
+    if (!cxn->config_params.local && CXN_ACTIVE(cxn) &&
+        CONNECTION_STATE(cxn) == INDIGO_CXN_S_HANDSHAKE_COMPLETE) {
+        cxn_list_add(&async_cxns, cxn);
+    } else {
+        cxn_list_remove(&async_cxns, cxn);
+    }
+
     /* Notify registered callbacks */
     FOREACH_STATUS_CALLBACK(idx, callback, cookie) {
         callback(cxn->cxn_id,
@@ -418,6 +571,11 @@ ind_cxn_status_notify(void)
  *
  ****************************************************************/
 
+static uint64_t
+internal_errors_get(debug_counter_t *counter)
+{
+    return ind_cxn_internal_errors;
+}
 
 /**
  * Clear all state for the module
@@ -425,33 +583,71 @@ ind_cxn_status_notify(void)
 static int
 module_init(void)
 {
-    int idx;
-
-    INDIGO_MEM_CLEAR(connection, sizeof(connection));
+    connection = NULL;
+    connection_slots = 0;
+    INDIGO_MEM_CLEAR(&active_cxns, sizeof(active_cxns));
+    INDIGO_MEM_CLEAR(&async_cxns, sizeof(async_cxns));
     INDIGO_MEM_CLEAR(status_change, sizeof(status_change));
-    for (idx = 0; idx < MAX_CONTROLLER_CONNECTIONS; ++idx) {
-        connection[idx].cxn_id = (indigo_cxn_id_t)idx;
-    }
 
     ind_cfg_register(&ind_cxn_cfg_ops);
 
+    debug_counter_register(&packet_in_drop_counter, "cxn.packet_in_drops",
+                           "Packet ins dropped by connection role or config");
+    debug_counter_register(&packet_in_rate_drop_counter,
+                           "cxn.packet_in_rate_drops",
+                           "Packet ins dropped over the rate limit");
+    debug_counter_register(&flow_removed_drop_counter,
+                           "cxn.flow_removed_drops",
+                           "Flow removed messages dropped by connection role or config");
+    debug_counter_register_get(&internal_errors_counter,
+                               "cxn.internal_errors",
+                               "Connection manager internal errors",
+                               internal_errors_get, NULL);
+
     ind_cxn_generation_id = 0;
 
     LOG_VERBOSE("Initial generation id: 0x%016"PRIx64, ind_cxn_generation_id);
 
+    /* Outgoing message buffers are released with of_alloc_free */
+    of_alloc_enable_set(1);
+
     return INDIGO_ERROR_NONE;
 }
 
+/**
+ * Find an inactive control block, growing the table if there is none
+ *
+ * Only called when adding a connection, so the scan is not on any
+ * per-message path.
+ */
 static indigo_cxn_id_t
 find_free_connection(void) {
-    int idx;
-    for (idx = 0; idx < MAX_CONTROLLER_CONNECTIONS; ++idx) {
-        if (!connection[idx].active) {
+    int idx, slots;
+
+    for (idx = 0; idx < connection_slots; ++idx) {
+        if (!connection[idx]->active) {
             return (indigo_cxn_id_t)idx;
         }
     }
 
-    return INVALID_CXN_ID;
+    if (connection_slots == MAX_CONTROLLER_CONNECTIONS) {
+        return INVALID_CXN_ID;
+    }
+
+    slots = connection_slots ? connection_slots * 2 : 8;
+    slots = aim_imin(slots, MAX_CONTROLLER_CONNECTIONS);
+    connection = aim_realloc(connection, slots * sizeof(connection[0]));
+    for (idx = connection_slots; idx < slots; ++idx) {
+        connection[idx] = aim_zmalloc(sizeof(connection_t));
+        connection[idx]->cxn_id = (indigo_cxn_id_t)idx;
+        connection[idx]->sd = -1;
+        connection[idx]->read_buffer = aim_malloc(READ_BUFFER_SIZE);
+    }
+
+    idx = connection_slots;
+    connection_slots = slots;
+
+    return (indigo_cxn_id_t)idx;
 }
 
 /* @fixme What should the cxn backlog be? */
@@ -548,10 +744,11 @@ connection_socket_setup(indigo_cxn_protocol_params_t *protocol_params,
     }
 
     ind_cxn_disconnected_init(cxn);
+    cxn->fail_count = 0;
 
     if (sd < 0) {
         /* Attempt to create the socket */
-        cxn->sd = socket(AF_INET, SOCK_STREAM, 0);
+        cxn->sd = socket(AF_INET, CXN_UDP(cxn) ? SOCK_DGRAM : SOCK_STREAM, 0);
         if (cxn->sd < 0) {
             LOG_ERROR("Failed to create controller connection socket: %s", strerror(errno));
             return NULL;
@@ -569,7 +766,7 @@ connection_socket_setup(indigo_cxn_protocol_params_t *protocol_params,
     }
 
     /* Disable Nagle's algorithm */
-    {
+    if (!CXN_UDP(cxn)) {
         int flag = 1;
         (void) setsockopt(cxn->sd, IPPROTO_TCP, TCP_NODELAY,
                           (char *) &flag, sizeof(int));
@@ -578,7 +775,7 @@ connection_socket_setup(indigo_cxn_protocol_params_t *protocol_params,
     LOG_VERBOSE("Created non-blocking socket %d for %s",
                 cxn->sd, cxn_id_ip_string(*cxn_id));
 
-    cxn->active = 1;
+    ind_cxn_active_set(cxn, 1);
     if (sd >= 0) { /* Assume connection is good to go */
         /* Set state to connecting */
         ind_cxn_state_set(cxn, INDIGO_CXN_S_CONNECTING);
@@ -627,12 +824,30 @@ indigo_cxn_connection_add(indigo_cxn_protocol_params_t *protocol_params,
         return INDIGO_ERROR_PARAM;
     }
 
-    if (protocol_params->header.protocol != INDIGO_CXN_PROTO_TCP_OVER_IPV4) {
+    if (protocol_params->header.protocol != INDIGO_CXN_PROTO_TCP_OVER_IPV4
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+        && protocol_params->header.protocol != INDIGO_CXN_PROTO_TLS_OVER_IPV4
+#endif
+        && protocol_params->header.protocol != INDIGO_CXN_PROTO_UDP_OVER_IPV4
+        ) {
         LOG_ERROR("Unsupported protocol for connection add: %d",
                      protocol_params->header.protocol);
         return INDIGO_ERROR_NOT_SUPPORTED;
     }
 
+    if (config_params->auxiliary_id != 0) {
+        if (config_params->local || config_params->listen ||
+            config_params->version < OF_VERSION_1_3) {
+            LOG_ERROR("Auxiliary connections must be active OpenFlow 1.3 "
+                      "remote connections");
+            return INDIGO_ERROR_PARAM;
+        }
+    } else if (protocol_params->header.protocol ==
+               INDIGO_CXN_PROTO_UDP_OVER_IPV4) {
+        LOG_ERROR("UDP is only supported for auxiliary connections");
+        return INDIGO_ERROR_NOT_SUPPORTED;
+    }
+
     cxn = connection_socket_setup(protocol_params, config_params, cxn_id, -1);
 
     if (cxn == NULL) {
@@ -643,7 +858,7 @@ indigo_cxn_connection_add(indigo_cxn_protocol_params_t *protocol_params,
             rv = listen_cxn_init(cxn);
             if (rv != INDIGO_ERROR_NONE) {
                 /* @fixme clean up connection? */
-                cxn->active = 0;
+                ind_cxn_active_set(cxn, 0);
             }
         } else {
             LOG_INFO("Added remote connection: %s", cxn_ip_string(cxn));
@@ -665,13 +880,13 @@ indigo_cxn_connection_remove(indigo_cxn_id_t cxn_id)
 
     LOG_INFO("Connection remove: %s", cxn_id_ip_string(cxn_id));
 
-    if (CONNECTION_STATE(&connection[cxn_id]) != INDIGO_CXN_S_DISCONNECTED) {
-        connection[cxn_id].flags |= CXN_TO_BE_REMOVED;
-        ind_cxn_disconnect(&connection[cxn_id]);
+    if (CONNECTION_STATE(connection[cxn_id]) != INDIGO_CXN_S_DISCONNECTED) {
+        connection[cxn_id]->flags |= CXN_TO_BE_REMOVED;
+        ind_cxn_disconnect(connection[cxn_id]);
     } else {
         ind_soc_timer_event_unregister(ind_cxn_connection_retry_timer,
-                                       &connection[cxn_id]);
-        connection[cxn_id].active = 0;
+                                       connection[cxn_id]);
+        ind_cxn_active_set(connection[cxn_id], 0);
     }
 
     /* @fixme If no connections active, turn off periodic timeout */
@@ -690,7 +905,7 @@ indigo_cxn_connection_config_get(
         return INDIGO_ERROR_PARAM;
     }
 
-    INDIGO_MEM_COPY(config, &connection[cxn_id].config_params,
+    INDIGO_MEM_COPY(config, &connection[cxn_id]->config_params,
                     sizeof(*config));
 
     return INDIGO_ERROR_NONE;
@@ -707,7 +922,7 @@ indigo_cxn_connection_status_get(
         return INDIGO_ERROR_PARAM;
     }
 
-    INDIGO_MEM_COPY(status, &connection[cxn_id].status, sizeof(*status));
+    INDIGO_MEM_COPY(status, &connection[cxn_id]->status, sizeof(*status));
 
     return INDIGO_ERROR_NONE;
 }
@@ -738,6 +953,19 @@ ind_cxn_send_role_status(connection_t *cxn, int reason)
     }
 }
 
+/**
+ * Set a connection's role
+ *
+ * All role changes of a connection that is up go through here, since
+ * the async subscriptions depend on them.
+ */
+void
+ind_cxn_role_set(connection_t *cxn, indigo_cxn_role_t role)
+{
+    cxn->status.role = role;
+    async_subscribers_stale = 1;
+}
+
 /**
  * Change the master connection
  *
@@ -750,13 +978,13 @@ ind_cxn_change_master(indigo_cxn_id_t master_id)
 {
     indigo_cxn_id_t cxn_id;
     connection_t *cxn;
-    FOREACH_REMOTE_ACTIVE_CXN(cxn_id, cxn) {
+    FOREACH_ASYNC_CXN(cxn_id, cxn) {
         if (cxn->cxn_id == master_id) {
             LOG_INFO("Upgrading cxn %s to master", cxn_id_ip_string(cxn_id));
-            cxn->status.role = INDIGO_CXN_R_MASTER;
+            ind_cxn_role_set(cxn, INDIGO_CXN_R_MASTER);
         } else if (cxn->status.role == INDIGO_CXN_R_MASTER) {
             LOG_INFO("Downgrading cxn %s to slave", cxn_id_ip_string(cxn_id));
-            cxn->status.role = INDIGO_CXN_R_SLAVE;
+            ind_cxn_role_set(cxn, INDIGO_CXN_R_SLAVE);
             ind_cxn_send_role_status(
                 cxn, OFP_BSN_CONTROLLER_ROLE_REASON_MASTER_REQUEST);
         }
@@ -805,14 +1033,19 @@ ind_cxn_populate_connection_list(of_list_bsn_controller_connection_t *list)
 
         memset(uri, 0, sizeof(uri));
 
-        if (cxn->protocol_params.header.protocol == INDIGO_CXN_PROTO_TCP_OVER_IPV4) {
+        if (cxn->protocol_params.header.protocol == INDIGO_CXN_PROTO_TCP_OVER_IPV4 ||
+            cxn->protocol_params.header.protocol == INDIGO_CXN_PROTO_TLS_OVER_IPV4 ||
+            cxn->protocol_params.header.protocol == INDIGO_CXN_PROTO_UDP_OVER_IPV4) {
             indigo_cxn_params_tcp_over_ipv4_t *proto =
                 &cxn->protocol_params.tcp_over_ipv4;
-            snprintf(uri, sizeof(uri), "tcp://%s:%d",
+            snprintf(uri, sizeof(uri), "%s://%s:%d",
+                CXN_TLS(cxn) ? "tls" : CXN_UDP(cxn) ? "udp" : "tcp",
                 proto->controller_ip, proto->controller_port);
         }
 
         of_bsn_controller_connection_uri_set(&entry, uri);
+        of_bsn_controller_connection_auxiliary_id_set(
+            &entry, cxn->config_params.auxiliary_id);
     }
 }
 
@@ -828,48 +1061,124 @@ ind_cxn_populate_connection_list(of_list_bsn_controller_connection_t *list)
                            ((obj)->object_id == OF_PORT_STATUS) ||  \
                            ((obj)->object_id == OF_FLOW_REMOVED))
 
-/* Send an OpenFlow message to a controller connection
- *
- * This routine takes ownership of the object.
+/**
+ * Output queue class for a message
+ */
+static cxn_output_class_t
+output_class_get(of_object_t *obj)
+{
+    switch (obj->object_id) {
+    case OF_ECHO_REQUEST:
+    case OF_ECHO_REPLY:
+        return CXN_OUTPUT_CLASS_ECHO;
+    case OF_PORT_STATUS:
+        return CXN_OUTPUT_CLASS_PORT_STATUS;
+    case OF_FLOW_REMOVED:
+        return CXN_OUTPUT_CLASS_FLOW_REMOVED;
+    case OF_PACKET_IN:
+        return CXN_OUTPUT_CLASS_PACKET_IN;
+    default:
+        return CXN_OUTPUT_CLASS_CONTROL;
+    }
+}
+
+/**
+ * Charge a packet-in against its token bucket
  *
- * In some cases the message may be dropped.
+ * @returns 1 if the bucket for the packet's reason (or table) is empty
  */
-void
-indigo_cxn_send_controller_message(indigo_cxn_id_t cxn_id, of_object_t *obj)
+static int
+packet_in_rate_exceeded(connection_t *cxn, of_packet_in_t *obj)
 {
-    uint8_t *data = NULL;
-    int len;
-    connection_t *cxn;
-    uint32_t xid;
+    cxn_token_bucket_t *bucket;
+    indigo_time_t now;
+    uint64_t depth;
+    uint8_t key;
+    int elapsed;
 
-    if (INDIGO_CXN_INVALID(cxn_id)) {
-        LOG_ERROR("Invalid or no active connection: %d", cxn_id);
-        goto done;
+    if (packet_in_limit.rate == 0) {
+        return 0;
     }
 
-    cxn = CXN_ID_TO_CONNECTION(cxn_id);
-    if (!CXN_TCP_CONNECTED(cxn)) {
-        LOG_ERROR("Connection id %d is not connected", cxn_id);
-        goto done;
+    if (packet_in_limit.by_table && obj->version >= OF_VERSION_1_1) {
+        of_packet_in_table_id_get(obj, &key);
+    } else {
+        of_packet_in_reason_get(obj, &key);
     }
 
-    xid = of_message_xid_get(OF_BUFFER_TO_MESSAGE(OF_OBJECT_BUFFER_INDEX(obj, 0)));
+    bucket = &cxn->packet_in_buckets[key];
+    depth = (uint64_t)packet_in_limit.burst * 1000;
+    now = INDIGO_CURRENT_TIME;
 
-    LOG_VERBOSE("cxn %s: Sending %s message xid %u",
-                cxn_ip_string(cxn), of_object_id_str[obj->object_id], xid);
+    if (bucket->last == 0) {
+        bucket->tokens = depth;
+    } else {
+        elapsed = INDIGO_TIME_DIFF_ms(bucket->last, now);
+        if (elapsed > 0) {
+            bucket->tokens += (uint64_t)elapsed * packet_in_limit.rate;
+        }
+        if (bucket->tokens > depth) {
+            bucket->tokens = depth;
+        }
+    }
+    bucket->last = now;
+
+    if (bucket->tokens < 1000) {
+        return 1;
+    }
+    bucket->tokens -= 1000;
 
-    if(cxn->trace_pvs) {
-        aim_printf(cxn->trace_pvs, "** of_msg_trace: send to cxn=%d\n", cxn->cxn_id);
-        of_object_dump((loci_writer_f)aim_printf, cxn->trace_pvs, obj);
-        aim_printf(cxn->trace_pvs, "**\n\n");
+    return 0;
+}
+
+/**
+ * Set the packet-in rate limit for all connections
+ *
+ * @param rate Packets per second allowed per bucket; 0 disables the limit
+ * @param burst Bucket depth in packets; 0 means the same as rate
+ * @param by_table Keep a bucket per table ID instead of per reason
+ */
+void
+ind_cxn_packet_in_limit_set(uint32_t rate, uint32_t burst, int by_table)
+{
+    int idx;
+
+    packet_in_limit.rate = rate;
+    packet_in_limit.burst = burst ? burst : rate;
+    packet_in_limit.by_table = by_table;
+
+    /* Start every bucket full under the new limit */
+    for (idx = 0; idx < connection_slots; idx++) {
+        memset(connection[idx]->packet_in_buckets, 0,
+               sizeof(connection[idx]->packet_in_buckets));
+    }
+}
+
+/**
+ * Per-connection checks and accounting for an outgoing message
+ *
+ * @returns 1 if the message should be enqueued on cxn, 0 if it is dropped
+ */
+static int
+cxn_send_admit(connection_t *cxn, of_object_t *obj)
+{
+    if (AIM_LOG_ENABLED(VERBOSE)) {
+        LOG_VERBOSE("cxn %s: Sending %s message xid %u",
+                    cxn_ip_string(cxn), of_object_id_str[obj->object_id],
+                    of_message_xid_get(OF_BUFFER_TO_MESSAGE(
+                        OF_OBJECT_BUFFER_INDEX(obj, 0))));
     }
 
+    if (CXN_TRACED(cxn, obj->object_id)) {
+        ind_cxn_trace_record(cxn, CXN_TRACE_OUT,
+                             OF_OBJECT_BUFFER_INDEX(obj, 0), obj->length);
+    }
 
     if (!CXN_HANDSHAKE_COMPLETE(cxn)) {
         if (IS_ASYNC_MSG(obj)) {
             LOG_TRACE("Handshake not complete; drop async msg %s",
                       of_object_id_str[obj->object_id]);
-            goto done;
+            return 0;
         }
     }
 
@@ -879,22 +1188,24 @@ indigo_cxn_send_controller_message(indigo_cxn_id_t cxn_id, of_object_t *obj)
         if (CXN_DROP_PACKET_IN(cxn, obj)) {
             LOG_TRACE("Dropping packetIn");
             cxn->status.packet_in_drop++;
-            goto done;
+            debug_counter_inc(&packet_in_drop_counter);
+            return 0;
+        }
+        if (packet_in_rate_exceeded(cxn, obj)) {
+            LOG_TRACE("Dropping packetIn over rate limit");
+            cxn->status.packet_in_rate_drop++;
+            debug_counter_inc(&packet_in_rate_drop_counter);
+            return 0;
         }
     } else if (obj->object_id == OF_FLOW_REMOVED) {
         if (CXN_DROP_FLOW_REMOVED(cxn, obj)) {
             LOG_TRACE("Dropping flowRemoved");
             cxn->status.flow_removed_drop++;
-            goto done;
+            debug_counter_inc(&flow_removed_drop_counter);
+            return 0;
         }
     }
 
-    /* Steal the buffer and enqueue the data */
-    LOG_OBJECT(obj);
-
-    of_object_wire_buffer_steal((of_object_t *)obj, &data);
-    len = obj->length;
-
     if (IS_MSG_OBJ(obj)) {
         cxn->messages_out_by_type[obj->object_id]++;
     } else {
@@ -902,9 +1213,50 @@ indigo_cxn_send_controller_message(indigo_cxn_id_t cxn_id, of_object_t *obj)
         cxn->messages_out_unknown++;
     }
 
-    if (ind_cxn_instance_enqueue(cxn, data, len) < 0) {
+    return 1;
+}
+
+/* Send an OpenFlow message to a controller connection
+ *
+ * This routine takes ownership of the object.
+ *
+ * In some cases the message may be dropped.
+ */
+void
+indigo_cxn_send_controller_message(indigo_cxn_id_t cxn_id, of_object_t *obj)
+{
+    uint8_t *data = NULL;
+    int len;
+    connection_t *cxn;
+
+    if (INDIGO_CXN_INVALID(cxn_id)) {
+        LOG_ERROR("Invalid or no active connection: %d", cxn_id);
+        goto done;
+    }
+
+    cxn = CXN_ID_TO_CONNECTION(cxn_id);
+    if (!CXN_TCP_CONNECTED(cxn)) {
+        LOG_ERROR("Connection id %d is not connected", cxn_id);
+        goto done;
+    }
+
+    if (!cxn_send_admit(cxn, obj)) {
+        goto done;
+    }
+
+    if (obj->object_id == OF_FEATURES_REPLY && obj->version >= OF_VERSION_1_3) {
+        of_features_reply_auxiliary_id_set(obj, cxn->config_params.auxiliary_id);
+    }
+
+    /* Steal the buffer and enqueue the data */
+    LOG_OBJECT(obj);
+
+    of_object_wire_buffer_steal((of_object_t *)obj, &data);
+    len = obj->length;
+
+    if (ind_cxn_instance_enqueue(cxn, data, len, output_class_get(obj)) < 0) {
         LOG_ERROR("Could not enqueue message data, disconnecting");
-        aim_free(data);
+        of_alloc_free(data);
         ind_cxn_disconnect(cxn);
     }
 
@@ -919,12 +1271,81 @@ indigo_cxn_send_controller_message(indigo_cxn_id_t cxn_id, of_object_t *obj)
     of_object_delete(obj);
 }
 
+/**
+ * Find the main connection an auxiliary connection belongs to
+ *
+ * That is the non-auxiliary remote connection to the same controller IP.
+ */
+connection_t *
+ind_cxn_main_get(const connection_t *aux)
+{
+    indigo_cxn_id_t cxn_id;
+    connection_t *cxn;
+
+    FOREACH_REMOTE_ACTIVE_CXN(cxn_id, cxn) {
+        if (cxn != aux && !CXN_AUXILIARY(cxn) && !CXN_LISTEN(cxn) &&
+            !strcmp(cxn->protocol_params.tcp_over_ipv4.controller_ip,
+                    aux->protocol_params.tcp_over_ipv4.controller_ip)) {
+            return cxn;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Close the auxiliary connections of a main connection going down
+ */
+void
+ind_cxn_auxiliaries_disconnect(connection_t *main_cxn)
+{
+    indigo_cxn_id_t cxn_id;
+    connection_t *cxn;
+
+    FOREACH_REMOTE_ACTIVE_CXN(cxn_id, cxn) {
+        if (CXN_AUXILIARY(cxn) && CXN_TCP_CONNECTED(cxn) &&
+            ind_cxn_main_get(cxn) == main_cxn) {
+            LOG_VERBOSE("Closing auxiliary connection %s with its main",
+                        cxn_ip_string(cxn));
+            ind_cxn_disconnect(cxn);
+        }
+    }
+}
+
+/**
+ * Find the auxiliary connection that takes a main connection's packet-ins
+ *
+ * The one with the lowest auxiliary ID that has completed its handshake.
+ */
+static connection_t *
+packet_in_auxiliary_get(const connection_t *main_cxn)
+{
+    indigo_cxn_id_t cxn_id;
+    connection_t *cxn, *best = NULL;
+
+    FOREACH_REMOTE_ACTIVE_CXN(cxn_id, cxn) {
+        if (CXN_AUXILIARY(cxn) && CXN_HANDSHAKE_COMPLETE(cxn) &&
+            (best == NULL ||
+             cxn->config_params.auxiliary_id < best->config_params.auxiliary_id) &&
+            ind_cxn_main_get(cxn) == main_cxn) {
+            best = cxn;
+        }
+    }
+
+    return best;
+}
+
 /**
  * Check whether the given connection is interested in the message.
+ *
+ * Packet-ins go to a main connection's auxiliary connection when it has
+ * one up; auxiliary connections take nothing else.
  */
 int
 ind_cxn_accepts_async_message(const connection_t *cxn, const of_object_t *obj)
 {
+    indigo_cxn_role_t role = cxn->status.role;
+
     if (CONNECTION_STATE(cxn) != INDIGO_CXN_S_HANDSHAKE_COMPLETE) {
         return 0;
     }
@@ -933,7 +1354,20 @@ ind_cxn_accepts_async_message(const connection_t *cxn, const of_object_t *obj)
         return 0;
     }
 
-    if (cxn->status.role == INDIGO_CXN_R_SLAVE) {
+    if (CXN_AUXILIARY(cxn)) {
+        connection_t *main_cxn = ind_cxn_main_get(cxn);
+        if (obj->object_id != OF_PACKET_IN || main_cxn == NULL ||
+            !CXN_HANDSHAKE_COMPLETE(main_cxn) ||
+            packet_in_auxiliary_get(main_cxn) != cxn) {
+            return 0;
+        }
+        role = main_cxn->status.role;
+    } else if (obj->object_id == OF_PACKET_IN &&
+               packet_in_auxiliary_get(cxn) != NULL) {
+        return 0;
+    }
+
+    if (role == INDIGO_CXN_R_SLAVE) {
         if ((obj->object_id == OF_PACKET_IN) ||
             (obj->object_id == OF_FLOW_REMOVED)) {
             return 0;
@@ -943,44 +1377,268 @@ ind_cxn_accepts_async_message(const connection_t *cxn, const of_object_t *obj)
     return 1;
 }
 
+/* Subscription list for an async message */
+static cxn_list_t *
+async_subscribers_get(const of_object_t *obj)
+{
+    static const of_object_t probes[CXN_ASYNC_COUNT] = {
+        [CXN_ASYNC_PACKET_IN] = { .object_id = OF_PACKET_IN },
+        [CXN_ASYNC_FLOW_REMOVED] = { .object_id = OF_FLOW_REMOVED },
+        [CXN_ASYNC_OTHER] = { .object_id = OF_PORT_STATUS },
+    };
+    indigo_cxn_id_t cxn_id;
+    connection_t *cxn;
+    int kind;
+
+    if (async_subscribers_stale) {
+        for (kind = 0; kind < CXN_ASYNC_COUNT; kind++) {
+            async_subscribers[kind].count = 0;
+            FOREACH_ASYNC_CXN(cxn_id, cxn) {
+                if (ind_cxn_accepts_async_message(cxn, &probes[kind])) {
+                    cxn_list_add(&async_subscribers[kind], cxn);
+                }
+            }
+        }
+        async_subscribers_stale = 0;
+    }
+
+    switch (obj->object_id) {
+    case OF_PACKET_IN:
+        return &async_subscribers[CXN_ASYNC_PACKET_IN];
+    case OF_FLOW_REMOVED:
+        return &async_subscribers[CXN_ASYNC_FLOW_REMOVED];
+    default:
+        return &async_subscribers[CXN_ASYNC_OTHER];
+    }
+}
+
 /**
  * Send an async message to all interested connections.
  */
 void
 indigo_cxn_send_async_message(of_object_t *obj)
 {
-    indigo_cxn_id_t cxn_id;
+    cxn_list_t *subscribers = async_subscribers_get(obj);
     connection_t *cxn;
+    connection_t **targets;
+    cxn_shared_msg_t *shared;
+    cxn_output_class_t output_class;
+    uint8_t *data = NULL;
+    int count = 0;
+    int i;
 
-    /*
-     * The connection that will end up sending the original 'obj',
-     * rather than a duplicate. indigo_cxn_send_controller_message
-     * consumes the LOCI object so we need to call it on the
-     * original last.
-     */
-    indigo_cxn_id_t first_cxn_id = INDIGO_CXN_ID_UNSPECIFIED;
+    /* Copied out, as a failed enqueue changes the subscriptions */
+    if (async_targets_size < subscribers->count) {
+        async_targets_size = subscribers->count;
+        async_targets = aim_realloc(async_targets,
+                                    async_targets_size * sizeof(async_targets[0]));
+    }
+    targets = async_targets;
 
-    FOREACH_ACTIVE_CXN(cxn_id, cxn) {
-        if (ind_cxn_accepts_async_message(cxn, obj) &&
-            (cxn->status.negotiated_version == obj->version)) {
-            if (first_cxn_id == INDIGO_CXN_ID_UNSPECIFIED) {
-                first_cxn_id = cxn->cxn_id;
-            } else {
-                of_object_t *dup = of_object_dup(obj);
-                if (dup != NULL) {
-                    indigo_cxn_send_controller_message(cxn->cxn_id, dup);
-                }
-            }
+    for (i = 0; i < subscribers->count; i++) {
+        cxn = subscribers->items[i];
+        if (cxn->status.negotiated_version == obj->version) {
+            targets[count++] = cxn;
         }
     }
 
-    if (first_cxn_id != INDIGO_CXN_ID_UNSPECIFIED) {
-        indigo_cxn_send_controller_message(first_cxn_id, obj);
-    } else {
+    if (count == 0) {
         LOG_VERBOSE("Dropping async %s message, no interested connections",
                     of_object_id_str[obj->object_id]);
         of_object_delete(obj);
+        return;
+    }
+
+    if (count == 1) {
+        indigo_cxn_send_controller_message(targets[0]->cxn_id, obj);
+        return;
+    }
+
+    /*
+     * Several controllers want this message. Serialize it once and let
+     * each output queue hold a reference rather than a copy.
+     */
+    for (i = 0; i < count; ) {
+        if (cxn_send_admit(targets[i], obj)) {
+            i++;
+        } else {
+            targets[i] = targets[--count];
+        }
+    }
+
+    if (count == 0) {
+        of_object_delete(obj);
+        return;
+    }
+
+    LOG_OBJECT(obj);
+
+    output_class = output_class_get(obj);
+    of_object_wire_buffer_steal(obj, &data);
+    shared = ind_cxn_shared_msg_new(data, obj->length);
+    of_object_delete(obj);
+    if (shared == NULL) {
+        LOG_ERROR("Could not allocate shared async message");
+        of_alloc_free(data);
+        return;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (ind_cxn_instance_enqueue_shared(targets[i], shared,
+                                            output_class) < 0) {
+            LOG_ERROR("Could not enqueue message data, disconnecting");
+            ind_cxn_disconnect(targets[i]);
+        }
+    }
+
+    ind_cxn_shared_msg_unref(shared);
+}
+
+/**
+ * Is the connection's output above the high watermark, or above the low
+ * one while the memory budget is under pressure? The waiters run once
+ * the output drains below the low watermark either way.
+ */
+int
+indigo_cxn_output_blocked(indigo_cxn_id_t cxn_id)
+{
+    connection_t *cxn;
+
+    if (INDIGO_CXN_INVALID(cxn_id)) {
+        return 0;
+    }
+
+    cxn = CXN_ID_TO_CONNECTION(cxn_id);
+    if (!CXN_TCP_CONNECTED(cxn)) {
+        return 0;
+    }
+
+    if (indigo_mem_budget_pressure()) {
+        return cxn->bytes_enqueued > CXN_OUTPUT_LOW_WATERMARK;
+    }
+
+    return cxn->bytes_enqueued > CXN_OUTPUT_HIGH_WATERMARK;
+}
+
+/* Append to a growable array of waiters */
+static indigo_error_t
+output_waiter_add(cxn_output_waiter_t **waiters, int *count, int *size,
+                  indigo_cxn_output_ready_f callback, void *cookie)
+{
+    cxn_output_waiter_t *new_waiters;
+
+    if (*count == *size) {
+        int new_size = *size ? *size * 2 : 4;
+        new_waiters = aim_realloc(*waiters, new_size * sizeof(*new_waiters));
+        if (new_waiters == NULL) {
+            return INDIGO_ERROR_RESOURCE;
+        }
+        *waiters = new_waiters;
+        *size = new_size;
+    }
+
+    (*waiters)[*count].callback = callback;
+    (*waiters)[*count].cookie = cookie;
+    (*count)++;
+
+    return INDIGO_ERROR_NONE;
+}
+
+/**
+ * Wait for the connection's output to drain
+ */
+indigo_error_t
+indigo_cxn_output_ready_register(indigo_cxn_id_t cxn_id,
+                                 indigo_cxn_output_ready_f callback,
+                                 void *cookie)
+{
+    connection_t *cxn;
+
+    if (INDIGO_CXN_INVALID(cxn_id)) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    cxn = CXN_ID_TO_CONNECTION(cxn_id);
+    if (!CXN_TCP_CONNECTED(cxn)) {
+        return INDIGO_ERROR_CONNECTION;
+    }
+
+    return output_waiter_add(&cxn->output_waiters, &cxn->output_waiter_count,
+                             &cxn->output_waiter_size, callback, cookie);
+}
+
+/* Waiting for every flow removed queue to drain */
+static cxn_output_waiter_t *flow_removed_waiters;
+static int flow_removed_waiter_count;
+static int flow_removed_waiter_size;
+
+/**
+ * Is any connection's flow removed queue above the high watermark?
+ */
+int
+indigo_cxn_flow_removed_blocked(void)
+{
+    indigo_cxn_id_t cxn_id;
+    connection_t *cxn;
+
+    FOREACH_ACTIVE_CXN(cxn_id, cxn) {
+        if (CXN_HANDSHAKE_COMPLETE(cxn) &&
+            cxn->output_queues[CXN_OUTPUT_CLASS_FLOW_REMOVED].count >=
+            FLOW_REMOVED_HIGH_WATERMARK) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Wait for every connection's flow removed queue to drain
+ */
+indigo_error_t
+indigo_cxn_flow_removed_ready_register(indigo_cxn_output_ready_f callback,
+                                       void *cookie)
+{
+    return output_waiter_add(&flow_removed_waiters, &flow_removed_waiter_count,
+                             &flow_removed_waiter_size, callback, cookie);
+}
+
+/**
+ * Call and forget the flow removed waiters once no connection is above
+ * the low watermark
+ *
+ * The list is detached first because callbacks may register again.
+ */
+void
+ind_cxn_flow_removed_waiters_run(void)
+{
+    cxn_output_waiter_t *waiters = flow_removed_waiters;
+    int count = flow_removed_waiter_count;
+    indigo_cxn_id_t cxn_id;
+    connection_t *cxn;
+    int i;
+
+    if (count == 0) {
+        return;
+    }
+
+    FOREACH_ACTIVE_CXN(cxn_id, cxn) {
+        if (CXN_HANDSHAKE_COMPLETE(cxn) &&
+            cxn->output_queues[CXN_OUTPUT_CLASS_FLOW_REMOVED].count >
+            FLOW_REMOVED_LOW_WATERMARK) {
+            return;
+        }
     }
+
+    flow_removed_waiters = NULL;
+    flow_removed_waiter_count = 0;
+    flow_removed_waiter_size = 0;
+
+    for (i = 0; i < count; i++) {
+        waiters[i].callback(waiters[i].cookie);
+    }
+
+    aim_free(waiters);
 }
 
 /**
@@ -1085,6 +1743,107 @@ ind_cxn_message_track_setup(indigo_cxn_id_t cxn_id, of_object_t *obj)
     return INDIGO_ERROR_NONE;
 }
 
+/**
+ * Take ownership of a message passed to a handler
+ */
+
+of_object_t *
+indigo_cxn_message_claim(indigo_cxn_id_t cxn_id, of_object_t *obj)
+{
+    connection_t *cxn;
+    of_object_t *claimed;
+
+    if (!CXN_ID_VALID(cxn_id) || !CXN_ID_TCP_CONNECTED(cxn_id)) {
+        return NULL;
+    }
+
+    cxn = CXN_ID_TO_CONNECTION(cxn_id);
+
+    if ((claimed = cxn_message_claim(cxn, obj)) == NULL) {
+        return NULL;
+    }
+
+    cxn_message_track_setup(cxn, claimed);
+
+    return claimed;
+}
+
+/**
+ * Report a message that a handler could not decode
+ */
+
+void
+indigo_cxn_message_parse_error(indigo_cxn_id_t cxn_id, of_object_t *obj)
+{
+    connection_t *cxn;
+    uint8_t *buf;
+
+    if (!CXN_ID_VALID(cxn_id) || !CXN_ID_TCP_CONNECTED(cxn_id)) {
+        return;
+    }
+
+    cxn = CXN_ID_TO_CONNECTION(cxn_id);
+    cxn->messages_in_malformed++;
+
+    buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
+    if (of_validate_message(OF_BUFFER_TO_MESSAGE(buf), obj->length) != 0) {
+        LOG_INFO("Message from cxn %d failed full validation", cxn_id);
+    } else {
+        LOG_INFO("Message from cxn %d validated but could not be decoded",
+                 cxn_id);
+    }
+
+    ind_cxn_parse_error_send(cxn, buf, obj->length);
+}
+
+/**
+ * Update whether a connection is trusted
+ *
+ * Takes effect from the next message received.
+ */
+
+void
+ind_cxn_trusted_set(indigo_cxn_id_t cxn_id, int trusted)
+{
+    if (CXN_ID_VALID(cxn_id)) {
+        connection[cxn_id]->config_params.trusted = trusted;
+    }
+}
+
+/**
+ * Update a connection's share of message processing
+ *
+ * Takes effect from its next turn of the event loop.
+ */
+
+void
+ind_cxn_weight_set(indigo_cxn_id_t cxn_id, uint32_t weight)
+{
+    if (CXN_ID_VALID(cxn_id)) {
+        connection[cxn_id]->config_params.weight = weight;
+    }
+}
+
+/**
+ * Update whether a connection pipelines flow mods
+ *
+ * Takes effect from the next message received.
+ */
+
+void
+ind_cxn_pipelined_set(indigo_cxn_id_t cxn_id, int pipelined)
+{
+    if (CXN_ID_VALID(cxn_id)) {
+        connection[cxn_id]->config_params.pipelined = pipelined;
+    }
+}
+
+int
+ind_cxn_pipelined(indigo_cxn_id_t cxn_id)
+{
+    return CXN_ID_VALID(cxn_id) && connection[cxn_id]->config_params.pipelined;
+}
+
 
 
 /*
@@ -1169,6 +1928,11 @@ ind_cxn_finish(void)
 {
     LOG_TRACE("Indigo connection manager fini");
     ind_cxn_enable_set(0);
+    ind_cxn_latency_clear();
+    debug_counter_unregister(&packet_in_drop_counter);
+    debug_counter_unregister(&packet_in_rate_drop_counter);
+    debug_counter_unregister(&flow_removed_drop_counter);
+    debug_counter_unregister(&internal_errors_counter);
     return INDIGO_ERROR_NONE;
 }
 
@@ -1205,6 +1969,7 @@ indigo_cxn_send_error_reply(indigo_cxn_id_t cxn_id, of_object_t *orig,
 
     LOG_TRACE("Sending error msg to %s. type %d. code %d.",
               cxn_id_ip_string(cxn_id), type, code);
+    ind_cxn_flight_error_out(cxn_id, xid, type, code);
 
     if ((msg = of_hello_failed_error_msg_new(orig->version)) == NULL) {
         LOG_ERROR("Could not allocate error message");
@@ -1316,24 +2081,42 @@ ind_cxn_listen_socket_ready(int socket_id, void *cookie, int read_ready,
         LOG_ERROR("Could not set up accepted connection");
         /* @fixme clean up? */
     } else {
-        /* Inherit the tracer - move to config_params? */
-        cxn->trace_pvs = listen_cxn->trace_pvs;
+        /* Inherit the traced message types - move to config_params? */
+        cxn->trace_on = listen_cxn->trace_on;
+        memcpy(cxn->trace_types, listen_cxn->trace_types,
+               sizeof(cxn->trace_types));
     }
 }
 
 indigo_error_t
 ind_cxn_message_trace(indigo_cxn_id_t cxn_id, aim_pvs_t* pvs)
+{
+    return ind_cxn_trace_set(cxn_id, -1, pvs != NULL);
+}
+
+/**
+ * Turn tracing of a message type on or off
+ *
+ * @param cxn_id The connection, or -1 for all active connections
+ * @param object_id The message type, or -1 for all types
+ * @param enable Trace if nonzero
+ */
+indigo_error_t
+ind_cxn_trace_set(indigo_cxn_id_t cxn_id, int object_id, int enable)
 {
     connection_t *cxn;
     indigo_cxn_id_t _cxn_id;
+
+    if (object_id >= OF_MESSAGE_OBJECT_COUNT) {
+        return INDIGO_ERROR_PARAM;
+    }
+
     FOREACH_ACTIVE_CXN(_cxn_id, cxn) {
-        if(cxn_id == -1 || cxn_id == _cxn_id) {
-            cxn->trace_pvs = pvs;
-            if(cxn_id == _cxn_id) {
-                break;
-            }
+        if (cxn_id == -1 || cxn_id == _cxn_id) {
+            ind_cxn_trace_types_set(cxn, object_id, enable);
         }
     }
+
     return INDIGO_ERROR_NONE;
 }
 
@@ -1425,6 +2208,10 @@ ind_cxn_stats_show(aim_pvs_t *pvs, int details)
                    cxn->packet_ins);
         aim_printf(pvs, "    Packet in drops: %"PRIu64"\n",
                    cxn->status.packet_in_drop);
+        aim_printf(pvs, "    Packet in rate limit drops: %"PRIu64"\n",
+                   cxn->status.packet_in_rate_drop);
+        aim_printf(pvs, "    Flow removed drops: %"PRIu64"\n",
+                   cxn->status.flow_removed_drop);
 
         aim_printf(pvs, "    Messages in, current connection: %"PRIu64"\n",
                    cxn->status.messages_in);
@@ -1446,6 +2233,36 @@ ind_cxn_stats_show(aim_pvs_t *pvs, int details)
             aim_printf(pvs, "        Unknown type: %"PRIu64"\n",
                        cxn->messages_in_unknown);
         }
+        if (cxn->config_params.trusted) {
+            aim_printf(pvs, "    Messages in, light validation: %"PRIu64"\n",
+                       cxn->messages_in_unvalidated);
+        }
+        if (cxn->messages_in_malformed) {
+            aim_printf(pvs, "    Messages in, malformed: %"PRIu64"\n",
+                       cxn->messages_in_malformed);
+        }
+        aim_printf(pvs, "    Weight: %u%s, read quota yields: %"PRIu64"\n",
+                   cxn->config_params.weight ? cxn->config_params.weight : 1,
+                   cxn->status.role == INDIGO_CXN_R_SLAVE ? " (slave)" : "",
+                   cxn->read_quota_yields);
+        if (cxn->echo_requests_early) {
+            aim_printf(pvs, "    Echo requests answered early: %"PRIu64"\n",
+                       cxn->echo_requests_early);
+        }
+        if (cxn->messages_in_claimed) {
+            aim_printf(pvs, "    Messages in, claimed without copy: %"PRIu64"\n",
+                       cxn->messages_in_claimed);
+        }
+        if (cxn->config_params.pipelined) {
+            aim_printf(pvs, "    Flow mods pipelined\n");
+        }
+        if (CXN_AUXILIARY(cxn)) {
+            connection_t *main_cxn = ind_cxn_main_get(cxn);
+            aim_printf(pvs, "    Auxiliary id %u%s, main connection %d\n",
+                       cxn->config_params.auxiliary_id,
+                       CXN_UDP(cxn) ? " (udp)" : "",
+                       main_cxn ? main_cxn->cxn_id : -1);
+        }
 
         aim_printf(pvs, "    Messages out, current connection: %"PRIu64"\n",
                    cxn->status.messages_out);
@@ -1467,6 +2284,25 @@ ind_cxn_stats_show(aim_pvs_t *pvs, int details)
             aim_printf(pvs, "        Unknown type: %"PRIu64"\n",
                        cxn->messages_out_unknown);
         }
+
+        aim_printf(pvs, "    Output queue: %d bytes, %d messages\n",
+                   cxn->bytes_enqueued, cxn->pkts_enqueued);
+        aim_printf(pvs, "    Output queue high water: %u bytes, %u messages\n",
+                   cxn->status.output_bytes_high,
+                   cxn->status.output_msgs_high);
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+        if (CXN_TLS(cxn)) {
+            aim_printf(pvs, "    TLS handshakes: %u, resumed: %u\n",
+                       cxn->tls_handshakes, cxn->tls_resumed);
+        }
+#endif
+        aim_printf(pvs, "    Output queue by class: echo %d, control %d, "
+                   "port status %d, flow removed %d, packet in %d\n",
+                   cxn->output_queues[CXN_OUTPUT_CLASS_ECHO].count,
+                   cxn->output_queues[CXN_OUTPUT_CLASS_CONTROL].count,
+                   cxn->output_queues[CXN_OUTPUT_CLASS_PORT_STATUS].count,
+                   cxn->output_queues[CXN_OUTPUT_CLASS_FLOW_REMOVED].count,
+                   cxn->output_queues[CXN_OUTPUT_CLASS_PACKET_IN].count);
     }
     if (!cxn_count) {
         aim_printf(pvs, "No active connections\n");
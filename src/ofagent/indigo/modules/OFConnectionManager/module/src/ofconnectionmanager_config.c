@@ -85,6 +85,11 @@ ofconnectionmanager_config_settings_t ofconnectionmanager_config_settings[] =
     { __ofconnectionmanager_config_STRINGIFY_NAME(OFCONNECTIONMANAGER_CONFIG_OF_VERSION), __ofconnectionmanager_config_STRINGIFY_VALUE(OFCONNECTIONMANAGER_CONFIG_OF_VERSION) },
 #else
 { OFCONNECTIONMANAGER_CONFIG_OF_VERSION(__ofconnectionmanager_config_STRINGIFY_NAME), "__undefined__" },
+#endif
+#ifdef OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS
+    { __ofconnectionmanager_config_STRINGIFY_NAME(OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS), __ofconnectionmanager_config_STRINGIFY_VALUE(OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS) },
+#else
+{ OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS(__ofconnectionmanager_config_STRINGIFY_NAME), "__undefined__" },
 #endif
     { NULL, NULL }
 };
@@ -116,6 +121,7 @@ ofconnectionmanager_config_show(struct aim_pvs_s* pvs)
 /* <auto.end.cdefs(OFCONNECTIONMANAGER_CONFIG_HEADER).source> */
 
 #define MAX_CONTROLLERS 16
+#define TLS_PATH_LEN 256
 
 struct controller {
     indigo_cxn_protocol_params_t proto;
@@ -126,6 +132,14 @@ struct controller {
 static struct config {
     uint32_t log_flags;
     int keepalive_period_ms;
+    int packet_in_rate;
+    int packet_in_burst;
+    int packet_in_limit_by_table;
+    struct {
+        char ca_cert_file[TLS_PATH_LEN];
+        char cert_file[TLS_PATH_LEN];
+        char key_file[TLS_PATH_LEN];
+    } tls;
     int num_controllers;
     struct controller controllers[MAX_CONTROLLERS];
 } staged_config, current_config;
@@ -135,10 +149,16 @@ static indigo_error_t
 parse_controller(struct controller *controller, cJSON *root)
 {
     indigo_cxn_params_tcp_over_ipv4_t *proto;
+    indigo_cxn_protocol_t protocol = INDIGO_CXN_PROTO_TCP_OVER_IPV4;
     char *proto_str, *ip;
     int port;
     int listen;
     int prio;
+    int trusted;
+    int weight;
+    int pipelined;
+    int auxiliary_id;
+    int packet_in_queue;
     indigo_error_t err;
 
     err = ind_cfg_lookup_string(root, "ip_addr", &ip);
@@ -162,8 +182,15 @@ parse_controller(struct controller *controller, cJSON *root)
         return err;
     }
 
-    /* @TODO support more protocol types */
-    if (strcmp(proto_str, "tcp")) {
+    if (!strcmp(proto_str, "tcp")) {
+        protocol = INDIGO_CXN_PROTO_TCP_OVER_IPV4;
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    } else if (!strcmp(proto_str, "tls")) {
+        protocol = INDIGO_CXN_PROTO_TLS_OVER_IPV4;
+#endif
+    } else if (!strcmp(proto_str, "udp")) {
+        protocol = INDIGO_CXN_PROTO_UDP_OVER_IPV4;
+    } else {
         AIM_LOG_ERROR("Config: Invalid controller protocol: %s", proto_str);
         return INDIGO_ERROR_PARAM;
     }
@@ -204,14 +231,97 @@ parse_controller(struct controller *controller, cJSON *root)
         return err;
     }
 
+    err = ind_cfg_lookup_bool(root, "trusted", &trusted);
+    if (err == INDIGO_ERROR_NOT_FOUND) {
+        trusted = 0;
+    } else if (err < 0) {
+        if (err == INDIGO_ERROR_PARAM) {
+            AIM_LOG_ERROR("Config: 'trusted' must be a boolean");
+        }
+        return err;
+    }
+
+    err = ind_cfg_lookup_int(root, "weight", &weight);
+    if (err == INDIGO_ERROR_NOT_FOUND) {
+        weight = 1;
+    } else if (err < 0) {
+        if (err == INDIGO_ERROR_PARAM) {
+            AIM_LOG_ERROR("Config: 'weight' must be an integer");
+        }
+        return err;
+    }
+
+    if (weight < 1 || weight > CXN_WEIGHT_MAX) {
+        AIM_LOG_ERROR("Config: 'weight' must be between 1 and %d",
+                      CXN_WEIGHT_MAX);
+        return INDIGO_ERROR_PARAM;
+    }
+
+    err = ind_cfg_lookup_bool(root, "pipeline", &pipelined);
+    if (err == INDIGO_ERROR_NOT_FOUND) {
+        pipelined = 0;
+    } else if (err < 0) {
+        if (err == INDIGO_ERROR_PARAM) {
+            AIM_LOG_ERROR("Config: 'pipeline' must be a boolean");
+        }
+        return err;
+    }
+
+    err = ind_cfg_lookup_int(root, "auxiliary_id", &auxiliary_id);
+    if (err == INDIGO_ERROR_NOT_FOUND) {
+        auxiliary_id = 0;
+    } else if (err < 0) {
+        if (err == INDIGO_ERROR_PARAM) {
+            AIM_LOG_ERROR("Config: 'auxiliary_id' must be an integer");
+        }
+        return err;
+    }
+
+    if (auxiliary_id < 0 || auxiliary_id > 255) {
+        AIM_LOG_ERROR("Config: Invalid auxiliary_id: %d", auxiliary_id);
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (auxiliary_id != 0 &&
+        (listen || OFCONNECTIONMANAGER_CONFIG_OF_VERSION < OF_VERSION_1_3)) {
+        AIM_LOG_ERROR("Config: Auxiliary connections need OpenFlow 1.3 "
+                      "and cannot listen");
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (auxiliary_id == 0 && protocol == INDIGO_CXN_PROTO_UDP_OVER_IPV4) {
+        AIM_LOG_ERROR("Config: 'udp' is only allowed with an auxiliary_id");
+        return INDIGO_ERROR_PARAM;
+    }
+
+    err = ind_cfg_lookup_int(root, "packet_in_queue", &packet_in_queue);
+    if (err == INDIGO_ERROR_NOT_FOUND) {
+        packet_in_queue = 0;
+    } else if (err < 0) {
+        if (err == INDIGO_ERROR_PARAM) {
+            AIM_LOG_ERROR("Config: 'packet_in_queue' must be an integer");
+        }
+        return err;
+    }
+
+    if (packet_in_queue < 0) {
+        AIM_LOG_ERROR("Config: Invalid packet_in_queue: %d", packet_in_queue);
+        return INDIGO_ERROR_PARAM;
+    }
+
     /* TODO validate IP */
 
     proto = &controller->proto.tcp_over_ipv4;
-    proto->protocol = INDIGO_CXN_PROTO_TCP_OVER_IPV4;
+    proto->protocol = protocol;
     strncpy(proto->controller_ip, ip, sizeof(proto->controller_ip));
     proto->controller_port = port;
     controller->config.listen = listen;
     controller->config.cxn_priority = prio;
+    controller->config.trusted = trusted;
+    controller->config.weight = weight;
+    controller->config.pipelined = pipelined;
+    controller->config.auxiliary_id = auxiliary_id;
+    controller->config.packet_in_queue_max = packet_in_queue;
     controller->config.local = 0;
     controller->config.version = OFCONNECTIONMANAGER_CONFIG_OF_VERSION;
 
@@ -262,22 +372,73 @@ parse_controllers(cJSON *root)
     return INDIGO_ERROR_NONE;
 }
 
-/* Match on the protocol params. */
+/* Match on the protocol params and auxiliary ID. */
 static const struct controller *
 find_controller(const struct config *config,
-                const indigo_cxn_protocol_params_t *proto)
+                const struct controller *controller)
 {
     int i;
     for (i = 0; i < config->num_controllers; i++) {
         const struct controller *c = &config->controllers[i];
         /* Assumes unused space is zeroed. */
-        if (!memcmp(proto, &c->proto, sizeof(*proto))) {
+        if (!memcmp(&controller->proto, &c->proto, sizeof(c->proto)) &&
+            controller->config.auxiliary_id == c->config.auxiliary_id) {
             return c;
         }
     }
     return NULL;
 }
 
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+/* Copy an optional file name from the "tls" section */
+static indigo_error_t
+parse_tls_path(cJSON *root, const char *key, char *dest)
+{
+    char *path;
+    indigo_error_t err;
+
+    dest[0] = '\0';
+
+    err = ind_cfg_lookup_string(root, key, &path);
+    if (err == INDIGO_ERROR_NOT_FOUND) {
+        return INDIGO_ERROR_NONE;
+    } else if (err < 0) {
+        AIM_LOG_ERROR("Config: '%s' must be a string", key);
+        return err;
+    }
+
+    if (strlen(path) >= TLS_PATH_LEN) {
+        AIM_LOG_ERROR("Config: '%s' is too long", key);
+        return INDIGO_ERROR_PARAM;
+    }
+    strcpy(dest, path);
+
+    return INDIGO_ERROR_NONE;
+}
+
+/* Parse the optional "tls" object of certificate and key files */
+static indigo_error_t
+parse_tls(cJSON *root)
+{
+    indigo_error_t err;
+
+    if ((err = parse_tls_path(root, "tls.ca_cert_file",
+                              staged_config.tls.ca_cert_file)) < 0) {
+        return err;
+    }
+    if ((err = parse_tls_path(root, "tls.cert_file",
+                              staged_config.tls.cert_file)) < 0) {
+        return err;
+    }
+    if ((err = parse_tls_path(root, "tls.key_file",
+                              staged_config.tls.key_file)) < 0) {
+        return err;
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+#endif
+
 indigo_error_t
 ind_cxn_cfg_stage(cJSON *config)
 {
@@ -307,6 +468,36 @@ ind_cxn_cfg_stage(cJSON *config)
         return err;
     }
 
+    /* Packet-in rate limit is optional; absent means unlimited */
+    staged_config.packet_in_rate = 0;
+    err = ind_cfg_lookup_int(config, "packet_in_rate", &staged_config.packet_in_rate);
+    if (err == INDIGO_ERROR_PARAM || staged_config.packet_in_rate < 0) {
+        AIM_LOG_ERROR("Config: Could not parse 'packet_in_rate'");
+        return INDIGO_ERROR_PARAM;
+    }
+
+    staged_config.packet_in_burst = 0;
+    err = ind_cfg_lookup_int(config, "packet_in_burst", &staged_config.packet_in_burst);
+    if (err == INDIGO_ERROR_PARAM || staged_config.packet_in_burst < 0) {
+        AIM_LOG_ERROR("Config: Could not parse 'packet_in_burst'");
+        return INDIGO_ERROR_PARAM;
+    }
+
+    staged_config.packet_in_limit_by_table = 0;
+    err = ind_cfg_lookup_bool(config, "packet_in_limit_by_table",
+                              &staged_config.packet_in_limit_by_table);
+    if (err == INDIGO_ERROR_PARAM) {
+        AIM_LOG_ERROR("Config: Could not parse 'packet_in_limit_by_table'");
+        return err;
+    }
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    err = parse_tls(config);
+    if (err != INDIGO_ERROR_NONE) {
+        return err;
+    }
+#endif
+
     err = parse_controllers(config);
     if (err != INDIGO_ERROR_NONE) {
         return err;
@@ -333,6 +524,19 @@ ind_cxn_cfg_commit(void)
         lobj->common_flags = staged_config.log_flags;
     }
 
+    ind_cxn_packet_in_limit_set(staged_config.packet_in_rate,
+                                staged_config.packet_in_burst,
+                                staged_config.packet_in_limit_by_table);
+
+#if OFCONNECTIONMANAGER_CONFIG_INCLUDE_TLS == 1
+    /* New TLS connections use this; existing ones are left alone */
+    if (ind_cxn_tls_config_set(staged_config.tls.ca_cert_file,
+                               staged_config.tls.cert_file,
+                               staged_config.tls.key_file) < 0) {
+        AIM_LOG_ERROR("Failed to apply TLS configuration");
+    }
+#endif
+
     for (i = 0; i < staged_config.num_controllers; i++) {
         struct controller *c = &staged_config.controllers[i];
         const struct controller *old_controller;
@@ -342,8 +546,11 @@ ind_cxn_cfg_commit(void)
                      proto->controller_ip, proto->controller_port);
 
         /* Keep existing connections to the same controller. */
-        if ((old_controller = find_controller(&current_config, &c->proto))) {
+        if ((old_controller = find_controller(&current_config, c))) {
             c->cxn_id = old_controller->cxn_id;
+            ind_cxn_trusted_set(c->cxn_id, c->config.trusted);
+            ind_cxn_weight_set(c->cxn_id, c->config.weight);
+            ind_cxn_pipelined_set(c->cxn_id, c->config.pipelined);
             /* TODO apply keepalive_period to existing connection. */
             continue;
         }
@@ -358,7 +565,7 @@ ind_cxn_cfg_commit(void)
     /* Remove connections that don't exist in the new configuration. */
     for (i = 0; i < current_config.num_controllers; i++) {
         const struct controller *c = &current_config.controllers[i];
-        if (!find_controller(&staged_config, &c->proto)) {
+        if (!find_controller(&staged_config, c)) {
             (void) indigo_cxn_connection_remove(c->cxn_id);
         }
     }
@@ -367,7 +574,19 @@ ind_cxn_cfg_commit(void)
     current_config = staged_config;
 }
 
+static const char * const ind_cxn_cfg_paths[] = {
+    "logging.connection",
+    "keepalive_period_ms",
+    "packet_in_rate",
+    "packet_in_burst",
+    "packet_in_limit_by_table",
+    "tls",
+    "controllers",
+    NULL
+};
+
 const struct ind_cfg_ops ind_cxn_cfg_ops = {
     .stage = ind_cxn_cfg_stage,
     .commit = ind_cxn_cfg_commit,
+    .paths = ind_cxn_cfg_paths,
 };
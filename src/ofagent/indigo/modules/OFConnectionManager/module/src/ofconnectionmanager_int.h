@@ -78,6 +78,11 @@ connection_t* cookie_to_cxn(void* cookie);
  */
 #define IND_CXN_EVENT_PRIORITY 10
 
+/*
+ * Priority for the keepalive timer, so it fires ahead of queued work.
+ */
+#define IND_CXN_KEEPALIVE_PRIORITY 20
+
 extern void indigo_cxn_socket_ready_callback(int socket_id,
                                              void *cookie,
                                              int read_ready,
@@ -97,6 +102,19 @@ extern indigo_error_t ind_cxn_send_controller_message(indigo_cxn_id_t cxn_id,
 
 extern void cxn_message_track_setup(connection_t *cxn, of_object_t *obj);
 
+extern of_object_t *cxn_message_claim(connection_t *cxn, of_object_t *obj);
+
+extern void ind_cxn_packet_in_limit_set(uint32_t rate, uint32_t burst,
+                                        int by_table);
+
+extern void ind_cxn_trusted_set(indigo_cxn_id_t cxn_id, int trusted);
+
+extern void ind_cxn_weight_set(indigo_cxn_id_t cxn_id, uint32_t weight);
+
+extern void ind_cxn_pipelined_set(indigo_cxn_id_t cxn_id, int pipelined);
+
+void ind_cxn_role_set(connection_t *cxn, indigo_cxn_role_t role);
+
 void ind_cxn_change_master(indigo_cxn_id_t master_id);
 
 void ind_cxn_populate_connection_list(of_list_bsn_controller_connection_t *list);
@@ -120,6 +138,7 @@ void ind_cxn_populate_connection_list(of_list_bsn_controller_connection_t *list)
  ****************************************************************/
 
 extern void ind_cxn_status_change(connection_t *cxn);
+extern void ind_cxn_active_set(connection_t *cxn, int active);
 
 
 /****************************************************************
@@ -72,6 +72,122 @@ ofconnectionmanager_ucli_ucli__stats__(ucli_context_t *uc)
     return UCLI_STATUS_OK;
 }
 
+static ucli_status_t
+ofconnectionmanager_ucli_ucli__alloc__(ucli_context_t *uc)
+{
+    UCLI_COMMAND_INFO(uc,
+                      "alloc", 0,
+                      "$summary#Show LOCI object and buffer allocator stats.");
+
+    of_alloc_stats_dump((loci_writer_f)aim_printf, &uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ofconnectionmanager_ucli_ucli__latency__(ucli_context_t *uc)
+{
+    char *str;
+
+    UCLI_COMMAND_INFO(uc,
+                      "latency", -1,
+                      "$summary#Show per message type latency."
+                      "$args#[clear]");
+    if (uc->pargs->count == 1) {
+        UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+        if (!strcmp(str, "clear")) {
+            ind_cxn_latency_clear();
+            return UCLI_STATUS_OK;
+        }
+        return UCLI_STATUS_E_ARG;
+    } else if (uc->pargs->count > 1) {
+        return UCLI_STATUS_E_ARG;
+    }
+
+    ind_cxn_latency_show(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ofconnectionmanager_ucli_ucli__flight__(ucli_context_t *uc)
+{
+    char *str;
+    int cxn_id = -1;
+
+    UCLI_COMMAND_INFO(uc,
+                      "flight", -1,
+                      "$summary#Show recent control plane events."
+                      "$args#[clear|<cxn_id>]");
+    if (uc->pargs->count == 1) {
+        UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+        if (!strcmp(str, "clear")) {
+            ind_cxn_flight_clear();
+            return UCLI_STATUS_OK;
+        }
+        UCLI_ARGPARSE_OR_RETURN(uc, "i", &cxn_id);
+    } else if (uc->pargs->count > 1) {
+        return UCLI_STATUS_E_ARG;
+    }
+
+    ind_cxn_flight_show(&uc->pvs, cxn_id, 0);
+
+    return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ofconnectionmanager_ucli_ucli__trace__(ucli_context_t *uc)
+{
+    char *cmd, *arg = NULL;
+    int cxn_id = -1;
+
+    UCLI_COMMAND_INFO(uc,
+                      "trace", -1,
+                      "$summary#Trace messages or decode the message trace."
+                      "$args#on|off [<cxn_id> [<msg_type>]] | show [<cxn_id>] | clear | save <file> | decode <file>");
+    if (uc->pargs->count < 1 || uc->pargs->count > 3) {
+        return UCLI_STATUS_E_ARG;
+    }
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &cmd);
+
+    if (!strcmp(cmd, "on") || !strcmp(cmd, "off")) {
+        int enable = !strcmp(cmd, "on");
+        if (uc->pargs->count >= 2) {
+            UCLI_ARGPARSE_OR_RETURN(uc, "si", &cmd, &cxn_id);
+        }
+        if (uc->pargs->count == 3) {
+            UCLI_ARGPARSE_OR_RETURN(uc, "sis", &cmd, &cxn_id, &arg);
+            if (ind_cxn_trace_set_by_name(cxn_id, arg, enable) < 0) {
+                ucli_printf(uc, "Unknown message type %s\n", arg);
+                return UCLI_STATUS_E_ARG;
+            }
+        } else {
+            ind_cxn_trace_set(cxn_id, -1, enable);
+        }
+    } else if (!strcmp(cmd, "show") && uc->pargs->count <= 2) {
+        if (uc->pargs->count == 2) {
+            UCLI_ARGPARSE_OR_RETURN(uc, "si", &cmd, &cxn_id);
+        }
+        ind_cxn_trace_show(&uc->pvs, cxn_id);
+    } else if (!strcmp(cmd, "clear") && uc->pargs->count == 1) {
+        ind_cxn_trace_clear();
+    } else if (!strcmp(cmd, "save") && uc->pargs->count == 2) {
+        UCLI_ARGPARSE_OR_RETURN(uc, "ss", &cmd, &arg);
+        if (ind_cxn_trace_save(arg) < 0) {
+            return UCLI_STATUS_E_ERROR;
+        }
+    } else if (!strcmp(cmd, "decode") && uc->pargs->count == 2) {
+        UCLI_ARGPARSE_OR_RETURN(uc, "ss", &cmd, &arg);
+        if (ind_cxn_trace_decode(&uc->pvs, arg) < 0) {
+            return UCLI_STATUS_E_ERROR;
+        }
+    } else {
+        return UCLI_STATUS_E_ARG;
+    }
+
+    return UCLI_STATUS_OK;
+}
+
 
 /* <auto.ucli.handlers.start> */
 /******************************************************************************
@@ -84,6 +200,10 @@ static ucli_command_handler_f ofconnectionmanager_ucli_ucli_handlers__[] =
 {
     ofconnectionmanager_ucli_ucli__config__,
     ofconnectionmanager_ucli_ucli__stats__,
+    ofconnectionmanager_ucli_ucli__alloc__,
+    ofconnectionmanager_ucli_ucli__latency__,
+    ofconnectionmanager_ucli_ucli__flight__,
+    ofconnectionmanager_ucli_ucli__trace__,
     NULL
 };
 /******************************************************************************/
@@ -136,6 +136,11 @@ indigo_core_receive_controller_message(indigo_cxn_id_t cxn_id,
     cxn_msg_rx(cxn_id, obj);
 }
 
+void
+indigo_fwd_pending_flush(void)
+{
+}
+
 int main(int argc, char* argv[])
 {
     int cxn_id;
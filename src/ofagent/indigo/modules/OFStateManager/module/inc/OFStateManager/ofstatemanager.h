@@ -48,10 +48,22 @@
 #define IND_CORE_SERIAL_NUM_DEFAULT "11235813213455"
 
 typedef struct ind_core_config_s {
-    int expire_flows;   /**< Boolean, should state mgr manage flow expires */
+    int expire_flows;   /**< Boolean, should state mgr manage flow expires;
+                             otherwise forwarding must */
     int stats_check_ms; /**< How frequently to check stats for expire, etc */
     indigo_core_disconnected_mode_t disconnected_mode;
     int max_flowtable_entries; /**< Maximum number of entries in the flowtable */
+    int cookie_prefix_len; /**< Cookie bits bucketed for masked cookie
+                                queries; 0 for the default */
+    int aggregate_stats_refresh_ms; /**< How often to refresh the cached
+                                         flow counters that answer
+                                         aggregate stats; 0 to disable */
+    int idle_by_counters; /**< Boolean, detect idle flows by whether their
+                               packet counters moved, read in bulk, rather
+                               than by forwarding's hit status */
+    int stats_reply_cache_ms; /**< How long a port, table or group stats
+                                   reply answers identical requests;
+                                   0 to disable */
 } ind_core_config_t;
 
 
@@ -95,6 +107,33 @@ indigo_error_t ind_core_mfr_desc_get(of_desc_str_t desc);
 indigo_error_t ind_core_serial_num_set(of_serial_num_t serial_num);
 indigo_error_t ind_core_serial_num_get(of_serial_num_t serial_num);
 
+/**
+ * @brief Default location of the state snapshot
+ *
+ * /var/run is cleared on reboot, when the hardware tables are too.
+ */
+#define IND_CORE_SNAPSHOT_PATH_DEFAULT "/var/run/ofagent/state.snap"
+
+/**
+ * Restore the flow, group and meter tables from a snapshot
+ * @param path Snapshot file
+ *
+ * The tables must be empty, and forwarding must still hold the state
+ * the snapshot describes.  The per-table flow counts and the group count
+ * are checked against forwarding; on a mismatch nothing is restored.
+ * Returns INDIGO_ERROR_NOT_FOUND if there is no usable snapshot.
+ */
+indigo_error_t ind_core_snapshot_restore(const char *path);
+
+/**
+ * Start keeping a snapshot of the flow, group and meter tables
+ * @param path Snapshot file, replaced with the current state
+ *
+ * Every later change to the tables is appended to the file until
+ * ind_core_finish.
+ */
+indigo_error_t ind_core_snapshot_start(const char *path);
+
 /**
  * Dump all entries in the flow table.
  * This is verbose.
@@ -112,6 +151,17 @@ void ind_core_ft_show(aim_pvs_t* pvs);
  */
 void ind_core_ft_stats(aim_pvs_t* pvs);
 
+/**
+ * Show occupancy of the flow table and gentable allocation pools
+ */
+void ind_core_ft_pool_stats(aim_pvs_t* pvs);
+
+/**
+ * Show the heap memory held by the flow table, groups, meters and
+ * gentables
+ */
+void ind_core_memory_stats(aim_pvs_t* pvs);
+
 #ifdef OFDPA_FIXUP
 /**
  * Handles flow expiry that occured in the datapath.
@@ -19,7 +19,7 @@
 
 /**
  * @file
- * @brief OpenFlow message handlers for BSN port/VLAN stats messages
+ * @brief OpenFlow message handlers for BSN port/VLAN/debug counter stats messages
  */
 
 #include "ofstatemanager_log.h"
@@ -28,6 +28,7 @@
 #include <indigo/indigo.h>
 #include <indigo/forwarding.h>
 #include <indigo/port_manager.h>
+#include <indigo/debug_counter.h>
 #include <loci/loci.h>
 #include "handlers.h"
 
@@ -171,6 +172,16 @@ ind_core_bsn_port_counter_stats_entry_populate(of_bsn_port_counter_stats_entry_t
     append_uint64(&values, stats.tx_packets_multicast);
     append_uint64(&values, stats.tx_dropped);
     append_uint64(&values, stats.tx_errors);
+
+    /* Rates follow the counters so readers of the counters are unaffected */
+    append_uint64(&values, stats.rx_packets_rate);
+    append_uint64(&values, stats.rx_bits_rate);
+    append_uint64(&values, stats.rx_errors_rate);
+    append_uint64(&values, stats.tx_packets_rate);
+    append_uint64(&values, stats.tx_bits_rate);
+    append_uint64(&values, stats.tx_errors_rate);
+    append_uint64(&values, stats.rate_interval_ms);
+    append_uint64(&values, stats.rate_age_ms);
 }
 
 void
@@ -247,3 +258,113 @@ ind_core_bsn_port_counter_stats_request_handler(of_object_t *_obj,
 
     indigo_cxn_send_controller_message(cxn_id, reply);
 }
+
+void
+ind_core_bsn_debug_counter_desc_stats_request_handler(of_object_t *_obj,
+                                                      indigo_cxn_id_t cxn_id)
+{
+    of_bsn_debug_counter_desc_stats_request_t *obj = _obj;
+    of_bsn_debug_counter_desc_stats_reply_t *reply;
+    of_list_bsn_debug_counter_desc_stats_entry_t entries;
+    of_bsn_debug_counter_desc_stats_entry_t *entry;
+    list_links_t *cur;
+    uint32_t xid;
+
+    reply = of_bsn_debug_counter_desc_stats_reply_new(obj->version);
+    AIM_TRUE_OR_DIE(reply != NULL);
+
+    of_bsn_debug_counter_desc_stats_request_xid_get(obj, &xid);
+    of_bsn_debug_counter_desc_stats_reply_xid_set(reply, xid);
+    of_bsn_debug_counter_desc_stats_reply_entries_bind(reply, &entries);
+
+    entry = of_bsn_debug_counter_desc_stats_entry_new(entries.version);
+    AIM_TRUE_OR_DIE(entry != NULL);
+
+    LIST_FOREACH(debug_counter_list(), cur) {
+        debug_counter_t *counter = container_of(cur, links, debug_counter_t);
+        of_str64_t name;
+        of_desc_str_t description;
+
+        memset(name, 0, sizeof(name));
+        memset(description, 0, sizeof(description));
+        strncpy(name, counter->name, sizeof(name) - 1);
+        strncpy(description, counter->description, sizeof(description) - 1);
+
+        of_bsn_debug_counter_desc_stats_entry_counter_id_set(entry, counter->counter_id);
+        of_bsn_debug_counter_desc_stats_entry_name_set(entry, name);
+        of_bsn_debug_counter_desc_stats_entry_description_set(entry, description);
+
+        if (of_list_append(&entries, entry) < 0) {
+            /* This entry didn't fit, send out the current message and
+             * allocate a new one. */
+            of_bsn_debug_counter_desc_stats_reply_flags_set(
+                reply, OF_STATS_REPLY_FLAG_REPLY_MORE);
+            indigo_cxn_send_controller_message(cxn_id, reply);
+
+            reply = of_bsn_debug_counter_desc_stats_reply_new(obj->version);
+            AIM_TRUE_OR_DIE(reply != NULL);
+
+            of_bsn_debug_counter_desc_stats_reply_xid_set(reply, xid);
+            of_bsn_debug_counter_desc_stats_reply_entries_bind(reply, &entries);
+
+            if (of_list_append(&entries, entry) < 0) {
+                AIM_DIE("unexpected failure appending single bsn_debug_counter_desc stats entry");
+            }
+        }
+    }
+
+    of_object_delete(entry);
+
+    indigo_cxn_send_controller_message(cxn_id, reply);
+}
+
+void
+ind_core_bsn_debug_counter_stats_request_handler(of_object_t *_obj,
+                                                 indigo_cxn_id_t cxn_id)
+{
+    of_bsn_debug_counter_stats_request_t *obj = _obj;
+    of_bsn_debug_counter_stats_reply_t *reply;
+    of_list_bsn_debug_counter_stats_entry_t entries;
+    of_bsn_debug_counter_stats_entry_t *entry;
+    list_links_t *cur;
+    uint32_t xid;
+
+    reply = of_bsn_debug_counter_stats_reply_new(obj->version);
+    AIM_TRUE_OR_DIE(reply != NULL);
+
+    of_bsn_debug_counter_stats_request_xid_get(obj, &xid);
+    of_bsn_debug_counter_stats_reply_xid_set(reply, xid);
+    of_bsn_debug_counter_stats_reply_entries_bind(reply, &entries);
+
+    entry = of_bsn_debug_counter_stats_entry_new(entries.version);
+    AIM_TRUE_OR_DIE(entry != NULL);
+
+    LIST_FOREACH(debug_counter_list(), cur) {
+        debug_counter_t *counter = container_of(cur, links, debug_counter_t);
+
+        of_bsn_debug_counter_stats_entry_counter_id_set(entry, counter->counter_id);
+        of_bsn_debug_counter_stats_entry_value_set(entry, debug_counter_get(counter));
+
+        if (of_list_append(&entries, entry) < 0) {
+            /* This entry didn't fit, send out the current message and
+             * allocate a new one. */
+            of_bsn_debug_counter_stats_reply_flags_set(
+                reply, OF_STATS_REPLY_FLAG_REPLY_MORE);
+            indigo_cxn_send_controller_message(cxn_id, reply);
+
+            reply = of_bsn_debug_counter_stats_reply_new(obj->version);
+            AIM_TRUE_OR_DIE(reply != NULL);
+
+            of_bsn_debug_counter_stats_reply_xid_set(reply, xid);
+            of_bsn_debug_counter_stats_reply_entries_bind(reply, &entries);
+
+            if (of_list_append(&entries, entry) < 0) {
+                AIM_DIE("unexpected failure appending single bsn_debug_counter stats entry");
+            }
+        }
+    }
+
+    of_object_delete(entry);
+
+    indigo_cxn_send_controller_message(cxn_id, reply);
+}
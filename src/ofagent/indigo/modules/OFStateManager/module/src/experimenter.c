@@ -0,0 +1,248 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Experimenter dispatch table
+ *
+ * Handlers for experimenter messages and experimenter multipart requests
+ * are registered by (experimenter, subtype) and found with one hash
+ * lookup, before the message is offered to forwarding and the port
+ * manager in turn. Each entry counts its calls and errors and the time
+ * spent in the handler.
+ */
+
+#include "ofstatemanager_log.h"
+
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+
+#include <AIM/aim_list.h>
+#include <indigo/indigo.h>
+#include <indigo/of_state_manager.h>
+#include <loci/loci.h>
+#include <BigHash/bighash.h>
+#include "ofstatemanager_int.h"
+#include "experimenter.h"
+
+typedef struct experimenter_key_s {
+    uint32_t kind;
+    uint32_t experimenter;
+    uint32_t subtype;
+} experimenter_key_t;
+
+typedef struct experimenter_entry_s {
+    bighash_entry_t hash_entry;
+    experimenter_key_t key;
+    char name[32];
+    indigo_core_experimenter_handler_f handler;
+    uint64_t calls;
+    uint64_t errors;
+    uint64_t unsupported;       /* Passed on to the default handling */
+    uint64_t total_us;
+    uint64_t max_us;
+} experimenter_entry_t;
+
+#define TEMPLATE_NAME experimenter_hashtable
+#define TEMPLATE_OBJ_TYPE experimenter_entry_t
+#define TEMPLATE_KEY_FIELD key
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+/* Registrations are few; each OF-DPA extension is one or two */
+#define EXPERIMENTER_TABLE_BUCKETS 64
+
+static bighash_table_t *experimenter_table;
+static uint64_t experimenter_misses[INDIGO_CORE_EXPERIMENTER_KIND_COUNT];
+
+static const char *kind_names[INDIGO_CORE_EXPERIMENTER_KIND_COUNT] = {
+    "message",
+    "multipart",
+};
+
+static uint64_t
+experimenter_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void
+experimenter_key_make(experimenter_key_t *key, indigo_core_experimenter_kind_t kind,
+                      uint32_t experimenter, uint32_t subtype)
+{
+    /* Hashed and compared as bytes */
+    memset(key, 0, sizeof(*key));
+    key->kind = kind;
+    key->experimenter = experimenter;
+    key->subtype = subtype;
+}
+
+indigo_error_t
+indigo_core_experimenter_register(indigo_core_experimenter_kind_t kind,
+                                  uint32_t experimenter, uint32_t subtype,
+                                  const char *name,
+                                  indigo_core_experimenter_handler_f handler)
+{
+    experimenter_entry_t *entry;
+    experimenter_key_t key;
+
+    if (kind >= INDIGO_CORE_EXPERIMENTER_KIND_COUNT || handler == NULL) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (experimenter_table == NULL) {
+        experimenter_table = bighash_table_create(EXPERIMENTER_TABLE_BUCKETS);
+    }
+
+    experimenter_key_make(&key, kind, experimenter, subtype);
+    if (experimenter_hashtable_first(experimenter_table, &key) != NULL) {
+        return INDIGO_ERROR_EXISTS;
+    }
+
+    entry = aim_zmalloc(sizeof(*entry));
+    entry->key = key;
+    entry->handler = handler;
+    if (name != NULL) {
+        strncpy(entry->name, name, sizeof(entry->name) - 1);
+    }
+    experimenter_hashtable_insert(experimenter_table, entry);
+
+    return INDIGO_ERROR_NONE;
+}
+
+void
+indigo_core_experimenter_unregister(indigo_core_experimenter_kind_t kind,
+                                    uint32_t experimenter, uint32_t subtype)
+{
+    experimenter_entry_t *entry;
+    experimenter_key_t key;
+
+    if (experimenter_table == NULL) {
+        return;
+    }
+
+    experimenter_key_make(&key, kind, experimenter, subtype);
+    entry = experimenter_hashtable_first(experimenter_table, &key);
+    if (entry != NULL) {
+        bighash_remove(experimenter_table, &entry->hash_entry);
+        aim_free(entry);
+    }
+}
+
+int
+ind_core_experimenter_dispatch(indigo_core_experimenter_kind_t kind,
+                               of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+    experimenter_entry_t *entry;
+    experimenter_key_t key;
+    uint32_t experimenter, subtype;
+    uint64_t start, elapsed;
+    indigo_error_t rv;
+
+    if (experimenter_table == NULL) {
+        return 0;
+    }
+
+    if (kind == INDIGO_CORE_EXPERIMENTER_MULTIPART) {
+        of_experimenter_stats_request_experimenter_get(obj, &experimenter);
+        of_experimenter_stats_request_subtype_get(obj, &subtype);
+    } else {
+        of_experimenter_experimenter_get(obj, &experimenter);
+        of_experimenter_subtype_get(obj, &subtype);
+    }
+
+    experimenter_key_make(&key, kind, experimenter, subtype);
+    entry = experimenter_hashtable_first(experimenter_table, &key);
+    if (entry == NULL) {
+        experimenter_misses[kind]++;
+        return 0;
+    }
+
+    start = experimenter_now_us();
+    rv = entry->handler(obj, cxn_id);
+    elapsed = experimenter_now_us() - start;
+
+    if (rv == INDIGO_ERROR_NOT_SUPPORTED) {
+        entry->unsupported++;
+        return 0;
+    }
+
+    entry->calls++;
+    entry->total_us += elapsed;
+    if (elapsed > entry->max_us) {
+        entry->max_us = elapsed;
+    }
+    if (rv < 0) {
+        entry->errors++;
+        LOG_VERBOSE("Error from the %s handler for experimenter 0x%x subtype %u: %s",
+                    entry->name, experimenter, subtype, indigo_strerror(rv));
+    }
+
+    return 1;
+}
+
+static void
+experimenter_entry_free(bighash_entry_t *e)
+{
+    aim_free(container_of(e, hash_entry, experimenter_entry_t));
+}
+
+void
+ind_core_experimenter_finish(void)
+{
+    if (experimenter_table != NULL) {
+        bighash_table_destroy(experimenter_table, experimenter_entry_free);
+        experimenter_table = NULL;
+    }
+}
+
+void
+ind_core_experimenter_show(aim_pvs_t *pvs)
+{
+    experimenter_entry_t *entry;
+    bighash_iter_t iter;
+    bighash_entry_t *e;
+    int kind;
+
+    aim_printf(pvs, "%-9s %-10s %-7s %-24s %10s %8s %8s %8s %8s\n",
+               "kind", "experim.", "subtype", "name", "calls", "errors",
+               "unsupp.", "avg_us", "max_us");
+
+    if (experimenter_table != NULL) {
+        for (e = bighash_iter_start(experimenter_table, &iter); e != NULL;
+             e = bighash_iter_next(&iter)) {
+            entry = container_of(e, hash_entry, experimenter_entry_t);
+            aim_printf(pvs, "%-9s 0x%08x %-7u %-24s %10" PRIu64 " %8" PRIu64
+                       " %8" PRIu64 " %8" PRIu64 " %8" PRIu64 "\n",
+                       kind_names[entry->key.kind], entry->key.experimenter,
+                       entry->key.subtype, entry->name, entry->calls,
+                       entry->errors, entry->unsupported,
+                       entry->calls ? entry->total_us / entry->calls : 0,
+                       entry->max_us);
+        }
+    }
+
+    for (kind = 0; kind < INDIGO_CORE_EXPERIMENTER_KIND_COUNT; kind++) {
+        aim_printf(pvs, "Unregistered %s: %" PRIu64 "\n", kind_names[kind],
+                   experimenter_misses[kind]);
+    }
+}
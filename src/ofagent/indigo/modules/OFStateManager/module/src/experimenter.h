@@ -0,0 +1,47 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Experimenter dispatch table
+ *
+ * See experimenter.c.
+ */
+
+#ifndef _OFSTATEMANAGER_EXPERIMENTER_H_
+#define _OFSTATEMANAGER_EXPERIMENTER_H_
+
+#include <indigo/indigo.h>
+#include <indigo/of_state_manager.h>
+#include <loci/loci.h>
+
+/**
+ * Run the handler registered for a message's experimenter and subtype
+ *
+ * @returns 1 if a handler took the message; 0 if there is none, or it
+ * returned INDIGO_ERROR_NOT_SUPPORTED
+ */
+int ind_core_experimenter_dispatch(indigo_core_experimenter_kind_t kind,
+                                   of_object_t *obj, indigo_cxn_id_t cxn_id);
+
+void ind_core_experimenter_finish(void);
+
+void ind_core_experimenter_show(aim_pvs_t *pvs);
+
+#endif /* _OFSTATEMANAGER_EXPERIMENTER_H_ */
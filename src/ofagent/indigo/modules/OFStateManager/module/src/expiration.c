@@ -30,11 +30,29 @@
 #include "ofstatemanager_decs.h"
 #include "ft_entry.h"
 #include "table.h"
+#include "expiration.h"
 
 static void send_idle_notification(ft_entry_t *entry);
 
-static LIST_DEFINE(expiration_queue);
+/*
+ * Binary min-heap of flowtable entries ordered by expiration time
+ *
+ * Each entry records its position in the heap (expiration_index) so that
+ * removal and re-arming don't need to search for it. Insert, remove and
+ * update are all O(log n).
+ */
+static ft_entry_t **expiration_heap;
+static int expiration_heap_count;
+static int expiration_heap_size;
 static bool task_running = false;
+static bool expiration_enabled = true;
+static bool expiration_by_counters = false;
+static bool flow_removed_waiting = false;
+
+#define EXPIRATION_HEAP_INITIAL_SIZE 1024
+
+/* Most entries taken off the heap between yields */
+#define EXPIRATION_BATCH_SIZE 256
 
 static indigo_time_t
 calc_expiration_time(ft_entry_t *entry, int *reason)
@@ -58,102 +76,368 @@ calc_expiration_time(ft_entry_t *entry, int *reason)
     }
 }
 
+static void
+heap_set(int idx, ft_entry_t *entry)
+{
+    expiration_heap[idx] = entry;
+    entry->expiration_index = idx;
+}
+
+static void
+heap_sift_up(int idx)
+{
+    ft_entry_t *entry = expiration_heap[idx];
+
+    while (idx > 0) {
+        int parent = (idx - 1) / 2;
+        if (expiration_heap[parent]->expiration_time <= entry->expiration_time) {
+            break;
+        }
+        heap_set(idx, expiration_heap[parent]);
+        idx = parent;
+    }
+
+    heap_set(idx, entry);
+}
+
+static void
+heap_sift_down(int idx)
+{
+    ft_entry_t *entry = expiration_heap[idx];
+
+    while (1) {
+        int child = 2 * idx + 1;
+        if (child >= expiration_heap_count) {
+            break;
+        }
+        if (child + 1 < expiration_heap_count &&
+            expiration_heap[child + 1]->expiration_time <
+            expiration_heap[child]->expiration_time) {
+            child++;
+        }
+        if (entry->expiration_time <= expiration_heap[child]->expiration_time) {
+            break;
+        }
+        heap_set(idx, expiration_heap[child]);
+        idx = child;
+    }
+
+    heap_set(idx, entry);
+}
+
+void
+ind_core_expiration_enable_set(bool enable)
+{
+    expiration_enabled = enable;
+}
+
+void
+ind_core_expiration_by_counters_set(bool enable)
+{
+    expiration_by_counters = enable;
+}
+
 void
 ind_core_expiration_add(ft_entry_t *entry)
 {
     int reason;
-    indigo_time_t expiration_time = calc_expiration_time(entry, &reason);
-    list_links_t *cur;
 
-    /* Iterate over list in reverse order */
-    for (cur = expiration_queue.links.prev;
-         cur != &expiration_queue.links;
-         cur = cur->prev) {
-        ft_entry_t *other = FT_ENTRY_CONTAINER(cur, expiration);
-        if (calc_expiration_time(other, &reason) <= expiration_time) {
-            /* 'other' expires before us. Insert after it. */
-            list_insert_after(cur, &entry->expiration_links);
-            return;
-        }
+    if (!expiration_enabled) {
+        return;
+    }
+
+    if (expiration_heap_count == expiration_heap_size) {
+        int new_size = expiration_heap_size ?
+            expiration_heap_size * 2 : EXPIRATION_HEAP_INITIAL_SIZE;
+        expiration_heap = aim_realloc(expiration_heap,
+                                      new_size * sizeof(*expiration_heap));
+        AIM_TRUE_OR_DIE(expiration_heap != NULL);
+        expiration_heap_size = new_size;
     }
 
-    /* Lowest expiration time. Insert at front of list. */
-    list_unshift(&expiration_queue, &entry->expiration_links);
+    entry->expiration_time = calc_expiration_time(entry, &reason);
+    heap_set(expiration_heap_count++, entry);
+    heap_sift_up(entry->expiration_index);
 }
 
 void
 ind_core_expiration_remove(ft_entry_t *entry)
 {
-    list_remove(&entry->expiration_links);
+    int idx = entry->expiration_index;
+    ft_entry_t *last;
+
+    if (idx < 0) {
+        /* Added while forwarding owned expiration */
+        return;
+    }
+
+    INDIGO_ASSERT(idx >= 0 && idx < expiration_heap_count);
+    INDIGO_ASSERT(expiration_heap[idx] == entry);
+
+    entry->expiration_index = -1;
+    last = expiration_heap[--expiration_heap_count];
+    if (last == entry) {
+        return;
+    }
+
+    /* Move the last element into the hole and restore the heap property */
+    heap_set(idx, last);
+    if (idx > 0 &&
+        expiration_heap[(idx - 1) / 2]->expiration_time > last->expiration_time) {
+        heap_sift_up(idx);
+    } else {
+        heap_sift_down(idx);
+    }
 }
 
+/*
+ * Fetch the hit status of a batch of idle entries with one call per table.
+ * Entries whose table failed to report are marked in 'failed'.
+ */
 static void
-expire_flow(ft_entry_t *entry, int reason)
-{
-    if (reason == INDIGO_FLOW_REMOVED_HARD_TIMEOUT) {
-        LOG_TRACE("Hard TO (%d): " INDIGO_FLOW_ID_PRINTF_FORMAT,
-                  entry->hard_timeout,
-                  INDIGO_FLOW_ID_PRINTF_ARG(entry->id));
-        ind_core_flow_entry_delete(entry, reason);
-    } else if (reason == OF_FLOW_REMOVED_REASON_IDLE_TIMEOUT) {
-        int rv;
-        bool hit;
-
-        /* Get hit status for idle timeouts */
-        ind_core_table_t *table = ind_core_table_get(entry->table_id);
-        if (table != NULL) {
-            rv = table->ops->entry_hit_status_get(table->priv, entry->priv, &hit);
+expiration_hit_status_get(ft_entry_t **entries, int count,
+                          bool *hits, bool *failed)
+{
+    void *privs[EXPIRATION_BATCH_SIZE];
+    indigo_cookie_t flow_ids[EXPIRATION_BATCH_SIZE];
+    bool table_hits[EXPIRATION_BATCH_SIZE];
+    int idxs[EXPIRATION_BATCH_SIZE];
+    bool done[EXPIRATION_BATCH_SIZE];
+    ind_core_table_t *table;
+    uint8_t table_id;
+    indigo_error_t rv;
+    int i, j, n;
+
+    INDIGO_MEM_SET(done, 0, sizeof(done));
+
+    for (i = 0; i < count; i++) {
+        if (done[i]) {
+            continue;
+        }
+
+        table_id = entries[i]->table_id;
+        n = 0;
+        for (j = i; j < count; j++) {
+            if (!done[j] && entries[j]->table_id == table_id) {
+                idxs[n] = j;
+                privs[n] = entries[j]->priv;
+                flow_ids[n] = entries[j]->id;
+                done[j] = true;
+                n++;
+            }
+        }
+
+        table = ind_core_table_get(table_id);
+        if (table == NULL) {
+            rv = indigo_fwd_flow_hit_status_bulk_get(n, flow_ids, table_hits);
+        } else if (table->ops->entry_hit_status_bulk_get != NULL) {
+            rv = table->ops->entry_hit_status_bulk_get(table->priv, n, privs,
+                                                       table_hits);
         } else {
-            rv = indigo_fwd_flow_hit_status_get(entry->id, &hit);
+            rv = INDIGO_ERROR_NONE;
+            for (j = 0; j < n && rv == INDIGO_ERROR_NONE; j++) {
+                rv = table->ops->entry_hit_status_get(table->priv, privs[j],
+                                                      &table_hits[j]);
+            }
         }
 
         if (rv != INDIGO_ERROR_NONE) {
-            LOG_ERROR("Failed to get hit status for flow "
-                      INDIGO_FLOW_ID_PRINTF_FORMAT": %s",
-                      entry->id, indigo_strerror(rv));
-            return;
+            LOG_ERROR("Failed to get hit status for %d flows in table %u: %s",
+                      n, table_id, indigo_strerror(rv));
+        }
+
+        for (j = 0; j < n; j++) {
+            hits[idxs[j]] = table_hits[j];
+            failed[idxs[j]] = rv != INDIGO_ERROR_NONE;
+        }
+    }
+}
+
+/*
+ * Decide from the packet counters whether a batch of idle entries was hit.
+ * Fetching the stats moves last_counter_change if the count changed, as
+ * does any other stats fetch since the entry was armed; either way the
+ * idle deadline has moved past the one it was armed with. The caller
+ * holds a bulk stats request open, so forwarding reads its counters once
+ * per run rather than once per flow.
+ */
+static void
+expiration_counters_get(ft_entry_t **entries, int count,
+                        bool *hits, bool *failed)
+{
+    indigo_fi_flow_stats_t flow_stats[EXPIRATION_BATCH_SIZE];
+    indigo_error_t results[EXPIRATION_BATCH_SIZE];
+    ft_entry_t *entry;
+    int i;
+
+    ind_core_entries_stats_get(entries, count, flow_stats, results);
+
+    for (i = 0; i < count; i++) {
+        entry = entries[i];
+        failed[i] = results[i] != INDIGO_ERROR_NONE;
+        hits[i] = entry->last_counter_change + entry->idle_timeout*1000 >
+            entry->expiration_time;
+    }
+}
+
+/*
+ * Expire or re-arm a batch of entries due for an idle timeout. The
+ * entries have already been removed from the expiration heap.
+ */
+static void
+expire_idle_flows(ft_entry_t **entries, int count)
+{
+    bool hits[EXPIRATION_BATCH_SIZE];
+    bool failed[EXPIRATION_BATCH_SIZE];
+    ft_entry_t *idle[EXPIRATION_BATCH_SIZE];
+    ft_entry_t *entry;
+    int idle_count = 0;
+    int i;
+
+    if (expiration_by_counters) {
+        expiration_counters_get(entries, count, hits, failed);
+    } else {
+        expiration_hit_status_get(entries, count, hits, failed);
+    }
+
+    for (i = 0; i < count; i++) {
+        entry = entries[i];
+
+        if (failed[i]) {
+            /* Check again after another idle period */
+            entry->last_counter_change = INDIGO_CURRENT_TIME;
+            ind_core_expiration_add(entry);
+            continue;
         }
 
-        if (hit || entry->flags & OF_FLOW_MOD_FLAG_BSN_SEND_IDLE) {
-            /* Reinsert entry into the expiration list */
+        if (hits[i] || entry->flags & OF_FLOW_MOD_FLAG_BSN_SEND_IDLE) {
+            /* Put the entry back in the heap at its new expiration time */
             entry->last_counter_change = INDIGO_CURRENT_TIME;
-            ind_core_expiration_remove(entry);
             ind_core_expiration_add(entry);
         }
 
-        if (!hit) {
+        if (!hits[i]) {
             if (entry->flags & OF_FLOW_MOD_FLAG_BSN_SEND_IDLE) {
                 send_idle_notification(entry);
             } else {
                 LOG_TRACE("Idle TO (%d): " INDIGO_FLOW_ID_PRINTF_FORMAT,
                           entry->idle_timeout,
                           INDIGO_FLOW_ID_PRINTF_ARG(entry->id));
-                ind_core_flow_entry_delete(entry, reason);
+                idle[idle_count++] = entry;
             }
         }
     }
+
+    ind_core_flow_entries_delete(idle, idle_count,
+                                 INDIGO_FLOW_REMOVED_IDLE_TIMEOUT);
+}
+
+/* Flow removed messages drained; carry on expiring */
+static void
+expiration_flow_removed_ready(void *cookie)
+{
+    flow_removed_waiting = false;
+    ind_core_expiration_timer(NULL);
+}
+
+/*
+ * Hold off removing a flow that wants a flow_removed while the
+ * connections are backed up, so the message is delayed rather than
+ * dropped. The flow outlives its timeout by the delay.
+ */
+static bool
+expiration_flow_removed_blocked(ft_entry_t *entry)
+{
+    if (!(entry->flags & OF_FLOW_MOD_FLAG_SEND_FLOW_REM) ||
+        !indigo_cxn_flow_removed_blocked()) {
+        return false;
+    }
+
+    if (!flow_removed_waiting) {
+        if (indigo_cxn_flow_removed_ready_register(
+                expiration_flow_removed_ready, NULL) == INDIGO_ERROR_NONE) {
+            flow_removed_waiting = true;
+        }
+        /* Otherwise the next timer run retries */
+    }
+
+    return true;
 }
 
 static ind_soc_task_status_t
 expiration_task(void *cookie)
 {
     indigo_time_t current_time = INDIGO_CURRENT_TIME;
+    ft_entry_t *batch[EXPIRATION_BATCH_SIZE];
+    ft_entry_t *hard[EXPIRATION_BATCH_SIZE];
+    bool blocked = false;
+    bool bulk = false;
+    int count, hard_count, work;
     (void) cookie;
 
-    while (!list_empty(&expiration_queue)) {
-        int reason;
-        list_links_t *links = expiration_queue.links.next;
-        ft_entry_t *entry = FT_ENTRY_CONTAINER(links, expiration);
-        if (calc_expiration_time(entry, &reason) <= current_time) {
-            expire_flow(entry, reason);
-        } else {
+    while (expiration_heap_count > 0 &&
+           expiration_heap[0]->expiration_time <= current_time) {
+        /* The batches below must not hold queued table adds */
+        ind_core_table_pending_flush();
+
+        /* Take the due entries off the heap, up to a batch */
+        count = 0;
+        hard_count = 0;
+        for (work = 0; work < EXPIRATION_BATCH_SIZE; work++) {
+            int reason;
+            ft_entry_t *entry;
+
+            if (expiration_heap_count == 0) {
+                break;
+            }
+            entry = expiration_heap[0];
+            if (entry->expiration_time > current_time) {
+                break;
+            }
+            if (expiration_flow_removed_blocked(entry)) {
+                blocked = true;
+                break;
+            }
+
+            calc_expiration_time(entry, &reason);
+            if (reason == OF_FLOW_REMOVED_REASON_HARD_TIMEOUT) {
+                LOG_TRACE("Hard TO (%d): " INDIGO_FLOW_ID_PRINTF_FORMAT,
+                          entry->hard_timeout,
+                          INDIGO_FLOW_ID_PRINTF_ARG(entry->id));
+                ind_core_expiration_remove(entry);
+                hard[hard_count++] = entry;
+            } else {
+                ind_core_expiration_remove(entry);
+                batch[count++] = entry;
+            }
+        }
+
+        ind_core_flow_entries_delete(hard, hard_count,
+                                     INDIGO_FLOW_REMOVED_HARD_TIMEOUT);
+
+        if (expiration_by_counters && count > 0 && !bulk) {
+            indigo_fwd_flow_stats_bulk_begin(TABLE_ID_ANY);
+            bulk = true;
+        }
+
+        expire_idle_flows(batch, count);
+
+        if (blocked) {
             break;
         }
+
         if (ind_soc_should_yield()) {
+            if (bulk) {
+                indigo_fwd_flow_stats_bulk_end();
+            }
             return IND_SOC_TASK_CONTINUE;
         }
     }
 
+    if (bulk) {
+        indigo_fwd_flow_stats_bulk_end();
+    }
+
     task_running = false;
     return IND_SOC_TASK_FINISHED;
 }
@@ -188,6 +472,7 @@ send_idle_notification(ft_entry_t *entry)
 {
     of_bsn_flow_idle_t *msg;
     of_version_t ver;
+    of_match_t match;
 
     if (indigo_cxn_get_async_version(&ver) < 0) {
         /* No controllers connected */
@@ -203,7 +488,8 @@ send_idle_notification(ft_entry_t *entry)
     of_bsn_flow_idle_priority_set(msg, entry->priority);
     of_bsn_flow_idle_table_id_set(msg, entry->table_id);
 
-    if (of_bsn_flow_idle_match_set(msg, &entry->match)) {
+    ft_match_unpack(entry->match, &match);
+    if (of_bsn_flow_idle_match_set(msg, &match)) {
         LOG_ERROR("Failed to set match in idle notification");
         of_object_delete(msg);
         return;
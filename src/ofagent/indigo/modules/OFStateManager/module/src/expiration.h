@@ -32,6 +32,22 @@
 
 #include "ft_entry.h"
 
+/**
+ * Choose whether flow timeouts are tracked here
+ * @param enable False when forwarding expires flows itself
+ *
+ * Only takes effect for entries added afterwards.
+ */
+void ind_core_expiration_enable_set(bool enable);
+
+/**
+ * Choose how idle flows are detected
+ * @param enable True to compare each due flow's packet counter with the
+ * last one seen, fetched under one bulk stats request per expiration
+ * run, instead of asking forwarding for its hit status
+ */
+void ind_core_expiration_by_counters_set(bool enable);
+
 /**
  * Add a flow entry to the expiration datastructure
  * @param entry Pointer to the entry to be added
@@ -0,0 +1,381 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Flow counter subscriptions
+ *
+ * Instead of polling flow stats for every flow to find the few whose
+ * counters moved, a controller subscribes and the switch sends it the
+ * counter deltas of the flows that changed. LOCI has no message for
+ * this, so it is carried in BSN experimenter messages:
+ *
+ * Subscribe (subtype IND_CORE_FLOW_COUNTERS_SUBSCRIBE_SUBTYPE), data is
+ *     uint32_t interval_ms; uint32_t threshold;
+ *     uint64_t cookie; uint64_t cookie_mask;
+ * Every interval_ms the flows whose cookie matches under cookie_mask are
+ * read from one bulk stats snapshot, and those that matched at least
+ * threshold packets (any change if 0) since they were last reported are
+ * sent. An interval of 0 unsubscribes. The switch answers with the same
+ * message. A new subscription replaces the last, from any connection.
+ *
+ * Update (subtype IND_CORE_FLOW_COUNTERS_UPDATE_SUBTYPE), xid 0, data is
+ *     uint32_t sweep; uint16_t flags; uint16_t count; record...
+ * with count records of
+ *     uint64_t cookie; uint8_t table_id; uint8_t pad;
+ *     uint16_t priority; uint32_t pad;
+ *     uint64_t packets; uint64_t bytes;
+ * holding the deltas. IND_CORE_FLOW_COUNTERS_MORE is set in flags on
+ * every update of a sweep but the last. Flows are named by cookie, table
+ * and priority, so a controller that wants per flow counters gives its
+ * flows distinct cookies. A sweep is skipped while the subscriber's
+ * output is blocked; its deltas are carried into the next one.
+ */
+
+#include "ofstatemanager_log.h"
+
+#include <string.h>
+#include <inttypes.h>
+
+#include <indigo/indigo.h>
+#include <indigo/forwarding.h>
+#include <indigo/of_state_manager.h>
+#include <loci/loci.h>
+#include "ofstatemanager_decs.h"
+#include "flow_counters.h"
+
+/* Bytes of subscribe data */
+#define SUBSCRIBE_DATA_LEN 24
+
+/* Bytes of update header and of each record */
+#define UPDATE_HEADER_LEN 8
+#define UPDATE_RECORD_LEN 32
+
+/* Records per update message */
+#define UPDATE_RECORDS_MAX 1024
+
+/* Shortest interval accepted */
+#define INTERVAL_MIN_MS 100
+
+static struct {
+    bool subscribed;
+    bool sweep_running;
+    indigo_cxn_id_t cxn_id;
+    of_version_t version;
+    uint32_t interval_ms;
+    uint32_t threshold;
+    uint64_t cookie;
+    uint64_t cookie_mask;
+    uint32_t sweep;
+
+    /* Update being filled */
+    uint8_t *buf;
+    int count;
+    int sweep_updates;          /* Sent so far in this sweep */
+
+    /* Stats */
+    uint64_t sweeps;
+    uint64_t skipped;
+    uint64_t records;
+    uint64_t updates;
+} flow_counters;
+
+static inline uint32_t
+get_u32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+        ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline uint64_t
+get_u64(const uint8_t *p)
+{
+    return ((uint64_t)get_u32(p) << 32) | get_u32(p + 4);
+}
+
+static inline void
+put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8; p[1] = v;
+}
+
+static inline void
+put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static inline void
+put_u64(uint8_t *p, uint64_t v)
+{
+    put_u32(p, v >> 32);
+    put_u32(p + 4, v);
+}
+
+/* Send the records collected so far */
+static void
+update_send(int more)
+{
+    of_experimenter_t *msg;
+    of_octets_t octets;
+
+    /* A sweep that found nothing sends nothing */
+    if (flow_counters.count == 0 && (more || flow_counters.sweep_updates == 0)) {
+        return;
+    }
+
+    put_u32(flow_counters.buf, flow_counters.sweep);
+    put_u16(flow_counters.buf + 4, more ? IND_CORE_FLOW_COUNTERS_MORE : 0);
+    put_u16(flow_counters.buf + 6, flow_counters.count);
+    octets.data = flow_counters.buf;
+    octets.bytes = UPDATE_HEADER_LEN + flow_counters.count * UPDATE_RECORD_LEN;
+    flow_counters.count = 0;
+
+    if ((msg = of_experimenter_new(flow_counters.version)) == NULL) {
+        LOG_ERROR("Failed to allocate flow counter update");
+        return;
+    }
+
+    of_experimenter_xid_set(msg, 0);
+    of_experimenter_experimenter_set(msg, OF_EXPERIMENTER_ID_BSN);
+    of_experimenter_subtype_set(msg, IND_CORE_FLOW_COUNTERS_UPDATE_SUBTYPE);
+    if (of_experimenter_data_set(msg, &octets) < 0) {
+        LOG_ERROR("Failed to set flow counter update data");
+        of_object_delete(msg);
+        return;
+    }
+
+    indigo_cxn_send_controller_message(flow_counters.cxn_id, msg);
+    flow_counters.sweep_updates++;
+    flow_counters.updates++;
+}
+
+static void
+record_append(ft_entry_t *entry, uint64_t packets, uint64_t bytes)
+{
+    uint8_t *p = flow_counters.buf + UPDATE_HEADER_LEN +
+        flow_counters.count * UPDATE_RECORD_LEN;
+
+    memset(p, 0, UPDATE_RECORD_LEN);
+    put_u64(p, entry->cookie);
+    p[8] = entry->table_id;
+    put_u16(p + 10, entry->priority);
+    put_u64(p + 16, packets);
+    put_u64(p + 24, bytes);
+
+    flow_counters.records++;
+    if (++flow_counters.count == UPDATE_RECORDS_MAX) {
+        update_send(1);
+    }
+}
+
+static void
+sweep_coroutine(void *cookie)
+{
+    indigo_fi_flow_stats_t flow_stats;
+    of_meta_match_t query;
+    ft_iterator_t iter;
+    ft_entry_t *entry;
+    uint64_t packets, bytes;
+
+    memset(&query, 0, sizeof(query));
+    query.table_id = TABLE_ID_ANY;
+    query.cookie = flow_counters.cookie;
+    query.cookie_mask = flow_counters.cookie_mask;
+    query.mode = OF_MATCH_COOKIE_ONLY;
+
+    ft_iterator_init(&iter, ind_core_ft, &query);
+    while ((entry = ft_iterator_next(&iter)) != NULL) {
+        if (!flow_counters.subscribed) {
+            break;
+        }
+
+        if (ind_core_entry_stats_get(entry, &flow_stats) != INDIGO_ERROR_NONE) {
+            continue;
+        }
+
+        /* Counters that went backwards were reset */
+        packets = entry->packets >= entry->reported_packets ?
+            entry->packets - entry->reported_packets : entry->packets;
+        bytes = entry->bytes >= entry->reported_bytes ?
+            entry->bytes - entry->reported_bytes : entry->bytes;
+
+        if ((packets != 0 || bytes != 0) && packets >= flow_counters.threshold) {
+            record_append(entry, packets, bytes);
+            entry->reported_packets = entry->packets;
+            entry->reported_bytes = entry->bytes;
+        }
+
+        ind_soc_coroutine_maybe_yield();
+    }
+    ft_iterator_cleanup(&iter);
+
+    if (flow_counters.subscribed) {
+        update_send(0);
+    }
+
+    indigo_fwd_flow_stats_bulk_end();
+    flow_counters.sweep_running = false;
+}
+
+static void
+sweep_timer(void *cookie)
+{
+    indigo_cxn_status_t status;
+    indigo_error_t rv;
+
+    if (flow_counters.sweep_running) {
+        return;
+    }
+
+    if (indigo_cxn_connection_status_get(flow_counters.cxn_id, &status) < 0 ||
+        status.state != INDIGO_CXN_S_HANDSHAKE_COMPLETE) {
+        LOG_INFO("Flow counter subscriber disconnected; unsubscribing");
+        ind_core_flow_counters_stop();
+        return;
+    }
+
+    /* Don't pile updates behind a slow reader; the deltas keep */
+    if (indigo_cxn_output_blocked(flow_counters.cxn_id)) {
+        flow_counters.skipped++;
+        return;
+    }
+
+    flow_counters.sweep++;
+    flow_counters.sweeps++;
+    flow_counters.count = 0;
+    flow_counters.sweep_updates = 0;
+    indigo_fwd_flow_stats_bulk_begin(TABLE_ID_ANY);
+
+    rv = ind_soc_coroutine_spawn(sweep_coroutine, NULL, -10);
+    if (rv != INDIGO_ERROR_NONE) {
+        LOG_ERROR("Failed to start flow counter sweep: %s",
+                  indigo_strerror(rv));
+        indigo_fwd_flow_stats_bulk_end();
+        return;
+    }
+
+    flow_counters.sweep_running = true;
+}
+
+void
+ind_core_flow_counters_stop(void)
+{
+    if (!flow_counters.subscribed) {
+        return;
+    }
+
+    ind_soc_timer_event_unregister(sweep_timer, NULL);
+    flow_counters.subscribed = false;
+
+    /* A running sweep stops at its next entry and frees nothing */
+}
+
+static void
+subscribe(indigo_cxn_id_t cxn_id, of_object_t *obj, const uint8_t *data)
+{
+    of_object_t *reply;
+    uint32_t interval_ms = get_u32(data);
+
+    if (interval_ms != 0 && interval_ms < INTERVAL_MIN_MS) {
+        indigo_cxn_send_error_reply(cxn_id, obj, OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_EPERM);
+        return;
+    }
+
+    ind_core_flow_counters_stop();
+
+    if (interval_ms != 0) {
+        if (flow_counters.buf == NULL) {
+            flow_counters.buf = aim_malloc(UPDATE_HEADER_LEN +
+                                           UPDATE_RECORDS_MAX * UPDATE_RECORD_LEN);
+        }
+
+        flow_counters.cxn_id = cxn_id;
+        flow_counters.version = obj->version;
+        flow_counters.interval_ms = interval_ms;
+        flow_counters.threshold = get_u32(data + 4);
+        flow_counters.cookie = get_u64(data + 8);
+        flow_counters.cookie_mask = get_u64(data + 16);
+
+        if (ind_soc_timer_event_register_with_priority(
+                sweep_timer, NULL, interval_ms, -10) < 0) {
+            LOG_ERROR("Failed to register flow counter timer");
+            indigo_cxn_send_error_reply(cxn_id, obj, OF_ERROR_TYPE_BAD_REQUEST,
+                                        OF_REQUEST_FAILED_EPERM);
+            return;
+        }
+        flow_counters.subscribed = true;
+
+        LOG_VERBOSE("Flow counter subscription every %u ms, threshold %u",
+                    interval_ms, flow_counters.threshold);
+    }
+
+    /* Acknowledge with the same message */
+    if ((reply = of_object_dup(obj)) == NULL) {
+        LOG_ERROR("Failed to allocate flow counter subscribe reply");
+        return;
+    }
+    indigo_cxn_send_controller_message(cxn_id, reply);
+}
+
+int
+ind_core_flow_counters_handle(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+    uint32_t experimenter, subtype;
+    of_octets_t data;
+
+    of_experimenter_experimenter_get(obj, &experimenter);
+    if (experimenter != OF_EXPERIMENTER_ID_BSN) {
+        return 0;
+    }
+
+    of_experimenter_subtype_get(obj, &subtype);
+    if (subtype != IND_CORE_FLOW_COUNTERS_SUBSCRIBE_SUBTYPE) {
+        return 0;
+    }
+
+    of_experimenter_data_get(obj, &data);
+    if (data.bytes < SUBSCRIBE_DATA_LEN) {
+        indigo_cxn_send_error_reply(cxn_id, obj, OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_BAD_LEN);
+        return 1;
+    }
+
+    subscribe(cxn_id, obj, data.data);
+    return 1;
+}
+
+void
+ind_core_flow_counters_show(aim_pvs_t *pvs)
+{
+    if (!flow_counters.subscribed) {
+        aim_printf(pvs, "Flow counter subscription off\n");
+    } else {
+        aim_printf(pvs, "Flow counter subscription cxn %d, every %u ms, "
+                   "threshold %u, cookie 0x%"PRIx64"/0x%"PRIx64"\n",
+                   flow_counters.cxn_id, flow_counters.interval_ms,
+                   flow_counters.threshold, flow_counters.cookie,
+                   flow_counters.cookie_mask);
+    }
+    aim_printf(pvs, "  sweeps %"PRIu64" skipped %"PRIu64" records %"PRIu64
+               " updates %"PRIu64"\n",
+               flow_counters.sweeps, flow_counters.skipped,
+               flow_counters.records, flow_counters.updates);
+}
@@ -0,0 +1,55 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Flow counter subscriptions
+ *
+ * See flow_counters.c for the messages.
+ */
+
+#ifndef _OFSTATEMANAGER_FLOW_COUNTERS_H_
+#define _OFSTATEMANAGER_FLOW_COUNTERS_H_
+
+#include <indigo/indigo.h>
+#include <indigo/of_connection_manager.h>
+#include <loci/loci.h>
+
+/* BSN experimenter subtypes; the bundle messages use 0x100 and 0x101 */
+#define IND_CORE_FLOW_COUNTERS_SUBSCRIBE_SUBTYPE 0x102
+#define IND_CORE_FLOW_COUNTERS_UPDATE_SUBTYPE 0x103
+
+/* Update flag: more updates follow for this sweep */
+#define IND_CORE_FLOW_COUNTERS_MORE 0x1
+
+/**
+ * Handle an experimenter message if it is a flow counter subscription
+ *
+ * @returns 1 if the message was consumed, 0 to pass it on
+ */
+int ind_core_flow_counters_handle(of_object_t *obj, indigo_cxn_id_t cxn_id);
+
+/**
+ * Cancel the subscription, if any
+ */
+void ind_core_flow_counters_stop(void);
+
+void ind_core_flow_counters_show(aim_pvs_t *pvs);
+
+#endif /* _OFSTATEMANAGER_FLOW_COUNTERS_H_ */
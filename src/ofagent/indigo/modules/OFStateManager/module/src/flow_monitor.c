@@ -0,0 +1,455 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Flow monitors
+ *
+ * A connection sets up monitors on a part of the flow table and is sent
+ * each flow added, modified or removed there, by any connection or by
+ * expiry, so it need not dump the table to follow changes. This follows
+ * OpenFlow 1.4 flow monitoring; LOCI has no 1.4 messages, so it is
+ * carried in BSN experimenter messages:
+ *
+ * Monitor request (subtype IND_CORE_FLOW_MONITOR_REQUEST_SUBTYPE), data is
+ *     uint32_t monitor_id; uint16_t command; uint16_t flags;
+ *     uint8_t table_id; uint8_t pad[7];
+ *     uint64_t cookie; uint64_t cookie_mask;
+ *     match (optional)
+ * with command IND_CORE_FLOW_MONITOR_ADD, _MODIFY or _DELETE and flags
+ * of IND_CORE_FLOW_MONITOR_F_*. Flows in table_id (or any, if
+ * TABLE_ID_ANY) whose cookie matches under cookie_mask and whose match
+ * is at least as specific as the given match (or any, if none) are
+ * monitored. Monitor ids are per connection. The switch answers with the
+ * same message.
+ *
+ * Update (subtype IND_CORE_FLOW_MONITOR_UPDATE_SUBTYPE), xid 0, data is
+ *     uint32_t monitor_id; uint16_t event; uint16_t pad;
+ *     flow_add (absent for PAUSED and RESUMED)
+ * with event one of IND_CORE_FLOW_MONITOR_EVENT_* and a flow_add message
+ * describing the flow as it now is (or was, if removed). With
+ * IND_CORE_FLOW_MONITOR_F_INITIAL the monitored flows are first sent as
+ * INITIAL events.
+ *
+ * As in 1.4, when a monitoring connection's output is blocked its
+ * monitors send PAUSED and then drop events until the output drains,
+ * when they send RESUMED; the controller must then read the monitored
+ * flows again.
+ */
+
+#include "ofstatemanager_log.h"
+
+#include <string.h>
+
+#include <AIM/aim_list.h>
+#include <indigo/indigo.h>
+#include <loci/loci.h>
+#include "ofstatemanager_decs.h"
+#include "flow_monitor.h"
+#include "snapshot.h"
+
+/* Bytes of request data before the match, and of update header */
+#define REQUEST_HEADER_LEN 32
+#define UPDATE_HEADER_LEN 8
+
+typedef struct flow_monitor_s {
+    list_links_t links;
+    indigo_cxn_id_t cxn_id;
+    of_version_t version;
+    uint32_t monitor_id;
+    uint16_t flags;
+    of_meta_match_t query;
+    bool paused;
+    bool deleted;               /* Freed by the INITIAL walk when it ends */
+    bool initial_running;
+} flow_monitor_t;
+
+static LIST_DEFINE(flow_monitors);
+static int flow_monitor_count;
+static uint64_t flow_monitor_updates;
+static uint64_t flow_monitor_pauses;
+
+static inline uint16_t
+get_u16(const uint8_t *p)
+{
+    return ((uint16_t)p[0] << 8) | p[1];
+}
+
+static inline uint32_t
+get_u32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+        ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline uint64_t
+get_u64(const uint8_t *p)
+{
+    return ((uint64_t)get_u32(p) << 32) | get_u32(p + 4);
+}
+
+static inline void
+put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8; p[1] = v;
+}
+
+static inline void
+put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+}
+
+static flow_monitor_t *
+monitor_find(indigo_cxn_id_t cxn_id, uint32_t monitor_id)
+{
+    list_links_t *cur;
+
+    LIST_FOREACH(&flow_monitors, cur) {
+        flow_monitor_t *monitor = container_of(cur, links, flow_monitor_t);
+        if (!monitor->deleted && monitor->cxn_id == cxn_id &&
+                monitor->monitor_id == monitor_id) {
+            return monitor;
+        }
+    }
+
+    return NULL;
+}
+
+static void
+monitor_delete(flow_monitor_t *monitor)
+{
+    if (monitor->deleted) {
+        return;
+    }
+
+    monitor->deleted = true;
+    flow_monitor_count--;
+    if (!monitor->initial_running) {
+        list_remove(&monitor->links);
+        aim_free(monitor);
+    }
+}
+
+/* Send one update; flow_add is NULL for PAUSED and RESUMED */
+static void
+update_send(flow_monitor_t *monitor, uint16_t event, of_flow_add_t *flow_add)
+{
+    of_experimenter_t *msg;
+    of_octets_t octets;
+    uint8_t *data;
+    int flow_bytes = flow_add != NULL ? flow_add->length : 0;
+
+    if ((msg = of_experimenter_new(monitor->version)) == NULL) {
+        LOG_ERROR("Failed to allocate flow monitor update");
+        return;
+    }
+
+    data = aim_malloc(UPDATE_HEADER_LEN + flow_bytes);
+    put_u32(data, monitor->monitor_id);
+    put_u16(data + 4, event);
+    put_u16(data + 6, 0);
+    if (flow_add != NULL) {
+        memcpy(data + UPDATE_HEADER_LEN, OF_OBJECT_BUFFER_INDEX(flow_add, 0),
+               flow_bytes);
+    }
+    octets.data = data;
+    octets.bytes = UPDATE_HEADER_LEN + flow_bytes;
+
+    of_experimenter_xid_set(msg, 0);
+    of_experimenter_experimenter_set(msg, OF_EXPERIMENTER_ID_BSN);
+    of_experimenter_subtype_set(msg, IND_CORE_FLOW_MONITOR_UPDATE_SUBTYPE);
+    if (of_experimenter_data_set(msg, &octets) < 0) {
+        LOG_ERROR("Failed to set flow monitor update data");
+        of_object_delete(msg);
+        aim_free(data);
+        return;
+    }
+    aim_free(data);
+
+    indigo_cxn_send_controller_message(monitor->cxn_id, msg);
+    flow_monitor_updates++;
+}
+
+/*
+ * Send an event unless the connection is backed up; see above. Returns
+ * false if the monitor's connection is gone and it was deleted.
+ */
+static bool
+monitor_send(flow_monitor_t *monitor, uint16_t event, of_flow_add_t *flow_add)
+{
+    indigo_cxn_status_t status;
+
+    if (indigo_cxn_connection_status_get(monitor->cxn_id, &status) < 0 ||
+            status.state != INDIGO_CXN_S_HANDSHAKE_COMPLETE) {
+        monitor_delete(monitor);
+        return false;
+    }
+
+    if (indigo_cxn_output_blocked(monitor->cxn_id)) {
+        if (!monitor->paused) {
+            update_send(monitor, IND_CORE_FLOW_MONITOR_EVENT_PAUSED, NULL);
+            monitor->paused = true;
+            flow_monitor_pauses++;
+        }
+        return true;
+    }
+
+    if (monitor->paused) {
+        update_send(monitor, IND_CORE_FLOW_MONITOR_EVENT_RESUMED, NULL);
+        monitor->paused = false;
+    }
+
+    update_send(monitor, event, flow_add);
+    return true;
+}
+
+void
+ind_core_flow_monitor_notify(ft_entry_t *entry, uint16_t event)
+{
+    static const uint16_t event_flags[] = {
+        [IND_CORE_FLOW_MONITOR_EVENT_ADDED] = IND_CORE_FLOW_MONITOR_F_ADD,
+        [IND_CORE_FLOW_MONITOR_EVENT_REMOVED] = IND_CORE_FLOW_MONITOR_F_REMOVED,
+        [IND_CORE_FLOW_MONITOR_EVENT_MODIFIED] = IND_CORE_FLOW_MONITOR_F_MODIFY,
+    };
+    of_flow_add_t *flow_add = NULL;
+    list_links_t *cur, *next;
+
+    if (flow_monitor_count == 0) {
+        return;
+    }
+
+    LIST_FOREACH_SAFE(&flow_monitors, cur, next) {
+        flow_monitor_t *monitor = container_of(cur, links, flow_monitor_t);
+
+        if (monitor->deleted || !(monitor->flags & event_flags[event]) ||
+                !ft_entry_meta_match(&monitor->query, entry)) {
+            continue;
+        }
+
+        /* Built once, for the first monitor interested */
+        if (flow_add == NULL &&
+                (flow_add = ind_core_snapshot_flow_add_build(entry)) == NULL) {
+            LOG_ERROR("Failed to describe flow " INDIGO_FLOW_ID_PRINTF_FORMAT
+                      " for flow monitors", entry->id);
+            return;
+        }
+
+        monitor_send(monitor, event, flow_add);
+    }
+
+    if (flow_add != NULL) {
+        of_object_delete(flow_add);
+    }
+}
+
+/* Send the monitored flows as INITIAL events */
+static void
+monitor_initial_coroutine(void *cookie)
+{
+    flow_monitor_t *monitor = cookie;
+    of_flow_add_t *flow_add;
+    ft_iterator_t iter;
+    ft_entry_t *entry;
+
+    ft_iterator_init(&iter, ind_core_ft, &monitor->query);
+    while (!monitor->deleted && (entry = ft_iterator_next(&iter)) != NULL) {
+        /* Unlike later events, the initial flows wait for the reader */
+        while (indigo_cxn_output_blocked(monitor->cxn_id) &&
+               indigo_cxn_output_ready_register(
+                   monitor->cxn_id, ind_soc_coroutine_wake,
+                   ind_soc_coroutine_self()) == INDIGO_ERROR_NONE) {
+            ind_soc_coroutine_wait();
+        }
+
+        if ((flow_add = ind_core_snapshot_flow_add_build(entry)) != NULL) {
+            monitor_send(monitor, IND_CORE_FLOW_MONITOR_EVENT_INITIAL, flow_add);
+            of_object_delete(flow_add);
+        }
+
+        ind_soc_coroutine_maybe_yield();
+    }
+    ft_iterator_cleanup(&iter);
+
+    monitor->initial_running = false;
+    if (monitor->deleted) {
+        list_remove(&monitor->links);
+        aim_free(monitor);
+    }
+}
+
+/* Set the monitor's filter from the request; returns false if malformed */
+static bool
+monitor_query_set(flow_monitor_t *monitor, const uint8_t *data, int bytes)
+{
+    of_octets_t match_octets;
+
+    memset(&monitor->query, 0, sizeof(monitor->query));
+    monitor->query.table_id = data[8];
+    monitor->query.cookie = get_u64(data + 16);
+    monitor->query.cookie_mask = get_u64(data + 24);
+    monitor->query.out_port = OF_PORT_DEST_WILDCARD;
+    monitor->query.mode = OF_MATCH_NON_STRICT;
+
+    if (bytes > REQUEST_HEADER_LEN) {
+        match_octets.data = (uint8_t *)data + REQUEST_HEADER_LEN;
+        match_octets.bytes = bytes - REQUEST_HEADER_LEN;
+        if (of_match_deserialize(monitor->version, &monitor->query.match,
+                                 &match_octets) < 0) {
+            return false;
+        }
+    }
+
+    ft_meta_match_prepare(&monitor->query);
+    return true;
+}
+
+static void
+monitor_request(indigo_cxn_id_t cxn_id, of_object_t *obj,
+                const uint8_t *data, int bytes)
+{
+    uint32_t monitor_id = get_u32(data);
+    uint16_t command = get_u16(data + 4);
+    flow_monitor_t *monitor = monitor_find(cxn_id, monitor_id);
+    flow_monitor_t update;
+    of_object_t *reply;
+    indigo_error_t rv;
+
+    switch (command) {
+    case IND_CORE_FLOW_MONITOR_ADD:
+    case IND_CORE_FLOW_MONITOR_MODIFY:
+        if ((command == IND_CORE_FLOW_MONITOR_ADD) != (monitor == NULL) ||
+                (monitor == NULL &&
+                 flow_monitor_count >= IND_CORE_FLOW_MONITORS_MAX)) {
+            goto eperm;
+        }
+
+        update.version = obj->version;
+        if (!monitor_query_set(&update, data, bytes)) {
+            indigo_cxn_send_error_reply(cxn_id, obj, OF_ERROR_TYPE_BAD_MATCH,
+                                        OF_MATCH_FAILED_BAD_TYPE);
+            return;
+        }
+
+        if (monitor == NULL) {
+            monitor = aim_zmalloc(sizeof(*monitor));
+            monitor->cxn_id = cxn_id;
+            monitor->monitor_id = monitor_id;
+            list_push(&flow_monitors, &monitor->links);
+            flow_monitor_count++;
+        }
+        monitor->version = obj->version;
+        monitor->flags = get_u16(data + 6);
+        monitor->query = update.query;
+        monitor->paused = false;
+        break;
+    case IND_CORE_FLOW_MONITOR_DELETE:
+        if (monitor == NULL) {
+            goto eperm;
+        }
+        monitor_delete(monitor);
+        monitor = NULL;
+        break;
+    default:
+        goto eperm;
+    }
+
+    /* Acknowledge with the same message, ahead of the initial flows */
+    if ((reply = of_object_dup(obj)) != NULL) {
+        indigo_cxn_send_controller_message(cxn_id, reply);
+    } else {
+        LOG_ERROR("Failed to allocate flow monitor reply");
+    }
+
+    if (monitor != NULL && (monitor->flags & IND_CORE_FLOW_MONITOR_F_INITIAL) &&
+            !monitor->initial_running) {
+        rv = ind_soc_coroutine_spawn(monitor_initial_coroutine, monitor,
+                                     IND_SOC_DEFAULT_PRIORITY);
+        if (rv != INDIGO_ERROR_NONE) {
+            LOG_ERROR("Failed to start flow monitor initial walk: %s",
+                      indigo_strerror(rv));
+        } else {
+            monitor->initial_running = true;
+        }
+    }
+    return;
+
+eperm:
+    indigo_cxn_send_error_reply(cxn_id, obj, OF_ERROR_TYPE_BAD_REQUEST,
+                                OF_REQUEST_FAILED_EPERM);
+}
+
+int
+ind_core_flow_monitor_handle(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+    uint32_t experimenter, subtype;
+    of_octets_t data;
+
+    of_experimenter_experimenter_get(obj, &experimenter);
+    if (experimenter != OF_EXPERIMENTER_ID_BSN) {
+        return 0;
+    }
+
+    of_experimenter_subtype_get(obj, &subtype);
+    if (subtype != IND_CORE_FLOW_MONITOR_REQUEST_SUBTYPE) {
+        return 0;
+    }
+
+    of_experimenter_data_get(obj, &data);
+    if (data.bytes < REQUEST_HEADER_LEN) {
+        indigo_cxn_send_error_reply(cxn_id, obj, OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_BAD_LEN);
+        return 1;
+    }
+
+    monitor_request(cxn_id, obj, data.data, data.bytes);
+    return 1;
+}
+
+void
+ind_core_flow_monitor_show(aim_pvs_t *pvs)
+{
+    list_links_t *cur;
+
+    aim_printf(pvs, "%d flow monitors, %"PRIu64" updates, %"PRIu64" pauses\n",
+               flow_monitor_count, flow_monitor_updates, flow_monitor_pauses);
+    LIST_FOREACH(&flow_monitors, cur) {
+        flow_monitor_t *monitor = container_of(cur, links, flow_monitor_t);
+        if (monitor->deleted) {
+            continue;
+        }
+        aim_printf(pvs, "  cxn %d id %u flags 0x%x table %d cookie 0x%"PRIx64
+                   "/0x%"PRIx64"%s%s\n",
+                   monitor->cxn_id, monitor->monitor_id, monitor->flags,
+                   monitor->query.table_id, monitor->query.cookie,
+                   monitor->query.cookie_mask,
+                   monitor->initial_running ? " initial" : "",
+                   monitor->paused ? " paused" : "");
+    }
+}
+
+void
+ind_core_flow_monitor_clear(void)
+{
+    list_links_t *cur, *next;
+
+    LIST_FOREACH_SAFE(&flow_monitors, cur, next) {
+        monitor_delete(container_of(cur, links, flow_monitor_t));
+    }
+}
@@ -0,0 +1,84 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Flow monitors
+ *
+ * See flow_monitor.c for the messages.
+ */
+
+#ifndef _OFSTATEMANAGER_FLOW_MONITOR_H_
+#define _OFSTATEMANAGER_FLOW_MONITOR_H_
+
+#include <indigo/indigo.h>
+#include <indigo/of_connection_manager.h>
+#include <loci/loci.h>
+
+#include "ft_entry.h"
+
+/* BSN experimenter subtypes, after the flow counter messages */
+#define IND_CORE_FLOW_MONITOR_REQUEST_SUBTYPE 0x104
+#define IND_CORE_FLOW_MONITOR_UPDATE_SUBTYPE 0x105
+
+/* Monitors at once, over all connections */
+#define IND_CORE_FLOW_MONITORS_MAX 64
+
+/* Request commands */
+#define IND_CORE_FLOW_MONITOR_ADD 0
+#define IND_CORE_FLOW_MONITOR_MODIFY 1
+#define IND_CORE_FLOW_MONITOR_DELETE 2
+
+/* Request flags, as OpenFlow 1.4 ofp_flow_monitor_flags */
+#define IND_CORE_FLOW_MONITOR_F_INITIAL 0x1
+#define IND_CORE_FLOW_MONITOR_F_ADD 0x2
+#define IND_CORE_FLOW_MONITOR_F_REMOVED 0x4
+#define IND_CORE_FLOW_MONITOR_F_MODIFY 0x8
+
+/* Update events, as OpenFlow 1.4 ofp_flow_update_event */
+#define IND_CORE_FLOW_MONITOR_EVENT_INITIAL 0
+#define IND_CORE_FLOW_MONITOR_EVENT_ADDED 1
+#define IND_CORE_FLOW_MONITOR_EVENT_REMOVED 2
+#define IND_CORE_FLOW_MONITOR_EVENT_MODIFIED 3
+#define IND_CORE_FLOW_MONITOR_EVENT_PAUSED 5
+#define IND_CORE_FLOW_MONITOR_EVENT_RESUMED 6
+
+/**
+ * Handle an experimenter message if it is a flow monitor request
+ *
+ * @returns 1 if the message was consumed, 0 to pass it on
+ */
+int ind_core_flow_monitor_handle(of_object_t *obj, indigo_cxn_id_t cxn_id);
+
+/**
+ * Report a flow added, modified or about to be removed
+ *
+ * @param entry The flowtable entry
+ * @param event IND_CORE_FLOW_MONITOR_EVENT_ADDED, _MODIFIED or _REMOVED
+ */
+void ind_core_flow_monitor_notify(ft_entry_t *entry, uint16_t event);
+
+/**
+ * Delete all monitors
+ */
+void ind_core_flow_monitor_clear(void);
+
+void ind_core_flow_monitor_show(aim_pvs_t *pvs);
+
+#endif /* _OFSTATEMANAGER_FLOW_MONITOR_H_ */
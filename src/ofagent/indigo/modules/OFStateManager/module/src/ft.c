@@ -24,48 +24,384 @@
 
 #include <OFStateManager/ofstatemanager_config.h>
 #include <indigo/indigo.h>
-#include <murmur/murmur.h>
 
 #include "ofstatemanager_log.h"
 #include "ft.h"
+#include "ft_hash.h"
 #include "expiration.h"
+#include "snapshot.h"
+#include "flow_monitor.h"
 
-static indigo_error_t ft_entry_create(indigo_flow_id_t id, of_flow_add_t *flow_add, ft_entry_t **entry_p);
+static indigo_error_t ft_entry_create(ft_instance_t ft, indigo_flow_id_t id, of_flow_add_t *flow_add, ft_entry_t **entry_p);
 static void ft_entry_destroy(ft_instance_t ft, ft_entry_t *entry);
-static indigo_error_t ft_entry_set_effects(ft_entry_t *entry, of_flow_modify_t *flow_mod);
+static indigo_error_t ft_entry_set_effects(ft_instance_t ft, ft_entry_t *entry, of_flow_modify_t *flow_mod);
+static void ft_entry_effects_release(ft_instance_t ft, ft_entry_t *entry);
+static void ft_entry_match_store(ft_instance_t ft, ft_entry_t *entry, of_match_t *match);
+static void ft_entry_match_release(ft_instance_t ft, ft_entry_t *entry);
 static void ft_entry_link(ft_instance_t ft, ft_entry_t *entry);
 static void ft_entry_unlink(ft_instance_t ft, ft_entry_t *entry);
-static int ft_entry_has_out_port(ft_entry_t *entry, of_port_no_t port);
+static void ft_entry_out_refs_link(ft_instance_t ft, ft_entry_t *entry);
+static void ft_entry_out_refs_unlink(ft_instance_t ft, ft_entry_t *entry);
+static int ft_entry_out_match(of_meta_match_t *query, ft_entry_t *entry);
+static ft_entry_t **ft_out_ref_snapshot(ft_instance_t ft, uint8_t kind, uint32_t id, int *count);
+static void ft_entry_retire(ft_instance_t ft, ft_entry_t *entry);
+static void ft_reclaim(ft_instance_t ft);
 
 #define FT_HASH_SEED 0
 
-/**
- * @fixme Consider using something other than murmur for small data
- * hash calculations.  Multiplying by a prime is a good option
+/* See Threading in ft.h */
+#define FT_ASSERT_OWNER(_ft) \
+    INDIGO_ASSERT(pthread_equal(pthread_self(), (_ft)->owner), \
+                  "flowtable used off its owning thread")
+
+AIM_STATIC_ASSERT(ft_match_class_fits,
+                  sizeof(ft_match_t) <= FT_MATCH_MIN_SIZE << (FT_MATCH_CLASS_COUNT - 1));
+
+static uint32_t
+ft_strict_match_hash(ft_match_t *match, uint16_t priority)
+{
+    return ft_hash_bytes(match, ft_match_size(match),
+                         FT_HASH_SEED ^ priority);
+}
+
+/*
+ * 64-bit fingerprint of (match, priority, table_id) compared before the
+ * full match in strict lookups.  The low word is the strict match hash,
+ * which leaves out the table; the high word hashes the match again with
+ * the table and priority in the seed.
  */
+#define FT_STRICT_MATCH_FP_SEED 0x9e3779b9
+
+static uint64_t
+ft_strict_match_fp(ft_match_t *match, uint16_t priority, uint8_t table_id,
+                   uint32_t strict_match_hash)
+{
+    uint32_t seed = FT_STRICT_MATCH_FP_SEED ^ ((uint32_t)table_id << 16) ^ priority;
+
+    return ((uint64_t)ft_hash_bytes(match, ft_match_size(match), seed) << 32) |
+        strict_match_hash;
+}
+
+static uint32_t
+ft_flow_id_hash(indigo_flow_id_t *flow_id)
+{
+    return ft_hash_u64(*flow_id, FT_HASH_SEED);
+}
+
+static uint32_t
+ft_cookie_hash(uint64_t cookie)
+{
+    return ft_hash_u64(cookie, FT_HASH_SEED);
+}
 
 static int
-ft_strict_match_to_bucket_index(ft_instance_t ft,
-                                of_match_t *match,
-                                uint16_t priority)
+ft_cookie_to_bucket_index(ft_instance_t ft, uint64_t cookie)
+{
+    return cookie >> (64 - ft->config.cookie_prefix_len);
+}
+
+static list_head_t *
+ft_prio_bucket(ft_instance_t ft, uint8_t table_id, uint16_t priority)
+{
+    uint32_t key = ((uint32_t)table_id << 16) | priority;
+    uint32_t h = ft_hash_u32(key, FT_HASH_SEED);
+    return &ft->prio_buckets[h % FT_PRIO_BUCKET_COUNT];
+}
+
+static list_head_t *
+ft_out_bucket(ft_instance_t ft, uint8_t kind, uint32_t id)
+{
+    uint32_t h = ft_hash_u32(id, FT_HASH_SEED + kind);
+    return &ft->out_buckets[h % FT_OUT_BUCKET_COUNT];
+}
+
+/****************************************************************
+ * Flow checksums
+ ****************************************************************/
+
+static uint8_t
+ft_checksum_buckets_shift(uint32_t buckets_size)
+{
+    uint8_t bits = 0;
+
+    while (((uint32_t)1 << bits) < buckets_size) {
+        bits++;
+    }
+    return 64 - bits;
+}
+
+static void
+ft_checksum_table_init(ft_checksum_table_t *table, uint32_t buckets_size)
+{
+    table->buckets = aim_zmalloc(sizeof(*table->buckets) * buckets_size);
+    table->buckets_size = buckets_size;
+    table->buckets_shift = ft_checksum_buckets_shift(buckets_size);
+}
+
+static uint64_t *
+ft_checksum_bucket(ft_checksum_table_t *table, uint64_t checksum)
+{
+    /* A shift by 64 is undefined */
+    if (table->buckets_size == 1) {
+        return &table->buckets[0];
+    }
+    return &table->buckets[checksum >> table->buckets_shift];
+}
+
+/* XOR the entry into (or back out of) its table's checksums */
+static void
+ft_checksum_update(ft_instance_t ft, ft_entry_t *entry)
+{
+    ft_checksum_table_t *table = &ft->checksum_tables[entry->table_id];
+
+    table->checksum ^= entry->cookie;
+    *ft_checksum_bucket(table, entry->cookie) ^= entry->cookie;
+}
+
+indigo_error_t
+ft_checksum_buckets_size_set(ft_instance_t ft, uint8_t table_id,
+                             uint32_t buckets_size)
+{
+    ft_checksum_table_t *table = &ft->checksum_tables[table_id];
+    list_links_t *cur;
+    ft_entry_t *entry;
+
+    if (buckets_size == 0 || buckets_size > FT_CHECKSUM_BUCKETS_MAX ||
+        (buckets_size & (buckets_size - 1)) != 0) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (buckets_size == table->buckets_size) {
+        return INDIGO_ERROR_NONE;
+    }
+
+    aim_free(table->buckets);
+    ft_checksum_table_init(table, buckets_size);
+
+    LIST_FOREACH(&ft->table_lists[table_id], cur) {
+        entry = FT_ENTRY_CONTAINER(cur, table_id);
+        *ft_checksum_bucket(table, entry->cookie) ^= entry->cookie;
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+/****************************************************************
+ * Match signatures
+ ****************************************************************/
+
+static void
+ft_match_sig_pack(of_match_fields_t *f, uint64_t *words)
+{
+    words[0] = ((uint64_t)f->in_port << 32) |
+        ((uint64_t)f->eth_type << 16) | f->vlan_vid;
+    words[1] = ((uint64_t)f->ipv4_src << 32) | f->ipv4_dst;
+    words[2] = ((uint64_t)f->ip_proto << 48) |
+        ((uint64_t)f->ofdpa_vrf << 32) |
+        ((uint64_t)f->tcp_dst << 16) | f->udp_dst;
+}
+
+static void
+ft_match_sig_init(ft_match_sig_t *sig, of_match_t *match)
 {
-    uint32_t h = FT_HASH_SEED;
-    h = murmur_hash(match, sizeof(*match), h);
-    h = murmur_hash(&priority, sizeof(priority), h);
-    return h % ft->config.strict_match_bucket_count;
+    ft_match_sig_pack(&match->fields, sig->value);
+    ft_match_sig_pack(&match->masks, sig->mask);
 }
 
+/*
+ * Mirrors OF_OVERLAP_INT over the packed fields: true if some bit is
+ * significant in both matches and differs between them.
+ */
 static int
-ft_flow_id_to_bucket_index(ft_instance_t ft, indigo_flow_id_t *flow_id)
+ft_match_sig_disjoint(ft_match_sig_t *a, ft_match_sig_t *b)
+{
+    int i;
+
+    for (i = 0; i < FT_MATCH_SIG_WORDS; i++) {
+        if ((a->value[i] ^ b->value[i]) & a->mask[i] & b->mask[i]) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/****************************************************************
+ * Linear-hashing indices
+ ****************************************************************/
+
+static void
+ft_index_segment_add(ft_index_t *index)
+{
+    list_head_t *segment;
+    int idx;
+
+    index->segments = aim_realloc(index->segments,
+        (index->num_segments + 1) * sizeof(*index->segments));
+    AIM_TRUE_OR_DIE(index->segments != NULL);
+
+    segment = aim_zmalloc(sizeof(list_head_t) * FT_INDEX_SEGMENT_SIZE);
+    for (idx = 0; idx < FT_INDEX_SEGMENT_SIZE; idx++) {
+        list_init(&segment[idx]);
+    }
+
+    index->segments[index->num_segments++] = segment;
+}
+
+static void
+ft_index_init(ft_index_t *index, int bucket_count,
+              int links_offset, int hash_offset)
+{
+    if (bucket_count <= 0) {
+        bucket_count = 1;
+    }
+
+    INDIGO_MEM_SET(index, 0, sizeof(*index));
+    index->base_count = bucket_count;
+    index->bucket_count = bucket_count;
+    index->links_offset = links_offset;
+    index->hash_offset = hash_offset;
+
+    while (index->num_segments * FT_INDEX_SEGMENT_SIZE < bucket_count) {
+        ft_index_segment_add(index);
+    }
+}
+
+static void
+ft_index_cleanup(ft_index_t *index)
+{
+    int idx;
+
+    for (idx = 0; idx < index->num_segments; idx++) {
+        aim_free(index->segments[idx]);
+    }
+    aim_free(index->segments);
+    index->segments = NULL;
+    index->num_segments = 0;
+}
+
+static uint32_t
+ft_index_entry_hash(ft_index_t *index, ft_entry_t *entry)
 {
-    return (murmur_hash(flow_id, sizeof(*flow_id), FT_HASH_SEED) %
-            ft->config.flow_id_bucket_count);
+    return *(uint32_t *)(((char *)entry) + index->hash_offset);
 }
 
 static int
-ft_cookie_to_bucket_index(ft_instance_t ft, uint64_t cookie)
+ft_index_bucket_index(ft_index_t *index, uint32_t hash)
+{
+    uint32_t level_count = (uint32_t)index->base_count << index->level;
+    uint32_t idx = hash % level_count;
+
+    if (idx < (uint32_t)index->split) {
+        /* Bucket already split in this level */
+        idx = hash % (level_count * 2);
+    }
+
+    return idx;
+}
+
+static list_head_t *
+ft_index_bucket(ft_index_t *index, uint32_t hash)
+{
+    return FT_INDEX_BUCKET(index, ft_index_bucket_index(index, hash));
+}
+
+/*
+ * Add one bucket to the index by splitting the bucket at 'split'
+ *
+ * Only the entries of a single chain are moved, so the cost is bounded by
+ * the chain length.
+ */
+static void
+ft_index_split(ft_index_t *index)
+{
+    uint32_t level_count = (uint32_t)index->base_count << index->level;
+    list_head_t *old_bucket, *new_bucket;
+    list_links_t *cur, *next;
+    int new_idx = index->split + level_count;
+
+    if (new_idx >= index->num_segments * FT_INDEX_SEGMENT_SIZE) {
+        ft_index_segment_add(index);
+    }
+
+    old_bucket = FT_INDEX_BUCKET(index, index->split);
+    new_bucket = FT_INDEX_BUCKET(index, new_idx);
+
+    LIST_FOREACH_SAFE(old_bucket, cur, next) {
+        ft_entry_t *entry = (ft_entry_t *)(((char *)cur) - index->links_offset);
+        if (ft_index_entry_hash(index, entry) % (level_count * 2) != index->split) {
+            list_remove(cur);
+            list_push(new_bucket, cur);
+        }
+    }
+
+    index->bucket_count++;
+    if (++index->split == level_count) {
+        index->level++;
+        index->split = 0;
+    }
+}
+
+static void
+ft_index_maybe_grow(ft_instance_t ft, ft_index_t *index)
+{
+    int max_load = ft->config.max_load_factor;
+    int splits = 0;
+
+    if (index->pins > 0) {
+        /* Caught up on a later add */
+        return;
+    }
+
+    while (ft->status.current_count > index->bucket_count * max_load &&
+           splits++ < FT_INDEX_MAX_SPLITS_PER_ADD) {
+        ft_index_split(index);
+    }
+}
+
+int
+ft_index_length(ft_index_t *index)
 {
-    return cookie >> (64-FT_COOKIE_PREFIX_LEN);
+    int idx, count = 0;
+
+    for (idx = 0; idx < index->bucket_count; idx++) {
+        count += list_length(FT_INDEX_BUCKET(index, idx));
+    }
+
+    return count;
+}
+
+int
+ft_index_chain_max(ft_index_t *index)
+{
+    int idx, length, max = 0;
+
+    for (idx = 0; idx < index->bucket_count; idx++) {
+        length = list_length(FT_INDEX_BUCKET(index, idx));
+        if (length > max) {
+            max = length;
+        }
+    }
+
+    return max;
+}
+
+void
+ft_pools_show(ft_instance_t ft, aim_pvs_t *pvs)
+{
+    int idx;
+
+    ft_pool_show(&ft->entry_pool, pvs);
+    for (idx = 0; idx < FT_EFFECTS_CLASS_COUNT; idx++) {
+        ft_pool_show(&ft->effects_pools[idx], pvs);
+    }
+    aim_printf(pvs, "  %-16s %d unpooled\n", "effects", ft->effects_oversize);
+    ft_pool_show(&ft->effects_ref_pool, pvs);
+    aim_printf(pvs, "  %-16s %"PRIu64" stores reused a shared copy\n",
+               "effects", ft->effects_shares);
+    for (idx = 0; idx < FT_MATCH_CLASS_COUNT; idx++) {
+        ft_pool_show(&ft->match_pools[idx], pvs);
+    }
 }
 
 ft_instance_t
@@ -77,27 +413,85 @@ ft_create(ft_config_t *config)
 
     /* Allocate the flow table itself */
     ft = aim_zmalloc(sizeof(*ft));
+    ft->owner = pthread_self();
     INDIGO_MEM_COPY(&ft->config,  config, sizeof(ft_config_t));
+    if (ft->config.max_load_factor <= 0) {
+        ft->config.max_load_factor = FT_DEFAULT_MAX_LOAD_FACTOR;
+    }
+    if (ft->config.cookie_bucket_count <= 0) {
+        ft->config.cookie_bucket_count = ft->config.flow_id_bucket_count;
+    }
+    if (ft->config.cookie_prefix_len <= 0) {
+        ft->config.cookie_prefix_len = FT_DEFAULT_COOKIE_PREFIX_LEN;
+    } else if (ft->config.cookie_prefix_len > FT_COOKIE_PREFIX_LEN_MAX) {
+        ft->config.cookie_prefix_len = FT_COOKIE_PREFIX_LEN_MAX;
+    }
 
     list_init(&ft->all_list);
+    ft_id_map_init(&ft->flow_ids);
+    list_init(&ft->iterator_list);
+    list_init(&ft->retired_list);
+    ft->epoch = 1;
+
+    ft->table_lists = aim_zmalloc(sizeof(list_head_t) * FT_TABLE_LIST_COUNT);
+    for (idx = 0; idx < FT_TABLE_LIST_COUNT; idx++) {
+        list_init(&ft->table_lists[idx]);
+    }
+    ft->table_counts = aim_zmalloc(sizeof(uint32_t) * FT_TABLE_LIST_COUNT);
+    ft->table_counters = aim_zmalloc(sizeof(ft_table_counters_t) *
+                                     FT_TABLE_LIST_COUNT);
+
+    /* Set up the hash indices */
+    ft_slot_index_init(&ft->strict_match_index,
+                       config->strict_match_bucket_count);
+    ft_index_init(&ft->flow_id_index, config->flow_id_bucket_count,
+                  offsetof(ft_entry_t, flow_id_links),
+                  offsetof(ft_entry_t, flow_id_hash));
+    ft_index_init(&ft->cookie_index, ft->config.cookie_bucket_count,
+                  offsetof(ft_entry_t, cookie_hash_links),
+                  offsetof(ft_entry_t, cookie_hash));
+    ft_index_init(&ft->effects_index, FT_EFFECTS_BUCKET_COUNT,
+                  offsetof(ft_effects_t, links),
+                  offsetof(ft_effects_t, hash));
+
+    bytes = sizeof(list_head_t) * (1 << ft->config.cookie_prefix_len);
+    ft->cookie_buckets = aim_zmalloc(bytes);
+    for (idx = 0; idx < (1 << ft->config.cookie_prefix_len); idx++) {
+        list_init(&ft->cookie_buckets[idx]);
+    }
 
-    /* Allocate and init buckets for each search type */
-    bytes = sizeof(list_head_t) * config->strict_match_bucket_count;
-    ft->strict_match_buckets = aim_zmalloc(bytes);
-    for (idx = 0; idx < config->strict_match_bucket_count; idx++) {
-        list_init(&ft->strict_match_buckets[idx]);
+    ft->prio_buckets = aim_zmalloc(sizeof(list_head_t) * FT_PRIO_BUCKET_COUNT);
+    for (idx = 0; idx < FT_PRIO_BUCKET_COUNT; idx++) {
+        list_init(&ft->prio_buckets[idx]);
     }
 
-    bytes = sizeof(list_head_t) * config->flow_id_bucket_count;
-    ft->flow_id_buckets = aim_zmalloc(bytes);
-    for (idx = 0; idx < config->flow_id_bucket_count; idx++) {
-        list_init(&ft->flow_id_buckets[idx]);
+    ft->out_buckets = aim_zmalloc(sizeof(list_head_t) * FT_OUT_BUCKET_COUNT);
+    for (idx = 0; idx < FT_OUT_BUCKET_COUNT; idx++) {
+        list_init(&ft->out_buckets[idx]);
     }
+    list_init(&ft->out_overflow_list);
 
-    bytes = sizeof(list_head_t) * (1 << FT_COOKIE_PREFIX_LEN);
-    ft->cookie_buckets = aim_zmalloc(bytes);
-    for (idx = 0; idx < (1 << FT_COOKIE_PREFIX_LEN); idx++) {
-        list_init(&ft->cookie_buckets[idx]);
+    ft->checksum_tables = aim_zmalloc(sizeof(ft_checksum_table_t) * FT_TABLE_LIST_COUNT);
+    for (idx = 0; idx < FT_TABLE_LIST_COUNT; idx++) {
+        ft_checksum_table_init(&ft->checksum_tables[idx],
+                               FT_CHECKSUM_BUCKETS_DEFAULT);
+    }
+
+    /* Set up the allocation pools */
+    ft_pool_init(&ft->entry_pool, "entries", sizeof(ft_entry_t),
+                 FT_ENTRY_POOL_SLAB_ENTRIES);
+    ft_pool_slots_enable(&ft->entry_pool, offsetof(ft_entry_t, slot));
+    for (idx = 0; idx < FT_EFFECTS_CLASS_COUNT; idx++) {
+        bytes = FT_EFFECTS_MIN_SIZE << idx;
+        ft_pool_init(&ft->effects_pools[idx], "effects", bytes,
+                     FT_EFFECTS_POOL_SLAB_BYTES / bytes);
+    }
+    ft_pool_init(&ft->effects_ref_pool, "shared effects", sizeof(ft_effects_t),
+                 FT_EFFECTS_REF_POOL_SLAB_ENTRIES);
+    for (idx = 0; idx < FT_MATCH_CLASS_COUNT; idx++) {
+        bytes = FT_MATCH_MIN_SIZE << idx;
+        ft_pool_init(&ft->match_pools[idx], "matches", bytes,
+                     FT_MATCH_POOL_SLAB_BYTES / bytes);
     }
 
     return ft;
@@ -106,13 +500,10 @@ ft_create(ft_config_t *config)
 /* Macro for checking bucket lists are empty */
 #if !defined(FT_NO_ERROR_CHECKING)
 #define CHECK_BUCKETS(type) do {                                           \
-        int idx, cnt;                                                      \
-        for (idx = 0; idx < ft->config.type##_bucket_count; idx++) {       \
-            if ((cnt = list_length(&ft->type##_buckets[idx])) != 0) {      \
-                LOG_ERROR("ERROR: bucket list %s has len %d on delete",    \
-                          #type, cnt);                                     \
-                break;                                                     \
-            }                                                              \
+        int cnt;                                                           \
+        if ((cnt = ft_index_length(&ft->type##_index)) != 0) {             \
+            LOG_ERROR("ERROR: index %s has len %d on delete",              \
+                      #type, cnt);                                         \
         }                                                                  \
     } while (0)
 #else
@@ -124,6 +515,7 @@ ft_destroy(ft_instance_t ft)
 {
     ft_entry_t *entry;
     list_links_t *cur, *next;
+    int idx;
 
     if (ft == NULL) {
         return;
@@ -134,20 +526,67 @@ ft_destroy(ft_instance_t ft)
         ft_entry_destroy(ft, entry);
     }
 
-    if (ft->strict_match_buckets != NULL) {
-        CHECK_BUCKETS(strict_match);
-        aim_free(ft->strict_match_buckets);
-        ft->strict_match_buckets = NULL;
+    INDIGO_ASSERT(list_empty(&ft->iterator_list));
+    ft_reclaim(ft);
+
+    if (ft->strict_match_index.count != 0) {
+        LOG_ERROR("ERROR: index strict_match has len %d on delete",
+                  ft->strict_match_index.count);
     }
-    if (ft->flow_id_buckets != NULL) {
+    ft_slot_index_cleanup(&ft->strict_match_index);
+    if (ft->flow_id_index.segments != NULL) {
         CHECK_BUCKETS(flow_id);
-        aim_free(ft->flow_id_buckets);
-        ft->flow_id_buckets = NULL;
+        ft_index_cleanup(&ft->flow_id_index);
+    }
+    if (ft->cookie_index.segments != NULL) {
+        CHECK_BUCKETS(cookie);
+        ft_index_cleanup(&ft->cookie_index);
+    }
+    if (ft->effects_index.segments != NULL) {
+        CHECK_BUCKETS(effects);
+        ft_index_cleanup(&ft->effects_index);
     }
     if (ft->cookie_buckets != NULL) {
         aim_free(ft->cookie_buckets);
         ft->cookie_buckets = NULL;
     }
+    if (ft->table_lists != NULL) {
+        aim_free(ft->table_lists);
+        ft->table_lists = NULL;
+    }
+    if (ft->table_counts != NULL) {
+        aim_free(ft->table_counts);
+        ft->table_counts = NULL;
+    }
+    if (ft->table_counters != NULL) {
+        aim_free(ft->table_counters);
+        ft->table_counters = NULL;
+    }
+    ft_id_map_cleanup(&ft->flow_ids);
+    if (ft->prio_buckets != NULL) {
+        aim_free(ft->prio_buckets);
+        ft->prio_buckets = NULL;
+    }
+    if (ft->out_buckets != NULL) {
+        aim_free(ft->out_buckets);
+        ft->out_buckets = NULL;
+    }
+    if (ft->checksum_tables != NULL) {
+        for (idx = 0; idx < FT_TABLE_LIST_COUNT; idx++) {
+            aim_free(ft->checksum_tables[idx].buckets);
+        }
+        aim_free(ft->checksum_tables);
+        ft->checksum_tables = NULL;
+    }
+
+    ft_pool_cleanup(&ft->entry_pool);
+    for (idx = 0; idx < FT_EFFECTS_CLASS_COUNT; idx++) {
+        ft_pool_cleanup(&ft->effects_pools[idx]);
+    }
+    ft_pool_cleanup(&ft->effects_ref_pool);
+    for (idx = 0; idx < FT_MATCH_CLASS_COUNT; idx++) {
+        ft_pool_cleanup(&ft->match_pools[idx]);
+    }
 
     aim_free(ft);
 }
@@ -159,6 +598,7 @@ ft_add(ft_instance_t ft, indigo_flow_id_t id,
     ft_entry_t *entry = NULL;
     indigo_error_t rv;
 
+    FT_ASSERT_OWNER(ft);
     LOG_TRACE("Adding flow " INDIGO_FLOW_ID_PRINTF_FORMAT, id);
 
     /* If flow ID already exists, error. */
@@ -166,7 +606,7 @@ ft_add(ft_instance_t ft, indigo_flow_id_t id,
         return INDIGO_ERROR_EXISTS;
     }
 
-    if ((rv = ft_entry_create(id, flow_add, &entry)) < 0) {
+    if ((rv = ft_entry_create(ft, id, flow_add, &entry)) < 0) {
         return rv;
     }
 
@@ -174,6 +614,12 @@ ft_add(ft_instance_t ft, indigo_flow_id_t id,
     ft->status.adds += 1;
     ft->status.current_count += 1;
 
+    ft_index_maybe_grow(ft, &ft->flow_id_index);
+    ft_index_maybe_grow(ft, &ft->cookie_index);
+    ft_index_maybe_grow(ft, &ft->effects_index);
+
+    ind_core_snapshot_flow_write(entry, flow_add);
+
     if (entry_p != NULL) {
         *entry_p = entry;
     }
@@ -184,10 +630,13 @@ ft_add(ft_instance_t ft, indigo_flow_id_t id,
 void
 ft_delete(ft_instance_t ft, ft_entry_t *entry)
 {
+    FT_ASSERT_OWNER(ft);
     LOG_TRACE("Delete flow " INDIGO_FLOW_ID_PRINTF_FORMAT, entry->id);
 
+    ind_core_snapshot_flow_erase(entry->id);
+
     ft_entry_unlink(ft, entry);
-    ft_entry_destroy(ft, entry);
+    ft_entry_retire(ft, entry);
 
     ft->status.current_count -= 1;
     ft->status.deletes += 1;
@@ -198,17 +647,18 @@ ft_strict_match(ft_instance_t instance,
                of_meta_match_t *query,
                ft_entry_t **entry_ptr)
 {
-    int bucket_idx;
-    list_links_t *cur;
+    uint32_t hash, pos, slot;
 
+    FT_ASSERT_OWNER(instance);
     INDIGO_ASSERT(query->mode == OF_MATCH_STRICT);
 
-    bucket_idx = ft_strict_match_to_bucket_index(instance, &query->match,
-                                                 query->priority);
-    list_head_t *bucket = &instance->strict_match_buckets[bucket_idx];
+    ft_meta_match_prepare(query);
 
-    LIST_FOREACH(bucket, cur) {
-        ft_entry_t *entry = FT_ENTRY_CONTAINER(cur, strict_match);
+    hash = ft_strict_match_hash(&query->packed, query->priority);
+    pos = ft_slot_index_start(&instance->strict_match_index, hash);
+    while ((slot = ft_slot_index_next(&instance->strict_match_index,
+                                      hash, &pos)) != FT_SLOT_INDEX_EMPTY) {
+        ft_entry_t *entry = ft_pool_slot_object(&instance->entry_pool, slot);
         if (ft_entry_meta_match(query, entry)) {
             *entry_ptr = entry;
             return INDIGO_ERROR_NONE;
@@ -218,68 +668,273 @@ ft_strict_match(ft_instance_t instance,
     return INDIGO_ERROR_NOT_FOUND;
 }
 
-ft_entry_t *
-ft_lookup(ft_instance_t ft, indigo_flow_id_t id)
+indigo_error_t
+ft_strict_match_flow_add(ft_instance_t ft, of_flow_add_t *flow_add,
+                         ft_entry_t **entry_ptr)
+{
+    of_match_t match;
+    ft_match_t packed;
+    uint16_t priority;
+    uint8_t table_id = TABLE_ID_ANY;
+    uint32_t hash, pos, slot;
+    uint64_t fp = 0;
+
+    FT_ASSERT_OWNER(ft);
+    if (of_flow_add_match_get(flow_add, &match) < 0) {
+        return INDIGO_ERROR_PARSE;
+    }
+    ft_match_pack(&match, &packed);
+    of_flow_add_priority_get(flow_add, &priority);
+
+    hash = ft_strict_match_hash(&packed, priority);
+    if (flow_add->version >= OF_VERSION_1_1) {
+        of_flow_add_table_id_get(flow_add, &table_id);
+        fp = ft_strict_match_fp(&packed, priority, table_id, hash);
+    }
+
+    pos = ft_slot_index_start(&ft->strict_match_index, hash);
+    while ((slot = ft_slot_index_next(&ft->strict_match_index,
+                                      hash, &pos)) != FT_SLOT_INDEX_EMPTY) {
+        ft_entry_t *entry = ft_pool_slot_object(&ft->entry_pool, slot);
+        if (table_id != TABLE_ID_ANY) {
+            if (entry->strict_match_fp != fp ||
+                entry->table_id != table_id) {
+                continue;
+            }
+        }
+        if (entry->priority == priority && ft_match_eq(entry->match, &packed)) {
+            *entry_ptr = entry;
+            return INDIGO_ERROR_NONE;
+        }
+    }
+
+    return INDIGO_ERROR_NOT_FOUND;
+}
+
+/* Check one (table_id, priority) bucket for an overlapping entry */
+static int
+ft_overlap_found_in_bucket(ft_instance_t ft, of_meta_match_t *query,
+                           ft_match_sig_t *sig, uint8_t table_id)
 {
-    int bucket_idx = ft_flow_id_to_bucket_index(ft, &id);
-    list_head_t *bucket = &ft->flow_id_buckets[bucket_idx];
+    list_head_t *bucket = ft_prio_bucket(ft, table_id, query->priority);
     list_links_t *cur;
 
     LIST_FOREACH(bucket, cur) {
-        ft_entry_t *entry = FT_ENTRY_CONTAINER(cur, flow_id);
-        if (entry->id == id) {
-            return entry;
+        ft_entry_t *entry = FT_ENTRY_CONTAINER(cur, prio);
+        if (entry->table_id != table_id ||
+            entry->priority != query->priority) {
+            continue;
+        }
+        if (ft_match_sig_disjoint(&entry->match_sig, sig)) {
+            continue;
+        }
+        if (ft_entry_meta_match(query, entry)) {
+            return 1;
         }
     }
 
-    return NULL;
+    return 0;
 }
 
 int
-ft_entry_meta_match(of_meta_match_t *query, ft_entry_t *entry)
+ft_overlap_found(ft_instance_t ft, of_meta_match_t *query)
 {
-    uint64_t mask;
-    int rv = 0; /* Default is no match */
+    ft_match_sig_t sig;
+    int table_id;
 
-    if ((mask = query->cookie_mask)) {
-        if ((query->cookie & mask) != (entry->cookie & mask)) {
-            return rv;
-        }
-    }
+    FT_ASSERT_OWNER(ft);
+    INDIGO_ASSERT(query->mode == OF_MATCH_OVERLAP);
+    INDIGO_ASSERT(query->check_priority);
+
+    ft_meta_match_prepare(query);
+    ft_match_sig_init(&sig, &query->match);
 
     if (query->table_id != TABLE_ID_ANY) {
-        if (query->table_id != entry->table_id) {
-            return rv;
-        }
+        return ft_overlap_found_in_bucket(ft, query, &sig, query->table_id);
     }
 
-    if (query->check_priority) {
-        if (entry->priority != query->priority) {
-            return rv;
+    for (table_id = 0; table_id <= TABLE_ID_ANY; table_id++) {
+        if (ft_overlap_found_in_bucket(ft, query, &sig, table_id)) {
+            return 1;
         }
     }
 
-    switch (query->mode) {
-    case OF_MATCH_NON_STRICT:
-        /* Check if the entry's match is more specific than the query's */
-        if (!of_match_more_specific(&entry->match, &query->match)) {
-            break;
+    return 0;
+}
+
+void
+ft_entry_table_id_set(ft_instance_t ft, ft_entry_t *entry, uint8_t table_id)
+{
+    list_links_t *cur;
+
+    if (entry->table_id == table_id) {
+        return;
+    }
+
+    /*
+     * Anything walking the old table's list that would step onto this
+     * entry next must skip it instead, or it would follow the entry into
+     * the new table's list: iterators holding it, and retired entries
+     * whose stale links point at it.
+     */
+    if (!list_empty(&ft->iterator_list)) {
+        list_links_t *old_next = entry->table_id_links.next;
+
+        LIST_FOREACH(&ft->iterator_list, cur) {
+            ft_iterator_t *iter = container_of(cur, links, ft_iterator_t);
+            if (iter->next_entry == entry &&
+                iter->links_offset == offsetof(ft_entry_t, table_id_links)) {
+                iter->next_entry = (old_next == &iter->head->links) ? NULL :
+                    FT_ENTRY_CONTAINER(old_next, table_id);
+            }
         }
-        if (query->out_port != OF_PORT_DEST_WILDCARD) {
-            if (!ft_entry_has_out_port(entry, query->out_port)) {
-                break;
+        LIST_FOREACH(&ft->retired_list, cur) {
+            ft_entry_t *retired = container_of(cur, retired_links, ft_entry_t);
+            if (retired->table_id_links.next == &entry->table_id_links) {
+                retired->table_id_links.next = old_next;
             }
         }
-        rv = 1;
-        break;
+    }
+
+    list_remove(&entry->table_id_links);
+    ft->table_counts[entry->table_id]--;
+    ft->table_counters[entry->table_id].packets -= entry->packets;
+    ft->table_counters[entry->table_id].bytes -= entry->bytes;
+    list_remove(&entry->prio_links);
+    ft_checksum_update(ft, entry);
+    entry->table_id = table_id;
+    entry->strict_match_fp = ft_strict_match_fp(entry->match, entry->priority,
+                                                entry->table_id,
+                                                entry->strict_match_hash);
+    ft_checksum_update(ft, entry);
+    list_push(&ft->table_lists[entry->table_id], &entry->table_id_links);
+    ft->table_counts[entry->table_id]++;
+    ft->table_counters[entry->table_id].packets += entry->packets;
+    ft->table_counters[entry->table_id].bytes += entry->bytes;
+    list_push(ft_prio_bucket(ft, entry->table_id, entry->priority),
+              &entry->prio_links);
+
+    ind_core_snapshot_flow_write(entry, NULL);
+}
+
+void
+ft_entry_counters_set(ft_instance_t ft, ft_entry_t *entry,
+                      uint64_t packets, uint64_t bytes)
+{
+    ft_table_counters_t *counters = &ft->table_counters[entry->table_id];
+
+    counters->packets += packets - entry->packets;
+    counters->bytes += bytes - entry->bytes;
+    if (packets != entry->packets) {
+        entry->last_counter_change = INDIGO_CURRENT_TIME;
+    }
+    entry->packets = packets;
+    entry->bytes = bytes;
+}
+
+uint32_t
+ft_cookie_counters_get(ft_instance_t ft, uint64_t cookie, uint8_t table_id,
+                       ft_table_counters_t *counters)
+{
+    list_head_t *bucket = ft_index_bucket(&ft->cookie_index,
+                                          ft_cookie_hash(cookie));
+    list_links_t *cur;
+    uint32_t flows = 0;
+
+    INDIGO_MEM_SET(counters, 0, sizeof(*counters));
+
+    LIST_FOREACH(bucket, cur) {
+        ft_entry_t *entry = FT_ENTRY_CONTAINER(cur, cookie_hash);
+        if (entry->cookie != cookie) {
+            continue;
+        }
+        if (table_id != TABLE_ID_ANY && entry->table_id != table_id) {
+            continue;
+        }
+        counters->packets += entry->packets;
+        counters->bytes += entry->bytes;
+        flows++;
+    }
+
+    return flows;
+}
+
+indigo_flow_id_t
+ft_flow_id_next(ft_instance_t ft)
+{
+    return ft_id_map_next(&ft->flow_ids);
+}
+
+ft_entry_t *
+ft_lookup(ft_instance_t ft, indigo_flow_id_t id)
+{
+    list_head_t *bucket;
+    list_links_t *cur;
+
+    FT_ASSERT_OWNER(ft);
+    /* Every entry with a tracked ID is in the ID map */
+    if (ft_id_map_tracked(id)) {
+        return ft_id_map_get(&ft->flow_ids, id);
+    }
+
+    bucket = ft_index_bucket(&ft->flow_id_index, ft_flow_id_hash(&id));
+    LIST_FOREACH(bucket, cur) {
+        ft_entry_t *entry = FT_ENTRY_CONTAINER(cur, flow_id);
+        if (entry->id == id) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+void
+ft_meta_match_prepare(of_meta_match_t *query)
+{
+    ft_match_pack(&query->match, &query->packed);
+}
+
+int
+ft_entry_meta_match(of_meta_match_t *query, ft_entry_t *entry)
+{
+    uint64_t mask;
+    int rv = 0; /* Default is no match */
+
+    if ((mask = query->cookie_mask)) {
+        if ((query->cookie & mask) != (entry->cookie & mask)) {
+            return rv;
+        }
+    }
+
+    if (query->table_id != TABLE_ID_ANY) {
+        if (query->table_id != entry->table_id) {
+            return rv;
+        }
+    }
+
+    if (query->check_priority) {
+        if (entry->priority != query->priority) {
+            return rv;
+        }
+    }
+
+    switch (query->mode) {
+    case OF_MATCH_NON_STRICT:
+        /* Check if the entry's match is more specific than the query's */
+        if (!ft_match_more_specific(entry->match, &query->packed)) {
+            break;
+        }
+        if (!ft_entry_out_match(query, entry)) {
+            break;
+        }
+        rv = 1;
+        break;
     case OF_MATCH_STRICT:
-        if (!of_match_eq(&entry->match, &query->match)) {
+        if (!ft_match_eq(entry->match, &query->packed)) {
             break;
         }
-        if (query->out_port != OF_PORT_DEST_WILDCARD) {
-            if (!ft_entry_has_out_port(entry, query->out_port)) {
-                break;
-            }
+        if (!ft_entry_out_match(query, entry)) {
+            break;
         }
         rv = 1;
         break;
@@ -288,7 +943,7 @@ ft_entry_meta_match(of_meta_match_t *query, ft_entry_t *entry)
         rv = 1;
         break;
     case OF_MATCH_OVERLAP:
-        if (!of_match_overlap(&entry->match, &query->match)) {
+        if (!ft_match_overlap(entry->match, &query->packed)) {
             break;
         }
         rv = 1;
@@ -309,17 +964,54 @@ ft_entry_modify_effects(ft_instance_t instance,
 {
     indigo_error_t err;
 
+    FT_ASSERT_OWNER(instance);
     LOG_TRACE("Modifying effects of entry " INDIGO_FLOW_ID_PRINTF_FORMAT,
               entry->id);
 
-    err = ft_entry_set_effects(entry, flow_mod);
+    /* The referenced ports and groups may change with the effects */
+    ft_entry_out_refs_unlink(instance, entry);
+    err = ft_entry_set_effects(instance, entry, flow_mod);
+    ft_entry_out_refs_link(instance, entry);
     if (err == INDIGO_ERROR_NONE) {
         instance->status.updates += 1;
+        ind_core_snapshot_flow_write(entry, NULL);
+        ind_core_flow_monitor_notify(entry, IND_CORE_FLOW_MONITOR_EVENT_MODIFIED);
     }
 
     return err;
 }
 
+int
+ft_entry_effects_equal(ft_entry_t *entry, of_flow_modify_t *flow_mod)
+{
+    of_object_t effects;
+    uint8_t *buf;
+    int bytes;
+
+    if (entry->effects.actions == NULL ||
+            entry->effects.actions->version != flow_mod->version) {
+        return 0;
+    }
+
+    if (flow_mod->version == OF_VERSION_1_0) {
+        of_flow_modify_actions_bind(flow_mod, &effects);
+    } else {
+        of_flow_modify_instructions_bind(flow_mod, &effects);
+    }
+
+    bytes = effects.length;
+    if (bytes != entry->effects.actions->length) {
+        return 0;
+    }
+
+    buf = OF_OBJECT_BUFFER_INDEX(&effects, 0);
+    if (ft_hash_bytes(buf, bytes, FT_HASH_SEED) != entry->effects_ref->hash) {
+        return 0;
+    }
+
+    return memcmp(buf, entry->effects_ref->buf, bytes) == 0;
+}
+
 /*
  * Flowtable iterator task
  *
@@ -332,8 +1024,11 @@ ft_entry_modify_effects(ft_instance_t instance,
  */
 
 struct ft_iter_task_state {
+    ft_instance_t ft;
     ft_iter_task_callback_f callback;
+    ft_iter_task_pause_f pause;
     void *cookie;
+    int priority;
     ft_iterator_t iter;
 };
 
@@ -343,11 +1038,17 @@ ft_iter_task_callback(void *cookie)
     struct ft_iter_task_state *state = cookie;
 
     do {
+        /* The owner resumes the task with ft_iter_task_resume */
+        if (state->pause != NULL && state->pause(state->cookie, state)) {
+            return IND_SOC_TASK_FINISHED;
+        }
+
         ft_entry_t *entry = ft_iterator_next(&state->iter);
         if (entry == NULL) {
             /* Finished */
             state->callback(state->cookie, NULL);
             ft_iterator_cleanup(&state->iter);
+            state->ft->iter_tasks--;
             aim_free(state);
             return IND_SOC_TASK_FINISHED;
         } else {
@@ -364,25 +1065,119 @@ ft_spawn_iter_task(ft_instance_t instance,
                    ft_iter_task_callback_f callback,
                    void *cookie,
                    int priority)
+{
+    return ft_spawn_iter_task_with_pause(instance, query, callback, NULL,
+                                         cookie, priority);
+}
+
+indigo_error_t
+ft_spawn_iter_task_with_pause(ft_instance_t instance,
+                              of_meta_match_t *query,
+                              ft_iter_task_callback_f callback,
+                              ft_iter_task_pause_f pause,
+                              void *cookie,
+                              int priority)
 {
     indigo_error_t rv;
 
     struct ft_iter_task_state *state = aim_malloc(sizeof(*state));
 
+    state->ft = instance;
     state->callback = callback;
+    state->pause = pause;
     state->cookie = cookie;
+    state->priority = priority;
 
     ft_iterator_init(&state->iter, instance, query);
 
     rv = ind_soc_task_register(ft_iter_task_callback, state, priority);
     if (rv != INDIGO_ERROR_NONE) {
+        ft_iterator_cleanup(&state->iter);
         aim_free(state);
         return rv;
     }
 
+    instance->iter_tasks++;
+
     return INDIGO_ERROR_NONE;
 }
 
+void
+ft_iter_task_resume(void *task)
+{
+    struct ft_iter_task_state *state = task;
+    indigo_error_t rv;
+
+    rv = ind_soc_task_register(ft_iter_task_callback, state, state->priority);
+    if (rv != INDIGO_ERROR_NONE) {
+        /* Cannot continue; end the iteration so the owner cleans up */
+        LOG_ERROR("Failed to resume iter task: %s", indigo_strerror(rv));
+        state->callback(state->cookie, NULL);
+        ft_iterator_cleanup(&state->iter);
+        state->ft->iter_tasks--;
+        aim_free(state);
+    }
+}
+
+static uint64_t
+ft_index_bytes(ft_index_t *index)
+{
+    return index->num_segments *
+        (sizeof(*index->segments) +
+         sizeof(list_head_t) * FT_INDEX_SEGMENT_SIZE);
+}
+
+void
+ft_memory_get(ft_instance_t ft, ft_memory_t *memory)
+{
+    int idx;
+
+    INDIGO_MEM_SET(memory, 0, sizeof(*memory));
+
+    memory->entries = ft_pool_bytes(&ft->entry_pool);
+    memory->entries_used =
+        ft->entry_pool.in_use * (uint64_t)ft->entry_pool.object_size;
+
+    for (idx = 0; idx < FT_EFFECTS_CLASS_COUNT; idx++) {
+        ft_pool_t *pool = &ft->effects_pools[idx];
+        memory->effects += ft_pool_bytes(pool);
+        memory->effects_used += pool->in_use * (uint64_t)pool->object_size;
+    }
+    memory->effects += ft->effects_oversize_bytes;
+    memory->effects_used += ft->effects_oversize_bytes;
+    memory->effects += ft_pool_bytes(&ft->effects_ref_pool);
+    memory->effects_used += ft->effects_ref_pool.in_use *
+        (uint64_t)ft->effects_ref_pool.object_size;
+
+    for (idx = 0; idx < FT_MATCH_CLASS_COUNT; idx++) {
+        ft_pool_t *pool = &ft->match_pools[idx];
+        memory->matches += ft_pool_bytes(pool);
+        memory->matches_used += pool->in_use * (uint64_t)pool->object_size;
+    }
+
+    memory->indexes = sizeof(*ft) +
+        ft_slot_index_bytes(&ft->strict_match_index) +
+        ft_index_bytes(&ft->flow_id_index) +
+        ft_index_bytes(&ft->cookie_index) +
+        ft_index_bytes(&ft->effects_index) +
+        ft_id_map_bytes(&ft->flow_ids) +
+        sizeof(list_head_t) * (FT_TABLE_LIST_COUNT +
+                               (1 << ft->config.cookie_prefix_len) +
+                               FT_PRIO_BUCKET_COUNT +
+                               FT_OUT_BUCKET_COUNT) +
+        sizeof(uint32_t) * FT_TABLE_LIST_COUNT +
+        sizeof(ft_table_counters_t) * FT_TABLE_LIST_COUNT +
+        sizeof(ft_checksum_table_t) * FT_TABLE_LIST_COUNT;
+    for (idx = 0; idx < FT_TABLE_LIST_COUNT; idx++) {
+        memory->indexes += sizeof(uint64_t) *
+            (uint64_t)ft->checksum_tables[idx].buckets_size;
+    }
+
+    memory->iterators =
+        ft->iter_tasks * (uint64_t)sizeof(struct ft_iter_task_state) +
+        ft->snapshot_bytes;
+}
+
 static ft_entry_t *
 ft_iterator_links_to_entry(ft_iterator_t *iter, list_links_t *links)
 {
@@ -395,17 +1190,103 @@ ft_iterator_entry_to_links(ft_iterator_t *iter, ft_entry_t *entry)
     return (list_links_t *)(((char *)entry) + iter->links_offset);
 }
 
+/* Leave the active list once the walk is over; safe to call twice */
+static void
+ft_iterator_finish(ft_iterator_t *iter)
+{
+    if (iter->pinned_index != NULL) {
+        iter->pinned_index->pins--;
+        iter->pinned_index = NULL;
+    }
+
+    if (iter->snapshot != NULL) {
+        if (iter->frozen) {
+            iter->ft->snapshots--;
+        }
+        iter->ft->snapshot_bytes -=
+            (uint64_t)iter->snapshot_count * sizeof(ft_entry_t *);
+        aim_free(iter->snapshot);
+        iter->snapshot = NULL;
+    }
+
+    if (iter->active) {
+        list_remove(&iter->links);
+        iter->active = false;
+        ft_reclaim(iter->ft);
+    }
+}
+
+/* The port or group whose referencing entries cover the query, if any */
+static bool
+ft_iterator_out_ref(of_meta_match_t *query, uint8_t *kind, uint32_t *id)
+{
+    if (query->mode != OF_MATCH_NON_STRICT && query->mode != OF_MATCH_STRICT) {
+        return false;
+    }
+
+    if (query->check_out_group) {
+        *kind = FT_OUT_REF_GROUP;
+        *id = query->out_group;
+        return true;
+    } else if (query->out_port != OF_PORT_DEST_WILDCARD) {
+        *kind = FT_OUT_REF_PORT;
+        *id = query->out_port;
+        return true;
+    }
+
+    return false;
+}
+
 void
 ft_iterator_init(ft_iterator_t *iter, ft_instance_t ft, of_meta_match_t *query)
 {
+    uint8_t out_kind;
+    uint32_t out_id;
+
+    FT_ASSERT_OWNER(ft);
+
     if (query != NULL) {
         iter->query = *query;
+        ft_meta_match_prepare(&iter->query);
         iter->use_query = true;
     } else {
         iter->use_query = false;
     }
 
-    if (query && (query->cookie_mask & FT_COOKIE_PREFIX_MASK) == FT_COOKIE_PREFIX_MASK) {
+    iter->ft = ft;
+    iter->pinned_index = NULL;
+    iter->active = false;
+    iter->snapshot = NULL;
+    iter->snapshot_count = 0;
+    iter->snapshot_index = 0;
+    iter->frozen = false;
+
+    if (query && query->cookie_mask == ~(uint64_t)0) {
+        /* Using full cookie bucket, pinned so that it is not split */
+        iter->head = ft_index_bucket(&ft->cookie_index, ft_cookie_hash(query->cookie));
+        iter->links_offset = offsetof(ft_entry_t, cookie_hash_links);
+        iter->pinned_index = &ft->cookie_index;
+        iter->pinned_index->pins++;
+    } else if (query && ft_iterator_out_ref(query, &out_kind, &out_id)) {
+        /* Using the entries referencing the port or group */
+        iter->head = NULL;
+        iter->next_entry = NULL;
+        iter->snapshot = ft_out_ref_snapshot(ft, out_kind, out_id,
+                                             &iter->snapshot_count);
+        if (iter->snapshot != NULL) {
+            ft->snapshot_bytes +=
+                (uint64_t)iter->snapshot_count * sizeof(ft_entry_t *);
+            iter->epoch = ft->epoch;
+            iter->active = true;
+            list_push(&ft->iterator_list, &iter->links);
+        }
+        return;
+    } else if (query && query->table_id != TABLE_ID_ANY) {
+        /* Using per-table list */
+        iter->head = &ft->table_lists[query->table_id];
+        iter->links_offset = offsetof(ft_entry_t, table_id_links);
+    } else if (query && (query->cookie_mask & FT_COOKIE_PREFIX_MASK(ft)) ==
+               FT_COOKIE_PREFIX_MASK(ft)) {
         /* Using cookie bucket */
         iter->head = &ft->cookie_buckets[ft_cookie_to_bucket_index(ft, query->cookie)];
         iter->links_offset = offsetof(ft_entry_t, cookie_links);
@@ -416,51 +1297,116 @@ ft_iterator_init(ft_iterator_t *iter, ft_instance_t ft, of_meta_match_t *query)
 
     if (list_empty(iter->head)) {
         iter->next_entry = NULL;
+        ft_iterator_finish(iter);
     } else {
         iter->next_entry = ft_iterator_links_to_entry(iter, iter->head->links.next);
-        list_push(&iter->next_entry->iterators, &iter->entry_links);
+        iter->epoch = ft->epoch;
+        iter->active = true;
+        list_push(&ft->iterator_list, &iter->links);
     }
 }
 
+void
+ft_iterator_init_snapshot(ft_iterator_t *iter, ft_instance_t ft,
+                          of_meta_match_t *query)
+{
+    ft_entry_t **snapshot = NULL;
+    ft_entry_t *entry;
+    int count = 0, size = 0;
+
+    ft_iterator_init(iter, ft, query);
+    while ((entry = ft_iterator_next(iter)) != NULL) {
+        if (count == size) {
+            size = size ? size * 2 : 64;
+            snapshot = aim_realloc(snapshot, size * sizeof(*snapshot));
+        }
+        snapshot[count++] = entry;
+    }
+
+    if (count == 0) {
+        aim_free(snapshot);
+        return;
+    }
+
+    /* Trim to the exact size, since it is held for the whole dump */
+    iter->snapshot = aim_realloc(snapshot, count * sizeof(*snapshot));
+    iter->snapshot_count = count;
+    iter->snapshot_index = 0;
+    iter->frozen = true;
+    ft->snapshots++;
+    ft->snapshot_bytes += (uint64_t)count * sizeof(*snapshot);
+
+    /* The walk above left the active list; rejoin as the newest */
+    iter->epoch = ft->epoch;
+    iter->active = true;
+    list_push(&ft->iterator_list, &iter->links);
+}
+
 ft_entry_t *
 ft_iterator_next(ft_iterator_t *iter)
 {
-    if (iter->next_entry != NULL) {
-        list_remove(&iter->entry_links);
+    ft_entry_t *found = NULL;
+
+    if (iter->snapshot != NULL && iter->frozen) {
+        /* Deleted entries returned may still be in use; see cleanup */
+        if (iter->snapshot_index < iter->snapshot_count) {
+            found = iter->snapshot[iter->snapshot_index++];
+        }
+        return found;
+    }
+
+    if (iter->snapshot != NULL) {
+        /* Referencing entries; filtered like a list walk */
+        while (iter->snapshot_index < iter->snapshot_count) {
+            ft_entry_t *entry = iter->snapshot[iter->snapshot_index++];
+            if (entry->retired_epoch == 0 &&
+                ft_entry_meta_match(&iter->query, entry)) {
+                found = entry;
+                break;
+            }
+        }
+        if (iter->snapshot_index == iter->snapshot_count) {
+            ft_iterator_finish(iter);
+        }
+        return found;
     }
 
     while (iter->next_entry != NULL) {
         ft_entry_t *entry = iter->next_entry;
 
-        list_links_t *next_links = ft_iterator_entry_to_links(iter, iter->next_entry)->next;
+        /* Retired entries keep their links, so this is safe for them too */
+        list_links_t *next_links = ft_iterator_entry_to_links(iter, entry)->next;
         if (next_links == &iter->head->links) {
-            /* Finished iteration */
             iter->next_entry = NULL;
         } else {
             iter->next_entry = ft_iterator_links_to_entry(iter, next_links);
         }
 
-        if (iter->use_query && !ft_entry_meta_match(&iter->query, entry)) {
+        if (entry->retired_epoch != 0) {
             continue;
         }
 
-        if (iter->next_entry != NULL) {
-            list_push(&iter->next_entry->iterators, &iter->entry_links);
+        if (iter->use_query && !ft_entry_meta_match(&iter->query, entry)) {
+            continue;
         }
 
-        return entry;
+        found = entry;
+        break;
+    }
+
+    if (iter->next_entry == NULL) {
+        /* Finished iteration */
+        ft_iterator_finish(iter);
     }
 
-    return NULL;
+    return found;
 }
 
 void
 ft_iterator_cleanup(ft_iterator_t *iter)
 {
-    if (iter->next_entry != NULL) {
-        list_remove(&iter->entry_links);
-        iter->next_entry = NULL;
-    }
+    iter->next_entry = NULL;
+    ft_iterator_finish(iter);
 }
 
 /**
@@ -480,20 +1426,45 @@ ft_entry_link(ft_instance_t ft, ft_entry_t *entry)
     /* Link to full table iteration */
     list_push(&ft->all_list, &entry->table_links);
 
-    if (ft->strict_match_buckets) { /* Strict match hash */
-        idx = ft_strict_match_to_bucket_index(ft, &entry->match, entry->priority);
-        list_push(&ft->strict_match_buckets[idx], &entry->strict_match_links);
-    }
-    if (ft->flow_id_buckets) { /* Flow ID hash */
-        idx = ft_flow_id_to_bucket_index(ft, &entry->id);
-        list_push(&ft->flow_id_buckets[idx], &entry->flow_id_links);
-    }
+    /* Per-table iteration */
+    list_push(&ft->table_lists[entry->table_id], &entry->table_id_links);
+    ft->table_counts[entry->table_id]++;
+
+    /* (table_id, priority) buckets for overlap checks */
+    list_push(ft_prio_bucket(ft, entry->table_id, entry->priority),
+              &entry->prio_links);
+
+    /* Strict match hash */
+    entry->strict_match_hash = ft_strict_match_hash(entry->match, entry->priority);
+    entry->strict_match_fp = ft_strict_match_fp(entry->match, entry->priority,
+                                                entry->table_id,
+                                                entry->strict_match_hash);
+    ft_slot_index_insert(&ft->strict_match_index, entry->strict_match_hash,
+                         entry->slot);
+
+    /* Flow ID hash */
+    ft_id_map_set(&ft->flow_ids, entry->id, entry);
+    entry->flow_id_hash = ft_flow_id_hash(&entry->id);
+    list_push(ft_index_bucket(&ft->flow_id_index, entry->flow_id_hash),
+              &entry->flow_id_links);
+
+    /* Full cookie hash */
+    entry->cookie_hash = ft_cookie_hash(entry->cookie);
+    list_push(ft_index_bucket(&ft->cookie_index, entry->cookie_hash),
+              &entry->cookie_hash_links);
+
     if (ft->cookie_buckets) { /* Cookie prefix */
         idx = ft_cookie_to_bucket_index(ft, entry->cookie);
         list_push(&ft->cookie_buckets[idx], &entry->cookie_links);
     }
 
-    list_init(&entry->iterators);
+    /* Referenced ports and groups */
+    ft_entry_out_refs_link(ft, entry);
+
+    /* Table and bucket checksums */
+    ft_checksum_update(ft, entry);
+
+    entry->retired_epoch = 0;
 
     if (entry->idle_timeout || entry->hard_timeout) {
         ind_core_expiration_add(entry);
@@ -514,31 +1485,45 @@ ft_entry_unlink(ft_instance_t ft, ft_entry_t *entry)
 
     INDIGO_ASSERT(!list_empty(&ft->all_list));
 
-    /* Advance iterators pointing to this entry */
-    list_links_t *cur, *next;
-    LIST_FOREACH_SAFE(&entry->iterators, cur, next) {
-        ft_iterator_next(container_of(cur, entry_links, ft_iterator_t));
-    }
-
     /* Remove from full table iteration */
     list_remove(&entry->table_links);
 
-    if (ft->strict_match_buckets) { /* Strict match hash */
-        INDIGO_ASSERT(!list_empty(&ft->strict_match_buckets[
-            ft_strict_match_to_bucket_index(ft, &entry->match, entry->priority)]));
-        list_remove(&entry->strict_match_links);
-    }
-    if (ft->flow_id_buckets) { /* Flow ID hash */
-        INDIGO_ASSERT(!list_empty(&ft->flow_id_buckets[ft_flow_id_to_bucket_index(ft,
-            &entry->id)]));
-        list_remove(&entry->flow_id_links);
-    }
+    /* Per-table iteration */
+    list_remove(&entry->table_id_links);
+    ft->table_counts[entry->table_id]--;
+    ft->table_counters[entry->table_id].packets -= entry->packets;
+    ft->table_counters[entry->table_id].bytes -= entry->bytes;
+
+    /* (table_id, priority) buckets */
+    list_remove(&entry->prio_links);
+
+    /* Strict match hash */
+    ft_slot_index_remove(&ft->strict_match_index, entry->strict_match_hash,
+                         entry->slot);
+
+    /* Flow ID hash */
+    INDIGO_ASSERT(!list_empty(ft_index_bucket(&ft->flow_id_index,
+                                              entry->flow_id_hash)));
+    list_remove(&entry->flow_id_links);
+    ft_id_map_clear(&ft->flow_ids, entry->id);
+
+    /* Full cookie hash */
+    INDIGO_ASSERT(!list_empty(ft_index_bucket(&ft->cookie_index,
+                                              entry->cookie_hash)));
+    list_remove(&entry->cookie_hash_links);
+
     if (ft->cookie_buckets) { /* Cookie prefix */
         INDIGO_ASSERT(!list_empty(&ft->cookie_buckets[ft_cookie_to_bucket_index(ft,
             entry->cookie)]));
         list_remove(&entry->cookie_links);
     }
 
+    /* Referenced ports and groups */
+    ft_entry_out_refs_unlink(ft, entry);
+
+    /* Table and bucket checksums */
+    ft_checksum_update(ft, entry);
+
     if (entry->idle_timeout || entry->hard_timeout) {
         ind_core_expiration_remove(entry);
     }
@@ -554,28 +1539,41 @@ ft_entry_unlink(ft_instance_t ft, ft_entry_t *entry)
  * The list links are not modified by this call.
  */
 static indigo_error_t
-ft_entry_create(indigo_flow_id_t id, of_flow_add_t *flow_add, ft_entry_t **entry_p)
+ft_entry_create(ft_instance_t ft, indigo_flow_id_t id, of_flow_add_t *flow_add,
+                ft_entry_t **entry_p)
 {
     indigo_error_t err;
     ft_entry_t *entry;
+    of_match_t match;
+
+    if (of_flow_add_match_get(flow_add, &match) < 0) {
+        return INDIGO_ERROR_UNKNOWN;
+    }
 
-    entry = aim_zmalloc(sizeof(*entry));
+    entry = ft_pool_alloc(&ft->entry_pool);
 
     entry->id = id;
+    entry->expiration_index = -1;
+    entry->packets = 0;
+    entry->bytes = 0;
+    entry->reported_packets = 0;
+    entry->reported_bytes = 0;
 
-    if (of_flow_add_match_get(flow_add, &entry->match) < 0) {
-        aim_free(entry);
-        return INDIGO_ERROR_UNKNOWN;
-    }
+    ft_entry_match_store(ft, entry, &match);
     of_flow_add_cookie_get(flow_add, &entry->cookie);
     of_flow_add_priority_get(flow_add, &entry->priority);
     of_flow_add_flags_get(flow_add, &entry->flags);
     of_flow_add_idle_timeout_get(flow_add, &entry->idle_timeout);
     of_flow_add_hard_timeout_get(flow_add, &entry->hard_timeout);
+    if (flow_add->version >= OF_VERSION_1_1) {
+        of_flow_add_table_id_get(flow_add, &entry->table_id);
+    }
+    ft_match_sig_init(&entry->match_sig, &match);
 
-    err = ft_entry_set_effects(entry, flow_add);
+    err = ft_entry_set_effects(ft, entry, flow_add);
     if (err != INDIGO_ERROR_NONE) {
-        aim_free(entry);
+        ft_entry_match_release(ft, entry);
+        ft_pool_free(&ft->entry_pool, entry);
         return err;
     }
 
@@ -587,6 +1585,64 @@ ft_entry_create(indigo_flow_id_t id, of_flow_add_t *flow_add, ft_entry_t **entry
     return INDIGO_ERROR_NONE;
 }
 
+/**
+ * Free a deleted entry, or keep its ft_entry_t if an iterator may hold it
+ *
+ * The match and effects go at once unless a snapshot iterator may return
+ * the entry; otherwise only the links and retired_epoch of a retired
+ * entry are read again.  See ft_iterator_t.
+ */
+static void
+ft_entry_retire(ft_instance_t ft, ft_entry_t *entry)
+{
+    if (list_empty(&ft->iterator_list)) {
+        ft_entry_destroy(ft, entry);
+        return;
+    }
+
+    if (entry->pending_add != NULL) {
+        of_object_delete(entry->pending_add);
+        entry->pending_add = NULL;
+    }
+    if (ft->snapshots == 0) {
+        ft_entry_effects_release(ft, entry);
+        ft_entry_match_release(ft, entry);
+    }
+
+    entry->retired_epoch = ft->epoch++;
+    list_push(&ft->retired_list, &entry->retired_links);
+    ft->retired_count++;
+}
+
+/**
+ * Free the retired entries no active iterator can reach
+ *
+ * An iterator can only hold entries retired at or after its own epoch,
+ * and iterators are listed in the order they began.
+ */
+static void
+ft_reclaim(ft_instance_t ft)
+{
+    uint64_t oldest = UINT64_MAX;
+
+    if (!list_empty(&ft->iterator_list)) {
+        ft_iterator_t *iter = container_of(list_first(&ft->iterator_list),
+                                           links, ft_iterator_t);
+        oldest = iter->epoch;
+    }
+
+    while (!list_empty(&ft->retired_list)) {
+        ft_entry_t *entry = container_of(list_first(&ft->retired_list),
+                                         retired_links, ft_entry_t);
+        if (entry->retired_epoch >= oldest) {
+            break;
+        }
+        list_remove(&entry->retired_links);
+        ft->retired_count--;
+        ft_entry_destroy(ft, entry);
+    }
+}
+
 /**
  * Release the data associated with an entry
  *
@@ -597,96 +1653,539 @@ ft_entry_create(indigo_flow_id_t id, of_flow_add_t *flow_add, ft_entry_t **entry
 static void
 ft_entry_destroy(ft_instance_t ft, ft_entry_t *entry)
 {
-    if (entry->effects.actions != NULL) {
-        of_list_action_delete(entry->effects.actions);
-        entry->effects.actions = NULL;
+    if (entry->pending_add != NULL) {
+        of_object_delete(entry->pending_add);
+        entry->pending_add = NULL;
+    }
+
+    ft_entry_effects_release(ft, entry);
+    ft_entry_match_release(ft, entry);
+    ft_pool_free(&ft->entry_pool, entry);
+}
+
+/*
+ * Pack a match into a buffer from the smallest size class that holds it
+ * and point entry->match at it.
+ */
+static void
+ft_entry_match_store(ft_instance_t ft, ft_entry_t *entry, of_match_t *match)
+{
+    ft_match_t packed;
+    int bytes;
+    int cls;
+
+    ft_match_pack(match, &packed);
+    bytes = ft_match_size(&packed);
+
+    for (cls = 0; (FT_MATCH_MIN_SIZE << cls) < bytes; cls++);
+    INDIGO_ASSERT(cls < FT_MATCH_CLASS_COUNT);
+
+    entry->match = ft_pool_alloc(&ft->match_pools[cls]);
+    entry->match_class = cls;
+    INDIGO_MEM_COPY(entry->match, &packed, bytes);
+}
+
+static void
+ft_entry_match_release(ft_instance_t ft, ft_entry_t *entry)
+{
+    if (entry->match != NULL) {
+        ft_pool_free(&ft->match_pools[entry->match_class], entry->match);
+        entry->match = NULL;
+    }
+    if (entry->match_wire != NULL) {
+        ft_pool_free(&ft->match_pools[entry->match_wire_class],
+                     entry->match_wire);
+        entry->match_wire = NULL;
+    }
+}
+
+int
+ft_entry_match_wire(ft_instance_t ft, ft_entry_t *entry,
+                    of_version_t version, of_octets_t *octets)
+{
+    of_match_t match;
+    of_octets_t encoded;
+    int cls;
+
+    if (entry->match_wire == NULL) {
+        ft_match_unpack(entry->match, &match);
+        if (of_match_serialize(version, &match, &encoded) < 0) {
+            return 0;
+        }
+
+        for (cls = 0; cls < FT_MATCH_CLASS_COUNT &&
+                 (FT_MATCH_MIN_SIZE << cls) < encoded.bytes; cls++);
+        if (cls == FT_MATCH_CLASS_COUNT) {
+            of_alloc_free(encoded.data);
+            return 0;
+        }
+
+        entry->match_wire = ft_pool_alloc(&ft->match_pools[cls]);
+        entry->match_wire_bytes = encoded.bytes;
+        entry->match_wire_class = cls;
+        entry->match_wire_version = version;
+        INDIGO_MEM_COPY(entry->match_wire, encoded.data, encoded.bytes);
+        of_alloc_free(encoded.data);
+    }
+
+    if (entry->match_wire_version != version) {
+        return 0;
+    }
+
+    octets->data = entry->match_wire;
+    octets->bytes = entry->match_wire_bytes;
+    return 1;
+}
+
+/* Size class for an effects buffer, or -1 if it is too large to pool */
+static int
+ft_effects_class(int bytes)
+{
+    int cls;
+
+    for (cls = 0; cls < FT_EFFECTS_CLASS_COUNT; cls++) {
+        if (bytes <= (FT_EFFECTS_MIN_SIZE << cls)) {
+            return cls;
+        }
     }
 
-    aim_free(entry);
+    return -1;
+}
+
+/* Find the interned copy of some effects wire data */
+static ft_effects_t *
+ft_effects_find(ft_instance_t ft, uint8_t *data, int bytes, uint32_t hash)
+{
+    list_links_t *cur;
+
+    LIST_FOREACH(ft_index_bucket(&ft->effects_index, hash), cur) {
+        ft_effects_t *effects = container_of(cur, links, ft_effects_t);
+        if (effects->hash == hash && effects->bytes == bytes &&
+                memcmp(effects->buf, data, bytes) == 0) {
+            return effects;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Take a reference to the interned copy of some effects wire data,
+ * copying it into a pooled buffer if no entry holds it yet
+ */
+static ft_effects_t *
+ft_effects_intern(ft_instance_t ft, uint8_t *data, int bytes)
+{
+    uint32_t hash = ft_hash_bytes(data, bytes, FT_HASH_SEED);
+    ft_effects_t *effects;
+    int cls;
+
+    effects = ft_effects_find(ft, data, bytes, hash);
+    if (effects != NULL) {
+        effects->refcount++;
+        ft->effects_shares++;
+        return effects;
+    }
+
+    cls = ft_effects_class(bytes);
+    effects = ft_pool_alloc(&ft->effects_ref_pool);
+    if (cls >= 0) {
+        effects->buf = ft_pool_alloc(&ft->effects_pools[cls]);
+    } else {
+        effects->buf = aim_malloc(bytes);
+        AIM_TRUE_OR_DIE(effects->buf != NULL);
+        ft->effects_oversize += 1;
+        ft->effects_oversize_bytes += bytes;
+    }
+    INDIGO_MEM_COPY(effects->buf, data, bytes);
+    effects->hash = hash;
+    effects->bytes = bytes;
+    effects->cls = cls;
+    effects->refcount = 1;
+    list_push(ft_index_bucket(&ft->effects_index, hash), &effects->links);
+
+    return effects;
+}
+
+/* Drop a reference, freeing the wire data with the last one */
+static void
+ft_effects_unref(ft_instance_t ft, ft_effects_t *effects)
+{
+    if (--effects->refcount > 0) {
+        return;
+    }
+
+    list_remove(&effects->links);
+    if (effects->cls >= 0) {
+        ft_pool_free(&ft->effects_pools[effects->cls], effects->buf);
+    } else {
+        aim_free(effects->buf);
+        ft->effects_oversize -= 1;
+        ft->effects_oversize_bytes -= effects->bytes;
+    }
+    ft_pool_free(&ft->effects_ref_pool, effects);
+}
+
+/* Release the effects wire data and forget the effects object */
+static void
+ft_entry_effects_release(ft_instance_t ft, ft_entry_t *entry)
+{
+    if (entry->effects.actions == NULL) {
+        return;
+    }
+
+    ft_effects_unref(ft, entry->effects_ref);
+    entry->effects_ref = NULL;
+    entry->effects.actions = NULL;
+}
+
+/*
+ * Point entry->effects at the interned copy of an action or instruction
+ * list.
+ *
+ * The object itself lives in the entry, so the only allocation is the
+ * wire buffer, which is shared with other entries holding the same
+ * list and otherwise comes from a size-class pool.
+ */
+static void
+ft_entry_effects_store(ft_instance_t ft, ft_entry_t *entry, of_object_t *src)
+{
+    of_object_storage_t *storage = &entry->effects_storage;
+    int bytes = src->length;
+    ft_effects_t *effects;
+
+    /* Interned first, so storing the same list again keeps the buffer */
+    effects = ft_effects_intern(ft, OF_OBJECT_BUFFER_INDEX(src, 0), bytes);
+
+    ft_entry_effects_release(ft, entry);
+
+    INDIGO_MEM_SET(storage, 0, sizeof(*storage));
+    storage->wbuf.buf = effects->buf;
+    storage->wbuf.alloc_bytes = effects->cls >= 0 ?
+        (FT_EFFECTS_MIN_SIZE << effects->cls) : bytes;
+    storage->wbuf.current_bytes = bytes;
+    storage->obj.wire_object.wbuf = &storage->wbuf;
+    of_object_init_map[src->object_id](&storage->obj, src->version, bytes, 0);
+
+    entry->effects.actions = &storage->obj;
+    entry->effects_ref = effects;
 }
 
 /* Populate the output port list and effects */
 static indigo_error_t
-ft_entry_set_effects(ft_entry_t *entry,
-                    of_flow_modify_t *flow_mod)
+ft_entry_set_effects(ft_instance_t ft, ft_entry_t *entry,
+                     of_flow_modify_t *flow_mod)
 {
     if (flow_mod->version == OF_VERSION_1_0)
     {
-        of_list_action_t *actions;
-        if ((actions = of_flow_modify_actions_get(flow_mod)) == NULL) {
-            LOG_ERROR("Could not get action list");
-            return INDIGO_ERROR_RESOURCE;
-        }
-        of_list_action_delete(entry->effects.actions);
-        entry->effects.actions = actions;
+        of_list_action_t actions;
+        of_flow_modify_actions_bind(flow_mod, &actions);
+        ft_entry_effects_store(ft, entry, &actions);
     } else {
-        of_list_instruction_t *instructions;
-        if ((instructions = of_flow_modify_instructions_get(flow_mod)) == NULL) {
-            LOG_ERROR("Could not get instruction list");
-            return INDIGO_ERROR_RESOURCE;
-        }
-        of_list_instruction_delete(entry->effects.instructions);
-        entry->effects.instructions = instructions;
+        of_list_instruction_t instructions;
+        of_flow_modify_instructions_bind(flow_mod, &instructions);
+        ft_entry_effects_store(ft, entry, &instructions);
     }
 
     return INDIGO_ERROR_NONE;
 }
 
-static int
-action_list_has_out_port(of_list_action_t *actions, of_port_no_t port)
+/****************************************************************
+ * Output port, group and meter index
+ ****************************************************************/
+
+typedef void (*ft_out_walk_f)(void *cookie, uint8_t kind, uint32_t id);
+
+static void
+action_list_out_walk(of_list_action_t *actions, ft_out_walk_f fn,
+                     void *cookie)
 {
     of_action_t act;
     int loop_rv;
-    of_port_no_t out_port;
+    of_port_no_t port;
+    uint32_t group_id;
 
     OF_LIST_ACTION_ITER(actions, &act, loop_rv) {
         if (act.header.object_id == OF_ACTION_OUTPUT) {
-            of_action_output_port_get(&act.output, &out_port);
-            if (out_port == port) {
-                return 1;
-            }
+            of_action_output_port_get(&act.output, &port);
+            fn(cookie, FT_OUT_REF_PORT, port);
+        } else if (act.header.object_id == OF_ACTION_GROUP) {
+            of_action_group_group_id_get(&act.group, &group_id);
+            fn(cookie, FT_OUT_REF_GROUP, group_id);
         }
     }
-
-    return 0;
 }
 
-static int
-instruction_list_has_out_port(of_list_instruction_t *instructions, of_port_no_t port)
+/*
+ * Call fn for each output and group action and each meter instruction in
+ * the entry's effects
+ */
+static void
+ft_entry_out_walk(ft_entry_t *entry, ft_out_walk_f fn, void *cookie)
 {
     of_instruction_t inst;
+    of_list_action_t actions;
+    uint32_t meter_id;
     int loop_rv;
 
-    OF_LIST_INSTRUCTION_ITER(instructions, &inst, loop_rv) {
+    if (entry->effects.actions == NULL) {
+        return;
+    }
+
+    if (entry->effects.actions->version == OF_VERSION_1_0) {
+        action_list_out_walk(entry->effects.actions, fn, cookie);
+        return;
+    }
+
+    OF_LIST_INSTRUCTION_ITER(entry->effects.instructions, &inst, loop_rv) {
         if (inst.header.object_id == OF_INSTRUCTION_APPLY_ACTIONS) {
-            of_list_action_t actions;
             of_instruction_apply_actions_actions_bind(&inst.apply_actions, &actions);
-            if (action_list_has_out_port(&actions, port)) {
-                return 1;
-            }
         } else if (inst.header.object_id == OF_INSTRUCTION_WRITE_ACTIONS) {
-            of_list_action_t actions;
             of_instruction_write_actions_actions_bind(&inst.write_actions, &actions);
-            if (action_list_has_out_port(&actions, port)) {
-                return 1;
-            }
+        } else if (inst.header.object_id == OF_INSTRUCTION_METER) {
+            of_instruction_meter_meter_id_get(&inst.meter, &meter_id);
+            fn(cookie, FT_OUT_REF_METER, meter_id);
+            continue;
+        } else {
+            continue;
         }
+        action_list_out_walk(&actions, fn, cookie);
     }
+}
 
-    return 0;
+struct ft_out_link_state {
+    ft_instance_t ft;
+    ft_entry_t *entry;
+};
+
+static void
+ft_out_ref_add(void *cookie, uint8_t kind, uint32_t id)
+{
+    struct ft_out_link_state *state = cookie;
+    ft_entry_t *entry = state->entry;
+    ft_out_ref_t *ref;
+    int idx;
+
+    for (idx = 0; idx < entry->out_ref_count; idx++) {
+        if (entry->out_refs[idx].id == id && entry->out_refs[idx].kind == kind) {
+            return;
+        }
+    }
+
+    if (entry->out_ref_count == FT_ENTRY_OUT_REFS) {
+        entry->out_ref_overflow = 1;
+        return;
+    }
+
+    ref = &entry->out_refs[entry->out_ref_count++];
+    ref->id = id;
+    ref->kind = kind;
+    ref->entry = entry;
+    list_push(ft_out_bucket(state->ft, kind, id), &ref->links);
 }
 
-/**
- * Determine if the given entry has port as an output port
+static void
+ft_entry_out_refs_link(ft_instance_t ft, ft_entry_t *entry)
+{
+    struct ft_out_link_state state = { ft, entry };
+
+    entry->out_ref_count = 0;
+    entry->out_ref_overflow = 0;
+
+    ft_entry_out_walk(entry, ft_out_ref_add, &state);
+
+    if (entry->out_ref_overflow) {
+        list_push(&ft->out_overflow_list, &entry->out_overflow_links);
+    }
+}
+
+/*
+ * The refs themselves are kept, so a deleted entry can still be matched
+ * against an out_port or out_group query.
  */
+static void
+ft_entry_out_refs_unlink(ft_instance_t ft, ft_entry_t *entry)
+{
+    int idx;
+
+    for (idx = 0; idx < entry->out_ref_count; idx++) {
+        list_remove(&entry->out_refs[idx].links);
+    }
+
+    if (entry->out_ref_overflow) {
+        list_remove(&entry->out_overflow_links);
+    }
+}
+
 static int
-ft_entry_has_out_port(ft_entry_t *entry, of_port_no_t port)
+ft_entry_out_ref_indexed(ft_entry_t *entry, uint8_t kind, uint32_t id)
 {
-    if (entry->effects.actions->version == OF_VERSION_1_0) {
-        return action_list_has_out_port(entry->effects.actions, port);
-    } else {
-        return instruction_list_has_out_port(entry->effects.instructions, port);
+    int idx;
+
+    for (idx = 0; idx < entry->out_ref_count; idx++) {
+        if (entry->out_refs[idx].id == id && entry->out_refs[idx].kind == kind) {
+            return 1;
+        }
     }
 
     return 0;
 }
+
+struct ft_out_find_state {
+    uint8_t kind;
+    uint32_t id;
+    int found;
+};
+
+static void
+ft_out_ref_find(void *cookie, uint8_t kind, uint32_t id)
+{
+    struct ft_out_find_state *state = cookie;
+
+    if (kind == state->kind && id == state->id) {
+        state->found = 1;
+    }
+}
+
+/*
+ * True if the entry references the port, group or meter only beyond its
+ * indexed refs.  Those are the overflow entries the bucket walk does
+ * not see.
+ */
+static int
+ft_entry_out_ref_unindexed(ft_entry_t *entry, uint8_t kind, uint32_t id)
+{
+    struct ft_out_find_state state = { kind, id, 0 };
+
+    if (ft_entry_out_ref_indexed(entry, kind, id)) {
+        return 0;
+    }
+
+    ft_entry_out_walk(entry, ft_out_ref_find, &state);
+
+    return state.found;
+}
+
+/*
+ * True if the entry's effects reference the port, group or meter.  Only
+ * entries on the overflow list need their actions parsed.
+ */
+static int
+ft_entry_out_ref_has(ft_entry_t *entry, uint8_t kind, uint32_t id)
+{
+    if (ft_entry_out_ref_indexed(entry, kind, id)) {
+        return 1;
+    }
+
+    return entry->out_ref_overflow &&
+        ft_entry_out_ref_unindexed(entry, kind, id);
+}
+
+static int
+ft_entry_out_match(of_meta_match_t *query, ft_entry_t *entry)
+{
+    if (query->out_port != OF_PORT_DEST_WILDCARD &&
+        !ft_entry_out_ref_has(entry, FT_OUT_REF_PORT, query->out_port)) {
+        return 0;
+    }
+
+    if (query->check_out_group &&
+        !ft_entry_out_ref_has(entry, FT_OUT_REF_GROUP, query->out_group)) {
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+ * Count the entries referencing the port, group or meter, storing them in
+ * entries unless it is NULL
+ */
+static int
+ft_out_ref_collect(ft_instance_t ft, uint8_t kind, uint32_t id,
+                   ft_entry_t **entries)
+{
+    list_links_t *cur;
+    int count = 0;
+
+    LIST_FOREACH(ft_out_bucket(ft, kind, id), cur) {
+        ft_out_ref_t *ref = container_of(cur, links, ft_out_ref_t);
+        if (ref->id == id && ref->kind == kind) {
+            if (entries != NULL) {
+                entries[count] = ref->entry;
+            }
+            count++;
+        }
+    }
+
+    LIST_FOREACH(&ft->out_overflow_list, cur) {
+        ft_entry_t *entry = FT_ENTRY_CONTAINER(cur, out_overflow);
+        if (ft_entry_out_ref_unindexed(entry, kind, id)) {
+            if (entries != NULL) {
+                entries[count] = entry;
+            }
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Snapshot the entries referencing the port, group or meter; deleting one
+ * unlinks all of its refs, which may include the next link in the
+ * bucket.  Returns NULL if there are none.
+ */
+static ft_entry_t **
+ft_out_ref_snapshot(ft_instance_t ft, uint8_t kind, uint32_t id, int *count)
+{
+    ft_entry_t **entries;
+
+    *count = ft_out_ref_collect(ft, kind, id, NULL);
+    if (*count == 0) {
+        return NULL;
+    }
+
+    entries = aim_malloc(*count * sizeof(*entries));
+    AIM_TRUE_OR_DIE(entries != NULL);
+    ft_out_ref_collect(ft, kind, id, entries);
+
+    return entries;
+}
+
+static int
+ft_out_ref_foreach(ft_instance_t ft, uint8_t kind, uint32_t id,
+                   ft_group_ref_f callback, void *cookie)
+{
+    ft_entry_t **entries;
+    int count;
+    int idx;
+
+    if (callback == NULL) {
+        return ft_out_ref_collect(ft, kind, id, NULL);
+    }
+
+    entries = ft_out_ref_snapshot(ft, kind, id, &count);
+
+    for (idx = 0; idx < count; idx++) {
+        callback(cookie, entries[idx]);
+    }
+
+    aim_free(entries);
+
+    return count;
+}
+
+int
+ft_group_ref_foreach(ft_instance_t ft, uint32_t group_id,
+                     ft_group_ref_f callback, void *cookie)
+{
+    return ft_out_ref_foreach(ft, FT_OUT_REF_GROUP, group_id, callback, cookie);
+}
+
+int
+ft_meter_ref_foreach(ft_instance_t ft, uint32_t meter_id,
+                     ft_group_ref_f callback, void *cookie)
+{
+    return ft_out_ref_foreach(ft, FT_OUT_REF_METER, meter_id, callback, cookie);
+}
@@ -42,6 +42,14 @@
  *
  * When a client receives a reference to a flow table entry, it must
  * treat the entire structure as read-only.
+ *
+ * Threading
+ *
+ * An instance is not locked. It belongs to the thread that created it,
+ * the event loop for ind_core_ft, and only that thread may use it or
+ * the entries it hands out. Other threads get what they need through
+ * the event loop, as the flow worker does with its results. Debug builds
+ * check this at each entry point.
  */
 
 #ifndef _OFSTATEMANAGER_FT_H_
@@ -52,15 +60,81 @@
 #include <loci/loci.h>
 #include <BigList/biglist.h>
 #include <AIM/aim_list.h>
+#include <pthread.h>
 #include <stdbool.h>
 
 #include "ft_entry.h"
+#include "ft_pool.h"
+#include "ft_id.h"
+#include "ft_slot_index.h"
+
+/**
+ * Default and maximum length of the prefix used for bucketing flows by cookie
+ *
+ * See cookie_prefix_len in ft_config_t.
+ */
+#define FT_DEFAULT_COOKIE_PREFIX_LEN 8
+#define FT_COOKIE_PREFIX_LEN_MAX 16
+#define FT_COOKIE_PREFIX_MASK(_ft) \
+    (~(uint64_t)0 << (64 - (_ft)->config.cookie_prefix_len))
+
+/**
+ * Size classes for pooled effects buffers
+ *
+ * Class N holds buffers of FT_EFFECTS_MIN_SIZE << N bytes.  Larger
+ * effects are allocated individually.
+ */
+#define FT_EFFECTS_MIN_SIZE 64
+#define FT_EFFECTS_CLASS_COUNT 6
+
+/**
+ * Size classes for pooled compact match buffers
+ *
+ * Class N holds buffers of FT_MATCH_MIN_SIZE << N bytes.  The largest
+ * class fits any ft_match_t.
+ */
+#define FT_MATCH_MIN_SIZE 32
+#define FT_MATCH_CLASS_COUNT 6
+
+/**
+ * Slab sizing for the entry, effects and match pools
+ */
+#define FT_ENTRY_POOL_SLAB_ENTRIES 256
+#define FT_EFFECTS_POOL_SLAB_BYTES (64 * 1024)
+#define FT_MATCH_POOL_SLAB_BYTES (64 * 1024)
+
+/**
+ * Number of per-table lists, indexed by table_id
+ */
+#define FT_TABLE_LIST_COUNT 256
+
+/**
+ * Number of buckets in the (table_id, priority) index
+ */
+#define FT_PRIO_BUCKET_COUNT 1024
 
 /**
- * Length of the prefix used for bucketing flows by cookie.
+ * Number of buckets in the output port and group index
  */
-#define FT_COOKIE_PREFIX_LEN 8
-#define FT_COOKIE_PREFIX_MASK (~(uint64_t)0 << (64-FT_COOKIE_PREFIX_LEN))
+#define FT_OUT_BUCKET_COUNT 1024
+
+/**
+ * Initial number of buckets in the interned effects index
+ */
+#define FT_EFFECTS_BUCKET_COUNT 1024
+
+/**
+ * Slab sizing for the interned effects records
+ */
+#define FT_EFFECTS_REF_POOL_SLAB_ENTRIES 256
+
+/**
+ * Default and maximum number of checksum buckets per table
+ *
+ * The bucket count is always a power of 2; see ft_checksum_buckets_size_set.
+ */
+#define FT_CHECKSUM_BUCKETS_DEFAULT 64
+#define FT_CHECKSUM_BUCKETS_MAX (1 << 16)
 
 /**
  * Forward declaration of flowtable handle for other typedefs
@@ -80,16 +154,78 @@ typedef ft_public_t *ft_instance_t;
 
 /**
  * Flow table configuration structure
- * @param max_entries Maximum number of entries to support
- * @param strict_match_bucket_count How many buckets for strict_match hash table
- * @param flow_id_bucket_count How many buckets for flow_id hash table
+ * @param strict_match_bucket_count Initial buckets for strict_match hash table
+ * @param flow_id_bucket_count Initial buckets for flow_id hash table
+ * @param max_load_factor Average chain length that triggers index growth
+ * (0 for FT_DEFAULT_MAX_LOAD_FACTOR)
+ * @param cookie_bucket_count Initial buckets for the full cookie hash table
+ * (0 for flow_id_bucket_count)
+ * @param cookie_prefix_len Number of top cookie bits used by the cookie
+ * prefix buckets (0 for FT_DEFAULT_COOKIE_PREFIX_LEN, at most
+ * FT_COOKIE_PREFIX_LEN_MAX)
+ *
+ * The hash indices grow on demand, so the bucket counts are only a
+ * starting point.
  */
 
 typedef struct ft_config_s {
     int strict_match_bucket_count;
     int flow_id_bucket_count;
+    int max_load_factor;
+    int cookie_bucket_count;
+    int cookie_prefix_len;
 } ft_config_t;
 
+#define FT_DEFAULT_MAX_LOAD_FACTOR 2
+
+/**
+ * Number of buckets allocated at a time when a hash index grows
+ */
+#define FT_INDEX_SEGMENT_SIZE 256
+
+/**
+ * Maximum number of buckets split by a single add
+ *
+ * Bounds the work done in the event loop when an index needs to grow.
+ */
+#define FT_INDEX_MAX_SPLITS_PER_ADD 4
+
+/**
+ * Linear-hashing bucket index
+ *
+ * The index grows one bucket at a time by splitting the bucket at 'split'
+ * into itself and its buddy at 'split + (base_count << level)'. Buckets are
+ * allocated in segments of FT_INDEX_SEGMENT_SIZE so that growing never
+ * moves an existing list head.
+ *
+ * @param segments Directory of bucket segments
+ * @param num_segments Number of allocated segments
+ * @param base_count Bucket count at level 0
+ * @param level Number of completed doublings
+ * @param split Next bucket to be split in the current level
+ * @param bucket_count Number of buckets in use
+ * @param links_offset Offset of the list links in ft_entry_t
+ * @param hash_offset Offset of the cached 32-bit hash in ft_entry_t
+ * @param pins Number of iterators walking a bucket; the index does not
+ * grow while pinned, since a split would move entries under them
+ */
+
+typedef struct ft_index_s {
+    list_head_t **segments;
+    int num_segments;
+    int base_count;
+    int level;
+    int split;
+    int bucket_count;
+    int links_offset;
+    int hash_offset;
+    int pins;
+} ft_index_t;
+
+#define FT_INDEX_BUCKET(_index, _idx)                           \
+    (&(_index)->segments[(_idx) / FT_INDEX_SEGMENT_SIZE]         \
+                        [(_idx) % FT_INDEX_SEGMENT_SIZE])
+
 /**
  * Flow table status structure
  * @param current_count Current number of entries in the table not
@@ -101,6 +237,8 @@ typedef struct ft_config_s {
  * @param idle_expires Number of idle timeouts
  * @param updates Number of calls that modified a flow entry, e.g.
  * effects_modify.
+ * @param noop_updates Number of modifies that matched an entry whose
+ * effects were already those requested, skipping forwarding.
  * @param table_full_errors Number of adds that failed due to no space
  * in the table.
  * @param forwarding_add_errors Number of adds that failed due to a
@@ -114,10 +252,41 @@ typedef struct ft_status_s {
     uint64_t hard_expires;
     uint64_t idle_expires;
     uint64_t updates;
+    uint64_t noop_updates;
     uint64_t table_full_errors;
     uint64_t forwarding_add_errors;
 } ft_status_t;
 
+/**
+ * Flow checksums of one table
+ * @param checksum XOR of the checksums of all entries in the table
+ * @param buckets XOR of the checksums of the entries in each bucket
+ * @param buckets_size Number of buckets, a power of 2
+ * @param buckets_shift Right shift of a checksum giving its bucket
+ *
+ * As in the BSN checksum extensions, the checksum of an entry is its
+ * cookie, which the controller sets to a hash of the flow.  Entries are
+ * bucketed by the top bits of the checksum.
+ */
+
+typedef struct ft_checksum_table_s {
+    uint64_t checksum;
+    uint64_t *buckets;
+    uint32_t buckets_size;
+    uint8_t buckets_shift;
+} ft_checksum_table_t;
+
+/**
+ * Counters summed over the entries of one table
+ * @param packets Sum of the entries' cached packet counts
+ * @param bytes Sum of the entries' cached byte counts
+ */
+
+typedef struct ft_table_counters_s {
+    uint64_t packets;
+    uint64_t bytes;
+} ft_table_counters_t;
+
 /**
  * The public view of the instance for easier dereference
  *
@@ -129,29 +298,114 @@ struct ft_public_s {
     ft_status_t status;
 
     list_head_t all_list;          /* Single list of all current entries */
-
-    list_head_t *strict_match_buckets;  /* Array of strict match based buckets */
-    list_head_t *flow_id_buckets;  /* Array of flow_id based buckets */
+    list_head_t *table_lists;      /* Array of per-table entry lists */
+    uint32_t *table_counts;        /* Length of each per-table list */
+    ft_table_counters_t *table_counters; /* Per-table sums of entry counters */
+
+    ft_slot_index_t strict_match_index; /* Entry slots by strict match hash */
+    ft_index_t flow_id_index;      /* Flow_id based buckets */
+    ft_id_map_t flow_ids;          /* Flow ids in use and their entries; see ft_flow_id_next */
+    ft_index_t cookie_index;       /* Full cookie based buckets */
     list_head_t *cookie_buckets;   /* Array of cookie (prefix) based buckets */
+    list_head_t *prio_buckets;     /* Array of (table_id, priority) buckets */
+    list_head_t *out_buckets;      /* Array of output port, group and meter buckets */
+    list_head_t out_overflow_list; /* Entries with too many of those */
+    ft_checksum_table_t *checksum_tables; /* Array of per-table checksums */
+
+    ft_pool_t entry_pool;          /* Storage for ft_entry_t */
+    ft_pool_t effects_pools[FT_EFFECTS_CLASS_COUNT]; /* Effects buffers */
+    ft_pool_t effects_ref_pool;    /* Storage for ft_effects_t */
+    ft_index_t effects_index;      /* Interned effects by wire hash */
+    uint64_t effects_shares;       /* Stores that reused interned effects */
+    int effects_oversize;          /* Effects too large for any pool */
+    uint64_t effects_oversize_bytes; /* Bytes held by oversize effects */
+    int iter_tasks;                /* Running or paused iter tasks */
+    uint64_t epoch;                /* Bumped by each retired delete */
+    list_head_t iterator_list;     /* Active iterators, oldest first */
+    list_head_t retired_list;      /* Deleted entries, oldest first */
+    int retired_count;             /* Length of retired_list */
+    int snapshots;                 /* Active snapshot iterators */
+    uint64_t snapshot_bytes;       /* Held by snapshot entry arrays */
+    ft_pool_t match_pools[FT_MATCH_CLASS_COUNT]; /* Compact match buffers */
+    pthread_t owner;               /* Only thread allowed to use the table */
 };
 
 #define FT_CONFIG(_ft) (&(_ft)->config)
 #define FT_STATUS(_ft) (&(_ft)->status)
 
+/**
+ * Average chain length of a hash index, in hundredths
+ */
+#define FT_INDEX_LOAD_PERCENT(_ft, _index) \
+    ((_ft)->status.current_count * 100 / (_ft)->_index.bucket_count)
+
+/**
+ * Heap bytes held by a flow table instance
+ * @param entries Entry pool slabs
+ * @param effects Effects pool slabs and oversize effects buffers
+ * @param matches Compact and wire match pool slabs
+ * @param indexes Bucket arrays, hash index segments and checksum buckets
+ * @param iterators Iter task state and snapshot entry arrays
+ * @param entries_used, effects_used, matches_used The part of the pool
+ * slabs handed out
+ *
+ * Pool slabs are never returned to the heap, so the allocated figures
+ * stay at the high-water mark.
+ */
+
+typedef struct ft_memory_s {
+    uint64_t entries;
+    uint64_t effects;
+    uint64_t matches;
+    uint64_t indexes;
+    uint64_t iterators;
+    uint64_t entries_used;
+    uint64_t effects_used;
+    uint64_t matches_used;
+} ft_memory_t;
+
+#define FT_MEMORY_TOTAL(_mem)                                           \
+    ((_mem)->entries + (_mem)->effects + (_mem)->matches +              \
+     (_mem)->indexes + (_mem)->iterators)
+
 /**
  * Safe iterator for the flowtable
  *
  * See ft_iterator_init, ft_iterator_next, and ft_iterator_cleanup.
  *
+ * Stepping does not write to the entries.  An entry deleted while any
+ * iterator is active is unlinked but keeps its links and its ft_entry_t
+ * until every iterator started before the delete has finished, so an
+ * iterator holding it can still step past it.  Deleted entries are
+ * skipped.
+ *
+ * A snapshot iterator (ft_iterator_init_snapshot) instead walks an array
+ * of the entries that matched when it began.  Entries deleted after that
+ * keep their match and effects as well until it finishes, and are still
+ * returned, with a nonzero retired_epoch.
+ *
+ * A query filtering on out_port or out_group walks an array of the
+ * entries referencing that port or group, taken from the output index
+ * when it began, unless the full cookie narrows it further.  Those are
+ * matched as they are returned and deleted ones skipped, as for a list.
+ *
  * This struct should be treated as opaque.
  */
 typedef struct ft_iterator_s {
+    ft_instance_t ft;              /* Flow table being walked */
     list_head_t *head;             /* List head for this iteration */
     ft_entry_t *next_entry;        /* Entry to be returned on next() */
     int links_offset;              /* Offset of the links we're using in the flowtable entry */
-    list_links_t entry_links;      /* Linked into next_entry->iterators if next_entry != NULL */
+    ft_index_t *pinned_index;      /* Hash index walked, if any; see ft_index_t */
+    uint64_t epoch;                /* ft->epoch when the iteration began */
+    bool active;                   /* On ft->iterator_list */
+    list_links_t links;            /* In ft->iterator_list while active */
     bool use_query;                /* Whether 'query' is valid */
     of_meta_match_t query;         /* Optional query to filter by */
+    ft_entry_t **snapshot;         /* Entries of a snapshot or indexed iterator */
+    int snapshot_count;            /* Length of snapshot */
+    int snapshot_index;            /* Next entry of snapshot to return */
+    bool frozen;                   /* Snapshot returns deleted entries unmatched */
 } ft_iterator_t;
 
 /**
@@ -173,6 +427,40 @@ typedef struct ft_iterator_s {
              _next = _cur->next, _cur != &((_ft)->all_list.links);      \
              _cur = _next, _entry = FT_ENTRY_CONTAINER((_cur), table))
 
+/**
+ * Count the entries linked into a hash index
+ * @param index The index to walk
+ *
+ * Walks every bucket; intended for debugging and tests.
+ */
+
+int ft_index_length(ft_index_t *index);
+
+/**
+ * Length of the longest bucket chain in a hash index
+ * @param index The index to walk
+ *
+ * Walks every bucket; intended for debugging and tests.
+ */
+
+int ft_index_chain_max(ft_index_t *index);
+
+/**
+ * Print occupancy of the entry and effects pools
+ * @param ft The flow table instance
+ * @param pvs Output stream
+ */
+
+void ft_pools_show(ft_instance_t ft, aim_pvs_t *pvs);
+
+/**
+ * Add up the heap memory held by a flow table instance
+ * @param ft The flow table instance
+ * @param memory Output
+ */
+
+void ft_memory_get(ft_instance_t ft, ft_memory_t *memory);
+
 /*
  * Create a flow table instance
  *
@@ -218,6 +506,17 @@ indigo_error_t ft_add(ft_instance_t ft,
 
 void ft_delete(ft_instance_t ft, ft_entry_t *entry);
 
+/**
+ * Pick an ID for a new flow
+ * @param ft Handle for a flow table instance
+ * @returns A flow ID not in use, or 0 if none is left
+ *
+ * IDs are recycled, but not straight after their flow is deleted; see
+ * ft_id.h.  The ID becomes used when a flow is added with it.
+ */
+
+indigo_flow_id_t ft_flow_id_next(ft_instance_t ft);
+
 /**
  * Query the flow table (strict match) and return the first match if found
  * @param ft Handle for a flow table instance
@@ -230,11 +529,141 @@ indigo_error_t ft_strict_match(ft_instance_t instance,
                                of_meta_match_t *query,
                                ft_entry_t **entry_ptr);
 
+/**
+ * Find the entry a flow_add replaces
+ * @param ft Handle for a flow table instance
+ * @param flow_add The flow_add message
+ * @param entry_ptr (out) Pointer to where to store the result if found
+ * @returns INDIGO_ERROR_NONE if found, INDIGO_ERROR_NOT_FOUND if not, or
+ * INDIGO_ERROR_PARSE if the match could not be read
+ *
+ * Equivalent to ft_strict_match with the table, priority and match of
+ * the add and no cookie or out_port filter, but packs the match straight
+ * from the message and rejects bucket neighbours on the entry's
+ * strict_match_fp before comparing matches.
+ */
+
+indigo_error_t ft_strict_match_flow_add(ft_instance_t ft,
+                                        of_flow_add_t *flow_add,
+                                        ft_entry_t **entry_ptr);
+
+/**
+ * Check whether any entry overlaps the query
+ * @param ft Handle for a flow table instance
+ * @param query The meta-match data; mode must be OF_MATCH_OVERLAP and
+ * check_priority must be set
+ * @returns Boolean, true if an overlapping entry exists
+ *
+ * Only entries with the same table_id and priority are compared.  A
+ * table_id of TABLE_ID_ANY checks every table at that priority.
+ */
+
+int ft_overlap_found(ft_instance_t ft, of_meta_match_t *query);
+
+/**
+ * Change the table an entry belongs to
+ * @param ft The flow table handle
+ * @param entry Pointer to the entry to update
+ * @param table_id The new table ID
+ *
+ * Used when the forwarding layer places a flow in a different table than
+ * the one requested.  Keeps the (table_id, priority) index consistent.
+ */
+
+void ft_entry_table_id_set(ft_instance_t ft, ft_entry_t *entry,
+                           uint8_t table_id);
+
+/**
+ * Record the counters last read for an entry
+ * @param ft The flow table handle
+ * @param entry Pointer to the entry to update
+ * @param packets Packet count
+ * @param bytes Byte count
+ *
+ * Keeps the per-table sums in table_counters in step.  A deleted entry's
+ * cached counters leave its table's sums with it.  A change in the packet
+ * count moves the entry's last_counter_change to now.
+ */
+
+void ft_entry_counters_set(ft_instance_t ft, ft_entry_t *entry,
+                           uint64_t packets, uint64_t bytes);
+
+/**
+ * Sum the cached counters of the entries with a cookie
+ * @param ft The flow table handle
+ * @param cookie The full cookie
+ * @param table_id Table to count, or TABLE_ID_ANY
+ * @param counters (out) Sums of the entries' cached counters
+ * @returns Number of entries counted
+ *
+ * Only walks the cookie's bucket of the full cookie index.
+ */
+
+uint32_t ft_cookie_counters_get(ft_instance_t ft, uint64_t cookie,
+                                uint8_t table_id,
+                                ft_table_counters_t *counters);
+
+/**
+ * Change the number of checksum buckets of a table
+ * @param ft The flow table handle
+ * @param table_id The table to rebucket
+ * @param buckets_size The new bucket count
+ * @returns INDIGO_ERROR_PARAM unless buckets_size is a power of 2 no
+ * larger than FT_CHECKSUM_BUCKETS_MAX
+ *
+ * The bucket checksums are recomputed from the table's entries.
+ */
+
+indigo_error_t ft_checksum_buckets_size_set(ft_instance_t ft, uint8_t table_id,
+                                            uint32_t buckets_size);
+
+/**
+ * Callback for ft_group_ref_foreach and ft_meter_ref_foreach
+ * @param cookie Opaque pointer passed to the foreach function
+ * @param entry An entry whose effects reference the group or meter
+ */
+
+typedef void (*ft_group_ref_f)(void *cookie, ft_entry_t *entry);
+
+/**
+ * Visit every entry whose effects reference a group
+ * @param ft The flow table instance
+ * @param group_id The referenced group
+ * @param callback Called once per entry, or NULL to only count
+ * @param cookie Passed to callback
+ * @returns The number of entries visited
+ *
+ * Runs in the number of references to the group plus the number of
+ * entries referencing more than FT_ENTRY_OUT_REFS ports and groups.  The
+ * callback may delete the entry it is given, but no other entry.
+ */
+
+int ft_group_ref_foreach(ft_instance_t ft, uint32_t group_id,
+                         ft_group_ref_f callback, void *cookie);
+
+/**
+ * Visit every entry with a meter instruction for a meter
+ * @param ft The flow table instance
+ * @param meter_id The referenced meter
+ * @param callback Called once per entry, or NULL to only count
+ * @param cookie Passed to callback
+ * @returns The number of entries visited
+ *
+ * Uses the same index as ft_group_ref_foreach, with the same cost and
+ * the same rule on deletes from the callback.
+ */
+
+int ft_meter_ref_foreach(ft_instance_t ft, uint32_t meter_id,
+                         ft_group_ref_f callback, void *cookie);
+
 /**
  * Look up a flow by ID
  *
  * @param ft The flow table instance
  * @param id The flow ID being checked
+ *
+ * IDs from the allocator are found in the ID map; only IDs it does not
+ * track, e.g. restored from an older agent, use the flow ID index.
  */
 
 ft_entry_t *
@@ -254,6 +683,37 @@ ft_entry_modify_effects(ft_instance_t instance,
                         ft_entry_t *entry,
                         of_flow_modify_t *flow_mod);
 
+/**
+ * Get the wire form of an entry's match
+ * @param ft The flow table handle
+ * @param entry A live entry
+ * @param version The OpenFlow version of the wire match
+ * @param octets Output; the padded wire match, owned by the entry
+ * @returns 1 on success, 0 if the match has no cached wire form
+ *
+ * The match is encoded on first use and kept with the entry, since it
+ * never changes, so stats replies can copy it instead of encoding it
+ * again. Only one version is kept; a match too large for the match
+ * pools is not kept at all.
+ */
+
+int
+ft_entry_match_wire(ft_instance_t ft, ft_entry_t *entry,
+                    of_version_t version, of_octets_t *octets);
+
+/**
+ * Check whether a modify would leave the effects of an entry unchanged
+ * @param entry The entry matched by the modify
+ * @param flow_mod The LOCI flow mod object
+ * @returns 1 if the modify's actions (instructions) are byte-identical to
+ * those stored in the entry, 0 otherwise
+ *
+ * The length and cached hash are compared before the wire data.
+ */
+
+int
+ft_entry_effects_equal(ft_entry_t *entry, of_flow_modify_t *flow_mod);
+
 /*
  * Spawn a task that iterates over the flowtable
  *
@@ -265,7 +725,9 @@ ft_entry_modify_effects(ft_instance_t instance,
  * This function does not guarantee a consistent view of the
  * flowtable over the course of the task.
  *
- * This function does not use any indexes on the flowtable.
+ * Only the full cookie index and the per-table and cookie prefix lists
+ * are used to narrow the walk;
+ * see ft_iterator_init.
  *
  * The callback function will be called with a NULL entry argument at
  * the end of the iteration.
@@ -282,6 +744,47 @@ ft_spawn_iter_task(ft_instance_t instance,
                    void *cookie,
                    int priority);
 
+/**
+ * Callback asking whether an iter task should pause
+ *
+ * @param cookie The cookie passed to ft_spawn_iter_task_with_pause
+ * @param task Handle to pass to ft_iter_task_resume
+ * @returns true to pause the task before the next entry
+ *
+ * A callback that returns true takes responsibility for calling
+ * ft_iter_task_resume exactly once, later. The iterator keeps its
+ * position while paused.
+ */
+
+typedef bool (*ft_iter_task_pause_f)(void *cookie, void *task);
+
+/**
+ * Spawn an iter task that can be paused
+ *
+ * Like ft_spawn_iter_task, but 'pause' is consulted before each entry.
+ * This lets producers of large replies wait for the consumer to catch up.
+ */
+
+indigo_error_t
+ft_spawn_iter_task_with_pause(ft_instance_t instance,
+                              of_meta_match_t *query,
+                              ft_iter_task_callback_f callback,
+                              ft_iter_task_pause_f pause,
+                              void *cookie,
+                              int priority);
+
+/**
+ * Resume a paused iter task
+ *
+ * @param task The handle given to the pause callback
+ *
+ * The signature matches the connection manager's output ready callback
+ * so it can be registered there directly.
+ */
+
+void
+ft_iter_task_resume(void *task);
+
 /**
  * Initialize a flowtable iterator
  *
@@ -292,10 +795,33 @@ ft_spawn_iter_task(ft_instance_t instance,
  * This iterator does not guarantee a consistent view of the flowtable over
  * the course of the iteration. Flows added during the iteration may or may
  * not be returned by the iterator.
+ *
+ * A query naming a single table only walks that table's entries, and one
+ * filtering on out_port or out_group only those referencing it.
  */
 void
 ft_iterator_init(ft_iterator_t *iter, ft_instance_t ft, of_meta_match_t *query);
 
+/**
+ * Initialize a flowtable iterator over a frozen view
+ *
+ * As ft_iterator_init, but the matching entries are collected up front
+ * and exactly those are returned, however the table changes during the
+ * walk: flows added later are not returned and flows deleted later
+ * still are, with the match, effects and counters they had.  The entry
+ * fields are read as they are when returned, so a modify made during
+ * the walk is seen.
+ *
+ * Unlike ft_iterator_init, the entries returned stay valid until
+ * ft_iterator_cleanup, which must be called even after next() returns
+ * NULL.  Until then it costs a pointer per matching entry and keeps the
+ * match and effects of entries deleted meanwhile.  Meant for dumps that
+ * yield, such as flow stats.
+ */
+void
+ft_iterator_init_snapshot(ft_iterator_t *iter, ft_instance_t ft,
+                          of_meta_match_t *query);
+
 /**
  * Yield the next entry from an iterator
  *
@@ -25,16 +25,41 @@
 #include <loci/loci.h>
 
 #include "ofstatemanager_int.h"
+#include "ft_match.h"
 
 /****************************************************************
  * The flow entry structure
  ****************************************************************/
 
+/**
+ * Number of 64-bit words in a match signature
+ */
+#define FT_MATCH_SIG_WORDS 3
+
+/**
+ * Match signature
+ *
+ * A few commonly used match fields and their masks packed into fixed
+ * words.  Two matches whose signatures disagree under both masks cannot
+ * overlap, which lets the overlap check skip of_match_overlap for most
+ * entries.  Agreement says nothing; the full comparison is still needed.
+ */
+
+typedef struct ft_match_sig_s {
+    uint64_t value[FT_MATCH_SIG_WORDS];
+    uint64_t mask[FT_MATCH_SIG_WORDS];
+} ft_match_sig_t;
+
 /**
  * The data in a flow table entry
  *
  * @param id The externally determined flow ID; primary key
- * @param match The match structure recorded from the original add
+ * @param match Compact form of the match from the original add
+ * @param match_class Size class of the match buffer
+ * @param match_wire Wire form of the match, or NULL; see ft_entry_match_wire
+ * @param match_wire_bytes Length of match_wire, padding included
+ * @param match_wire_class Size class of the match_wire buffer
+ * @param match_wire_version OpenFlow version of match_wire
  * @param priority The priority, from the original add
  * @param idle_timeout The idle_timeout, from the original add
  * @param hard_timeout The hard_timeout, from the original add
@@ -43,36 +68,121 @@
  * @param cookie The cookie, from the original or as updated
  * @param effects The actions or instructions from the add or as updated.
  * See below.
+ * @param effects_storage Backing object for effects
+ * @param effects_ref Interned wire data of the effects; see ft_effects_t
  * @param insert_time The timestamp when the entry was inserted
  * @param packets Number of packets matched by the entry
  * @param bytes Number of bytes matched by the entry
  * @param last_counter_change Last update when counters changed
+ * @param expiration_time Cached deadline while in the expiration heap
+ * @param expiration_index Position in the expiration heap, or -1
+ * @param pending_add Tracked copy of the add while forwarding has it pending
+ * @param pending_cxn_id Connection the pending add arrived on
+ * @param packets, bytes Counters from the last stats fetch; see
+ * ft_entry_counters_set
+ * @param reported_packets, reported_bytes Counters as of the last flow
+ * counter update sent; see flow_counters.c
  * @param table_links For iterating across the flow table
- * @param prio_links Search by priority
- * @param match_links Search by strict match
+ * @param table_id_links Iterating across a single table
+ * @param prio_links Search by (table_id, priority)
  * @param flow_id_links Search by flow id
+ * @param out_refs Search by output port, group or meter; see
+ * ft_group_ref_foreach
+ * @param out_ref_count Number of valid out_refs
+ * @param out_ref_overflow References beyond FT_ENTRY_OUT_REFS exist
+ * @param out_overflow_links On the overflow list if out_ref_overflow
+ * @param retired_links On the flowtable's retired list once deleted;
+ * shares storage with flow_id_links, which ft_entry_unlink has removed
+ * @param retired_epoch Epoch of the delete, 0 while live; see ft_iterator_t
+ * @param strict_match_hash Cached hash of the match and priority, under
+ * which the entry's slot is kept in the strict match index
+ * @param slot Number of the entry in the entry pool, kept across reuse
+ * @param strict_match_fp Fingerprint of the match, priority and table_id
+ * @param flow_id_hash Cached hash of the flow id
+ * @param match_sig Packed subset of the match used to reject overlap checks
+ *
+ * The effects object lives in effects_storage and its wire data in a
+ * buffer owned by the flowtable and shared with every entry whose effects
+ * are byte-identical; never write to it or pass it to of_object_delete.
  *
  * The effects (actions or instructions) are tied to a specific OpenFlow
  * version. For example, a flow may be added using OpenFlow 1.0 but
  * modified using OpenFlow 1.3. Either union member may be used to check
  * the version and LOCI object type.
  *
+ * The match lives in a buffer sized to its fields; use ft_match_unpack
+ * to get an of_match_t for it.
+ *
  * The match, priority, timeouts and flags are invariant once the entry
  * has been added to the table.  The cookie and effects may be updated by
  * modify commands.
+ *
+ * There is one of these per flow, so fields are ordered by size to leave
+ * no padding; table_id sits with the other small fields for that reason.
+ */
+
+/**
+ * Number of output ports, groups and meters an entry is indexed under
+ * directly
+ *
+ * Entries that reference more also sit on the flowtable's overflow
+ * list, which every lookup by port, group or meter checks.
  */
+#define FT_ENTRY_OUT_REFS 2
+
+/* What an ft_out_ref_t names */
+#define FT_OUT_REF_PORT 0          /* Output action port */
+#define FT_OUT_REF_GROUP 1         /* Group action group_id */
+#define FT_OUT_REF_METER 2         /* Meter instruction meter_id */
+
+typedef struct ft_out_ref_s {
+    uint32_t id;                   /* Port number, group_id or meter_id */
+    uint8_t kind;                  /* FT_OUT_REF_PORT, _GROUP or _METER */
+    list_links_t links;            /* In the (kind, id) bucket */
+    struct ft_entry_s *entry;      /* Entry holding this reference */
+} ft_out_ref_t;
+
+/**
+ * Interned effects wire data
+ *
+ * Flows commonly share byte-identical actions or instructions, such as
+ * a group and a goto-table, so the flowtable keeps one copy of each
+ * distinct list, found by a hash of its wire bytes, and counts the
+ * entries referring to it.
+ *
+ * @param links In the flowtable's effects index
+ * @param hash Hash of the wire data
+ * @param refcount Number of entries using the data
+ * @param bytes Length of the wire data
+ * @param cls Size class of buf, or -1 if not pooled
+ * @param buf The wire data
+ */
+
+typedef struct ft_effects_s {
+    list_links_t links;
+    uint32_t hash;
+    uint32_t refcount;
+    int bytes;
+    int cls;
+    uint8_t *buf;
+} ft_effects_t;
 
 typedef struct ft_entry_s {
     /* Key */
     indigo_flow_id_t     id;
 
     /* Invariant */
-    of_match_t match;
+    ft_match_t *match;
+    uint8_t *match_wire;
+    void *priv;
+    int match_class;
+    uint16_t match_wire_bytes;
+    uint8_t match_wire_class;
+    uint8_t match_wire_version;
     uint16_t priority;
     uint16_t idle_timeout;
     uint16_t hard_timeout;
     uint16_t flags;
-    void *priv;
 
     /* Modifiable thru API calls */
     uint64_t cookie;
@@ -80,20 +190,43 @@ typedef struct ft_entry_s {
         of_list_action_t *actions;
         of_list_instruction_t *instructions;
     } effects;
+    of_object_storage_t effects_storage;
+    ft_effects_t *effects_ref;
 
     /* Updated by implementation */
-    uint8_t table_id;
     indigo_time_t insert_time;
     indigo_time_t last_counter_change;
+    indigo_time_t expiration_time;
+    of_flow_add_t *pending_add;
+    uint64_t packets;              /* Counters as of the last stats fetch */
+    uint64_t bytes;
+    uint64_t reported_packets;     /* As of the last flow counter update */
+    uint64_t reported_bytes;
+    int expiration_index;
+    indigo_cxn_id_t pending_cxn_id;
 
     /* For linked list maintance */
     list_links_t table_links;      /* For iterating across the flow table */
-    list_links_t strict_match_links;  /* Search by strict match */
-    list_links_t flow_id_links;    /* Search by flow id */
-    list_links_t cookie_links;     /* Search by cookie */
-    list_links_t expiration_links; /* Expiration list entry */
-    list_head_t iterators;         /* List of ft_iterator_t objects
-                                      pointing to this entry */
+    list_links_t table_id_links;   /* For iterating across one table */
+    list_links_t prio_links;       /* Search by (table_id, priority) */
+    union {
+        list_links_t flow_id_links;  /* Search by flow id, while live */
+        list_links_t retired_links;  /* On the retired list once deleted */
+    };
+    list_links_t cookie_links;     /* Search by cookie prefix */
+    list_links_t cookie_hash_links; /* Search by full cookie */
+    list_links_t out_overflow_links;
+    ft_out_ref_t out_refs[FT_ENTRY_OUT_REFS]; /* Search by port or group */
+    uint64_t retired_epoch;        /* Epoch of the delete; 0 while live */
+    uint64_t strict_match_fp;      /* See ft_strict_match_flow_add */
+    uint32_t strict_match_hash;    /* Hash used by strict match index */
+    uint32_t slot;                 /* In the entry pool; see ft_pool_slots_enable */
+    uint32_t flow_id_hash;         /* Hash used by flow id index */
+    uint32_t cookie_hash;          /* Hash used by cookie index */
+    uint8_t table_id;              /* Updated by implementation */
+    uint8_t out_ref_count;
+    uint8_t out_ref_overflow;
+    ft_match_sig_t match_sig;      /* See ft_match_sig_t */
 } ft_entry_t;
 
 /**
@@ -156,6 +289,7 @@ typedef enum of_match_mode_e {
 
 typedef struct of_meta_match_s {
     of_match_t match;       /* The match object for the query */
+    ft_match_t packed;      /* Compact form of match; see ft_meta_match_prepare */
     of_match_mode_t mode;   /* See above */
     uint64_t cookie;
     uint64_t cookie_mask;   /* If 0, do not match cookie */
@@ -163,12 +297,26 @@ typedef struct of_meta_match_s {
     int check_priority;     /* Boolean; should priority be checked */
     int check_overlap;      /* Boolean, for adds */
     of_port_no_t out_port;  /* OFPP_ANY means do not match */
+    int check_out_group;    /* Boolean; should out_group be checked */
+    uint32_t out_group;     /* Group the effects must reference */
     uint8_t table_id;       /* Set to TABLE_ID_ANY to wildcard */
 } of_meta_match_t;
 
+/**
+ * @brief Fill in the compact form of a query's match
+ * @param query The query, with match set
+ *
+ * Must be called after the query's match is set or changed and before
+ * the query is passed to ft_entry_meta_match.  The flowtable entry
+ * points that take a query do this themselves.
+ */
+
+extern void ft_meta_match_prepare(of_meta_match_t *query);
+
 /**
  * @brief Determine if an entry's match agrees with the metamatch data
- * @param query The match information from the query
+ * @param query The match information from the query, prepared with
+ * ft_meta_match_prepare
  * @param entry Pointer to the flow table entry being checked
  * @returns Boolean, true if entry matches meta_match data
  */
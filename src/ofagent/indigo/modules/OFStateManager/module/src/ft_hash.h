@@ -0,0 +1,102 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Hashing for flowtable indices
+ *
+ * Integer keys (flow ids, group ids, table/priority pairs) go through
+ * a multiply-xorshift finalizer rather than a general byte hash.
+ * Compact matches are hashed with CRC32C when the target has it:
+ * SSE4.2 on x86 and the CRC extension on ARMv8, chosen from the
+ * compiler's target macros.  Other targets use murmur.  The CRC is
+ * finalized so every bit of the result depends on the input, since
+ * the indices take it modulo the bucket count.
+ */
+
+#ifndef _OFSTATEMANAGER_FT_HASH_H_
+#define _OFSTATEMANAGER_FT_HASH_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <murmur/murmur.h>
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define FT_HASH_CRC32C 1
+#define FT_HASH_CRC32C_U64(_crc, _v) ((uint32_t)_mm_crc32_u64((_crc), (_v)))
+#define FT_HASH_CRC32C_U8(_crc, _v) _mm_crc32_u8((_crc), (_v))
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define FT_HASH_CRC32C 1
+#define FT_HASH_CRC32C_U64(_crc, _v) __crc32cd((_crc), (_v))
+#define FT_HASH_CRC32C_U8(_crc, _v) __crc32cb((_crc), (_v))
+#else
+#define FT_HASH_CRC32C 0
+#endif
+
+/**
+ * Hash a 32-bit key
+ */
+static inline uint32_t
+ft_hash_u32(uint32_t key, uint32_t seed)
+{
+    return murmur_fmix(key ^ seed);
+}
+
+/**
+ * Hash a 64-bit key
+ */
+static inline uint32_t
+ft_hash_u64(uint64_t key, uint32_t seed)
+{
+    key ^= seed;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return (uint32_t)key;
+}
+
+/**
+ * Hash a byte string, such as the used part of a compact match
+ */
+static inline uint32_t
+ft_hash_bytes(const void *key, int len, uint32_t seed)
+{
+#if FT_HASH_CRC32C == 1
+    const uint8_t *p = key;
+    uint32_t crc = ~seed;
+    uint64_t word;
+
+    for (; len >= 8; len -= 8, p += 8) {
+        memcpy(&word, p, sizeof(word));
+        crc = FT_HASH_CRC32C_U64(crc, word);
+    }
+    for (; len > 0; len--, p++) {
+        crc = FT_HASH_CRC32C_U8(crc, *p);
+    }
+    return murmur_fmix(~crc);
+#else
+    return murmur_hash(key, len, seed);
+#endif
+}
+
+#endif /* _OFSTATEMANAGER_FT_HASH_H_ */
@@ -0,0 +1,172 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Flow ID allocator
+ */
+
+#include <OFStateManager/ofstatemanager_config.h>
+#include <indigo/indigo.h>
+
+#include "ofstatemanager_int.h"
+#include "ofstatemanager_log.h"
+#include "ft_id.h"
+
+#define WORD(_id) ((_id) / 64)
+#define BIT(_id) (1ULL << ((_id) % 64))
+
+static void
+ft_id_map_grow(ft_id_map_t *map, uint32_t capacity)
+{
+    uint32_t old_words = map->capacity / 64;
+    uint32_t words = capacity / 64;
+
+    map->used = aim_realloc(map->used, words * sizeof(uint64_t));
+    map->full = aim_realloc(map->full, (words / 64) * sizeof(uint64_t));
+    map->values = aim_realloc(map->values, capacity * sizeof(void *));
+    AIM_TRUE_OR_DIE(map->used != NULL && map->full != NULL &&
+                    map->values != NULL);
+
+    INDIGO_MEM_SET(map->used + old_words, 0,
+                   (words - old_words) * sizeof(uint64_t));
+    INDIGO_MEM_SET(map->full + old_words / 64, 0,
+                   (words - old_words) / 64 * sizeof(uint64_t));
+    INDIGO_MEM_SET(map->values + old_words * 64, 0,
+                   (capacity - old_words * 64) * sizeof(void *));
+
+    map->capacity = capacity;
+}
+
+void
+ft_id_map_init(ft_id_map_t *map)
+{
+    INDIGO_MEM_SET(map, 0, sizeof(*map));
+    ft_id_map_grow(map, FT_ID_MAP_MIN_CAPACITY);
+    map->max_capacity = FT_ID_MAP_MAX_CAPACITY;
+    map->used[0] = BIT(0);
+    map->cursor = 1;
+}
+
+void
+ft_id_map_cleanup(ft_id_map_t *map)
+{
+    aim_free(map->used);
+    aim_free(map->full);
+    aim_free(map->values);
+    INDIGO_MEM_SET(map, 0, sizeof(*map));
+}
+
+/* First clear bit at or after start, or capacity if there is none */
+static uint32_t
+ft_id_map_find(ft_id_map_t *map, uint32_t start)
+{
+    uint32_t words = map->capacity / 64;
+    uint32_t word = WORD(start);
+    uint64_t bits;
+
+    bits = ~map->used[word] & (~0ULL << (start % 64));
+    if (bits) {
+        return word * 64 + __builtin_ctzll(bits);
+    }
+
+    /* Skip full words through the upper level */
+    for (word++; word < words; word = (word | 63) + 1) {
+        bits = ~map->full[WORD(word)] & (~0ULL << (word % 64));
+        if (bits) {
+            word = (word & ~63) + __builtin_ctzll(bits);
+            return word * 64 + __builtin_ctzll(~map->used[word]);
+        }
+    }
+
+    return map->capacity;
+}
+
+indigo_flow_id_t
+ft_id_map_next(ft_id_map_t *map)
+{
+    uint32_t id;
+
+    if (map->count + 1 >= map->capacity / 2 &&
+        map->capacity < map->max_capacity) {
+        ft_id_map_grow(map, map->capacity * 2);
+    }
+
+    id = ft_id_map_find(map, map->cursor);
+    if (id == map->capacity) {
+        id = ft_id_map_find(map, 1);
+        if (id == map->capacity) {
+            return 0;
+        }
+    }
+
+    map->cursor = (id + 1 < map->capacity) ? id + 1 : 1;
+
+    return id;
+}
+
+void
+ft_id_map_set(ft_id_map_t *map, indigo_flow_id_t id, void *value)
+{
+    if (!ft_id_map_tracked(id) || id >= map->max_capacity) {
+        return;
+    }
+
+    if (id >= map->capacity) {
+        uint32_t capacity = map->capacity;
+        while (capacity <= id) {
+            capacity *= 2;
+        }
+        ft_id_map_grow(map, capacity);
+    }
+
+    map->values[id] = value;
+
+    if (map->used[WORD(id)] & BIT(id)) {
+        return;
+    }
+
+    map->used[WORD(id)] |= BIT(id);
+    if (map->used[WORD(id)] == ~0ULL) {
+        map->full[WORD(WORD(id))] |= BIT(WORD(id));
+    }
+    map->count++;
+}
+
+void
+ft_id_map_clear(ft_id_map_t *map, indigo_flow_id_t id)
+{
+    if (id == 0 || id >= map->capacity ||
+        !(map->used[WORD(id)] & BIT(id))) {
+        return;
+    }
+
+    map->used[WORD(id)] &= ~BIT(id);
+    map->full[WORD(WORD(id))] &= ~BIT(WORD(id));
+    map->values[id] = NULL;
+    map->count--;
+}
+
+uint64_t
+ft_id_map_bytes(ft_id_map_t *map)
+{
+    return (map->capacity / 64) * sizeof(uint64_t) +
+        (map->capacity / 4096) * sizeof(uint64_t) +
+        map->capacity * (uint64_t)sizeof(void *);
+}
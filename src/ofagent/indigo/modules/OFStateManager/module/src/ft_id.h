@@ -0,0 +1,129 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Flow ID allocator
+ *
+ * IDs are tracked in a two-level bitmap and handed out next-fit from a
+ * cursor, so a freed ID comes back only after the cursor has gone round
+ * the map.  The map doubles whenever half its IDs are in use, keeping
+ * IDs dense while leaving at least that many allocations between the
+ * free and the reuse of an ID.  The flow ID is also the forwarding
+ * cookie, and the gap keeps late events for a deleted flow from landing
+ * on its successor.
+ *
+ * Because IDs are dense, the map also holds a value per ID, so the
+ * entry for a flow ID is found with one array access rather than a walk
+ * of a hash chain.
+ */
+
+#ifndef _OFSTATEMANAGER_FT_ID_H_
+#define _OFSTATEMANAGER_FT_ID_H_
+
+#include <indigo/indigo.h>
+
+/**
+ * Initial and largest number of IDs covered by a map
+ */
+#define FT_ID_MAP_MIN_CAPACITY 4096
+#define FT_ID_MAP_MAX_CAPACITY (1 << 26)
+
+/**
+ * Flow ID map
+ * @param used Bit N set if ID N is in use; ID 0 is never handed out
+ * @param full Bit N set if used word N has no clear bit
+ * @param values Value N set with ID N, NULL while ID N is free
+ * @param capacity Number of IDs covered, a power of 2
+ * @param max_capacity Largest capacity the map grows to, a power of 2;
+ *        FT_ID_MAP_MAX_CAPACITY unless lowered after init, as tests do
+ * @param count Number of IDs in use, not counting ID 0
+ * @param cursor Next ID to try
+ *
+ * IDs at or beyond FT_ID_MAP_MAX_CAPACITY, e.g. restored from an older
+ * agent, are not tracked; the map never hands them out.
+ */
+
+typedef struct ft_id_map_s {
+    uint64_t *used;
+    uint64_t *full;
+    void **values;
+    uint32_t capacity;
+    uint32_t max_capacity;
+    uint32_t count;
+    uint32_t cursor;
+} ft_id_map_t;
+
+/**
+ * Initialize an ID map
+ */
+void ft_id_map_init(ft_id_map_t *map);
+
+/**
+ * Release an ID map
+ */
+void ft_id_map_cleanup(ft_id_map_t *map);
+
+/**
+ * Pick the next free ID
+ * @returns The ID, or 0 if the map is full
+ *
+ * The ID is not marked used; see ft_id_map_set.
+ */
+indigo_flow_id_t ft_id_map_next(ft_id_map_t *map);
+
+/**
+ * Mark an ID used
+ * @param value Returned by ft_id_map_get until the ID is cleared
+ *
+ * Untracked IDs and IDs at or beyond max_capacity are ignored; see
+ * ft_id_map_tracked.
+ */
+void ft_id_map_set(ft_id_map_t *map, indigo_flow_id_t id, void *value);
+
+/**
+ * Mark an ID free
+ */
+void ft_id_map_clear(ft_id_map_t *map, indigo_flow_id_t id);
+
+/**
+ * Does the map track this ID?
+ */
+static inline int
+ft_id_map_tracked(indigo_flow_id_t id)
+{
+    return id != 0 && id < FT_ID_MAP_MAX_CAPACITY;
+}
+
+/**
+ * Value set with a tracked ID
+ * @returns The value, or NULL if the ID is free
+ */
+static inline void *
+ft_id_map_get(ft_id_map_t *map, indigo_flow_id_t id)
+{
+    return id < map->capacity ? map->values[id] : NULL;
+}
+
+/**
+ * Bytes allocated for a map's bitmaps and values
+ */
+uint64_t ft_id_map_bytes(ft_id_map_t *map);
+
+#endif /* _OFSTATEMANAGER_FT_ID_H_ */
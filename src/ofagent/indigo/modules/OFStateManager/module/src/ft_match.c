@@ -0,0 +1,447 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Compact match storage for flowtable entries
+ */
+
+#include <OFStateManager/ofstatemanager_config.h>
+#include <indigo/indigo.h>
+
+#include "ofstatemanager_int.h"
+#include "ft_match.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+/* Location of each of_match_fields_t member, in declaration order */
+typedef struct ft_match_field_s {
+    uint16_t offset;
+    uint16_t size;
+} ft_match_field_t;
+
+#define FT_MATCH_FIELD(name) \
+    { offsetof(of_match_fields_t, name), sizeof(((of_match_fields_t *)0)->name) }
+
+static const ft_match_field_t ft_match_fields[] = {
+    FT_MATCH_FIELD(in_port),
+    FT_MATCH_FIELD(in_phy_port),
+    FT_MATCH_FIELD(metadata),
+    FT_MATCH_FIELD(eth_dst),
+    FT_MATCH_FIELD(eth_src),
+    FT_MATCH_FIELD(eth_type),
+    FT_MATCH_FIELD(vlan_vid),
+    FT_MATCH_FIELD(vlan_pcp),
+    FT_MATCH_FIELD(ip_dscp),
+    FT_MATCH_FIELD(ip_ecn),
+    FT_MATCH_FIELD(ip_proto),
+    FT_MATCH_FIELD(ipv4_src),
+    FT_MATCH_FIELD(ipv4_dst),
+    FT_MATCH_FIELD(tcp_dst),
+    FT_MATCH_FIELD(tcp_src),
+    FT_MATCH_FIELD(udp_dst),
+    FT_MATCH_FIELD(udp_src),
+    FT_MATCH_FIELD(sctp_dst),
+    FT_MATCH_FIELD(sctp_src),
+    FT_MATCH_FIELD(icmpv4_type),
+    FT_MATCH_FIELD(icmpv4_code),
+    FT_MATCH_FIELD(arp_op),
+    FT_MATCH_FIELD(arp_spa),
+    FT_MATCH_FIELD(arp_tpa),
+    FT_MATCH_FIELD(arp_sha),
+    FT_MATCH_FIELD(arp_tha),
+    FT_MATCH_FIELD(ipv6_src),
+    FT_MATCH_FIELD(ipv6_dst),
+    FT_MATCH_FIELD(ipv6_flabel),
+    FT_MATCH_FIELD(icmpv6_type),
+    FT_MATCH_FIELD(icmpv6_code),
+    FT_MATCH_FIELD(ipv6_nd_target),
+    FT_MATCH_FIELD(ipv6_nd_sll),
+    FT_MATCH_FIELD(ipv6_nd_tll),
+    FT_MATCH_FIELD(mpls_label),
+    FT_MATCH_FIELD(mpls_tc),
+    FT_MATCH_FIELD(mpls_bos),
+    FT_MATCH_FIELD(tunnel_id),
+    FT_MATCH_FIELD(ofdpa_vrf),
+    FT_MATCH_FIELD(ofdpa_traffic_class),
+    FT_MATCH_FIELD(ofdpa_color),
+    FT_MATCH_FIELD(ofdpa_dei),
+    FT_MATCH_FIELD(ofdpa_qos_index),
+    FT_MATCH_FIELD(ofdpa_lmep_id),
+    FT_MATCH_FIELD(ofdpa_mpls_ttl),
+    FT_MATCH_FIELD(ofdpa_mpls_l2_port),
+    FT_MATCH_FIELD(ofdpa_l3_in_port),
+    FT_MATCH_FIELD(ofdpa_ovid),
+    FT_MATCH_FIELD(ofdpa_mpls_data_first_nibble),
+    FT_MATCH_FIELD(ofdpa_mpls_ach_channel),
+    FT_MATCH_FIELD(ofdpa_mpls_next_label_is_gal),
+    FT_MATCH_FIELD(ofdpa_oam_y1731_mdl),
+    FT_MATCH_FIELD(ofdpa_oam_y1731_opcode),
+    FT_MATCH_FIELD(ofdpa_color_actions_index),
+    FT_MATCH_FIELD(ofdpa_txfcl),
+    FT_MATCH_FIELD(ofdpa_rxfcl),
+    FT_MATCH_FIELD(ofdpa_rx_timestamp),
+    FT_MATCH_FIELD(ofdpa_bfd_discriminator),
+    FT_MATCH_FIELD(ofdpa_protection_index),
+    FT_MATCH_FIELD(ofdpa_allow_vlan_translation),
+    FT_MATCH_FIELD(ofdpa_mpls_type),
+    FT_MATCH_FIELD(onf_actset_output),
+    FT_MATCH_FIELD(bsn_in_ports_128),
+    FT_MATCH_FIELD(bsn_lag_id),
+    FT_MATCH_FIELD(bsn_vrf),
+    FT_MATCH_FIELD(bsn_l3_interface_class_id),
+    FT_MATCH_FIELD(bsn_global_vrf_allowed),
+    FT_MATCH_FIELD(bsn_l3_src_class_id),
+    FT_MATCH_FIELD(bsn_l3_dst_class_id),
+    FT_MATCH_FIELD(bsn_egr_port_group_id),
+    FT_MATCH_FIELD(bsn_udf1),
+    FT_MATCH_FIELD(bsn_udf0),
+    FT_MATCH_FIELD(bsn_udf2),
+    FT_MATCH_FIELD(bsn_udf5),
+    FT_MATCH_FIELD(bsn_udf4),
+    FT_MATCH_FIELD(bsn_udf7),
+    FT_MATCH_FIELD(bsn_udf6),
+    FT_MATCH_FIELD(bsn_udf3),
+};
+
+#define FT_MATCH_FIELD_COUNT AIM_ARRAYSIZE(ft_match_fields)
+
+AIM_STATIC_ASSERT(ft_match_present_words,
+                  FT_MATCH_FIELD_COUNT <= 64 * FT_MATCH_PRESENT_WORDS);
+
+#define FT_MATCH_PRESENT_TEST(_m, _idx) \
+    (((_m)->present[(_idx) / 64] >> ((_idx) % 64)) & 1)
+
+/*
+ * The compare kernels below run over the value half and mask half of two
+ * compact matches with identical layout, a vector at a time where the
+ * target has SIMD, then a 64-bit word at a time, then bytewise.  Only
+ * the vector width and its operations differ per ISA.
+ */
+
+#if defined(__AVX2__)
+#define FT_MATCH_VEC_BYTES 32
+typedef __m256i ft_match_vec_t;
+#define FT_MATCH_VEC_LOAD(_p) _mm256_loadu_si256((const __m256i *)(_p))
+#define FT_MATCH_VEC_AND(_a, _b) _mm256_and_si256(_a, _b)
+#define FT_MATCH_VEC_XOR(_a, _b) _mm256_xor_si256(_a, _b)
+#define FT_MATCH_VEC_OR(_a, _b) _mm256_or_si256(_a, _b)
+#define FT_MATCH_VEC_ANY(_v) (!_mm256_testz_si256(_v, _v))
+#elif defined(__SSE2__)
+#define FT_MATCH_VEC_BYTES 16
+typedef __m128i ft_match_vec_t;
+#define FT_MATCH_VEC_LOAD(_p) _mm_loadu_si128((const __m128i *)(_p))
+#define FT_MATCH_VEC_AND(_a, _b) _mm_and_si128(_a, _b)
+#define FT_MATCH_VEC_XOR(_a, _b) _mm_xor_si128(_a, _b)
+#define FT_MATCH_VEC_OR(_a, _b) _mm_or_si128(_a, _b)
+#define FT_MATCH_VEC_ANY(_v) \
+    (_mm_movemask_epi8(_mm_cmpeq_epi8(_v, _mm_setzero_si128())) != 0xffff)
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FT_MATCH_VEC_BYTES 16
+typedef uint8x16_t ft_match_vec_t;
+#define FT_MATCH_VEC_LOAD(_p) vld1q_u8(_p)
+#define FT_MATCH_VEC_AND(_a, _b) vandq_u8(_a, _b)
+#define FT_MATCH_VEC_XOR(_a, _b) veorq_u8(_a, _b)
+#define FT_MATCH_VEC_OR(_a, _b) vorrq_u8(_a, _b)
+#define FT_MATCH_VEC_ANY(_v) \
+    ((vgetq_lane_u64(vreinterpretq_u64_u8(_v), 0) | \
+      vgetq_lane_u64(vreinterpretq_u64_u8(_v), 1)) != 0)
+#endif
+
+#define FT_MATCH_AND(_a, _b) ((_a) & (_b))
+#define FT_MATCH_XOR(_a, _b) ((_a) ^ (_b))
+#define FT_MATCH_OR(_a, _b) ((_a) | (_b))
+
+/* Nonzero where the entry fails to cover the query's value and mask */
+#define FT_MATCH_SUBSET_DIFF(_and, _xor, _or, _ev, _em, _qv, _qm) \
+    _or(_xor(_and(_em, _qm), _qm), _xor(_and(_ev, _qm), _qv))
+
+/* Nonzero where two values differ under both masks */
+#define FT_MATCH_OVERLAP_DIFF(_and, _xor, _ev, _em, _qv, _qm) \
+    _and(_and(_xor(_ev, _qv), _em), _qm)
+
+static inline uint64_t
+ft_match_word_load(const uint8_t *p)
+{
+    uint64_t w;
+    INDIGO_MEM_COPY(&w, p, sizeof(w));
+    return w;
+}
+
+/*
+ * Return nonzero if any byte of the entry's value/mask halves fails to
+ * cover the aligned query's.  n is the length of each half.
+ */
+static int
+ft_match_subset_diff(const uint8_t *e, const uint8_t *q, int n)
+{
+    int i = 0;
+
+#ifdef FT_MATCH_VEC_BYTES
+    for (; i + FT_MATCH_VEC_BYTES <= n; i += FT_MATCH_VEC_BYTES) {
+        ft_match_vec_t d = FT_MATCH_SUBSET_DIFF(
+            FT_MATCH_VEC_AND, FT_MATCH_VEC_XOR, FT_MATCH_VEC_OR,
+            FT_MATCH_VEC_LOAD(e + i), FT_MATCH_VEC_LOAD(e + n + i),
+            FT_MATCH_VEC_LOAD(q + i), FT_MATCH_VEC_LOAD(q + n + i));
+        if (FT_MATCH_VEC_ANY(d)) {
+            return 1;
+        }
+    }
+#endif
+
+    for (; i + 8 <= n; i += 8) {
+        if (FT_MATCH_SUBSET_DIFF(
+                FT_MATCH_AND, FT_MATCH_XOR, FT_MATCH_OR,
+                ft_match_word_load(e + i), ft_match_word_load(e + n + i),
+                ft_match_word_load(q + i), ft_match_word_load(q + n + i))) {
+            return 1;
+        }
+    }
+
+    for (; i < n; i++) {
+        if (FT_MATCH_SUBSET_DIFF(FT_MATCH_AND, FT_MATCH_XOR, FT_MATCH_OR,
+                                 e[i], e[n + i], q[i], q[n + i])) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Return nonzero if any value byte differs under both masks.  n is the
+ * length of each half.
+ */
+static int
+ft_match_overlap_diff(const uint8_t *e, const uint8_t *q, int n)
+{
+    int i = 0;
+
+#ifdef FT_MATCH_VEC_BYTES
+    for (; i + FT_MATCH_VEC_BYTES <= n; i += FT_MATCH_VEC_BYTES) {
+        ft_match_vec_t d = FT_MATCH_OVERLAP_DIFF(
+            FT_MATCH_VEC_AND, FT_MATCH_VEC_XOR,
+            FT_MATCH_VEC_LOAD(e + i), FT_MATCH_VEC_LOAD(e + n + i),
+            FT_MATCH_VEC_LOAD(q + i), FT_MATCH_VEC_LOAD(q + n + i));
+        if (FT_MATCH_VEC_ANY(d)) {
+            return 1;
+        }
+    }
+#endif
+
+    for (; i + 8 <= n; i += 8) {
+        if (FT_MATCH_OVERLAP_DIFF(
+                FT_MATCH_AND, FT_MATCH_XOR,
+                ft_match_word_load(e + i), ft_match_word_load(e + n + i),
+                ft_match_word_load(q + i), ft_match_word_load(q + n + i))) {
+            return 1;
+        }
+    }
+
+    for (; i < n; i++) {
+        if (FT_MATCH_OVERLAP_DIFF(FT_MATCH_AND, FT_MATCH_XOR,
+                                  e[i], e[n + i], q[i], q[n + i])) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int
+ft_match_bytes_nonzero(const uint8_t *buf, int size)
+{
+    int i;
+
+    for (i = 0; i < size; i++) {
+        if (buf[i] != 0) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void
+ft_match_pack(const of_match_t *src, ft_match_t *dst)
+{
+    const uint8_t *fields = (const uint8_t *)&src->fields;
+    const uint8_t *masks = (const uint8_t *)&src->masks;
+    uint8_t *values_out, *masks_out;
+    int idx, i, size, half = 0;
+
+    INDIGO_MEM_SET(dst, 0, offsetof(ft_match_t, data));
+    dst->version = src->version;
+
+    for (idx = 0; idx < FT_MATCH_FIELD_COUNT; idx++) {
+        size = ft_match_fields[idx].size;
+        if (ft_match_bytes_nonzero(masks + ft_match_fields[idx].offset, size)) {
+            dst->present[idx / 64] |= (uint64_t)1 << (idx % 64);
+            half += size;
+        }
+    }
+
+    values_out = dst->data;
+    masks_out = dst->data + half;
+
+    for (idx = 0; idx < FT_MATCH_FIELD_COUNT; idx++) {
+        const uint8_t *value = fields + ft_match_fields[idx].offset;
+        const uint8_t *mask = masks + ft_match_fields[idx].offset;
+
+        if (!FT_MATCH_PRESENT_TEST(dst, idx)) {
+            continue;
+        }
+
+        size = ft_match_fields[idx].size;
+        for (i = 0; i < size; i++) {
+            values_out[i] = value[i] & mask[i];
+        }
+        INDIGO_MEM_COPY(masks_out, mask, size);
+        values_out += size;
+        masks_out += size;
+    }
+
+    dst->bytes = 2 * half;
+}
+
+void
+ft_match_unpack(const ft_match_t *src, of_match_t *dst)
+{
+    uint8_t *fields = (uint8_t *)&dst->fields;
+    uint8_t *masks = (uint8_t *)&dst->masks;
+    const uint8_t *values_in = src->data;
+    const uint8_t *masks_in = src->data + src->bytes / 2;
+    int idx, size;
+
+    INDIGO_MEM_SET(dst, 0, sizeof(*dst));
+    dst->version = src->version;
+
+    for (idx = 0; idx < FT_MATCH_FIELD_COUNT; idx++) {
+        if (!FT_MATCH_PRESENT_TEST(src, idx)) {
+            continue;
+        }
+
+        size = ft_match_fields[idx].size;
+        INDIGO_MEM_COPY(fields + ft_match_fields[idx].offset, values_in, size);
+        INDIGO_MEM_COPY(masks + ft_match_fields[idx].offset, masks_in, size);
+        values_in += size;
+        masks_in += size;
+    }
+}
+
+int
+ft_match_eq(const ft_match_t *m1, const ft_match_t *m2)
+{
+    return m1->bytes == m2->bytes &&
+        memcmp(m1, m2, ft_match_size(m1)) == 0;
+}
+
+/*
+ * Lay out the query's value and mask for each field the entry matches at
+ * the offsets the entry uses, zero where the query does not match it, so
+ * the kernels can compare the two bytewise.
+ */
+static void
+ft_match_align(const ft_match_t *entry, const ft_match_t *query,
+               uint8_t *aligned)
+{
+    int e_half = entry->bytes / 2;
+    int q_half = query->bytes / 2;
+    int e_off = 0, q_off = 0;
+    int w, idx, size, in_e, in_q;
+    uint64_t bits;
+
+    INDIGO_MEM_SET(aligned, 0, entry->bytes);
+
+    for (w = 0; w < FT_MATCH_PRESENT_WORDS; w++) {
+        bits = entry->present[w] | query->present[w];
+        while (bits) {
+            idx = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+
+            size = ft_match_fields[idx].size;
+            in_e = FT_MATCH_PRESENT_TEST(entry, idx);
+            in_q = FT_MATCH_PRESENT_TEST(query, idx);
+
+            if (in_e && in_q) {
+                INDIGO_MEM_COPY(aligned + e_off,
+                                query->data + q_off, size);
+                INDIGO_MEM_COPY(aligned + e_half + e_off,
+                                query->data + q_half + q_off, size);
+            }
+
+            if (in_e) {
+                e_off += size;
+            }
+            if (in_q) {
+                q_off += size;
+            }
+        }
+    }
+}
+
+/*
+ * The entry must match every field the query does, each with at least
+ * the query's mask bits, and agree with the query's value under the
+ * query's mask.
+ */
+int
+ft_match_more_specific(const ft_match_t *entry, const ft_match_t *query)
+{
+    uint8_t aligned[FT_MATCH_MAX_DATA];
+    int i;
+
+    for (i = 0; i < FT_MATCH_PRESENT_WORDS; i++) {
+        if (query->present[i] & ~entry->present[i]) {
+            return 0;
+        }
+    }
+
+    ft_match_align(entry, query, aligned);
+    return !ft_match_subset_diff(entry->data, aligned, entry->bytes / 2);
+}
+
+/*
+ * Only fields matched by both can tell the two apart; they overlap unless
+ * one of those differs under both masks.
+ */
+int
+ft_match_overlap(const ft_match_t *m1, const ft_match_t *m2)
+{
+    uint8_t aligned[FT_MATCH_MAX_DATA];
+    uint64_t common = 0;
+    int i;
+
+    for (i = 0; i < FT_MATCH_PRESENT_WORDS; i++) {
+        common |= m1->present[i] & m2->present[i];
+    }
+
+    if (common == 0) {
+        return 1;
+    }
+
+    ft_match_align(m1, m2, aligned);
+    return !ft_match_overlap_diff(m1->data, aligned, m1->bytes / 2);
+}
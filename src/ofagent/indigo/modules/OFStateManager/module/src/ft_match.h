@@ -0,0 +1,101 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Compact match storage for flowtable entries
+ *
+ * An of_match_t carries a value and a mask for every field LOCI knows
+ * about, although a typical flow matches only a handful.  The compact
+ * form keeps a bitmap of the fields whose mask is nonzero followed by
+ * the value and mask bytes of just those fields, in of_match_fields_t
+ * order.  Values are stored masked, so two compact matches describe the
+ * same flow space exactly when their bytes are equal.
+ */
+
+#ifndef _OFSTATEMANAGER_FT_MATCH_H_
+#define _OFSTATEMANAGER_FT_MATCH_H_
+
+#include <stddef.h>
+#include <indigo/indigo.h>
+#include <loci/loci.h>
+
+/**
+ * Number of 64-bit words in the present-field bitmap
+ */
+#define FT_MATCH_PRESENT_WORDS 2
+
+/**
+ * Upper bound on the packed value and mask bytes of one match
+ */
+#define FT_MATCH_MAX_DATA (2 * sizeof(of_match_fields_t))
+
+/**
+ * Compact match
+ * @param present Bit N set if field N of of_match_fields_t is matched
+ * @param bytes Number of bytes used in data
+ * @param version OpenFlow version of the match
+ * @param data Values of the present fields in field order, then their masks
+ *
+ * Keeping the values and masks in two parallel halves lets matches with
+ * the same layout be compared a vector at a time.
+ * Flowtable entries allocate only ft_match_size() bytes, so data must
+ * not be accessed beyond bytes.  A full-size ft_match_t is used for
+ * queries.
+ */
+
+typedef struct ft_match_s {
+    uint64_t present[FT_MATCH_PRESENT_WORDS];
+    uint16_t bytes;
+    uint8_t version;
+    uint8_t data[FT_MATCH_MAX_DATA];
+} ft_match_t;
+
+/**
+ * Bytes in use by a compact match, header included
+ */
+#define ft_match_size(_m) (offsetof(ft_match_t, data) + (_m)->bytes)
+
+/**
+ * Build the compact form of a match
+ */
+void ft_match_pack(const of_match_t *src, ft_match_t *dst);
+
+/**
+ * Expand a compact match back into an of_match_t
+ */
+void ft_match_unpack(const ft_match_t *src, of_match_t *dst);
+
+/**
+ * Do two matches describe the same flow space?  As of_match_eq.
+ */
+int ft_match_eq(const ft_match_t *m1, const ft_match_t *m2);
+
+/**
+ * Is the entry match more specific than (or equal to) the query match?
+ * As of_match_more_specific.
+ */
+int ft_match_more_specific(const ft_match_t *entry, const ft_match_t *query);
+
+/**
+ * Do two matches overlap in flow space?  As of_match_overlap.
+ */
+int ft_match_overlap(const ft_match_t *m1, const ft_match_t *m2);
+
+#endif /* _OFSTATEMANAGER_FT_MATCH_H_ */
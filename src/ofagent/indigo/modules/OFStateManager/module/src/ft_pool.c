@@ -0,0 +1,199 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Fixed-size object pools for flowtable data
+ */
+
+#include <OFStateManager/ofstatemanager_config.h>
+#include <indigo/indigo.h>
+#include <indigo/mem_arena.h>
+
+#include "ofstatemanager_int.h"
+#include "ofstatemanager_log.h"
+#include "ft_pool.h"
+
+/* Slab header; objects follow, 8-byte aligned */
+struct ft_pool_slab_s {
+    ft_pool_slab_t *next;
+    uint64_t objects[];
+};
+
+static uint32_t
+ft_pool_slab_bytes(ft_pool_t *pool)
+{
+    return sizeof(ft_pool_slab_t) + pool->object_size * pool->objects_per_slab;
+}
+
+void
+ft_pool_init(ft_pool_t *pool, const char *name,
+             int object_size, int objects_per_slab)
+{
+    INDIGO_ASSERT(object_size > 0 && objects_per_slab > 0);
+
+    INDIGO_MEM_SET(pool, 0, sizeof(*pool));
+    pool->name = name;
+    /* Room for the free list link, 8-byte aligned */
+    if (object_size < sizeof(void *)) {
+        object_size = sizeof(void *);
+    }
+    pool->object_size = (object_size + 7) & ~7;
+    pool->objects_per_slab = objects_per_slab;
+}
+
+void
+ft_pool_slots_enable(ft_pool_t *pool, int slot_offset)
+{
+    INDIGO_ASSERT(pool->slab_count == 0);
+    INDIGO_ASSERT(slot_offset >= sizeof(void *) &&
+                  slot_offset + sizeof(uint32_t) <= pool->object_size);
+
+    pool->slot_offset = slot_offset;
+}
+
+void
+ft_pool_cleanup(ft_pool_t *pool)
+{
+    ft_pool_slab_t *slab, *next;
+
+    if (pool->in_use != 0) {
+        LOG_ERROR("Pool %s cleaned up with %d objects in use",
+                  pool->name, pool->in_use);
+    }
+
+    for (slab = pool->slabs; slab != NULL; slab = next) {
+        next = slab->next;
+        if (indigo_mem_arena_contains(slab)) {
+            indigo_mem_arena_free(slab, ft_pool_slab_bytes(pool));
+        } else {
+            aim_free(slab);
+        }
+    }
+
+    aim_free(pool->slab_objects);
+    pool->slab_objects = NULL;
+    pool->slab_objects_size = 0;
+
+    pool->slabs = NULL;
+    pool->slab_count = 0;
+    pool->free_list = NULL;
+    pool->in_use = 0;
+}
+
+static void
+ft_pool_grow(ft_pool_t *pool)
+{
+    ft_pool_slab_t *slab;
+    char *obj;
+    int idx;
+
+    /* Objects are zeroed as they are handed out */
+    slab = indigo_mem_arena_alloc(ft_pool_slab_bytes(pool));
+    if (slab == NULL) {
+        slab = aim_malloc(ft_pool_slab_bytes(pool));
+    }
+    AIM_TRUE_OR_DIE(slab != NULL);
+
+    if (pool->slot_offset != 0 &&
+        pool->slab_count == pool->slab_objects_size) {
+        int size = pool->slab_objects_size ? pool->slab_objects_size * 2 : 16;
+        pool->slab_objects = aim_realloc(pool->slab_objects,
+                                         size * sizeof(pool->slab_objects[0]));
+        AIM_TRUE_OR_DIE(pool->slab_objects != NULL);
+        pool->slab_objects_size = size;
+    }
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->slab_count++;
+
+    /* Thread the new objects onto the free list in address order */
+    obj = (char *)slab->objects + pool->object_size * pool->objects_per_slab;
+    for (idx = pool->objects_per_slab - 1; idx >= 0; idx--) {
+        obj -= pool->object_size;
+        *(void **)obj = pool->free_list;
+        pool->free_list = obj;
+        if (pool->slot_offset != 0) {
+            *(uint32_t *)(obj + pool->slot_offset) =
+                (pool->slab_count - 1) * pool->objects_per_slab + idx + 1;
+        }
+    }
+
+    if (pool->slot_offset != 0) {
+        pool->slab_objects[pool->slab_count - 1] = (char *)slab->objects;
+    }
+}
+
+void *
+ft_pool_alloc(ft_pool_t *pool)
+{
+    void *obj;
+    uint32_t slot;
+
+    if (pool->free_list == NULL) {
+        ft_pool_grow(pool);
+    }
+
+    obj = pool->free_list;
+    pool->free_list = *(void **)obj;
+    if (pool->slot_offset != 0) {
+        slot = *(uint32_t *)((char *)obj + pool->slot_offset);
+        INDIGO_MEM_SET(obj, 0, pool->object_size);
+        *(uint32_t *)((char *)obj + pool->slot_offset) = slot;
+    } else {
+        INDIGO_MEM_SET(obj, 0, pool->object_size);
+    }
+
+    pool->in_use++;
+
+    return obj;
+}
+
+void
+ft_pool_free(ft_pool_t *pool, void *obj)
+{
+    if (obj == NULL) {
+        return;
+    }
+
+    INDIGO_ASSERT(pool->in_use > 0);
+
+    *(void **)obj = pool->free_list;
+    pool->free_list = obj;
+    pool->in_use--;
+}
+
+uint64_t
+ft_pool_bytes(ft_pool_t *pool)
+{
+    return pool->slab_count * (uint64_t)ft_pool_slab_bytes(pool) +
+        pool->slab_objects_size * sizeof(pool->slab_objects[0]);
+}
+
+void
+ft_pool_show(ft_pool_t *pool, aim_pvs_t *pvs)
+{
+    int capacity = pool->slab_count * pool->objects_per_slab;
+
+    aim_printf(pvs, "  %-16s size %5d: %d/%d in use, %d slabs, %d KB\n",
+               pool->name, pool->object_size, pool->in_use, capacity,
+               pool->slab_count,
+               (int)((capacity * (uint64_t)pool->object_size) / 1024));
+}
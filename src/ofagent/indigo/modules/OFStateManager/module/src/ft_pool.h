@@ -0,0 +1,132 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Fixed-size object pools for flowtable data
+ *
+ * Objects are carved out of slabs and recycled through a free list, so
+ * flow churn does not hit malloc and the heap does not fragment.  Slabs
+ * come from the memory arena when there is one, and are kept until the
+ * pool is cleaned up.
+ *
+ * A pool may also number its objects with 32-bit slots, so an index can
+ * hold a slot in place of a pointer; see ft_pool_slots_enable.
+ */
+
+#ifndef _OFSTATEMANAGER_FT_POOL_H_
+#define _OFSTATEMANAGER_FT_POOL_H_
+
+#include <indigo/indigo.h>
+#include <AIM/aim_pvs.h>
+
+typedef struct ft_pool_slab_s ft_pool_slab_t;
+
+/**
+ * Object pool
+ * @param name Shown by ft_pool_show
+ * @param object_size Size of each object, rounded up to 8 bytes
+ * @param objects_per_slab Number of objects allocated at a time
+ * @param free_list Singly linked list of free objects
+ * @param slabs List of allocated slabs
+ * @param slab_count Number of allocated slabs
+ * @param in_use Number of objects handed out
+ * @param slot_offset Offset of the uint32_t slot in each object, or 0 if
+ *        the pool does not number its objects
+ * @param slab_objects First object of each slab, by slab number, while
+ *        objects are numbered
+ * @param slab_objects_size Allocated length of slab_objects
+ */
+
+typedef struct ft_pool_s {
+    const char *name;
+    int object_size;
+    int objects_per_slab;
+    void *free_list;
+    ft_pool_slab_t *slabs;
+    int slab_count;
+    int in_use;
+    int slot_offset;
+    char **slab_objects;
+    int slab_objects_size;
+} ft_pool_t;
+
+/**
+ * Initialize a pool
+ * @param pool The pool
+ * @param name Name used in ft_pool_show
+ * @param object_size Size of each object
+ * @param objects_per_slab Objects per slab
+ *
+ * No memory is allocated until the first ft_pool_alloc.
+ */
+void ft_pool_init(ft_pool_t *pool, const char *name,
+                  int object_size, int objects_per_slab);
+
+/**
+ * Number the objects of a pool
+ * @param pool The pool, before its first ft_pool_alloc
+ * @param slot_offset Offset of a uint32_t in the object that holds its
+ *        slot; past the free list link
+ *
+ * Slots start at 1, so 0 can mean none.  An object keeps its slot for
+ * the life of the pool; ft_pool_alloc zeroes everything else.
+ */
+void ft_pool_slots_enable(ft_pool_t *pool, int slot_offset);
+
+/**
+ * Object with a given slot
+ */
+static inline void *
+ft_pool_slot_object(ft_pool_t *pool, uint32_t slot)
+{
+    uint32_t idx = slot - 1;
+
+    return pool->slab_objects[idx / pool->objects_per_slab] +
+        (idx % pool->objects_per_slab) * pool->object_size;
+}
+
+/**
+ * Release all slabs of a pool
+ *
+ * All objects must have been returned with ft_pool_free.
+ */
+void ft_pool_cleanup(ft_pool_t *pool);
+
+/**
+ * Allocate a zeroed object from a pool
+ */
+void *ft_pool_alloc(ft_pool_t *pool);
+
+/**
+ * Return an object to its pool
+ */
+void ft_pool_free(ft_pool_t *pool, void *obj);
+
+/**
+ * Bytes allocated for a pool's slabs
+ */
+uint64_t ft_pool_bytes(ft_pool_t *pool);
+
+/**
+ * Print occupancy of a pool on one line
+ */
+void ft_pool_show(ft_pool_t *pool, aim_pvs_t *pvs);
+
+#endif /* _OFSTATEMANAGER_FT_POOL_H_ */
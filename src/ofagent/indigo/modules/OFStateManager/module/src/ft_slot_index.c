@@ -0,0 +1,169 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Open-addressed index of pool slots
+ */
+
+#include <OFStateManager/ofstatemanager_config.h>
+#include <indigo/indigo.h>
+
+#include "ofstatemanager_int.h"
+#include "ofstatemanager_log.h"
+#include "ft_slot_index.h"
+
+static void
+ft_slot_index_alloc(ft_slot_index_t *index, uint32_t size)
+{
+    index->cells = aim_zmalloc(size * sizeof(ft_slot_index_cell_t));
+    AIM_TRUE_OR_DIE(index->cells != NULL);
+    index->size = size;
+    index->count = 0;
+    index->tombstones = 0;
+}
+
+/* Store a cell in the first free or dead cell of its probe sequence */
+static void
+ft_slot_index_place(ft_slot_index_t *index, uint32_t hash, uint32_t slot)
+{
+    uint32_t pos = hash & (index->size - 1);
+    ft_slot_index_cell_t *cell;
+
+    for (;;) {
+        cell = &index->cells[pos];
+        if (cell->slot == FT_SLOT_INDEX_EMPTY) {
+            break;
+        }
+        if (cell->slot == FT_SLOT_INDEX_TOMBSTONE) {
+            index->tombstones--;
+            break;
+        }
+        pos = (pos + 1) & (index->size - 1);
+    }
+
+    cell->hash = hash;
+    cell->slot = slot;
+    index->count++;
+}
+
+void
+ft_slot_index_init(ft_slot_index_t *index, uint32_t count)
+{
+    uint32_t size = FT_SLOT_INDEX_MIN_SIZE;
+
+    while (size < count * 2 && size < 0x80000000) {
+        size *= 2;
+    }
+
+    ft_slot_index_alloc(index, size);
+}
+
+void
+ft_slot_index_cleanup(ft_slot_index_t *index)
+{
+    aim_free(index->cells);
+    INDIGO_MEM_SET(index, 0, sizeof(*index));
+}
+
+/* Rebuild the table without tombstones, doubling it if a quarter is live */
+static void
+ft_slot_index_rehash(ft_slot_index_t *index)
+{
+    ft_slot_index_cell_t *cells = index->cells;
+    uint32_t size = index->size;
+    uint32_t new_size = size;
+    uint32_t idx;
+
+    if ((index->count + 1) * 4 > size) {
+        new_size = size * 2;
+    }
+
+    ft_slot_index_alloc(index, new_size);
+
+    for (idx = 0; idx < size; idx++) {
+        if (cells[idx].slot != FT_SLOT_INDEX_EMPTY &&
+            cells[idx].slot != FT_SLOT_INDEX_TOMBSTONE) {
+            ft_slot_index_place(index, cells[idx].hash, cells[idx].slot);
+        }
+    }
+
+    aim_free(cells);
+}
+
+void
+ft_slot_index_insert(ft_slot_index_t *index, uint32_t hash, uint32_t slot)
+{
+    INDIGO_ASSERT(slot != FT_SLOT_INDEX_EMPTY &&
+                  slot != FT_SLOT_INDEX_TOMBSTONE);
+
+    if ((index->count + index->tombstones + 1) * 2 > index->size) {
+        ft_slot_index_rehash(index);
+    }
+
+    ft_slot_index_place(index, hash, slot);
+}
+
+void
+ft_slot_index_remove(ft_slot_index_t *index, uint32_t hash, uint32_t slot)
+{
+    uint32_t pos = hash & (index->size - 1);
+    ft_slot_index_cell_t *cell;
+
+    for (;;) {
+        cell = &index->cells[pos];
+        if (cell->slot == FT_SLOT_INDEX_EMPTY) {
+            INDIGO_ASSERT(!"slot not in index");
+            return;
+        }
+        if (cell->slot == slot) {
+            break;
+        }
+        pos = (pos + 1) & (index->size - 1);
+    }
+
+    /* A cell ending its probe run can be emptied outright */
+    if (index->cells[(pos + 1) & (index->size - 1)].slot ==
+        FT_SLOT_INDEX_EMPTY) {
+        cell->slot = FT_SLOT_INDEX_EMPTY;
+    } else {
+        cell->slot = FT_SLOT_INDEX_TOMBSTONE;
+        index->tombstones++;
+    }
+    index->count--;
+}
+
+uint32_t
+ft_slot_index_probe_max(ft_slot_index_t *index)
+{
+    uint32_t idx, probes, max = 0;
+
+    for (idx = 0; idx < index->size; idx++) {
+        if (index->cells[idx].slot == FT_SLOT_INDEX_EMPTY ||
+            index->cells[idx].slot == FT_SLOT_INDEX_TOMBSTONE) {
+            continue;
+        }
+        probes = ((idx - index->cells[idx].hash) & (index->size - 1)) + 1;
+        if (probes > max) {
+            max = probes;
+        }
+    }
+
+    return max;
+}
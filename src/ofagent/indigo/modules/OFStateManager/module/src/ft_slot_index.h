@@ -0,0 +1,137 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Open-addressed index of pool slots
+ *
+ * Maps a 32-bit hash to the pool slots of the objects with that hash,
+ * for indexes that only look objects up and never walk a chain in
+ * order.  Each cell holds the hash and the slot, 8 bytes in all, in
+ * place of the two list pointers an object would otherwise carry, and a
+ * probe compares cached hashes without touching the objects.
+ *
+ * Cells are probed linearly from the hash.  A removed object leaves a
+ * tombstone, and the cells are rehashed once live and dead cells fill
+ * half the table, doubling when the live ones alone fill a quarter.
+ * Rehashing moves cells, so a lookup must not insert or remove.
+ */
+
+#ifndef _OFSTATEMANAGER_FT_SLOT_INDEX_H_
+#define _OFSTATEMANAGER_FT_SLOT_INDEX_H_
+
+#include <indigo/indigo.h>
+
+/* Slot of a cell never used, and of a removed one */
+#define FT_SLOT_INDEX_EMPTY 0
+#define FT_SLOT_INDEX_TOMBSTONE 0xffffffff
+
+/* Smallest number of cells */
+#define FT_SLOT_INDEX_MIN_SIZE 16
+
+typedef struct ft_slot_index_cell_s {
+    uint32_t hash;
+    uint32_t slot;
+} ft_slot_index_cell_t;
+
+/**
+ * Slot index
+ * @param cells The table, size long
+ * @param size Number of cells, a power of 2
+ * @param count Cells holding a slot
+ * @param tombstones Cells left by removals
+ */
+
+typedef struct ft_slot_index_s {
+    ft_slot_index_cell_t *cells;
+    uint32_t size;
+    uint32_t count;
+    uint32_t tombstones;
+} ft_slot_index_t;
+
+/**
+ * Initialize a slot index
+ * @param count Number of slots to make room for
+ */
+void ft_slot_index_init(ft_slot_index_t *index, uint32_t count);
+
+/**
+ * Release a slot index
+ */
+void ft_slot_index_cleanup(ft_slot_index_t *index);
+
+/**
+ * Add a slot under a hash
+ */
+void ft_slot_index_insert(ft_slot_index_t *index, uint32_t hash, uint32_t slot);
+
+/**
+ * Remove a slot added under a hash
+ */
+void ft_slot_index_remove(ft_slot_index_t *index, uint32_t hash, uint32_t slot);
+
+/**
+ * Start a lookup
+ * @returns Probe position for ft_slot_index_next
+ */
+static inline uint32_t
+ft_slot_index_start(ft_slot_index_t *index, uint32_t hash)
+{
+    return hash & (index->size - 1);
+}
+
+/**
+ * Next slot added under a hash
+ * @param pos Probe position from ft_slot_index_start, advanced
+ * @returns The slot, or FT_SLOT_INDEX_EMPTY when there are no more
+ */
+static inline uint32_t
+ft_slot_index_next(ft_slot_index_t *index, uint32_t hash, uint32_t *pos)
+{
+    ft_slot_index_cell_t *cell;
+
+    for (;;) {
+        cell = &index->cells[*pos];
+        if (cell->slot == FT_SLOT_INDEX_EMPTY) {
+            return FT_SLOT_INDEX_EMPTY;
+        }
+        *pos = (*pos + 1) & (index->size - 1);
+        if (cell->hash == hash && cell->slot != FT_SLOT_INDEX_TOMBSTONE) {
+            return cell->slot;
+        }
+    }
+}
+
+/**
+ * Longest probe run to a slot in the index
+ *
+ * Walks every cell; intended for debugging and tests.
+ */
+uint32_t ft_slot_index_probe_max(ft_slot_index_t *index);
+
+/**
+ * Bytes allocated for a slot index
+ */
+static inline uint64_t
+ft_slot_index_bytes(ft_slot_index_t *index)
+{
+    return index->size * (uint64_t)sizeof(ft_slot_index_cell_t);
+}
+
+#endif /* _OFSTATEMANAGER_FT_SLOT_INDEX_H_ */
@@ -24,9 +24,24 @@
  * See detailed documentation in the Indigo architecture headers.
  *
  * TODO:
- *  - Reduce LOCI allocation overhead per entry.
  *  - Reuse stats entry during stats tasks.
- *  - Automatically resize key hashtable buckets.
+ *
+ * Each entry is a single block holding its key and value TLVs inline,
+ * carved from a size-classed pool shared by all gentables. LOCI views of
+ * the key and value are bound on the stack only when an op callback or a
+ * stats reply needs them.
+ *
+ * Resizing the key or checksum buckets does not move every entry at once.
+ * The old array is kept alongside the new one and a migration task moves
+ * one old bucket at a time, yielding to higher priority events in between.
+ * An old bucket stays authoritative for its entries until it has been
+ * moved, so lookups, inserts and the iterator consult it first.
+ *
+ * Tables with batch ops get new entries and deletions queued instead of
+ * handed over one message at a time. A queued entry is linked into the
+ * buckets right away and marked pending until the batch is flushed, which
+ * happens when the queue fills, from a task once the current burst of
+ * messages has been read, or before anything that could observe it.
  */
 
 #include "ofstatemanager_log.h"
@@ -37,10 +52,33 @@
 #include "ofstatemanager_decs.h"
 #include "ofstatemanager_int.h"
 #include "handlers.h"
+#include "ft_pool.h"
 #include <murmur/murmur.h>
 
 #define MAX_GENTABLES 16
 
+/*
+ * Size classes for pooled entries
+ *
+ * Class N holds entries of GENTABLE_ENTRY_MIN_SIZE << N bytes, including
+ * the inline key and value. Larger entries are allocated individually.
+ */
+#define GENTABLE_ENTRY_MIN_SIZE 128
+#define GENTABLE_ENTRY_CLASS_COUNT 4
+#define GENTABLE_ENTRY_POOL_SLAB_BYTES (64 * 1024)
+
+/* Grow the key buckets once the average chain exceeds this length */
+#define KEY_BUCKETS_LOAD_FACTOR 2
+#define KEY_BUCKETS_MAX_SIZE (1 << 20)
+
+/* Queued adds and deletes per table before the batch is flushed inline */
+#define GENTABLE_BATCH_SIZE 64
+
+/* Entry pending states */
+#define GENTABLE_ENTRY_PENDING_NONE 0
+#define GENTABLE_ENTRY_PENDING_ADD 1
+#define GENTABLE_ENTRY_PENDING_DEL 2
+
 struct ind_core_gentable_entry;
 
 typedef void (*ind_core_gentable_iter_task_callback_f)(
@@ -54,9 +92,23 @@ static void update_checksum(of_checksum_128_t *dst, const of_checksum_128_t *src
 static uint32_t hash_key(of_list_bsn_tlv_t *key);
 static list_head_t *find_key_bucket(indigo_core_gentable_t *gentable, uint32_t key_hash);
 static indigo_error_t delete_entry(indigo_core_gentable_t *gentable, struct ind_core_gentable_entry *entry);
+static void remove_entry(indigo_core_gentable_t *gentable, struct ind_core_gentable_entry *entry);
 static struct ind_core_gentable_entry *find_entry_by_key(indigo_core_gentable_t *gentable, of_list_bsn_tlv_t *key);
-static bool key_equality(of_list_bsn_tlv_t *a, of_list_bsn_tlv_t *b);
+static bool key_equality(struct ind_core_gentable_entry *entry, of_list_bsn_tlv_t *key);
+static struct ind_core_gentable_entry *alloc_entry(of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *value);
+static void free_entry(struct ind_core_gentable_entry *entry);
+static struct ind_core_gentable_entry *store_value(indigo_core_gentable_t *gentable, struct ind_core_gentable_entry *entry, of_list_bsn_tlv_t *value);
+static of_list_bsn_tlv_t *entry_key(struct ind_core_gentable_entry *entry, of_object_storage_t *storage);
+static of_list_bsn_tlv_t *entry_value(struct ind_core_gentable_entry *entry, of_object_storage_t *storage);
 static indigo_error_t ind_core_gentable_spawn_iter_task(indigo_core_gentable_t *gentable, ind_core_gentable_iter_task_callback_f callback, void *cookie, int priority, of_checksum_128_t checksum_prefix, of_checksum_128_t checksum_mask);
+static uint32_t checksum_bucket_index(uint64_t checksum_hi, uint8_t shift);
+static struct ind_core_gentable_checksum_bucket *alloc_checksum_buckets(uint32_t size);
+static void resize_key_buckets(indigo_core_gentable_t *gentable, uint32_t new_size);
+static void start_migration(indigo_core_gentable_t *gentable);
+static void finish_migration(indigo_core_gentable_t *gentable);
+static void send_bucket_stats_reply(indigo_core_gentable_t *gentable, of_object_t *obj, indigo_cxn_id_t cxn_id);
+static void queue_pending(indigo_core_gentable_t *gentable, struct ind_core_gentable_entry *entry, uint8_t pending, of_object_t *obj, indigo_cxn_id_t cxn_id);
+static void flush_pending(indigo_core_gentable_t *gentable);
 
 struct ind_core_gentable_checksum_bucket {
     of_checksum_128_t checksum;
@@ -77,6 +129,21 @@ struct indigo_core_gentable {
     uint8_t checksum_buckets_shift; /* see checksum_buckets_shift */
     of_checksum_128_t checksum;
     of_table_name_t name;
+
+    /* Buckets being migrated by the migration task, NULL when idle */
+    list_head_t *old_key_buckets;
+    struct ind_core_gentable_checksum_bucket *old_checksum_buckets;
+    uint32_t old_key_buckets_size;
+    uint32_t old_checksum_buckets_size;
+    uint32_t key_buckets_migrated; /* old key buckets already moved */
+    uint32_t checksum_buckets_migrated; /* old checksum buckets already moved */
+    uint8_t old_checksum_buckets_shift;
+    bool migration_task_running;
+    list_head_t pending_bucket_stats; /* requests waiting for the migration */
+
+    /* Adds and deletes waiting for add_batch/del_batch, in arrival order */
+    struct ind_core_gentable_pending_op *pending_ops;
+    int num_pending_ops;
 };
 
 struct ind_core_gentable_entry {
@@ -84,13 +151,40 @@ struct ind_core_gentable_entry {
     list_links_t checksum_links;
     uint32_t key_hash;
     void *priv;
-    of_list_bsn_tlv_t *key;
-    of_list_bsn_tlv_t *value;
     of_checksum_128_t checksum;
+    uint16_t key_length;
+    uint16_t value_length;
+    int8_t pool_class; /* -1 if allocated individually */
+    uint8_t pending; /* GENTABLE_ENTRY_PENDING_* */
+    uint8_t data[]; /* key TLVs followed by value TLVs */
+};
+
+struct ind_core_gentable_pending_bucket_stats {
+    list_links_t links;
+    indigo_cxn_id_t cxn_id;
+    of_object_t *request;
+};
+
+struct ind_core_gentable_pending_op {
+    struct ind_core_gentable_entry *entry;
+    indigo_cxn_id_t cxn_id;
+    of_object_t *request; /* tracked, so a barrier waits for the flush */
 };
 
 static indigo_core_gentable_t *gentables[MAX_GENTABLES];
 
+/* Entry storage shared by all gentables, set up by the first registration */
+static ft_pool_t entry_pools[GENTABLE_ENTRY_CLASS_COUNT];
+static int num_registered;
+static int oversize_entries;
+static uint64_t oversize_bytes;
+
+/* Scratch space for handing a queued run to the table */
+static indigo_core_gentable_batch_entry_t batch_entries[GENTABLE_BATCH_SIZE];
+static of_object_storage_t batch_key_storage[GENTABLE_BATCH_SIZE];
+static of_object_storage_t batch_value_storage[GENTABLE_BATCH_SIZE];
+static bool pending_flush_task_running = false;
+
 /*
  * Used to fix an ABA problem with iteration.
  */
@@ -114,6 +208,15 @@ indigo_core_gentable_register(
     AIM_TRUE_OR_DIE(ops->modify != NULL);
     AIM_TRUE_OR_DIE(ops->del != NULL);
     AIM_TRUE_OR_DIE(ops->get_stats != NULL);
+    AIM_TRUE_OR_DIE((ops->add_batch == NULL) == (ops->del_batch == NULL));
+
+    if (num_registered++ == 0) {
+        for (i = 0; i < GENTABLE_ENTRY_CLASS_COUNT; i++) {
+            int bytes = GENTABLE_ENTRY_MIN_SIZE << i;
+            ft_pool_init(&entry_pools[i], "gentable entries", bytes,
+                         GENTABLE_ENTRY_POOL_SLAB_BYTES / bytes);
+        }
+    }
 
     struct indigo_core_gentable *gentable = aim_zmalloc(sizeof(*gentable));
 
@@ -137,15 +240,14 @@ indigo_core_gentable_register(
         list_init(&gentable->key_buckets[i]);
     }
 
-    gentable->checksum_buckets = aim_malloc(sizeof(*gentable->checksum_buckets) *
-                                            gentable->checksum_buckets_size);
+    gentable->checksum_buckets =
+        alloc_checksum_buckets(gentable->checksum_buckets_size);
 
-    for (i = 0; i < gentable->checksum_buckets_size; i++) {
-        struct ind_core_gentable_checksum_bucket *bucket =
-            &gentable->checksum_buckets[i];
-        bucket->checksum.lo = 0;
-        bucket->checksum.hi = 0;
-        list_init(&bucket->entries);
+    list_init(&gentable->pending_bucket_stats);
+
+    if (ops->add_batch != NULL) {
+        gentable->pending_ops = aim_malloc(sizeof(*gentable->pending_ops) *
+                                           GENTABLE_BATCH_SIZE);
     }
 
     gentables[gentable->table_id] = gentable;
@@ -163,6 +265,14 @@ indigo_core_gentable_unregister(indigo_core_gentable_t *gentable)
 
     AIM_TRUE_OR_DIE(gentables[gentable->table_id] == gentable);
 
+    flush_pending(gentable);
+
+    /*
+     * Settle any resize so every entry is in the current key buckets. The
+     * migration task notices the generation change and exits on its own.
+     */
+    finish_migration(gentable);
+
     /* Delete all entries */
     for (i = 0; i < gentable->key_buckets_size; i++) {
         list_links_t *cur, *next;
@@ -180,7 +290,14 @@ indigo_core_gentable_unregister(indigo_core_gentable_t *gentable)
 
     aim_free(gentable->key_buckets);
     aim_free(gentable->checksum_buckets);
+    aim_free(gentable->pending_ops);
     aim_free(gentable);
+
+    if (--num_registered == 0) {
+        for (i = 0; i < GENTABLE_ENTRY_CLASS_COUNT; i++) {
+            ft_pool_cleanup(&entry_pools[i]);
+        }
+    }
 }
 
 
@@ -195,6 +312,7 @@ ind_core_bsn_gentable_entry_add_handler(
     indigo_core_gentable_t *gentable;
     of_list_bsn_tlv_t key, value;
     void *priv = NULL;
+    bool queued = false;
     indigo_error_t rv;
     struct ind_core_gentable_checksum_bucket *checksum_bucket;
     struct ind_core_gentable_entry *entry;
@@ -214,19 +332,27 @@ ind_core_bsn_gentable_entry_add_handler(
     }
 
     entry = find_entry_by_key(gentable, &key);
+    if (entry != NULL && entry->pending != GENTABLE_ENTRY_PENDING_NONE) {
+        /* Settle the queued op so this message applies on top of it */
+        flush_pending(gentable);
+        entry = find_entry_by_key(gentable, &key);
+    }
 
     if (entry == NULL) {
-        /* Adding a new entry */
-        rv = gentable->ops->add(gentable->priv, &key, &value, &priv);
-        if (rv != INDIGO_ERROR_NONE) {
-            AIM_LOG_ERROR("%s gentable add failed: %s",
-                          gentable->name, indigo_strerror(rv));
-            goto error;
+        /* Adding a new entry; a batching table sees it when the queue is flushed */
+        if (gentable->ops->add_batch != NULL) {
+            queued = true;
+        } else {
+            rv = gentable->ops->add(gentable->priv, &key, &value, &priv);
+            if (rv != INDIGO_ERROR_NONE) {
+                AIM_LOG_ERROR("%s gentable add failed: %s",
+                              gentable->name, indigo_strerror(rv));
+                goto error;
+            }
         }
 
-        /* Allocate new entry */
-        entry = aim_zmalloc(sizeof(*entry));
-        entry->key = of_object_dup(&key);
+        /* Allocate new entry, copying in the key and value */
+        entry = alloc_entry(&key, &value);
 
         entry->key_hash = hash_key(&key);
         entry->priv = priv;
@@ -235,6 +361,12 @@ ind_core_bsn_gentable_entry_add_handler(
         list_push(find_key_bucket(gentable, entry->key_hash), &entry->key_links);
 
         gentable->num_entries++;
+
+        if (gentable->old_key_buckets == NULL &&
+                gentable->key_buckets_size < KEY_BUCKETS_MAX_SIZE &&
+                gentable->num_entries > gentable->key_buckets_size * KEY_BUCKETS_LOAD_FACTOR) {
+            resize_key_buckets(gentable, gentable->key_buckets_size * 2);
+        }
     } else {
         /* Modifying an existing entry */
         rv = gentable->ops->modify(gentable->priv, entry->priv, &key, &value);
@@ -244,8 +376,6 @@ ind_core_bsn_gentable_entry_add_handler(
             goto error;
         }
 
-        of_object_delete(entry->value);
-
         /* Remove from old checksum bucket */
         checksum_bucket = find_checksum_bucket(gentable, &entry->checksum);
         list_remove(&entry->checksum_links);
@@ -253,10 +383,12 @@ ind_core_bsn_gentable_entry_add_handler(
 
         /* Remove from table checksum */
         update_checksum(&gentable->checksum, &entry->checksum);
+
+        /* May move the entry to a different size class */
+        entry = store_value(gentable, entry, &value);
     }
 
-    /* Update value and checksum */
-    entry->value = of_object_dup(&value);
+    /* Update checksum */
     of_bsn_gentable_entry_add_checksum_get(obj, &entry->checksum);
 
     /* Insert into checksum bucket */
@@ -267,6 +399,10 @@ ind_core_bsn_gentable_entry_add_handler(
     /* Add to table checksum */
     update_checksum(&gentable->checksum, &entry->checksum);
 
+    if (queued) {
+        queue_pending(gentable, entry, GENTABLE_ENTRY_PENDING_ADD, obj, cxn_id);
+    }
+
     return;
 
 error:
@@ -302,11 +438,21 @@ ind_core_bsn_gentable_entry_delete_handler(
     }
 
     entry = find_entry_by_key(gentable, &key);
+    if (entry != NULL && entry->pending != GENTABLE_ENTRY_PENDING_NONE) {
+        flush_pending(gentable);
+        entry = find_entry_by_key(gentable, &key);
+    }
+
     if (entry == NULL) {
         AIM_LOG_TRACE("Nonexistent %s gentable entry", gentable->name);
         return;
     }
 
+    if (gentable->ops->del_batch != NULL) {
+        queue_pending(gentable, entry, GENTABLE_ENTRY_PENDING_DEL, obj, cxn_id);
+        return;
+    }
+
     rv = delete_entry(gentable, entry);
     if (rv < 0) {
         AIM_LOG_ERROR("%s gentable delete failed: %s",
@@ -402,9 +548,6 @@ ind_core_bsn_gentable_set_buckets_size_handler(
     indigo_core_gentable_t *gentable;
     uint32_t xid;
     uint32_t new_buckets_size;
-    uint32_t old_buckets_size;
-    struct ind_core_gentable_checksum_bucket *old_buckets;
-    int i;
 
     of_bsn_gentable_set_buckets_size_xid_get(obj, &xid);
     of_bsn_gentable_set_buckets_size_table_id_get(obj, &table_id);
@@ -434,48 +577,30 @@ ind_core_bsn_gentable_set_buckets_size_handler(
         return;
     }
 
-    old_buckets_size = gentable->checksum_buckets_size;
-    old_buckets = gentable->checksum_buckets;
+    /* Only one resize is in flight at a time; settle the previous one */
+    if (gentable->old_checksum_buckets != NULL) {
+        finish_migration(gentable);
+    }
+
+    gentable->old_checksum_buckets = gentable->checksum_buckets;
+    gentable->old_checksum_buckets_size = gentable->checksum_buckets_size;
+    gentable->old_checksum_buckets_shift = gentable->checksum_buckets_shift;
+    gentable->checksum_buckets_migrated = 0;
 
     gentable->checksum_buckets_size = new_buckets_size;
-    gentable->checksum_buckets = aim_malloc(sizeof(*gentable->checksum_buckets) *
-                                            gentable->checksum_buckets_size);
-
+    gentable->checksum_buckets = alloc_checksum_buckets(new_buckets_size);
     gentable->checksum_buckets_shift =
         calc_checksum_buckets_shift(gentable->checksum_buckets_size);
 
-    for (i = 0; i < gentable->checksum_buckets_size; i++) {
-        struct ind_core_gentable_checksum_bucket *bucket =
-            &gentable->checksum_buckets[i];
-        bucket->checksum.lo = 0;
-        bucket->checksum.hi = 0;
-        list_init(&bucket->entries);
-    }
-
-    for (i = 0; i < old_buckets_size; i++) {
-        list_links_t *cur, *next;
-        LIST_FOREACH_SAFE(&old_buckets[i].entries, cur, next) {
-            struct ind_core_gentable_entry *entry =
-                container_of(cur, checksum_links, struct ind_core_gentable_entry);
-
-            /* Remove from old bucket */
-            list_remove(&entry->checksum_links);
-
-            /* Insert into new bucket */
-            struct ind_core_gentable_checksum_bucket *new_bucket;
-            new_bucket = find_checksum_bucket(gentable, &entry->checksum);
-            list_push(&new_bucket->entries, &entry->checksum_links);
-            update_checksum(&new_bucket->checksum, &entry->checksum);
-        }
-    }
-
-    aim_free(old_buckets);
+    start_migration(gentable);
 }
 
 struct ind_core_gentable_entry_stats_state {
     indigo_cxn_id_t cxn_id;
     of_object_t *request;
     of_object_t *reply;
+    of_list_bsn_gentable_entry_stats_entry_t entries;  /* Of reply */
+    of_list_builder_t builder;                         /* Of entries */
 };
 
 static void
@@ -485,18 +610,19 @@ entry_stats_iter(void *cookie, indigo_core_gentable_t *gentable,
     struct ind_core_gentable_entry_stats_state *state = cookie;
 
     if (entry != NULL) {
-        of_list_bsn_gentable_entry_stats_entry_t stats_entries;
         of_bsn_gentable_entry_stats_entry_t *stats_entry;
         of_list_bsn_tlv_t stats;
+        of_object_storage_t key_storage;
+        of_list_bsn_tlv_t *key = entry_key(entry, &key_storage);
 
         stats_entry = of_bsn_gentable_entry_stats_entry_new(OF_VERSION_1_3);
-        AIM_TRUE_OR_DIE(of_bsn_gentable_entry_stats_entry_key_set(stats_entry, entry->key) == 0);
+        AIM_TRUE_OR_DIE(of_bsn_gentable_entry_stats_entry_key_set(stats_entry, key) == 0);
         of_bsn_gentable_entry_stats_entry_stats_bind(stats_entry, &stats);
 
-        gentable->ops->get_stats(gentable->priv, entry->priv, entry->key, &stats);
+        gentable->ops->get_stats(gentable->priv, entry->priv, key, &stats);
 
-        of_bsn_gentable_entry_stats_reply_entries_bind(state->reply, &stats_entries);
-        if (of_list_append(&stats_entries, stats_entry) < 0) {
+        if (of_list_append(&state->entries, stats_entry) < 0) {
+            of_list_builder_finish(&state->builder);
             of_bsn_gentable_entry_stats_reply_flags_set(state->reply,
                                                         OF_STATS_REPLY_FLAG_REPLY_MORE);
             indigo_cxn_send_controller_message(state->cxn_id, state->reply);
@@ -507,14 +633,16 @@ entry_stats_iter(void *cookie, indigo_core_gentable_t *gentable,
             of_bsn_gentable_entry_stats_request_xid_get(state->request, &xid);
             of_bsn_gentable_entry_stats_reply_xid_set(state->reply, xid);
 
-            of_bsn_gentable_entry_stats_reply_entries_bind(state->reply, &stats_entries);
-            if (of_list_append(&stats_entries, stats_entry) < 0) {
+            of_bsn_gentable_entry_stats_reply_entries_bind(state->reply, &state->entries);
+            of_list_builder_start(&state->builder, &state->entries);
+            if (of_list_append(&state->entries, stats_entry) < 0) {
                 AIM_DIE("unexpected failure appending to an empty stats list");
             }
         }
 
         of_object_delete(stats_entry);
     } else {
+        of_list_builder_finish(&state->builder);
         indigo_cxn_send_controller_message(state->cxn_id, state->reply);
         of_object_delete(state->request);
         aim_free(state);
@@ -556,6 +684,8 @@ ind_core_bsn_gentable_entry_stats_request_handler(
     state->cxn_id = cxn_id;
     state->request = ind_core_dup_tracking(obj, cxn_id);
     state->reply = reply;
+    of_bsn_gentable_entry_stats_reply_entries_bind(reply, &state->entries);
+    of_list_builder_start(&state->builder, &state->entries);
 
     rv = ind_core_gentable_spawn_iter_task(gentable, entry_stats_iter, state,
                                            IND_SOC_DEFAULT_PRIORITY,
@@ -572,6 +702,8 @@ struct ind_core_gentable_entry_desc_stats_state {
     indigo_cxn_id_t cxn_id;
     of_object_t *request;
     of_object_t *reply;
+    of_list_bsn_gentable_entry_desc_stats_entry_t entries;  /* Of reply */
+    of_list_builder_t builder;                              /* Of entries */
 };
 
 static void
@@ -581,16 +713,18 @@ entry_desc_stats_iter(void *cookie, indigo_core_gentable_t *gentable,
     struct ind_core_gentable_entry_desc_stats_state *state = cookie;
 
     if (entry != NULL) {
-        of_list_bsn_gentable_entry_desc_stats_entry_t stats_entries;
         of_bsn_gentable_entry_desc_stats_entry_t *stats_entry;
+        of_object_storage_t key_storage, value_storage;
 
         stats_entry = of_bsn_gentable_entry_desc_stats_entry_new(OF_VERSION_1_3);
         of_bsn_gentable_entry_desc_stats_entry_checksum_set(stats_entry, entry->checksum);
-        AIM_TRUE_OR_DIE(of_bsn_gentable_entry_desc_stats_entry_key_set(stats_entry, entry->key) == 0);
-        AIM_TRUE_OR_DIE(of_bsn_gentable_entry_desc_stats_entry_value_set(stats_entry, entry->value) == 0);
+        AIM_TRUE_OR_DIE(of_bsn_gentable_entry_desc_stats_entry_key_set(
+            stats_entry, entry_key(entry, &key_storage)) == 0);
+        AIM_TRUE_OR_DIE(of_bsn_gentable_entry_desc_stats_entry_value_set(
+            stats_entry, entry_value(entry, &value_storage)) == 0);
 
-        of_bsn_gentable_entry_desc_stats_reply_entries_bind(state->reply, &stats_entries);
-        if (of_list_append(&stats_entries, stats_entry) < 0) {
+        if (of_list_append(&state->entries, stats_entry) < 0) {
+            of_list_builder_finish(&state->builder);
             of_bsn_gentable_entry_desc_stats_reply_flags_set(state->reply,
                                                              OF_STATS_REPLY_FLAG_REPLY_MORE);
             indigo_cxn_send_controller_message(state->cxn_id, state->reply);
@@ -601,14 +735,16 @@ entry_desc_stats_iter(void *cookie, indigo_core_gentable_t *gentable,
             of_bsn_gentable_entry_desc_stats_request_xid_get(state->request, &xid);
             of_bsn_gentable_entry_desc_stats_reply_xid_set(state->reply, xid);
 
-            of_bsn_gentable_entry_desc_stats_reply_entries_bind(state->reply, &stats_entries);
-            if (of_list_append(&stats_entries, stats_entry) < 0) {
+            of_bsn_gentable_entry_desc_stats_reply_entries_bind(state->reply, &state->entries);
+            of_list_builder_start(&state->builder, &state->entries);
+            if (of_list_append(&state->entries, stats_entry) < 0) {
                 AIM_DIE("unexpected failure appending to an empty stats list");
             }
         }
 
         of_object_delete(stats_entry);
     } else {
+        of_list_builder_finish(&state->builder);
         indigo_cxn_send_controller_message(state->cxn_id, state->reply);
         of_object_delete(state->request);
         aim_free(state);
@@ -650,6 +786,8 @@ ind_core_bsn_gentable_entry_desc_stats_request_handler(
     state->cxn_id = cxn_id;
     state->request = ind_core_dup_tracking(obj, cxn_id);
     state->reply = reply;
+    of_bsn_gentable_entry_desc_stats_reply_entries_bind(reply, &state->entries);
+    of_list_builder_start(&state->builder, &state->entries);
 
     rv = ind_core_gentable_spawn_iter_task(gentable, entry_desc_stats_iter, state,
                                            IND_SOC_DEFAULT_PRIORITY,
@@ -748,19 +886,10 @@ ind_core_bsn_gentable_bucket_stats_request_handler(
     indigo_cxn_id_t cxn_id)
 {
     indigo_core_gentable_t *gentable;
-    uint32_t xid;
     uint16_t table_id;
-    of_bsn_gentable_bucket_stats_reply_t *reply;
-    int i;
-    of_list_bsn_gentable_bucket_stats_entry_t stats_entries;
 
-    of_bsn_gentable_bucket_stats_request_xid_get(obj, &xid);
     of_bsn_gentable_bucket_stats_request_table_id_get(obj, &table_id);
 
-    reply = of_bsn_gentable_bucket_stats_reply_new(obj->version);
-    of_bsn_gentable_bucket_stats_reply_xid_set(reply, xid);
-    of_bsn_gentable_bucket_stats_reply_entries_bind(reply, &stats_entries);
-
     gentable = find_gentable_by_id(table_id);
     if (gentable == NULL) {
         AIM_LOG_ERROR("Nonexistent gentable id %d", table_id);
@@ -768,10 +897,44 @@ ind_core_bsn_gentable_bucket_stats_request_handler(
             cxn_id, obj,
             OF_ERROR_TYPE_BAD_REQUEST,
             OF_REQUEST_FAILED_BAD_TABLE_ID);
-        of_object_delete(reply);
         return;
     }
 
+    if (gentable->old_checksum_buckets != NULL) {
+        /*
+         * A new bucket's checksum is incomplete until every old bucket
+         * feeding it has been moved. Answer once the migration finishes.
+         */
+        struct ind_core_gentable_pending_bucket_stats *pending =
+            aim_zmalloc(sizeof(*pending));
+        pending->cxn_id = cxn_id;
+        pending->request = ind_core_dup_tracking(obj, cxn_id);
+        list_push(&gentable->pending_bucket_stats, &pending->links);
+        return;
+    }
+
+    send_bucket_stats_reply(gentable, obj, cxn_id);
+}
+
+static void
+send_bucket_stats_reply(
+    indigo_core_gentable_t *gentable,
+    of_object_t *obj,
+    indigo_cxn_id_t cxn_id)
+{
+    uint32_t xid;
+    of_bsn_gentable_bucket_stats_reply_t *reply;
+    int i;
+    of_list_bsn_gentable_bucket_stats_entry_t stats_entries;
+    of_list_builder_t builder;
+
+    of_bsn_gentable_bucket_stats_request_xid_get(obj, &xid);
+
+    reply = of_bsn_gentable_bucket_stats_reply_new(obj->version);
+    of_bsn_gentable_bucket_stats_reply_xid_set(reply, xid);
+    of_bsn_gentable_bucket_stats_reply_entries_bind(reply, &stats_entries);
+    of_list_builder_start(&builder, &stats_entries);
+
     for (i = 0; i < gentable->checksum_buckets_size; i++) {
         struct ind_core_gentable_checksum_bucket *bucket =
             &gentable->checksum_buckets[i];
@@ -779,12 +942,14 @@ ind_core_bsn_gentable_bucket_stats_request_handler(
         of_bsn_gentable_bucket_stats_entry_t stats_entry;
         of_bsn_gentable_bucket_stats_entry_init(&stats_entry, reply->version, -1, 1);
         if (of_list_bsn_gentable_bucket_stats_entry_append_bind(&stats_entries, &stats_entry)) {
+            of_list_builder_finish(&builder);
             of_bsn_gentable_bucket_stats_reply_flags_set(reply, OF_STATS_REPLY_FLAG_REPLY_MORE);
             indigo_cxn_send_controller_message(cxn_id, reply);
 
             reply = of_bsn_gentable_bucket_stats_reply_new(obj->version);
             of_bsn_gentable_bucket_stats_reply_xid_set(reply, xid);
             of_bsn_gentable_bucket_stats_reply_entries_bind(reply, &stats_entries);
+            of_list_builder_start(&builder, &stats_entries);
 
             if (of_list_bsn_gentable_bucket_stats_entry_append_bind(&stats_entries, &stats_entry)) {
                 AIM_DIE("unexpected failure appending to an empty bucket stats list");
@@ -793,11 +958,79 @@ ind_core_bsn_gentable_bucket_stats_request_handler(
 
         of_bsn_gentable_bucket_stats_entry_checksum_set(&stats_entry, bucket->checksum);
     }
+    of_list_builder_finish(&builder);
 
     indigo_cxn_send_controller_message(cxn_id, reply);
 }
 
 
+/**
+ * Heap bytes held by all gentables
+ * @param num_entries Output; total entries
+ *
+ * Includes the entry pools, which hold the keys and values, but not the
+ * tables' private data.
+ */
+uint64_t
+ind_core_gentable_memory(int *num_entries)
+{
+    uint64_t bytes = 0;
+    int i;
+
+    *num_entries = 0;
+
+    for (i = 0; i < MAX_GENTABLES; i++) {
+        indigo_core_gentable_t *gentable = gentables[i];
+        if (gentable == NULL) {
+            continue;
+        }
+
+        bytes += sizeof(*gentable) +
+            sizeof(*gentable->key_buckets) * gentable->key_buckets_size +
+            sizeof(*gentable->checksum_buckets) *
+                gentable->checksum_buckets_size;
+
+        if (gentable->old_key_buckets != NULL) {
+            bytes += sizeof(*gentable->old_key_buckets) *
+                gentable->old_key_buckets_size;
+        }
+
+        if (gentable->old_checksum_buckets != NULL) {
+            bytes += sizeof(*gentable->old_checksum_buckets) *
+                gentable->old_checksum_buckets_size;
+        }
+
+        *num_entries += gentable->num_entries;
+    }
+
+    if (num_registered > 0) {
+        for (i = 0; i < GENTABLE_ENTRY_CLASS_COUNT; i++) {
+            bytes += ft_pool_bytes(&entry_pools[i]);
+        }
+    }
+
+    return bytes + oversize_bytes;
+}
+
+/**
+ * Print occupancy of the gentable entry pools
+ */
+void
+ind_core_gentable_pools_show(aim_pvs_t *pvs)
+{
+    int i;
+
+    if (num_registered > 0) {
+        for (i = 0; i < GENTABLE_ENTRY_CLASS_COUNT; i++) {
+            ft_pool_show(&entry_pools[i], pvs);
+        }
+    }
+
+    aim_printf(pvs, "  %-16s %d entries, %llu bytes\n", "oversize",
+               oversize_entries, (unsigned long long)oversize_bytes);
+}
+
+
 /* Utility functions */
 
 static __attribute__((unused)) indigo_core_gentable_t *
@@ -847,13 +1080,52 @@ calc_checksum_buckets_shift(uint32_t checksum_buckets_size)
     return 64 - i + 1;
 }
 
+/*
+ * A single bucket has a shift of 64, which is too far to shift a uint64_t.
+ */
+static uint32_t
+checksum_bucket_index(uint64_t checksum_hi, uint8_t shift)
+{
+    return shift >= 64 ? 0 : checksum_hi >> shift;
+}
+
+/*
+ * While the checksum buckets are being resized an entry lives in its old
+ * bucket until the migration task has moved that bucket.
+ */
 static struct ind_core_gentable_checksum_bucket *
 find_checksum_bucket(indigo_core_gentable_t *gentable, of_checksum_128_t *checksum)
 {
-    uint32_t idx = checksum->hi >> gentable->checksum_buckets_shift;
+    uint32_t idx;
+
+    if (gentable->old_checksum_buckets != NULL) {
+        idx = checksum_bucket_index(checksum->hi, gentable->old_checksum_buckets_shift);
+        if (idx >= gentable->checksum_buckets_migrated) {
+            return &gentable->old_checksum_buckets[idx];
+        }
+    }
+
+    idx = checksum_bucket_index(checksum->hi, gentable->checksum_buckets_shift);
     return &gentable->checksum_buckets[idx];
 }
 
+static struct ind_core_gentable_checksum_bucket *
+alloc_checksum_buckets(uint32_t size)
+{
+    struct ind_core_gentable_checksum_bucket *buckets;
+    int i;
+
+    buckets = aim_malloc(sizeof(*buckets) * size);
+
+    for (i = 0; i < size; i++) {
+        buckets[i].checksum.lo = 0;
+        buckets[i].checksum.hi = 0;
+        list_init(&buckets[i].entries);
+    }
+
+    return buckets;
+}
+
 static void
 update_checksum(of_checksum_128_t *dst, const of_checksum_128_t *src)
 {
@@ -867,9 +1139,17 @@ hash_key(of_list_bsn_tlv_t *key)
     return murmur_hash(OF_OBJECT_BUFFER_INDEX(key, 0), key->length, 0);
 }
 
+/* Same rule as find_checksum_bucket for a key bucket resize */
 static list_head_t *
 find_key_bucket(indigo_core_gentable_t *gentable, uint32_t key_hash)
 {
+    if (gentable->old_key_buckets != NULL) {
+        uint32_t idx = key_hash & (gentable->old_key_buckets_size - 1);
+        if (idx >= gentable->key_buckets_migrated) {
+            return &gentable->old_key_buckets[idx];
+        }
+    }
+
     return &gentable->key_buckets[key_hash & (gentable->key_buckets_size - 1)];
 }
 
@@ -877,13 +1157,27 @@ static indigo_error_t
 delete_entry(indigo_core_gentable_t *gentable, struct ind_core_gentable_entry *entry)
 {
     indigo_error_t rv;
-    struct ind_core_gentable_checksum_bucket *checksum_bucket;
+    of_object_storage_t key_storage;
 
-    rv = gentable->ops->del(gentable->priv, entry->priv, entry->key);
+    rv = gentable->ops->del(gentable->priv, entry->priv,
+                            entry_key(entry, &key_storage));
     if (rv < 0) {
         return rv;
     }
 
+    remove_entry(gentable, entry);
+
+    return INDIGO_ERROR_NONE;
+}
+
+/*
+ * Unlink and free an entry the table no longer holds
+ */
+static void
+remove_entry(indigo_core_gentable_t *gentable, struct ind_core_gentable_entry *entry)
+{
+    struct ind_core_gentable_checksum_bucket *checksum_bucket;
+
     list_remove(&entry->key_links);
     list_remove(&entry->checksum_links);
 
@@ -892,13 +1186,9 @@ delete_entry(indigo_core_gentable_t *gentable, struct ind_core_gentable_entry *e
     update_checksum(&checksum_bucket->checksum, &entry->checksum);
     update_checksum(&gentable->checksum, &entry->checksum);
 
-    of_object_delete(entry->key);
-    of_object_delete(entry->value);
-    aim_free(entry);
+    free_entry(entry);
 
     gentable->num_entries--;
-
-    return INDIGO_ERROR_NONE;
 }
 
 static struct ind_core_gentable_entry *
@@ -912,7 +1202,7 @@ find_entry_by_key(indigo_core_gentable_t *gentable, of_list_bsn_tlv_t *key)
     LIST_FOREACH_SAFE(bucket, cur, next) {
         struct ind_core_gentable_entry *entry =
             container_of(cur, key_links, struct ind_core_gentable_entry);
-        if (entry->key_hash == hash && key_equality(key, entry->key)) {
+        if (entry->key_hash == hash && key_equality(entry, key)) {
             return entry;
         }
     }
@@ -921,14 +1211,460 @@ find_entry_by_key(indigo_core_gentable_t *gentable, of_list_bsn_tlv_t *key)
 }
 
 static bool
-key_equality(of_list_bsn_tlv_t *a, of_list_bsn_tlv_t *b)
+key_equality(struct ind_core_gentable_entry *entry, of_list_bsn_tlv_t *key)
 {
-    if (a->length != b->length) {
+    if (entry->key_length != key->length) {
         return false;
     }
 
-    return memcmp(OF_OBJECT_BUFFER_INDEX(a, 0),
-                  OF_OBJECT_BUFFER_INDEX(b, 0), a->length) == 0;
+    return memcmp(entry->data, OF_OBJECT_BUFFER_INDEX(key, 0),
+                  key->length) == 0;
+}
+
+static int
+entry_class(int bytes)
+{
+    int cls;
+
+    for (cls = 0; cls < GENTABLE_ENTRY_CLASS_COUNT; cls++) {
+        if (bytes <= (GENTABLE_ENTRY_MIN_SIZE << cls)) {
+            return cls;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * Allocate an entry with room for the key and value and copy them in
+ *
+ * Only the data fields are filled in; the caller links the entry.
+ */
+static struct ind_core_gentable_entry *
+alloc_entry(of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *value)
+{
+    struct ind_core_gentable_entry *entry;
+    int bytes = sizeof(*entry) + key->length + value->length;
+    int cls = entry_class(bytes);
+
+    if (cls >= 0) {
+        entry = ft_pool_alloc(&entry_pools[cls]);
+    } else {
+        entry = aim_zmalloc(bytes);
+        oversize_entries++;
+        oversize_bytes += bytes;
+    }
+
+    entry->pool_class = cls;
+    entry->pending = GENTABLE_ENTRY_PENDING_NONE;
+    entry->key_length = key->length;
+    entry->value_length = value->length;
+    INDIGO_MEM_COPY(entry->data, OF_OBJECT_BUFFER_INDEX(key, 0), key->length);
+    INDIGO_MEM_COPY(entry->data + key->length,
+                    OF_OBJECT_BUFFER_INDEX(value, 0), value->length);
+
+    return entry;
+}
+
+static void
+free_entry(struct ind_core_gentable_entry *entry)
+{
+    if (entry->pool_class >= 0) {
+        ft_pool_free(&entry_pools[entry->pool_class], entry);
+    } else {
+        oversize_entries--;
+        oversize_bytes -= sizeof(*entry) + entry->key_length + entry->value_length;
+        aim_free(entry);
+    }
+}
+
+/*
+ * Replace the value of an entry that is not in a checksum bucket
+ *
+ * If the new value needs a different size class the entry is moved to a
+ * new block and relinked into its key bucket. Returns the entry to use
+ * from now on.
+ */
+static struct ind_core_gentable_entry *
+store_value(indigo_core_gentable_t *gentable,
+            struct ind_core_gentable_entry *entry,
+            of_list_bsn_tlv_t *value)
+{
+    struct ind_core_gentable_entry *new_entry;
+    of_object_storage_t key_storage;
+    int cls = entry_class(sizeof(*entry) + entry->key_length + value->length);
+
+    if (cls >= 0 && cls == entry->pool_class) {
+        entry->value_length = value->length;
+        INDIGO_MEM_COPY(entry->data + entry->key_length,
+                        OF_OBJECT_BUFFER_INDEX(value, 0), value->length);
+        return entry;
+    }
+
+    new_entry = alloc_entry(entry_key(entry, &key_storage), value);
+    new_entry->key_hash = entry->key_hash;
+    new_entry->priv = entry->priv;
+    new_entry->checksum = entry->checksum;
+
+    list_remove(&entry->key_links);
+    list_push(find_key_bucket(gentable, new_entry->key_hash), &new_entry->key_links);
+
+    free_entry(entry);
+
+    return new_entry;
+}
+
+/*
+ * Bind a LOCI view over TLVs stored in an entry
+ *
+ * The view lives in the caller's storage and is only valid until the
+ * entry is modified or freed.
+ */
+static of_list_bsn_tlv_t *
+bind_tlvs(of_object_storage_t *storage, uint8_t *buf, int bytes)
+{
+    INDIGO_MEM_SET(storage, 0, sizeof(*storage));
+    storage->wbuf.buf = buf;
+    storage->wbuf.alloc_bytes = bytes;
+    storage->wbuf.current_bytes = bytes;
+    storage->obj.wire_object.wbuf = &storage->wbuf;
+    of_list_bsn_tlv_init(&storage->obj, OF_VERSION_1_3, bytes, 0);
+
+    return &storage->obj;
+}
+
+static of_list_bsn_tlv_t *
+entry_key(struct ind_core_gentable_entry *entry, of_object_storage_t *storage)
+{
+    return bind_tlvs(storage, entry->data, entry->key_length);
+}
+
+static of_list_bsn_tlv_t *
+entry_value(struct ind_core_gentable_entry *entry, of_object_storage_t *storage)
+{
+    return bind_tlvs(storage, entry->data + entry->key_length,
+                     entry->value_length);
+}
+
+
+/*
+ * Bucket migration task
+ *
+ * Rehashing a large gentable in one go would stall the event loop. Instead
+ * the resize installs the new array, keeps the old one, and this task moves
+ * the old buckets across in index order. The key buckets are done first,
+ * then the checksum buckets.
+ */
+
+struct ind_core_gentable_migration_task_state {
+    uint16_t table_id;
+    uint64_t generation_id;
+};
+
+static void
+resize_key_buckets(indigo_core_gentable_t *gentable, uint32_t new_size)
+{
+    int i;
+
+    AIM_LOG_VERBOSE("Resizing %s gentable key buckets from %u to %u",
+                    gentable->name, gentable->key_buckets_size, new_size);
+
+    gentable->old_key_buckets = gentable->key_buckets;
+    gentable->old_key_buckets_size = gentable->key_buckets_size;
+    gentable->key_buckets_migrated = 0;
+
+    gentable->key_buckets_size = new_size;
+    gentable->key_buckets = aim_malloc(sizeof(*gentable->key_buckets) * new_size);
+
+    for (i = 0; i < new_size; i++) {
+        list_init(&gentable->key_buckets[i]);
+    }
+
+    start_migration(gentable);
+}
+
+/*
+ * Move the entries of the next old bucket into the new buckets
+ *
+ * Returns false when there was nothing left to move.
+ */
+static bool
+migrate_bucket(indigo_core_gentable_t *gentable)
+{
+    list_links_t *cur, *next;
+
+    if (gentable->old_key_buckets != NULL) {
+        list_head_t *old_bucket =
+            &gentable->old_key_buckets[gentable->key_buckets_migrated++];
+
+        LIST_FOREACH_SAFE(old_bucket, cur, next) {
+            struct ind_core_gentable_entry *entry =
+                container_of(cur, key_links, struct ind_core_gentable_entry);
+            list_remove(&entry->key_links);
+            list_push(find_key_bucket(gentable, entry->key_hash), &entry->key_links);
+        }
+
+        if (gentable->key_buckets_migrated == gentable->old_key_buckets_size) {
+            aim_free(gentable->old_key_buckets);
+            gentable->old_key_buckets = NULL;
+        }
+
+        return true;
+    }
+
+    if (gentable->old_checksum_buckets != NULL) {
+        struct ind_core_gentable_checksum_bucket *old_bucket =
+            &gentable->old_checksum_buckets[gentable->checksum_buckets_migrated++];
+
+        /* The old bucket's checksum is discarded along with the array */
+        LIST_FOREACH_SAFE(&old_bucket->entries, cur, next) {
+            struct ind_core_gentable_entry *entry =
+                container_of(cur, checksum_links, struct ind_core_gentable_entry);
+            struct ind_core_gentable_checksum_bucket *new_bucket =
+                find_checksum_bucket(gentable, &entry->checksum);
+            list_remove(&entry->checksum_links);
+            list_push(&new_bucket->entries, &entry->checksum_links);
+            update_checksum(&new_bucket->checksum, &entry->checksum);
+        }
+
+        if (gentable->checksum_buckets_migrated == gentable->old_checksum_buckets_size) {
+            aim_free(gentable->old_checksum_buckets);
+            gentable->old_checksum_buckets = NULL;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * Answer the bucket stats requests that arrived during a checksum bucket
+ * resize
+ */
+static void
+send_pending_bucket_stats(indigo_core_gentable_t *gentable)
+{
+    list_links_t *cur, *next;
+
+    LIST_FOREACH_SAFE(&gentable->pending_bucket_stats, cur, next) {
+        struct ind_core_gentable_pending_bucket_stats *pending =
+            container_of(cur, links, struct ind_core_gentable_pending_bucket_stats);
+        list_remove(&pending->links);
+        send_bucket_stats_reply(gentable, pending->request, pending->cxn_id);
+        of_object_delete(pending->request);
+        aim_free(pending);
+    }
+}
+
+/*
+ * Move everything that is left without yielding
+ *
+ * Used when the caller needs the resize settled right away: a second resize,
+ * unregistering the table, or a failure to register the task.
+ */
+static void
+finish_migration(indigo_core_gentable_t *gentable)
+{
+    while (migrate_bucket(gentable)) {
+        /* keep going */
+    }
+
+    send_pending_bucket_stats(gentable);
+}
+
+static ind_soc_task_status_t
+ind_core_gentable_migration_task_callback(void *cookie)
+{
+    struct ind_core_gentable_migration_task_state *state = cookie;
+    indigo_core_gentable_t *gentable = find_gentable_by_id(state->table_id);
+
+    if (gentable == NULL || gentable->generation_id != state->generation_id) {
+        /* Unregistered; it settled the migration before freeing the table */
+        aim_free(state);
+        return IND_SOC_TASK_FINISHED;
+    }
+
+    /* Move at least one bucket per invocation so the resize always progresses */
+    do {
+        if (!migrate_bucket(gentable)) {
+            send_pending_bucket_stats(gentable);
+            gentable->migration_task_running = false;
+            aim_free(state);
+            return IND_SOC_TASK_FINISHED;
+        }
+    } while (!ind_soc_should_yield());
+
+    return IND_SOC_TASK_CONTINUE;
+}
+
+static void
+start_migration(indigo_core_gentable_t *gentable)
+{
+    indigo_error_t rv;
+
+    if (gentable->migration_task_running) {
+        /* The running task picks up the new work */
+        return;
+    }
+
+    struct ind_core_gentable_migration_task_state *state = aim_zmalloc(sizeof(*state));
+    state->table_id = gentable->table_id;
+    state->generation_id = gentable->generation_id;
+
+    rv = ind_soc_task_register(ind_core_gentable_migration_task_callback, state,
+                               IND_SOC_DEFAULT_PRIORITY);
+    if (rv != INDIGO_ERROR_NONE) {
+        AIM_LOG_WARN("Failed to spawn %s gentable migration task, resizing inline: %s",
+                     gentable->name, indigo_strerror(rv));
+        aim_free(state);
+        finish_migration(gentable);
+        return;
+    }
+
+    gentable->migration_task_running = true;
+}
+
+
+/*
+ * Batched adds and deletes
+ *
+ * The queue holds entries in arrival order. Flushing hands each run of
+ * consecutive adds or deletes to the table in one call, so the table sees
+ * them in the same order the controller sent them.
+ */
+
+static ind_soc_task_status_t
+pending_flush_task(void *cookie)
+{
+    pending_flush_task_running = false;
+    ind_core_gentable_pending_flush();
+    return IND_SOC_TASK_FINISHED;
+}
+
+static void
+queue_pending(indigo_core_gentable_t *gentable,
+              struct ind_core_gentable_entry *entry, uint8_t pending,
+              of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+    struct ind_core_gentable_pending_op *op =
+        &gentable->pending_ops[gentable->num_pending_ops++];
+
+    entry->pending = pending;
+    op->entry = entry;
+    op->cxn_id = cxn_id;
+    op->request = ind_core_dup_tracking(obj, cxn_id);
+
+    if (gentable->num_pending_ops == GENTABLE_BATCH_SIZE) {
+        flush_pending(gentable);
+        return;
+    }
+
+    if (!pending_flush_task_running) {
+        if (ind_soc_task_register(pending_flush_task, NULL,
+                                  IND_SOC_DEFAULT_PRIORITY) < 0) {
+            AIM_LOG_ERROR("Failed to start gentable flush task; flushing now");
+            flush_pending(gentable);
+            return;
+        }
+        pending_flush_task_running = true;
+    }
+}
+
+static void
+complete_pending(indigo_core_gentable_t *gentable,
+                 struct ind_core_gentable_pending_op *op,
+                 indigo_core_gentable_batch_entry_t *batch_entry)
+{
+    struct ind_core_gentable_entry *entry = op->entry;
+    bool add = entry->pending == GENTABLE_ENTRY_PENDING_ADD;
+
+    entry->pending = GENTABLE_ENTRY_PENDING_NONE;
+
+    if (batch_entry->status == INDIGO_ERROR_NONE) {
+        if (add) {
+            entry->priv = batch_entry->entry_priv;
+        } else {
+            remove_entry(gentable, entry);
+        }
+    } else {
+        AIM_LOG_ERROR("%s gentable %s failed: %s", gentable->name,
+                      add ? "add" : "delete", indigo_strerror(batch_entry->status));
+        if (add) {
+            /* The table never held it */
+            remove_entry(gentable, entry);
+        }
+        indigo_cxn_send_error_reply(
+            op->cxn_id, op->request,
+            OF_ERROR_TYPE_BAD_REQUEST,
+            OF_REQUEST_FAILED_EPERM);
+    }
+
+    of_object_delete(op->request);
+}
+
+static void
+flush_pending(indigo_core_gentable_t *gentable)
+{
+    int start = 0;
+
+    while (start < gentable->num_pending_ops) {
+        uint8_t pending = gentable->pending_ops[start].entry->pending;
+        indigo_error_t rv;
+        int count, i;
+
+        for (count = 0; start + count < gentable->num_pending_ops; count++) {
+            struct ind_core_gentable_entry *entry =
+                gentable->pending_ops[start + count].entry;
+            indigo_core_gentable_batch_entry_t *batch_entry = &batch_entries[count];
+
+            if (entry->pending != pending) {
+                break;
+            }
+
+            batch_entry->key = entry_key(entry, &batch_key_storage[count]);
+            batch_entry->value = pending == GENTABLE_ENTRY_PENDING_ADD ?
+                entry_value(entry, &batch_value_storage[count]) : NULL;
+            batch_entry->entry_priv = entry->priv;
+            batch_entry->status = INDIGO_ERROR_NONE;
+        }
+
+        if (pending == GENTABLE_ENTRY_PENDING_ADD) {
+            rv = gentable->ops->add_batch(gentable->priv, batch_entries, count);
+        } else {
+            rv = gentable->ops->del_batch(gentable->priv, batch_entries, count);
+        }
+
+        for (i = 0; i < count; i++) {
+            if (rv < 0) {
+                batch_entries[i].status = rv;
+            }
+            complete_pending(gentable, &gentable->pending_ops[start + i],
+                             &batch_entries[i]);
+        }
+
+        start += count;
+    }
+
+    gentable->num_pending_ops = 0;
+}
+
+/*
+ * Hand every queued add and delete to its table
+ *
+ * Called before handling any message that could observe the queued
+ * entries.
+ */
+void
+ind_core_gentable_pending_flush(void)
+{
+    int i;
+
+    for (i = 0; i < MAX_GENTABLES; i++) {
+        if (gentables[i] != NULL) {
+            flush_pending(gentables[i]);
+        }
+    }
 }
 
 
@@ -966,20 +1702,42 @@ ind_core_gentable_iter_task_callback(void *cookie)
         return IND_SOC_TASK_FINISHED;
     }
 
+    /* Queued entries have no table state to report or delete yet */
+    flush_pending(gentable);
+
     /*
      * This code needs to handle resizing of the checksum buckets array between
-     * task invocations.
+     * task invocations, and iterating while a resize is being migrated.
      *
      * Between invocations, the next_checksum field is the lowest possible
      * checksum we haven't iterated over. Normally this is the lowest possible
      * checksum in the next bucket. If the buckets were shrunk then this may be
      * somewhere in the middle of the checksum range of a bucket, in which case
      * we'll ignore the entries we've already seen.
+     *
+     * During a migration next_checksum falls in either an old bucket that
+     * hasn't moved yet, which holds every entry in its range, or in a new
+     * bucket. A new bucket only holds entries from old buckets that have
+     * moved, so we stop short of the first unmoved old bucket and pick it up
+     * on the next pass.
      */
 
+    /* Highest checksum (upper half) covered by the prefix and mask */
+    const uint64_t last_checksum_hi =
+        (state->checksum_prefix.hi & state->checksum_mask.hi) | ~state->checksum_mask.hi;
+
     do {
         struct ind_core_gentable_checksum_bucket *bucket =
             find_checksum_bucket(gentable, &state->next_checksum);
+        uint8_t shift = gentable->checksum_buckets_shift;
+        bool old_bucket = false;
+
+        if (gentable->old_checksum_buckets != NULL &&
+                checksum_bucket_index(state->next_checksum.hi, gentable->old_checksum_buckets_shift) >=
+                    gentable->checksum_buckets_migrated) {
+            shift = gentable->old_checksum_buckets_shift;
+            old_bucket = true;
+        }
 
         list_links_t *cur, *next;
         LIST_FOREACH_SAFE(&bucket->entries, cur, next) {
@@ -1002,30 +1760,27 @@ ind_core_gentable_iter_task_callback(void *cookie)
             state->callback(state->cookie, gentable, entry);
         }
 
-        const uint64_t bucket_interval = (uint64_t)1 << gentable->checksum_buckets_shift;
-        const uint64_t bucket_mask = ~(uint64_t)0 << gentable->checksum_buckets_shift;
-
-        /* Advance to next bucket */
-        state->next_checksum.hi += bucket_interval;
+        /* Highest checksum (upper half) in the range we just covered */
+        uint64_t bucket_last_hi = shift >= 64 ? ~(uint64_t)0 :
+            state->next_checksum.hi | (((uint64_t)1 << shift) - 1);
 
-        /* Reset to the lowest checksum in the bucket */
-        state->next_checksum.hi &= bucket_mask;
-
-        /*
-         * Calculate the end of our bucket range.
-         *
-         * Basically, add the length of the checksum range to the start of the
-         * range and then mask to the beginning of a bucket.
-         */
-        uint64_t end_checksum_hi =
-            (state->checksum_prefix.hi + (~state->checksum_mask.hi + 1)) & bucket_mask;
+        if (!old_bucket && gentable->old_checksum_buckets != NULL) {
+            uint64_t unmoved_hi = (uint64_t)gentable->checksum_buckets_migrated <<
+                gentable->old_checksum_buckets_shift;
+            if (bucket_last_hi >= unmoved_hi) {
+                bucket_last_hi = unmoved_hi - 1;
+            }
+        }
 
-        if (state->next_checksum.hi == end_checksum_hi) {
+        if (bucket_last_hi >= last_checksum_hi) {
             /* Finished */
             state->callback(state->cookie, gentable, NULL);
             aim_free(state);
             return IND_SOC_TASK_FINISHED;
         }
+
+        /* Advance to the lowest checksum in the next bucket */
+        state->next_checksum.hi = bucket_last_hi + 1;
     } while (!ind_soc_should_yield());
 
     return IND_SOC_TASK_CONTINUE;
@@ -35,23 +35,46 @@
 #include "ofstatemanager_decs.h"
 #include "ofstatemanager_int.h"
 #include "handlers.h"
+#include "snapshot.h"
+#include "reply_cache.h"
 #include <BigHash/bighash.h>
 
-typedef struct ind_core_group_s {
+/*
+ * A group action in one of a group's buckets.  Hashed by the referenced
+ * group so the groups chained to it are found without a table walk.
+ */
+typedef struct ind_core_group_ref_s {
     bighash_entry_t hash_entry;
+    uint32_t ref_id;            /* Referenced group */
+    uint32_t group_id;          /* Group whose bucket references it */
+} ind_core_group_ref_t;
+
+typedef struct ind_core_group_s {
     uint32_t id;
     uint32_t type;
     of_list_bucket_t *buckets;
+    of_group_desc_stats_entry_t *desc; /* Reply entry, built on first use */
     indigo_time_t creation_time;
+    ind_core_group_ref_t *refs; /* One per distinct referenced group */
+    int num_refs;
 } ind_core_group_t;
 
 #define TEMPLATE_NAME group_hashtable
 #define TEMPLATE_OBJ_TYPE ind_core_group_t
 #define TEMPLATE_KEY_FIELD id
+#include <BigHash/bighash_intkey_template.h>
+
+#define TEMPLATE_NAME group_ref_hashtable
+#define TEMPLATE_OBJ_TYPE ind_core_group_ref_t
+#define TEMPLATE_KEY_FIELD ref_id
 #define TEMPLATE_ENTRY_FIELD hash_entry
 #include <BigHash/bighash_template.h>
 
-static bighash_table_t *ind_core_group_hashtable;
+/* Bounds chain-aware deletes; OF-DPA chains are only a few groups deep */
+#define IND_CORE_GROUP_CHAIN_MAX 8
+
+static bighash_intkey_table_t *ind_core_group_hashtable;
+static bighash_table_t *ind_core_group_ref_hashtable;
 
 static ind_core_group_t *
 ind_core_group_lookup(uint32_t id)
@@ -59,16 +82,119 @@ ind_core_group_lookup(uint32_t id)
     return group_hashtable_first(ind_core_group_hashtable, &id);
 }
 
+static void
+ind_core_group_ref_add(ind_core_group_t *group, uint32_t ref_id, int *alloc)
+{
+    int idx;
+
+    for (idx = 0; idx < group->num_refs; idx++) {
+        if (group->refs[idx].ref_id == ref_id) {
+            return;
+        }
+    }
+
+    if (group->num_refs == *alloc) {
+        *alloc = *alloc ? *alloc * 2 : 4;
+        group->refs = aim_realloc(group->refs, *alloc * sizeof(*group->refs));
+        AIM_TRUE_OR_DIE(group->refs != NULL);
+    }
+
+    group->refs[group->num_refs].ref_id = ref_id;
+    group->refs[group->num_refs].group_id = group->id;
+    group->num_refs++;
+}
+
+/* Index the groups referenced from group->buckets */
+static void
+ind_core_group_refs_link(ind_core_group_t *group)
+{
+    of_bucket_t bucket;
+    of_list_action_t actions;
+    of_action_t act;
+    uint32_t ref_id;
+    int alloc = 0;
+    int bucket_rv, action_rv;
+    int idx;
+
+    group->refs = NULL;
+    group->num_refs = 0;
+
+    OF_LIST_BUCKET_ITER(group->buckets, &bucket, bucket_rv) {
+        of_bucket_actions_bind(&bucket, &actions);
+        OF_LIST_ACTION_ITER(&actions, &act, action_rv) {
+            if (act.header.object_id == OF_ACTION_GROUP) {
+                of_action_group_group_id_get(&act.group, &ref_id);
+                ind_core_group_ref_add(group, ref_id, &alloc);
+            }
+        }
+    }
+
+    /* Insert once the array has stopped moving */
+    for (idx = 0; idx < group->num_refs; idx++) {
+        group_ref_hashtable_insert(ind_core_group_ref_hashtable,
+                                   &group->refs[idx]);
+    }
+}
+
+static void
+ind_core_group_refs_unlink(ind_core_group_t *group)
+{
+    int idx;
+
+    for (idx = 0; idx < group->num_refs; idx++) {
+        bighash_remove(ind_core_group_ref_hashtable, &group->refs[idx].hash_entry);
+    }
+
+    aim_free(group->refs);
+    group->refs = NULL;
+    group->num_refs = 0;
+}
+
+/* Number of groups with a bucket forwarding to the given group */
+static int
+ind_core_group_referrer_count(uint32_t id)
+{
+    ind_core_group_ref_t *ref;
+    int count = 0;
+
+    for (ref = group_ref_hashtable_first(ind_core_group_ref_hashtable, &id);
+            ref; ref = group_ref_hashtable_next(ref)) {
+        count++;
+    }
+
+    return count;
+}
+
+static void
+ind_core_group_flow_delete(void *cookie, ft_entry_t *entry)
+{
+    ind_core_flow_entry_delete(entry, INDIGO_FLOW_REMOVED_GROUP_DELETE);
+}
+
+/* Drop a group from the table once forwarding no longer has it */
+static void
+ind_core_group_free(ind_core_group_t *group)
+{
+    ind_core_snapshot_group_erase(group->id);
+    ind_core_group_refs_unlink(group);
+    of_object_delete(group->buckets);
+    of_object_delete(group->desc);
+    group_hashtable_remove(ind_core_group_hashtable, group);
+    aim_free(group);
+}
+
 #ifdef OFDPA_FIXUP
 static indigo_error_t
 ind_core_group_delete_one(ind_core_group_t *group)
 {
     indigo_error_t result;
+
+    /* Flows forwarding to a deleted group are removed with it */
+    ft_group_ref_foreach(ind_core_ft, group->id, ind_core_group_flow_delete, NULL);
+
     result = indigo_fwd_group_delete(group->id);
     if (result >= 0) {
-      of_object_delete(group->buckets);
-      bighash_remove(ind_core_group_hashtable, &group->hash_entry);
-      aim_free(group);
+      ind_core_group_free(group);
     }
     return result;
 }
@@ -76,13 +202,65 @@ ind_core_group_delete_one(ind_core_group_t *group)
 static void
 ind_core_group_delete_one(ind_core_group_t *group)
 {
+    /* Flows forwarding to a deleted group are removed with it */
+    ft_group_ref_foreach(ind_core_ft, group->id, ind_core_group_flow_delete, NULL);
+
     indigo_fwd_group_delete(group->id);
-    of_object_delete(group->buckets);
-    bighash_remove(ind_core_group_hashtable, &group->hash_entry);
-    aim_free(group);
+    ind_core_group_free(group);
+}
+#endif
+
+#ifdef OFDPA_FIXUP
+/*
+ * Delete a group after the groups chained to it, so OF-DPA never sees a
+ * group deleted while a bucket still points at it.
+ */
+static indigo_error_t
+ind_core_group_delete_chain(ind_core_group_t *group, int depth)
+{
+    ind_core_group_ref_t *ref;
+    ind_core_group_t *referrer;
+    indigo_error_t result;
+
+    if (depth > IND_CORE_GROUP_CHAIN_MAX) {
+        AIM_LOG_ERROR("Group 0x%x chained deeper than %d", group->id,
+                      IND_CORE_GROUP_CHAIN_MAX);
+        return INDIGO_ERROR_PARAM;
+    }
+
+    while ((ref = group_ref_hashtable_first(ind_core_group_ref_hashtable,
+                                            &group->id)) != NULL) {
+        referrer = ind_core_group_lookup(ref->group_id);
+        AIM_ASSERT(referrer != NULL);
+        result = ind_core_group_delete_chain(referrer, depth + 1);
+        if (result < 0) {
+            return result;
+        }
+    }
+
+    return ind_core_group_delete_one(group);
 }
 #endif
 
+static void
+ind_core_group_insert(uint32_t id, uint8_t type, of_list_bucket_t *buckets)
+{
+    ind_core_group_t *group;
+
+    group = aim_malloc(sizeof(*group));
+    group->id = id;
+    group->type = type;
+    group->buckets = of_object_dup(buckets);
+    AIM_TRUE_OR_DIE(group->buckets != NULL);
+    group->desc = NULL;
+    group->creation_time = INDIGO_CURRENT_TIME;
+    ind_core_group_refs_link(group);
+
+    group_hashtable_insert(ind_core_group_hashtable, group);
+
+    ind_core_snapshot_group_write(id, type, group->buckets);
+}
+
 void
 ind_core_group_add_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
 {
@@ -96,6 +274,8 @@ ind_core_group_add_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     uint16_t err_code = OF_GROUP_MOD_FAILED_EPERM;
     indigo_error_t result;
 
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_GROUP_STATS);
+
     of_group_add_xid_get(obj, &xid);
     of_group_add_group_type_get(obj, &type);
     of_group_add_group_id_get(obj, &id);
@@ -119,14 +299,7 @@ ind_core_group_add_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
         goto error;
     }
 
-    group = aim_malloc(sizeof(*group));
-    group->id = id;
-    group->type = type;
-    group->buckets = of_object_dup(&buckets);
-    AIM_TRUE_OR_DIE(group->buckets != NULL);
-    group->creation_time = INDIGO_CURRENT_TIME;
-
-    group_hashtable_insert(ind_core_group_hashtable, group);
+    ind_core_group_insert(id, type, &buckets);
 
     return;
 
@@ -134,6 +307,73 @@ error:
     indigo_cxn_send_error_reply(cxn_id, obj, err_type, err_code);
 }
 
+/**
+ * Adopt a group that forwarding has already installed
+ *
+ * See indigo/of_state_manager.h.
+ */
+indigo_error_t
+indigo_core_group_restore(of_group_add_t *group_add)
+{
+    uint8_t type;
+    uint32_t id;
+    of_list_bucket_t buckets;
+
+    of_group_add_group_type_get(group_add, &type);
+    of_group_add_group_id_get(group_add, &id);
+    of_group_add_buckets_bind(group_add, &buckets);
+
+    if (id > OF_GROUP_MAX) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (ind_core_group_lookup(id) != NULL) {
+        return INDIGO_ERROR_EXISTS;
+    }
+
+    ind_core_group_insert(id, type, &buckets);
+
+    AIM_LOG_TRACE("Restored group 0x%x", id);
+
+    return INDIGO_ERROR_NONE;
+}
+
+/**
+ * Install a group that belongs to the switch
+ *
+ * See indigo/of_state_manager.h.
+ */
+indigo_error_t
+indigo_core_group_preload(of_group_add_t *group_add)
+{
+    uint8_t type;
+    uint32_t id;
+    of_list_bucket_t buckets;
+    indigo_error_t rv;
+
+    of_group_add_group_type_get(group_add, &type);
+    of_group_add_group_id_get(group_add, &id);
+    of_group_add_buckets_bind(group_add, &buckets);
+
+    if (id > OF_GROUP_MAX) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (ind_core_group_lookup(id) != NULL) {
+        return INDIGO_ERROR_EXISTS;
+    }
+
+    if ((rv = indigo_fwd_group_add(id, type, &buckets)) < 0) {
+        return rv;
+    }
+
+    ind_core_group_insert(id, type, &buckets);
+
+    AIM_LOG_TRACE("Preloaded group 0x%x", id);
+
+    return INDIGO_ERROR_NONE;
+}
+
 void
 ind_core_group_modify_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
 {
@@ -147,6 +387,8 @@ ind_core_group_modify_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     uint16_t err_code = OF_GROUP_MOD_FAILED_EPERM;
     indigo_error_t result;
 
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_GROUP_STATS);
+
     of_group_modify_xid_get(obj, &xid);
     of_group_modify_group_type_get(obj, &type);
     of_group_modify_group_id_get(obj, &id);
@@ -162,13 +404,15 @@ ind_core_group_modify_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     }
 
     if (group->type == type) {
-        result = indigo_fwd_group_modify(id, &buckets);
 #ifdef OFDPA_FIXUP
+        result = indigo_fwd_group_modify(id, group->buckets, &buckets);
         if (result < 0) {
             err_code = OF_GROUP_MOD_FAILED_INVALID_GROUP;
             ind_core_group_delete_one(group);
             goto error;
         }
+#else
+        result = indigo_fwd_group_modify(id, &buckets);
 #endif
     } else {
 #ifdef OFDPA_FIXUP
@@ -189,9 +433,15 @@ ind_core_group_modify_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     }
 
     group->type = type;
+    ind_core_group_refs_unlink(group);
     of_object_delete(group->buckets);
     group->buckets = of_object_dup(&buckets);
     AIM_TRUE_OR_DIE(group->buckets != NULL);
+    of_object_delete(group->desc);
+    group->desc = NULL;
+    ind_core_group_refs_link(group);
+
+    ind_core_snapshot_group_write(id, type, group->buckets);
 
     return;
 
@@ -212,6 +462,8 @@ ind_core_group_delete_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     indigo_error_t result;
 #endif /* OFDPA_FIXUP */
 
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_GROUP_STATS);
+
     of_group_delete_xid_get(obj, &xid);
     of_group_delete_group_id_get(obj, &id);
 
@@ -220,21 +472,29 @@ ind_core_group_delete_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     }
 
     if (id == OF_GROUP_ALL) {
-        bighash_iter_t iter;
-        for (group = bighash_iter_start(ind_core_group_hashtable, &iter);
-                group; group = bighash_iter_next(&iter)) {
+        bighash_intkey_iter_t iter;
 #ifdef OFDPA_FIXUP
-            result = ind_core_group_delete_one(group);
+        /* A chained delete can remove any group; removes never move the rest */
+        for (group = bighash_intkey_iter_start(ind_core_group_hashtable, &iter);
+                group; group = bighash_intkey_iter_next(&iter)) {
+            result = ind_core_group_delete_chain(group, 0);
             if (result < 0) {
                 err_code = OF_GROUP_MOD_FAILED_INVALID_GROUP;
                 goto error;
             }
-#else				
-            ind_core_group_delete_one(group)
-#endif /* OFDPA_FIXUP */
         }
+#else
+        for (group = bighash_intkey_iter_start(ind_core_group_hashtable, &iter);
+                group; group = bighash_intkey_iter_next(&iter)) {
+            ind_core_group_delete_one(group);
+        }
+#endif /* OFDPA_FIXUP */
     } else if (group != NULL) {
 #ifdef OFDPA_FIXUP
+            if (ind_core_group_referrer_count(id) > 0) {
+                err_code = OF_GROUP_MOD_FAILED_CHAINED_GROUP;
+                goto error;
+            }
             result = ind_core_group_delete_one(group);
             if (result < 0) {
                 err_code = OF_GROUP_MOD_FAILED_INVALID_GROUP;
@@ -268,6 +528,11 @@ ind_core_group_stats_entry_populate(of_group_stats_entry_t *entry,
     of_group_stats_entry_duration_nsec_set(entry, duration_nsec);
 
     indigo_fwd_group_stats_get(group->id, entry);
+
+    /* Flows and groups forwarding to this group, from the reverse indices */
+    of_group_stats_entry_ref_count_set(entry,
+        ft_group_ref_foreach(ind_core_ft, group->id, NULL, NULL) +
+        ind_core_group_referrer_count(group->id));
 }
 
 /* TODO segment long replies */
@@ -283,6 +548,10 @@ ind_core_group_stats_request_handler(of_object_t *_obj,
     uint32_t id;
     indigo_time_t current_time = INDIGO_CURRENT_TIME;
 
+    if (ind_core_reply_cache_send(IND_CORE_REPLY_CACHE_GROUP_STATS, obj, cxn_id)) {
+        return;
+    }
+
     of_group_stats_request_group_id_get(obj, &id);
 
     reply = of_group_stats_reply_new(obj->version);
@@ -296,10 +565,10 @@ ind_core_group_stats_request_handler(of_object_t *_obj,
     AIM_TRUE_OR_DIE(entry != NULL);
 
     if (id == OF_GROUP_ALL) {
-        bighash_iter_t iter;
+        bighash_intkey_iter_t iter;
         ind_core_group_t *group;
-        for (group = bighash_iter_start(ind_core_group_hashtable, &iter);
-                group; group = bighash_iter_next(&iter)) {
+        for (group = bighash_intkey_iter_start(ind_core_group_hashtable, &iter);
+                group; group = bighash_intkey_iter_next(&iter)) {
             ind_core_group_stats_entry_populate(entry, group, current_time);
 
             if (of_list_append(&entries, entry) < 0) {
@@ -324,9 +593,39 @@ ind_core_group_stats_request_handler(of_object_t *_obj,
 
     of_object_delete(entry);
 
+    ind_core_reply_cache_store(IND_CORE_REPLY_CACHE_GROUP_STATS, obj, reply);
     indigo_cxn_send_controller_message(cxn_id, reply);
 }
 
+/*
+ * The group's desc entry as serialized for the given version
+ *
+ * Kept from the last desc request until the buckets change, so repeated
+ * requests append stored bytes instead of re-encoding every group. The
+ * entry is built in the caller's scratch object, which has a full size
+ * buffer, and kept as a copy trimmed to its length.
+ */
+static of_group_desc_stats_entry_t *
+ind_core_group_desc_get(ind_core_group_t *group,
+                        of_group_desc_stats_entry_t *scratch)
+{
+    if (group->desc != NULL && group->desc->version == scratch->version) {
+        return group->desc;
+    }
+
+    of_group_desc_stats_entry_group_type_set(scratch, group->type);
+    of_group_desc_stats_entry_group_id_set(scratch, group->id);
+    if (of_group_desc_stats_entry_buckets_set(scratch, group->buckets) < 0) {
+        AIM_DIE("unexpected failure setting group desc stats entry buckets");
+    }
+
+    of_object_delete(group->desc);
+    group->desc = of_object_dup(scratch);
+    AIM_TRUE_OR_DIE(group->desc != NULL);
+
+    return group->desc;
+}
+
 /* TODO segment long replies */
 void
 ind_core_group_desc_stats_request_handler(of_object_t *_obj,
@@ -338,7 +637,7 @@ ind_core_group_desc_stats_request_handler(of_object_t *_obj,
     of_group_desc_stats_entry_t *entry;
     uint32_t xid;
     ind_core_group_t *group;
-    bighash_iter_t iter;
+    bighash_intkey_iter_t iter;
 
     reply = of_group_desc_stats_reply_new(obj->version);
     AIM_TRUE_OR_DIE(reply != NULL);
@@ -350,15 +649,9 @@ ind_core_group_desc_stats_request_handler(of_object_t *_obj,
     entry = of_group_desc_stats_entry_new(entries.version);
     AIM_TRUE_OR_DIE(entry != NULL);
 
-    for (group = bighash_iter_start(ind_core_group_hashtable, &iter);
-            group; group = bighash_iter_next(&iter)) {
-        of_group_desc_stats_entry_group_type_set(entry, group->type);
-        of_group_desc_stats_entry_group_id_set(entry, group->id);
-        if (of_group_desc_stats_entry_buckets_set(entry, group->buckets) < 0) {
-            AIM_DIE("unexpected failure setting group desc stats entry buckets");
-        }
-
-        if (of_list_append(&entries, entry) < 0) {
+    for (group = bighash_intkey_iter_start(ind_core_group_hashtable, &iter);
+            group; group = bighash_intkey_iter_next(&iter)) {
+        if (of_list_append(&entries, ind_core_group_desc_get(group, entry)) < 0) {
             break;
         }
     }
@@ -376,9 +669,114 @@ ind_core_group_features_stats_request_handler(of_object_t *_obj,
     ind_core_unhandled_message(obj, cxn_id);
 }
 
+/**
+ * Number of groups in the group table
+ */
+int
+ind_core_group_count(void)
+{
+    return bighash_intkey_count(ind_core_group_hashtable);
+}
+
+/**
+ * Heap bytes held by the group table
+ *
+ * Includes the duplicated bucket lists and the reference index.
+ */
+uint64_t
+ind_core_group_memory(void)
+{
+    ind_core_group_t *group;
+    bighash_intkey_iter_t iter;
+    uint64_t bytes;
+    int alloc;
+
+    bytes = bighash_intkey_table_bytes(ind_core_group_hashtable) +
+        IND_CORE_BIGHASH_BYTES(ind_core_group_ref_hashtable);
+
+    for (group = bighash_intkey_iter_start(ind_core_group_hashtable, &iter);
+         group != NULL;
+         group = bighash_intkey_iter_next(&iter)) {
+        bytes += sizeof(*group) + IND_CORE_DUP_BYTES(group->buckets);
+        if (group->desc != NULL) {
+            bytes += IND_CORE_DUP_BYTES(group->desc);
+        }
+        /* The refs array doubles from 4; see ind_core_group_ref_add */
+        if (group->num_refs > 0) {
+            for (alloc = 4; alloc < group->num_refs; alloc *= 2);
+            bytes += alloc * sizeof(*group->refs);
+        }
+    }
+
+    return bytes;
+}
+
+/**
+ * Install a group from a snapshot, replacing any group with its ID
+ *
+ * Forwarding is expected to have the group already.
+ */
+indigo_error_t
+ind_core_group_snapshot_load(of_group_add_t *group_add)
+{
+    uint32_t id;
+
+    of_group_add_group_id_get(group_add, &id);
+    ind_core_group_snapshot_unload(id);
+
+    return indigo_core_group_restore(group_add);
+}
+
+/**
+ * Drop a group loaded from a snapshot, or every group for OF_GROUP_ALL
+ *
+ * Forwarding is not told.
+ */
+void
+ind_core_group_snapshot_unload(uint32_t id)
+{
+    ind_core_group_t *group;
+    bighash_intkey_iter_t iter;
+
+    if (id != OF_GROUP_ALL) {
+        if ((group = ind_core_group_lookup(id)) != NULL) {
+            ind_core_group_free(group);
+        }
+        return;
+    }
+
+    for (group = bighash_intkey_iter_start(ind_core_group_hashtable, &iter);
+         group != NULL;
+         group = bighash_intkey_iter_next(&iter)) {
+        ind_core_group_free(group);
+    }
+}
+
+/**
+ * Write every group to the open snapshot
+ */
+void
+ind_core_group_snapshot_save(void)
+{
+    ind_core_group_t *group;
+    bighash_intkey_iter_t iter;
+
+    for (group = bighash_intkey_iter_start(ind_core_group_hashtable, &iter);
+         group != NULL;
+         group = bighash_intkey_iter_next(&iter)) {
+        ind_core_snapshot_group_write(group->id, group->type, group->buckets);
+    }
+}
+
 void
 ind_core_group_init(void)
 {
-    ind_core_group_hashtable = bighash_table_create(1024);
+    /* Group counts vary widely between deployments, so start small
+       and let the tables grow */
+    ind_core_group_hashtable = bighash_intkey_table_create(1024);
     AIM_TRUE_OR_DIE(ind_core_group_hashtable != NULL);
+
+    ind_core_group_ref_hashtable = bighash_table_create(1024);
+    AIM_TRUE_OR_DIE(ind_core_group_ref_hashtable != NULL);
+    bighash_table_autogrow_set(ind_core_group_ref_hashtable, 4);
 }
@@ -32,13 +32,20 @@
 #include <indigo/of_state_manager.h>
 #include <indigo/port_manager.h>
 #include <indigo/forwarding.h>
+#include <indigo/mem_budget.h>
 #include <loci/loci.h>
 #include <loci/loci_obj_dump.h>
+#include <SocketManager/socketmanager.h>
 #include "ofstatemanager_decs.h"
 #include "ofstatemanager_int.h"
 #include "handlers.h"
 #include "ft.h"
 #include "table.h"
+#include "snapshot.h"
+#include "flow_counters.h"
+#include "flow_monitor.h"
+#include "reply_cache.h"
+#include "experimenter.h"
 
 static void
 flow_mod_err_msg_send(indigo_error_t indigo_err, of_version_t ver,
@@ -82,7 +89,9 @@ ind_core_packet_out_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
 {
     of_packet_out_t *obj = _obj;
 
-    (void)indigo_fwd_packet_out(obj);
+    if (indigo_fwd_packet_out(obj) == INDIGO_ERROR_PARSE) {
+        indigo_cxn_message_parse_error(cxn_id, obj);
+    }
 }
 
 /****************************************************************/
@@ -100,6 +109,10 @@ ind_core_port_mod_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     of_port_mod_t *obj = _obj;
     indigo_error_t rv;
 
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_PORT_DESC);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_FEATURES);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_PORT_STATS);
+
     rv = indigo_port_modify(obj);
     if (rv != INDIGO_ERROR_NONE) {
         of_version_t ver = obj->version;
@@ -132,12 +145,17 @@ ind_core_port_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     indigo_error_t rv;
     uint32_t xid = 0;
 
+    if (ind_core_reply_cache_send(IND_CORE_REPLY_CACHE_PORT_STATS, obj, cxn_id)) {
+        return;
+    }
+
     rv = indigo_port_stats_get(obj, &reply);
     if (rv == INDIGO_ERROR_NONE) {
         /* Set the XID to match the request */
         of_port_stats_request_xid_get(obj, &xid);
         of_port_stats_reply_xid_set(reply, xid);
 
+        ind_core_reply_cache_store(IND_CORE_REPLY_CACHE_PORT_STATS, obj, reply);
         indigo_cxn_send_controller_message(cxn_id, reply);
     } else {
         of_port_no_t port_no;
@@ -270,7 +288,7 @@ flow_mod_setup_query(of_flow_modify_t *obj, /* Works with add, mod, del */
     }
     if (of_flow_modify_match_get(obj, &(query->match)) < 0) {
         LOG_ERROR("Failed to extract match from flow");
-        return INDIGO_ERROR_UNKNOWN;
+        return INDIGO_ERROR_PARSE;
     }
     query->mode = query_mode;
     if ((query_mode == OF_MATCH_STRICT) || (query_mode == OF_MATCH_OVERLAP)) {
@@ -282,6 +300,10 @@ flow_mod_setup_query(of_flow_modify_t *obj, /* Works with add, mod, del */
     } else {
         /* Could check object_id is delete or delete_strict */
         of_flow_add_out_port_get(obj, &(query->out_port));
+        if (obj->version >= OF_VERSION_1_1) {
+            of_flow_modify_out_group_get(obj, &query->out_group);
+            query->check_out_group = query->out_group != OF_GROUP_ANY;
+        }
     }
     if (query_mode != OF_MATCH_OVERLAP && obj->version >= OF_VERSION_1_1) {
         of_flow_add_cookie_get(obj, &query->cookie);
@@ -300,31 +322,80 @@ flow_mod_setup_query(of_flow_modify_t *obj, /* Works with add, mod, del */
 static int
 overlap_found(of_flow_modify_t *obj)
 {
-    ft_entry_t *entry;
-    list_links_t *cur, *next;
     of_meta_match_t query;
 
     _TRY(flow_mod_setup_query(obj, &query, OF_MATCH_OVERLAP, 1));
 
-    FT_ITER(ind_core_ft, entry, cur, next) {
-        if (ft_entry_meta_match(&query, entry)) {
-            return 1;
-        }
+    return ft_overlap_found(ind_core_ft, &query);
+}
+
+
+/*
+ * Deferred flow adds are flushed from a task so that a burst of adds
+ * read from the socket can be programmed together.
+ */
+
+static bool pending_flush_task_running = false;
+
+static ind_soc_task_status_t
+pending_flush_task(void *cookie)
+{
+    pending_flush_task_running = false;
+    ind_core_table_pending_flush();
+    indigo_fwd_pending_submit();
+    return IND_SOC_TASK_FINISHED;
+}
+
+static void
+pending_flush_task_start(void)
+{
+    if (pending_flush_task_running) {
+        return;
     }
 
-    return 0;
+    if (ind_soc_task_register(pending_flush_task, NULL,
+                              IND_SOC_DEFAULT_PRIORITY) < 0) {
+        LOG_ERROR("Failed to start pending flush task; flushing now");
+        ind_core_table_pending_flush();
+        indigo_fwd_pending_flush();
+        return;
+    }
+
+    pending_flush_task_running = true;
 }
 
-static indigo_flow_id_t
-flow_id_next(void)
+void
+indigo_core_flow_create_done(indigo_cookie_t flow_id, indigo_error_t result)
 {
-    static indigo_flow_id_t next_flow_id = 1;
+    ft_entry_t *entry;
 
-    indigo_flow_id_t result = next_flow_id;
+    entry = ft_lookup(ind_core_ft, flow_id);
+    if (entry == NULL || entry->pending_add == NULL) {
+        LOG_ERROR("Completion for unknown pending flow "
+                  INDIGO_FLOW_ID_PRINTF_FORMAT, flow_id);
+        return;
+    }
 
-    if (++next_flow_id == 0)  next_flow_id = 1;
+    if (result == INDIGO_ERROR_NONE) {
+        of_object_delete(entry->pending_add);
+        entry->pending_add = NULL;
+        ind_core_flow_monitor_notify(entry, IND_CORE_FLOW_MONITOR_EVENT_ADDED);
+        return;
+    }
 
-    return (result);
+    LOG_ERROR_RL("Error from Forwarding while inserting flow: %s",
+                 indigo_strerror(result));
+    ind_core_ft->status.forwarding_add_errors += 1;
+
+    /* Preloaded flows have no connection to tell */
+    if (!INDIGO_CXN_UNSPECIFIED(entry->pending_cxn_id)) {
+        flow_mod_err_msg_send(result, entry->pending_add->version,
+                              entry->pending_cxn_id,
+                              (of_flow_modify_t *)entry->pending_add);
+    }
+
+    /* Frees the pending add */
+    ft_delete(ind_core_ft, entry);
 }
 
 /**
@@ -339,7 +410,6 @@ ind_core_flow_add_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
 {
     indigo_error_t rv = INDIGO_ERROR_NONE;
     of_flow_modify_t *obj = _obj; /* Coerce to flow_modify object */
-    of_meta_match_t query;
     uint16_t flags;
     of_version_t ver;
     uint32_t xid = 0;
@@ -377,21 +447,24 @@ ind_core_flow_add_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     }
 
     /* Search table; if match found, replace entry */
-    rv = flow_mod_setup_query(obj, &query, OF_MATCH_STRICT, 1);
-    if (rv != INDIGO_ERROR_NONE) {
-        /* TODO send error */
-        return;
-    }
-
-    /* Delete existing flow if any */
-    if (ft_strict_match(ind_core_ft, &query, &entry) == INDIGO_ERROR_NONE) {
+    rv = ft_strict_match_flow_add(ind_core_ft, obj, &entry);
+    if (rv == INDIGO_ERROR_NONE) {
         ind_core_flow_entry_delete(entry, INDIGO_FLOW_REMOVED_OVERWRITE);
+    } else if (rv != INDIGO_ERROR_NOT_FOUND) {
+        indigo_cxn_message_parse_error(cxn_id, obj);
+        return;
     }
 
     /* No match found, add as normal */
     LOG_TRACE("Adding new flow");
 
-    flow_id = flow_id_next();
+    flow_id = ft_flow_id_next(ind_core_ft);
+    if (flow_id == 0) {
+        LOG_ERROR("No flow id left for new flow");
+        flow_mod_err_msg_send(INDIGO_ERROR_RESOURCE, obj->version, cxn_id,
+                              (of_flow_modify_t *)obj);
+        return;
+    }
 
     rv = ft_add(ind_core_ft, flow_id, obj, &entry);
     if (rv != INDIGO_ERROR_NONE) {
@@ -407,21 +480,36 @@ ind_core_flow_add_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     }
 
     ind_core_table_t *table = ind_core_table_get(table_id);
-    if (table != NULL) {
+    if (table != NULL && table->ops->entry_create_batch != NULL) {
+        /* Queued below, to be created with the adds after it */
+        rv = INDIGO_ERROR_PENDING;
+    } else if (table != NULL) {
         rv = table->ops->entry_create(table->priv, obj, flow_id, &entry->priv);
     } else {
         rv = indigo_fwd_flow_create(flow_id, (of_flow_add_t *)obj, &table_id);
     }
 
-    if (rv == INDIGO_ERROR_NONE) {
+    if (rv == INDIGO_ERROR_PENDING) {
+        /* Keep the add until forwarding reports the result */
+        LOG_TRACE("Flow " INDIGO_FLOW_ID_PRINTF_FORMAT " pending in forwarding",
+                  flow_id);
+        entry->pending_add = ind_core_dup_tracking(obj, cxn_id);
+        entry->pending_cxn_id = cxn_id;
+        ft_entry_table_id_set(ind_core_ft, entry, table_id);
+        if (table != NULL && table->ops->entry_create_batch != NULL) {
+            ind_core_table_create_enqueue(entry);
+        }
+        pending_flush_task_start();
+    } else if (rv == INDIGO_ERROR_NONE) {
         LOG_TRACE("Flow table now has %d entries",
                   FT_STATUS(ind_core_ft)->current_count);
-        entry->table_id = table_id;
+        ft_entry_table_id_set(ind_core_ft, entry, table_id);
+        ind_core_flow_monitor_notify(entry, IND_CORE_FLOW_MONITOR_EVENT_ADDED);
     } else { /* Error during insertion at forwarding layer */
        uint32_t xid;
 
-       LOG_ERROR("Error from Forwarding while inserting flow: %s",
-                 indigo_strerror(rv));
+       LOG_ERROR_RL("Error from Forwarding while inserting flow: %s",
+                    indigo_strerror(rv));
        ind_core_ft->status.forwarding_add_errors += 1;
 
        of_flow_add_xid_get(obj, &xid);
@@ -433,6 +521,111 @@ ind_core_flow_add_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     }
 }
 
+/**
+ * Adopt a flow that forwarding has already installed
+ *
+ * See indigo/of_state_manager.h.
+ */
+
+indigo_error_t
+indigo_core_flow_restore(indigo_flow_id_t flow_id, of_flow_add_t *flow_add)
+{
+    indigo_error_t rv;
+    ft_entry_t *entry;
+    uint8_t table_id;
+
+    if (flow_id == 0 || flow_add->version < OF_VERSION_1_1) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    rv = ft_add(ind_core_ft, flow_id, flow_add, &entry);
+    if (rv != INDIGO_ERROR_NONE) {
+        LOG_ERROR("Failed to restore flow " INDIGO_FLOW_ID_PRINTF_FORMAT
+                  ": %s", flow_id, indigo_strerror(rv));
+        return rv;
+    }
+
+    of_flow_add_table_id_get(flow_add, &table_id);
+    ft_entry_table_id_set(ind_core_ft, entry, table_id);
+
+    LOG_TRACE("Restored flow " INDIGO_FLOW_ID_PRINTF_FORMAT " in table %d",
+              flow_id, table_id);
+
+    return INDIGO_ERROR_NONE;
+}
+
+/* Next ID to try for a preloaded flow */
+static indigo_flow_id_t ind_core_preload_flow_id = INDIGO_CORE_PRELOAD_FLOW_ID_BASE;
+
+/**
+ * Install a flow that belongs to the switch
+ *
+ * See indigo/of_state_manager.h.
+ */
+
+indigo_error_t
+indigo_core_flow_preload(of_flow_add_t *flow_add)
+{
+    indigo_error_t rv;
+    ft_entry_t *entry;
+    indigo_flow_id_t flow_id;
+    uint8_t table_id;
+
+    if (flow_add->version < OF_VERSION_1_1) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    /* Already there, e.g. adopted by a warm start */
+    rv = ft_strict_match_flow_add(ind_core_ft, flow_add, &entry);
+    if (rv == INDIGO_ERROR_NONE) {
+        return INDIGO_ERROR_EXISTS;
+    } else if (rv != INDIGO_ERROR_NOT_FOUND) {
+        return rv;
+    }
+
+    of_flow_add_table_id_get(flow_add, &table_id);
+    if (ind_core_table_get(table_id) != NULL) {
+        return INDIGO_ERROR_NOT_SUPPORTED;
+    }
+
+    /* Skip the IDs of preloaded flows a warm start adopted */
+    do {
+        flow_id = ind_core_preload_flow_id++;
+    } while (ft_lookup(ind_core_ft, flow_id) != NULL);
+
+    if (!INDIGO_CORE_FLOW_ID_PRELOADED(flow_id)) {
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    rv = ft_add(ind_core_ft, flow_id, flow_add, &entry);
+    if (rv != INDIGO_ERROR_NONE) {
+        return rv;
+    }
+
+    rv = indigo_fwd_flow_create(flow_id, flow_add, &table_id);
+    if (rv == INDIGO_ERROR_PENDING) {
+        entry->pending_add = of_object_dup(flow_add);
+        AIM_TRUE_OR_DIE(entry->pending_add != NULL);
+        entry->pending_cxn_id = INDIGO_CXN_ID_UNSPECIFIED;
+        pending_flush_task_start();
+    } else if (rv != INDIGO_ERROR_NONE) {
+        ind_core_ft->status.forwarding_add_errors += 1;
+        ft_delete(ind_core_ft, entry);
+        return rv;
+    }
+
+    of_flow_add_table_id_get(flow_add, &table_id);
+    ft_entry_table_id_set(ind_core_ft, entry, table_id);
+    if (rv == INDIGO_ERROR_NONE) {
+        ind_core_flow_monitor_notify(entry, IND_CORE_FLOW_MONITOR_EVENT_ADDED);
+    }
+
+    LOG_TRACE("Preloaded flow " INDIGO_FLOW_ID_PRINTF_FORMAT " in table %d",
+              flow_id, table_id);
+
+    return INDIGO_ERROR_NONE;
+}
+
 /**
  * Translate the error status into the correct error code for the given
  * OpenFlow version, and send the error message to the controller.
@@ -536,47 +729,160 @@ flow_mod_err_msg_send(indigo_error_t indigo_err, of_version_t ver,
 
 /****************************************************************/
 
-/* State for non-strict flow-modify iteration */
+/* Arguments of a non-strict flow-modify or delete coroutine */
 struct flow_modify_state {
     of_flow_modify_t *request;
     indigo_cxn_id_t cxn_id;
-    int num_matched;
+    of_meta_match_t query;
 };
 
-/* Flowtable iterator for ind_core_flow_modify_handler */
+/*
+ * Apply a modify to one matched entry
+ *
+ * A modify whose effects are byte-identical to the entry's is answered
+ * from the flowtable without a round trip to forwarding.  Nothing else in
+ * the entry is changed by a modify: the cookie, timeouts and flags are
+ * those of the original add.
+ */
 static void
-modify_iter_cb(void *cookie, ft_entry_t *entry)
+flow_modify_entry(ft_entry_t *entry, of_flow_modify_t *obj,
+                  indigo_cxn_id_t cxn_id)
 {
-    struct flow_modify_state *state = cookie;
+    indigo_error_t rv;
 
-    if (entry != NULL) {
-        indigo_error_t rv;
-        state->num_matched++;
-        ind_core_table_t *table = ind_core_table_get(entry->table_id);
-        if (table != NULL) {
-            rv = table->ops->entry_modify(table->priv, entry->priv, state->request);
-        } else {
-            rv = indigo_fwd_flow_modify(entry->id, state->request);
-        }
-        if (rv == INDIGO_ERROR_NONE) {
-            ft_entry_modify_effects(ind_core_ft, entry, state->request);
-        } else {
-            LOG_ERROR("Error from Forwarding while modifying flow: %d",
-                      indigo_strerror(rv));
-            flow_mod_err_msg_send(rv, state->request->version,
-                                  state->cxn_id, state->request);
+    if (ft_entry_effects_equal(entry, obj)) {
+        LOG_TRACE("Modify leaves flow " INDIGO_FLOW_ID_PRINTF_FORMAT
+                  " unchanged", entry->id);
+        ind_core_ft->status.noop_updates += 1;
+        return;
+    }
+
+    if (ind_core_table_create_queued(entry)) {
+        /* The table must have the add first, which may fail */
+        indigo_flow_id_t flow_id = entry->id;
+        ind_core_table_pending_flush();
+        if ((entry = ft_lookup(ind_core_ft, flow_id)) == NULL) {
+            return;
         }
+    }
+
+    ind_core_table_t *table = ind_core_table_get(entry->table_id);
+    if (table != NULL) {
+        rv = table->ops->entry_modify(table->priv, entry->priv, obj);
     } else {
-        if (state->num_matched == 0) {
-            LOG_TRACE("No entries to modify, treat as add");
-            /* OpenFlow 1.0.0, section 4.6, page 14.  Treat as an add */
-            ind_core_flow_add_handler(state->request, state->cxn_id);
-        } else {
-            LOG_TRACE("Finished flow modify task");
+        rv = indigo_fwd_flow_modify(entry->id, obj);
+    }
+
+    if (rv == INDIGO_ERROR_NONE) {
+        ft_entry_modify_effects(ind_core_ft, entry, obj);
+    } else {
+        LOG_ERROR("Error from Forwarding while modifying flow: %d",
+                  indigo_strerror(rv));
+        flow_mod_err_msg_send(rv, obj->version, cxn_id, obj);
+    }
+}
+
+/*
+ * Apply a modify to several matched entries, with one call per run of
+ * entries in a table that has entry_modify_batch. No add is queued.
+ */
+static void
+flow_modify_entries(ft_entry_t **entries, int count, of_flow_modify_t *obj,
+                    indigo_cxn_id_t cxn_id)
+{
+    static indigo_core_table_batch_entry_t batch[IND_CORE_TABLE_BATCH_MAX];
+    ft_entry_t *changed[IND_CORE_TABLE_BATCH_MAX];
+    ind_core_table_t *table;
+    indigo_error_t rv;
+    int i, j, n, m;
+
+    for (i = 0; i < count; i += n) {
+        n = ind_core_table_batch_len(&entries[i], count - i);
+        table = ind_core_table_get(entries[i]->table_id);
+        if (table == NULL || table->ops->entry_modify_batch == NULL) {
+            for (j = 0; j < n; j++) {
+                flow_modify_entry(entries[i + j], obj, cxn_id);
+            }
+            continue;
+        }
+
+        m = 0;
+        for (j = 0; j < n; j++) {
+            if (ft_entry_effects_equal(entries[i + j], obj)) {
+                ind_core_ft->status.noop_updates += 1;
+                continue;
+            }
+            changed[m] = entries[i + j];
+            batch[m].obj = NULL;
+            batch[m].flow_id = entries[i + j]->id;
+            batch[m].entry_priv = entries[i + j]->priv;
+            batch[m].status = INDIGO_ERROR_NONE;
+            m++;
+        }
+        if (m == 0) {
+            continue;
+        }
+
+        rv = table->ops->entry_modify_batch(table->priv, obj, batch, m);
+
+        for (j = 0; j < m; j++) {
+            if (rv < 0) {
+                batch[j].status = rv;
+            }
+            if (batch[j].status == INDIGO_ERROR_NONE) {
+                ft_entry_modify_effects(ind_core_ft, changed[j], obj);
+            } else {
+                LOG_ERROR("Error from table while modifying flow: %s",
+                          indigo_strerror(batch[j].status));
+                flow_mod_err_msg_send(batch[j].status, obj->version, cxn_id, obj);
+            }
+        }
+    }
+}
+
+/* Coroutine for ind_core_flow_modify_handler */
+static void
+flow_modify_coroutine(void *cookie)
+{
+    struct flow_modify_state *state = cookie;
+    ft_entry_t *entries[IND_CORE_TABLE_BATCH_MAX];
+    ft_iterator_t iter;
+    ft_entry_t *entry;
+    int num_matched = 0;
+    int count = 0;
+
+    ft_iterator_init(&iter, ind_core_ft, &state->query);
+    for (;;) {
+        if (count == 0) {
+            /* Adds queued while yielded may be among the matches */
+            ind_core_table_pending_flush();
+        }
+        entry = ft_iterator_next(&iter);
+        if (entry != NULL) {
+            num_matched++;
+            entries[count++] = entry;
+        }
+        if (count > 0 && (entry == NULL || count == IND_CORE_TABLE_BATCH_MAX)) {
+            flow_modify_entries(entries, count, state->request, state->cxn_id);
+            count = 0;
+            ind_soc_coroutine_maybe_yield();
+        }
+        if (entry == NULL) {
+            break;
         }
-        of_object_delete(state->request);
-        aim_free(state);
     }
+    ft_iterator_cleanup(&iter);
+
+    if (num_matched == 0) {
+        LOG_TRACE("No entries to modify, treat as add");
+        /* OpenFlow 1.0.0, section 4.6, page 14.  Treat as an add */
+        ind_core_flow_add_handler(state->request, state->cxn_id);
+    } else {
+        LOG_TRACE("Finished flow modify");
+    }
+
+    of_object_delete(state->request);
+    aim_free(state);
 }
 
 /**
@@ -591,22 +897,22 @@ ind_core_flow_modify_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
 {
     of_flow_modify_t *obj = _obj;
     int rv;
-    of_meta_match_t query;
 
     struct flow_modify_state *state = aim_malloc(sizeof(*state));
-    state->request = ind_core_dup_tracking(obj, cxn_id);
-    state->num_matched = 0;
+    state->request = ind_core_claim_tracking(obj, cxn_id);
     state->cxn_id = cxn_id;
 
-    rv = flow_mod_setup_query(state->request, &query, OF_MATCH_NON_STRICT, 1);
+    rv = flow_mod_setup_query(state->request, &state->query,
+                              OF_MATCH_NON_STRICT, 1);
     if (rv != INDIGO_ERROR_NONE) {
+        indigo_cxn_message_parse_error(cxn_id, obj);
         of_object_delete(state->request);
         aim_free(state);
         return;
     }
 
-    rv = ft_spawn_iter_task(ind_core_ft, &query, modify_iter_cb, state,
-                            IND_SOC_DEFAULT_PRIORITY);
+    rv = ind_soc_coroutine_spawn(flow_modify_coroutine, state,
+                                 IND_SOC_DEFAULT_PRIORITY);
     if (rv != INDIGO_ERROR_NONE) {
         of_object_delete(state->request);
         aim_free(state);
@@ -635,7 +941,7 @@ ind_core_flow_modify_strict_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     /* Form the query */
     rv = flow_mod_setup_query(obj, &query, OF_MATCH_STRICT, 1);
     if (rv != INDIGO_ERROR_NONE) {
-        /* TODO send error */
+        indigo_cxn_message_parse_error(cxn_id, obj);
         return;
     }
 
@@ -647,39 +953,67 @@ ind_core_flow_modify_strict_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
         return;
     }
 
-    ind_core_table_t *table = ind_core_table_get(entry->table_id);
-    if (table != NULL) {
-        rv = table->ops->entry_modify(table->priv, entry->priv, obj);
-    } else {
-        rv = indigo_fwd_flow_modify(entry->id, obj);
-    }
-
-    if (rv == INDIGO_ERROR_NONE) {
-        ft_entry_modify_effects(ind_core_ft, entry, obj);
-    } else {
-        LOG_ERROR("Error from Forwarding while modifying flow: %d",
-                  indigo_strerror(rv));
-        flow_mod_err_msg_send(rv, obj->version, cxn_id, obj);
-    }
+    flow_modify_entry(entry, obj, cxn_id);
 }
 
 /****************************************************************/
 
-/* Flowtable iterator for ind_core_flow_delete_handler */
-static void
-delete_iter_cb(void *cookie, ft_entry_t *entry)
+/* A non-strict delete that covers every flow in its table(s) */
+static int
+flow_delete_is_wildcard(of_meta_match_t *query)
 {
-    struct flow_modify_state *state = cookie;
+    static const of_match_fields_t no_masks;
 
-    if (entry != NULL) {
-        ind_core_flow_entry_delete(entry, INDIGO_FLOW_REMOVED_DELETE);
-    } else {
-        LOG_TRACE("Finished flow delete task");
-        of_object_delete(state->request);
-        aim_free(state);
+    return query->cookie_mask == 0 &&
+        query->out_port == OF_PORT_DEST_WILDCARD &&
+        !query->check_out_group &&
+        memcmp(&query->match.masks, &no_masks, sizeof(no_masks)) == 0;
+}
+
+/* Wait while flow removed messages are backed up */
+static void
+flow_delete_wait(void)
+{
+    while (indigo_cxn_flow_removed_blocked()) {
+        if (indigo_cxn_flow_removed_ready_register(
+                ind_soc_coroutine_wake,
+                ind_soc_coroutine_self()) != INDIGO_ERROR_NONE) {
+            return;
+        }
+        LOG_TRACE("Pausing flow delete for flow removed messages");
+        ind_soc_coroutine_wait();
     }
 }
 
+/* Coroutine for ind_core_flow_delete_handler */
+static void
+flow_delete_coroutine(void *cookie)
+{
+    struct flow_modify_state *state = cookie;
+    ft_entry_t *entries[IND_CORE_TABLE_BATCH_MAX];
+    ft_iterator_t iter;
+    int count;
+
+    ft_iterator_init(&iter, ind_core_ft, &state->query);
+    do {
+        /* Before taking the next entries, which may go while waiting */
+        flow_delete_wait();
+        ind_core_table_pending_flush();
+        for (count = 0; count < IND_CORE_TABLE_BATCH_MAX; count++) {
+            if ((entries[count] = ft_iterator_next(&iter)) == NULL) {
+                break;
+            }
+        }
+        ind_core_flow_entries_delete(entries, count, INDIGO_FLOW_REMOVED_DELETE);
+        ind_soc_coroutine_maybe_yield();
+    } while (count == IND_CORE_TABLE_BATCH_MAX);
+    ft_iterator_cleanup(&iter);
+
+    LOG_TRACE("Finished flow delete");
+    of_object_delete(state->request);
+    aim_free(state);
+}
+
 
 /**
  * Handle a flow_delete message
@@ -691,23 +1025,30 @@ delete_iter_cb(void *cookie, ft_entry_t *entry)
 void
 ind_core_flow_delete_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
 {
-    of_meta_match_t query;
     indigo_error_t rv;
 
     struct flow_modify_state *state = aim_malloc(sizeof(*state));
-    state->request = ind_core_dup_tracking(obj, cxn_id);
-    state->num_matched = 0;
+    state->request = ind_core_claim_tracking(obj, cxn_id);
     state->cxn_id = cxn_id;
 
-    rv = flow_mod_setup_query(obj, &query, OF_MATCH_NON_STRICT, 0);
+    rv = flow_mod_setup_query(obj, &state->query, OF_MATCH_NON_STRICT, 0);
     if (rv != INDIGO_ERROR_NONE) {
+        indigo_cxn_message_parse_error(cxn_id, obj);
         of_object_delete(state->request);
         aim_free(state);
         return;
     }
 
-    rv = ft_spawn_iter_task(ind_core_ft, &query, delete_iter_cb, state,
-                            IND_SOC_DEFAULT_PRIORITY);
+    /* Clearing a table, or all of them, is one forwarding call */
+    if (flow_delete_is_wildcard(&state->query) &&
+        ind_core_flow_table_purge(state->query.table_id) == INDIGO_ERROR_NONE) {
+        of_object_delete(state->request);
+        aim_free(state);
+        return;
+    }
+
+    rv = ind_soc_coroutine_spawn(flow_delete_coroutine, state,
+                                 IND_SOC_DEFAULT_PRIORITY);
     if (rv != INDIGO_ERROR_NONE) {
         of_object_delete(state->request);
         aim_free(state);
@@ -732,7 +1073,7 @@ ind_core_flow_delete_strict_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
 
     rv = flow_mod_setup_query((of_flow_modify_t *)obj, &query, OF_MATCH_STRICT, 0);
     if (rv != INDIGO_ERROR_NONE) {
-        /* TODO send error */
+        indigo_cxn_message_parse_error(cxn_id, obj);
         return;
     }
 
@@ -777,69 +1118,354 @@ ind_core_get_config_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
 
 /****************************************************************/
 
+/*
+ * Read a flow's counters from its table or from forwarding, and keep
+ * them as the entry's cached counters
+ *
+ * A flow deleted under a snapshot iterator is gone from forwarding, so
+ * its cached counters are the last word.
+ */
+indigo_error_t
+ind_core_entry_stats_get(ft_entry_t *entry, indigo_fi_flow_stats_t *flow_stats)
+{
+    indigo_error_t rv;
+
+    flow_stats->flow_id = entry->id;
+    flow_stats->duration_ns = 0;
+    flow_stats->packets = -1;
+    flow_stats->bytes = -1;
+
+    if (entry->retired_epoch != 0) {
+        flow_stats->packets = entry->packets;
+        flow_stats->bytes = entry->bytes;
+        return INDIGO_ERROR_NONE;
+    }
+
+    ind_core_table_t *table = ind_core_table_get(entry->table_id);
+    if (table != NULL && ind_core_table_create_queued(entry)) {
+        /* Not in the table yet, so nothing counted */
+        flow_stats->packets = 0;
+        flow_stats->bytes = 0;
+        rv = INDIGO_ERROR_NONE;
+    } else if (table != NULL) {
+        rv = table->ops->entry_stats_get(table->priv, entry->priv, flow_stats);
+    } else {
+        rv = indigo_fwd_flow_stats_get(entry->id, flow_stats);
+    }
+
+    if (rv != INDIGO_ERROR_NONE) {
+        LOG_ERROR_RL("Failed to get stats for flow "INDIGO_FLOW_ID_PRINTF_FORMAT": %s",
+                     entry->id, indigo_strerror(rv));
+        return rv;
+    }
+
+    ft_entry_counters_set(ind_core_ft, entry, flow_stats->packets,
+                          flow_stats->bytes);
+
+    return INDIGO_ERROR_NONE;
+}
+
+/*
+ * As ind_core_entry_stats_get for several entries, with one call per run
+ * of entries in a table that has entry_stats_batch_get. No add is queued.
+ */
+void
+ind_core_entries_stats_get(ft_entry_t **entries, int count,
+                           indigo_fi_flow_stats_t *flow_stats,
+                           indigo_error_t *results)
+{
+    static indigo_core_table_batch_entry_t batch[IND_CORE_TABLE_BATCH_MAX];
+    ind_core_table_t *table;
+    indigo_error_t rv;
+    int i, j, n;
+
+    for (i = 0; i < count; i += n) {
+        n = ind_core_table_batch_len(&entries[i], count - i);
+        table = ind_core_table_get(entries[i]->table_id);
+        if (table == NULL || table->ops->entry_stats_batch_get == NULL ||
+                entries[i]->retired_epoch != 0) {
+            for (j = i; j < i + n; j++) {
+                results[j] = ind_core_entry_stats_get(entries[j], &flow_stats[j]);
+            }
+            continue;
+        }
+
+        for (j = 0; j < n; j++) {
+            batch[j].obj = NULL;
+            batch[j].flow_id = entries[i + j]->id;
+            batch[j].entry_priv = entries[i + j]->priv;
+            batch[j].flow_stats.flow_id = entries[i + j]->id;
+            batch[j].flow_stats.duration_ns = 0;
+            batch[j].flow_stats.packets = -1;
+            batch[j].flow_stats.bytes = -1;
+            batch[j].status = INDIGO_ERROR_NONE;
+        }
+
+        rv = table->ops->entry_stats_batch_get(table->priv, batch, n);
+
+        for (j = 0; j < n; j++) {
+            if (rv < 0) {
+                batch[j].status = rv;
+            }
+            flow_stats[i + j] = batch[j].flow_stats;
+            results[i + j] = batch[j].status;
+            if (batch[j].status != INDIGO_ERROR_NONE) {
+                LOG_ERROR_RL("Failed to get stats for flow "INDIGO_FLOW_ID_PRINTF_FORMAT": %s",
+                             entries[i + j]->id, indigo_strerror(batch[j].status));
+                continue;
+            }
+            ft_entry_counters_set(ind_core_ft, entries[i + j],
+                                  flow_stats[i + j].packets,
+                                  flow_stats[i + j].bytes);
+        }
+    }
+}
+
+/*
+ * Flow stats
+ *
+ * A request for all tables is split into one collector per table that
+ * has flows, each a coroutine walking that table's list, so the tables
+ * are walked side by side.  The replies go out in table order: the front
+ * collector sends its replies as they fill, and the ones behind it queue
+ * up to IND_CORE_FLOW_STATS_QUEUE_MAX replies and then wait until they
+ * reach the front.  The last reply of the last collector carries the
+ * final flags.
+ */
+
+#define IND_CORE_FLOW_STATS_QUEUE_MAX 8
+
+struct ind_core_flow_stats_state;
+
+struct ind_core_flow_stats_collector {
+    struct ind_core_flow_stats_state *state;
+    int index;
+    uint8_t table_id;
+    of_flow_stats_reply_t *reply;  /* Being filled */
+    of_list_flow_stats_entry_t entries;  /* Of reply */
+    of_list_builder_t builder;     /* Of entries, while filling reply */
+    of_flow_stats_reply_t *queue[IND_CORE_FLOW_STATS_QUEUE_MAX];
+    int queue_count;
+    ind_soc_coroutine_t *waiting;  /* Waiting to reach the front */
+    bool done;
+};
+
 struct ind_core_flow_stats_state {
     indigo_cxn_id_t cxn_id;
     of_flow_stats_request_t *req;
+    of_meta_match_t query;
     indigo_time_t current_time;
-    of_flow_stats_reply_t *reply;
+    int num_collectors;
+    int front;                     /* Collector whose replies go out */
+    struct ind_core_flow_stats_collector collectors[];
 };
 
+static of_flow_stats_reply_t *
+ind_core_flow_stats_reply_new(struct ind_core_flow_stats_state *state)
+{
+    of_flow_stats_reply_t *reply;
+    uint32_t xid;
+
+    reply = of_flow_stats_reply_new(state->req->version);
+    if (reply == NULL) {
+        LOG_ERROR("Failed to allocate of_flow_stats_reply.");
+        return NULL;
+    }
+
+    of_flow_stats_request_xid_get(state->req, &xid);
+    of_flow_stats_reply_xid_set(reply, xid);
+    of_flow_stats_reply_flags_set(reply, 1);
+
+    return reply;
+}
+
+/* Send the collector's current reply, or queue it if not at the front */
 static void
-ind_core_flow_stats_iter(void *cookie, ft_entry_t *entry)
+ind_core_flow_stats_flush(struct ind_core_flow_stats_collector *collector)
 {
-    struct ind_core_flow_stats_state *state = cookie;
-    uint32_t secs, nsecs;
-    indigo_error_t rv;
+    struct ind_core_flow_stats_state *state = collector->state;
 
-    /* Allocate a reply if we don't already have one. */
-    if (state->reply == NULL) {
-        uint32_t xid;
-
-        state->reply = of_flow_stats_reply_new(state->req->version);
-        if (state->reply == NULL) {
-            LOG_ERROR("Failed to allocate of_flow_stats_reply.");
-            if (entry == NULL) {
-                /* This is the last callback, so need to clean up
-                 * before returning. */
-                of_flow_stats_request_delete(state->req);
-                aim_free(state);
+    of_list_builder_finish(&collector->builder);
+    if (collector->index == state->front) {
+        indigo_cxn_send_controller_message(state->cxn_id, collector->reply);
+    } else {
+        INDIGO_ASSERT(collector->queue_count < IND_CORE_FLOW_STATS_QUEUE_MAX);
+        indigo_mem_budget_charge(INDIGO_MEM_BUDGET_REPLY,
+                                 collector->reply->length);
+        collector->queue[collector->queue_count++] = collector->reply;
+    }
+    collector->reply = NULL;
+}
+
+/*
+ * Move the front past finished collectors, sending what the new front
+ * has queued.  Once every collector is finished, send the final reply
+ * and free the request state.
+ */
+static void
+ind_core_flow_stats_advance(struct ind_core_flow_stats_state *state)
+{
+    struct ind_core_flow_stats_collector *collector;
+    of_flow_stats_reply_t *reply;
+    int i;
+
+    while (state->front < state->num_collectors) {
+        collector = &state->collectors[state->front];
+        for (i = 0; i < collector->queue_count; i++) {
+            indigo_mem_budget_release(INDIGO_MEM_BUDGET_REPLY,
+                                      collector->queue[i]->length);
+            indigo_cxn_send_controller_message(state->cxn_id,
+                                               collector->queue[i]);
+        }
+        collector->queue_count = 0;
+
+        if (!collector->done) {
+            if (collector->waiting != NULL) {
+                ind_soc_coroutine_t *co = collector->waiting;
+                collector->waiting = NULL;
+                ind_soc_coroutine_wake(co);
             }
             return;
         }
 
-        of_flow_stats_request_xid_get(state->req, &xid);
-        of_flow_stats_reply_xid_set(state->reply, xid);
-        of_flow_stats_reply_flags_set(state->reply, 1);
+        state->front++;
     }
 
-    if (entry == NULL) {
-        /* Send last reply */
-        of_flow_stats_reply_flags_set(state->reply, 0);
-        indigo_cxn_send_controller_message(state->cxn_id, state->reply);
+    /* Send last reply */
+    reply = state->collectors[state->num_collectors - 1].reply;
+    if (reply == NULL) {
+        reply = ind_core_flow_stats_reply_new(state);
+    }
+    if (reply != NULL) {
+        of_flow_stats_reply_flags_set(reply, 0);
+        indigo_cxn_send_controller_message(state->cxn_id, reply);
+    }
 
-        /* Clean up state */
-        of_flow_stats_request_delete(state->req);
-        aim_free(state);
-        return;
+    /* Clean up state */
+    indigo_fwd_flow_stats_bulk_end();
+    of_flow_stats_request_delete(state->req);
+    aim_free(state);
+}
+
+/* The collector's walk is over; may free the request state */
+static void
+ind_core_flow_stats_finish(struct ind_core_flow_stats_collector *collector)
+{
+    struct ind_core_flow_stats_state *state = collector->state;
+
+    /* The last collector's reply is kept for the final flags */
+    collector->done = true;
+    of_list_builder_finish(&collector->builder);
+    if (collector->reply != NULL &&
+        collector->index != state->num_collectors - 1) {
+        ind_core_flow_stats_flush(collector);
+    }
+    if (collector->index == state->front) {
+        ind_core_flow_stats_advance(state);
     }
+}
 
-    indigo_fi_flow_stats_t flow_stats = {
-        .flow_id = entry->id,
-        .duration_ns = 0,
-        .packets = -1,
-        .bytes = -1,
-    };
+/* Offset of the match in a flow stats entry with an OXM match */
+#define IND_CORE_FLOW_STATS_ENTRY_MATCH_OFFSET 48
 
-    ind_core_table_t *table = ind_core_table_get(entry->table_id);
-    if (table != NULL) {
-        rv = table->ops->entry_stats_get(table->priv, entry->priv, &flow_stats);
-    } else {
-        rv = indigo_fwd_flow_stats_get(entry->id, &flow_stats);
+/*
+ * Append a flow stats entry holding the flow's cached wire match and its
+ * interned instructions, copied in whole, leaving the fixed fields to be
+ * filled in. Returns 0 if the flow has no wire data for the reply's
+ * version, and -1 on failure.
+ */
+static int
+ind_core_flow_stats_entry_wire_bind(
+    struct ind_core_flow_stats_collector *collector, ft_entry_t *entry,
+    of_flow_stats_entry_t *stats_entry)
+{
+    const int offset = IND_CORE_FLOW_STATS_ENTRY_MATCH_OFFSET;
+    of_version_t version = collector->reply->version;
+    ft_effects_t *effects = entry->effects_ref;
+    of_octets_t match;
+    uint8_t *buf;
+
+    if (version < OF_VERSION_1_2 || effects == NULL ||
+        !ft_entry_match_wire(ind_core_ft, entry, version, &match)) {
+        return 0;
     }
 
-    if (rv != INDIGO_ERROR_NONE) {
-        LOG_ERROR("Failed to get stats for flow "INDIGO_FLOW_ID_PRINTF_FORMAT": %s",
-                  entry->id, indigo_strerror(rv));
+    of_flow_stats_entry_init(stats_entry, version,
+                             offset + match.bytes + effects->bytes, 1);
+    if (of_list_flow_stats_entry_append_bind(&collector->entries,
+                                             stats_entry)) {
+        LOG_ERROR("failed to append to flow stats list");
+        return -1;
+    }
+
+    buf = OF_OBJECT_BUFFER_INDEX(stats_entry, offset);
+    INDIGO_MEM_COPY(buf, match.data, match.bytes);
+    INDIGO_MEM_COPY(buf + match.bytes, effects->buf, effects->bytes);
+
+    return 1;
+}
+
+/* Append a flow stats entry and encode the flow's match and effects into it */
+static int
+ind_core_flow_stats_entry_encode_bind(
+    struct ind_core_flow_stats_collector *collector, ft_entry_t *entry,
+    of_flow_stats_entry_t *stats_entry)
+{
+    of_match_t match;
+
+    of_flow_stats_entry_init(stats_entry, collector->reply->version, -1, 1);
+    if (of_list_flow_stats_entry_append_bind(&collector->entries,
+                                             stats_entry)) {
+        LOG_ERROR("failed to append to flow stats list");
+        return -1;
+    }
+
+    ft_match_unpack(entry->match, &match);
+    if (of_flow_stats_entry_match_set(stats_entry, &match)) {
+        LOG_ERROR("Failed to set match in flow stats entry");
+        return -1;
+    }
+
+    if (stats_entry->version == entry->effects.actions->version) {
+        if (stats_entry->version == OF_VERSION_1_0) {
+            if (of_flow_stats_entry_actions_set(
+                    stats_entry, entry->effects.actions) < 0) {
+                LOG_ERROR("Failed to set actions list of flow stats entry");
+                return -1;
+            }
+        } else {
+            if (of_flow_stats_entry_instructions_set(
+                    stats_entry, entry->effects.instructions) < 0) {
+                LOG_ERROR("Failed to set instructions list of flow stats entry");
+                return -1;
+            }
+        }
+    }
+
+    return 1;
+}
+
+static void
+ind_core_flow_stats_append(struct ind_core_flow_stats_collector *collector,
+                           ft_entry_t *entry)
+{
+    struct ind_core_flow_stats_state *state = collector->state;
+    uint32_t secs, nsecs;
+    int rv;
+
+    /* Allocate a reply if we don't already have one. */
+    if (collector->reply == NULL) {
+        collector->reply = ind_core_flow_stats_reply_new(state);
+        if (collector->reply == NULL) {
+            return;
+        }
+        of_flow_stats_reply_entries_bind(collector->reply, &collector->entries);
+        of_list_builder_start(&collector->builder, &collector->entries);
+    }
+
+    indigo_fi_flow_stats_t flow_stats;
+
+    if (ind_core_entry_stats_get(entry, &flow_stats) != INDIGO_ERROR_NONE) {
         return;
     }
 
@@ -856,12 +1482,14 @@ ind_core_flow_stats_iter(void *cookie, ft_entry_t *entry)
 
     /* Set up the structures to append an entry to the list */
     {
-        of_list_flow_stats_entry_t list;
         of_flow_stats_entry_t stats_entry;
-        of_flow_stats_reply_entries_bind(state->reply, &list);
-        of_flow_stats_entry_init(&stats_entry, state->reply->version, -1, 1);
-        if (of_list_flow_stats_entry_append_bind(&list, &stats_entry)) {
-            LOG_ERROR("failed to append to flow stats list");
+
+        rv = ind_core_flow_stats_entry_wire_bind(collector, entry, &stats_entry);
+        if (rv == 0) {
+            rv = ind_core_flow_stats_entry_encode_bind(collector, entry,
+                                                       &stats_entry);
+        }
+        if (rv < 0) {
             return;
         }
 
@@ -874,27 +1502,6 @@ ind_core_flow_stats_iter(void *cookie, ft_entry_t *entry)
             of_flow_stats_entry_flags_set(&stats_entry, entry->flags);
         }
 
-        if (of_flow_stats_entry_match_set(&stats_entry, &entry->match)) {
-            LOG_ERROR("Failed to set match in flow stats entry");
-            return;
-        }
-
-        if (stats_entry.version == entry->effects.actions->version) {
-            if (stats_entry.version == OF_VERSION_1_0) {
-                if (of_flow_stats_entry_actions_set(
-                        &stats_entry, entry->effects.actions) < 0) {
-                    LOG_ERROR("Failed to set actions list of flow stats entry");
-                    return;
-                }
-            } else {
-                if (of_flow_stats_entry_instructions_set(
-                        &stats_entry, entry->effects.instructions) < 0) {
-                    LOG_ERROR("Failed to set instructions list of flow stats entry");
-                    return;
-                }
-            }
-        }
-
         of_flow_stats_entry_table_id_set(&stats_entry, entry->table_id);
         of_flow_stats_entry_duration_sec_set(&stats_entry, secs);
         of_flow_stats_entry_duration_nsec_set(&stats_entry, nsecs);
@@ -902,10 +1509,67 @@ ind_core_flow_stats_iter(void *cookie, ft_entry_t *entry)
         of_flow_stats_entry_byte_count_set(&stats_entry, flow_stats.bytes);
     }
 
-    if (state->reply->length > (1 << 15)) { /* Last object would get too big */
-        indigo_cxn_send_controller_message(state->cxn_id, state->reply);
-        state->reply = NULL;
+    /* The reply's length is only fixed up when the builder finishes */
+    if (collector->entries.length > (1 << 15)) { /* Last object would get too big */
+        ind_core_flow_stats_flush(collector);
+    }
+}
+
+/*
+ * Wait while the requesting connection is backed up, so a full table
+ * dump is produced only as fast as it is sent.  A collector behind the
+ * front waits once its queue is full instead.
+ */
+static void
+ind_core_flow_stats_wait(struct ind_core_flow_stats_collector *collector)
+{
+    struct ind_core_flow_stats_state *state = collector->state;
+
+    for (;;) {
+        if (collector->index != state->front) {
+            if (collector->queue_count < IND_CORE_FLOW_STATS_QUEUE_MAX) {
+                return;
+            }
+            LOG_TRACE("Pausing flow stats collector %d for cxn %d",
+                      collector->index, state->cxn_id);
+            collector->waiting = ind_soc_coroutine_self();
+        } else {
+            if (!indigo_cxn_output_blocked(state->cxn_id)) {
+                return;
+            }
+            if (indigo_cxn_output_ready_register(
+                    state->cxn_id, ind_soc_coroutine_wake,
+                    ind_soc_coroutine_self()) != INDIGO_ERROR_NONE) {
+                return;
+            }
+            LOG_TRACE("Pausing flow stats for cxn %d", state->cxn_id);
+        }
+        ind_soc_coroutine_wait();
+    }
+}
+
+/* Coroutine walking one collector's table */
+static void
+ind_core_flow_stats_collect(void *cookie)
+{
+    struct ind_core_flow_stats_collector *collector = cookie;
+    of_meta_match_t query = collector->state->query;
+    ft_iterator_t iter;
+    ft_entry_t *entry;
+
+    query.table_id = collector->table_id;
+    ft_iterator_init_snapshot(&iter, ind_core_ft, &query);
+    for (;;) {
+        ind_core_flow_stats_wait(collector);
+        if ((entry = ft_iterator_next(&iter)) == NULL) {
+            break;
+        }
+        ind_core_flow_stats_append(collector, entry);
+        ind_soc_coroutine_maybe_yield();
     }
+    ft_iterator_cleanup(&iter);
+
+    ind_core_flow_stats_finish(collector);
 }
 
 /**
@@ -921,6 +1585,11 @@ ind_core_flow_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     of_flow_stats_request_t *obj = _obj;
     of_meta_match_t query;
     struct ind_core_flow_stats_state *state;
+    struct ind_core_flow_stats_collector *collector;
+    uint8_t tables[FT_TABLE_LIST_COUNT];
+    int num_tables = 0;
+    int table_id;
+    int i;
     indigo_error_t rv;
 
     /* Set up the query structure */
@@ -934,83 +1603,242 @@ ind_core_flow_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     if (obj->version >= OF_VERSION_1_1) {
         of_flow_stats_request_cookie_get(obj, &query.cookie);
         of_flow_stats_request_cookie_mask_get(obj, &query.cookie_mask);
+        of_flow_stats_request_out_group_get(obj, &query.out_group);
+        query.check_out_group = query.out_group != OF_GROUP_ANY;
+    }
+
+    /* Non strict; do not check priority or overlap */
+    query.mode = OF_MATCH_NON_STRICT;
+
+    /* One collector per table with flows, or one for the whole request */
+    if (query.table_id == TABLE_ID_ANY) {
+        for (table_id = 0; table_id < TABLE_ID_ANY; table_id++) {
+            if (ind_core_ft->table_counts[table_id] > 0) {
+                tables[num_tables++] = table_id;
+            }
+        }
+    }
+    if (num_tables < 2) {
+        tables[0] = query.table_id;
+        num_tables = 1;
+    }
+
+    state = aim_zmalloc(sizeof(*state) + num_tables * sizeof(*collector));
+    state->req = ind_core_claim_tracking(obj, cxn_id);
+    state->query = query;
+    state->cxn_id = cxn_id;
+    state->current_time = INDIGO_CURRENT_TIME;
+    state->num_collectors = num_tables;
+    state->front = 0;
+
+    indigo_fwd_flow_stats_bulk_begin(query.table_id);
+
+    /*
+     * A collector that cannot start finishes empty; the last one to
+     * finish frees the state, so it is not touched after the loop.
+     */
+    for (i = 0; i < num_tables; i++) {
+        collector = &state->collectors[i];
+        collector->state = state;
+        collector->index = i;
+        collector->table_id = tables[i];
+    }
+    for (i = 0; i < num_tables; i++) {
+        collector = &state->collectors[i];
+        rv = ind_soc_coroutine_spawn(ind_core_flow_stats_collect, collector,
+                                     IND_SOC_DEFAULT_PRIORITY);
+        if (rv != INDIGO_ERROR_NONE) {
+            LOG_ERROR("Failed to start flow stats collector: %s",
+                      indigo_strerror(rv));
+            ind_core_flow_stats_finish(collector);
+        }
+    }
+}
+
+/****************************************************************/
+
+/*
+ * Aggregate stats
+ *
+ * With aggregate_stats_refresh_ms set, a background walk refreshes every
+ * flow's cached counters on that period, which the flowtable keeps summed
+ * per table.  A request with no match fields and no out_port or out_group
+ * filter is then answered from the sums when its cookie mask is zero, or
+ * from the flows of the cookie's bucket in the full cookie index when the
+ * mask is full, without reading any counters.  The counters are as old as the
+ * last refresh; once that is more than two periods old, or for any other
+ * request, the matching flows are walked and read as before.
+ */
+
+static bool aggregate_refresh_running;
+static indigo_time_t aggregate_refresh_start;
+static indigo_time_t aggregate_refresh_time; /* Start of the last full refresh */
+
+static void
+ind_core_aggregate_refresh_coroutine(void *cookie)
+{
+    indigo_fi_flow_stats_t flow_stats[IND_CORE_TABLE_BATCH_MAX];
+    indigo_error_t results[IND_CORE_TABLE_BATCH_MAX];
+    ft_entry_t *entries[IND_CORE_TABLE_BATCH_MAX];
+    ft_iterator_t iter;
+    int count;
+
+    ft_iterator_init(&iter, ind_core_ft, NULL);
+    do {
+        ind_core_table_pending_flush();
+        for (count = 0; count < IND_CORE_TABLE_BATCH_MAX; count++) {
+            if ((entries[count] = ft_iterator_next(&iter)) == NULL) {
+                break;
+            }
+        }
+        ind_core_entries_stats_get(entries, count, flow_stats, results);
+        ind_soc_coroutine_maybe_yield();
+    } while (count == IND_CORE_TABLE_BATCH_MAX);
+    ft_iterator_cleanup(&iter);
+
+    indigo_fwd_flow_stats_bulk_end();
+    aggregate_refresh_time = aggregate_refresh_start;
+    aggregate_refresh_running = false;
+}
+
+void
+ind_core_aggregate_stats_timer(void *cookie)
+{
+    indigo_error_t rv;
+
+    if (aggregate_refresh_running) {
+        return;
+    }
+
+    aggregate_refresh_start = INDIGO_CURRENT_TIME;
+    indigo_fwd_flow_stats_bulk_begin(TABLE_ID_ANY);
+
+    rv = ind_soc_coroutine_spawn(ind_core_aggregate_refresh_coroutine, NULL,
+                                 -10);
+    if (rv != INDIGO_ERROR_NONE) {
+        LOG_ERROR("Failed to start aggregate stats refresh: %s",
+                  indigo_strerror(rv));
+        indigo_fwd_flow_stats_bulk_end();
+        return;
+    }
+
+    aggregate_refresh_running = true;
+}
+
+/* Answer from the cached counters if the query allows; see above */
+static bool
+ind_core_aggregate_stats_cached(of_meta_match_t *query, uint64_t *packets,
+                                uint64_t *bytes, uint32_t *flows)
+{
+    static const of_match_fields_t no_masks;
+    ft_table_counters_t counters;
+    int table_id;
+
+    if (ind_core_config.aggregate_stats_refresh_ms <= 0 ||
+        aggregate_refresh_time == 0 ||
+        INDIGO_CURRENT_TIME - aggregate_refresh_time >
+            2 * (indigo_time_t)ind_core_config.aggregate_stats_refresh_ms) {
+        return false;
+    }
+
+    if (query->out_port != OF_PORT_DEST_WILDCARD || query->check_out_group ||
+        memcmp(&query->match.masks, &no_masks, sizeof(no_masks)) != 0) {
+        return false;
+    }
+
+    if (query->cookie_mask == ~(uint64_t)0) {
+        *flows = ft_cookie_counters_get(ind_core_ft, query->cookie,
+                                        query->table_id, &counters);
+        *packets = counters.packets;
+        *bytes = counters.bytes;
+        return true;
+    }
+
+    if (query->cookie_mask != 0) {
+        return false;
+    }
+
+    *packets = 0;
+    *bytes = 0;
+    *flows = 0;
+    for (table_id = 0; table_id < FT_TABLE_LIST_COUNT; table_id++) {
+        if (query->table_id != TABLE_ID_ANY && query->table_id != table_id) {
+            continue;
+        }
+        *packets += ind_core_ft->table_counters[table_id].packets;
+        *bytes += ind_core_ft->table_counters[table_id].bytes;
+        *flows += ind_core_ft->table_counts[table_id];
     }
 
-    /* Non strict; do not check priority or overlap */
-    query.mode = OF_MATCH_NON_STRICT;
+    return true;
+}
 
-    state = aim_malloc(sizeof(*state));
-    state->req = ind_core_dup_tracking(obj, cxn_id);
-    state->cxn_id = cxn_id;
-    state->current_time = INDIGO_CURRENT_TIME;
-    state->reply = NULL;
+static void
+ind_core_aggregate_stats_reply_send(indigo_cxn_id_t cxn_id,
+                                    of_aggregate_stats_request_t *req,
+                                    uint64_t packets, uint64_t bytes,
+                                    uint32_t flows)
+{
+    of_aggregate_stats_reply_t *reply;
+    uint32_t xid;
 
-    rv = ft_spawn_iter_task(ind_core_ft, &query, ind_core_flow_stats_iter,
-                            state, IND_SOC_DEFAULT_PRIORITY);
-    if (rv != INDIGO_ERROR_NONE) {
-        LOG_ERROR("Failed to start flow stats iter: %s", indigo_strerror(rv));
-        of_object_delete(state->req);
-        aim_free(state);
+    reply = of_aggregate_stats_reply_new(req->version);
+    if (reply == NULL) {
+        LOG_ERROR("Failed to allocate aggregate stats reply.");
+        return;
     }
-}
 
-/****************************************************************/
+    of_aggregate_stats_request_xid_get(req, &xid);
+    of_aggregate_stats_reply_xid_set(reply, xid);
+    of_aggregate_stats_reply_byte_count_set(reply, bytes);
+    of_aggregate_stats_reply_packet_count_set(reply, packets);
+    of_aggregate_stats_reply_flow_count_set(reply, flows);
+    indigo_cxn_send_controller_message(cxn_id, reply);
+}
 
 struct ind_core_aggregate_stats_state {
-    uint64_t packets;
-    uint64_t bytes;
-    uint32_t flows;
     indigo_cxn_id_t cxn_id;
     of_aggregate_stats_request_t *req;
+    of_meta_match_t query;
 };
 
 static void
-ind_core_aggregate_stats_iter(void *cookie, ft_entry_t *entry)
+ind_core_aggregate_stats_coroutine(void *cookie)
 {
     struct ind_core_aggregate_stats_state *state = cookie;
-    indigo_error_t rv;
-
-    if (entry != NULL) {
-        indigo_fi_flow_stats_t flow_stats = {
-            .flow_id = entry->id,
-            .duration_ns = 0,
-            .packets = -1,
-            .bytes = -1,
-        };
-
-        ind_core_table_t *table = ind_core_table_get(entry->table_id);
-        if (table != NULL) {
-            rv = table->ops->entry_stats_get(table->priv, entry->priv, &flow_stats);
-        } else {
-            rv = indigo_fwd_flow_stats_get(entry->id, &flow_stats);
-        }
-
-        if (rv != INDIGO_ERROR_NONE) {
-            LOG_ERROR("Failed to get stats for flow "INDIGO_FLOW_ID_PRINTF_FORMAT": %s",
-                      entry->id, indigo_strerror(rv));
-            return;
+    indigo_fi_flow_stats_t flow_stats[IND_CORE_TABLE_BATCH_MAX];
+    indigo_error_t results[IND_CORE_TABLE_BATCH_MAX];
+    ft_entry_t *entries[IND_CORE_TABLE_BATCH_MAX];
+    uint64_t packets = 0, bytes = 0;
+    uint32_t flows = 0;
+    ft_iterator_t iter;
+    int count, i;
+
+    ft_iterator_init_snapshot(&iter, ind_core_ft, &state->query);
+    do {
+        ind_core_table_pending_flush();
+        for (count = 0; count < IND_CORE_TABLE_BATCH_MAX; count++) {
+            if ((entries[count] = ft_iterator_next(&iter)) == NULL) {
+                break;
+            }
         }
-
-        state->bytes += flow_stats.bytes;
-        state->packets += flow_stats.packets;
-        state->flows += 1;
-    } else {
-        uint32_t xid;
-        of_aggregate_stats_reply_t* reply;
-        of_aggregate_stats_request_xid_get(state->req, &xid);
-        reply = of_aggregate_stats_reply_new(state->req->version);
-        if (reply != NULL) {
-            of_aggregate_stats_reply_xid_set(reply, xid);
-            of_aggregate_stats_reply_byte_count_set(reply, state->bytes);
-            of_aggregate_stats_reply_packet_count_set(reply, state->packets);
-            of_aggregate_stats_reply_flow_count_set(reply, state->flows);
-            indigo_cxn_send_controller_message(state->cxn_id, reply);
-        } else {
-            LOG_ERROR("Failed to allocate aggregate stats reply.");
+        ind_core_entries_stats_get(entries, count, flow_stats, results);
+        for (i = 0; i < count; i++) {
+            if (results[i] == INDIGO_ERROR_NONE) {
+                bytes += flow_stats[i].bytes;
+                packets += flow_stats[i].packets;
+                flows += 1;
+            }
         }
-        of_aggregate_stats_request_delete(state->req);
-        aim_free(state);
-    }
+        ind_soc_coroutine_maybe_yield();
+    } while (count == IND_CORE_TABLE_BATCH_MAX);
+    ft_iterator_cleanup(&iter);
+
+    ind_core_aggregate_stats_reply_send(state->cxn_id, state->req,
+                                        packets, bytes, flows);
+    indigo_fwd_flow_stats_bulk_end();
+    of_aggregate_stats_request_delete(state->req);
+    aim_free(state);
 }
 
 /**
@@ -1027,6 +1855,8 @@ ind_core_aggregate_stats_request_handler(of_object_t *_obj,
     of_aggregate_stats_request_t *obj = _obj;
     of_meta_match_t query;
     struct ind_core_aggregate_stats_state *state;
+    uint64_t packets, bytes;
+    uint32_t flows;
     indigo_error_t rv;
 
     /* Set up the query structure */
@@ -1040,22 +1870,30 @@ ind_core_aggregate_stats_request_handler(of_object_t *_obj,
     if (obj->version >= OF_VERSION_1_1) {
         of_aggregate_stats_request_cookie_get(obj, &query.cookie);
         of_aggregate_stats_request_cookie_mask_get(obj, &query.cookie_mask);
+        of_aggregate_stats_request_out_group_get(obj, &query.out_group);
+        query.check_out_group = query.out_group != OF_GROUP_ANY;
     }
 
     /* Non strict; do not check priority or overlap */
     query.mode = OF_MATCH_NON_STRICT;
 
+    if (ind_core_aggregate_stats_cached(&query, &packets, &bytes, &flows)) {
+        ind_core_aggregate_stats_reply_send(cxn_id, obj, packets, bytes, flows);
+        return;
+    }
+
     state = aim_malloc(sizeof(*state));
     state->cxn_id = cxn_id;
-    state->req = ind_core_dup_tracking(obj, cxn_id);
-    state->packets = 0;
-    state->bytes = 0;
-    state->flows = 0;
+    state->req = ind_core_claim_tracking(obj, cxn_id);
+    state->query = query;
+
+    indigo_fwd_flow_stats_bulk_begin(query.table_id);
 
-    rv = ft_spawn_iter_task(ind_core_ft, &query, ind_core_aggregate_stats_iter,
-                            state, IND_SOC_DEFAULT_PRIORITY);
+    rv = ind_soc_coroutine_spawn(ind_core_aggregate_stats_coroutine, state,
+                                 IND_SOC_DEFAULT_PRIORITY);
     if (rv != INDIGO_ERROR_NONE) {
         LOG_ERROR("Failed to start aggregate stats iter: %s", indigo_strerror(rv));
+        indigo_fwd_flow_stats_bulk_end();
         of_object_delete(state->req);
         aim_free(state);
         return;
@@ -1079,6 +1917,10 @@ ind_core_desc_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     uint32_t xid;
     ind_core_desc_stats_t *data;
 
+    if (ind_core_reply_cache_send(IND_CORE_REPLY_CACHE_DESC, obj, cxn_id)) {
+        return;
+    }
+
     /* Create reply and send to controller */
     if ((reply = of_desc_stats_reply_new(obj->version)) == NULL) {
         LOG_ERROR("Failed to create desc stats reply message");
@@ -1096,6 +1938,7 @@ ind_core_desc_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     of_desc_stats_reply_serial_num_set(reply, data->serial_num);
     of_desc_stats_reply_flags_set(reply, 0);
 
+    ind_core_reply_cache_store(IND_CORE_REPLY_CACHE_DESC, obj, reply);
     indigo_cxn_send_controller_message(cxn_id, reply);
 }
 
@@ -1115,6 +1958,10 @@ ind_core_table_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     of_table_stats_request_t *reply = NULL;
     indigo_error_t rv;
 
+    if (ind_core_reply_cache_send(IND_CORE_REPLY_CACHE_TABLE_STATS, obj, cxn_id)) {
+        return;
+    }
+
     rv = indigo_fwd_table_stats_get(obj, &reply);
     if (rv < 0) {
         LOG_ERROR("Table stats failed: %s", indigo_strerror(rv));
@@ -1122,6 +1969,7 @@ ind_core_table_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
         return;
     }
 
+    ind_core_reply_cache_store(IND_CORE_REPLY_CACHE_TABLE_STATS, obj, reply);
     indigo_cxn_send_controller_message(cxn_id, reply);
 }
 
@@ -1141,6 +1989,10 @@ ind_core_port_desc_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_
     of_port_desc_stats_request_t *obj = _obj;
     of_port_desc_stats_reply_t *reply;
 
+    if (ind_core_reply_cache_send(IND_CORE_REPLY_CACHE_PORT_DESC, obj, cxn_id)) {
+        return;
+    }
+
     /* Generate a port_desc_stats reply and send to controller */
     if ((reply = of_port_desc_stats_reply_new(obj->version)) == NULL) {
         LOG_ERROR("Failed to create port_desc_stats reply message");
@@ -1149,91 +2001,35 @@ ind_core_port_desc_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_
 
     of_port_desc_stats_request_xid_get(obj, &xid);
     of_port_desc_stats_reply_xid_set(reply, xid);
-    indigo_port_desc_stats_get(reply);
+    if (indigo_port_desc_stats_get(reply) == INDIGO_ERROR_NONE) {
+        ind_core_reply_cache_store(IND_CORE_REPLY_CACHE_PORT_DESC, obj, reply);
+    }
 
     indigo_cxn_send_controller_message(cxn_id, reply);
 }
-#ifdef OFDPA_FIXUP
 /****************************************************************/
 
 /**
- * Handle a experimenter_stats_request message
+ * Handle an experimenter_stats_request message
  * @param cxn_id Connection handler for the owning connection
  * @param _obj Generic type object for the message to be coerced
- * @returns Error code
+ *
+ * Only registered handlers serve experimenter multiparts; see
+ * indigo_core_experimenter_register.
  */
 void
 ind_core_experimenter_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
 {
-  uint32_t xid;
-  uint32_t experimenter_id;
-  of_experimenter_multipart_request_ofdpa_t *obj = _obj;
-
-  uint32_t subtype;
-  
-  ofdpa_mpls_set_qos_action_multipart_request_t *ofdpa_mpls_set_qos_action_multipart_request;
-  ofdpa_mpls_set_qos_action_multipart_reply_t ofdpa_mpls_set_qos_action_multipart_reply;
-  
-  ofdpa_oam_dataplane_ctr_multipart_request_t *ofdpa_oam_dataplane_ctr_multipart_request;
-  ofdpa_oam_dataplane_ctr_multipart_reply_t ofdpa_oam_dataplane_ctr_multipart_reply;
-  
-  ofdpa_oam_drop_status_multipart_request_t *ofdpa_oam_drop_status_multipart_request;
-  ofdpa_oam_drop_status_multipart_reply_t ofdpa_oam_drop_status_multipart_reply;
-  
-  ofdpa_mpls_vpn_label_remark_action_multipart_request_t *ofdpa_mpls_vpn_label_remark_action_multipart_request;
-  ofdpa_mpls_vpn_label_remark_action_multipart_reply_t ofdpa_mpls_vpn_label_remark_action_multipart_reply;
- 
-  of_experimenter_multipart_request_ofdpa_experimenter_get(obj, &experimenter_id);
-  if(experimenter_id != 0x1018)
-  {
-    LOG_ERROR("Wrong experimenter id 0x%x", experimenter_id);
-  }
-   
-  of_experimenter_ofdpa_subtype_get(obj, &xid);
-  of_experimenter_ofdpa_subtype_get(obj, &subtype);
-
-  switch(subtype)
-  {
-    case 1: //OFDPA_ACTION_TABLE_TYPE_MPLS_SET_QOS
-      ofdpa_mpls_set_qos_action_multipart_request = _obj;
-      
-      indigo_set_mpls_qos_get_multipart(ofdpa_mpls_set_qos_action_multipart_request, 
-        &ofdpa_mpls_set_qos_action_multipart_reply);
-      
-      ofdpa_mpls_set_qos_action_multipart_reply_xid_set(&ofdpa_mpls_set_qos_action_multipart_reply, xid);
-      indigo_cxn_send_controller_message(cxn_id, &ofdpa_mpls_set_qos_action_multipart_reply);
-      break;
-      
-    case 2: //OFDPA_ACTION_TABLE_TYPE_OAM_DATAPLANE_COUNTER
-      ofdpa_oam_dataplane_ctr_multipart_request = _obj;
-      indigo_oam_dataplane_get_multipart(ofdpa_oam_dataplane_ctr_multipart_request, 
-        &ofdpa_oam_dataplane_ctr_multipart_reply);
-      ofdpa_oam_dataplane_ctr_multipart_reply_xid_set(&ofdpa_oam_dataplane_ctr_multipart_reply, xid);
-      indigo_cxn_send_controller_message(cxn_id, &ofdpa_oam_dataplane_ctr_multipart_reply);      
-      break;
-      
-    case 3: //OFDPA_ACTION_TABLE_TYPE_DROP_STATUS
-      ofdpa_oam_drop_status_multipart_request = _obj;
-      indigo_drop_status_get_multipart(ofdpa_oam_drop_status_multipart_request, 
-        &ofdpa_oam_drop_status_multipart_reply);
-      ofdpa_oam_drop_status_multipart_reply_xid_set(&ofdpa_oam_drop_status_multipart_reply, xid);
-      indigo_cxn_send_controller_message(cxn_id, &ofdpa_oam_drop_status_multipart_reply);      
-      break;
-      
-    case 4: //OFDPA_ACTION_TABLE_TYPE_MPLS_VPN_LABEL_REMARK
-    case 5: //OFDPA_ACTION_TABLE_TYPE_MPLS_TUNNEL_LABEL_REMARK
-    case 6: //OFDPA_ACTION_TABLE_TYPE_L2_INTERFACE_REMARK
-      ofdpa_mpls_vpn_label_remark_action_multipart_request = _obj;
-      indigo_remark_action_get_multipart(ofdpa_mpls_vpn_label_remark_action_multipart_request, 
-        &ofdpa_mpls_vpn_label_remark_action_multipart_reply);
-      ofdpa_mpls_set_qos_action_multipart_reply_xid_set(&ofdpa_mpls_vpn_label_remark_action_multipart_reply, xid);
-      indigo_cxn_send_controller_message(cxn_id, &ofdpa_mpls_vpn_label_remark_action_multipart_reply);      
-      break;
-    default:
-      LOG_ERROR("experimenter subtype 0x%x unsupported", subtype);
-  }
+    if (ind_core_experimenter_dispatch(INDIGO_CORE_EXPERIMENTER_MULTIPART,
+                                       _obj, cxn_id)) {
+        return;
+    }
+
+    indigo_cxn_send_error_reply(
+            cxn_id, _obj,
+            OF_ERROR_TYPE_BAD_REQUEST,
+            OF_REQUEST_FAILED_BAD_EXPERIMENTER);
 }
-#endif
 /****************************************************************/
 /**
  * Handle a features_request message
@@ -1250,6 +2046,10 @@ ind_core_features_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     uint32_t xid;
     of_dpid_t dpid;
 
+    if (ind_core_reply_cache_send(IND_CORE_REPLY_CACHE_FEATURES, obj, cxn_id)) {
+        return;
+    }
+
     /* Generate a features reply and send to controller */
     if ((reply = of_features_reply_new(obj->version)) == NULL) {
         LOG_ERROR("Failed to create features reply message");
@@ -1264,6 +2064,7 @@ ind_core_features_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     _TRY_NR(indigo_fwd_forwarding_features_get(reply));
     _TRY_NR(indigo_port_features_get(reply));
 
+    ind_core_reply_cache_store(IND_CORE_REPLY_CACHE_FEATURES, obj, reply);
     indigo_cxn_send_controller_message(cxn_id, reply);
 }
 
@@ -1293,8 +2094,9 @@ ind_core_set_config_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
  * @param _obj Generic type object for the message to be coerced
  * @returns Error code
  *
- * The state manager has no specific support for experimenter messages.
- * However, the port or forwarding modules may have that support
+ * Handlers registered for the experimenter and subtype are tried first;
+ * see indigo_core_experimenter_register. Otherwise the port or
+ * forwarding modules may have support for the message
  * independent of the state manager.  For this reason, the state
  * manager calls both the port manager and forwarding modules with
  * the request.
@@ -1326,6 +2128,13 @@ ind_core_experimenter_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
     indigo_error_t port_rv;
     indigo_error_t rv = INDIGO_ERROR_NONE;
 
+    if (ind_core_flow_counters_handle(obj, cxn_id) ||
+            ind_core_flow_monitor_handle(obj, cxn_id) ||
+            ind_core_experimenter_dispatch(INDIGO_CORE_EXPERIMENTER_MESSAGE,
+                                           obj, cxn_id)) {
+        return;
+    }
+
     /* Handle object of type of_experimenter_t */
     if ((fwd_rv = indigo_fwd_experimenter(obj, cxn_id)) < 0) {
         LOG_TRACE("Error from fwd_experimenter: %s", indigo_strerror(fwd_rv));
@@ -1578,24 +2387,169 @@ ind_core_bsn_sw_pipeline_stats_request_handler(of_object_t *_obj,
     indigo_cxn_send_controller_message(cxn_id, reply);
 }
 
+/**
+ * Handle a BSN table checksum stats request
+ * @param cxn_id Connection handler for the owning connection
+ * @param _obj Generic type object for the message to be coerced
+ *
+ * Reports the flow checksum of each table holding entries.
+ */
+
+void
+ind_core_bsn_table_checksum_stats_request_handler(of_object_t *_obj,
+                                                  indigo_cxn_id_t cxn_id)
+{
+    of_bsn_table_checksum_stats_request_t *obj = _obj;
+    of_bsn_table_checksum_stats_reply_t *reply;
+    of_list_bsn_table_checksum_stats_entry_t entries;
+    of_bsn_table_checksum_stats_entry_t entry;
+    uint32_t xid;
+    int table_id;
+
+    if ((reply = of_bsn_table_checksum_stats_reply_new(obj->version)) == NULL) {
+        LOG_ERROR("Failed to create table checksum stats reply message");
+        return;
+    }
+
+    of_bsn_table_checksum_stats_request_xid_get(obj, &xid);
+    of_bsn_table_checksum_stats_reply_xid_set(reply, xid);
+    of_bsn_table_checksum_stats_reply_entries_bind(reply, &entries);
+
+    for (table_id = 0; table_id < FT_TABLE_LIST_COUNT; table_id++) {
+        if (list_empty(&ind_core_ft->table_lists[table_id])) {
+            continue;
+        }
+
+        of_bsn_table_checksum_stats_entry_init(&entry, reply->version, -1, 1);
+        if (of_list_bsn_table_checksum_stats_entry_append_bind(&entries, &entry)) {
+            LOG_ERROR("Failed to append to table checksum stats list");
+            break;
+        }
+        of_bsn_table_checksum_stats_entry_table_id_set(&entry, table_id);
+        of_bsn_table_checksum_stats_entry_checksum_set(
+            &entry, ind_core_ft->checksum_tables[table_id].checksum);
+    }
+
+    indigo_cxn_send_controller_message(cxn_id, reply);
+}
+
+/**
+ * Handle a BSN flow checksum bucket stats request
+ * @param cxn_id Connection handler for the owning connection
+ * @param _obj Generic type object for the message to be coerced
+ *
+ * Replies with the checksum of every bucket of the table, split over
+ * as many messages as needed.
+ */
+
+void
+ind_core_bsn_flow_checksum_bucket_stats_request_handler(of_object_t *_obj,
+                                                        indigo_cxn_id_t cxn_id)
+{
+    of_bsn_flow_checksum_bucket_stats_request_t *obj = _obj;
+    of_bsn_flow_checksum_bucket_stats_reply_t *reply;
+    of_list_bsn_flow_checksum_bucket_stats_entry_t entries;
+    of_bsn_flow_checksum_bucket_stats_entry_t entry;
+    of_list_builder_t builder;
+    ft_checksum_table_t *table;
+    uint32_t xid;
+    uint8_t table_id;
+    uint32_t i;
+
+    of_bsn_flow_checksum_bucket_stats_request_xid_get(obj, &xid);
+    of_bsn_flow_checksum_bucket_stats_request_table_id_get(obj, &table_id);
+    table = &ind_core_ft->checksum_tables[table_id];
+
+    if ((reply = of_bsn_flow_checksum_bucket_stats_reply_new(obj->version)) == NULL) {
+        LOG_ERROR("Failed to create flow checksum bucket stats reply message");
+        return;
+    }
+    of_bsn_flow_checksum_bucket_stats_reply_xid_set(reply, xid);
+    of_bsn_flow_checksum_bucket_stats_reply_entries_bind(reply, &entries);
+    of_list_builder_start(&builder, &entries);
+
+    for (i = 0; i < table->buckets_size; i++) {
+        of_bsn_flow_checksum_bucket_stats_entry_init(&entry, reply->version, -1, 1);
+        if (of_list_bsn_flow_checksum_bucket_stats_entry_append_bind(&entries, &entry)) {
+            of_list_builder_finish(&builder);
+            of_bsn_flow_checksum_bucket_stats_reply_flags_set(
+                reply, OF_STATS_REPLY_FLAG_REPLY_MORE);
+            indigo_cxn_send_controller_message(cxn_id, reply);
+
+            if ((reply = of_bsn_flow_checksum_bucket_stats_reply_new(obj->version)) == NULL) {
+                LOG_ERROR("Failed to create flow checksum bucket stats reply message");
+                return;
+            }
+            of_bsn_flow_checksum_bucket_stats_reply_xid_set(reply, xid);
+            of_bsn_flow_checksum_bucket_stats_reply_entries_bind(reply, &entries);
+            of_list_builder_start(&builder, &entries);
+
+            if (of_list_bsn_flow_checksum_bucket_stats_entry_append_bind(&entries, &entry)) {
+                AIM_DIE("unexpected failure appending to an empty bucket stats list");
+            }
+        }
+        of_bsn_flow_checksum_bucket_stats_entry_checksum_set(&entry, table->buckets[i]);
+    }
+    of_list_builder_finish(&builder);
+
+    indigo_cxn_send_controller_message(cxn_id, reply);
+}
+
+/**
+ * Handle a BSN table set buckets size message
+ * @param cxn_id Connection handler for the owning connection
+ * @param _obj Generic type object for the message to be coerced
+ */
+
+void
+ind_core_bsn_table_set_buckets_size_handler(of_object_t *_obj,
+                                            indigo_cxn_id_t cxn_id)
+{
+    of_bsn_table_set_buckets_size_t *obj = _obj;
+    uint16_t table_id;
+    uint32_t buckets_size;
+
+    of_bsn_table_set_buckets_size_table_id_get(obj, &table_id);
+    of_bsn_table_set_buckets_size_buckets_size_get(obj, &buckets_size);
+
+    if (table_id >= FT_TABLE_LIST_COUNT) {
+        LOG_ERROR("Invalid table id %d for checksum buckets", table_id);
+        indigo_cxn_send_error_reply(cxn_id, obj,
+                                    OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_BAD_TABLE_ID);
+        return;
+    }
+
+    if (ft_checksum_buckets_size_set(ind_core_ft, table_id, buckets_size) < 0) {
+        LOG_ERROR("Invalid checksum buckets size %u for table %d",
+                  buckets_size, table_id);
+        indigo_cxn_send_error_reply(cxn_id, obj,
+                                    OF_ERROR_TYPE_BAD_REQUEST,
+                                    OF_REQUEST_FAILED_EPERM);
+    }
+}
+
 /*================METER TABLE======================================*/
 #ifdef OFDPA_FIXUP
-#include <BigHash/bighash.h>
+/*
+ * The bands are kept as last programmed, so a modify repeating them is
+ * answered without translating or programming anything. Flows using a
+ * meter are found through the flowtable's meter index; see
+ * ft_meter_ref_foreach.
+ */
 typedef struct ind_core_meter_s {
-    bighash_entry_t hash_entry;
     uint32_t id;
     uint32_t flag;
-    of_list_meter_band_t *meters;
+    of_list_meter_band_t *meters;  /* Band cache */
     indigo_time_t creation_time;
 } ind_core_meter_t;
 
 #define TEMPLATE_NAME meter_hashtable
 #define TEMPLATE_OBJ_TYPE ind_core_meter_t
 #define TEMPLATE_KEY_FIELD id
-#define TEMPLATE_ENTRY_FIELD hash_entry
-#include <BigHash/bighash_template.h>
+#include <BigHash/bighash_intkey_template.h>
 
-static bighash_table_t *ind_core_meter_hashtable;
+static bighash_intkey_table_t *ind_core_meter_hashtable;
 
 static ind_core_meter_t *
 ind_core_meter_lookup(uint32_t id)
@@ -1603,15 +2557,61 @@ ind_core_meter_lookup(uint32_t id)
     return meter_hashtable_first(ind_core_meter_hashtable, &id);
 }
 
+static void
+ind_core_meter_insert(uint32_t id, uint16_t flag, of_list_meter_band_t *meters)
+{
+    ind_core_meter_t *meter;
+
+    meter = aim_malloc(sizeof(*meter));
+    meter->id = id;
+    meter->flag = flag;
+    meter->meters = of_object_dup(meters);
+    AIM_TRUE_OR_DIE(meter->meters != NULL);
+    meter->creation_time = INDIGO_CURRENT_TIME;
+
+    meter_hashtable_insert(ind_core_meter_hashtable, meter);
+
+    ind_core_snapshot_meter_write(id, flag, meter->meters);
+}
+
+/* True if the flags and bands are those the meter was programmed with */
+static int
+ind_core_meter_bands_equal(ind_core_meter_t *meter, uint16_t flag,
+                           of_list_meter_band_t *meters)
+{
+    return meter->flag == flag &&
+        meter->meters->length == meters->length &&
+        memcmp(OF_OBJECT_BUFFER_INDEX(meter->meters, 0),
+               OF_OBJECT_BUFFER_INDEX(meters, 0), meters->length) == 0;
+}
+
+static void
+ind_core_meter_flow_delete(void *cookie, ft_entry_t *entry)
+{
+    ind_core_flow_entry_delete(entry, INDIGO_FLOW_REMOVED_DELETE);
+}
+
+/* Drop a meter from the table once forwarding no longer has it */
+static void
+ind_core_meter_free(ind_core_meter_t *meter)
+{
+    ind_core_snapshot_meter_erase(meter->id);
+    of_object_delete(meter->meters);
+    meter_hashtable_remove(ind_core_meter_hashtable, meter);
+    aim_free(meter);
+}
+
 static indigo_error_t
 ind_core_meter_delete_one(ind_core_meter_t *meter)
 {
     indigo_error_t result;
+
+    /* Flows metered by a deleted meter are removed with it */
+    ft_meter_ref_foreach(ind_core_ft, meter->id, ind_core_meter_flow_delete, NULL);
+
     result = indigo_fwd_meter_delete(meter->id);
     if (result >= 0) {
-      of_object_delete(meter->meters);
-      bighash_remove(ind_core_meter_hashtable, &meter->hash_entry);
-      aim_free(meter);
+      ind_core_meter_free(meter);
     }
     return result;
 }
@@ -1653,14 +2653,7 @@ ind_core_meter_add_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
         goto error;
     }
 
-    meter = aim_malloc(sizeof(*meter));
-    meter->id = id;
-    meter->flag = flag;
-    meter->meters = of_object_dup(&meters);
-    AIM_TRUE_OR_DIE(meter->meters != NULL);
-    meter->creation_time = INDIGO_CURRENT_TIME;
-
-    meter_hashtable_insert(ind_core_meter_hashtable, meter);
+    ind_core_meter_insert(id, flag, &meters);
 
     return;
 
@@ -1695,6 +2688,10 @@ ind_core_meter_modify_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
         goto error;
     }
 
+    if (ind_core_meter_bands_equal(meter, flag, &meters)) {
+        return;
+    }
+
     if (meter->flag == flag) {
         result = indigo_fwd_meter_modify(id, flag, &meters);
         if (result < 0) {
@@ -1721,6 +2718,8 @@ ind_core_meter_modify_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     meter->meters = of_object_dup(&meters);
     AIM_TRUE_OR_DIE(meter->meters != NULL);
 
+    ind_core_snapshot_meter_write(id, flag, meter->meters);
+
     return;
 
 error:
@@ -1746,9 +2745,9 @@ ind_core_meter_delete_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
     }
 
     if (id == OF_METER_ALL) {
-        bighash_iter_t iter;
-        for (meter = bighash_iter_start(ind_core_meter_hashtable, &iter);
-                meter; meter = bighash_iter_next(&iter)) {
+        bighash_intkey_iter_t iter;
+        for (meter = bighash_intkey_iter_start(ind_core_meter_hashtable, &iter);
+                meter; meter = bighash_intkey_iter_next(&iter)) {
             result = ind_core_meter_delete_one(meter);
             if (result < 0) {
                 err_code = OF_METER_MOD_FAILED_INVALID_METER;
@@ -1772,10 +2771,220 @@ error:
     indigo_cxn_send_error_reply(cxn_id, obj, err_type, err_code);
 }
 
+static void
+ind_core_meter_stats_entry_populate(of_meter_stats_t *entry,
+                                    ind_core_meter_t *meter,
+                                    indigo_time_t current_time)
+{
+    uint32_t duration_sec, duration_nsec;
+    of_list_meter_band_stats_t band_stats;
+    of_meter_band_stats_t band_stat;
+    of_meter_band_t band;
+    int rv;
+
+    of_meter_stats_meter_id_set(entry, meter->id);
+
+    calc_duration(current_time, meter->creation_time, &duration_sec, &duration_nsec);
+    of_meter_stats_duration_sec_set(entry, duration_sec);
+    of_meter_stats_duration_nsec_set(entry, duration_nsec);
+
+    /* Flows using the meter, from the reverse index */
+    of_meter_stats_flow_count_set(entry,
+        ft_meter_ref_foreach(ind_core_ft, meter->id, NULL, NULL));
+
+    /* Default to "counter not supported" */
+    of_meter_stats_packet_in_count_set(entry, (uint64_t)-1);
+    of_meter_stats_byte_in_count_set(entry, (uint64_t)-1);
+
+    /* One band stats entry per band, in band order */
+    of_meter_stats_band_stats_bind(entry, &band_stats);
+    OF_LIST_METER_BAND_ITER(meter->meters, &band, rv) {
+        of_meter_band_stats_init(&band_stat, entry->version, -1, 1);
+        if (of_list_meter_band_stats_append_bind(&band_stats, &band_stat) < 0) {
+            break;
+        }
+        of_meter_band_stats_packet_band_count_set(&band_stat, (uint64_t)-1);
+        of_meter_band_stats_byte_band_count_set(&band_stat, (uint64_t)-1);
+    }
+
+    indigo_fwd_meter_stats_get(meter->id, entry);
+}
+
+/* Replies too long for one message are split with REPLY_MORE */
+void
+ind_core_meter_stats_request_handler(of_object_t *_obj, indigo_cxn_id_t cxn_id)
+{
+    of_meter_stats_request_t *obj = _obj;
+    of_meter_stats_reply_t *reply;
+    of_list_meter_stats_t entries;
+    of_list_builder_t builder;
+    of_meter_stats_t *entry;
+    uint32_t xid;
+    uint32_t id;
+    indigo_time_t current_time = INDIGO_CURRENT_TIME;
+
+    of_meter_stats_request_meter_id_get(obj, &id);
+
+    reply = of_meter_stats_reply_new(obj->version);
+    AIM_TRUE_OR_DIE(reply != NULL);
+
+    of_meter_stats_request_xid_get(obj, &xid);
+    of_meter_stats_reply_xid_set(reply, xid);
+    of_meter_stats_reply_entries_bind(reply, &entries);
+    of_list_builder_start(&builder, &entries);
+
+    entry = of_meter_stats_new(entries.version);
+    AIM_TRUE_OR_DIE(entry != NULL);
+
+    if (id == OF_METER_ALL) {
+        bighash_intkey_iter_t iter;
+        ind_core_meter_t *meter;
+        for (meter = bighash_intkey_iter_start(ind_core_meter_hashtable, &iter);
+                meter; meter = bighash_intkey_iter_next(&iter)) {
+            ind_core_meter_stats_entry_populate(entry, meter, current_time);
+
+            if (of_list_append(&entries, entry) < 0) {
+                /* This entry didn't fit, send out the current message and
+                 * allocate a new one. */
+                of_list_builder_finish(&builder);
+                of_meter_stats_reply_flags_set(reply, OF_STATS_REPLY_FLAG_REPLY_MORE);
+                indigo_cxn_send_controller_message(cxn_id, reply);
+
+                reply = of_meter_stats_reply_new(obj->version);
+                AIM_TRUE_OR_DIE(reply != NULL);
+
+                of_meter_stats_reply_xid_set(reply, xid);
+                of_meter_stats_reply_entries_bind(reply, &entries);
+                of_list_builder_start(&builder, &entries);
+
+                if (of_list_append(&entries, entry) < 0) {
+                    AIM_DIE("unexpected failure appending single meter stats entry");
+                }
+            }
+
+            /* HACK unable to truncate existing object */
+            of_object_delete(entry);
+            entry = of_meter_stats_new(entries.version);
+            AIM_TRUE_OR_DIE(entry != NULL);
+        }
+    } else if (id <= OF_METER_MAX) {
+        ind_core_meter_t *meter = ind_core_meter_lookup(id);
+        if (meter != NULL) {
+            ind_core_meter_stats_entry_populate(entry, meter, current_time);
+
+            if (of_list_append(&entries, entry) < 0) {
+                AIM_DIE("unexpected failure appending single meter stats entry");
+            }
+        }
+    }
+
+    of_object_delete(entry);
+    of_list_builder_finish(&builder);
+
+    indigo_cxn_send_controller_message(cxn_id, reply);
+}
+
+/**
+ * Install a meter from a snapshot, replacing any meter with its ID
+ *
+ * Forwarding is expected to have the meter already.
+ */
+indigo_error_t
+ind_core_meter_snapshot_load(of_meter_add_t *meter_add)
+{
+    uint16_t flag;
+    uint32_t id;
+    of_list_meter_band_t meters;
+
+    of_meter_add_flags_get(meter_add, &flag);
+    of_meter_add_meter_id_get(meter_add, &id);
+    of_meter_add_meters_bind(meter_add, &meters);
+
+    if (id > OF_METER_MAX) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    ind_core_meter_snapshot_unload(id);
+    ind_core_meter_insert(id, flag, &meters);
+
+    return INDIGO_ERROR_NONE;
+}
+
+/**
+ * Drop a meter loaded from a snapshot, or every meter for OF_METER_ALL
+ *
+ * Forwarding is not told.
+ */
+void
+ind_core_meter_snapshot_unload(uint32_t id)
+{
+    ind_core_meter_t *meter;
+    bighash_intkey_iter_t iter;
+
+    if (id != OF_METER_ALL) {
+        if ((meter = ind_core_meter_lookup(id)) != NULL) {
+            ind_core_meter_free(meter);
+        }
+        return;
+    }
+
+    for (meter = bighash_intkey_iter_start(ind_core_meter_hashtable, &iter);
+         meter != NULL;
+         meter = bighash_intkey_iter_next(&iter)) {
+        ind_core_meter_free(meter);
+    }
+}
+
+/**
+ * Write every meter to the open snapshot
+ */
+void
+ind_core_meter_snapshot_save(void)
+{
+    ind_core_meter_t *meter;
+    bighash_intkey_iter_t iter;
+
+    for (meter = bighash_intkey_iter_start(ind_core_meter_hashtable, &iter);
+         meter != NULL;
+         meter = bighash_intkey_iter_next(&iter)) {
+        ind_core_snapshot_meter_write(meter->id, meter->flag, meter->meters);
+    }
+}
+
+/**
+ * Number of meters in the meter table
+ */
+int
+ind_core_meter_count(void)
+{
+    return bighash_intkey_count(ind_core_meter_hashtable);
+}
+
+/**
+ * Heap bytes held by the meter table, including the band lists
+ */
+uint64_t
+ind_core_meter_memory(void)
+{
+    ind_core_meter_t *meter;
+    bighash_intkey_iter_t iter;
+    uint64_t bytes;
+
+    bytes = bighash_intkey_table_bytes(ind_core_meter_hashtable);
+
+    for (meter = bighash_intkey_iter_start(ind_core_meter_hashtable, &iter);
+         meter != NULL;
+         meter = bighash_intkey_iter_next(&iter)) {
+        bytes += sizeof(*meter) + IND_CORE_DUP_BYTES(meter->meters);
+    }
+
+    return bytes;
+}
+
 void
 ind_core_meter_init(void)
 {
-    ind_core_meter_hashtable = bighash_table_create(1024);
+    ind_core_meter_hashtable = bighash_intkey_table_create(1024);
     AIM_TRUE_OR_DIE(ind_core_meter_hashtable != NULL);
 }
 #endif
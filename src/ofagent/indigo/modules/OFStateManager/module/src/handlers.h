@@ -99,28 +99,9 @@ extern void ind_core_group_desc_stats_request_handler(
 extern void ind_core_group_features_stats_request_handler(
     of_object_t *_obj,
     indigo_cxn_id_t cxn);
-#ifdef OFDPA_FIXUP
 extern void ind_core_experimenter_stats_request_handler(
     of_object_t *_obj,
     indigo_cxn_id_t cxn);
- 
-extern void indigo_set_mpls_qos_get_multipart(
-    ofdpa_mpls_set_qos_action_multipart_request_t *request, 
-    ofdpa_mpls_set_qos_action_multipart_reply_t *reply);
-
-extern void indigo_oam_dataplane_get_multipart(
-    ofdpa_oam_dataplane_ctr_multipart_request_t *request , 
-    ofdpa_oam_dataplane_ctr_multipart_reply_t *reply);
-
-extern void indigo_drop_status_get_multipart(
-    ofdpa_oam_drop_status_multipart_request_t *request , 
-    ofdpa_oam_drop_status_multipart_reply_t *reply);
-
-extern void indigo_remark_action_get_multipart(
-    ofdpa_mpls_vpn_label_remark_action_multipart_request_t *request, 
-    ofdpa_mpls_vpn_label_remark_action_multipart_reply_t *reply);      
-    
-#endif   
 extern void ind_core_bsn_get_ip_mask_request_handler(
     of_object_t *_obj,
     indigo_cxn_id_t cxn_id);
@@ -139,6 +120,15 @@ extern void ind_core_bsn_sw_pipeline_set_request_handler(
 extern void ind_core_bsn_sw_pipeline_stats_request_handler(
     of_object_t *_obj,
     indigo_cxn_id_t cxn_id);
+extern void ind_core_bsn_table_checksum_stats_request_handler(
+    of_object_t *_obj,
+    indigo_cxn_id_t cxn_id);
+extern void ind_core_bsn_flow_checksum_bucket_stats_request_handler(
+    of_object_t *_obj,
+    indigo_cxn_id_t cxn_id);
+extern void ind_core_bsn_table_set_buckets_size_handler(
+    of_object_t *_obj,
+    indigo_cxn_id_t cxn_id);
 
 /* group_handlers.c */
 void ind_core_group_add_handler(
@@ -171,6 +161,9 @@ void ind_core_meter_modify_handler(
 void ind_core_meter_delete_handler(
     of_object_t *_obj,
     indigo_cxn_id_t cxn_id);
+void ind_core_meter_stats_request_handler(
+    of_object_t *_obj,
+    indigo_cxn_id_t cxn_id);
 #endif
 
 /* bsn_counter_handlers.c */
@@ -180,6 +173,12 @@ void ind_core_bsn_vlan_counter_stats_request_handler(
 void ind_core_bsn_port_counter_stats_request_handler(
     of_object_t *_obj,
     indigo_cxn_id_t cxn_id);
+void ind_core_bsn_debug_counter_desc_stats_request_handler(
+    of_object_t *_obj,
+    indigo_cxn_id_t cxn_id);
+void ind_core_bsn_debug_counter_stats_request_handler(
+    of_object_t *_obj,
+    indigo_cxn_id_t cxn_id);
 
 /* gentable_handlers.c */
 void ind_core_bsn_gentable_entry_add_handler(
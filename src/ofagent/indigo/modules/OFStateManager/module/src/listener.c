@@ -25,44 +25,189 @@
 #include <OFStateManager/ofstatemanager_config.h>
 #include <OFStateManager/ofstatemanager.h>
 #include <indigo/indigo.h>
-#include <BigList/biglist.h>
 
 #include "ofstatemanager_log.h"
 #include "listener.h"
 
-static biglist_t *packet_in_listeners;
-static biglist_t *port_status_listeners;
-static biglist_t *message_listeners;
+/*
+ * Each kind of listener is kept in a fixed array sorted by decreasing
+ * priority, so dispatch is a walk over contiguous entries with no
+ * allocation. Filters are checked before the call.
+ */
+
+#define MESSAGE_FILTER_WORDS ((OF_MESSAGE_OBJECT_COUNT + 31) / 32)
+
+typedef struct listener_s {
+    void *fn;
+    int priority;
+    indigo_core_packet_in_filter_t packet_in_filter;
+    bool message_filtered;
+    uint32_t message_ids[MESSAGE_FILTER_WORDS]; /* Bitmap by object id */
+} listener_t;
+
+typedef struct listener_chain_s {
+    listener_t listeners[INDIGO_CORE_LISTENERS_MAX];
+    int count;
+    uint32_t packet_in_fields; /* Union of the packet-in filter fields */
+} listener_chain_t;
+
+static listener_chain_t packet_in_listeners;
+static listener_chain_t port_status_listeners;
+static listener_chain_t message_listeners;
+
+/* Insert a listener after those of the same or higher priority */
+static listener_t *
+chain_add(listener_chain_t *chain, void *fn, int priority)
+{
+    listener_t *listener;
+    int i, idx;
+
+    for (i = 0; i < chain->count; i++) {
+        if (chain->listeners[i].fn == fn) {
+            return NULL;
+        }
+    }
+
+    if (chain->count == INDIGO_CORE_LISTENERS_MAX) {
+        return NULL;
+    }
+
+    for (idx = 0; idx < chain->count; idx++) {
+        if (chain->listeners[idx].priority < priority) {
+            break;
+        }
+    }
+
+    memmove(&chain->listeners[idx + 1], &chain->listeners[idx],
+            (chain->count - idx) * sizeof(chain->listeners[0]));
+    chain->count++;
+
+    listener = &chain->listeners[idx];
+    memset(listener, 0, sizeof(*listener));
+    listener->fn = fn;
+    listener->priority = priority;
+
+    return listener;
+}
+
+static indigo_error_t
+chain_add_error(listener_chain_t *chain)
+{
+    return chain->count == INDIGO_CORE_LISTENERS_MAX ?
+        INDIGO_ERROR_RESOURCE : INDIGO_ERROR_EXISTS;
+}
+
+static void
+chain_remove(listener_chain_t *chain, void *fn)
+{
+    int i;
+
+    for (i = 0; i < chain->count; i++) {
+        if (chain->listeners[i].fn == fn) {
+            chain->count--;
+            memmove(&chain->listeners[i], &chain->listeners[i + 1],
+                    (chain->count - i) * sizeof(chain->listeners[0]));
+            break;
+        }
+    }
+
+    chain->packet_in_fields = 0;
+    for (i = 0; i < chain->count; i++) {
+        chain->packet_in_fields |= chain->listeners[i].packet_in_filter.fields;
+    }
+}
 
 /* Packet in */
 
 indigo_error_t
-indigo_core_packet_in_listener_register(indigo_core_packet_in_listener_f fn)
+indigo_core_packet_in_listener_register_with_filter(
+    indigo_core_packet_in_listener_f fn,
+    const indigo_core_packet_in_filter_t *filter,
+    int priority)
 {
-    if (biglist_find(packet_in_listeners, fn)) {
-        return INDIGO_ERROR_EXISTS;
+    listener_t *listener;
+
+    listener = chain_add(&packet_in_listeners, fn, priority);
+    if (listener == NULL) {
+        return chain_add_error(&packet_in_listeners);
     }
 
-    packet_in_listeners = biglist_append(packet_in_listeners, fn);
+    if (filter != NULL) {
+        listener->packet_in_filter = *filter;
+        packet_in_listeners.packet_in_fields |= filter->fields;
+    }
 
     return INDIGO_ERROR_NONE;
 }
 
+indigo_error_t
+indigo_core_packet_in_listener_register(indigo_core_packet_in_listener_f fn)
+{
+    return indigo_core_packet_in_listener_register_with_filter(
+        fn, NULL, INDIGO_CORE_LISTENER_PRIORITY_DEFAULT);
+}
+
 void
 indigo_core_packet_in_listener_unregister(indigo_core_packet_in_listener_f fn)
 {
-    packet_in_listeners = biglist_remove(packet_in_listeners, fn);
+    chain_remove(&packet_in_listeners, fn);
+}
+
+/* Ethertype after any VLAN tags, or 0 if the frame is too short */
+static uint16_t
+packet_in_eth_type(of_packet_in_t *packet_in)
+{
+    of_octets_t data;
+    int offset = 12;
+    uint16_t eth_type;
+
+    of_packet_in_data_get(packet_in, &data);
+
+    for (;;) {
+        if (data.bytes < offset + 2) {
+            return 0;
+        }
+        eth_type = (data.data[offset] << 8) | data.data[offset + 1];
+        if (eth_type != 0x8100 && eth_type != 0x88a8) {
+            return eth_type;
+        }
+        offset += 4;
+    }
 }
 
 indigo_core_listener_result_t
 ind_core_packet_in_notify(of_packet_in_t *packet_in)
 {
     indigo_core_listener_result_t result = INDIGO_CORE_LISTENER_RESULT_PASS;
-    biglist_t *cur;
-    indigo_core_packet_in_listener_f fn;
+    listener_chain_t *chain = &packet_in_listeners;
+    uint16_t eth_type = 0;
+    uint8_t table_id = 0;
+    bool has_table_id = packet_in->version >= OF_VERSION_1_1;
+    int i;
 
-    BIGLIST_FOREACH_DATA(cur, packet_in_listeners, indigo_core_packet_in_listener_f, fn) {
-        result |= fn(packet_in);
+    /* Decode only what some filter looks at */
+    if (chain->packet_in_fields & INDIGO_CORE_PACKET_IN_FILTER_ETH_TYPE) {
+        eth_type = packet_in_eth_type(packet_in);
+    }
+    if ((chain->packet_in_fields & INDIGO_CORE_PACKET_IN_FILTER_TABLE_ID) &&
+        has_table_id) {
+        of_packet_in_table_id_get(packet_in, &table_id);
+    }
+
+    for (i = 0; i < chain->count; i++) {
+        listener_t *listener = &chain->listeners[i];
+        indigo_core_packet_in_filter_t *filter = &listener->packet_in_filter;
+
+        if ((filter->fields & INDIGO_CORE_PACKET_IN_FILTER_ETH_TYPE) &&
+            filter->eth_type != eth_type) {
+            continue;
+        }
+        if ((filter->fields & INDIGO_CORE_PACKET_IN_FILTER_TABLE_ID) &&
+            has_table_id && filter->table_id != table_id) {
+            continue;
+        }
+
+        result |= ((indigo_core_packet_in_listener_f)listener->fn)(packet_in);
     }
 
     return result;
@@ -71,32 +216,40 @@ ind_core_packet_in_notify(of_packet_in_t *packet_in)
 /* Port status */
 
 indigo_error_t
-indigo_core_port_status_listener_register(indigo_core_port_status_listener_f fn)
+indigo_core_port_status_listener_register_with_priority(
+    indigo_core_port_status_listener_f fn,
+    int priority)
 {
-    if (biglist_find(port_status_listeners, fn)) {
-        return INDIGO_ERROR_EXISTS;
+    if (chain_add(&port_status_listeners, fn, priority) == NULL) {
+        return chain_add_error(&port_status_listeners);
     }
 
-    port_status_listeners = biglist_append(port_status_listeners, fn);
-
     return INDIGO_ERROR_NONE;
 }
 
+indigo_error_t
+indigo_core_port_status_listener_register(indigo_core_port_status_listener_f fn)
+{
+    return indigo_core_port_status_listener_register_with_priority(
+        fn, INDIGO_CORE_LISTENER_PRIORITY_DEFAULT);
+}
+
 void
 indigo_core_port_status_listener_unregister(indigo_core_port_status_listener_f fn)
 {
-    port_status_listeners = biglist_remove(port_status_listeners, fn);
+    chain_remove(&port_status_listeners, fn);
 }
 
 indigo_core_listener_result_t
 ind_core_port_status_notify(of_port_status_t *port_status)
 {
     indigo_core_listener_result_t result = INDIGO_CORE_LISTENER_RESULT_PASS;
-    biglist_t *cur;
-    indigo_core_port_status_listener_f fn;
+    listener_chain_t *chain = &port_status_listeners;
+    int i;
 
-    BIGLIST_FOREACH_DATA(cur, port_status_listeners, indigo_core_port_status_listener_f, fn) {
-        result |= fn(port_status);
+    for (i = 0; i < chain->count; i++) {
+        result |= ((indigo_core_port_status_listener_f)
+                   chain->listeners[i].fn)(port_status);
     }
 
     return result;
@@ -105,32 +258,68 @@ ind_core_port_status_notify(of_port_status_t *port_status)
 /* Message from controller */
 
 indigo_error_t
-indigo_core_message_listener_register(indigo_core_message_listener_f fn)
+indigo_core_message_listener_register_with_filter(
+    indigo_core_message_listener_f fn,
+    const of_object_id_t *object_ids,
+    int count,
+    int priority)
 {
-    if (biglist_find(message_listeners, fn)) {
-        return INDIGO_ERROR_EXISTS;
+    listener_t *listener;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        if (object_ids[i] < 0 || object_ids[i] >= OF_MESSAGE_OBJECT_COUNT) {
+            return INDIGO_ERROR_PARAM;
+        }
+    }
+
+    listener = chain_add(&message_listeners, fn, priority);
+    if (listener == NULL) {
+        return chain_add_error(&message_listeners);
     }
 
-    message_listeners = biglist_append(message_listeners, fn);
+    if (object_ids != NULL) {
+        listener->message_filtered = true;
+        for (i = 0; i < count; i++) {
+            listener->message_ids[object_ids[i] / 32] |=
+                1U << (object_ids[i] % 32);
+        }
+    }
 
     return INDIGO_ERROR_NONE;
 }
 
+indigo_error_t
+indigo_core_message_listener_register(indigo_core_message_listener_f fn)
+{
+    return indigo_core_message_listener_register_with_filter(
+        fn, NULL, 0, INDIGO_CORE_LISTENER_PRIORITY_DEFAULT);
+}
+
 void
 indigo_core_message_listener_unregister(indigo_core_message_listener_f fn)
 {
-    message_listeners = biglist_remove(message_listeners, fn);
+    chain_remove(&message_listeners, fn);
 }
 
 indigo_core_listener_result_t
 ind_core_message_notify(indigo_cxn_id_t cxn_id, of_object_t *message)
 {
     indigo_core_listener_result_t result = INDIGO_CORE_LISTENER_RESULT_PASS;
-    biglist_t *cur;
-    indigo_core_message_listener_f fn;
+    listener_chain_t *chain = &message_listeners;
+    int id = message->object_id;
+    int i;
+
+    for (i = 0; i < chain->count; i++) {
+        listener_t *listener = &chain->listeners[i];
+
+        if (listener->message_filtered &&
+            (id < 0 || id >= OF_MESSAGE_OBJECT_COUNT ||
+             !(listener->message_ids[id / 32] & (1U << (id % 32))))) {
+            continue;
+        }
 
-    BIGLIST_FOREACH_DATA(cur, message_listeners, indigo_core_message_listener_f, fn) {
-        result |= fn(cxn_id, message);
+        result |= ((indigo_core_message_listener_f)listener->fn)(cxn_id, message);
     }
 
     return result;
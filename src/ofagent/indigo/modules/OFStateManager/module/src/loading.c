@@ -0,0 +1,451 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Requests held while forwarding's state is restored
+ *
+ * Forwarding may adopt the flows and groups it already has in the
+ * background, after the controller connections are up, so the handshake
+ * and echoes are not held up by reading back every entry. Forwarding
+ * marks the groups and then each table as restored; until then the
+ * requests whose outcome depends on them are held:
+ *
+ * - Group messages, until the groups are restored.
+ * - Flow modifies and deletes and flow and aggregate stats requests,
+ *   until their table is restored, or every table for TABLE_ID_ANY.
+ * - Flow adds and table stats requests, until every table is restored.
+ *   Flow IDs are the forwarding cookies, so one handed out before then
+ *   could be the cookie of a flow not yet read back.
+ *
+ * Anything else is handled as it arrives. Once a connection has a held
+ * message, its later held-class messages are held behind it, so each
+ * connection's flow mods and stats requests keep their order. Held
+ * messages are tracked like any operation in progress, so a barrier
+ * behind them is answered only after they are handled. Those of a
+ * connection that closes are dropped.
+ */
+
+#include "ofstatemanager_log.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+#include <AIM/aim_list.h>
+#include <indigo/indigo.h>
+#include <indigo/of_state_manager.h>
+#include <SocketManager/socketmanager.h>
+#include <loci/loci.h>
+#include "ofstatemanager_decs.h"
+#include "ofstatemanager_int.h"
+#include "ft_entry.h"
+#include "loading.h"
+
+#define LOADING_TABLE_COUNT 256
+
+typedef struct loading_msg_s {
+    list_links_t links;
+    of_object_t *obj;
+    indigo_cxn_id_t cxn_id;
+} loading_msg_t;
+
+typedef struct loading_cxn_s {
+    uint32_t held;              /* Held or ready messages */
+    uint32_t pass;              /* Last replay pass that kept one held */
+} loading_cxn_t;
+
+static struct {
+    bool active;
+    bool groups;                /* Groups still loading */
+    int tables;                 /* Number of tables still loading */
+    uint8_t table_loading[LOADING_TABLE_COUNT / 8];
+    list_head_t held;           /* Waiting for state, in arrival order */
+    list_head_t ready;          /* Waiting for the replay task */
+    loading_cxn_t *cxns;
+    int cxn_count;
+    uint32_t pass;
+    bool task_running;
+    uint32_t held_now;
+    uint32_t held_high;
+    uint64_t held_total;
+    uint64_t dropped;
+    indigo_time_t start_time;
+} loading;
+
+static void loading_cxn_status_change(indigo_cxn_id_t cxn_id,
+                                      indigo_cxn_protocol_params_t *params,
+                                      indigo_cxn_state_t state,
+                                      void *cookie);
+
+static bool
+table_loading(uint8_t table_id)
+{
+    if (table_id == TABLE_ID_ANY) {
+        return loading.tables > 0;
+    }
+    return (loading.table_loading[table_id / 8] >> (table_id % 8)) & 1;
+}
+
+/* Does the message need state that is still loading? */
+static bool
+loading_blocks(of_object_t *obj)
+{
+    uint8_t table_id;
+
+    switch (obj->object_id) {
+    case OF_FLOW_ADD:
+    case OF_TABLE_STATS_REQUEST:
+        return loading.tables > 0;
+    case OF_FLOW_MODIFY:
+    case OF_FLOW_MODIFY_STRICT:
+    case OF_FLOW_DELETE:
+    case OF_FLOW_DELETE_STRICT:
+        if (obj->version < OF_VERSION_1_1) {
+            return loading.tables > 0;
+        }
+        of_flow_modify_table_id_get(obj, &table_id);
+        return table_loading(table_id);
+    case OF_FLOW_STATS_REQUEST:
+        of_flow_stats_request_table_id_get(obj, &table_id);
+        return table_loading(table_id);
+    case OF_AGGREGATE_STATS_REQUEST:
+        of_aggregate_stats_request_table_id_get(obj, &table_id);
+        return table_loading(table_id);
+    case OF_GROUP_ADD:
+    case OF_GROUP_MODIFY:
+    case OF_GROUP_DELETE:
+    case OF_GROUP_STATS_REQUEST:
+    case OF_GROUP_DESC_STATS_REQUEST:
+        return loading.groups;
+    default:
+        return false;
+    }
+}
+
+/* Could the message ever be held? */
+static bool
+loading_holdable(of_object_t *obj)
+{
+    switch (obj->object_id) {
+    case OF_FLOW_ADD:
+    case OF_TABLE_STATS_REQUEST:
+    case OF_FLOW_MODIFY:
+    case OF_FLOW_MODIFY_STRICT:
+    case OF_FLOW_DELETE:
+    case OF_FLOW_DELETE_STRICT:
+    case OF_FLOW_STATS_REQUEST:
+    case OF_AGGREGATE_STATS_REQUEST:
+    case OF_GROUP_ADD:
+    case OF_GROUP_MODIFY:
+    case OF_GROUP_DELETE:
+    case OF_GROUP_STATS_REQUEST:
+    case OF_GROUP_DESC_STATS_REQUEST:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static loading_cxn_t *
+loading_cxn(indigo_cxn_id_t cxn_id)
+{
+    int count;
+
+    if (cxn_id >= loading.cxn_count) {
+        count = cxn_id + 1;
+        loading.cxns = aim_realloc(loading.cxns, count * sizeof(*loading.cxns));
+        memset(&loading.cxns[loading.cxn_count], 0,
+               (count - loading.cxn_count) * sizeof(*loading.cxns));
+        loading.cxn_count = count;
+    }
+
+    return &loading.cxns[cxn_id];
+}
+
+static void
+loading_msg_free(loading_msg_t *msg)
+{
+    loading_cxn(msg->cxn_id)->held--;
+    loading.held_now--;
+    /* Releases the connection's outstanding operation */
+    of_object_delete(msg->obj);
+    aim_free(msg);
+}
+
+/* Stop holding once everything is loaded and nothing is left to replay */
+static void
+loading_check_done(void)
+{
+    if (!loading.active || loading.groups || loading.tables > 0 ||
+            !list_empty(&loading.held) || !list_empty(&loading.ready)) {
+        return;
+    }
+
+    LOG_INFO("State restored in %d ms; %" PRIu64 " requests were held",
+             INDIGO_TIME_DIFF_ms(loading.start_time, INDIGO_CURRENT_TIME),
+             loading.held_total);
+
+    loading.active = false;
+    indigo_cxn_status_change_unregister(loading_cxn_status_change, NULL);
+    aim_free(loading.cxns);
+    loading.cxns = NULL;
+    loading.cxn_count = 0;
+}
+
+static ind_soc_task_status_t
+loading_replay_task(void *cookie)
+{
+    list_links_t *cur;
+    loading_msg_t *msg;
+
+    while ((cur = list_shift(&loading.ready)) != NULL) {
+        msg = container_of(cur, links, loading_msg_t);
+        ind_core_message_dispatch(msg->obj, msg->cxn_id);
+        loading_msg_free(msg);
+
+        if (ind_soc_should_yield()) {
+            return IND_SOC_TASK_CONTINUE;
+        }
+    }
+
+    loading.task_running = false;
+    loading_check_done();
+    return IND_SOC_TASK_FINISHED;
+}
+
+/*
+ * Move the held messages that can now run to the ready list, keeping
+ * each connection's order, and have the task dispatch them. The handlers
+ * are not called from here as forwarding is in the middle of its restore.
+ */
+static void
+loading_replay(void)
+{
+    list_links_t *cur, *next;
+    loading_msg_t *msg;
+    loading_cxn_t *cxn;
+
+    loading.pass++;
+
+    LIST_FOREACH_SAFE(&loading.held, cur, next) {
+        msg = container_of(cur, links, loading_msg_t);
+        cxn = loading_cxn(msg->cxn_id);
+        if (cxn->pass == loading.pass || loading_blocks(msg->obj)) {
+            cxn->pass = loading.pass;
+            continue;
+        }
+        list_remove(cur);
+        list_push(&loading.ready, cur);
+    }
+
+    if (list_empty(&loading.ready) || loading.task_running) {
+        loading_check_done();
+        return;
+    }
+
+    if (ind_soc_task_register(loading_replay_task, NULL,
+                              IND_SOC_DEFAULT_PRIORITY) < 0) {
+        LOG_ERROR("Failed to start the held request task; replaying now");
+        while (loading_replay_task(NULL) == IND_SOC_TASK_CONTINUE) {
+        }
+        return;
+    }
+
+    loading.task_running = true;
+}
+
+/* Drop the held messages of a closing connection */
+static void
+loading_cxn_status_change(indigo_cxn_id_t cxn_id,
+                          indigo_cxn_protocol_params_t *params,
+                          indigo_cxn_state_t state,
+                          void *cookie)
+{
+    LIST_DEFINE(dropped);
+    list_links_t *cur, *next;
+    loading_msg_t *msg;
+
+    if (state != INDIGO_CXN_S_CLOSING && state != INDIGO_CXN_S_DISCONNECTED) {
+        return;
+    }
+    if (cxn_id >= loading.cxn_count || loading.cxns[cxn_id].held == 0) {
+        return;
+    }
+
+    /*
+     * Unlinked first: releasing the last operation of a closing
+     * connection calls back here with it disconnected.
+     */
+    LIST_FOREACH_SAFE(&loading.held, cur, next) {
+        msg = container_of(cur, links, loading_msg_t);
+        if (msg->cxn_id == cxn_id) {
+            list_remove(cur);
+            list_push(&dropped, cur);
+        }
+    }
+    LIST_FOREACH_SAFE(&loading.ready, cur, next) {
+        msg = container_of(cur, links, loading_msg_t);
+        if (msg->cxn_id == cxn_id) {
+            list_remove(cur);
+            list_push(&dropped, cur);
+        }
+    }
+
+    while ((cur = list_shift(&dropped)) != NULL) {
+        msg = container_of(cur, links, loading_msg_t);
+        loading.dropped++;
+        loading_msg_free(msg);
+    }
+
+    loading_check_done();
+}
+
+int
+ind_core_loading_hold(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+    loading_msg_t *msg;
+
+    if (!loading.active || !loading_holdable(obj)) {
+        return 0;
+    }
+
+    if (!loading_blocks(obj) && loading_cxn(cxn_id)->held == 0) {
+        return 0;
+    }
+
+    msg = aim_zmalloc(sizeof(*msg));
+    msg->obj = ind_core_claim_tracking(obj, cxn_id);
+    msg->cxn_id = cxn_id;
+    list_push(&loading.held, &msg->links);
+
+    loading_cxn(cxn_id)->held++;
+    loading.held_total++;
+    if (++loading.held_now > loading.held_high) {
+        loading.held_high = loading.held_now;
+    }
+
+    return 1;
+}
+
+/**
+ * Hold back requests that depend on state still being restored
+ *
+ * See indigo/of_state_manager.h.
+ */
+
+void
+indigo_core_loading_start(void)
+{
+    if (loading.active) {
+        return;
+    }
+
+    list_init(&loading.held);
+    list_init(&loading.ready);
+    /* Every table but TABLE_ID_ANY */
+    memset(loading.table_loading, 0xff, sizeof(loading.table_loading));
+    loading.table_loading[TABLE_ID_ANY / 8] &= ~(1 << (TABLE_ID_ANY % 8));
+    loading.tables = LOADING_TABLE_COUNT - 1;
+    loading.groups = true;
+    loading.held_total = 0;
+    loading.held_high = 0;
+    loading.dropped = 0;
+    loading.start_time = INDIGO_CURRENT_TIME;
+    loading.active = true;
+
+    if (indigo_cxn_status_change_register(loading_cxn_status_change,
+                                          NULL) < 0) {
+        LOG_ERROR("Failed to watch connections for held requests");
+    }
+}
+
+void
+indigo_core_groups_loaded(void)
+{
+    if (!loading.active || !loading.groups) {
+        return;
+    }
+
+    loading.groups = false;
+    loading_replay();
+}
+
+void
+indigo_core_table_loaded(uint8_t table_id)
+{
+    if (!loading.active || table_id == TABLE_ID_ANY ||
+            !table_loading(table_id)) {
+        return;
+    }
+
+    loading.table_loading[table_id / 8] &= ~(1 << (table_id % 8));
+    loading.tables--;
+    loading_replay();
+}
+
+void
+indigo_core_loading_done(void)
+{
+    if (!loading.active) {
+        return;
+    }
+
+    memset(loading.table_loading, 0, sizeof(loading.table_loading));
+    loading.tables = 0;
+    loading.groups = false;
+    loading_replay();
+}
+
+void
+ind_core_loading_finish(void)
+{
+    list_links_t *cur;
+    loading_msg_t *msg;
+
+    if (!loading.active) {
+        return;
+    }
+
+    while ((cur = list_shift(&loading.held)) != NULL ||
+           (cur = list_shift(&loading.ready)) != NULL) {
+        msg = container_of(cur, links, loading_msg_t);
+        loading_msg_free(msg);
+    }
+
+    loading.groups = false;
+    loading.tables = 0;
+    loading_check_done();
+}
+
+void
+ind_core_loading_show(aim_pvs_t *pvs)
+{
+    if (!loading.active) {
+        aim_printf(pvs, "Restore: not in progress\n");
+        return;
+    }
+
+    aim_printf(pvs, "Restore: %s, %d tables loading, %d ms so far\n",
+               loading.groups ? "groups loading" : "groups loaded",
+               loading.tables,
+               INDIGO_TIME_DIFF_ms(loading.start_time, INDIGO_CURRENT_TIME));
+    aim_printf(pvs, "  held %u (high %u), total %" PRIu64 ", dropped %" PRIu64 "\n",
+               loading.held_now, loading.held_high, loading.held_total,
+               loading.dropped);
+}
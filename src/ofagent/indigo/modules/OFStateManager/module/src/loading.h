@@ -0,0 +1,56 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Requests held while forwarding's state is restored
+ *
+ * See loading.c.
+ */
+
+#ifndef _OFSTATEMANAGER_LOADING_H_
+#define _OFSTATEMANAGER_LOADING_H_
+
+#include <indigo/indigo.h>
+#include <indigo/of_connection_manager.h>
+#include <loci/loci.h>
+
+/**
+ * Hold a message that needs state still being restored
+ *
+ * @returns 1 if the message was taken and will be dispatched later; 0 if
+ * it should be handled now
+ */
+int ind_core_loading_hold(of_object_t *obj, indigo_cxn_id_t cxn_id);
+
+/**
+ * Drop any held messages and stop waiting for the restore
+ */
+void ind_core_loading_finish(void);
+
+void ind_core_loading_show(aim_pvs_t *pvs);
+
+/**
+ * Run the handler for a message that listeners and admission have seen
+ *
+ * Defined in ofstatemanager.c.
+ */
+void ind_core_message_dispatch(of_object_t *obj, indigo_cxn_id_t cxn);
+
+#endif /* _OFSTATEMANAGER_LOADING_H_ */
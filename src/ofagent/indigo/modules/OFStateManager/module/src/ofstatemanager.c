@@ -32,6 +32,9 @@
 #include <indigo/forwarding.h>
 #include <indigo/indigo.h>
 #include <indigo/of_state_manager.h>
+#include <indigo/debug_counter.h>
+#include <indigo/mem_budget.h>
+#include <indigo/mem_arena.h>
 #include <loci/loci_dump.h>
 #include <loci/loci_show.h>
 #include "ofstatemanager_int.h"
@@ -42,6 +45,11 @@
 #include "expiration.h"
 #include "listener.h"
 #include "table.h"
+#include "flow_counters.h"
+#include "reply_cache.h"
+#include "flow_monitor.h"
+#include "loading.h"
+#include "experimenter.h"
 
 static void
 process_flow_removal(ft_entry_t *entry,
@@ -69,10 +77,45 @@ int ind_core_module_enabled = 0;
 
 /**
  * @brief Statistics for debugging
+ *
+ * The values as of the last indigo_core_stats_get are kept so it can
+ * report the counts since then.
  */
-static uint32_t ind_core_flow_mods = 0;
-static uint32_t ind_core_packet_ins = 0;
-static uint32_t ind_core_packet_outs = 0;
+static debug_counter_t ind_core_flow_mods;
+static debug_counter_t ind_core_packet_ins;
+static debug_counter_t ind_core_packet_outs;
+static uint64_t ind_core_flow_mods_last;
+static uint64_t ind_core_packet_ins_last;
+static uint64_t ind_core_packet_outs_last;
+
+/* Flow table status fields exported as debug counters */
+static struct {
+    const char *name;
+    const char *description;
+    size_t offset;
+    debug_counter_t counter;
+} ind_core_ft_counters[] = {
+    { "core.flow_table.adds", "Flow table entries added",
+      offsetof(ft_status_t, adds) },
+    { "core.flow_table.deletes", "Flow table entries deleted",
+      offsetof(ft_status_t, deletes) },
+    { "core.flow_table.hard_expires", "Flow table entries hard timed out",
+      offsetof(ft_status_t, hard_expires) },
+    { "core.flow_table.idle_expires", "Flow table entries idle timed out",
+      offsetof(ft_status_t, idle_expires) },
+    { "core.flow_table.updates", "Flow table entries modified",
+      offsetof(ft_status_t, updates) },
+    { "core.flow_table.noop_updates",
+      "Flow modifies that left the entry unchanged",
+      offsetof(ft_status_t, noop_updates) },
+    { "core.flow_table.table_full_errors",
+      "Flow adds failed for lack of space in the flow table",
+      offsetof(ft_status_t, table_full_errors) },
+    { "core.flow_table.forwarding_add_errors",
+      "Flow adds failed in forwarding",
+      offsetof(ft_status_t, forwarding_add_errors) },
+};
+static debug_counter_t ind_core_ft_current_count;
 
 
 /**
@@ -97,6 +140,9 @@ static int ind_core_connection_count;
         }                                       \
     } while(0)
 
+#define CORE_EXPIRES_FLOWS(_cfg) \
+    ((_cfg)->expire_flows && ((_cfg)->stats_check_ms > 0))
+
 
 /* Handle a packet in from forwarding */
 indigo_error_t
@@ -109,7 +155,7 @@ indigo_core_packet_in(of_packet_in_t *packet_in)
     }
 
     LOG_TRACE("Packet in rcvd");
-    ind_core_packet_ins++;
+    debug_counter_inc(&ind_core_packet_ins);
 
     if (ind_core_packet_in_notify(packet_in) == INDIGO_CORE_LISTENER_RESULT_DROP) {
         LOG_TRACE("Listener dropped packet-in");
@@ -141,6 +187,7 @@ send_flow_removed_message(ft_entry_t *entry,
     indigo_time_t current;
     uint64_t packets, bytes;
     of_version_t ver;
+    of_match_t match;
 
     current = INDIGO_CURRENT_TIME;
 
@@ -168,7 +215,8 @@ send_flow_removed_message(ft_entry_t *entry,
         of_flow_removed_hard_timeout_set(msg, entry->hard_timeout);
     }
 
-    if (of_flow_removed_match_set(msg, &entry->match)) {
+    ft_match_unpack(entry->match, &match);
+    if (of_flow_removed_match_set(msg, &match)) {
         LOG_ERROR("Failed to set match in flow removed message");
         of_object_delete(msg);
         return;
@@ -199,6 +247,69 @@ send_flow_removed_message(ft_entry_t *entry,
 
 /****************************************************************/
 
+/*
+ * Forwarding resolves flow mods and packet outs against deferred adds
+ * itself, so a pipelined connection need not wait for those to finish.
+ * Anything else may depend on what the adds programmed (groups in use,
+ * table state) and flushes them first.
+ */
+
+static int
+pending_flush_needed(indigo_cxn_id_t cxn, of_object_t *obj)
+{
+    switch (obj->object_id) {
+    case OF_FLOW_ADD:
+        return 0;
+    case OF_FLOW_MODIFY:
+    case OF_FLOW_MODIFY_STRICT:
+    case OF_FLOW_DELETE:
+    case OF_FLOW_DELETE_STRICT:
+    case OF_PACKET_OUT:
+        return !ind_cxn_pipelined(cxn);
+    default:
+        return 1;
+    }
+}
+
+/*
+ * At the memory budget, refuse new multipart requests and flow adds and
+ * modifies, which take on memory, with an error. Deletes and the other
+ * messages still run. Returns 0 if the message was refused.
+ */
+static int
+mem_budget_admit(indigo_cxn_id_t cxn, of_object_t *obj)
+{
+    of_version_t ver = obj->version;
+
+    switch (obj->object_id) {
+    case OF_FLOW_ADD:
+    case OF_FLOW_MODIFY:
+    case OF_FLOW_MODIFY_STRICT:
+        if (!indigo_mem_budget_admit()) {
+            /* As flow_mod_err_msg_send reports INDIGO_ERROR_RESOURCE */
+            indigo_cxn_send_error_reply(
+                cxn, obj, OF_ERROR_TYPE_FLOW_MOD_FAILED_BY_VERSION(ver),
+                ver >= OF_VERSION_1_3 ?
+                    OF_FLOW_MOD_FAILED_TABLE_FULL_BY_VERSION(ver) :
+                    OF_FLOW_MOD_FAILED_ALL_TABLES_FULL_BY_VERSION(ver));
+            return 0;
+        }
+        return 1;
+    default:
+        if (of_message_type_get(OF_OBJECT_BUFFER_INDEX(obj, 0)) ==
+                OF_OBJ_TYPE_STATS_REQUEST_BY_VERSION(ver) &&
+                !indigo_mem_budget_admit()) {
+            indigo_cxn_send_error_reply(
+                cxn, obj, OF_ERROR_TYPE_BAD_REQUEST_BY_VERSION(ver),
+                ver >= OF_VERSION_1_3 ?
+                    OF_REQUEST_FAILED_MULTIPART_BUFFER_OVERFLOW_BY_VERSION(ver) :
+                    OF_REQUEST_FAILED_EPERM_BY_VERSION(ver));
+            return 0;
+        }
+        return 1;
+    }
+}
+
 /**
  * @brief Handle an OF message from the controller
  * @param cxn The connection id from which the request came
@@ -225,36 +336,73 @@ indigo_core_receive_controller_message(indigo_cxn_id_t cxn, of_object_t *obj)
         return;
     }
 
+    if (!mem_budget_admit(cxn, obj)) {
+        LOG_TRACE("Memory budget refused message");
+        return;
+    }
+
+    if (ind_core_loading_hold(obj, cxn)) {
+        LOG_TRACE("Holding message until its table is restored");
+        return;
+    }
+
+    ind_core_message_dispatch(obj, cxn);
+}
+
+/**
+ * @brief Run the handler for a message
+ * @param obj The message; ownership as for indigo_core_receive_controller_message
+ * @param cxn The connection id from which the request came
+ *
+ * Listeners and admission have already seen the message. Also used for
+ * messages held while the tables were restored.
+ */
+
+void
+ind_core_message_dispatch(of_object_t *obj, indigo_cxn_id_t cxn)
+{
+    /* Anything after a flow add must see it programmed */
+    if (pending_flush_needed(cxn, obj)) {
+        ind_core_table_pending_flush();
+        indigo_fwd_pending_flush();
+    }
+
+    /* Likewise for batched gentable adds and deletes */
+    if (obj->object_id != OF_BSN_GENTABLE_ENTRY_ADD &&
+            obj->object_id != OF_BSN_GENTABLE_ENTRY_DELETE) {
+        ind_core_gentable_pending_flush();
+    }
+
     /* Default handlers */
     switch (obj->object_id) {
 
     case OF_PACKET_OUT:
-        ind_core_packet_outs++;
+        debug_counter_inc(&ind_core_packet_outs);
         ind_core_packet_out_handler(obj, cxn);
         break;
 
     case OF_FLOW_ADD:
-        ind_core_flow_mods++;
+        debug_counter_inc(&ind_core_flow_mods);
         ind_core_flow_add_handler(obj, cxn);
         break;
 
     case OF_FLOW_MODIFY:
-        ind_core_flow_mods++;
+        debug_counter_inc(&ind_core_flow_mods);
         ind_core_flow_modify_handler(obj, cxn);
         break;
 
     case OF_FLOW_MODIFY_STRICT:
-        ind_core_flow_mods++;
+        debug_counter_inc(&ind_core_flow_mods);
         ind_core_flow_modify_strict_handler(obj, cxn);
         break;
 
     case OF_FLOW_DELETE:
-        ind_core_flow_mods++;
+        debug_counter_inc(&ind_core_flow_mods);
         ind_core_flow_delete_handler(obj, cxn);
         break;
 
     case OF_FLOW_DELETE_STRICT:
-        ind_core_flow_mods++;
+        debug_counter_inc(&ind_core_flow_mods);
         ind_core_flow_delete_strict_handler(obj, cxn);
         break;
 
@@ -355,6 +503,10 @@ indigo_core_receive_controller_message(indigo_cxn_id_t cxn, of_object_t *obj)
         ind_core_meter_delete_handler(obj, cxn);
         break;
 
+    case OF_METER_STATS_REQUEST:
+        ind_core_meter_stats_request_handler(obj, cxn);
+        break;
+
 #endif
     /****************************************************************
      * Gentable messages
@@ -432,6 +584,26 @@ indigo_core_receive_controller_message(indigo_cxn_id_t cxn, of_object_t *obj)
         ind_core_bsn_port_counter_stats_request_handler(obj, cxn);
         break;
 
+    case OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST:
+        ind_core_bsn_debug_counter_desc_stats_request_handler(obj, cxn);
+        break;
+
+    case OF_BSN_DEBUG_COUNTER_STATS_REQUEST:
+        ind_core_bsn_debug_counter_stats_request_handler(obj, cxn);
+        break;
+
+    case OF_BSN_TABLE_CHECKSUM_STATS_REQUEST:
+        ind_core_bsn_table_checksum_stats_request_handler(obj, cxn);
+        break;
+
+    case OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST:
+        ind_core_bsn_flow_checksum_bucket_stats_request_handler(obj, cxn);
+        break;
+
+    case OF_BSN_TABLE_SET_BUCKETS_SIZE:
+        ind_core_bsn_table_set_buckets_size_handler(obj, cxn);
+        break;
+
     /* These all use the experimenter handler */
     case OF_BSN_GET_MIRRORING_REQUEST:
     case OF_BSN_SET_MIRRORING:
@@ -455,11 +627,7 @@ indigo_core_receive_controller_message(indigo_cxn_id_t cxn, of_object_t *obj)
       ind_core_unhandled_message(obj, cxn);
       break;
     case OF_EXPERIMENTER_STATS_REQUEST:
-    #ifdef OFDPA_FIXUP
       ind_core_experimenter_stats_request_handler(obj, cxn);
-    #else
-      ind_core_unhandled_message(obj, cxn);
-    #endif
       break;
 
     /****************************************************************
@@ -513,6 +681,7 @@ indigo_core_dpid_set(of_dpid_t dpid)
     if (ind_core_dpid != dpid) {
         LOG_INFO("Changing switch DPID to %016llx", dpid);
         INDIGO_MEM_COPY(&ind_core_dpid, &dpid, sizeof(ind_core_dpid));
+        ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_FEATURES);
         ind_cxn_reset(IND_CXN_RESET_ALL);
     } else {
         LOG_VERBOSE("Switch DPID set called but unchanged");
@@ -533,8 +702,64 @@ indigo_core_dpid_get(of_dpid_t *dpid)
 }
 
 
+/* Initial size of the flowtable hash indices */
+#define IND_CORE_FT_INITIAL_BUCKETS 1024
+
 #define INIT_STR(var, val) INDIGO_MEM_COPY(&(var), (val), sizeof(val))
 
+static uint64_t
+ind_core_ft_counter_get(debug_counter_t *counter)
+{
+    return *(uint64_t *)((char *)&ind_core_ft->status +
+                         (uintptr_t)counter->cookie);
+}
+
+static uint64_t
+ind_core_ft_current_count_get(debug_counter_t *counter)
+{
+    return ind_core_ft->status.current_count;
+}
+
+static void
+ind_core_debug_counters_register(void)
+{
+    int i;
+
+    debug_counter_register(&ind_core_flow_mods, "core.flow_mods",
+                           "Flow mod messages received");
+    debug_counter_register(&ind_core_packet_ins, "core.packet_ins",
+                           "Packet ins received from forwarding");
+    debug_counter_register(&ind_core_packet_outs, "core.packet_outs",
+                           "Packet out messages received");
+
+    debug_counter_register_get(&ind_core_ft_current_count,
+                               "core.flow_table.current_count",
+                               "Flow table entries installed",
+                               ind_core_ft_current_count_get, NULL);
+    for (i = 0; i < AIM_ARRAYSIZE(ind_core_ft_counters); i++) {
+        debug_counter_register_get(&ind_core_ft_counters[i].counter,
+                                   ind_core_ft_counters[i].name,
+                                   ind_core_ft_counters[i].description,
+                                   ind_core_ft_counter_get,
+                                   (void *)ind_core_ft_counters[i].offset);
+    }
+}
+
+static void
+ind_core_debug_counters_unregister(void)
+{
+    int i;
+
+    debug_counter_unregister(&ind_core_flow_mods);
+    debug_counter_unregister(&ind_core_packet_ins);
+    debug_counter_unregister(&ind_core_packet_outs);
+
+    debug_counter_unregister(&ind_core_ft_current_count);
+    for (i = 0; i < AIM_ARRAYSIZE(ind_core_ft_counters); i++) {
+        debug_counter_unregister(&ind_core_ft_counters[i].counter);
+    }
+}
+
 indigo_error_t
 ind_core_init(ind_core_config_t *config)
 {
@@ -567,8 +792,15 @@ ind_core_init(ind_core_config_t *config)
         /* Default value */
         config->max_flowtable_entries = 16384;
     }
+    /* The hash indices grow on demand, so start them small */
+    INDIGO_MEM_SET(&ft_config, 0, sizeof(ft_config));
     ft_config.strict_match_bucket_count = config->max_flowtable_entries;
-    ft_config.flow_id_bucket_count = config->max_flowtable_entries;
+    if (ft_config.strict_match_bucket_count > IND_CORE_FT_INITIAL_BUCKETS) {
+        ft_config.strict_match_bucket_count = IND_CORE_FT_INITIAL_BUCKETS;
+    }
+    ft_config.flow_id_bucket_count = ft_config.strict_match_bucket_count;
+    ft_config.cookie_bucket_count = ft_config.strict_match_bucket_count;
+    ft_config.cookie_prefix_len = config->cookie_prefix_len;
 
     if ((ind_core_ft = ft_create(&ft_config)) == NULL) {
         LOG_ERROR("Unable to allocate flow table");
@@ -577,6 +809,12 @@ ind_core_init(ind_core_config_t *config)
 
     ind_core_connection_count = 0;
 
+    ind_core_debug_counters_register();
+
+    /* Otherwise forwarding expires flows and reports them as removed */
+    ind_core_expiration_enable_set(CORE_EXPIRES_FLOWS(&ind_core_config));
+    ind_core_expiration_by_counters_set(ind_core_config.idle_by_counters);
+
     ind_core_group_init();
 #ifdef OFDPA_FIXUP
     ind_core_meter_init();
@@ -589,6 +827,19 @@ ind_core_init(ind_core_config_t *config)
     return INDIGO_ERROR_NONE;
 }
 
+/*
+ * Only a flow_removed message reports the final statistics of a deleted
+ * flow; see process_flow_removal.
+ */
+
+static bool
+ind_core_flow_removal_stats_needed(ft_entry_t *entry,
+                                   indigo_fi_flow_removed_t reason)
+{
+    return (entry->flags & OF_FLOW_MOD_FLAG_SEND_FLOW_REM) &&
+        reason != INDIGO_FLOW_REMOVED_OVERWRITE;
+}
+
 /**
  * @brief Do the necessary processing to delete a flow entry
  *
@@ -615,10 +866,17 @@ ind_core_flow_entry_delete(ft_entry_t *entry, indigo_fi_flow_removed_t reason)
               INDIGO_FLOW_ID_PRINTF_ARG(entry->id));
 
     ind_core_table_t *table = ind_core_table_get(entry->table_id);
-    if (table != NULL) {
+    if (table != NULL && ind_core_table_create_cancel(entry)) {
+        /* The table never had it */
+        flow_stats.packets = 0;
+        flow_stats.bytes = 0;
+        rv = INDIGO_ERROR_NONE;
+    } else if (table != NULL) {
         rv = table->ops->entry_delete(table->priv, entry->priv, &flow_stats);
     } else {
-        rv = indigo_fwd_flow_delete(entry->id, &flow_stats);
+        rv = indigo_fwd_flow_delete(entry->id,
+                                    ind_core_flow_removal_stats_needed(entry, reason) ?
+                                    &flow_stats : NULL);
     }
 
     if (rv != INDIGO_ERROR_NONE) {
@@ -630,6 +888,118 @@ ind_core_flow_entry_delete(ft_entry_t *entry, indigo_fi_flow_removed_t reason)
     process_flow_removal(entry, &flow_stats, reason);
 }
 
+/**
+ * As ind_core_flow_entry_delete for several entries, with one call per
+ * run of entries in a table that has entry_delete_batch
+ *
+ * No add may be queued; see ind_core_table_pending_flush.
+ */
+
+void
+ind_core_flow_entries_delete(ft_entry_t **entries, int count,
+                             indigo_fi_flow_removed_t reason)
+{
+    static indigo_core_table_batch_entry_t batch[IND_CORE_TABLE_BATCH_MAX];
+    ind_core_table_t *table;
+    indigo_error_t rv;
+    int i, j, n;
+
+    for (i = 0; i < count; i += n) {
+        n = ind_core_table_batch_len(&entries[i], count - i);
+        table = ind_core_table_get(entries[i]->table_id);
+        if (table == NULL || table->ops->entry_delete_batch == NULL) {
+            for (j = i; j < i + n; j++) {
+                ind_core_flow_entry_delete(entries[j], reason);
+            }
+            continue;
+        }
+
+        for (j = 0; j < n; j++) {
+            batch[j].obj = NULL;
+            batch[j].flow_id = entries[i + j]->id;
+            batch[j].entry_priv = entries[i + j]->priv;
+            batch[j].flow_stats.flow_id = entries[i + j]->id;
+            batch[j].flow_stats.duration_ns = 0;
+            batch[j].flow_stats.packets = -1;
+            batch[j].flow_stats.bytes = -1;
+            batch[j].status = INDIGO_ERROR_NONE;
+        }
+
+        rv = table->ops->entry_delete_batch(table->priv, batch, n);
+
+        for (j = 0; j < n; j++) {
+            if (rv < 0) {
+                batch[j].status = rv;
+            }
+            if (batch[j].status != INDIGO_ERROR_NONE) {
+                LOG_ERROR("Error deleting flow " INDIGO_FLOW_ID_PRINTF_FORMAT ": %s",
+                          INDIGO_FLOW_ID_PRINTF_ARG(batch[j].flow_id),
+                          indigo_strerror(batch[j].status));
+                /* Ignoring failure */
+            }
+            process_flow_removal(entries[i + j], &batch[j].flow_stats, reason);
+        }
+    }
+}
+
+/**
+ * Delete every flow in a table with one call into forwarding
+ * @param table_id The table, or TABLE_ID_ANY for all tables
+ * @returns INDIGO_ERROR_NOT_SUPPORTED, or the forwarding error, if the
+ * flows must be deleted one by one instead
+ *
+ * Forwarding returns no final counters, so this is only done when no
+ * flow in scope asked for a flow_removed. Flows in tables registered
+ * with indigo_core_table_register are still deleted through their ops.
+ */
+
+indigo_error_t
+ind_core_flow_table_purge(uint8_t table_id)
+{
+    list_links_t *cur, *next;
+    ft_entry_t *entry;
+    indigo_error_t rv;
+    int count = 0;
+
+    if (table_id != TABLE_ID_ANY && ind_core_table_get(table_id) != NULL) {
+        return INDIGO_ERROR_NOT_SUPPORTED;
+    }
+
+    FT_ITER(ind_core_ft, entry, cur, next) {
+        if ((table_id == TABLE_ID_ANY || entry->table_id == table_id) &&
+            (entry->flags & OF_FLOW_MOD_FLAG_SEND_FLOW_REM)) {
+            return INDIGO_ERROR_NOT_SUPPORTED;
+        }
+    }
+
+    rv = indigo_fwd_flow_delete_all(table_id);
+    if (rv != INDIGO_ERROR_NONE) {
+        if (rv != INDIGO_ERROR_NOT_SUPPORTED) {
+            LOG_ERROR("Error purging table %d: %s, deleting flows one by one",
+                      table_id, indigo_strerror(rv));
+        }
+        return rv;
+    }
+
+    FT_ITER(ind_core_ft, entry, cur, next) {
+        if (table_id != TABLE_ID_ANY && entry->table_id != table_id) {
+            continue;
+        }
+        if (ind_core_table_get(entry->table_id) != NULL) {
+            ind_core_flow_entry_delete(entry, INDIGO_FLOW_REMOVED_DELETE);
+        } else {
+            ind_core_flow_monitor_notify(entry,
+                                         IND_CORE_FLOW_MONITOR_EVENT_REMOVED);
+            ft_delete(ind_core_ft, entry);
+        }
+        count++;
+    }
+
+    LOG_VERBOSE("Purged %d flows from table %d", count, table_id);
+
+    return INDIGO_ERROR_NONE;
+}
+
 /**
  * @brief Process a flow removal from the local flow table
  */
@@ -646,6 +1016,7 @@ process_flow_removal(ft_entry_t *entry,
         }
     }
 
+    ind_core_flow_monitor_notify(entry, IND_CORE_FLOW_MONITOR_EVENT_REMOVED);
     ft_delete(ind_core_ft, entry);
 
     LOG_TRACE("Flow table now has %d entries",
@@ -685,9 +1056,6 @@ indigo_core_flow_removed(indigo_fi_flow_removed_t reason,
     process_flow_removal(entry, stats, reason);
 }
 
-#define CORE_EXPIRES_FLOWS(_cfg) \
-    ((_cfg)->expire_flows && ((_cfg)->stats_check_ms > 0))
-
 indigo_error_t
 ind_core_enable_set(int enable)
 {
@@ -702,12 +1070,22 @@ ind_core_enable_set(int enable)
                 ind_core_expiration_timer, NULL,
                 ind_core_config.stats_check_ms, -10);
         }
+        if (ind_core_config.aggregate_stats_refresh_ms > 0) {
+            ind_soc_timer_event_register_with_priority(
+                ind_core_aggregate_stats_timer, NULL,
+                ind_core_config.aggregate_stats_refresh_ms, -10);
+        }
         ind_core_module_enabled = 1;
     } else if (!enable && ind_core_module_enabled) {
         LOG_INFO("Disabling OF state mgr");
         if (CORE_EXPIRES_FLOWS(&ind_core_config)) {
             ind_soc_timer_event_unregister(ind_core_expiration_timer, NULL);
         }
+        if (ind_core_config.aggregate_stats_refresh_ms > 0) {
+            ind_soc_timer_event_unregister(ind_core_aggregate_stats_timer, NULL);
+        }
+        ind_core_flow_counters_stop();
+        ind_core_flow_monitor_clear();
         ind_core_module_enabled = 0;
     } else {
         LOG_VERBOSE("Redundant enable call.  Currently %s",
@@ -736,16 +1114,26 @@ ind_core_finish(void)
 {
     LOG_TRACE("OF state mgr finish called");
 
+    /* The tables are torn down below but forwarding keeps its state */
+    ind_core_snapshot_stop();
+
+    ind_core_loading_finish();
+    ind_core_experimenter_finish();
+
     /* Indicate core is shutting down */
     if (ind_core_module_enabled) {
         LOG_VERBOSE("Finish is calling disable");
         ind_core_enable_set(0);
     }
 
+    ind_core_debug_counters_unregister();
+
     ft_destroy(ind_core_ft);
 
     ind_core_test_gentable_finish();
 
+    ind_core_reply_cache_clear();
+
     ind_core_init_done = 0;
 
     return INDIGO_ERROR_NONE;
@@ -761,6 +1149,7 @@ ind_core_sw_desc_set(of_desc_str_t desc)
 
     INDIGO_MEM_COPY(ind_core_of_config.desc_stats.sw_desc,
                     desc, OF_DESC_STR_LEN);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_DESC);
 
     return INDIGO_ERROR_NONE;
 }
@@ -790,6 +1179,7 @@ ind_core_hw_desc_set(of_desc_str_t desc)
 
     INDIGO_MEM_COPY(ind_core_of_config.desc_stats.hw_desc,
                     desc, OF_DESC_STR_LEN);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_DESC);
 
     return INDIGO_ERROR_NONE;
 }
@@ -819,6 +1209,7 @@ ind_core_dp_desc_set(of_desc_str_t desc)
 
     INDIGO_MEM_COPY(ind_core_of_config.desc_stats.dp_desc,
                     desc, OF_DESC_STR_LEN);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_DESC);
 
     return INDIGO_ERROR_NONE;
 }
@@ -848,6 +1239,7 @@ ind_core_mfr_desc_set(of_desc_str_t desc)
 
     INDIGO_MEM_COPY(ind_core_of_config.desc_stats.mfr_desc,
                     desc, OF_DESC_STR_LEN);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_DESC);
 
     return INDIGO_ERROR_NONE;
 }
@@ -877,6 +1269,7 @@ ind_core_serial_num_set(of_serial_num_t serial_num)
 
     INDIGO_MEM_COPY(ind_core_of_config.desc_stats.serial_num,
                     serial_num, OF_SERIAL_NUM_LEN);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_DESC);
 
     return INDIGO_ERROR_NONE;
 }
@@ -978,6 +1371,10 @@ indigo_core_port_status_update(of_port_status_t *of_port_status)
 
     LOG_TRACE("OF state mgr port status update");
 
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_PORT_DESC);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_FEATURES);
+    ind_core_reply_cache_invalidate(IND_CORE_REPLY_CACHE_PORT_STATS);
+
     if (ind_core_port_status_notify(of_port_status) == INDIGO_CORE_LISTENER_RESULT_DROP) {
         LOG_TRACE("Listener dropped port status update");
         of_object_delete(of_port_status);
@@ -992,10 +1389,12 @@ ind_core_ft_dump(aim_pvs_t* pvs)
 {
     ft_entry_t *entry;
     list_links_t *cur, *next;
+    of_match_t match;
 
     FT_ITER(ind_core_ft, entry, cur, next) {
         aim_printf(pvs, "Flow %d:\n", entry->id);
-        loci_dump_match((loci_writer_f)aim_printf, pvs, &entry->match);
+        ft_match_unpack(entry->match, &match);
+        loci_dump_match((loci_writer_f)aim_printf, pvs, &match);
         aim_printf(pvs, "cookie: 0x%016"PRIx64"\n", entry->cookie);
         aim_printf(pvs, "idle_timeout: %hu\n", entry->idle_timeout);
         aim_printf(pvs, "hard_timeout: %hu\n", entry->hard_timeout);
@@ -1003,7 +1402,7 @@ ind_core_ft_dump(aim_pvs_t* pvs)
         aim_printf(pvs, "flags: %hu\n", entry->flags);
         aim_printf(pvs, "table_id: %hhu\n", entry->table_id);
 
-        if (entry->match.version == OF_VERSION_1_0) {
+        if (entry->match->version == OF_VERSION_1_0) {
             int rv;
             of_action_t elt;
             OF_LIST_ACTION_ITER(entry->effects.actions, &elt, rv) {
@@ -1026,15 +1425,17 @@ ind_core_ft_show(aim_pvs_t* pvs)
 {
     ft_entry_t *entry;
     list_links_t *cur, *next;
+    of_match_t match;
 
     FT_ITER(ind_core_ft, entry, cur, next) {
         aim_printf(pvs, "Flow %d: ", entry->id);
-        loci_show_match((loci_writer_f)aim_printf, pvs, &entry->match);
+        ft_match_unpack(entry->match, &match);
+        loci_show_match((loci_writer_f)aim_printf, pvs, &match);
         aim_printf(pvs, "cookie=0x%016"PRIx64" ", entry->cookie);
         aim_printf(pvs, "priority=%hu ", entry->priority);
         aim_printf(pvs, "table_id=%hhu ", entry->table_id);
 
-        if (entry->match.version == OF_VERSION_1_0) {
+        if (entry->match->version == OF_VERSION_1_0) {
             int rv;
             of_action_t elt;
             OF_LIST_ACTION_ITER(entry->effects.actions, &elt, rv) {
@@ -1056,6 +1457,34 @@ ind_core_ft_show(aim_pvs_t* pvs)
     }
 }
 
+#define KB(_bytes) ((unsigned long long)((_bytes) + 1023) / 1024)
+
+static void
+ind_core_ft_memory_show(aim_pvs_t *pvs, ft_instance_t ft)
+{
+    ft_memory_t mem;
+
+    ft_memory_get(ft, &mem);
+    aim_printf(pvs, "  Memory:         %llu KB", KB(FT_MEMORY_TOTAL(&mem)));
+    if (ft->status.current_count > 0) {
+        aim_printf(pvs, ", %llu bytes per flow",
+                   (unsigned long long)(FT_MEMORY_TOTAL(&mem) /
+                                        ft->status.current_count));
+    }
+    aim_printf(pvs, "\n");
+    aim_printf(pvs, "    Entries:      %llu KB (%llu KB in use)\n",
+               KB(mem.entries), KB(mem.entries_used));
+    aim_printf(pvs, "    Effects:      %llu KB (%llu KB in use)\n",
+               KB(mem.effects), KB(mem.effects_used));
+    aim_printf(pvs, "    Matches:      %llu KB (%llu KB in use)\n",
+               KB(mem.matches), KB(mem.matches_used));
+    aim_printf(pvs, "    Indexes:      %llu KB\n", KB(mem.indexes));
+    aim_printf(pvs, "    Iterators:    %llu KB (%d tasks, %d coroutines, "
+               "%d deleted flows held)\n",
+               KB(mem.iterators), ft->iter_tasks, ind_soc_coroutine_count(),
+               ft->retired_count);
+}
+
 void
 ind_core_ft_stats(aim_pvs_t *pvs)
 {
@@ -1069,10 +1498,64 @@ ind_core_ft_stats(aim_pvs_t *pvs)
     aim_printf(pvs, "  Hard Exp:       %d\n", (int)ft->status.hard_expires);
     aim_printf(pvs, "  Idle Exp:       %d\n", (int)ft->status.idle_expires);
     aim_printf(pvs, "  Updates:        %d\n", (int)ft->status.updates);
+    aim_printf(pvs, "  No-op updates:  %d\n", (int)ft->status.noop_updates);
     aim_printf(pvs, "  Full Errors:    %d\n",
                (int)ft->status.table_full_errors);
     aim_printf(pvs, "  Fwd Add Errors: %d\n",
                (int)ft->status.forwarding_add_errors);
+    aim_printf(pvs, "  Strict match index: %u cells, %u used, %u removed\n",
+               ft->strict_match_index.size, ft->strict_match_index.count,
+               ft->strict_match_index.tombstones);
+    aim_printf(pvs, "  Flow ID index:      %d buckets, load factor %d.%02d\n",
+               ft->flow_id_index.bucket_count,
+               FT_INDEX_LOAD_PERCENT(ft, flow_id_index) / 100,
+               FT_INDEX_LOAD_PERCENT(ft, flow_id_index) % 100);
+    aim_printf(pvs, "  Cookie index:       %d buckets, load factor %d.%02d\n",
+               ft->cookie_index.bucket_count,
+               FT_INDEX_LOAD_PERCENT(ft, cookie_index) / 100,
+               FT_INDEX_LOAD_PERCENT(ft, cookie_index) % 100);
+    aim_printf(pvs, "  Cookie prefix:      %d bits\n",
+               ft->config.cookie_prefix_len);
+    ind_core_ft_memory_show(pvs, ft);
+}
+
+void
+ind_core_memory_stats(aim_pvs_t *pvs)
+{
+    ft_memory_t mem;
+    uint64_t groups, meters = 0, gentables, total;
+    int gentable_entries;
+
+    ft_memory_get(ind_core_ft, &mem);
+    groups = ind_core_group_memory();
+#ifdef OFDPA_FIXUP
+    meters = ind_core_meter_memory();
+#endif
+    gentables = ind_core_gentable_memory(&gentable_entries);
+    total = FT_MEMORY_TOTAL(&mem) + groups + meters + gentables;
+
+    aim_printf(pvs, "State manager memory: %llu KB\n", KB(total));
+    aim_printf(pvs, "Flow table: %d flows\n", ind_core_ft->status.current_count);
+    ind_core_ft_memory_show(pvs, ind_core_ft);
+    aim_printf(pvs, "Groups:     %d groups, %llu KB\n",
+               ind_core_group_count(), KB(groups));
+#ifdef OFDPA_FIXUP
+    aim_printf(pvs, "Meters:     %d meters, %llu KB\n",
+               ind_core_meter_count(), KB(meters));
+#endif
+    aim_printf(pvs, "Gentables:  %d entries, %llu KB\n",
+               gentable_entries, KB(gentables));
+    /* Flow table pools and connection output rings are carved from it */
+    indigo_mem_arena_show(pvs);
+}
+
+void
+ind_core_ft_pool_stats(aim_pvs_t *pvs)
+{
+    aim_printf(pvs, "Flow table pools:\n");
+    ft_pools_show(ind_core_ft, pvs);
+    aim_printf(pvs, "Gentable pools:\n");
+    ind_core_gentable_pools_show(pvs);
 }
 
 
@@ -1088,14 +1571,38 @@ indigo_core_stats_get(uint32_t *total_flows,
                       uint32_t *packet_ins,
                       uint32_t *packet_outs)
 {
+    uint64_t flow_mods_now = debug_counter_get(&ind_core_flow_mods);
+    uint64_t packet_ins_now = debug_counter_get(&ind_core_packet_ins);
+    uint64_t packet_outs_now = debug_counter_get(&ind_core_packet_outs);
+
     *total_flows = ind_core_ft->status.current_count;
-    *flow_mods = ind_core_flow_mods;
-    *packet_ins = ind_core_packet_ins;
-    *packet_outs = ind_core_packet_outs;
+    *flow_mods = flow_mods_now - ind_core_flow_mods_last;
+    *packet_ins = packet_ins_now - ind_core_packet_ins_last;
+    *packet_outs = packet_outs_now - ind_core_packet_outs_last;
+
+    ind_core_flow_mods_last = flow_mods_now;
+    ind_core_packet_ins_last = packet_ins_now;
+    ind_core_packet_outs_last = packet_outs_now;
+}
+
+uint32_t
+indigo_core_table_flow_count(uint8_t table_id)
+{
+    if (ind_core_ft == NULL) {
+        return 0;
+    }
+
+    return ind_core_ft->table_counts[table_id];
+}
+
+uint16_t
+indigo_core_miss_send_len_get(void)
+{
+    if (!ind_core_of_config.config_set_done) {
+        return OF_CONTROLLER_PKT_NO_BUFFER;
+    }
 
-    ind_core_flow_mods = 0;
-    ind_core_packet_ins = 0;
-    ind_core_packet_outs = 0;
+    return ind_core_of_config.miss_send_len;
 }
 
 
@@ -1118,6 +1625,24 @@ ind_core_dup_tracking(of_object_t *obj, indigo_cxn_id_t cxn_id)
     return new_obj;
 }
 
+/**
+ * Take ownership of the message passed to a handler
+ *
+ * Like ind_core_dup_tracking, but avoids the copy when the connection
+ * manager can hand over the message's read buffer. Only for the object
+ * the handler was called with.
+ *
+ * This function does not return NULL.
+ */
+
+of_object_t *
+ind_core_claim_tracking(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+    of_object_t *new_obj = indigo_cxn_message_claim(cxn_id, obj);
+    AIM_TRUE_OR_DIE(new_obj != NULL);
+    return new_obj;
+}
+
 #ifdef OFDPA_FIXUP
 /**
  * Handles flow expiry that occured in the datapath.
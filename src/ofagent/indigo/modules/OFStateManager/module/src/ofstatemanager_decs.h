@@ -34,16 +34,51 @@ extern int ind_core_module_enabled;
 
 /* State manager configuration data, shared within module */
 extern ind_core_of_config_t ind_core_of_config;
+extern ind_core_config_t ind_core_config;
 
 /* The flow table instance visible to all parts of the module */
 extern ft_instance_t ind_core_ft;
 
 extern void ind_core_flow_entry_delete(ft_entry_t *entry,
                                        indigo_fi_flow_removed_t reason);
+extern void ind_core_flow_entries_delete(ft_entry_t **entries, int count,
+                                         indigo_fi_flow_removed_t reason);
+extern indigo_error_t ind_core_flow_table_purge(uint8_t table_id);
+extern void ind_core_aggregate_stats_timer(void *cookie);
+extern indigo_error_t ind_core_entry_stats_get(ft_entry_t *entry,
+                                               indigo_fi_flow_stats_t *flow_stats);
+extern void ind_core_entries_stats_get(ft_entry_t **entries, int count,
+                                       indigo_fi_flow_stats_t *flow_stats,
+                                       indigo_error_t *results);
+
+/* Heap bytes held by an object from of_object_dup */
+#define IND_CORE_DUP_BYTES(_obj)                                        \
+    (sizeof(of_object_t) + sizeof(of_wire_buffer_t) + (_obj)->length)
+
+/* Heap bytes held by a table from bighash_table_create */
+#define IND_CORE_BIGHASH_BYTES(_table)                                  \
+    (sizeof(bighash_table_t) +                                          \
+     (_table)->bucket_alloc * sizeof(bighash_entry_t *))
 
 void ind_core_group_init(void);
+int ind_core_group_count(void);
+uint64_t ind_core_group_memory(void);
+indigo_error_t ind_core_group_snapshot_load(of_group_add_t *group_add);
+void ind_core_group_snapshot_unload(uint32_t id);
+void ind_core_group_snapshot_save(void);
 
 #ifdef OFDPA_FIXUP
 void ind_core_meter_init(void);
+int ind_core_meter_count(void);
+uint64_t ind_core_meter_memory(void);
+indigo_error_t ind_core_meter_snapshot_load(of_meter_add_t *meter_add);
+void ind_core_meter_snapshot_unload(uint32_t id);
+void ind_core_meter_snapshot_save(void);
 #endif
+
+uint64_t ind_core_gentable_memory(int *num_entries);
+void ind_core_gentable_pools_show(aim_pvs_t *pvs);
+void ind_core_gentable_pending_flush(void);
+
+void ind_core_snapshot_stop(void);
 #endif /* OFSTATEMANAGER_DECS_H */
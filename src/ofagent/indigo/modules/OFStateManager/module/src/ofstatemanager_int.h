@@ -32,6 +32,7 @@
 /* C file must include appropriate log header */
 
 #include <indigo/fi.h>
+#include <indigo/log.h>
 #include <indigo/of_connection_manager.h>
 #include <SocketManager/socketmanager.h>
 #include <OFStateManager/ofstatemanager_config.h>
@@ -43,6 +44,7 @@
 #define LOG_INFO AIM_LOG_INFO
 #define LOG_VERBOSE AIM_LOG_VERBOSE
 #define LOG_TRACE AIM_LOG_TRACE
+#define LOG_ERROR_RL(...) INDIGO_LOG_RL(AIM_LOG_ERROR, __VA_ARGS__)
 
 /**
  * Try an operation and return the error code on failure.
@@ -122,6 +124,7 @@ void ind_core_test_gentable_init(void);
 void ind_core_test_gentable_finish(void);
 
 of_object_t *ind_core_dup_tracking(of_object_t *obj, indigo_cxn_id_t cxn_id);
+of_object_t *ind_core_claim_tracking(of_object_t *obj, indigo_cxn_id_t cxn_id);
 
 #include <OFStateManager/ofstatemanager.h>
 
@@ -34,6 +34,12 @@
 #include <uCli/ucli.h>
 #include <uCli/ucli_argparse.h>
 #include <uCli/ucli_handler_macros.h>
+#include <OFStateManager/ofstatemanager.h>
+#include "flow_counters.h"
+#include "flow_monitor.h"
+#include "reply_cache.h"
+#include "loading.h"
+#include "experimenter.h"
 
 
 
@@ -48,6 +54,92 @@ ofstatemanager_ucli_ucli__config__(ucli_context_t* uc)
     return UCLI_STATUS_OK;
 }
 
+static ucli_status_t
+ofstatemanager_ucli_ucli__pools__(ucli_context_t* uc)
+{
+    UCLI_COMMAND_INFO(uc,
+                      "pools", 0,
+                      "$summary#Show flow table and gentable pool occupancy.");
+
+    ind_core_ft_pool_stats(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+
+static ucli_status_t
+ofstatemanager_ucli_ucli__memory__(ucli_context_t* uc)
+{
+    UCLI_COMMAND_INFO(uc,
+                      "memory", 0,
+                      "$summary#Show memory used by flows, groups, meters and gentables.");
+
+    ind_core_memory_stats(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+
+static ucli_status_t
+ofstatemanager_ucli_ucli__flowcounters__(ucli_context_t* uc)
+{
+    UCLI_COMMAND_INFO(uc,
+                      "flowcounters", 0,
+                      "$summary#Show the flow counter subscription.");
+
+    ind_core_flow_counters_show(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ofstatemanager_ucli_ucli__flowmonitors__(ucli_context_t* uc)
+{
+    UCLI_COMMAND_INFO(uc,
+                      "flowmonitors", 0,
+                      "$summary#Show the flow monitors.");
+
+    ind_core_flow_monitor_show(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ofstatemanager_ucli_ucli__replycache__(ucli_context_t* uc)
+{
+    UCLI_COMMAND_INFO(uc,
+                      "replycache", 0,
+                      "$summary#Show the cached desc, features and port desc replies.");
+
+    ind_core_reply_cache_show(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ofstatemanager_ucli_ucli__loading__(ucli_context_t* uc)
+{
+    UCLI_COMMAND_INFO(uc,
+                      "loading", 0,
+                      "$summary#Show the background restore and the requests held for it.");
+
+    ind_core_loading_show(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ofstatemanager_ucli_ucli__experimenter__(ucli_context_t* uc)
+{
+    UCLI_COMMAND_INFO(uc,
+                      "experimenter", 0,
+                      "$summary#Show the registered experimenter handlers and their stats.");
+
+    ind_core_experimenter_show(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
 
 /* <auto.ucli.handlers.start> */
 /******************************************************************************
@@ -59,6 +151,13 @@ ofstatemanager_ucli_ucli__config__(ucli_context_t* uc)
 static ucli_command_handler_f ofstatemanager_ucli_ucli_handlers__[] =
 {
     ofstatemanager_ucli_ucli__config__,
+    ofstatemanager_ucli_ucli__pools__,
+    ofstatemanager_ucli_ucli__memory__,
+    ofstatemanager_ucli_ucli__flowcounters__,
+    ofstatemanager_ucli_ucli__flowmonitors__,
+    ofstatemanager_ucli_ucli__replycache__,
+    ofstatemanager_ucli_ucli__loading__,
+    ofstatemanager_ucli_ucli__experimenter__,
     NULL
 };
 /******************************************************************************/
@@ -0,0 +1,204 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Cached replies to requests for static switch data and stats
+ *
+ * The desc, features and port desc replies are rebuilt from the same
+ * data on every request, and each controller connection, and each
+ * monitoring poller, asks for them again. The encoded reply is kept
+ * instead, and a request is answered with a copy of it and the
+ * request's xid.
+ *
+ * A cached reply is dropped when the data behind it changes: the desc
+ * strings, the DPID, or any port status or port mod. Only the last
+ * version asked for is kept.
+ *
+ * Each controller, and the monitoring poller, also sends the same port,
+ * table and group stats requests within a second or so of each other.
+ * With ind_core_config.stats_reply_cache_ms set, those replies are kept
+ * for that long, and a request with the same body is answered from the
+ * copy instead of being computed again.  Port and group stats replies
+ * are dropped early when ports or groups come or go, but the counters
+ * in them are as old as the first request.
+ *
+ * A reply is only reused for a request with the same version and the
+ * same bytes after the OpenFlow header, so the stats type, flags and
+ * selectors such as port_no or group_id all match.
+ */
+
+#include "ofstatemanager_log.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+#include <indigo/indigo.h>
+#include <loci/loci.h>
+#include "ofstatemanager_decs.h"
+#include "reply_cache.h"
+
+static const char *cache_names[IND_CORE_REPLY_CACHE_COUNT] = {
+    "desc",
+    "features",
+    "port_desc",
+    "port_stats",
+    "table_stats",
+    "group_stats",
+};
+
+#define REPLY_CACHE_KEY_OFFSET 8   /* Past the OpenFlow header and its xid */
+
+static struct {
+    of_object_t *reply;
+    uint8_t *key;               /* Request body the reply answers */
+    int key_len;
+    indigo_time_t stored;       /* When the reply was kept */
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t invalidations;
+} reply_cache[IND_CORE_REPLY_CACHE_COUNT];
+
+/* True for the stats caches, whose replies are only kept briefly */
+static int
+reply_cache_timed(ind_core_reply_cache_t cache)
+{
+    return cache >= IND_CORE_REPLY_CACHE_PORT_STATS;
+}
+
+/* The request's bytes that the reply depends on */
+static int
+reply_cache_key(of_object_t *request, uint8_t **key)
+{
+    *key = OF_OBJECT_BUFFER_INDEX(request, REPLY_CACHE_KEY_OFFSET);
+    return request->length - REPLY_CACHE_KEY_OFFSET;
+}
+
+int
+ind_core_reply_cache_send(ind_core_reply_cache_t cache,
+                          of_object_t *request, indigo_cxn_id_t cxn_id)
+{
+    of_object_t *cached = reply_cache[cache].reply;
+    of_object_t *reply;
+    uint8_t *key;
+    int key_len;
+    uint32_t xid;
+
+    if (reply_cache_timed(cache)) {
+        if (ind_core_config.stats_reply_cache_ms <= 0) {
+            return 0;
+        }
+        if (cached != NULL &&
+            INDIGO_CURRENT_TIME - reply_cache[cache].stored >=
+                (indigo_time_t)ind_core_config.stats_reply_cache_ms) {
+            ind_core_reply_cache_invalidate(cache);
+            cached = NULL;
+        }
+    }
+
+    key_len = reply_cache_key(request, &key);
+    if (cached == NULL || cached->version != request->version ||
+        key_len != reply_cache[cache].key_len ||
+        (key_len > 0 && memcmp(key, reply_cache[cache].key, key_len) != 0)) {
+        reply_cache[cache].misses++;
+        return 0;
+    }
+
+    if ((reply = of_object_dup(cached)) == NULL) {
+        reply_cache[cache].misses++;
+        return 0;
+    }
+
+    of_object_xid_get(request, &xid);
+    of_object_xid_set(reply, xid);
+    reply_cache[cache].hits++;
+
+    indigo_cxn_send_controller_message(cxn_id, reply);
+
+    return 1;
+}
+
+void
+ind_core_reply_cache_store(ind_core_reply_cache_t cache,
+                           of_object_t *request, of_object_t *reply)
+{
+    of_object_t *copy;
+    uint8_t *key, *key_copy;
+    int key_len;
+
+    if (reply_cache_timed(cache) && ind_core_config.stats_reply_cache_ms <= 0) {
+        return;
+    }
+
+    if ((copy = of_object_dup(reply)) == NULL) {
+        LOG_VERBOSE("Failed to cache %s reply", cache_names[cache]);
+        return;
+    }
+
+    key_len = reply_cache_key(request, &key);
+    key_copy = key_len > 0 ? aim_memdup(key, key_len) : NULL;
+
+    if (reply_cache[cache].reply != NULL) {
+        of_object_delete(reply_cache[cache].reply);
+        aim_free(reply_cache[cache].key);
+    }
+    reply_cache[cache].reply = copy;
+    reply_cache[cache].key = key_copy;
+    reply_cache[cache].key_len = key_len;
+    reply_cache[cache].stored = INDIGO_CURRENT_TIME;
+}
+
+void
+ind_core_reply_cache_invalidate(ind_core_reply_cache_t cache)
+{
+    if (reply_cache[cache].reply != NULL) {
+        of_object_delete(reply_cache[cache].reply);
+        reply_cache[cache].reply = NULL;
+        aim_free(reply_cache[cache].key);
+        reply_cache[cache].key = NULL;
+        reply_cache[cache].key_len = 0;
+        reply_cache[cache].invalidations++;
+    }
+}
+
+void
+ind_core_reply_cache_clear(void)
+{
+    int i;
+
+    for (i = 0; i < IND_CORE_REPLY_CACHE_COUNT; i++) {
+        ind_core_reply_cache_invalidate(i);
+    }
+}
+
+void
+ind_core_reply_cache_show(aim_pvs_t *pvs)
+{
+    int i;
+
+    aim_printf(pvs, "%-11s %-6s %12s %12s %12s\n", "reply", "cached",
+               "hits", "misses", "invalidated");
+    for (i = 0; i < IND_CORE_REPLY_CACHE_COUNT; i++) {
+        aim_printf(pvs, "%-11s %-6s %12"PRIu64" %12"PRIu64" %12"PRIu64"\n",
+                   cache_names[i],
+                   reply_cache[i].reply != NULL ? "yes" : "no",
+                   reply_cache[i].hits, reply_cache[i].misses,
+                   reply_cache[i].invalidations);
+    }
+}
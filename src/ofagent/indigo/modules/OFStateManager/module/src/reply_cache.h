@@ -0,0 +1,72 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Cached replies to requests for static switch data and stats
+ *
+ * See reply_cache.c.
+ */
+
+#ifndef _OFSTATEMANAGER_REPLY_CACHE_H_
+#define _OFSTATEMANAGER_REPLY_CACHE_H_
+
+#include <indigo/indigo.h>
+#include <indigo/of_connection_manager.h>
+#include <loci/loci.h>
+
+typedef enum ind_core_reply_cache_e {
+    IND_CORE_REPLY_CACHE_DESC,
+    IND_CORE_REPLY_CACHE_FEATURES,
+    IND_CORE_REPLY_CACHE_PORT_DESC,
+    /* Kept for ind_core_config.stats_reply_cache_ms only */
+    IND_CORE_REPLY_CACHE_PORT_STATS,
+    IND_CORE_REPLY_CACHE_TABLE_STATS,
+    IND_CORE_REPLY_CACHE_GROUP_STATS,
+    IND_CORE_REPLY_CACHE_COUNT,
+} ind_core_reply_cache_t;
+
+/**
+ * Answer a request from the cache
+ *
+ * @returns 1 if a copy of the cached reply, with the request's xid, was
+ * sent; 0 if there is none for the request's version and body
+ */
+int ind_core_reply_cache_send(ind_core_reply_cache_t cache,
+                              of_object_t *request, indigo_cxn_id_t cxn_id);
+
+/**
+ * Keep a copy of a reply to request that is about to be sent
+ */
+void ind_core_reply_cache_store(ind_core_reply_cache_t cache,
+                                of_object_t *request, of_object_t *reply);
+
+/**
+ * Drop a cached reply because the data behind it changed
+ */
+void ind_core_reply_cache_invalidate(ind_core_reply_cache_t cache);
+
+/**
+ * Drop all cached replies
+ */
+void ind_core_reply_cache_clear(void);
+
+void ind_core_reply_cache_show(aim_pvs_t *pvs);
+
+#endif /* _OFSTATEMANAGER_REPLY_CACHE_H_ */
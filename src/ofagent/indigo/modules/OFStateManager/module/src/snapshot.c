@@ -0,0 +1,741 @@
+/****************************************************************
+ *
+ *        Copyright 2014, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief State snapshot
+ *
+ * The snapshot is a memory mapped journal of flow, group and meter
+ * records.  Each change to the tables appends the new state of the object
+ * (or an erase record) and then advances the committed length in the
+ * file header, so a crash leaves at most a partial record past the end.
+ * Later records for an ID replace earlier ones.  When the journal fills
+ * it is rewritten from the live tables into a new file that is renamed
+ * over the old one.
+ *
+ * Fetching every entry back from forwarding is what makes a warm start
+ * slow, so a restore only checks the snapshot against forwarding's flow
+ * count for each table and its group count.  The difference between
+ * forwarding's counts and the tables' counts when the snapshot was
+ * started is kept in the header, so state forwarding holds outside the
+ * tables does not fail the check.
+ */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <OFStateManager/ofstatemanager_config.h>
+#include <OFStateManager/ofstatemanager.h>
+#include <indigo/indigo.h>
+#include <indigo/of_state_manager.h>
+#include <indigo/forwarding.h>
+#include <loci/loci.h>
+#include <murmur/murmur.h>
+
+#include "ofstatemanager_log.h"
+#include "ofstatemanager_decs.h"
+#include "ofstatemanager_int.h"
+#include "ft.h"
+#include "ft_match.h"
+#include "snapshot.h"
+
+#define IND_CORE_SNAPSHOT_MAGIC 0x4f465353 /* "OFSS" */
+#define IND_CORE_SNAPSHOT_VERSION 1
+
+/* Record space in a new file; doubled as needed */
+#define IND_CORE_SNAPSHOT_CAPACITY_MIN (1 << 20)
+
+#define IND_CORE_SNAPSHOT_ALIGN(_bytes) (((uint64_t)(_bytes) + 7) & ~7ULL)
+
+#define IND_CORE_SNAPSHOT_TABLE_COUNT 256
+
+enum ind_core_snapshot_record_type_e {
+    IND_CORE_SNAPSHOT_FLOW = 1,
+    IND_CORE_SNAPSHOT_FLOW_ERASE = 2,
+    IND_CORE_SNAPSHOT_GROUP = 3,
+    IND_CORE_SNAPSHOT_GROUP_ERASE = 4,
+    IND_CORE_SNAPSHOT_METER = 5,
+    IND_CORE_SNAPSHOT_METER_ERASE = 6,
+};
+
+typedef struct ind_core_snapshot_header_s {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_bytes;      /* Offset of the first record */
+    uint64_t used;              /* Bytes of committed records */
+    uint64_t capacity;          /* Bytes of record space in the file */
+    int32_t flow_base[IND_CORE_SNAPSHOT_TABLE_COUNT]; /* Forwarding less table flows */
+    int32_t group_base;         /* Forwarding less table groups */
+    uint32_t pad;
+} ind_core_snapshot_header_t;
+
+/* Each record is followed by its payload, padded to 8 bytes */
+typedef struct ind_core_snapshot_record_s {
+    uint16_t type;
+    uint16_t table_id;          /* Flow records only */
+    uint32_t bytes;             /* Payload length, without padding */
+    uint64_t id;
+    uint32_t checksum;          /* murmur_hash of the payload */
+    uint32_t pad;
+} ind_core_snapshot_record_t;
+
+typedef struct ind_core_snapshot_file_s {
+    int fd;
+    ind_core_snapshot_header_t *header; /* Start of the mapping */
+    size_t map_bytes;
+} ind_core_snapshot_file_t;
+
+/* The open snapshot; header is NULL when there is none */
+static ind_core_snapshot_file_t ind_core_snapshot_file = { .fd = -1 };
+static char *ind_core_snapshot_path;
+static int32_t ind_core_snapshot_flow_base[IND_CORE_SNAPSHOT_TABLE_COUNT];
+static int32_t ind_core_snapshot_group_base;
+static bool ind_core_snapshot_rewriting;
+
+static indigo_error_t ind_core_snapshot_rewrite(void);
+
+static void
+ind_core_snapshot_unmap(ind_core_snapshot_file_t *file)
+{
+    if (file->header != NULL) {
+        munmap(file->header, file->map_bytes);
+    }
+    if (file->fd >= 0) {
+        close(file->fd);
+    }
+    file->fd = -1;
+    file->header = NULL;
+    file->map_bytes = 0;
+}
+
+/* Size the file for the given record space and map it writable */
+static indigo_error_t
+ind_core_snapshot_map(ind_core_snapshot_file_t *file, uint64_t capacity)
+{
+    size_t map_bytes = sizeof(ind_core_snapshot_header_t) + capacity;
+    void *addr;
+
+    if (ftruncate(file->fd, map_bytes) < 0) {
+        LOG_ERROR("Failed to size snapshot to %zu bytes: %s",
+                  map_bytes, strerror(errno));
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    addr = mmap(NULL, map_bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                file->fd, 0);
+    if (addr == MAP_FAILED) {
+        LOG_ERROR("Failed to map snapshot: %s", strerror(errno));
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    /* The new mapping sees the records written through the old one */
+    if (file->header != NULL) {
+        munmap(file->header, file->map_bytes);
+    }
+    file->header = addr;
+    file->map_bytes = map_bytes;
+    file->header->capacity = capacity;
+
+    return INDIGO_ERROR_NONE;
+}
+
+/*
+ * Stop keeping the snapshot after a failure.  The file is removed so a
+ * restart does not trust a journal with changes missing.
+ */
+static void
+ind_core_snapshot_abandon(void)
+{
+    LOG_ERROR("Abandoning snapshot %s", ind_core_snapshot_path);
+
+    ind_core_snapshot_unmap(&ind_core_snapshot_file);
+    unlink(ind_core_snapshot_path);
+    aim_free(ind_core_snapshot_path);
+    ind_core_snapshot_path = NULL;
+}
+
+static void
+ind_core_snapshot_append(uint16_t type, uint16_t table_id, uint64_t id,
+                         const void *payload, uint32_t bytes)
+{
+    ind_core_snapshot_header_t *header = ind_core_snapshot_file.header;
+    ind_core_snapshot_record_t *record;
+    uint64_t need = sizeof(*record) + IND_CORE_SNAPSHOT_ALIGN(bytes);
+    uint64_t capacity;
+
+    if (header->used + need > header->capacity) {
+        /* Most of a full journal is records superseded by later ones */
+        if (!ind_core_snapshot_rewriting && ind_core_snapshot_rewrite() < 0) {
+            return;
+        }
+
+        /* Leave room to journal at least as much as the live state */
+        header = ind_core_snapshot_file.header;
+        capacity = header->capacity;
+        while (header->used + need > capacity / 2) {
+            capacity *= 2;
+        }
+        if (capacity != header->capacity &&
+            ind_core_snapshot_map(&ind_core_snapshot_file, capacity) < 0) {
+            ind_core_snapshot_abandon();
+            return;
+        }
+        header = ind_core_snapshot_file.header;
+    }
+
+    record = (void *)((uint8_t *)header + header->header_bytes + header->used);
+    record->type = type;
+    record->table_id = table_id;
+    record->bytes = bytes;
+    record->id = id;
+    record->checksum = murmur_hash(payload, bytes, 0);
+    record->pad = 0;
+    if (bytes > 0) {
+        memcpy(record + 1, payload, bytes);
+    }
+    memset((uint8_t *)(record + 1) + bytes, 0,
+           IND_CORE_SNAPSHOT_ALIGN(bytes) - bytes);
+
+    /* Commit the record */
+    header->used += need;
+}
+
+static void
+ind_core_snapshot_object_append(uint16_t type, uint16_t table_id, uint64_t id,
+                                of_object_t *obj)
+{
+    ind_core_snapshot_append(type, table_id, id,
+                             OF_OBJECT_BUFFER_INDEX(obj, 0), obj->length);
+}
+
+/* Build a flow_add that recreates the entry */
+of_flow_add_t *
+ind_core_snapshot_flow_add_build(ft_entry_t *entry)
+{
+    of_flow_add_t *flow_add;
+    of_match_t match;
+
+    if (entry->effects.actions == NULL) {
+        return NULL;
+    }
+
+    if ((flow_add = of_flow_add_new(entry->effects.actions->version)) == NULL) {
+        return NULL;
+    }
+
+    of_flow_add_cookie_set(flow_add, entry->cookie);
+    of_flow_add_priority_set(flow_add, entry->priority);
+    of_flow_add_flags_set(flow_add, entry->flags);
+    of_flow_add_idle_timeout_set(flow_add, entry->idle_timeout);
+    of_flow_add_hard_timeout_set(flow_add, entry->hard_timeout);
+    of_flow_add_buffer_id_set(flow_add, OF_BUFFER_ID_NO_BUFFER);
+
+    ft_match_unpack(entry->match, &match);
+    if (of_flow_add_match_set(flow_add, &match) < 0) {
+        goto error;
+    }
+
+    if (flow_add->version >= OF_VERSION_1_1) {
+        of_flow_add_table_id_set(flow_add, entry->table_id);
+        if (of_flow_add_instructions_set(flow_add,
+                                         entry->effects.instructions) < 0) {
+            goto error;
+        }
+    } else {
+        if (of_flow_add_actions_set(flow_add, entry->effects.actions) < 0) {
+            goto error;
+        }
+    }
+
+    return flow_add;
+
+error:
+    of_object_delete(flow_add);
+    return NULL;
+}
+
+void
+ind_core_snapshot_flow_write(ft_entry_t *entry, of_flow_add_t *flow_add)
+{
+    of_flow_add_t *rebuilt = NULL;
+
+    if (ind_core_snapshot_file.header == NULL) {
+        return;
+    }
+
+    if (flow_add == NULL || flow_add->object_id != OF_FLOW_ADD) {
+        if ((rebuilt = ind_core_snapshot_flow_add_build(entry)) == NULL) {
+            LOG_ERROR("Failed to build snapshot record for flow "
+                      INDIGO_FLOW_ID_PRINTF_FORMAT, entry->id);
+            ind_core_snapshot_abandon();
+            return;
+        }
+        flow_add = rebuilt;
+    }
+
+    ind_core_snapshot_object_append(IND_CORE_SNAPSHOT_FLOW, entry->table_id,
+                                    entry->id, flow_add);
+
+    if (rebuilt != NULL) {
+        of_object_delete(rebuilt);
+    }
+}
+
+void
+ind_core_snapshot_flow_erase(indigo_flow_id_t id)
+{
+    if (ind_core_snapshot_file.header == NULL) {
+        return;
+    }
+
+    ind_core_snapshot_append(IND_CORE_SNAPSHOT_FLOW_ERASE, 0, id, NULL, 0);
+}
+
+void
+ind_core_snapshot_group_write(uint32_t id, uint8_t type,
+                              of_list_bucket_t *buckets)
+{
+    of_group_add_t *group_add;
+
+    if (ind_core_snapshot_file.header == NULL) {
+        return;
+    }
+
+    if ((group_add = of_group_add_new(buckets->version)) == NULL) {
+        goto error;
+    }
+
+    of_group_add_group_type_set(group_add, type);
+    of_group_add_group_id_set(group_add, id);
+    if (of_group_add_buckets_set(group_add, buckets) < 0) {
+        of_object_delete(group_add);
+        goto error;
+    }
+
+    ind_core_snapshot_object_append(IND_CORE_SNAPSHOT_GROUP, 0, id, group_add);
+    of_object_delete(group_add);
+    return;
+
+error:
+    LOG_ERROR("Failed to build snapshot record for group 0x%x", id);
+    ind_core_snapshot_abandon();
+}
+
+void
+ind_core_snapshot_group_erase(uint32_t id)
+{
+    if (ind_core_snapshot_file.header == NULL) {
+        return;
+    }
+
+    ind_core_snapshot_append(IND_CORE_SNAPSHOT_GROUP_ERASE, 0, id, NULL, 0);
+}
+
+void
+ind_core_snapshot_meter_write(uint32_t id, uint16_t flags,
+                              of_list_meter_band_t *bands)
+{
+    of_meter_add_t *meter_add;
+
+    if (ind_core_snapshot_file.header == NULL) {
+        return;
+    }
+
+    if ((meter_add = of_meter_add_new(bands->version)) == NULL) {
+        goto error;
+    }
+
+    of_meter_add_flags_set(meter_add, flags);
+    of_meter_add_meter_id_set(meter_add, id);
+    if (of_meter_add_meters_set(meter_add, bands) < 0) {
+        of_object_delete(meter_add);
+        goto error;
+    }
+
+    ind_core_snapshot_object_append(IND_CORE_SNAPSHOT_METER, 0, id, meter_add);
+    of_object_delete(meter_add);
+    return;
+
+error:
+    LOG_ERROR("Failed to build snapshot record for meter %u", id);
+    ind_core_snapshot_abandon();
+}
+
+void
+ind_core_snapshot_meter_erase(uint32_t id)
+{
+    if (ind_core_snapshot_file.header == NULL) {
+        return;
+    }
+
+    ind_core_snapshot_append(IND_CORE_SNAPSHOT_METER_ERASE, 0, id, NULL, 0);
+}
+
+/*
+ * Write the live tables to a new file and rename it over the snapshot.
+ * On failure the snapshot is abandoned.
+ */
+static indigo_error_t
+ind_core_snapshot_rewrite(void)
+{
+    ind_core_snapshot_file_t old = ind_core_snapshot_file;
+    ind_core_snapshot_file_t file = { .fd = -1 };
+    ind_core_snapshot_header_t *header;
+    char tmp_path[PATH_MAX];
+    uint64_t capacity = IND_CORE_SNAPSHOT_CAPACITY_MIN;
+    list_links_t *cur, *next;
+    ft_entry_t *entry;
+
+    if (old.header != NULL && old.header->capacity > capacity) {
+        capacity = old.header->capacity;
+    }
+
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", ind_core_snapshot_path);
+    if ((file.fd = open(tmp_path, O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0) {
+        LOG_ERROR("Failed to create %s: %s", tmp_path, strerror(errno));
+        ind_core_snapshot_abandon();
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    if (ind_core_snapshot_map(&file, capacity) < 0) {
+        ind_core_snapshot_unmap(&file);
+        unlink(tmp_path);
+        ind_core_snapshot_abandon();
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    header = file.header;
+    header->magic = IND_CORE_SNAPSHOT_MAGIC;
+    header->version = IND_CORE_SNAPSHOT_VERSION;
+    header->header_bytes = sizeof(*header);
+    header->used = 0;
+    memcpy(header->flow_base, ind_core_snapshot_flow_base,
+           sizeof(header->flow_base));
+    header->group_base = ind_core_snapshot_group_base;
+    header->pad = 0;
+
+    /* The write hooks append to the new file from here */
+    ind_core_snapshot_file = file;
+    ind_core_snapshot_rewriting = true;
+
+    FT_ITER(ind_core_ft, entry, cur, next) {
+        ind_core_snapshot_flow_write(entry, NULL);
+    }
+    ind_core_group_snapshot_save();
+#ifdef OFDPA_FIXUP
+    ind_core_meter_snapshot_save();
+#endif
+
+    ind_core_snapshot_rewriting = false;
+
+    if (ind_core_snapshot_file.header == NULL) {
+        /* Abandoned while writing */
+        unlink(tmp_path);
+        ind_core_snapshot_unmap(&old);
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    if (rename(tmp_path, ind_core_snapshot_path) < 0) {
+        LOG_ERROR("Failed to rename %s: %s", tmp_path, strerror(errno));
+        unlink(tmp_path);
+        ind_core_snapshot_unmap(&old);
+        ind_core_snapshot_abandon();
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    ind_core_snapshot_unmap(&old);
+
+    LOG_VERBOSE("Rewrote snapshot %s: %" PRIu64 " bytes of records",
+                ind_core_snapshot_path, ind_core_snapshot_file.header->used);
+
+    return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+ind_core_snapshot_start(const char *path)
+{
+    uint32_t hw_count;
+    int table_id;
+    indigo_error_t rv;
+
+    if (ind_core_snapshot_file.header != NULL) {
+        return INDIGO_ERROR_EXISTS;
+    }
+
+    for (table_id = 0; table_id < IND_CORE_SNAPSHOT_TABLE_COUNT; table_id++) {
+        if ((rv = indigo_fwd_table_flow_count_get(table_id, &hw_count)) < 0) {
+            LOG_ERROR("Failed to get the flow count of table %d: %s",
+                      table_id, indigo_strerror(rv));
+            return rv;
+        }
+        ind_core_snapshot_flow_base[table_id] = hw_count -
+            ind_core_ft->table_counts[table_id];
+    }
+
+    if ((rv = indigo_fwd_group_count_get(&hw_count)) < 0) {
+        LOG_ERROR("Failed to get the group count: %s", indigo_strerror(rv));
+        return rv;
+    }
+    ind_core_snapshot_group_base = hw_count - ind_core_group_count();
+
+    ind_core_snapshot_path = aim_strdup(path);
+    if ((rv = ind_core_snapshot_rewrite()) < 0) {
+        return rv;
+    }
+
+    LOG_INFO("Keeping a snapshot in %s", path);
+
+    return INDIGO_ERROR_NONE;
+}
+
+void
+ind_core_snapshot_stop(void)
+{
+    if (ind_core_snapshot_file.header == NULL) {
+        return;
+    }
+
+    ind_core_snapshot_unmap(&ind_core_snapshot_file);
+    aim_free(ind_core_snapshot_path);
+    ind_core_snapshot_path = NULL;
+}
+
+static indigo_error_t
+ind_core_snapshot_record_apply(ind_core_snapshot_record_t *record,
+                               uint8_t *payload)
+{
+    of_object_storage_t storage;
+    of_object_t *obj = NULL;
+    ft_entry_t *entry;
+    indigo_error_t rv;
+
+    if (record->bytes > 0) {
+        if (record->bytes < OF_MESSAGE_HEADER_LENGTH ||
+            (obj = of_object_new_from_message_preallocated(
+                 &storage, payload, record->bytes)) == NULL) {
+            return INDIGO_ERROR_PARSE;
+        }
+    }
+
+    switch (record->type) {
+    case IND_CORE_SNAPSHOT_FLOW:
+        if (obj == NULL || obj->object_id != OF_FLOW_ADD) {
+            return INDIGO_ERROR_PARSE;
+        }
+        if ((entry = ft_lookup(ind_core_ft, record->id)) != NULL) {
+            ft_delete(ind_core_ft, entry);
+        }
+        if ((rv = indigo_core_flow_restore(record->id, obj)) < 0) {
+            return rv;
+        }
+        entry = ft_lookup(ind_core_ft, record->id);
+        ft_entry_table_id_set(ind_core_ft, entry, record->table_id);
+        return INDIGO_ERROR_NONE;
+    case IND_CORE_SNAPSHOT_FLOW_ERASE:
+        if ((entry = ft_lookup(ind_core_ft, record->id)) != NULL) {
+            ft_delete(ind_core_ft, entry);
+        }
+        return INDIGO_ERROR_NONE;
+    case IND_CORE_SNAPSHOT_GROUP:
+        if (obj == NULL || obj->object_id != OF_GROUP_ADD) {
+            return INDIGO_ERROR_PARSE;
+        }
+        return ind_core_group_snapshot_load(obj);
+    case IND_CORE_SNAPSHOT_GROUP_ERASE:
+        ind_core_group_snapshot_unload(record->id);
+        return INDIGO_ERROR_NONE;
+#ifdef OFDPA_FIXUP
+    case IND_CORE_SNAPSHOT_METER:
+        if (obj == NULL || obj->object_id != OF_METER_ADD) {
+            return INDIGO_ERROR_PARSE;
+        }
+        return ind_core_meter_snapshot_load(obj);
+    case IND_CORE_SNAPSHOT_METER_ERASE:
+        ind_core_meter_snapshot_unload(record->id);
+        return INDIGO_ERROR_NONE;
+#endif
+    default:
+        LOG_WARN("Unknown snapshot record type %u", record->type);
+        return INDIGO_ERROR_PARSE;
+    }
+}
+
+static indigo_error_t
+ind_core_snapshot_replay(ind_core_snapshot_header_t *header)
+{
+    uint8_t *records = (uint8_t *)header + header->header_bytes;
+    ind_core_snapshot_record_t *record;
+    uint64_t offset = 0;
+    uint64_t need;
+    uint8_t *payload;
+    indigo_error_t rv;
+
+    while (offset < header->used) {
+        record = (void *)(records + offset);
+        if (header->used - offset < sizeof(*record)) {
+            return INDIGO_ERROR_PARSE;
+        }
+        need = sizeof(*record) + IND_CORE_SNAPSHOT_ALIGN(record->bytes);
+        if (header->used - offset < need) {
+            return INDIGO_ERROR_PARSE;
+        }
+
+        payload = (uint8_t *)(record + 1);
+        if (murmur_hash(payload, record->bytes, 0) != record->checksum) {
+            LOG_WARN("Corrupt snapshot record at offset %" PRIu64, offset);
+            return INDIGO_ERROR_PARSE;
+        }
+
+        if ((rv = ind_core_snapshot_record_apply(record, payload)) < 0) {
+            LOG_WARN("Failed to apply snapshot record at offset %" PRIu64
+                     ": %s", offset, indigo_strerror(rv));
+            return rv;
+        }
+
+        offset += need;
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+/* Check the restored tables against forwarding's counts */
+static indigo_error_t
+ind_core_snapshot_verify(ind_core_snapshot_header_t *header)
+{
+    uint32_t hw_count;
+    int64_t count;
+    int table_id;
+    indigo_error_t rv;
+
+    for (table_id = 0; table_id < IND_CORE_SNAPSHOT_TABLE_COUNT; table_id++) {
+        if ((rv = indigo_fwd_table_flow_count_get(table_id, &hw_count)) < 0) {
+            return rv;
+        }
+        count = ind_core_ft->table_counts[table_id];
+        if (count + header->flow_base[table_id] != hw_count) {
+            LOG_WARN("Table %d has %u flows, snapshot expects %" PRId64,
+                     table_id, hw_count,
+                     count + header->flow_base[table_id]);
+            return INDIGO_ERROR_UNKNOWN;
+        }
+    }
+
+    if ((rv = indigo_fwd_group_count_get(&hw_count)) < 0) {
+        return rv;
+    }
+    count = ind_core_group_count();
+    if (count + header->group_base != hw_count) {
+        LOG_WARN("Forwarding has %u groups, snapshot expects %" PRId64,
+                 hw_count, count + header->group_base);
+        return INDIGO_ERROR_UNKNOWN;
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+/* Undo a partial restore */
+static void
+ind_core_snapshot_clear(void)
+{
+    list_links_t *cur, *next;
+    ft_entry_t *entry;
+
+    FT_ITER(ind_core_ft, entry, cur, next) {
+        ft_delete(ind_core_ft, entry);
+    }
+    ind_core_group_snapshot_unload(OF_GROUP_ALL);
+#ifdef OFDPA_FIXUP
+    ind_core_meter_snapshot_unload(OF_METER_ALL);
+#endif
+}
+
+indigo_error_t
+ind_core_snapshot_restore(const char *path)
+{
+    ind_core_snapshot_file_t file = { .fd = -1 };
+    ind_core_snapshot_header_t *header;
+    struct stat st;
+    void *addr;
+    indigo_error_t rv;
+
+    if (ind_core_snapshot_file.header != NULL ||
+        ind_core_ft->status.current_count != 0 ||
+        ind_core_group_count() != 0) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if ((file.fd = open(path, O_RDONLY)) < 0) {
+        if (errno != ENOENT) {
+            LOG_WARN("Failed to open snapshot %s: %s", path, strerror(errno));
+        }
+        return INDIGO_ERROR_NOT_FOUND;
+    }
+
+    if (fstat(file.fd, &st) < 0 ||
+        st.st_size < (off_t)sizeof(ind_core_snapshot_header_t)) {
+        LOG_WARN("Snapshot %s is truncated", path);
+        ind_core_snapshot_unmap(&file);
+        return INDIGO_ERROR_NOT_FOUND;
+    }
+
+    /* Private and writable, as loci may touch the message buffers */
+    addr = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                file.fd, 0);
+    if (addr == MAP_FAILED) {
+        LOG_WARN("Failed to map snapshot %s: %s", path, strerror(errno));
+        ind_core_snapshot_unmap(&file);
+        return INDIGO_ERROR_NOT_FOUND;
+    }
+    file.header = header = addr;
+    file.map_bytes = st.st_size;
+
+    if (header->magic != IND_CORE_SNAPSHOT_MAGIC ||
+        header->version != IND_CORE_SNAPSHOT_VERSION ||
+        header->header_bytes != sizeof(*header) ||
+        header->used > st.st_size - sizeof(*header)) {
+        LOG_WARN("Snapshot %s has a bad header", path);
+        ind_core_snapshot_unmap(&file);
+        return INDIGO_ERROR_NOT_FOUND;
+    }
+
+    rv = ind_core_snapshot_replay(header);
+    if (rv == INDIGO_ERROR_NONE) {
+        rv = ind_core_snapshot_verify(header);
+    }
+
+    ind_core_snapshot_unmap(&file);
+
+    if (rv < 0) {
+        LOG_WARN("Ignoring snapshot %s", path);
+        ind_core_snapshot_clear();
+        return INDIGO_ERROR_NOT_FOUND;
+    }
+
+    LOG_INFO("Restored %u flows and %d groups from snapshot %s",
+             ind_core_ft->status.current_count, ind_core_group_count(), path);
+
+    return INDIGO_ERROR_NONE;
+}
@@ -0,0 +1,88 @@
+/****************************************************************
+ *
+ *        Copyright 2014, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief State snapshot interfaces
+ *
+ * The flowtable, group table and meter table report each change here.
+ * When a snapshot is open the new state of the object is appended to the
+ * snapshot file; otherwise these calls do nothing.
+ */
+
+#ifndef _OFSTATEMANAGER_SNAPSHOT_H_
+#define _OFSTATEMANAGER_SNAPSHOT_H_
+
+#include <indigo/indigo.h>
+#include <loci/loci.h>
+
+#include "ft_entry.h"
+
+/**
+ * Record the current state of a flow
+ * @param entry The flowtable entry
+ * @param flow_add The flow_add the entry was created from, or NULL to
+ * rebuild one from the entry
+ */
+void ind_core_snapshot_flow_write(ft_entry_t *entry, of_flow_add_t *flow_add);
+
+/**
+ * Build a flow_add that would recreate a flow
+ * @param entry The flowtable entry
+ * @returns A new flow_add owned by the caller, or NULL on failure
+ */
+of_flow_add_t *ind_core_snapshot_flow_add_build(ft_entry_t *entry);
+
+/**
+ * Record that a flow was deleted
+ * @param id The flow ID
+ */
+void ind_core_snapshot_flow_erase(indigo_flow_id_t id);
+
+/**
+ * Record the current state of a group
+ * @param id Group ID
+ * @param type OpenFlow group type
+ * @param buckets The group's buckets
+ */
+void ind_core_snapshot_group_write(uint32_t id, uint8_t type,
+                                   of_list_bucket_t *buckets);
+
+/**
+ * Record that a group was deleted
+ * @param id Group ID
+ */
+void ind_core_snapshot_group_erase(uint32_t id);
+
+/**
+ * Record the current state of a meter
+ * @param id Meter ID
+ * @param flags OpenFlow meter flags
+ * @param bands The meter's bands
+ */
+void ind_core_snapshot_meter_write(uint32_t id, uint16_t flags,
+                                   of_list_meter_band_t *bands);
+
+/**
+ * Record that a meter was deleted
+ * @param id Meter ID
+ */
+void ind_core_snapshot_meter_erase(uint32_t id);
+
+#endif /* _OFSTATEMANAGER_SNAPSHOT_H_ */
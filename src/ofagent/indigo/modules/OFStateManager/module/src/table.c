@@ -20,18 +20,137 @@
 #include "table.h"
 #include <AIM/aim_memory.h>
 #include <AIM/aim_string.h>
+#include <string.h>
 #include "ft.h"
 #include "ofstatemanager_decs.h"
 #include "ofstatemanager_log.h"
 
 static ind_core_table_t *ind_core_tables[256];
 
+/* Flow adds waiting for entry_create_batch, oldest first */
+static indigo_flow_id_t create_queue[IND_CORE_TABLE_BATCH_MAX];
+static int create_queue_count;
+
 ind_core_table_t *
 ind_core_table_get(uint8_t table_id)
 {
     return ind_core_tables[table_id];
 }
 
+void
+ind_core_table_create_enqueue(ft_entry_t *entry)
+{
+    if (create_queue_count == IND_CORE_TABLE_BATCH_MAX) {
+        ind_core_table_pending_flush();
+    }
+    create_queue[create_queue_count++] = entry->id;
+}
+
+static int
+create_queue_find(ft_entry_t *entry)
+{
+    int i;
+
+    if (entry->pending_add == NULL) {
+        return -1;
+    }
+
+    for (i = 0; i < create_queue_count; i++) {
+        if (create_queue[i] == entry->id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int
+ind_core_table_create_queued(ft_entry_t *entry)
+{
+    return create_queue_find(entry) >= 0;
+}
+
+/*
+ * Take a queued add off the queue; the table never sees it. Returns 0
+ * if the entry was not queued.
+ */
+int
+ind_core_table_create_cancel(ft_entry_t *entry)
+{
+    int i = create_queue_find(entry);
+
+    if (i < 0) {
+        return 0;
+    }
+
+    memmove(&create_queue[i], &create_queue[i + 1],
+            (create_queue_count - i - 1) * sizeof(create_queue[0]));
+    create_queue_count--;
+    return 1;
+}
+
+/*
+ * Hand every queued add to its table, one batch per run of adds to the
+ * same table, and complete them as forwarding's pending adds are
+ */
+void
+ind_core_table_pending_flush(void)
+{
+    static indigo_core_table_batch_entry_t batch[IND_CORE_TABLE_BATCH_MAX];
+    ft_entry_t *entries[IND_CORE_TABLE_BATCH_MAX];
+    ind_core_table_t *table;
+    indigo_error_t rv;
+    int count = 0;
+    int i, j, n;
+
+    for (i = 0; i < create_queue_count; i++) {
+        entries[count] = ft_lookup(ind_core_ft, create_queue[i]);
+        if (entries[count] != NULL) {
+            count++;
+        }
+    }
+    create_queue_count = 0;
+
+    for (i = 0; i < count; i += n) {
+        n = ind_core_table_batch_len(&entries[i], count - i);
+        table = ind_core_table_get(entries[i]->table_id);
+        AIM_TRUE_OR_DIE(table != NULL);
+
+        for (j = 0; j < n; j++) {
+            batch[j].obj = entries[i + j]->pending_add;
+            batch[j].flow_id = entries[i + j]->id;
+            batch[j].entry_priv = NULL;
+            batch[j].status = INDIGO_ERROR_NONE;
+        }
+
+        rv = table->ops->entry_create_batch(table->priv, batch, n);
+
+        for (j = 0; j < n; j++) {
+            if (rv < 0) {
+                batch[j].status = rv;
+            }
+            if (batch[j].status == INDIGO_ERROR_NONE) {
+                entries[i + j]->priv = batch[j].entry_priv;
+            }
+            indigo_core_flow_create_done(batch[j].flow_id, batch[j].status);
+        }
+    }
+}
+
+int
+ind_core_table_batch_len(ft_entry_t **entries, int count)
+{
+    int n;
+
+    for (n = 1; n < count && n < IND_CORE_TABLE_BATCH_MAX; n++) {
+        if (entries[n]->table_id != entries[0]->table_id ||
+                (entries[n]->retired_epoch != 0) !=
+                (entries[0]->retired_epoch != 0)) {
+            break;
+        }
+    }
+    return n;
+}
+
 void indigo_core_table_register(uint8_t table_id, const char *name,
                                 const indigo_core_table_ops_t *ops, void *priv)
 {
@@ -61,6 +180,8 @@ void indigo_core_table_unregister(uint8_t table_id)
     ind_core_table_t *table = ind_core_tables[table_id];
     AIM_TRUE_OR_DIE(table != NULL);
 
+    ind_core_table_pending_flush();
+
     list_links_t *cur, *next;
     ft_entry_t *entry;
     FT_ITER(ind_core_ft, entry, cur, next) {
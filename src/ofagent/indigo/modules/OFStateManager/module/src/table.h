@@ -25,6 +25,7 @@
 #include <indigo/error.h>
 #include <indigo/fi.h>
 #include <indigo/of_state_manager.h>
+#include "ft_entry.h"
 
 typedef struct ind_core_table_s {
     char *name;
@@ -34,5 +35,22 @@ typedef struct ind_core_table_s {
 
 ind_core_table_t *ind_core_table_get(uint8_t table_id);
 
+/* Most entries handed to a table in one batch operation */
+#define IND_CORE_TABLE_BATCH_MAX 64
+
+/*
+ * Flow adds to tables with entry_create_batch are queued until the next
+ * flush. The callers of the batch helpers flush first, so the entries
+ * they hold are not queued.
+ */
+void ind_core_table_create_enqueue(ft_entry_t *entry);
+int ind_core_table_create_queued(ft_entry_t *entry);
+int ind_core_table_create_cancel(ft_entry_t *entry);
+void ind_core_table_pending_flush(void);
+
+/* Number of entries from the start that are in the same table and all
+ * live or all deleted, at most IND_CORE_TABLE_BATCH_MAX */
+int ind_core_table_batch_len(ft_entry_t **entries, int count);
+
 #endif
 
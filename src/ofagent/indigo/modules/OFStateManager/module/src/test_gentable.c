@@ -225,11 +225,39 @@ ind_core_test_gentable_get_stats(void *table_priv, void *entry_priv, of_list_bsn
     }
 }
 
+static indigo_error_t
+ind_core_test_gentable_add_batch(void *table_priv, indigo_core_gentable_batch_entry_t *entries, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++) {
+        entries[i].status = ind_core_test_gentable_add(
+            table_priv, entries[i].key, entries[i].value, &entries[i].entry_priv);
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t
+ind_core_test_gentable_del_batch(void *table_priv, indigo_core_gentable_batch_entry_t *entries, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++) {
+        entries[i].status = ind_core_test_gentable_delete(
+            table_priv, entries[i].entry_priv, entries[i].key);
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
 static indigo_core_gentable_ops_t ind_core_test_gentable_ops = {
     ind_core_test_gentable_add,
     ind_core_test_gentable_modify,
     ind_core_test_gentable_delete,
     ind_core_test_gentable_get_stats,
+    ind_core_test_gentable_add_batch,
+    ind_core_test_gentable_del_batch,
 };
 
 void
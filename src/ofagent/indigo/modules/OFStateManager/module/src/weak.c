@@ -53,6 +53,16 @@ indigo_port_extended_stats_get(
     /* All counters default to -1 */
 }
 
+#ifdef OFDPA_FIXUP
+WEAK void
+indigo_fwd_meter_stats_get(
+    uint32_t id,
+    of_meter_stats_t *entry)
+{
+    /* Counters default to -1 and flow_count to 0 */
+}
+#endif
+
 WEAK indigo_error_t
 indigo_fwd_flow_create(
     indigo_cookie_t flow_id,
@@ -62,6 +72,17 @@ indigo_fwd_flow_create(
     return INDIGO_ERROR_BAD_TABLE_ID;
 }
 
+WEAK void
+indigo_fwd_pending_flush(void)
+{
+}
+
+WEAK void
+indigo_fwd_pending_submit(void)
+{
+    indigo_fwd_pending_flush();
+}
+
 WEAK indigo_error_t
 indigo_fwd_flow_modify(
     indigo_cookie_t flow_id,
@@ -78,6 +99,12 @@ indigo_fwd_flow_delete(
     return INDIGO_ERROR_BAD_TABLE_ID;
 }
 
+WEAK indigo_error_t
+indigo_fwd_flow_delete_all(uint8_t table_id)
+{
+    return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
 WEAK indigo_error_t
 indigo_fwd_flow_stats_get(
     indigo_cookie_t flow_id,
@@ -86,6 +113,16 @@ indigo_fwd_flow_stats_get(
     return INDIGO_ERROR_BAD_TABLE_ID;
 }
 
+WEAK void
+indigo_fwd_flow_stats_bulk_begin(uint8_t table_id)
+{
+}
+
+WEAK void
+indigo_fwd_flow_stats_bulk_end(void)
+{
+}
+
 WEAK indigo_error_t
 indigo_fwd_flow_hit_status_get(
     indigo_cookie_t flow_id,
@@ -94,4 +131,37 @@ indigo_fwd_flow_hit_status_get(
     return INDIGO_ERROR_BAD_TABLE_ID;
 }
 
+WEAK indigo_error_t
+indigo_fwd_flow_hit_status_bulk_get(
+    int count,
+    const indigo_cookie_t *flow_ids,
+    bool *hit_status)
+{
+    indigo_error_t rv;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        rv = indigo_fwd_flow_hit_status_get(flow_ids[i], &hit_status[i]);
+        if (rv != INDIGO_ERROR_NONE) {
+            return rv;
+        }
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+WEAK indigo_error_t
+indigo_fwd_table_flow_count_get(
+    uint8_t table_id,
+    uint32_t *count)
+{
+    return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
+WEAK indigo_error_t
+indigo_fwd_group_count_get(uint32_t *count)
+{
+    return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
 #endif
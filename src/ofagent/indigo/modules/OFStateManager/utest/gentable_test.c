@@ -45,6 +45,8 @@
 extern void handle_message(of_object_t *obj);
 extern int do_barrier(void);
 
+static void send_add(uint32_t port, of_mac_addr_t mac, uint8_t csum_hi);
+static void send_delete(uint32_t port);
 static void do_add(uint32_t port, of_mac_addr_t mac, uint8_t csum_hi);
 static void do_delete(uint32_t port);
 static void do_clear(void);
@@ -67,12 +69,14 @@ struct test_table {
     int count_modify;
     int count_delete;
     int count_stats;
+    int count_batch;
     struct test_entry entries[NUM_ENTRIES];
 };
 
 static struct test_table table;
 
 static indigo_core_gentable_ops_t test_ops;
+static indigo_core_gentable_ops_t test_batch_ops;
 
 static const of_mac_addr_t mac1 = { { 0xab, 0xcd, 0xef, 0xff, 0xff, 0x01 } };
 static const of_mac_addr_t mac2 = { { 0xab, 0xcd, 0xef, 0xff, 0xff, 0x02 } };
@@ -302,6 +306,116 @@ test_gentable_long_running_task(void)
     return TEST_PASS;
 }
 
+static int
+test_gentable_resize(void)
+{
+    int i;
+    indigo_core_gentable_t *gentable;
+    of_table_name_t name = "gentable 0";
+
+    memset(&table, 0, sizeof(table));
+    indigo_core_gentable_register(name, &test_ops, &table, 10, 2, &gentable);
+    AIM_TRUE_OR_DIE(table.count_op == 0);
+
+    /* Key buckets grow while entries are still being added */
+    for (i = 0; i < NUM_ENTRIES; i++) {
+        do_add(i, mac1, i << 4);
+    }
+    AIM_TRUE_OR_DIE(table.count_add == NUM_ENTRIES);
+
+    /* Entries must still be found before their key bucket has moved */
+    memset(&table, 0, sizeof(table));
+    do_add(3, mac2, 3 << 4);
+    do_delete(5);
+    AIM_TRUE_OR_DIE(table.entries[3].count_modify == 1);
+    AIM_TRUE_OR_DIE(table.entries[5].count_delete == 1);
+    AIM_TRUE_OR_DIE(table.count_op == 2);
+
+    /* Expand buckets, iterate while they are migrated */
+    do_set_buckets_size(8);
+    memset(&table, 0, sizeof(table));
+    do_entry_stats();
+    for (i = 0; i < NUM_ENTRIES; i++) {
+        AIM_TRUE_OR_DIE(table.entries[i].count_stats == (i == 5 ? 0 : 1));
+    }
+    AIM_TRUE_OR_DIE(table.count_op == NUM_ENTRIES - 1);
+
+    /* Shrink buckets, clear while they are migrated */
+    do_set_buckets_size(2);
+    memset(&table, 0, sizeof(table));
+    do_clear();
+    AIM_TRUE_OR_DIE(table.count_delete == NUM_ENTRIES - 1);
+    AIM_TRUE_OR_DIE(table.count_op == NUM_ENTRIES - 1);
+
+    do_add(7, mac3, 7 << 4);
+
+    memset(&table, 0, sizeof(table));
+    indigo_core_gentable_unregister(gentable);
+    AIM_TRUE_OR_DIE(table.entries[7].count_delete == 1);
+    AIM_TRUE_OR_DIE(table.count_op == 1);
+
+    return TEST_PASS;
+}
+
+static int
+test_gentable_batch(void)
+{
+    indigo_core_gentable_t *gentable;
+    of_table_name_t name = "gentable 0";
+    int i;
+
+    memset(&table, 0, sizeof(table));
+    indigo_core_gentable_register(name, &test_batch_ops, &table, 10, 8, &gentable);
+    AIM_TRUE_OR_DIE(table.count_op == 0);
+
+    /* Adds are queued until the barrier, then handed over together */
+    for (i = 0; i < NUM_ENTRIES; i++) {
+        send_add(i, mac1, 0);
+    }
+    send_add(NUM_ENTRIES, mac1, 0);
+    AIM_TRUE_OR_DIE(table.count_op == 0);
+    do_barrier();
+    AIM_TRUE_OR_DIE(table.count_batch == 1);
+    AIM_TRUE_OR_DIE(table.count_add == NUM_ENTRIES);
+    AIM_TRUE_OR_DIE(table.entries[1].count_add == 1);
+
+    /* The rejected entry is gone */
+    memset(&table, 0, sizeof(table));
+    do_delete(NUM_ENTRIES);
+    AIM_TRUE_OR_DIE(table.count_batch == 0);
+    AIM_TRUE_OR_DIE(table.count_op == 0);
+
+    /* Modify is not batched */
+    do_add(1, mac3, 0);
+    AIM_TRUE_OR_DIE(table.count_batch == 0);
+    AIM_TRUE_OR_DIE(table.entries[1].count_modify == 1);
+
+    /* Re-adding a key queued for deletion settles the delete first */
+    memset(&table, 0, sizeof(table));
+    send_delete(2);
+    send_add(2, mac2, 0);
+    do_barrier();
+    AIM_TRUE_OR_DIE(table.count_batch == 2);
+    AIM_TRUE_OR_DIE(table.entries[2].count_delete == 1);
+    AIM_TRUE_OR_DIE(table.entries[2].count_add == 1);
+
+    /* Stats see the queued deletes applied */
+    memset(&table, 0, sizeof(table));
+    for (i = 0; i < NUM_ENTRIES; i++) {
+        send_delete(i);
+    }
+    do_entry_stats();
+    AIM_TRUE_OR_DIE(table.count_batch == 1);
+    AIM_TRUE_OR_DIE(table.count_delete == NUM_ENTRIES);
+    AIM_TRUE_OR_DIE(table.count_stats == 0);
+
+    memset(&table, 0, sizeof(table));
+    indigo_core_gentable_unregister(gentable);
+    AIM_TRUE_OR_DIE(table.count_op == 0);
+
+    return TEST_PASS;
+}
+
 int
 test_gentable(void)
 {
@@ -311,6 +425,8 @@ test_gentable(void)
     RUN_TEST(gentable_clear);
     RUN_TEST(gentable_entry_stats);
     RUN_TEST(gentable_long_running_task);
+    RUN_TEST(gentable_resize);
+    RUN_TEST(gentable_batch);
     return TEST_PASS;
 }
 
@@ -318,7 +434,7 @@ test_gentable(void)
 /* Utility functions to send OpenFlow messages */
 
 static void
-do_add(uint32_t port, of_mac_addr_t mac, uint8_t csum_hi)
+send_add(uint32_t port, of_mac_addr_t mac, uint8_t csum_hi)
 {
     of_object_t *obj = of_bsn_gentable_entry_add_new(OF_VERSION_1_3);
     of_bsn_gentable_entry_add_xid_set(obj, 0x12345678);
@@ -351,11 +467,17 @@ do_add(uint32_t port, of_mac_addr_t mac, uint8_t csum_hi)
     }
 
     handle_message(obj);
+}
+
+static void
+do_add(uint32_t port, of_mac_addr_t mac, uint8_t csum_hi)
+{
+    send_add(port, mac, csum_hi);
     do_barrier();
 }
 
 static void
-do_delete(uint32_t port)
+send_delete(uint32_t port)
 {
     of_object_t *obj = of_bsn_gentable_entry_delete_new(OF_VERSION_1_3);
     of_bsn_gentable_entry_delete_xid_set(obj, 0x12345678);
@@ -373,6 +495,12 @@ do_delete(uint32_t port)
     }
 
     handle_message(obj);
+}
+
+static void
+do_delete(uint32_t port)
+{
+    send_delete(port);
     do_barrier();
 }
 
@@ -577,3 +705,53 @@ static indigo_core_gentable_ops_t test_ops = {
     test_gentable_delete,
     test_gentable_get_stats,
 };
+
+/* Entries with out of range ports are rejected instead of asserting */
+static indigo_error_t
+test_gentable_add_batch(void *table_priv, indigo_core_gentable_batch_entry_t *entries, int count)
+{
+    struct test_table *table = table_priv;
+    int i;
+
+    table->count_batch++;
+
+    for (i = 0; i < count; i++) {
+        of_port_no_t port;
+        parse_key(entries[i].key, &port);
+
+        if (port >= NUM_ENTRIES) {
+            entries[i].status = INDIGO_ERROR_PARAM;
+            continue;
+        }
+
+        entries[i].status = test_gentable_add(table_priv, entries[i].key,
+                                              entries[i].value, &entries[i].entry_priv);
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t
+test_gentable_del_batch(void *table_priv, indigo_core_gentable_batch_entry_t *entries, int count)
+{
+    struct test_table *table = table_priv;
+    int i;
+
+    table->count_batch++;
+
+    for (i = 0; i < count; i++) {
+        entries[i].status = test_gentable_delete(table_priv, entries[i].entry_priv,
+                                                 entries[i].key);
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+static indigo_core_gentable_ops_t test_batch_ops = {
+    test_gentable_add,
+    test_gentable_modify,
+    test_gentable_delete,
+    test_gentable_get_stats,
+    test_gentable_add_batch,
+    test_gentable_del_batch,
+};
@@ -52,6 +52,9 @@ int test_gentable(void);
 /* Defined in table_test.c */
 int test_table(void);
 
+/* Defined in soak_test.c */
+int test_soak(void);
+
 /* Must be an even number */
 #define TEST_FLOW_COUNT 1000
 
@@ -123,6 +126,26 @@ indigo_fwd_table_stats_get(of_table_stats_request_t *request,
     return INDIGO_ERROR_NONE;
 }
 
+/* Flows forwarding holds in table 0 beyond the flowtable's */
+int fwd_flow_count_skew;
+
+indigo_error_t
+indigo_fwd_table_flow_count_get(uint8_t table_id, uint32_t *count)
+{
+    *count = list_length(&ind_core_ft->table_lists[table_id]);
+    if (table_id == 0) {
+        *count += fwd_flow_count_skew;
+    }
+    return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_fwd_group_count_get(uint32_t *count)
+{
+    *count = 0;
+    return INDIGO_ERROR_NONE;
+}
+
 indigo_error_t delete_error = INDIGO_ERROR_NONE;
 
 indigo_error_t
@@ -130,7 +153,9 @@ indigo_fwd_flow_delete(indigo_cookie_t flow_id,
                        indigo_fi_flow_stats_t *flow_stats)
 {
     AIM_LOG_VERBOSE("flow delete called\n");
-    memset(flow_stats, 0, sizeof(*flow_stats));
+    if (flow_stats != NULL) {
+        memset(flow_stats, 0, sizeof(*flow_stats));
+    }
     return INDIGO_ERROR_NONE;
 }
 
@@ -189,6 +214,12 @@ indigo_cxn_send_error_reply(indigo_cxn_id_t cxn_id, of_object_t *orig,
                       cxn_id);
 }
 
+void
+indigo_cxn_message_parse_error(indigo_cxn_id_t cxn_id, of_object_t *obj)
+{
+    AIM_LOG_VERBOSE("Parse error reported for cxn id %d\n", cxn_id);
+}
+
 static int controller_message_counters[OF_MESSAGE_OBJECT_COUNT];
 
 void
@@ -211,6 +242,33 @@ indigo_cxn_send_async_message(of_object_t *obj)
     of_object_delete(obj);
 }
 
+int
+indigo_cxn_output_blocked(indigo_cxn_id_t cxn_id)
+{
+    return 0;
+}
+
+indigo_error_t
+indigo_cxn_output_ready_register(indigo_cxn_id_t cxn_id,
+                                 indigo_cxn_output_ready_f callback,
+                                 void *cookie)
+{
+    return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
+int
+indigo_cxn_flow_removed_blocked(void)
+{
+    return 0;
+}
+
+indigo_error_t
+indigo_cxn_flow_removed_ready_register(indigo_cxn_output_ready_f callback,
+                                       void *cookie)
+{
+    return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
 indigo_error_t
 indigo_cxn_get_async_version(of_version_t *ver)
 {
@@ -230,6 +288,34 @@ ind_cxn_message_track_setup(indigo_cxn_id_t cxn_id, of_object_t *obj)
     return INDIGO_ERROR_NONE;
 }
 
+of_object_t *
+indigo_cxn_message_claim(indigo_cxn_id_t cxn_id, of_object_t *obj)
+{
+    of_object_t *claimed = of_object_dup(obj);
+    ind_cxn_message_track_setup(cxn_id, claimed);
+    return claimed;
+}
+
+int
+ind_cxn_pipelined(indigo_cxn_id_t cxn_id)
+{
+    return 0;
+}
+
+indigo_error_t
+indigo_cxn_status_change_register(indigo_cxn_status_change_f handler,
+                                  void *cookie)
+{
+    return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_cxn_status_change_unregister(indigo_cxn_status_change_f handler,
+                                    void *cookie)
+{
+    return INDIGO_ERROR_NONE;
+}
+
 indigo_error_t
 indigo_port_modify(of_port_mod_t *port_mod)
 {
@@ -322,8 +408,14 @@ indigo_fwd_group_add(uint32_t id, uint8_t group_type, of_list_bucket_t *buckets)
     return INDIGO_ERROR_NOT_SUPPORTED;
 }
 
+#ifdef OFDPA_FIXUP
+indigo_error_t
+indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *old_buckets,
+                        of_list_bucket_t *buckets)
+#else
 indigo_error_t
 indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *buckets)
+#endif
 {
     return INDIGO_ERROR_NOT_SUPPORTED;
 }
@@ -419,13 +511,15 @@ depopulate_table(ft_instance_t ft)
 {
     int idx;
     ft_entry_t *entry;
+    of_match_t match;
     int count;
 
     count = ft->status.current_count;
     for (idx = 0; idx < count; ++idx) {
         entry = ft_lookup(ft, TEST_KEY(idx));
         TEST_ASSERT(entry != NULL);
-        TEST_ASSERT(entry->match.fields.eth_type == TEST_ETH_TYPE(idx));
+        ft_match_unpack(entry->match, &match);
+        TEST_ASSERT(match.fields.eth_type == TEST_ETH_TYPE(idx));
         ft_delete(ft, entry);
         TEST_ASSERT(check_table_entry_states(ft) == 0);
     }
@@ -439,7 +533,6 @@ check_bucket_counts(ft_instance_t ft, int expected)
     int count = 0;
     ft_entry_t *_entry;
     list_links_t *cur, *next;
-    int idx;
 
     FT_ITER(ft, _entry, cur, next) {
         (void)_entry;
@@ -448,17 +541,8 @@ check_bucket_counts(ft_instance_t ft, int expected)
     TEST_ASSERT(count == expected);
 
     /* Check the buckets */
-    count = 0;
-    for (idx = 0; idx < ft->config.flow_id_bucket_count; idx++) {
-        count += list_length(&ft->flow_id_buckets[idx]);
-    }
-    TEST_ASSERT(count == expected);
-
-    count = 0;
-    for (idx = 0; idx < ft->config.strict_match_bucket_count; idx++) {
-        count += list_length(&ft->strict_match_buckets[idx]);
-    }
-    TEST_ASSERT(count == expected);
+    TEST_ASSERT(ft_index_length(&ft->flow_id_index) == expected);
+    TEST_ASSERT(ft->strict_match_index.count == expected);
 
     return 0;
 }
@@ -500,6 +584,7 @@ count_matching(ft_instance_t ft, of_meta_match_t *query)
     ft_entry_t *entry;
     list_links_t *cur, *next;
 
+    ft_meta_match_prepare(query);
     FT_ITER(ft, entry, cur, next) {
         if (ft_entry_meta_match(query, entry)) {
             count += 1;
@@ -509,12 +594,28 @@ count_matching(ft_instance_t ft, of_meta_match_t *query)
     return count;
 }
 
+static int
+iter_count(ft_instance_t ft, of_meta_match_t *query)
+{
+    int count = 0;
+    ft_iterator_t iter;
+
+    ft_iterator_init(&iter, ft, query);
+    while (ft_iterator_next(&iter) != NULL) {
+        count += 1;
+    }
+    ft_iterator_cleanup(&iter);
+
+    return count;
+}
+
 static int
 first_match(ft_instance_t ft, of_meta_match_t *query, ft_entry_t **result)
 {
     ft_entry_t *entry;
     list_links_t *cur, *next;
 
+    ft_meta_match_prepare(query);
     FT_ITER(ft, entry, cur, next) {
         if (ft_entry_meta_match(query, entry)) {
             *result = entry;
@@ -616,6 +717,9 @@ test_ft_hash(void)
     TEST_ASSERT(count_matching(ft, &query) == 1);
     TEST_INDIGO_OK(ft_strict_match(ft, &query, &lookup_entry));
     TEST_ASSERT(lookup_entry->id == TEST_ENT_ID);
+    lookup_entry = NULL;
+    TEST_INDIGO_OK(ft_strict_match_flow_add(ft, flow_add, &lookup_entry));
+    TEST_ASSERT(lookup_entry->id == TEST_ENT_ID);
 
     /* Test fail lookup for port, strict */
     query.out_port                      = 1;
@@ -699,30 +803,1048 @@ test_ft_hash(void)
     query.match.fields.eth_type         = 0x1;
     query.match.masks.eth_type          = 0x1;
 
-    TEST_ASSERT(count_matching(ft, &query) == TEST_FLOW_COUNT/2);
+    TEST_ASSERT(count_matching(ft, &query) == TEST_FLOW_COUNT/2);
+
+    TEST_ASSERT(check_bucket_counts(ft, TEST_FLOW_COUNT) == 0);
+    TEST_ASSERT(check_table_entry_states(ft) == 0);
+
+    /* Query table for each individual flow with exact match */
+    for (idx = 0; idx < TEST_FLOW_COUNT; idx++) {
+        query.out_port                      = OF_PORT_DEST_WILDCARD;
+        query.mode                          = OF_MATCH_STRICT;
+        query.match.fields.eth_type         = TEST_ETH_TYPE(idx);
+        query.match.masks.eth_type          = 0xffff;
+
+        TEST_ASSERT(count_matching(ft, &query) == 1);
+
+        TEST_INDIGO_OK(ft_strict_match(ft, &query, &entry));
+        TEST_ASSERT(entry->id == TEST_KEY(idx));
+    }
+
+    TEST_OK(depopulate_table(ft));
+    TEST_ASSERT(check_bucket_counts(ft, 0) == 0);
+    ft_destroy(ft);
+    ft = NULL;
+
+    /* @todo Check for memory consistency */
+
+    return TEST_PASS;
+}
+
+/* Start with tiny indices and check they grow as flows are added */
+static int
+test_ft_index_grow(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        4, /* strict_match buckets */
+        4, /* flow_id buckets */
+    };
+    of_match_t match;
+    ft_entry_t *entry;
+    int idx;
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+    TEST_ASSERT(ft->flow_id_index.bucket_count == 4);
+
+    TEST_ASSERT(populate_table(ft, TEST_FLOW_COUNT, &match) == 0);
+    TEST_ASSERT(check_bucket_counts(ft, TEST_FLOW_COUNT) == 0);
+
+    /* Growth keeps the load factor bounded */
+    TEST_ASSERT(ft->flow_id_index.bucket_count * FT_DEFAULT_MAX_LOAD_FACTOR >=
+                TEST_FLOW_COUNT);
+    TEST_ASSERT(ft->strict_match_index.size >= 2 * TEST_FLOW_COUNT);
+
+    /* Every entry is still reachable through both indices */
+    for (idx = 0; idx < TEST_FLOW_COUNT; idx++) {
+        of_meta_match_t query;
+        entry = ft_lookup(ft, TEST_KEY(idx));
+        TEST_ASSERT(entry != NULL);
+
+        INDIGO_MEM_SET(&query, 0, sizeof(query));
+        ft_match_unpack(entry->match, &query.match);
+        query.mode = OF_MATCH_STRICT;
+        query.check_priority = 1;
+        query.priority = entry->priority;
+        query.table_id = TABLE_ID_ANY;
+        query.out_port = OF_PORT_DEST_WILDCARD;
+        TEST_INDIGO_OK(ft_strict_match(ft, &query, &entry));
+        TEST_ASSERT(entry->id == TEST_KEY(idx));
+    }
+
+    TEST_ASSERT(depopulate_table(ft) == 0);
+    TEST_ASSERT(check_bucket_counts(ft, 0) == 0);
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+/* IDs from the allocator are found through the ID map, others through the index */
+static int
+test_ft_lookup(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        4, /* strict_match buckets */
+        4, /* flow_id buckets */
+    };
+    of_flow_add_t *flow_add;
+    of_match_t match;
+    ft_entry_t *tracked, *untracked;
+    indigo_flow_id_t big = (indigo_flow_id_t)FT_ID_MAP_MAX_CAPACITY + 7;
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+
+    flow_add = of_flow_add_new(OF_VERSION_1_0);
+    TEST_ASSERT(of_flow_add_OF_VERSION_1_0_populate(flow_add, 1) != 0);
+    of_flow_add_flags_set(flow_add, 0);
+    TEST_OK(of_flow_add_match_get(flow_add, &match));
+
+    match.fields.eth_type = TEST_ETH_TYPE(0);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    TEST_INDIGO_OK(ft_add(ft, TEST_KEY(0), flow_add, &tracked));
+    match.fields.eth_type = TEST_ETH_TYPE(1);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    TEST_INDIGO_OK(ft_add(ft, big, flow_add, &untracked));
+    of_flow_add_delete(flow_add);
+
+    TEST_ASSERT(ft_lookup(ft, TEST_KEY(0)) == tracked);
+    TEST_ASSERT(ft_lookup(ft, big) == untracked);
+    TEST_ASSERT(ft_lookup(ft, TEST_KEY(0) + 1) == NULL);
+    TEST_ASSERT(ft_lookup(ft, big + 1) == NULL);
+    TEST_ASSERT(ft_lookup(ft, 0) == NULL);
+
+    /* An ID beyond the map's current capacity */
+    TEST_ASSERT(ft_lookup(ft, FT_ID_MAP_MAX_CAPACITY - 1) == NULL);
+
+    ft_delete(ft, tracked);
+    ft_delete(ft, untracked);
+    TEST_ASSERT(ft_lookup(ft, TEST_KEY(0)) == NULL);
+    TEST_ASSERT(ft_lookup(ft, big) == NULL);
+
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+static int
+test_ft_match_wire(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        4, /* strict_match buckets */
+        4, /* flow_id buckets */
+    };
+    of_flow_add_t *flow_add;
+    of_match_t match;
+    of_octets_t expected, octets;
+    ft_entry_t *entry;
+    uint8_t *cached;
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_ASSERT(flow_add != NULL);
+    memset(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = TEST_ETH_TYPE(0);
+    OF_MATCH_MASK_ETH_TYPE_EXACT_SET(&match);
+    match.fields.in_port = 5;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    TEST_INDIGO_OK(ft_add(ft, TEST_KEY(0), flow_add, &entry));
+    of_flow_add_delete(flow_add);
+
+    /* Encoded on first use, then the same copy */
+    TEST_ASSERT(entry->match_wire == NULL);
+    TEST_ASSERT(ft_entry_match_wire(ft, entry, OF_VERSION_1_3, &octets) == 1);
+    TEST_OK(of_match_serialize(OF_VERSION_1_3, &match, &expected));
+    TEST_ASSERT(octets.bytes == expected.bytes);
+    TEST_ASSERT(memcmp(octets.data, expected.data, expected.bytes) == 0);
+    of_alloc_free(expected.data);
+    cached = octets.data;
+    TEST_ASSERT(ft_entry_match_wire(ft, entry, OF_VERSION_1_3, &octets) == 1);
+    TEST_ASSERT(octets.data == cached);
+
+    /* Only the first version is kept */
+    TEST_ASSERT(ft_entry_match_wire(ft, entry, OF_VERSION_1_2, &octets) == 0);
+
+    ft_delete(ft, entry);
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+static int
+overlap_query(ft_instance_t ft, uint8_t table_id, uint16_t priority,
+              uint16_t eth_type, uint16_t eth_type_mask)
+{
+    of_meta_match_t query;
+
+    INDIGO_MEM_SET(&query, 0, sizeof(query));
+    query.match.version = OF_VERSION_1_3;
+    query.match.fields.eth_type = eth_type;
+    query.match.masks.eth_type = eth_type_mask;
+    query.mode = OF_MATCH_OVERLAP;
+    query.check_priority = 1;
+    query.priority = priority;
+    query.table_id = table_id;
+    query.out_port = OF_PORT_DEST_WILDCARD;
+
+    return ft_overlap_found(ft, &query);
+}
+
+static int
+test_ft_overlap(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        1024, /* strict_match buckets */
+        1024, /* flow_id buckets */
+    };
+    of_flow_add_t *flow_add;
+    of_match_t match;
+    ft_entry_t *entry;
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+
+    INDIGO_MEM_SET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = 0x0800;
+    match.masks.eth_type = 0xffff;
+
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    of_flow_add_table_id_set(flow_add, 1);
+    of_flow_add_priority_set(flow_add, 100);
+    TEST_INDIGO_OK(ft_add(ft, TEST_ENT_ID, flow_add, &entry));
+    of_object_delete(flow_add);
+    TEST_ASSERT(entry->table_id == 1);
+
+    /* Same table and priority */
+    TEST_ASSERT(overlap_query(ft, 1, 100, 0x0800, 0xffff));
+    TEST_ASSERT(overlap_query(ft, 1, 100, 0, 0));
+    TEST_ASSERT(!overlap_query(ft, 1, 100, 0x0806, 0xffff));
+
+    /* Other tables and priorities are never compared */
+    TEST_ASSERT(!overlap_query(ft, 2, 100, 0x0800, 0xffff));
+    TEST_ASSERT(!overlap_query(ft, 1, 101, 0x0800, 0xffff));
+    TEST_ASSERT(overlap_query(ft, TABLE_ID_ANY, 100, 0x0800, 0xffff));
+
+    /* Moving the entry to another table updates the index */
+    ft_entry_table_id_set(ft, entry, 2);
+    TEST_ASSERT(!overlap_query(ft, 1, 100, 0x0800, 0xffff));
+    TEST_ASSERT(overlap_query(ft, 2, 100, 0x0800, 0xffff));
+
+    ft_delete(ft, entry);
+    TEST_ASSERT(!overlap_query(ft, TABLE_ID_ANY, 100, 0, 0));
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+static int
+test_ft_match(void)
+{
+    of_match_t match, query, out;
+    ft_match_t packed, packed_query;
+
+    /* Bridging style match: VLAN plus destination MAC */
+    INDIGO_MEM_SET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.vlan_vid = 0x1064;
+    match.masks.vlan_vid = 0x1fff;
+    INDIGO_MEM_SET(&match.fields.eth_dst, 0x22, sizeof(match.fields.eth_dst));
+    INDIGO_MEM_SET(&match.masks.eth_dst, 0xff, sizeof(match.masks.eth_dst));
+
+    ft_match_pack(&match, &packed);
+    TEST_ASSERT(packed.bytes == 2 * (sizeof(of_mac_addr_t) + sizeof(uint16_t)));
+    ft_match_unpack(&packed, &out);
+    TEST_ASSERT(of_match_eq(&match, &out));
+
+    /* Bits outside the mask do not change the packed form */
+    query = match;
+    query.fields.vlan_vid |= 0x2000;
+    ft_match_pack(&query, &packed_query);
+    TEST_ASSERT(ft_match_eq(&packed, &packed_query));
+
+    /* A query on VLAN alone is less specific and overlaps */
+    INDIGO_MEM_SET(&query, 0, sizeof(query));
+    query.version = OF_VERSION_1_3;
+    query.fields.vlan_vid = 0x1000;
+    query.masks.vlan_vid = 0x1000;
+    ft_match_pack(&query, &packed_query);
+    TEST_ASSERT(!ft_match_eq(&packed, &packed_query));
+    TEST_ASSERT(ft_match_more_specific(&packed, &packed_query));
+    TEST_ASSERT(!ft_match_more_specific(&packed_query, &packed));
+    TEST_ASSERT(ft_match_overlap(&packed, &packed_query));
+
+    /* A different VLAN is disjoint */
+    query.fields.vlan_vid = 0x1065;
+    query.masks.vlan_vid = 0x1fff;
+    ft_match_pack(&query, &packed_query);
+    TEST_ASSERT(!ft_match_more_specific(&packed, &packed_query));
+    TEST_ASSERT(!ft_match_overlap(&packed, &packed_query));
+
+    /* Disjoint fields always overlap */
+    INDIGO_MEM_SET(&query, 0, sizeof(query));
+    query.version = OF_VERSION_1_3;
+    query.fields.eth_type = 0x0800;
+    query.masks.eth_type = 0xffff;
+    ft_match_pack(&query, &packed_query);
+    TEST_ASSERT(ft_match_overlap(&packed, &packed_query));
+    TEST_ASSERT(!ft_match_more_specific(&packed, &packed_query));
+
+    /* Wide matches differing only in their last value byte */
+    INDIGO_MEM_SET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    INDIGO_MEM_SET(&match.fields.ipv6_src, 0x20, sizeof(match.fields.ipv6_src));
+    INDIGO_MEM_SET(&match.masks.ipv6_src, 0xff, sizeof(match.masks.ipv6_src));
+    INDIGO_MEM_SET(&match.fields.ipv6_dst, 0x30, sizeof(match.fields.ipv6_dst));
+    INDIGO_MEM_SET(&match.masks.ipv6_dst, 0xff, sizeof(match.masks.ipv6_dst));
+    query = match;
+    query.fields.ipv6_dst.addr[15] ^= 1;
+    ft_match_pack(&match, &packed);
+    ft_match_pack(&query, &packed_query);
+    TEST_ASSERT(!ft_match_more_specific(&packed, &packed_query));
+    TEST_ASSERT(!ft_match_overlap(&packed, &packed_query));
+    query.masks.ipv6_dst.addr[15] = 0xfe;
+    ft_match_pack(&query, &packed_query);
+    TEST_ASSERT(ft_match_more_specific(&packed, &packed_query));
+    TEST_ASSERT(ft_match_overlap(&packed, &packed_query));
+
+    return TEST_PASS;
+}
+
+static int
+add_table_flow(ft_instance_t ft, int id, uint8_t table_id,
+               uint16_t eth_type, ft_entry_t **entry_p)
+{
+    of_flow_add_t *flow_add;
+    of_match_t match;
+
+    INDIGO_MEM_SET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = eth_type;
+    match.masks.eth_type = 0xffff;
+
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    of_flow_add_table_id_set(flow_add, table_id);
+    TEST_INDIGO_OK(ft_add(ft, id, flow_add, entry_p));
+    of_object_delete(flow_add);
+
+    return 0;
+}
+
+/* Entry a flow_add for (table_id, eth_type) would replace, or NULL */
+static ft_entry_t *
+find_table_flow(ft_instance_t ft, uint8_t table_id, uint16_t eth_type)
+{
+    of_flow_add_t *flow_add;
+    of_match_t match;
+    ft_entry_t *entry = NULL;
+
+    INDIGO_MEM_SET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = eth_type;
+    match.masks.eth_type = 0xffff;
+
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    of_flow_add_table_id_set(flow_add, table_id);
+    if (ft_strict_match_flow_add(ft, flow_add, &entry) != INDIGO_ERROR_NONE) {
+        entry = NULL;
+    }
+    of_object_delete(flow_add);
+
+    return entry;
+}
+
+static int
+count_table_entries(ft_instance_t ft, uint8_t table_id, int delete)
+{
+    ft_iterator_t iter;
+    of_meta_match_t query;
+    ft_entry_t *entry;
+    int count = 0;
+
+    INDIGO_MEM_SET(&query, 0, sizeof(query));
+    query.match.version = OF_VERSION_1_3;
+    query.mode = OF_MATCH_NON_STRICT;
+    query.table_id = table_id;
+    query.out_port = OF_PORT_DEST_WILDCARD;
+
+    ft_iterator_init(&iter, ft, &query);
+    while ((entry = ft_iterator_next(&iter)) != NULL) {
+        if (entry->table_id != table_id) {
+            return -1;
+        }
+        count++;
+        if (delete) {
+            ft_delete(ft, entry);
+        }
+    }
+    ft_iterator_cleanup(&iter);
+
+    return count;
+}
+
+static int
+test_ft_table_lists(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        1024, /* strict_match buckets */
+        1024, /* flow_id buckets */
+    };
+    ft_entry_t *entry;
+    int idx;
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+
+    for (idx = 0; idx < 10; idx++) {
+        TEST_ASSERT(add_table_flow(ft, TEST_KEY(idx), 1, idx, &entry) == 0);
+    }
+    for (idx = 10; idx < 15; idx++) {
+        TEST_ASSERT(add_table_flow(ft, TEST_KEY(idx), 2, idx, &entry) == 0);
+    }
+
+    TEST_ASSERT(count_table_entries(ft, 1, 0) == 10);
+    TEST_ASSERT(count_table_entries(ft, 2, 0) == 5);
+    TEST_ASSERT(count_table_entries(ft, 3, 0) == 0);
+    TEST_ASSERT(ft->table_counts[1] == 10);
+    TEST_ASSERT(ft->table_counts[2] == 5);
+    TEST_ASSERT(ft->table_counts[3] == 0);
+
+    TEST_ASSERT(find_table_flow(ft, 1, 0) == ft_lookup(ft, TEST_KEY(0)));
+    TEST_ASSERT(find_table_flow(ft, 2, 0) == NULL);
+
+    /* Moving an entry changes which list it is on */
+    ft_entry_table_id_set(ft, ft_lookup(ft, TEST_KEY(0)), 2);
+    TEST_ASSERT(find_table_flow(ft, 1, 0) == NULL);
+    TEST_ASSERT(find_table_flow(ft, 2, 0) == ft_lookup(ft, TEST_KEY(0)));
+    TEST_ASSERT(count_table_entries(ft, 1, 0) == 9);
+    TEST_ASSERT(count_table_entries(ft, 2, 0) == 6);
+    TEST_ASSERT(ft->table_counts[1] == 9);
+    TEST_ASSERT(ft->table_counts[2] == 6);
+
+    /* Deleting during a per-table iteration */
+    TEST_ASSERT(count_table_entries(ft, 2, 1) == 6);
+    TEST_ASSERT(count_table_entries(ft, 2, 0) == 0);
+    TEST_ASSERT(ft->status.current_count == 9);
+    TEST_ASSERT(ft->table_counts[2] == 0);
+
+    TEST_ASSERT(count_table_entries(ft, 1, 1) == 9);
+    TEST_ASSERT(ft->status.current_count == 0);
+    TEST_ASSERT(ft->table_counts[1] == 0);
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+static int
+add_cookie_flow(ft_instance_t ft, int id, uint8_t table_id, uint64_t cookie)
+{
+    of_flow_add_t *flow_add;
+    of_match_t match;
+
+    INDIGO_MEM_SET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = id;
+    match.masks.eth_type = 0xffff;
+
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    of_flow_add_table_id_set(flow_add, table_id);
+    of_flow_add_cookie_set(flow_add, cookie);
+    TEST_INDIGO_OK(ft_add(ft, id, flow_add, NULL));
+    of_object_delete(flow_add);
+
+    return 0;
+}
+
+static int
+test_ft_checksums(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        1024, /* strict_match buckets */
+        1024, /* flow_id buckets */
+    };
+    ft_checksum_table_t *table;
+    uint64_t cookie_a = 0x0400000000000001ULL;   /* Bucket 1 of 64 */
+    uint64_t cookie_b = 0x0400000000000010ULL;   /* Bucket 1 of 64 */
+    uint64_t cookie_c = 0xfc00000000000100ULL;   /* Bucket 63 of 64 */
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+    table = &ft->checksum_tables[1];
+    TEST_ASSERT(table->buckets_size == FT_CHECKSUM_BUCKETS_DEFAULT);
+
+    TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(0), 1, cookie_a) == 0);
+    TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(1), 1, cookie_b) == 0);
+    TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(2), 1, cookie_c) == 0);
+    TEST_ASSERT(table->checksum == (cookie_a ^ cookie_b ^ cookie_c));
+    TEST_ASSERT(table->buckets[1] == (cookie_a ^ cookie_b));
+    TEST_ASSERT(table->buckets[63] == cookie_c);
+    TEST_ASSERT(table->buckets[0] == 0);
+
+    /* Moving an entry moves its checksum */
+    ft_entry_table_id_set(ft, ft_lookup(ft, TEST_KEY(2)), 2);
+    TEST_ASSERT(table->checksum == (cookie_a ^ cookie_b));
+    TEST_ASSERT(table->buckets[63] == 0);
+    TEST_ASSERT(ft->checksum_tables[2].checksum == cookie_c);
+
+    /* Rebucketing recomputes the buckets */
+    TEST_ASSERT(ft_checksum_buckets_size_set(ft, 1, 1) == INDIGO_ERROR_NONE);
+    TEST_ASSERT(table->buckets[0] == (cookie_a ^ cookie_b));
+    TEST_ASSERT(ft_checksum_buckets_size_set(ft, 1, 4096) == INDIGO_ERROR_NONE);
+    TEST_ASSERT(table->buckets[64] == (cookie_a ^ cookie_b));
+    TEST_ASSERT(ft_checksum_buckets_size_set(ft, 1, 3) == INDIGO_ERROR_PARAM);
+    TEST_ASSERT(ft_checksum_buckets_size_set(ft, 1, 0) == INDIGO_ERROR_PARAM);
+    TEST_ASSERT(ft_checksum_buckets_size_set(
+                    ft, 1, FT_CHECKSUM_BUCKETS_MAX * 2) == INDIGO_ERROR_PARAM);
+    TEST_ASSERT(table->buckets_size == 4096);
+
+    /* Deleting removes the checksum */
+    ft_delete(ft, ft_lookup(ft, TEST_KEY(0)));
+    TEST_ASSERT(table->checksum == cookie_b);
+    TEST_ASSERT(table->buckets[64] == cookie_b);
+    ft_delete(ft, ft_lookup(ft, TEST_KEY(1)));
+    TEST_ASSERT(table->checksum == 0);
+    TEST_ASSERT(table->buckets[64] == 0);
+
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+static int
+count_cookie_entries(ft_instance_t ft, uint64_t cookie, uint64_t cookie_mask)
+{
+    ft_iterator_t iter;
+    of_meta_match_t query;
+    ft_entry_t *entry;
+    int count = 0;
+
+    INDIGO_MEM_SET(&query, 0, sizeof(query));
+    query.match.version = OF_VERSION_1_3;
+    query.mode = OF_MATCH_NON_STRICT;
+    query.table_id = TABLE_ID_ANY;
+    query.out_port = OF_PORT_DEST_WILDCARD;
+    query.cookie = cookie;
+    query.cookie_mask = cookie_mask;
+
+    ft_iterator_init(&iter, ft, &query);
+    while ((entry = ft_iterator_next(&iter)) != NULL) {
+        if ((entry->cookie & cookie_mask) != (cookie & cookie_mask)) {
+            return -1;
+        }
+        count++;
+    }
+    ft_iterator_cleanup(&iter);
+
+    return count;
+}
+
+/* Flows share the top byte of the cookie and differ in the low bits */
+#define TEST_SERVICE_COOKIE(_svc) (0xab00000000000000ULL | (_svc))
+
+static int
+test_ft_cookie_index(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        4, /* strict_match buckets */
+        4, /* flow_id buckets */
+        0, /* max_load_factor */
+        4, /* cookie buckets */
+        4, /* cookie_prefix_len */
+    };
+    ft_iterator_t iter;
+    of_meta_match_t query;
+    int idx, buckets;
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+    TEST_ASSERT(ft->config.cookie_prefix_len == 4);
+
+    for (idx = 0; idx < TEST_FLOW_COUNT; idx++) {
+        uint64_t cookie = TEST_SERVICE_COOKIE(idx % 10);
+        TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(idx), 1, cookie) == 0);
+    }
+    TEST_ASSERT(ft_index_length(&ft->cookie_index) == TEST_FLOW_COUNT);
+    TEST_ASSERT(ft->cookie_index.bucket_count * FT_DEFAULT_MAX_LOAD_FACTOR >=
+                TEST_FLOW_COUNT);
+
+    /* Full mask uses the cookie index, other masks the prefix buckets */
+    TEST_ASSERT(count_cookie_entries(ft, TEST_SERVICE_COOKIE(3), ~0ULL) ==
+                TEST_FLOW_COUNT / 10);
+    TEST_ASSERT(count_cookie_entries(ft, TEST_SERVICE_COOKIE(10), ~0ULL) == 0);
+    TEST_ASSERT(count_cookie_entries(ft, TEST_SERVICE_COOKIE(0),
+                                     0xf000000000000000ULL) == TEST_FLOW_COUNT);
+    TEST_ASSERT(count_cookie_entries(ft, TEST_SERVICE_COOKIE(2),
+                                     0xff0000000000000eULL) ==
+                TEST_FLOW_COUNT / 5);
+
+    /* The index does not grow under an iterator, and catches up after */
+    INDIGO_MEM_SET(&query, 0, sizeof(query));
+    query.match.version = OF_VERSION_1_3;
+    query.mode = OF_MATCH_NON_STRICT;
+    query.table_id = TABLE_ID_ANY;
+    query.out_port = OF_PORT_DEST_WILDCARD;
+    query.cookie = TEST_SERVICE_COOKIE(3);
+    query.cookie_mask = ~0ULL;
+    ft_iterator_init(&iter, ft, &query);
+    TEST_ASSERT(ft->cookie_index.pins == 1);
+    buckets = ft->cookie_index.bucket_count;
+    for (idx = TEST_FLOW_COUNT; idx < TEST_FLOW_COUNT * 2; idx++) {
+        uint64_t cookie = TEST_SERVICE_COOKIE(idx % 10);
+        TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(idx), 1, cookie) == 0);
+    }
+    TEST_ASSERT(ft->cookie_index.bucket_count == buckets);
+    idx = 0;
+    while (ft_iterator_next(&iter) != NULL) {
+        idx++;
+    }
+    TEST_ASSERT(idx == TEST_FLOW_COUNT * 2 / 10);
+    TEST_ASSERT(ft->cookie_index.pins == 0);
+    ft_iterator_cleanup(&iter);
+    TEST_ASSERT(ft->cookie_index.pins == 0);
+
+    TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(TEST_FLOW_COUNT * 2), 1,
+                                TEST_SERVICE_COOKIE(0)) == 0);
+    TEST_ASSERT(ft->cookie_index.bucket_count > buckets);
+
+    for (idx = 0; idx <= TEST_FLOW_COUNT * 2; idx++) {
+        ft_delete(ft, ft_lookup(ft, TEST_KEY(idx)));
+    }
+    TEST_ASSERT(ft_index_length(&ft->cookie_index) == 0);
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+static int
+test_ft_counters(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        16, /* strict_match buckets */
+        16, /* flow_id buckets */
+    };
+    ft_table_counters_t counters;
+    uint64_t cookie_a = TEST_SERVICE_COOKIE(1);
+    uint64_t cookie_b = TEST_SERVICE_COOKIE(2);
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+
+    TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(0), 1, cookie_a) == 0);
+    TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(1), 1, cookie_b) == 0);
+    TEST_ASSERT(add_cookie_flow(ft, TEST_KEY(2), 2, cookie_a) == 0);
+
+    ft_entry_counters_set(ft, ft_lookup(ft, TEST_KEY(0)), 10, 100);
+    ft_entry_counters_set(ft, ft_lookup(ft, TEST_KEY(1)), 20, 200);
+    ft_entry_counters_set(ft, ft_lookup(ft, TEST_KEY(2)), 30, 300);
+    TEST_ASSERT(ft->table_counters[1].packets == 30);
+    TEST_ASSERT(ft->table_counters[1].bytes == 300);
+    TEST_ASSERT(ft->table_counters[2].packets == 30);
+
+    TEST_ASSERT(ft_cookie_counters_get(ft, cookie_a, TABLE_ID_ANY, &counters) == 2);
+    TEST_ASSERT(counters.packets == 40 && counters.bytes == 400);
+    TEST_ASSERT(ft_cookie_counters_get(ft, cookie_a, 2, &counters) == 1);
+    TEST_ASSERT(counters.packets == 30);
+
+    /* Updates apply the difference */
+    ft_entry_counters_set(ft, ft_lookup(ft, TEST_KEY(0)), 15, 150);
+    TEST_ASSERT(ft->table_counters[1].packets == 35);
+
+    /* Counters follow an entry to its new table and leave with it */
+    ft_entry_table_id_set(ft, ft_lookup(ft, TEST_KEY(2)), 1);
+    TEST_ASSERT(ft->table_counters[1].packets == 65);
+    TEST_ASSERT(ft->table_counters[2].packets == 0);
+    ft_delete(ft, ft_lookup(ft, TEST_KEY(1)));
+    TEST_ASSERT(ft->table_counters[1].packets == 45);
+    TEST_ASSERT(ft->table_counters[1].bytes == 450);
+
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+/*
+ * 1.3 flow add whose apply-actions forward to the given groups, after a
+ * meter instruction unless meter_id is 0
+ */
+static of_flow_add_t *
+make_meter_flow_add(int id, uint32_t meter_id, uint32_t *group_ids, int count)
+{
+    of_flow_add_t *flow_add;
+    of_list_instruction_t *instructions;
+    of_instruction_meter_t *meter;
+    of_instruction_apply_actions_t *apply;
+    of_list_action_t *actions;
+    of_action_group_t *group;
+    of_match_t match;
+    int idx;
+
+    INDIGO_MEM_SET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = id;
+    match.masks.eth_type = 0xffff;
+
+    actions = of_list_action_new(OF_VERSION_1_3);
+    for (idx = 0; idx < count; idx++) {
+        group = of_action_group_new(OF_VERSION_1_3);
+        of_action_group_group_id_set(group, group_ids[idx]);
+        AIM_TRUE_OR_DIE(of_list_append(actions, group) == 0);
+        of_object_delete(group);
+    }
+
+    apply = of_instruction_apply_actions_new(OF_VERSION_1_3);
+    AIM_TRUE_OR_DIE(of_instruction_apply_actions_actions_set(apply, actions) == 0);
+    instructions = of_list_instruction_new(OF_VERSION_1_3);
+    if (meter_id != 0) {
+        meter = of_instruction_meter_new(OF_VERSION_1_3);
+        of_instruction_meter_meter_id_set(meter, meter_id);
+        AIM_TRUE_OR_DIE(of_list_append(instructions, meter) == 0);
+        of_object_delete(meter);
+    }
+    AIM_TRUE_OR_DIE(of_list_append(instructions, apply) == 0);
+
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    AIM_TRUE_OR_DIE(of_flow_add_match_set(flow_add, &match) == 0);
+    AIM_TRUE_OR_DIE(of_flow_add_instructions_set(flow_add, instructions) == 0);
+
+    of_object_delete(instructions);
+    of_object_delete(apply);
+    of_object_delete(actions);
+
+    return flow_add;
+}
+
+static of_flow_add_t *
+make_group_flow_add(int id, uint32_t *group_ids, int count)
+{
+    return make_meter_flow_add(id, 0, group_ids, count);
+}
+
+static void
+group_ref_delete(void *cookie, ft_entry_t *entry)
+{
+    ft_delete(cookie, entry);
+}
+
+static int
+test_ft_group_refs(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        1024, /* strict_match buckets */
+        1024, /* flow_id buckets */
+    };
+    of_flow_add_t *flow_add;
+    ft_entry_t *entry;
+    uint32_t one[] = { 10 };
+    uint32_t two[] = { 10, 20 };
+    uint32_t many[] = { 30, 31, 10, 32 };
+    of_meta_match_t query;
+    int idx;
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+
+    for (idx = 0; idx < 5; idx++) {
+        flow_add = make_group_flow_add(idx, one, 1);
+        TEST_INDIGO_OK(ft_add(ft, TEST_KEY(idx), flow_add, &entry));
+        of_object_delete(flow_add);
+    }
+
+    flow_add = make_group_flow_add(5, two, 2);
+    TEST_INDIGO_OK(ft_add(ft, TEST_KEY(5), flow_add, &entry));
+    of_object_delete(flow_add);
+
+    /* Group 10 is past the indexed refs of this one */
+    flow_add = make_group_flow_add(6, many, 4);
+    TEST_INDIGO_OK(ft_add(ft, TEST_KEY(6), flow_add, &entry));
+    of_object_delete(flow_add);
+    TEST_ASSERT(entry->out_ref_overflow);
+
+    TEST_ASSERT(ft_group_ref_foreach(ft, 10, NULL, NULL) == 7);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 20, NULL, NULL) == 1);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 32, NULL, NULL) == 1);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 40, NULL, NULL) == 0);
+
+    /* Modifying the effects moves the entry to the new group */
+    flow_add = make_group_flow_add(0, &two[1], 1);
+    TEST_INDIGO_OK(ft_entry_modify_effects(ft, ft_lookup(ft, TEST_KEY(0)), flow_add));
+    of_object_delete(flow_add);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 10, NULL, NULL) == 6);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 20, NULL, NULL) == 2);
+
+    /* Filtered queries walk the referencing entries */
+    INDIGO_MEM_SET(&query, 0, sizeof(query));
+    query.match.version = OF_VERSION_1_3;
+    query.mode = OF_MATCH_NON_STRICT;
+    query.table_id = TABLE_ID_ANY;
+    query.out_port = OF_PORT_DEST_WILDCARD;
+    query.check_out_group = 1;
+    query.out_group = 20;
+    TEST_ASSERT(iter_count(ft, &query) == 2);
+    TEST_ASSERT(count_matching(ft, &query) == 2);
+    query.out_group = 32;
+    TEST_ASSERT(iter_count(ft, &query) == 1);
+
+    /* Ports and groups with the same number are kept apart */
+    query.check_out_group = 0;
+    query.out_port = 10;
+    TEST_ASSERT(iter_count(ft, &query) == 0);
+
+    /* The callback may delete the entry it is handed */
+    TEST_ASSERT(ft_group_ref_foreach(ft, 10, group_ref_delete, ft) == 6);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 10, NULL, NULL) == 0);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 32, NULL, NULL) == 0);
+    TEST_ASSERT(ft->status.current_count == 1);
+
+    /* Meter instructions are indexed apart from groups of the same number */
+    flow_add = make_meter_flow_add(7, 10, one, 1);
+    TEST_INDIGO_OK(ft_add(ft, TEST_KEY(7), flow_add, &entry));
+    of_object_delete(flow_add);
+    flow_add = make_meter_flow_add(8, 10, many, 4);
+    TEST_INDIGO_OK(ft_add(ft, TEST_KEY(8), flow_add, &entry));
+    of_object_delete(flow_add);
+    TEST_ASSERT(entry->out_ref_overflow);
+    TEST_ASSERT(ft_meter_ref_foreach(ft, 10, NULL, NULL) == 2);
+    TEST_ASSERT(ft_meter_ref_foreach(ft, 20, NULL, NULL) == 0);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 10, NULL, NULL) == 2);
+
+    TEST_ASSERT(ft_meter_ref_foreach(ft, 10, group_ref_delete, ft) == 2);
+    TEST_ASSERT(ft_meter_ref_foreach(ft, 10, NULL, NULL) == 0);
+    TEST_ASSERT(ft_group_ref_foreach(ft, 10, NULL, NULL) == 0);
+    TEST_ASSERT(ft->status.current_count == 1);
+
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
+
+static int
+effects_in_use(ft_instance_t ft)
+{
+    int idx, count = ft->effects_oversize;
+
+    for (idx = 0; idx < FT_EFFECTS_CLASS_COUNT; idx++) {
+        count += ft->effects_pools[idx].in_use;
+    }
+
+    return count;
+}
+
+static int
+test_ft_pools(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        1024, /* strict_match buckets */
+        1024, /* flow_id buckets */
+    };
+    of_match_t match;
+    of_flow_modify_t *flow_mod;
+    ft_entry_t *entry;
+    ft_entry_t *other;
+    ft_memory_t mem;
+
+    ft = ft_create(&config);
+    TEST_ASSERT(ft != NULL);
+
+    ft_memory_get(ft, &mem);
+    TEST_ASSERT(mem.entries == 0 && mem.effects == 0 && mem.matches == 0);
+    TEST_ASSERT(mem.indexes > 0);
+
+    TEST_ASSERT(populate_table(ft, TEST_FLOW_COUNT, &match) == 0);
+    TEST_ASSERT(ft->entry_pool.in_use == TEST_FLOW_COUNT);
+
+    /* The entries were added with the same actions, so share one buffer */
+    TEST_ASSERT(effects_in_use(ft) == 1);
+    other = ft_lookup(ft, TEST_KEY(1));
+    TEST_ASSERT(other != NULL);
+    TEST_ASSERT(other->effects_ref->refcount == TEST_FLOW_COUNT);
+
+    ft_memory_get(ft, &mem);
+    TEST_ASSERT(mem.entries_used == TEST_FLOW_COUNT *
+                (uint64_t)ft->entry_pool.object_size);
+    TEST_ASSERT(mem.entries >= mem.entries_used);
+    TEST_ASSERT(mem.effects >= mem.effects_used && mem.effects_used > 0);
+    TEST_ASSERT(mem.matches >= mem.matches_used && mem.matches_used > 0);
+
+    /* Replacing effects releases the old buffer */
+    entry = ft_lookup(ft, TEST_KEY(0));
+    TEST_ASSERT(entry != NULL);
+    flow_mod = of_flow_modify_new(OF_VERSION_1_0);
+    TEST_ASSERT(of_flow_modify_OF_VERSION_1_0_populate(flow_mod, 1) != 0);
+    TEST_INDIGO_OK(ft_entry_modify_effects(ft, entry, flow_mod));
+    TEST_ASSERT(ft_entry_effects_equal(entry, flow_mod));
+    of_object_delete(flow_mod);
+    TEST_ASSERT(entry->effects.actions->version == OF_VERSION_1_0);
+    flow_mod = of_flow_modify_new(OF_VERSION_1_0);
+    TEST_ASSERT(!ft_entry_effects_equal(entry, flow_mod));
+    of_object_delete(flow_mod);
+    if (entry->effects_ref == other->effects_ref) {
+        TEST_ASSERT(effects_in_use(ft) == 1);
+    } else {
+        TEST_ASSERT(effects_in_use(ft) == 2);
+        TEST_ASSERT(entry->effects_ref->refcount == 1);
+        TEST_ASSERT(other->effects_ref->refcount == TEST_FLOW_COUNT - 1);
+    }
+
+    TEST_ASSERT(depopulate_table(ft) == 0);
+    TEST_ASSERT(ft->entry_pool.in_use == 0);
+    TEST_ASSERT(effects_in_use(ft) == 0);
+    TEST_ASSERT(ft->entry_pool.slab_count > 0);
+
+    /* Slabs are kept, so only the in-use figures drop */
+    ft_memory_get(ft, &mem);
+    TEST_ASSERT(mem.entries_used == 0 && mem.effects_used == 0);
+    TEST_ASSERT(mem.entries > 0);
+    ft_destroy(ft);
+
+    return TEST_PASS;
+}
 
-    TEST_ASSERT(check_bucket_counts(ft, TEST_FLOW_COUNT) == 0);
-    TEST_ASSERT(check_table_entry_states(ft) == 0);
+static int
+test_ft_id_map(void)
+{
+    ft_id_map_t map;
+    uint64_t bytes;
+    uint32_t i;
+
+    ft_id_map_init(&map);
+    TEST_ASSERT(map.capacity == FT_ID_MAP_MIN_CAPACITY);
+    map.max_capacity = FT_ID_MAP_MIN_CAPACITY * 2;
+    bytes = ft_id_map_bytes(&map);
+
+    /* A freed ID is not handed out again before the cursor wraps */
+    TEST_ASSERT(ft_id_map_next(&map) == 1);
+    ft_id_map_set(&map, 1, &map);
+    TEST_ASSERT(ft_id_map_next(&map) == 2);
+    ft_id_map_set(&map, 2, &map);
+    ft_id_map_clear(&map, 1);
+    TEST_ASSERT(ft_id_map_get(&map, 1) == NULL);
+    TEST_ASSERT(map.count == 1);
+    TEST_ASSERT(ft_id_map_next(&map) == 3);
+    ft_id_map_set(&map, 3, &map);
+    ft_id_map_clear(&map, 2);
+    TEST_ASSERT(map.count == 1);
+
+    /* Fill the map; it doubles once half its IDs are used */
+    for (i = 4; i < map.max_capacity; i++) {
+        TEST_ASSERT(ft_id_map_next(&map) == i);
+        TEST_ASSERT(map.capacity ==
+                    (map.count + 1 < FT_ID_MAP_MIN_CAPACITY / 2 ?
+                     FT_ID_MAP_MIN_CAPACITY : FT_ID_MAP_MIN_CAPACITY * 2));
+        ft_id_map_set(&map, i, (void *)(uintptr_t)i);
+    }
+    TEST_ASSERT(ft_id_map_bytes(&map) == bytes * 2);
+    TEST_ASSERT(ft_id_map_get(&map, 1000) == (void *)(uintptr_t)1000);
+
+    /* The cursor wraps round to the IDs freed at the start */
+    TEST_ASSERT(ft_id_map_next(&map) == 1);
+    ft_id_map_set(&map, 1, &map);
+    TEST_ASSERT(ft_id_map_next(&map) == 2);
+    ft_id_map_set(&map, 2, &map);
+    TEST_ASSERT(map.count == map.capacity - 1);
+
+    /* Exhausted, and IDs beyond the limit are not taken on */
+    TEST_ASSERT(ft_id_map_next(&map) == 0);
+    ft_id_map_set(&map, map.max_capacity, &map);
+    TEST_ASSERT(map.capacity == map.max_capacity);
+    TEST_ASSERT(ft_id_map_next(&map) == 0);
+
+    /* Cleared IDs are reused next-fit from the cursor */
+    ft_id_map_clear(&map, 5000);
+    ft_id_map_clear(&map, 100);
+    TEST_ASSERT(ft_id_map_get(&map, 100) == NULL);
+    TEST_ASSERT(ft_id_map_next(&map) == 100);
+    ft_id_map_set(&map, 100, &map);
+    TEST_ASSERT(ft_id_map_next(&map) == 5000);
+    ft_id_map_set(&map, 5000, &map);
+    TEST_ASSERT(ft_id_map_next(&map) == 0);
+
+    ft_id_map_cleanup(&map);
 
-    /* Query table for each individual flow with exact match */
-    for (idx = 0; idx < TEST_FLOW_COUNT; idx++) {
-        query.out_port                      = OF_PORT_DEST_WILDCARD;
-        query.mode                          = OF_MATCH_STRICT;
-        query.match.fields.eth_type         = TEST_ETH_TYPE(idx);
-        query.match.masks.eth_type          = 0xffff;
+    return TEST_PASS;
+}
 
-        TEST_ASSERT(count_matching(ft, &query) == 1);
+static int
+test_ft_slot_index(void)
+{
+    ft_slot_index_t index;
+    ft_pool_t pool;
+    ft_entry_t *entries[600];
+    uint32_t pos, slot;
+    int idx, found;
+
+    /* Pool slots map back to their objects and survive reuse */
+    ft_pool_init(&pool, "test", sizeof(ft_entry_t), 256);
+    ft_pool_slots_enable(&pool, offsetof(ft_entry_t, slot));
+    for (idx = 0; idx < 600; idx++) {
+        entries[idx] = ft_pool_alloc(&pool);
+        TEST_ASSERT(entries[idx]->slot == idx + 1);
+        TEST_ASSERT(ft_pool_slot_object(&pool, idx + 1) == entries[idx]);
+    }
+    ft_pool_free(&pool, entries[300]);
+    TEST_ASSERT(ft_pool_alloc(&pool) == entries[300]);
+    TEST_ASSERT(entries[300]->slot == 301);
+
+    /* Equal hashes share a probe run; removal leaves the rest findable */
+    ft_slot_index_init(&index, 0);
+    TEST_ASSERT(index.size == FT_SLOT_INDEX_MIN_SIZE);
+    for (idx = 0; idx < 600; idx++) {
+        ft_slot_index_insert(&index, idx % 7, entries[idx]->slot);
+    }
+    TEST_ASSERT(index.count == 600);
+    TEST_ASSERT(index.size >= 2 * 600);
 
-        TEST_INDIGO_OK(ft_strict_match(ft, &query, &entry));
-        TEST_ASSERT(entry->id == TEST_KEY(idx));
+    for (idx = 0; idx < 600; idx += 2) {
+        ft_slot_index_remove(&index, idx % 7, entries[idx]->slot);
+    }
+    TEST_ASSERT(index.count == 300);
+
+    found = 0;
+    pos = ft_slot_index_start(&index, 3);
+    while ((slot = ft_slot_index_next(&index, 3, &pos)) != FT_SLOT_INDEX_EMPTY) {
+        ft_entry_t *entry = ft_pool_slot_object(&pool, slot);
+        TEST_ASSERT(entry->slot % 2 == 0 && (entry->slot - 1) % 7 == 3);
+        found++;
     }
+    TEST_ASSERT(found == 43);
 
-    TEST_OK(depopulate_table(ft));
-    TEST_ASSERT(check_bucket_counts(ft, 0) == 0);
-    ft_destroy(ft);
-    ft = NULL;
+    /* Churn reuses tombstones without growing */
+    for (idx = 0; idx < 10000; idx++) {
+        ft_slot_index_insert(&index, 99, entries[0]->slot);
+        ft_slot_index_remove(&index, 99, entries[0]->slot);
+    }
+    TEST_ASSERT(index.count == 300);
+    TEST_ASSERT(index.size <= 4 * 600);
+    TEST_ASSERT(ft_slot_index_probe_max(&index) < index.size);
 
-    /* @todo Check for memory consistency */
+    for (idx = 1; idx < 600; idx += 2) {
+        ft_slot_index_remove(&index, idx % 7, entries[idx]->slot);
+    }
+    TEST_ASSERT(index.count == 0);
+    ft_slot_index_cleanup(&index);
+
+    for (idx = 0; idx < 600; idx++) {
+        ft_pool_free(&pool, entries[idx]);
+    }
+    ft_pool_cleanup(&pool);
 
     return TEST_PASS;
 }
@@ -857,6 +1979,45 @@ test_ft_iterator(void)
         ft_iterator_cleanup(&iter);
     }
 
+    /* Entries deleted ahead of an iterator are skipped and held until it ends */
+    {
+        ft_iterator_t iter;
+        ft_iterator_init(&iter, ft, NULL);
+        TEST_ASSERT(ft_iterator_next(&iter) == entries[1]);
+        ft_delete(ft, entries[2]);
+        ft_delete(ft, entries[0]);
+        TEST_ASSERT(ft->retired_count == 2);
+        TEST_ASSERT(ft_iterator_next(&iter) == NULL);
+        TEST_ASSERT(ft->retired_count == 0);
+        ft_iterator_cleanup(&iter);
+        TEST_OK(add_flow(ft, 2, &entries[2]));
+        TEST_OK(add_flow(ft, 0, &entries[0]));
+        TEST_ASSERT(ft->retired_count == 0);
+    }
+
+    /* A snapshot returns what matched when it began, later deletes included */
+    {
+        ft_entry_t *added;
+        ft_iterator_t iter;
+        ft_iterator_init_snapshot(&iter, ft, NULL);
+        TEST_ASSERT(ft->snapshots == 1);
+        TEST_ASSERT(ft_iterator_next(&iter) == entries[1]);
+        ft_delete(ft, entries[0]);
+        TEST_OK(add_flow(ft, 3, &added));
+        TEST_ASSERT(ft_iterator_next(&iter) == entries[2]);
+        TEST_ASSERT(ft_iterator_next(&iter) == entries[0]);
+        TEST_ASSERT(entries[0]->retired_epoch != 0);
+        TEST_ASSERT(entries[0]->match != NULL);
+        TEST_ASSERT(entries[0]->effects.actions != NULL);
+        TEST_ASSERT(ft_iterator_next(&iter) == NULL);
+        TEST_ASSERT(ft->retired_count == 1);
+        ft_iterator_cleanup(&iter);
+        TEST_ASSERT(ft->snapshots == 0 && ft->snapshot_bytes == 0);
+        TEST_ASSERT(ft->retired_count == 0);
+        ft_delete(ft, added);
+        TEST_OK(add_flow(ft, 0, &entries[0]));
+    }
+
     /* Check query by cookie */
     /* Wildcards lowest cookie bit, so cookies 0 and 1 match while 2 does not */
     {
@@ -945,12 +2106,90 @@ test_ft_iter_task(void)
     TEST_ASSERT(state.finished == -1);
     TEST_ASSERT(state.entries_seen == 0);
     TEST_ASSERT(ft->status.current_count == 2);
+    TEST_ASSERT(ft->iter_tasks == 1);
     while (state.finished != 1) {
         ind_soc_select_and_run(0);
     }
     TEST_ASSERT(state.finished == 1);
     TEST_ASSERT(state.entries_seen == 2);
     TEST_ASSERT(ft->status.current_count == 0);
+    TEST_ASSERT(ft->iter_tasks == 0);
+
+    ft_destroy(ft);
+    of_object_delete(flow_add1);
+    of_object_delete(flow_add2);
+
+    return TEST_PASS;
+}
+
+struct iter_task_pause_state {
+    struct iter_task_state base;
+    int pause_after;
+    void *paused_task;
+};
+
+static bool
+iter_task_pause_cb(void *cookie, void *task)
+{
+    struct iter_task_pause_state *state = cookie;
+    if (state->base.entries_seen == state->pause_after &&
+            state->paused_task == NULL) {
+        state->paused_task = task;
+        return true;
+    }
+    return false;
+}
+
+static int
+test_ft_iter_task_pause(void)
+{
+    ft_instance_t ft;
+    ft_config_t config = {
+        1024, /* strict_match buckets */
+        1024, /* flow_id buckets */
+    };
+    of_flow_add_t *flow_add1, *flow_add2;
+    ft_entry_t *entry1, *entry2;
+    struct iter_task_pause_state state;
+    int i;
+
+    ft = ft_create(&config);
+
+    flow_add1 = of_flow_add_new(OF_VERSION_1_0);
+    of_flow_add_OF_VERSION_1_0_populate(flow_add1, 1);
+    of_flow_add_flags_set(flow_add1, 0);
+
+    flow_add2 = of_flow_add_new(OF_VERSION_1_0);
+    of_flow_add_OF_VERSION_1_0_populate(flow_add2, 2);
+    of_flow_add_flags_set(flow_add2, 0);
+
+    TEST_INDIGO_OK(ft_add(ft, 1, flow_add1, &entry1));
+    TEST_INDIGO_OK(ft_add(ft, 2, flow_add2, &entry2));
+
+    state = (struct iter_task_pause_state) {
+        .base = { .ft = ft, .finished = -1, .entries_seen = 0 },
+        .pause_after = 1,
+    };
+    TEST_INDIGO_OK(ft_spawn_iter_task_with_pause(
+        ft, NULL, iter_task_cb, iter_task_pause_cb,
+        &state, IND_SOC_DEFAULT_PRIORITY));
+
+    /* Runs until the pause callback stops it after the first entry */
+    while (state.paused_task == NULL) {
+        ind_soc_select_and_run(0);
+    }
+    for (i = 0; i < 10; i++) {
+        ind_soc_select_and_run(0);
+    }
+    TEST_ASSERT(state.base.entries_seen == 1);
+    TEST_ASSERT(state.base.finished == 0);
+
+    ft_iter_task_resume(state.paused_task);
+    while (state.base.finished != 1) {
+        ind_soc_select_and_run(0);
+    }
+    TEST_ASSERT(state.base.entries_seen == 2);
+    TEST_ASSERT(ft->status.current_count == 0);
 
     ft_destroy(ft);
     of_object_delete(flow_add1);
@@ -996,6 +2235,22 @@ test_packet_in(void)
     return TEST_PASS;
 }
 
+static int experimenter_handled;
+
+static indigo_error_t
+experimenter_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+    experimenter_handled++;
+    return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t
+experimenter_handler_unsupported(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+    experimenter_handled++;
+    return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
 static int
 test_experimenter(void)
 {
@@ -1006,6 +2261,40 @@ test_experimenter(void)
     indigo_core_receive_controller_message(0, exp);
     of_object_delete(exp);
 
+    /* Registered handlers are found by experimenter and subtype */
+    TEST_INDIGO_OK(indigo_core_experimenter_register(
+        INDIGO_CORE_EXPERIMENTER_MESSAGE, 0x1018, 1, "test", experimenter_handler));
+    TEST_ASSERT(indigo_core_experimenter_register(
+        INDIGO_CORE_EXPERIMENTER_MESSAGE, 0x1018, 1, "test",
+        experimenter_handler) == INDIGO_ERROR_EXISTS);
+    TEST_INDIGO_OK(indigo_core_experimenter_register(
+        INDIGO_CORE_EXPERIMENTER_MESSAGE, 0x1018, 2, "unsupported",
+        experimenter_handler_unsupported));
+
+    exp = of_experimenter_new(OF_VERSION_1_3);
+    of_experimenter_experimenter_set(exp, 0x1018);
+    of_experimenter_subtype_set(exp, 1);
+    indigo_core_receive_controller_message(0, exp);
+    TEST_ASSERT(experimenter_handled == 1);
+
+    /* Other subtypes and experimenters are not */
+    of_experimenter_subtype_set(exp, 3);
+    indigo_core_receive_controller_message(0, exp);
+    of_experimenter_experimenter_set(exp, 0x1019);
+    of_experimenter_subtype_set(exp, 1);
+    indigo_core_receive_controller_message(0, exp);
+    TEST_ASSERT(experimenter_handled == 1);
+
+    /* A handler can pass a message on */
+    of_experimenter_experimenter_set(exp, 0x1018);
+    of_experimenter_subtype_set(exp, 2);
+    indigo_core_receive_controller_message(0, exp);
+    TEST_ASSERT(experimenter_handled == 2);
+    of_object_delete(exp);
+
+    indigo_core_experimenter_unregister(INDIGO_CORE_EXPERIMENTER_MESSAGE, 0x1018, 1);
+    indigo_core_experimenter_unregister(INDIGO_CORE_EXPERIMENTER_MESSAGE, 0x1018, 2);
+
     return TEST_PASS;
 }
 
@@ -1240,6 +2529,231 @@ test_modify_strict(void)
 }
 
 
+/* Restore a flow under a forwarding ID, then add one from a controller */
+int
+test_flow_restore(void)
+{
+    indigo_flow_id_t restored_id = 0x100000;
+    of_flow_add_t *flow_add;
+    ft_status_t *status;
+    of_match_t match;
+
+    status = FT_STATUS(ind_core_ft);
+
+    INDIGO_MEM_CLEAR(&match, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = 0x0800;
+    match.masks.eth_type = 0xffff;
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_ASSERT(flow_add != NULL);
+    of_flow_add_table_id_set(flow_add, 10);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+
+    TEST_INDIGO_OK(indigo_core_flow_restore(restored_id, flow_add));
+    TEST_ASSERT(status->current_count == 1);
+    TEST_ASSERT(ft_lookup(ind_core_ft, restored_id) != NULL);
+    TEST_ASSERT(ft_lookup(ind_core_ft, restored_id)->table_id == 10);
+
+    /* Restoring the same ID again is refused */
+    TEST_ASSERT(indigo_core_flow_restore(restored_id, flow_add) ==
+                INDIGO_ERROR_EXISTS);
+    of_flow_add_delete(flow_add);
+
+    /* Controller flows are given IDs above the restored one */
+    flow_add = of_flow_add_new(OF_VERSION_1_0);
+    TEST_ASSERT(flow_add != NULL);
+    TEST_ASSERT(of_flow_add_OF_VERSION_1_0_populate(flow_add, 1) != 0);
+    of_flow_add_flags_set(flow_add, 0);
+    handle_message(flow_add);
+    TEST_INDIGO_OK(do_barrier());
+    TEST_ASSERT(status->current_count == 2);
+    TEST_ASSERT(ft_lookup(ind_core_ft, restored_id + 1) != NULL);
+
+    TEST_ASSERT(delete_all_entries(ind_core_ft) == TEST_PASS);
+    TEST_ASSERT(status->current_count == 0);
+
+    return TEST_PASS;
+}
+
+static int
+add_restored_flow(indigo_flow_id_t id, uint8_t table_id, uint16_t priority)
+{
+    of_flow_add_t *flow_add;
+    of_match_t match;
+
+    INDIGO_MEM_CLEAR(&match, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = 0x0800;
+    match.masks.eth_type = 0xffff;
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_ASSERT(flow_add != NULL);
+    of_flow_add_table_id_set(flow_add, table_id);
+    of_flow_add_priority_set(flow_add, priority);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+
+    TEST_INDIGO_OK(indigo_core_flow_restore(id, flow_add));
+    of_flow_add_delete(flow_add);
+
+    return TEST_PASS;
+}
+
+/* Journal flow changes, then rebuild the flowtable from the journal */
+int
+test_snapshot(void)
+{
+    const char *path = "/tmp/ofstatemanager_utest.snap";
+    ft_status_t *status;
+    ft_entry_t *entry;
+
+    status = FT_STATUS(ind_core_ft);
+    unlink(path);
+
+    TEST_ASSERT(ind_core_snapshot_restore(path) == INDIGO_ERROR_NOT_FOUND);
+
+    TEST_ASSERT(add_restored_flow(0x200000, 10, 1) == TEST_PASS);
+    TEST_INDIGO_OK(ind_core_snapshot_start(path));
+    TEST_ASSERT(add_restored_flow(0x200001, 10, 2) == TEST_PASS);
+    TEST_ASSERT(add_restored_flow(0x200002, 20, 3) == TEST_PASS);
+
+    /* Delete one flow and move another */
+    ft_delete(ind_core_ft, ft_lookup(ind_core_ft, 0x200001));
+    ft_entry_table_id_set(ind_core_ft, ft_lookup(ind_core_ft, 0x200002), 30);
+
+    /* Stopping keeps the file; empty the flowtable behind its back */
+    ind_core_snapshot_stop();
+    TEST_ASSERT(delete_all_entries(ind_core_ft) == TEST_PASS);
+
+    TEST_INDIGO_OK(ind_core_snapshot_restore(path));
+    TEST_ASSERT(status->current_count == 2);
+    TEST_ASSERT(ft_lookup(ind_core_ft, 0x200001) == NULL);
+    TEST_ASSERT((entry = ft_lookup(ind_core_ft, 0x200000)) != NULL);
+    TEST_ASSERT(entry->table_id == 10);
+    TEST_ASSERT(entry->priority == 1);
+    TEST_ASSERT((entry = ft_lookup(ind_core_ft, 0x200002)) != NULL);
+    TEST_ASSERT(entry->table_id == 30);
+
+    /* Restoring needs an empty flowtable */
+    TEST_ASSERT(ind_core_snapshot_restore(path) == INDIGO_ERROR_PARAM);
+    TEST_ASSERT(delete_all_entries(ind_core_ft) == TEST_PASS);
+
+    /* A snapshot that disagrees with forwarding is not used */
+    fwd_flow_count_skew = 1;
+    TEST_ASSERT(ind_core_snapshot_restore(path) == INDIGO_ERROR_NOT_FOUND);
+    TEST_ASSERT(status->current_count == 0);
+    fwd_flow_count_skew = 0;
+
+    unlink(path);
+
+    return TEST_PASS;
+}
+
+static of_flow_delete_t *
+make_table_delete(uint8_t table_id)
+{
+    of_flow_delete_t *flow_del;
+
+    flow_del = of_flow_delete_new(OF_VERSION_1_3);
+    AIM_TRUE_OR_DIE(flow_del != NULL);
+    of_flow_delete_table_id_set(flow_del, table_id);
+    of_flow_delete_out_port_set(flow_del, OF_PORT_DEST_WILDCARD);
+
+    return flow_del;
+}
+
+/* Requests wait for the tables they need while state is restored */
+int
+test_loading(void)
+{
+    of_flow_add_t *flow_add;
+    ft_status_t *status;
+    of_match_t match;
+
+    status = FT_STATUS(ind_core_ft);
+
+    TEST_ASSERT(add_restored_flow(0x300000, 10, 1) == TEST_PASS);
+    indigo_core_loading_start();
+
+    /* Table 20 is still loading; the delete is held and counted */
+    handle_message(make_table_delete(20));
+    TEST_ASSERT(outstanding_op_cnt == 1);
+
+    /* Adds wait for every table, so the restored IDs are all known */
+    INDIGO_MEM_CLEAR(&match, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_ASSERT(flow_add != NULL);
+    of_flow_add_table_id_set(flow_add, 20);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+    handle_message(flow_add);
+    TEST_ASSERT(outstanding_op_cnt == 2);
+    TEST_ASSERT(status->current_count == 1);
+
+    /* Behind the held messages of this connection, though table 10 is loaded */
+    indigo_core_table_loaded(10);
+    handle_message(make_table_delete(10));
+    TEST_ASSERT(outstanding_op_cnt == 3);
+    TEST_ASSERT(status->current_count == 1);
+
+    indigo_core_table_loaded(20);
+    TEST_ASSERT(outstanding_op_cnt == 3);
+
+    /* In order: the delete in table 20, the add, the delete in table 10 */
+    indigo_core_loading_done();
+    TEST_INDIGO_OK(do_barrier());
+    TEST_ASSERT(status->current_count == 1);
+    TEST_ASSERT(ft_lookup(ind_core_ft, 0x300000) == NULL);
+
+    /* Nothing held once loading is done */
+    handle_message(make_table_delete(20));
+    TEST_INDIGO_OK(do_barrier());
+    TEST_ASSERT(status->current_count == 0);
+
+    return TEST_PASS;
+}
+
+/* Switch-owned flows get IDs apart from the controller's */
+int
+test_preload(void)
+{
+    indigo_flow_id_t id = INDIGO_CORE_PRELOAD_FLOW_ID_BASE + 1;
+    of_flow_add_t *flow_add;
+    ft_status_t *status;
+    ft_entry_t *entry;
+    of_match_t match;
+
+    status = FT_STATUS(ind_core_ft);
+
+    /* A warm start adopted the first preloaded flow */
+    TEST_ASSERT(add_restored_flow(INDIGO_CORE_PRELOAD_FLOW_ID_BASE, 10, 1) == TEST_PASS);
+
+    INDIGO_MEM_CLEAR(&match, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    match.fields.eth_type = 0x0806;
+    match.masks.eth_type = 0xffff;
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    TEST_ASSERT(flow_add != NULL);
+    of_flow_add_table_id_set(flow_add, 10);
+    of_flow_add_cookie_set(flow_add, 0x7072656c6f616400ULL);
+    TEST_OK(of_flow_add_match_set(flow_add, &match));
+
+    TEST_INDIGO_OK(indigo_core_flow_preload(flow_add));
+    TEST_ASSERT(status->current_count == 2);
+    TEST_ASSERT((entry = ft_lookup(ind_core_ft, id)) != NULL);
+    TEST_ASSERT(INDIGO_CORE_FLOW_ID_PRELOADED(entry->id));
+    TEST_ASSERT(entry->table_id == 10);
+    TEST_ASSERT(entry->cookie == 0x7072656c6f616400ULL);
+
+    /* Installing it again, e.g. after a reload, is skipped */
+    TEST_ASSERT(indigo_core_flow_preload(flow_add) == INDIGO_ERROR_EXISTS);
+    TEST_ASSERT(status->current_count == 2);
+    of_flow_add_delete(flow_add);
+
+    TEST_ASSERT(delete_all_entries(ind_core_ft) == TEST_PASS);
+    TEST_ASSERT(status->current_count == 0);
+
+    return TEST_PASS;
+}
+
 int
 test_flow_stats(void)
 {
@@ -1253,10 +2767,23 @@ struct listener_state {
 
 struct listener_state listener_states[3];
 
+/* Listeners called, in order */
+int listener_calls[16];
+int listener_call_count;
+
+static void
+listener_called(int idx)
+{
+    if (listener_call_count < AIM_ARRAYSIZE(listener_calls)) {
+        listener_calls[listener_call_count++] = idx;
+    }
+}
+
 indigo_core_listener_result_t
 listener0(void *arg)
 {
     listener_states[0].count++;
+    listener_called(0);
     return listener_states[0].result;
 }
 
@@ -1264,6 +2791,7 @@ indigo_core_listener_result_t
 listener1(void *arg)
 {
     listener_states[1].count++;
+    listener_called(1);
     return listener_states[1].result;
 }
 
@@ -1271,6 +2799,7 @@ indigo_core_listener_result_t
 listener2(void *arg)
 {
     listener_states[2].count++;
+    listener_called(2);
     return listener_states[2].result;
 }
 
@@ -1424,6 +2953,92 @@ test_message_listeners(void)
     return TEST_PASS;
 }
 
+static of_packet_in_t *
+listener_packet_in(uint16_t eth_type, uint8_t table_id)
+{
+    of_packet_in_t *packet_in = of_packet_in_new(OF_VERSION_1_3);
+    uint8_t frame[64];
+    of_octets_t data = { .data = frame, .bytes = sizeof(frame) };
+
+    memset(frame, 0, sizeof(frame));
+    frame[12] = 0x81;    /* VLAN tag, skipped by the filter */
+    frame[16] = eth_type >> 8;
+    frame[17] = eth_type & 0xff;
+    of_packet_in_data_set(packet_in, &data);
+    of_packet_in_table_id_set(packet_in, table_id);
+
+    return packet_in;
+}
+
+int
+test_listener_filters(void)
+{
+    indigo_core_packet_in_filter_t lldp = {
+        .fields = INDIGO_CORE_PACKET_IN_FILTER_ETH_TYPE,
+        .eth_type = 0x88cc,
+    };
+    indigo_core_packet_in_filter_t table = {
+        .fields = INDIGO_CORE_PACKET_IN_FILTER_TABLE_ID,
+        .table_id = 60,
+    };
+    of_object_id_t echo = OF_ECHO_REQUEST;
+
+    memset(listener_states, 0, sizeof(listener_states));
+
+    /* Registered lowest priority first; called highest first */
+    TEST_INDIGO_OK(indigo_core_packet_in_listener_register_with_filter(
+        (indigo_core_packet_in_listener_f)listener0, &lldp, -1));
+    TEST_INDIGO_OK(indigo_core_packet_in_listener_register_with_filter(
+        (indigo_core_packet_in_listener_f)listener1, &table, 5));
+    TEST_INDIGO_OK(indigo_core_packet_in_listener_register(
+        (indigo_core_packet_in_listener_f)listener2));
+    TEST_ASSERT(indigo_core_packet_in_listener_register(
+        (indigo_core_packet_in_listener_f)listener2) == INDIGO_ERROR_EXISTS);
+
+    listener_call_count = 0;
+    TEST_INDIGO_OK(indigo_core_packet_in(listener_packet_in(0x88cc, 60)));
+    TEST_ASSERT(listener_call_count == 3);
+    TEST_ASSERT(listener_calls[0] == 1);
+    TEST_ASSERT(listener_calls[1] == 2);
+    TEST_ASSERT(listener_calls[2] == 0);
+
+    /* Filtered listeners are skipped */
+    listener_call_count = 0;
+    TEST_INDIGO_OK(indigo_core_packet_in(listener_packet_in(0x0800, 10)));
+    TEST_ASSERT(listener_call_count == 1);
+    TEST_ASSERT(listener_calls[0] == 2);
+
+    indigo_core_packet_in_listener_unregister(
+        (indigo_core_packet_in_listener_f)listener0);
+    indigo_core_packet_in_listener_unregister(
+        (indigo_core_packet_in_listener_f)listener1);
+    indigo_core_packet_in_listener_unregister(
+        (indigo_core_packet_in_listener_f)listener2);
+
+    /* Message listeners filtered by type */
+    TEST_INDIGO_OK(indigo_core_message_listener_register_with_filter(
+        (indigo_core_message_listener_f)listener0, &echo, 1,
+        INDIGO_CORE_LISTENER_PRIORITY_DEFAULT));
+    TEST_INDIGO_OK(indigo_core_message_listener_register(
+        (indigo_core_message_listener_f)listener1));
+
+    listener_call_count = 0;
+    handle_message(of_features_request_new(OF_VERSION_1_0));
+    TEST_ASSERT(listener_call_count == 1);
+    TEST_ASSERT(listener_calls[0] == 1);
+
+    listener_call_count = 0;
+    handle_message(of_echo_request_new(OF_VERSION_1_0));
+    TEST_ASSERT(listener_call_count == 2);
+
+    indigo_core_message_listener_unregister(
+        (indigo_core_message_listener_f)listener0);
+    indigo_core_message_listener_unregister(
+        (indigo_core_message_listener_f)listener1);
+
+    return TEST_PASS;
+}
+
 int
 aim_main(int argc, char* argv[])
 {
@@ -1434,8 +3049,22 @@ aim_main(int argc, char* argv[])
     ind_soc_enable_set(1);
 
     RUN_TEST(ft_hash);
+    RUN_TEST(ft_index_grow);
+    RUN_TEST(ft_lookup);
+    RUN_TEST(ft_match_wire);
+    RUN_TEST(ft_overlap);
+    RUN_TEST(ft_match);
+    RUN_TEST(ft_table_lists);
+    RUN_TEST(ft_checksums);
+    RUN_TEST(ft_cookie_index);
+    RUN_TEST(ft_counters);
+    RUN_TEST(ft_group_refs);
+    RUN_TEST(ft_pools);
+    RUN_TEST(ft_id_map);
+    RUN_TEST(ft_slot_index);
     RUN_TEST(ft_iterator);
     RUN_TEST(ft_iter_task);
+    RUN_TEST(ft_iter_task_pause);
 
     /* Init Core */
     MEMSET(&core, 0, sizeof(core));
@@ -1455,10 +3084,15 @@ aim_main(int argc, char* argv[])
     RUN_TEST(exact_add_del);
     RUN_TEST(modify);
     RUN_TEST(modify_strict);
+    RUN_TEST(flow_restore);
+    RUN_TEST(snapshot);
+    RUN_TEST(loading);
+    RUN_TEST(preload);
 
     RUN_TEST(packet_in_listeners);
     RUN_TEST(port_status_listeners);
     RUN_TEST(message_listeners);
+    RUN_TEST(listener_filters);
 
     if (test_gentable() != TEST_PASS) {
         return 1;
@@ -1468,6 +3102,11 @@ aim_main(int argc, char* argv[])
         return 1;
     }
 
+    /* Long running; see soak_test.c */
+    if (getenv("OFSTATEMANAGER_SOAK_MINUTES") != NULL) {
+        RUN_TEST(soak);
+    }
+
     /* Kill logging for OFStateManager as next tests gen errors */
     aim_log_pvs_set(aim_log_find("ofstatemanager"), NULL);
 
@@ -0,0 +1,417 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/*
+ * Churn soak test
+ *
+ * Keeps a fixed population of flows churning through the core with the
+ * forwarding stubs of main.c: strict modifies, strict deletes each
+ * followed by an add of a new flow in the freed slot, and adds of flows
+ * with a 1 second hard timeout left for the core to expire. Every sample
+ * period it records RSS, heap in use, flow table memory, the longest
+ * strict match and flow id bucket chains and the latency of the
+ * operations since the last sample, and fails when one of them drifts
+ * past its threshold from the first sample.
+ *
+ * Long running, so only run when OFSTATEMANAGER_SOAK_MINUTES is set.
+ * OFSTATEMANAGER_SOAK_SAMPLE_SECS sets the sample period (default 60)
+ * and OFSTATEMANAGER_SOAK_FLOWS the population (default 512).
+ */
+
+#define AIM_LOG_MODULE_NAME ofstatemanager_utest
+#include <AIM/aim_log.h>
+
+#include <OFStateManager/ofstatemanager.h>
+#include <OFStateManager/ofstatemanager_config.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <loci/loci.h>
+#include <locitest/unittest.h>
+#include <locitest/test_common.h>
+#include <SocketManager/socketmanager.h>
+#include <ft.h>
+
+#include "ofstatemanager_decs.h"
+
+extern void handle_message(of_object_t *obj);
+extern int do_barrier(void);
+
+#define SOAK_FLOWS_DEFAULT 512
+#define SOAK_FLOWS_MAX 896          /* Under the utest's 1024 entry table */
+#define SOAK_EXPIRE_EVERY 8         /* Ops per add of an expiring flow */
+#define SOAK_PRIORITY 100
+
+/* Latency histogram in microseconds; longer ops land in the last bucket */
+#define SOAK_LATENCY_BUCKETS 10000
+
+/* Drift allowed from the first sample */
+#define SOAK_MEMORY_DRIFT_PERCENT 10
+#define SOAK_MEMORY_DRIFT_SLACK_KB 4096
+#define SOAK_CHAIN_DRIFT_FACTOR 2
+#define SOAK_CHAIN_DRIFT_SLACK 4
+#define SOAK_P50_DRIFT_FACTOR 2
+#define SOAK_P50_DRIFT_SLACK_US 10
+#define SOAK_P99_DRIFT_FACTOR 4
+#define SOAK_P99_DRIFT_SLACK_US 100
+
+struct soak_sample {
+    uint64_t rss_kb;
+    uint64_t heap_kb;
+    uint64_t ft_kb;
+    int strict_chain_max;
+    int flow_id_chain_max;
+    uint32_t p50_us;
+    uint32_t p99_us;
+};
+
+struct soak_slot {
+    uint32_t gen;
+    uint32_t port;
+};
+
+static uint32_t soak_latency[SOAK_LATENCY_BUCKETS];
+static uint64_t soak_latency_count;
+static uint32_t soak_rand_state = 0x12345678;
+
+static uint32_t
+soak_rand(void)
+{
+    /* xorshift32 */
+    soak_rand_state ^= soak_rand_state << 13;
+    soak_rand_state ^= soak_rand_state >> 17;
+    soak_rand_state ^= soak_rand_state << 5;
+    return soak_rand_state;
+}
+
+static uint64_t
+soak_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int
+soak_env_int(const char *name, int def)
+{
+    const char *value = getenv(name);
+    return value != NULL && atoi(value) > 0 ? atoi(value) : def;
+}
+
+/* Flow slot s of generation gen, or expiring flow s if gen is 0 */
+static void
+soak_match(uint32_t s, uint32_t gen, of_match_t *match)
+{
+    INDIGO_MEM_CLEAR(match, sizeof(*match));
+    match->version = OF_VERSION_1_3;
+    match->fields.eth_type = 0x0800;
+    match->masks.eth_type = 0xffff;
+    match->fields.ipv4_dst = (gen ? 0x0a000000 : 0x0b000000) | s;
+    match->masks.ipv4_dst = 0xffffffff;
+    match->fields.ipv4_src = gen;
+    match->masks.ipv4_src = 0xffffffff;
+}
+
+static of_list_instruction_t *
+soak_instructions(uint32_t port)
+{
+    of_list_instruction_t *insts;
+    of_instruction_apply_actions_t *inst;
+    of_list_action_t *actions;
+    of_action_output_t *output;
+
+    insts = of_list_instruction_new(OF_VERSION_1_3);
+    inst = of_instruction_apply_actions_new(OF_VERSION_1_3);
+    actions = of_list_action_new(OF_VERSION_1_3);
+    output = of_action_output_new(OF_VERSION_1_3);
+    AIM_TRUE_OR_DIE(insts && inst && actions && output);
+
+    of_action_output_port_set(output, port);
+    AIM_TRUE_OR_DIE(of_list_append(actions, output) == 0);
+    AIM_TRUE_OR_DIE(of_instruction_apply_actions_actions_set(inst, actions) == 0);
+    AIM_TRUE_OR_DIE(of_list_append(insts, inst) == 0);
+
+    of_object_delete(output);
+    of_object_delete(actions);
+    of_object_delete(inst);
+    return insts;
+}
+
+static void
+soak_latency_add(uint64_t us)
+{
+    soak_latency[us < SOAK_LATENCY_BUCKETS ? us : SOAK_LATENCY_BUCKETS - 1]++;
+    soak_latency_count++;
+}
+
+static uint32_t
+soak_latency_percentile(int percent)
+{
+    uint64_t want = (soak_latency_count * percent + 99) / 100;
+    uint64_t seen = 0;
+    uint32_t us;
+
+    for (us = 0; us < SOAK_LATENCY_BUCKETS - 1; us++) {
+        seen += soak_latency[us];
+        if (seen >= want) {
+            break;
+        }
+    }
+    return us;
+}
+
+/* Send a flow-mod and wait for the core to finish it */
+static void
+soak_op(of_object_t *obj)
+{
+    uint64_t start = soak_now_us();
+
+    handle_message(obj);
+    do_barrier();
+    soak_latency_add(soak_now_us() - start);
+}
+
+static void
+soak_add(uint32_t s, uint32_t gen, uint32_t port, uint16_t hard_timeout)
+{
+    of_flow_add_t *flow_add;
+    of_list_instruction_t *insts;
+    of_match_t match;
+
+    flow_add = of_flow_add_new(OF_VERSION_1_3);
+    AIM_TRUE_OR_DIE(flow_add != NULL);
+    soak_match(s, gen, &match);
+    AIM_TRUE_OR_DIE(of_flow_add_match_set(flow_add, &match) == OF_ERROR_NONE);
+    insts = soak_instructions(port);
+    AIM_TRUE_OR_DIE(of_flow_add_instructions_set(flow_add, insts) == OF_ERROR_NONE);
+    of_object_delete(insts);
+    of_flow_add_priority_set(flow_add, SOAK_PRIORITY);
+    of_flow_add_hard_timeout_set(flow_add, hard_timeout);
+    of_flow_add_out_port_set(flow_add, OF_PORT_DEST_WILDCARD);
+    of_flow_add_out_group_set(flow_add, OF_GROUP_ANY);
+    soak_op(flow_add);
+}
+
+static void
+soak_modify(uint32_t s, uint32_t gen, uint32_t port)
+{
+    of_flow_modify_strict_t *flow_mod;
+    of_list_instruction_t *insts;
+    of_match_t match;
+
+    flow_mod = of_flow_modify_strict_new(OF_VERSION_1_3);
+    AIM_TRUE_OR_DIE(flow_mod != NULL);
+    soak_match(s, gen, &match);
+    AIM_TRUE_OR_DIE(of_flow_modify_strict_match_set(flow_mod, &match) == OF_ERROR_NONE);
+    insts = soak_instructions(port);
+    AIM_TRUE_OR_DIE(of_flow_modify_strict_instructions_set(flow_mod, insts) == OF_ERROR_NONE);
+    of_object_delete(insts);
+    of_flow_modify_strict_priority_set(flow_mod, SOAK_PRIORITY);
+    of_flow_modify_strict_out_port_set(flow_mod, OF_PORT_DEST_WILDCARD);
+    of_flow_modify_strict_out_group_set(flow_mod, OF_GROUP_ANY);
+    soak_op(flow_mod);
+}
+
+static void
+soak_delete(uint32_t s, uint32_t gen)
+{
+    of_flow_delete_strict_t *flow_del;
+    of_match_t match;
+
+    flow_del = of_flow_delete_strict_new(OF_VERSION_1_3);
+    AIM_TRUE_OR_DIE(flow_del != NULL);
+    soak_match(s, gen, &match);
+    AIM_TRUE_OR_DIE(of_flow_delete_strict_match_set(flow_del, &match) == OF_ERROR_NONE);
+    of_flow_delete_strict_priority_set(flow_del, SOAK_PRIORITY);
+    of_flow_delete_strict_out_port_set(flow_del, OF_PORT_DEST_WILDCARD);
+    of_flow_delete_strict_out_group_set(flow_del, OF_GROUP_ANY);
+    soak_op(flow_del);
+}
+
+static uint64_t
+soak_rss_kb(void)
+{
+    unsigned long size, resident = 0;
+    FILE *f = fopen("/proc/self/statm", "r");
+
+    if (f != NULL) {
+        if (fscanf(f, "%lu %lu", &size, &resident) != 2) {
+            resident = 0;
+        }
+        fclose(f);
+    }
+    return (uint64_t)resident * sysconf(_SC_PAGESIZE) / 1024;
+}
+
+static void
+soak_sample_take(struct soak_sample *sample)
+{
+    ft_memory_t memory;
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 mi = mallinfo2();
+#else
+    struct mallinfo mi = mallinfo();
+#endif
+
+    ft_memory_get(ind_core_ft, &memory);
+
+    sample->rss_kb = soak_rss_kb();
+    sample->heap_kb = ((uint64_t)mi.uordblks + mi.hblkhd) / 1024;
+    sample->ft_kb = (memory.entries + memory.effects + memory.matches +
+                     memory.indexes + memory.iterators) / 1024;
+    sample->strict_chain_max = ft_slot_index_probe_max(&ind_core_ft->strict_match_index);
+    sample->flow_id_chain_max = ft_index_chain_max(&ind_core_ft->flow_id_index);
+    sample->p50_us = soak_latency_percentile(50);
+    sample->p99_us = soak_latency_percentile(99);
+
+    INDIGO_MEM_CLEAR(soak_latency, sizeof(soak_latency));
+    soak_latency_count = 0;
+}
+
+static int
+soak_memory_drifted(const char *name, uint64_t base, uint64_t now)
+{
+    uint64_t allowed = base * SOAK_MEMORY_DRIFT_PERCENT / 100;
+
+    if (allowed < SOAK_MEMORY_DRIFT_SLACK_KB) {
+        allowed = SOAK_MEMORY_DRIFT_SLACK_KB;
+    }
+    if (now > base + allowed) {
+        AIM_LOG_ERROR("soak: %s grew from %"PRIu64" kB to %"PRIu64" kB",
+                      name, base, now);
+        return 1;
+    }
+    return 0;
+}
+
+static int
+soak_drifted(const struct soak_sample *base, const struct soak_sample *now)
+{
+    int drifted = 0;
+
+    drifted |= soak_memory_drifted("RSS", base->rss_kb, now->rss_kb);
+    drifted |= soak_memory_drifted("heap", base->heap_kb, now->heap_kb);
+    drifted |= soak_memory_drifted("flow table memory", base->ft_kb, now->ft_kb);
+
+    if (now->strict_chain_max > base->strict_chain_max * SOAK_CHAIN_DRIFT_FACTOR + SOAK_CHAIN_DRIFT_SLACK ||
+        now->flow_id_chain_max > base->flow_id_chain_max * SOAK_CHAIN_DRIFT_FACTOR + SOAK_CHAIN_DRIFT_SLACK) {
+        AIM_LOG_ERROR("soak: longest chains grew from %d/%d to %d/%d",
+                      base->strict_chain_max, base->flow_id_chain_max,
+                      now->strict_chain_max, now->flow_id_chain_max);
+        drifted = 1;
+    }
+
+    if (now->p50_us > base->p50_us * SOAK_P50_DRIFT_FACTOR + SOAK_P50_DRIFT_SLACK_US ||
+        now->p99_us > base->p99_us * SOAK_P99_DRIFT_FACTOR + SOAK_P99_DRIFT_SLACK_US) {
+        AIM_LOG_ERROR("soak: latency p50/p99 grew from %u/%u us to %u/%u us",
+                      base->p50_us, base->p99_us, now->p50_us, now->p99_us);
+        drifted = 1;
+    }
+
+    return drifted;
+}
+
+int
+test_soak(void)
+{
+    struct soak_slot *slots;
+    struct soak_sample base, sample;
+    uint64_t start, end, next_sample, ops = 0, now;
+    uint32_t s, expire_next = 0;
+    int minutes, sample_secs, flows, expire_flows, samples = 0;
+    ft_status_t *status = FT_STATUS(ind_core_ft);
+
+    minutes = soak_env_int("OFSTATEMANAGER_SOAK_MINUTES", 0);
+    sample_secs = soak_env_int("OFSTATEMANAGER_SOAK_SAMPLE_SECS", 60);
+    flows = soak_env_int("OFSTATEMANAGER_SOAK_FLOWS", SOAK_FLOWS_DEFAULT);
+    TEST_ASSERT(minutes > 0);
+    TEST_ASSERT(flows <= SOAK_FLOWS_MAX);
+    expire_flows = flows / SOAK_EXPIRE_EVERY;
+
+    slots = aim_zmalloc(flows * sizeof(*slots));
+
+    for (s = 0; s < flows; s++) {
+        slots[s].gen = 1;
+        slots[s].port = 1;
+        soak_add(s, slots[s].gen, slots[s].port, 0);
+    }
+    TEST_ASSERT(status->current_count == flows);
+
+    start = soak_now_us();
+    end = start + (uint64_t)minutes * 60 * 1000000;
+    next_sample = start + (uint64_t)sample_secs * 1000000;
+
+    while ((now = soak_now_us()) < end) {
+        s = soak_rand() % flows;
+        if (soak_rand() & 1) {
+            slots[s].port = 1 + slots[s].port % 48;
+            soak_modify(s, slots[s].gen, slots[s].port);
+        } else {
+            soak_delete(s, slots[s].gen);
+            slots[s].gen++;
+            soak_add(s, slots[s].gen, slots[s].port, 0);
+        }
+
+        if (++ops % SOAK_EXPIRE_EVERY == 0) {
+            soak_add(expire_next++ % expire_flows, 0, 1, 1);
+            /* Let the expiration timer run */
+            ind_soc_select_and_run(0);
+        }
+
+        if (now >= next_sample) {
+            soak_sample_take(&sample);
+            AIM_LOG_MSG("soak: %d min, %"PRIu64" ops, %d flows, "
+                        "RSS %"PRIu64" kB, heap %"PRIu64" kB, ft %"PRIu64" kB, "
+                        "chains %d/%d, p50 %u us, p99 %u us",
+                        (int)((now - start) / 60000000), ops, status->current_count,
+                        sample.rss_kb, sample.heap_kb, sample.ft_kb,
+                        sample.strict_chain_max, sample.flow_id_chain_max,
+                        sample.p50_us, sample.p99_us);
+            if (samples++ == 0) {
+                base = sample;
+            } else if (soak_drifted(&base, &sample)) {
+                aim_free(slots);
+                return TEST_FAIL;
+            }
+            next_sample += (uint64_t)sample_secs * 1000000;
+        }
+    }
+
+    AIM_LOG_MSG("soak: %"PRIu64" hard expirations", status->hard_expires);
+    TEST_ASSERT(status->hard_expires > 0);
+
+    for (s = 0; s < flows; s++) {
+        soak_delete(s, slots[s].gen);
+    }
+    aim_free(slots);
+
+    /* Wait out the expiring flows */
+    end = soak_now_us() + 5000000;
+    while (status->current_count > 0 && soak_now_us() < end) {
+        ind_soc_select_and_run(100);
+    }
+    TEST_ASSERT(status->current_count == 0);
+
+    return TEST_PASS;
+}
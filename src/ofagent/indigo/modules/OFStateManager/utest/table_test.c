@@ -41,6 +41,7 @@
 extern void handle_message(of_object_t *obj);
 extern int do_barrier(void);
 
+static of_object_t *make_add(uint32_t port, uint32_t meter);
 static void do_add(uint32_t port, uint32_t meter);
 static void do_modify(uint32_t port, uint32_t meter) __attribute__((unused));
 static void do_delete(uint32_t port) __attribute__((unused));
@@ -80,8 +81,10 @@ struct test_table_stats {
 
 static struct test_table table;
 static struct test_table_stats stats;
+static int count_create_batch;
 
 static indigo_core_table_ops_t test_ops;
+static indigo_core_table_ops_t test_batch_ops;
 
 static int
 test_table_entry_add(void)
@@ -211,6 +214,48 @@ test_table_entry_stats(void)
     return TEST_PASS;
 }
 
+static int
+test_table_entry_create_batch(void)
+{
+    memset(&table, 0, sizeof(table));
+    memset(&stats, 0, sizeof(stats));
+    count_create_batch = 0;
+    table.magic = TABLE_MAGIC;
+    indigo_core_table_register(TABLE_ID, "test", &test_batch_ops, &table);
+
+    /* Queued until something must observe them */
+    handle_message(make_add(1, 1000));
+    handle_message(make_add(2, 2000));
+    handle_message(make_add(3, 3000));
+    AIM_TRUE_OR_DIE(stats.count_add == 0);
+
+    handle_message(of_barrier_request_new(OF_VERSION_1_3));
+    AIM_TRUE_OR_DIE(count_create_batch == 1);
+    AIM_TRUE_OR_DIE(stats.count_add == 3);
+    AIM_TRUE_OR_DIE(table.entries[2].meter == 2000);
+
+    /* Operations on the entries reach them through the batch's privs */
+    memset(&stats, 0, sizeof(stats));
+    do_modify(2, 4000);
+    AIM_TRUE_OR_DIE(table.entries[2].meter == 4000);
+    AIM_TRUE_OR_DIE(stats.entries[2].count_modify == 1);
+
+    /* A delete after a queued add sees it */
+    memset(&stats, 0, sizeof(stats));
+    handle_message(make_add(4, 5000));
+    do_delete(4);
+    AIM_TRUE_OR_DIE(count_create_batch == 2);
+    AIM_TRUE_OR_DIE(stats.entries[4].count_add == 1);
+    AIM_TRUE_OR_DIE(stats.entries[4].count_delete == 1);
+
+    memset(&stats, 0, sizeof(stats));
+    indigo_core_table_unregister(TABLE_ID);
+    AIM_TRUE_OR_DIE(stats.count_delete == 3);
+    AIM_TRUE_OR_DIE(stats.count_op == 3);
+
+    return TEST_PASS;
+}
+
 int
 test_table(void)
 {
@@ -218,13 +263,14 @@ test_table(void)
     RUN_TEST(table_entry_delete);
     RUN_TEST(table_entry_modify);
     RUN_TEST(table_entry_stats);
+    RUN_TEST(table_entry_create_batch);
     return TEST_PASS;
 }
 
 /* Utility functions to send OpenFlow messages */
 
-static void
-do_add(uint32_t port, uint32_t meter)
+static of_object_t *
+make_add(uint32_t port, uint32_t meter)
 {
     of_object_t *obj = of_flow_add_new(OF_VERSION_1_3);
     of_flow_add_xid_set(obj, 0x12345678);
@@ -250,7 +296,13 @@ do_add(uint32_t port, uint32_t meter)
         of_object_delete(list);
     }
 
-    handle_message(obj);
+    return obj;
+}
+
+static void
+do_add(uint32_t port, uint32_t meter)
+{
+    handle_message(make_add(port, meter));
     do_barrier();
 }
 
@@ -454,3 +506,28 @@ static indigo_core_table_ops_t test_ops = {
     op_entry_stats_get,
     op_entry_hit_status_get,
 };
+
+static indigo_error_t
+op_entry_create_batch(void *table_priv, indigo_core_table_batch_entry_t *entries, int count)
+{
+    int i;
+
+    count_create_batch++;
+
+    for (i = 0; i < count; i++) {
+        entries[i].status = op_entry_create(table_priv, entries[i].obj,
+                                            entries[i].flow_id,
+                                            &entries[i].entry_priv);
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+static indigo_core_table_ops_t test_batch_ops = {
+    .entry_create = op_entry_create,
+    .entry_modify = op_entry_modify,
+    .entry_delete = op_entry_delete,
+    .entry_stats_get = op_entry_stats_get,
+    .entry_hit_status_get = op_entry_hit_status_get,
+    .entry_create_batch = op_entry_create_batch,
+};
@@ -284,6 +284,100 @@ indigo_error_t ind_soc_task_register(
     ind_soc_task_callback_f callback,
     void *cookie, int priority);
 
+/****************************************************************
+ * Coroutine functions
+ ****************************************************************/
+
+/**
+ * A coroutine is a task with its own stack. It runs a function from
+ * start to end and may suspend itself at any depth in that function,
+ * keeping its locals, instead of returning to the event loop with its
+ * progress saved by hand in a state struct.
+ *
+ * A coroutine suspends in one of two ways. ind_soc_coroutine_yield
+ * returns to the event loop and resumes the next time tasks at its
+ * priority run. ind_soc_coroutine_wait suspends it until someone calls
+ * ind_soc_coroutine_wake, for example a connection's output ready
+ * callback or a forwarding completion.
+ *
+ * The yield, wait and self functions may only be called from inside a
+ * coroutine.
+ */
+
+typedef struct ind_soc_coroutine_s ind_soc_coroutine_t;
+
+/**
+ * Body of a coroutine
+ *
+ * @param cookie Data passed to ind_soc_coroutine_spawn
+ *
+ * The coroutine ends when this function returns.
+ */
+
+typedef void (*ind_soc_coroutine_f)(void *cookie);
+
+/**
+ * Start a coroutine
+ *
+ * @param func Coroutine body
+ * @param cookie Opaque data passed to func
+ * @param priority Priority level of the task that runs it
+ *
+ * The coroutine first runs the next time tasks at its priority run,
+ * never from inside this call.
+ */
+
+indigo_error_t ind_soc_coroutine_spawn(
+    ind_soc_coroutine_f func,
+    void *cookie, int priority);
+
+/**
+ * Return the running coroutine
+ */
+
+ind_soc_coroutine_t *ind_soc_coroutine_self(void);
+
+/**
+ * Return to the event loop until tasks at this priority next run
+ */
+
+void ind_soc_coroutine_yield(void);
+
+/**
+ * Yield if ind_soc_should_yield() is true
+ *
+ * Call this after each unit of work in a long loop.
+ */
+
+void ind_soc_coroutine_maybe_yield(void);
+
+/**
+ * Suspend the running coroutine until it is woken
+ *
+ * Returns at once if ind_soc_coroutine_wake was called since the last
+ * wait, so a wakeup that arrives between registering for it and
+ * waiting is not lost.
+ */
+
+void ind_soc_coroutine_wait(void);
+
+/**
+ * Wake a coroutine suspended in ind_soc_coroutine_wait
+ *
+ * @param coroutine The ind_soc_coroutine_t to wake
+ *
+ * The argument is untyped so this can be registered directly as a
+ * callback with its cookie, e.g. with indigo_cxn_output_ready_register.
+ */
+
+void ind_soc_coroutine_wake(void *coroutine);
+
+/**
+ * Number of coroutines that have been spawned and not yet finished
+ */
+
+int ind_soc_coroutine_count(void);
+
 
 typedef struct ind_soc_config_s {
     uint32_t flags; /* Ignored */
@@ -321,6 +415,9 @@ extern indigo_error_t ind_soc_init(ind_soc_config_t *config);
  * run.  Then select is run on all registered sockets.  Those that have called
  * data_out_ready will be checked for write availability as well.
  *
+ * Until it returns, INDIGO_CURRENT_TIME gives callbacks the time of the
+ * loop's last clock read instead of reading the clock itself.
+ *
  * Provided by socket manager, required by application
  */
 
@@ -341,7 +438,9 @@ extern void ind_soc_run_status_set(ind_soc_run_status_t status);
  * Check whether the current callback should yield
  *
  * This function will return true if too much time has passed
- * since the callback began.
+ * since the callback began: SOCKETMANAGER_CONFIG_TIMESLICE_MS if a
+ * timer or socket at the callback's priority or higher is waiting,
+ * SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS otherwise.
  *
  * This should be only called after the callback has done some
  * minimal amount of work to ensure forward progress.
@@ -353,6 +452,146 @@ extern void ind_soc_run_status_set(ind_soc_run_status_t status);
 
 int ind_soc_should_yield(void);
 
+/****************************************************************
+ * Event loop latency probe
+ ****************************************************************/
+
+/** Latency buckets: 0 ms, then [2^(n-1), 2^n) ms, the last unbounded */
+#define IND_SOC_PROBE_BUCKETS 12
+
+/** Distinct socket priorities tracked; sockets at others are not counted */
+#define IND_SOC_PROBE_PRIORITIES 8
+
+/**
+ * Distribution of one probed interval, in milliseconds
+ */
+typedef struct ind_soc_probe_latency_s {
+    uint64_t count;
+    uint64_t total_ms;
+    uint32_t max_ms;
+    uint64_t buckets[IND_SOC_PROBE_BUCKETS];
+} ind_soc_probe_latency_t;
+
+/**
+ * Event loop latency probe results
+ *
+ * loop_busy: From a wait returning to the next wait, so the longest
+ * the loop went without looking for new events.
+ *
+ * timer_late: From a timer's deadline (its last run plus repeat_time_ms)
+ * to its callback starting.
+ *
+ * timer_run, socket_run, task_run: How long callbacks ran.
+ *
+ * task_yield_gap: How long a task ran between starting, each call to
+ * ind_soc_should_yield() and returning.
+ *
+ * socket_ready: For each socket priority, from the wait that first
+ * reported a socket ready to its callback starting.
+ */
+typedef struct ind_soc_probe_stats_s {
+    ind_soc_probe_latency_t loop_busy;
+    ind_soc_probe_latency_t timer_late;
+    ind_soc_probe_latency_t timer_run;
+    ind_soc_probe_latency_t socket_run;
+    ind_soc_probe_latency_t task_run;
+    ind_soc_probe_latency_t task_yield_gap;
+    int num_priorities;
+    struct {
+        int priority;
+        ind_soc_probe_latency_t socket_ready;
+    } priorities[IND_SOC_PROBE_PRIORITIES];
+} ind_soc_probe_stats_t;
+
+/**
+ * Enable or disable the latency probe
+ *
+ * Disabled by default. When disabled the event loop pays only for a
+ * flag test. Results are kept across disable and enable.
+ */
+
+void ind_soc_probe_enable_set(int enable);
+
+/**
+ * Get whether the latency probe is enabled
+ */
+
+int ind_soc_probe_enable_get(void);
+
+/**
+ * Copy out the latency probe results
+ */
+
+void ind_soc_probe_stats_get(ind_soc_probe_stats_t *stats);
+
+/**
+ * Reset the latency probe results
+ */
+
+void ind_soc_probe_stats_clear(void);
+
+/****************************************************************
+ * Callback profiler
+ ****************************************************************/
+
+/** Distinct callback functions tracked; calls to others are dropped */
+#define IND_SOC_PROFILE_CALLBACKS 128
+
+/** How a profiled function was called */
+typedef enum ind_soc_profile_kind_e {
+    IND_SOC_PROFILE_SOCKET,
+    IND_SOC_PROFILE_TIMER,
+    IND_SOC_PROFILE_TASK,
+} ind_soc_profile_kind_t;
+
+/**
+ * Run time of one callback function
+ *
+ * Times are from a monotonic clock around each call. The loop runs
+ * callbacks one at a time on its own thread, so this is the CPU time the
+ * loop spent in the function unless the callback blocks.
+ */
+typedef struct ind_soc_profile_entry_s {
+    void *callback;
+    ind_soc_profile_kind_t kind;
+    uint64_t count;
+    uint64_t total_us;
+    uint32_t max_us;
+} ind_soc_profile_entry_t;
+
+/**
+ * Enable or disable the callback profiler
+ *
+ * Disabled by default. When enabled each callback costs two clock
+ * reads and a hash lookup. Results are kept across disable and enable.
+ */
+
+void ind_soc_profile_enable_set(int enable);
+
+/**
+ * Get whether the callback profiler is enabled
+ */
+
+int ind_soc_profile_enable_get(void);
+
+/**
+ * Copy out the callback profile, most total run time first
+ * @param entries Output array
+ * @param max_entries Size of entries
+ * @param dropped If not NULL, set to the calls not counted because
+ * IND_SOC_PROFILE_CALLBACKS functions were already tracked
+ * @returns The number of entries filled in
+ */
+
+int ind_soc_profile_get(ind_soc_profile_entry_t *entries, int max_entries,
+                        uint64_t *dropped);
+
+/**
+ * Reset the callback profile
+ */
+
+void ind_soc_profile_clear(void);
+
 
 /**
  * Enable the socket manager
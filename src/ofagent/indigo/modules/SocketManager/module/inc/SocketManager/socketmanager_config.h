@@ -111,23 +111,63 @@
 /**
  * SOCKETMANAGER_CONFIG_TIMESLICE_MS
  *
- * Milliseconds before ind_soc_should_yield() returns true. */
+ * Milliseconds before ind_soc_should_yield() returns true if other work is pending. */
 
 
 #ifndef SOCKETMANAGER_CONFIG_TIMESLICE_MS
 #define SOCKETMANAGER_CONFIG_TIMESLICE_MS 10
 #endif
 
+/**
+ * SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS
+ *
+ * Milliseconds before ind_soc_should_yield() returns true if no other work is pending. */
+
+
+#ifndef SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS
+#define SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS 50
+#endif
+
 /**
  * SOCKETMANAGER_CONFIG_MAX_TIMERS
  *
- * Maximum number of timers supported */
+ * Initial timer heap capacity */
 
 
 #ifndef SOCKETMANAGER_CONFIG_MAX_TIMERS
 #define SOCKETMANAGER_CONFIG_MAX_TIMERS 48
 #endif
 
+/**
+ * SOCKETMANAGER_CONFIG_MAX_SOCKETS
+ *
+ * Maximum socket descriptor value supported */
+
+
+#ifndef SOCKETMANAGER_CONFIG_MAX_SOCKETS
+#define SOCKETMANAGER_CONFIG_MAX_SOCKETS 1024
+#endif
+
+/**
+ * SOCKETMANAGER_CONFIG_USE_EPOLL
+ *
+ * Use epoll(7) rather than poll(2) to wait for socket events. */
+
+
+#ifndef SOCKETMANAGER_CONFIG_USE_EPOLL
+#define SOCKETMANAGER_CONFIG_USE_EPOLL 1
+#endif
+
+/**
+ * SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE
+ *
+ * Bytes of stack given to each coroutine. */
+
+
+#ifndef SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE
+#define SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE 262144
+#endif
+
 
 
 /**
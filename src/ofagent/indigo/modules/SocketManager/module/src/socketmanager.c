@@ -29,8 +29,14 @@
  * loop processes one priority level before polling for potential new high
  * priority events.
  *
+ * Sockets are waited on with epoll(7), or poll(2) when
+ * SOCKETMANAGER_CONFIG_USE_EPOLL is 0. Either way each wait fills the dense
+ * ready_sockets array, so dispatch only visits sockets that have events.
+ *
  * @todo Make the max socket ID supported a parameter to the module
- * @todo Make the max timer events supported a parameter to the module
+ *
+ * Timers are kept in a binary min-heap ordered by deadline, and hashed on
+ * (callback, cookie) for register/unregister lookups.
  *
  * @todo Consider supporting both periodic and single events.  Currently
  * periodic events are supported with a special one-shot, immediate
@@ -57,13 +63,37 @@
 #include <AIM/aim_list.h>
 
 #include <poll.h>
+#if SOCKETMANAGER_CONFIG_USE_EPOLL == 1
+#include <sys/epoll.h>
+#endif
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
 #include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <time.h>
 
 static void before_callback(void);
-static void after_callback(void);
+static void after_callback(ind_soc_probe_latency_t *run_time,
+                           ind_soc_profile_kind_t kind, void *callback);
+
+/* Time the current callback started */
+static indigo_time_t callback_start_time;
+
+/* Priority the loop is running callbacks at */
+static int loop_priority;
+
+/*
+ * When ind_soc_should_yield last looked for pending work, and whether it
+ * found any; the check is made at most once a millisecond per callback
+ */
+static indigo_time_t yield_check_time;
+static int yield_pending;
+
+/* Set while ind_soc_select_and_run runs; see clock_read */
+static int loop_running = 0;
 
 static int init_done = 0;
 static int module_enabled = 0;
@@ -78,21 +108,44 @@ static int module_enabled = 0;
 #define INVALID_SOCKET_ID -1
 
 /* Maximum simultaneous sockets to support */
-#define SOCKET_COUNT_MAX 1024
+#define SOCKET_COUNT_MAX SOCKETMANAGER_CONFIG_MAX_SOCKETS
 typedef struct soc_map_s {
-    short socket_id;
-    uint16_t pollfd_index;
+    int socket_id;
+    int pollfd_index;
+    short events; /* POLLIN/POLLOUT */
     int priority;
     ind_soc_socket_ready_callback_f callback;
     void *cookie;
+    indigo_time_t probe_ready_since; /* Valid while probe_wait is current */
+    uint64_t probe_wait; /* Probe wait count when last reported ready */
 } soc_map_t;
 
 /* Indexed by socket descriptor */
 static soc_map_t soc_map[SOCKET_COUNT_MAX];
 
+/* Number of registered sockets */
+static int num_sockets = 0;
+
+#if SOCKETMANAGER_CONFIG_USE_EPOLL == 1
+static int epoll_fd = -1;
+static struct epoll_event epoll_events[SOCKET_COUNT_MAX];
+#else
 /* Dense array passed to poll(2) */
 static struct pollfd pollfds[SOCKET_COUNT_MAX];
-static int num_pollfds = 0;
+#endif
+
+/*
+ * Sockets with events from the last wait, in the order reported.
+ * Entries for sockets unregistered since the wait have socket_id set to
+ * INVALID_SOCKET_ID.
+ */
+typedef struct soc_ready_s {
+    int socket_id;
+    short revents; /* POLLIN/POLLOUT/POLLERR/POLLHUP */
+} soc_ready_t;
+
+static soc_ready_t ready_sockets[SOCKET_COUNT_MAX];
+static int num_ready_sockets = 0;
 
 #define IS_ACTIVE_SOCKET_ID(_id) (soc_map[_id].socket_id == (_id))
 #define IS_LEGAL_SOCKET_ID(_id) (((_id) >= 0) && ((_id) < SOCKET_COUNT_MAX))
@@ -103,20 +156,31 @@ static int num_pollfds = 0;
  * Lookup is (callback, cookie)
  */
 typedef struct timer_event_s {
+    list_links_t hash_links;
+    list_links_t expired_links; /* Valid when on_expired */
     ind_soc_timer_callback_f callback;
     void *cookie;
     int repeat_time_ms;
     int priority;
-    indigo_time_t last_call;
+    indigo_time_t deadline;
+    int heap_index;
+    int on_expired;
 } timer_event_t;
 
-static timer_event_t timer_event[SOCKETMANAGER_CONFIG_MAX_TIMERS];
+#define TIMER_HASH_BUCKETS 256
+
+static list_head_t timer_hash[TIMER_HASH_BUCKETS];
 
-#define TIMER_EVENT_VALID(idx) (timer_event[idx].callback != NULL)
+/* Min-heap ordered by deadline */
+static timer_event_t **timer_heap;
+static int timer_heap_size = 0;
+static int timer_heap_alloc = 0;
 
-#define FOREACH_TIMER_EVENT(idx)                        \
-    for ((idx) = 0; (idx) < SOCKETMANAGER_CONFIG_MAX_TIMERS; (idx)++)   \
-        if (TIMER_EVENT_VALID(idx))
+/* Timers due to fire in the current process_timers call */
+static list_head_t expired_timers;
+
+#define TIMER_EXPIRED(timer, now) \
+    (INDIGO_TIME_DIFF_ms((now), (timer)->deadline) <= 0)
 
 /*
  * Task structure
@@ -131,36 +195,420 @@ typedef struct ind_soc_task_s {
 /* Sorted in descending priority order */
 static list_head_t tasks;
 
+/*
+ * Latency probe
+ *
+ * Every measurement is made with INDIGO_CURRENT_TIME, which the loop
+ * refreshes after each wait, after each callback and on each
+ * should_yield check, so enabling the probe adds no clock reads.
+ */
+static int probe_enabled = 0;
+static ind_soc_probe_stats_t probe_stats;
+
+/* Incremented on each wait; starts above 1 so 0 never looks current */
+static uint64_t probe_wait_count = 2;
+static indigo_time_t probe_wait_end;
+
+/* Set while a task callback runs */
+static int probe_in_task = 0;
+static indigo_time_t probe_last_yield_check;
+
+/*
+ * Callback profiler
+ *
+ * Open addressing on the callback address; the table never shrinks
+ * until cleared, so a function keeps its slot.
+ */
+static int profile_enabled = 0;
+static ind_soc_profile_entry_t profile_table[IND_SOC_PROFILE_CALLBACKS];
+static int profile_count = 0;
+static uint64_t profile_dropped = 0;
+static uint64_t profile_start_us;
+
+static uint64_t
+profile_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void
+profile_record(ind_soc_profile_kind_t kind, void *callback, uint64_t us)
+{
+    uintptr_t h = (uintptr_t)callback;
+    ind_soc_profile_entry_t *entry;
+    int i, idx;
+
+    h ^= h >> 17;
+    h *= 0x9e3779b97f4a7c15ULL;
+    idx = (h >> 32) % IND_SOC_PROFILE_CALLBACKS;
+
+    for (i = 0; i < IND_SOC_PROFILE_CALLBACKS; i++) {
+        entry = &profile_table[idx];
+        if (entry->callback == callback && entry->kind == kind) {
+            break;
+        }
+        if (entry->callback == NULL) {
+            entry->callback = callback;
+            entry->kind = kind;
+            profile_count++;
+            break;
+        }
+        idx = (idx + 1) % IND_SOC_PROFILE_CALLBACKS;
+    }
+
+    if (i == IND_SOC_PROFILE_CALLBACKS) {
+        profile_dropped++;
+        return;
+    }
+
+    if (us > UINT32_MAX) {
+        us = UINT32_MAX;
+    }
+
+    entry->count++;
+    entry->total_us += us;
+    if (us > entry->max_us) {
+        entry->max_us = us;
+    }
+}
+
+void
+ind_soc_profile_enable_set(int enable)
+{
+    profile_enabled = enable ? 1 : 0;
+}
+
+int
+ind_soc_profile_enable_get(void)
+{
+    return profile_enabled;
+}
+
+void
+ind_soc_profile_clear(void)
+{
+    memset(profile_table, 0, sizeof(profile_table));
+    profile_count = 0;
+    profile_dropped = 0;
+}
 
-/* Return index for timer; -1 if not found.  Use only with valid callback */
 static int
+profile_entry_cmp(const void *_a, const void *_b)
+{
+    const ind_soc_profile_entry_t *a = _a, *b = _b;
+
+    if (a->total_us != b->total_us) {
+        return a->total_us < b->total_us ? 1 : -1;
+    }
+    return 0;
+}
+
+int
+ind_soc_profile_get(ind_soc_profile_entry_t *entries, int max_entries,
+                    uint64_t *dropped)
+{
+    ind_soc_profile_entry_t sorted[IND_SOC_PROFILE_CALLBACKS];
+    int i, n = 0;
+
+    for (i = 0; i < IND_SOC_PROFILE_CALLBACKS; i++) {
+        if (profile_table[i].callback != NULL) {
+            sorted[n++] = profile_table[i];
+        }
+    }
+
+    qsort(sorted, n, sizeof(sorted[0]), profile_entry_cmp);
+
+    if (n > max_entries) {
+        n = max_entries;
+    }
+    memcpy(entries, sorted, n * sizeof(sorted[0]));
+
+    if (dropped != NULL) {
+        *dropped = profile_dropped;
+    }
+
+    return n;
+}
+
+static const char *
+profile_kind_name(ind_soc_profile_kind_t kind)
+{
+    switch (kind) {
+    case IND_SOC_PROFILE_SOCKET: return "socket";
+    case IND_SOC_PROFILE_TIMER: return "timer";
+    case IND_SOC_PROFILE_TASK: return "task";
+    default: return "unknown";
+    }
+}
+
+void
+ind_soc_profile_show(aim_pvs_t *pvs, int count)
+{
+    ind_soc_profile_entry_t entries[IND_SOC_PROFILE_CALLBACKS];
+    uint64_t dropped, total_us = 0;
+    int i, n;
+
+    n = ind_soc_profile_get(entries, IND_SOC_PROFILE_CALLBACKS, &dropped);
+    for (i = 0; i < n; i++) {
+        total_us += entries[i].total_us;
+    }
+
+    aim_printf(pvs, "Callback profiler %s, %d functions, %"PRIu64" ms total",
+               profile_enabled ? "enabled" : "disabled", n, total_us / 1000);
+    if (dropped) {
+        aim_printf(pvs, ", %"PRIu64" calls dropped", dropped);
+    }
+    aim_printf(pvs, "\n");
+    aim_printf(pvs, "%-6s %-18s %10s %10s %6s %10s %10s\n",
+               "kind", "callback", "calls", "total_ms", "share",
+               "avg_us", "max_us");
+
+    for (i = 0; i < n && i < count; i++) {
+        ind_soc_profile_entry_t *entry = &entries[i];
+        aim_printf(pvs, "%-6s %-18p %10"PRIu64" %10"PRIu64" %5.1f%% %10"PRIu64" %10u\n",
+                   profile_kind_name(entry->kind), entry->callback,
+                   entry->count, entry->total_us / 1000,
+                   total_us ? 100.0 * entry->total_us / total_us : 0.0,
+                   entry->total_us / entry->count, entry->max_us);
+    }
+}
+
+static void
+probe_record(ind_soc_probe_latency_t *latency, int ms)
+{
+    int bucket = 0;
+
+    if (ms < 0) {
+        ms = 0;
+    }
+
+    if (ms > 0) {
+        bucket = 32 - __builtin_clz((unsigned)ms);
+        if (bucket >= IND_SOC_PROBE_BUCKETS) {
+            bucket = IND_SOC_PROBE_BUCKETS - 1;
+        }
+    }
+
+    latency->count++;
+    latency->total_ms += ms;
+    if (ms > latency->max_ms) {
+        latency->max_ms = ms;
+    }
+    latency->buckets[bucket]++;
+}
+
+/* Return the socket_ready results for priority; NULL if out of slots */
+static ind_soc_probe_latency_t *
+probe_socket_ready_find(int priority)
+{
+    int i;
+
+    for (i = 0; i < probe_stats.num_priorities; i++) {
+        if (probe_stats.priorities[i].priority == priority) {
+            return &probe_stats.priorities[i].socket_ready;
+        }
+    }
+
+    if (probe_stats.num_priorities == IND_SOC_PROBE_PRIORITIES) {
+        return NULL;
+    }
+
+    i = probe_stats.num_priorities++;
+    probe_stats.priorities[i].priority = priority;
+    return &probe_stats.priorities[i].socket_ready;
+}
+
+void
+ind_soc_probe_enable_set(int enable)
+{
+    if (enable && !probe_enabled) {
+        /* Forget sockets seen ready before the probe was last disabled */
+        probe_wait_count += 2;
+        probe_wait_end = 0;
+    }
+    probe_enabled = enable ? 1 : 0;
+}
+
+int
+ind_soc_probe_enable_get(void)
+{
+    return probe_enabled;
+}
+
+void
+ind_soc_probe_stats_get(ind_soc_probe_stats_t *stats)
+{
+    *stats = probe_stats;
+}
+
+void
+ind_soc_probe_stats_clear(void)
+{
+    memset(&probe_stats, 0, sizeof(probe_stats));
+}
+
+static void
+probe_latency_show(aim_pvs_t *pvs, const char *name,
+                   const ind_soc_probe_latency_t *latency)
+{
+    int i, last;
+
+    aim_printf(pvs, "%-20s count %10"PRIu64"  avg %8.2f ms  max %6u ms ",
+               name, latency->count,
+               latency->count ? (double)latency->total_ms / latency->count : 0.0,
+               latency->max_ms);
+
+    /* Buckets past the last one used are left out */
+    for (last = IND_SOC_PROBE_BUCKETS - 1; last > 0 && latency->buckets[last] == 0; last--);
+    for (i = 0; i <= last; i++) {
+        if (i == 0) {
+            aim_printf(pvs, " 0:%"PRIu64, latency->buckets[i]);
+        } else if (i == IND_SOC_PROBE_BUCKETS - 1) {
+            aim_printf(pvs, " >=%d:%"PRIu64, 1 << (i - 1), latency->buckets[i]);
+        } else {
+            aim_printf(pvs, " <%d:%"PRIu64, 1 << i, latency->buckets[i]);
+        }
+    }
+    aim_printf(pvs, "\n");
+}
+
+void
+ind_soc_probe_stats_show(aim_pvs_t *pvs)
+{
+    char name[32];
+    int i;
+
+    aim_printf(pvs, "Latency probe %s, timeslice %d ms, %d ms when idle\n",
+               probe_enabled ? "enabled" : "disabled",
+               SOCKETMANAGER_CONFIG_TIMESLICE_MS,
+               SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS);
+    probe_latency_show(pvs, "loop_busy", &probe_stats.loop_busy);
+    probe_latency_show(pvs, "timer_late", &probe_stats.timer_late);
+    probe_latency_show(pvs, "timer_run", &probe_stats.timer_run);
+    probe_latency_show(pvs, "socket_run", &probe_stats.socket_run);
+    probe_latency_show(pvs, "task_run", &probe_stats.task_run);
+    probe_latency_show(pvs, "task_yield_gap", &probe_stats.task_yield_gap);
+    for (i = 0; i < probe_stats.num_priorities; i++) {
+        snprintf(name, sizeof(name), "socket_ready[%d]",
+                 probe_stats.priorities[i].priority);
+        probe_latency_show(pvs, name, &probe_stats.priorities[i].socket_ready);
+    }
+}
+
+
+static list_head_t *
+timer_hash_bucket(ind_soc_timer_callback_f callback, void *cookie)
+{
+    uint64_t h = (uintptr_t)callback ^ ((uintptr_t)cookie * 0x9e3779b97f4a7c15ULL);
+    return &timer_hash[(h ^ (h >> 32)) % TIMER_HASH_BUCKETS];
+}
+
+/* Return the timer for (callback, cookie); NULL if not found */
+static timer_event_t *
 timer_event_find(ind_soc_timer_callback_f callback, void *cookie)
 {
-    int idx;
+    list_head_t *bucket = timer_hash_bucket(callback, cookie);
+    list_links_t *cur;
 
-    FOREACH_TIMER_EVENT(idx) {
-        if ((timer_event[idx].callback == callback) &&
-                (timer_event[idx].cookie == cookie)) {
-            return idx;
+    LIST_FOREACH(bucket, cur) {
+        timer_event_t *timer = container_of(cur, hash_links, timer_event_t);
+        if (timer->callback == callback && timer->cookie == cookie) {
+            return timer;
         }
     }
 
-    return -1;
+    return NULL;
 }
 
-/* Return index of first free timer slot */
 static int
-timer_event_free_slot(void)
+timer_heap_before(int a, int b)
 {
-    int idx;
+    return INDIGO_TIME_DIFF_ms(timer_heap[b]->deadline,
+                               timer_heap[a]->deadline) < 0;
+}
+
+static void
+timer_heap_swap(int a, int b)
+{
+    timer_event_t *tmp = timer_heap[a];
+    timer_heap[a] = timer_heap[b];
+    timer_heap[b] = tmp;
+    timer_heap[a]->heap_index = a;
+    timer_heap[b]->heap_index = b;
+}
+
+/* Restore the heap property for the element at idx */
+static void
+timer_heap_fix(int idx)
+{
+    while (idx > 0 && timer_heap_before(idx, (idx - 1) / 2)) {
+        timer_heap_swap(idx, (idx - 1) / 2);
+        idx = (idx - 1) / 2;
+    }
+
+    for (;;) {
+        int left = idx * 2 + 1, right = left + 1, min = idx;
+        if (left < timer_heap_size && timer_heap_before(left, min)) {
+            min = left;
+        }
+        if (right < timer_heap_size && timer_heap_before(right, min)) {
+            min = right;
+        }
+        if (min == idx) {
+            break;
+        }
+        timer_heap_swap(idx, min);
+        idx = min;
+    }
+}
 
-    for (idx = 0; idx < SOCKETMANAGER_CONFIG_MAX_TIMERS; idx++) {
-        if (timer_event[idx].callback == NULL) {
-            return idx;
+static indigo_error_t
+timer_heap_insert(timer_event_t *timer)
+{
+    if (timer_heap_size == timer_heap_alloc) {
+        int new_alloc = timer_heap_alloc ? timer_heap_alloc * 2 :
+            SOCKETMANAGER_CONFIG_MAX_TIMERS;
+        timer_event_t **new_heap =
+            aim_realloc(timer_heap, new_alloc * sizeof(*new_heap));
+        if (new_heap == NULL) {
+            return INDIGO_ERROR_RESOURCE;
         }
+        timer_heap = new_heap;
+        timer_heap_alloc = new_alloc;
+    }
+
+    timer->heap_index = timer_heap_size;
+    timer_heap[timer_heap_size++] = timer;
+    timer_heap_fix(timer->heap_index);
+
+    return INDIGO_ERROR_NONE;
+}
+
+static void
+timer_heap_remove(timer_event_t *timer)
+{
+    int idx = timer->heap_index;
+
+    timer_heap_size--;
+    if (idx != timer_heap_size) {
+        timer_heap[idx] = timer_heap[timer_heap_size];
+        timer_heap[idx]->heap_index = idx;
+        timer_heap_fix(idx);
     }
+    timer->heap_index = -1;
+}
 
-    return -1;
+static void
+timer_event_free(timer_event_t *timer)
+{
+    timer_heap_remove(timer);
+    list_remove(&timer->hash_links);
+    if (timer->on_expired) {
+        list_remove(&timer->expired_links);
+    }
+    aim_free(timer);
 }
 
 static void
@@ -170,22 +618,287 @@ soc_mgr_init(void)
     for (idx = 0; idx < SOCKET_COUNT_MAX; idx++) {
         soc_map[idx].socket_id = INVALID_SOCKET_ID;
     }
+    num_sockets = 0;
+    num_ready_sockets = 0;
 
-    for (idx = 0; idx < SOCKETMANAGER_CONFIG_MAX_TIMERS; idx++) {
-        timer_event[idx].callback = NULL;
+    while (timer_heap_size > 0) {
+        timer_event_free(timer_heap[0]);
     }
 
+    for (idx = 0; idx < TIMER_HASH_BUCKETS; idx++) {
+        list_init(&timer_hash[idx]);
+    }
+
+    list_init(&expired_timers);
+
     list_init(&tasks);
 }
 
 
+#if SOCKETMANAGER_CONFIG_USE_EPOLL == 1
+
+static uint32_t
+epoll_events_from_poll(short events)
+{
+    uint32_t ep_events = 0;
+
+    if (events & POLLIN) {
+        ep_events |= EPOLLIN;
+    }
+    if (events & POLLOUT) {
+        ep_events |= EPOLLOUT;
+    }
+
+    return ep_events;
+}
+
+static short
+poll_events_from_epoll(uint32_t ep_events)
+{
+    short events = 0;
+
+    if (ep_events & EPOLLIN) {
+        events |= POLLIN;
+    }
+    if (ep_events & EPOLLOUT) {
+        events |= POLLOUT;
+    }
+    if (ep_events & EPOLLERR) {
+        events |= POLLERR;
+    }
+    if (ep_events & EPOLLHUP) {
+        events |= POLLHUP;
+    }
+
+    return events;
+}
+
+static int
+soc_epoll_fd_get(void)
+{
+    if (epoll_fd < 0) {
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0) {
+            LOG_ERROR("Could not create epoll instance: %s", strerror(errno));
+        }
+    }
+
+    return epoll_fd;
+}
+
+static indigo_error_t
+soc_backend_add(int socket_id)
+{
+    struct epoll_event ev;
+    int epfd;
+
+    if ((epfd = soc_epoll_fd_get()) < 0) {
+        return INDIGO_ERROR_UNKNOWN;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = epoll_events_from_poll(soc_map[socket_id].events);
+    ev.data.fd = socket_id;
+
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, socket_id, &ev) < 0) {
+        LOG_ERROR("Could not add socket %d to epoll: %s",
+                  socket_id, strerror(errno));
+        return INDIGO_ERROR_UNKNOWN;
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+static void
+soc_backend_remove(int socket_id)
+{
+    /* The socket may already have been closed, which removes it */
+    if (epoll_fd >= 0 &&
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, socket_id, NULL) < 0) {
+        LOG_TRACE("Could not remove socket %d from epoll: %s",
+                  socket_id, strerror(errno));
+    }
+}
+
+static void
+soc_backend_events_set(int socket_id, short events)
+{
+    struct epoll_event ev;
+
+    if (soc_map[socket_id].events == events) {
+        return;
+    }
+    soc_map[socket_id].events = events;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = epoll_events_from_poll(events);
+    ev.data.fd = socket_id;
+
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, socket_id, &ev) < 0) {
+        LOG_ERROR("Could not modify socket %d in epoll: %s",
+                  socket_id, strerror(errno));
+    }
+}
+
+/*
+ * Wait for events and fill ready_sockets. Returns the wait result.
+ */
+static int
+soc_backend_wait(int timeout_ms)
+{
+    int rv, i, epfd;
+
+    num_ready_sockets = 0;
+
+    if ((epfd = soc_epoll_fd_get()) < 0) {
+        return -1;
+    }
+
+    rv = epoll_wait(epfd, epoll_events, SOCKET_COUNT_MAX, timeout_ms);
+
+    for (i = 0; i < rv; i++) {
+        soc_ready_t *ready = &ready_sockets[num_ready_sockets++];
+        ready->socket_id = epoll_events[i].data.fd;
+        ready->revents = poll_events_from_epoll(epoll_events[i].events);
+    }
+
+    return rv;
+}
+
+/*
+ * Whether a socket with at least the given priority is ready, without
+ * waiting. Level triggered readiness is left for the next wait.
+ */
+static int
+soc_backend_pending(int priority)
+{
+    struct epoll_event events[16];
+    int rv, i, epfd;
+
+    if ((epfd = soc_epoll_fd_get()) < 0) {
+        return 0;
+    }
+
+    rv = epoll_wait(epfd, events, AIM_ARRAYSIZE(events), 0);
+
+    for (i = 0; i < rv; i++) {
+        if (soc_map[events[i].data.fd].priority >= priority) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void
+soc_backend_finish(void)
+{
+    if (epoll_fd >= 0) {
+        close(epoll_fd);
+        epoll_fd = -1;
+    }
+}
+
+#else /* poll(2) */
+
+static indigo_error_t
+soc_backend_add(int socket_id)
+{
+    struct pollfd *pfd;
+
+    INDIGO_ASSERT(num_sockets < SOCKET_COUNT_MAX);
+    soc_map[socket_id].pollfd_index = num_sockets;
+    pfd = &pollfds[num_sockets];
+    pfd->fd = socket_id;
+    pfd->events = soc_map[socket_id].events;
+    pfd->revents = 0;
+
+    return INDIGO_ERROR_NONE;
+}
+
+static void
+soc_backend_remove(int socket_id)
+{
+    /*
+     * Need to maintain the dense property of the pollfds array.
+     * Move the element at the end to the index being freed.
+     */
+    INDIGO_ASSERT(num_sockets > 0);
+    if (num_sockets > 1) {
+        int dst_index = POLLFD_INDEX(socket_id);
+        struct pollfd *src_pfd = &pollfds[num_sockets-1];
+        struct pollfd *dst_pfd = &pollfds[dst_index];
+        if (src_pfd != dst_pfd) {
+            soc_map[src_pfd->fd].pollfd_index = dst_index;
+            *dst_pfd = *src_pfd;
+        }
+    }
+}
+
+static void
+soc_backend_events_set(int socket_id, short events)
+{
+    soc_map[socket_id].events = events;
+    pollfds[POLLFD_INDEX(socket_id)].events = events;
+}
+
+static int
+soc_backend_wait(int timeout_ms)
+{
+    int rv, i;
+
+    num_ready_sockets = 0;
+
+    rv = poll(pollfds, num_sockets, timeout_ms);
+
+    for (i = 0; i < num_sockets && num_ready_sockets < rv; i++) {
+        if (pollfds[i].revents != 0) {
+            soc_ready_t *ready = &ready_sockets[num_ready_sockets++];
+            ready->socket_id = pollfds[i].fd;
+            ready->revents = pollfds[i].revents;
+        }
+    }
+
+    return rv;
+}
+
+/*
+ * Whether a socket with at least the given priority is ready, without
+ * waiting. The next wait overwrites the revents this sets.
+ */
+static int
+soc_backend_pending(int priority)
+{
+    int rv, i;
+
+    rv = poll(pollfds, num_sockets, 0);
+
+    for (i = 0; i < num_sockets && rv > 0; i++) {
+        if (pollfds[i].revents != 0) {
+            if (soc_map[pollfds[i].fd].priority >= priority) {
+                return 1;
+            }
+            rv--;
+        }
+    }
+
+    return 0;
+}
+
+static void
+soc_backend_finish(void)
+{
+}
+
+#endif /* SOCKETMANAGER_CONFIG_USE_EPOLL */
+
 indigo_error_t
 ind_soc_socket_register_with_priority(int socket_id,
                                       ind_soc_socket_ready_callback_f callback,
                                       void *cookie,
                                       int priority)
 {
-    struct pollfd *pfd;
+    indigo_error_t rv;
 
     LOG_VERBOSE("Register socket %d", socket_id);
     if (!IS_LEGAL_SOCKET_ID(socket_id)) {
@@ -204,17 +917,17 @@ ind_soc_socket_register_with_priority(int socket_id,
     }
 
     INDIGO_ASSERT(soc_map[socket_id].socket_id == INVALID_SOCKET_ID);
+    soc_map[socket_id].events = POLLIN;
+
+    if ((rv = soc_backend_add(socket_id)) < 0) {
+        return rv;
+    }
+
     soc_map[socket_id].socket_id = socket_id;
-    soc_map[socket_id].pollfd_index = num_pollfds;
     soc_map[socket_id].callback = callback;
     soc_map[socket_id].cookie = cookie;
     soc_map[socket_id].priority = priority;
-
-    INDIGO_ASSERT(num_pollfds < SOCKET_COUNT_MAX);
-    pfd = &pollfds[num_pollfds++];
-    pfd->fd = socket_id;
-    pfd->events = POLLIN;
-    pfd->revents = 0;
+    num_sockets++;
 
     return INDIGO_ERROR_NONE;
 }
@@ -241,7 +954,7 @@ ind_soc_data_out_ready(int socket_id)
         return INDIGO_ERROR_PARAM;
     }
 
-    pollfds[POLLFD_INDEX(socket_id)].events |= POLLOUT;
+    soc_backend_events_set(socket_id, soc_map[socket_id].events | POLLOUT);
 
     return INDIGO_ERROR_NONE;
 }
@@ -259,7 +972,7 @@ ind_soc_data_out_clear(int socket_id)
         return INDIGO_ERROR_PARAM;
     }
 
-    pollfds[POLLFD_INDEX(socket_id)].events &= ~POLLOUT;
+    soc_backend_events_set(socket_id, soc_map[socket_id].events & ~POLLOUT);
 
     return INDIGO_ERROR_NONE;
 }
@@ -277,7 +990,7 @@ ind_soc_data_in_pause(int socket_id)
         return INDIGO_ERROR_PARAM;
     }
 
-    pollfds[POLLFD_INDEX(socket_id)].events &= ~POLLIN;
+    soc_backend_events_set(socket_id, soc_map[socket_id].events & ~POLLIN);
 
     return INDIGO_ERROR_NONE;
 }
@@ -295,7 +1008,7 @@ ind_soc_data_in_resume(int socket_id)
         return INDIGO_ERROR_PARAM;
     }
 
-    pollfds[POLLFD_INDEX(socket_id)].events |= POLLIN;
+    soc_backend_events_set(socket_id, soc_map[socket_id].events | POLLIN);
 
     return INDIGO_ERROR_NONE;
 }
@@ -307,6 +1020,8 @@ ind_soc_data_in_resume(int socket_id)
 indigo_error_t
 ind_soc_socket_unregister(int socket_id)
 {
+    int i;
+
     LOG_VERBOSE("Unregister socket %d", socket_id);
 
     if (!IS_LEGAL_SOCKET_ID(socket_id)) {
@@ -319,23 +1034,16 @@ ind_soc_socket_unregister(int socket_id)
         return INDIGO_ERROR_PARAM;
     }
 
-    /*
-     * Need to maintain the dense property of the pollfds array.
-     * Move the element at the end to the index being freed.
-     */
-    INDIGO_ASSERT(num_pollfds > 0);
-    if (num_pollfds > 1) {
-        int dst_index = POLLFD_INDEX(socket_id);
-        struct pollfd *src_pfd = &pollfds[num_pollfds-1];
-        struct pollfd *dst_pfd = &pollfds[dst_index];
-        if (src_pfd != dst_pfd) {
-            soc_map[src_pfd->fd].pollfd_index = dst_index;
-            *dst_pfd = *src_pfd;
+    soc_backend_remove(socket_id);
+    num_sockets--;
+
+    /* Drop any pending events so they aren't delivered to a new owner */
+    for (i = 0; i < num_ready_sockets; i++) {
+        if (ready_sockets[i].socket_id == socket_id) {
+            ready_sockets[i].socket_id = INVALID_SOCKET_ID;
         }
     }
 
-    num_pollfds--;
-
     memset(&soc_map[socket_id], 0, sizeof(soc_map_t));
     soc_map[socket_id].socket_id = INVALID_SOCKET_ID;
 
@@ -361,16 +1069,64 @@ ind_soc_run_status_set(ind_soc_run_status_t s)
 static int
 find_next_timer_expiration(indigo_time_t now)
 {
-    int idx;
-    int next_ms = -1, elapsed, tmp_ms;
-    FOREACH_TIMER_EVENT(idx) {
-        elapsed = INDIGO_TIME_DIFF_ms(timer_event[idx].last_call, now);
-        tmp_ms = timer_event[idx].repeat_time_ms - elapsed; /* Time to next */
-        if (next_ms == -1 || tmp_ms < next_ms) {
-            next_ms = tmp_ms > 0 ? tmp_ms : 0;
-        }
+    int next_ms;
+
+    if (timer_heap_size == 0) {
+        return -1;
+    }
+
+    next_ms = INDIGO_TIME_DIFF_ms(now, timer_heap[0]->deadline);
+    return next_ms > 0 ? next_ms : 0;
+}
+
+/*
+ * Append expired timers with the given priority in the subheap rooted at
+ * idx to expired_timers.
+ */
+static void
+collect_expired_timers(int idx, indigo_time_t now, int priority)
+{
+    timer_event_t *timer;
+
+    if (idx >= timer_heap_size) {
+        return;
+    }
+
+    timer = timer_heap[idx];
+    if (!TIMER_EXPIRED(timer, now)) {
+        return;
     }
-    return next_ms;
+
+    if (timer->priority == priority) {
+        list_push(&expired_timers, &timer->expired_links);
+        timer->on_expired = 1;
+    }
+
+    collect_expired_timers(idx * 2 + 1, now, priority);
+    collect_expired_timers(idx * 2 + 2, now, priority);
+}
+
+/*
+ * Return the highest priority of the expired timers in the subheap rooted
+ * at idx, or the given priority if it is higher.
+ */
+static int
+highest_expired_timer_priority(int idx, indigo_time_t now, int priority)
+{
+    timer_event_t *timer;
+
+    if (idx >= timer_heap_size) {
+        return priority;
+    }
+
+    timer = timer_heap[idx];
+    if (!TIMER_EXPIRED(timer, now)) {
+        return priority;
+    }
+
+    priority = aim_imax(priority, timer->priority);
+    priority = highest_expired_timer_priority(idx * 2 + 1, now, priority);
+    return highest_expired_timer_priority(idx * 2 + 2, now, priority);
 }
 
 /*
@@ -379,41 +1135,48 @@ find_next_timer_expiration(indigo_time_t now)
 static void
 process_timers(int priority)
 {
-    int idx;
-    indigo_time_t now;
-    int elapsed, tmp_ms;
+    indigo_time_t now, deadline;
     ind_soc_timer_callback_f callback;
+    void *cookie;
 
     now = INDIGO_CURRENT_TIME;
 
-    FOREACH_TIMER_EVENT(idx) {
-        if(ind_soc_run_status__ == IND_SOC_RUN_STATUS_EXIT) {
-            break;
-        }
+    collect_expired_timers(0, now, priority);
 
-        if (timer_event[idx].priority != priority) {
-            continue;
-        }
+    /*
+     * Callbacks may register or unregister timers. Unregistering or
+     * re-registering a timer takes it off expired_timers.
+     */
+    while (!list_empty(&expired_timers)) {
+        timer_event_t *timer =
+            container_of(list_first(&expired_timers), expired_links, timer_event_t);
 
-        elapsed = INDIGO_TIME_DIFF_ms(timer_event[idx].last_call, now);
-        tmp_ms = timer_event[idx].repeat_time_ms - elapsed; /* Time to next */
-        if (tmp_ms <= 0) {
-            timer_event[idx].last_call = now;
+        list_remove(&timer->expired_links);
+        timer->on_expired = 0;
 
-            /* The callback may change its registration, so need to track
-             * current value if this is one-shot.
-             */
+        if(ind_soc_run_status__ == IND_SOC_RUN_STATUS_EXIT) {
+            continue;
+        }
 
-            callback = timer_event[idx].callback;
-            if (timer_event[idx].repeat_time_ms == IND_SOC_TIMER_IMMEDIATE) {
-                /* De-register one-shot immediate timers */
-                timer_event[idx].callback = NULL;
-            }
+        callback = timer->callback;
+        cookie = timer->cookie;
+        deadline = timer->deadline;
+        if (timer->repeat_time_ms == IND_SOC_TIMER_IMMEDIATE) {
+            /* De-register one-shot immediate timers */
+            timer_event_free(timer);
+        } else {
+            timer->deadline = now + timer->repeat_time_ms;
+            timer_heap_fix(timer->heap_index);
+        }
 
-            before_callback();
-            callback(timer_event[idx].cookie);
-            after_callback();
+        before_callback();
+        if (probe_enabled) {
+            probe_record(&probe_stats.timer_late,
+                         INDIGO_TIME_DIFF_ms(deadline, callback_start_time));
         }
+        callback(cookie);
+        after_callback(&probe_stats.timer_run, IND_SOC_PROFILE_TIMER,
+                       (void *)callback);
     }
 }
 
@@ -422,7 +1185,7 @@ ind_soc_timer_event_register_with_priority(
     ind_soc_timer_callback_f callback, void *cookie,
     int repeat_time_ms, int priority)
 {
-    int idx;
+    timer_event_t *timer;
 
     if (callback == NULL) {
         LOG_ERROR("Null callback for timer register");
@@ -433,22 +1196,36 @@ ind_soc_timer_event_register_with_priority(
         return INDIGO_ERROR_PARAM;
     }
     /* Allow re-registering which resets the timer */
-    if ((idx = timer_event_find(callback, cookie)) >= 0) {
+    if ((timer = timer_event_find(callback, cookie)) != NULL) {
         LOG_TRACE("Resetting event timer for %p to %d", callback, repeat_time_ms);
-        timer_event[idx].repeat_time_ms = repeat_time_ms;
-        timer_event[idx].last_call = INDIGO_CURRENT_TIME;
+        timer->repeat_time_ms = repeat_time_ms;
+        timer->deadline = INDIGO_CURRENT_TIME + repeat_time_ms;
+        timer_heap_fix(timer->heap_index);
+        if (timer->on_expired) {
+            list_remove(&timer->expired_links);
+            timer->on_expired = 0;
+        }
         return INDIGO_ERROR_NONE;
     }
-    if ((idx = timer_event_free_slot()) < 0) {
+
+    if ((timer = aim_zmalloc(sizeof(*timer))) == NULL) {
+        LOG_ERROR("No space for timer event %p, %p", callback, cookie);
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    timer->repeat_time_ms = repeat_time_ms;
+    timer->callback = callback;
+    timer->cookie = cookie;
+    timer->deadline = INDIGO_CURRENT_TIME + repeat_time_ms;
+    timer->priority = priority;
+
+    if (timer_heap_insert(timer) < 0) {
         LOG_ERROR("No space for timer event %p, %p", callback, cookie);
+        aim_free(timer);
         return INDIGO_ERROR_RESOURCE;
     }
 
-    timer_event[idx].repeat_time_ms = repeat_time_ms;
-    timer_event[idx].callback = callback;
-    timer_event[idx].cookie = cookie;
-    timer_event[idx].last_call = INDIGO_CURRENT_TIME;
-    timer_event[idx].priority = priority;
+    list_push(timer_hash_bucket(callback, cookie), &timer->hash_links);
 
     return INDIGO_ERROR_NONE;
 }
@@ -465,15 +1242,15 @@ ind_soc_timer_event_register(
 indigo_error_t
 ind_soc_timer_event_unregister(ind_soc_timer_callback_f callback, void *cookie)
 {
-    int idx;
+    timer_event_t *timer;
 
-    if ((idx = timer_event_find(callback, cookie)) < 0) {
+    if ((timer = timer_event_find(callback, cookie)) == NULL) {
         LOG_TRACE("Timer event %p, %p not found for unregister",
                   callback, cookie);
         return INDIGO_ERROR_NOT_FOUND;
     }
 
-    timer_event[idx].callback = NULL;
+    timer_event_free(timer);
 
     return INDIGO_ERROR_NONE;
 }
@@ -601,38 +1378,136 @@ indigo_error_t
 ind_soc_finish(void)
 {
     LOG_INFO("Shutting down socket manager");
+    soc_backend_finish();
     soc_mgr_init();
     init_done = 0;
 
     return INDIGO_ERROR_NONE;
 }
 
-/* Time since the current callback started */
-static indigo_time_t callback_start_time;
+/*
+ * Read the clock.  While the loop runs this also refreshes the time that
+ * INDIGO_CURRENT_TIME returns to callbacks.
+ */
+static indigo_time_t
+clock_read(void)
+{
+    return loop_running ? indigo_time_cache_update() : INDIGO_PRECISE_TIME;
+}
 
+/* The callback starts where the previous one, or the wait, ended */
 static void
 before_callback(void)
 {
     callback_start_time = INDIGO_CURRENT_TIME;
+    probe_last_yield_check = callback_start_time;
+    yield_check_time = callback_start_time;
+    yield_pending = 0;
+    if (profile_enabled) {
+        profile_start_us = profile_now_us();
+    }
 }
 
+/*
+ * run_time is where the probe records how long the callback took;
+ * kind and callback identify it to the profiler
+ */
 static void
-after_callback(void)
+after_callback(ind_soc_probe_latency_t *run_time,
+               ind_soc_profile_kind_t kind, void *callback)
 {
-    indigo_time_t elapsed =
-        INDIGO_TIME_DIFF_ms(callback_start_time, INDIGO_CURRENT_TIME);
-    if (elapsed >= SOCKETMANAGER_CONFIG_TIMESLICE_MS * 2) {
+    indigo_time_t now = clock_read();
+    indigo_time_t elapsed = INDIGO_TIME_DIFF_ms(callback_start_time, now);
+    /* Tasks may run for the idle timeslice when nothing else is pending */
+    int timeslice = probe_in_task ? SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS
+                                  : SOCKETMANAGER_CONFIG_TIMESLICE_MS;
+    if (elapsed >= timeslice * 2) {
         LOG_VERBOSE("Callback exceeded 2x timeslice (ran for %d ms, timeslice is %d ms)",
-                    (int)elapsed, SOCKETMANAGER_CONFIG_TIMESLICE_MS);
+                    (int)elapsed, timeslice);
+    }
+
+    if (probe_enabled) {
+        probe_record(run_time, elapsed);
+        if (probe_in_task) {
+            probe_record(&probe_stats.task_yield_gap,
+                         INDIGO_TIME_DIFF_ms(probe_last_yield_check, now));
+        }
+    }
+
+    /* profile_start_us is stale if the profiler was enabled mid-callback */
+    if (profile_enabled && profile_start_us != 0) {
+        profile_record(kind, callback, profile_now_us() - profile_start_us);
     }
+    profile_start_us = 0;
 }
 
+/*
+ * Whether a timer or socket the loop would run at the current priority is
+ * waiting
+ */
+static int
+soc_work_pending(indigo_time_t now)
+{
+    if (highest_expired_timer_priority(0, now, INT_MIN) >= loop_priority) {
+        return 1;
+    }
+
+    return soc_backend_pending(loop_priority);
+}
+
+/*
+ * A callback gets the short timeslice if other work is waiting and the
+ * idle timeslice if not. Past the short timeslice, pending work is looked
+ * for at most once a millisecond so a tight loop of calls stays cheap.
+ */
 int
 ind_soc_should_yield(void)
 {
-    indigo_time_t elapsed =
-        INDIGO_TIME_DIFF_ms(callback_start_time, INDIGO_CURRENT_TIME);
-    return elapsed >= SOCKETMANAGER_CONFIG_TIMESLICE_MS;
+    indigo_time_t now = clock_read();
+    indigo_time_t elapsed = INDIGO_TIME_DIFF_ms(callback_start_time, now);
+
+    if (probe_enabled && probe_in_task) {
+        probe_record(&probe_stats.task_yield_gap,
+                     INDIGO_TIME_DIFF_ms(probe_last_yield_check, now));
+        probe_last_yield_check = now;
+    }
+
+    if (elapsed < SOCKETMANAGER_CONFIG_TIMESLICE_MS) {
+        return 0;
+    }
+
+    if (elapsed >= SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS) {
+        return 1;
+    }
+
+    if (now != yield_check_time) {
+        yield_check_time = now;
+        yield_pending = soc_work_pending(now);
+    }
+
+    return yield_pending;
+}
+
+/*
+ * Note when each socket the last wait reported was first seen ready. A
+ * socket whose priority is not served stays ready, and keeps its time
+ * until it gets its callback.
+ */
+static void
+probe_ready_mark(void)
+{
+    int i;
+
+    probe_wait_end = INDIGO_CURRENT_TIME;
+    probe_wait_count++;
+
+    for (i = 0; i < num_ready_sockets; i++) {
+        soc_map_t *soc = &soc_map[ready_sockets[i].socket_id];
+        if (soc->probe_wait != probe_wait_count - 1) {
+            soc->probe_ready_since = probe_wait_end;
+        }
+        soc->probe_wait = probe_wait_count;
+    }
 }
 
 /*
@@ -642,26 +1517,41 @@ static void
 process_sockets(int priority)
 {
     int i;
-    for (i = 0; i < num_pollfds; i++) {
-        struct pollfd *pfd = &pollfds[i];
+    for (i = 0; i < num_ready_sockets; i++) {
+        soc_ready_t *ready = &ready_sockets[i];
+        int socket_id = ready->socket_id;
         int read_ready, write_ready, error_seen;
 
         if (ind_soc_run_status__ == IND_SOC_RUN_STATUS_EXIT) {
             break;
         }
 
-        if (soc_map[pfd->fd].priority != priority) {
+        if (socket_id == INVALID_SOCKET_ID ||
+                soc_map[socket_id].priority != priority) {
             continue;
         }
 
-        read_ready = (pfd->revents & POLLIN) != 0;
-        write_ready = (pfd->revents & POLLOUT) != 0;
-        error_seen = (pfd->revents & POLLERR) != 0;
+        read_ready = (ready->revents & POLLIN) != 0;
+        write_ready = (ready->revents & POLLOUT) != 0;
+        error_seen = (ready->revents & POLLERR) != 0;
         if (read_ready || write_ready || error_seen) {
+            /* The callback may unregister the socket */
+            ind_soc_socket_ready_callback_f callback = soc_map[socket_id].callback;
             before_callback();
-            soc_map[pfd->fd].callback(pfd->fd, soc_map[pfd->fd].cookie,
-                    read_ready, write_ready, error_seen);
-            after_callback();
+            if (probe_enabled && soc_map[socket_id].probe_wait == probe_wait_count) {
+                ind_soc_probe_latency_t *ready_latency = probe_socket_ready_find(priority);
+                if (ready_latency != NULL) {
+                    probe_record(ready_latency,
+                                 INDIGO_TIME_DIFF_ms(soc_map[socket_id].probe_ready_since,
+                                                     callback_start_time));
+                }
+                /* The next report starts a new interval */
+                soc_map[socket_id].probe_wait = 0;
+            }
+            callback(socket_id, soc_map[socket_id].cookie,
+                     read_ready, write_ready, error_seen);
+            after_callback(&probe_stats.socket_run, IND_SOC_PROFILE_SOCKET,
+                           (void *)callback);
         }
     }
 }
@@ -675,54 +1565,47 @@ process_tasks(int priority)
     struct list_links *cur, *next;
     LIST_FOREACH_SAFE(&tasks, cur, next) {
         ind_soc_task_t *task = container_of(cur, links, ind_soc_task_t);
+        ind_soc_task_callback_f callback = task->callback;
         if (task->priority < priority) {
             break;
         }
         before_callback();
-        if (task->callback(task->cookie) == IND_SOC_TASK_FINISHED) {
+        probe_in_task = 1;
+        if (callback(task->cookie) == IND_SOC_TASK_FINISHED) {
             list_remove(&task->links);
             aim_free(task);
         }
-        after_callback();
+        after_callback(&probe_stats.task_run, IND_SOC_PROFILE_TASK,
+                       (void *)callback);
+        probe_in_task = 0;
     }
 }
 
 /*
  * This function returns the priority level the event loop should process
- * on the current iteration. It assumes poll() has been called on the global
- * pollfds array.
+ * on the current iteration. It assumes soc_backend_wait() has filled the
+ * ready_sockets array.
  */
 static int
 find_highest_ready_priority(void)
 {
     int idx;
     indigo_time_t now;
-    int elapsed, tmp_ms;
     int priority = INT_MIN;
 
     now = INDIGO_CURRENT_TIME;
 
-    for (idx = 0; idx < num_pollfds; idx++) {
-        struct pollfd *pfd = &pollfds[idx];
+    for (idx = 0; idx < num_ready_sockets; idx++) {
+        int socket_id = ready_sockets[idx].socket_id;
 
-        if (pfd->revents == 0) {
+        if (socket_id == INVALID_SOCKET_ID) {
             continue;
         }
 
-        priority = aim_imax(priority, soc_map[pfd->fd].priority);
+        priority = aim_imax(priority, soc_map[socket_id].priority);
     }
 
-    FOREACH_TIMER_EVENT(idx) {
-        if (timer_event[idx].priority <= priority) {
-            continue;
-        }
-
-        elapsed = INDIGO_TIME_DIFF_ms(timer_event[idx].last_call, now);
-        tmp_ms = timer_event[idx].repeat_time_ms - elapsed; /* Time to next */
-        if (tmp_ms <= 0) {
-            priority = timer_event[idx].priority;
-        }
-    }
+    priority = highest_expired_timer_priority(0, now, priority);
 
     if (!list_empty(&tasks)) {
         ind_soc_task_t *task = container_of(tasks.links.next, links, ind_soc_task_t);
@@ -738,8 +1621,8 @@ find_highest_ready_priority(void)
  * If timeout < 0, block indefinitely; if timeout == 0, poll.
  */
 
-int
-ind_soc_select_and_run(int run_for_ms)
+static int
+select_and_run(int run_for_ms)
 {
     int rv;
     indigo_time_t start, current;
@@ -762,9 +1645,19 @@ ind_soc_select_and_run(int run_for_ms)
         timeout_ms = calculate_next_timeout(start, current,
                                             run_for_ms, next_timer_ms);
 
-        LOG_TRACE("polling %d fds, timeout %d ms", num_pollfds, timeout_ms);
-        rv = poll(pollfds, num_pollfds, timeout_ms);
+        if (probe_enabled && probe_wait_end != 0) {
+            probe_record(&probe_stats.loop_busy,
+                         INDIGO_TIME_DIFF_ms(probe_wait_end, INDIGO_CURRENT_TIME));
+        }
+
+        LOG_TRACE("polling %d fds, timeout %d ms", num_sockets, timeout_ms);
+        rv = soc_backend_wait(timeout_ms);
         LOG_TRACE("poll returned %d", rv);
+        clock_read();
+
+        if (probe_enabled) {
+            probe_ready_mark();
+        }
 
         if (rv < 0 && errno != EINTR) {
             LOG_ERROR("Error in poll: %s", strerror(errno));
@@ -773,6 +1666,7 @@ ind_soc_select_and_run(int run_for_ms)
 
         priority = find_highest_ready_priority();
         LOG_TRACE("processing priority %d", priority);
+        loop_priority = priority;
 
         process_sockets(priority);
         process_timers(priority);
@@ -788,3 +1682,20 @@ ind_soc_select_and_run(int run_for_ms)
 
     return INDIGO_ERROR_NONE;
 }
+
+/* INDIGO_CURRENT_TIME is served from the loop's clock reads until return */
+int
+ind_soc_select_and_run(int run_for_ms)
+{
+    int rv;
+
+    loop_running = 1;
+    clock_read();
+
+    rv = select_and_run(run_for_ms);
+
+    loop_running = 0;
+    indigo_time_cache_clear();
+
+    return rv;
+}
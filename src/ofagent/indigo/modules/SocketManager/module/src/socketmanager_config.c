@@ -79,10 +79,30 @@ socketmanager_config_settings_t socketmanager_config_settings[] =
 #else
 { SOCKETMANAGER_CONFIG_TIMESLICE_MS(__socketmanager_config_STRINGIFY_NAME), "__undefined__" },
 #endif
+#ifdef SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS
+    { __socketmanager_config_STRINGIFY_NAME(SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS), __socketmanager_config_STRINGIFY_VALUE(SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS) },
+#else
+{ SOCKETMANAGER_CONFIG_TIMESLICE_IDLE_MS(__socketmanager_config_STRINGIFY_NAME), "__undefined__" },
+#endif
 #ifdef SOCKETMANAGER_CONFIG_MAX_TIMERS
     { __socketmanager_config_STRINGIFY_NAME(SOCKETMANAGER_CONFIG_MAX_TIMERS), __socketmanager_config_STRINGIFY_VALUE(SOCKETMANAGER_CONFIG_MAX_TIMERS) },
 #else
 { SOCKETMANAGER_CONFIG_MAX_TIMERS(__socketmanager_config_STRINGIFY_NAME), "__undefined__" },
+#endif
+#ifdef SOCKETMANAGER_CONFIG_MAX_SOCKETS
+    { __socketmanager_config_STRINGIFY_NAME(SOCKETMANAGER_CONFIG_MAX_SOCKETS), __socketmanager_config_STRINGIFY_VALUE(SOCKETMANAGER_CONFIG_MAX_SOCKETS) },
+#else
+{ SOCKETMANAGER_CONFIG_MAX_SOCKETS(__socketmanager_config_STRINGIFY_NAME), "__undefined__" },
+#endif
+#ifdef SOCKETMANAGER_CONFIG_USE_EPOLL
+    { __socketmanager_config_STRINGIFY_NAME(SOCKETMANAGER_CONFIG_USE_EPOLL), __socketmanager_config_STRINGIFY_VALUE(SOCKETMANAGER_CONFIG_USE_EPOLL) },
+#else
+{ SOCKETMANAGER_CONFIG_USE_EPOLL(__socketmanager_config_STRINGIFY_NAME), "__undefined__" },
+#endif
+#ifdef SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE
+    { __socketmanager_config_STRINGIFY_NAME(SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE), __socketmanager_config_STRINGIFY_VALUE(SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE) },
+#else
+{ SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE(__socketmanager_config_STRINGIFY_NAME), "__undefined__" },
 #endif
     { NULL, NULL }
 };
@@ -149,7 +169,13 @@ ind_soc_cfg_commit(void)
     }
 }
 
+static const char * const ind_soc_cfg_paths[] = {
+    "logging.connection",
+    NULL
+};
+
 const struct ind_cfg_ops ind_soc_cfg_ops = {
     .stage = ind_soc_cfg_stage,
     .commit = ind_soc_cfg_commit,
+    .paths = ind_soc_cfg_paths,
 };
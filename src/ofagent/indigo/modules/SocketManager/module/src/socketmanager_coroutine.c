@@ -0,0 +1,242 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/******************************************************************************
+ *
+ * Coroutines
+ *
+ * Each coroutine is driven by an ordinary task. The task callback switches
+ * to the coroutine's stack with swapcontext(3) and the coroutine switches
+ * back when it yields, waits or finishes. A yield leaves the task
+ * registered so it runs again in its turn; a wait finishes the task and
+ * ind_soc_coroutine_wake registers a new one. Since coroutines only run
+ * inside task callbacks, ind_soc_should_yield and the latency probe work
+ * in them as in any task.
+ *
+ * Stacks are mmap'd with a guard page below them, so an overflow faults
+ * instead of corrupting the heap, and a few are kept for reuse.
+ *
+ * See header file for detailed function documentation.
+ *
+ *****************************************************************************/
+
+#include "socketmanager_log.h"
+#include "socketmanager_int.h"
+
+#include <SocketManager/socketmanager.h>
+
+#include <indigo/assert.h>
+#include <indigo/memory.h>
+#include <AIM/aim.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdbool.h>
+
+/* Stacks kept after their coroutine finishes */
+#define COROUTINE_STACK_CACHE 4
+
+struct ind_soc_coroutine_s {
+    ucontext_t context;        /* The coroutine's saved registers */
+    ucontext_t caller;         /* The task callback that resumed it */
+    ind_soc_coroutine_f func;
+    void *cookie;
+    int priority;
+    void *stack;               /* Mapping, starting with the guard page */
+    bool waiting;              /* In ind_soc_coroutine_wait; no task */
+    bool wake_pending;         /* Woken while not waiting */
+    bool finished;
+};
+
+static ind_soc_coroutine_t *current_coroutine;
+static int coroutine_count;
+static void *stack_cache[COROUTINE_STACK_CACHE];
+static int stack_cache_count;
+
+static size_t
+stack_mapping_size(void)
+{
+    return SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE + getpagesize();
+}
+
+static void *
+stack_alloc(void)
+{
+    void *stack;
+
+    if (stack_cache_count > 0) {
+        return stack_cache[--stack_cache_count];
+    }
+
+    stack = mmap(NULL, stack_mapping_size(), PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (stack == MAP_FAILED) {
+        return NULL;
+    }
+
+    if (mprotect(stack, getpagesize(), PROT_NONE) < 0) {
+        munmap(stack, stack_mapping_size());
+        return NULL;
+    }
+
+    return stack;
+}
+
+static void
+stack_free(void *stack)
+{
+    if (stack_cache_count < COROUTINE_STACK_CACHE) {
+        stack_cache[stack_cache_count++] = stack;
+    } else {
+        munmap(stack, stack_mapping_size());
+    }
+}
+
+/* First frame on the coroutine's stack; returns through uc_link */
+static void
+coroutine_entry(void)
+{
+    ind_soc_coroutine_t *co = current_coroutine;
+
+    co->func(co->cookie);
+    co->finished = true;
+}
+
+static ind_soc_task_status_t
+coroutine_task(void *cookie)
+{
+    ind_soc_coroutine_t *co = cookie;
+    ind_soc_coroutine_t *prev = current_coroutine;
+
+    current_coroutine = co;
+    AIM_TRUE_OR_DIE(swapcontext(&co->caller, &co->context) == 0);
+    current_coroutine = prev;
+
+    if (co->finished) {
+        stack_free(co->stack);
+        aim_free(co);
+        coroutine_count--;
+        return IND_SOC_TASK_FINISHED;
+    }
+
+    if (co->waiting) {
+        return IND_SOC_TASK_FINISHED;
+    }
+
+    return IND_SOC_TASK_CONTINUE;
+}
+
+/* Switch back to coroutine_task */
+static void
+coroutine_suspend(ind_soc_coroutine_t *co)
+{
+    AIM_TRUE_OR_DIE(swapcontext(&co->context, &co->caller) == 0);
+}
+
+indigo_error_t
+ind_soc_coroutine_spawn(ind_soc_coroutine_f func, void *cookie, int priority)
+{
+    ind_soc_coroutine_t *co;
+    indigo_error_t rv;
+
+    co = aim_zmalloc(sizeof(*co));
+    co->func = func;
+    co->cookie = cookie;
+    co->priority = priority;
+
+    co->stack = stack_alloc();
+    if (co->stack == NULL) {
+        AIM_LOG_ERROR("Failed to allocate coroutine stack");
+        aim_free(co);
+        return INDIGO_ERROR_RESOURCE;
+    }
+
+    AIM_TRUE_OR_DIE(getcontext(&co->context) == 0);
+    co->context.uc_stack.ss_sp = (char *)co->stack + getpagesize();
+    co->context.uc_stack.ss_size = SOCKETMANAGER_CONFIG_COROUTINE_STACK_SIZE;
+    co->context.uc_link = &co->caller;
+    makecontext(&co->context, coroutine_entry, 0);
+
+    rv = ind_soc_task_register(coroutine_task, co, priority);
+    if (rv != INDIGO_ERROR_NONE) {
+        stack_free(co->stack);
+        aim_free(co);
+        return rv;
+    }
+
+    coroutine_count++;
+
+    return INDIGO_ERROR_NONE;
+}
+
+ind_soc_coroutine_t *
+ind_soc_coroutine_self(void)
+{
+    INDIGO_ASSERT(current_coroutine != NULL);
+    return current_coroutine;
+}
+
+void
+ind_soc_coroutine_yield(void)
+{
+    coroutine_suspend(ind_soc_coroutine_self());
+}
+
+void
+ind_soc_coroutine_maybe_yield(void)
+{
+    if (ind_soc_should_yield()) {
+        ind_soc_coroutine_yield();
+    }
+}
+
+void
+ind_soc_coroutine_wait(void)
+{
+    ind_soc_coroutine_t *co = ind_soc_coroutine_self();
+
+    if (co->wake_pending) {
+        co->wake_pending = false;
+        return;
+    }
+
+    co->waiting = true;
+    coroutine_suspend(co);
+}
+
+void
+ind_soc_coroutine_wake(void *coroutine)
+{
+    ind_soc_coroutine_t *co = coroutine;
+
+    if (!co->waiting) {
+        co->wake_pending = true;
+        return;
+    }
+
+    co->waiting = false;
+    AIM_TRUE_OR_DIE(ind_soc_task_register(coroutine_task, co,
+                                          co->priority) == INDIGO_ERROR_NONE);
+}
+
+int
+ind_soc_coroutine_count(void)
+{
+    return coroutine_count;
+}
@@ -33,7 +33,14 @@
 #include <SocketManager/socketmanager_config.h>
 #include <SocketManager/socketmanager.h>
 #include <cjson/cJSON.h>
+#include <AIM/aim_pvs.h>
 
 extern const struct ind_cfg_ops ind_soc_cfg_ops;
 
+/* Print the latency probe results */
+void ind_soc_probe_stats_show(aim_pvs_t *pvs);
+
+/* Print the callback profile for the top 'count' functions */
+void ind_soc_profile_show(aim_pvs_t *pvs, int count);
+
 #endif /* __SOCKETMANAGER_INT_H__ */
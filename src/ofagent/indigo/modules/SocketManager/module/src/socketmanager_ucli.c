@@ -33,6 +33,9 @@
 #include <uCli/ucli.h>
 #include <uCli/ucli_argparse.h>
 #include <uCli/ucli_handler_macros.h>
+#include <SocketManager/socketmanager.h>
+#include <string.h>
+#include "socketmanager_int.h"
 
 
 
@@ -47,6 +50,68 @@ socketmanager_ucli_ucli__config__(ucli_context_t* uc)
     return UCLI_STATUS_OK;
 }
 
+static ucli_status_t
+socketmanager_ucli_ucli__probe__(ucli_context_t* uc)
+{
+    char *str;
+
+    UCLI_COMMAND_INFO(uc,
+                      "probe", -1,
+                      "$summary#Show or control the event loop latency probe."
+                      "$args#[enable|disable|clear]");
+    if (uc->pargs->count == 1) {
+        UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+        if (!strcmp(str, "enable")) {
+            ind_soc_probe_enable_set(1);
+        } else if (!strcmp(str, "disable")) {
+            ind_soc_probe_enable_set(0);
+        } else if (!strcmp(str, "clear")) {
+            ind_soc_probe_stats_clear();
+        } else {
+            return UCLI_STATUS_E_ARG;
+        }
+        return UCLI_STATUS_OK;
+    } else if (uc->pargs->count > 1) {
+        return UCLI_STATUS_E_ARG;
+    }
+
+    ind_soc_probe_stats_show(&uc->pvs);
+
+    return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+socketmanager_ucli_ucli__profile__(ucli_context_t* uc)
+{
+    char *str;
+    int count = 20;
+
+    UCLI_COMMAND_INFO(uc,
+                      "profile", -1,
+                      "$summary#Show the callbacks using the most event loop time, or control the profiler."
+                      "$args#[enable|disable|clear|<count>]");
+    if (uc->pargs->count == 1) {
+        UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+        if (!strcmp(str, "enable")) {
+            ind_soc_profile_enable_set(1);
+            return UCLI_STATUS_OK;
+        } else if (!strcmp(str, "disable")) {
+            ind_soc_profile_enable_set(0);
+            return UCLI_STATUS_OK;
+        } else if (!strcmp(str, "clear")) {
+            ind_soc_profile_clear();
+            return UCLI_STATUS_OK;
+        }
+        UCLI_ARGPARSE_OR_RETURN(uc, "i", &count);
+    } else if (uc->pargs->count > 1) {
+        return UCLI_STATUS_E_ARG;
+    }
+
+    ind_soc_profile_show(&uc->pvs, count);
+
+    return UCLI_STATUS_OK;
+}
+
 static ucli_status_t
 socketmanager_ucli_ucli__foo__(ucli_context_t* uc)
 {
@@ -69,6 +134,8 @@ socketmanager_ucli_ucli__foo__(ucli_context_t* uc)
 static ucli_command_handler_f socketmanager_ucli_ucli_handlers__[] =
 {
     socketmanager_ucli_ucli__config__,
+    socketmanager_ucli_ucli__probe__,
+    socketmanager_ucli_ucli__profile__,
     socketmanager_ucli_ucli__foo__,
     NULL
 };
@@ -275,6 +275,67 @@ test_socket_mgmt(void)
     close(fds[1]);
 }
 
+/* Unregisters the peer socket passed in cookie on the first callback */
+static int unregister_peer_calls;
+
+static void
+socket_callback_unregister_peer(
+    int socket_id,
+    void *cookie,
+    int read_ready,
+    int write_ready,
+    int error_seen)
+{
+    int *peer = cookie;
+    char buf;
+
+    unregister_peer_calls++;
+    if (read_ready && read(socket_id, &buf, 1) != 1) {
+        perror("read");
+        abort();
+    }
+    if (*peer >= 0) {
+        INDIGO_ASSERT(ind_soc_socket_unregister(*peer) == 0);
+        *peer = -1;
+    }
+}
+
+static void
+test_socket_unregister_ready(void)
+{
+    int fds[2];
+    int peers[2];
+
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+        perror("socketpair");
+        abort();
+    }
+
+    /* Make both ends readable */
+    if (write(fds[0], "x", 1) != 1 || write(fds[1], "x", 1) != 1) {
+        perror("write");
+        abort();
+    }
+
+    /* Whichever callback runs first unregisters the other socket */
+    peers[0] = fds[1];
+    peers[1] = fds[0];
+    INDIGO_ASSERT(ind_soc_socket_register(fds[0], socket_callback_unregister_peer, &peers[0]) == 0);
+    INDIGO_ASSERT(ind_soc_socket_register(fds[1], socket_callback_unregister_peer, &peers[1]) == 0);
+
+    unregister_peer_calls = 0;
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(unregister_peer_calls == 1);
+
+    if (peers[0] == -1) {
+        INDIGO_ASSERT(ind_soc_socket_unregister(fds[0]) == 0);
+    } else {
+        INDIGO_ASSERT(ind_soc_socket_unregister(fds[1]) == 0);
+    }
+
+    close(fds[0]);
+    close(fds[1]);
+}
 
 static void
 timer_callback(void *cookie)
@@ -349,6 +410,42 @@ test_immediate_timer(void)
     INDIGO_ASSERT(ind_soc_timer_event_unregister(timer_callback, &count) < 0);
 }
 
+/* Unregisters the other of the two timers whose cookies are in peer_timers */
+static int peer_timers[2];
+static int peer_timer_calls;
+
+static void
+timer_callback_unregister_peer(void *cookie)
+{
+    int *self = cookie;
+    int *peer = (self == &peer_timers[0]) ? &peer_timers[1] : &peer_timers[0];
+
+    peer_timer_calls++;
+    ind_soc_timer_event_unregister(timer_callback_unregister_peer, self);
+    INDIGO_ASSERT(ind_soc_timer_event_unregister(
+        timer_callback_unregister_peer, peer) == 0);
+}
+
+static void
+test_timer_unregister_expired(void)
+{
+    /* Both expire on the same pass; the first to fire cancels the other */
+    INDIGO_ASSERT(ind_soc_timer_event_register(
+        timer_callback_unregister_peer, &peer_timers[0], 1) == 0);
+    INDIGO_ASSERT(ind_soc_timer_event_register(
+        timer_callback_unregister_peer, &peer_timers[1], 1) == 0);
+
+    usleep(5000);
+    peer_timer_calls = 0;
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(peer_timer_calls == 1);
+
+    INDIGO_ASSERT(ind_soc_timer_event_unregister(
+        timer_callback_unregister_peer, &peer_timers[0]) < 0);
+    INDIGO_ASSERT(ind_soc_timer_event_unregister(
+        timer_callback_unregister_peer, &peer_timers[1]) < 0);
+}
+
 static void
 test_timer_mgmt(void)
 {
@@ -375,27 +472,30 @@ test_timer_mgmt(void)
     /* Should be able to register and unregister a bunch of timers */
     {
         int i, j;
+        const int num_timers = SOCKETMANAGER_CONFIG_MAX_TIMERS * 20;
 
-        for (i = 0; 1; i++) {
-            indigo_error_t err = ind_soc_timer_event_register(
-                timer_callback, (void *)(uintptr_t)i, 100);
-            if (err < 0) {
-                INDIGO_ASSERT(err == INDIGO_ERROR_RESOURCE);
-                break;
-            }
+        for (i = 0; i < num_timers; i++) {
+            INDIGO_ASSERT(ind_soc_timer_event_register(
+                timer_callback, (void *)(uintptr_t)i, 100 + (i * 7919) % 1000) == 0);
         }
 
-        for (j = 0; 1; j++) {
-            indigo_error_t err = ind_soc_timer_event_unregister(
-                timer_callback, (void *)(uintptr_t)j);
-            if (err < 0) {
-                INDIGO_ASSERT(err == INDIGO_ERROR_NOT_FOUND);
-                break;
-            }
+        /* Unregister in a different order than registration */
+        for (j = 1; j < num_timers; j += 2) {
+            INDIGO_ASSERT(ind_soc_timer_event_unregister(
+                timer_callback, (void *)(uintptr_t)j) == 0);
+        }
+        for (j = num_timers - 2; j >= 0; j -= 2) {
+            INDIGO_ASSERT(ind_soc_timer_event_unregister(
+                timer_callback, (void *)(uintptr_t)j) == 0);
         }
 
-        INDIGO_ASSERT(i == j);
-        INDIGO_ASSERT(i >= 16);
+        for (j = 0; j < num_timers; j++) {
+            INDIGO_ASSERT(ind_soc_timer_event_unregister(
+                timer_callback, (void *)(uintptr_t)j) == INDIGO_ERROR_NOT_FOUND);
+        }
+
+        /* Nothing left to fire */
+        INDIGO_ASSERT(ind_soc_select_and_run(0) == 0);
     }
 }
 
@@ -476,7 +576,7 @@ test_task(void)
     INDIGO_ASSERT(counters[0] == 0);
     INDIGO_ASSERT(counters[1] == 0);
 
-    /* Task should yield after 10 ms */
+    /* Task should yield after 50 ms when nothing else is pending */
     INDIGO_ASSERT(ind_soc_task_register(task_callback_yield, &counters[0], 0) == INDIGO_ERROR_NONE);
     memset(counters, 0, sizeof(counters));
     i = 0;
@@ -485,11 +585,42 @@ test_task(void)
         tmp = counters[0];
         ind_soc_select_and_run(0);
         tmp = counters[0] - tmp;
-        INDIGO_ASSERT(tmp <= 10); /* 10 ms/timeslice / 1+ ms/unit <= 10 units/timeslice */
+        INDIGO_ASSERT(tmp <= 50); /* 50 ms/timeslice / 1+ ms/unit <= 50 units/timeslice */
         i++;
     }
-    INDIGO_ASSERT(i >= 10); /* (100 units * 1+ ms/unit) / 10 ms/timeslice >= 10 timeslices */
-    INDIGO_ASSERT(100 / i >= 5); /* average at least 5 units per timeslice */
+    INDIGO_ASSERT(i >= 2); /* (100 units * 1+ ms/unit) / 50 ms/timeslice >= 2 timeslices */
+    INDIGO_ASSERT(100 / i >= 25); /* average at least 25 units per timeslice */
+
+    /* Task should yield after 10 ms while a socket is ready */
+    {
+        int fds[2];
+        struct sock_counters sock_counters;
+        char buf[100];
+
+        memset(buf, 'x', sizeof(buf));
+        INDIGO_ASSERT(pipe(fds) == 0);
+        INDIGO_ASSERT(write(fds[1], buf, sizeof(buf)) == sizeof(buf));
+        memset(&sock_counters, 0, sizeof(sock_counters));
+        INDIGO_ASSERT(ind_soc_socket_register(fds[0], socket_callback, &sock_counters) == 0);
+
+        INDIGO_ASSERT(ind_soc_task_register(task_callback_yield, &counters[0], 0) == INDIGO_ERROR_NONE);
+        memset(counters, 0, sizeof(counters));
+        i = 0;
+        while (counters[0] < 100) {
+            int tmp;
+            tmp = counters[0];
+            ind_soc_select_and_run(0);
+            tmp = counters[0] - tmp;
+            INDIGO_ASSERT(tmp <= 10); /* 10 ms/timeslice / 1+ ms/unit <= 10 units/timeslice */
+            i++;
+        }
+        INDIGO_ASSERT(i >= 10); /* (100 units * 1+ ms/unit) / 10 ms/timeslice >= 10 timeslices */
+        INDIGO_ASSERT(sock_counters.read == i);
+
+        INDIGO_ASSERT(ind_soc_socket_unregister(fds[0]) == 0);
+        close(fds[0]);
+        close(fds[1]);
+    }
 
     /* Excessively long callback should trigger a warning (not checked) */
     INDIGO_ASSERT(ind_soc_task_register(task_callback_long, &counters[0], 0) == INDIGO_ERROR_NONE);
@@ -641,6 +772,260 @@ test_priority(void)
     }
 }
 
+static ind_soc_probe_latency_t *
+probe_socket_ready(ind_soc_probe_stats_t *stats, int priority)
+{
+    int i;
+    for (i = 0; i < stats->num_priorities; i++) {
+        if (stats->priorities[i].priority == priority) {
+            return &stats->priorities[i].socket_ready;
+        }
+    }
+    return NULL;
+}
+
+static void
+test_probe(void)
+{
+    int read_fds[2], write_fds[2];
+    struct sock_counters counters[2];
+    ind_soc_probe_stats_t stats;
+    int timer_count = 0, task_count = 0;
+    int i;
+
+    for (i = 0; i < 2; i++) {
+        int fds[2];
+        if (pipe(fds) < 0) {
+            perror("pipe");
+            abort();
+        }
+        read_fds[i] = fds[0];
+        write_fds[i] = fds[1];
+    }
+
+    INDIGO_ASSERT(ind_soc_probe_enable_get() == 0);
+    ind_soc_probe_stats_clear();
+    ind_soc_probe_enable_set(1);
+
+    INDIGO_ASSERT(ind_soc_socket_register_with_priority(
+        read_fds[0], socket_callback, &counters[0], 1) == 0);
+    INDIGO_ASSERT(ind_soc_socket_register_with_priority(
+        read_fds[1], socket_callback, &counters[1], -1) == 0);
+
+    /* A 100 ms task that never checks for yield holds up the low priority socket */
+    memset(counters, 0, sizeof(counters));
+    INDIGO_ASSERT(ind_soc_task_register(task_callback_long, &task_count, 1) == 0);
+    for (i = 0; i < 2; i++) {
+        write(write_fds[i], "x", 1);
+    }
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(counters[0].read == 1 && counters[1].read == 0);
+    INDIGO_ASSERT(task_count == 1);
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(counters[1].read == 1);
+
+    ind_soc_probe_stats_get(&stats);
+    INDIGO_ASSERT(stats.task_run.count == 1 && stats.task_run.max_ms >= 90);
+    INDIGO_ASSERT(stats.task_yield_gap.count == 1 && stats.task_yield_gap.max_ms >= 90);
+    INDIGO_ASSERT(stats.socket_run.count == 2);
+    INDIGO_ASSERT(stats.loop_busy.max_ms >= 90);
+    INDIGO_ASSERT(stats.num_priorities == 2);
+    INDIGO_ASSERT(probe_socket_ready(&stats, 1)->count == 1);
+    INDIGO_ASSERT(probe_socket_ready(&stats, 1)->max_ms < 90);
+    INDIGO_ASSERT(probe_socket_ready(&stats, -1)->count == 1);
+    INDIGO_ASSERT(probe_socket_ready(&stats, -1)->max_ms >= 90);
+
+    /* A timer run 50 ms after its deadline is counted as late */
+    ind_soc_probe_stats_clear();
+    INDIGO_ASSERT(ind_soc_timer_event_register(timer_callback, &timer_count, 10) == 0);
+    usleep(60 * 1000);
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(timer_count == 1);
+    ind_soc_probe_stats_get(&stats);
+    INDIGO_ASSERT(stats.timer_late.count == 1 && stats.timer_late.max_ms >= 40);
+    INDIGO_ASSERT(stats.timer_run.count == 1);
+
+    /* Nothing is recorded while disabled */
+    ind_soc_probe_enable_set(0);
+    usleep(20 * 1000);
+    ind_soc_select_and_run(0);
+    ind_soc_probe_stats_get(&stats);
+    INDIGO_ASSERT(stats.timer_late.count == 1);
+    INDIGO_ASSERT(ind_soc_timer_event_unregister(timer_callback, &timer_count) == 0);
+
+    for (i = 0; i < 2; i++) {
+        INDIGO_ASSERT(ind_soc_socket_unregister(read_fds[i]) == 0);
+        close(read_fds[i]);
+        close(write_fds[i]);
+    }
+}
+
+static void
+test_profile(void)
+{
+    ind_soc_profile_entry_t entries[IND_SOC_PROFILE_CALLBACKS];
+    uint64_t dropped;
+    int timer_count = 0, task_count = 0;
+    int n;
+
+    INDIGO_ASSERT(ind_soc_profile_enable_get() == 0);
+    ind_soc_profile_clear();
+    ind_soc_profile_enable_set(1);
+
+    INDIGO_ASSERT(ind_soc_task_register(task_callback_long, &task_count, 0) == 0);
+    INDIGO_ASSERT(ind_soc_timer_event_register(timer_callback, &timer_count, 10) == 0);
+    usleep(20 * 1000);
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(task_count == 1 && timer_count == 1);
+    INDIGO_ASSERT(ind_soc_timer_event_unregister(timer_callback, &timer_count) == 0);
+
+    /* The long task sorts first */
+    n = ind_soc_profile_get(entries, IND_SOC_PROFILE_CALLBACKS, &dropped);
+    INDIGO_ASSERT(n == 2 && dropped == 0);
+    INDIGO_ASSERT(entries[0].callback == (void *)task_callback_long);
+    INDIGO_ASSERT(entries[0].kind == IND_SOC_PROFILE_TASK);
+    INDIGO_ASSERT(entries[0].count == 1 && entries[0].max_us >= 90000);
+    INDIGO_ASSERT(entries[1].callback == (void *)timer_callback);
+    INDIGO_ASSERT(entries[1].kind == IND_SOC_PROFILE_TIMER);
+    INDIGO_ASSERT(entries[1].count == 1);
+    INDIGO_ASSERT(ind_soc_profile_get(entries, 1, NULL) == 1);
+
+    /* Nothing is recorded while disabled */
+    ind_soc_profile_enable_set(0);
+    INDIGO_ASSERT(ind_soc_task_register(task_callback_long, &task_count, 0) == 0);
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(task_count == 2);
+    ind_soc_profile_get(entries, IND_SOC_PROFILE_CALLBACKS, NULL);
+    INDIGO_ASSERT(entries[0].count == 1);
+
+    ind_soc_profile_clear();
+    INDIGO_ASSERT(ind_soc_profile_get(entries, IND_SOC_PROFILE_CALLBACKS, NULL) == 0);
+}
+
+struct coroutine_state {
+    int steps;
+    int deep;
+    int spins;
+    ind_soc_coroutine_t *self;
+};
+
+/* Suspends below its first frame, keeping its locals */
+static void
+coroutine_nested(struct coroutine_state *state, int depth)
+{
+    int local = depth * 10;
+
+    if (depth > 0) {
+        coroutine_nested(state, depth - 1);
+    } else {
+        ind_soc_coroutine_yield();
+    }
+
+    INDIGO_ASSERT(local == depth * 10);
+    state->deep++;
+}
+
+static void
+coroutine_body(void *cookie)
+{
+    struct coroutine_state *state = cookie;
+
+    state->self = ind_soc_coroutine_self();
+    state->steps++;
+    ind_soc_coroutine_yield();
+
+    state->steps++;
+    coroutine_nested(state, 3);
+
+    /* A wake before the wait is not lost */
+    ind_soc_coroutine_wake(state->self);
+    ind_soc_coroutine_wait();
+    state->steps++;
+
+    ind_soc_coroutine_wait();
+    state->steps++;
+
+    while (state->spins < 100) {
+        usleep(1000);
+        state->spins++;
+        ind_soc_coroutine_maybe_yield();
+    }
+}
+
+static void
+test_coroutine(void)
+{
+    struct coroutine_state state;
+    int i;
+
+    memset(&state, 0, sizeof(state));
+    INDIGO_ASSERT(ind_soc_coroutine_spawn(coroutine_body, &state, 0) == INDIGO_ERROR_NONE);
+    INDIGO_ASSERT(ind_soc_coroutine_count() == 1);
+    INDIGO_ASSERT(state.steps == 0);
+
+    /* Runs to the first yield */
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(state.steps == 1);
+
+    /* Yields from a nested call, then resumes it */
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(state.steps == 2 && state.deep == 0);
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(state.deep == 4 && state.steps == 3);
+
+    /* Waiting; nothing runs until woken */
+    for (i = 0; i < 3; i++) {
+        ind_soc_select_and_run(0);
+    }
+    INDIGO_ASSERT(state.steps == 3);
+    ind_soc_coroutine_wake(state.self);
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(state.steps == 4);
+
+    /* Yields each idle timeslice, as a task would */
+    i = 0;
+    while (ind_soc_coroutine_count() > 0) {
+        ind_soc_select_and_run(0);
+        i++;
+    }
+    INDIGO_ASSERT(state.spins == 100);
+    INDIGO_ASSERT(i >= 2);
+}
+
+static ind_soc_task_status_t
+task_callback_time(void *cookie)
+{
+    int *count_ptr = cookie;
+    indigo_time_t start = INDIGO_CURRENT_TIME;
+
+    /* The cached time stands still until the loop reads the clock */
+    usleep(5000);
+    INDIGO_ASSERT(INDIGO_CURRENT_TIME == start);
+    INDIGO_ASSERT(INDIGO_TIME_DIFF_ms(start, INDIGO_PRECISE_TIME) >= 5);
+
+    ind_soc_should_yield();
+    INDIGO_ASSERT(INDIGO_TIME_DIFF_ms(start, INDIGO_CURRENT_TIME) >= 5);
+
+    (*count_ptr)++;
+    return IND_SOC_TASK_FINISHED;
+}
+
+static void
+test_time_cache(void)
+{
+    int count = 0;
+    indigo_time_t before;
+
+    INDIGO_ASSERT(ind_soc_task_register(task_callback_time, &count, 0) == INDIGO_ERROR_NONE);
+    ind_soc_select_and_run(0);
+    INDIGO_ASSERT(count == 1);
+
+    /* Outside the loop the clock is read */
+    before = INDIGO_CURRENT_TIME;
+    usleep(5000);
+    INDIGO_ASSERT(INDIGO_TIME_DIFF_ms(before, INDIGO_CURRENT_TIME) >= 5);
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -651,10 +1036,16 @@ main(int argc, char* argv[])
     test_timer_mgmt();
     test_periodic_timer();
     test_immediate_timer();
+    test_timer_unregister_expired();
     test_socket();
     test_socket_mgmt();
+    test_socket_unregister_ready();
     test_task();
+    test_coroutine();
+    test_time_cache();
     test_priority();
+    test_probe();
+    test_profile();
 
     return 0;
 }
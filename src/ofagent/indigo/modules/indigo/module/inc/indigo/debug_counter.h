@@ -0,0 +1,125 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Named 64-bit debug counters
+ *
+ * Any module may register counters here. The registered counters are
+ * listed and read in bulk by the BSN debug counter multipart messages.
+ *
+ * A counter is owned by the module that registers it, usually as a
+ * static variable, and must stay registered until it is freed.
+ * Registration, unregistration and reads happen on the event loop
+ * thread. debug_counter_inc and debug_counter_add may be called from any
+ * thread.
+ *
+ * Counter IDs are assigned at registration, increasing from 1, and are
+ * not reused. Names are dotted, like "core.flow_mods".
+ */
+
+#ifndef _INDIGO_DEBUG_COUNTER_H_
+#define _INDIGO_DEBUG_COUNTER_H_
+
+#include <stdint.h>
+#include <AIM/aim_list.h>
+
+typedef struct debug_counter_s debug_counter_t;
+
+/**
+ * Read the value of a counter kept elsewhere
+ */
+typedef uint64_t (*debug_counter_get_f)(debug_counter_t *counter);
+
+struct debug_counter_s {
+    list_links_t links;
+    uint64_t counter_id;
+    const char *name;
+    const char *description;
+    uint64_t value;
+    debug_counter_get_f get;    /* NULL to report value */
+    void *cookie;               /* For the get function */
+};
+
+/**
+ * Register a counter
+ *
+ * @param counter Counter to register; its value is not changed
+ * @param name Name of the counter, at most 63 characters
+ * @param description Description, at most 255 characters
+ *
+ * The name and description are not copied.
+ */
+
+void debug_counter_register(debug_counter_t *counter,
+                            const char *name, const char *description);
+
+/**
+ * Register a counter whose value is read by a function
+ *
+ * For values already maintained by other means, such as a field of
+ * a status struct.
+ */
+
+void debug_counter_register_get(debug_counter_t *counter,
+                                const char *name, const char *description,
+                                debug_counter_get_f get, void *cookie);
+
+/**
+ * Unregister a counter
+ *
+ * Does nothing if the counter is not registered.
+ */
+
+void debug_counter_unregister(debug_counter_t *counter);
+
+/**
+ * List of registered counters, in registration order
+ *
+ * Iterate with LIST_FOREACH and container_of on the links field.
+ */
+
+list_head_t *debug_counter_list(void);
+
+static inline void
+debug_counter_add(debug_counter_t *counter, uint64_t amount)
+{
+    __atomic_fetch_add(&counter->value, amount, __ATOMIC_RELAXED);
+}
+
+static inline void
+debug_counter_inc(debug_counter_t *counter)
+{
+    debug_counter_add(counter, 1);
+}
+
+/**
+ * Current value of a counter
+ */
+
+static inline uint64_t
+debug_counter_get(debug_counter_t *counter)
+{
+    if (counter->get) {
+        return counter->get(counter);
+    }
+    return __atomic_load_n(&counter->value, __ATOMIC_RELAXED);
+}
+
+#endif /* _INDIGO_DEBUG_COUNTER_H_ */
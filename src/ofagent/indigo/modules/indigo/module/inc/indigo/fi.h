@@ -84,6 +84,9 @@ typedef struct indigo_fi_vlan_stats {
  * @brief Port statistics counters
  *
  * Should be set to -1 if not supported.
+ *
+ * The rates are per second over the last rate_interval_ms, measured
+ * rate_age_ms ago, for implementations that sample counters themselves.
  */
 
 typedef struct indigo_fi_port_stats {
@@ -99,6 +102,14 @@ typedef struct indigo_fi_port_stats {
     uint64_t tx_packets_multicast;
     uint64_t tx_dropped;
     uint64_t tx_errors;
+    uint64_t rx_packets_rate;
+    uint64_t rx_bits_rate;
+    uint64_t rx_errors_rate;
+    uint64_t tx_packets_rate;
+    uint64_t tx_bits_rate;
+    uint64_t tx_errors_rate;
+    uint64_t rate_interval_ms;
+    uint64_t rate_age_ms;
 } indigo_fi_port_stats_t;
 
 #endif /* _INDIGO_FI_H_ */
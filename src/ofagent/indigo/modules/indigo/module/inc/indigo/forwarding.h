@@ -64,6 +64,12 @@ extern indigo_error_t indigo_fwd_forwarding_features_get(
  *
  * Ownership of the flow_add LOXI object is maintained by the
  * caller (OF state manager).
+ *
+ * The forwarding engine may defer programming the flow and return
+ * INDIGO_ERROR_PENDING. It must then report the result through
+ * indigo_core_flow_create_done no later than the next call to
+ * indigo_fwd_pending_flush. Until then, modify, delete and stats calls
+ * for the flow refer to the deferred add.
  */
 
 extern indigo_error_t indigo_fwd_flow_create(
@@ -91,15 +97,31 @@ extern indigo_error_t indigo_fwd_flow_modify(
 /**
  * @brief Flow delete
  * @param flow_id Flow identifier
- * @param [out] flow_stats Statistics for flow
+ * @param [out] flow_stats Final statistics for the flow, or NULL
  *
- * Delete a flow from the forwarding engine.
+ * Delete a flow from the forwarding engine. The state manager passes
+ * NULL when nothing will report the final statistics, so they need not
+ * be read back before the delete.
  */
 
 extern indigo_error_t indigo_fwd_flow_delete(
     indigo_cookie_t flow_id,
     indigo_fi_flow_stats_t *flow_stats);
 
+/**
+ * @brief Delete every flow in a table
+ * @param table_id The table, or 0xff for all tables
+ * @return INDIGO_ERROR_NOT_SUPPORTED if flows must be deleted one by one
+ *
+ * Used for a flow delete that wildcards everything, such as a controller
+ * clearing the tables on connect. No final stats are returned, so the
+ * state manager only calls this when no flow in the table asked for a
+ * flow_removed message. On any error the state manager falls back to
+ * indigo_fwd_flow_delete for each flow.
+ */
+
+extern indigo_error_t indigo_fwd_flow_delete_all(uint8_t table_id);
+
 /**
  * @brief Flow stats
  * @param flow_id The ID of the flow whose stats are to be retrieved
@@ -113,6 +135,24 @@ extern indigo_error_t indigo_fwd_flow_stats_get(
     indigo_cookie_t flow_id,
     indigo_fi_flow_stats_t *flow_stats);
 
+/**
+ * @brief Start a run of flow stats lookups
+ * @param table_id Table the lookups are for, or 0xff for all tables
+ *
+ * Called before iterating over many flows with indigo_fwd_flow_stats_get,
+ * so the forwarding engine can fetch the counters in bulk. Calls nest;
+ * each must be matched by indigo_fwd_flow_stats_bulk_end. Counters
+ * returned in between may be as old as the first call.
+ */
+
+extern void indigo_fwd_flow_stats_bulk_begin(uint8_t table_id);
+
+/**
+ * @brief End a run of flow stats lookups
+ */
+
+extern void indigo_fwd_flow_stats_bulk_end(void);
+
 /**
  * @brief Flow hit status
  * @param flow_id The ID of the flow whose hit status is to be retrieved
@@ -125,6 +165,22 @@ extern indigo_error_t indigo_fwd_flow_hit_status_get(
     indigo_cookie_t flow_id,
     bool *hit_status);
 
+/**
+ * @brief Flow hit status for several flows
+ * @param count Number of flows
+ * @param flow_ids The IDs of the flows whose hit status is to be retrieved
+ * @param [out] hit_status Array of count entries, each true if the flow was
+ * hit since last time its hit status was retrieved
+ *
+ * Get the hit status of several existing flows in one call. The default
+ * implementation calls indigo_fwd_flow_hit_status_get for each flow.
+ */
+
+extern indigo_error_t indigo_fwd_flow_hit_status_bulk_get(
+    int count,
+    const indigo_cookie_t *flow_ids,
+    bool *hit_status);
+
 /**
  * @brief Table stats
  * @param table_stats_request The LOXI request
@@ -139,6 +195,28 @@ extern indigo_error_t indigo_fwd_table_stats_get(
     of_table_stats_request_t *table_stats_request,
     of_table_stats_reply_t **table_stats_reply);
 
+/**
+ * @brief Count the flows installed in a table
+ * @param table_id The table
+ * @param [out] count Number of flows, 0 for a table that does not exist
+ * @return INDIGO_ERROR_NOT_SUPPORTED if counts are not available
+ *
+ * Used to check saved state against the hardware without reading back
+ * every entry.
+ */
+
+extern indigo_error_t indigo_fwd_table_flow_count_get(
+    uint8_t table_id,
+    uint32_t *count);
+
+/**
+ * @brief Count the groups installed
+ * @param [out] count Number of groups
+ * @return INDIGO_ERROR_NOT_SUPPORTED if the count is not available
+ */
+
+extern indigo_error_t indigo_fwd_group_count_get(uint32_t *count);
+
 /**
  * @brief VLAN stats
  * @param vlan_vid The ID of the VLAN whose stats are to be retrieved
@@ -179,6 +257,31 @@ extern indigo_error_t indigo_fwd_experimenter(
     indigo_cxn_id_t cxn_id);
 
 
+/**
+ * @brief Complete deferred operations
+ *
+ * Programs any flows for which indigo_fwd_flow_create returned
+ * INDIGO_ERROR_PENDING and reports each result through
+ * indigo_core_flow_create_done before returning.
+ *
+ * Called before barrier replies and before any message that must be
+ * ordered after earlier flow adds.
+ */
+
+extern void indigo_fwd_pending_flush(void);
+
+/**
+ * @brief Start programming deferred operations
+ *
+ * Like indigo_fwd_pending_flush, but the forwarding engine may report the
+ * results through indigo_core_flow_create_done after returning, at the
+ * latest by the next call to indigo_fwd_pending_flush.
+ *
+ * Called from the main loop when there is no ordering requirement.
+ */
+
+extern void indigo_fwd_pending_submit(void);
+
 /**
  * Notify forwarding of changes in expiration processing behavior
  */
@@ -206,9 +309,16 @@ indigo_error_t indigo_fwd_group_add(uint32_t id, uint8_t group_type, of_list_buc
 /**
  * @brief Modify an existing group
  * @param id Group ID
+ * @param old_buckets LOCI bucket list currently installed, so Forwarding
+ * can update only the buckets that changed
  * @param buckets LOCI bucket list
  */
+#ifdef OFDPA_FIXUP
+indigo_error_t indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *old_buckets,
+                                       of_list_bucket_t *buckets);
+#else
 indigo_error_t indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *buckets);
+#endif
 
 /**
  * @brief Delete an existing group
@@ -261,6 +371,17 @@ indigo_error_t indigo_fwd_meter_modify(uint32_t id, uint16_t flag, of_list_meter
  * @param id Meter ID
  */
 indigo_error_t indigo_fwd_meter_delete(uint32_t id);
+
+/**
+ * @brief Retrieve stats for a meter
+ * @param id Meter ID
+ * @param entry LOCI of_meter_stats_t to be filled in with stats
+ *
+ * The entry has the meter ID, duration and one band stats entry per band
+ * already, with counters set to -1. Forwarding should set flow_count and
+ * any counters it supports.
+ */
+void indigo_fwd_meter_stats_get(uint32_t id, of_meter_stats_t *entry);
 #endif
 
 /**
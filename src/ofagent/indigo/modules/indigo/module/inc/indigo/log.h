@@ -0,0 +1,121 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Rate limited and asynchronous logging
+ *
+ * INDIGO_LOG_RL wraps an AIM log macro with a token bucket kept in a
+ * static variable at the call site, so a message that fires on every
+ * packet or flow during a fault is logged at most
+ * INDIGO_LOG_RL_BURST times at once and INDIGO_LOG_RL_PER_SEC times a
+ * second after that. A suppressed message costs a time read and a
+ * counter increment; its arguments are not evaluated. The next message
+ * logged from the call site is preceded by the number suppressed.
+ *
+ * For example:
+ *
+ *   INDIGO_LOG_RL(AIM_LOG_ERROR, "Failed to send: %s", indigo_strerror(rv));
+ *
+ * The bucket is not locked; from several threads the limit is only
+ * approximate.
+ *
+ * indigo_log_async_start() puts a ring and a writer thread in front of
+ * a slow log destination such as syslog, so a stalled syslog daemon
+ * drops log messages instead of stalling the event loop.
+ */
+
+#ifndef _INDIGO_LOG_H_
+#define _INDIGO_LOG_H_
+
+#include <stdint.h>
+#include <AIM/aim_pvs.h>
+#include <indigo/error.h>
+#include <indigo/time.h>
+
+#define INDIGO_LOG_RL_PER_SEC 10
+#define INDIGO_LOG_RL_BURST 10
+
+typedef struct indigo_log_rl_s {
+    indigo_time_t refill_time;
+    uint32_t tokens;            /* Thousandths of a message */
+    uint32_t suppressed;        /* Since the last message logged */
+    uint8_t init;
+} indigo_log_rl_t;
+
+/**
+ * Take a token from a call site's bucket
+ *
+ * @param rl The call site's bucket
+ * @param suppressed Set to the messages suppressed since the last one
+ * logged, when a token is taken
+ * @returns 1 if the message should be logged
+ */
+
+int indigo_log_rl_take(indigo_log_rl_t *rl, uint32_t *suppressed);
+
+#define INDIGO_LOG_RL(_log, ...)                                        \
+    do {                                                                \
+        static indigo_log_rl_t _indigo_log_rl;                          \
+        uint32_t _indigo_log_suppressed;                                \
+        if (indigo_log_rl_take(&_indigo_log_rl, &_indigo_log_suppressed)) { \
+            if (_indigo_log_suppressed) {                               \
+                _log("Suppressed %u messages from %s:%d",               \
+                     _indigo_log_suppressed, __FILE__, __LINE__);       \
+            }                                                           \
+            _log(__VA_ARGS__);                                          \
+        }                                                               \
+    } while (0)
+
+/**
+ * Start the asynchronous log writer
+ *
+ * Returns a PVS that formats each message into a ring of fixed size
+ * records and returns without blocking; a thread of its own writes the
+ * records to dest in order. A message arriving at a full ring is
+ * dropped and counted, and the writer reports the count to dest once it
+ * catches up. A message longer than INDIGO_LOG_ASYNC_RECORD_SIZE is
+ * truncated.
+ *
+ * Set the returned PVS as the log destination with aim_log_pvs_set_all()
+ * and put dest back before calling indigo_log_async_stop().
+ *
+ * @param dest Where the messages are written, e.g. the syslog PVS
+ * @param records Ring size, rounded up to a power of 2
+ * @returns The writer's PVS, or NULL on failure
+ */
+
+aim_pvs_t *indigo_log_async_start(aim_pvs_t *dest, uint32_t records);
+
+/**
+ * Write what is left in the ring and stop the writer thread
+ */
+
+void indigo_log_async_stop(void);
+
+/**
+ * Show the writer's counters
+ */
+
+void indigo_log_async_show(aim_pvs_t *pvs);
+
+#define INDIGO_LOG_ASYNC_RECORD_SIZE 256
+#define INDIGO_LOG_ASYNC_RECORDS_MAX (1 << 20)
+
+#endif /* _INDIGO_LOG_H_ */
@@ -0,0 +1,89 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Process-wide arena of large pages
+ *
+ * Data that is walked in full, such as the flow table pools and the
+ * connection output rings, is spread over many 4 KiB heap pages and
+ * misses the TLB on every walk. With an arena configured, it is carved
+ * out of 2 MiB chunks instead: hugetlbfs pages where the kernel has them
+ * reserved, otherwise 2 MiB aligned anonymous mappings advised for
+ * transparent huge pages.
+ *
+ * Chunks are mapped as needed up to the limit and never unmapped. Freed
+ * blocks are kept for reuse by allocations of the same size. Callers
+ * fall back to the heap when indigo_mem_arena_alloc returns NULL, and
+ * use indigo_mem_arena_contains to pick the matching free.
+ *
+ * The limit is 0 (no arena) by default. The arena is only used from the
+ * event loop and is not locked.
+ */
+
+#ifndef _INDIGO_MEM_ARENA_H_
+#define _INDIGO_MEM_ARENA_H_
+
+#include <stdint.h>
+#include <AIM/aim_pvs.h>
+
+#define INDIGO_MEM_ARENA_CHUNK_BYTES (2 * 1024 * 1024)
+
+/* Blocks are rounded up to and aligned on a cache line */
+#define INDIGO_MEM_ARENA_ALIGN 64
+
+/**
+ * Set the arena size
+ *
+ * @param bytes Limit on the mapped chunks, rounded down to whole chunks,
+ * or 0 for none. Chunks already mapped are kept.
+ */
+
+void indigo_mem_arena_limit_set(uint64_t bytes);
+
+/**
+ * Allocate a block from the arena
+ *
+ * @returns The block, not zeroed, or NULL if there is no arena, the
+ * block is larger than a chunk or the arena is full
+ */
+
+void *indigo_mem_arena_alloc(uint32_t bytes);
+
+/**
+ * Return a block, with the size it was allocated with
+ */
+
+void indigo_mem_arena_free(void *ptr, uint32_t bytes);
+
+/**
+ * Was ptr allocated from the arena?
+ */
+
+int indigo_mem_arena_contains(const void *ptr);
+
+/**
+ * Bytes mapped for the arena
+ */
+
+uint64_t indigo_mem_arena_bytes(void);
+
+void indigo_mem_arena_show(aim_pvs_t *pvs);
+
+#endif /* _INDIGO_MEM_ARENA_H_ */
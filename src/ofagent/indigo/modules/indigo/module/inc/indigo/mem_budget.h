@@ -0,0 +1,84 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief Process-wide memory budget
+ *
+ * The memory that grows with controller traffic rather than with the
+ * tables is charged here by class: queued output, requests held by
+ * operations in progress and multipart replies held back for ordering.
+ * With a limit set, producers check the budget before taking on more:
+ *
+ * - Above INDIGO_MEM_BUDGET_PRESSURE_PERCENT of the limit, long
+ *   multipart replies are produced only as fast as they are sent, with
+ *   a lower output watermark per connection.
+ * - At the limit, new multipart requests and flow adds and modifies are
+ *   refused with an OpenFlow error, and packet-ins are dropped.
+ *
+ * Charges are always counted; the limit is 0 (none) by default. The
+ * budget is only used from the event loop and is not locked.
+ */
+
+#ifndef _INDIGO_MEM_BUDGET_H_
+#define _INDIGO_MEM_BUDGET_H_
+
+#include <stdint.h>
+#include <AIM/aim_pvs.h>
+
+#define INDIGO_MEM_BUDGET_PRESSURE_PERCENT 75
+
+typedef enum indigo_mem_budget_class_e {
+    INDIGO_MEM_BUDGET_OUTPUT,   /* Connection output queues */
+    INDIGO_MEM_BUDGET_REQUEST,  /* Requests held by operations in progress */
+    INDIGO_MEM_BUDGET_REPLY,    /* Multipart replies held for ordering */
+    INDIGO_MEM_BUDGET_CLASS_COUNT,
+} indigo_mem_budget_class_t;
+
+/**
+ * Set the budget
+ *
+ * @param bytes Limit on the charged memory, or 0 for none
+ */
+
+void indigo_mem_budget_limit_set(uint64_t bytes);
+
+uint64_t indigo_mem_budget_limit_get(void);
+
+void indigo_mem_budget_charge(indigo_mem_budget_class_t cls, uint32_t bytes);
+
+void indigo_mem_budget_release(indigo_mem_budget_class_t cls, uint32_t bytes);
+
+/**
+ * Is the charged memory above the pressure threshold?
+ */
+
+int indigo_mem_budget_pressure(void);
+
+/**
+ * Admit new work
+ *
+ * @returns 0, and counts a refusal, if the charged memory is at the limit
+ */
+
+int indigo_mem_budget_admit(void);
+
+void indigo_mem_budget_show(aim_pvs_t *pvs);
+
+#endif /* _INDIGO_MEM_BUDGET_H_ */
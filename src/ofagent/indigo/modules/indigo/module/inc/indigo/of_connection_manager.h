@@ -76,11 +76,18 @@
  *
  * INDIGO_CXN_PROTO_INVALID A marker used to indicate an undefined protocol
  * INDIGO_CXN_PROTO_TCP_OVER_IPV4 Use TCP over IPv4 for the connection
+ * INDIGO_CXN_PROTO_TLS_OVER_IPV4 Use TLS over TCP over IPv4; takes the
+ * same parameters as TCP over IPv4
+ * INDIGO_CXN_PROTO_UDP_OVER_IPV4 Use UDP over IPv4, one or more whole
+ * messages per datagram; takes the same parameters as TCP over IPv4 and
+ * is only allowed for auxiliary connections
  */
 
 typedef enum indigo_cxn_protocol_e {
     INDIGO_CXN_PROTO_INVALID            = -1,
-    INDIGO_CXN_PROTO_TCP_OVER_IPV4      = 0
+    INDIGO_CXN_PROTO_TCP_OVER_IPV4      = 0,
+    INDIGO_CXN_PROTO_TLS_OVER_IPV4      = 1,
+    INDIGO_CXN_PROTO_UDP_OVER_IPV4      = 2
 } indigo_cxn_protocol_t;
 
 /**
@@ -115,7 +122,7 @@ typedef struct indigo_cxn_params_tcp_over_ipv4_s {
 
 typedef union indigo_cxn_protocol_params_u {
     indigo_cxn_params_header_t header;
-    indigo_cxn_params_tcp_over_ipv4_t tcp_over_ipv4;
+    indigo_cxn_params_tcp_over_ipv4_t tcp_over_ipv4; /* Also TLS and UDP */
 } indigo_cxn_protocol_params_t;
 
 /**
@@ -153,6 +160,12 @@ typedef union indigo_cxn_protocol_params_u {
  * Remote connections are usually active connect (non-listen) controller
  * connections that require a handshake to continue processing.  Echo
  * requests may be done on these connections as a keepalive.
+ *
+ * An OpenFlow 1.3 auxiliary connection (auxiliary_id nonzero) belongs to
+ * the main connection to the same controller IP. It connects only while
+ * the main connection is up, is closed with it, takes its role, and
+ * carries the packet-ins that would have gone to the main connection.
+ * The controller may send packet-outs on it like on any connection.
  */
 
 typedef struct indigo_cxn_config_params_s {
@@ -162,6 +175,11 @@ typedef struct indigo_cxn_config_params_s {
     int listen;
     uint32_t periodic_echo_ms;
     uint32_t reset_echo_count;
+    int trusted;    /* Skip full validation of flow_mod, packet_out, barrier */
+    uint32_t weight; /* Share of message processing when busy; 0 means 1 */
+    int pipelined;  /* Flow mods may complete after later messages */
+    uint8_t auxiliary_id; /* Nonzero for an auxiliary connection */
+    int packet_in_queue_max; /* Queued packet-ins before drops; 0 default */
 } indigo_cxn_config_params_t;
 
 /****************************************************************
@@ -212,6 +230,11 @@ typedef enum indigo_cxn_role_e {
  *    bytes_out Number of bytes written in since last connect
  *    messages_in Number of messages received since last connect
  *    messages_out Number of messages sent to controller since last connect
+ *    packet_in_drop Packet-ins dropped because the packet-in queue was full
+ *    packet_in_rate_drop Packet-ins dropped by the packet-in rate limit
+ *    flow_removed_drop Flow removed messages dropped because their queue was full
+ *    output_bytes_high Most bytes queued for output since last connect
+ *    output_msgs_high Most messages queued for output since last connect
  */
 
 typedef struct indigo_cxn_status_s {
@@ -226,7 +249,10 @@ typedef struct indigo_cxn_status_s {
     uint64_t messages_in;
     uint64_t messages_out;
     uint64_t packet_in_drop;
+    uint64_t packet_in_rate_drop;
     uint64_t flow_removed_drop;
+    uint32_t output_bytes_high;
+    uint32_t output_msgs_high;
 } indigo_cxn_status_t;
 
 /****************************************************************
@@ -350,6 +376,73 @@ extern void indigo_cxn_send_controller_message(
 
 extern void indigo_cxn_send_async_message(of_object_t *obj);
 
+/**
+ * Callback for indigo_cxn_output_ready_register
+ *
+ * @param cookie Cookie given at registration
+ */
+
+typedef void (*indigo_cxn_output_ready_f)(void *cookie);
+
+/**
+ * Is a connection's output backed up?
+ *
+ * @param cxn_id The connection
+ * @returns 1 if the queued output is above the high watermark, or
+ * above the low watermark while the memory budget is under pressure
+ *
+ * Producers of long multipart replies should stop generating output
+ * while this is true and wait with indigo_cxn_output_ready_register.
+ * Invalid or disconnected connections are never backed up.
+ */
+
+extern int indigo_cxn_output_blocked(indigo_cxn_id_t cxn_id);
+
+/**
+ * Request a callback once a connection's output drains
+ *
+ * @param cxn_id The connection
+ * @param callback Called when the queued output falls below the low
+ *                 watermark, or when the connection closes
+ * @param cookie Passed to callback
+ * @returns Error code; the callback is not registered on error
+ *
+ * Each registration is called exactly once.
+ */
+
+extern indigo_error_t indigo_cxn_output_ready_register(
+    indigo_cxn_id_t cxn_id,
+    indigo_cxn_output_ready_f callback,
+    void *cookie);
+
+/**
+ * Are flow removed messages backed up?
+ *
+ * @returns 1 if any connection has a backlog of flow removed messages
+ *
+ * Producers of many flow removed messages, such as flow expiration and
+ * non-strict deletes, should hold off removing flows that want one while
+ * this is true and wait with indigo_cxn_flow_removed_ready_register, so
+ * the messages are delayed rather than dropped.
+ */
+
+extern int indigo_cxn_flow_removed_blocked(void);
+
+/**
+ * Request a callback once flow removed messages drain
+ *
+ * @param callback Called when no connection has a backlog of flow
+ *                 removed messages, including after a disconnect
+ * @param cookie Passed to callback
+ * @returns Error code; the callback is not registered on error
+ *
+ * Each registration is called exactly once.
+ */
+
+extern indigo_error_t indigo_cxn_flow_removed_ready_register(
+    indigo_cxn_output_ready_f callback,
+    void *cookie);
+
 /**
  * Send an error message to a controller connection
  *
@@ -364,6 +457,39 @@ extern void
 indigo_cxn_send_error_reply(indigo_cxn_id_t cxn_id, of_object_t *orig,
                             uint16_t type, uint16_t code);
 
+/**
+ * Take ownership of a message passed to a handler
+ *
+ * @param cxn_id Controller the message came from
+ * @param obj The message, as passed to the handler
+ * @returns An object the caller owns and deletes, or NULL if the
+ * connection is gone
+ *
+ * The message passed to a handler points into the connection's read
+ * buffer and is only valid until the handler returns.  A handler that
+ * keeps it for an operation in progress claims it here instead of
+ * duplicating it: when the message is alone in the read buffer the
+ * buffer is handed over without a copy.  The returned object is tracked
+ * as an outstanding operation on the connection, like one passed to
+ * ind_cxn_message_track_setup, and obj stays usable until the handler
+ * returns.
+ */
+extern of_object_t *
+indigo_cxn_message_claim(indigo_cxn_id_t cxn_id, of_object_t *obj);
+
+/**
+ * Report a message that a handler could not decode
+ *
+ * @param cxn_id Controller the message came from
+ * @param obj The message
+ *
+ * Messages from trusted controllers are only partly validated on
+ * receipt; this runs the full validator and answers with a bad request
+ * error, as a message failing validation on receipt would get.
+ */
+extern void
+indigo_cxn_message_parse_error(indigo_cxn_id_t cxn_id, of_object_t *obj);
+
 
 /**
  * Connection information structure.
@@ -129,6 +129,24 @@ extern indigo_error_t indigo_core_dpid_get(of_dpid_t *dpid);
 extern void indigo_core_port_status_update(of_port_status_t *port_status);
 
 
+/****************************************************************
+ * Asynchronous forwarding flow create completion
+ ****************************************************************/
+
+/**
+ * @brief Report the result of a deferred flow create
+ * @param flow_id The flow passed to indigo_fwd_flow_create
+ * @param result Result of programming the flow
+ *
+ * Called from forwarding for each flow for which indigo_fwd_flow_create
+ * returned INDIGO_ERROR_PENDING. On error the flow is removed and the
+ * error is sent to the controller against the original flow add.
+ */
+extern void indigo_core_flow_create_done(
+    indigo_cookie_t flow_id,
+    indigo_error_t result);
+
+
 /****************************************************************
  * Asynchronous forwarding flow removed event notification call
  *
@@ -155,6 +173,111 @@ extern void indigo_core_flow_removed(
     indigo_fi_flow_removed_t reason,
     indigo_fi_flow_stats_t *stats);
 
+/****************************************************************
+ * Warm start: adopt state already programmed in forwarding
+ ****************************************************************/
+
+/**
+ * @brief Add a flow that forwarding already has installed
+ * @param flow_id The identifier forwarding knows the flow by
+ * @param flow_add Describes the flow; it is not retained
+ *
+ * The flow enters the flow table under flow_id without a call to
+ * indigo_fwd_flow_create.  Flow IDs allocated afterwards for controller
+ * adds skip the restored IDs for as long as those flows exist.  Meant to
+ * be called before any controller connects.
+ */
+
+extern indigo_error_t indigo_core_flow_restore(
+    indigo_flow_id_t flow_id,
+    of_flow_add_t *flow_add);
+
+/**
+ * @brief Add a group that forwarding already has installed
+ * @param group_add Describes the group; it is not retained
+ *
+ * As indigo_core_flow_restore, without a call to indigo_fwd_group_add.
+ */
+
+extern indigo_error_t indigo_core_group_restore(
+    of_group_add_t *group_add);
+
+/****************************************************************
+ * Preload: state that belongs to the switch rather than a controller
+ ****************************************************************/
+
+/**
+ * Flow IDs of preloaded flows
+ *
+ * The ID is also forwarding's cookie for the flow, so a preloaded flow
+ * adopted by a warm start is still known as one.  The range is above the
+ * IDs handed out for controller adds.
+ */
+
+#define INDIGO_CORE_PRELOAD_FLOW_ID_BASE  (1ULL << 48)
+#define INDIGO_CORE_PRELOAD_FLOW_ID_COUNT (1ULL << 32)
+#define INDIGO_CORE_FLOW_ID_PRELOADED(_id)                              \
+    ((_id) >= INDIGO_CORE_PRELOAD_FLOW_ID_BASE &&                       \
+     (_id) < INDIGO_CORE_PRELOAD_FLOW_ID_BASE + INDIGO_CORE_PRELOAD_FLOW_ID_COUNT)
+
+/**
+ * @brief Install a flow that belongs to the switch
+ * @param flow_add Describes the flow; it is not retained
+ *
+ * Programmed through forwarding like a controller's add, including its
+ * batching, with a preloaded flow ID.  Errors from forwarding that come
+ * later are counted and logged, not sent to a controller.  Once in, the
+ * flow is like any other; controllers see it with the cookie in flow_add.
+ *
+ * @returns INDIGO_ERROR_EXISTS if an identical flow is already installed
+ */
+
+extern indigo_error_t indigo_core_flow_preload(
+    of_flow_add_t *flow_add);
+
+/**
+ * @brief Install a group that belongs to the switch
+ * @param group_add Describes the group; it is not retained
+ *
+ * @returns INDIGO_ERROR_EXISTS if the group ID is in use
+ */
+
+extern indigo_error_t indigo_core_group_preload(
+    of_group_add_t *group_add);
+
+/**
+ * @brief Hold back requests that depend on state still being restored
+ *
+ * For forwarding that adopts its state after the controller connections
+ * are up.  Until indigo_core_groups_loaded, group messages are held.
+ * Until indigo_core_table_loaded for a table, flow modifies, deletes and
+ * flow and aggregate stats requests for it are held; flow adds and table
+ * stats requests wait for every table.  The handshake, echoes and other
+ * messages are handled as usual.  Held messages count as operations in
+ * progress, so a later barrier is answered only after they are handled.
+ */
+
+extern void indigo_core_loading_start(void);
+
+/**
+ * @brief The groups have all been restored
+ */
+
+extern void indigo_core_groups_loaded(void);
+
+/**
+ * @brief The flows of a table have all been restored
+ * @param table_id The table
+ */
+
+extern void indigo_core_table_loaded(uint8_t table_id);
+
+/**
+ * @brief Everything has been restored, or the restore was abandoned
+ */
+
+extern void indigo_core_loading_done(void);
+
 /****************************************************************
  * Asynchronous connection manager notification, disconnection mode
  ****************************************************************/
@@ -200,6 +323,26 @@ indigo_core_stats_get(uint32_t *total_flows,
                       uint32_t *packet_ins,
                       uint32_t *packet_outs);
 
+/**
+ * @brief Returns the number of flows in a table.
+ * @param table_id The table
+ *
+ * Counts the flows known to the state manager without asking Forwarding.
+ */
+
+extern uint32_t
+indigo_core_table_flow_count(uint8_t table_id);
+
+/**
+ * @brief Returns the miss_send_len from the last set_config.
+ *
+ * OF_CONTROLLER_PKT_NO_BUFFER (send whole packets) until a controller
+ * has sent a set_config.
+ */
+
+extern uint16_t
+indigo_core_miss_send_len_get(void);
+
 /****************************************************************
  * Gentable
  *
@@ -215,6 +358,13 @@ indigo_core_stats_get(uint32_t *total_flows,
  * called when a gentable_entry_add message is received for a key that
  * already exists in the table.
  *
+ * A table may also provide 'add_batch' and 'del_batch'. New entries and
+ * deletions are then queued and handed to the table together, once enough
+ * have accumulated or before anything that must observe them (a barrier,
+ * any other message, a stats iteration). Each entry carries its own
+ * result; a failed entry is answered with an error for the message that
+ * requested it.
+ *
  ****************************************************************/
 
 /**
@@ -222,6 +372,20 @@ indigo_core_stats_get(uint32_t *total_flows,
  */
 typedef struct indigo_core_gentable indigo_core_gentable_t;
 
+/**
+ * @brief One entry of a batched gentable operation
+ * @param key Entry key
+ * @param value Entry value (add only)
+ * @param entry_priv Entry private data; set by add_batch, passed to del_batch
+ * @param status Result for this entry, INDIGO_ERROR_NONE on entry
+ */
+typedef struct indigo_core_gentable_batch_entry {
+    of_list_bsn_tlv_t *key;
+    of_list_bsn_tlv_t *value;
+    void *entry_priv;
+    indigo_error_t status;
+} indigo_core_gentable_batch_entry_t;
+
 /**
  * @brief Operations on a gentable
  */
@@ -261,6 +425,26 @@ typedef struct indigo_core_gentable_ops {
      * @param stats Stats list to be filled in
      */
     void (*get_stats)(void *table_priv, void *entry_priv, of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *stats);
+
+    /**
+     * @brief Add several new entries (optional)
+     * @param table_priv Table private data
+     * @param entries Entries to add; fill in entry_priv and status of each
+     * @param count Number of entries
+     *
+     * An error return fails every entry in the batch.
+     */
+    indigo_error_t (*add_batch)(void *table_priv, indigo_core_gentable_batch_entry_t *entries, int count);
+
+    /**
+     * @brief Delete several entries (optional)
+     * @param table_priv Table private data
+     * @param entries Entries to delete; fill in status of each
+     * @param count Number of entries
+     *
+     * An error return fails every entry in the batch.
+     */
+    indigo_error_t (*del_batch)(void *table_priv, indigo_core_gentable_batch_entry_t *entries, int count);
 } indigo_core_gentable_ops_t;
 
 /*
@@ -312,6 +496,18 @@ typedef enum indigo_core_listener_result {
     INDIGO_CORE_LISTENER_RESULT_DROP = 1,
 } indigo_core_listener_result_t;
 
+/**
+ * Listeners of each kind are called in decreasing priority, and in
+ * registration order within a priority. The plain register functions
+ * use INDIGO_CORE_LISTENER_PRIORITY_DEFAULT.
+ *
+ * A listener registered with a filter is only called for events that
+ * pass it; for the others it counts as returning PASS. At most
+ * INDIGO_CORE_LISTENERS_MAX listeners of each kind can be registered.
+ */
+#define INDIGO_CORE_LISTENER_PRIORITY_DEFAULT 0
+#define INDIGO_CORE_LISTENERS_MAX 16
+
 /**
  * Packet-in listener registration
  */
@@ -319,6 +515,21 @@ typedef indigo_core_listener_result_t (*indigo_core_packet_in_listener_f)(of_pac
 indigo_error_t indigo_core_packet_in_listener_register(indigo_core_packet_in_listener_f fn);
 void indigo_core_packet_in_listener_unregister(indigo_core_packet_in_listener_f fn);
 
+/* Fields of indigo_core_packet_in_filter_t to check */
+#define INDIGO_CORE_PACKET_IN_FILTER_ETH_TYPE (1 << 0)
+#define INDIGO_CORE_PACKET_IN_FILTER_TABLE_ID (1 << 1)
+
+typedef struct indigo_core_packet_in_filter_s {
+    uint32_t fields;    /* INDIGO_CORE_PACKET_IN_FILTER_* */
+    uint16_t eth_type;  /* Ethertype after any VLAN tags */
+    uint8_t table_id;   /* Not checked for OpenFlow 1.0 packet-ins */
+} indigo_core_packet_in_filter_t;
+
+indigo_error_t indigo_core_packet_in_listener_register_with_filter(
+    indigo_core_packet_in_listener_f fn,
+    const indigo_core_packet_in_filter_t *filter,
+    int priority);
+
 /**
  * Port status listener registration
  */
@@ -326,6 +537,10 @@ typedef indigo_core_listener_result_t (*indigo_core_port_status_listener_f)(of_p
 indigo_error_t indigo_core_port_status_listener_register(indigo_core_port_status_listener_f fn);
 void indigo_core_port_status_listener_unregister(indigo_core_port_status_listener_f fn);
 
+indigo_error_t indigo_core_port_status_listener_register_with_priority(
+    indigo_core_port_status_listener_f fn,
+    int priority);
+
 /**
  * Message listener registration
  */
@@ -333,6 +548,56 @@ typedef indigo_core_listener_result_t (*indigo_core_message_listener_f)(indigo_c
 indigo_error_t indigo_core_message_listener_register(indigo_core_message_listener_f fn);
 void indigo_core_message_listener_unregister(indigo_core_message_listener_f fn);
 
+/* Only call the listener for messages of the given object types */
+indigo_error_t indigo_core_message_listener_register_with_filter(
+    indigo_core_message_listener_f fn,
+    const of_object_id_t *object_ids,
+    int count,
+    int priority);
+
+/****************************************************************
+ *
+ * Experimenter dispatch
+ *
+ * A module can register a handler for one experimenter message or
+ * experimenter multipart request, by experimenter ID and subtype. The
+ * handler is found with a hash lookup and called before the message is
+ * offered to indigo_fwd_experimenter and indigo_port_experimenter. It
+ * sends any reply itself; the object belongs to the caller.
+ *
+ * A handler returning INDIGO_ERROR_NOT_SUPPORTED passes the message on
+ * as if it were not registered. Other errors are counted and logged.
+ * The "experimenter" ucli command shows the calls, errors and time
+ * spent in each handler.
+ *
+ ****************************************************************/
+
+typedef enum indigo_core_experimenter_kind_e {
+    INDIGO_CORE_EXPERIMENTER_MESSAGE,   /* of_experimenter_t */
+    INDIGO_CORE_EXPERIMENTER_MULTIPART, /* of_experimenter_stats_request_t */
+    INDIGO_CORE_EXPERIMENTER_KIND_COUNT,
+} indigo_core_experimenter_kind_t;
+
+typedef indigo_error_t (*indigo_core_experimenter_handler_f)(
+    of_object_t *obj, indigo_cxn_id_t cxn_id);
+
+/**
+ * @brief Register the handler for an experimenter and subtype
+ * @param name Shown with the handler's stats
+ * @returns INDIGO_ERROR_EXISTS if the subtype already has a handler
+ */
+indigo_error_t indigo_core_experimenter_register(
+    indigo_core_experimenter_kind_t kind,
+    uint32_t experimenter,
+    uint32_t subtype,
+    const char *name,
+    indigo_core_experimenter_handler_f handler);
+
+void indigo_core_experimenter_unregister(
+    indigo_core_experimenter_kind_t kind,
+    uint32_t experimenter,
+    uint32_t subtype);
+
 
 /****************************************************************
  *
@@ -359,8 +624,34 @@ void indigo_core_message_listener_unregister(indigo_core_message_listener_f fn);
  *
  ****************************************************************/
 
+/**
+ * One entry of a batched table operation
+ * @param obj Flow-add message (entry_create_batch only)
+ * @param flow_id Flow ID
+ * @param entry_priv Entry private data; set by entry_create_batch, passed
+ * to the other batch operations
+ * @param flow_stats Final or current stats (entry_delete_batch and
+ * entry_stats_batch_get only)
+ * @param status Result for this entry, INDIGO_ERROR_NONE on entry
+ */
+typedef struct indigo_core_table_batch_entry_s {
+    of_flow_add_t *obj;
+    indigo_cookie_t flow_id;
+    void *entry_priv;
+    indigo_fi_flow_stats_t flow_stats;
+    indigo_error_t status;
+} indigo_core_table_batch_entry_t;
+
 /**
  * Table operations
+ *
+ * The batch operations are optional. With entry_create_batch, flow adds
+ * to the table are queued and handed to it together, once enough have
+ * accumulated or before anything that must observe them (a barrier, any
+ * other message, another operation on the table). The others are used
+ * when a flow mod, an expiration run or a stats walk reaches several
+ * entries of the table in a row. An error return from a batch operation
+ * fails every entry in the batch.
  */
 
 typedef struct indigo_core_table_ops_s {
@@ -407,6 +698,55 @@ typedef struct indigo_core_table_ops_s {
      * @param [out] hit_status True if entry hit since last time API was called
      */
     indigo_error_t (*entry_hit_status_get)(void *table_priv, void *entry_priv, bool *hit_status);
+
+    /**
+     * Retrieve and reset hit status for several entries
+     * @param table_priv Private data passed to indigo_core_table_register
+     * @param count Number of entries
+     * @param entry_privs Private data returned by the entry_create operation
+     * for each entry
+     * @param [out] hit_status Array of count entries, each true if that
+     * entry was hit since last time its hit status was retrieved
+     *
+     * May be NULL, in which case entry_hit_status_get is called per entry.
+     */
+    indigo_error_t (*entry_hit_status_bulk_get)(void *table_priv, int count, void **entry_privs, bool *hit_status);
+
+    /**
+     * Add several entries (optional)
+     * @param table_priv Private data passed to indigo_core_table_register
+     * @param entries Entries to add; fill in entry_priv and status of each
+     * @param count Number of entries
+     */
+    indigo_error_t (*entry_create_batch)(void *table_priv, indigo_core_table_batch_entry_t *entries, int count);
+
+    /**
+     * Apply one modify to several entries (optional)
+     * @param table_priv Private data passed to indigo_core_table_register
+     * @param obj Flow-modify message
+     * @param entries Entries to modify; fill in status of each
+     * @param count Number of entries
+     */
+    indigo_error_t (*entry_modify_batch)(void *table_priv, of_flow_modify_strict_t *obj, indigo_core_table_batch_entry_t *entries, int count);
+
+    /**
+     * Delete several entries (optional)
+     * @param table_priv Private data passed to indigo_core_table_register
+     * @param entries Entries to delete; fill in flow_stats and status of each
+     * @param count Number of entries
+     *
+     * As for entry_delete, the implementation should deallocate each
+     * entry_priv.
+     */
+    indigo_error_t (*entry_delete_batch)(void *table_priv, indigo_core_table_batch_entry_t *entries, int count);
+
+    /**
+     * Retrieve stats for several entries (optional)
+     * @param table_priv Private data passed to indigo_core_table_register
+     * @param entries Entries to read; fill in flow_stats and status of each
+     * @param count Number of entries
+     */
+    indigo_error_t (*entry_stats_batch_get)(void *table_priv, indigo_core_table_batch_entry_t *entries, int count);
 } indigo_core_table_ops_t;
 
 /**
@@ -0,0 +1,118 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/**
+ * @file
+ * @brief CPU and scheduling placement of agent threads
+ *
+ * On a switch CPU with a few cores the agent's threads compete with each
+ * other and with the OF-DPA server. Each thread registers under a role
+ * when it starts, and the placement set for the role is applied to it:
+ * a CPU affinity mask, a scheduling policy and a priority. Changing a
+ * role's placement applies it to the role's running threads.
+ *
+ * A placement is written as CPUS[/POLICY[/PRIORITY]], for example
+ * "2-3/fifo/50" or "0,2". CPUS is a list of CPUs and ranges, or "*"
+ * for any; POLICY is "other", "fifo" or "rr". Parts left out are left
+ * as the thread has them.
+ *
+ * Registration and placement changes are only made from the event loop
+ * thread, which starts the others, and are not locked.
+ */
+
+#ifndef _INDIGO_THREAD_H_
+#define _INDIGO_THREAD_H_
+
+#include <stdint.h>
+#include <pthread.h>
+#include <AIM/aim_pvs.h>
+#include <indigo/error.h>
+
+typedef enum indigo_thread_role_e {
+    INDIGO_THREAD_EVENT_LOOP,
+    INDIGO_THREAD_PACKET_RX,
+    INDIGO_THREAD_FLOW_WORKER,
+    INDIGO_THREAD_OFDPA_CLIENT,
+    INDIGO_THREAD_LOG,
+    INDIGO_THREAD_PCAP,
+    INDIGO_THREAD_ROLE_COUNT,
+} indigo_thread_role_t;
+
+/* Threads tracked at once */
+#define INDIGO_THREAD_MAX 32
+
+typedef struct indigo_thread_placement_s {
+    uint64_t cpus;      /* Bit per CPU, or 0 for any */
+    int policy;         /* SCHED_OTHER, SCHED_FIFO, SCHED_RR, or -1 to leave */
+    int priority;       /* For SCHED_FIFO and SCHED_RR */
+} indigo_thread_placement_t;
+
+/**
+ * Role name, as used in placement options and configuration
+ */
+
+const char *indigo_thread_role_name(indigo_thread_role_t role);
+
+/**
+ * Look up a role by name
+ *
+ * @returns INDIGO_ERROR_NOT_FOUND for an unknown name
+ */
+
+indigo_error_t indigo_thread_role_parse(const char *name,
+                                        indigo_thread_role_t *role);
+
+/**
+ * Parse CPUS[/POLICY[/PRIORITY]]
+ *
+ * @returns INDIGO_ERROR_PARAM if the text is not a valid placement
+ */
+
+indigo_error_t indigo_thread_placement_parse(const char *text,
+                                             indigo_thread_placement_t *placement);
+
+/**
+ * Set the placement of a role and apply it to the role's threads
+ *
+ * @param placement The placement, or NULL to leave the threads as they are
+ * @returns The first error applying it, if any
+ */
+
+indigo_error_t indigo_thread_placement_set(indigo_thread_role_t role,
+                                           const indigo_thread_placement_t *placement);
+
+/**
+ * Register a started thread and apply its role's placement
+ *
+ * @returns The error applying the placement, if any; the thread is
+ * registered either way and the error is shown by indigo_thread_show
+ */
+
+indigo_error_t indigo_thread_register(indigo_thread_role_t role,
+                                      pthread_t thread);
+
+/**
+ * Forget a thread, before it is joined
+ */
+
+void indigo_thread_unregister(pthread_t thread);
+
+void indigo_thread_show(aim_pvs_t *pvs);
+
+#endif /* _INDIGO_THREAD_H_ */
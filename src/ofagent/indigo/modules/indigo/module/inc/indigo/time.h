@@ -25,6 +25,7 @@
  *
  * indigo_time_t:  Typedef of struct for time
  * INDIGO_CURRENT_TIME: Return current time of type indigo_time_t
+ * INDIGO_PRECISE_TIME: Same, always read from the clock
  * INDIGO_TIME_DIFF_ms(earlier, later): Difference in milliseconds in times
  */
 
@@ -54,8 +55,26 @@ typedef uint64_t indigo_time_t;
 /**
  * Get the current timestamp
  * @returns An indigo_time_t value representing the current time
+ *
+ * Inside the SocketManager event loop this is the time the loop last
+ * read the clock: after each wait, at the end of each callback and on
+ * each ind_soc_should_yield() check. It trails the clock by at most the
+ * time the running callback has spent since then, and costs no system
+ * call. Outside the loop it reads the clock.
+ *
+ * The cache belongs to the thread running the event loop; other threads
+ * must use INDIGO_PRECISE_TIME.
  */
-#define INDIGO_CURRENT_TIME indigo_current_time()
+#define INDIGO_CURRENT_TIME indigo_current_time_cached()
+
+/**
+ * Get the current timestamp from the clock
+ * @returns An indigo_time_t value representing the current time
+ *
+ * For measuring intervals shorter than a callback, and for threads other
+ * than the one running the event loop.
+ */
+#define INDIGO_PRECISE_TIME indigo_current_time()
 
 /**
  * Time difference in milliseconds
@@ -93,6 +112,35 @@ indigo_current_time(void) {
 }
 #endif
 
+/* Loop-cached time; 0 while no event loop is running */
+extern indigo_time_t indigo_time_cached;
+
+static inline indigo_time_t
+indigo_current_time_cached(void) {
+    indigo_time_t now = indigo_time_cached;
+    return now != 0 ? now : indigo_current_time();
+}
+
+/**
+ * Read the clock into the cache
+ *
+ * Called by the event loop only.
+ */
+static inline indigo_time_t
+indigo_time_cache_update(void) {
+    return indigo_time_cached = indigo_current_time();
+}
+
+/**
+ * Stop caching; INDIGO_CURRENT_TIME reads the clock again
+ *
+ * Called by the event loop when it returns.
+ */
+static inline void
+indigo_time_cache_clear(void) {
+    indigo_time_cached = 0;
+}
+
 /* Printing time to a string */
 #define INDIGO_TIME_FORMAT "%b %d %T"
 #define INDIGO_TIME_BYTES 32
@@ -145,6 +193,7 @@ indigo_time_str(indigo_time_t itime, char *buf, int len) {
 #if defined(INDIGO_STUB_TIME)
 typedef uint64_t indigo_time_t;
 #define INDIGO_CURRENT_TIME (0)
+#define INDIGO_PRECISE_TIME (0)
 #define INDIGO_TIME_DIFF_ms(_a,_b) (0)
 #endif
 
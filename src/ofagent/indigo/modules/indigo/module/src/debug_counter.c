@@ -0,0 +1,64 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+#include <AIM/aim.h>
+#include <indigo/debug_counter.h>
+
+static LIST_DEFINE(debug_counters);
+static uint64_t debug_counter_next_id = 1;
+
+void
+debug_counter_register_get(debug_counter_t *counter,
+                           const char *name, const char *description,
+                           debug_counter_get_f get, void *cookie)
+{
+    AIM_TRUE_OR_DIE(counter->counter_id == 0,
+                    "debug counter %s registered twice", name);
+
+    counter->counter_id = debug_counter_next_id++;
+    counter->name = name;
+    counter->description = description;
+    counter->get = get;
+    counter->cookie = cookie;
+    list_push(&debug_counters, &counter->links);
+}
+
+void
+debug_counter_register(debug_counter_t *counter,
+                       const char *name, const char *description)
+{
+    debug_counter_register_get(counter, name, description, NULL, NULL);
+}
+
+void
+debug_counter_unregister(debug_counter_t *counter)
+{
+    if (counter->counter_id == 0) {
+        return;
+    }
+
+    list_remove(&counter->links);
+    counter->counter_id = 0;
+}
+
+list_head_t *
+debug_counter_list(void)
+{
+    return &debug_counters;
+}
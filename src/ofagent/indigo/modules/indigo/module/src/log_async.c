@@ -0,0 +1,263 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/******************************************************************************
+ *
+ *  /module/src/log_async.c
+ *
+ *  Asynchronous log writer
+ *
+ *  Messages may be logged from any thread, so the ring takes several
+ *  producers. Each record carries a sequence number: a producer claims
+ *  the record at head with a compare and swap, formats into it and
+ *  publishes it by advancing its sequence; the writer thread takes
+ *  records in order once published. When the writer is idle it sleeps
+ *  on an eventfd, which a producer only signals if the writer said it
+ *  was going to sleep, so a message normally costs no system call.
+ *
+ *****************************************************************************/
+#include <AIM/aim.h>
+#include <indigo/indigo_config.h>
+#include <indigo/indigo.h>
+#include <indigo/log.h>
+#include <indigo/thread.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <inttypes.h>
+#include <sys/eventfd.h>
+
+typedef struct log_record_s {
+    uint32_t seq;
+    char text[INDIGO_LOG_ASYNC_RECORD_SIZE];
+} log_record_t;
+
+typedef struct log_async_s {
+    aim_pvs_t pvs;              /* First, so the PVS casts back */
+    aim_pvs_t *dest;
+    log_record_t *ring;
+    uint32_t mask;
+    uint32_t head;              /* Next record to claim */
+    uint32_t tail;              /* Next record to write; writer only */
+    int eventfd;
+    int sleeping;
+    volatile int stopping;
+    pthread_t thread;
+    uint64_t written;
+    uint64_t dropped;
+    uint64_t truncated;
+    uint64_t dropped_reported;
+} log_async_t;
+
+static log_async_t *log_async;
+
+static int
+log_async_vprintf(aim_pvs_t *pvs, const char *fmt, va_list vargs)
+{
+    log_async_t *la = (log_async_t *)pvs;
+    log_record_t *rec;
+    uint32_t pos = __atomic_load_n(&la->head, __ATOMIC_RELAXED);
+    uint64_t one = 1;
+    int32_t diff;
+    int len;
+
+    for (;;) {
+        rec = &la->ring[pos & la->mask];
+        diff = (int32_t)(__atomic_load_n(&rec->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&la->head, &pos, pos + 1, 1,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* Full; drop the newest message rather than wait */
+            __atomic_fetch_add(&la->dropped, 1, __ATOMIC_RELAXED);
+            return 0;
+        } else {
+            pos = __atomic_load_n(&la->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    len = vsnprintf(rec->text, sizeof(rec->text), fmt, vargs);
+    if (len >= (int)sizeof(rec->text)) {
+        __atomic_fetch_add(&la->truncated, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&rec->seq, pos + 1, __ATOMIC_RELEASE);
+
+    if (__atomic_exchange_n(&la->sleeping, 0, __ATOMIC_SEQ_CST)) {
+        if (write(la->eventfd, &one, sizeof(one)) < 0) {
+            /* The writer wakes on its next message */
+        }
+    }
+
+    return len;
+}
+
+/* Write every published record; returns the number written */
+static int
+log_async_drain(log_async_t *la)
+{
+    log_record_t *rec;
+    uint64_t dropped;
+    int count = 0;
+
+    for (;;) {
+        rec = &la->ring[la->tail & la->mask];
+        if (__atomic_load_n(&rec->seq, __ATOMIC_ACQUIRE) != la->tail + 1) {
+            break;
+        }
+        aim_printf(la->dest, "%s", rec->text);
+        __atomic_store_n(&rec->seq, la->tail + la->mask + 1, __ATOMIC_RELEASE);
+        la->tail++;
+        count++;
+    }
+
+    __atomic_fetch_add(&la->written, count, __ATOMIC_RELAXED);
+
+    dropped = __atomic_load_n(&la->dropped, __ATOMIC_RELAXED);
+    if (dropped != la->dropped_reported) {
+        aim_printf(la->dest, "Dropped %" PRIu64 " log messages\n",
+                   dropped - la->dropped_reported);
+        la->dropped_reported = dropped;
+    }
+
+    return count;
+}
+
+static void *
+log_async_thread(void *arg)
+{
+    log_async_t *la = arg;
+    uint64_t value;
+
+    while (!la->stopping) {
+        if (log_async_drain(la) > 0) {
+            continue;
+        }
+
+        __atomic_store_n(&la->sleeping, 1, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&la->ring[la->tail & la->mask].seq,
+                            __ATOMIC_SEQ_CST) == la->tail + 1) {
+            /* A message was published before it saw us asleep */
+            __atomic_store_n(&la->sleeping, 0, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        if (read(la->eventfd, &value, sizeof(value)) < 0 && errno != EINTR) {
+            break;
+        }
+    }
+
+    log_async_drain(la);
+    return NULL;
+}
+
+aim_pvs_t *
+indigo_log_async_start(aim_pvs_t *dest, uint32_t records)
+{
+    log_async_t *la;
+    uint32_t size = 1;
+    uint32_t i;
+
+    if (log_async != NULL || records == 0 ||
+        records > INDIGO_LOG_ASYNC_RECORDS_MAX) {
+        return NULL;
+    }
+
+    while (size < records) {
+        size <<= 1;
+    }
+
+    la = aim_zmalloc(sizeof(*la));
+    la->ring = aim_malloc(size * sizeof(*la->ring));
+    for (i = 0; i < size; i++) {
+        la->ring[i].seq = i;
+    }
+    la->mask = size - 1;
+    la->dest = dest;
+    la->pvs.description = "{async}";
+    la->pvs.vprintf = log_async_vprintf;
+    la->pvs.enabled = 1;
+
+    la->eventfd = eventfd(0, 0);
+    if (la->eventfd < 0) {
+        goto error;
+    }
+
+    if (pthread_create(&la->thread, NULL, log_async_thread, la) != 0) {
+        close(la->eventfd);
+        goto error;
+    }
+
+    /* A placement error is shown with the threads */
+    (void) indigo_thread_register(INDIGO_THREAD_LOG, la->thread);
+
+    log_async = la;
+    return &la->pvs;
+
+error:
+    aim_free(la->ring);
+    aim_free(la);
+    return NULL;
+}
+
+void
+indigo_log_async_stop(void)
+{
+    log_async_t *la = log_async;
+    uint64_t one = 1;
+
+    if (la == NULL) {
+        return;
+    }
+
+    la->stopping = 1;
+    if (write(la->eventfd, &one, sizeof(one)) < 0) {
+        /* The thread still sees stopping once it wakes */
+    }
+    indigo_thread_unregister(la->thread);
+    pthread_join(la->thread, NULL);
+
+    close(la->eventfd);
+    log_async = NULL;
+    aim_free(la->ring);
+    aim_free(la);
+}
+
+void
+indigo_log_async_show(aim_pvs_t *pvs)
+{
+    log_async_t *la = log_async;
+
+    if (la == NULL) {
+        aim_printf(pvs, "Asynchronous log writer off\n");
+        return;
+    }
+
+    aim_printf(pvs, "Asynchronous log writer to %s, %u records\n",
+               la->dest->description ? la->dest->description : "?",
+               la->mask + 1);
+    aim_printf(pvs, "  written %" PRIu64 " dropped %" PRIu64
+               " truncated %" PRIu64 "\n",
+               __atomic_load_n(&la->written, __ATOMIC_RELAXED),
+               __atomic_load_n(&la->dropped, __ATOMIC_RELAXED),
+               __atomic_load_n(&la->truncated, __ATOMIC_RELAXED));
+}
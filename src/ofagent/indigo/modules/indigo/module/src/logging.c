@@ -27,8 +27,38 @@
 #include <AIM/aim.h>
 #include <indigo/indigo_config.h>
 #include <indigo/indigo.h>
+#include <indigo/log.h>
 
 aim_pvs_t* indigo_log_pvs = &aim_pvs_stderr;
 
+int
+indigo_log_rl_take(indigo_log_rl_t *rl, uint32_t *suppressed)
+{
+    indigo_time_t now = INDIGO_CURRENT_TIME;
+    uint64_t refill;
 
+    if (!rl->init) {
+        rl->tokens = INDIGO_LOG_RL_BURST * 1000;
+        rl->refill_time = now;
+        rl->init = 1;
+    } else if (now > rl->refill_time) {
+        /* INDIGO_LOG_RL_PER_SEC messages a second, in thousandths */
+        refill = (now - rl->refill_time) * INDIGO_LOG_RL_PER_SEC;
+        if (refill > INDIGO_LOG_RL_BURST * 1000 - rl->tokens) {
+            rl->tokens = INDIGO_LOG_RL_BURST * 1000;
+        } else {
+            rl->tokens += refill;
+        }
+        rl->refill_time = now;
+    }
 
+    if (rl->tokens < 1000) {
+        rl->suppressed++;
+        return 0;
+    }
+
+    rl->tokens -= 1000;
+    *suppressed = rl->suppressed;
+    rl->suppressed = 0;
+    return 1;
+}
@@ -0,0 +1,212 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/******************************************************************************
+ *
+ *  /module/src/mem_arena.c
+ *
+ *  Process-wide arena of large pages
+ *
+ *****************************************************************************/
+#include <AIM/aim.h>
+#include <indigo/indigo_config.h>
+#include <indigo/indigo.h>
+#include <indigo/mem_arena.h>
+#include <sys/mman.h>
+#include <inttypes.h>
+
+#define CHUNK_BYTES INDIGO_MEM_ARENA_CHUNK_BYTES
+
+/* A freed block, kept for the next allocation of the same size */
+typedef struct arena_free_s {
+    struct arena_free_s *next;
+    uint32_t bytes;
+} arena_free_t;
+
+static struct {
+    uint64_t limit;
+    uint8_t **chunks;
+    int chunk_count;
+    int chunk_max;
+    int huge_chunks;            /* Of chunk_count, from hugetlbfs */
+    uint32_t chunk_offset;      /* Next free byte in the newest chunk */
+    arena_free_t *free_list;
+    uint64_t used;
+    uint64_t free_bytes;        /* On the free list */
+    uint64_t fallbacks;         /* Allocations left to the heap */
+} mem_arena;
+
+void
+indigo_mem_arena_limit_set(uint64_t bytes)
+{
+    int chunk_max = bytes / CHUNK_BYTES;
+
+    if (chunk_max < mem_arena.chunk_count) {
+        chunk_max = mem_arena.chunk_count;
+    }
+
+    mem_arena.chunks = aim_realloc(mem_arena.chunks,
+                                   (chunk_max + 1) * sizeof(*mem_arena.chunks));
+    mem_arena.chunk_max = chunk_max;
+    mem_arena.limit = (uint64_t)chunk_max * CHUNK_BYTES;
+}
+
+/*
+ * Map a chunk from hugetlbfs, or failing that a chunk aligned on 2 MiB
+ * so transparent huge pages can back it.
+ */
+
+static uint8_t *
+chunk_map(int *huge)
+{
+    uint8_t *map, *chunk;
+    uintptr_t head;
+
+#ifdef MAP_HUGETLB
+    map = mmap(NULL, CHUNK_BYTES, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (map != MAP_FAILED) {
+        *huge = 1;
+        return map;
+    }
+#endif
+
+    map = mmap(NULL, 2 * CHUNK_BYTES, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == MAP_FAILED) {
+        return NULL;
+    }
+
+    head = (CHUNK_BYTES - ((uintptr_t)map & (CHUNK_BYTES - 1))) & (CHUNK_BYTES - 1);
+    chunk = map + head;
+    if (head > 0) {
+        munmap(map, head);
+    }
+    munmap(chunk + CHUNK_BYTES, CHUNK_BYTES - head);
+
+#ifdef MADV_HUGEPAGE
+    (void) madvise(chunk, CHUNK_BYTES, MADV_HUGEPAGE);
+#endif
+
+    *huge = 0;
+    return chunk;
+}
+
+void *
+indigo_mem_arena_alloc(uint32_t bytes)
+{
+    arena_free_t **prev, *block;
+    uint8_t *chunk;
+    int huge;
+
+    if (mem_arena.limit == 0) {
+        return NULL;
+    }
+
+    bytes = (bytes + INDIGO_MEM_ARENA_ALIGN - 1) & ~(INDIGO_MEM_ARENA_ALIGN - 1);
+    if (bytes > CHUNK_BYTES) {
+        mem_arena.fallbacks++;
+        return NULL;
+    }
+
+    for (prev = &mem_arena.free_list; *prev != NULL; prev = &(*prev)->next) {
+        block = *prev;
+        if (block->bytes == bytes) {
+            *prev = block->next;
+            mem_arena.free_bytes -= bytes;
+            mem_arena.used += bytes;
+            return block;
+        }
+    }
+
+    if (mem_arena.chunk_count == 0 ||
+        mem_arena.chunk_offset + bytes > CHUNK_BYTES) {
+        /* The rest of the newest chunk is left unused */
+        if (mem_arena.chunk_count == mem_arena.chunk_max ||
+            (chunk = chunk_map(&huge)) == NULL) {
+            mem_arena.fallbacks++;
+            return NULL;
+        }
+        mem_arena.chunks[mem_arena.chunk_count++] = chunk;
+        mem_arena.huge_chunks += huge;
+        mem_arena.chunk_offset = 0;
+    }
+
+    chunk = mem_arena.chunks[mem_arena.chunk_count - 1];
+    block = (arena_free_t *)(chunk + mem_arena.chunk_offset);
+    mem_arena.chunk_offset += bytes;
+    mem_arena.used += bytes;
+
+    return block;
+}
+
+void
+indigo_mem_arena_free(void *ptr, uint32_t bytes)
+{
+    arena_free_t *block = ptr;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    AIM_ASSERT(indigo_mem_arena_contains(ptr));
+
+    bytes = (bytes + INDIGO_MEM_ARENA_ALIGN - 1) & ~(INDIGO_MEM_ARENA_ALIGN - 1);
+    block->bytes = bytes;
+    block->next = mem_arena.free_list;
+    mem_arena.free_list = block;
+    mem_arena.used -= bytes;
+    mem_arena.free_bytes += bytes;
+}
+
+int
+indigo_mem_arena_contains(const void *ptr)
+{
+    const uint8_t *p = ptr;
+    int i;
+
+    for (i = 0; i < mem_arena.chunk_count; i++) {
+        if (p >= mem_arena.chunks[i] && p < mem_arena.chunks[i] + CHUNK_BYTES) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+uint64_t
+indigo_mem_arena_bytes(void)
+{
+    return (uint64_t)mem_arena.chunk_count * CHUNK_BYTES;
+}
+
+void
+indigo_mem_arena_show(aim_pvs_t *pvs)
+{
+    if (mem_arena.limit == 0) {
+        aim_printf(pvs, "Arena:      none\n");
+        return;
+    }
+
+    aim_printf(pvs, "Arena:      %d of %d chunks, %d on huge pages, "
+               "%" PRIu64 " KB in use, %" PRIu64 " KB free, %" PRIu64 " heap fallbacks\n",
+               mem_arena.chunk_count, mem_arena.chunk_max,
+               mem_arena.huge_chunks, mem_arena.used / 1024,
+               mem_arena.free_bytes / 1024, mem_arena.fallbacks);
+}
@@ -0,0 +1,122 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/******************************************************************************
+ *
+ *  /module/src/mem_budget.c
+ *
+ *  Process-wide memory budget
+ *
+ *****************************************************************************/
+#include <AIM/aim.h>
+#include <indigo/indigo_config.h>
+#include <indigo/indigo.h>
+#include <indigo/mem_budget.h>
+#include <inttypes.h>
+
+static const char *class_names[INDIGO_MEM_BUDGET_CLASS_COUNT] = {
+    "output",
+    "request",
+    "reply",
+};
+
+static struct {
+    uint64_t limit;
+    uint64_t pressure;          /* Threshold in bytes */
+    uint64_t used;
+    uint64_t used_high;
+    uint64_t class_used[INDIGO_MEM_BUDGET_CLASS_COUNT];
+    uint64_t class_high[INDIGO_MEM_BUDGET_CLASS_COUNT];
+    uint64_t refused;
+} mem_budget;
+
+void
+indigo_mem_budget_limit_set(uint64_t bytes)
+{
+    mem_budget.limit = bytes;
+    mem_budget.pressure = bytes / 100 * INDIGO_MEM_BUDGET_PRESSURE_PERCENT;
+}
+
+uint64_t
+indigo_mem_budget_limit_get(void)
+{
+    return mem_budget.limit;
+}
+
+void
+indigo_mem_budget_charge(indigo_mem_budget_class_t cls, uint32_t bytes)
+{
+    mem_budget.used += bytes;
+    if (mem_budget.used > mem_budget.used_high) {
+        mem_budget.used_high = mem_budget.used;
+    }
+
+    mem_budget.class_used[cls] += bytes;
+    if (mem_budget.class_used[cls] > mem_budget.class_high[cls]) {
+        mem_budget.class_high[cls] = mem_budget.class_used[cls];
+    }
+}
+
+void
+indigo_mem_budget_release(indigo_mem_budget_class_t cls, uint32_t bytes)
+{
+    AIM_ASSERT(mem_budget.class_used[cls] >= bytes);
+    mem_budget.used -= bytes;
+    mem_budget.class_used[cls] -= bytes;
+}
+
+int
+indigo_mem_budget_pressure(void)
+{
+    return mem_budget.limit != 0 && mem_budget.used >= mem_budget.pressure;
+}
+
+int
+indigo_mem_budget_admit(void)
+{
+    if (mem_budget.limit != 0 && mem_budget.used >= mem_budget.limit) {
+        mem_budget.refused++;
+        return 0;
+    }
+
+    return 1;
+}
+
+void
+indigo_mem_budget_show(aim_pvs_t *pvs)
+{
+    int i;
+
+    if (mem_budget.limit == 0) {
+        aim_printf(pvs, "Memory budget: no limit\n");
+    } else {
+        aim_printf(pvs, "Memory budget: %" PRIu64 " bytes, pressure at %" PRIu64 " bytes%s\n",
+                   mem_budget.limit, mem_budget.pressure,
+                   indigo_mem_budget_pressure() ? " (under pressure)" : "");
+    }
+
+    aim_printf(pvs, "  %-8s %14s %14s\n", "class", "used", "high");
+    for (i = 0; i < INDIGO_MEM_BUDGET_CLASS_COUNT; i++) {
+        aim_printf(pvs, "  %-8s %14" PRIu64 " %14" PRIu64 "\n", class_names[i],
+                   mem_budget.class_used[i], mem_budget.class_high[i]);
+    }
+    aim_printf(pvs, "  %-8s %14" PRIu64 " %14" PRIu64 "\n", "total",
+               mem_budget.used, mem_budget.used_high);
+    aim_printf(pvs, "  refused %" PRIu64 "\n", mem_budget.refused);
+}
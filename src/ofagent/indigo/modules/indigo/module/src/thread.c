@@ -0,0 +1,344 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/******************************************************************************
+ *
+ *  /module/src/thread.c
+ *
+ *  CPU and scheduling placement of agent threads
+ *
+ *****************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE             /* pthread_setaffinity_np */
+#endif
+#include <pthread.h>
+#include <sched.h>              /* Before AIM, which undefines _GNU_SOURCE */
+#include <AIM/aim.h>
+#include <indigo/indigo_config.h>
+#include <indigo/indigo.h>
+#include <indigo/thread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+static const char *role_names[INDIGO_THREAD_ROLE_COUNT] = {
+    "event_loop",
+    "rx",
+    "flow_worker",
+    "ofdpa_client",
+    "log",
+    "pcap",
+};
+
+static const struct {
+    const char *name;
+    int policy;
+} policies[] = {
+    { "other", SCHED_OTHER },
+    { "fifo", SCHED_FIFO },
+    { "rr", SCHED_RR },
+};
+
+static struct {
+    indigo_thread_placement_t placement[INDIGO_THREAD_ROLE_COUNT];
+    int placed[INDIGO_THREAD_ROLE_COUNT];   /* A placement was set */
+    struct {
+        pthread_t thread;
+        indigo_thread_role_t role;
+        indigo_error_t status;              /* Of the last apply */
+    } threads[INDIGO_THREAD_MAX];
+    int thread_count;
+} thread_placement;
+
+const char *
+indigo_thread_role_name(indigo_thread_role_t role)
+{
+    return role < INDIGO_THREAD_ROLE_COUNT ? role_names[role] : "unknown";
+}
+
+indigo_error_t
+indigo_thread_role_parse(const char *name, indigo_thread_role_t *role)
+{
+    int i;
+
+    for (i = 0; i < INDIGO_THREAD_ROLE_COUNT; i++) {
+        if (!strcmp(name, role_names[i])) {
+            *role = i;
+            return INDIGO_ERROR_NONE;
+        }
+    }
+
+    return INDIGO_ERROR_NOT_FOUND;
+}
+
+/* "0,2-3" into a mask; "*" is 0 */
+static indigo_error_t
+cpus_parse(const char *text, const char *end, uint64_t *cpus)
+{
+    unsigned long first, last;
+    char *next;
+
+    *cpus = 0;
+    if (end - text == 1 && *text == '*') {
+        return INDIGO_ERROR_NONE;
+    }
+
+    while (text < end) {
+        first = strtoul(text, &next, 10);
+        if (next == text) {
+            return INDIGO_ERROR_PARAM;
+        }
+        last = first;
+        if (*next == '-') {
+            text = next + 1;
+            last = strtoul(text, &next, 10);
+            if (next == text) {
+                return INDIGO_ERROR_PARAM;
+            }
+        }
+        if (first > last || last >= 64) {
+            return INDIGO_ERROR_PARAM;
+        }
+        for (; first <= last; first++) {
+            *cpus |= 1ULL << first;
+        }
+
+        if (next < end && *next != ',') {
+            return INDIGO_ERROR_PARAM;
+        }
+        text = next < end ? next + 1 : next;
+    }
+
+    return *cpus != 0 ? INDIGO_ERROR_NONE : INDIGO_ERROR_PARAM;
+}
+
+indigo_error_t
+indigo_thread_placement_parse(const char *text,
+                              indigo_thread_placement_t *placement)
+{
+    const char *slash = strchr(text, '/');
+    const char *policy;
+    char *end;
+    long priority;
+    int min, max;
+    size_t len;
+    unsigned i;
+
+    placement->policy = -1;
+    placement->priority = 0;
+
+    if (cpus_parse(text, slash ? slash : text + strlen(text),
+                   &placement->cpus) < 0) {
+        return INDIGO_ERROR_PARAM;
+    }
+    if (slash == NULL) {
+        return INDIGO_ERROR_NONE;
+    }
+
+    policy = slash + 1;
+    slash = strchr(policy, '/');
+    len = slash ? (size_t)(slash - policy) : strlen(policy);
+    for (i = 0; i < AIM_ARRAYSIZE(policies); i++) {
+        if (len == strlen(policies[i].name) &&
+            !strncmp(policy, policies[i].name, len)) {
+            placement->policy = policies[i].policy;
+            break;
+        }
+    }
+    if (placement->policy < 0) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    min = sched_get_priority_min(placement->policy);
+    max = sched_get_priority_max(placement->policy);
+    if (slash == NULL) {
+        placement->priority = min;
+        return INDIGO_ERROR_NONE;
+    }
+
+    priority = strtol(slash + 1, &end, 10);
+    if (end == slash + 1 || *end != '\0' || priority < min || priority > max) {
+        return INDIGO_ERROR_PARAM;
+    }
+    placement->priority = priority;
+
+    return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t
+placement_apply(pthread_t thread, const indigo_thread_placement_t *placement)
+{
+    struct sched_param param;
+    cpu_set_t set;
+    int cpu;
+
+    if (placement->cpus != 0) {
+        CPU_ZERO(&set);
+        for (cpu = 0; cpu < 64; cpu++) {
+            if (placement->cpus & (1ULL << cpu)) {
+                CPU_SET(cpu, &set);
+            }
+        }
+        if (pthread_setaffinity_np(thread, sizeof(set), &set) != 0) {
+            return INDIGO_ERROR_PARAM;
+        }
+    }
+
+    if (placement->policy >= 0) {
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = placement->priority;
+        if (pthread_setschedparam(thread, placement->policy, &param) != 0) {
+            /* Real-time policies need CAP_SYS_NICE */
+            return INDIGO_ERROR_NOT_SUPPORTED;
+        }
+    }
+
+    return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t
+indigo_thread_placement_set(indigo_thread_role_t role,
+                            const indigo_thread_placement_t *placement)
+{
+    indigo_error_t rv = INDIGO_ERROR_NONE;
+    int i;
+
+    if (role >= INDIGO_THREAD_ROLE_COUNT) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (placement == NULL) {
+        thread_placement.placed[role] = 0;
+        return INDIGO_ERROR_NONE;
+    }
+
+    thread_placement.placement[role] = *placement;
+    thread_placement.placed[role] = 1;
+
+    for (i = 0; i < thread_placement.thread_count; i++) {
+        if (thread_placement.threads[i].role == role) {
+            thread_placement.threads[i].status =
+                placement_apply(thread_placement.threads[i].thread, placement);
+            if (rv == INDIGO_ERROR_NONE) {
+                rv = thread_placement.threads[i].status;
+            }
+        }
+    }
+
+    return rv;
+}
+
+indigo_error_t
+indigo_thread_register(indigo_thread_role_t role, pthread_t thread)
+{
+    int i = thread_placement.thread_count;
+    indigo_error_t rv = INDIGO_ERROR_NONE;
+
+    if (role >= INDIGO_THREAD_ROLE_COUNT) {
+        return INDIGO_ERROR_PARAM;
+    }
+
+    if (thread_placement.placed[role]) {
+        rv = placement_apply(thread, &thread_placement.placement[role]);
+    }
+
+    if (i == INDIGO_THREAD_MAX) {
+        /* Placed once, but later changes will not reach it */
+        return rv;
+    }
+
+    thread_placement.threads[i].thread = thread;
+    thread_placement.threads[i].role = role;
+    thread_placement.threads[i].status = rv;
+    thread_placement.thread_count++;
+
+    return rv;
+}
+
+void
+indigo_thread_unregister(pthread_t thread)
+{
+    int i;
+
+    for (i = 0; i < thread_placement.thread_count; i++) {
+        if (pthread_equal(thread_placement.threads[i].thread, thread)) {
+            thread_placement.threads[i] =
+                thread_placement.threads[--thread_placement.thread_count];
+            return;
+        }
+    }
+}
+
+static void
+placement_show(aim_pvs_t *pvs, const indigo_thread_placement_t *placement)
+{
+    int cpu;
+    int first = 1;
+
+    if (placement->cpus == 0) {
+        aim_printf(pvs, "*");
+    }
+    for (cpu = 0; cpu < 64; cpu++) {
+        if (placement->cpus & (1ULL << cpu)) {
+            aim_printf(pvs, "%s%d", first ? "" : ",", cpu);
+            first = 0;
+        }
+    }
+
+    switch (placement->policy) {
+    case SCHED_OTHER: aim_printf(pvs, "/other"); break;
+    case SCHED_FIFO: aim_printf(pvs, "/fifo/%d", placement->priority); break;
+    case SCHED_RR: aim_printf(pvs, "/rr/%d", placement->priority); break;
+    default: break;
+    }
+}
+
+void
+indigo_thread_show(aim_pvs_t *pvs)
+{
+    int role, i, count;
+
+    aim_printf(pvs, "  %-14s %-20s %s\n", "role", "placement", "threads");
+    for (role = 0; role < INDIGO_THREAD_ROLE_COUNT; role++) {
+        aim_printf(pvs, "  %-14s ", role_names[role]);
+        if (thread_placement.placed[role]) {
+            placement_show(pvs, &thread_placement.placement[role]);
+        } else {
+            aim_printf(pvs, "-");
+        }
+
+        count = 0;
+        for (i = 0; i < thread_placement.thread_count; i++) {
+            if (thread_placement.threads[i].role == (indigo_thread_role_t)role) {
+                count++;
+            }
+        }
+        aim_printf(pvs, "\t%d", count);
+
+        for (i = 0; i < thread_placement.thread_count; i++) {
+            if (thread_placement.threads[i].role == (indigo_thread_role_t)role &&
+                thread_placement.threads[i].status != INDIGO_ERROR_NONE) {
+                aim_printf(pvs, " (not applied: %s)",
+                           indigo_strerror(thread_placement.threads[i].status));
+                break;
+            }
+        }
+        aim_printf(pvs, "\n");
+    }
+}
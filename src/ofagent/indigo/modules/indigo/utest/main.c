@@ -34,6 +34,7 @@
 #include <indigo/of_state_manager.h>
 #include <indigo/forwarding.h>
 #include <indigo/port_manager.h>
+#include <indigo/debug_counter.h>
 
 #define AIM_LOG_MODULE_NAME indigo
 #include <AIM/aim_log.h>
@@ -48,10 +49,42 @@ AIM_LOG_STRUCT_DEFINE(
                       0x0   /* Initial custom flags */
                       );
 
+static uint64_t
+test_counter_get(debug_counter_t *counter)
+{
+    return *(uint64_t *)counter->cookie;
+}
+
+static void
+test_debug_counters(void)
+{
+    static debug_counter_t a, b;
+    uint64_t b_value = 42;
+
+    debug_counter_register(&a, "test.a", "Test counter a");
+    debug_counter_register_get(&b, "test.b", "Test counter b",
+                               test_counter_get, &b_value);
+    AIM_TRUE_OR_DIE(a.counter_id != 0 && b.counter_id != a.counter_id);
+
+    debug_counter_inc(&a);
+    debug_counter_add(&a, 2);
+    AIM_TRUE_OR_DIE(debug_counter_get(&a) == 3);
+    AIM_TRUE_OR_DIE(debug_counter_get(&b) == 42);
+
+    AIM_TRUE_OR_DIE(list_length(debug_counter_list()) == 2);
+
+    debug_counter_unregister(&a);
+    debug_counter_unregister(&a);
+    AIM_TRUE_OR_DIE(list_length(debug_counter_list()) == 1);
+    debug_counter_unregister(&b);
+    AIM_TRUE_OR_DIE(list_empty(debug_counter_list()));
+}
+
 int
 main(int argc, char* argv[])
 {
     INDIGO_ASSERT(1==1);
+    test_debug_counters();
     AIM_LOG_INFO("Okay.");
     return 0;
 }
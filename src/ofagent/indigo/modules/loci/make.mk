@@ -28,6 +28,10 @@ LOCI := $(SUBMODULE_LOXIGEN_ARTIFACTS)/loci
 
 loci_INCLUDES := -I $(LOCI)/inc
 loci_INTERNAL_INCLUDES := -I $(LOCI)/src
+ifdef LOCI_SINGLE_VERSION
+# e.g. LOCI_SINGLE_VERSION=OF_VERSION_1_3; see loci_base.h
+GLOBAL_CFLAGS += -DLOCI_SINGLE_VERSION=$(LOCI_SINGLE_VERSION)
+endif
 ifndef DEBUG
 loci_CFLAGS := -Os
 endif
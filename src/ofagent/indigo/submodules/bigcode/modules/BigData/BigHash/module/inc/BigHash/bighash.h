@@ -50,8 +50,35 @@ typedef struct bighash_table_s {
 
     /** Current number of entries in this table. */
     int entry_count;
+
+    /** Auto-grow load factor (entries per bucket), 0 if disabled */
+    int grow_load;
+    /** Bucket count when the grow in progress started */
+    int base_count;
+    /** Allocated size of the bucket array */
+    int bucket_alloc;
+    /** Number of completed grows */
+    int grow_count;
 } bighash_table_t;
 
+/**
+ * Table utilization summary
+ */
+typedef struct bighash_table_stats_s {
+    /** Buckets in use */
+    int bucket_count;
+    /** Entries in the table */
+    int entry_count;
+    /** Buckets with no entries */
+    int empty_buckets;
+    /** Longest chain */
+    int max_chain;
+    /** Completed grows */
+    int grow_count;
+    /** A grow is still migrating buckets */
+    int growing;
+} bighash_table_stats_t;
+
 
 /**
  * Iterator over hastable entries
@@ -106,6 +133,20 @@ int bighash_table_init(bighash_table_t *table, int bucket_count);
  */
 int bighash_table_init_static(bighash_table_t *table);
 
+/**
+ * @brief Let a table grow its bucket array as entries are added.
+ * @param table The hash table. Its buckets must have been allocated
+ * by bighash_table_create or bighash_table_init.
+ * @param max_load Average chain length that triggers a grow, or 0 to
+ * stop growing. Stopping finishes a grow in progress.
+ * @returns 0 on success, -1 if the buckets were not allocated here.
+ * @note Growing doubles the bucket count, splitting a few old buckets
+ * on each insert rather than rehashing the whole table at once. An
+ * insert while iterating over a growing table may return an entry
+ * twice.
+ */
+int bighash_table_autogrow_set(bighash_table_t *table, int max_load);
+
 /**
  * Callback for entry destruction.
  */
@@ -158,6 +199,15 @@ void bighash_remove(bighash_table_t *table, bighash_entry_t *entry);
  */
 void bighash_table_utilization_show(bighash_table_t *table, aim_pvs_t *pvs);
 
+/**
+ * @brief Get a utilization summary.
+ * @param table The hash table.
+ * @param stats Filled in with the summary.
+ * @note This walks every bucket.
+ */
+void bighash_table_stats_get(bighash_table_t *table,
+                             bighash_table_stats_t *stats);
+
 /**
  * @brief Start iteration over all entries in the table.
  * @param table The hash table.
@@ -34,6 +34,7 @@ The documentation overview for this module should go here.
  * @{
  *
  * @defgroup bighash-bighash Public Interface
+ * @defgroup bighash-intkey Integer Key Table Interface
  * @defgroup bighash-config Compile Time Configuration
  * @defgroup bighash-porting Porting Macros
  *
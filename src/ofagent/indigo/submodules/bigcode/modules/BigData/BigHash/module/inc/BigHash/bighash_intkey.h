@@ -0,0 +1,201 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ***************************************************************/
+/************************************************************//**
+ *
+ * @file
+ * @brief Open addressing hash table for integer keys
+ * @addtogroup bighash-intkey
+ * @{
+ *
+ * Maps unique integer keys of up to 64 bits to object pointers. The keys
+ * and pointers are kept together in one slot array that is probed
+ * linearly, with a control byte per slot holding 7 bits of the key's
+ * hash. A lookup usually reads one control byte and one slot and never
+ * touches the stored objects, where a bighash lookup follows a chain
+ * through them.
+ *
+ * A removed entry leaves a tombstone, so entries only move when an
+ * insert resizes the table. Lookups and removes while iterating are
+ * safe; an insert while iterating may return an entry twice or skip one.
+ *
+ * See bighash_intkey_template.h for wrappers keyed by a field of the
+ * stored object.
+ *
+ ***************************************************************/
+#ifndef __BIGHASH_INTKEY_H__
+#define __BIGHASH_INTKEY_H__
+
+#include <BigHash/bighash_config.h>
+#include <stdint.h>
+
+/** Control byte of a slot that was never used */
+#define BIGHASH_INTKEY_EMPTY   0x80
+/** Control byte of a slot whose entry was removed */
+#define BIGHASH_INTKEY_DELETED 0xfe
+
+/**
+ * Table slot
+ */
+typedef struct bighash_intkey_slot_s {
+    /** Key */
+    uint64_t key;
+    /** Stored object */
+    void *obj;
+} bighash_intkey_slot_t;
+
+/**
+ * Integer key table
+ */
+typedef struct bighash_intkey_table_s {
+    /** Per slot control bytes: a hash tag, EMPTY or DELETED */
+    uint8_t *ctrl;
+    /** Slots */
+    bighash_intkey_slot_t *slots;
+    /** Number of slots minus one; the slot count is a power of two */
+    uint32_t mask;
+    /** Number of entries */
+    uint32_t count;
+    /** Number of tombstones */
+    uint32_t deleted;
+    /** Number of completed resizes */
+    uint32_t resize_count;
+} bighash_intkey_table_t;
+
+/**
+ * Iterator over table entries
+ */
+typedef struct bighash_intkey_iter_s {
+    /** Table. Must not be freed during iteration */
+    bighash_intkey_table_t *table;
+    /** Next slot to check */
+    uint32_t index;
+} bighash_intkey_iter_t;
+
+/**
+ * @brief Hash a key.
+ * @param key The key.
+ * @note The finalizer of MurmurHash3, which is all an integer key needs.
+ */
+static inline uint64_t
+bighash_intkey_hash(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+/**
+ * @brief Find the object stored under a key.
+ * @param table The table.
+ * @param key The key.
+ * @returns The object, or NULL if the key is not in the table.
+ */
+static inline void *
+bighash_intkey_find(bighash_intkey_table_t *table, uint64_t key)
+{
+    uint64_t hash = bighash_intkey_hash(key);
+    uint8_t tag = hash >> 57;
+    uint32_t index = hash & table->mask;
+
+    while (1) {
+        uint8_t ctrl = table->ctrl[index];
+        if (ctrl == tag && table->slots[index].key == key) {
+            return table->slots[index].obj;
+        } else if (ctrl == BIGHASH_INTKEY_EMPTY) {
+            return NULL;
+        }
+        index = (index + 1) & table->mask;
+    }
+}
+
+/**
+ * @brief Create a table.
+ * @param size_hint Number of entries expected; the table grows past it
+ * as needed.
+ * @returns The new table.
+ */
+bighash_intkey_table_t *bighash_intkey_table_create(uint32_t size_hint);
+
+/**
+ * Callback for object destruction.
+ */
+typedef void (bighash_intkey_free_f)(void *obj);
+
+/**
+ * @brief Destroy a table.
+ * @param table The table to destroy.
+ * @param free The object free function (optional)
+ */
+void bighash_intkey_table_destroy(bighash_intkey_table_t *table,
+                                  bighash_intkey_free_f free);
+
+/**
+ * @brief Insert an object.
+ * @param table The table.
+ * @param key The key, which must not already be in the table.
+ * @param obj The object.
+ */
+void bighash_intkey_insert(bighash_intkey_table_t *table, uint64_t key,
+                           void *obj);
+
+/**
+ * @brief Remove the object stored under a key.
+ * @param table The table.
+ * @param key The key.
+ * @returns The removed object, or NULL if the key is not in the table.
+ */
+void *bighash_intkey_remove(bighash_intkey_table_t *table, uint64_t key);
+
+/**
+ * @brief Start iteration over all objects in the table.
+ * @param table The table.
+ * @param iter The iterator to initialize.
+ * @returns The first object, or NULL if the table is empty.
+ */
+void *bighash_intkey_iter_start(bighash_intkey_table_t *table,
+                                bighash_intkey_iter_t *iter);
+
+/**
+ * @brief Get the next object in the current iteration.
+ * @param iter The iterator.
+ * @returns The next object, or NULL if the end has been reached.
+ */
+void *bighash_intkey_iter_next(bighash_intkey_iter_t *iter);
+
+/**
+ * @brief Get the number of entries in the table.
+ * @param table The table.
+ */
+static inline int
+bighash_intkey_count(bighash_intkey_table_t *table)
+{
+    return table->count;
+}
+
+/**
+ * @brief Heap bytes held by the table, not counting the stored objects.
+ * @param table The table.
+ */
+uint64_t bighash_intkey_table_bytes(bighash_intkey_table_t *table);
+
+#endif /* __BIGHASH_INTKEY_H__ */
+/* @} */
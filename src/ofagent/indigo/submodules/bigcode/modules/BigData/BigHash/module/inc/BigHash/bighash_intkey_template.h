@@ -0,0 +1,89 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ***************************************************************/
+/*
+ * BigHash integer key template
+ *
+ * The counterpart of bighash_template.h for bighash_intkey tables, for
+ * objects with a unique integer key of up to 64 bits. The table holds
+ * pointers to the objects, so no entry field is embedded in them.
+ *
+ * The following macros must be defined before including this file:
+ *   TEMPLATE_NAME - prefix for the created functions
+ *   TEMPLATE_OBJ_TYPE - type (not a pointer) of the stored object
+ *   TEMPLATE_KEY_FIELD - field name of the key
+ *
+ * The above macros will be automatically undefined by this file.
+ *
+ * Iterate with bighash_intkey_iter_start and bighash_intkey_iter_next.
+ */
+
+#include <BigHash/bighash_intkey.h>
+
+#ifndef TEMPLATE_NAME
+#error "Must define TEMPLATE_NAME"
+#endif
+
+#ifndef TEMPLATE_OBJ_TYPE
+#error "Must define TEMPLATE_OBJ_TYPE"
+#endif
+
+#ifndef TEMPLATE_KEY_FIELD
+#error "Must define TEMPLATE_KEY_FIELD"
+#endif
+
+/* Macro to create a function name */
+#define BHIT_NAME_PASTE(X,Y) X ## _ ## Y
+#define BHIT_NAME_EXPAND(X, Y) BHIT_NAME_PASTE(X, Y)
+#define BHIT_NAME(X) BHIT_NAME_EXPAND(TEMPLATE_NAME, X)
+
+/* Derive the key type from the object type and field */
+#define TEMPLATE_KEY_TYPE typeof(((TEMPLATE_OBJ_TYPE *)0)->TEMPLATE_KEY_FIELD)
+
+/* Insert an object; its key must not already be in the table */
+static inline void
+BHIT_NAME(insert)(bighash_intkey_table_t *table, TEMPLATE_OBJ_TYPE *obj)
+{
+    bighash_intkey_insert(table, obj->TEMPLATE_KEY_FIELD, obj);
+}
+
+/* Return the object with 'key', or NULL */
+static inline TEMPLATE_OBJ_TYPE *
+BHIT_NAME(first)(bighash_intkey_table_t *table, const TEMPLATE_KEY_TYPE *key)
+{
+    return bighash_intkey_find(table, *key);
+}
+
+/* Remove an object */
+static inline void
+BHIT_NAME(remove)(bighash_intkey_table_t *table, TEMPLATE_OBJ_TYPE *obj)
+{
+    void *removed = bighash_intkey_remove(table, obj->TEMPLATE_KEY_FIELD);
+    AIM_ASSERT(removed == obj);
+    (void)removed;
+}
+
+#undef BHIT_NAME_PASTE
+#undef BHIT_NAME_EXPAND
+#undef BHIT_NAME
+
+#undef TEMPLATE_KEY_TYPE
+
+#undef TEMPLATE_NAME
+#undef TEMPLATE_OBJ_TYPE
+#undef TEMPLATE_KEY_FIELD
@@ -21,6 +21,9 @@
 #include <BigHash/bighash.h>
 #include "bighash_log.h"
 
+/* Old buckets split per insert while a grow is in progress */
+#define BIGHASH_GROW_SPLITS 2
+
 bighash_table_t *
 bighash_table_create(int bucket_count)
 {
@@ -53,6 +56,8 @@ bighash_table_init(bighash_table_t *table, int bucket_count)
         table->flags |= BIGHASH_TABLE_F_BUCKETS_ALLOCATED;
     }
     table->bucket_count = bucket_count;
+    table->base_count = bucket_count;
+    table->bucket_alloc = bucket_count;
 
     bighash_table_init_buckets__(table);
 
@@ -82,6 +87,8 @@ bighash_table_destroy(bighash_table_t *table, bighash_entry_free_f efree)
         aim_free(table->buckets);
         table->buckets = NULL;
         table->bucket_count = 0;
+        table->base_count = 0;
+        table->bucket_alloc = 0;
     }
 
     if(table->flags & BIGHASH_TABLE_F_TABLE_ALLOCATED) {
@@ -90,17 +97,118 @@ bighash_table_destroy(bighash_table_t *table, bighash_entry_free_f efree)
 }
 
 
+static void bighash_split__(bighash_table_t *table);
+
+int
+bighash_table_autogrow_set(bighash_table_t *table, int max_load)
+{
+    if(max_load > 0 &&
+       !(table->flags & BIGHASH_TABLE_F_BUCKETS_ALLOCATED)) {
+        return -1;
+    }
+    /* Finish a grow in progress; nothing would split the rest */
+    if(max_load == 0) {
+        while(table->bucket_count != table->base_count) {
+            bighash_split__(table);
+        }
+    }
+    table->grow_load = max_load;
+    return 0;
+}
+
+/*
+ * Auto-grow is linear hashing over the modulus: while growing from
+ * base_count buckets to twice that, buckets below the split point
+ * (bucket_count - base_count) have already been split and are indexed
+ * with the doubled modulus. Splitting bucket b only ever moves entries
+ * to bucket b + base_count, so entries never move between unrelated
+ * buckets and bucket_count always covers every entry.
+ */
 bighash_entry_t **
 bighash_bucket(bighash_table_t *table, uint32_t hash)
 {
-    int bucket = hash % table->bucket_count;
+    int bucket;
+    if(table->bucket_count == table->base_count) {
+        bucket = hash % table->bucket_count;
+    }
+    else {
+        bucket = hash % table->base_count;
+        if(bucket < table->bucket_count - table->base_count) {
+            bucket = hash % (table->base_count * 2);
+        }
+    }
     return &table->buckets[bucket];
 }
 
+static void
+bighash_split__(bighash_table_t *table)
+{
+    int b = table->bucket_count - table->base_count;
+    int hi = b + table->base_count;
+    bighash_entry_t *cur = table->buckets[b];
+    bighash_entry_t **lo_tail = &table->buckets[b];
+    bighash_entry_t **hi_tail = &table->buckets[hi];
+
+    /* Keep chain order so entries with equal hashes stay newest first */
+    while(cur != NULL) {
+        bighash_entry_t *next = cur->next;
+        if((int)(cur->hash % (table->base_count * 2)) == hi) {
+            *hi_tail = cur;
+            hi_tail = &cur->next;
+        }
+        else {
+            *lo_tail = cur;
+            lo_tail = &cur->next;
+        }
+        cur = next;
+    }
+    *lo_tail = NULL;
+    *hi_tail = NULL;
+
+    table->bucket_count++;
+    if(table->bucket_count == table->base_count * 2) {
+        table->base_count = table->bucket_count;
+        table->grow_count++;
+    }
+}
+
+static void
+bighash_grow__(bighash_table_t *table)
+{
+    int i;
+
+    if(table->bucket_count == table->base_count) {
+        if(table->entry_count < table->grow_load * table->bucket_count ||
+           table->bucket_count > INT32_MAX / 2) {
+            return;
+        }
+        if(table->bucket_alloc < table->bucket_count * 2) {
+            table->buckets = aim_realloc(table->buckets,
+                                         sizeof(table->buckets[0]) *
+                                         table->bucket_count * 2);
+            table->bucket_alloc = table->bucket_count * 2;
+        }
+        for(i = table->bucket_count; i < table->bucket_count * 2; i++) {
+            table->buckets[i] = NULL;
+        }
+    }
+
+    for(i = 0; i < BIGHASH_GROW_SPLITS; i++) {
+        bighash_split__(table);
+        if(table->bucket_count == table->base_count) {
+            break;
+        }
+    }
+}
+
 void
 bighash_insert(bighash_table_t *table, bighash_entry_t *e, uint32_t hash)
 {
-    bighash_entry_t **bucket = bighash_bucket(table, hash);
+    bighash_entry_t **bucket;
+    if(table->grow_load) {
+        bighash_grow__(table);
+    }
+    bucket = bighash_bucket(table, hash);
     e->next = *bucket;
     e->hash = hash;
     *bucket = e;
@@ -155,8 +263,17 @@ bighash_table_utilization_show(bighash_table_t *table, aim_pvs_t *pvs)
 {
     int i;
     int count = 0;
+    bighash_table_stats_t stats;
 
+    bighash_table_stats_get(table, &stats);
     aim_printf(pvs, "table: %d buckets\n", table->bucket_count);
+    aim_printf(pvs, "entries: %d load: %d.%.2d empty: %d max chain: %d grows: %d%s\n",
+               stats.entry_count,
+               stats.bucket_count ? stats.entry_count / stats.bucket_count : 0,
+               stats.bucket_count ?
+               (stats.entry_count * 100 / stats.bucket_count) % 100 : 0,
+               stats.empty_buckets, stats.max_chain, stats.grow_count,
+               stats.growing ? " (growing)" : "");
 
     for(i = 0; i < table->bucket_count; i++) {
         int c = 0;
@@ -170,6 +287,34 @@ bighash_table_utilization_show(bighash_table_t *table, aim_pvs_t *pvs)
     }
 }
 
+void
+bighash_table_stats_get(bighash_table_t *table, bighash_table_stats_t *stats)
+{
+    int i;
+
+    AIM_MEMSET(stats, 0, sizeof(*stats));
+    stats->bucket_count = table->bucket_count;
+    stats->entry_count = table->entry_count;
+    stats->grow_count = table->grow_count;
+    stats->growing = table->grow_load &&
+        table->bucket_count != table->base_count;
+
+    for(i = 0; i < table->bucket_count; i++) {
+        int c = 0;
+        bighash_entry_t *cur = table->buckets[i];
+        while (cur != NULL) {
+            c++;
+            cur = cur->next;
+        }
+        if(c == 0) {
+            stats->empty_buckets++;
+        }
+        if(c > stats->max_chain) {
+            stats->max_chain = c;
+        }
+    }
+}
+
 static int
 next_nonempty_bucket__(bighash_table_t *table, int current)
 {
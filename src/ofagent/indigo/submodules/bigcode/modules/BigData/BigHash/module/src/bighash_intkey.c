@@ -0,0 +1,205 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ***************************************************************/
+
+#include <BigHash/bighash_config.h>
+#include <BigHash/bighash_intkey.h>
+#include <string.h>
+#include <inttypes.h>
+#include "bighash_log.h"
+
+/* Smallest slot count */
+#define BIGHASH_INTKEY_MIN_SLOTS 16
+
+/* Slot count for count entries, at most 7/16 full */
+static uint32_t
+bighash_intkey_slots_for__(uint32_t count)
+{
+    uint32_t slots = BIGHASH_INTKEY_MIN_SLOTS;
+    while ((uint64_t)count * 16 > (uint64_t)slots * 7) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+static void
+bighash_intkey_alloc__(bighash_intkey_table_t *table, uint32_t slots)
+{
+    table->ctrl = aim_malloc(slots);
+    memset(table->ctrl, BIGHASH_INTKEY_EMPTY, slots);
+    table->slots = aim_malloc(slots * sizeof(table->slots[0]));
+    table->mask = slots - 1;
+    table->count = 0;
+    table->deleted = 0;
+}
+
+/* Store in the first free slot; the key is known to be absent */
+static void
+bighash_intkey_place__(bighash_intkey_table_t *table, uint64_t key, void *obj)
+{
+    uint64_t hash = bighash_intkey_hash(key);
+    uint32_t index = hash & table->mask;
+
+    while (table->ctrl[index] != BIGHASH_INTKEY_EMPTY &&
+           table->ctrl[index] != BIGHASH_INTKEY_DELETED) {
+        index = (index + 1) & table->mask;
+    }
+
+    if (table->ctrl[index] == BIGHASH_INTKEY_DELETED) {
+        table->deleted--;
+    }
+    table->ctrl[index] = hash >> 57;
+    table->slots[index].key = key;
+    table->slots[index].obj = obj;
+    table->count++;
+}
+
+/*
+ * Rehash into a new slot array, dropping the tombstones. The size only
+ * grows, so a table emptied by removes keeps its slots.
+ */
+static void
+bighash_intkey_resize__(bighash_intkey_table_t *table, uint32_t count)
+{
+    uint8_t *ctrl = table->ctrl;
+    bighash_intkey_slot_t *slots = table->slots;
+    uint32_t old_slots = table->mask + 1;
+    uint32_t new_slots = bighash_intkey_slots_for__(count);
+    uint32_t i;
+
+    if (new_slots < old_slots) {
+        new_slots = old_slots;
+    }
+
+    bighash_intkey_alloc__(table, new_slots);
+    for (i = 0; i < old_slots; i++) {
+        if (ctrl[i] != BIGHASH_INTKEY_EMPTY && ctrl[i] != BIGHASH_INTKEY_DELETED) {
+            bighash_intkey_place__(table, slots[i].key, slots[i].obj);
+        }
+    }
+
+    aim_free(ctrl);
+    aim_free(slots);
+    table->resize_count++;
+}
+
+bighash_intkey_table_t *
+bighash_intkey_table_create(uint32_t size_hint)
+{
+    bighash_intkey_table_t *table = aim_zmalloc(sizeof(*table));
+    bighash_intkey_alloc__(table, bighash_intkey_slots_for__(size_hint));
+    return table;
+}
+
+void
+bighash_intkey_table_destroy(bighash_intkey_table_t *table,
+                             bighash_intkey_free_f free)
+{
+    uint32_t i;
+
+    if (table == NULL) {
+        return;
+    }
+
+    if (free != NULL) {
+        for (i = 0; i <= table->mask; i++) {
+            if (table->ctrl[i] != BIGHASH_INTKEY_EMPTY &&
+                table->ctrl[i] != BIGHASH_INTKEY_DELETED) {
+                free(table->slots[i].obj);
+            }
+        }
+    }
+
+    aim_free(table->ctrl);
+    aim_free(table->slots);
+    aim_free(table);
+}
+
+void
+bighash_intkey_insert(bighash_intkey_table_t *table, uint64_t key, void *obj)
+{
+    AIM_ASSERT(bighash_intkey_find(table, key) == NULL,
+               "Duplicate key %" PRIu64 " in integer key table", key);
+
+    /* Keep at least one slot in eight empty so probes terminate quickly */
+    if ((uint64_t)(table->count + table->deleted + 1) * 8 >
+        (uint64_t)(table->mask + 1) * 7) {
+        bighash_intkey_resize__(table, table->count + 1);
+    }
+
+    bighash_intkey_place__(table, key, obj);
+}
+
+void *
+bighash_intkey_remove(bighash_intkey_table_t *table, uint64_t key)
+{
+    uint64_t hash = bighash_intkey_hash(key);
+    uint8_t tag = hash >> 57;
+    uint32_t index = hash & table->mask;
+    void *obj;
+
+    while (table->ctrl[index] != BIGHASH_INTKEY_EMPTY) {
+        if (table->ctrl[index] == tag && table->slots[index].key == key) {
+            obj = table->slots[index].obj;
+            /* No probe continues past an empty slot, so none needs a tombstone */
+            if (table->ctrl[(index + 1) & table->mask] == BIGHASH_INTKEY_EMPTY) {
+                table->ctrl[index] = BIGHASH_INTKEY_EMPTY;
+            } else {
+                table->ctrl[index] = BIGHASH_INTKEY_DELETED;
+                table->deleted++;
+            }
+            table->count--;
+            return obj;
+        }
+        index = (index + 1) & table->mask;
+    }
+
+    return NULL;
+}
+
+void *
+bighash_intkey_iter_start(bighash_intkey_table_t *table,
+                          bighash_intkey_iter_t *iter)
+{
+    iter->table = table;
+    iter->index = 0;
+    return bighash_intkey_iter_next(iter);
+}
+
+void *
+bighash_intkey_iter_next(bighash_intkey_iter_t *iter)
+{
+    bighash_intkey_table_t *table = iter->table;
+
+    while (iter->index <= table->mask) {
+        uint32_t index = iter->index++;
+        if (table->ctrl[index] != BIGHASH_INTKEY_EMPTY &&
+            table->ctrl[index] != BIGHASH_INTKEY_DELETED) {
+            return table->slots[index].obj;
+        }
+    }
+
+    return NULL;
+}
+
+uint64_t
+bighash_intkey_table_bytes(bighash_intkey_table_t *table)
+{
+    uint64_t slots = (uint64_t)table->mask + 1;
+    return sizeof(*table) + slots * (1 + sizeof(table->slots[0]));
+}
@@ -206,6 +206,75 @@ test_template(void)
     return 0;
 }
 
+typedef struct test_intkey_entry_s {
+    uint32_t id;
+    int found;
+} test_intkey_entry_t;
+
+#define TEMPLATE_NAME test_intkey_hashtable
+#define TEMPLATE_OBJ_TYPE test_intkey_entry_t
+#define TEMPLATE_KEY_FIELD id
+#include <BigHash/bighash_intkey_template.h>
+
+int
+test_intkey(void)
+{
+    bighash_intkey_table_t *table = bighash_intkey_table_create(4);
+    bighash_intkey_iter_t iter;
+    test_intkey_entry_t *entries;
+    test_intkey_entry_t *te;
+    int count = 10000;
+    uint32_t key;
+    int i;
+
+    entries = aim_zmalloc(count * sizeof(*entries));
+    for (i = 0; i < count; i++) {
+        entries[i].id = i * 7919;
+        test_intkey_hashtable_insert(table, &entries[i]);
+    }
+    assert(bighash_intkey_count(table) == count);
+    assert(table->resize_count > 0);
+
+    for (i = 0; i < count; i++) {
+        key = i * 7919;
+        assert(test_intkey_hashtable_first(table, &key) == &entries[i]);
+    }
+    key = 1;
+    assert(test_intkey_hashtable_first(table, &key) == NULL);
+
+    /* Remove the odd entries while iterating; the rest are each seen once */
+    for (te = bighash_intkey_iter_start(table, &iter); te;
+         te = bighash_intkey_iter_next(&iter)) {
+        assert(!te->found);
+        te->found = 1;
+        if ((te - entries) % 2) {
+            test_intkey_hashtable_remove(table, te);
+        }
+    }
+    assert(bighash_intkey_count(table) == count / 2);
+
+    for (i = 0; i < count; i++) {
+        assert(entries[i].found);
+        key = i * 7919;
+        te = test_intkey_hashtable_first(table, &key);
+        assert(te == ((i % 2) ? NULL : &entries[i]));
+    }
+
+    /* Tombstones are reused and cleared without growing the table */
+    for (i = 0; i < count * 4; i++) {
+        te = &entries[1 + 2 * (i % (count / 2))];
+        test_intkey_hashtable_insert(table, te);
+        test_intkey_hashtable_remove(table, te);
+    }
+    assert(bighash_intkey_count(table) == count / 2);
+    assert(table->mask + 1 <= 2 * 16384);
+
+    bighash_intkey_table_destroy(table, NULL);
+    aim_free(entries);
+
+    return 0;
+}
+
 int main(int argc, char *argv[])
 {
     biglist_t *entries = NULL;
@@ -287,7 +356,73 @@ int main(int argc, char *argv[])
     bighash_table_utilization_show(&static_table, &aim_pvs_stdout);
     bighash_table_destroy(&static_table, free_test_entry);
 
+    /** Auto-grow: entries stay reachable while buckets are split */
+    {
+        bighash_table_t *table;
+        bighash_table_stats_t stats;
+        table = bighash_table_create(16);
+        if(bighash_table_autogrow_set(table, 4) != 0) {
+            AIM_DIE("Could not enable auto-grow.");
+        }
+        insert__(table, 10000, &entries);
+        bighash_table_stats_get(table, &stats);
+        if(stats.grow_count == 0 || stats.entry_count != 10000 ||
+           stats.bucket_count < 10000 / 8) {
+            AIM_DIE("Table did not grow (buckets=%d, grows=%d)",
+                    stats.bucket_count, stats.grow_count);
+        }
+        bighash_table_utilization_show(table, &aim_pvs_stdout);
+        test_table_data__(table, &entries);
+        bighash_table_destroy(table, NULL);
+
+        /* Stopping a grow part way finishes its splits */
+        table = bighash_table_create(16);
+        bighash_table_autogrow_set(table, 4);
+        insert__(table, 66, &entries);
+        if(table->bucket_count == table->base_count) {
+            AIM_DIE("Expected a grow in progress (buckets=%d)",
+                    table->bucket_count);
+        }
+        bighash_table_autogrow_set(table, 0);
+        if(table->bucket_count != table->base_count) {
+            AIM_DIE("Grow not finished (buckets=%d, base=%d)",
+                    table->bucket_count, table->base_count);
+        }
+        test_table_data__(table, &entries);
+        bighash_table_destroy(table, NULL);
+
+        /* Static buckets cannot grow */
+        bighash_table_init_static(&static_table);
+        if(bighash_table_autogrow_set(&static_table, 4) != -1) {
+            AIM_DIE("Auto-grow enabled on a static table.");
+        }
+        bighash_table_destroy(&static_table, NULL);
+    }
+
     test_template();
+    test_intkey();
+
+    /** Template ordering survives a split */
+    {
+        bighash_table_t *table = bighash_table_create(1);
+        test_entry_t e[4] = { { 1, 0 }, { 1, 0 }, { 1, 0 }, { 2, 0 } };
+        test_entry_t *fe;
+        uint32_t key = 1;
+        int i;
+        bighash_table_autogrow_set(table, 1);
+        for(i = 0; i < 4; i++) {
+            test_hashtable_insert(table, &e[i]);
+        }
+        assert(table->bucket_count > 1);
+        fe = test_hashtable_first(table, &key);
+        assert(fe == &e[2]);
+        fe = test_hashtable_next(fe);
+        assert(fe == &e[1]);
+        fe = test_hashtable_next(fe);
+        assert(fe == &e[0]);
+        assert(test_hashtable_next(fe) == NULL);
+        bighash_table_destroy(table, NULL);
+    }
 
     return 0;
 }
@@ -28,6 +28,7 @@ Simple doubly-linked list implementation.
  *
  * @defgroup biglist-biglist Linked List Interface
  * @defgroup biglist-locked  Locked Linked List Interface
+ * @defgroup biglist-queue   List Queue Interface
  * @defgroup biglist-config Compile-Time Configuration
  *
  * @}
@@ -0,0 +1,99 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+/*************************************************************//**
+ *
+ * module/inc/biglist_queue.h
+ *
+ * @file
+ * @brief List Queue Interface
+ *
+ * @addtogroup biglist-queue
+ * @{
+ *
+ ****************************************************************/
+
+#ifndef __BIGLIST_QUEUE_H__
+#define __BIGLIST_QUEUE_H__
+
+#include <BigList/biglist_config.h>
+#include <BigList/biglist.h>
+
+/**
+ * FIFO queue built on biglist elements.
+ *
+ * The queue keeps a tail pointer so appends are O(1), and recycles
+ * shifted elements through a small free pool instead of allocating
+ * one per append. The head is an ordinary biglist and may be walked
+ * with BIGLIST_FOREACH.
+ */
+typedef struct biglist_queue_s {
+    /** First element */
+    biglist_t* head;
+    /** Last element */
+    biglist_t* tail;
+    /** Number of queued elements */
+    int count;
+
+    /** Spare elements, linked through next */
+    biglist_t* pool;
+    /** Number of spare elements */
+    int pool_count;
+    /** Maximum number of spare elements kept */
+    int pool_max;
+} biglist_queue_t;
+
+/**
+ * @brief Initialize a queue.
+ * @param q The queue.
+ * @param pool_max Number of spare elements to keep for reuse.
+ */
+void biglist_queue_init(biglist_queue_t* q, int pool_max);
+
+/**
+ * @brief Append to the queue.
+ * @param q The queue.
+ * @param data The data to append.
+ * @returns 0 on success, -1 if an element could not be allocated.
+ */
+int biglist_queue_push(biglist_queue_t* q, void* data);
+
+/**
+ * @brief Remove the first element of the queue.
+ * @param q The queue.
+ * @returns The element's data, or NULL if the queue is empty.
+ */
+void* biglist_queue_shift(biglist_queue_t* q);
+
+/**
+ * @brief Get the first element's data without removing it.
+ * @param q The queue.
+ */
+#define BIGLIST_QUEUE_PEEK(_q) ( (_q)->head ? (_q)->head->data : NULL )
+
+/**
+ * @brief Free all elements, including the pool.
+ * @param q The queue.
+ * @param free_function Called on each queued element's data (optional).
+ * @returns The number of queued elements freed.
+ */
+int biglist_queue_free_all(biglist_queue_t* q, biglist_free_f free_function);
+
+#endif /* __BIGLIST_QUEUE_H__ */
+/* @} */
@@ -23,6 +23,7 @@
 #include <BigList/biglist_config.h>
 #include <BigList/biglist.h>
 #include <BigList/biglist_locked.h>
+#include <BigList/biglist_queue.h>
 
 
 #endif /* __BIGLIST_INT_H__ */
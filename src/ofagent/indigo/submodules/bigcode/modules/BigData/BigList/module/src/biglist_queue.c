@@ -0,0 +1,105 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ****************************************************************/
+
+#include "biglist_int.h"
+
+void
+biglist_queue_init(biglist_queue_t* q, int pool_max)
+{
+    AIM_MEMSET(q, 0, sizeof(*q));
+    q->pool_max = pool_max;
+}
+
+int
+biglist_queue_push(biglist_queue_t* q, void* data)
+{
+    biglist_t* ble = q->pool;
+
+    if(ble) {
+        q->pool = ble->next;
+        q->pool_count--;
+        ble->data = data;
+        ble->next = NULL;
+        ble->previous = q->tail;
+    }
+    else {
+        ble = biglist_alloc(data, q->tail, NULL);
+        if(ble == NULL) {
+            return -1;
+        }
+    }
+
+    if(q->tail) {
+        q->tail->next = ble;
+    }
+    else {
+        q->head = ble;
+    }
+    q->tail = ble;
+    q->count++;
+    return 0;
+}
+
+void*
+biglist_queue_shift(biglist_queue_t* q)
+{
+    biglist_t* ble = q->head;
+    void* data;
+
+    if(ble == NULL) {
+        return NULL;
+    }
+
+    q->head = ble->next;
+    if(q->head) {
+        q->head->previous = NULL;
+    }
+    else {
+        q->tail = NULL;
+    }
+    q->count--;
+
+    data = ble->data;
+    if(q->pool_count < q->pool_max) {
+        ble->next = q->pool;
+        q->pool = ble;
+        q->pool_count++;
+    }
+    else {
+        aim_free(ble);
+    }
+    return data;
+}
+
+int
+biglist_queue_free_all(biglist_queue_t* q, biglist_free_f free_function)
+{
+    int count = biglist_free_all(q->head, free_function);
+    biglist_t* ble;
+
+    while((ble = q->pool)) {
+        q->pool = ble->next;
+        aim_free(ble);
+    }
+
+    q->head = q->tail = NULL;
+    q->count = 0;
+    q->pool_count = 0;
+    return count;
+}
@@ -22,6 +22,7 @@
 #include <string.h>
 
 #include <BigList/biglist.h>
+#include <BigList/biglist_queue.h>
 
 #define FAIL(list, fmt, ...)                                        \
     do {                                                            \
@@ -317,6 +318,46 @@ int utest_BigList(void)
         BLFREE(bl, 10);
         BLFREE(copy, 10);
     }
+
+    /* biglist_queue */
+    {
+        biglist_queue_t q;
+        biglist_queue_init(&q, 4);
+        for(i = 0; i < 10; i++) {
+            biglist_queue_push(&q, IP(i));
+        }
+        if(q.count != 10 || biglist_length(q.head) != 10 ||
+           biglist_last(q.head) != q.tail) {
+            FAIL(q.head, "queue has %d elements, should be 10", q.count);
+        }
+        for(i = 0; i < 6; i++) {
+            if(PI(biglist_queue_shift(&q)) != i) {
+                FAIL(q.head, "queue shift %d out of order", i);
+            }
+        }
+        if(q.pool_count != 4) {
+            FATAL("queue pool has %d elements, should be 4", q.pool_count);
+        }
+        /* Reuses pooled elements */
+        for(i = 10; i < 14; i++) {
+            biglist_queue_push(&q, IP(i));
+        }
+        if(q.pool_count != 0 || PI(BIGLIST_QUEUE_PEEK(&q)) != 6) {
+            FAIL(q.head, "queue pool=%d after reuse", q.pool_count);
+        }
+        for(i = 6; i < 14; i++) {
+            if(PI(biglist_queue_shift(&q)) != i) {
+                FAIL(q.head, "queue shift %d out of order", i);
+            }
+        }
+        if(q.head || q.tail || q.count || biglist_queue_shift(&q)) {
+            FATAL("queue not empty (count=%d)", q.count);
+        }
+        biglist_queue_push(&q, IP(1));
+        if((i = biglist_queue_free_all(&q, NULL)) != 1) {
+            FATAL("queue free returned %d, should be 1", i);
+        }
+    }
     return 0;
 }
 
@@ -133,6 +133,94 @@ void bigring_iter_start(bigring_t* br, int* iter);
 void* bigring_iter_next(bigring_t* br, int* iter);
 
 
+/**
+ * Lock-free BigRing object.
+ *
+ * A bounded FIFO for handing entries between threads without a lock.
+ * Unlike bigring_t, pushing to a full ring fails rather than
+ * replacing the oldest entry, since only the consumer may advance the
+ * head.
+ */
+typedef struct bigring_lf_s bigring_lf_t;
+
+/**
+ * Lock-free ring producer modes.
+ */
+typedef enum bigring_lf_mode_e {
+    /** One producer thread and one consumer thread. */
+    BIGRING_LF_MODE_SPSC,
+    /** Any number of producer threads and one consumer thread. */
+    BIGRING_LF_MODE_MPSC,
+} bigring_lf_mode_t;
+
+/**
+ * @brief Create a lock-free ring.
+ * @param size The minimum number of entries; rounded up to a power of
+ * two, and to at least two.
+ * @param mode The producer mode.
+ * @param free_entry The entry deallocator used by bigring_lf_destroy().
+ */
+bigring_lf_t* bigring_lf_create(int size, bigring_lf_mode_t mode,
+                                bigring_free_entry_f free_entry);
+
+/**
+ * @brief Destroy a lock-free ring.
+ * @param br The ring.
+ * @note Entries still in the ring are freed. No producer or consumer
+ * may be using the ring.
+ */
+void bigring_lf_destroy(bigring_lf_t* br);
+
+/**
+ * @brief Get the capacity of a lock-free ring.
+ * @param br The ring.
+ */
+int bigring_lf_size(bigring_lf_t* br);
+
+/**
+ * @brief Get the number of entries in a lock-free ring.
+ * @param br The ring.
+ * @note This is a snapshot while producers or the consumer are active.
+ */
+int bigring_lf_count(bigring_lf_t* br);
+
+/**
+ * @brief Add an entry to a lock-free ring.
+ * @param br The ring.
+ * @param entry The entry to add; must not be NULL.
+ * @returns 0 on success, -1 if the ring is full.
+ */
+int bigring_lf_push(bigring_lf_t* br, void* entry);
+
+/**
+ * @brief Add entries to a lock-free ring.
+ * @param br The ring.
+ * @param entries The entries to add, in order.
+ * @param count The number of entries.
+ * @returns The number of leading entries added, less than count if
+ * the ring filled up.
+ */
+int bigring_lf_push_batch(bigring_lf_t* br, void** entries, int count);
+
+/**
+ * @brief Remove the next entry from a lock-free ring.
+ * @param br The ring.
+ * @returns The entry, or NULL if the ring is empty.
+ * @note Consumer thread only.
+ */
+void* bigring_lf_shift(bigring_lf_t* br);
+
+/**
+ * @brief Remove up to count entries from a lock-free ring.
+ * @param br The ring.
+ * @param entries Receives the entries, in order.
+ * @param count The maximum number of entries.
+ * @returns The number of entries removed.
+ * @note Consumer thread only.
+ */
+int bigring_lf_shift_batch(bigring_lf_t* br, void** entries, int count);
+
+
 #endif /* __BIGRING_H__ */
 /* @} */
 
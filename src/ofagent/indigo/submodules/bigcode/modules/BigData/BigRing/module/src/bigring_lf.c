@@ -0,0 +1,285 @@
+/****************************************************************
+ *
+ *        Copyright 2013, Big Switch Networks, Inc.
+ *
+ * Licensed under the Eclipse Public License, Version 1.0 (the
+ * "License"); you may not use this file except in compliance
+ * with the License. You may obtain a copy of the License at
+ *
+ *        http://www.eclipse.org/legal/epl-v10.html
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the
+ * License.
+ *
+ ***************************************************************/
+
+#include <BigRing/bigring_config.h>
+#include <BigRing/bigring.h>
+
+/*
+ * Lock-free ring
+ *
+ * head and tail are free-running counters masked into the ring. The
+ * producer and consumer sides live on separate cache lines, and each
+ * side keeps a cached copy of the other's counter so it only reads the
+ * shared one when the cached view says the ring is full or empty.
+ *
+ * In MPSC mode producers claim slots by advancing tail with a CAS and
+ * publish each slot through its sequence number: slot i is free for
+ * position p when seq == p and holds the entry for p when seq == p + 1.
+ * The consumer frees slots in order, so when the last slot of a batch
+ * is free all of the batch is.
+ */
+
+#define BIGRING_LF_CACHE_LINE 64
+
+struct bigring_lf_s {
+    /* Read-only after create */
+    uint32_t mask;
+    bigring_lf_mode_t mode;
+    void** ring;
+    /** MPSC slot sequence numbers; NULL in SPSC mode */
+    uint32_t* seq;
+    bigring_free_entry_f free_entry;
+    char pad0[BIGRING_LF_CACHE_LINE];
+
+    /* Producer side */
+    uint32_t tail;
+    /** SPSC producer's last view of head */
+    uint32_t head_cache;
+    char pad1[BIGRING_LF_CACHE_LINE];
+
+    /* Consumer side */
+    uint32_t head;
+    /** SPSC consumer's last view of tail */
+    uint32_t tail_cache;
+    char pad2[BIGRING_LF_CACHE_LINE];
+};
+
+bigring_lf_t*
+bigring_lf_create(int size, bigring_lf_mode_t mode,
+                  bigring_free_entry_f free_entry)
+{
+    bigring_lf_t* br = aim_zmalloc(sizeof(*br));
+    /* Two slots at least, so that a full slot's sequence number never
+       reads as free for the next lap */
+    uint32_t capacity = 2;
+    uint32_t i;
+
+    while(capacity < (uint32_t)size) {
+        capacity <<= 1;
+    }
+
+    br->mask = capacity - 1;
+    br->mode = mode;
+    br->ring = aim_zmalloc(sizeof(void*)*capacity);
+    br->free_entry = free_entry;
+
+    if(mode == BIGRING_LF_MODE_MPSC) {
+        br->seq = aim_zmalloc(sizeof(uint32_t)*capacity);
+        for(i = 0; i < capacity; i++) {
+            br->seq[i] = i;
+        }
+    }
+
+    return br;
+}
+
+void
+bigring_lf_destroy(bigring_lf_t* br)
+{
+    void* entry;
+
+    while((entry = bigring_lf_shift(br))) {
+        if(br->free_entry) {
+            br->free_entry(entry);
+        }
+    }
+
+    AIM_FREE(br->seq);
+    AIM_FREE(br->ring);
+    AIM_FREE(br);
+}
+
+int
+bigring_lf_size(bigring_lf_t* br)
+{
+    return br->mask + 1;
+}
+
+int
+bigring_lf_count(bigring_lf_t* br)
+{
+    uint32_t head = __atomic_load_n(&br->head, __ATOMIC_ACQUIRE);
+    uint32_t tail = __atomic_load_n(&br->tail, __ATOMIC_ACQUIRE);
+    int32_t count = (int32_t)(tail - head);
+
+    if(count < 0) {
+        return 0;
+    }
+    if(count > (int32_t)br->mask + 1) {
+        return br->mask + 1;
+    }
+    return count;
+}
+
+static int
+bigring_lf_spsc_push__(bigring_lf_t* br, void** entries, int count)
+{
+    uint32_t tail = __atomic_load_n(&br->tail, __ATOMIC_RELAXED);
+    uint32_t space = br->mask + 1 - (tail - br->head_cache);
+    int i;
+
+    if(space < (uint32_t)count) {
+        br->head_cache = __atomic_load_n(&br->head, __ATOMIC_ACQUIRE);
+        space = br->mask + 1 - (tail - br->head_cache);
+        if(space < (uint32_t)count) {
+            count = space;
+        }
+    }
+
+    for(i = 0; i < count; i++) {
+        br->ring[(tail + i) & br->mask] = entries[i];
+    }
+    __atomic_store_n(&br->tail, tail + count, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+static int
+bigring_lf_spsc_shift__(bigring_lf_t* br, void** entries, int count)
+{
+    uint32_t head = __atomic_load_n(&br->head, __ATOMIC_RELAXED);
+    uint32_t avail = br->tail_cache - head;
+    int i;
+
+    if(avail < (uint32_t)count) {
+        br->tail_cache = __atomic_load_n(&br->tail, __ATOMIC_ACQUIRE);
+        avail = br->tail_cache - head;
+        if(avail < (uint32_t)count) {
+            count = avail;
+        }
+    }
+
+    for(i = 0; i < count; i++) {
+        entries[i] = br->ring[(head + i) & br->mask];
+    }
+    __atomic_store_n(&br->head, head + count, __ATOMIC_RELEASE);
+
+    return count;
+}
+
+static int
+bigring_lf_mpsc_push__(bigring_lf_t* br, void** entries, int count)
+{
+    uint32_t pos = __atomic_load_n(&br->tail, __ATOMIC_RELAXED);
+    uint32_t last;
+    int32_t diff;
+    int n, i;
+
+    if(count > (int)br->mask + 1) {
+        count = br->mask + 1;
+    }
+
+    for(;;) {
+        /* Shrink the batch until its last slot is free */
+        n = count;
+        for(;;) {
+            last = pos + n - 1;
+            diff = (int32_t)(__atomic_load_n(&br->seq[last & br->mask],
+                                             __ATOMIC_ACQUIRE) - last);
+            if(diff >= 0 || n == 1) {
+                break;
+            }
+            n /= 2;
+        }
+
+        if(diff == 0) {
+            if(__atomic_compare_exchange_n(&br->tail, &pos, pos + n, 1,
+                                           __ATOMIC_RELAXED,
+                                           __ATOMIC_RELAXED)) {
+                break;
+            }
+            /* pos now holds the current tail */
+        }
+        else if(diff < 0) {
+            /* Full */
+            return 0;
+        }
+        else {
+            /* Another producer claimed pos */
+            pos = __atomic_load_n(&br->tail, __ATOMIC_RELAXED);
+        }
+    }
+
+    for(i = 0; i < n; i++) {
+        br->ring[(pos + i) & br->mask] = entries[i];
+        __atomic_store_n(&br->seq[(pos + i) & br->mask], pos + i + 1,
+                         __ATOMIC_RELEASE);
+    }
+
+    return n;
+}
+
+static int
+bigring_lf_mpsc_shift__(bigring_lf_t* br, void** entries, int count)
+{
+    uint32_t head = br->head;
+    uint32_t idx;
+    int n;
+
+    for(n = 0; n < count; n++) {
+        idx = (head + n) & br->mask;
+        if(__atomic_load_n(&br->seq[idx], __ATOMIC_ACQUIRE) != head + n + 1) {
+            break;
+        }
+        entries[n] = br->ring[idx];
+        br->ring[idx] = NULL;
+        __atomic_store_n(&br->seq[idx], head + n + br->mask + 1,
+                         __ATOMIC_RELEASE);
+    }
+    __atomic_store_n(&br->head, head + n, __ATOMIC_RELEASE);
+
+    return n;
+}
+
+int
+bigring_lf_push_batch(bigring_lf_t* br, void** entries, int count)
+{
+    if(count <= 0) {
+        return 0;
+    }
+    if(br->mode == BIGRING_LF_MODE_MPSC) {
+        return bigring_lf_mpsc_push__(br, entries, count);
+    }
+    return bigring_lf_spsc_push__(br, entries, count);
+}
+
+int
+bigring_lf_push(bigring_lf_t* br, void* entry)
+{
+    return (bigring_lf_push_batch(br, &entry, 1) == 1) ? 0 : -1;
+}
+
+int
+bigring_lf_shift_batch(bigring_lf_t* br, void** entries, int count)
+{
+    if(count <= 0) {
+        return 0;
+    }
+    if(br->mode == BIGRING_LF_MODE_MPSC) {
+        return bigring_lf_mpsc_shift__(br, entries, count);
+    }
+    return bigring_lf_spsc_shift__(br, entries, count);
+}
+
+void*
+bigring_lf_shift(bigring_lf_t* br)
+{
+    void* entry;
+    return (bigring_lf_shift_batch(br, &entry, 1) == 1) ? entry : NULL;
+}
@@ -24,6 +24,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include <sched.h>
 #include <AIM/aim.h>
 
 #define AIM_LOG_MODULE_NAME BigRingTest
@@ -223,6 +225,181 @@ bigring_str_test(int size, bigring_free_entry_f fef)
 }
 
 
+static void
+bigring_lf_basic_test(bigring_lf_mode_t mode, int size)
+{
+    bigring_lf_t* br = bigring_lf_create(size, mode, NULL);
+    void* batch[8];
+    intptr_t c;
+    int capacity = bigring_lf_size(br);
+    int i, n;
+
+    if(capacity < size || (capacity & (capacity - 1))) {
+        AIM_LOG_ERROR("lf size %d not a power of two >= %d", capacity, size);
+        abort();
+    }
+
+    /* Wrap several times, filling to capacity each time */
+    for(i = 0; i < 3; i++) {
+        for(c = 1; c <= capacity; c++) {
+            if(bigring_lf_push(br, (void*)c) < 0) {
+                AIM_LOG_ERROR("lf push %d failed below capacity %d", c, capacity);
+                abort();
+            }
+        }
+        if(bigring_lf_push(br, (void*)c) == 0) {
+            AIM_LOG_ERROR("lf push succeeded on a full ring");
+            abort();
+        }
+        if(bigring_lf_count(br) != capacity) {
+            AIM_LOG_ERROR("lf count is %d, should be %d", bigring_lf_count(br), capacity);
+            abort();
+        }
+        for(c = 1; c <= capacity; c++) {
+            intptr_t v = (intptr_t)bigring_lf_shift(br);
+            if(v != c) {
+                AIM_LOG_ERROR("lf entry mismatch - expected %p, got %p", c, v);
+                abort();
+            }
+        }
+        if(bigring_lf_shift(br) != NULL || bigring_lf_count(br) != 0) {
+            AIM_LOG_ERROR("lf ring not empty after draining");
+            abort();
+        }
+    }
+
+    /* Batches stop at the capacity and at the entries available */
+    for(i = 0; i < 8; i++) {
+        batch[i] = (void*)(intptr_t)(i + 1);
+    }
+    n = 0;
+    while(n < capacity) {
+        int pushed = bigring_lf_push_batch(br, batch, 8);
+        if(pushed != ((capacity - n < 8) ? capacity - n : 8)) {
+            AIM_LOG_ERROR("lf push batch added %d with %d of %d used", pushed, n, capacity);
+            abort();
+        }
+        n += pushed;
+    }
+    n = 0;
+    while((i = bigring_lf_shift_batch(br, batch, 3)) > 0) {
+        for(c = 0; c < i; c++) {
+            if((intptr_t)batch[c] != ((n + c) % 8) + 1) {
+                AIM_LOG_ERROR("lf shift batch entry mismatch at %d", n + c);
+                abort();
+            }
+        }
+        n += i;
+    }
+    if(n != capacity) {
+        AIM_LOG_ERROR("lf shift batch returned %d entries, should be %d", n, capacity);
+        abort();
+    }
+
+    bigring_lf_destroy(br);
+}
+
+#define LF_THREAD_PRODUCERS 4
+#define LF_THREAD_ENTRIES 200000
+
+typedef struct lf_producer_s {
+    bigring_lf_t* br;
+    intptr_t id;
+} lf_producer_t;
+
+static void*
+lf_producer__(void* arg)
+{
+    lf_producer_t* p = arg;
+    void* batch[5];
+    intptr_t seq = 0;
+    int i, n;
+
+    /* Entries encode (producer, sequence); mix single and batch pushes */
+    while(seq < LF_THREAD_ENTRIES) {
+        if(seq % 3) {
+            n = 0;
+            for(i = 0; i < 5 && seq + i < LF_THREAD_ENTRIES; i++, n++) {
+                batch[i] = (void*)(((seq + i + 1) << 4) | p->id);
+            }
+            n = bigring_lf_push_batch(p->br, batch, n);
+        }
+        else {
+            n = (bigring_lf_push(p->br, (void*)(((seq + 1) << 4) | p->id)) == 0);
+        }
+        if(n == 0) {
+            sched_yield();
+        }
+        seq += n;
+    }
+    return NULL;
+}
+
+static void
+bigring_lf_thread_test(bigring_lf_mode_t mode, int producers)
+{
+    bigring_lf_t* br = bigring_lf_create(64, mode, NULL);
+    lf_producer_t p[LF_THREAD_PRODUCERS];
+    pthread_t threads[LF_THREAD_PRODUCERS];
+    intptr_t next[LF_THREAD_PRODUCERS];
+    void* batch[16];
+    int total = 0;
+    int i, n;
+
+    for(i = 0; i < producers; i++) {
+        p[i].br = br;
+        p[i].id = i;
+        next[i] = 1;
+        pthread_create(&threads[i], NULL, lf_producer__, &p[i]);
+    }
+
+    while(total < producers * LF_THREAD_ENTRIES) {
+        n = bigring_lf_shift_batch(br, batch, 16);
+        if(n == 0) {
+            sched_yield();
+        }
+        for(i = 0; i < n; i++) {
+            intptr_t v = (intptr_t)batch[i];
+            intptr_t id = v & 0xf;
+            if(id >= producers || (v >> 4) != next[id]) {
+                AIM_LOG_ERROR("lf thread entry %p out of order, expected %d from %d",
+                              v, next[id & 0x3], id);
+                abort();
+            }
+            next[id]++;
+        }
+        total += n;
+    }
+
+    for(i = 0; i < producers; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    if(bigring_lf_shift(br) != NULL) {
+        AIM_LOG_ERROR("lf thread ring not empty");
+        abort();
+    }
+    bigring_lf_destroy(br);
+}
+
+static void
+bigring_lf_str_test(bigring_lf_mode_t mode, int size)
+{
+    bigring_lf_t* br = bigring_lf_create(size, mode, free_entry__);
+    int i;
+
+    /* Destroy frees what is left, oldest first */
+    free_count__ = 0;
+    for(i = 0; i < size; i++) {
+        bigring_lf_push(br, aim_fstrdup("%d", i));
+    }
+    bigring_lf_destroy(br);
+    if(free_count__ != size) {
+        AIM_LOG_ERROR("lf free count is %d, should be %d", free_count__, size);
+        abort();
+    }
+}
+
+
 int aim_main(int argc, char* argv[])
 {
     int size_min = 1, size_max = 65;
@@ -244,6 +421,17 @@ int aim_main(int argc, char* argv[])
         AIM_LOG_MSG("StrTest(%d, default)", s);
         bigring_str_test(s, bigring_aim_free_entry);
     }
+    for(s = 1; s <= 65; s++) {
+        AIM_LOG_MSG("LFTest(%d)", s);
+        bigring_lf_basic_test(BIGRING_LF_MODE_SPSC, s);
+        bigring_lf_basic_test(BIGRING_LF_MODE_MPSC, s);
+    }
+    bigring_lf_str_test(BIGRING_LF_MODE_SPSC, 8);
+    bigring_lf_str_test(BIGRING_LF_MODE_MPSC, 8);
+    AIM_LOG_MSG("LFThreadTest(SPSC)");
+    bigring_lf_thread_test(BIGRING_LF_MODE_SPSC, 1);
+    AIM_LOG_MSG("LFThreadTest(MPSC)");
+    bigring_lf_thread_test(BIGRING_LF_MODE_MPSC, LF_THREAD_PRODUCERS);
     bigring_config_show(&aim_pvs_stdout);
     return 0;
 }
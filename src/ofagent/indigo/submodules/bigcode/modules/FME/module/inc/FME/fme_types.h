@@ -59,6 +59,7 @@ typedef struct fme_counters_s {
 
 
 struct fme_key_s;
+struct fme_tuple_s;
 
 /** Key dumper signature. */
 typedef int (*fme_key_dump_f)(struct fme_key_s* key, aim_pvs_t* pvs);
@@ -114,7 +115,7 @@ typedef struct fme_entry_s {
     /** Enable or disable state of this entry */
     int enabled;
 
-    /** Current index in the parent FME's entry table. */
+    /** Current index in the parent FME's entry table (not priority order). */
     int index;
 
     /** Client's assigned cookie for this entry. */
@@ -123,14 +124,64 @@ typedef struct fme_entry_s {
     /** Client entry dumper */
     fme_entry_cookie_dump_f cdumper;
 
+    /** Insertion order in the parent FME. Later entries win priority ties. */
+    uint64_t seq;
+
+    /** Hash of the masked key values. */
+    uint32_t hash;
+
+    /** The tuple holding this entry, NULL if not in an FME. */
+    struct fme_tuple_s* tuple;
+
+    /** Next entry in the same tuple hash bucket. */
+    struct fme_entry_s* bucket_next;
+
 } fme_entry_t;
 
 /**
- * This is the collection of fme_entry_t structures,
- * kept in priority order, against which you can attempt
- * matches.
+ * All entries in an FME that share a keymask, key size and key mask.
+ *
+ * Masking an incoming key with the tuple's mask gives an exact-match
+ * lookup into the tuple's hash table.
+ */
+typedef struct fme_tuple_s {
+    /** The parent FME. */
+    struct fme_s* fme;
+
+    /** Keymask shared by the entries. */
+    uint32_t keymask;
+
+    /** Key size shared by the entries. */
+    int size;
+
+    /** Key mask shared by the entries. */
+    uint8_t masks[FME_CONFIG_KEY_SIZE_WORDS*4];
+
+    /**
+     * Upper bound on the priority of the entries. Raised on insert but
+     * not lowered on removal.
+     */
+    int max_prio;
+
+    /** The number of entries. */
+    int num_entries;
+
+    /** The number of hash buckets (a power of 2). */
+    int num_buckets;
+
+    /** The hash buckets. */
+    fme_entry_t** buckets;
+
+} fme_tuple_t;
+
+/**
+ * This is the collection of fme_entry_t structures against
+ * which you can attempt matches.
  *
- * @todo: convert to inclusive list processing for the entry table.
+ * Entries are grouped into tuples by mask (tuple space search).
+ * A match looks up the incoming key in each tuple, highest
+ * priority tuple first, and stops once no remaining tuple can
+ * hold a better entry.
  */
 typedef struct fme_s {
     /** string used for object log messages. */
@@ -142,9 +193,21 @@ typedef struct fme_s {
     /** The current number of entries. */
     int num_entries;
 
-    /** The entry table. */
+    /** The entry table, in no particular order. */
     fme_entry_t** entries;
 
+    /** The tuples, in descending max_prio order. */
+    fme_tuple_t** tuples;
+
+    /** The current number of tuples. */
+    int num_tuples;
+
+    /** Allocated size of the tuple table. */
+    int max_tuples;
+
+    /** Sequence number for the next entry added. */
+    uint64_t next_seq;
+
 } fme_t;
 
 
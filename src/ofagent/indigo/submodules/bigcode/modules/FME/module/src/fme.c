@@ -23,8 +23,14 @@
 #include <stdlib.h>
 #include <IOF/iof.h>
 #include "fme_log.h"
+#include <murmur/murmur.h>
 
 static int fme_key_dump_default__(fme_key_t* key, aim_pvs_t* ap);
+static void fme_tuple_insert__(fme_t* fme, fme_entry_t* entry);
+static void fme_tuple_remove__(fme_entry_t* entry);
+
+/* Initial hash buckets per tuple; doubled when the load exceeds 1 */
+#define FME_TUPLE_BUCKETS_DEFAULT 16
 
 int
 fme_create(fme_t** rv, const char* name, int max_entries)
@@ -45,6 +51,7 @@ fme_destroy_all(fme_t* fme)
     for(i = 0; i < fme->num_entries; i++) {
         fme_entry_destroy(fme->entries[i]);
     }
+    fme->num_entries = 0;
     if(fme->log_string) {
         aim_free((void*)fme->log_string);
     }
@@ -54,6 +61,18 @@ fme_destroy_all(fme_t* fme)
 void
 fme_destroy(fme_t* fme)
 {
+    int i;
+
+    /* Entries outlive the FME, so detach them from its tuples */
+    for(i = 0; i < fme->num_entries; i++) {
+        fme->entries[i]->tuple = NULL;
+        fme->entries[i]->bucket_next = NULL;
+    }
+    for(i = 0; i < fme->num_tuples; i++) {
+        aim_free(fme->tuples[i]->buckets);
+        aim_free(fme->tuples[i]);
+    }
+    aim_free(fme->tuples);
     aim_free(fme->entries);
     aim_free(fme);
 }
@@ -82,10 +101,22 @@ fme_entry_destroy(fme_entry_t* entry)
 int
 fme_entry_key_set(fme_entry_t* entry, fme_key_t* key)
 {
+    fme_t* fme = NULL;
+
+    /* The key decides the tuple, so move an entry that is already added */
+    if(entry->tuple) {
+        fme = entry->tuple->fme;
+        fme_tuple_remove__(entry);
+    }
+
     FME_MEMCPY(&entry->key, key, sizeof(*key));
     if(entry->key.dumper == NULL) {
         entry->key.dumper = fme_key_dump_default__;
     }
+
+    if(fme) {
+        fme_tuple_insert__(fme, entry);
+    }
     return 0;
 }
 
@@ -129,7 +160,7 @@ fme_entry_timeouts(fme_t* fme, fme_timeval_t now, biglist_t** list)
     if(list == NULL || now == 0) {
         return 0;
     }
-    for(i = 0; fme->num_entries; i++) {
+    for(i = 0; i < fme->num_entries; i++) {
         if(fme_entry_timeout_status(fme->entries[i], now)) {
             rv = biglist_prepend(rv, fme->entries[i]);
             count++;
@@ -139,60 +170,183 @@ fme_entry_timeouts(fme_t* fme, fme_timeval_t now, biglist_t** list)
     return count;
 }
 
-static void
-fme_update_indexes__(fme_t* fme)
+
+/*
+ * Tuples
+ *
+ * Every entry lives in the tuple for its keymask, key size and key mask,
+ * hashed by its key values under that mask. The tuple table is kept in
+ * descending max_prio order so a match can stop early.
+ */
+
+static uint32_t
+fme_key_hash__(const uint8_t* values, const uint8_t* masks, int size)
 {
+    uint32_t words[FME_CONFIG_KEY_SIZE_WORDS];
+    const uint32_t* vp = (const uint32_t*) values;
+    const uint32_t* mp = (const uint32_t*) masks;
     int i;
-    for(i = 0; i < fme->num_entries; i++) {
-        fme->entries[i]->index = i;
+
+    for(i = 0; i < size/4; i++) {
+        words[i] = vp[i] & mp[i];
     }
+    return murmur_hash(words, (size/4)*4, 0);
 }
 
-int
-fme_add_entry(fme_t* fme, fme_entry_t* entry)
+/* Does a take precedence over b? */
+static int
+fme_entry_precedes__(fme_entry_t* a, fme_entry_t* b)
+{
+    return a->prio > b->prio || (a->prio == b->prio && a->seq > b->seq);
+}
+
+static fme_tuple_t*
+fme_tuple_find__(fme_t* fme, fme_key_t* key)
 {
     int i;
+    for(i = 0; i < fme->num_tuples; i++) {
+        fme_tuple_t* tuple = fme->tuples[i];
+        if(tuple->keymask == key->keymask && tuple->size == key->size &&
+           !memcmp(tuple->masks, key->masks, key->size)) {
+            return tuple;
+        }
+    }
+    return NULL;
+}
 
-    if(fme->num_entries == fme->max_entries) {
-        return -1;
+static fme_tuple_t*
+fme_tuple_create__(fme_t* fme, fme_key_t* key)
+{
+    fme_tuple_t* tuple = aim_zmalloc(sizeof(*tuple));
+    tuple->fme = fme;
+    tuple->keymask = key->keymask;
+    tuple->size = key->size;
+    FME_MEMCPY(tuple->masks, key->masks, key->size);
+    tuple->max_prio = INT_MIN;
+    tuple->num_buckets = FME_TUPLE_BUCKETS_DEFAULT;
+    tuple->buckets = aim_zmalloc(sizeof(fme_entry_t*)*tuple->num_buckets);
+
+    if(fme->num_tuples == fme->max_tuples) {
+        fme->max_tuples = fme->max_tuples ? fme->max_tuples*2 : 8;
+        fme->tuples = aim_realloc(fme->tuples,
+                                  sizeof(fme_tuple_t*)*fme->max_tuples);
+    }
+    /* Lowest possible priority, so it belongs at the end */
+    fme->tuples[fme->num_tuples++] = tuple;
+    return tuple;
+}
+
+static void
+fme_tuple_grow__(fme_tuple_t* tuple)
+{
+    int size = tuple->num_buckets*2;
+    fme_entry_t** buckets = aim_zmalloc(sizeof(fme_entry_t*)*size);
+    int i;
+
+    for(i = 0; i < tuple->num_buckets; i++) {
+        fme_entry_t* fe = tuple->buckets[i];
+        while(fe) {
+            fme_entry_t* next = fe->bucket_next;
+            fe->bucket_next = buckets[fe->hash & (size-1)];
+            buckets[fe->hash & (size-1)] = fe;
+            fe = next;
+        }
     }
+    aim_free(tuple->buckets);
+    tuple->buckets = buckets;
+    tuple->num_buckets = size;
+}
 
-    if(fme->num_entries == 0) {
-        fme->entries[fme->num_entries++] = entry;
-        return 0;
+/* Move a tuple ahead of those with a lower max_prio */
+static void
+fme_tuple_raise__(fme_t* fme, fme_tuple_t* tuple)
+{
+    int i = 0;
+    while(fme->tuples[i] != tuple) {
+        i++;
+    }
+    while(i > 0 && fme->tuples[i-1]->max_prio < tuple->max_prio) {
+        fme->tuples[i] = fme->tuples[i-1];
+        i--;
+    }
+    fme->tuples[i] = tuple;
+}
+
+static void
+fme_tuple_insert__(fme_t* fme, fme_entry_t* entry)
+{
+    fme_tuple_t* tuple = fme_tuple_find__(fme, &entry->key);
+    fme_entry_t** bucket;
+
+    if(tuple == NULL) {
+        tuple = fme_tuple_create__(fme, &entry->key);
     }
+    if(tuple->num_entries >= tuple->num_buckets) {
+        fme_tuple_grow__(tuple);
+    }
+
+    entry->hash = fme_key_hash__(entry->key.values, tuple->masks, tuple->size);
+    bucket = &tuple->buckets[entry->hash & (tuple->num_buckets-1)];
+    entry->bucket_next = *bucket;
+    *bucket = entry;
+    entry->tuple = tuple;
+    tuple->num_entries++;
 
-    if(fme->entries[fme->num_entries-1]->prio > entry->prio) {
-        fme->entries[fme->num_entries] = entry;
-        entry->index = fme->num_entries++;
+    if(entry->prio > tuple->max_prio) {
+        tuple->max_prio = entry->prio;
+        fme_tuple_raise__(fme, tuple);
     }
-    else {
-        /* todo -- binary search for index insertion if this is kept at all */
-        i = 0;
-        while(fme->entries[i]->prio > entry->prio) {
-            i++;
-        }
-        FME_MEMMOVE(fme->entries+i+1, fme->entries+i, (fme->num_entries-i)*sizeof(fme_entry_t*));
-        fme->entries[i] = entry;
-        entry->index = i;
-        ++fme->num_entries;
-        fme_update_indexes__(fme);
+}
+
+static void
+fme_tuple_remove__(fme_entry_t* entry)
+{
+    fme_tuple_t* tuple = entry->tuple;
+    fme_t* fme = tuple->fme;
+    fme_entry_t** fep = &tuple->buckets[entry->hash & (tuple->num_buckets-1)];
+    int i;
+
+    while(*fep != entry) {
+        fep = &(*fep)->bucket_next;
     }
+    *fep = entry->bucket_next;
+    entry->bucket_next = NULL;
+    entry->tuple = NULL;
+
+    if(--tuple->num_entries == 0) {
+        for(i = 0; fme->tuples[i] != tuple; i++);
+        FME_MEMMOVE(fme->tuples+i, fme->tuples+i+1,
+                    (fme->num_tuples-i-1)*sizeof(fme_tuple_t*));
+        fme->num_tuples--;
+        aim_free(tuple->buckets);
+        aim_free(tuple);
+    }
+}
+
+
+int
+fme_add_entry(fme_t* fme, fme_entry_t* entry)
+{
+    if(fme->num_entries == fme->max_entries) {
+        return -1;
+    }
+
+    entry->seq = fme->next_seq++;
+    entry->index = fme->num_entries;
+    fme->entries[fme->num_entries++] = entry;
+    fme_tuple_insert__(fme, entry);
     return 0;
 }
 
 int
 fme_remove_entry(fme_t* fme, fme_entry_t* entry)
 {
-    if(fme->entries[entry->index] == entry) {
-        int msize = fme->num_entries - entry->index - 1;
-        --fme->num_entries;
-        if(msize) {
-            FME_MEMMOVE(fme->entries+(entry->index),
-                        fme->entries+(entry->index+1),
-                        msize*sizeof(fme_entry_t*));
-            fme_update_indexes__(fme);
-        }
+    if(entry->index >= 0 && entry->index < fme->num_entries &&
+       fme->entries[entry->index] == entry) {
+        fme_entry_t* last = fme->entries[--fme->num_entries];
+        fme->entries[entry->index] = last;
+        last->index = entry->index;
+        fme_tuple_remove__(entry);
     }
     else {
         AIM_LOG_WARN("entry not found");
@@ -237,29 +391,72 @@ fme_key_match__(fme_key_t* value, fme_key_t* matchkey)
     return 1;
 }
 
+/*
+ * Check an entry found by hash against the key, without updating
+ * its counters.
+ */
 static
-int fme_entry_match__(fme_entry_t* entry, fme_key_t* key, fme_timeval_t now,
-                      int size)
+int fme_entry_match__(fme_entry_t* entry, fme_key_t* key, fme_timeval_t now)
 {
     if(entry->enabled == 0) {
         /* entry is disabled */
         return 0;
     }
+    if(fme_key_match__(key, &entry->key) != 1) {
+        /* no match */
+        return 0;
+    }
     if(fme_entry_timeout_status(entry, now)) {
         /* entry has timed-out and should be disabled */
         entry->enabled = 0;
         return 0;
     }
-    if(fme_key_match__(key, &entry->key) == 0) {
-        /* no match */
-        return 0;
-    }
+    return 1;
+}
 
-    /* entry has matched */
+static void
+fme_entry_hit__(fme_entry_t* entry, fme_timeval_t now, int size)
+{
     ++entry->counters.matches;
     entry->counters.bytes += size;
     entry->timestamp = now;
-    return 1;
+}
+
+/*
+ * Look up the key in one tuple. Calls fn for each matching entry and
+ * returns the number found.
+ */
+static int
+fme_tuple_lookup__(fme_tuple_t* tuple, fme_key_t* key, fme_timeval_t now,
+                   void (*fn)(fme_entry_t* fe, void* cookie), void* cookie)
+{
+    fme_entry_t* fe;
+    uint32_t hash;
+    int count = 0;
+
+    if(tuple->size != key->size ||
+       (key->keymask & tuple->keymask) != tuple->keymask) {
+        return 0;
+    }
+
+    hash = fme_key_hash__(key->values, tuple->masks, tuple->size);
+    for(fe = tuple->buckets[hash & (tuple->num_buckets-1)]; fe;
+        fe = fe->bucket_next) {
+        if(fe->hash == hash && fme_entry_match__(fe, key, now)) {
+            fn(fe, cookie);
+            count++;
+        }
+    }
+    return count;
+}
+
+static void
+fme_match_best__(fme_entry_t* fe, void* cookie)
+{
+    fme_entry_t** best = cookie;
+    if(*best == NULL || fme_entry_precedes__(fe, *best)) {
+        *best = fe;
+    }
 }
 
 int
@@ -269,6 +466,7 @@ fme_match(fme_t* fme, fme_key_t* key, fme_timeval_t now, int size,
     int i;
     int rv = 0;
     iof_t iof;
+    fme_entry_t* best = NULL;
 
     if(AIM_LOG_ENABLED(VERBOSE)) {
         iof_init(&iof, &aim_pvs_stdout);
@@ -282,20 +480,22 @@ fme_match(fme_t* fme, fme_key_t* key, fme_timeval_t now, int size,
     }
 
     /*
-     * Find the first match, in priority order
+     * Find the highest priority match. Tuples are in descending max_prio
+     * order, so stop at the first one that cannot beat the best so far.
      */
-    for(i = 0; i < fme->num_entries; i++) {
-        fme_entry_t* fe = fme->entries[i];
-        if(fe == NULL) {
-            AIM_LOG_INTERNAL("entry is null");
-            continue;
-        }
-        if(fme_entry_match__(fe, key, now, size)) {
-            *matched = fe;
-            AIM_LOG_VERBOSE("matched index %d", fe->index);
-            rv = 1;
+    for(i = 0; i < fme->num_tuples; i++) {
+        fme_tuple_t* tuple = fme->tuples[i];
+        if(best && tuple->max_prio < best->prio) {
             break;
         }
+        fme_tuple_lookup__(tuple, key, now, fme_match_best__, &best);
+    }
+
+    if(best) {
+        fme_entry_hit__(best, now, size);
+        *matched = best;
+        AIM_LOG_VERBOSE("matched index %d", best->index);
+        rv = 1;
     }
 
     if(AIM_LOG_ENABLED(VERBOSE)) {
@@ -310,6 +510,21 @@ fme_match(fme_t* fme, fme_key_t* key, fme_timeval_t now, int size,
     return rv;
 }
 
+static void
+fme_matches_collect__(fme_entry_t* fe, void* cookie)
+{
+    biglist_t** list = cookie;
+    *list = biglist_prepend(*list, fe);
+}
+
+static int
+fme_matches_compare__(const void* a, const void* b)
+{
+    fme_entry_t* fa = (fme_entry_t*)a;
+    fme_entry_t* fb = (fme_entry_t*)b;
+    return fme_entry_precedes__(fa, fb) ? -1 : 1;
+}
+
 int
 fme_matches(fme_t* fme, fme_key_t* key, fme_timeval_t now, int size,
             biglist_t** matches)
@@ -317,29 +532,25 @@ fme_matches(fme_t* fme, fme_key_t* key, fme_timeval_t now, int size,
     int i;
     int count = 0;
     biglist_t* rv = NULL;
+    biglist_t* ble;
 
     /*
      * Find all matches
      */
-    for(i = 0; i < fme->num_entries; i++) {
-        fme_entry_t* fe = fme->entries[i];
-        if(fme->entries[i] == NULL) {
-            AIM_LOG_INTERNAL("entry is null");
-            continue;
-        }
-        if(fme_entry_match__(fe, key, now, size)) {
-            rv = biglist_prepend(rv, fe);
-            count++;
-        }
+    for(i = 0; i < fme->num_tuples; i++) {
+        count += fme_tuple_lookup__(fme->tuples[i], key, now,
+                                    fme_matches_collect__, &rv);
     }
     if(count > 1) {
-        rv = biglist_reverse(rv);
+        rv = biglist_sort(rv, fme_matches_compare__);
+    }
+    for(ble = rv; ble; ble = biglist_next(ble)) {
+        fme_entry_hit__(ble->data, now, size);
     }
     *matches = rv;
     return count;
 }
 
-
 void
 fme_dump(fme_t* fme, aim_pvs_t* ap)
 {
@@ -371,9 +371,9 @@ fme_ucli_utm__perf__(ucli_context_t* uc)
     for(i = 0; i < iterations; i++) {
         int rv = fme_match(fme, &mkey, 0, 0, &match);
         /* The lowest priority entry will always match */
-        if(rv != 1 || match->index != table_size-1){
-            return ucli_printf(uc, "i=%d error: rv=%d, index=%d\n", i, rv,
-                               (match) ? match->index : -1);
+        if(rv != 1 || match->prio != 0){
+            return ucli_printf(uc, "i=%d error: rv=%d, prio=%d\n", i, rv,
+                               (match) ? match->prio : -1);
         }
     }
     end = os_time_thread();
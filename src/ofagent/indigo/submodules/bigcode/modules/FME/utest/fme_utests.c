@@ -181,6 +181,30 @@ ucli_block_t fme_utests[] =
       "match 0xFF DEADBEEF 0 0",
     },
   },
+  {
+    "mask-priority",
+    {
+      "entry 1",
+      "key 0x1 DEADBEEF FFFFFFFF",
+      "entry 2",
+      "key 0x1 DEAD0000 FFFF0000",
+      "entry 3",
+      "key 0x1 CAFEF00D FFFFFFFF",
+      "expect 2",
+      "match 0x1 DEADBEEF 0 0",
+    },
+  },
+  {
+    "mask-wildcard",
+    {
+      "entry 1",
+      "key 0x1 00000000 00000000",
+      "entry 5",
+      "key 0x1 DEADBEEF FFFFFFFF",
+      "expect 5",
+      "match 0x1 DEADBEEF 0 0",
+    },
+  },
   {
     "perf-10000-10000-0",
     {
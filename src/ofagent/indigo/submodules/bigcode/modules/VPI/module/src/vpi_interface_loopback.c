@@ -27,6 +27,7 @@
 #include "vpi_interface_loopback.h"
 
 #include <BigList/biglist.h>
+#include <BigList/biglist_queue.h>
 
 #include <unistd.h>
 #include <semaphore.h>
@@ -97,7 +98,7 @@ typedef struct vpi_interface_loopback_s {
  *****************************************************************************/
     const char* log_string;
 
-    biglist_t* packet_list;
+    biglist_queue_t packets;
 
     sem_t lock;
 
@@ -155,6 +156,7 @@ vpi_loopback_interface_create(vpi_interface_t** vi, char* args[], int flags,
     nvi->interface.destroy = vpi_loopback_interface_destroy;
 
     sem_init(&nvi->lock, 0, 1);
+    biglist_queue_init(&nvi->packets, 16);
 
     *vi = (vpi_interface_t*)nvi;
     return 0;
@@ -168,7 +170,7 @@ vpi_loopback_interface_send(vpi_interface_t* _vi, unsigned char* data, int len)
     if(rv) {
         VPI_INFO(vi, "send: data=%p size=%d", data, len);
         sem_wait(&vi->lock);
-        vi->packet_list = biglist_append((biglist_t*)vi->packet_list, rv);
+        biglist_queue_push(&vi->packets, rv);
         sem_post(&vi->lock);
     }
     return (rv) ? 0 : -1;
@@ -180,12 +182,11 @@ vpi_loopback_interface_recv(vpi_interface_t* _vi, unsigned char* data, int len)
     vpi_loopback_packet_t* rv;
 
     VICAST(vi, _vi);
-    while(vi->packet_list == NULL) {
+    while(vi->packets.head == NULL) {
         AIM_USLEEP(250000);
     }
     sem_wait(&vi->lock);
-    rv = (vpi_loopback_packet_t*)vi->packet_list->data;
-    vi->packet_list = biglist_remove((biglist_t*)vi->packet_list, rv);
+    rv = (vpi_loopback_packet_t*)biglist_queue_shift(&vi->packets);
     sem_post(&vi->lock);
 
     if(len > rv->size) {
@@ -201,18 +202,14 @@ int
 vpi_loopback_interface_recv_ready(vpi_interface_t* _vi)
 {
     VICAST(vi, _vi);
-    return vi->packet_list != NULL;
+    return vi->packets.head != NULL;
 }
 
 int
 vpi_loopback_interface_destroy(vpi_interface_t* _vi)
 {
     VICAST(vi, _vi);
-    biglist_t* ble;
-    for(ble = vi->packet_list; ble; ble = biglist_next(ble)) {
-        loopback_packet__Free((vpi_loopback_packet_t*)ble->data);
-    }
-    biglist_free(vi->packet_list);
+    biglist_queue_free_all(&vi->packets, (biglist_free_f)loopback_packet__Free);
     aim_free(vi);
     return 0;
 }
@@ -27,6 +27,10 @@
 #include "vpi_interface_queue.h"
 
 #include <OS/os_sem.h>
+#include <BigList/biglist_queue.h>
+
+/** Spare list elements kept by each packet queue */
+#define VPI_PQ_POOL_MAX 64
 
 static const char* queue_interface_docstring__ =
     "----------------------------------------------------\n"
@@ -86,7 +90,7 @@ typedef struct vpi_pq_s {
     os_sem_t packets_available;
 
     /** The actual packet queue */
-    biglist_t* list;
+    biglist_queue_t queue;
 
     /** Packet history queue (TBD) */
     biglist_t* history_list;
@@ -133,6 +137,7 @@ pq_alloc_locked__(const char* name)
     pq->mlock = os_sem_create(1);
     pq->packets_available = os_sem_create(0);
     pq->refcount = 0;
+    biglist_queue_init(&pq->queue, VPI_PQ_POOL_MAX);
 
     pq_list__->list = biglist_prepend(pq_list__->list, pq);
 
@@ -151,7 +156,7 @@ pq_destroy__(vpi_pq_t* pq)
         aim_free((char*)pq->name);
         os_sem_destroy(pq->mlock);
         os_sem_destroy(pq->packets_available);
-        biglist_free_all(pq->list, (biglist_free_f)qpacket_free__);
+        biglist_queue_free_all(&pq->queue, (biglist_free_f)qpacket_free__);
         aim_free(pq);
     }
 }
@@ -225,7 +230,7 @@ void
 pq_append__(vpi_pq_t* q, vpi_qpacket_t* qp)
 {
     os_sem_take(q->mlock);
-    q->list = biglist_append(q->list, qp);
+    biglist_queue_push(&q->queue, qp);
     os_sem_give(q->mlock);
     os_sem_give(q->packets_available);
 }
@@ -235,10 +240,7 @@ pq_unshift__(vpi_pq_t* q)
 {
     vpi_qpacket_t* rv = NULL;
     os_sem_take(q->mlock);
-    if(q->list) {
-        rv = (vpi_qpacket_t*)(q->list->data);
-        q->list = biglist_remove_link_free(q->list, q->list);
-    }
+    rv = (vpi_qpacket_t*)biglist_queue_shift(&q->queue);
     os_sem_give(q->mlock);
     return rv;
 }
@@ -285,7 +287,7 @@ int
 vpi_queue_interface_recv_ready(vpi_interface_t* _vi)
 {
     VICAST(vi, _vi);
-    return vi->rq->list != NULL;
+    return vi->rq->queue.head != NULL;
 }
 
 int
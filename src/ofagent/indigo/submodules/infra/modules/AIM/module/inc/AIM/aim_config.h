@@ -102,6 +102,26 @@ struct aim_pvs_s;
 #define AIM_CONFIG_LOG_INCLUDE_ENV_VARIABLES 1
 #endif
 
+/**
+ * AIM_CONFIG_LOG_INCLUDE_VERBOSE
+ *
+ * Compile in verbose log messages. When 0 their arguments are not evaluated. */
+
+
+#ifndef AIM_CONFIG_LOG_INCLUDE_VERBOSE
+#define AIM_CONFIG_LOG_INCLUDE_VERBOSE 1
+#endif
+
+/**
+ * AIM_CONFIG_LOG_INCLUDE_TRACE
+ *
+ * Compile in trace log messages. When 0 their arguments are not evaluated. */
+
+
+#ifndef AIM_CONFIG_LOG_INCLUDE_TRACE
+#define AIM_CONFIG_LOG_INCLUDE_TRACE 1
+#endif
+
 /**
  * AIM_CONFIG_PVS_INCLUDE_TTY
  *
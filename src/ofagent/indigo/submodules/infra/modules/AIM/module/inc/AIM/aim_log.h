@@ -576,7 +576,8 @@ extern aim_log_t AIM_LOG_STRUCT;
  * Determine whether a log setting is enabled.
  */
 #define AIM_LOG_ENABLED(_flag)                                          \
-    aim_log_enabled(AIM_LOG_STRUCT_POINTER, AIM_LOG_FLAG_##_flag)
+    (AIM_LOG_COMPILED_##_flag &&                                        \
+     aim_log_enabled(AIM_LOG_STRUCT_POINTER, AIM_LOG_FLAG_##_flag))
 
 /**
  * Determine whether a custom log setting is enabled.
@@ -595,15 +596,56 @@ extern aim_log_t AIM_LOG_STRUCT;
 
 
 
+/**
+ * Whether messages of each common flag are compiled in.
+ *
+ * A message that is not compiled in is still type checked, but its
+ * arguments are never evaluated.
+ */
+#define AIM_LOG_COMPILED_MSG 1
+#define AIM_LOG_COMPILED_FATAL 1
+#define AIM_LOG_COMPILED_ERROR 1
+#define AIM_LOG_COMPILED_WARN 1
+#define AIM_LOG_COMPILED_INFO 1
+#define AIM_LOG_COMPILED_VERBOSE AIM_CONFIG_LOG_INCLUDE_VERBOSE
+#define AIM_LOG_COMPILED_TRACE AIM_CONFIG_LOG_INCLUDE_TRACE
+#define AIM_LOG_COMPILED_INTERNAL 1
+#define AIM_LOG_COMPILED_BUG 1
+#define AIM_LOG_COMPILED_FTRACE 1
+
+/**
+ * Inline test of the module's flags before calling aim_log_common.
+ *
+ * Disabled messages then cost one load and a branch, without evaluating
+ * the arguments or setting up the varargs call. MSG and FATAL are always
+ * logged. Until the environment overrides are read, defer to
+ * aim_log_common so it can read them.
+ */
+#if AIM_CONFIG_LOG_INCLUDE_ENV_VARIABLES == 1
+#define AIM_LOG_FLAGS_READY_(_l) ((_l)->env != 0)
+#else
+#define AIM_LOG_FLAGS_READY_(_l) 1
+#endif
+
+#define AIM_LOG_FAST_ENABLED(_flag)                                     \
+    (AIM_LOG_COMPILED_##_flag &&                                        \
+     __builtin_expect((AIM_LOG_BIT_##_flag &                            \
+                       (AIM_LOG_BIT_MSG | AIM_LOG_BIT_FATAL)) ||        \
+                      (AIM_LOG_STRUCT_POINTER->common_flags &           \
+                       AIM_LOG_BIT_##_flag) ||                          \
+                      !AIM_LOG_FLAGS_READY_(AIM_LOG_STRUCT_POINTER), 0))
+
 /**
  * Issue a common log message with rate-limiting.
  */
 #define AIM_LOG_MOD_RL_COMMON(_flag, _rl, _time, ...)                   \
-    aim_log_common(AIM_LOG_STRUCT_POINTER, AIM_LOG_FLAG_##_flag,        \
-                   _rl, _time,                                          \
-                   __func__, __FILE__, __LINE__,                        \
-                   AIM_LOG_MODULE_NAME_STR AIM_LOG_PREFIX1 AIM_LOG_PREFIX2 \
-                   ": " #_flag ": " AIM_VA_ARGS_FIRST(__VA_ARGS__) AIM_VA_ARGS_REST(__VA_ARGS__))
+    (AIM_LOG_FAST_ENABLED(_flag) ?                                      \
+     aim_log_common(AIM_LOG_STRUCT_POINTER, AIM_LOG_FLAG_##_flag,       \
+                    _rl, _time,                                         \
+                    __func__, __FILE__, __LINE__,                       \
+                    AIM_LOG_MODULE_NAME_STR AIM_LOG_PREFIX1 AIM_LOG_PREFIX2 \
+                    ": " #_flag ": " AIM_VA_ARGS_FIRST(__VA_ARGS__) AIM_VA_ARGS_REST(__VA_ARGS__)) \
+     : (void)0)
 
 /**
  * Issue a common log message, no rate limiting.
@@ -638,11 +680,13 @@ extern aim_log_t AIM_LOG_STRUCT;
  * Issue a common object log message with rate limiting.
  */
 #define AIM_LOG_OBJ_RL_COMMON(_obj, _flag, _rl, _time, ...)             \
-    aim_log_common(AIM_LOG_STRUCT_POINTER, AIM_LOG_FLAG_##_flag,        \
-                   _rl, _time,                                          \
-                   __func__, __FILE__, __LINE__,                        \
-                   AIM_LOG_MODULE_NAME_STR AIM_LOG_PREFIX1 AIM_LOG_PREFIX2 "(%s)" \
-                   ": " #_flag ": " AIM_VA_ARGS_FIRST(__VA_ARGS__),  (_obj)->log_string AIM_VA_ARGS_REST(__VA_ARGS__))
+    (AIM_LOG_FAST_ENABLED(_flag) ?                                      \
+     aim_log_common(AIM_LOG_STRUCT_POINTER, AIM_LOG_FLAG_##_flag,       \
+                    _rl, _time,                                         \
+                    __func__, __FILE__, __LINE__,                       \
+                    AIM_LOG_MODULE_NAME_STR AIM_LOG_PREFIX1 AIM_LOG_PREFIX2 "(%s)" \
+                    ": " #_flag ": " AIM_VA_ARGS_FIRST(__VA_ARGS__),  (_obj)->log_string AIM_VA_ARGS_REST(__VA_ARGS__)) \
+     : (void)0)
 
 
 /**
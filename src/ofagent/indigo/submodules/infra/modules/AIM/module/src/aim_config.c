@@ -67,6 +67,16 @@ aim_config_settings_t aim_config_settings[] =
 #else
 { AIM_CONFIG_LOG_INCLUDE_ENV_VARIABLES(__aim_config_STRINGIFY_NAME), "__undefined__" },
 #endif
+#ifdef AIM_CONFIG_LOG_INCLUDE_VERBOSE
+    { __aim_config_STRINGIFY_NAME(AIM_CONFIG_LOG_INCLUDE_VERBOSE), __aim_config_STRINGIFY_VALUE(AIM_CONFIG_LOG_INCLUDE_VERBOSE) },
+#else
+{ AIM_CONFIG_LOG_INCLUDE_VERBOSE(__aim_config_STRINGIFY_NAME), "__undefined__" },
+#endif
+#ifdef AIM_CONFIG_LOG_INCLUDE_TRACE
+    { __aim_config_STRINGIFY_NAME(AIM_CONFIG_LOG_INCLUDE_TRACE), __aim_config_STRINGIFY_VALUE(AIM_CONFIG_LOG_INCLUDE_TRACE) },
+#else
+{ AIM_CONFIG_LOG_INCLUDE_TRACE(__aim_config_STRINGIFY_NAME), "__undefined__" },
+#endif
 #ifdef AIM_CONFIG_PVS_INCLUDE_TTY
     { __aim_config_STRINGIFY_NAME(AIM_CONFIG_PVS_INCLUDE_TTY), __aim_config_STRINGIFY_VALUE(AIM_CONFIG_PVS_INCLUDE_TTY) },
 #else
@@ -540,17 +540,23 @@ extern int of_match_v3_to_match(of_match_v3_t *src, of_match_t *dst);
 extern int of_match_to_wire_match_v1(of_match_t *src, of_match_v1_t *dst);
 extern int of_match_to_wire_match_v2(of_match_t *src, of_match_v2_t *dst);
 extern int of_match_to_wire_match_v3(of_match_t *src, of_match_v3_t *dst);
+extern int of_match_v3_oxm_visit(of_octets_t *octets,
+                                 of_oxm_visitor_f visitor, void *cookie);
+extern int of_flow_mod_match_oxm_visit(of_object_t *obj,
+                                       of_oxm_visitor_f visitor, void *cookie);
 
 /**
  * Macro to check consistency of length for top level objects
  *
- * If the object has no parent then its length should match the
- * underlying wire buffer's current bytes.
+ * If the object has no parent then it should end at the underlying
+ * wire buffer's current bytes. That is its length for a message, or
+ * its offset and length for a list detached by a list builder.
  */
 #define OF_LENGTH_CHECK_ASSERT(obj) \
     LOCI_ASSERT(((obj)->parent != NULL) || \
      ((obj)->wire_object.wbuf == NULL) || \
-     (WBUF_CURRENT_BYTES((obj)->wire_object.wbuf) == (obj)->length))
+     (WBUF_CURRENT_BYTES((obj)->wire_object.wbuf) == \
+      OF_OBJECT_ABSOLUTE_OFFSET(obj, (obj)->length)))
 
 #define OF_DEBUG_DUMP
 #if defined(OF_DEBUG_DUMP)
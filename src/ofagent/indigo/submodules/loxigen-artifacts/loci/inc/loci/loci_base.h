@@ -61,10 +61,32 @@
  */
 typedef int (*loci_writer_f)(void *cookie, const char *fmt, ...);
 
+/**
+ * Single version build
+ *
+ * Define LOCI_SINGLE_VERSION to one of the of_version_t values (for
+ * example, -DLOCI_SINGLE_VERSION=OF_VERSION_1_3) to build LOCI for that
+ * wire version only. The accessors then switch on the constant rather
+ * than on obj->version, so each switch folds to the one case and the
+ * accessors become fixed offset loads and stores. Messages and objects
+ * of any other version are rejected as unsupported.
+ *
+ * The whole tree must be built with the same setting.
+ */
+#ifdef LOCI_SINGLE_VERSION
+#define LOCI_OBJ_VERSION(obj) ((of_version_t)(LOCI_SINGLE_VERSION))
+#else
+#define LOCI_OBJ_VERSION(obj) ((obj)->version)
+#endif
+
 /**
  * Check if a version is supported
  */
+#ifdef LOCI_SINGLE_VERSION
+#define OF_VERSION_OKAY(v) ((v) == (LOCI_SINGLE_VERSION))
+#else
 #define OF_VERSION_OKAY(v) ((v) >= OF_VERSION_1_0 && (v) <= OF_VERSION_1_3)
+#endif
 
 
 /**
@@ -224,7 +246,9 @@ typedef uint64_t of_match_bmap_t;
 #define MEMCPY(dest, src, bytes) memcpy(dest, src, bytes)
 #define MEMCMP(a, b, bytes) memcmp(a, b, bytes)
 #define MALLOC(bytes) malloc(bytes)
-#define FREE(ptr) free(ptr)
+/* Pool aware; see loci/of_alloc.h */
+extern void of_alloc_free(void *ptr);
+#define FREE(ptr) of_alloc_free(ptr)
 
 /** Try an operation and return on failure. */
 #define OF_TRY(op) do {                                                      \
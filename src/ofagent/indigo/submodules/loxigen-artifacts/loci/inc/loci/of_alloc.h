@@ -0,0 +1,94 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * Freelist allocator for LOCI objects and wire buffers
+ *
+ * Objects, wire buffer structures and wire buffer data are carved
+ * from per-size-class arenas and recycled through freelists instead
+ * of going back to malloc.  Pooling is off until enabled with
+ * of_alloc_enable_set; until then every request goes to MALLOC.
+ *
+ * FREE (and so every LOCI release path) goes through of_alloc_free,
+ * which recognizes arena memory and hands anything else to free().
+ * Owners of a stolen wire buffer must release it with of_alloc_free
+ * as well.
+ *
+ * Not thread safe; LOCI objects are expected to be created and
+ * deleted from a single thread.
+ *
+ ****************************************************************/
+
+#ifndef _OF_ALLOC_H_
+#define _OF_ALLOC_H_
+
+#include <loci/loci_base.h>
+
+/** Smallest pooled wire buffer data size (OF_WIRE_BUFFER_MIN_ALLOC_BYTES) */
+#define OF_ALLOC_BUF_MIN_BYTES 128
+
+/** Largest pooled wire buffer data size; covers OF_WIRE_BUFFER_MAX_LENGTH */
+#define OF_ALLOC_BUF_MAX_BYTES 65536
+
+/** Arena bytes reserved for each size class the first time it is used */
+#define OF_ALLOC_ARENA_BYTES (1024 * 1024)
+
+/** Minimum number of blocks in a size class arena */
+#define OF_ALLOC_ARENA_MIN_BLOCKS 16
+
+/**
+ * Allocator counters
+ * @param hits Allocations served from an arena
+ * @param misses Allocations that fell back to MALLOC while enabled
+ * @param frees Blocks returned to a freelist
+ * @param in_use Arena blocks currently allocated
+ * @param free_count Blocks on the freelist
+ * @param capacity Blocks in the arena (0 until first use)
+ */
+typedef struct of_alloc_stats_s {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t frees;
+    uint32_t in_use;
+    uint32_t free_count;
+    uint32_t capacity;
+} of_alloc_stats_t;
+
+/**
+ * Enable or disable pooling of new allocations
+ *
+ * Arena memory already handed out is still recycled after disabling.
+ */
+extern void of_alloc_enable_set(int enable);
+extern int of_alloc_enable_get(void);
+
+/** Allocate storage for an of_object_t */
+extern void *of_alloc_object(void);
+
+/** Allocate storage for an of_wire_buffer_t */
+extern void *of_alloc_wbuf(void);
+
+/**
+ * Allocate wire buffer data
+ * @param bytes In: bytes required.  Out: bytes actually usable, which
+ * is the size class when served from a pool.
+ */
+extern uint8_t *of_alloc_buf(int *bytes);
+
+/**
+ * Release memory from any of the above, or from MALLOC
+ *
+ * Matches of_buffer_free_f so it can be used as a wire buffer free hook.
+ */
+extern void of_alloc_free(void *ptr);
+
+/** Sum of the counters across all size classes */
+extern void of_alloc_stats_get(of_alloc_stats_t *stats);
+
+/** Write per size class counters */
+extern int of_alloc_stats_dump(loci_writer_f writer, void *cookie);
+
+#endif /* _OF_ALLOC_H_ */
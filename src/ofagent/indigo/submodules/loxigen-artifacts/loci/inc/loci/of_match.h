@@ -1708,4 +1708,31 @@ of_match_overlap(of_match_t *match1, of_match_t *match2)
     return 1; /* No field differentiates matches */
 }
 
+/**
+ * One OXM TLV of a serialized match, as handed to an of_oxm_visitor_f
+ *
+ * value and mask point into the wire buffer holding the match; they are
+ * only valid for the duration of the visitor call.  For experimenter
+ * class OXMs the experimenter ID is stripped from value and returned
+ * separately.
+ */
+typedef struct of_oxm_tlv_s {
+    uint32_t type_len;          /* OXM header as found on the wire */
+    uint32_t experimenter;      /* 0 unless class is OF_OXM_CLASS_EXPERIMENTER */
+    const uint8_t *value;
+    const uint8_t *mask;        /* NULL if the has-mask bit is clear */
+    int value_len;              /* Bytes in value (and in mask, if present) */
+} of_oxm_tlv_t;
+
+#define OF_OXM_TLV_CLASS(tlv) ((uint16_t)((tlv)->type_len >> 16))
+#define OF_OXM_TLV_FIELD(tlv) ((uint8_t)(((tlv)->type_len >> 9) & 0x7f))
+
+/**
+ * Callback for of_match_v3_oxm_visit
+ *
+ * Return 0 to continue the walk; any other value stops it and is
+ * returned to the caller of the visit function.
+ */
+typedef int (*of_oxm_visitor_f)(void *cookie, const of_oxm_tlv_t *tlv);
+
 #endif /* Match header file */
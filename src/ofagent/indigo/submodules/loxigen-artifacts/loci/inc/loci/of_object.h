@@ -64,6 +64,30 @@ extern int of_list_append_bind(of_object_t *parent, of_object_t *child);
 /* Append a copy of item to list */
 extern int of_list_append(of_object_t *list, of_object_t *item);
 
+/**
+ * Builder for a long list at the end of a message
+ *
+ * Each append, and each set that changes the length of an entry, walks
+ * up the parents of the list rewriting their lengths. Between
+ * of_list_builder_start and of_list_builder_finish the list is detached
+ * from its parent, so the entries are written one after the other
+ * touching only the entry and the list, and the lengths of the parents
+ * are fixed up once by the finish.
+ *
+ * Append to the list with the usual append functions. The list must be
+ * at the end of the buffer, and the parents must not be used (their
+ * lengths are stale) until the builder is finished.
+ */
+typedef struct of_list_builder_s {
+    of_object_t *list;
+    of_object_t *parent;        /* Of the list, while detached */
+    int start_length;           /* Of the list, when started */
+} of_list_builder_t;
+
+extern void of_list_builder_start(of_list_builder_t *builder,
+                                  of_object_t *list);
+extern void of_list_builder_finish(of_list_builder_t *builder);
+
 extern of_object_t *of_object_new(int bytes);
 extern of_object_t *of_object_dup(of_object_t *src);
 
@@ -92,6 +116,9 @@ extern int of_object_buffer_bind(of_object_t *obj, uint8_t *buf,
  *
  * The wire buffer is taken from the object and its wirebuffer is set to
  * NULL.  The ref_count of the wire buffer is not changed.
+ *
+ * The caller owns the returned data and must release it with
+ * of_alloc_free, as it may come from a LOCI allocator pool.
  */
 extern void of_object_wire_buffer_steal(of_object_t *obj, uint8_t **buffer);
 extern int of_object_append_buffer(of_object_t *dst, of_object_t *src);
@@ -103,6 +130,9 @@ typedef struct of_object_storage_s of_object_storage_t;
 of_object_t *of_object_new_from_message_preallocated(
     of_object_storage_t *storage, uint8_t *buf, int len);
 
+of_object_t *of_object_new_from_message_preallocated_light(
+    of_object_storage_t *storage, uint8_t *buf, int len);
+
 /* Delete an OpenFlow object without reference to its type */
 extern void of_object_delete(of_object_t *obj);
 
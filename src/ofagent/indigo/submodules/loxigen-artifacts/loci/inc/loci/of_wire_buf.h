@@ -11,6 +11,7 @@
 #include <loci/of_object.h>
 #include <loci/of_match.h>
 #include <loci/of_buffer.h>
+#include <loci/of_alloc.h>
 
 /****************************************************************
  *
@@ -136,7 +137,7 @@ of_wire_buffer_new(int a_bytes)
 {
     of_wire_buffer_t *wbuf;
 
-    wbuf = (of_wire_buffer_t *)MALLOC(sizeof(of_wire_buffer_t));
+    wbuf = (of_wire_buffer_t *)of_alloc_wbuf();
     if (wbuf == NULL) {
         return NULL;
     }
@@ -146,13 +147,15 @@ of_wire_buffer_new(int a_bytes)
         a_bytes = OF_WIRE_BUFFER_MIN_ALLOC_BYTES;
     }
 
-    if ((wbuf->buf = (uint8_t *)MALLOC(a_bytes)) == NULL) {
+    /* May round a_bytes up to the pool size class */
+    if ((wbuf->buf = of_alloc_buf(&a_bytes)) == NULL) {
         FREE(wbuf);
         return NULL;
     }
     MEMSET(wbuf->buf, 0, a_bytes);
     wbuf->current_bytes = 0;
     wbuf->alloc_bytes = a_bytes;
+    wbuf->free = of_alloc_free;
 
     return (of_wire_buffer_t *)wbuf;
 }
@@ -169,7 +172,7 @@ of_wire_buffer_new_bind(uint8_t *buf, int bytes, of_buffer_free_f buf_free)
 {
     of_wire_buffer_t *wbuf;
 
-    wbuf = (of_wire_buffer_t *)MALLOC(sizeof(of_wire_buffer_t));
+    wbuf = (of_wire_buffer_t *)of_alloc_wbuf();
     if (wbuf == NULL) {
         return NULL;
     }
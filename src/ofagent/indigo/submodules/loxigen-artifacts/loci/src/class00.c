@@ -34,7 +34,7 @@ void
 of_action_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 0)); /* type */
         switch (value) {
@@ -414,7 +414,7 @@ void
 of_action_experimenter_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 4)); /* experimenter */
         switch (value) {
@@ -590,7 +590,7 @@ of_action_experimenter_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -631,7 +631,7 @@ of_action_experimenter_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -675,7 +675,7 @@ of_action_experimenter_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -722,7 +722,7 @@ of_action_experimenter_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -793,7 +793,7 @@ void
 of_action_bsn_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 8)); /* subtype */
         switch (value) {
@@ -966,7 +966,7 @@ of_action_bsn_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1007,7 +1007,7 @@ of_action_bsn_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1050,7 +1050,7 @@ of_action_bsn_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1091,7 +1091,7 @@ of_action_bsn_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1150,7 +1150,7 @@ static void
 of_action_bsn_mirror_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -1294,7 +1294,7 @@ of_action_bsn_mirror_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1335,7 +1335,7 @@ of_action_bsn_mirror_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1378,7 +1378,7 @@ of_action_bsn_mirror_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1419,7 +1419,7 @@ of_action_bsn_mirror_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1462,7 +1462,7 @@ of_action_bsn_mirror_dest_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1503,7 +1503,7 @@ of_action_bsn_mirror_dest_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1546,7 +1546,7 @@ of_action_bsn_mirror_vlan_tag_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1587,7 +1587,7 @@ of_action_bsn_mirror_vlan_tag_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1630,7 +1630,7 @@ of_action_bsn_mirror_copy_stage_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1671,7 +1671,7 @@ of_action_bsn_mirror_copy_stage_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1730,7 +1730,7 @@ static void
 of_action_bsn_set_tunnel_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -1874,7 +1874,7 @@ of_action_bsn_set_tunnel_dst_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1915,7 +1915,7 @@ of_action_bsn_set_tunnel_dst_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1958,7 +1958,7 @@ of_action_bsn_set_tunnel_dst_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1999,7 +1999,7 @@ of_action_bsn_set_tunnel_dst_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2042,7 +2042,7 @@ of_action_bsn_set_tunnel_dst_dst_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2083,7 +2083,7 @@ of_action_bsn_set_tunnel_dst_dst_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2142,7 +2142,7 @@ static void
 of_action_enqueue_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint16_t *)(buf + 0) = U16_HTON(0xb); /* type */
         break;
@@ -2281,7 +2281,7 @@ of_action_enqueue_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ENQUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2320,7 +2320,7 @@ of_action_enqueue_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ENQUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2360,7 +2360,7 @@ of_action_enqueue_queue_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ENQUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2398,7 +2398,7 @@ of_action_enqueue_queue_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ENQUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2455,7 +2455,7 @@ void
 of_action_nicira_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 8)); /* subtype */
         switch (value) {
@@ -2616,7 +2616,7 @@ of_action_nicira_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_NICIRA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2657,7 +2657,7 @@ of_action_nicira_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_NICIRA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2700,7 +2700,7 @@ of_action_nicira_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_NICIRA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2741,7 +2741,7 @@ of_action_nicira_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_NICIRA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2800,7 +2800,7 @@ static void
 of_action_nicira_dec_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -2944,7 +2944,7 @@ of_action_nicira_dec_ttl_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_NICIRA_DEC_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2985,7 +2985,7 @@ of_action_nicira_dec_ttl_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_NICIRA_DEC_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3028,7 +3028,7 @@ of_action_nicira_dec_ttl_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_NICIRA_DEC_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3069,7 +3069,7 @@ of_action_nicira_dec_ttl_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_NICIRA_DEC_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3128,7 +3128,7 @@ static void
 of_action_output_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -3270,7 +3270,7 @@ of_action_output_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3314,7 +3314,7 @@ of_action_output_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3359,7 +3359,7 @@ of_action_output_max_len_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3402,7 +3402,7 @@ of_action_output_max_len_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3463,7 +3463,7 @@ static void
 of_action_set_dl_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint16_t *)(buf + 0) = U16_HTON(0x5); /* type */
         break;
@@ -3605,7 +3605,7 @@ of_action_set_dl_dst_dl_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_DL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3644,7 +3644,7 @@ of_action_set_dl_dst_dl_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_DL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3701,7 +3701,7 @@ static void
 of_action_set_dl_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint16_t *)(buf + 0) = U16_HTON(0x4); /* type */
         break;
@@ -3843,7 +3843,7 @@ of_action_set_dl_src_dl_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_DL_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3882,7 +3882,7 @@ of_action_set_dl_src_dl_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_DL_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3939,7 +3939,7 @@ static void
 of_action_set_nw_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint16_t *)(buf + 0) = U16_HTON(0x7); /* type */
         break;
@@ -4081,7 +4081,7 @@ of_action_set_nw_dst_nw_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4120,7 +4120,7 @@ of_action_set_nw_dst_nw_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4177,7 +4177,7 @@ static void
 of_action_set_nw_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint16_t *)(buf + 0) = U16_HTON(0x6); /* type */
         break;
@@ -4319,7 +4319,7 @@ of_action_set_nw_src_nw_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4358,7 +4358,7 @@ of_action_set_nw_src_nw_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4415,7 +4415,7 @@ static void
 of_action_set_nw_tos_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint16_t *)(buf + 0) = U16_HTON(0x8); /* type */
         break;
@@ -4557,7 +4557,7 @@ of_action_set_nw_tos_nw_tos_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_TOS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4596,7 +4596,7 @@ of_action_set_nw_tos_nw_tos_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_TOS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4653,7 +4653,7 @@ static void
 of_action_set_tp_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
         *(uint16_t *)(buf + 0) = U16_HTON(0xa); /* type */
@@ -4793,7 +4793,7 @@ of_action_set_tp_dst_tp_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_TP_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4832,7 +4832,7 @@ of_action_set_tp_dst_tp_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_TP_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4889,7 +4889,7 @@ static void
 of_action_set_tp_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
         *(uint16_t *)(buf + 0) = U16_HTON(0x9); /* type */
@@ -5029,7 +5029,7 @@ of_action_set_tp_src_tp_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_TP_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5068,7 +5068,7 @@ of_action_set_tp_src_tp_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_TP_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5125,7 +5125,7 @@ static void
 of_action_set_vlan_pcp_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
         *(uint16_t *)(buf + 0) = U16_HTON(0x2); /* type */
@@ -5265,7 +5265,7 @@ of_action_set_vlan_pcp_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_VLAN_PCP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5304,7 +5304,7 @@ of_action_set_vlan_pcp_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_VLAN_PCP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5361,7 +5361,7 @@ static void
 of_action_set_vlan_vid_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1); /* type */
@@ -5501,7 +5501,7 @@ of_action_set_vlan_vid_vlan_vid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_VLAN_VID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5540,7 +5540,7 @@ of_action_set_vlan_vid_vlan_vid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_VLAN_VID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5597,7 +5597,7 @@ static void
 of_action_strip_vlan_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint16_t *)(buf + 0) = U16_HTON(0x3); /* type */
         break;
@@ -5753,7 +5753,7 @@ void
 of_header_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint8_t value = *(uint8_t *)(buf + 1); /* type */
         switch (value) {
@@ -6205,7 +6205,7 @@ of_header_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6246,7 +6246,7 @@ of_header_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6306,7 +6306,7 @@ void
 of_stats_reply_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 8)); /* stats_type */
         switch (value) {
@@ -6615,7 +6615,7 @@ of_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6656,7 +6656,7 @@ of_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6699,7 +6699,7 @@ of_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6740,7 +6740,7 @@ of_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6799,7 +6799,7 @@ static void
 of_aggregate_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x11; /* type */
@@ -6988,7 +6988,7 @@ of_aggregate_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7029,7 +7029,7 @@ of_aggregate_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7072,7 +7072,7 @@ of_aggregate_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7113,7 +7113,7 @@ of_aggregate_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7156,7 +7156,7 @@ of_aggregate_stats_reply_packet_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7199,7 +7199,7 @@ of_aggregate_stats_reply_packet_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7244,7 +7244,7 @@ of_aggregate_stats_reply_byte_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7287,7 +7287,7 @@ of_aggregate_stats_reply_byte_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7332,7 +7332,7 @@ of_aggregate_stats_reply_flow_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7375,7 +7375,7 @@ of_aggregate_stats_reply_flow_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7437,7 +7437,7 @@ void
 of_stats_request_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 8)); /* stats_type */
         switch (value) {
@@ -7746,7 +7746,7 @@ of_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7787,7 +7787,7 @@ of_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7830,7 +7830,7 @@ of_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7871,7 +7871,7 @@ of_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7930,7 +7930,7 @@ static void
 of_aggregate_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x10; /* type */
@@ -8125,7 +8125,7 @@ of_aggregate_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8166,7 +8166,7 @@ of_aggregate_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8209,7 +8209,7 @@ of_aggregate_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8250,7 +8250,7 @@ of_aggregate_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8293,7 +8293,7 @@ of_aggregate_stats_request_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8336,7 +8336,7 @@ of_aggregate_stats_request_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8381,7 +8381,7 @@ of_aggregate_stats_request_out_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8425,7 +8425,7 @@ of_aggregate_stats_request_out_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8470,7 +8470,7 @@ of_aggregate_stats_request_out_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8510,7 +8510,7 @@ of_aggregate_stats_request_out_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8552,7 +8552,7 @@ of_aggregate_stats_request_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8592,7 +8592,7 @@ of_aggregate_stats_request_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8634,7 +8634,7 @@ of_aggregate_stats_request_cookie_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8674,7 +8674,7 @@ of_aggregate_stats_request_cookie_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8718,7 +8718,7 @@ of_aggregate_stats_request_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8779,7 +8779,7 @@ of_aggregate_stats_request_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_AGGREGATE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8861,7 +8861,7 @@ void
 of_error_msg_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 8)); /* err_type */
         switch (value) {
@@ -9182,7 +9182,7 @@ of_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9223,7 +9223,7 @@ of_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9282,7 +9282,7 @@ static void
 of_bad_action_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -9467,7 +9467,7 @@ of_bad_action_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_ACTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9508,7 +9508,7 @@ of_bad_action_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_ACTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9551,7 +9551,7 @@ of_bad_action_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_ACTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9592,7 +9592,7 @@ of_bad_action_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_ACTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9636,7 +9636,7 @@ of_bad_action_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BAD_ACTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9683,7 +9683,7 @@ of_bad_action_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BAD_ACTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9753,7 +9753,7 @@ static void
 of_bad_request_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -9938,7 +9938,7 @@ of_bad_request_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_REQUEST_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9979,7 +9979,7 @@ of_bad_request_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_REQUEST_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10022,7 +10022,7 @@ of_bad_request_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_REQUEST_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10063,7 +10063,7 @@ of_bad_request_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_REQUEST_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10107,7 +10107,7 @@ of_bad_request_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BAD_REQUEST_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10154,7 +10154,7 @@ of_bad_request_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BAD_REQUEST_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10224,7 +10224,7 @@ static void
 of_barrier_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -10411,7 +10411,7 @@ of_barrier_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BARRIER_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10452,7 +10452,7 @@ of_barrier_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BARRIER_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10511,7 +10511,7 @@ static void
 of_barrier_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -10698,7 +10698,7 @@ of_barrier_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BARRIER_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10739,7 +10739,7 @@ of_barrier_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BARRIER_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10799,7 +10799,7 @@ void
 of_experimenter_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 8)); /* experimenter */
         switch (value) {
@@ -11012,7 +11012,7 @@ of_experimenter_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11053,7 +11053,7 @@ of_experimenter_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11096,7 +11096,7 @@ of_experimenter_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11137,7 +11137,7 @@ of_experimenter_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11180,7 +11180,7 @@ of_experimenter_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11221,7 +11221,7 @@ of_experimenter_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11265,7 +11265,7 @@ of_experimenter_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11312,7 +11312,7 @@ of_experimenter_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11383,7 +11383,7 @@ void
 of_bsn_header_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 12)); /* subtype */
         switch (value) {
@@ -11947,7 +11947,7 @@ of_bsn_header_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11988,7 +11988,7 @@ of_bsn_header_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12031,7 +12031,7 @@ of_bsn_header_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12072,7 +12072,7 @@ of_bsn_header_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12115,7 +12115,7 @@ of_bsn_header_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12156,7 +12156,7 @@ of_bsn_header_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12215,7 +12215,7 @@ static void
 of_bsn_bw_clear_data_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -12401,7 +12401,7 @@ of_bsn_bw_clear_data_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12442,7 +12442,7 @@ of_bsn_bw_clear_data_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12485,7 +12485,7 @@ of_bsn_bw_clear_data_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12526,7 +12526,7 @@ of_bsn_bw_clear_data_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12569,7 +12569,7 @@ of_bsn_bw_clear_data_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12610,7 +12610,7 @@ of_bsn_bw_clear_data_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12653,7 +12653,7 @@ of_bsn_bw_clear_data_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12694,7 +12694,7 @@ of_bsn_bw_clear_data_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -33,7 +33,7 @@ static void
 of_bsn_bw_clear_data_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -219,7 +219,7 @@ of_bsn_bw_clear_data_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -260,7 +260,7 @@ of_bsn_bw_clear_data_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -303,7 +303,7 @@ of_bsn_bw_clear_data_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -344,7 +344,7 @@ of_bsn_bw_clear_data_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -387,7 +387,7 @@ of_bsn_bw_clear_data_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -428,7 +428,7 @@ of_bsn_bw_clear_data_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_CLEAR_DATA_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -487,7 +487,7 @@ static void
 of_bsn_bw_enable_get_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -673,7 +673,7 @@ of_bsn_bw_enable_get_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -714,7 +714,7 @@ of_bsn_bw_enable_get_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -757,7 +757,7 @@ of_bsn_bw_enable_get_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -798,7 +798,7 @@ of_bsn_bw_enable_get_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -841,7 +841,7 @@ of_bsn_bw_enable_get_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -882,7 +882,7 @@ of_bsn_bw_enable_get_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -925,7 +925,7 @@ of_bsn_bw_enable_get_reply_enabled_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -966,7 +966,7 @@ of_bsn_bw_enable_get_reply_enabled_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1025,7 +1025,7 @@ static void
 of_bsn_bw_enable_get_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -1211,7 +1211,7 @@ of_bsn_bw_enable_get_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1252,7 +1252,7 @@ of_bsn_bw_enable_get_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1295,7 +1295,7 @@ of_bsn_bw_enable_get_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1336,7 +1336,7 @@ of_bsn_bw_enable_get_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1379,7 +1379,7 @@ of_bsn_bw_enable_get_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1420,7 +1420,7 @@ of_bsn_bw_enable_get_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1479,7 +1479,7 @@ static void
 of_bsn_bw_enable_set_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -1665,7 +1665,7 @@ of_bsn_bw_enable_set_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1706,7 +1706,7 @@ of_bsn_bw_enable_set_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1749,7 +1749,7 @@ of_bsn_bw_enable_set_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1790,7 +1790,7 @@ of_bsn_bw_enable_set_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1833,7 +1833,7 @@ of_bsn_bw_enable_set_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1874,7 +1874,7 @@ of_bsn_bw_enable_set_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1917,7 +1917,7 @@ of_bsn_bw_enable_set_reply_enable_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1958,7 +1958,7 @@ of_bsn_bw_enable_set_reply_enable_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2001,7 +2001,7 @@ of_bsn_bw_enable_set_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2042,7 +2042,7 @@ of_bsn_bw_enable_set_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2101,7 +2101,7 @@ static void
 of_bsn_bw_enable_set_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -2287,7 +2287,7 @@ of_bsn_bw_enable_set_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2328,7 +2328,7 @@ of_bsn_bw_enable_set_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2371,7 +2371,7 @@ of_bsn_bw_enable_set_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2412,7 +2412,7 @@ of_bsn_bw_enable_set_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2455,7 +2455,7 @@ of_bsn_bw_enable_set_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2496,7 +2496,7 @@ of_bsn_bw_enable_set_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2539,7 +2539,7 @@ of_bsn_bw_enable_set_request_enable_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2580,7 +2580,7 @@ of_bsn_bw_enable_set_request_enable_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_BW_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2639,7 +2639,7 @@ static void
 of_bsn_get_interfaces_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -2825,7 +2825,7 @@ of_bsn_get_interfaces_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2866,7 +2866,7 @@ of_bsn_get_interfaces_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2909,7 +2909,7 @@ of_bsn_get_interfaces_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2950,7 +2950,7 @@ of_bsn_get_interfaces_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2993,7 +2993,7 @@ of_bsn_get_interfaces_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3034,7 +3034,7 @@ of_bsn_get_interfaces_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3083,7 +3083,7 @@ of_bsn_get_interfaces_reply_interfaces_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3160,7 +3160,7 @@ of_bsn_get_interfaces_reply_interfaces_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3247,7 +3247,7 @@ static void
 of_bsn_get_interfaces_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -3433,7 +3433,7 @@ of_bsn_get_interfaces_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3474,7 +3474,7 @@ of_bsn_get_interfaces_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3517,7 +3517,7 @@ of_bsn_get_interfaces_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3558,7 +3558,7 @@ of_bsn_get_interfaces_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3601,7 +3601,7 @@ of_bsn_get_interfaces_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3642,7 +3642,7 @@ of_bsn_get_interfaces_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_INTERFACES_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3701,7 +3701,7 @@ static void
 of_bsn_get_ip_mask_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -3884,7 +3884,7 @@ of_bsn_get_ip_mask_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3922,7 +3922,7 @@ of_bsn_get_ip_mask_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3962,7 +3962,7 @@ of_bsn_get_ip_mask_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4000,7 +4000,7 @@ of_bsn_get_ip_mask_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4040,7 +4040,7 @@ of_bsn_get_ip_mask_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4078,7 +4078,7 @@ of_bsn_get_ip_mask_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4118,7 +4118,7 @@ of_bsn_get_ip_mask_reply_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4156,7 +4156,7 @@ of_bsn_get_ip_mask_reply_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4196,7 +4196,7 @@ of_bsn_get_ip_mask_reply_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4234,7 +4234,7 @@ of_bsn_get_ip_mask_reply_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4290,7 +4290,7 @@ static void
 of_bsn_get_ip_mask_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -4473,7 +4473,7 @@ of_bsn_get_ip_mask_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4511,7 +4511,7 @@ of_bsn_get_ip_mask_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4551,7 +4551,7 @@ of_bsn_get_ip_mask_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4589,7 +4589,7 @@ of_bsn_get_ip_mask_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4629,7 +4629,7 @@ of_bsn_get_ip_mask_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4667,7 +4667,7 @@ of_bsn_get_ip_mask_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4707,7 +4707,7 @@ of_bsn_get_ip_mask_request_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4745,7 +4745,7 @@ of_bsn_get_ip_mask_request_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_IP_MASK_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4801,7 +4801,7 @@ static void
 of_bsn_get_l2_table_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -4984,7 +4984,7 @@ of_bsn_get_l2_table_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5022,7 +5022,7 @@ of_bsn_get_l2_table_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5062,7 +5062,7 @@ of_bsn_get_l2_table_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5100,7 +5100,7 @@ of_bsn_get_l2_table_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5140,7 +5140,7 @@ of_bsn_get_l2_table_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5178,7 +5178,7 @@ of_bsn_get_l2_table_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5218,7 +5218,7 @@ of_bsn_get_l2_table_reply_l2_table_enable_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5256,7 +5256,7 @@ of_bsn_get_l2_table_reply_l2_table_enable_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5296,7 +5296,7 @@ of_bsn_get_l2_table_reply_l2_table_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5334,7 +5334,7 @@ of_bsn_get_l2_table_reply_l2_table_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5390,7 +5390,7 @@ static void
 of_bsn_get_l2_table_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -5573,7 +5573,7 @@ of_bsn_get_l2_table_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5611,7 +5611,7 @@ of_bsn_get_l2_table_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5651,7 +5651,7 @@ of_bsn_get_l2_table_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5689,7 +5689,7 @@ of_bsn_get_l2_table_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5729,7 +5729,7 @@ of_bsn_get_l2_table_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5767,7 +5767,7 @@ of_bsn_get_l2_table_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5823,7 +5823,7 @@ static void
 of_bsn_get_mirroring_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -6009,7 +6009,7 @@ of_bsn_get_mirroring_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6050,7 +6050,7 @@ of_bsn_get_mirroring_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6093,7 +6093,7 @@ of_bsn_get_mirroring_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6134,7 +6134,7 @@ of_bsn_get_mirroring_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6177,7 +6177,7 @@ of_bsn_get_mirroring_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6218,7 +6218,7 @@ of_bsn_get_mirroring_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6261,7 +6261,7 @@ of_bsn_get_mirroring_reply_report_mirror_ports_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6302,7 +6302,7 @@ of_bsn_get_mirroring_reply_report_mirror_ports_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6361,7 +6361,7 @@ static void
 of_bsn_get_mirroring_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -6547,7 +6547,7 @@ of_bsn_get_mirroring_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6588,7 +6588,7 @@ of_bsn_get_mirroring_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6631,7 +6631,7 @@ of_bsn_get_mirroring_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6672,7 +6672,7 @@ of_bsn_get_mirroring_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6715,7 +6715,7 @@ of_bsn_get_mirroring_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6756,7 +6756,7 @@ of_bsn_get_mirroring_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6799,7 +6799,7 @@ of_bsn_get_mirroring_request_report_mirror_ports_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6840,7 +6840,7 @@ of_bsn_get_mirroring_request_report_mirror_ports_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GET_MIRRORING_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6899,7 +6899,7 @@ static void
 of_bsn_hybrid_get_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -7082,7 +7082,7 @@ of_bsn_hybrid_get_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7120,7 +7120,7 @@ of_bsn_hybrid_get_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7160,7 +7160,7 @@ of_bsn_hybrid_get_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7198,7 +7198,7 @@ of_bsn_hybrid_get_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7238,7 +7238,7 @@ of_bsn_hybrid_get_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7276,7 +7276,7 @@ of_bsn_hybrid_get_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7316,7 +7316,7 @@ of_bsn_hybrid_get_reply_hybrid_enable_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7354,7 +7354,7 @@ of_bsn_hybrid_get_reply_hybrid_enable_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7394,7 +7394,7 @@ of_bsn_hybrid_get_reply_hybrid_version_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7432,7 +7432,7 @@ of_bsn_hybrid_get_reply_hybrid_version_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7488,7 +7488,7 @@ static void
 of_bsn_hybrid_get_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -7671,7 +7671,7 @@ of_bsn_hybrid_get_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7709,7 +7709,7 @@ of_bsn_hybrid_get_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7749,7 +7749,7 @@ of_bsn_hybrid_get_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7787,7 +7787,7 @@ of_bsn_hybrid_get_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7827,7 +7827,7 @@ of_bsn_hybrid_get_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7865,7 +7865,7 @@ of_bsn_hybrid_get_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_HYBRID_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8034,7 +8034,7 @@ of_bsn_interface_hw_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_INTERFACE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8075,7 +8075,7 @@ of_bsn_interface_hw_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_INTERFACE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8118,7 +8118,7 @@ of_bsn_interface_name_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_INTERFACE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8159,7 +8159,7 @@ of_bsn_interface_name_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_INTERFACE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8202,7 +8202,7 @@ of_bsn_interface_ipv4_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_INTERFACE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8243,7 +8243,7 @@ of_bsn_interface_ipv4_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_INTERFACE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8286,7 +8286,7 @@ of_bsn_interface_ipv4_netmask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_INTERFACE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8327,7 +8327,7 @@ of_bsn_interface_ipv4_netmask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_INTERFACE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8386,7 +8386,7 @@ static void
 of_bsn_pdu_rx_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -8572,7 +8572,7 @@ of_bsn_pdu_rx_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8613,7 +8613,7 @@ of_bsn_pdu_rx_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8656,7 +8656,7 @@ of_bsn_pdu_rx_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8697,7 +8697,7 @@ of_bsn_pdu_rx_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8740,7 +8740,7 @@ of_bsn_pdu_rx_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8781,7 +8781,7 @@ of_bsn_pdu_rx_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8824,7 +8824,7 @@ of_bsn_pdu_rx_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8865,7 +8865,7 @@ of_bsn_pdu_rx_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8908,7 +8908,7 @@ of_bsn_pdu_rx_reply_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8952,7 +8952,7 @@ of_bsn_pdu_rx_reply_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8997,7 +8997,7 @@ of_bsn_pdu_rx_reply_slot_num_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9040,7 +9040,7 @@ of_bsn_pdu_rx_reply_slot_num_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9101,7 +9101,7 @@ static void
 of_bsn_pdu_rx_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -9287,7 +9287,7 @@ of_bsn_pdu_rx_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9328,7 +9328,7 @@ of_bsn_pdu_rx_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9371,7 +9371,7 @@ of_bsn_pdu_rx_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9412,7 +9412,7 @@ of_bsn_pdu_rx_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9455,7 +9455,7 @@ of_bsn_pdu_rx_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9496,7 +9496,7 @@ of_bsn_pdu_rx_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9539,7 +9539,7 @@ of_bsn_pdu_rx_request_timeout_ms_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9580,7 +9580,7 @@ of_bsn_pdu_rx_request_timeout_ms_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9623,7 +9623,7 @@ of_bsn_pdu_rx_request_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9667,7 +9667,7 @@ of_bsn_pdu_rx_request_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9712,7 +9712,7 @@ of_bsn_pdu_rx_request_slot_num_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9755,7 +9755,7 @@ of_bsn_pdu_rx_request_slot_num_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9801,7 +9801,7 @@ of_bsn_pdu_rx_request_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9851,7 +9851,7 @@ of_bsn_pdu_rx_request_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9924,7 +9924,7 @@ static void
 of_bsn_pdu_rx_timeout_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -10110,7 +10110,7 @@ of_bsn_pdu_rx_timeout_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10151,7 +10151,7 @@ of_bsn_pdu_rx_timeout_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10194,7 +10194,7 @@ of_bsn_pdu_rx_timeout_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10235,7 +10235,7 @@ of_bsn_pdu_rx_timeout_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10278,7 +10278,7 @@ of_bsn_pdu_rx_timeout_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10319,7 +10319,7 @@ of_bsn_pdu_rx_timeout_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10362,7 +10362,7 @@ of_bsn_pdu_rx_timeout_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10406,7 +10406,7 @@ of_bsn_pdu_rx_timeout_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10451,7 +10451,7 @@ of_bsn_pdu_rx_timeout_slot_num_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10494,7 +10494,7 @@ of_bsn_pdu_rx_timeout_slot_num_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_RX_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10555,7 +10555,7 @@ static void
 of_bsn_pdu_tx_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -10741,7 +10741,7 @@ of_bsn_pdu_tx_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10782,7 +10782,7 @@ of_bsn_pdu_tx_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10825,7 +10825,7 @@ of_bsn_pdu_tx_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10866,7 +10866,7 @@ of_bsn_pdu_tx_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10909,7 +10909,7 @@ of_bsn_pdu_tx_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10950,7 +10950,7 @@ of_bsn_pdu_tx_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10993,7 +10993,7 @@ of_bsn_pdu_tx_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11034,7 +11034,7 @@ of_bsn_pdu_tx_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11077,7 +11077,7 @@ of_bsn_pdu_tx_reply_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11121,7 +11121,7 @@ of_bsn_pdu_tx_reply_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11166,7 +11166,7 @@ of_bsn_pdu_tx_reply_slot_num_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11209,7 +11209,7 @@ of_bsn_pdu_tx_reply_slot_num_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11270,7 +11270,7 @@ static void
 of_bsn_pdu_tx_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -11456,7 +11456,7 @@ of_bsn_pdu_tx_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11497,7 +11497,7 @@ of_bsn_pdu_tx_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11540,7 +11540,7 @@ of_bsn_pdu_tx_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11581,7 +11581,7 @@ of_bsn_pdu_tx_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11624,7 +11624,7 @@ of_bsn_pdu_tx_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11665,7 +11665,7 @@ of_bsn_pdu_tx_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11708,7 +11708,7 @@ of_bsn_pdu_tx_request_tx_interval_ms_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11749,7 +11749,7 @@ of_bsn_pdu_tx_request_tx_interval_ms_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11792,7 +11792,7 @@ of_bsn_pdu_tx_request_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11836,7 +11836,7 @@ of_bsn_pdu_tx_request_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11881,7 +11881,7 @@ of_bsn_pdu_tx_request_slot_num_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11924,7 +11924,7 @@ of_bsn_pdu_tx_request_slot_num_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11970,7 +11970,7 @@ of_bsn_pdu_tx_request_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12020,7 +12020,7 @@ of_bsn_pdu_tx_request_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_PDU_TX_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12093,7 +12093,7 @@ static void
 of_bsn_set_ip_mask_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -12276,7 +12276,7 @@ of_bsn_set_ip_mask_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12314,7 +12314,7 @@ of_bsn_set_ip_mask_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12354,7 +12354,7 @@ of_bsn_set_ip_mask_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12392,7 +12392,7 @@ of_bsn_set_ip_mask_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12432,7 +12432,7 @@ of_bsn_set_ip_mask_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12470,7 +12470,7 @@ of_bsn_set_ip_mask_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12510,7 +12510,7 @@ of_bsn_set_ip_mask_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12548,7 +12548,7 @@ of_bsn_set_ip_mask_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12588,7 +12588,7 @@ of_bsn_set_ip_mask_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12626,7 +12626,7 @@ of_bsn_set_ip_mask_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_IP_MASK);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12682,7 +12682,7 @@ static void
 of_bsn_set_l2_table_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -12865,7 +12865,7 @@ of_bsn_set_l2_table_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12903,7 +12903,7 @@ of_bsn_set_l2_table_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12943,7 +12943,7 @@ of_bsn_set_l2_table_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12981,7 +12981,7 @@ of_bsn_set_l2_table_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13021,7 +13021,7 @@ of_bsn_set_l2_table_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13059,7 +13059,7 @@ of_bsn_set_l2_table_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13099,7 +13099,7 @@ of_bsn_set_l2_table_reply_l2_table_enable_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13137,7 +13137,7 @@ of_bsn_set_l2_table_reply_l2_table_enable_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13177,7 +13177,7 @@ of_bsn_set_l2_table_reply_l2_table_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13215,7 +13215,7 @@ of_bsn_set_l2_table_reply_l2_table_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13255,7 +13255,7 @@ of_bsn_set_l2_table_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13293,7 +13293,7 @@ of_bsn_set_l2_table_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13349,7 +13349,7 @@ static void
 of_bsn_set_l2_table_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -13532,7 +13532,7 @@ of_bsn_set_l2_table_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13570,7 +13570,7 @@ of_bsn_set_l2_table_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13610,7 +13610,7 @@ of_bsn_set_l2_table_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13648,7 +13648,7 @@ of_bsn_set_l2_table_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13688,7 +13688,7 @@ of_bsn_set_l2_table_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13726,7 +13726,7 @@ of_bsn_set_l2_table_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13766,7 +13766,7 @@ of_bsn_set_l2_table_request_l2_table_enable_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13804,7 +13804,7 @@ of_bsn_set_l2_table_request_l2_table_enable_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13844,7 +13844,7 @@ of_bsn_set_l2_table_request_l2_table_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13882,7 +13882,7 @@ of_bsn_set_l2_table_request_l2_table_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_L2_TABLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13938,7 +13938,7 @@ static void
 of_bsn_set_mirroring_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -14124,7 +14124,7 @@ of_bsn_set_mirroring_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_MIRRORING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14165,7 +14165,7 @@ of_bsn_set_mirroring_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_MIRRORING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14208,7 +14208,7 @@ of_bsn_set_mirroring_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_MIRRORING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14249,7 +14249,7 @@ of_bsn_set_mirroring_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_MIRRORING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14292,7 +14292,7 @@ of_bsn_set_mirroring_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_MIRRORING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14333,7 +14333,7 @@ of_bsn_set_mirroring_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_MIRRORING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14376,7 +14376,7 @@ of_bsn_set_mirroring_report_mirror_ports_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_MIRRORING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14417,7 +14417,7 @@ of_bsn_set_mirroring_report_mirror_ports_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_MIRRORING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14476,7 +14476,7 @@ static void
 of_bsn_set_pktin_suppression_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -14662,7 +14662,7 @@ of_bsn_set_pktin_suppression_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14703,7 +14703,7 @@ of_bsn_set_pktin_suppression_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14746,7 +14746,7 @@ of_bsn_set_pktin_suppression_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14787,7 +14787,7 @@ of_bsn_set_pktin_suppression_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14830,7 +14830,7 @@ of_bsn_set_pktin_suppression_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14871,7 +14871,7 @@ of_bsn_set_pktin_suppression_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14914,7 +14914,7 @@ of_bsn_set_pktin_suppression_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14955,7 +14955,7 @@ of_bsn_set_pktin_suppression_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15014,7 +15014,7 @@ static void
 of_bsn_set_pktin_suppression_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -15200,7 +15200,7 @@ of_bsn_set_pktin_suppression_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15241,7 +15241,7 @@ of_bsn_set_pktin_suppression_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15284,7 +15284,7 @@ of_bsn_set_pktin_suppression_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15325,7 +15325,7 @@ of_bsn_set_pktin_suppression_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15368,7 +15368,7 @@ of_bsn_set_pktin_suppression_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15409,7 +15409,7 @@ of_bsn_set_pktin_suppression_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15452,7 +15452,7 @@ of_bsn_set_pktin_suppression_request_enabled_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15493,7 +15493,7 @@ of_bsn_set_pktin_suppression_request_enabled_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15536,7 +15536,7 @@ of_bsn_set_pktin_suppression_request_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15577,7 +15577,7 @@ of_bsn_set_pktin_suppression_request_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15620,7 +15620,7 @@ of_bsn_set_pktin_suppression_request_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15661,7 +15661,7 @@ of_bsn_set_pktin_suppression_request_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15704,7 +15704,7 @@ of_bsn_set_pktin_suppression_request_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15745,7 +15745,7 @@ of_bsn_set_pktin_suppression_request_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15788,7 +15788,7 @@ of_bsn_set_pktin_suppression_request_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15829,7 +15829,7 @@ of_bsn_set_pktin_suppression_request_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SET_PKTIN_SUPPRESSION_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15888,7 +15888,7 @@ static void
 of_bsn_shell_command_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -16071,7 +16071,7 @@ of_bsn_shell_command_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16109,7 +16109,7 @@ of_bsn_shell_command_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16149,7 +16149,7 @@ of_bsn_shell_command_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16187,7 +16187,7 @@ of_bsn_shell_command_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16227,7 +16227,7 @@ of_bsn_shell_command_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16265,7 +16265,7 @@ of_bsn_shell_command_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16305,7 +16305,7 @@ of_bsn_shell_command_service_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16343,7 +16343,7 @@ of_bsn_shell_command_service_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16384,7 +16384,7 @@ of_bsn_shell_command_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16428,7 +16428,7 @@ of_bsn_shell_command_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_COMMAND);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16495,7 +16495,7 @@ static void
 of_bsn_shell_output_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -16678,7 +16678,7 @@ of_bsn_shell_output_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16716,7 +16716,7 @@ of_bsn_shell_output_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16756,7 +16756,7 @@ of_bsn_shell_output_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16794,7 +16794,7 @@ of_bsn_shell_output_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16834,7 +16834,7 @@ of_bsn_shell_output_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16872,7 +16872,7 @@ of_bsn_shell_output_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16913,7 +16913,7 @@ of_bsn_shell_output_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16957,7 +16957,7 @@ of_bsn_shell_output_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17024,7 +17024,7 @@ static void
 of_bsn_shell_status_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -17207,7 +17207,7 @@ of_bsn_shell_status_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17245,7 +17245,7 @@ of_bsn_shell_status_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17285,7 +17285,7 @@ of_bsn_shell_status_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17323,7 +17323,7 @@ of_bsn_shell_status_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17363,7 +17363,7 @@ of_bsn_shell_status_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17401,7 +17401,7 @@ of_bsn_shell_status_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17441,7 +17441,7 @@ of_bsn_shell_status_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17479,7 +17479,7 @@ of_bsn_shell_status_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_SHELL_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17536,7 +17536,7 @@ void
 of_experimenter_stats_reply_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 12)); /* experimenter */
         switch (value) {
@@ -17737,7 +17737,7 @@ of_experimenter_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17778,7 +17778,7 @@ of_experimenter_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17821,7 +17821,7 @@ of_experimenter_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17862,7 +17862,7 @@ of_experimenter_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17905,7 +17905,7 @@ of_experimenter_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17948,7 +17948,7 @@ of_experimenter_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17993,7 +17993,7 @@ of_experimenter_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18032,7 +18032,7 @@ of_experimenter_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18074,7 +18074,7 @@ of_experimenter_stats_reply_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18123,7 +18123,7 @@ of_experimenter_stats_reply_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18196,7 +18196,7 @@ void
 of_bsn_stats_reply_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 20)); /* subtype */
         switch (value) {
@@ -18421,7 +18421,7 @@ of_bsn_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18462,7 +18462,7 @@ of_bsn_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18505,7 +18505,7 @@ of_bsn_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18546,7 +18546,7 @@ of_bsn_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18589,7 +18589,7 @@ of_bsn_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18630,7 +18630,7 @@ of_bsn_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18673,7 +18673,7 @@ of_bsn_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18714,7 +18714,7 @@ of_bsn_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -34,7 +34,7 @@ void
 of_experimenter_stats_request_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 12)); /* experimenter */
         switch (value) {
@@ -235,7 +235,7 @@ of_experimenter_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -276,7 +276,7 @@ of_experimenter_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -319,7 +319,7 @@ of_experimenter_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -360,7 +360,7 @@ of_experimenter_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -403,7 +403,7 @@ of_experimenter_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -446,7 +446,7 @@ of_experimenter_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -491,7 +491,7 @@ of_experimenter_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -530,7 +530,7 @@ of_experimenter_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -572,7 +572,7 @@ of_experimenter_stats_request_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -621,7 +621,7 @@ of_experimenter_stats_request_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -694,7 +694,7 @@ void
 of_bsn_stats_request_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 20)); /* subtype */
         switch (value) {
@@ -919,7 +919,7 @@ of_bsn_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -960,7 +960,7 @@ of_bsn_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1003,7 +1003,7 @@ of_bsn_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1044,7 +1044,7 @@ of_bsn_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1087,7 +1087,7 @@ of_bsn_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1128,7 +1128,7 @@ of_bsn_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1171,7 +1171,7 @@ of_bsn_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1212,7 +1212,7 @@ of_bsn_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1271,7 +1271,7 @@ static void
 of_bsn_virtual_port_create_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -1457,7 +1457,7 @@ of_bsn_virtual_port_create_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1498,7 +1498,7 @@ of_bsn_virtual_port_create_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1541,7 +1541,7 @@ of_bsn_virtual_port_create_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1582,7 +1582,7 @@ of_bsn_virtual_port_create_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1625,7 +1625,7 @@ of_bsn_virtual_port_create_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1666,7 +1666,7 @@ of_bsn_virtual_port_create_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1709,7 +1709,7 @@ of_bsn_virtual_port_create_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1750,7 +1750,7 @@ of_bsn_virtual_port_create_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1793,7 +1793,7 @@ of_bsn_virtual_port_create_reply_vport_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1834,7 +1834,7 @@ of_bsn_virtual_port_create_reply_vport_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1894,7 +1894,7 @@ void
 of_bsn_vport_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 0)); /* type */
         switch (value) {
@@ -2068,7 +2068,7 @@ static void
 of_bsn_vport_q_in_q_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -2201,7 +2201,7 @@ of_bsn_vport_q_in_q_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2242,7 +2242,7 @@ of_bsn_vport_q_in_q_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2285,7 +2285,7 @@ of_bsn_vport_q_in_q_ingress_tpid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2326,7 +2326,7 @@ of_bsn_vport_q_in_q_ingress_tpid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2369,7 +2369,7 @@ of_bsn_vport_q_in_q_ingress_vlan_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2410,7 +2410,7 @@ of_bsn_vport_q_in_q_ingress_vlan_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2453,7 +2453,7 @@ of_bsn_vport_q_in_q_egress_tpid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2494,7 +2494,7 @@ of_bsn_vport_q_in_q_egress_tpid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2537,7 +2537,7 @@ of_bsn_vport_q_in_q_egress_vlan_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2578,7 +2578,7 @@ of_bsn_vport_q_in_q_egress_vlan_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2621,7 +2621,7 @@ of_bsn_vport_q_in_q_if_name_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2662,7 +2662,7 @@ of_bsn_vport_q_in_q_if_name_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VPORT_Q_IN_Q);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2721,7 +2721,7 @@ static void
 of_bsn_virtual_port_create_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -2907,7 +2907,7 @@ of_bsn_virtual_port_create_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2948,7 +2948,7 @@ of_bsn_virtual_port_create_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2991,7 +2991,7 @@ of_bsn_virtual_port_create_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3032,7 +3032,7 @@ of_bsn_virtual_port_create_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3075,7 +3075,7 @@ of_bsn_virtual_port_create_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3116,7 +3116,7 @@ of_bsn_virtual_port_create_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3165,7 +3165,7 @@ of_bsn_virtual_port_create_request_vport_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3242,7 +3242,7 @@ of_bsn_virtual_port_create_request_vport_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_CREATE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3329,7 +3329,7 @@ static void
 of_bsn_virtual_port_remove_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -3515,7 +3515,7 @@ of_bsn_virtual_port_remove_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3556,7 +3556,7 @@ of_bsn_virtual_port_remove_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3599,7 +3599,7 @@ of_bsn_virtual_port_remove_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3640,7 +3640,7 @@ of_bsn_virtual_port_remove_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3683,7 +3683,7 @@ of_bsn_virtual_port_remove_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3724,7 +3724,7 @@ of_bsn_virtual_port_remove_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3767,7 +3767,7 @@ of_bsn_virtual_port_remove_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3808,7 +3808,7 @@ of_bsn_virtual_port_remove_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3867,7 +3867,7 @@ static void
 of_bsn_virtual_port_remove_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -4053,7 +4053,7 @@ of_bsn_virtual_port_remove_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4094,7 +4094,7 @@ of_bsn_virtual_port_remove_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4137,7 +4137,7 @@ of_bsn_virtual_port_remove_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4178,7 +4178,7 @@ of_bsn_virtual_port_remove_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4221,7 +4221,7 @@ of_bsn_virtual_port_remove_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4262,7 +4262,7 @@ of_bsn_virtual_port_remove_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4305,7 +4305,7 @@ of_bsn_virtual_port_remove_request_vport_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4346,7 +4346,7 @@ of_bsn_virtual_port_remove_request_vport_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VIRTUAL_PORT_REMOVE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4405,7 +4405,7 @@ static void
 of_desc_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x11; /* type */
@@ -4594,7 +4594,7 @@ of_desc_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4635,7 +4635,7 @@ of_desc_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4678,7 +4678,7 @@ of_desc_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4719,7 +4719,7 @@ of_desc_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4762,7 +4762,7 @@ of_desc_stats_reply_mfr_desc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4805,7 +4805,7 @@ of_desc_stats_reply_mfr_desc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4850,7 +4850,7 @@ of_desc_stats_reply_hw_desc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4893,7 +4893,7 @@ of_desc_stats_reply_hw_desc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4938,7 +4938,7 @@ of_desc_stats_reply_sw_desc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4981,7 +4981,7 @@ of_desc_stats_reply_sw_desc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5026,7 +5026,7 @@ of_desc_stats_reply_serial_num_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5069,7 +5069,7 @@ of_desc_stats_reply_serial_num_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5114,7 +5114,7 @@ of_desc_stats_reply_dp_desc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5157,7 +5157,7 @@ of_desc_stats_reply_dp_desc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5218,7 +5218,7 @@ static void
 of_desc_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x10; /* type */
@@ -5407,7 +5407,7 @@ of_desc_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5448,7 +5448,7 @@ of_desc_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5491,7 +5491,7 @@ of_desc_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5532,7 +5532,7 @@ of_desc_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5591,7 +5591,7 @@ static void
 of_echo_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -5775,7 +5775,7 @@ of_echo_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ECHO_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5816,7 +5816,7 @@ of_echo_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ECHO_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5860,7 +5860,7 @@ of_echo_reply_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_ECHO_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5907,7 +5907,7 @@ of_echo_reply_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_ECHO_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5977,7 +5977,7 @@ static void
 of_echo_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -6161,7 +6161,7 @@ of_echo_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ECHO_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6202,7 +6202,7 @@ of_echo_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ECHO_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6246,7 +6246,7 @@ of_echo_request_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_ECHO_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6293,7 +6293,7 @@ of_echo_request_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_ECHO_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6363,7 +6363,7 @@ static void
 of_features_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -6547,7 +6547,7 @@ of_features_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6588,7 +6588,7 @@ of_features_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6631,7 +6631,7 @@ of_features_reply_datapath_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6672,7 +6672,7 @@ of_features_reply_datapath_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6715,7 +6715,7 @@ of_features_reply_n_buffers_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6756,7 +6756,7 @@ of_features_reply_n_buffers_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6799,7 +6799,7 @@ of_features_reply_n_tables_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6840,7 +6840,7 @@ of_features_reply_n_tables_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6883,7 +6883,7 @@ of_features_reply_auxiliary_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6921,7 +6921,7 @@ of_features_reply_auxiliary_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6961,7 +6961,7 @@ of_features_reply_capabilities_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7002,7 +7002,7 @@ of_features_reply_capabilities_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7045,7 +7045,7 @@ of_features_reply_reserved_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7085,7 +7085,7 @@ of_features_reply_reserved_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7133,7 +7133,7 @@ of_features_reply_ports_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7210,7 +7210,7 @@ of_features_reply_ports_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7281,7 +7281,7 @@ of_features_reply_actions_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7319,7 +7319,7 @@ of_features_reply_actions_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7375,7 +7375,7 @@ static void
 of_features_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -7559,7 +7559,7 @@ of_features_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7600,7 +7600,7 @@ of_features_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FEATURES_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7660,7 +7660,7 @@ void
 of_flow_mod_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 56)); /* _command */
         switch (value) {
@@ -7912,7 +7912,7 @@ of_flow_mod_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7953,7 +7953,7 @@ of_flow_mod_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7996,7 +7996,7 @@ of_flow_mod_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8039,7 +8039,7 @@ of_flow_mod_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8084,7 +8084,7 @@ of_flow_mod_cookie_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8124,7 +8124,7 @@ of_flow_mod_cookie_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8166,7 +8166,7 @@ of_flow_mod_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8206,7 +8206,7 @@ of_flow_mod_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8248,7 +8248,7 @@ of_flow_mod_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8291,7 +8291,7 @@ of_flow_mod_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8336,7 +8336,7 @@ of_flow_mod_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8379,7 +8379,7 @@ of_flow_mod_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8424,7 +8424,7 @@ of_flow_mod_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8467,7 +8467,7 @@ of_flow_mod_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8512,7 +8512,7 @@ of_flow_mod_buffer_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8555,7 +8555,7 @@ of_flow_mod_buffer_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8600,7 +8600,7 @@ of_flow_mod_out_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8644,7 +8644,7 @@ of_flow_mod_out_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8689,7 +8689,7 @@ of_flow_mod_out_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8729,7 +8729,7 @@ of_flow_mod_out_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8771,7 +8771,7 @@ of_flow_mod_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8814,7 +8814,7 @@ of_flow_mod_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8861,7 +8861,7 @@ of_flow_mod_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8922,7 +8922,7 @@ of_flow_mod_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8993,7 +8993,7 @@ of_flow_mod_instructions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9072,7 +9072,7 @@ of_flow_mod_instructions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9151,7 +9151,7 @@ of_flow_mod_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9225,7 +9225,7 @@ of_flow_mod_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9309,7 +9309,7 @@ static void
 of_flow_add_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0xe; /* type */
@@ -9504,7 +9504,7 @@ of_flow_add_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9545,7 +9545,7 @@ of_flow_add_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9588,7 +9588,7 @@ of_flow_add_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9631,7 +9631,7 @@ of_flow_add_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9676,7 +9676,7 @@ of_flow_add_cookie_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9716,7 +9716,7 @@ of_flow_add_cookie_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9758,7 +9758,7 @@ of_flow_add_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9798,7 +9798,7 @@ of_flow_add_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9840,7 +9840,7 @@ of_flow_add_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9883,7 +9883,7 @@ of_flow_add_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9928,7 +9928,7 @@ of_flow_add_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9971,7 +9971,7 @@ of_flow_add_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10016,7 +10016,7 @@ of_flow_add_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10059,7 +10059,7 @@ of_flow_add_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10104,7 +10104,7 @@ of_flow_add_buffer_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10147,7 +10147,7 @@ of_flow_add_buffer_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10192,7 +10192,7 @@ of_flow_add_out_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10236,7 +10236,7 @@ of_flow_add_out_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10281,7 +10281,7 @@ of_flow_add_out_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10321,7 +10321,7 @@ of_flow_add_out_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10363,7 +10363,7 @@ of_flow_add_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10406,7 +10406,7 @@ of_flow_add_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10453,7 +10453,7 @@ of_flow_add_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10514,7 +10514,7 @@ of_flow_add_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10585,7 +10585,7 @@ of_flow_add_instructions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10664,7 +10664,7 @@ of_flow_add_instructions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10743,7 +10743,7 @@ of_flow_add_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10817,7 +10817,7 @@ of_flow_add_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10901,7 +10901,7 @@ static void
 of_flow_delete_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0xe; /* type */
@@ -11096,7 +11096,7 @@ of_flow_delete_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11137,7 +11137,7 @@ of_flow_delete_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11180,7 +11180,7 @@ of_flow_delete_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11223,7 +11223,7 @@ of_flow_delete_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11268,7 +11268,7 @@ of_flow_delete_cookie_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11308,7 +11308,7 @@ of_flow_delete_cookie_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11350,7 +11350,7 @@ of_flow_delete_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11390,7 +11390,7 @@ of_flow_delete_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11432,7 +11432,7 @@ of_flow_delete_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11475,7 +11475,7 @@ of_flow_delete_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11520,7 +11520,7 @@ of_flow_delete_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11563,7 +11563,7 @@ of_flow_delete_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11608,7 +11608,7 @@ of_flow_delete_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11651,7 +11651,7 @@ of_flow_delete_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11696,7 +11696,7 @@ of_flow_delete_buffer_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11739,7 +11739,7 @@ of_flow_delete_buffer_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11784,7 +11784,7 @@ of_flow_delete_out_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11828,7 +11828,7 @@ of_flow_delete_out_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11873,7 +11873,7 @@ of_flow_delete_out_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11913,7 +11913,7 @@ of_flow_delete_out_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11955,7 +11955,7 @@ of_flow_delete_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11998,7 +11998,7 @@ of_flow_delete_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12045,7 +12045,7 @@ of_flow_delete_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12106,7 +12106,7 @@ of_flow_delete_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12177,7 +12177,7 @@ of_flow_delete_instructions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12256,7 +12256,7 @@ of_flow_delete_instructions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12335,7 +12335,7 @@ of_flow_delete_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12409,7 +12409,7 @@ of_flow_delete_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12493,7 +12493,7 @@ static void
 of_flow_delete_strict_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0xe; /* type */
@@ -12688,7 +12688,7 @@ of_flow_delete_strict_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12729,7 +12729,7 @@ of_flow_delete_strict_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12772,7 +12772,7 @@ of_flow_delete_strict_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12815,7 +12815,7 @@ of_flow_delete_strict_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12860,7 +12860,7 @@ of_flow_delete_strict_cookie_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12900,7 +12900,7 @@ of_flow_delete_strict_cookie_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12942,7 +12942,7 @@ of_flow_delete_strict_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12982,7 +12982,7 @@ of_flow_delete_strict_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13024,7 +13024,7 @@ of_flow_delete_strict_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13067,7 +13067,7 @@ of_flow_delete_strict_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13112,7 +13112,7 @@ of_flow_delete_strict_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13155,7 +13155,7 @@ of_flow_delete_strict_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13200,7 +13200,7 @@ of_flow_delete_strict_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13243,7 +13243,7 @@ of_flow_delete_strict_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13288,7 +13288,7 @@ of_flow_delete_strict_buffer_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13331,7 +13331,7 @@ of_flow_delete_strict_buffer_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13376,7 +13376,7 @@ of_flow_delete_strict_out_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13420,7 +13420,7 @@ of_flow_delete_strict_out_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13465,7 +13465,7 @@ of_flow_delete_strict_out_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13505,7 +13505,7 @@ of_flow_delete_strict_out_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13547,7 +13547,7 @@ of_flow_delete_strict_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13590,7 +13590,7 @@ of_flow_delete_strict_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13637,7 +13637,7 @@ of_flow_delete_strict_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13698,7 +13698,7 @@ of_flow_delete_strict_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13769,7 +13769,7 @@ of_flow_delete_strict_instructions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13848,7 +13848,7 @@ of_flow_delete_strict_instructions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13927,7 +13927,7 @@ of_flow_delete_strict_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14001,7 +14001,7 @@ of_flow_delete_strict_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14085,7 +14085,7 @@ static void
 of_flow_mod_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1; /* type */
@@ -14274,7 +14274,7 @@ of_flow_mod_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14315,7 +14315,7 @@ of_flow_mod_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14358,7 +14358,7 @@ of_flow_mod_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14399,7 +14399,7 @@ of_flow_mod_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14443,7 +14443,7 @@ of_flow_mod_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14490,7 +14490,7 @@ of_flow_mod_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14560,7 +14560,7 @@ static void
 of_flow_modify_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0xe; /* type */
@@ -14755,7 +14755,7 @@ of_flow_modify_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14796,7 +14796,7 @@ of_flow_modify_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14839,7 +14839,7 @@ of_flow_modify_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14882,7 +14882,7 @@ of_flow_modify_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14927,7 +14927,7 @@ of_flow_modify_cookie_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14967,7 +14967,7 @@ of_flow_modify_cookie_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15009,7 +15009,7 @@ of_flow_modify_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15049,7 +15049,7 @@ of_flow_modify_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15091,7 +15091,7 @@ of_flow_modify_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15134,7 +15134,7 @@ of_flow_modify_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15179,7 +15179,7 @@ of_flow_modify_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15222,7 +15222,7 @@ of_flow_modify_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15267,7 +15267,7 @@ of_flow_modify_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15310,7 +15310,7 @@ of_flow_modify_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15355,7 +15355,7 @@ of_flow_modify_buffer_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15398,7 +15398,7 @@ of_flow_modify_buffer_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15443,7 +15443,7 @@ of_flow_modify_out_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15487,7 +15487,7 @@ of_flow_modify_out_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15532,7 +15532,7 @@ of_flow_modify_out_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15572,7 +15572,7 @@ of_flow_modify_out_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15614,7 +15614,7 @@ of_flow_modify_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15657,7 +15657,7 @@ of_flow_modify_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15704,7 +15704,7 @@ of_flow_modify_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15765,7 +15765,7 @@ of_flow_modify_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15836,7 +15836,7 @@ of_flow_modify_instructions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15915,7 +15915,7 @@ of_flow_modify_instructions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15994,7 +15994,7 @@ of_flow_modify_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16068,7 +16068,7 @@ of_flow_modify_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16152,7 +16152,7 @@ static void
 of_flow_modify_strict_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0xe; /* type */
@@ -16347,7 +16347,7 @@ of_flow_modify_strict_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16388,7 +16388,7 @@ of_flow_modify_strict_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16431,7 +16431,7 @@ of_flow_modify_strict_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16474,7 +16474,7 @@ of_flow_modify_strict_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16519,7 +16519,7 @@ of_flow_modify_strict_cookie_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16559,7 +16559,7 @@ of_flow_modify_strict_cookie_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16601,7 +16601,7 @@ of_flow_modify_strict_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16641,7 +16641,7 @@ of_flow_modify_strict_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16683,7 +16683,7 @@ of_flow_modify_strict_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16726,7 +16726,7 @@ of_flow_modify_strict_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16771,7 +16771,7 @@ of_flow_modify_strict_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16814,7 +16814,7 @@ of_flow_modify_strict_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16859,7 +16859,7 @@ of_flow_modify_strict_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16902,7 +16902,7 @@ of_flow_modify_strict_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16947,7 +16947,7 @@ of_flow_modify_strict_buffer_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16990,7 +16990,7 @@ of_flow_modify_strict_buffer_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17035,7 +17035,7 @@ of_flow_modify_strict_out_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17079,7 +17079,7 @@ of_flow_modify_strict_out_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17124,7 +17124,7 @@ of_flow_modify_strict_out_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17164,7 +17164,7 @@ of_flow_modify_strict_out_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17206,7 +17206,7 @@ of_flow_modify_strict_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17249,7 +17249,7 @@ of_flow_modify_strict_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17296,7 +17296,7 @@ of_flow_modify_strict_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17357,7 +17357,7 @@ of_flow_modify_strict_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17428,7 +17428,7 @@ of_flow_modify_strict_instructions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17507,7 +17507,7 @@ of_flow_modify_strict_instructions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17586,7 +17586,7 @@ of_flow_modify_strict_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17660,7 +17660,7 @@ of_flow_modify_strict_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(IS_FLOW_MOD_SUBTYPE(obj->object_id));
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17744,7 +17744,7 @@ static void
 of_flow_removed_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -17934,7 +17934,7 @@ of_flow_removed_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17975,7 +17975,7 @@ of_flow_removed_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18018,7 +18018,7 @@ of_flow_removed_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18061,7 +18061,7 @@ of_flow_removed_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18106,7 +18106,7 @@ of_flow_removed_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18149,7 +18149,7 @@ of_flow_removed_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18194,7 +18194,7 @@ of_flow_removed_reason_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18237,7 +18237,7 @@ of_flow_removed_reason_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18282,7 +18282,7 @@ of_flow_removed_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18322,7 +18322,7 @@ of_flow_removed_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18364,7 +18364,7 @@ of_flow_removed_duration_sec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18407,7 +18407,7 @@ of_flow_removed_duration_sec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18452,7 +18452,7 @@ of_flow_removed_duration_nsec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18495,7 +18495,7 @@ of_flow_removed_duration_nsec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18540,7 +18540,7 @@ of_flow_removed_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18583,7 +18583,7 @@ of_flow_removed_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18628,7 +18628,7 @@ of_flow_removed_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18667,7 +18667,7 @@ of_flow_removed_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18708,7 +18708,7 @@ of_flow_removed_packet_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18751,7 +18751,7 @@ of_flow_removed_packet_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18796,7 +18796,7 @@ of_flow_removed_byte_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18839,7 +18839,7 @@ of_flow_removed_byte_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18886,7 +18886,7 @@ of_flow_removed_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18947,7 +18947,7 @@ of_flow_removed_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_REMOVED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19152,7 +19152,7 @@ of_flow_stats_entry_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19193,7 +19193,7 @@ of_flow_stats_entry_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19236,7 +19236,7 @@ of_flow_stats_entry_duration_sec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19279,7 +19279,7 @@ of_flow_stats_entry_duration_sec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19324,7 +19324,7 @@ of_flow_stats_entry_duration_nsec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19367,7 +19367,7 @@ of_flow_stats_entry_duration_nsec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19412,7 +19412,7 @@ of_flow_stats_entry_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19455,7 +19455,7 @@ of_flow_stats_entry_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19500,7 +19500,7 @@ of_flow_stats_entry_idle_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19543,7 +19543,7 @@ of_flow_stats_entry_idle_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19588,7 +19588,7 @@ of_flow_stats_entry_hard_timeout_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19631,7 +19631,7 @@ of_flow_stats_entry_hard_timeout_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19676,7 +19676,7 @@ of_flow_stats_entry_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19714,7 +19714,7 @@ of_flow_stats_entry_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19754,7 +19754,7 @@ of_flow_stats_entry_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19797,7 +19797,7 @@ of_flow_stats_entry_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19842,7 +19842,7 @@ of_flow_stats_entry_packet_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19885,7 +19885,7 @@ of_flow_stats_entry_packet_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19930,7 +19930,7 @@ of_flow_stats_entry_byte_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19973,7 +19973,7 @@ of_flow_stats_entry_byte_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20020,7 +20020,7 @@ of_flow_stats_entry_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20081,7 +20081,7 @@ of_flow_stats_entry_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20152,7 +20152,7 @@ of_flow_stats_entry_instructions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20231,7 +20231,7 @@ of_flow_stats_entry_instructions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20310,7 +20310,7 @@ of_flow_stats_entry_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20384,7 +20384,7 @@ of_flow_stats_entry_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20468,7 +20468,7 @@ static void
 of_flow_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x11; /* type */
@@ -20657,7 +20657,7 @@ of_flow_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20698,7 +20698,7 @@ of_flow_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20741,7 +20741,7 @@ of_flow_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20782,7 +20782,7 @@ of_flow_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20831,7 +20831,7 @@ of_flow_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20911,7 +20911,7 @@ of_flow_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21001,7 +21001,7 @@ static void
 of_flow_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x10; /* type */
@@ -21196,7 +21196,7 @@ of_flow_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21237,7 +21237,7 @@ of_flow_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21280,7 +21280,7 @@ of_flow_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21321,7 +21321,7 @@ of_flow_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21364,7 +21364,7 @@ of_flow_stats_request_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21407,7 +21407,7 @@ of_flow_stats_request_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21452,7 +21452,7 @@ of_flow_stats_request_out_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21496,7 +21496,7 @@ of_flow_stats_request_out_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21541,7 +21541,7 @@ of_flow_stats_request_out_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21581,7 +21581,7 @@ of_flow_stats_request_out_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21623,7 +21623,7 @@ of_flow_stats_request_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21663,7 +21663,7 @@ of_flow_stats_request_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21705,7 +21705,7 @@ of_flow_stats_request_cookie_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21745,7 +21745,7 @@ of_flow_stats_request_cookie_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21789,7 +21789,7 @@ of_flow_stats_request_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21850,7 +21850,7 @@ of_flow_stats_request_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_FLOW_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21931,7 +21931,7 @@ static void
 of_get_config_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -22115,7 +22115,7 @@ of_get_config_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22156,7 +22156,7 @@ of_get_config_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22199,7 +22199,7 @@ of_get_config_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22240,7 +22240,7 @@ of_get_config_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22283,7 +22283,7 @@ of_get_config_reply_miss_send_len_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22324,7 +22324,7 @@ of_get_config_reply_miss_send_len_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22383,7 +22383,7 @@ static void
 of_get_config_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -22567,7 +22567,7 @@ of_get_config_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GET_CONFIG_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22608,7 +22608,7 @@ of_get_config_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GET_CONFIG_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22667,7 +22667,7 @@ static void
 of_hello_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -22851,7 +22851,7 @@ of_hello_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_HELLO);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22892,7 +22892,7 @@ of_hello_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_HELLO);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22941,7 +22941,7 @@ of_hello_elements_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_HELLO);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23015,7 +23015,7 @@ of_hello_elements_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_HELLO);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23099,7 +23099,7 @@ static void
 of_hello_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -23284,7 +23284,7 @@ of_hello_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_HELLO_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23325,7 +23325,7 @@ of_hello_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_HELLO_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23368,7 +23368,7 @@ of_hello_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_HELLO_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23409,7 +23409,7 @@ of_hello_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_HELLO_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23453,7 +23453,7 @@ of_hello_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_HELLO_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23500,7 +23500,7 @@ of_hello_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_HELLO_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23683,7 +23683,7 @@ of_match_v1_wildcards_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23721,7 +23721,7 @@ of_match_v1_wildcards_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23761,7 +23761,7 @@ of_match_v1_in_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23800,7 +23800,7 @@ of_match_v1_in_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23840,7 +23840,7 @@ of_match_v1_eth_src_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23878,7 +23878,7 @@ of_match_v1_eth_src_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23918,7 +23918,7 @@ of_match_v1_eth_dst_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23956,7 +23956,7 @@ of_match_v1_eth_dst_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23996,7 +23996,7 @@ of_match_v1_vlan_vid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24034,7 +24034,7 @@ of_match_v1_vlan_vid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24074,7 +24074,7 @@ of_match_v1_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24112,7 +24112,7 @@ of_match_v1_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24152,7 +24152,7 @@ of_match_v1_eth_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24190,7 +24190,7 @@ of_match_v1_eth_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24230,7 +24230,7 @@ of_match_v1_ip_dscp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24268,7 +24268,7 @@ of_match_v1_ip_dscp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24308,7 +24308,7 @@ of_match_v1_ip_proto_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24346,7 +24346,7 @@ of_match_v1_ip_proto_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24386,7 +24386,7 @@ of_match_v1_ipv4_src_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24424,7 +24424,7 @@ of_match_v1_ipv4_src_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24464,7 +24464,7 @@ of_match_v1_ipv4_dst_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24502,7 +24502,7 @@ of_match_v1_ipv4_dst_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24542,7 +24542,7 @@ of_match_v1_tcp_src_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24580,7 +24580,7 @@ of_match_v1_tcp_src_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24620,7 +24620,7 @@ of_match_v1_tcp_dst_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24658,7 +24658,7 @@ of_match_v1_tcp_dst_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24715,7 +24715,7 @@ void
 of_nicira_header_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 12)); /* subtype */
         switch (value) {
@@ -24907,7 +24907,7 @@ of_nicira_header_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24948,7 +24948,7 @@ of_nicira_header_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24991,7 +24991,7 @@ of_nicira_header_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25032,7 +25032,7 @@ of_nicira_header_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25075,7 +25075,7 @@ of_nicira_header_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25116,7 +25116,7 @@ of_nicira_header_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_HEADER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25175,7 +25175,7 @@ static void
 of_nicira_controller_role_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -25358,7 +25358,7 @@ of_nicira_controller_role_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25396,7 +25396,7 @@ of_nicira_controller_role_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25436,7 +25436,7 @@ of_nicira_controller_role_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25474,7 +25474,7 @@ of_nicira_controller_role_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25514,7 +25514,7 @@ of_nicira_controller_role_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25552,7 +25552,7 @@ of_nicira_controller_role_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25592,7 +25592,7 @@ of_nicira_controller_role_reply_role_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -25630,7 +25630,7 @@ of_nicira_controller_role_reply_role_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
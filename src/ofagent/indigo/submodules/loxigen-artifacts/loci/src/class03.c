@@ -33,7 +33,7 @@ static void
 of_nicira_controller_role_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -216,7 +216,7 @@ of_nicira_controller_role_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -254,7 +254,7 @@ of_nicira_controller_role_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -294,7 +294,7 @@ of_nicira_controller_role_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -332,7 +332,7 @@ of_nicira_controller_role_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -372,7 +372,7 @@ of_nicira_controller_role_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -410,7 +410,7 @@ of_nicira_controller_role_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -450,7 +450,7 @@ of_nicira_controller_role_request_role_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -488,7 +488,7 @@ of_nicira_controller_role_request_role_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_NICIRA_CONTROLLER_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -544,7 +544,7 @@ static void
 of_packet_in_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -734,7 +734,7 @@ of_packet_in_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -775,7 +775,7 @@ of_packet_in_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -818,7 +818,7 @@ of_packet_in_buffer_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -859,7 +859,7 @@ of_packet_in_buffer_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -902,7 +902,7 @@ of_packet_in_total_len_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -947,7 +947,7 @@ of_packet_in_total_len_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -994,7 +994,7 @@ of_packet_in_reason_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1039,7 +1039,7 @@ of_packet_in_reason_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1086,7 +1086,7 @@ of_packet_in_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1128,7 +1128,7 @@ of_packet_in_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1172,7 +1172,7 @@ of_packet_in_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1210,7 +1210,7 @@ of_packet_in_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1252,7 +1252,7 @@ of_packet_in_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1308,7 +1308,7 @@ of_packet_in_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1369,7 +1369,7 @@ of_packet_in_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1422,7 +1422,7 @@ of_packet_in_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1482,7 +1482,7 @@ of_packet_in_in_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1524,7 +1524,7 @@ of_packet_in_in_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1567,7 +1567,7 @@ of_packet_in_in_phy_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1606,7 +1606,7 @@ of_packet_in_in_phy_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1662,7 +1662,7 @@ static void
 of_packet_out_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -1846,7 +1846,7 @@ of_packet_out_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1887,7 +1887,7 @@ of_packet_out_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1930,7 +1930,7 @@ of_packet_out_buffer_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1971,7 +1971,7 @@ of_packet_out_buffer_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2014,7 +2014,7 @@ of_packet_out_in_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2058,7 +2058,7 @@ of_packet_out_in_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2109,7 +2109,7 @@ of_packet_out_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2189,7 +2189,7 @@ of_packet_out_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2262,7 +2262,7 @@ of_packet_out_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2309,7 +2309,7 @@ of_packet_out_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2497,7 +2497,7 @@ of_packet_queue_queue_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_QUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2538,7 +2538,7 @@ of_packet_queue_queue_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_QUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2581,7 +2581,7 @@ of_packet_queue_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_QUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2621,7 +2621,7 @@ of_packet_queue_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_QUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2668,7 +2668,7 @@ of_packet_queue_properties_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_QUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2748,7 +2748,7 @@ of_packet_queue_properties_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_PACKET_QUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2951,7 +2951,7 @@ of_port_desc_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2995,7 +2995,7 @@ of_port_desc_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3040,7 +3040,7 @@ of_port_desc_hw_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3083,7 +3083,7 @@ of_port_desc_hw_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3128,7 +3128,7 @@ of_port_desc_name_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3171,7 +3171,7 @@ of_port_desc_name_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3216,7 +3216,7 @@ of_port_desc_config_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3259,7 +3259,7 @@ of_port_desc_config_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3304,7 +3304,7 @@ of_port_desc_state_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3347,7 +3347,7 @@ of_port_desc_state_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3392,7 +3392,7 @@ of_port_desc_curr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3435,7 +3435,7 @@ of_port_desc_curr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3480,7 +3480,7 @@ of_port_desc_advertised_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3523,7 +3523,7 @@ of_port_desc_advertised_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3568,7 +3568,7 @@ of_port_desc_supported_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3611,7 +3611,7 @@ of_port_desc_supported_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3656,7 +3656,7 @@ of_port_desc_peer_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3699,7 +3699,7 @@ of_port_desc_peer_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3744,7 +3744,7 @@ of_port_desc_curr_speed_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3784,7 +3784,7 @@ of_port_desc_curr_speed_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3826,7 +3826,7 @@ of_port_desc_max_speed_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3866,7 +3866,7 @@ of_port_desc_max_speed_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3924,7 +3924,7 @@ static void
 of_port_mod_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0xf; /* type */
@@ -4111,7 +4111,7 @@ of_port_mod_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4152,7 +4152,7 @@ of_port_mod_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4195,7 +4195,7 @@ of_port_mod_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4239,7 +4239,7 @@ of_port_mod_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4284,7 +4284,7 @@ of_port_mod_hw_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4327,7 +4327,7 @@ of_port_mod_hw_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4372,7 +4372,7 @@ of_port_mod_config_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4415,7 +4415,7 @@ of_port_mod_config_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4460,7 +4460,7 @@ of_port_mod_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4503,7 +4503,7 @@ of_port_mod_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4548,7 +4548,7 @@ of_port_mod_advertise_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4591,7 +4591,7 @@ of_port_mod_advertise_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4652,7 +4652,7 @@ static void
 of_port_mod_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1; /* type */
@@ -4841,7 +4841,7 @@ of_port_mod_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4882,7 +4882,7 @@ of_port_mod_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4925,7 +4925,7 @@ of_port_mod_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4966,7 +4966,7 @@ of_port_mod_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5010,7 +5010,7 @@ of_port_mod_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5057,7 +5057,7 @@ of_port_mod_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_PORT_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5240,7 +5240,7 @@ of_port_stats_entry_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5284,7 +5284,7 @@ of_port_stats_entry_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5329,7 +5329,7 @@ of_port_stats_entry_rx_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5370,7 +5370,7 @@ of_port_stats_entry_rx_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5413,7 +5413,7 @@ of_port_stats_entry_tx_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5454,7 +5454,7 @@ of_port_stats_entry_tx_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5497,7 +5497,7 @@ of_port_stats_entry_rx_bytes_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5538,7 +5538,7 @@ of_port_stats_entry_rx_bytes_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5581,7 +5581,7 @@ of_port_stats_entry_tx_bytes_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5622,7 +5622,7 @@ of_port_stats_entry_tx_bytes_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5665,7 +5665,7 @@ of_port_stats_entry_rx_dropped_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5706,7 +5706,7 @@ of_port_stats_entry_rx_dropped_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5749,7 +5749,7 @@ of_port_stats_entry_tx_dropped_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5790,7 +5790,7 @@ of_port_stats_entry_tx_dropped_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5833,7 +5833,7 @@ of_port_stats_entry_rx_errors_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5874,7 +5874,7 @@ of_port_stats_entry_rx_errors_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5917,7 +5917,7 @@ of_port_stats_entry_tx_errors_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5958,7 +5958,7 @@ of_port_stats_entry_tx_errors_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6001,7 +6001,7 @@ of_port_stats_entry_rx_frame_err_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6042,7 +6042,7 @@ of_port_stats_entry_rx_frame_err_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6085,7 +6085,7 @@ of_port_stats_entry_rx_over_err_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6126,7 +6126,7 @@ of_port_stats_entry_rx_over_err_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6169,7 +6169,7 @@ of_port_stats_entry_rx_crc_err_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6210,7 +6210,7 @@ of_port_stats_entry_rx_crc_err_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6253,7 +6253,7 @@ of_port_stats_entry_collisions_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6294,7 +6294,7 @@ of_port_stats_entry_collisions_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6337,7 +6337,7 @@ of_port_stats_entry_duration_sec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6375,7 +6375,7 @@ of_port_stats_entry_duration_sec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6415,7 +6415,7 @@ of_port_stats_entry_duration_nsec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6453,7 +6453,7 @@ of_port_stats_entry_duration_nsec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6509,7 +6509,7 @@ static void
 of_port_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x11; /* type */
@@ -6698,7 +6698,7 @@ of_port_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6739,7 +6739,7 @@ of_port_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6782,7 +6782,7 @@ of_port_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6823,7 +6823,7 @@ of_port_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6872,7 +6872,7 @@ of_port_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6952,7 +6952,7 @@ of_port_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7042,7 +7042,7 @@ static void
 of_port_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x10; /* type */
@@ -7231,7 +7231,7 @@ of_port_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7272,7 +7272,7 @@ of_port_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7315,7 +7315,7 @@ of_port_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7356,7 +7356,7 @@ of_port_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7399,7 +7399,7 @@ of_port_stats_request_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7443,7 +7443,7 @@ of_port_stats_request_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7504,7 +7504,7 @@ static void
 of_port_status_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -7688,7 +7688,7 @@ of_port_status_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7729,7 +7729,7 @@ of_port_status_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7772,7 +7772,7 @@ of_port_status_reason_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7813,7 +7813,7 @@ of_port_status_reason_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7862,7 +7862,7 @@ of_port_status_desc_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7942,7 +7942,7 @@ of_port_status_desc_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_PORT_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8032,7 +8032,7 @@ static void
 of_queue_get_config_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x15; /* type */
@@ -8219,7 +8219,7 @@ of_queue_get_config_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8260,7 +8260,7 @@ of_queue_get_config_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8303,7 +8303,7 @@ of_queue_get_config_reply_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8347,7 +8347,7 @@ of_queue_get_config_reply_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8398,7 +8398,7 @@ of_queue_get_config_reply_queues_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8475,7 +8475,7 @@ of_queue_get_config_reply_queues_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8562,7 +8562,7 @@ static void
 of_queue_get_config_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x14; /* type */
@@ -8749,7 +8749,7 @@ of_queue_get_config_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8790,7 +8790,7 @@ of_queue_get_config_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8833,7 +8833,7 @@ of_queue_get_config_request_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8877,7 +8877,7 @@ of_queue_get_config_request_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_GET_CONFIG_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8938,7 +8938,7 @@ static void
 of_queue_op_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1; /* type */
@@ -9127,7 +9127,7 @@ of_queue_op_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_OP_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9168,7 +9168,7 @@ of_queue_op_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_OP_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9211,7 +9211,7 @@ of_queue_op_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_OP_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9252,7 +9252,7 @@ of_queue_op_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_OP_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9296,7 +9296,7 @@ of_queue_op_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_OP_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9343,7 +9343,7 @@ of_queue_op_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_OP_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9414,7 +9414,7 @@ void
 of_queue_prop_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 0)); /* type */
         switch (value) {
@@ -9604,7 +9604,7 @@ static void
 of_queue_prop_min_rate_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -9746,7 +9746,7 @@ of_queue_prop_min_rate_rate_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_MIN_RATE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9787,7 +9787,7 @@ of_queue_prop_min_rate_rate_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_MIN_RATE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9959,7 +9959,7 @@ of_queue_stats_entry_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10003,7 +10003,7 @@ of_queue_stats_entry_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10048,7 +10048,7 @@ of_queue_stats_entry_queue_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10089,7 +10089,7 @@ of_queue_stats_entry_queue_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10132,7 +10132,7 @@ of_queue_stats_entry_tx_bytes_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10173,7 +10173,7 @@ of_queue_stats_entry_tx_bytes_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10216,7 +10216,7 @@ of_queue_stats_entry_tx_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10257,7 +10257,7 @@ of_queue_stats_entry_tx_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10300,7 +10300,7 @@ of_queue_stats_entry_tx_errors_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10341,7 +10341,7 @@ of_queue_stats_entry_tx_errors_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10384,7 +10384,7 @@ of_queue_stats_entry_duration_sec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10422,7 +10422,7 @@ of_queue_stats_entry_duration_sec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10462,7 +10462,7 @@ of_queue_stats_entry_duration_nsec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10500,7 +10500,7 @@ of_queue_stats_entry_duration_nsec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10556,7 +10556,7 @@ static void
 of_queue_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x11; /* type */
@@ -10745,7 +10745,7 @@ of_queue_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10786,7 +10786,7 @@ of_queue_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10829,7 +10829,7 @@ of_queue_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10870,7 +10870,7 @@ of_queue_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10919,7 +10919,7 @@ of_queue_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10999,7 +10999,7 @@ of_queue_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11089,7 +11089,7 @@ static void
 of_queue_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x10; /* type */
@@ -11278,7 +11278,7 @@ of_queue_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11319,7 +11319,7 @@ of_queue_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11362,7 +11362,7 @@ of_queue_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11403,7 +11403,7 @@ of_queue_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11446,7 +11446,7 @@ of_queue_stats_request_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11490,7 +11490,7 @@ of_queue_stats_request_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11535,7 +11535,7 @@ of_queue_stats_request_queue_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11578,7 +11578,7 @@ of_queue_stats_request_queue_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11639,7 +11639,7 @@ static void
 of_set_config_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
@@ -11823,7 +11823,7 @@ of_set_config_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SET_CONFIG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11864,7 +11864,7 @@ of_set_config_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SET_CONFIG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11907,7 +11907,7 @@ of_set_config_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SET_CONFIG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11948,7 +11948,7 @@ of_set_config_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SET_CONFIG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11991,7 +11991,7 @@ of_set_config_miss_send_len_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SET_CONFIG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12032,7 +12032,7 @@ of_set_config_miss_send_len_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SET_CONFIG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12091,7 +12091,7 @@ static void
 of_table_mod_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x16; /* type */
@@ -12278,7 +12278,7 @@ of_table_mod_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12319,7 +12319,7 @@ of_table_mod_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12362,7 +12362,7 @@ of_table_mod_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12403,7 +12403,7 @@ of_table_mod_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12446,7 +12446,7 @@ of_table_mod_config_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12487,7 +12487,7 @@ of_table_mod_config_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12659,7 +12659,7 @@ of_table_stats_entry_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12700,7 +12700,7 @@ of_table_stats_entry_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12743,7 +12743,7 @@ of_table_stats_entry_active_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12790,7 +12790,7 @@ of_table_stats_entry_active_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12839,7 +12839,7 @@ of_table_stats_entry_lookup_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12886,7 +12886,7 @@ of_table_stats_entry_lookup_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12935,7 +12935,7 @@ of_table_stats_entry_matched_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12982,7 +12982,7 @@ of_table_stats_entry_matched_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13031,7 +13031,7 @@ of_table_stats_entry_name_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13073,7 +13073,7 @@ of_table_stats_entry_name_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13117,7 +13117,7 @@ of_table_stats_entry_match_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13158,7 +13158,7 @@ of_table_stats_entry_match_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13201,7 +13201,7 @@ of_table_stats_entry_wildcards_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13245,7 +13245,7 @@ of_table_stats_entry_wildcards_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13291,7 +13291,7 @@ of_table_stats_entry_write_actions_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13332,7 +13332,7 @@ of_table_stats_entry_write_actions_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13375,7 +13375,7 @@ of_table_stats_entry_apply_actions_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13416,7 +13416,7 @@ of_table_stats_entry_apply_actions_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13459,7 +13459,7 @@ of_table_stats_entry_write_setfields_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13497,7 +13497,7 @@ of_table_stats_entry_write_setfields_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13537,7 +13537,7 @@ of_table_stats_entry_apply_setfields_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13575,7 +13575,7 @@ of_table_stats_entry_apply_setfields_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13615,7 +13615,7 @@ of_table_stats_entry_metadata_match_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13653,7 +13653,7 @@ of_table_stats_entry_metadata_match_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13693,7 +13693,7 @@ of_table_stats_entry_metadata_write_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13731,7 +13731,7 @@ of_table_stats_entry_metadata_write_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13771,7 +13771,7 @@ of_table_stats_entry_instructions_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13812,7 +13812,7 @@ of_table_stats_entry_instructions_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13855,7 +13855,7 @@ of_table_stats_entry_config_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13896,7 +13896,7 @@ of_table_stats_entry_config_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13939,7 +13939,7 @@ of_table_stats_entry_max_entries_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13983,7 +13983,7 @@ of_table_stats_entry_max_entries_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14045,7 +14045,7 @@ static void
 of_table_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x11; /* type */
@@ -14234,7 +14234,7 @@ of_table_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14275,7 +14275,7 @@ of_table_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14318,7 +14318,7 @@ of_table_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14359,7 +14359,7 @@ of_table_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14408,7 +14408,7 @@ of_table_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14488,7 +14488,7 @@ of_table_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14578,7 +14578,7 @@ static void
 of_table_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x10; /* type */
@@ -14767,7 +14767,7 @@ of_table_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14808,7 +14808,7 @@ of_table_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14851,7 +14851,7 @@ of_table_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14892,7 +14892,7 @@ of_table_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14951,7 +14951,7 @@ static void
 of_action_copy_ttl_in_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -15108,7 +15108,7 @@ static void
 of_action_copy_ttl_out_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -15265,7 +15265,7 @@ static void
 of_action_dec_mpls_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -15422,7 +15422,7 @@ static void
 of_action_dec_nw_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -15579,7 +15579,7 @@ static void
 of_action_group_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -15720,7 +15720,7 @@ of_action_group_group_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_GROUP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15760,7 +15760,7 @@ of_action_group_group_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_GROUP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15818,7 +15818,7 @@ static void
 of_action_pop_mpls_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -15959,7 +15959,7 @@ of_action_pop_mpls_ethertype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_POP_MPLS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15999,7 +15999,7 @@ of_action_pop_mpls_ethertype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_POP_MPLS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16057,7 +16057,7 @@ static void
 of_action_pop_vlan_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -16214,7 +16214,7 @@ static void
 of_action_push_mpls_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -16355,7 +16355,7 @@ of_action_push_mpls_ethertype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_PUSH_MPLS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16395,7 +16395,7 @@ of_action_push_mpls_ethertype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_PUSH_MPLS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -33,7 +33,7 @@ static void
 of_action_push_vlan_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -174,7 +174,7 @@ of_action_push_vlan_ethertype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_PUSH_VLAN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -214,7 +214,7 @@ of_action_push_vlan_ethertype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_PUSH_VLAN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -272,7 +272,7 @@ static void
 of_action_set_mpls_label_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
         *(uint16_t *)(buf + 0) = U16_HTON(0xd); /* type */
         break;
@@ -411,7 +411,7 @@ of_action_set_mpls_label_mpls_label_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_MPLS_LABEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -449,7 +449,7 @@ of_action_set_mpls_label_mpls_label_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_MPLS_LABEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -505,7 +505,7 @@ static void
 of_action_set_mpls_tc_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
         *(uint16_t *)(buf + 0) = U16_HTON(0xe); /* type */
         break;
@@ -644,7 +644,7 @@ of_action_set_mpls_tc_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_MPLS_TC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -682,7 +682,7 @@ of_action_set_mpls_tc_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_MPLS_TC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -738,7 +738,7 @@ static void
 of_action_set_mpls_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -879,7 +879,7 @@ of_action_set_mpls_ttl_mpls_ttl_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_MPLS_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -919,7 +919,7 @@ of_action_set_mpls_ttl_mpls_ttl_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_MPLS_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -977,7 +977,7 @@ static void
 of_action_set_nw_ecn_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
         *(uint16_t *)(buf + 0) = U16_HTON(0x8); /* type */
         break;
@@ -1116,7 +1116,7 @@ of_action_set_nw_ecn_nw_ecn_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_ECN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1154,7 +1154,7 @@ of_action_set_nw_ecn_nw_ecn_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_ECN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1210,7 +1210,7 @@ static void
 of_action_set_nw_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -1351,7 +1351,7 @@ of_action_set_nw_ttl_nw_ttl_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1391,7 +1391,7 @@ of_action_set_nw_ttl_nw_ttl_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_NW_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1449,7 +1449,7 @@ static void
 of_action_set_queue_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -1590,7 +1590,7 @@ of_action_set_queue_queue_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_QUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1630,7 +1630,7 @@ of_action_set_queue_queue_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_QUEUE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1688,7 +1688,7 @@ static void
 of_bad_instruction_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -1872,7 +1872,7 @@ of_bad_instruction_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_INSTRUCTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1912,7 +1912,7 @@ of_bad_instruction_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_INSTRUCTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1954,7 +1954,7 @@ of_bad_instruction_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_INSTRUCTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1994,7 +1994,7 @@ of_bad_instruction_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_INSTRUCTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2037,7 +2037,7 @@ of_bad_instruction_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BAD_INSTRUCTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2083,7 +2083,7 @@ of_bad_instruction_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BAD_INSTRUCTION_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2152,7 +2152,7 @@ static void
 of_bad_match_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -2336,7 +2336,7 @@ of_bad_match_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_MATCH_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2376,7 +2376,7 @@ of_bad_match_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_MATCH_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2418,7 +2418,7 @@ of_bad_match_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_MATCH_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2458,7 +2458,7 @@ of_bad_match_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BAD_MATCH_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2501,7 +2501,7 @@ of_bad_match_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BAD_MATCH_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2547,7 +2547,7 @@ of_bad_match_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BAD_MATCH_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2734,7 +2734,7 @@ of_bucket_weight_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2774,7 +2774,7 @@ of_bucket_weight_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2816,7 +2816,7 @@ of_bucket_watch_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2857,7 +2857,7 @@ of_bucket_watch_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2899,7 +2899,7 @@ of_bucket_watch_group_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2939,7 +2939,7 @@ of_bucket_watch_group_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2987,7 +2987,7 @@ of_bucket_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3063,7 +3063,7 @@ of_bucket_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3262,7 +3262,7 @@ of_bucket_counter_packet_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET_COUNTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3302,7 +3302,7 @@ of_bucket_counter_packet_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET_COUNTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3344,7 +3344,7 @@ of_bucket_counter_byte_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET_COUNTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3384,7 +3384,7 @@ of_bucket_counter_byte_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BUCKET_COUNTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3443,7 +3443,7 @@ void
 of_group_mod_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 8)); /* command */
         switch (value) {
@@ -3647,7 +3647,7 @@ of_group_mod_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3687,7 +3687,7 @@ of_group_mod_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3729,7 +3729,7 @@ of_group_mod_group_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3769,7 +3769,7 @@ of_group_mod_group_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3811,7 +3811,7 @@ of_group_mod_group_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3851,7 +3851,7 @@ of_group_mod_group_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3899,7 +3899,7 @@ of_group_mod_buckets_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3975,7 +3975,7 @@ of_group_mod_buckets_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4061,7 +4061,7 @@ static void
 of_group_add_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -4245,7 +4245,7 @@ of_group_add_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4285,7 +4285,7 @@ of_group_add_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4327,7 +4327,7 @@ of_group_add_group_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4367,7 +4367,7 @@ of_group_add_group_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4409,7 +4409,7 @@ of_group_add_group_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4449,7 +4449,7 @@ of_group_add_group_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4497,7 +4497,7 @@ of_group_add_buckets_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4573,7 +4573,7 @@ of_group_add_buckets_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4659,7 +4659,7 @@ static void
 of_group_delete_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -4843,7 +4843,7 @@ of_group_delete_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4883,7 +4883,7 @@ of_group_delete_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4925,7 +4925,7 @@ of_group_delete_group_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4965,7 +4965,7 @@ of_group_delete_group_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5007,7 +5007,7 @@ of_group_delete_group_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5047,7 +5047,7 @@ of_group_delete_group_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5095,7 +5095,7 @@ of_group_delete_buckets_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5171,7 +5171,7 @@ of_group_delete_buckets_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5375,7 +5375,7 @@ of_group_desc_stats_entry_group_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5415,7 +5415,7 @@ of_group_desc_stats_entry_group_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5457,7 +5457,7 @@ of_group_desc_stats_entry_group_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5497,7 +5497,7 @@ of_group_desc_stats_entry_group_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5545,7 +5545,7 @@ of_group_desc_stats_entry_buckets_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5621,7 +5621,7 @@ of_group_desc_stats_entry_buckets_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5707,7 +5707,7 @@ static void
 of_group_desc_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -5891,7 +5891,7 @@ of_group_desc_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5931,7 +5931,7 @@ of_group_desc_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5973,7 +5973,7 @@ of_group_desc_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6013,7 +6013,7 @@ of_group_desc_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6061,7 +6061,7 @@ of_group_desc_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6137,7 +6137,7 @@ of_group_desc_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6223,7 +6223,7 @@ static void
 of_group_desc_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -6407,7 +6407,7 @@ of_group_desc_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6447,7 +6447,7 @@ of_group_desc_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6489,7 +6489,7 @@ of_group_desc_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6529,7 +6529,7 @@ of_group_desc_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6587,7 +6587,7 @@ static void
 of_group_mod_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -6771,7 +6771,7 @@ of_group_mod_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6811,7 +6811,7 @@ of_group_mod_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6853,7 +6853,7 @@ of_group_mod_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6893,7 +6893,7 @@ of_group_mod_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6936,7 +6936,7 @@ of_group_mod_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6982,7 +6982,7 @@ of_group_mod_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7051,7 +7051,7 @@ static void
 of_group_modify_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -7235,7 +7235,7 @@ of_group_modify_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7275,7 +7275,7 @@ of_group_modify_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7317,7 +7317,7 @@ of_group_modify_group_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7357,7 +7357,7 @@ of_group_modify_group_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7399,7 +7399,7 @@ of_group_modify_group_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7439,7 +7439,7 @@ of_group_modify_group_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7487,7 +7487,7 @@ of_group_modify_buckets_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7563,7 +7563,7 @@ of_group_modify_buckets_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7767,7 +7767,7 @@ of_group_stats_entry_group_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7807,7 +7807,7 @@ of_group_stats_entry_group_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7849,7 +7849,7 @@ of_group_stats_entry_ref_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7889,7 +7889,7 @@ of_group_stats_entry_ref_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7931,7 +7931,7 @@ of_group_stats_entry_packet_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7971,7 +7971,7 @@ of_group_stats_entry_packet_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8013,7 +8013,7 @@ of_group_stats_entry_byte_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8053,7 +8053,7 @@ of_group_stats_entry_byte_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8095,7 +8095,7 @@ of_group_stats_entry_duration_sec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8133,7 +8133,7 @@ of_group_stats_entry_duration_sec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8173,7 +8173,7 @@ of_group_stats_entry_duration_nsec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8211,7 +8211,7 @@ of_group_stats_entry_duration_nsec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8257,7 +8257,7 @@ of_group_stats_entry_bucket_stats_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8336,7 +8336,7 @@ of_group_stats_entry_bucket_stats_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8425,7 +8425,7 @@ static void
 of_group_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -8609,7 +8609,7 @@ of_group_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8649,7 +8649,7 @@ of_group_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8691,7 +8691,7 @@ of_group_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8731,7 +8731,7 @@ of_group_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8779,7 +8779,7 @@ of_group_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8855,7 +8855,7 @@ of_group_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8941,7 +8941,7 @@ static void
 of_group_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -9125,7 +9125,7 @@ of_group_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9165,7 +9165,7 @@ of_group_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9207,7 +9207,7 @@ of_group_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9247,7 +9247,7 @@ of_group_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9289,7 +9289,7 @@ of_group_stats_request_group_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9329,7 +9329,7 @@ of_group_stats_request_group_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9388,7 +9388,7 @@ void
 of_instruction_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 0)); /* type */
         switch (value) {
@@ -9602,7 +9602,7 @@ static void
 of_instruction_apply_actions_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -9749,7 +9749,7 @@ of_instruction_apply_actions_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_APPLY_ACTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9825,7 +9825,7 @@ of_instruction_apply_actions_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_APPLY_ACTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9911,7 +9911,7 @@ static void
 of_instruction_clear_actions_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -10069,7 +10069,7 @@ void
 of_instruction_experimenter_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 4)); /* experimenter */
         switch (value) {
@@ -10212,7 +10212,7 @@ of_instruction_experimenter_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10252,7 +10252,7 @@ of_instruction_experimenter_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10295,7 +10295,7 @@ of_instruction_experimenter_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10341,7 +10341,7 @@ of_instruction_experimenter_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10410,7 +10410,7 @@ static void
 of_instruction_goto_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -10551,7 +10551,7 @@ of_instruction_goto_table_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_GOTO_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10591,7 +10591,7 @@ of_instruction_goto_table_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_GOTO_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10649,7 +10649,7 @@ static void
 of_instruction_write_actions_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -10796,7 +10796,7 @@ of_instruction_write_actions_actions_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_WRITE_ACTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10872,7 +10872,7 @@ of_instruction_write_actions_actions_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_WRITE_ACTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10958,7 +10958,7 @@ static void
 of_instruction_write_metadata_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -11099,7 +11099,7 @@ of_instruction_write_metadata_metadata_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_WRITE_METADATA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11139,7 +11139,7 @@ of_instruction_write_metadata_metadata_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_WRITE_METADATA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11181,7 +11181,7 @@ of_instruction_write_metadata_metadata_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_WRITE_METADATA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11221,7 +11221,7 @@ of_instruction_write_metadata_metadata_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_WRITE_METADATA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11279,7 +11279,7 @@ static void
 of_match_v2_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
         *(uint16_t *)(buf + 0) = U16_HTON(0x0); /* type */
         break;
@@ -11409,7 +11409,7 @@ of_match_v2_in_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11448,7 +11448,7 @@ of_match_v2_in_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11488,7 +11488,7 @@ of_match_v2_wildcards_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11526,7 +11526,7 @@ of_match_v2_wildcards_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11566,7 +11566,7 @@ of_match_v2_eth_src_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11604,7 +11604,7 @@ of_match_v2_eth_src_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11644,7 +11644,7 @@ of_match_v2_eth_src_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11682,7 +11682,7 @@ of_match_v2_eth_src_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11722,7 +11722,7 @@ of_match_v2_eth_dst_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11760,7 +11760,7 @@ of_match_v2_eth_dst_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11800,7 +11800,7 @@ of_match_v2_eth_dst_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11838,7 +11838,7 @@ of_match_v2_eth_dst_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11878,7 +11878,7 @@ of_match_v2_vlan_vid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11916,7 +11916,7 @@ of_match_v2_vlan_vid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11956,7 +11956,7 @@ of_match_v2_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11994,7 +11994,7 @@ of_match_v2_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12034,7 +12034,7 @@ of_match_v2_eth_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12072,7 +12072,7 @@ of_match_v2_eth_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12112,7 +12112,7 @@ of_match_v2_ip_dscp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12150,7 +12150,7 @@ of_match_v2_ip_dscp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12190,7 +12190,7 @@ of_match_v2_ip_proto_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12228,7 +12228,7 @@ of_match_v2_ip_proto_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12268,7 +12268,7 @@ of_match_v2_ipv4_src_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12306,7 +12306,7 @@ of_match_v2_ipv4_src_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12346,7 +12346,7 @@ of_match_v2_ipv4_src_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12384,7 +12384,7 @@ of_match_v2_ipv4_src_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12424,7 +12424,7 @@ of_match_v2_ipv4_dst_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12462,7 +12462,7 @@ of_match_v2_ipv4_dst_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12502,7 +12502,7 @@ of_match_v2_ipv4_dst_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12540,7 +12540,7 @@ of_match_v2_ipv4_dst_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12580,7 +12580,7 @@ of_match_v2_tcp_src_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12618,7 +12618,7 @@ of_match_v2_tcp_src_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12658,7 +12658,7 @@ of_match_v2_tcp_dst_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12696,7 +12696,7 @@ of_match_v2_tcp_dst_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12736,7 +12736,7 @@ of_match_v2_mpls_label_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12774,7 +12774,7 @@ of_match_v2_mpls_label_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12814,7 +12814,7 @@ of_match_v2_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12852,7 +12852,7 @@ of_match_v2_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12892,7 +12892,7 @@ of_match_v2_metadata_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12930,7 +12930,7 @@ of_match_v2_metadata_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12970,7 +12970,7 @@ of_match_v2_metadata_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13008,7 +13008,7 @@ of_match_v2_metadata_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13064,7 +13064,7 @@ static void
 of_switch_config_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -13248,7 +13248,7 @@ of_switch_config_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SWITCH_CONFIG_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13288,7 +13288,7 @@ of_switch_config_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SWITCH_CONFIG_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13330,7 +13330,7 @@ of_switch_config_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SWITCH_CONFIG_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13370,7 +13370,7 @@ of_switch_config_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_SWITCH_CONFIG_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13413,7 +13413,7 @@ of_switch_config_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_SWITCH_CONFIG_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13459,7 +13459,7 @@ of_switch_config_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_SWITCH_CONFIG_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13528,7 +13528,7 @@ static void
 of_table_mod_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_1:
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
@@ -13712,7 +13712,7 @@ of_table_mod_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13752,7 +13752,7 @@ of_table_mod_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13794,7 +13794,7 @@ of_table_mod_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13834,7 +13834,7 @@ of_table_mod_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13877,7 +13877,7 @@ of_table_mod_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13923,7 +13923,7 @@ of_table_mod_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -34,7 +34,7 @@ void
 of_oxm_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 0)); /* type_len */
         switch (value) {
@@ -907,7 +907,7 @@ static void
 of_action_set_field_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x19); /* type */
@@ -1048,7 +1048,7 @@ of_action_set_field_field_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_FIELD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1093,7 +1093,7 @@ of_action_set_field_field_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_SET_FIELD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1161,7 +1161,7 @@ static void
 of_experimenter_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
@@ -1344,7 +1344,7 @@ of_experimenter_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1383,7 +1383,7 @@ of_experimenter_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1424,7 +1424,7 @@ of_experimenter_error_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1463,7 +1463,7 @@ of_experimenter_error_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1504,7 +1504,7 @@ of_experimenter_error_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1543,7 +1543,7 @@ of_experimenter_error_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1585,7 +1585,7 @@ of_experimenter_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1630,7 +1630,7 @@ of_experimenter_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1698,7 +1698,7 @@ static void
 of_group_features_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
@@ -1881,7 +1881,7 @@ of_group_features_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1920,7 +1920,7 @@ of_group_features_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1961,7 +1961,7 @@ of_group_features_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2000,7 +2000,7 @@ of_group_features_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2041,7 +2041,7 @@ of_group_features_stats_reply_types_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2080,7 +2080,7 @@ of_group_features_stats_reply_types_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2121,7 +2121,7 @@ of_group_features_stats_reply_capabilities_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2160,7 +2160,7 @@ of_group_features_stats_reply_capabilities_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2201,7 +2201,7 @@ of_group_features_stats_reply_max_groups_all_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2240,7 +2240,7 @@ of_group_features_stats_reply_max_groups_all_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2281,7 +2281,7 @@ of_group_features_stats_reply_max_groups_select_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2320,7 +2320,7 @@ of_group_features_stats_reply_max_groups_select_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2361,7 +2361,7 @@ of_group_features_stats_reply_max_groups_indirect_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2400,7 +2400,7 @@ of_group_features_stats_reply_max_groups_indirect_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2441,7 +2441,7 @@ of_group_features_stats_reply_max_groups_ff_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2480,7 +2480,7 @@ of_group_features_stats_reply_max_groups_ff_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2521,7 +2521,7 @@ of_group_features_stats_reply_actions_all_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2560,7 +2560,7 @@ of_group_features_stats_reply_actions_all_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2601,7 +2601,7 @@ of_group_features_stats_reply_actions_select_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2640,7 +2640,7 @@ of_group_features_stats_reply_actions_select_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2681,7 +2681,7 @@ of_group_features_stats_reply_actions_indirect_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2720,7 +2720,7 @@ of_group_features_stats_reply_actions_indirect_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2761,7 +2761,7 @@ of_group_features_stats_reply_actions_ff_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2800,7 +2800,7 @@ of_group_features_stats_reply_actions_ff_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2857,7 +2857,7 @@ static void
 of_group_features_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
@@ -3040,7 +3040,7 @@ of_group_features_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3079,7 +3079,7 @@ of_group_features_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3120,7 +3120,7 @@ of_group_features_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3159,7 +3159,7 @@ of_group_features_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_GROUP_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3216,7 +3216,7 @@ static void
 of_match_v3_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1); /* type */
@@ -3360,7 +3360,7 @@ of_match_v3_oxm_list_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V3);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3435,7 +3435,7 @@ of_match_v3_oxm_list_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_MATCH_V3);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3520,7 +3520,7 @@ static void
 of_oxm_arp_op_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002a02); /* type_len */
@@ -3654,7 +3654,7 @@ of_oxm_arp_op_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_OP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3693,7 +3693,7 @@ of_oxm_arp_op_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_OP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3750,7 +3750,7 @@ static void
 of_oxm_arp_op_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002b04); /* type_len */
@@ -3884,7 +3884,7 @@ of_oxm_arp_op_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_OP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3923,7 +3923,7 @@ of_oxm_arp_op_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_OP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3964,7 +3964,7 @@ of_oxm_arp_op_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_OP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4003,7 +4003,7 @@ of_oxm_arp_op_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_OP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4060,7 +4060,7 @@ static void
 of_oxm_arp_sha_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003006); /* type_len */
@@ -4194,7 +4194,7 @@ of_oxm_arp_sha_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SHA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4233,7 +4233,7 @@ of_oxm_arp_sha_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SHA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4290,7 +4290,7 @@ static void
 of_oxm_arp_sha_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x8000310c); /* type_len */
@@ -4424,7 +4424,7 @@ of_oxm_arp_sha_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SHA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4463,7 +4463,7 @@ of_oxm_arp_sha_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SHA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4504,7 +4504,7 @@ of_oxm_arp_sha_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SHA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4543,7 +4543,7 @@ of_oxm_arp_sha_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SHA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4600,7 +4600,7 @@ static void
 of_oxm_arp_spa_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002c04); /* type_len */
@@ -4734,7 +4734,7 @@ of_oxm_arp_spa_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4773,7 +4773,7 @@ of_oxm_arp_spa_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4830,7 +4830,7 @@ static void
 of_oxm_arp_spa_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002d08); /* type_len */
@@ -4964,7 +4964,7 @@ of_oxm_arp_spa_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SPA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5003,7 +5003,7 @@ of_oxm_arp_spa_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SPA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5044,7 +5044,7 @@ of_oxm_arp_spa_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SPA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5083,7 +5083,7 @@ of_oxm_arp_spa_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_SPA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5140,7 +5140,7 @@ static void
 of_oxm_arp_tha_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003206); /* type_len */
@@ -5274,7 +5274,7 @@ of_oxm_arp_tha_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_THA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5313,7 +5313,7 @@ of_oxm_arp_tha_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_THA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5370,7 +5370,7 @@ static void
 of_oxm_arp_tha_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x8000330c); /* type_len */
@@ -5504,7 +5504,7 @@ of_oxm_arp_tha_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_THA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5543,7 +5543,7 @@ of_oxm_arp_tha_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_THA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5584,7 +5584,7 @@ of_oxm_arp_tha_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_THA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5623,7 +5623,7 @@ of_oxm_arp_tha_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_THA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5680,7 +5680,7 @@ static void
 of_oxm_arp_tpa_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002e04); /* type_len */
@@ -5814,7 +5814,7 @@ of_oxm_arp_tpa_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_TPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5853,7 +5853,7 @@ of_oxm_arp_tpa_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_TPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5910,7 +5910,7 @@ static void
 of_oxm_arp_tpa_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002f08); /* type_len */
@@ -6044,7 +6044,7 @@ of_oxm_arp_tpa_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_TPA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6083,7 +6083,7 @@ of_oxm_arp_tpa_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_TPA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6124,7 +6124,7 @@ of_oxm_arp_tpa_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_TPA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6163,7 +6163,7 @@ of_oxm_arp_tpa_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ARP_TPA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6220,7 +6220,7 @@ static void
 of_oxm_bsn_egr_port_group_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30e04); /* type_len */
@@ -6354,7 +6354,7 @@ of_oxm_bsn_egr_port_group_id_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_EGR_PORT_GROUP_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6393,7 +6393,7 @@ of_oxm_bsn_egr_port_group_id_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_EGR_PORT_GROUP_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6450,7 +6450,7 @@ static void
 of_oxm_bsn_egr_port_group_id_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30f08); /* type_len */
@@ -6584,7 +6584,7 @@ of_oxm_bsn_egr_port_group_id_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_EGR_PORT_GROUP_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6623,7 +6623,7 @@ of_oxm_bsn_egr_port_group_id_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_EGR_PORT_GROUP_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6664,7 +6664,7 @@ of_oxm_bsn_egr_port_group_id_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_EGR_PORT_GROUP_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6703,7 +6703,7 @@ of_oxm_bsn_egr_port_group_id_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_EGR_PORT_GROUP_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6760,7 +6760,7 @@ static void
 of_oxm_bsn_global_vrf_allowed_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30601); /* type_len */
@@ -6894,7 +6894,7 @@ of_oxm_bsn_global_vrf_allowed_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_GLOBAL_VRF_ALLOWED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6933,7 +6933,7 @@ of_oxm_bsn_global_vrf_allowed_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_GLOBAL_VRF_ALLOWED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6990,7 +6990,7 @@ static void
 of_oxm_bsn_global_vrf_allowed_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30702); /* type_len */
@@ -7124,7 +7124,7 @@ of_oxm_bsn_global_vrf_allowed_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_GLOBAL_VRF_ALLOWED_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7163,7 +7163,7 @@ of_oxm_bsn_global_vrf_allowed_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_GLOBAL_VRF_ALLOWED_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7204,7 +7204,7 @@ of_oxm_bsn_global_vrf_allowed_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_GLOBAL_VRF_ALLOWED_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7243,7 +7243,7 @@ of_oxm_bsn_global_vrf_allowed_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_GLOBAL_VRF_ALLOWED_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7300,7 +7300,7 @@ static void
 of_oxm_bsn_in_ports_128_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30010); /* type_len */
@@ -7434,7 +7434,7 @@ of_oxm_bsn_in_ports_128_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_IN_PORTS_128);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7473,7 +7473,7 @@ of_oxm_bsn_in_ports_128_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_IN_PORTS_128);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7530,7 +7530,7 @@ static void
 of_oxm_bsn_in_ports_128_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30120); /* type_len */
@@ -7664,7 +7664,7 @@ of_oxm_bsn_in_ports_128_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_IN_PORTS_128_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7703,7 +7703,7 @@ of_oxm_bsn_in_ports_128_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_IN_PORTS_128_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7744,7 +7744,7 @@ of_oxm_bsn_in_ports_128_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_IN_PORTS_128_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7783,7 +7783,7 @@ of_oxm_bsn_in_ports_128_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_IN_PORTS_128_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7840,7 +7840,7 @@ static void
 of_oxm_bsn_l3_dst_class_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30c04); /* type_len */
@@ -7974,7 +7974,7 @@ of_oxm_bsn_l3_dst_class_id_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_DST_CLASS_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8013,7 +8013,7 @@ of_oxm_bsn_l3_dst_class_id_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_DST_CLASS_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8070,7 +8070,7 @@ static void
 of_oxm_bsn_l3_dst_class_id_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30d08); /* type_len */
@@ -8204,7 +8204,7 @@ of_oxm_bsn_l3_dst_class_id_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_DST_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8243,7 +8243,7 @@ of_oxm_bsn_l3_dst_class_id_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_DST_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8284,7 +8284,7 @@ of_oxm_bsn_l3_dst_class_id_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_DST_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8323,7 +8323,7 @@ of_oxm_bsn_l3_dst_class_id_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_DST_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8380,7 +8380,7 @@ static void
 of_oxm_bsn_l3_interface_class_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30804); /* type_len */
@@ -8514,7 +8514,7 @@ of_oxm_bsn_l3_interface_class_id_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_INTERFACE_CLASS_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8553,7 +8553,7 @@ of_oxm_bsn_l3_interface_class_id_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_INTERFACE_CLASS_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8610,7 +8610,7 @@ static void
 of_oxm_bsn_l3_interface_class_id_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30908); /* type_len */
@@ -8744,7 +8744,7 @@ of_oxm_bsn_l3_interface_class_id_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_INTERFACE_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8783,7 +8783,7 @@ of_oxm_bsn_l3_interface_class_id_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_INTERFACE_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8824,7 +8824,7 @@ of_oxm_bsn_l3_interface_class_id_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_INTERFACE_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8863,7 +8863,7 @@ of_oxm_bsn_l3_interface_class_id_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_INTERFACE_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8920,7 +8920,7 @@ static void
 of_oxm_bsn_l3_src_class_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30a04); /* type_len */
@@ -9054,7 +9054,7 @@ of_oxm_bsn_l3_src_class_id_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_SRC_CLASS_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9093,7 +9093,7 @@ of_oxm_bsn_l3_src_class_id_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_SRC_CLASS_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9150,7 +9150,7 @@ static void
 of_oxm_bsn_l3_src_class_id_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30b08); /* type_len */
@@ -9284,7 +9284,7 @@ of_oxm_bsn_l3_src_class_id_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_SRC_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9323,7 +9323,7 @@ of_oxm_bsn_l3_src_class_id_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_SRC_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9364,7 +9364,7 @@ of_oxm_bsn_l3_src_class_id_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_SRC_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9403,7 +9403,7 @@ of_oxm_bsn_l3_src_class_id_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_L3_SRC_CLASS_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9460,7 +9460,7 @@ static void
 of_oxm_bsn_lag_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30204); /* type_len */
@@ -9594,7 +9594,7 @@ of_oxm_bsn_lag_id_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_LAG_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9633,7 +9633,7 @@ of_oxm_bsn_lag_id_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_LAG_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9690,7 +9690,7 @@ static void
 of_oxm_bsn_lag_id_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30308); /* type_len */
@@ -9824,7 +9824,7 @@ of_oxm_bsn_lag_id_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_LAG_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9863,7 +9863,7 @@ of_oxm_bsn_lag_id_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_LAG_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9904,7 +9904,7 @@ of_oxm_bsn_lag_id_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_LAG_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9943,7 +9943,7 @@ of_oxm_bsn_lag_id_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_LAG_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10000,7 +10000,7 @@ static void
 of_oxm_bsn_udf0_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31004); /* type_len */
@@ -10134,7 +10134,7 @@ of_oxm_bsn_udf0_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF0);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10173,7 +10173,7 @@ of_oxm_bsn_udf0_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF0);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10230,7 +10230,7 @@ static void
 of_oxm_bsn_udf0_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31108); /* type_len */
@@ -10364,7 +10364,7 @@ of_oxm_bsn_udf0_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF0_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10403,7 +10403,7 @@ of_oxm_bsn_udf0_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF0_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10444,7 +10444,7 @@ of_oxm_bsn_udf0_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF0_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10483,7 +10483,7 @@ of_oxm_bsn_udf0_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF0_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -33,7 +33,7 @@ static void
 of_oxm_bsn_udf1_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31204); /* type_len */
@@ -167,7 +167,7 @@ of_oxm_bsn_udf1_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -206,7 +206,7 @@ of_oxm_bsn_udf1_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF1);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -263,7 +263,7 @@ static void
 of_oxm_bsn_udf1_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31308); /* type_len */
@@ -397,7 +397,7 @@ of_oxm_bsn_udf1_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF1_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -436,7 +436,7 @@ of_oxm_bsn_udf1_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF1_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -477,7 +477,7 @@ of_oxm_bsn_udf1_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF1_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -516,7 +516,7 @@ of_oxm_bsn_udf1_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF1_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -573,7 +573,7 @@ static void
 of_oxm_bsn_udf2_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31404); /* type_len */
@@ -707,7 +707,7 @@ of_oxm_bsn_udf2_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -746,7 +746,7 @@ of_oxm_bsn_udf2_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF2);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -803,7 +803,7 @@ static void
 of_oxm_bsn_udf2_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31508); /* type_len */
@@ -937,7 +937,7 @@ of_oxm_bsn_udf2_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF2_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -976,7 +976,7 @@ of_oxm_bsn_udf2_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF2_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1017,7 +1017,7 @@ of_oxm_bsn_udf2_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF2_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1056,7 +1056,7 @@ of_oxm_bsn_udf2_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF2_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1113,7 +1113,7 @@ static void
 of_oxm_bsn_udf3_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31604); /* type_len */
@@ -1247,7 +1247,7 @@ of_oxm_bsn_udf3_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF3);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1286,7 +1286,7 @@ of_oxm_bsn_udf3_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF3);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1343,7 +1343,7 @@ static void
 of_oxm_bsn_udf3_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31708); /* type_len */
@@ -1477,7 +1477,7 @@ of_oxm_bsn_udf3_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF3_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1516,7 +1516,7 @@ of_oxm_bsn_udf3_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF3_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1557,7 +1557,7 @@ of_oxm_bsn_udf3_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF3_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1596,7 +1596,7 @@ of_oxm_bsn_udf3_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF3_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1653,7 +1653,7 @@ static void
 of_oxm_bsn_udf4_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31804); /* type_len */
@@ -1787,7 +1787,7 @@ of_oxm_bsn_udf4_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF4);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1826,7 +1826,7 @@ of_oxm_bsn_udf4_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF4);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1883,7 +1883,7 @@ static void
 of_oxm_bsn_udf4_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31908); /* type_len */
@@ -2017,7 +2017,7 @@ of_oxm_bsn_udf4_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF4_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2056,7 +2056,7 @@ of_oxm_bsn_udf4_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF4_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2097,7 +2097,7 @@ of_oxm_bsn_udf4_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF4_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2136,7 +2136,7 @@ of_oxm_bsn_udf4_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF4_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2193,7 +2193,7 @@ static void
 of_oxm_bsn_udf5_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31a04); /* type_len */
@@ -2327,7 +2327,7 @@ of_oxm_bsn_udf5_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF5);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2366,7 +2366,7 @@ of_oxm_bsn_udf5_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF5);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2423,7 +2423,7 @@ static void
 of_oxm_bsn_udf5_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31b08); /* type_len */
@@ -2557,7 +2557,7 @@ of_oxm_bsn_udf5_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF5_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2596,7 +2596,7 @@ of_oxm_bsn_udf5_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF5_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2637,7 +2637,7 @@ of_oxm_bsn_udf5_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF5_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2676,7 +2676,7 @@ of_oxm_bsn_udf5_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF5_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2733,7 +2733,7 @@ static void
 of_oxm_bsn_udf6_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31c04); /* type_len */
@@ -2867,7 +2867,7 @@ of_oxm_bsn_udf6_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF6);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2906,7 +2906,7 @@ of_oxm_bsn_udf6_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF6);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2963,7 +2963,7 @@ static void
 of_oxm_bsn_udf6_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31d08); /* type_len */
@@ -3097,7 +3097,7 @@ of_oxm_bsn_udf6_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF6_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3136,7 +3136,7 @@ of_oxm_bsn_udf6_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF6_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3177,7 +3177,7 @@ of_oxm_bsn_udf6_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF6_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3216,7 +3216,7 @@ of_oxm_bsn_udf6_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF6_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3273,7 +3273,7 @@ static void
 of_oxm_bsn_udf7_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31e04); /* type_len */
@@ -3407,7 +3407,7 @@ of_oxm_bsn_udf7_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF7);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3446,7 +3446,7 @@ of_oxm_bsn_udf7_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF7);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3503,7 +3503,7 @@ static void
 of_oxm_bsn_udf7_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x31f08); /* type_len */
@@ -3637,7 +3637,7 @@ of_oxm_bsn_udf7_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF7_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3676,7 +3676,7 @@ of_oxm_bsn_udf7_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF7_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3717,7 +3717,7 @@ of_oxm_bsn_udf7_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF7_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3756,7 +3756,7 @@ of_oxm_bsn_udf7_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_UDF7_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3813,7 +3813,7 @@ static void
 of_oxm_bsn_vrf_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30404); /* type_len */
@@ -3947,7 +3947,7 @@ of_oxm_bsn_vrf_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_VRF);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3986,7 +3986,7 @@ of_oxm_bsn_vrf_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_VRF);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4043,7 +4043,7 @@ static void
 of_oxm_bsn_vrf_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x30508); /* type_len */
@@ -4177,7 +4177,7 @@ of_oxm_bsn_vrf_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_VRF_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4216,7 +4216,7 @@ of_oxm_bsn_vrf_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_VRF_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4257,7 +4257,7 @@ of_oxm_bsn_vrf_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_VRF_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4296,7 +4296,7 @@ of_oxm_bsn_vrf_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_BSN_VRF_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4353,7 +4353,7 @@ static void
 of_oxm_eth_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000606); /* type_len */
@@ -4487,7 +4487,7 @@ of_oxm_eth_dst_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4526,7 +4526,7 @@ of_oxm_eth_dst_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4583,7 +4583,7 @@ static void
 of_oxm_eth_dst_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x8000070c); /* type_len */
@@ -4717,7 +4717,7 @@ of_oxm_eth_dst_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4756,7 +4756,7 @@ of_oxm_eth_dst_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4797,7 +4797,7 @@ of_oxm_eth_dst_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4836,7 +4836,7 @@ of_oxm_eth_dst_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4893,7 +4893,7 @@ static void
 of_oxm_eth_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000806); /* type_len */
@@ -5027,7 +5027,7 @@ of_oxm_eth_src_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5066,7 +5066,7 @@ of_oxm_eth_src_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5123,7 +5123,7 @@ static void
 of_oxm_eth_src_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x8000090c); /* type_len */
@@ -5257,7 +5257,7 @@ of_oxm_eth_src_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5296,7 +5296,7 @@ of_oxm_eth_src_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5337,7 +5337,7 @@ of_oxm_eth_src_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5376,7 +5376,7 @@ of_oxm_eth_src_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5433,7 +5433,7 @@ static void
 of_oxm_eth_type_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000a02); /* type_len */
@@ -5567,7 +5567,7 @@ of_oxm_eth_type_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5606,7 +5606,7 @@ of_oxm_eth_type_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5663,7 +5663,7 @@ static void
 of_oxm_eth_type_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000b04); /* type_len */
@@ -5797,7 +5797,7 @@ of_oxm_eth_type_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5836,7 +5836,7 @@ of_oxm_eth_type_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5877,7 +5877,7 @@ of_oxm_eth_type_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5916,7 +5916,7 @@ of_oxm_eth_type_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ETH_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5973,7 +5973,7 @@ static void
 of_oxm_icmpv4_code_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002801); /* type_len */
@@ -6107,7 +6107,7 @@ of_oxm_icmpv4_code_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_CODE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6146,7 +6146,7 @@ of_oxm_icmpv4_code_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_CODE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6203,7 +6203,7 @@ static void
 of_oxm_icmpv4_code_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002902); /* type_len */
@@ -6337,7 +6337,7 @@ of_oxm_icmpv4_code_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_CODE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6376,7 +6376,7 @@ of_oxm_icmpv4_code_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_CODE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6417,7 +6417,7 @@ of_oxm_icmpv4_code_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_CODE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6456,7 +6456,7 @@ of_oxm_icmpv4_code_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_CODE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6513,7 +6513,7 @@ static void
 of_oxm_icmpv4_type_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002601); /* type_len */
@@ -6647,7 +6647,7 @@ of_oxm_icmpv4_type_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6686,7 +6686,7 @@ of_oxm_icmpv4_type_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6743,7 +6743,7 @@ static void
 of_oxm_icmpv4_type_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002702); /* type_len */
@@ -6877,7 +6877,7 @@ of_oxm_icmpv4_type_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6916,7 +6916,7 @@ of_oxm_icmpv4_type_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6957,7 +6957,7 @@ of_oxm_icmpv4_type_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6996,7 +6996,7 @@ of_oxm_icmpv4_type_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV4_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7053,7 +7053,7 @@ static void
 of_oxm_icmpv6_code_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003c01); /* type_len */
@@ -7187,7 +7187,7 @@ of_oxm_icmpv6_code_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_CODE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7226,7 +7226,7 @@ of_oxm_icmpv6_code_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_CODE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7283,7 +7283,7 @@ static void
 of_oxm_icmpv6_code_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003d02); /* type_len */
@@ -7417,7 +7417,7 @@ of_oxm_icmpv6_code_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_CODE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7456,7 +7456,7 @@ of_oxm_icmpv6_code_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_CODE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7497,7 +7497,7 @@ of_oxm_icmpv6_code_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_CODE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7536,7 +7536,7 @@ of_oxm_icmpv6_code_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_CODE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7593,7 +7593,7 @@ static void
 of_oxm_icmpv6_type_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003a01); /* type_len */
@@ -7727,7 +7727,7 @@ of_oxm_icmpv6_type_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7766,7 +7766,7 @@ of_oxm_icmpv6_type_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7823,7 +7823,7 @@ static void
 of_oxm_icmpv6_type_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003b02); /* type_len */
@@ -7957,7 +7957,7 @@ of_oxm_icmpv6_type_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7996,7 +7996,7 @@ of_oxm_icmpv6_type_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8037,7 +8037,7 @@ of_oxm_icmpv6_type_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8076,7 +8076,7 @@ of_oxm_icmpv6_type_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ICMPV6_TYPE_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8133,7 +8133,7 @@ static void
 of_oxm_in_phy_port_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000204); /* type_len */
@@ -8267,7 +8267,7 @@ of_oxm_in_phy_port_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PHY_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8307,7 +8307,7 @@ of_oxm_in_phy_port_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PHY_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8364,7 +8364,7 @@ static void
 of_oxm_in_phy_port_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000308); /* type_len */
@@ -8498,7 +8498,7 @@ of_oxm_in_phy_port_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PHY_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8538,7 +8538,7 @@ of_oxm_in_phy_port_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PHY_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8579,7 +8579,7 @@ of_oxm_in_phy_port_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PHY_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8619,7 +8619,7 @@ of_oxm_in_phy_port_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PHY_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -33,7 +33,7 @@ static void
 of_oxm_in_port_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000004); /* type_len */
@@ -167,7 +167,7 @@ of_oxm_in_port_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -207,7 +207,7 @@ of_oxm_in_port_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -264,7 +264,7 @@ static void
 of_oxm_in_port_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000108); /* type_len */
@@ -398,7 +398,7 @@ of_oxm_in_port_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -438,7 +438,7 @@ of_oxm_in_port_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -479,7 +479,7 @@ of_oxm_in_port_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -519,7 +519,7 @@ of_oxm_in_port_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IN_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -576,7 +576,7 @@ static void
 of_oxm_ip_dscp_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001001); /* type_len */
@@ -710,7 +710,7 @@ of_oxm_ip_dscp_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_DSCP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -749,7 +749,7 @@ of_oxm_ip_dscp_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_DSCP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -806,7 +806,7 @@ static void
 of_oxm_ip_dscp_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001102); /* type_len */
@@ -940,7 +940,7 @@ of_oxm_ip_dscp_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_DSCP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -979,7 +979,7 @@ of_oxm_ip_dscp_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_DSCP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1020,7 +1020,7 @@ of_oxm_ip_dscp_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_DSCP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1059,7 +1059,7 @@ of_oxm_ip_dscp_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_DSCP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1116,7 +1116,7 @@ static void
 of_oxm_ip_ecn_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001201); /* type_len */
@@ -1250,7 +1250,7 @@ of_oxm_ip_ecn_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_ECN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1289,7 +1289,7 @@ of_oxm_ip_ecn_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_ECN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1346,7 +1346,7 @@ static void
 of_oxm_ip_ecn_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001302); /* type_len */
@@ -1480,7 +1480,7 @@ of_oxm_ip_ecn_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_ECN_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1519,7 +1519,7 @@ of_oxm_ip_ecn_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_ECN_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1560,7 +1560,7 @@ of_oxm_ip_ecn_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_ECN_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1599,7 +1599,7 @@ of_oxm_ip_ecn_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_ECN_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1656,7 +1656,7 @@ static void
 of_oxm_ip_proto_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001401); /* type_len */
@@ -1790,7 +1790,7 @@ of_oxm_ip_proto_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_PROTO);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1829,7 +1829,7 @@ of_oxm_ip_proto_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_PROTO);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1886,7 +1886,7 @@ static void
 of_oxm_ip_proto_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001502); /* type_len */
@@ -2020,7 +2020,7 @@ of_oxm_ip_proto_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_PROTO_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2059,7 +2059,7 @@ of_oxm_ip_proto_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_PROTO_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2100,7 +2100,7 @@ of_oxm_ip_proto_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_PROTO_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2139,7 +2139,7 @@ of_oxm_ip_proto_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IP_PROTO_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2196,7 +2196,7 @@ static void
 of_oxm_ipv4_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001804); /* type_len */
@@ -2330,7 +2330,7 @@ of_oxm_ipv4_dst_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2369,7 +2369,7 @@ of_oxm_ipv4_dst_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2426,7 +2426,7 @@ static void
 of_oxm_ipv4_dst_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001908); /* type_len */
@@ -2560,7 +2560,7 @@ of_oxm_ipv4_dst_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2599,7 +2599,7 @@ of_oxm_ipv4_dst_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2640,7 +2640,7 @@ of_oxm_ipv4_dst_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2679,7 +2679,7 @@ of_oxm_ipv4_dst_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2736,7 +2736,7 @@ static void
 of_oxm_ipv4_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001604); /* type_len */
@@ -2870,7 +2870,7 @@ of_oxm_ipv4_src_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2909,7 +2909,7 @@ of_oxm_ipv4_src_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2966,7 +2966,7 @@ static void
 of_oxm_ipv4_src_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001708); /* type_len */
@@ -3100,7 +3100,7 @@ of_oxm_ipv4_src_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3139,7 +3139,7 @@ of_oxm_ipv4_src_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3180,7 +3180,7 @@ of_oxm_ipv4_src_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3219,7 +3219,7 @@ of_oxm_ipv4_src_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV4_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3276,7 +3276,7 @@ static void
 of_oxm_ipv6_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003610); /* type_len */
@@ -3410,7 +3410,7 @@ of_oxm_ipv6_dst_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3449,7 +3449,7 @@ of_oxm_ipv6_dst_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3506,7 +3506,7 @@ static void
 of_oxm_ipv6_dst_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003720); /* type_len */
@@ -3640,7 +3640,7 @@ of_oxm_ipv6_dst_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3679,7 +3679,7 @@ of_oxm_ipv6_dst_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3720,7 +3720,7 @@ of_oxm_ipv6_dst_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3759,7 +3759,7 @@ of_oxm_ipv6_dst_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3816,7 +3816,7 @@ static void
 of_oxm_ipv6_flabel_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003804); /* type_len */
@@ -3950,7 +3950,7 @@ of_oxm_ipv6_flabel_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_FLABEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3989,7 +3989,7 @@ of_oxm_ipv6_flabel_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_FLABEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4046,7 +4046,7 @@ static void
 of_oxm_ipv6_flabel_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003908); /* type_len */
@@ -4180,7 +4180,7 @@ of_oxm_ipv6_flabel_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_FLABEL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4219,7 +4219,7 @@ of_oxm_ipv6_flabel_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_FLABEL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4260,7 +4260,7 @@ of_oxm_ipv6_flabel_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_FLABEL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4299,7 +4299,7 @@ of_oxm_ipv6_flabel_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_FLABEL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4356,7 +4356,7 @@ static void
 of_oxm_ipv6_nd_sll_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004006); /* type_len */
@@ -4490,7 +4490,7 @@ of_oxm_ipv6_nd_sll_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_SLL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4529,7 +4529,7 @@ of_oxm_ipv6_nd_sll_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_SLL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4586,7 +4586,7 @@ static void
 of_oxm_ipv6_nd_sll_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x8000410c); /* type_len */
@@ -4720,7 +4720,7 @@ of_oxm_ipv6_nd_sll_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_SLL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4759,7 +4759,7 @@ of_oxm_ipv6_nd_sll_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_SLL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4800,7 +4800,7 @@ of_oxm_ipv6_nd_sll_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_SLL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4839,7 +4839,7 @@ of_oxm_ipv6_nd_sll_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_SLL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4896,7 +4896,7 @@ static void
 of_oxm_ipv6_nd_target_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003e10); /* type_len */
@@ -5030,7 +5030,7 @@ of_oxm_ipv6_nd_target_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TARGET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5069,7 +5069,7 @@ of_oxm_ipv6_nd_target_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TARGET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5126,7 +5126,7 @@ static void
 of_oxm_ipv6_nd_target_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003f20); /* type_len */
@@ -5260,7 +5260,7 @@ of_oxm_ipv6_nd_target_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TARGET_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5299,7 +5299,7 @@ of_oxm_ipv6_nd_target_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TARGET_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5340,7 +5340,7 @@ of_oxm_ipv6_nd_target_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TARGET_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5379,7 +5379,7 @@ of_oxm_ipv6_nd_target_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TARGET_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5436,7 +5436,7 @@ static void
 of_oxm_ipv6_nd_tll_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004206); /* type_len */
@@ -5570,7 +5570,7 @@ of_oxm_ipv6_nd_tll_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TLL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5609,7 +5609,7 @@ of_oxm_ipv6_nd_tll_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TLL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5666,7 +5666,7 @@ static void
 of_oxm_ipv6_nd_tll_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x8000430c); /* type_len */
@@ -5800,7 +5800,7 @@ of_oxm_ipv6_nd_tll_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TLL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5839,7 +5839,7 @@ of_oxm_ipv6_nd_tll_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TLL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5880,7 +5880,7 @@ of_oxm_ipv6_nd_tll_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TLL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5919,7 +5919,7 @@ of_oxm_ipv6_nd_tll_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_ND_TLL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5976,7 +5976,7 @@ static void
 of_oxm_ipv6_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003410); /* type_len */
@@ -6110,7 +6110,7 @@ of_oxm_ipv6_src_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6149,7 +6149,7 @@ of_oxm_ipv6_src_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6206,7 +6206,7 @@ static void
 of_oxm_ipv6_src_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80003520); /* type_len */
@@ -6340,7 +6340,7 @@ of_oxm_ipv6_src_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6379,7 +6379,7 @@ of_oxm_ipv6_src_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6420,7 +6420,7 @@ of_oxm_ipv6_src_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6459,7 +6459,7 @@ of_oxm_ipv6_src_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_IPV6_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6516,7 +6516,7 @@ static void
 of_oxm_metadata_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000408); /* type_len */
@@ -6650,7 +6650,7 @@ of_oxm_metadata_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_METADATA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6689,7 +6689,7 @@ of_oxm_metadata_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_METADATA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6746,7 +6746,7 @@ static void
 of_oxm_metadata_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000510); /* type_len */
@@ -6880,7 +6880,7 @@ of_oxm_metadata_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_METADATA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6919,7 +6919,7 @@ of_oxm_metadata_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_METADATA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6960,7 +6960,7 @@ of_oxm_metadata_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_METADATA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6999,7 +6999,7 @@ of_oxm_metadata_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_METADATA_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7056,7 +7056,7 @@ static void
 of_oxm_mpls_bos_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004801); /* type_len */
@@ -7190,7 +7190,7 @@ of_oxm_mpls_bos_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_BOS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7229,7 +7229,7 @@ of_oxm_mpls_bos_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_BOS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7286,7 +7286,7 @@ static void
 of_oxm_mpls_bos_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004902); /* type_len */
@@ -7420,7 +7420,7 @@ of_oxm_mpls_bos_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_BOS_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7459,7 +7459,7 @@ of_oxm_mpls_bos_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_BOS_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7500,7 +7500,7 @@ of_oxm_mpls_bos_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_BOS_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7539,7 +7539,7 @@ of_oxm_mpls_bos_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_BOS_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7596,7 +7596,7 @@ static void
 of_oxm_mpls_label_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004404); /* type_len */
@@ -7730,7 +7730,7 @@ of_oxm_mpls_label_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_LABEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7769,7 +7769,7 @@ of_oxm_mpls_label_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_LABEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7826,7 +7826,7 @@ static void
 of_oxm_mpls_label_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004508); /* type_len */
@@ -7960,7 +7960,7 @@ of_oxm_mpls_label_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_LABEL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7999,7 +7999,7 @@ of_oxm_mpls_label_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_LABEL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8040,7 +8040,7 @@ of_oxm_mpls_label_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_LABEL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8079,7 +8079,7 @@ of_oxm_mpls_label_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_LABEL_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8136,7 +8136,7 @@ static void
 of_oxm_mpls_tc_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004601); /* type_len */
@@ -8270,7 +8270,7 @@ of_oxm_mpls_tc_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_TC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8309,7 +8309,7 @@ of_oxm_mpls_tc_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_TC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8366,7 +8366,7 @@ static void
 of_oxm_mpls_tc_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004702); /* type_len */
@@ -8500,7 +8500,7 @@ of_oxm_mpls_tc_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_TC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8539,7 +8539,7 @@ of_oxm_mpls_tc_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_TC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8580,7 +8580,7 @@ of_oxm_mpls_tc_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_TC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8619,7 +8619,7 @@ of_oxm_mpls_tc_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_MPLS_TC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
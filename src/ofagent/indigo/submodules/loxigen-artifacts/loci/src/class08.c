@@ -33,7 +33,7 @@ static void
 of_oxm_sctp_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002402); /* type_len */
@@ -167,7 +167,7 @@ of_oxm_sctp_dst_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -206,7 +206,7 @@ of_oxm_sctp_dst_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -263,7 +263,7 @@ static void
 of_oxm_sctp_dst_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002504); /* type_len */
@@ -397,7 +397,7 @@ of_oxm_sctp_dst_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -436,7 +436,7 @@ of_oxm_sctp_dst_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -477,7 +477,7 @@ of_oxm_sctp_dst_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -516,7 +516,7 @@ of_oxm_sctp_dst_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -573,7 +573,7 @@ static void
 of_oxm_sctp_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002202); /* type_len */
@@ -707,7 +707,7 @@ of_oxm_sctp_src_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -746,7 +746,7 @@ of_oxm_sctp_src_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -803,7 +803,7 @@ static void
 of_oxm_sctp_src_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002304); /* type_len */
@@ -937,7 +937,7 @@ of_oxm_sctp_src_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -976,7 +976,7 @@ of_oxm_sctp_src_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1017,7 +1017,7 @@ of_oxm_sctp_src_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1056,7 +1056,7 @@ of_oxm_sctp_src_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_SCTP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1113,7 +1113,7 @@ static void
 of_oxm_tcp_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001c02); /* type_len */
@@ -1247,7 +1247,7 @@ of_oxm_tcp_dst_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1286,7 +1286,7 @@ of_oxm_tcp_dst_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1343,7 +1343,7 @@ static void
 of_oxm_tcp_dst_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001d04); /* type_len */
@@ -1477,7 +1477,7 @@ of_oxm_tcp_dst_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1516,7 +1516,7 @@ of_oxm_tcp_dst_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1557,7 +1557,7 @@ of_oxm_tcp_dst_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1596,7 +1596,7 @@ of_oxm_tcp_dst_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1653,7 +1653,7 @@ static void
 of_oxm_tcp_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001a02); /* type_len */
@@ -1787,7 +1787,7 @@ of_oxm_tcp_src_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1826,7 +1826,7 @@ of_oxm_tcp_src_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1883,7 +1883,7 @@ static void
 of_oxm_tcp_src_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001b04); /* type_len */
@@ -2017,7 +2017,7 @@ of_oxm_tcp_src_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2056,7 +2056,7 @@ of_oxm_tcp_src_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2097,7 +2097,7 @@ of_oxm_tcp_src_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2136,7 +2136,7 @@ of_oxm_tcp_src_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TCP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2193,7 +2193,7 @@ static void
 of_oxm_tunnel_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004c08); /* type_len */
@@ -2327,7 +2327,7 @@ of_oxm_tunnel_id_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TUNNEL_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2366,7 +2366,7 @@ of_oxm_tunnel_id_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TUNNEL_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2423,7 +2423,7 @@ static void
 of_oxm_tunnel_id_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80004d10); /* type_len */
@@ -2557,7 +2557,7 @@ of_oxm_tunnel_id_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TUNNEL_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2596,7 +2596,7 @@ of_oxm_tunnel_id_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TUNNEL_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2637,7 +2637,7 @@ of_oxm_tunnel_id_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TUNNEL_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2676,7 +2676,7 @@ of_oxm_tunnel_id_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_TUNNEL_ID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2733,7 +2733,7 @@ static void
 of_oxm_udp_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002002); /* type_len */
@@ -2867,7 +2867,7 @@ of_oxm_udp_dst_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2906,7 +2906,7 @@ of_oxm_udp_dst_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2963,7 +2963,7 @@ static void
 of_oxm_udp_dst_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80002104); /* type_len */
@@ -3097,7 +3097,7 @@ of_oxm_udp_dst_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3136,7 +3136,7 @@ of_oxm_udp_dst_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3177,7 +3177,7 @@ of_oxm_udp_dst_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3216,7 +3216,7 @@ of_oxm_udp_dst_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_DST_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3273,7 +3273,7 @@ static void
 of_oxm_udp_src_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001e02); /* type_len */
@@ -3407,7 +3407,7 @@ of_oxm_udp_src_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3446,7 +3446,7 @@ of_oxm_udp_src_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_SRC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3503,7 +3503,7 @@ static void
 of_oxm_udp_src_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80001f04); /* type_len */
@@ -3637,7 +3637,7 @@ of_oxm_udp_src_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3676,7 +3676,7 @@ of_oxm_udp_src_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3717,7 +3717,7 @@ of_oxm_udp_src_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3756,7 +3756,7 @@ of_oxm_udp_src_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_UDP_SRC_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3813,7 +3813,7 @@ static void
 of_oxm_vlan_pcp_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000e01); /* type_len */
@@ -3947,7 +3947,7 @@ of_oxm_vlan_pcp_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_PCP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3986,7 +3986,7 @@ of_oxm_vlan_pcp_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_PCP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4043,7 +4043,7 @@ static void
 of_oxm_vlan_pcp_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000f02); /* type_len */
@@ -4177,7 +4177,7 @@ of_oxm_vlan_pcp_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_PCP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4216,7 +4216,7 @@ of_oxm_vlan_pcp_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_PCP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4257,7 +4257,7 @@ of_oxm_vlan_pcp_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_PCP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4296,7 +4296,7 @@ of_oxm_vlan_pcp_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_PCP_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4353,7 +4353,7 @@ static void
 of_oxm_vlan_vid_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000c02); /* type_len */
@@ -4487,7 +4487,7 @@ of_oxm_vlan_vid_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_VID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4526,7 +4526,7 @@ of_oxm_vlan_vid_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_VID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4583,7 +4583,7 @@ static void
 of_oxm_vlan_vid_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0x80000d04); /* type_len */
@@ -4717,7 +4717,7 @@ of_oxm_vlan_vid_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_VID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4756,7 +4756,7 @@ of_oxm_vlan_vid_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_VID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4797,7 +4797,7 @@ of_oxm_vlan_vid_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_VID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4836,7 +4836,7 @@ of_oxm_vlan_vid_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_VLAN_VID_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4894,7 +4894,7 @@ void
 of_queue_prop_experimenter_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 8)); /* experimenter */
         switch (value) {
@@ -5025,7 +5025,7 @@ of_queue_prop_experimenter_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5064,7 +5064,7 @@ of_queue_prop_experimenter_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5106,7 +5106,7 @@ of_queue_prop_experimenter_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5151,7 +5151,7 @@ of_queue_prop_experimenter_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5219,7 +5219,7 @@ static void
 of_queue_prop_max_rate_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x2); /* type */
@@ -5359,7 +5359,7 @@ of_queue_prop_max_rate_rate_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_MAX_RATE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5398,7 +5398,7 @@ of_queue_prop_max_rate_rate_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_QUEUE_PROP_MAX_RATE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5455,7 +5455,7 @@ static void
 of_role_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
@@ -5637,7 +5637,7 @@ of_role_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5676,7 +5676,7 @@ of_role_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5717,7 +5717,7 @@ of_role_reply_role_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5756,7 +5756,7 @@ of_role_reply_role_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5797,7 +5797,7 @@ of_role_reply_generation_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5836,7 +5836,7 @@ of_role_reply_generation_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5893,7 +5893,7 @@ static void
 of_role_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
@@ -6075,7 +6075,7 @@ of_role_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6114,7 +6114,7 @@ of_role_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6155,7 +6155,7 @@ of_role_request_role_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6194,7 +6194,7 @@ of_role_request_role_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6235,7 +6235,7 @@ of_role_request_generation_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6274,7 +6274,7 @@ of_role_request_generation_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6331,7 +6331,7 @@ static void
 of_role_request_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_2:
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
@@ -6514,7 +6514,7 @@ of_role_request_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6553,7 +6553,7 @@ of_role_request_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6594,7 +6594,7 @@ of_role_request_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6633,7 +6633,7 @@ of_role_request_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6675,7 +6675,7 @@ of_role_request_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6720,7 +6720,7 @@ of_role_request_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_ROLE_REQUEST_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6789,7 +6789,7 @@ void
 of_action_id_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 0)); /* type */
         switch (value) {
@@ -6980,7 +6980,7 @@ void
 of_action_id_experimenter_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 4)); /* experimenter */
         switch (value) {
@@ -7111,7 +7111,7 @@ of_action_id_experimenter_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7149,7 +7149,7 @@ of_action_id_experimenter_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7206,7 +7206,7 @@ void
 of_action_id_bsn_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 8)); /* subtype */
         switch (value) {
@@ -7334,7 +7334,7 @@ of_action_id_bsn_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7372,7 +7372,7 @@ of_action_id_bsn_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7412,7 +7412,7 @@ of_action_id_bsn_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7450,7 +7450,7 @@ of_action_id_bsn_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7506,7 +7506,7 @@ static void
 of_action_id_bsn_mirror_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x5c16c7); /* experimenter */
@@ -7647,7 +7647,7 @@ of_action_id_bsn_mirror_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7685,7 +7685,7 @@ of_action_id_bsn_mirror_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7725,7 +7725,7 @@ of_action_id_bsn_mirror_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7763,7 +7763,7 @@ of_action_id_bsn_mirror_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN_MIRROR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7819,7 +7819,7 @@ static void
 of_action_id_bsn_set_tunnel_dst_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x5c16c7); /* experimenter */
@@ -7960,7 +7960,7 @@ of_action_id_bsn_set_tunnel_dst_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7998,7 +7998,7 @@ of_action_id_bsn_set_tunnel_dst_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8038,7 +8038,7 @@ of_action_id_bsn_set_tunnel_dst_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8076,7 +8076,7 @@ of_action_id_bsn_set_tunnel_dst_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_BSN_SET_TUNNEL_DST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8132,7 +8132,7 @@ static void
 of_action_id_copy_ttl_in_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xc); /* type */
         break;
@@ -8287,7 +8287,7 @@ static void
 of_action_id_copy_ttl_out_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xb); /* type */
         break;
@@ -8442,7 +8442,7 @@ static void
 of_action_id_dec_mpls_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x10); /* type */
         break;
@@ -8597,7 +8597,7 @@ static void
 of_action_id_dec_nw_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x18); /* type */
         break;
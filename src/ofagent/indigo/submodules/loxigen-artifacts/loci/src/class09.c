@@ -33,7 +33,7 @@ static void
 of_action_id_group_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x16); /* type */
         break;
@@ -189,7 +189,7 @@ void
 of_action_id_nicira_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 8)); /* subtype */
         switch (value) {
@@ -314,7 +314,7 @@ of_action_id_nicira_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_NICIRA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -352,7 +352,7 @@ of_action_id_nicira_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_NICIRA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -392,7 +392,7 @@ of_action_id_nicira_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_NICIRA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -430,7 +430,7 @@ of_action_id_nicira_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_NICIRA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -486,7 +486,7 @@ static void
 of_action_id_nicira_dec_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x2320); /* experimenter */
@@ -627,7 +627,7 @@ of_action_id_nicira_dec_ttl_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_NICIRA_DEC_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -665,7 +665,7 @@ of_action_id_nicira_dec_ttl_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_NICIRA_DEC_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -705,7 +705,7 @@ of_action_id_nicira_dec_ttl_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_NICIRA_DEC_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -743,7 +743,7 @@ of_action_id_nicira_dec_ttl_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_NICIRA_DEC_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -800,7 +800,7 @@ void
 of_action_ofdpa_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 8)); /* subtype */
         switch (value) {
@@ -985,7 +985,7 @@ of_action_ofdpa_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1023,7 +1023,7 @@ of_action_ofdpa_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1063,7 +1063,7 @@ of_action_ofdpa_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1101,7 +1101,7 @@ of_action_ofdpa_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1158,7 +1158,7 @@ void
 of_action_id_ofdpa_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 8)); /* subtype */
         switch (value) {
@@ -1343,7 +1343,7 @@ of_action_id_ofdpa_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1381,7 +1381,7 @@ of_action_id_ofdpa_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1421,7 +1421,7 @@ of_action_id_ofdpa_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1459,7 +1459,7 @@ of_action_id_ofdpa_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1515,7 +1515,7 @@ static void
 of_action_ofdpa_check_drop_status_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -1656,7 +1656,7 @@ of_action_ofdpa_check_drop_status_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1694,7 +1694,7 @@ of_action_ofdpa_check_drop_status_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1734,7 +1734,7 @@ of_action_ofdpa_check_drop_status_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1772,7 +1772,7 @@ of_action_ofdpa_check_drop_status_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1812,7 +1812,7 @@ of_action_ofdpa_check_drop_status_drop_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1850,7 +1850,7 @@ of_action_ofdpa_check_drop_status_drop_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1890,7 +1890,7 @@ of_action_ofdpa_check_drop_status_drop_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1928,7 +1928,7 @@ of_action_ofdpa_check_drop_status_drop_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1984,7 +1984,7 @@ static void
 of_action_id_ofdpa_check_drop_status_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -2125,7 +2125,7 @@ of_action_id_ofdpa_check_drop_status_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2163,7 +2163,7 @@ of_action_id_ofdpa_check_drop_status_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2203,7 +2203,7 @@ of_action_id_ofdpa_check_drop_status_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2241,7 +2241,7 @@ of_action_id_ofdpa_check_drop_status_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CHECK_DROP_STATUS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2297,7 +2297,7 @@ static void
 of_action_ofdpa_class_based_rx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -2438,7 +2438,7 @@ of_action_ofdpa_class_based_rx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2476,7 +2476,7 @@ of_action_ofdpa_class_based_rx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2516,7 +2516,7 @@ of_action_ofdpa_class_based_rx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2554,7 +2554,7 @@ of_action_ofdpa_class_based_rx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2594,7 +2594,7 @@ of_action_ofdpa_class_based_rx_count_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2632,7 +2632,7 @@ of_action_ofdpa_class_based_rx_count_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2672,7 +2672,7 @@ of_action_ofdpa_class_based_rx_count_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2710,7 +2710,7 @@ of_action_ofdpa_class_based_rx_count_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2766,7 +2766,7 @@ static void
 of_action_id_ofdpa_class_based_rx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -2907,7 +2907,7 @@ of_action_id_ofdpa_class_based_rx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2945,7 +2945,7 @@ of_action_id_ofdpa_class_based_rx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2985,7 +2985,7 @@ of_action_id_ofdpa_class_based_rx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3023,7 +3023,7 @@ of_action_id_ofdpa_class_based_rx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CLASS_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3079,7 +3079,7 @@ static void
 of_action_ofdpa_class_based_tx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -3220,7 +3220,7 @@ of_action_ofdpa_class_based_tx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3258,7 +3258,7 @@ of_action_ofdpa_class_based_tx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3298,7 +3298,7 @@ of_action_ofdpa_class_based_tx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3336,7 +3336,7 @@ of_action_ofdpa_class_based_tx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3376,7 +3376,7 @@ of_action_ofdpa_class_based_tx_count_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3414,7 +3414,7 @@ of_action_ofdpa_class_based_tx_count_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3454,7 +3454,7 @@ of_action_ofdpa_class_based_tx_count_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3492,7 +3492,7 @@ of_action_ofdpa_class_based_tx_count_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3548,7 +3548,7 @@ static void
 of_action_id_ofdpa_class_based_tx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -3689,7 +3689,7 @@ of_action_id_ofdpa_class_based_tx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3727,7 +3727,7 @@ of_action_id_ofdpa_class_based_tx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3767,7 +3767,7 @@ of_action_id_ofdpa_class_based_tx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3805,7 +3805,7 @@ of_action_id_ofdpa_class_based_tx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_CLASS_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3861,7 +3861,7 @@ static void
 of_action_ofdpa_color_based_rx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -4002,7 +4002,7 @@ of_action_ofdpa_color_based_rx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4040,7 +4040,7 @@ of_action_ofdpa_color_based_rx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4080,7 +4080,7 @@ of_action_ofdpa_color_based_rx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4118,7 +4118,7 @@ of_action_ofdpa_color_based_rx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4158,7 +4158,7 @@ of_action_ofdpa_color_based_rx_count_act_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4196,7 +4196,7 @@ of_action_ofdpa_color_based_rx_count_act_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4236,7 +4236,7 @@ of_action_ofdpa_color_based_rx_count_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4274,7 +4274,7 @@ of_action_ofdpa_color_based_rx_count_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4330,7 +4330,7 @@ static void
 of_action_id_ofdpa_color_based_rx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -4471,7 +4471,7 @@ of_action_id_ofdpa_color_based_rx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4509,7 +4509,7 @@ of_action_id_ofdpa_color_based_rx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4549,7 +4549,7 @@ of_action_id_ofdpa_color_based_rx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4587,7 +4587,7 @@ of_action_id_ofdpa_color_based_rx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COLOR_BASED_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4643,7 +4643,7 @@ static void
 of_action_ofdpa_color_based_tx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -4784,7 +4784,7 @@ of_action_ofdpa_color_based_tx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4822,7 +4822,7 @@ of_action_ofdpa_color_based_tx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4862,7 +4862,7 @@ of_action_ofdpa_color_based_tx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4900,7 +4900,7 @@ of_action_ofdpa_color_based_tx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4940,7 +4940,7 @@ of_action_ofdpa_color_based_tx_count_act_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4978,7 +4978,7 @@ of_action_ofdpa_color_based_tx_count_act_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5018,7 +5018,7 @@ of_action_ofdpa_color_based_tx_count_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5056,7 +5056,7 @@ of_action_ofdpa_color_based_tx_count_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5112,7 +5112,7 @@ static void
 of_action_id_ofdpa_color_based_tx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5253,7 +5253,7 @@ of_action_id_ofdpa_color_based_tx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5291,7 +5291,7 @@ of_action_id_ofdpa_color_based_tx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5331,7 +5331,7 @@ of_action_id_ofdpa_color_based_tx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5369,7 +5369,7 @@ of_action_id_ofdpa_color_based_tx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COLOR_BASED_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5425,7 +5425,7 @@ static void
 of_action_ofdpa_copy_tc_in_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5566,7 +5566,7 @@ of_action_ofdpa_copy_tc_in_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COPY_TC_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5604,7 +5604,7 @@ of_action_ofdpa_copy_tc_in_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COPY_TC_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5644,7 +5644,7 @@ of_action_ofdpa_copy_tc_in_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COPY_TC_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5682,7 +5682,7 @@ of_action_ofdpa_copy_tc_in_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COPY_TC_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5738,7 +5738,7 @@ static void
 of_action_id_ofdpa_copy_tc_in_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5879,7 +5879,7 @@ of_action_id_ofdpa_copy_tc_in_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COPY_TC_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5917,7 +5917,7 @@ of_action_id_ofdpa_copy_tc_in_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COPY_TC_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5957,7 +5957,7 @@ of_action_id_ofdpa_copy_tc_in_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COPY_TC_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5995,7 +5995,7 @@ of_action_id_ofdpa_copy_tc_in_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COPY_TC_IN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6051,7 +6051,7 @@ static void
 of_action_ofdpa_copy_tc_out_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -6192,7 +6192,7 @@ of_action_ofdpa_copy_tc_out_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COPY_TC_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6230,7 +6230,7 @@ of_action_ofdpa_copy_tc_out_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COPY_TC_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6270,7 +6270,7 @@ of_action_ofdpa_copy_tc_out_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COPY_TC_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6308,7 +6308,7 @@ of_action_ofdpa_copy_tc_out_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_COPY_TC_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6364,7 +6364,7 @@ static void
 of_action_id_ofdpa_copy_tc_out_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -6505,7 +6505,7 @@ of_action_id_ofdpa_copy_tc_out_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COPY_TC_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6543,7 +6543,7 @@ of_action_id_ofdpa_copy_tc_out_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COPY_TC_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6583,7 +6583,7 @@ of_action_id_ofdpa_copy_tc_out_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COPY_TC_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6621,7 +6621,7 @@ of_action_id_ofdpa_copy_tc_out_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_COPY_TC_OUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6677,7 +6677,7 @@ static void
 of_action_ofdpa_dec_ttl_mtu_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -6818,7 +6818,7 @@ of_action_ofdpa_dec_ttl_mtu_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_DEC_TTL_MTU);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6856,7 +6856,7 @@ of_action_ofdpa_dec_ttl_mtu_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_DEC_TTL_MTU);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6896,7 +6896,7 @@ of_action_ofdpa_dec_ttl_mtu_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_DEC_TTL_MTU);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6934,7 +6934,7 @@ of_action_ofdpa_dec_ttl_mtu_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_DEC_TTL_MTU);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6990,7 +6990,7 @@ static void
 of_action_id_ofdpa_dec_ttl_mtu_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -7131,7 +7131,7 @@ of_action_id_ofdpa_dec_ttl_mtu_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_DEC_TTL_MTU);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7169,7 +7169,7 @@ of_action_id_ofdpa_dec_ttl_mtu_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_DEC_TTL_MTU);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7209,7 +7209,7 @@ of_action_id_ofdpa_dec_ttl_mtu_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_DEC_TTL_MTU);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7247,7 +7247,7 @@ of_action_id_ofdpa_dec_ttl_mtu_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_DEC_TTL_MTU);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7303,7 +7303,7 @@ static void
 of_action_ofdpa_oam_lm_rx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -7444,7 +7444,7 @@ of_action_ofdpa_oam_lm_rx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7482,7 +7482,7 @@ of_action_ofdpa_oam_lm_rx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7522,7 +7522,7 @@ of_action_ofdpa_oam_lm_rx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7560,7 +7560,7 @@ of_action_ofdpa_oam_lm_rx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7600,7 +7600,7 @@ of_action_ofdpa_oam_lm_rx_count_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7638,7 +7638,7 @@ of_action_ofdpa_oam_lm_rx_count_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7678,7 +7678,7 @@ of_action_ofdpa_oam_lm_rx_count_lmep_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7716,7 +7716,7 @@ of_action_ofdpa_oam_lm_rx_count_lmep_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7772,7 +7772,7 @@ static void
 of_action_id_ofdpa_oam_lm_rx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -7913,7 +7913,7 @@ of_action_id_ofdpa_oam_lm_rx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7951,7 +7951,7 @@ of_action_id_ofdpa_oam_lm_rx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7991,7 +7991,7 @@ of_action_id_ofdpa_oam_lm_rx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8029,7 +8029,7 @@ of_action_id_ofdpa_oam_lm_rx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_OAM_LM_RX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8085,7 +8085,7 @@ static void
 of_action_ofdpa_oam_lm_tx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -8226,7 +8226,7 @@ of_action_ofdpa_oam_lm_tx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8264,7 +8264,7 @@ of_action_ofdpa_oam_lm_tx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8304,7 +8304,7 @@ of_action_ofdpa_oam_lm_tx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8342,7 +8342,7 @@ of_action_ofdpa_oam_lm_tx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8382,7 +8382,7 @@ of_action_ofdpa_oam_lm_tx_count_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8420,7 +8420,7 @@ of_action_ofdpa_oam_lm_tx_count_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8460,7 +8460,7 @@ of_action_ofdpa_oam_lm_tx_count_lmep_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8498,7 +8498,7 @@ of_action_ofdpa_oam_lm_tx_count_lmep_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8554,7 +8554,7 @@ static void
 of_action_id_ofdpa_oam_lm_tx_count_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -8695,7 +8695,7 @@ of_action_id_ofdpa_oam_lm_tx_count_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8733,7 +8733,7 @@ of_action_id_ofdpa_oam_lm_tx_count_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8773,7 +8773,7 @@ of_action_id_ofdpa_oam_lm_tx_count_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8811,7 +8811,7 @@ of_action_id_ofdpa_oam_lm_tx_count_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_OAM_LM_TX_COUNT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8867,7 +8867,7 @@ static void
 of_action_ofdpa_pop_cw_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -9008,7 +9008,7 @@ of_action_ofdpa_pop_cw_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_POP_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9046,7 +9046,7 @@ of_action_ofdpa_pop_cw_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_POP_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9086,7 +9086,7 @@ of_action_ofdpa_pop_cw_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_POP_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9124,7 +9124,7 @@ of_action_ofdpa_pop_cw_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_POP_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9180,7 +9180,7 @@ static void
 of_action_id_ofdpa_pop_cw_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -9321,7 +9321,7 @@ of_action_id_ofdpa_pop_cw_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_POP_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9359,7 +9359,7 @@ of_action_id_ofdpa_pop_cw_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_POP_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9399,7 +9399,7 @@ of_action_id_ofdpa_pop_cw_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_POP_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9437,7 +9437,7 @@ of_action_id_ofdpa_pop_cw_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_POP_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9493,7 +9493,7 @@ static void
 of_action_ofdpa_pop_l2hdr_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -9634,7 +9634,7 @@ of_action_ofdpa_pop_l2hdr_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_POP_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9672,7 +9672,7 @@ of_action_ofdpa_pop_l2hdr_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_POP_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9712,7 +9712,7 @@ of_action_ofdpa_pop_l2hdr_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_POP_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9750,7 +9750,7 @@ of_action_ofdpa_pop_l2hdr_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_POP_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9806,7 +9806,7 @@ static void
 of_action_id_ofdpa_pop_l2hdr_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -9947,7 +9947,7 @@ of_action_id_ofdpa_pop_l2hdr_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_POP_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9985,7 +9985,7 @@ of_action_id_ofdpa_pop_l2hdr_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_POP_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10025,7 +10025,7 @@ of_action_id_ofdpa_pop_l2hdr_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_POP_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10063,7 +10063,7 @@ of_action_id_ofdpa_pop_l2hdr_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_POP_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10119,7 +10119,7 @@ static void
 of_action_ofdpa_push_cw_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -10260,7 +10260,7 @@ of_action_ofdpa_push_cw_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_PUSH_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10298,7 +10298,7 @@ of_action_ofdpa_push_cw_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_PUSH_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10338,7 +10338,7 @@ of_action_ofdpa_push_cw_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_PUSH_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10376,7 +10376,7 @@ of_action_ofdpa_push_cw_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_PUSH_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10432,7 +10432,7 @@ static void
 of_action_id_ofdpa_push_cw_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -10573,7 +10573,7 @@ of_action_id_ofdpa_push_cw_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_PUSH_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10611,7 +10611,7 @@ of_action_id_ofdpa_push_cw_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_PUSH_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10651,7 +10651,7 @@ of_action_id_ofdpa_push_cw_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_PUSH_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10689,7 +10689,7 @@ of_action_id_ofdpa_push_cw_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_PUSH_CW);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10745,7 +10745,7 @@ static void
 of_action_ofdpa_push_l2hdr_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -10886,7 +10886,7 @@ of_action_ofdpa_push_l2hdr_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_PUSH_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10924,7 +10924,7 @@ of_action_ofdpa_push_l2hdr_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_PUSH_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10964,7 +10964,7 @@ of_action_ofdpa_push_l2hdr_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_PUSH_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11002,7 +11002,7 @@ of_action_ofdpa_push_l2hdr_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_PUSH_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
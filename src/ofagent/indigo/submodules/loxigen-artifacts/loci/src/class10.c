@@ -33,7 +33,7 @@ static void
 of_action_id_ofdpa_push_l2hdr_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -174,7 +174,7 @@ of_action_id_ofdpa_push_l2hdr_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_PUSH_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -212,7 +212,7 @@ of_action_id_ofdpa_push_l2hdr_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_PUSH_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -252,7 +252,7 @@ of_action_id_ofdpa_push_l2hdr_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_PUSH_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -290,7 +290,7 @@ of_action_id_ofdpa_push_l2hdr_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_PUSH_L2HDR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -346,7 +346,7 @@ static void
 of_action_ofdpa_set_counter_fields_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -487,7 +487,7 @@ of_action_ofdpa_set_counter_fields_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -525,7 +525,7 @@ of_action_ofdpa_set_counter_fields_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -565,7 +565,7 @@ of_action_ofdpa_set_counter_fields_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -603,7 +603,7 @@ of_action_ofdpa_set_counter_fields_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -643,7 +643,7 @@ of_action_ofdpa_set_counter_fields_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -681,7 +681,7 @@ of_action_ofdpa_set_counter_fields_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -721,7 +721,7 @@ of_action_ofdpa_set_counter_fields_lmep_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -759,7 +759,7 @@ of_action_ofdpa_set_counter_fields_lmep_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -815,7 +815,7 @@ static void
 of_action_id_ofdpa_set_counter_fields_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -956,7 +956,7 @@ of_action_id_ofdpa_set_counter_fields_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -994,7 +994,7 @@ of_action_id_ofdpa_set_counter_fields_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1034,7 +1034,7 @@ of_action_id_ofdpa_set_counter_fields_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1072,7 +1072,7 @@ of_action_id_ofdpa_set_counter_fields_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_COUNTER_FIELDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1128,7 +1128,7 @@ static void
 of_action_ofdpa_set_mpls_pcpdei_from_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -1269,7 +1269,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1307,7 +1307,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1347,7 +1347,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1385,7 +1385,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1425,7 +1425,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1463,7 +1463,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1503,7 +1503,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1541,7 +1541,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1581,7 +1581,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1619,7 +1619,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1659,7 +1659,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_pcp_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1697,7 +1697,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_table_pcp_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1753,7 +1753,7 @@ static void
 of_action_id_ofdpa_set_mpls_pcpdei_from_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -1894,7 +1894,7 @@ of_action_id_ofdpa_set_mpls_pcpdei_from_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1932,7 +1932,7 @@ of_action_id_ofdpa_set_mpls_pcpdei_from_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1972,7 +1972,7 @@ of_action_id_ofdpa_set_mpls_pcpdei_from_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2010,7 +2010,7 @@ of_action_id_ofdpa_set_mpls_pcpdei_from_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2066,7 +2066,7 @@ static void
 of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -2207,7 +2207,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2245,7 +2245,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2285,7 +2285,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2323,7 +2323,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2363,7 +2363,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2401,7 +2401,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2441,7 +2441,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2479,7 +2479,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2519,7 +2519,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2557,7 +2557,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2597,7 +2597,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_pcp_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2635,7 +2635,7 @@ of_action_ofdpa_set_mpls_pcpdei_from_tunnel_table_pcp_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2691,7 +2691,7 @@ static void
 of_action_id_ofdpa_set_mpls_pcpdei_from_tunnel_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -2832,7 +2832,7 @@ of_action_id_ofdpa_set_mpls_pcpdei_from_tunnel_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2870,7 +2870,7 @@ of_action_id_ofdpa_set_mpls_pcpdei_from_tunnel_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2910,7 +2910,7 @@ of_action_id_ofdpa_set_mpls_pcpdei_from_tunnel_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2948,7 +2948,7 @@ of_action_id_ofdpa_set_mpls_pcpdei_from_tunnel_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_PCPDEI_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3004,7 +3004,7 @@ static void
 of_action_ofdpa_set_mpls_qos_from_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -3145,7 +3145,7 @@ of_action_ofdpa_set_mpls_qos_from_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3183,7 +3183,7 @@ of_action_ofdpa_set_mpls_qos_from_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3223,7 +3223,7 @@ of_action_ofdpa_set_mpls_qos_from_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3261,7 +3261,7 @@ of_action_ofdpa_set_mpls_qos_from_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3301,7 +3301,7 @@ of_action_ofdpa_set_mpls_qos_from_table_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3339,7 +3339,7 @@ of_action_ofdpa_set_mpls_qos_from_table_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3379,7 +3379,7 @@ of_action_ofdpa_set_mpls_qos_from_table_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3417,7 +3417,7 @@ of_action_ofdpa_set_mpls_qos_from_table_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3473,7 +3473,7 @@ static void
 of_action_id_ofdpa_set_mpls_qos_from_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -3614,7 +3614,7 @@ of_action_id_ofdpa_set_mpls_qos_from_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3652,7 +3652,7 @@ of_action_id_ofdpa_set_mpls_qos_from_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3692,7 +3692,7 @@ of_action_id_ofdpa_set_mpls_qos_from_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3730,7 +3730,7 @@ of_action_id_ofdpa_set_mpls_qos_from_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_QOS_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3786,7 +3786,7 @@ static void
 of_action_ofdpa_set_mpls_tc_from_tunnel_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -3927,7 +3927,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3965,7 +3965,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4005,7 +4005,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4043,7 +4043,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4083,7 +4083,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4121,7 +4121,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4161,7 +4161,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4199,7 +4199,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4239,7 +4239,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4277,7 +4277,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4317,7 +4317,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4355,7 +4355,7 @@ of_action_ofdpa_set_mpls_tc_from_tunnel_table_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4411,7 +4411,7 @@ static void
 of_action_id_ofdpa_set_mpls_tc_from_tunnel_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -4552,7 +4552,7 @@ of_action_id_ofdpa_set_mpls_tc_from_tunnel_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4590,7 +4590,7 @@ of_action_id_ofdpa_set_mpls_tc_from_tunnel_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4630,7 +4630,7 @@ of_action_id_ofdpa_set_mpls_tc_from_tunnel_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4668,7 +4668,7 @@ of_action_id_ofdpa_set_mpls_tc_from_tunnel_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_TC_FROM_TUNNEL_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4724,7 +4724,7 @@ static void
 of_action_ofdpa_set_mpls_tc_from_vpn_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -4865,7 +4865,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4903,7 +4903,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4943,7 +4943,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4981,7 +4981,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5021,7 +5021,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5059,7 +5059,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5099,7 +5099,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5137,7 +5137,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5177,7 +5177,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5215,7 +5215,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5255,7 +5255,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5293,7 +5293,7 @@ of_action_ofdpa_set_mpls_tc_from_vpn_table_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5349,7 +5349,7 @@ static void
 of_action_id_ofdpa_set_mpls_tc_from_vpn_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5490,7 +5490,7 @@ of_action_id_ofdpa_set_mpls_tc_from_vpn_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5528,7 +5528,7 @@ of_action_id_ofdpa_set_mpls_tc_from_vpn_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5568,7 +5568,7 @@ of_action_id_ofdpa_set_mpls_tc_from_vpn_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5606,7 +5606,7 @@ of_action_id_ofdpa_set_mpls_tc_from_vpn_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_MPLS_TC_FROM_VPN_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5662,7 +5662,7 @@ static void
 of_action_ofdpa_set_pcpdei_from_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5803,7 +5803,7 @@ of_action_ofdpa_set_pcpdei_from_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5841,7 +5841,7 @@ of_action_ofdpa_set_pcpdei_from_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5881,7 +5881,7 @@ of_action_ofdpa_set_pcpdei_from_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5919,7 +5919,7 @@ of_action_ofdpa_set_pcpdei_from_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5959,7 +5959,7 @@ of_action_ofdpa_set_pcpdei_from_table_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5997,7 +5997,7 @@ of_action_ofdpa_set_pcpdei_from_table_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6037,7 +6037,7 @@ of_action_ofdpa_set_pcpdei_from_table_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6075,7 +6075,7 @@ of_action_ofdpa_set_pcpdei_from_table_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6115,7 +6115,7 @@ of_action_ofdpa_set_pcpdei_from_table_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6153,7 +6153,7 @@ of_action_ofdpa_set_pcpdei_from_table_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6209,7 +6209,7 @@ static void
 of_action_id_ofdpa_set_pcpdei_from_table_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -6350,7 +6350,7 @@ of_action_id_ofdpa_set_pcpdei_from_table_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6388,7 +6388,7 @@ of_action_id_ofdpa_set_pcpdei_from_table_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6428,7 +6428,7 @@ of_action_id_ofdpa_set_pcpdei_from_table_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6466,7 +6466,7 @@ of_action_id_ofdpa_set_pcpdei_from_table_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_ID_OFDPA_SET_PCPDEI_FROM_TABLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6522,7 +6522,7 @@ static void
 of_action_id_output_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x0); /* type */
         break;
@@ -6677,7 +6677,7 @@ static void
 of_action_id_pop_mpls_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x14); /* type */
         break;
@@ -6832,7 +6832,7 @@ static void
 of_action_pop_pbb_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1b); /* type */
         break;
@@ -6987,7 +6987,7 @@ static void
 of_action_id_pop_pbb_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1b); /* type */
         break;
@@ -7142,7 +7142,7 @@ static void
 of_action_id_pop_vlan_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x12); /* type */
         break;
@@ -7297,7 +7297,7 @@ static void
 of_action_id_push_mpls_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x13); /* type */
         break;
@@ -7452,7 +7452,7 @@ static void
 of_action_push_pbb_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1a); /* type */
         break;
@@ -7591,7 +7591,7 @@ of_action_push_pbb_ethertype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_PUSH_PBB);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7629,7 +7629,7 @@ of_action_push_pbb_ethertype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ACTION_PUSH_PBB);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7685,7 +7685,7 @@ static void
 of_action_id_push_pbb_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1a); /* type */
         break;
@@ -7840,7 +7840,7 @@ static void
 of_action_id_push_vlan_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x11); /* type */
         break;
@@ -7995,7 +7995,7 @@ static void
 of_action_id_set_field_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x19); /* type */
         break;
@@ -8150,7 +8150,7 @@ static void
 of_action_id_set_mpls_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xf); /* type */
         break;
@@ -8305,7 +8305,7 @@ static void
 of_action_id_set_nw_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x17); /* type */
         break;
@@ -8460,7 +8460,7 @@ static void
 of_action_id_set_queue_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x15); /* type */
         break;
@@ -8615,7 +8615,7 @@ static void
 of_async_get_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1b; /* type */
@@ -8796,7 +8796,7 @@ of_async_get_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8834,7 +8834,7 @@ of_async_get_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8874,7 +8874,7 @@ of_async_get_reply_packet_in_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8912,7 +8912,7 @@ of_async_get_reply_packet_in_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8952,7 +8952,7 @@ of_async_get_reply_packet_in_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8990,7 +8990,7 @@ of_async_get_reply_packet_in_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9030,7 +9030,7 @@ of_async_get_reply_port_status_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9068,7 +9068,7 @@ of_async_get_reply_port_status_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9108,7 +9108,7 @@ of_async_get_reply_port_status_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9146,7 +9146,7 @@ of_async_get_reply_port_status_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9186,7 +9186,7 @@ of_async_get_reply_flow_removed_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9224,7 +9224,7 @@ of_async_get_reply_flow_removed_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9264,7 +9264,7 @@ of_async_get_reply_flow_removed_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9302,7 +9302,7 @@ of_async_get_reply_flow_removed_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9358,7 +9358,7 @@ static void
 of_async_get_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1a; /* type */
@@ -9539,7 +9539,7 @@ of_async_get_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9577,7 +9577,7 @@ of_async_get_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9617,7 +9617,7 @@ of_async_get_request_packet_in_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9655,7 +9655,7 @@ of_async_get_request_packet_in_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9695,7 +9695,7 @@ of_async_get_request_packet_in_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9733,7 +9733,7 @@ of_async_get_request_packet_in_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9773,7 +9773,7 @@ of_async_get_request_port_status_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9811,7 +9811,7 @@ of_async_get_request_port_status_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9851,7 +9851,7 @@ of_async_get_request_port_status_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9889,7 +9889,7 @@ of_async_get_request_port_status_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9929,7 +9929,7 @@ of_async_get_request_flow_removed_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9967,7 +9967,7 @@ of_async_get_request_flow_removed_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10007,7 +10007,7 @@ of_async_get_request_flow_removed_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10045,7 +10045,7 @@ of_async_get_request_flow_removed_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10101,7 +10101,7 @@ static void
 of_async_set_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1c; /* type */
@@ -10282,7 +10282,7 @@ of_async_set_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10320,7 +10320,7 @@ of_async_set_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10360,7 +10360,7 @@ of_async_set_packet_in_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10398,7 +10398,7 @@ of_async_set_packet_in_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10438,7 +10438,7 @@ of_async_set_packet_in_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10476,7 +10476,7 @@ of_async_set_packet_in_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10516,7 +10516,7 @@ of_async_set_port_status_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10554,7 +10554,7 @@ of_async_set_port_status_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10594,7 +10594,7 @@ of_async_set_port_status_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10632,7 +10632,7 @@ of_async_set_port_status_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10672,7 +10672,7 @@ of_async_set_flow_removed_mask_equal_master_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10710,7 +10710,7 @@ of_async_set_flow_removed_mask_equal_master_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10750,7 +10750,7 @@ of_async_set_flow_removed_mask_slave_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10788,7 +10788,7 @@ of_async_set_flow_removed_mask_slave_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_ASYNC_SET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10844,7 +10844,7 @@ static void
 of_bsn_arp_idle_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -11027,7 +11027,7 @@ of_bsn_arp_idle_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11065,7 +11065,7 @@ of_bsn_arp_idle_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11105,7 +11105,7 @@ of_bsn_arp_idle_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11143,7 +11143,7 @@ of_bsn_arp_idle_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11183,7 +11183,7 @@ of_bsn_arp_idle_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11221,7 +11221,7 @@ of_bsn_arp_idle_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11261,7 +11261,7 @@ of_bsn_arp_idle_vlan_vid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11299,7 +11299,7 @@ of_bsn_arp_idle_vlan_vid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11339,7 +11339,7 @@ of_bsn_arp_idle_ipv4_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11377,7 +11377,7 @@ of_bsn_arp_idle_ipv4_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_ARP_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
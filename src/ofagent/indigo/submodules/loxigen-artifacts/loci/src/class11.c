@@ -146,7 +146,7 @@ of_bsn_controller_connection_state_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -184,7 +184,7 @@ of_bsn_controller_connection_state_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -224,7 +224,7 @@ of_bsn_controller_connection_auxiliary_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -262,7 +262,7 @@ of_bsn_controller_connection_auxiliary_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -302,7 +302,7 @@ of_bsn_controller_connection_role_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -340,7 +340,7 @@ of_bsn_controller_connection_role_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -380,7 +380,7 @@ of_bsn_controller_connection_uri_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -418,7 +418,7 @@ of_bsn_controller_connection_uri_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -474,7 +474,7 @@ static void
 of_bsn_controller_connections_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -657,7 +657,7 @@ of_bsn_controller_connections_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -695,7 +695,7 @@ of_bsn_controller_connections_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -735,7 +735,7 @@ of_bsn_controller_connections_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -773,7 +773,7 @@ of_bsn_controller_connections_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -813,7 +813,7 @@ of_bsn_controller_connections_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -851,7 +851,7 @@ of_bsn_controller_connections_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -897,7 +897,7 @@ of_bsn_controller_connections_reply_connections_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -971,7 +971,7 @@ of_bsn_controller_connections_reply_connections_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1055,7 +1055,7 @@ static void
 of_bsn_controller_connections_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -1238,7 +1238,7 @@ of_bsn_controller_connections_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1276,7 +1276,7 @@ of_bsn_controller_connections_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1316,7 +1316,7 @@ of_bsn_controller_connections_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1354,7 +1354,7 @@ of_bsn_controller_connections_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1394,7 +1394,7 @@ of_bsn_controller_connections_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1432,7 +1432,7 @@ of_bsn_controller_connections_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_CONTROLLER_CONNECTIONS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1601,7 +1601,7 @@ of_bsn_debug_counter_desc_stats_entry_counter_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1639,7 +1639,7 @@ of_bsn_debug_counter_desc_stats_entry_counter_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1679,7 +1679,7 @@ of_bsn_debug_counter_desc_stats_entry_name_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1717,7 +1717,7 @@ of_bsn_debug_counter_desc_stats_entry_name_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1757,7 +1757,7 @@ of_bsn_debug_counter_desc_stats_entry_description_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1795,7 +1795,7 @@ of_bsn_debug_counter_desc_stats_entry_description_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1851,7 +1851,7 @@ static void
 of_bsn_debug_counter_desc_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -2035,7 +2035,7 @@ of_bsn_debug_counter_desc_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2073,7 +2073,7 @@ of_bsn_debug_counter_desc_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2113,7 +2113,7 @@ of_bsn_debug_counter_desc_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2151,7 +2151,7 @@ of_bsn_debug_counter_desc_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2191,7 +2191,7 @@ of_bsn_debug_counter_desc_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2229,7 +2229,7 @@ of_bsn_debug_counter_desc_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2269,7 +2269,7 @@ of_bsn_debug_counter_desc_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2307,7 +2307,7 @@ of_bsn_debug_counter_desc_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2353,7 +2353,7 @@ of_bsn_debug_counter_desc_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2427,7 +2427,7 @@ of_bsn_debug_counter_desc_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2511,7 +2511,7 @@ static void
 of_bsn_debug_counter_desc_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -2695,7 +2695,7 @@ of_bsn_debug_counter_desc_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2733,7 +2733,7 @@ of_bsn_debug_counter_desc_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2773,7 +2773,7 @@ of_bsn_debug_counter_desc_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2811,7 +2811,7 @@ of_bsn_debug_counter_desc_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2851,7 +2851,7 @@ of_bsn_debug_counter_desc_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2889,7 +2889,7 @@ of_bsn_debug_counter_desc_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2929,7 +2929,7 @@ of_bsn_debug_counter_desc_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2967,7 +2967,7 @@ of_bsn_debug_counter_desc_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3136,7 +3136,7 @@ of_bsn_debug_counter_stats_entry_counter_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3174,7 +3174,7 @@ of_bsn_debug_counter_stats_entry_counter_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3214,7 +3214,7 @@ of_bsn_debug_counter_stats_entry_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3252,7 +3252,7 @@ of_bsn_debug_counter_stats_entry_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3308,7 +3308,7 @@ static void
 of_bsn_debug_counter_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -3492,7 +3492,7 @@ of_bsn_debug_counter_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3530,7 +3530,7 @@ of_bsn_debug_counter_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3570,7 +3570,7 @@ of_bsn_debug_counter_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3608,7 +3608,7 @@ of_bsn_debug_counter_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3648,7 +3648,7 @@ of_bsn_debug_counter_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3686,7 +3686,7 @@ of_bsn_debug_counter_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3726,7 +3726,7 @@ of_bsn_debug_counter_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3764,7 +3764,7 @@ of_bsn_debug_counter_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3810,7 +3810,7 @@ of_bsn_debug_counter_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3884,7 +3884,7 @@ of_bsn_debug_counter_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3968,7 +3968,7 @@ static void
 of_bsn_debug_counter_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -4152,7 +4152,7 @@ of_bsn_debug_counter_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4190,7 +4190,7 @@ of_bsn_debug_counter_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4230,7 +4230,7 @@ of_bsn_debug_counter_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4268,7 +4268,7 @@ of_bsn_debug_counter_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4308,7 +4308,7 @@ of_bsn_debug_counter_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4346,7 +4346,7 @@ of_bsn_debug_counter_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4386,7 +4386,7 @@ of_bsn_debug_counter_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4424,7 +4424,7 @@ of_bsn_debug_counter_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_DEBUG_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4593,7 +4593,7 @@ of_bsn_flow_checksum_bucket_stats_entry_checksum_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4631,7 +4631,7 @@ of_bsn_flow_checksum_bucket_stats_entry_checksum_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4687,7 +4687,7 @@ static void
 of_bsn_flow_checksum_bucket_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -4871,7 +4871,7 @@ of_bsn_flow_checksum_bucket_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4909,7 +4909,7 @@ of_bsn_flow_checksum_bucket_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4949,7 +4949,7 @@ of_bsn_flow_checksum_bucket_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4987,7 +4987,7 @@ of_bsn_flow_checksum_bucket_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5027,7 +5027,7 @@ of_bsn_flow_checksum_bucket_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5065,7 +5065,7 @@ of_bsn_flow_checksum_bucket_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5105,7 +5105,7 @@ of_bsn_flow_checksum_bucket_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5143,7 +5143,7 @@ of_bsn_flow_checksum_bucket_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5189,7 +5189,7 @@ of_bsn_flow_checksum_bucket_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5263,7 +5263,7 @@ of_bsn_flow_checksum_bucket_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5347,7 +5347,7 @@ static void
 of_bsn_flow_checksum_bucket_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -5531,7 +5531,7 @@ of_bsn_flow_checksum_bucket_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5569,7 +5569,7 @@ of_bsn_flow_checksum_bucket_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5609,7 +5609,7 @@ of_bsn_flow_checksum_bucket_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5647,7 +5647,7 @@ of_bsn_flow_checksum_bucket_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5687,7 +5687,7 @@ of_bsn_flow_checksum_bucket_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5725,7 +5725,7 @@ of_bsn_flow_checksum_bucket_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5765,7 +5765,7 @@ of_bsn_flow_checksum_bucket_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5803,7 +5803,7 @@ of_bsn_flow_checksum_bucket_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5843,7 +5843,7 @@ of_bsn_flow_checksum_bucket_stats_request_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5881,7 +5881,7 @@ of_bsn_flow_checksum_bucket_stats_request_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_CHECKSUM_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5937,7 +5937,7 @@ static void
 of_bsn_flow_idle_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -6120,7 +6120,7 @@ of_bsn_flow_idle_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6158,7 +6158,7 @@ of_bsn_flow_idle_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6198,7 +6198,7 @@ of_bsn_flow_idle_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6236,7 +6236,7 @@ of_bsn_flow_idle_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6276,7 +6276,7 @@ of_bsn_flow_idle_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6314,7 +6314,7 @@ of_bsn_flow_idle_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6354,7 +6354,7 @@ of_bsn_flow_idle_cookie_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6392,7 +6392,7 @@ of_bsn_flow_idle_cookie_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6432,7 +6432,7 @@ of_bsn_flow_idle_priority_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6470,7 +6470,7 @@ of_bsn_flow_idle_priority_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6510,7 +6510,7 @@ of_bsn_flow_idle_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6548,7 +6548,7 @@ of_bsn_flow_idle_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6590,7 +6590,7 @@ of_bsn_flow_idle_match_get(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6642,7 +6642,7 @@ of_bsn_flow_idle_match_set(
     of_octets_t match_octets; /* Serialized string for match */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6714,7 +6714,7 @@ static void
 of_bsn_flow_idle_enable_get_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -6897,7 +6897,7 @@ of_bsn_flow_idle_enable_get_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6935,7 +6935,7 @@ of_bsn_flow_idle_enable_get_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6975,7 +6975,7 @@ of_bsn_flow_idle_enable_get_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7013,7 +7013,7 @@ of_bsn_flow_idle_enable_get_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7053,7 +7053,7 @@ of_bsn_flow_idle_enable_get_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7091,7 +7091,7 @@ of_bsn_flow_idle_enable_get_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7131,7 +7131,7 @@ of_bsn_flow_idle_enable_get_reply_enabled_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7169,7 +7169,7 @@ of_bsn_flow_idle_enable_get_reply_enabled_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7225,7 +7225,7 @@ static void
 of_bsn_flow_idle_enable_get_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -7408,7 +7408,7 @@ of_bsn_flow_idle_enable_get_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7446,7 +7446,7 @@ of_bsn_flow_idle_enable_get_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7486,7 +7486,7 @@ of_bsn_flow_idle_enable_get_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7524,7 +7524,7 @@ of_bsn_flow_idle_enable_get_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7564,7 +7564,7 @@ of_bsn_flow_idle_enable_get_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7602,7 +7602,7 @@ of_bsn_flow_idle_enable_get_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_GET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7658,7 +7658,7 @@ static void
 of_bsn_flow_idle_enable_set_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -7841,7 +7841,7 @@ of_bsn_flow_idle_enable_set_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7879,7 +7879,7 @@ of_bsn_flow_idle_enable_set_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7919,7 +7919,7 @@ of_bsn_flow_idle_enable_set_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7957,7 +7957,7 @@ of_bsn_flow_idle_enable_set_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7997,7 +7997,7 @@ of_bsn_flow_idle_enable_set_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8035,7 +8035,7 @@ of_bsn_flow_idle_enable_set_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8075,7 +8075,7 @@ of_bsn_flow_idle_enable_set_reply_enable_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8113,7 +8113,7 @@ of_bsn_flow_idle_enable_set_reply_enable_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8153,7 +8153,7 @@ of_bsn_flow_idle_enable_set_reply_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8191,7 +8191,7 @@ of_bsn_flow_idle_enable_set_reply_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8247,7 +8247,7 @@ static void
 of_bsn_flow_idle_enable_set_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -8430,7 +8430,7 @@ of_bsn_flow_idle_enable_set_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8468,7 +8468,7 @@ of_bsn_flow_idle_enable_set_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8508,7 +8508,7 @@ of_bsn_flow_idle_enable_set_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8546,7 +8546,7 @@ of_bsn_flow_idle_enable_set_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8586,7 +8586,7 @@ of_bsn_flow_idle_enable_set_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8624,7 +8624,7 @@ of_bsn_flow_idle_enable_set_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8664,7 +8664,7 @@ of_bsn_flow_idle_enable_set_request_enable_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8702,7 +8702,7 @@ of_bsn_flow_idle_enable_set_request_enable_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_FLOW_IDLE_ENABLE_SET_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8871,7 +8871,7 @@ of_bsn_gentable_bucket_stats_entry_checksum_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8909,7 +8909,7 @@ of_bsn_gentable_bucket_stats_entry_checksum_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8965,7 +8965,7 @@ static void
 of_bsn_gentable_bucket_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -9149,7 +9149,7 @@ of_bsn_gentable_bucket_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9187,7 +9187,7 @@ of_bsn_gentable_bucket_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9227,7 +9227,7 @@ of_bsn_gentable_bucket_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9265,7 +9265,7 @@ of_bsn_gentable_bucket_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9305,7 +9305,7 @@ of_bsn_gentable_bucket_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9343,7 +9343,7 @@ of_bsn_gentable_bucket_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9383,7 +9383,7 @@ of_bsn_gentable_bucket_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9421,7 +9421,7 @@ of_bsn_gentable_bucket_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9467,7 +9467,7 @@ of_bsn_gentable_bucket_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9541,7 +9541,7 @@ of_bsn_gentable_bucket_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9625,7 +9625,7 @@ static void
 of_bsn_gentable_bucket_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -9809,7 +9809,7 @@ of_bsn_gentable_bucket_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9847,7 +9847,7 @@ of_bsn_gentable_bucket_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9887,7 +9887,7 @@ of_bsn_gentable_bucket_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9925,7 +9925,7 @@ of_bsn_gentable_bucket_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9965,7 +9965,7 @@ of_bsn_gentable_bucket_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10003,7 +10003,7 @@ of_bsn_gentable_bucket_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10043,7 +10043,7 @@ of_bsn_gentable_bucket_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10081,7 +10081,7 @@ of_bsn_gentable_bucket_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10121,7 +10121,7 @@ of_bsn_gentable_bucket_stats_request_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10159,7 +10159,7 @@ of_bsn_gentable_bucket_stats_request_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_BUCKET_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10215,7 +10215,7 @@ static void
 of_bsn_gentable_clear_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -10398,7 +10398,7 @@ of_bsn_gentable_clear_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10436,7 +10436,7 @@ of_bsn_gentable_clear_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10476,7 +10476,7 @@ of_bsn_gentable_clear_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10514,7 +10514,7 @@ of_bsn_gentable_clear_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10554,7 +10554,7 @@ of_bsn_gentable_clear_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10592,7 +10592,7 @@ of_bsn_gentable_clear_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10632,7 +10632,7 @@ of_bsn_gentable_clear_reply_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10670,7 +10670,7 @@ of_bsn_gentable_clear_reply_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10710,7 +10710,7 @@ of_bsn_gentable_clear_reply_deleted_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10748,7 +10748,7 @@ of_bsn_gentable_clear_reply_deleted_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10788,7 +10788,7 @@ of_bsn_gentable_clear_reply_error_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10826,7 +10826,7 @@ of_bsn_gentable_clear_reply_error_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10882,7 +10882,7 @@ static void
 of_bsn_gentable_clear_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -11065,7 +11065,7 @@ of_bsn_gentable_clear_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11103,7 +11103,7 @@ of_bsn_gentable_clear_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11143,7 +11143,7 @@ of_bsn_gentable_clear_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11181,7 +11181,7 @@ of_bsn_gentable_clear_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11221,7 +11221,7 @@ of_bsn_gentable_clear_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11259,7 +11259,7 @@ of_bsn_gentable_clear_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11299,7 +11299,7 @@ of_bsn_gentable_clear_request_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11337,7 +11337,7 @@ of_bsn_gentable_clear_request_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11377,7 +11377,7 @@ of_bsn_gentable_clear_request_checksum_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11415,7 +11415,7 @@ of_bsn_gentable_clear_request_checksum_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11455,7 +11455,7 @@ of_bsn_gentable_clear_request_checksum_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11493,7 +11493,7 @@ of_bsn_gentable_clear_request_checksum_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_CLEAR_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11667,7 +11667,7 @@ of_bsn_gentable_desc_stats_entry_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11705,7 +11705,7 @@ of_bsn_gentable_desc_stats_entry_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11745,7 +11745,7 @@ of_bsn_gentable_desc_stats_entry_name_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11783,7 +11783,7 @@ of_bsn_gentable_desc_stats_entry_name_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11823,7 +11823,7 @@ of_bsn_gentable_desc_stats_entry_buckets_size_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11861,7 +11861,7 @@ of_bsn_gentable_desc_stats_entry_buckets_size_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11901,7 +11901,7 @@ of_bsn_gentable_desc_stats_entry_max_entries_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11939,7 +11939,7 @@ of_bsn_gentable_desc_stats_entry_max_entries_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11995,7 +11995,7 @@ static void
 of_bsn_gentable_desc_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -12179,7 +12179,7 @@ of_bsn_gentable_desc_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12217,7 +12217,7 @@ of_bsn_gentable_desc_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12257,7 +12257,7 @@ of_bsn_gentable_desc_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12295,7 +12295,7 @@ of_bsn_gentable_desc_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12335,7 +12335,7 @@ of_bsn_gentable_desc_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12373,7 +12373,7 @@ of_bsn_gentable_desc_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12413,7 +12413,7 @@ of_bsn_gentable_desc_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12451,7 +12451,7 @@ of_bsn_gentable_desc_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12497,7 +12497,7 @@ of_bsn_gentable_desc_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12571,7 +12571,7 @@ of_bsn_gentable_desc_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12655,7 +12655,7 @@ static void
 of_bsn_gentable_desc_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -12839,7 +12839,7 @@ of_bsn_gentable_desc_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12877,7 +12877,7 @@ of_bsn_gentable_desc_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12917,7 +12917,7 @@ of_bsn_gentable_desc_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12955,7 +12955,7 @@ of_bsn_gentable_desc_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12995,7 +12995,7 @@ of_bsn_gentable_desc_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13033,7 +13033,7 @@ of_bsn_gentable_desc_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13073,7 +13073,7 @@ of_bsn_gentable_desc_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13111,7 +13111,7 @@ of_bsn_gentable_desc_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13167,7 +13167,7 @@ static void
 of_bsn_gentable_entry_add_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -13350,7 +13350,7 @@ of_bsn_gentable_entry_add_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13388,7 +13388,7 @@ of_bsn_gentable_entry_add_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13428,7 +13428,7 @@ of_bsn_gentable_entry_add_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13466,7 +13466,7 @@ of_bsn_gentable_entry_add_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13506,7 +13506,7 @@ of_bsn_gentable_entry_add_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13544,7 +13544,7 @@ of_bsn_gentable_entry_add_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13584,7 +13584,7 @@ of_bsn_gentable_entry_add_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13622,7 +13622,7 @@ of_bsn_gentable_entry_add_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13662,7 +13662,7 @@ of_bsn_gentable_entry_add_checksum_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13700,7 +13700,7 @@ of_bsn_gentable_entry_add_checksum_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13746,7 +13746,7 @@ of_bsn_gentable_entry_add_key_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13820,7 +13820,7 @@ of_bsn_gentable_entry_add_key_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13892,7 +13892,7 @@ of_bsn_gentable_entry_add_value_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13966,7 +13966,7 @@ of_bsn_gentable_entry_add_value_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_ADD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14050,7 +14050,7 @@ static void
 of_bsn_gentable_entry_delete_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -14233,7 +14233,7 @@ of_bsn_gentable_entry_delete_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14271,7 +14271,7 @@ of_bsn_gentable_entry_delete_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14311,7 +14311,7 @@ of_bsn_gentable_entry_delete_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14349,7 +14349,7 @@ of_bsn_gentable_entry_delete_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14389,7 +14389,7 @@ of_bsn_gentable_entry_delete_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14427,7 +14427,7 @@ of_bsn_gentable_entry_delete_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14467,7 +14467,7 @@ of_bsn_gentable_entry_delete_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14505,7 +14505,7 @@ of_bsn_gentable_entry_delete_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14551,7 +14551,7 @@ of_bsn_gentable_entry_delete_key_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14625,7 +14625,7 @@ of_bsn_gentable_entry_delete_key_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DELETE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14827,7 +14827,7 @@ of_bsn_gentable_entry_desc_stats_entry_checksum_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14865,7 +14865,7 @@ of_bsn_gentable_entry_desc_stats_entry_checksum_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14911,7 +14911,7 @@ of_bsn_gentable_entry_desc_stats_entry_key_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14985,7 +14985,7 @@ of_bsn_gentable_entry_desc_stats_entry_key_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15057,7 +15057,7 @@ of_bsn_gentable_entry_desc_stats_entry_value_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15131,7 +15131,7 @@ of_bsn_gentable_entry_desc_stats_entry_value_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15215,7 +15215,7 @@ static void
 of_bsn_gentable_entry_desc_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -15399,7 +15399,7 @@ of_bsn_gentable_entry_desc_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15437,7 +15437,7 @@ of_bsn_gentable_entry_desc_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15477,7 +15477,7 @@ of_bsn_gentable_entry_desc_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15515,7 +15515,7 @@ of_bsn_gentable_entry_desc_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15555,7 +15555,7 @@ of_bsn_gentable_entry_desc_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15593,7 +15593,7 @@ of_bsn_gentable_entry_desc_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15633,7 +15633,7 @@ of_bsn_gentable_entry_desc_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15671,7 +15671,7 @@ of_bsn_gentable_entry_desc_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15717,7 +15717,7 @@ of_bsn_gentable_entry_desc_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15791,7 +15791,7 @@ of_bsn_gentable_entry_desc_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15875,7 +15875,7 @@ static void
 of_bsn_gentable_entry_desc_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -16059,7 +16059,7 @@ of_bsn_gentable_entry_desc_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16097,7 +16097,7 @@ of_bsn_gentable_entry_desc_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16137,7 +16137,7 @@ of_bsn_gentable_entry_desc_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16175,7 +16175,7 @@ of_bsn_gentable_entry_desc_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16215,7 +16215,7 @@ of_bsn_gentable_entry_desc_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16253,7 +16253,7 @@ of_bsn_gentable_entry_desc_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16293,7 +16293,7 @@ of_bsn_gentable_entry_desc_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16331,7 +16331,7 @@ of_bsn_gentable_entry_desc_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16371,7 +16371,7 @@ of_bsn_gentable_entry_desc_stats_request_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16409,7 +16409,7 @@ of_bsn_gentable_entry_desc_stats_request_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16449,7 +16449,7 @@ of_bsn_gentable_entry_desc_stats_request_checksum_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16487,7 +16487,7 @@ of_bsn_gentable_entry_desc_stats_request_checksum_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16527,7 +16527,7 @@ of_bsn_gentable_entry_desc_stats_request_checksum_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16565,7 +16565,7 @@ of_bsn_gentable_entry_desc_stats_request_checksum_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16745,7 +16745,7 @@ of_bsn_gentable_entry_stats_entry_key_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16819,7 +16819,7 @@ of_bsn_gentable_entry_stats_entry_key_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16891,7 +16891,7 @@ of_bsn_gentable_entry_stats_entry_stats_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16965,7 +16965,7 @@ of_bsn_gentable_entry_stats_entry_stats_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17049,7 +17049,7 @@ static void
 of_bsn_gentable_entry_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -17233,7 +17233,7 @@ of_bsn_gentable_entry_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17271,7 +17271,7 @@ of_bsn_gentable_entry_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17311,7 +17311,7 @@ of_bsn_gentable_entry_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17349,7 +17349,7 @@ of_bsn_gentable_entry_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17389,7 +17389,7 @@ of_bsn_gentable_entry_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17427,7 +17427,7 @@ of_bsn_gentable_entry_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17467,7 +17467,7 @@ of_bsn_gentable_entry_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17505,7 +17505,7 @@ of_bsn_gentable_entry_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17551,7 +17551,7 @@ of_bsn_gentable_entry_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17625,7 +17625,7 @@ of_bsn_gentable_entry_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_GENTABLE_ENTRY_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -33,7 +33,7 @@ static void
 of_bsn_tlv_circuit_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xe); /* type */
         break;
@@ -173,7 +173,7 @@ of_bsn_tlv_circuit_id_value_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_CIRCUIT_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -217,7 +217,7 @@ of_bsn_tlv_circuit_id_value_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_CIRCUIT_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -284,7 +284,7 @@ static void
 of_bsn_tlv_idle_notification_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x7); /* type */
         break;
@@ -439,7 +439,7 @@ static void
 of_bsn_tlv_idle_time_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x5); /* type */
         break;
@@ -578,7 +578,7 @@ of_bsn_tlv_idle_time_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_IDLE_TIME);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -616,7 +616,7 @@ of_bsn_tlv_idle_time_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_IDLE_TIME);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -672,7 +672,7 @@ static void
 of_bsn_tlv_idle_timeout_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x8); /* type */
         break;
@@ -811,7 +811,7 @@ of_bsn_tlv_idle_timeout_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_IDLE_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -849,7 +849,7 @@ of_bsn_tlv_idle_timeout_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_IDLE_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -905,7 +905,7 @@ static void
 of_bsn_tlv_ipv4_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x4); /* type */
         break;
@@ -1044,7 +1044,7 @@ of_bsn_tlv_ipv4_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_IPV4);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1082,7 +1082,7 @@ of_bsn_tlv_ipv4_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_IPV4);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1138,7 +1138,7 @@ static void
 of_bsn_tlv_mac_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1); /* type */
         break;
@@ -1277,7 +1277,7 @@ of_bsn_tlv_mac_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_MAC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1315,7 +1315,7 @@ of_bsn_tlv_mac_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_MAC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1371,7 +1371,7 @@ static void
 of_bsn_tlv_miss_packets_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xd); /* type */
         break;
@@ -1510,7 +1510,7 @@ of_bsn_tlv_miss_packets_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_MISS_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1548,7 +1548,7 @@ of_bsn_tlv_miss_packets_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_MISS_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1604,7 +1604,7 @@ static void
 of_bsn_tlv_port_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x0); /* type */
         break;
@@ -1743,7 +1743,7 @@ of_bsn_tlv_port_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1782,7 +1782,7 @@ of_bsn_tlv_port_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1838,7 +1838,7 @@ static void
 of_bsn_tlv_reply_packets_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xc); /* type */
         break;
@@ -1977,7 +1977,7 @@ of_bsn_tlv_reply_packets_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_REPLY_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2015,7 +2015,7 @@ of_bsn_tlv_reply_packets_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_REPLY_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2071,7 +2071,7 @@ static void
 of_bsn_tlv_request_packets_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xb); /* type */
         break;
@@ -2210,7 +2210,7 @@ of_bsn_tlv_request_packets_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_REQUEST_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2248,7 +2248,7 @@ of_bsn_tlv_request_packets_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_REQUEST_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2304,7 +2304,7 @@ static void
 of_bsn_tlv_rx_packets_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x2); /* type */
         break;
@@ -2443,7 +2443,7 @@ of_bsn_tlv_rx_packets_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_RX_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2481,7 +2481,7 @@ of_bsn_tlv_rx_packets_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_RX_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2537,7 +2537,7 @@ static void
 of_bsn_tlv_tx_packets_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x3); /* type */
         break;
@@ -2676,7 +2676,7 @@ of_bsn_tlv_tx_packets_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_TX_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2714,7 +2714,7 @@ of_bsn_tlv_tx_packets_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_TX_PACKETS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2770,7 +2770,7 @@ static void
 of_bsn_tlv_udf_anchor_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x10); /* type */
         break;
@@ -2909,7 +2909,7 @@ of_bsn_tlv_udf_anchor_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UDF_ANCHOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2947,7 +2947,7 @@ of_bsn_tlv_udf_anchor_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UDF_ANCHOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3003,7 +3003,7 @@ static void
 of_bsn_tlv_udf_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xf); /* type */
         break;
@@ -3142,7 +3142,7 @@ of_bsn_tlv_udf_id_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UDF_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3180,7 +3180,7 @@ of_bsn_tlv_udf_id_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UDF_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3236,7 +3236,7 @@ static void
 of_bsn_tlv_udf_length_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x12); /* type */
         break;
@@ -3375,7 +3375,7 @@ of_bsn_tlv_udf_length_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UDF_LENGTH);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3413,7 +3413,7 @@ of_bsn_tlv_udf_length_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UDF_LENGTH);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3469,7 +3469,7 @@ static void
 of_bsn_tlv_udf_offset_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x11); /* type */
         break;
@@ -3608,7 +3608,7 @@ of_bsn_tlv_udf_offset_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UDF_OFFSET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3646,7 +3646,7 @@ of_bsn_tlv_udf_offset_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UDF_OFFSET);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3702,7 +3702,7 @@ static void
 of_bsn_tlv_unicast_query_timeout_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x9); /* type */
         break;
@@ -3841,7 +3841,7 @@ of_bsn_tlv_unicast_query_timeout_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UNICAST_QUERY_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3879,7 +3879,7 @@ of_bsn_tlv_unicast_query_timeout_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_UNICAST_QUERY_TIMEOUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3935,7 +3935,7 @@ static void
 of_bsn_tlv_vlan_vid_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x6); /* type */
         break;
@@ -4074,7 +4074,7 @@ of_bsn_tlv_vlan_vid_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_VLAN_VID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4112,7 +4112,7 @@ of_bsn_tlv_vlan_vid_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_TLV_VLAN_VID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4286,7 +4286,7 @@ of_bsn_vlan_counter_stats_entry_vlan_vid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4324,7 +4324,7 @@ of_bsn_vlan_counter_stats_entry_vlan_vid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4370,7 +4370,7 @@ of_bsn_vlan_counter_stats_entry_values_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4444,7 +4444,7 @@ of_bsn_vlan_counter_stats_entry_values_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_ENTRY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4528,7 +4528,7 @@ static void
 of_bsn_vlan_counter_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -4712,7 +4712,7 @@ of_bsn_vlan_counter_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4750,7 +4750,7 @@ of_bsn_vlan_counter_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4790,7 +4790,7 @@ of_bsn_vlan_counter_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4828,7 +4828,7 @@ of_bsn_vlan_counter_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4868,7 +4868,7 @@ of_bsn_vlan_counter_stats_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4906,7 +4906,7 @@ of_bsn_vlan_counter_stats_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4946,7 +4946,7 @@ of_bsn_vlan_counter_stats_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4984,7 +4984,7 @@ of_bsn_vlan_counter_stats_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5030,7 +5030,7 @@ of_bsn_vlan_counter_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5104,7 +5104,7 @@ of_bsn_vlan_counter_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5188,7 +5188,7 @@ static void
 of_bsn_vlan_counter_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -5372,7 +5372,7 @@ of_bsn_vlan_counter_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5410,7 +5410,7 @@ of_bsn_vlan_counter_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5450,7 +5450,7 @@ of_bsn_vlan_counter_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5488,7 +5488,7 @@ of_bsn_vlan_counter_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5528,7 +5528,7 @@ of_bsn_vlan_counter_stats_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5566,7 +5566,7 @@ of_bsn_vlan_counter_stats_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5606,7 +5606,7 @@ of_bsn_vlan_counter_stats_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5644,7 +5644,7 @@ of_bsn_vlan_counter_stats_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5684,7 +5684,7 @@ of_bsn_vlan_counter_stats_request_vlan_vid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5722,7 +5722,7 @@ of_bsn_vlan_counter_stats_request_vlan_vid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_BSN_VLAN_COUNTER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5779,7 +5779,7 @@ void
 of_experimenter_multipart_reply_ofdpa_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 20)); /* subtype */
         switch (value) {
@@ -5968,7 +5968,7 @@ of_experimenter_multipart_reply_ofdpa_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REPLY_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6006,7 +6006,7 @@ of_experimenter_multipart_reply_ofdpa_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REPLY_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6046,7 +6046,7 @@ of_experimenter_multipart_reply_ofdpa_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REPLY_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6084,7 +6084,7 @@ of_experimenter_multipart_reply_ofdpa_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REPLY_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6124,7 +6124,7 @@ of_experimenter_multipart_reply_ofdpa_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REPLY_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6162,7 +6162,7 @@ of_experimenter_multipart_reply_ofdpa_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REPLY_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6202,7 +6202,7 @@ of_experimenter_multipart_reply_ofdpa_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REPLY_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6240,7 +6240,7 @@ of_experimenter_multipart_reply_ofdpa_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REPLY_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6297,7 +6297,7 @@ void
 of_experimenter_multipart_request_ofdpa_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 20)); /* subtype */
         switch (value) {
@@ -6486,7 +6486,7 @@ of_experimenter_multipart_request_ofdpa_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REQUEST_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6524,7 +6524,7 @@ of_experimenter_multipart_request_ofdpa_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REQUEST_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6564,7 +6564,7 @@ of_experimenter_multipart_request_ofdpa_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REQUEST_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6602,7 +6602,7 @@ of_experimenter_multipart_request_ofdpa_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REQUEST_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6642,7 +6642,7 @@ of_experimenter_multipart_request_ofdpa_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REQUEST_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6680,7 +6680,7 @@ of_experimenter_multipart_request_ofdpa_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REQUEST_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6720,7 +6720,7 @@ of_experimenter_multipart_request_ofdpa_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REQUEST_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6758,7 +6758,7 @@ of_experimenter_multipart_request_ofdpa_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_MULTIPART_REQUEST_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6815,7 +6815,7 @@ void
 of_experimenter_ofdpa_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 12)); /* subtype */
         switch (value) {
@@ -7004,7 +7004,7 @@ of_experimenter_ofdpa_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7042,7 +7042,7 @@ of_experimenter_ofdpa_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7082,7 +7082,7 @@ of_experimenter_ofdpa_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7120,7 +7120,7 @@ of_experimenter_ofdpa_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7160,7 +7160,7 @@ of_experimenter_ofdpa_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7198,7 +7198,7 @@ of_experimenter_ofdpa_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7238,7 +7238,7 @@ of_experimenter_ofdpa_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7276,7 +7276,7 @@ of_experimenter_ofdpa_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7317,7 +7317,7 @@ of_experimenter_ofdpa_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7361,7 +7361,7 @@ of_experimenter_ofdpa_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_EXPERIMENTER_OFDPA);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7429,7 +7429,7 @@ void
 of_hello_elem_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 0)); /* type */
         switch (value) {
@@ -7571,7 +7571,7 @@ static void
 of_hello_elem_versionbitmap_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1); /* type */
         break;
@@ -7716,7 +7716,7 @@ of_hello_elem_versionbitmap_bitmaps_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_HELLO_ELEM_VERSIONBITMAP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7790,7 +7790,7 @@ of_hello_elem_versionbitmap_bitmaps_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_HELLO_ELEM_VERSIONBITMAP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7875,7 +7875,7 @@ void
 of_instruction_id_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 0)); /* type */
         switch (value) {
@@ -8035,7 +8035,7 @@ static void
 of_instruction_id_apply_actions_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x4); /* type */
         break;
@@ -8191,7 +8191,7 @@ void
 of_instruction_bsn_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 8)); /* subtype */
         switch (value) {
@@ -8334,7 +8334,7 @@ of_instruction_bsn_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8372,7 +8372,7 @@ of_instruction_bsn_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8412,7 +8412,7 @@ of_instruction_bsn_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8450,7 +8450,7 @@ of_instruction_bsn_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8507,7 +8507,7 @@ void
 of_instruction_id_experimenter_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 4)); /* experimenter */
         switch (value) {
@@ -8632,7 +8632,7 @@ of_instruction_id_experimenter_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_ID_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8670,7 +8670,7 @@ of_instruction_id_experimenter_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_ID_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8727,7 +8727,7 @@ void
 of_instruction_id_bsn_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint32_t value = U32_NTOH(*(uint32_t *)(buf + 8)); /* subtype */
         switch (value) {
@@ -8870,7 +8870,7 @@ of_instruction_id_bsn_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_ID_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8908,7 +8908,7 @@ of_instruction_id_bsn_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_ID_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8948,7 +8948,7 @@ of_instruction_id_bsn_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_ID_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8986,7 +8986,7 @@ of_instruction_id_bsn_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_ID_BSN);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9042,7 +9042,7 @@ static void
 of_instruction_bsn_arp_offload_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         *(uint32_t *)(buf + 4) = U32_HTON(0x5c16c7); /* experimenter */
@@ -9183,7 +9183,7 @@ of_instruction_bsn_arp_offload_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_BSN_ARP_OFFLOAD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9221,7 +9221,7 @@ of_instruction_bsn_arp_offload_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_BSN_ARP_OFFLOAD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9261,7 +9261,7 @@ of_instruction_bsn_arp_offload_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_BSN_ARP_OFFLOAD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9299,7 +9299,7 @@ of_instruction_bsn_arp_offload_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_INSTRUCTION_BSN_ARP_OFFLOAD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
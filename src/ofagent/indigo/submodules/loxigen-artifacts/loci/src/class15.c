@@ -33,7 +33,7 @@ static void
 of_meter_features_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -215,7 +215,7 @@ of_meter_features_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -253,7 +253,7 @@ of_meter_features_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -293,7 +293,7 @@ of_meter_features_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -331,7 +331,7 @@ of_meter_features_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -377,7 +377,7 @@ of_meter_features_stats_reply_features_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -451,7 +451,7 @@ of_meter_features_stats_reply_features_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -535,7 +535,7 @@ static void
 of_meter_features_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -717,7 +717,7 @@ of_meter_features_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -755,7 +755,7 @@ of_meter_features_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -795,7 +795,7 @@ of_meter_features_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -833,7 +833,7 @@ of_meter_features_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -889,7 +889,7 @@ static void
 of_meter_mod_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1; /* type */
@@ -1071,7 +1071,7 @@ of_meter_mod_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1109,7 +1109,7 @@ of_meter_mod_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1149,7 +1149,7 @@ of_meter_mod_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1187,7 +1187,7 @@ of_meter_mod_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1228,7 +1228,7 @@ of_meter_mod_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_METER_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1272,7 +1272,7 @@ of_meter_mod_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_METER_MOD_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1339,7 +1339,7 @@ static void
 of_meter_modify_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1d; /* type */
@@ -1521,7 +1521,7 @@ of_meter_modify_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1559,7 +1559,7 @@ of_meter_modify_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1599,7 +1599,7 @@ of_meter_modify_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1637,7 +1637,7 @@ of_meter_modify_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1677,7 +1677,7 @@ of_meter_modify_meter_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1715,7 +1715,7 @@ of_meter_modify_meter_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1761,7 +1761,7 @@ of_meter_modify_meters_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_METER_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1835,7 +1835,7 @@ of_meter_modify_meters_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_METER_MODIFY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2037,7 +2037,7 @@ of_meter_stats_meter_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2075,7 +2075,7 @@ of_meter_stats_meter_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2115,7 +2115,7 @@ of_meter_stats_flow_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2153,7 +2153,7 @@ of_meter_stats_flow_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2193,7 +2193,7 @@ of_meter_stats_packet_in_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2231,7 +2231,7 @@ of_meter_stats_packet_in_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2271,7 +2271,7 @@ of_meter_stats_byte_in_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2309,7 +2309,7 @@ of_meter_stats_byte_in_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2349,7 +2349,7 @@ of_meter_stats_duration_sec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2387,7 +2387,7 @@ of_meter_stats_duration_sec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2427,7 +2427,7 @@ of_meter_stats_duration_nsec_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2465,7 +2465,7 @@ of_meter_stats_duration_nsec_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2511,7 +2511,7 @@ of_meter_stats_band_stats_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2585,7 +2585,7 @@ of_meter_stats_band_stats_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2669,7 +2669,7 @@ static void
 of_meter_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -2851,7 +2851,7 @@ of_meter_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2889,7 +2889,7 @@ of_meter_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2929,7 +2929,7 @@ of_meter_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2967,7 +2967,7 @@ of_meter_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3013,7 +3013,7 @@ of_meter_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3087,7 +3087,7 @@ of_meter_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3171,7 +3171,7 @@ static void
 of_meter_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -3353,7 +3353,7 @@ of_meter_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3391,7 +3391,7 @@ of_meter_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3431,7 +3431,7 @@ of_meter_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3469,7 +3469,7 @@ of_meter_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3509,7 +3509,7 @@ of_meter_stats_request_meter_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3547,7 +3547,7 @@ of_meter_stats_request_meter_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_METER_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3603,7 +3603,7 @@ static void
 of_oxm_ofdpa_allow_vlan_translation_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff3005); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -3737,7 +3737,7 @@ of_oxm_ofdpa_allow_vlan_translation_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_ALLOW_VLAN_TRANSLATION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3775,7 +3775,7 @@ of_oxm_ofdpa_allow_vlan_translation_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_ALLOW_VLAN_TRANSLATION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3815,7 +3815,7 @@ of_oxm_ofdpa_allow_vlan_translation_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_ALLOW_VLAN_TRANSLATION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3853,7 +3853,7 @@ of_oxm_ofdpa_allow_vlan_translation_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_ALLOW_VLAN_TRANSLATION);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3909,7 +3909,7 @@ static void
 of_oxm_ofdpa_bfd_discriminator_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff2808); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -4043,7 +4043,7 @@ of_oxm_ofdpa_bfd_discriminator_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4081,7 +4081,7 @@ of_oxm_ofdpa_bfd_discriminator_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4121,7 +4121,7 @@ of_oxm_ofdpa_bfd_discriminator_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4159,7 +4159,7 @@ of_oxm_ofdpa_bfd_discriminator_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4215,7 +4215,7 @@ static void
 of_oxm_ofdpa_bfd_discriminator_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff290c); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -4349,7 +4349,7 @@ of_oxm_ofdpa_bfd_discriminator_masked_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4387,7 +4387,7 @@ of_oxm_ofdpa_bfd_discriminator_masked_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4427,7 +4427,7 @@ of_oxm_ofdpa_bfd_discriminator_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4465,7 +4465,7 @@ of_oxm_ofdpa_bfd_discriminator_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4505,7 +4505,7 @@ of_oxm_ofdpa_bfd_discriminator_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4543,7 +4543,7 @@ of_oxm_ofdpa_bfd_discriminator_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_BFD_DISCRIMINATOR_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4599,7 +4599,7 @@ static void
 of_oxm_ofdpa_color_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff0605); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -4733,7 +4733,7 @@ of_oxm_ofdpa_color_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_COLOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4771,7 +4771,7 @@ of_oxm_ofdpa_color_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_COLOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4811,7 +4811,7 @@ of_oxm_ofdpa_color_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_COLOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4849,7 +4849,7 @@ of_oxm_ofdpa_color_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_COLOR);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4905,7 +4905,7 @@ static void
 of_oxm_ofdpa_color_actions_index_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff2008); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5039,7 +5039,7 @@ of_oxm_ofdpa_color_actions_index_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_COLOR_ACTIONS_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5077,7 +5077,7 @@ of_oxm_ofdpa_color_actions_index_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_COLOR_ACTIONS_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5117,7 +5117,7 @@ of_oxm_ofdpa_color_actions_index_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_COLOR_ACTIONS_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5155,7 +5155,7 @@ of_oxm_ofdpa_color_actions_index_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_COLOR_ACTIONS_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5211,7 +5211,7 @@ static void
 of_oxm_ofdpa_dei_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff0805); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5345,7 +5345,7 @@ of_oxm_ofdpa_dei_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_DEI);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5383,7 +5383,7 @@ of_oxm_ofdpa_dei_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_DEI);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5423,7 +5423,7 @@ of_oxm_ofdpa_dei_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_DEI);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5461,7 +5461,7 @@ of_oxm_ofdpa_dei_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_DEI);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5517,7 +5517,7 @@ static void
 of_oxm_ofdpa_l3_in_port_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff1208); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5651,7 +5651,7 @@ of_oxm_ofdpa_l3_in_port_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_L3_IN_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5689,7 +5689,7 @@ of_oxm_ofdpa_l3_in_port_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_L3_IN_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5729,7 +5729,7 @@ of_oxm_ofdpa_l3_in_port_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_L3_IN_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5767,7 +5767,7 @@ of_oxm_ofdpa_l3_in_port_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_L3_IN_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5823,7 +5823,7 @@ static void
 of_oxm_ofdpa_lmep_id_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff0c08); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -5957,7 +5957,7 @@ of_oxm_ofdpa_lmep_id_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_LMEP_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5995,7 +5995,7 @@ of_oxm_ofdpa_lmep_id_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_LMEP_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6035,7 +6035,7 @@ of_oxm_ofdpa_lmep_id_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_LMEP_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6073,7 +6073,7 @@ of_oxm_ofdpa_lmep_id_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_LMEP_ID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6129,7 +6129,7 @@ static void
 of_oxm_ofdpa_mpls_ach_channel_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff1806); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -6263,7 +6263,7 @@ of_oxm_ofdpa_mpls_ach_channel_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_ACH_CHANNEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6301,7 +6301,7 @@ of_oxm_ofdpa_mpls_ach_channel_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_ACH_CHANNEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6341,7 +6341,7 @@ of_oxm_ofdpa_mpls_ach_channel_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_ACH_CHANNEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6379,7 +6379,7 @@ of_oxm_ofdpa_mpls_ach_channel_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_ACH_CHANNEL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6435,7 +6435,7 @@ static void
 of_oxm_ofdpa_mpls_data_first_nibble_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff1605); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -6569,7 +6569,7 @@ of_oxm_ofdpa_mpls_data_first_nibble_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_DATA_FIRST_NIBBLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6607,7 +6607,7 @@ of_oxm_ofdpa_mpls_data_first_nibble_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_DATA_FIRST_NIBBLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6647,7 +6647,7 @@ of_oxm_ofdpa_mpls_data_first_nibble_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_DATA_FIRST_NIBBLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6685,7 +6685,7 @@ of_oxm_ofdpa_mpls_data_first_nibble_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_DATA_FIRST_NIBBLE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6741,7 +6741,7 @@ static void
 of_oxm_ofdpa_mpls_l2_port_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff1008); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -6875,7 +6875,7 @@ of_oxm_ofdpa_mpls_l2_port_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6913,7 +6913,7 @@ of_oxm_ofdpa_mpls_l2_port_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6953,7 +6953,7 @@ of_oxm_ofdpa_mpls_l2_port_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6991,7 +6991,7 @@ of_oxm_ofdpa_mpls_l2_port_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7047,7 +7047,7 @@ static void
 of_oxm_ofdpa_mpls_l2_port_masked_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff110c); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -7181,7 +7181,7 @@ of_oxm_ofdpa_mpls_l2_port_masked_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7219,7 +7219,7 @@ of_oxm_ofdpa_mpls_l2_port_masked_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7259,7 +7259,7 @@ of_oxm_ofdpa_mpls_l2_port_masked_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7297,7 +7297,7 @@ of_oxm_ofdpa_mpls_l2_port_masked_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7337,7 +7337,7 @@ of_oxm_ofdpa_mpls_l2_port_masked_value_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7375,7 +7375,7 @@ of_oxm_ofdpa_mpls_l2_port_masked_value_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_L2_PORT_MASKED);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7431,7 +7431,7 @@ static void
 of_oxm_ofdpa_mpls_next_label_is_gal_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff1a05); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -7565,7 +7565,7 @@ of_oxm_ofdpa_mpls_next_label_is_gal_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_NEXT_LABEL_IS_GAL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7603,7 +7603,7 @@ of_oxm_ofdpa_mpls_next_label_is_gal_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_NEXT_LABEL_IS_GAL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7643,7 +7643,7 @@ of_oxm_ofdpa_mpls_next_label_is_gal_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_NEXT_LABEL_IS_GAL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7681,7 +7681,7 @@ of_oxm_ofdpa_mpls_next_label_is_gal_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_NEXT_LABEL_IS_GAL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7737,7 +7737,7 @@ static void
 of_oxm_ofdpa_mpls_ttl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff0e05); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -7871,7 +7871,7 @@ of_oxm_ofdpa_mpls_ttl_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7909,7 +7909,7 @@ of_oxm_ofdpa_mpls_ttl_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7949,7 +7949,7 @@ of_oxm_ofdpa_mpls_ttl_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7987,7 +7987,7 @@ of_oxm_ofdpa_mpls_ttl_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_TTL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8043,7 +8043,7 @@ static void
 of_oxm_ofdpa_mpls_type_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff2e06); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -8177,7 +8177,7 @@ of_oxm_ofdpa_mpls_type_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8215,7 +8215,7 @@ of_oxm_ofdpa_mpls_type_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8255,7 +8255,7 @@ of_oxm_ofdpa_mpls_type_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8293,7 +8293,7 @@ of_oxm_ofdpa_mpls_type_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_MPLS_TYPE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8349,7 +8349,7 @@ static void
 of_oxm_ofdpa_oam_y1731_mdl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff1c05); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -8483,7 +8483,7 @@ of_oxm_ofdpa_oam_y1731_mdl_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OAM_Y1731_MDL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8521,7 +8521,7 @@ of_oxm_ofdpa_oam_y1731_mdl_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OAM_Y1731_MDL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8561,7 +8561,7 @@ of_oxm_ofdpa_oam_y1731_mdl_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OAM_Y1731_MDL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8599,7 +8599,7 @@ of_oxm_ofdpa_oam_y1731_mdl_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OAM_Y1731_MDL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8655,7 +8655,7 @@ static void
 of_oxm_ofdpa_oam_y1731_opcode_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff1e05); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -8789,7 +8789,7 @@ of_oxm_ofdpa_oam_y1731_opcode_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OAM_Y1731_OPCODE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8827,7 +8827,7 @@ of_oxm_ofdpa_oam_y1731_opcode_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OAM_Y1731_OPCODE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8867,7 +8867,7 @@ of_oxm_ofdpa_oam_y1731_opcode_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OAM_Y1731_OPCODE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8905,7 +8905,7 @@ of_oxm_ofdpa_oam_y1731_opcode_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OAM_Y1731_OPCODE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8961,7 +8961,7 @@ static void
 of_oxm_ofdpa_ovid_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff1406); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -9095,7 +9095,7 @@ of_oxm_ofdpa_ovid_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OVID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9133,7 +9133,7 @@ of_oxm_ofdpa_ovid_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OVID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9173,7 +9173,7 @@ of_oxm_ofdpa_ovid_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OVID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9211,7 +9211,7 @@ of_oxm_ofdpa_ovid_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_OVID);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9267,7 +9267,7 @@ static void
 of_oxm_ofdpa_protection_index_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff2a05); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -9401,7 +9401,7 @@ of_oxm_ofdpa_protection_index_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_PROTECTION_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9439,7 +9439,7 @@ of_oxm_ofdpa_protection_index_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_PROTECTION_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9479,7 +9479,7 @@ of_oxm_ofdpa_protection_index_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_PROTECTION_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9517,7 +9517,7 @@ of_oxm_ofdpa_protection_index_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_PROTECTION_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9573,7 +9573,7 @@ static void
 of_oxm_ofdpa_qos_index_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff0a05); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -9707,7 +9707,7 @@ of_oxm_ofdpa_qos_index_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_QOS_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9745,7 +9745,7 @@ of_oxm_ofdpa_qos_index_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_QOS_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9785,7 +9785,7 @@ of_oxm_ofdpa_qos_index_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_QOS_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9823,7 +9823,7 @@ of_oxm_ofdpa_qos_index_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_QOS_INDEX);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9879,7 +9879,7 @@ static void
 of_oxm_ofdpa_rx_timestamp_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff260c); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -10013,7 +10013,7 @@ of_oxm_ofdpa_rx_timestamp_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_RX_TIMESTAMP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10051,7 +10051,7 @@ of_oxm_ofdpa_rx_timestamp_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_RX_TIMESTAMP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10091,7 +10091,7 @@ of_oxm_ofdpa_rx_timestamp_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_RX_TIMESTAMP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10129,7 +10129,7 @@ of_oxm_ofdpa_rx_timestamp_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_RX_TIMESTAMP);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10185,7 +10185,7 @@ static void
 of_oxm_ofdpa_rxfcl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff240c); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -10319,7 +10319,7 @@ of_oxm_ofdpa_rxfcl_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_RXFCL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10357,7 +10357,7 @@ of_oxm_ofdpa_rxfcl_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_RXFCL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10397,7 +10397,7 @@ of_oxm_ofdpa_rxfcl_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_RXFCL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10435,7 +10435,7 @@ of_oxm_ofdpa_rxfcl_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_RXFCL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10491,7 +10491,7 @@ static void
 of_oxm_ofdpa_traffic_class_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff0405); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -10625,7 +10625,7 @@ of_oxm_ofdpa_traffic_class_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_TRAFFIC_CLASS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10663,7 +10663,7 @@ of_oxm_ofdpa_traffic_class_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_TRAFFIC_CLASS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10703,7 +10703,7 @@ of_oxm_ofdpa_traffic_class_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_TRAFFIC_CLASS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10741,7 +10741,7 @@ of_oxm_ofdpa_traffic_class_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_TRAFFIC_CLASS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10797,7 +10797,7 @@ static void
 of_oxm_ofdpa_txfcl_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff220c); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -10931,7 +10931,7 @@ of_oxm_ofdpa_txfcl_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_TXFCL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10969,7 +10969,7 @@ of_oxm_ofdpa_txfcl_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_TXFCL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11009,7 +11009,7 @@ of_oxm_ofdpa_txfcl_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_TXFCL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11047,7 +11047,7 @@ of_oxm_ofdpa_txfcl_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_TXFCL);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11103,7 +11103,7 @@ static void
 of_oxm_ofdpa_vrf_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff0206); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x1018); /* experimenter */
@@ -11237,7 +11237,7 @@ of_oxm_ofdpa_vrf_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_VRF);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11275,7 +11275,7 @@ of_oxm_ofdpa_vrf_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_VRF);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11315,7 +11315,7 @@ of_oxm_ofdpa_vrf_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_VRF);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11353,7 +11353,7 @@ of_oxm_ofdpa_vrf_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_OFDPA_VRF);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -33,7 +33,7 @@ static void
 of_oxm_onf_actset_output_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint32_t *)(buf + 0) = U32_HTON(0xffff5608); /* type_len */
         *(uint32_t *)(buf + 4) = U32_HTON(0x4f4e4600); /* experimenter */
@@ -167,7 +167,7 @@ of_oxm_onf_actset_output_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ONF_ACTSET_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -205,7 +205,7 @@ of_oxm_onf_actset_output_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ONF_ACTSET_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -245,7 +245,7 @@ of_oxm_onf_actset_output_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ONF_ACTSET_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -283,7 +283,7 @@ of_oxm_onf_actset_output_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_OXM_ONF_ACTSET_OUTPUT);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -339,7 +339,7 @@ static void
 of_port_desc_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -521,7 +521,7 @@ of_port_desc_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -559,7 +559,7 @@ of_port_desc_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -599,7 +599,7 @@ of_port_desc_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -637,7 +637,7 @@ of_port_desc_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -683,7 +683,7 @@ of_port_desc_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -757,7 +757,7 @@ of_port_desc_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -841,7 +841,7 @@ static void
 of_port_desc_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -1023,7 +1023,7 @@ of_port_desc_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1061,7 +1061,7 @@ of_port_desc_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1101,7 +1101,7 @@ of_port_desc_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1139,7 +1139,7 @@ of_port_desc_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_PORT_DESC_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1196,7 +1196,7 @@ void
 of_table_feature_prop_wire_object_id_get(of_object_t *obj, of_object_id_t *id)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3: {
         uint16_t value = U16_NTOH(*(uint16_t *)(buf + 0)); /* type */
         switch (value) {
@@ -1383,7 +1383,7 @@ static void
 of_table_feature_prop_apply_actions_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x6); /* type */
         break;
@@ -1528,7 +1528,7 @@ of_table_feature_prop_apply_actions_action_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_APPLY_ACTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1602,7 +1602,7 @@ of_table_feature_prop_apply_actions_action_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_APPLY_ACTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1686,7 +1686,7 @@ static void
 of_table_feature_prop_apply_actions_miss_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x7); /* type */
         break;
@@ -1831,7 +1831,7 @@ of_table_feature_prop_apply_actions_miss_action_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_APPLY_ACTIONS_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1905,7 +1905,7 @@ of_table_feature_prop_apply_actions_miss_action_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_APPLY_ACTIONS_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1989,7 +1989,7 @@ static void
 of_table_feature_prop_apply_setfield_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xe); /* type */
         break;
@@ -2134,7 +2134,7 @@ of_table_feature_prop_apply_setfield_oxm_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_APPLY_SETFIELD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2208,7 +2208,7 @@ of_table_feature_prop_apply_setfield_oxm_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_APPLY_SETFIELD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2292,7 +2292,7 @@ static void
 of_table_feature_prop_apply_setfield_miss_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xf); /* type */
         break;
@@ -2437,7 +2437,7 @@ of_table_feature_prop_apply_setfield_miss_oxm_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_APPLY_SETFIELD_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2511,7 +2511,7 @@ of_table_feature_prop_apply_setfield_miss_oxm_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_APPLY_SETFIELD_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2595,7 +2595,7 @@ static void
 of_table_feature_prop_experimenter_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xfffe); /* type */
         break;
@@ -2734,7 +2734,7 @@ of_table_feature_prop_experimenter_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2772,7 +2772,7 @@ of_table_feature_prop_experimenter_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2812,7 +2812,7 @@ of_table_feature_prop_experimenter_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2850,7 +2850,7 @@ of_table_feature_prop_experimenter_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2891,7 +2891,7 @@ of_table_feature_prop_experimenter_experimenter_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2935,7 +2935,7 @@ of_table_feature_prop_experimenter_experimenter_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3002,7 +3002,7 @@ static void
 of_table_feature_prop_experimenter_miss_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xffff); /* type */
         break;
@@ -3141,7 +3141,7 @@ of_table_feature_prop_experimenter_miss_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3179,7 +3179,7 @@ of_table_feature_prop_experimenter_miss_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3219,7 +3219,7 @@ of_table_feature_prop_experimenter_miss_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3257,7 +3257,7 @@ of_table_feature_prop_experimenter_miss_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3298,7 +3298,7 @@ of_table_feature_prop_experimenter_miss_experimenter_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3342,7 +3342,7 @@ of_table_feature_prop_experimenter_miss_experimenter_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_EXPERIMENTER_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3409,7 +3409,7 @@ static void
 of_table_feature_prop_instructions_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x0); /* type */
         break;
@@ -3554,7 +3554,7 @@ of_table_feature_prop_instructions_instruction_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_INSTRUCTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3628,7 +3628,7 @@ of_table_feature_prop_instructions_instruction_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_INSTRUCTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3712,7 +3712,7 @@ static void
 of_table_feature_prop_instructions_miss_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x1); /* type */
         break;
@@ -3857,7 +3857,7 @@ of_table_feature_prop_instructions_miss_instruction_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_INSTRUCTIONS_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3931,7 +3931,7 @@ of_table_feature_prop_instructions_miss_instruction_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_INSTRUCTIONS_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4015,7 +4015,7 @@ static void
 of_table_feature_prop_match_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x8); /* type */
         break;
@@ -4160,7 +4160,7 @@ of_table_feature_prop_match_oxm_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_MATCH);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4234,7 +4234,7 @@ of_table_feature_prop_match_oxm_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_MATCH);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4318,7 +4318,7 @@ static void
 of_table_feature_prop_next_tables_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x2); /* type */
         break;
@@ -4463,7 +4463,7 @@ of_table_feature_prop_next_tables_next_table_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_NEXT_TABLES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4537,7 +4537,7 @@ of_table_feature_prop_next_tables_next_table_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_NEXT_TABLES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4621,7 +4621,7 @@ static void
 of_table_feature_prop_next_tables_miss_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x3); /* type */
         break;
@@ -4766,7 +4766,7 @@ of_table_feature_prop_next_tables_miss_next_table_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_NEXT_TABLES_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4840,7 +4840,7 @@ of_table_feature_prop_next_tables_miss_next_table_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_NEXT_TABLES_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4924,7 +4924,7 @@ static void
 of_table_feature_prop_wildcards_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xa); /* type */
         break;
@@ -5069,7 +5069,7 @@ of_table_feature_prop_wildcards_oxm_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WILDCARDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5143,7 +5143,7 @@ of_table_feature_prop_wildcards_oxm_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WILDCARDS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5227,7 +5227,7 @@ static void
 of_table_feature_prop_write_actions_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x4); /* type */
         break;
@@ -5372,7 +5372,7 @@ of_table_feature_prop_write_actions_action_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WRITE_ACTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5446,7 +5446,7 @@ of_table_feature_prop_write_actions_action_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WRITE_ACTIONS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5530,7 +5530,7 @@ static void
 of_table_feature_prop_write_actions_miss_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0x5); /* type */
         break;
@@ -5675,7 +5675,7 @@ of_table_feature_prop_write_actions_miss_action_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WRITE_ACTIONS_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5749,7 +5749,7 @@ of_table_feature_prop_write_actions_miss_action_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WRITE_ACTIONS_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5833,7 +5833,7 @@ static void
 of_table_feature_prop_write_setfield_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xc); /* type */
         break;
@@ -5978,7 +5978,7 @@ of_table_feature_prop_write_setfield_oxm_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WRITE_SETFIELD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6052,7 +6052,7 @@ of_table_feature_prop_write_setfield_oxm_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WRITE_SETFIELD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6136,7 +6136,7 @@ static void
 of_table_feature_prop_write_setfield_miss_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint16_t *)(buf + 0) = U16_HTON(0xd); /* type */
         break;
@@ -6281,7 +6281,7 @@ of_table_feature_prop_write_setfield_miss_oxm_ids_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WRITE_SETFIELD_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6355,7 +6355,7 @@ of_table_feature_prop_write_setfield_miss_oxm_ids_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURE_PROP_WRITE_SETFIELD_MISS);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6557,7 +6557,7 @@ of_table_features_table_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6595,7 +6595,7 @@ of_table_features_table_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6635,7 +6635,7 @@ of_table_features_name_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6673,7 +6673,7 @@ of_table_features_name_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6713,7 +6713,7 @@ of_table_features_metadata_match_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6751,7 +6751,7 @@ of_table_features_metadata_match_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6791,7 +6791,7 @@ of_table_features_metadata_write_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6829,7 +6829,7 @@ of_table_features_metadata_write_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6869,7 +6869,7 @@ of_table_features_config_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6907,7 +6907,7 @@ of_table_features_config_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6947,7 +6947,7 @@ of_table_features_max_entries_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6985,7 +6985,7 @@ of_table_features_max_entries_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7031,7 +7031,7 @@ of_table_features_properties_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7105,7 +7105,7 @@ of_table_features_properties_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7189,7 +7189,7 @@ static void
 of_table_features_failed_error_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x1; /* type */
@@ -7371,7 +7371,7 @@ of_table_features_failed_error_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7409,7 +7409,7 @@ of_table_features_failed_error_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7449,7 +7449,7 @@ of_table_features_failed_error_msg_code_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7487,7 +7487,7 @@ of_table_features_failed_error_msg_code_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7528,7 +7528,7 @@ of_table_features_failed_error_msg_data_get(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7572,7 +7572,7 @@ of_table_features_failed_error_msg_data_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_FAILED_ERROR_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7639,7 +7639,7 @@ static void
 of_table_features_stats_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -7821,7 +7821,7 @@ of_table_features_stats_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7859,7 +7859,7 @@ of_table_features_stats_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7899,7 +7899,7 @@ of_table_features_stats_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7937,7 +7937,7 @@ of_table_features_stats_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7983,7 +7983,7 @@ of_table_features_stats_reply_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8057,7 +8057,7 @@ of_table_features_stats_reply_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8141,7 +8141,7 @@ static void
 of_table_features_stats_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -8323,7 +8323,7 @@ of_table_features_stats_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8361,7 +8361,7 @@ of_table_features_stats_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8401,7 +8401,7 @@ of_table_features_stats_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8439,7 +8439,7 @@ of_table_features_stats_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8485,7 +8485,7 @@ of_table_features_stats_request_entries_bind(
     int cur_len = 0; /* Current length of object data */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8559,7 +8559,7 @@ of_table_features_stats_request_entries_set(
     int new_len, delta; /* For set, need new length and delta */
 
     LOCI_ASSERT(obj->object_id == OF_TABLE_FEATURES_STATS_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8756,7 +8756,7 @@ of_uint32_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_UINT32);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8794,7 +8794,7 @@ of_uint32_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_UINT32);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8963,7 +8963,7 @@ of_uint64_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_UINT64);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9001,7 +9001,7 @@ of_uint64_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_UINT64);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9170,7 +9170,7 @@ of_uint8_value_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_UINT8);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9208,7 +9208,7 @@ of_uint8_value_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OF_UINT8);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9264,7 +9264,7 @@ static void
 ofdpa_class_based_ctr_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -9447,7 +9447,7 @@ ofdpa_class_based_ctr_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9485,7 +9485,7 @@ ofdpa_class_based_ctr_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9525,7 +9525,7 @@ ofdpa_class_based_ctr_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9563,7 +9563,7 @@ ofdpa_class_based_ctr_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9603,7 +9603,7 @@ ofdpa_class_based_ctr_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9641,7 +9641,7 @@ ofdpa_class_based_ctr_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9681,7 +9681,7 @@ ofdpa_class_based_ctr_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9719,7 +9719,7 @@ ofdpa_class_based_ctr_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9759,7 +9759,7 @@ ofdpa_class_based_ctr_mod_msg_block_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9797,7 +9797,7 @@ ofdpa_class_based_ctr_mod_msg_block_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9837,7 +9837,7 @@ ofdpa_class_based_ctr_mod_msg_transmit_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9875,7 +9875,7 @@ ofdpa_class_based_ctr_mod_msg_transmit_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9915,7 +9915,7 @@ ofdpa_class_based_ctr_mod_msg_receive_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9953,7 +9953,7 @@ ofdpa_class_based_ctr_mod_msg_receive_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9993,7 +9993,7 @@ ofdpa_class_based_ctr_mod_msg_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10031,7 +10031,7 @@ ofdpa_class_based_ctr_mod_msg_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10087,7 +10087,7 @@ static void
 ofdpa_class_based_ctr_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -10270,7 +10270,7 @@ ofdpa_class_based_ctr_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10308,7 +10308,7 @@ ofdpa_class_based_ctr_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10348,7 +10348,7 @@ ofdpa_class_based_ctr_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10386,7 +10386,7 @@ ofdpa_class_based_ctr_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10426,7 +10426,7 @@ ofdpa_class_based_ctr_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10464,7 +10464,7 @@ ofdpa_class_based_ctr_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10504,7 +10504,7 @@ ofdpa_class_based_ctr_multipart_reply_block_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10542,7 +10542,7 @@ ofdpa_class_based_ctr_multipart_reply_block_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10582,7 +10582,7 @@ ofdpa_class_based_ctr_multipart_reply_transmit_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10620,7 +10620,7 @@ ofdpa_class_based_ctr_multipart_reply_transmit_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10660,7 +10660,7 @@ ofdpa_class_based_ctr_multipart_reply_receive_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10698,7 +10698,7 @@ ofdpa_class_based_ctr_multipart_reply_receive_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10738,7 +10738,7 @@ ofdpa_class_based_ctr_multipart_reply_reference_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10776,7 +10776,7 @@ ofdpa_class_based_ctr_multipart_reply_reference_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10816,7 +10816,7 @@ ofdpa_class_based_ctr_multipart_reply_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10854,7 +10854,7 @@ ofdpa_class_based_ctr_multipart_reply_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10910,7 +10910,7 @@ static void
 ofdpa_class_based_ctr_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -11093,7 +11093,7 @@ ofdpa_class_based_ctr_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11131,7 +11131,7 @@ ofdpa_class_based_ctr_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11171,7 +11171,7 @@ ofdpa_class_based_ctr_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11209,7 +11209,7 @@ ofdpa_class_based_ctr_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11249,7 +11249,7 @@ ofdpa_class_based_ctr_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11287,7 +11287,7 @@ ofdpa_class_based_ctr_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11327,7 +11327,7 @@ ofdpa_class_based_ctr_multipart_request_block_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11365,7 +11365,7 @@ ofdpa_class_based_ctr_multipart_request_block_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11405,7 +11405,7 @@ ofdpa_class_based_ctr_multipart_request_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11443,7 +11443,7 @@ ofdpa_class_based_ctr_multipart_request_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_CLASS_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11499,7 +11499,7 @@ static void
 ofdpa_color_based_ctr_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -11682,7 +11682,7 @@ ofdpa_color_based_ctr_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11720,7 +11720,7 @@ ofdpa_color_based_ctr_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11760,7 +11760,7 @@ ofdpa_color_based_ctr_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11798,7 +11798,7 @@ ofdpa_color_based_ctr_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11838,7 +11838,7 @@ ofdpa_color_based_ctr_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11876,7 +11876,7 @@ ofdpa_color_based_ctr_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11916,7 +11916,7 @@ ofdpa_color_based_ctr_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11954,7 +11954,7 @@ ofdpa_color_based_ctr_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11994,7 +11994,7 @@ ofdpa_color_based_ctr_mod_msg_block_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12032,7 +12032,7 @@ ofdpa_color_based_ctr_mod_msg_block_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12072,7 +12072,7 @@ ofdpa_color_based_ctr_mod_msg_transmit_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12110,7 +12110,7 @@ ofdpa_color_based_ctr_mod_msg_transmit_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12150,7 +12150,7 @@ ofdpa_color_based_ctr_mod_msg_receive_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12188,7 +12188,7 @@ ofdpa_color_based_ctr_mod_msg_receive_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12228,7 +12228,7 @@ ofdpa_color_based_ctr_mod_msg_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12266,7 +12266,7 @@ ofdpa_color_based_ctr_mod_msg_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12322,7 +12322,7 @@ static void
 ofdpa_color_based_ctr_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -12505,7 +12505,7 @@ ofdpa_color_based_ctr_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12543,7 +12543,7 @@ ofdpa_color_based_ctr_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12583,7 +12583,7 @@ ofdpa_color_based_ctr_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12621,7 +12621,7 @@ ofdpa_color_based_ctr_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12661,7 +12661,7 @@ ofdpa_color_based_ctr_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12699,7 +12699,7 @@ ofdpa_color_based_ctr_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12739,7 +12739,7 @@ ofdpa_color_based_ctr_multipart_reply_block_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12777,7 +12777,7 @@ ofdpa_color_based_ctr_multipart_reply_block_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12817,7 +12817,7 @@ ofdpa_color_based_ctr_multipart_reply_transmit_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12855,7 +12855,7 @@ ofdpa_color_based_ctr_multipart_reply_transmit_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12895,7 +12895,7 @@ ofdpa_color_based_ctr_multipart_reply_receive_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12933,7 +12933,7 @@ ofdpa_color_based_ctr_multipart_reply_receive_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12973,7 +12973,7 @@ ofdpa_color_based_ctr_multipart_reply_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13011,7 +13011,7 @@ ofdpa_color_based_ctr_multipart_reply_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
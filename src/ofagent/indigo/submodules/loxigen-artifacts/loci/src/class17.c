@@ -33,7 +33,7 @@ static void
 ofdpa_color_based_ctr_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -216,7 +216,7 @@ ofdpa_color_based_ctr_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -254,7 +254,7 @@ ofdpa_color_based_ctr_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -294,7 +294,7 @@ ofdpa_color_based_ctr_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -332,7 +332,7 @@ ofdpa_color_based_ctr_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -372,7 +372,7 @@ ofdpa_color_based_ctr_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -410,7 +410,7 @@ ofdpa_color_based_ctr_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -450,7 +450,7 @@ ofdpa_color_based_ctr_multipart_request_block_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -488,7 +488,7 @@ ofdpa_color_based_ctr_multipart_request_block_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -528,7 +528,7 @@ ofdpa_color_based_ctr_multipart_request_transmit_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -566,7 +566,7 @@ ofdpa_color_based_ctr_multipart_request_transmit_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -606,7 +606,7 @@ ofdpa_color_based_ctr_multipart_request_receive_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -644,7 +644,7 @@ ofdpa_color_based_ctr_multipart_request_receive_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -684,7 +684,7 @@ ofdpa_color_based_ctr_multipart_request_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -722,7 +722,7 @@ ofdpa_color_based_ctr_multipart_request_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_COLOR_BASED_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -778,7 +778,7 @@ static void
 ofdpa_l2_interface_remark_action_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -961,7 +961,7 @@ ofdpa_l2_interface_remark_action_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -999,7 +999,7 @@ ofdpa_l2_interface_remark_action_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1039,7 +1039,7 @@ ofdpa_l2_interface_remark_action_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1077,7 +1077,7 @@ ofdpa_l2_interface_remark_action_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1117,7 +1117,7 @@ ofdpa_l2_interface_remark_action_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1155,7 +1155,7 @@ ofdpa_l2_interface_remark_action_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1195,7 +1195,7 @@ ofdpa_l2_interface_remark_action_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1233,7 +1233,7 @@ ofdpa_l2_interface_remark_action_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1273,7 +1273,7 @@ ofdpa_l2_interface_remark_action_mod_msg_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1311,7 +1311,7 @@ ofdpa_l2_interface_remark_action_mod_msg_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1351,7 +1351,7 @@ ofdpa_l2_interface_remark_action_mod_msg_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1389,7 +1389,7 @@ ofdpa_l2_interface_remark_action_mod_msg_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1429,7 +1429,7 @@ ofdpa_l2_interface_remark_action_mod_msg_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1467,7 +1467,7 @@ ofdpa_l2_interface_remark_action_mod_msg_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1507,7 +1507,7 @@ ofdpa_l2_interface_remark_action_mod_msg_dscp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1545,7 +1545,7 @@ ofdpa_l2_interface_remark_action_mod_msg_dscp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1585,7 +1585,7 @@ ofdpa_l2_interface_remark_action_mod_msg_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1623,7 +1623,7 @@ ofdpa_l2_interface_remark_action_mod_msg_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1663,7 +1663,7 @@ ofdpa_l2_interface_remark_action_mod_msg_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1701,7 +1701,7 @@ ofdpa_l2_interface_remark_action_mod_msg_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1757,7 +1757,7 @@ static void
 ofdpa_l2_interface_remark_action_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -1941,7 +1941,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -1979,7 +1979,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2019,7 +2019,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2057,7 +2057,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2097,7 +2097,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2135,7 +2135,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2175,7 +2175,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2213,7 +2213,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2253,7 +2253,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2291,7 +2291,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2331,7 +2331,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2369,7 +2369,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2409,7 +2409,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2447,7 +2447,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2487,7 +2487,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2525,7 +2525,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2565,7 +2565,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2603,7 +2603,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2643,7 +2643,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2681,7 +2681,7 @@ ofdpa_l2_interface_remark_action_multipart_reply_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2737,7 +2737,7 @@ static void
 ofdpa_l2_interface_remark_action_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -2921,7 +2921,7 @@ ofdpa_l2_interface_remark_action_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2959,7 +2959,7 @@ ofdpa_l2_interface_remark_action_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -2999,7 +2999,7 @@ ofdpa_l2_interface_remark_action_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3037,7 +3037,7 @@ ofdpa_l2_interface_remark_action_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3077,7 +3077,7 @@ ofdpa_l2_interface_remark_action_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3115,7 +3115,7 @@ ofdpa_l2_interface_remark_action_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3155,7 +3155,7 @@ ofdpa_l2_interface_remark_action_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3193,7 +3193,7 @@ ofdpa_l2_interface_remark_action_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3233,7 +3233,7 @@ ofdpa_l2_interface_remark_action_multipart_request_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3271,7 +3271,7 @@ ofdpa_l2_interface_remark_action_multipart_request_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3311,7 +3311,7 @@ ofdpa_l2_interface_remark_action_multipart_request_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3349,7 +3349,7 @@ ofdpa_l2_interface_remark_action_multipart_request_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3389,7 +3389,7 @@ ofdpa_l2_interface_remark_action_multipart_request_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3427,7 +3427,7 @@ ofdpa_l2_interface_remark_action_multipart_request_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3467,7 +3467,7 @@ ofdpa_l2_interface_remark_action_multipart_request_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3505,7 +3505,7 @@ ofdpa_l2_interface_remark_action_multipart_request_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3545,7 +3545,7 @@ ofdpa_l2_interface_remark_action_multipart_request_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3583,7 +3583,7 @@ ofdpa_l2_interface_remark_action_multipart_request_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3623,7 +3623,7 @@ ofdpa_l2_interface_remark_action_multipart_request_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3661,7 +3661,7 @@ ofdpa_l2_interface_remark_action_multipart_request_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_L2_INTERFACE_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3717,7 +3717,7 @@ static void
 ofdpa_mpls_set_qos_action_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -3900,7 +3900,7 @@ ofdpa_mpls_set_qos_action_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3938,7 +3938,7 @@ ofdpa_mpls_set_qos_action_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -3978,7 +3978,7 @@ ofdpa_mpls_set_qos_action_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4016,7 +4016,7 @@ ofdpa_mpls_set_qos_action_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4056,7 +4056,7 @@ ofdpa_mpls_set_qos_action_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4094,7 +4094,7 @@ ofdpa_mpls_set_qos_action_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4134,7 +4134,7 @@ ofdpa_mpls_set_qos_action_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4172,7 +4172,7 @@ ofdpa_mpls_set_qos_action_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4212,7 +4212,7 @@ ofdpa_mpls_set_qos_action_mod_msg_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4250,7 +4250,7 @@ ofdpa_mpls_set_qos_action_mod_msg_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4290,7 +4290,7 @@ ofdpa_mpls_set_qos_action_mod_msg_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4328,7 +4328,7 @@ ofdpa_mpls_set_qos_action_mod_msg_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4368,7 +4368,7 @@ ofdpa_mpls_set_qos_action_mod_msg_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4406,7 +4406,7 @@ ofdpa_mpls_set_qos_action_mod_msg_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4446,7 +4446,7 @@ ofdpa_mpls_set_qos_action_mod_msg_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4484,7 +4484,7 @@ ofdpa_mpls_set_qos_action_mod_msg_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4540,7 +4540,7 @@ static void
 ofdpa_mpls_set_qos_action_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -4724,7 +4724,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4762,7 +4762,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4802,7 +4802,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4840,7 +4840,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4880,7 +4880,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4918,7 +4918,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4958,7 +4958,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -4996,7 +4996,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5036,7 +5036,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5074,7 +5074,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5114,7 +5114,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5152,7 +5152,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5192,7 +5192,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5230,7 +5230,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5270,7 +5270,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5308,7 +5308,7 @@ ofdpa_mpls_set_qos_action_multipart_reply_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5364,7 +5364,7 @@ static void
 ofdpa_mpls_set_qos_action_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -5548,7 +5548,7 @@ ofdpa_mpls_set_qos_action_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5586,7 +5586,7 @@ ofdpa_mpls_set_qos_action_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5626,7 +5626,7 @@ ofdpa_mpls_set_qos_action_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5664,7 +5664,7 @@ ofdpa_mpls_set_qos_action_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5704,7 +5704,7 @@ ofdpa_mpls_set_qos_action_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5742,7 +5742,7 @@ ofdpa_mpls_set_qos_action_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5782,7 +5782,7 @@ ofdpa_mpls_set_qos_action_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5820,7 +5820,7 @@ ofdpa_mpls_set_qos_action_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5860,7 +5860,7 @@ ofdpa_mpls_set_qos_action_multipart_request_qos_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5898,7 +5898,7 @@ ofdpa_mpls_set_qos_action_multipart_request_qos_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5938,7 +5938,7 @@ ofdpa_mpls_set_qos_action_multipart_request_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -5976,7 +5976,7 @@ ofdpa_mpls_set_qos_action_multipart_request_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6016,7 +6016,7 @@ ofdpa_mpls_set_qos_action_multipart_request_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6054,7 +6054,7 @@ ofdpa_mpls_set_qos_action_multipart_request_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6094,7 +6094,7 @@ ofdpa_mpls_set_qos_action_multipart_request_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6132,7 +6132,7 @@ ofdpa_mpls_set_qos_action_multipart_request_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_SET_QOS_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6188,7 +6188,7 @@ static void
 ofdpa_mpls_tunnel_label_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -6372,7 +6372,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6410,7 +6410,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6450,7 +6450,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6488,7 +6488,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6528,7 +6528,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6566,7 +6566,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6606,7 +6606,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6644,7 +6644,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6684,7 +6684,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6722,7 +6722,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6762,7 +6762,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6800,7 +6800,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6840,7 +6840,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6878,7 +6878,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6918,7 +6918,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6956,7 +6956,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -6996,7 +6996,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7034,7 +7034,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7074,7 +7074,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7112,7 +7112,7 @@ ofdpa_mpls_tunnel_label_multipart_reply_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7168,7 +7168,7 @@ static void
 ofdpa_mpls_tunnel_label_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -7352,7 +7352,7 @@ ofdpa_mpls_tunnel_label_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7390,7 +7390,7 @@ ofdpa_mpls_tunnel_label_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7430,7 +7430,7 @@ ofdpa_mpls_tunnel_label_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7468,7 +7468,7 @@ ofdpa_mpls_tunnel_label_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7508,7 +7508,7 @@ ofdpa_mpls_tunnel_label_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7546,7 +7546,7 @@ ofdpa_mpls_tunnel_label_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7586,7 +7586,7 @@ ofdpa_mpls_tunnel_label_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7624,7 +7624,7 @@ ofdpa_mpls_tunnel_label_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7664,7 +7664,7 @@ ofdpa_mpls_tunnel_label_multipart_request_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7702,7 +7702,7 @@ ofdpa_mpls_tunnel_label_multipart_request_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7742,7 +7742,7 @@ ofdpa_mpls_tunnel_label_multipart_request_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7780,7 +7780,7 @@ ofdpa_mpls_tunnel_label_multipart_request_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7820,7 +7820,7 @@ ofdpa_mpls_tunnel_label_multipart_request_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7858,7 +7858,7 @@ ofdpa_mpls_tunnel_label_multipart_request_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7898,7 +7898,7 @@ ofdpa_mpls_tunnel_label_multipart_request_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7936,7 +7936,7 @@ ofdpa_mpls_tunnel_label_multipart_request_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -7976,7 +7976,7 @@ ofdpa_mpls_tunnel_label_multipart_request_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8014,7 +8014,7 @@ ofdpa_mpls_tunnel_label_multipart_request_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8054,7 +8054,7 @@ ofdpa_mpls_tunnel_label_multipart_request_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8092,7 +8092,7 @@ ofdpa_mpls_tunnel_label_multipart_request_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8148,7 +8148,7 @@ static void
 ofdpa_mpls_tunnel_label_remark_action_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -8331,7 +8331,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8369,7 +8369,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8409,7 +8409,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8447,7 +8447,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8487,7 +8487,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8525,7 +8525,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8565,7 +8565,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8603,7 +8603,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8643,7 +8643,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8681,7 +8681,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8721,7 +8721,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8759,7 +8759,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8799,7 +8799,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8837,7 +8837,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8877,7 +8877,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8915,7 +8915,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8955,7 +8955,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -8993,7 +8993,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9033,7 +9033,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9071,7 +9071,7 @@ ofdpa_mpls_tunnel_label_remark_action_mod_msg_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_TUNNEL_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9127,7 +9127,7 @@ static void
 ofdpa_mpls_vpn_label_remark_action_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -9310,7 +9310,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9348,7 +9348,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9388,7 +9388,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9426,7 +9426,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9466,7 +9466,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9504,7 +9504,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9544,7 +9544,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9582,7 +9582,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9622,7 +9622,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9660,7 +9660,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9700,7 +9700,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9738,7 +9738,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9778,7 +9778,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9816,7 +9816,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9856,7 +9856,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9894,7 +9894,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9934,7 +9934,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -9972,7 +9972,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10012,7 +10012,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10050,7 +10050,7 @@ ofdpa_mpls_vpn_label_remark_action_mod_msg_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10106,7 +10106,7 @@ static void
 ofdpa_mpls_vpn_label_remark_action_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -10290,7 +10290,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10328,7 +10328,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10368,7 +10368,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10406,7 +10406,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10446,7 +10446,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10484,7 +10484,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10524,7 +10524,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10562,7 +10562,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10602,7 +10602,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10640,7 +10640,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10680,7 +10680,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10718,7 +10718,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10758,7 +10758,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10796,7 +10796,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10836,7 +10836,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10874,7 +10874,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10914,7 +10914,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10952,7 +10952,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -10992,7 +10992,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11030,7 +11030,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_reply_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11086,7 +11086,7 @@ static void
 ofdpa_mpls_vpn_label_remark_action_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -11270,7 +11270,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11308,7 +11308,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11348,7 +11348,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11386,7 +11386,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11426,7 +11426,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11464,7 +11464,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11504,7 +11504,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11542,7 +11542,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11582,7 +11582,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11620,7 +11620,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11660,7 +11660,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11698,7 +11698,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11738,7 +11738,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_color_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11776,7 +11776,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_color_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11816,7 +11816,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_mpls_tc_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11854,7 +11854,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_mpls_tc_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11894,7 +11894,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_pcp_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11932,7 +11932,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_pcp_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -11972,7 +11972,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_dei_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12010,7 +12010,7 @@ ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_dei_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_MPLS_VPN_LABEL_REMARK_ACTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12066,7 +12066,7 @@ static void
 ofdpa_oam_dataplane_ctr_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -12249,7 +12249,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12287,7 +12287,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12327,7 +12327,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12365,7 +12365,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12405,7 +12405,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12443,7 +12443,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12483,7 +12483,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12521,7 +12521,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12561,7 +12561,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_lmep_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12599,7 +12599,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_lmep_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12639,7 +12639,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_transmit_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12677,7 +12677,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_transmit_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12717,7 +12717,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_receive_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12755,7 +12755,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_receive_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12795,7 +12795,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12833,7 +12833,7 @@ ofdpa_oam_dataplane_ctr_mod_msg_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -12889,7 +12889,7 @@ static void
 ofdpa_oam_dataplane_ctr_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -13073,7 +13073,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13111,7 +13111,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13151,7 +13151,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13189,7 +13189,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13229,7 +13229,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13267,7 +13267,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13307,7 +13307,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13345,7 +13345,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13385,7 +13385,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_lmep_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13423,7 +13423,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_lmep_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13463,7 +13463,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_receive_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13501,7 +13501,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_receive_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13541,7 +13541,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_transmit_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13579,7 +13579,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_transmit_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13619,7 +13619,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_reference_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13657,7 +13657,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_reference_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13697,7 +13697,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13735,7 +13735,7 @@ ofdpa_oam_dataplane_ctr_multipart_reply_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -13791,7 +13791,7 @@ static void
 ofdpa_oam_dataplane_ctr_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -13975,7 +13975,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14013,7 +14013,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14053,7 +14053,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14091,7 +14091,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14131,7 +14131,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14169,7 +14169,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14209,7 +14209,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14247,7 +14247,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14287,7 +14287,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_lmep_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14325,7 +14325,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_lmep_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14365,7 +14365,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_transmit_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14403,7 +14403,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_transmit_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14443,7 +14443,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_receive_packets_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14481,7 +14481,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_receive_packets_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14521,7 +14521,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_reference_count_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14559,7 +14559,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_reference_count_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14599,7 +14599,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_traffic_class_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14637,7 +14637,7 @@ ofdpa_oam_dataplane_ctr_multipart_request_traffic_class_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DATAPLANE_CTR_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14693,7 +14693,7 @@ static void
 ofdpa_oam_drop_status_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -14876,7 +14876,7 @@ ofdpa_oam_drop_status_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14914,7 +14914,7 @@ ofdpa_oam_drop_status_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14954,7 +14954,7 @@ ofdpa_oam_drop_status_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -14992,7 +14992,7 @@ ofdpa_oam_drop_status_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15032,7 +15032,7 @@ ofdpa_oam_drop_status_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15070,7 +15070,7 @@ ofdpa_oam_drop_status_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15110,7 +15110,7 @@ ofdpa_oam_drop_status_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15148,7 +15148,7 @@ ofdpa_oam_drop_status_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15188,7 +15188,7 @@ ofdpa_oam_drop_status_mod_msg_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15226,7 +15226,7 @@ ofdpa_oam_drop_status_mod_msg_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15266,7 +15266,7 @@ ofdpa_oam_drop_status_mod_msg_entry_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15304,7 +15304,7 @@ ofdpa_oam_drop_status_mod_msg_entry_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15344,7 +15344,7 @@ ofdpa_oam_drop_status_mod_msg_drop_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15382,7 +15382,7 @@ ofdpa_oam_drop_status_mod_msg_drop_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15438,7 +15438,7 @@ static void
 ofdpa_oam_drop_status_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -15622,7 +15622,7 @@ ofdpa_oam_drop_status_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15660,7 +15660,7 @@ ofdpa_oam_drop_status_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15700,7 +15700,7 @@ ofdpa_oam_drop_status_multipart_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15738,7 +15738,7 @@ ofdpa_oam_drop_status_multipart_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15778,7 +15778,7 @@ ofdpa_oam_drop_status_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15816,7 +15816,7 @@ ofdpa_oam_drop_status_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15856,7 +15856,7 @@ ofdpa_oam_drop_status_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15894,7 +15894,7 @@ ofdpa_oam_drop_status_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15934,7 +15934,7 @@ ofdpa_oam_drop_status_multipart_reply_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -15972,7 +15972,7 @@ ofdpa_oam_drop_status_multipart_reply_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16012,7 +16012,7 @@ ofdpa_oam_drop_status_multipart_reply_entry_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16050,7 +16050,7 @@ ofdpa_oam_drop_status_multipart_reply_entry_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16090,7 +16090,7 @@ ofdpa_oam_drop_status_multipart_reply_drop_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16128,7 +16128,7 @@ ofdpa_oam_drop_status_multipart_reply_drop_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16184,7 +16184,7 @@ static void
 ofdpa_oam_drop_status_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -16368,7 +16368,7 @@ ofdpa_oam_drop_status_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16406,7 +16406,7 @@ ofdpa_oam_drop_status_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16446,7 +16446,7 @@ ofdpa_oam_drop_status_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16484,7 +16484,7 @@ ofdpa_oam_drop_status_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16524,7 +16524,7 @@ ofdpa_oam_drop_status_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16562,7 +16562,7 @@ ofdpa_oam_drop_status_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16602,7 +16602,7 @@ ofdpa_oam_drop_status_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16640,7 +16640,7 @@ ofdpa_oam_drop_status_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16680,7 +16680,7 @@ ofdpa_oam_drop_status_multipart_request_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16718,7 +16718,7 @@ ofdpa_oam_drop_status_multipart_request_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16758,7 +16758,7 @@ ofdpa_oam_drop_status_multipart_request_index_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16796,7 +16796,7 @@ ofdpa_oam_drop_status_multipart_request_index_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16836,7 +16836,7 @@ ofdpa_oam_drop_status_multipart_request_entry_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16874,7 +16874,7 @@ ofdpa_oam_drop_status_multipart_request_entry_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16914,7 +16914,7 @@ ofdpa_oam_drop_status_multipart_request_drop_status_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -16952,7 +16952,7 @@ ofdpa_oam_drop_status_multipart_request_drop_status_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_OAM_DROP_STATUS_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17008,7 +17008,7 @@ static void
 ofdpa_port_experimenter_prop_scheduling_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -17192,7 +17192,7 @@ ofdpa_port_experimenter_prop_scheduling_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17230,7 +17230,7 @@ ofdpa_port_experimenter_prop_scheduling_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17270,7 +17270,7 @@ ofdpa_port_experimenter_prop_scheduling_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17308,7 +17308,7 @@ ofdpa_port_experimenter_prop_scheduling_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17348,7 +17348,7 @@ ofdpa_port_experimenter_prop_scheduling_hw_addr_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17386,7 +17386,7 @@ ofdpa_port_experimenter_prop_scheduling_hw_addr_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17426,7 +17426,7 @@ ofdpa_port_experimenter_prop_scheduling_config_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17464,7 +17464,7 @@ ofdpa_port_experimenter_prop_scheduling_config_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17504,7 +17504,7 @@ ofdpa_port_experimenter_prop_scheduling_mask_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17542,7 +17542,7 @@ ofdpa_port_experimenter_prop_scheduling_mask_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17582,7 +17582,7 @@ ofdpa_port_experimenter_prop_scheduling_pm_type_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17620,7 +17620,7 @@ ofdpa_port_experimenter_prop_scheduling_pm_type_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17660,7 +17660,7 @@ ofdpa_port_experimenter_prop_scheduling_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17698,7 +17698,7 @@ ofdpa_port_experimenter_prop_scheduling_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17738,7 +17738,7 @@ ofdpa_port_experimenter_prop_scheduling_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17776,7 +17776,7 @@ ofdpa_port_experimenter_prop_scheduling_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17816,7 +17816,7 @@ ofdpa_port_experimenter_prop_scheduling_mode_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17854,7 +17854,7 @@ ofdpa_port_experimenter_prop_scheduling_mode_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17894,7 +17894,7 @@ ofdpa_port_experimenter_prop_scheduling_parameter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17932,7 +17932,7 @@ ofdpa_port_experimenter_prop_scheduling_parameter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_PORT_EXPERIMENTER_PROP_SCHEDULING);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -17988,7 +17988,7 @@ static void
 ofdpa_queue_desc_prop_congestion_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -18172,7 +18172,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18210,7 +18210,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18250,7 +18250,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18288,7 +18288,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18328,7 +18328,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18366,7 +18366,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18406,7 +18406,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18444,7 +18444,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18484,7 +18484,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_mode_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18522,7 +18522,7 @@ ofdpa_queue_desc_prop_congestion_multipart_reply_mode_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18578,7 +18578,7 @@ static void
 ofdpa_queue_desc_prop_congestion_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -18762,7 +18762,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18800,7 +18800,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18840,7 +18840,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18878,7 +18878,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18918,7 +18918,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18956,7 +18956,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -18996,7 +18996,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19034,7 +19034,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19074,7 +19074,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_mode_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19112,7 +19112,7 @@ ofdpa_queue_desc_prop_congestion_multipart_request_mode_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_CONGESTION_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19168,7 +19168,7 @@ static void
 ofdpa_queue_desc_prop_parent_multipart_reply_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -19352,7 +19352,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19390,7 +19390,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19430,7 +19430,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19468,7 +19468,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19508,7 +19508,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19546,7 +19546,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19586,7 +19586,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19624,7 +19624,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19664,7 +19664,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_scheduler_level_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19702,7 +19702,7 @@ ofdpa_queue_desc_prop_parent_multipart_reply_scheduler_level_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REPLY);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19758,7 +19758,7 @@ static void
 ofdpa_queue_desc_prop_parent_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -19942,7 +19942,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -19980,7 +19980,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20020,7 +20020,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20058,7 +20058,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20098,7 +20098,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20136,7 +20136,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20176,7 +20176,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20214,7 +20214,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20254,7 +20254,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_scheduler_level_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20292,7 +20292,7 @@ ofdpa_queue_desc_prop_parent_multipart_request_scheduler_level_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_DESC_PROP_PARENT_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20348,7 +20348,7 @@ static void
 ofdpa_queue_mod_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -20531,7 +20531,7 @@ ofdpa_queue_mod_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20569,7 +20569,7 @@ ofdpa_queue_mod_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20609,7 +20609,7 @@ ofdpa_queue_mod_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20647,7 +20647,7 @@ ofdpa_queue_mod_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20687,7 +20687,7 @@ ofdpa_queue_mod_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20725,7 +20725,7 @@ ofdpa_queue_mod_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20765,7 +20765,7 @@ ofdpa_queue_mod_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20803,7 +20803,7 @@ ofdpa_queue_mod_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20843,7 +20843,7 @@ ofdpa_queue_mod_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20881,7 +20881,7 @@ ofdpa_queue_mod_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20921,7 +20921,7 @@ ofdpa_queue_mod_queue_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -20959,7 +20959,7 @@ ofdpa_queue_mod_queue_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_QUEUE_MOD);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21015,7 +21015,7 @@ static void
 ofdpa_scheduler_node_mod_msg_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x4; /* type */
@@ -21198,7 +21198,7 @@ ofdpa_scheduler_node_mod_msg_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21236,7 +21236,7 @@ ofdpa_scheduler_node_mod_msg_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21276,7 +21276,7 @@ ofdpa_scheduler_node_mod_msg_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21314,7 +21314,7 @@ ofdpa_scheduler_node_mod_msg_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21354,7 +21354,7 @@ ofdpa_scheduler_node_mod_msg_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21392,7 +21392,7 @@ ofdpa_scheduler_node_mod_msg_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21432,7 +21432,7 @@ ofdpa_scheduler_node_mod_msg_mod_command_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21470,7 +21470,7 @@ ofdpa_scheduler_node_mod_msg_mod_command_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21510,7 +21510,7 @@ ofdpa_scheduler_node_mod_msg_level_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21548,7 +21548,7 @@ ofdpa_scheduler_node_mod_msg_level_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21588,7 +21588,7 @@ ofdpa_scheduler_node_mod_msg_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21626,7 +21626,7 @@ ofdpa_scheduler_node_mod_msg_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21666,7 +21666,7 @@ ofdpa_scheduler_node_mod_msg_max_rate_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21704,7 +21704,7 @@ ofdpa_scheduler_node_mod_msg_max_rate_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21744,7 +21744,7 @@ ofdpa_scheduler_node_mod_msg_min_rate_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21782,7 +21782,7 @@ ofdpa_scheduler_node_mod_msg_min_rate_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21822,7 +21822,7 @@ ofdpa_scheduler_node_mod_msg_mode_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21860,7 +21860,7 @@ ofdpa_scheduler_node_mod_msg_mode_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21900,7 +21900,7 @@ ofdpa_scheduler_node_mod_msg_weight_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21938,7 +21938,7 @@ ofdpa_scheduler_node_mod_msg_weight_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MOD_MSG);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -21994,7 +21994,7 @@ static void
 ofdpa_scheduler_node_multipart_request_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x12; /* type */
@@ -22178,7 +22178,7 @@ ofdpa_scheduler_node_multipart_request_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22216,7 +22216,7 @@ ofdpa_scheduler_node_multipart_request_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22256,7 +22256,7 @@ ofdpa_scheduler_node_multipart_request_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22294,7 +22294,7 @@ ofdpa_scheduler_node_multipart_request_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22334,7 +22334,7 @@ ofdpa_scheduler_node_multipart_request_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22372,7 +22372,7 @@ ofdpa_scheduler_node_multipart_request_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22412,7 +22412,7 @@ ofdpa_scheduler_node_multipart_request_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22450,7 +22450,7 @@ ofdpa_scheduler_node_multipart_request_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22490,7 +22490,7 @@ ofdpa_scheduler_node_multipart_request_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22528,7 +22528,7 @@ ofdpa_scheduler_node_multipart_request_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22568,7 +22568,7 @@ ofdpa_scheduler_node_multipart_request_level_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22606,7 +22606,7 @@ ofdpa_scheduler_node_multipart_request_level_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22646,7 +22646,7 @@ ofdpa_scheduler_node_multipart_request_max_rate_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22684,7 +22684,7 @@ ofdpa_scheduler_node_multipart_request_max_rate_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22724,7 +22724,7 @@ ofdpa_scheduler_node_multipart_request_min_rate_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22762,7 +22762,7 @@ ofdpa_scheduler_node_multipart_request_min_rate_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22802,7 +22802,7 @@ ofdpa_scheduler_node_multipart_request_mode_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22840,7 +22840,7 @@ ofdpa_scheduler_node_multipart_request_mode_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22880,7 +22880,7 @@ ofdpa_scheduler_node_multipart_request_weight_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22918,7 +22918,7 @@ ofdpa_scheduler_node_multipart_request_weight_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_REQUEST);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -22974,7 +22974,7 @@ static void
 ofdpa_scheduler_node_multipart_response_push_wire_types(of_object_t *obj)
 {
     unsigned char *buf = OF_OBJECT_BUFFER_INDEX(obj, 0);
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_3:
         *(uint8_t *)(buf + 0) = obj->version; /* version */
         *(uint8_t *)(buf + 1) = 0x13; /* type */
@@ -23158,7 +23158,7 @@ ofdpa_scheduler_node_multipart_response_xid_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23196,7 +23196,7 @@ ofdpa_scheduler_node_multipart_response_xid_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23236,7 +23236,7 @@ ofdpa_scheduler_node_multipart_response_flags_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23274,7 +23274,7 @@ ofdpa_scheduler_node_multipart_response_flags_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23314,7 +23314,7 @@ ofdpa_scheduler_node_multipart_response_experimenter_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23352,7 +23352,7 @@ ofdpa_scheduler_node_multipart_response_experimenter_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23392,7 +23392,7 @@ ofdpa_scheduler_node_multipart_response_subtype_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23430,7 +23430,7 @@ ofdpa_scheduler_node_multipart_response_subtype_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23470,7 +23470,7 @@ ofdpa_scheduler_node_multipart_response_port_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23508,7 +23508,7 @@ ofdpa_scheduler_node_multipart_response_port_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23548,7 +23548,7 @@ ofdpa_scheduler_node_multipart_response_level_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23586,7 +23586,7 @@ ofdpa_scheduler_node_multipart_response_level_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23626,7 +23626,7 @@ ofdpa_scheduler_node_multipart_response_max_rate_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23664,7 +23664,7 @@ ofdpa_scheduler_node_multipart_response_max_rate_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23704,7 +23704,7 @@ ofdpa_scheduler_node_multipart_response_min_rate_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23742,7 +23742,7 @@ ofdpa_scheduler_node_multipart_response_min_rate_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23782,7 +23782,7 @@ ofdpa_scheduler_node_multipart_response_mode_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23820,7 +23820,7 @@ ofdpa_scheduler_node_multipart_response_mode_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23860,7 +23860,7 @@ ofdpa_scheduler_node_multipart_response_weight_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -23898,7 +23898,7 @@ ofdpa_scheduler_node_multipart_response_weight_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFDPA_SCHEDULER_NODE_MULTIPART_RESPONSE);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24067,7 +24067,7 @@ ofp_queue_desc_port_no_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFP_QUEUE_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24105,7 +24105,7 @@ ofp_queue_desc_port_no_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFP_QUEUE_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24145,7 +24145,7 @@ ofp_queue_desc_queue_id_get(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFP_QUEUE_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -24183,7 +24183,7 @@ ofp_queue_desc_queue_id_set(
     of_version_t ver;
 
     LOCI_ASSERT(obj->object_id == OFP_QUEUE_DESC);
-    ver = obj->version;
+    ver = LOCI_OBJ_VERSION(obj);
     wbuf = OF_OBJECT_TO_WBUF(obj);
     LOCI_ASSERT(wbuf != NULL);
 
@@ -139,7 +139,7 @@ int
 of_flow_removed_setup_from_flow_add(of_flow_removed_t *obj,
                                     of_flow_add_t *flow_add)
 {
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         return flow_removed_setup_from_flow_add_common(obj, flow_add,
                                                        8, 8);
@@ -208,7 +208,7 @@ of_flow_stats_entry_setup_from_flow_add(of_flow_stats_entry_t *obj,
                                         of_flow_add_t *flow_add,
                                         of_object_t *effects)
 {
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         return flow_stats_entry_setup_from_flow_add_common(obj, flow_add,
                                                            effects, 4, 8);
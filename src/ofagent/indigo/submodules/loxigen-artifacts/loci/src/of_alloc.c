@@ -0,0 +1,245 @@
+/* Copyright (c) 2008 The Board of Trustees of The Leland Stanford Junior University */
+/* Copyright (c) 2011, 2012 Open Networking Foundation */
+/* Copyright (c) 2012, 2013 Big Switch Networks, Inc. */
+/* See the file LICENSE.loci which should have been included in the source distribution */
+
+/****************************************************************
+ *
+ * of_alloc.c
+ *
+ * Size class freelists for LOCI objects and wire buffers
+ *
+ ****************************************************************/
+
+#include <stdlib.h>
+#include <loci/loci.h>
+#include <loci/of_alloc.h>
+
+/* Keep every block suitably aligned for any member type */
+#define OF_ALLOC_ALIGN 16
+#define OF_ALLOC_ROUND(bytes) \
+    (((bytes) + OF_ALLOC_ALIGN - 1) & ~(OF_ALLOC_ALIGN - 1))
+
+/* Wire buffer data classes are the powers of two from MIN to MAX */
+#define OF_ALLOC_BUF_CLASS_COUNT 10
+
+enum {
+    OF_ALLOC_POOL_OBJECT,
+    OF_ALLOC_POOL_WBUF,
+    OF_ALLOC_POOL_BUF_FIRST,
+    OF_ALLOC_POOL_COUNT = OF_ALLOC_POOL_BUF_FIRST + OF_ALLOC_BUF_CLASS_COUNT
+};
+
+/* A freed block holds the link to the next free block */
+typedef struct of_alloc_block_s {
+    struct of_alloc_block_s *next;
+} of_alloc_block_t;
+
+typedef struct of_alloc_pool_s {
+    const char *name;
+    int size;                   /* Block size */
+    uint8_t *arena;             /* Reserved on first allocation */
+    uint8_t *arena_end;
+    uint32_t carved;            /* Blocks ever handed out of the arena */
+    of_alloc_block_t *free_head;
+    of_alloc_stats_t stats;
+} of_alloc_pool_t;
+
+static of_alloc_pool_t of_alloc_pools[OF_ALLOC_POOL_COUNT] = {
+    [OF_ALLOC_POOL_OBJECT] = { "object", OF_ALLOC_ROUND(sizeof(of_object_t)) },
+    [OF_ALLOC_POOL_WBUF] = { "wbuf", OF_ALLOC_ROUND(sizeof(of_wire_buffer_t)) },
+    [OF_ALLOC_POOL_BUF_FIRST + 0] = { "buf128", 128 },
+    [OF_ALLOC_POOL_BUF_FIRST + 1] = { "buf256", 256 },
+    [OF_ALLOC_POOL_BUF_FIRST + 2] = { "buf512", 512 },
+    [OF_ALLOC_POOL_BUF_FIRST + 3] = { "buf1k", 1024 },
+    [OF_ALLOC_POOL_BUF_FIRST + 4] = { "buf2k", 2048 },
+    [OF_ALLOC_POOL_BUF_FIRST + 5] = { "buf4k", 4096 },
+    [OF_ALLOC_POOL_BUF_FIRST + 6] = { "buf8k", 8192 },
+    [OF_ALLOC_POOL_BUF_FIRST + 7] = { "buf16k", 16384 },
+    [OF_ALLOC_POOL_BUF_FIRST + 8] = { "buf32k", 32768 },
+    [OF_ALLOC_POOL_BUF_FIRST + 9] = { "buf64k", OF_ALLOC_BUF_MAX_BYTES },
+};
+
+static int of_alloc_enabled;
+
+/* Bounds of all arenas, to reject non-arena pointers quickly */
+static uint8_t *of_alloc_lo;
+static uint8_t *of_alloc_hi;
+
+void
+of_alloc_enable_set(int enable)
+{
+    of_alloc_enabled = enable;
+}
+
+int
+of_alloc_enable_get(void)
+{
+    return of_alloc_enabled;
+}
+
+/*
+ * Reserve the arena for a pool.  Pages are only touched as blocks are
+ * carved, so an arena costs little until its class is busy.
+ */
+static void
+of_alloc_arena_reserve(of_alloc_pool_t *pool)
+{
+    uint32_t blocks = OF_ALLOC_ARENA_BYTES / pool->size;
+
+    if (blocks < OF_ALLOC_ARENA_MIN_BLOCKS) {
+        blocks = OF_ALLOC_ARENA_MIN_BLOCKS;
+    }
+
+    if ((pool->arena = (uint8_t *)malloc((size_t)blocks * pool->size)) == NULL) {
+        return;
+    }
+
+    pool->arena_end = pool->arena + (size_t)blocks * pool->size;
+    pool->stats.capacity = blocks;
+
+    if (of_alloc_lo == NULL || pool->arena < of_alloc_lo) {
+        of_alloc_lo = pool->arena;
+    }
+    if (pool->arena_end > of_alloc_hi) {
+        of_alloc_hi = pool->arena_end;
+    }
+}
+
+static void *
+of_alloc_pool_get(of_alloc_pool_t *pool)
+{
+    of_alloc_block_t *block;
+
+    if (!of_alloc_enabled) {
+        return malloc(pool->size);
+    }
+
+    if ((block = pool->free_head) != NULL) {
+        pool->free_head = block->next;
+        pool->stats.free_count--;
+    } else {
+        if (pool->arena == NULL) {
+            of_alloc_arena_reserve(pool);
+        }
+        if (pool->carved == pool->stats.capacity) {
+            pool->stats.misses++;
+            return malloc(pool->size);
+        }
+        block = (of_alloc_block_t *)(pool->arena +
+                                     (size_t)pool->carved * pool->size);
+        pool->carved++;
+    }
+
+    pool->stats.hits++;
+    pool->stats.in_use++;
+
+    return block;
+}
+
+void *
+of_alloc_object(void)
+{
+    return of_alloc_pool_get(&of_alloc_pools[OF_ALLOC_POOL_OBJECT]);
+}
+
+void *
+of_alloc_wbuf(void)
+{
+    return of_alloc_pool_get(&of_alloc_pools[OF_ALLOC_POOL_WBUF]);
+}
+
+uint8_t *
+of_alloc_buf(int *bytes)
+{
+    of_alloc_pool_t *pool;
+    int idx;
+
+    if (!of_alloc_enabled || *bytes > OF_ALLOC_BUF_MAX_BYTES) {
+        return (uint8_t *)malloc(*bytes);
+    }
+
+    for (idx = OF_ALLOC_POOL_BUF_FIRST; idx < OF_ALLOC_POOL_COUNT; idx++) {
+        if (of_alloc_pools[idx].size >= *bytes) {
+            break;
+        }
+    }
+
+    pool = &of_alloc_pools[idx];
+    *bytes = pool->size;
+
+    return (uint8_t *)of_alloc_pool_get(pool);
+}
+
+void
+of_alloc_free(void *ptr)
+{
+    of_alloc_pool_t *pool;
+    of_alloc_block_t *block = (of_alloc_block_t *)ptr;
+    int idx;
+
+    if ((uint8_t *)ptr < of_alloc_lo || (uint8_t *)ptr >= of_alloc_hi) {
+        free(ptr);
+        return;
+    }
+
+    for (idx = 0; idx < OF_ALLOC_POOL_COUNT; idx++) {
+        pool = &of_alloc_pools[idx];
+        if ((uint8_t *)ptr >= pool->arena && (uint8_t *)ptr < pool->arena_end) {
+            LOCI_ASSERT(pool->stats.in_use > 0);
+            block->next = pool->free_head;
+            pool->free_head = block;
+            pool->stats.free_count++;
+            pool->stats.in_use--;
+            pool->stats.frees++;
+            return;
+        }
+    }
+
+    /* Between two arenas */
+    free(ptr);
+}
+
+void
+of_alloc_stats_get(of_alloc_stats_t *stats)
+{
+    int idx;
+
+    MEMSET(stats, 0, sizeof(*stats));
+
+    for (idx = 0; idx < OF_ALLOC_POOL_COUNT; idx++) {
+        const of_alloc_stats_t *pool_stats = &of_alloc_pools[idx].stats;
+        stats->hits += pool_stats->hits;
+        stats->misses += pool_stats->misses;
+        stats->frees += pool_stats->frees;
+        stats->in_use += pool_stats->in_use;
+        stats->free_count += pool_stats->free_count;
+        stats->capacity += pool_stats->capacity;
+    }
+}
+
+int
+of_alloc_stats_dump(loci_writer_f writer, void *cookie)
+{
+    int out = 0;
+    int idx;
+
+    out += writer(cookie, "LOCI allocator %s\n",
+                  of_alloc_enabled ? "enabled" : "disabled");
+    out += writer(cookie, "%-8s %6s %12s %12s %12s %8s %8s %8s\n",
+                  "class", "size", "hits", "misses", "frees",
+                  "in_use", "free", "capacity");
+
+    for (idx = 0; idx < OF_ALLOC_POOL_COUNT; idx++) {
+        const of_alloc_pool_t *pool = &of_alloc_pools[idx];
+        out += writer(cookie,
+                      "%-8s %6d %12" PRIu64 " %12" PRIu64 " %12" PRIu64
+                      " %8u %8u %8u\n",
+                      pool->name, pool->size, pool->stats.hits,
+                      pool->stats.misses, pool->stats.frees,
+                      pool->stats.in_use, pool->stats.free_count,
+                      pool->stats.capacity);
+    }
+
+    return out;
+}
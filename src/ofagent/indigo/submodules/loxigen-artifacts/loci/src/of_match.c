@@ -3131,3 +3131,119 @@ of_match_deserialize(of_version_t version, of_match_t *match,
 
     return OF_ERROR_NONE;
 }
+
+/**
+ * Walk the OXM TLVs of a serialized OF 1.2+ match without decoding them
+ * @param octets The serialized match: type, length, OXM list and padding
+ * @param visitor Called once per OXM TLV, in wire order
+ * @param cookie Passed through to the visitor
+ *
+ * Nothing is copied; the visitor sees pointers into octets->data.  This
+ * is the cheap alternative to of_match_deserialize for callers that only
+ * need some of the fields.  A nonzero return from the visitor ends the
+ * walk and is returned.
+ */
+
+int
+of_match_v3_oxm_visit(of_octets_t *octets, of_oxm_visitor_f visitor,
+                      void *cookie)
+{
+    const uint8_t *buf = octets->data;
+    of_oxm_tlv_t tlv;
+    int match_len;
+    int offset = 4;
+    int payload_len;
+    int rv;
+
+    if (octets->bytes == 0) { /* No match specified means all wildcards */
+        return OF_ERROR_NONE;
+    }
+
+    if (octets->bytes < 4) {
+        return OF_ERROR_PARSE;
+    }
+
+    /* Length covers the match header and OXMs but not the padding */
+    match_len = (buf[2] << 8) | buf[3];
+    if (match_len < 4 || match_len > octets->bytes) {
+        return OF_ERROR_PARSE;
+    }
+
+    while (offset < match_len) {
+        if (offset + 4 > match_len) {
+            return OF_ERROR_PARSE;
+        }
+
+        tlv.type_len = ((uint32_t)buf[offset] << 24) |
+            ((uint32_t)buf[offset + 1] << 16) |
+            ((uint32_t)buf[offset + 2] << 8) | buf[offset + 3];
+        payload_len = tlv.type_len & 0xff;
+        if (offset + 4 + payload_len > match_len) {
+            return OF_ERROR_PARSE;
+        }
+
+        tlv.value = buf + offset + 4;
+        tlv.experimenter = 0;
+        if (OF_OXM_TLV_CLASS(&tlv) == OF_OXM_CLASS_EXPERIMENTER) {
+            if (payload_len < 4) {
+                return OF_ERROR_PARSE;
+            }
+            tlv.experimenter = ((uint32_t)tlv.value[0] << 24) |
+                ((uint32_t)tlv.value[1] << 16) |
+                ((uint32_t)tlv.value[2] << 8) | tlv.value[3];
+            tlv.value += 4;
+            payload_len -= 4;
+        }
+
+        if (tlv.type_len & 0x100) { /* has-mask bit */
+            tlv.value_len = payload_len / 2;
+            tlv.mask = tlv.value + tlv.value_len;
+        } else {
+            tlv.value_len = payload_len;
+            tlv.mask = NULL;
+        }
+
+        if ((rv = visitor(cookie, &tlv)) != 0) {
+            return rv;
+        }
+
+        offset += 4 + (tlv.type_len & 0xff);
+    }
+
+    return OF_ERROR_NONE;
+}
+
+/**
+ * Walk the OXM TLVs of the match in a flow_mod family message
+ * @param obj Pointer to an of_flow_add, of_flow_modify, etc. object
+ * @param visitor Called once per OXM TLV, in wire order
+ * @param cookie Passed through to the visitor
+ *
+ * Zero-copy counterpart of of_flow_add_match_get; only OF 1.2 and
+ * later matches are OXM based.
+ */
+
+int
+of_flow_mod_match_oxm_visit(of_object_t *obj, of_oxm_visitor_f visitor,
+                            void *cookie)
+{
+    of_octets_t match_octets;
+    const int offset = 48; /* Fixed flow_mod fields precede the match */
+
+    switch (LOCI_OBJ_VERSION(obj)) {
+    case OF_VERSION_1_2:
+    case OF_VERSION_1_3:
+        break;
+    default:
+        return OF_ERROR_VERSION;
+    }
+
+    if (obj->length < offset + 4) {
+        return OF_ERROR_PARSE;
+    }
+
+    match_octets.data = OF_OBJECT_BUFFER_INDEX(obj, offset);
+    match_octets.bytes = obj->length - offset;
+
+    return of_match_v3_oxm_visit(&match_octets, visitor, cookie);
+}
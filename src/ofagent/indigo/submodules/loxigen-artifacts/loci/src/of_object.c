@@ -31,7 +31,7 @@ of_object_new(int bytes)
 {
     of_object_t *obj;
 
-    if ((obj = (of_object_t *)MALLOC(sizeof(*obj))) == NULL) {
+    if ((obj = (of_object_t *)of_alloc_object()) == NULL) {
         return NULL;
     }
     MEMSET(obj, 0, sizeof(*obj));
@@ -90,7 +90,7 @@ of_object_dup(of_object_t *src)
     of_object_t *dst;
     of_object_init_f init_fn;
 
-    if ((dst = (of_object_t *)MALLOC(sizeof(*dst))) == NULL) {
+    if ((dst = (of_object_t *)of_alloc_object()) == NULL) {
         return NULL;
     }
 
@@ -198,6 +198,115 @@ of_object_new_from_message_preallocated(of_object_storage_t *storage,
     return obj;
 }
 
+/**
+ * Check that the variable part of a message fits in its length
+ *
+ * Only the message types of_object_new_from_message_preallocated_light
+ * accepts are understood; anything else fails.
+ */
+
+static int
+message_extent_check(of_message_t msg, of_version_t version, int len)
+{
+    uint16_t actions_len, match_len;
+    uint8_t type = of_message_type_get(msg);
+
+    if (type == OF_OBJ_TYPE_BARRIER_REQUEST_BY_VERSION(version)) {
+        return len == OF_MESSAGE_HEADER_LENGTH ? 0 : -1;
+    }
+
+    if (type == OF_OBJ_TYPE_PACKET_OUT) {
+        if (version == OF_VERSION_1_0) {
+            if (len < 16) {
+                return -1;
+            }
+            buf_u16_get(msg + 14, &actions_len);
+            return 16 + actions_len <= len ? 0 : -1;
+        }
+        if (len < 24) {
+            return -1;
+        }
+        buf_u16_get(msg + 16, &actions_len);
+        return 24 + actions_len <= len ? 0 : -1;
+    }
+
+    if (type == OF_OBJ_TYPE_FLOW_MOD) {
+        if (version < OF_VERSION_1_2) {
+            /* Fixed size match; covered by the fixed length check */
+            return 0;
+        }
+        if (len < 52) {
+            return -1;
+        }
+        buf_u16_get(msg + 50, &match_len);
+        if (match_len < 4) {
+            return -1;
+        }
+        return 48 + ((match_len + 7) & ~7) <= len ? 0 : -1;
+    }
+
+    return -1;
+}
+
+/**
+ * Parse a message without allocating memory or running the validator
+ *
+ * @param storage Pointer to an uninitialized of_object_storage_t
+ * @param buf Pointer to the buffer
+ * @param length Length of buf
+ * @returns Pointer to an initialized of_object_t, or NULL
+ *
+ * For flow_mod, packet_out and barrier_request, checks just the header,
+ * the fixed length and that the match or action list fits in the
+ * message.  Lists within are left to the accessors, so use this only for
+ * messages from a trusted source.  Returns NULL for any other type or a
+ * failed check; the caller should fall back to
+ * of_object_new_from_message_preallocated, which validates fully.
+ */
+
+of_object_t *
+of_object_new_from_message_preallocated_light(of_object_storage_t *storage,
+                                              uint8_t *buf, int len)
+{
+    of_object_t *obj = &storage->obj;
+    of_wire_buffer_t *wbuf = &storage->wbuf;
+    of_message_t msg = buf;
+    of_version_t version;
+    of_object_id_t object_id;
+
+    if (len < OF_MESSAGE_HEADER_LENGTH ||
+        of_message_length_get(msg) != len) {
+        return NULL;
+    }
+
+    version = of_message_version_get(msg);
+    if (!OF_VERSION_OKAY(version)) {
+        return NULL;
+    }
+
+    if (message_extent_check(msg, version, len) < 0) {
+        return NULL;
+    }
+
+    memset(storage, 0, sizeof(*storage));
+
+    obj->version = version;
+    obj->wire_object.wbuf = wbuf;
+    wbuf->buf = msg;
+    wbuf->alloc_bytes = len;
+    wbuf->current_bytes = len;
+
+    of_header_wire_object_id_get(obj, &object_id);
+    if (object_id < 0 || object_id >= OF_OBJECT_COUNT ||
+        len < of_object_fixed_len[version][object_id]) {
+        return NULL;
+    }
+
+    of_object_init_map[object_id](obj, version, len, 0);
+
+    return obj;
+}
+
 /**
  * Bind an existing buffer to an LOCI object
  *
@@ -442,6 +551,52 @@ of_list_append(of_object_t *list, of_object_t *item)
     return OF_ERROR_NONE;
 }
 
+/**
+ * Start building a list
+ * @param builder The builder state
+ * @param list The list; must be at the end of its wire buffer
+ *
+ * Detaches the list from its parent until of_list_builder_finish.
+ */
+void
+of_list_builder_start(of_list_builder_t *builder, of_object_t *list)
+{
+    LOCI_ASSERT(OF_OBJECT_ABSOLUTE_OFFSET(list, list->length) ==
+                WBUF_CURRENT_BYTES(list->wire_object.wbuf));
+
+    builder->list = list;
+    builder->parent = list->parent;
+    builder->start_length = list->length;
+    list->parent = NULL;
+}
+
+/**
+ * Finish building a list
+ * @param builder The builder state
+ *
+ * Reattaches the list and updates its parents for everything appended
+ * since of_list_builder_start. May be called more than once.
+ */
+void
+of_list_builder_finish(of_list_builder_t *builder)
+{
+    of_object_t *list = builder->list;
+    int delta;
+
+    if (list == NULL) {
+        return;
+    }
+
+    list->parent = builder->parent;
+    delta = list->length - builder->start_length;
+    if (delta > 0 && list->parent != NULL) {
+        of_object_parent_length_update(list->parent, delta);
+    }
+
+    builder->list = NULL;
+    builder->parent = NULL;
+}
+
 /**
  * Generic list first function
  * @param parent The parent; must be a list object
@@ -29,7 +29,7 @@ wire_buf_v1_to_match(of_wire_buffer_t *wbuf, int offset)
 int
 of_wire_buffer_of_match_get(of_object_t *obj, int offset, of_match_t *match)
 {
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         break;
     case OF_VERSION_1_1:
@@ -62,7 +62,7 @@ of_wire_buffer_of_match_set(of_object_t *obj, int offset,
 {
     // of_octets_t octets;
 
-    switch (obj->version) {
+    switch (LOCI_OBJ_VERSION(obj)) {
     case OF_VERSION_1_0:
         break;
     case OF_VERSION_1_1:
@@ -11,6 +11,7 @@
 
 #include <locitest/test_common.h>
 #include <loci/of_utils.h>
+#include <loci/of_alloc.h>
 
 /**
  * Test has output port utility function
@@ -138,6 +139,107 @@ test_of_object_new_from_message_preallocated(void)
     return TEST_PASS;
 }
 
+/**
+ * Objects and buffers deleted with pooling enabled are reused
+ */
+static int
+test_of_alloc_reuse(void)
+{
+    of_alloc_stats_t before, after;
+    of_echo_request_t *obj;
+    of_object_t *first;
+    uint8_t *data;
+    int i;
+
+    of_alloc_enable_set(1);
+    of_alloc_stats_get(&before);
+
+    for (i = 0; i < 10; i++) {
+        obj = of_echo_request_new(OF_VERSION_1_3);
+        TEST_ASSERT(obj != NULL);
+        TEST_ASSERT(OF_OBJECT_TO_WBUF(obj)->alloc_bytes >= OF_WIRE_BUFFER_MAX_LENGTH);
+        if (i == 0) {
+            first = obj;
+        } else {
+            TEST_ASSERT(obj == first);
+        }
+        of_echo_request_delete(obj);
+    }
+
+    /* A stolen buffer goes back to its pool too */
+    obj = of_echo_request_new(OF_VERSION_1_3);
+    TEST_ASSERT(obj != NULL);
+    of_object_wire_buffer_steal(obj, &data);
+    of_echo_request_delete(obj);
+    of_alloc_free(data);
+
+    of_alloc_stats_get(&after);
+    of_alloc_enable_set(0);
+
+    /* Object, wire buffer and data per allocation */
+    TEST_ASSERT(after.hits - before.hits == 33);
+    TEST_ASSERT(after.frees - before.frees == 33);
+    TEST_ASSERT(after.in_use == before.in_use);
+
+    return TEST_PASS;
+}
+
+/**
+ * A list built with a list builder ends up as if appended to directly
+ */
+static int
+test_of_list_builder(void)
+{
+    of_flow_stats_reply_t *reply;
+    of_list_flow_stats_entry_t entries;
+    of_flow_stats_entry_t entry;
+    of_list_builder_t builder;
+    of_match_t match;
+    int start_length;
+    int i, rv;
+
+    reply = of_flow_stats_reply_new(OF_VERSION_1_3);
+    TEST_ASSERT(reply != NULL);
+    start_length = reply->length;
+
+    of_flow_stats_reply_entries_bind(reply, &entries);
+    of_list_builder_start(&builder, &entries);
+    TEST_ASSERT(entries.parent == NULL);
+
+    MEMSET(&match, 0, sizeof(match));
+    match.version = OF_VERSION_1_3;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+    for (i = 0; i < 10; i++) {
+        match.fields.in_port = i;
+        of_flow_stats_entry_init(&entry, OF_VERSION_1_3, -1, 1);
+        TEST_OK(of_list_flow_stats_entry_append_bind(&entries, &entry));
+        TEST_OK(of_flow_stats_entry_match_set(&entry, &match));
+        of_flow_stats_entry_priority_set(&entry, i);
+    }
+
+    /* The reply is only fixed up at the finish */
+    TEST_ASSERT(reply->length == start_length);
+    of_list_builder_finish(&builder);
+    TEST_ASSERT(entries.parent == reply);
+    TEST_ASSERT(reply->length == start_length + entries.length);
+    TEST_ASSERT(reply->length == WBUF_CURRENT_BYTES(OF_OBJECT_TO_WBUF(reply)));
+
+    /* Entries read back from the wire */
+    of_flow_stats_reply_entries_bind(reply, &entries);
+    i = 0;
+    OF_LIST_FLOW_STATS_ENTRY_ITER(&entries, &entry, rv) {
+        uint16_t priority;
+        of_flow_stats_entry_priority_get(&entry, &priority);
+        TEST_ASSERT(priority == i);
+        i++;
+    }
+    TEST_ASSERT(i == 10);
+
+    of_flow_stats_reply_delete(reply);
+
+    return TEST_PASS;
+}
+
 int
 run_utility_tests(void)
 {
@@ -145,6 +247,8 @@ run_utility_tests(void)
     RUN_TEST(of_object_new_from_message);
     RUN_TEST(of_object_new_from_message_preallocated);
     RUN_TEST(dump_objs);
+    RUN_TEST(of_alloc_reuse);
+    RUN_TEST(of_list_builder);
 
     return TEST_PASS;
 }
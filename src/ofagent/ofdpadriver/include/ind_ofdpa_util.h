@@ -31,8 +31,12 @@
 **********************************************************************/
 #include <linux/if_ether.h>
 #include "indigo/error.h"
+#include "indigo/log.h"
+#include "indigo/thread.h"
+#include "indigo/types.h"
 #include "loci/of_match.h"
 #include "loci/loci.h"
+#include <AIM/aim_pvs.h>
 #include "ofdpa_api.h"
 
 #define IND_OFDPA_IP_DSCP_MASK     0xfc
@@ -44,10 +48,18 @@
 
 #define IND_OFDPA_NANO_SEC 1000000000
 
+/* Build the "ofdpa" ucli node; the build must also link the uCli module */
+#ifndef IND_OFDPA_CONFIG_INCLUDE_UCLI
+#define IND_OFDPA_CONFIG_INCLUDE_UCLI 0
+#endif
+
 typedef struct indPacketOutActions_s
 {
   uint32_t outputPort;
   uint32_t pipeline;
+  uint32_t flood;       /* Output to FLOOD or ALL */
+  uint32_t group;       /* Output to groupId */
+  uint32_t groupId;
 } indPacketOutActions_t;
 
 indigo_error_t indigoConvertOfdpaRv(OFDPA_ERROR_t result);
@@ -58,6 +70,7 @@ indigo_error_t indigoConvertOfdpaRv(OFDPA_ERROR_t result);
 #define LOG_INFO AIM_LOG_INFO
 #define LOG_VERBOSE AIM_LOG_VERBOSE
 #define LOG_TRACE AIM_LOG_TRACE
+#define LOG_ERROR_RL(...) INDIGO_LOG_RL(AIM_LOG_ERROR, __VA_ARGS__)
 
 typedef struct ind_ofdpa_group_bucket_s
 {
@@ -335,5 +348,460 @@ typedef unsigned long long ind_ofdpa_fields_t;
 indigo_error_t indigoConvertOfdpaRv(OFDPA_ERROR_t result);
 
 void ind_ofdpa_port_event_receive(void);
+
+/* Coalesce port events into one port_status per port per window */
+void ind_ofdpa_port_status_window_set(int window_ms);
+void ind_ofdpa_port_status_show(aim_pvs_t *pvs);
 void ind_ofdpa_flow_event_receive(void);
 void ind_ofdpa_pkt_receive(void);
+int ind_ofdpa_pkt_receive_init(uint32_t *max_pkt_size);
+int ind_ofdpa_pkt_deliver(uint8_t *buf, ofdpaPacket_t *rxPkt);
+
+/* Optional thread receiving packets in place of the main loop */
+indigo_error_t ind_ofdpa_rx_thread_start(int cpu);
+void ind_ofdpa_rx_thread_stop(void);
+void ind_ofdpa_rx_thread_show(aim_pvs_t *pvs);
+
+/* Ring of the most recently punted packets, for debugging */
+void ind_ofdpa_pkt_capture_enable_set(int enable);
+int ind_ofdpa_pkt_capture_enable_get(void);
+void ind_ofdpa_pkt_capture_clear(void);
+void ind_ofdpa_pkt_capture_show(aim_pvs_t *pvs, int show_data);
+
+#if IND_OFDPA_CONFIG_INCLUDE_UCLI == 1
+#include <uCli/ucli.h>
+
+/* The "ofdpa" debug command node, for the application's ucli */
+ucli_node_t *ind_ofdpa_ucli_node_create(void);
+#endif
+
+/* Optional packet-in buffers, so packet-ins carry a buffer_id and miss_send_len bytes */
+indigo_error_t ind_ofdpa_pktbuf_config(uint32_t count, int timeout_ms);
+int ind_ofdpa_pktbuf_enabled(void);
+uint32_t ind_ofdpa_pktbuf_store(uint32_t in_port, const uint8_t *data, uint32_t len);
+int ind_ofdpa_pktbuf_take(uint32_t buffer_id, uint8_t **data, uint32_t *len, uint32_t *in_port);
+void ind_ofdpa_pktbuf_show(aim_pvs_t *pvs);
+
+/* Optional tap writing punted and injected frames to pcap files */
+typedef enum
+{
+  IND_OFDPA_PCAP_DIR_PKTIN,
+  IND_OFDPA_PCAP_DIR_PKTOUT,
+  IND_OFDPA_PCAP_DIR_COUNT
+} ind_ofdpa_pcap_dir_t;
+
+extern int ind_ofdpa_pcap_enabled;
+
+#define IND_OFDPA_PCAP_TAP(_dir, _data, _len)      \
+  do                                               \
+  {                                                \
+    if (ind_ofdpa_pcap_enabled)                    \
+    {                                              \
+      ind_ofdpa_pcap_tap((_dir), (_data), (_len)); \
+    }                                              \
+  } while (0)
+
+indigo_error_t ind_ofdpa_pcap_start(const char *prefix, uint32_t snaplen, const char *filter);
+void ind_ofdpa_pcap_stop(void);
+void ind_ofdpa_pcap_tap(ind_ofdpa_pcap_dir_t dir, const uint8_t *data, uint32_t len);
+void ind_ofdpa_pcap_show(aim_pvs_t *pvs);
+
+/* Cache of translated group bucket action lists */
+typedef struct ind_ofdpa_bucket_cache_stats_s
+{
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t bypass;    /* Action lists too long to cache */
+} ind_ofdpa_bucket_cache_stats_t;
+
+void ind_ofdpa_bucket_cache_stats_get(ind_ofdpa_bucket_cache_stats_t *stats);
+void ind_ofdpa_bucket_cache_clear(void);
+
+/* Translation to OF-DPA entries alone, without touching the hardware */
+indigo_error_t ind_ofdpa_flow_translate(of_flow_add_t *flow_add,
+                                        ofdpaFlowEntry_t *flow);
+indigo_error_t ind_ofdpa_group_bucket_entries_build(uint32_t group_id,
+                                                    of_list_bucket_t *of_buckets,
+                                                    ofdpaGroupBucketEntry_t **entries_out,
+                                                    int *count_out);
+
+/* Optional local bucket switching of MPLS fast failover groups on link down */
+indigo_error_t ind_ofdpa_ff_assist_start(void);
+void ind_ofdpa_ff_assist_stop(void);
+void ind_ofdpa_ff_assist_show(aim_pvs_t *pvs);
+void ind_ofdpa_ff_port_state(uint32_t port, int up);
+
+/* Optional fixed size bucket tables for L3 ECMP groups, 0 for off */
+indigo_error_t ind_ofdpa_resilient_ecmp_set(int size);
+void ind_ofdpa_resilient_ecmp_show(aim_pvs_t *pvs);
+
+/*
+ * OF-DPA API call statistics. Driver calls into OF-DPA go through
+ * IND_OFDPA_RPC(api, args...), which evaluates to the OFDPA_ERROR_t the
+ * API returned. While enabled, each call is counted with its latency and
+ * its error, if any. Failures other than not found always go to the
+ * connection manager's flight recorder. ofdpaPktReceive is left out as it
+ * blocks on its timeout. Once enabled, the call counts are also the
+ * ofdpa.rpc.<api> debug counters.
+ */
+#define IND_OFDPA_RPC_APIS(X) \
+  X(ofdpaDropStatusAdd) \
+  X(ofdpaDropStatusDelete) \
+  X(ofdpaDropStatusGet) \
+  X(ofdpaFlowAdd) \
+  X(ofdpaFlowByCookieDelete) \
+  X(ofdpaFlowByCookieGet) \
+  X(ofdpaFlowDelete) \
+  X(ofdpaFlowEntryInit) \
+  X(ofdpaFlowEventNextGet) \
+  X(ofdpaFlowModify) \
+  X(ofdpaFlowNextGet) \
+  X(ofdpaFlowStatsGet) \
+  X(ofdpaFlowTableInfoGet) \
+  X(ofdpaFlowTableSupported) \
+  X(ofdpaGroupAdd) \
+  X(ofdpaGroupBucketEntryAdd) \
+  X(ofdpaGroupBucketEntryDelete) \
+  X(ofdpaGroupBucketEntryFirstGet) \
+  X(ofdpaGroupBucketEntryModify) \
+  X(ofdpaGroupBucketEntryNextGet) \
+  X(ofdpaGroupBucketsDeleteAll) \
+  X(ofdpaGroupDelete) \
+  X(ofdpaGroupMplsSubTypeGet) \
+  X(ofdpaGroupNextGet) \
+  X(ofdpaGroupStatsGet) \
+  X(ofdpaGroupTableTotalEntryCountGet) \
+  X(ofdpaGroupTypeGet) \
+  X(ofdpaMaxPktSizeGet) \
+  X(ofdpaMeterAdd) \
+  X(ofdpaMeterDelete) \
+  X(ofdpaMeterNextGet) \
+  X(ofdpaMeterStatsGet) \
+  X(ofdpaMplsQosActionAdd) \
+  X(ofdpaMplsQosActionDelete) \
+  X(ofdpaMplsQosActionEntryGet) \
+  X(ofdpaNumQueuesGet) \
+  X(ofdpaOamDataCounterAdd) \
+  X(ofdpaOamDataCounterDelete) \
+  X(ofdpaOamDataCountersLMGet) \
+  X(ofdpaOamEventNextGet) \
+  X(ofdpaOamMepGet) \
+  X(ofdpaOamMepNextGet) \
+  X(ofdpaOamProDmCountersGet) \
+  X(ofdpaOamProLmCountersGet) \
+  X(ofdpaPktSend) \
+  X(ofdpaPortAdvertiseFeatureSet) \
+  X(ofdpaPortConfigGet) \
+  X(ofdpaPortConfigSet) \
+  X(ofdpaPortCurrSpeedGet) \
+  X(ofdpaPortEventNextGet) \
+  X(ofdpaPortFeatureGet) \
+  X(ofdpaPortMacGet) \
+  X(ofdpaPortMaxSpeedGet) \
+  X(ofdpaPortNameGet) \
+  X(ofdpaPortNextGet) \
+  X(ofdpaPortStateGet) \
+  X(ofdpaPortStatsGet) \
+  X(ofdpaQueueRateGet) \
+  X(ofdpaQueueRateSet) \
+  X(ofdpaQueueStatsGet) \
+  X(ofdpaRemarkActionAdd) \
+  X(ofdpaRemarkActionDelete) \
+  X(ofdpaRemarkActionEntryGet) \
+  X(ofdpaSourceMacLearningSet) \
+  X(ofdpaTunnelEcmpNextHopGroupCreate) \
+  X(ofdpaTunnelEcmpNextHopGroupDelete) \
+  X(ofdpaTunnelEcmpNextHopGroupGet) \
+  X(ofdpaTunnelEcmpNextHopGroupMaxMembersGet) \
+  X(ofdpaTunnelEcmpNextHopGroupMemberAdd) \
+  X(ofdpaTunnelEcmpNextHopGroupMemberDelete) \
+  X(ofdpaTunnelEcmpNextHopGroupMemberGet) \
+  X(ofdpaTunnelEcmpNextHopGroupMemberNextGet) \
+  X(ofdpaTunnelEcmpNextHopGroupNextGet) \
+  X(ofdpaTunnelNextHopCreate) \
+  X(ofdpaTunnelNextHopDelete) \
+  X(ofdpaTunnelNextHopGet) \
+  X(ofdpaTunnelNextHopModify) \
+  X(ofdpaTunnelNextHopNextGet) \
+  X(ofdpaTunnelPortCreate) \
+  X(ofdpaTunnelPortDelete) \
+  X(ofdpaTunnelPortGet) \
+  X(ofdpaTunnelPortNextGet) \
+  X(ofdpaTunnelPortTenantAdd) \
+  X(ofdpaTunnelPortTenantDelete) \
+  X(ofdpaTunnelPortTenantGet) \
+  X(ofdpaTunnelPortTenantNextGet) \
+  X(ofdpaTunnelTenantCreate) \
+  X(ofdpaTunnelTenantDelete) \
+  X(ofdpaTunnelTenantGet) \
+  X(ofdpaTunnelTenantNextGet)
+
+#define IND_OFDPA_RPC_ENUM(_api) IND_OFDPA_RPC_##_api,
+typedef enum ind_ofdpa_rpc_e
+{
+  IND_OFDPA_RPC_APIS(IND_OFDPA_RPC_ENUM)
+  IND_OFDPA_RPC_COUNT
+} ind_ofdpa_rpc_t;
+#undef IND_OFDPA_RPC_ENUM
+
+typedef struct ind_ofdpa_rpc_stats_s
+{
+  uint64_t calls;
+  uint64_t errors;          /* Any result other than OFDPA_E_NONE */
+  uint64_t not_found;       /* Of errors, those mapping to INDIGO_ERROR_NOT_FOUND */
+  uint64_t total_ns;
+  uint64_t max_ns;
+  indigo_error_t last_error;
+} ind_ofdpa_rpc_stats_t;
+
+extern int ind_ofdpa_rpc_stats_enabled;
+
+uint64_t ind_ofdpa_rpc_now_ns(void);
+void ind_ofdpa_rpc_record(ind_ofdpa_rpc_t api, uint64_t start_ns, OFDPA_ERROR_t rv);
+void ind_ofdpa_rpc_error(ind_ofdpa_rpc_t api, OFDPA_ERROR_t rv);
+
+#define IND_OFDPA_RPC(_api, ...)                                        \
+  ({                                                                    \
+    OFDPA_ERROR_t _rpc_rv;                                              \
+    if (__atomic_load_n(&ind_ofdpa_rpc_stats_enabled, __ATOMIC_RELAXED)) \
+    {                                                                   \
+      uint64_t _rpc_start = ind_ofdpa_rpc_now_ns();                     \
+      _rpc_rv = _api(__VA_ARGS__);                                      \
+      ind_ofdpa_rpc_record(IND_OFDPA_RPC_##_api, _rpc_start, _rpc_rv);  \
+    }                                                                   \
+    else                                                                \
+    {                                                                   \
+      _rpc_rv = _api(__VA_ARGS__);                                      \
+    }                                                                   \
+    if (_rpc_rv != OFDPA_E_NONE)                                        \
+    {                                                                   \
+      ind_ofdpa_rpc_error(IND_OFDPA_RPC_##_api, _rpc_rv);               \
+    }                                                                   \
+    _rpc_rv;                                                            \
+  })
+
+const char *ind_ofdpa_rpc_name(ind_ofdpa_rpc_t api);
+void ind_ofdpa_rpc_stats_enable_set(int enable);
+int ind_ofdpa_rpc_stats_enable_get(void);
+void ind_ofdpa_rpc_stats_get(ind_ofdpa_rpc_t api, ind_ofdpa_rpc_stats_t *stats);
+void ind_ofdpa_rpc_stats_clear(void);
+void ind_ofdpa_rpc_stats_show(aim_pvs_t *pvs);
+
+/* Flow table occupancy, capacity and adds refused as full */
+void ind_ofdpa_table_capacity_show(aim_pvs_t *pvs);
+
+/* Hold queued flow adds for a window so later modifies and deletes fold in */
+void ind_ofdpa_flow_window_set(int window_ms);
+void ind_ofdpa_flow_window_show(aim_pvs_t *pvs);
+
+/* Optional thread that programs batched flow adds off the main loop */
+indigo_error_t ind_ofdpa_flow_worker_start(void);
+void ind_ofdpa_flow_worker_stop(void);
+
+/*
+ * Optional pool of OF-DPA client threads. The op runs on a client thread
+ * and makes the OF-DPA calls; done runs afterwards on the event loop with
+ * the op's result. Without the pool both run before submit returns.
+ */
+typedef OFDPA_ERROR_t (*ind_ofdpa_async_op_f)(void *cookie);
+typedef void (*ind_ofdpa_async_done_f)(void *cookie, OFDPA_ERROR_t rv);
+
+indigo_error_t ind_ofdpa_async_start(int threads);
+void ind_ofdpa_async_stop(void);
+int ind_ofdpa_async_running(void);
+indigo_error_t ind_ofdpa_async_submit(ind_ofdpa_async_op_f op,
+                                      ind_ofdpa_async_done_f done,
+                                      void *cookie);
+void ind_ofdpa_async_wait(void);
+void ind_ofdpa_async_show(aim_pvs_t *pvs);
+
+/* Optional cache answering all-port stats requests, refreshed in the background */
+indigo_error_t ind_ofdpa_port_stats_cache_start(int interval_ms);
+void ind_ofdpa_port_stats_cache_stop(void);
+void ind_ofdpa_port_stats_cache_show(aim_pvs_t *pvs);
+
+/* Per-second port rates between the last two cache sweeps; -1 if unknown */
+typedef struct ind_ofdpa_port_rates_s
+{
+  uint64_t rx_packets;
+  uint64_t rx_bits;
+  uint64_t rx_errors;
+  uint64_t tx_packets;
+  uint64_t tx_bits;
+  uint64_t tx_errors;
+  uint32_t interval_ms;   /* Between the two sweeps */
+  uint32_t age_ms;        /* Since the newer sweep started */
+} ind_ofdpa_port_rates_t;
+
+void ind_ofdpa_port_stats_rates_show(aim_pvs_t *pvs);
+
+/* Optional cache answering queue stats requests, refreshed in the background */
+indigo_error_t ind_ofdpa_queue_stats_cache_start(int interval_ms);
+void ind_ofdpa_queue_stats_cache_stop(void);
+void ind_ofdpa_queue_stats_cache_show(aim_pvs_t *pvs);
+
+/* Set queue rates; use this rather than ofdpaQueueRateSet to keep the queue config cache current */
+indigo_error_t ind_ofdpa_queue_rate_set(uint32_t port, uint32_t queueId,
+                                        uint32_t minRate, uint32_t maxRate);
+
+/* Optional background collection of MEP LM/DM samples and data plane LM counters */
+indigo_error_t ind_ofdpa_oam_collector_start(int interval_ms);
+void ind_ofdpa_oam_collector_stop(void);
+void ind_ofdpa_oam_thresholds_set(uint32_t loss, uint32_t delay);
+void ind_ofdpa_oam_collector_show(aim_pvs_t *pvs);
+
+/* Per ingress port packet-in metering, configured from the "pktin_meter" config section */
+void ind_ofdpa_pimu_init(void);
+int ind_ofdpa_pimu_check(const ofdpaPacket_t *rxPkt, uint8_t *data, unsigned int len);
+void ind_ofdpa_pimu_clear(void);
+void ind_ofdpa_pimu_show(aim_pvs_t *pvs);
+
+/* Thread placement defaults from --thread ROLE@PLACEMENT, overridden by the "threads" config section */
+void ind_ofdpa_threads_init(void);
+indigo_error_t ind_ofdpa_thread_option_parse(const char *text);
+/* Register a started thread, logging a placement that could not be applied */
+void ind_ofdpa_thread_register(indigo_thread_role_t role, pthread_t thread);
+
+/* Groups and flows installed at startup from the "preload" config section */
+void ind_ofdpa_preload_init(void);
+/* Hold installing while a warm start adopts the existing state */
+void ind_ofdpa_preload_hold(int hold);
+
+/* Drain OAM events and report them, with threshold crossings, to the controllers */
+void ind_ofdpa_oam_event_receive(void);
+void ind_ofdpa_oam_mep_show(aim_pvs_t *pvs, uint32_t lmepId);
+void ind_ofdpa_oam_data_counter_track(uint32_t lmepId, uint8_t trafficClass, int add);
+int ind_ofdpa_oam_data_counters_get(uint32_t lmepId, uint8_t trafficClass,
+                                    uint32_t *txFCl, uint32_t *rxFCl);
+
+/* Optional background refresh of group stats, walking the groups once per interval */
+indigo_error_t ind_ofdpa_group_stats_start(int interval_ms);
+void ind_ofdpa_group_stats_stop(void);
+void ind_ofdpa_group_stats_show(aim_pvs_t *pvs);
+
+/* Optional background refresh of meter stats into the meter shadow */
+indigo_error_t ind_ofdpa_meter_stats_start(int interval_ms);
+void ind_ofdpa_meter_stats_stop(void);
+void ind_ofdpa_meter_stats_show(aim_pvs_t *pvs);
+/* Color based actions flow counters and per-tenant totals from the same sweep */
+int ind_ofdpa_color_flow_stats_get(uint64_t cookie, ofdpaFlowEntryStats_t *stats);
+void ind_ofdpa_tenant_metering_show(aim_pvs_t *pvs);
+
+/* Optional packet-in classifier applying a per-class policy before the controller */
+typedef enum
+{
+  IND_OFDPA_PKTIN_CLASS_ARP,
+  IND_OFDPA_PKTIN_CLASS_ND,
+  IND_OFDPA_PKTIN_CLASS_LLDP,
+  IND_OFDPA_PKTIN_CLASS_LACP,
+  IND_OFDPA_PKTIN_CLASS_DHCP,
+  IND_OFDPA_PKTIN_CLASS_BFD,
+  IND_OFDPA_PKTIN_CLASS_FLOW,
+  IND_OFDPA_PKTIN_CLASS_OTHER,
+  IND_OFDPA_PKTIN_CLASS_COUNT
+} ind_ofdpa_pktin_class_t;
+
+typedef struct ind_ofdpa_pktin_policy_s
+{
+  int      local;       /* consume here rather than send to the controller */
+  uint32_t rate_pps;    /* 0 for no rate limit */
+  uint32_t burst;       /* 0 for rate_pps */
+  uint32_t dedup_ms;    /* send repeats of a flow once per window, 0 for every one */
+} ind_ofdpa_pktin_policy_t;
+
+indigo_error_t ind_ofdpa_pktin_classifier_start(void);
+void ind_ofdpa_pktin_classifier_stop(void);
+indigo_error_t ind_ofdpa_pktin_policy_set(ind_ofdpa_pktin_class_t cls,
+                                          const ind_ofdpa_pktin_policy_t *policy);
+int ind_ofdpa_pktin_class_lookup(const char *name);
+void ind_ofdpa_pktin_classifier_show(aim_pvs_t *pvs);
+
+/* Optional PDU offload: periodic tx and expected rx PDUs programmed by the controller */
+indigo_error_t ind_ofdpa_pdu_offload_start(void);
+void ind_ofdpa_pdu_offload_stop(void);
+void ind_ofdpa_pdu_offload_show(aim_pvs_t *pvs);
+int ind_ofdpa_pdu_receive(uint32_t portNum, uint8_t *data, unsigned int len);
+
+/* Bridging and Unicast Routing host entries as gentables */
+void ind_ofdpa_host_gentables_register(void);
+
+/* Optional ARP responder for the addresses in the arp_responder gentable */
+indigo_error_t ind_ofdpa_arp_responder_start(void);
+void ind_ofdpa_arp_responder_stop(void);
+void ind_ofdpa_arp_responder_show(aim_pvs_t *pvs);
+int ind_ofdpa_arp_receive(uint32_t portNum, const uint8_t *data, unsigned int len);
+
+/* Optional source MAC learning in the agent, installing Bridging flows through the flow batch */
+#define IND_OFDPA_LEARN_AGING_DEFAULT 300
+indigo_error_t ind_ofdpa_learn_start(uint32_t aging_sec);
+void ind_ofdpa_learn_stop(void);
+void ind_ofdpa_learn_show(aim_pvs_t *pvs, int detail);
+int ind_ofdpa_learn_receive(const ofdpaPacket_t *rxPkt, const uint8_t *data, unsigned int len);
+void ind_ofdpa_learn_install_done(const ofdpaFlowEntry_t *flow, OFDPA_ERROR_t ofdpa_rv);
+int ind_ofdpa_learn_flow_expired(const ofdpaFlowEntry_t *flow);
+/* Programming of the learned flows, kept in order with the controller's */
+void ind_ofdpa_flow_learned_queue(const ofdpaFlowEntry_t *flow);
+/* Synchronous add of a gentable flow; modify and delete as for learned flows */
+OFDPA_ERROR_t ind_ofdpa_flow_direct_add(ofdpaFlowEntry_t *flow);
+OFDPA_ERROR_t ind_ofdpa_flow_learned_modify(ofdpaFlowEntry_t *flow);
+OFDPA_ERROR_t ind_ofdpa_flow_learned_delete(ofdpaFlowEntry_t *flow);
+
+/* Cache of the OF-DPA tunnel objects; create and delete them through these calls to keep it current */
+indigo_error_t ind_ofdpa_tunnel_cache_load(void);
+void ind_ofdpa_tunnel_cache_clear(void);
+void ind_ofdpa_tunnel_cache_show(aim_pvs_t *pvs, int detail);
+indigo_error_t ind_ofdpa_tunnel_tenant_create(uint32_t tunnelId, ofdpaTunnelTenantConfig_t *config);
+indigo_error_t ind_ofdpa_tunnel_tenant_delete(uint32_t tunnelId);
+indigo_error_t ind_ofdpa_tunnel_port_create(uint32_t portNum, ofdpa_buffdesc *name,
+                                            ofdpaTunnelPortConfig_t *config);
+indigo_error_t ind_ofdpa_tunnel_port_delete(uint32_t portNum);
+indigo_error_t ind_ofdpa_tunnel_port_tenant_add(uint32_t portNum, uint32_t tunnelId);
+indigo_error_t ind_ofdpa_tunnel_port_tenant_delete(uint32_t portNum, uint32_t tunnelId);
+indigo_error_t ind_ofdpa_tunnel_next_hop_create(uint32_t nextHopId, ofdpaTunnelNextHopConfig_t *config);
+indigo_error_t ind_ofdpa_tunnel_next_hop_modify(uint32_t nextHopId, ofdpaTunnelNextHopConfig_t *config);
+indigo_error_t ind_ofdpa_tunnel_next_hop_delete(uint32_t nextHopId);
+indigo_error_t ind_ofdpa_tunnel_ecmp_create(uint32_t ecmpNextHopGroupId,
+                                            ofdpaTunnelEcmpNextHopGroupConfig_t *config);
+indigo_error_t ind_ofdpa_tunnel_ecmp_delete(uint32_t ecmpNextHopGroupId);
+indigo_error_t ind_ofdpa_tunnel_ecmp_member_add(uint32_t ecmpNextHopGroupId, uint32_t nextHopId);
+indigo_error_t ind_ofdpa_tunnel_ecmp_member_delete(uint32_t ecmpNextHopGroupId, uint32_t nextHopId);
+/* Replace the members of an ECMP group, adding before deleting */
+indigo_error_t ind_ofdpa_tunnel_ecmp_members_set(uint32_t ecmpNextHopGroupId,
+                                                 const uint32_t *nextHopIds, int count);
+indigo_error_t ind_ofdpa_tunnel_tenant_get(uint32_t tunnelId, ofdpaTunnelTenantConfig_t *config);
+indigo_error_t ind_ofdpa_tunnel_port_get(uint32_t portNum, ofdpaTunnelPortConfig_t *config);
+indigo_error_t ind_ofdpa_tunnel_next_hop_get(uint32_t nextHopId, ofdpaTunnelNextHopConfig_t *config);
+int ind_ofdpa_tunnel_port_tenant_is_member(uint32_t portNum, uint32_t tunnelId);
+/* Returns the tenant's port count; up to max port numbers are stored in ports */
+int ind_ofdpa_tunnel_tenant_ports_get(uint32_t tunnelId, uint32_t *ports, int max);
+
+/* OXM experimenter ids */
+#define IND_OFDPA_OXM_EXPERIMENTER_OFDPA  0x00001018
+#define IND_OFDPA_OXM_EXPERIMENTER_ONF    0x4f4e4600
+
+int ind_ofdpa_oxm_write(uint8_t *buf, int space, uint32_t type_len, uint32_t experimenter,
+                        const uint8_t *value, const uint8_t *mask);
+
+/*
+ * Check the OF-DPA flow tables against the agent's flows in the
+ * background, a few flows every interval_ms; with repair, delete flows
+ * the agent does not know and report flows missing from OF-DPA as removed
+ */
+indigo_error_t ind_ofdpa_flow_scrub_start(int interval_ms, int repair);
+void ind_ofdpa_flow_scrub_stop(void);
+void ind_ofdpa_flow_scrub_show(aim_pvs_t *pvs);
+
+/* Register the OF-DPA experimenter messages and multiparts with the core */
+void ind_ofdpa_experimenter_register(void);
+
+/* Experimenter subtype for a flow_add template expanded over port and VLAN ranges */
+#define IND_OFDPA_EXPERIMENTER_RANGE_FLOW_ADD  0x100
+indigo_error_t ind_ofdpa_range_flow_add_handler(of_object_t *obj, indigo_cxn_id_t cxn_id);
+
+/*
+ * Warm start: adopt the groups and flows already in OF-DPA in the
+ * background, calling done, if not NULL, once they are all adopted
+ */
+typedef void (*ind_ofdpa_warm_start_done_f)(void);
+indigo_error_t ind_ofdpa_warm_start(ind_ofdpa_warm_start_done_f done);
+void ind_ofdpa_groups_restore(int *restored, int *skipped);
@@ -0,0 +1,416 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_arp.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "indigo/of_state_manager.h"
+#include "indigo/debug_counter.h"
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim.h>
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+/*
+ * ARP responder
+ *
+ * ARP requests for gateway addresses are answered in the agent instead of
+ * through a packet-in and a packet_out from the controller. The addresses
+ * are entries of the "arp_responder" gentable:
+ *
+ * Key:
+ *  - vlan_vid (0 for untagged frames)
+ *  - ipv4
+ *
+ * Value:
+ *  - mac
+ *
+ * Stats:
+ *  - request_packets: requests seen for the address
+ *  - reply_packets: replies sent
+ *
+ * A punted ARP request for a known address is answered out of the port
+ * it came in on, with the VLAN tag it came with, and never reaches the
+ * controller. Requests for other addresses, gratuitous ARPs and replies
+ * go to the controller as before. The responder totals are also debug
+ * counters.
+ */
+#define IND_OFDPA_ARP_BUCKETS     1024
+#define IND_OFDPA_ARP_MAX         4096
+#define IND_OFDPA_ARP_FRAME_MIN   60
+
+#define IND_OFDPA_ARP_LEN         28
+#define IND_OFDPA_ARP_OP_REQUEST  1
+#define IND_OFDPA_ARP_OP_REPLY    2
+
+typedef struct ind_ofdpa_arp_key_s
+{
+  uint16_t  vlan_vid;
+  uint16_t  pad;
+  of_ipv4_t ipv4;
+} ind_ofdpa_arp_key_t;
+
+typedef struct ind_ofdpa_arp_entry_s
+{
+  bighash_entry_t     hash_entry;
+  ind_ofdpa_arp_key_t key;
+  of_mac_addr_t       mac;
+  uint64_t            requests;
+  uint64_t            replies;
+} ind_ofdpa_arp_entry_t;
+
+#define TEMPLATE_NAME ind_ofdpa_arp_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_arp_entry_t
+#define TEMPLATE_KEY_FIELD key
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static bighash_table_t *ind_ofdpa_arp_table = NULL;
+static indigo_core_gentable_t *ind_ofdpa_arp_gentable = NULL;
+
+static struct
+{
+  bool            running;
+  int             count;
+  debug_counter_t requests;
+  debug_counter_t replies;
+  debug_counter_t misses;
+  debug_counter_t errors;
+} ind_ofdpa_arp;
+
+static indigo_error_t ind_ofdpa_arp_key_parse(of_list_bsn_tlv_t *tlvs, ind_ofdpa_arp_key_t *key)
+{
+  of_bsn_tlv_t tlv;
+  int loop_rv = 0;
+  int count_vlan_vid = 0;
+  int count_ipv4 = 0;
+
+  memset(key, 0, sizeof(*key));
+
+  OF_LIST_BSN_TLV_ITER(tlvs, &tlv, loop_rv)
+  {
+    if (tlv.header.object_id == OF_BSN_TLV_VLAN_VID)
+    {
+      count_vlan_vid++;
+      of_bsn_tlv_vlan_vid_value_get(&tlv.port, &key->vlan_vid);
+    }
+    else if (tlv.header.object_id == OF_BSN_TLV_IPV4)
+    {
+      count_ipv4++;
+      of_bsn_tlv_ipv4_value_get(&tlv.port, &key->ipv4);
+    }
+    else
+    {
+      return INDIGO_ERROR_NOT_SUPPORTED;
+    }
+  }
+
+  if (count_vlan_vid != 1 || count_ipv4 != 1 || key->vlan_vid >= 4095)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_arp_value_parse(of_list_bsn_tlv_t *tlvs, of_mac_addr_t *mac)
+{
+  of_bsn_tlv_t tlv;
+  int loop_rv = 0;
+  int count_mac = 0;
+
+  OF_LIST_BSN_TLV_ITER(tlvs, &tlv, loop_rv)
+  {
+    if (tlv.header.object_id == OF_BSN_TLV_MAC)
+    {
+      count_mac++;
+      of_bsn_tlv_mac_value_get(&tlv.port, mac);
+    }
+    else
+    {
+      return INDIGO_ERROR_NOT_SUPPORTED;
+    }
+  }
+
+  if (count_mac != 1 || (mac->addr[0] & 1))
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_arp_gentable_add(void *table_priv, of_list_bsn_tlv_t *key,
+                                                 of_list_bsn_tlv_t *value, void **entry_priv)
+{
+  ind_ofdpa_arp_entry_t *entry;
+  ind_ofdpa_arp_key_t k;
+  of_mac_addr_t mac;
+  indigo_error_t rv;
+
+  if ((rv = ind_ofdpa_arp_key_parse(key, &k)) < 0 ||
+      (rv = ind_ofdpa_arp_value_parse(value, &mac)) < 0)
+  {
+    return rv;
+  }
+
+  if (ind_ofdpa_arp.count >= IND_OFDPA_ARP_MAX)
+  {
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  entry = aim_zmalloc(sizeof(*entry));
+  entry->key = k;
+  entry->mac = mac;
+  ind_ofdpa_arp_hashtable_insert(ind_ofdpa_arp_table, entry);
+  ind_ofdpa_arp.count++;
+
+  *entry_priv = entry;
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_arp_gentable_modify(void *table_priv, void *entry_priv,
+                                                    of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *value)
+{
+  ind_ofdpa_arp_entry_t *entry = entry_priv;
+  of_mac_addr_t mac;
+  indigo_error_t rv;
+
+  if ((rv = ind_ofdpa_arp_value_parse(value, &mac)) < 0)
+  {
+    return rv;
+  }
+
+  entry->mac = mac;
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_arp_gentable_delete(void *table_priv, void *entry_priv,
+                                                    of_list_bsn_tlv_t *key)
+{
+  ind_ofdpa_arp_entry_t *entry = entry_priv;
+
+  bighash_remove(ind_ofdpa_arp_table, &entry->hash_entry);
+  ind_ofdpa_arp.count--;
+  aim_free(entry);
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_arp_gentable_get_stats(void *table_priv, void *entry_priv,
+                                             of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *stats)
+{
+  ind_ofdpa_arp_entry_t *entry = entry_priv;
+  of_object_t *tlv;
+
+  tlv = of_bsn_tlv_request_packets_new(stats->version);
+  of_bsn_tlv_request_packets_value_set(tlv, entry->requests);
+  of_list_append(stats, tlv);
+  of_object_delete(tlv);
+
+  tlv = of_bsn_tlv_reply_packets_new(stats->version);
+  of_bsn_tlv_reply_packets_value_set(tlv, entry->replies);
+  of_list_append(stats, tlv);
+  of_object_delete(tlv);
+}
+
+static const indigo_core_gentable_ops_t ind_ofdpa_arp_gentable_ops =
+{
+  .add = ind_ofdpa_arp_gentable_add,
+  .modify = ind_ofdpa_arp_gentable_modify,
+  .del = ind_ofdpa_arp_gentable_delete,
+  .get_stats = ind_ofdpa_arp_gentable_get_stats,
+};
+
+static inline uint32_t ind_ofdpa_arp_get_u32(const uint8_t *p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+int ind_ofdpa_arp_receive(uint32_t portNum, const uint8_t *data, unsigned int len)
+{
+  uint8_t reply[IND_OFDPA_ARP_FRAME_MIN];
+  ind_ofdpa_arp_entry_t *entry;
+  ind_ofdpa_arp_key_t key;
+  const uint8_t *arp;
+  unsigned int hdr_len = 14;
+  ofdpa_buffdesc pkt;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  if (ind_ofdpa_arp.count == 0 || len < 14)
+  {
+    return 0;
+  }
+
+  memset(&key, 0, sizeof(key));
+  if (data[12] == 0x81 && data[13] == 0x00)
+  {
+    if (len < 18)
+    {
+      return 0;
+    }
+    key.vlan_vid = ((data[14] << 8) | data[15]) & 0x0fff;
+    hdr_len = 18;
+  }
+
+  /* Requests for an IPv4 address over Ethernet */
+  arp = data + hdr_len;
+  if (data[hdr_len - 2] != 0x08 || data[hdr_len - 1] != 0x06 ||
+      len < hdr_len + IND_OFDPA_ARP_LEN ||
+      arp[0] != 0 || arp[1] != 1 || arp[2] != 0x08 || arp[3] != 0x00 ||
+      arp[4] != 6 || arp[5] != 4 ||
+      arp[6] != 0 || arp[7] != IND_OFDPA_ARP_OP_REQUEST)
+  {
+    return 0;
+  }
+
+  /* Gratuitous ARPs announce the sender; the controller wants those */
+  if (!memcmp(arp + 14, arp + 24, 4))
+  {
+    return 0;
+  }
+
+  key.ipv4 = ind_ofdpa_arp_get_u32(arp + 24);
+  entry = ind_ofdpa_arp_hashtable_first(ind_ofdpa_arp_table, &key);
+  if (entry == NULL)
+  {
+    debug_counter_inc(&ind_ofdpa_arp.misses);
+    return 0;
+  }
+
+  entry->requests++;
+  debug_counter_inc(&ind_ofdpa_arp.requests);
+
+  /* To the requester, with the same tag, from the gateway */
+  memset(reply, 0, sizeof(reply));
+  memcpy(reply, data + 6, 6);
+  memcpy(reply + 6, entry->mac.addr, 6);
+  memcpy(reply + 12, data + 12, hdr_len - 12);
+  memcpy(reply + hdr_len, arp, 6);
+  reply[hdr_len + 6] = 0;
+  reply[hdr_len + 7] = IND_OFDPA_ARP_OP_REPLY;
+  memcpy(reply + hdr_len + 8, entry->mac.addr, 6);
+  memcpy(reply + hdr_len + 14, arp + 24, 4);
+  memcpy(reply + hdr_len + 18, arp + 8, 10);
+
+  pkt.pstart = (char *)reply;
+  pkt.size = sizeof(reply);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPktSend, &pkt, 0, portNum, 0);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR_RL("Failed to send ARP reply on port %u. (ofdpa_rv = %d)", portNum, ofdpa_rv);
+    debug_counter_inc(&ind_ofdpa_arp.errors);
+    return 0;
+  }
+
+  entry->replies++;
+  debug_counter_inc(&ind_ofdpa_arp.replies);
+  return 1;
+}
+
+indigo_error_t ind_ofdpa_arp_responder_start(void)
+{
+  if (ind_ofdpa_arp.running)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  if (ind_ofdpa_arp_table == NULL)
+  {
+    ind_ofdpa_arp_table = bighash_table_create(IND_OFDPA_ARP_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_arp_table != NULL);
+  }
+
+  indigo_core_gentable_register("arp_responder", &ind_ofdpa_arp_gentable_ops, NULL,
+                                IND_OFDPA_ARP_MAX, IND_OFDPA_ARP_BUCKETS,
+                                &ind_ofdpa_arp_gentable);
+
+  debug_counter_register(&ind_ofdpa_arp.requests, "ofdpa.arp_responder.requests",
+                         "ARP requests for a responder address");
+  debug_counter_register(&ind_ofdpa_arp.replies, "ofdpa.arp_responder.replies",
+                         "ARP replies sent by the responder");
+  debug_counter_register(&ind_ofdpa_arp.misses, "ofdpa.arp_responder.misses",
+                         "ARP requests for other addresses, sent to the controller");
+  debug_counter_register(&ind_ofdpa_arp.errors, "ofdpa.arp_responder.errors",
+                         "ARP replies that could not be sent");
+
+  ind_ofdpa_arp.running = true;
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_arp_responder_stop(void)
+{
+  if (!ind_ofdpa_arp.running)
+  {
+    return;
+  }
+
+  /* Deletes the entries */
+  indigo_core_gentable_unregister(ind_ofdpa_arp_gentable);
+  ind_ofdpa_arp_gentable = NULL;
+
+  debug_counter_unregister(&ind_ofdpa_arp.requests);
+  debug_counter_unregister(&ind_ofdpa_arp.replies);
+  debug_counter_unregister(&ind_ofdpa_arp.misses);
+  debug_counter_unregister(&ind_ofdpa_arp.errors);
+
+  ind_ofdpa_arp.running = false;
+}
+
+void ind_ofdpa_arp_responder_show(aim_pvs_t *pvs)
+{
+  ind_ofdpa_arp_entry_t *entry;
+  bighash_iter_t iter;
+
+  if (!ind_ofdpa_arp.running)
+  {
+    aim_printf(pvs, "ARP responder off\n");
+    return;
+  }
+
+  aim_printf(pvs, "ARP responder on, %d addresses\n", ind_ofdpa_arp.count);
+  aim_printf(pvs, "  requests %"PRIu64" replies %"PRIu64" misses %"PRIu64" errors %"PRIu64"\n",
+             debug_counter_get(&ind_ofdpa_arp.requests),
+             debug_counter_get(&ind_ofdpa_arp.replies),
+             debug_counter_get(&ind_ofdpa_arp.misses),
+             debug_counter_get(&ind_ofdpa_arp.errors));
+
+  for (entry = bighash_iter_start(ind_ofdpa_arp_table, &iter);
+       entry != NULL;
+       entry = bighash_iter_next(&iter))
+  {
+    aim_printf(pvs, "vlan %4u %u.%u.%u.%u %02x:%02x:%02x:%02x:%02x:%02x requests %"PRIu64" replies %"PRIu64"\n",
+               entry->key.vlan_vid,
+               entry->key.ipv4 >> 24, (entry->key.ipv4 >> 16) & 0xff,
+               (entry->key.ipv4 >> 8) & 0xff, entry->key.ipv4 & 0xff,
+               entry->mac.addr[0], entry->mac.addr[1], entry->mac.addr[2],
+               entry->mac.addr[3], entry->mac.addr[4], entry->mac.addr[5],
+               entry->requests, entry->replies);
+  }
+}
@@ -0,0 +1,400 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_async.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim.h>
+#include <SocketManager/socketmanager.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <sys/eventfd.h>
+
+/*
+ * Asynchronous OF-DPA client
+ *
+ * Each OF-DPA API call is a round trip to the OF-DPA server, and the
+ * event loop waits for it. Work submitted here is run by a small pool of
+ * client threads instead; each request's op makes its OF-DPA calls on a
+ * client thread, and its done callback is run later on the event loop,
+ * woken through an eventfd, with the op's result.
+ *
+ * Requests are started in submission order but may finish in any order
+ * when there is more than one thread, so ops that depend on each other
+ * should be submitted as one op. An op must not touch state the event
+ * loop owns; it works on what its cookie points to, and the done callback
+ * publishes the result.
+ *
+ * When the client is not running, submit runs the op and its done
+ * callback before returning, so callers need not check.
+ */
+#define IND_OFDPA_ASYNC_THREADS_MAX 16
+
+typedef struct ind_ofdpa_async_req_s
+{
+  struct ind_ofdpa_async_req_s *next;
+  ind_ofdpa_async_op_f         op;
+  ind_ofdpa_async_done_f       done;
+  void                         *cookie;
+  OFDPA_ERROR_t                rv;
+} ind_ofdpa_async_req_t;
+
+typedef struct
+{
+  ind_ofdpa_async_req_t *head;
+  ind_ofdpa_async_req_t *tail;
+} ind_ofdpa_async_queue_t;
+
+static struct
+{
+  bool                    running;
+  bool                    stopping;     /* Under lock */
+  int                     thread_count;
+  pthread_t               threads[IND_OFDPA_ASYNC_THREADS_MAX];
+  pthread_mutex_t         lock;
+  pthread_cond_t          work_cond;    /* Submitted queue not empty, or stopping */
+  pthread_cond_t          done_cond;    /* Completed queue not empty */
+  ind_ofdpa_async_queue_t submitted;    /* Under lock */
+  ind_ofdpa_async_queue_t completed;    /* Under lock */
+  int                     eventfd;
+  uint32_t                queued;       /* Under lock; submitted, not yet started */
+  uint32_t                queued_high;  /* Under lock */
+  uint32_t                outstanding;  /* Submitted, done not yet called */
+  uint64_t                requests;
+  uint64_t                errors;
+  uint64_t                wakeups;
+} ind_ofdpa_async = {
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+  .work_cond = PTHREAD_COND_INITIALIZER,
+  .done_cond = PTHREAD_COND_INITIALIZER,
+  .eventfd = -1,
+};
+
+static void ind_ofdpa_async_push(ind_ofdpa_async_queue_t *queue, ind_ofdpa_async_req_t *req)
+{
+  req->next = NULL;
+  if (queue->tail == NULL)
+  {
+    queue->head = req;
+  }
+  else
+  {
+    queue->tail->next = req;
+  }
+  queue->tail = req;
+}
+
+static ind_ofdpa_async_req_t *ind_ofdpa_async_pop(ind_ofdpa_async_queue_t *queue)
+{
+  ind_ofdpa_async_req_t *req = queue->head;
+
+  if (req != NULL)
+  {
+    queue->head = req->next;
+    if (queue->head == NULL)
+    {
+      queue->tail = NULL;
+    }
+  }
+
+  return req;
+}
+
+static void ind_ofdpa_async_complete(ind_ofdpa_async_req_t *req)
+{
+  if (req->rv != OFDPA_E_NONE)
+  {
+    ind_ofdpa_async.errors++;
+  }
+  ind_ofdpa_async.outstanding--;
+
+  if (req->done != NULL)
+  {
+    req->done(req->cookie, req->rv);
+  }
+  aim_free(req);
+}
+
+/* Run the done callbacks of every completed request */
+static void ind_ofdpa_async_drain(void)
+{
+  ind_ofdpa_async_req_t *req;
+
+  pthread_mutex_lock(&ind_ofdpa_async.lock);
+  req = ind_ofdpa_async.completed.head;
+  ind_ofdpa_async.completed.head = NULL;
+  ind_ofdpa_async.completed.tail = NULL;
+  pthread_mutex_unlock(&ind_ofdpa_async.lock);
+
+  while (req != NULL)
+  {
+    ind_ofdpa_async_req_t *next = req->next;
+    ind_ofdpa_async_complete(req);
+    req = next;
+  }
+}
+
+static void *ind_ofdpa_async_thread(void *arg)
+{
+  ind_ofdpa_async_req_t *req;
+  uint64_t one = 1;
+  bool wake;
+
+  pthread_mutex_lock(&ind_ofdpa_async.lock);
+  for (;;)
+  {
+    while (ind_ofdpa_async.submitted.head == NULL && !ind_ofdpa_async.stopping)
+    {
+      pthread_cond_wait(&ind_ofdpa_async.work_cond, &ind_ofdpa_async.lock);
+    }
+
+    req = ind_ofdpa_async_pop(&ind_ofdpa_async.submitted);
+    if (req == NULL)
+    {
+      break;
+    }
+    ind_ofdpa_async.queued--;
+
+    pthread_mutex_unlock(&ind_ofdpa_async.lock);
+    req->rv = req->op(req->cookie);
+    pthread_mutex_lock(&ind_ofdpa_async.lock);
+
+    /* The event loop drains the whole queue, so one wakeup covers a burst */
+    wake = (ind_ofdpa_async.completed.head == NULL);
+    ind_ofdpa_async_push(&ind_ofdpa_async.completed, req);
+    pthread_cond_broadcast(&ind_ofdpa_async.done_cond);
+
+    if (wake && write(ind_ofdpa_async.eventfd, &one, sizeof(one)) != sizeof(one))
+    {
+      LOG_ERROR("Failed to signal OF-DPA client completion: %s", strerror(errno));
+    }
+  }
+  pthread_mutex_unlock(&ind_ofdpa_async.lock);
+
+  return NULL;
+}
+
+static void ind_ofdpa_async_ready(int socket_id, void *cookie,
+                                  int read_ready, int write_ready,
+                                  int error_seen)
+{
+  uint64_t value;
+
+  if (read(socket_id, &value, sizeof(value)) < 0 && errno != EAGAIN)
+  {
+    LOG_ERROR("Failed to read OF-DPA client eventfd: %s", strerror(errno));
+  }
+
+  ind_ofdpa_async.wakeups++;
+  ind_ofdpa_async_drain();
+}
+
+indigo_error_t ind_ofdpa_async_submit(ind_ofdpa_async_op_f op,
+                                      ind_ofdpa_async_done_f done,
+                                      void *cookie)
+{
+  ind_ofdpa_async_req_t *req;
+  OFDPA_ERROR_t rv;
+
+  ind_ofdpa_async.requests++;
+
+  if (!ind_ofdpa_async.running)
+  {
+    rv = op(cookie);
+    if (rv != OFDPA_E_NONE)
+    {
+      ind_ofdpa_async.errors++;
+    }
+    if (done != NULL)
+    {
+      done(cookie, rv);
+    }
+    return INDIGO_ERROR_NONE;
+  }
+
+  req = aim_zmalloc(sizeof(*req));
+  req->op = op;
+  req->done = done;
+  req->cookie = cookie;
+  ind_ofdpa_async.outstanding++;
+
+  pthread_mutex_lock(&ind_ofdpa_async.lock);
+  ind_ofdpa_async_push(&ind_ofdpa_async.submitted, req);
+  if (++ind_ofdpa_async.queued > ind_ofdpa_async.queued_high)
+  {
+    ind_ofdpa_async.queued_high = ind_ofdpa_async.queued;
+  }
+  pthread_cond_signal(&ind_ofdpa_async.work_cond);
+  pthread_mutex_unlock(&ind_ofdpa_async.lock);
+
+  return INDIGO_ERROR_NONE;
+}
+
+int ind_ofdpa_async_running(void)
+{
+  return ind_ofdpa_async.running;
+}
+
+/*
+ * Block until every submitted request has completed and its done callback
+ * has run, including requests submitted by those callbacks.
+ */
+void ind_ofdpa_async_wait(void)
+{
+  while (ind_ofdpa_async.outstanding != 0)
+  {
+    pthread_mutex_lock(&ind_ofdpa_async.lock);
+    while (ind_ofdpa_async.completed.head == NULL)
+    {
+      pthread_cond_wait(&ind_ofdpa_async.done_cond, &ind_ofdpa_async.lock);
+    }
+    pthread_mutex_unlock(&ind_ofdpa_async.lock);
+
+    ind_ofdpa_async_drain();
+  }
+}
+
+indigo_error_t ind_ofdpa_async_start(int threads)
+{
+  int i;
+
+  if (ind_ofdpa_async.running)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  if (threads <= 0 || threads > IND_OFDPA_ASYNC_THREADS_MAX)
+  {
+    LOG_ERROR("OF-DPA client threads must be between 1 and %d", IND_OFDPA_ASYNC_THREADS_MAX);
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_async.eventfd = eventfd(0, EFD_NONBLOCK);
+  if (ind_ofdpa_async.eventfd < 0)
+  {
+    LOG_ERROR("Failed to allocate OF-DPA client eventfd: %s", strerror(errno));
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  if (ind_soc_socket_register(ind_ofdpa_async.eventfd,
+                              ind_ofdpa_async_ready, NULL) < 0)
+  {
+    LOG_ERROR("Failed to register OF-DPA client eventfd");
+    close(ind_ofdpa_async.eventfd);
+    ind_ofdpa_async.eventfd = -1;
+    return INDIGO_ERROR_UNKNOWN;
+  }
+
+  ind_ofdpa_async.stopping = false;
+  ind_ofdpa_async.running = true;
+
+  for (i = 0; i < threads; i++)
+  {
+    if (pthread_create(&ind_ofdpa_async.threads[i], NULL,
+                       ind_ofdpa_async_thread, NULL) != 0)
+    {
+      LOG_ERROR("Failed to create OF-DPA client thread");
+      break;
+    }
+    ind_ofdpa_thread_register(INDIGO_THREAD_OFDPA_CLIENT, ind_ofdpa_async.threads[i]);
+    ind_ofdpa_async.thread_count++;
+  }
+
+  if (ind_ofdpa_async.thread_count == 0)
+  {
+    ind_ofdpa_async_stop();
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  LOG_INFO("Started %d OF-DPA client threads", ind_ofdpa_async.thread_count);
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_async_stop(void)
+{
+  int i;
+
+  if (!ind_ofdpa_async.running)
+  {
+    return;
+  }
+
+  /* Finish what was submitted so every done callback runs */
+  if (ind_ofdpa_async.thread_count > 0)
+  {
+    ind_ofdpa_async_wait();
+  }
+
+  pthread_mutex_lock(&ind_ofdpa_async.lock);
+  ind_ofdpa_async.stopping = true;
+  pthread_cond_broadcast(&ind_ofdpa_async.work_cond);
+  pthread_mutex_unlock(&ind_ofdpa_async.lock);
+
+  for (i = 0; i < ind_ofdpa_async.thread_count; i++)
+  {
+    indigo_thread_unregister(ind_ofdpa_async.threads[i]);
+    pthread_join(ind_ofdpa_async.threads[i], NULL);
+  }
+  ind_ofdpa_async.thread_count = 0;
+  ind_ofdpa_async.running = false;
+
+  ind_soc_socket_unregister(ind_ofdpa_async.eventfd);
+  close(ind_ofdpa_async.eventfd);
+  ind_ofdpa_async.eventfd = -1;
+}
+
+void ind_ofdpa_async_show(aim_pvs_t *pvs)
+{
+  uint32_t queued, queued_high;
+
+  if (!ind_ofdpa_async.running)
+  {
+    aim_printf(pvs, "Asynchronous OF-DPA client off; requests run on the event loop\n");
+  }
+  else
+  {
+    aim_printf(pvs, "Asynchronous OF-DPA client, %d threads\n", ind_ofdpa_async.thread_count);
+  }
+
+  pthread_mutex_lock(&ind_ofdpa_async.lock);
+  queued = ind_ofdpa_async.queued;
+  queued_high = ind_ofdpa_async.queued_high;
+  pthread_mutex_unlock(&ind_ofdpa_async.lock);
+
+  aim_printf(pvs, "  requests %"PRIu64" errors %"PRIu64" outstanding %u"
+             " queued %u (high %u) wakeups %"PRIu64"\n",
+             ind_ofdpa_async.requests, ind_ofdpa_async.errors,
+             ind_ofdpa_async.outstanding, queued, queued_high,
+             ind_ofdpa_async.wakeups);
+}
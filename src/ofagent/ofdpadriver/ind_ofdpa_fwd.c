@@ -40,15 +40,21 @@
 #include "ind_ofdpa_util.h"
 #include "indigo/memory.h"
 #include "indigo/forwarding.h"
+#include "indigo/port_manager.h"
 #include "ind_ofdpa_log.h"
 #include "indigo/of_state_manager.h"
+#include "indigo/of_connection_manager.h"
 #include "indigo/fi.h"
 #include "OFStateManager/ofstatemanager.h"
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include <SocketManager/socketmanager.h>
+#include <sys/eventfd.h>
 
 
 static indigo_error_t ind_ofdpa_packet_out_actions_get(of_list_action_t *of_list_actions,
                                                        indPacketOutActions_t *packetOutActions);
-static indigo_error_t ind_ofdpa_match_fields_masks_get(const of_match_t *match, ofdpaFlowEntry_t *flow);
+static indigo_error_t ind_ofdpa_match_fields_masks_get(of_flow_add_t *flow_add, ofdpaFlowEntry_t *flow);
 static indigo_error_t ind_ofdpa_translate_openflow_actions(of_object_id_t type, of_list_action_t *actions, ofdpaFlowEntry_t *flow);
 static indigo_error_t indigo_set_mpls_qos(ofdpa_mpls_set_qos_action_mod_msg_t *mpls_set_qos_action);
 static indigo_error_t indigo_oam_dataplane(ofdpa_oam_dataplane_ctr_mod_msg_t *oam_dataplane_ctr);
@@ -57,826 +63,705 @@ static indigo_error_t indigo_remark_action(ofdpa_mpls_tunnel_label_remark_action
 extern int ofagent_of_version;
 
 /*
- * Build up a record of all the match fields included in the flow_mod message. This is used to detect when the message
- * contains a match field that is not supported by the flow table. The agent is required to reject flows that request
- * a match that the switch cannot support.
+ * Match field bit for each OXM the flow tables know about, by OXM field
+ * number. Standard fields use class 0x8000; the OF-DPA and ONF fields use
+ * the experimenter class 0xffff. OXMs without a bit are not validated.
  */
-static void ind_ofdpa_populate_flow_bitmask(const of_match_t *match, ind_ofdpa_fields_t *ind_ofdpa_match_fields_bitmask)
+static const ind_ofdpa_fields_t ind_ofdpa_oxm_basic_bits[128] =
 {
-  of_mac_addr_t macAddr;
-  of_ipv6_t     ipAddr;
+  [0]  = IND_OFDPA_PORT,            /* in_port */
+  [1]  = IND_OFDPA_PORT,            /* in_phy_port */
+  [3]  = IND_OFDPA_DSTMAC,
+  [4]  = IND_OFDPA_SRCMAC,
+  [5]  = IND_OFDPA_ETHER_TYPE,
+  [6]  = IND_OFDPA_VLANID,
+  [7]  = IND_OFDPA_VLAN_PCP,
+  [8]  = IND_OFDPA_IP_DSCP,
+  [9]  = IND_OFDPA_IP_ECN,
+  [10] = IND_OFDPA_IP_PROTO,
+  [11] = IND_OFDPA_IPV4_SRC,
+  [12] = IND_OFDPA_IPV4_DST,
+  [13] = IND_OFDPA_TCP_L4_SRC_PORT,
+  [14] = IND_OFDPA_TCP_L4_DST_PORT,
+  [15] = IND_OFDPA_UDP_L4_SRC_PORT,
+  [16] = IND_OFDPA_UDP_L4_DST_PORT,
+  [17] = IND_OFDPA_SCTP_L4_SRC_PORT,
+  [18] = IND_OFDPA_SCTP_L4_DST_PORT,
+  [19] = IND_OFDPA_ICMPV4_TYPE,
+  [20] = IND_OFDPA_ICMPV4_CODE,
+  [22] = IND_OFDPA_IPV4_ARP_SPA,
+  [26] = IND_OFDPA_IPV6_SRC,
+  [27] = IND_OFDPA_IPV6_DST,
+  [28] = IND_OFDPA_IPV6_FLOW_LABEL,
+  [29] = IND_OFDPA_ICMPV6_TYPE,
+  [30] = IND_OFDPA_ICMPV6_CODE,
+  [34] = IND_OFDPA_MPLS_LABEL,
+  [35] = IND_OFDPA_MPLS_TC,
+  [36] = IND_OFDPA_MPLS_BOS,
+  [38] = IND_OFDPA_TUNNEL_ID,
+};
+
+static const ind_ofdpa_fields_t ind_ofdpa_oxm_experimenter_bits[128] =
+{
+  [1]  = IND_OFDPA_VRF,
+  [2]  = IND_OFDPA_TC,
+  [3]  = IND_OFDPA_COLOR,
+  [4]  = IND_OFDPA_VLAN_DEI,
+  [5]  = IND_OFDPA_QOS_INDEX,
+  [6]  = IND_OFDPA_LMEP_ID,
+  [7]  = IND_OFDPA_MPLS_TTL,
+  [8]  = IND_OFDPA_MPLS_L2_PORT,
+  [9]  = IND_OFDPA_L3_IN_PORT,
+  [10] = IND_OFDPA_OVID,
+  [11] = IND_OFDPA_MPLS_DATA_FIRST_NIBBLE,
+  [12] = IND_OFDPA_MPLS_ACH_CHANNEL,
+  [13] = IND_OFDPA_MPLS_NEXT_LABEL_IS_GAL,
+  [14] = IND_OFDPA_OAM_Y1731_MDL,
+  [15] = IND_OFDPA_OAM_Y1731_OPCODE,
+  [16] = IND_OFDPA_COLOR_ACTIONS_INDEX,
+  [17] = IND_OFDPA_TXFCL,
+  [18] = IND_OFDPA_RXFCL,
+  [19] = IND_OFDPA_RX_TIMESTAMP,
+  [20] = IND_OFDPA_BFD_DISCRIMINATOR,
+  [21] = IND_OFDPA_PROTECTION_INDEX,
+  [24] = IND_OFDPA_ALLOW_VLAN_TRANSLATION,
+  [43] = IND_ONF_ACTSET_OUTPUT,
+};
+
+/* OXMs collected from a flow_mod match, indexed by match field bit number */
+typedef struct ind_ofdpa_match_oxms_s
+{
+  ind_ofdpa_fields_t  present;
+  const uint8_t      *value[64];
+  const uint8_t      *mask[64];   /* NULL for an exact match */
+  uint8_t             len[64];
+} ind_ofdpa_match_oxms_t;
 
-  *ind_ofdpa_match_fields_bitmask = 0;
+/*
+ * OXM visitor building up a record of the match fields included in the
+ * flow_mod message. This is used to detect when the message contains a
+ * match field that is not supported by the flow table. The agent is
+ * required to reject flows that request a match that the switch cannot
+ * support.
+ *
+ * A masked OXM whose mask is all zero is a wildcard and does not count.
+ * Only pointers into the message are kept; values are decoded straight
+ * into the flow entry by ind_ofdpa_match_fields_apply.
+ */
+static int ind_ofdpa_match_oxm_collect(void *cookie, const of_oxm_tlv_t *tlv)
+{
+  ind_ofdpa_match_oxms_t *oxms = cookie;
+  ind_ofdpa_fields_t bit = 0;
+  int index;
+  int i;
 
-  if (match->masks.vlan_vid != 0)
+  if (OF_OXM_TLV_CLASS(tlv) == 0x8000)
   {
-    (*ind_ofdpa_match_fields_bitmask) |= IND_OFDPA_VLANID;
+    bit = ind_ofdpa_oxm_basic_bits[OF_OXM_TLV_FIELD(tlv)];
   }
-
-  memset(&macAddr, 0, sizeof(macAddr));
-
-  if ((memcmp(&match->masks.eth_src, &macAddr, sizeof(match->masks.eth_src))) != 0)
+  else if (OF_OXM_TLV_CLASS(tlv) == OF_OXM_CLASS_EXPERIMENTER)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_SRCMAC;
+    bit = ind_ofdpa_oxm_experimenter_bits[OF_OXM_TLV_FIELD(tlv)];
   }
 
-  if ((memcmp(&match->masks.eth_dst, &macAddr, sizeof(match->masks.eth_dst))) != 0)
+  if (bit == 0)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_DSTMAC;
+    return 0;
   }
 
-  if ((match->masks.in_port != 0) ||(match->masks.in_phy_port != 0))
+  if (tlv->mask != NULL)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_PORT;
+    for (i = 0; i < tlv->value_len && tlv->mask[i] == 0; i++);
+    if (i == tlv->value_len)
+    {
+      return 0;
+    }
   }
 
-  if (match->masks.eth_type != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_ETHER_TYPE;
-  }
+  oxms->present |= bit;
 
-  if (match->masks.ipv4_dst != 0)
+  /* in_phy_port only counts as a port match; the flow tables use in_port */
+  if (OF_OXM_TLV_CLASS(tlv) == 0x8000 && OF_OXM_TLV_FIELD(tlv) == 1)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IPV4_DST;
+    return 0;
   }
 
-  if (match->masks.ipv4_src != 0)
+  if (tlv->value_len > 16)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IPV4_SRC;
+    return OF_ERROR_PARSE;
   }
 
-  memset(&ipAddr, 0, sizeof(ipAddr));
+  index = __builtin_ctzll(bit);
+  oxms->value[index] = tlv->value;
+  oxms->mask[index]  = tlv->mask;
+  oxms->len[index]   = tlv->value_len;
 
-  if ((memcmp(&match->masks.ipv6_dst, &ipAddr, sizeof(match->masks.ipv6_dst))) != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IPV6_DST;
-  }
+  return 0;
+}
 
-  if ((memcmp(&match->masks.ipv6_src, &ipAddr, sizeof(match->masks.ipv6_src))) != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IPV6_SRC;
-  }
+/*
+ * Per-table match field layouts. Each entry says where in the OF-DPA flow
+ * entry a match field's value and mask go; validation against the table's
+ * bitmaps is done beforehand from ind_ofdpa_match_tables.
+ */
+typedef struct ind_ofdpa_match_field_s
+{
+  ind_ofdpa_fields_t field;
+  uint16_t           value_offset;  /* Offset in ofdpaFlowEntry_t */
+  uint16_t           mask_offset;   /* 0 if the table takes no mask */
+  uint8_t            size;          /* Of the value, and of the mask */
+  uint8_t            is_addr;       /* Byte string (MAC, IPv6) rather than an integer */
+  uint8_t            ip_proto;      /* If nonzero, only used when ip_proto matches */
+  uint64_t           value_and;
+  uint64_t           mask_and;
+} ind_ofdpa_match_field_t;
+
+#define IND_OFDPA_MATCH_ALL  (~0ULL)
+
+#define IND_OFDPA_MATCH_OFFSET(entry, member) \
+  offsetof(ofdpaFlowEntry_t, flowData.entry.match_criteria.member)
+#define IND_OFDPA_MATCH_SIZE(entry, member) \
+  sizeof(((ofdpaFlowEntry_t *)0)->flowData.entry.match_criteria.member)
+
+#define IND_OFDPA_MATCH_FIELD(bit, entry, value, mask_offset, is_addr, proto, value_and, mask_and) \
+  { bit, IND_OFDPA_MATCH_OFFSET(entry, value), mask_offset, IND_OFDPA_MATCH_SIZE(entry, value), \
+    is_addr, proto, value_and, mask_and }
+
+#define IND_OFDPA_MATCH(bit, entry, value, mask) \
+  IND_OFDPA_MATCH_FIELD(bit, entry, value, IND_OFDPA_MATCH_OFFSET(entry, mask), 0, 0, \
+                        IND_OFDPA_MATCH_ALL, IND_OFDPA_MATCH_ALL)
+#define IND_OFDPA_MATCH_AND(bit, entry, value, mask, value_and, mask_and) \
+  IND_OFDPA_MATCH_FIELD(bit, entry, value, IND_OFDPA_MATCH_OFFSET(entry, mask), 0, 0, \
+                        value_and, mask_and)
+#define IND_OFDPA_MATCH_PROTO(bit, proto, entry, value, mask) \
+  IND_OFDPA_MATCH_FIELD(bit, entry, value, IND_OFDPA_MATCH_OFFSET(entry, mask), 0, proto, \
+                        IND_OFDPA_MATCH_ALL, IND_OFDPA_MATCH_ALL)
+#define IND_OFDPA_MATCH_VALUE(bit, entry, value) \
+  IND_OFDPA_MATCH_FIELD(bit, entry, value, 0, 0, 0, IND_OFDPA_MATCH_ALL, IND_OFDPA_MATCH_ALL)
+#define IND_OFDPA_MATCH_VALUE_AND(bit, entry, value, value_and) \
+  IND_OFDPA_MATCH_FIELD(bit, entry, value, 0, 0, 0, value_and, IND_OFDPA_MATCH_ALL)
+#define IND_OFDPA_MATCH_ADDR(bit, entry, value, mask) \
+  IND_OFDPA_MATCH_FIELD(bit, entry, value, IND_OFDPA_MATCH_OFFSET(entry, mask), 1, 0, \
+                        IND_OFDPA_MATCH_ALL, IND_OFDPA_MATCH_ALL)
+#define IND_OFDPA_MATCH_ADDR_VALUE(bit, entry, value) \
+  IND_OFDPA_MATCH_FIELD(bit, entry, value, 0, 1, 0, IND_OFDPA_MATCH_ALL, IND_OFDPA_MATCH_ALL)
+
+static const ind_ofdpa_match_field_t ind_ofdpa_match_ingress_port_fields[] =
+{
+  IND_OFDPA_MATCH(IND_OFDPA_PORT, ingressPortFlowEntry, inPort, inPortMask),
+  IND_OFDPA_MATCH(IND_OFDPA_TUNNEL_ID, ingressPortFlowEntry, tunnelId, tunnelIdMask),
+  IND_OFDPA_MATCH(IND_OFDPA_ETHER_TYPE, ingressPortFlowEntry, etherType, etherTypeMask),
+  IND_OFDPA_MATCH(IND_OFDPA_LMEP_ID, ingressPortFlowEntry, lmepId, lmepIdMask),
+};
 
-  if (match->masks.tunnel_id != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_TUNNEL_ID;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_injected_oam_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_LMEP_ID, injectedOamFlowEntry, lmepId),
+};
 
-  if (match->masks.vlan_pcp != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_VLAN_PCP;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_vlan_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_PORT, vlanFlowEntry, inPort),
+  IND_OFDPA_MATCH_AND(IND_OFDPA_VLANID, vlanFlowEntry, vlanId, vlanIdMask, (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK), (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK)),
+};
 
-  if (match->masks.ofdpa_dei != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_VLAN_DEI;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_vlan_1_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_PORT, vlan1FlowEntry, inPort),
+  IND_OFDPA_MATCH_VALUE_AND(IND_OFDPA_VLANID, vlan1FlowEntry, vlanId, (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK)),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_OVID, vlan1FlowEntry, ovid),
+};
 
-  if (match->masks.arp_spa != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IPV4_ARP_SPA;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_maintenance_point_fields[] =
+{
+  IND_OFDPA_MATCH(IND_OFDPA_ETHER_TYPE, mpFlowEntry, etherType, etherTypeMask),
+  IND_OFDPA_MATCH_AND(IND_OFDPA_OAM_Y1731_MDL, mpFlowEntry, oamY1731Mdl, oamY1731MdlMask, IND_OFDPA_MATCH_ALL, OFDPA_OAM_Y1731_MDL_EXACT_MASK),
+  IND_OFDPA_MATCH(IND_OFDPA_OAM_Y1731_OPCODE, mpFlowEntry, oamY1731Opcode, oamY1731OpcodeMask),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_PORT, mpFlowEntry, inPort),
+  IND_OFDPA_MATCH_AND(IND_OFDPA_VLANID, mpFlowEntry, vlanId, vlanIdMask, (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK), (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK)),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_DSTMAC, mpFlowEntry, destMac, destMacMask),
+};
+
+static const ind_ofdpa_match_field_t ind_ofdpa_match_mpls_l2_port_fields[] =
+{
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_L2_PORT, mplsL2PortFlowEntry, mplsL2Port, mplsL2PortMask),
+  IND_OFDPA_MATCH(IND_OFDPA_ETHER_TYPE, mplsL2PortFlowEntry, etherType, etherTypeMask),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_TUNNEL_ID, mplsL2PortFlowEntry, tunnelId),
+};
 
-  if (match->masks.ip_dscp != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IP_DSCP;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_termination_mac_fields[] =
+{
+  IND_OFDPA_MATCH(IND_OFDPA_PORT, terminationMacFlowEntry, inPort, inPortMask),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_ETHER_TYPE, terminationMacFlowEntry, etherType),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_DSTMAC, terminationMacFlowEntry, destMac, destMacMask),
+  IND_OFDPA_MATCH_AND(IND_OFDPA_VLANID, terminationMacFlowEntry, vlanId, vlanIdMask, IND_OFDPA_MATCH_ALL, (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK)),
+};
 
-  if (match->masks.ip_ecn != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IP_ECN;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_mpls_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_ETHER_TYPE, mplsFlowEntry, etherType),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_MPLS_BOS, mplsFlowEntry, mplsBos),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_MPLS_LABEL, mplsFlowEntry, mplsLabel),
+  IND_OFDPA_MATCH(IND_OFDPA_PORT, mplsFlowEntry, inPort, inPortMask),
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_TTL, mplsFlowEntry, mplsTtl, mplsTtlMask),
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_DATA_FIRST_NIBBLE, mplsFlowEntry, mplsDataFirstNibble, mplsDataFirstNibbleMask),
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_ACH_CHANNEL, mplsFlowEntry, mplsAchChannel, mplsAchChannelMask),
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_NEXT_LABEL_IS_GAL, mplsFlowEntry, nextLabelIsGal, nextLabelIsGalMask),
+  IND_OFDPA_MATCH(IND_OFDPA_IPV4_DST, mplsFlowEntry, destIp4, destIp4Mask),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_IPV6_DST, mplsFlowEntry, destIp6, destIp6Mask),
+  IND_OFDPA_MATCH(IND_OFDPA_IP_PROTO, mplsFlowEntry, ipProto, ipProtoMask),
+  IND_OFDPA_MATCH(IND_OFDPA_UDP_L4_SRC_PORT, mplsFlowEntry, udpSrcPort, udpSrcPortMask),
+  IND_OFDPA_MATCH(IND_OFDPA_UDP_L4_DST_PORT, mplsFlowEntry, udpDstPort, udpDstPortMask),
+};
+
+static const ind_ofdpa_match_field_t ind_ofdpa_match_mpls_maintenance_point_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_LMEP_ID, mplsMpFlowEntry, lmepId),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_OAM_Y1731_OPCODE, mplsMpFlowEntry, oamY1731Opcode),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_ETHER_TYPE, mplsMpFlowEntry, etherType),
+};
 
-  if (match->masks.ip_proto != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IP_PROTO;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_unicast_routing_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_ETHER_TYPE, unicastRoutingFlowEntry, etherType),
+  IND_OFDPA_MATCH(IND_OFDPA_VRF, unicastRoutingFlowEntry, vrf, vrfMask),
+  IND_OFDPA_MATCH(IND_OFDPA_IPV4_DST, unicastRoutingFlowEntry, dstIp4, dstIp4Mask),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_IPV6_DST, unicastRoutingFlowEntry, dstIp6, dstIp6Mask),
+};
 
-  if (match->masks.tcp_src != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_TCP_L4_SRC_PORT;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_multicast_routing_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_ETHER_TYPE, multicastRoutingFlowEntry, etherType),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_VLANID, multicastRoutingFlowEntry, vlanId),
+  IND_OFDPA_MATCH(IND_OFDPA_VRF, multicastRoutingFlowEntry, vrf, vrfMask),
+  IND_OFDPA_MATCH(IND_OFDPA_IPV4_SRC, multicastRoutingFlowEntry, srcIp4, srcIp4Mask),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_IPV4_DST, multicastRoutingFlowEntry, dstIp4),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_IPV6_SRC, multicastRoutingFlowEntry, srcIp6, srcIp6Mask),
+  IND_OFDPA_MATCH_ADDR_VALUE(IND_OFDPA_IPV6_DST, multicastRoutingFlowEntry, dstIp6),
+};
+
+static const ind_ofdpa_match_field_t ind_ofdpa_match_bridging_fields[] =
+{
+  IND_OFDPA_MATCH_AND(IND_OFDPA_VLANID, bridgingFlowEntry, vlanId, vlanIdMask, IND_OFDPA_MATCH_ALL, (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK)),
+  IND_OFDPA_MATCH(IND_OFDPA_TUNNEL_ID, bridgingFlowEntry, tunnelId, tunnelIdMask),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_DSTMAC, bridgingFlowEntry, destMac, destMacMask),
+};
 
-  if (match->masks.tcp_dst != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_TCP_L4_DST_PORT;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_l2_policer_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_TUNNEL_ID, l2PolicerFlowEntry, tunnelId),
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_L2_PORT, l2PolicerFlowEntry, mplsL2Port, mplsL2PortMask),
+};
 
-  if (match->masks.udp_src != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_UDP_L4_SRC_PORT;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_l2_policer_actions_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_COLOR, l2PolicerActionsFlowEntry, color),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_COLOR_ACTIONS_INDEX, l2PolicerActionsFlowEntry, colorActionsIndex),
+};
 
-  if (match->masks.udp_dst != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_UDP_L4_DST_PORT;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_dscp_trust_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_QOS_INDEX, dscpTrustFlowEntry, qosIndex),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_IP_DSCP, dscpTrustFlowEntry, dscpValue),
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_L2_PORT, dscpTrustFlowEntry, mplsL2Port, mplsL2PortMask),
+};
 
-  if (match->masks.sctp_src != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_SCTP_L4_SRC_PORT;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_pcp_trust_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_QOS_INDEX, pcpTrustFlowEntry, qosIndex),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_VLAN_PCP, pcpTrustFlowEntry, pcpValue),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_VLAN_DEI, pcpTrustFlowEntry, dei),
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_L2_PORT, pcpTrustFlowEntry, mplsL2Port, mplsL2PortMask),
+};
 
-  if (match->masks.sctp_dst != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_SCTP_L4_DST_PORT;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_acl_policy_fields[] =
+{
+  IND_OFDPA_MATCH(IND_OFDPA_PORT, policyAclFlowEntry, inPort, inPortMask),
+  IND_OFDPA_MATCH(IND_OFDPA_MPLS_L2_PORT, policyAclFlowEntry, mplsL2Port, mplsL2PortMask),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_SRCMAC, policyAclFlowEntry, srcMac, srcMacMask),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_DSTMAC, policyAclFlowEntry, destMac, destMacMask),
+  IND_OFDPA_MATCH(IND_OFDPA_ETHER_TYPE, policyAclFlowEntry, etherType, etherTypeMask),
+  IND_OFDPA_MATCH_AND(IND_OFDPA_VLANID, policyAclFlowEntry, vlanId, vlanIdMask, IND_OFDPA_MATCH_ALL, (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK)),
+  IND_OFDPA_MATCH(IND_OFDPA_VLAN_PCP, policyAclFlowEntry, vlanPcp, vlanPcpMask),
+  IND_OFDPA_MATCH(IND_OFDPA_VLAN_DEI, policyAclFlowEntry, vlanDei, vlanDeiMask),
+  IND_OFDPA_MATCH(IND_OFDPA_TUNNEL_ID, policyAclFlowEntry, tunnelId, tunnelIdMask),
+  IND_OFDPA_MATCH(IND_OFDPA_VRF, policyAclFlowEntry, vrf, vrfMask),
+  IND_OFDPA_MATCH(IND_OFDPA_IPV4_SRC, policyAclFlowEntry, sourceIp4, sourceIp4Mask),
+  IND_OFDPA_MATCH(IND_OFDPA_IPV4_DST, policyAclFlowEntry, destIp4, destIp4Mask),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_IPV6_SRC, policyAclFlowEntry, sourceIp6, sourceIp6Mask),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_IPV6_DST, policyAclFlowEntry, destIp6, destIp6Mask),
+  IND_OFDPA_MATCH(IND_OFDPA_IPV4_ARP_SPA, policyAclFlowEntry, ipv4ArpSpa, ipv4ArpSpaMask),
+  IND_OFDPA_MATCH(IND_OFDPA_IP_PROTO, policyAclFlowEntry, ipProto, ipProtoMask),
+  IND_OFDPA_MATCH(IND_OFDPA_IP_DSCP, policyAclFlowEntry, dscp, dscpMask),
+  IND_OFDPA_MATCH(IND_OFDPA_IP_ECN, policyAclFlowEntry, ecn, ecnMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_TCP_L4_SRC_PORT, IPPROTO_TCP, policyAclFlowEntry, srcL4Port, srcL4PortMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_TCP_L4_DST_PORT, IPPROTO_TCP, policyAclFlowEntry, destL4Port, destL4PortMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_UDP_L4_SRC_PORT, IPPROTO_UDP, policyAclFlowEntry, srcL4Port, srcL4PortMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_UDP_L4_DST_PORT, IPPROTO_UDP, policyAclFlowEntry, destL4Port, destL4PortMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_SCTP_L4_SRC_PORT, IPPROTO_SCTP, policyAclFlowEntry, srcL4Port, srcL4PortMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_SCTP_L4_DST_PORT, IPPROTO_SCTP, policyAclFlowEntry, destL4Port, destL4PortMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_ICMPV4_TYPE, IPPROTO_ICMP, policyAclFlowEntry, icmpType, icmpTypeMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_ICMPV4_CODE, IPPROTO_ICMP, policyAclFlowEntry, icmpCode, icmpCodeMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_ICMPV6_TYPE, IPPROTO_ICMPV6, policyAclFlowEntry, icmpType, icmpTypeMask),
+  IND_OFDPA_MATCH_PROTO(IND_OFDPA_ICMPV6_CODE, IPPROTO_ICMPV6, policyAclFlowEntry, icmpCode, icmpCodeMask),
+  IND_OFDPA_MATCH(IND_OFDPA_IPV6_FLOW_LABEL, policyAclFlowEntry, ipv6FlowLabel, ipv6FlowLabelMask),
+};
+
+static const ind_ofdpa_match_field_t ind_ofdpa_match_color_based_actions_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_COLOR, colorActionsFlowEntry, color),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_COLOR_ACTIONS_INDEX, colorActionsFlowEntry, index),
+};
 
-  if (match->masks.icmpv4_type != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_ICMPV4_TYPE;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_egress_vlan_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_ONF_ACTSET_OUTPUT, egressVlanFlowEntry, outPort),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_VLANID, egressVlanFlowEntry, vlanId),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_ALLOW_VLAN_TRANSLATION, egressVlanFlowEntry, allowVlanTranslation),
+};
 
-  if (match->masks.icmpv4_code != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_ICMPV4_CODE;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_egress_vlan_1_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_ONF_ACTSET_OUTPUT, egressVlan1FlowEntry, outPort),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_VLANID, egressVlan1FlowEntry, vlanId),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_OVID, egressVlan1FlowEntry, ovid),
+};
 
-  if (match->masks.ipv6_flabel != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_IPV6_FLOW_LABEL;
-  }
+static const ind_ofdpa_match_field_t ind_ofdpa_match_egress_maintenance_point_fields[] =
+{
+  IND_OFDPA_MATCH_VALUE(IND_ONF_ACTSET_OUTPUT, egressMpFlowEntry, outPort),
+  IND_OFDPA_MATCH_AND(IND_OFDPA_VLANID, egressMpFlowEntry, vlanId, vlanIdMask, IND_OFDPA_MATCH_ALL, (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK)),
+  IND_OFDPA_MATCH(IND_OFDPA_ETHER_TYPE, egressMpFlowEntry, etherType, etherTypeMask),
+  IND_OFDPA_MATCH_AND(IND_OFDPA_OAM_Y1731_MDL, egressMpFlowEntry, oamY1731Mdl, oamY1731MdlMask, IND_OFDPA_MATCH_ALL, OFDPA_OAM_Y1731_MDL_EXACT_MASK),
+  IND_OFDPA_MATCH(IND_OFDPA_OAM_Y1731_OPCODE, egressMpFlowEntry, oamY1731Opcode, oamY1731OpcodeMask),
+  IND_OFDPA_MATCH_ADDR(IND_OFDPA_DSTMAC, egressMpFlowEntry, destMac, destMacMask),
+};
+
+static const ind_ofdpa_match_field_t ind_ofdpa_match_egress_dscp_pcp_remark_fields[] =
+{
+  IND_OFDPA_MATCH(IND_OFDPA_ETHER_TYPE, egressDscpPcpRemarkFlowEntry, etherType, etherTypeMask),
+  IND_OFDPA_MATCH_VALUE(IND_ONF_ACTSET_OUTPUT, egressDscpPcpRemarkFlowEntry, outPort),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_TC, egressDscpPcpRemarkFlowEntry, trafficClass),
+  IND_OFDPA_MATCH_VALUE(IND_OFDPA_COLOR, egressDscpPcpRemarkFlowEntry, color),
+};
 
-  if (match->masks.icmpv6_type != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_ICMPV6_TYPE;
-  }
+typedef struct ind_ofdpa_match_table_s
+{
+  const ind_ofdpa_match_field_t *fields;
+  int                            field_count;
+  ind_ofdpa_fields_t             allowed;       /* Fields the table can match on */
+  ind_ofdpa_fields_t             mandatory;     /* Fields that must all be present */
+  ind_ofdpa_fields_t             mandatory_alt; /* Alternative mandatory set, if nonzero */
+} ind_ofdpa_match_table_t;
 
-  if (match->masks.icmpv6_code != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_ICMPV6_CODE;
-  }
-  if (match->masks.mpls_label != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_MPLS_LABEL;
-  }
-  if (match->masks.mpls_bos != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_MPLS_BOS;
-  }
-  if (match->masks.mpls_tc != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_MPLS_TC;
-  }
-  if (match->masks.ofdpa_mpls_l2_port != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_MPLS_L2_PORT;
-  }
-  if (match->masks.ofdpa_ovid != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_OVID;
-  }
-  if (match->masks.ofdpa_vrf != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_VRF;
-  }
-  if (match->masks.ofdpa_qos_index != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_QOS_INDEX;
-  }
-  if (match->masks.ofdpa_lmep_id != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_LMEP_ID;
-  }
-  if (match->masks.ofdpa_mpls_ttl != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_MPLS_TTL;
-  }
-  if (match->masks.ofdpa_bfd_discriminator != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_BFD_DISCRIMINATOR;
-  }
-  if (match->masks.ofdpa_mpls_data_first_nibble != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_MPLS_DATA_FIRST_NIBBLE;
-  }
-  if (match->masks.ofdpa_mpls_ach_channel != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_MPLS_ACH_CHANNEL;
-  }
-  if (match->masks.ofdpa_mpls_next_label_is_gal != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_MPLS_NEXT_LABEL_IS_GAL;
-  }
-  if (match->masks.ofdpa_oam_y1731_mdl != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_OAM_Y1731_MDL;
-  }
-  if (match->masks.ofdpa_oam_y1731_opcode != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_OAM_Y1731_OPCODE;
-  }
-  if (match->masks.ofdpa_color_actions_index != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_COLOR_ACTIONS_INDEX;
-  }
-  if (match->masks.ofdpa_txfcl != 0)
-  {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_TXFCL;
-  }
-  if (match->masks.ofdpa_rxfcl != 0)
+#define IND_OFDPA_MATCH_TABLE(fields) fields, AIM_ARRAYSIZE(fields)
+
+/* Indexed by OF-DPA table id; tables without a field layout are invalid */
+static const ind_ofdpa_match_table_t ind_ofdpa_match_tables[256] =
+{
+  [OFDPA_FLOW_TABLE_ID_INGRESS_PORT] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_ingress_port_fields),
+      IND_OFDPA_ING_PORT_FLOW_MATCH_BITMAP, IND_OFDPA_ING_PORT_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_INJECTED_OAM] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_injected_oam_fields),
+      IND_OFDPA_INJECTED_OAM_FLOW_MATCH_BITMAP, IND_OFDPA_INJECTED_OAM_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_VLAN] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_vlan_fields),
+      IND_OFDPA_VLAN_FLOW_MATCH_BITMAP, IND_OFDPA_VLAN_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_VLAN_1] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_vlan_1_fields),
+      IND_OFDPA_VLAN1_FLOW_MATCH_BITMAP, IND_OFDPA_VLAN1_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_MAINTENANCE_POINT] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_maintenance_point_fields),
+      IND_OFDPA_MP_FLOW_MATCH_BITMAP, IND_OFDPA_MP_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_MPLS_L2_PORT] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_mpls_l2_port_fields),
+      IND_OFDPA_MPLS_L2_PORT_FLOW_MATCH_BITMAP, IND_OFDPA_MPLS_L2_PORT_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_TERMINATION_MAC] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_termination_mac_fields),
+      IND_OFDPA_TERM_MAC_FLOW_MATCH_BITMAP, IND_OFDPA_TERM_MAC_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_MPLS_0] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_mpls_fields),
+      IND_OFDPA_MPLS_FLOW_MATCH_BITMAP, IND_OFDPA_MPLS_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_MPLS_1] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_mpls_fields),
+      IND_OFDPA_MPLS_FLOW_MATCH_BITMAP, IND_OFDPA_MPLS_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_MPLS_2] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_mpls_fields),
+      IND_OFDPA_MPLS_FLOW_MATCH_BITMAP, IND_OFDPA_MPLS_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_MPLS_MAINTENANCE_POINT] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_mpls_maintenance_point_fields),
+      IND_OFDPA_MPLS_MP_FLOW_MATCH_BITMAP, IND_OFDPA_MPLS_MP_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_unicast_routing_fields),
+      IND_OFDPA_UCAST_ROUTING_FLOW_MATCH_BITMAP, IND_OFDPA_UCAST_ROUTINGV4_FLOW_MATCH_MAND_BITMAP, IND_OFDPA_UCAST_ROUTINGV6_FLOW_MATCH_MAND_BITMAP },
+  [OFDPA_FLOW_TABLE_ID_MULTICAST_ROUTING] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_multicast_routing_fields),
+      IND_OFDPA_MCAST_ROUTING_FLOW_MATCH_BITMAP, IND_OFDPA_MCAST_ROUTINGV4_FLOW_MATCH_MAND_BITMAP, IND_OFDPA_MCAST_ROUTINGV6_FLOW_MATCH_MAND_BITMAP },
+  [OFDPA_FLOW_TABLE_ID_BRIDGING] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_bridging_fields),
+      IND_OFDPA_BRIDGING_FLOW_MATCH_BITMAP, 0, 0 },
+  [OFDPA_FLOW_TABLE_ID_L2_POLICER] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_l2_policer_fields),
+      IND_OFDPA_L2_POLICER_FLOW_MATCH_BITMAP, IND_OFDPA_L2_POLICER_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_L2_POLICER_ACTIONS] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_l2_policer_actions_fields),
+      IND_OFDPA_L2_POLICER_ACTIONS_FLOW_MATCH_BITMAP, IND_OFDPA_L2_POLICER_ACTIONS_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_PORT_DSCP_TRUST] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_dscp_trust_fields),
+      IND_OFDPA_DSCP_TRUST_FLOW_MATCH_BITMAP, IND_OFDPA_DSCP_TRUST_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_TUNNEL_DSCP_TRUST] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_dscp_trust_fields),
+      IND_OFDPA_DSCP_TRUST_FLOW_MATCH_BITMAP, IND_OFDPA_DSCP_TRUST_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_MPLS_DSCP_TRUST] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_dscp_trust_fields),
+      IND_OFDPA_DSCP_TRUST_FLOW_MATCH_BITMAP, IND_OFDPA_DSCP_TRUST_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_PORT_PCP_TRUST] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_pcp_trust_fields),
+      IND_OFDPA_PCP_TRUST_FLOW_MATCH_BITMAP, IND_OFDPA_PCP_TRUST_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_TUNNEL_PCP_TRUST] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_pcp_trust_fields),
+      IND_OFDPA_PCP_TRUST_FLOW_MATCH_BITMAP, IND_OFDPA_PCP_TRUST_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_MPLS_PCP_TRUST] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_pcp_trust_fields),
+      IND_OFDPA_PCP_TRUST_FLOW_MATCH_BITMAP, IND_OFDPA_PCP_TRUST_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_ACL_POLICY] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_acl_policy_fields),
+      IND_OFDPA_ACL_POLICY_FLOW_MATCH_BITMAP, 0, 0 },
+  [OFDPA_FLOW_TABLE_ID_COLOR_BASED_ACTIONS] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_color_based_actions_fields),
+      IND_OFDPA_COLOR_BASED_ACTIONS_FLOW_MATCH_BITMAP, IND_OFDPA_COLOR_BASED_ACTIONS_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_EGRESS_VLAN] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_egress_vlan_fields),
+      IND_OFDPA_EGRESS_VLAN_FLOW_MATCH_BITMAP, IND_OFDPA_EGRESS_VLAN_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_EGRESS_VLAN_1] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_egress_vlan_1_fields),
+      IND_OFDPA_EGRESS_VLAN1_FLOW_MATCH_BITMAP, IND_OFDPA_EGRESS_VLAN1_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_EGRESS_MAINTENANCE_POINT] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_egress_maintenance_point_fields),
+      IND_OFDPA_EGRESS_MP_FLOW_MATCH_BITMAP, IND_OFDPA_EGRESS_MP_FLOW_MATCH_MAND_BITMAP, 0 },
+  [OFDPA_FLOW_TABLE_ID_EGRESS_DSCP_PCP_REMARK] = { IND_OFDPA_MATCH_TABLE(ind_ofdpa_match_egress_dscp_pcp_remark_fields),
+      IND_OFDPA_EGRESS_DSCP_PCP_REM_FLOW_MATCH_BITMAP, IND_OFDPA_EGRESS_DSCP_PCP_REM_FLOW_MATCH_MAND_BITMAP, 0 },
+};
+
+static uint64_t ind_ofdpa_oxm_uint_get(const uint8_t *buf, int len)
+{
+  uint64_t val = 0;
+  int i;
+
+  for (i = 0; i < len; i++)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_RXFCL;
+    val = (val << 8) | buf[i];
   }
-  if (match->masks.ofdpa_rx_timestamp != 0)
+  return val;
+}
+
+static void ind_ofdpa_match_uint_set(uint8_t *dst, int size, uint64_t val)
+{
+  uint8_t  v8;
+  uint16_t v16;
+  uint32_t v32;
+
+  switch (size)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_RX_TIMESTAMP;
+    case 1:
+      v8 = val;
+      memcpy(dst, &v8, size);
+      break;
+    case 2:
+      v16 = val;
+      memcpy(dst, &v16, size);
+      break;
+    case 4:
+      v32 = val;
+      memcpy(dst, &v32, size);
+      break;
+    case 8:
+      memcpy(dst, &val, size);
+      break;
+    default:
+      break;
   }
-  if (match->masks.ofdpa_l3_in_port != 0)
+}
+
+/*
+ * Match shapes
+ *
+ * Flows in a table use few distinct sets of match fields; bridging flows
+ * match VLAN and MAC, or VLAN alone. The result of validating a set
+ * against the table, and which of the table's field layouts it fills in,
+ * only depend on the set (and on ip_proto, which selects the L4 port
+ * layouts), so they are kept per table for the shapes seen most recently
+ * and the per-flow work is only decoding the values.
+ */
+#define IND_OFDPA_MATCH_SHAPES_PER_TABLE 8
+#define IND_OFDPA_MATCH_SHAPE_FIELDS     32
+
+typedef struct ind_ofdpa_match_shape_s
+{
+  ind_ofdpa_fields_t present;
+  uint8_t            ip_proto;
+  uint8_t            valid;
+  uint8_t            field_count;
+  indigo_error_t     result;       /* Of validating the fields against the table */
+  uint8_t            fields[IND_OFDPA_MATCH_SHAPE_FIELDS]; /* Indexes of the table fields to apply */
+} ind_ofdpa_match_shape_t;
+
+typedef struct ind_ofdpa_match_shapes_s
+{
+  ind_ofdpa_match_shape_t shapes[IND_OFDPA_MATCH_SHAPES_PER_TABLE];
+  uint8_t                 next;    /* Next shape to replace */
+} ind_ofdpa_match_shapes_t;
+
+/* Indexed by OF-DPA table id, allocated on first use */
+static ind_ofdpa_match_shapes_t *ind_ofdpa_match_shapes[256];
+
+static void ind_ofdpa_match_shape_build(const ind_ofdpa_match_table_t *table,
+                                        ind_ofdpa_fields_t present, uint8_t ip_proto,
+                                        ind_ofdpa_match_shape_t *shape)
+{
+  const ind_ofdpa_match_field_t *field;
+  int i;
+
+  shape->present = present;
+  shape->ip_proto = ip_proto;
+  shape->field_count = 0;
+  shape->valid = 1;
+
+  if (((present | table->allowed) != table->allowed) ||
+      (((present & table->mandatory) != table->mandatory) &&
+       ((table->mandatory_alt == 0) ||
+        ((present & table->mandatory_alt) != table->mandatory_alt))))
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_L3_IN_PORT;
+    shape->result = INDIGO_ERROR_COMPAT;
+    return;
   }
-  if (match->masks.ofdpa_protection_index != 0)
+  shape->result = INDIGO_ERROR_NONE;
+
+  for (i = 0; i < table->field_count; i++)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_PROTECTION_INDEX;
+    field = &table->fields[i];
+    if (!(present & field->field) ||
+        (field->ip_proto != 0 && field->ip_proto != ip_proto))
+    {
+      continue;
+    }
+    AIM_TRUE_OR_DIE(shape->field_count < IND_OFDPA_MATCH_SHAPE_FIELDS);
+    shape->fields[shape->field_count++] = i;
   }
-  if (match->masks.ofdpa_color != 0)
+}
+
+static const ind_ofdpa_match_shape_t *
+ind_ofdpa_match_shape_get(OFDPA_FLOW_TABLE_ID_t tableId,
+                          const ind_ofdpa_match_table_t *table,
+                          ind_ofdpa_fields_t present, uint8_t ip_proto)
+{
+  ind_ofdpa_match_shapes_t *shapes = ind_ofdpa_match_shapes[tableId];
+  ind_ofdpa_match_shape_t *shape;
+  int i;
+
+  if (shapes == NULL)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_COLOR;
+    shapes = aim_zmalloc(sizeof(*shapes));
+    ind_ofdpa_match_shapes[tableId] = shapes;
   }
-  if (match->masks.ofdpa_traffic_class != 0)
+
+  for (i = 0; i < IND_OFDPA_MATCH_SHAPES_PER_TABLE; i++)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_TC;
+    shape = &shapes->shapes[i];
+    if (shape->valid && shape->present == present && shape->ip_proto == ip_proto)
+    {
+      return shape;
+    }
   }
-  if (match->masks.ofdpa_allow_vlan_translation != 0)
+
+  shape = &shapes->shapes[shapes->next];
+  shapes->next = (shapes->next + 1) % IND_OFDPA_MATCH_SHAPES_PER_TABLE;
+  ind_ofdpa_match_shape_build(table, present, ip_proto, shape);
+  return shape;
+}
+
+/* Value of the ip_proto OXM, if any, as the L4 field layouts key on it */
+static uint8_t ind_ofdpa_match_ip_proto(const ind_ofdpa_match_oxms_t *oxms)
+{
+  uint64_t ip_proto;
+  int index;
+
+  if (!(oxms->present & IND_OFDPA_IP_PROTO))
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_OFDPA_ALLOW_VLAN_TRANSLATION;
+    return 0;
   }
-  if (match->masks.onf_actset_output != 0)
+
+  index = __builtin_ctzll(IND_OFDPA_IP_PROTO);
+  ip_proto = ind_ofdpa_oxm_uint_get(oxms->value[index], oxms->len[index]);
+  if (oxms->mask[index] != NULL)
   {
-    *ind_ofdpa_match_fields_bitmask |= IND_ONF_ACTSET_OUTPUT;
+    ip_proto &= ind_ofdpa_oxm_uint_get(oxms->mask[index], oxms->len[index]);
   }
-  LOG_TRACE("match_fields_bitmask is 0x%llX", *ind_ofdpa_match_fields_bitmask);
+  return ip_proto;
 }
 
-/* Get the flow match criteria from of_match */
-
-static indigo_error_t ind_ofdpa_match_fields_masks_get(const of_match_t *match, ofdpaFlowEntry_t *flow)
+/*
+ * Decode the collected OXMs straight into the flow entry. As in a LOCI
+ * of_match_t, exact matches get an all ones mask and values are cleared
+ * outside their mask; absent fields are left zero.
+ */
+static void ind_ofdpa_match_fields_apply(const ind_ofdpa_match_table_t *table,
+                                         const ind_ofdpa_match_shape_t *shape,
+                                         const ind_ofdpa_match_oxms_t *oxms,
+                                         ofdpaFlowEntry_t *flow)
 {
-  indigo_error_t err = INDIGO_ERROR_NONE;
-  ind_ofdpa_fields_t ind_ofdpa_match_fields_bitmask;
-
-  ind_ofdpa_populate_flow_bitmask(match, &ind_ofdpa_match_fields_bitmask);
+  const ind_ofdpa_match_field_t *field;
+  uint8_t *base = (uint8_t *)flow;
+  uint64_t value, mask;
+  int index, len;
+  int i, j;
 
-  switch (flow->tableId)
+  for (i = 0; i < shape->field_count; i++)
   {
-    case OFDPA_FLOW_TABLE_ID_INGRESS_PORT:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_ING_PORT_FLOW_MATCH_BITMAP) != IND_OFDPA_ING_PORT_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_ING_PORT_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_ING_PORT_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.ingressPortFlowEntry.match_criteria.inPort        = match->fields.in_port;
-        flow->flowData.ingressPortFlowEntry.match_criteria.inPortMask    = match->masks.in_port;
-        flow->flowData.ingressPortFlowEntry.match_criteria.tunnelId      = match->fields.tunnel_id;
-        flow->flowData.ingressPortFlowEntry.match_criteria.tunnelIdMask  = match->masks.tunnel_id;
-        flow->flowData.ingressPortFlowEntry.match_criteria.etherType     = match->fields.eth_type;
-        flow->flowData.ingressPortFlowEntry.match_criteria.etherTypeMask = match->masks.eth_type;
-        flow->flowData.ingressPortFlowEntry.match_criteria.lmepId        = match->fields.ofdpa_lmep_id;
-        flow->flowData.ingressPortFlowEntry.match_criteria.lmepIdMask    = match->masks.ofdpa_lmep_id;
-      }
-      break;
+    field = &table->fields[shape->fields[i]];
+    index = __builtin_ctzll(field->field);
+    len = oxms->len[index];
 
-    case OFDPA_FLOW_TABLE_ID_INJECTED_OAM:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_INJECTED_OAM_FLOW_MATCH_BITMAP) != IND_OFDPA_INJECTED_OAM_FLOW_MATCH_BITMAP)
-      {
-       err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_INJECTED_OAM_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_INJECTED_OAM_FLOW_MATCH_MAND_BITMAP)
-      {
-       err = INDIGO_ERROR_COMPAT;
-      }
-      else
+    if (field->is_addr)
+    {
+      for (j = 0; j < len && j < field->size; j++)
       {
-        flow->flowData.injectedOamFlowEntry.match_criteria.lmepId = match->fields.ofdpa_lmep_id;
+        mask = (oxms->mask[index] != NULL) ? oxms->mask[index][j] : 0xff;
+        base[field->value_offset + j] = oxms->value[index][j] & mask;
+        if (field->mask_offset != 0)
+        {
+          base[field->mask_offset + j] = mask;
+        }
       }
-      break;
+      continue;
+    }
 
-    case OFDPA_FLOW_TABLE_ID_VLAN:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_VLAN_FLOW_MATCH_BITMAP) != IND_OFDPA_VLAN_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_VLAN_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_VLAN_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.vlanFlowEntry.match_criteria.inPort        = match->fields.in_port;
-        flow->flowData.vlanFlowEntry.match_criteria.vlanId        = match->fields.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
-        flow->flowData.vlanFlowEntry.match_criteria.vlanIdMask    = match->masks.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
-      }
-      break;
+    mask = (len < 8) ? ((1ULL << (8 * len)) - 1) : IND_OFDPA_MATCH_ALL;
+    if (oxms->mask[index] != NULL)
+    {
+      mask = ind_ofdpa_oxm_uint_get(oxms->mask[index], len);
+    }
+    value = ind_ofdpa_oxm_uint_get(oxms->value[index], len) & mask;
 
-    case OFDPA_FLOW_TABLE_ID_VLAN_1:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_VLAN1_FLOW_MATCH_BITMAP) != IND_OFDPA_VLAN1_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_VLAN1_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_VLAN1_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.vlan1FlowEntry.match_criteria.inPort        = match->fields.in_port;
-        flow->flowData.vlan1FlowEntry.match_criteria.vlanId        = match->fields.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
-        flow->flowData.vlan1FlowEntry.match_criteria.ovid          = match->fields.ofdpa_ovid;
-      }
-      break;
+    ind_ofdpa_match_uint_set(base + field->value_offset, field->size, value & field->value_and);
+    if (field->mask_offset != 0)
+    {
+      ind_ofdpa_match_uint_set(base + field->mask_offset, field->size, mask & field->mask_and);
+    }
+  }
+}
 
-    case OFDPA_FLOW_TABLE_ID_MAINTENANCE_POINT:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_MP_FLOW_MATCH_BITMAP) != IND_OFDPA_MP_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_MP_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_MP_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.mpFlowEntry.match_criteria.etherType          = match->fields.eth_type;
-        flow->flowData.mpFlowEntry.match_criteria.etherTypeMask      = match->masks.eth_type;
-        flow->flowData.mpFlowEntry.match_criteria.oamY1731Mdl        = match->fields.ofdpa_oam_y1731_mdl;
-        flow->flowData.mpFlowEntry.match_criteria.oamY1731MdlMask    = match->masks.ofdpa_oam_y1731_mdl & OFDPA_OAM_Y1731_MDL_EXACT_MASK;
-        flow->flowData.mpFlowEntry.match_criteria.oamY1731Opcode     = match->fields.ofdpa_oam_y1731_opcode;
-        flow->flowData.mpFlowEntry.match_criteria.oamY1731OpcodeMask = match->masks.ofdpa_oam_y1731_opcode;
-        flow->flowData.mpFlowEntry.match_criteria.inPort             = match->fields.in_port;
-        flow->flowData.mpFlowEntry.match_criteria.vlanId             = match->fields.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
-        flow->flowData.mpFlowEntry.match_criteria.vlanIdMask         = match->masks.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
+/* Get the flow match criteria from the flow_mod OXMs */
 
-        memcpy(flow->flowData.mpFlowEntry.match_criteria.destMac.addr, &match->fields.eth_dst, OF_MAC_ADDR_BYTES);
-        memcpy(flow->flowData.mpFlowEntry.match_criteria.destMacMask.addr, &match->masks.eth_dst, OF_MAC_ADDR_BYTES);
-      }
-      break;
+static indigo_error_t ind_ofdpa_match_fields_masks_get(of_flow_add_t *flow_add, ofdpaFlowEntry_t *flow)
+{
+  const ind_ofdpa_match_table_t *table;
+  const ind_ofdpa_match_shape_t *shape;
+  ind_ofdpa_match_oxms_t oxms;
 
-    case OFDPA_FLOW_TABLE_ID_MPLS_L2_PORT:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_MPLS_L2_PORT_FLOW_MATCH_BITMAP) != IND_OFDPA_MPLS_L2_PORT_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_MPLS_L2_PORT_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_MPLS_L2_PORT_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.mplsL2PortFlowEntry.match_criteria.mplsL2Port     = match->fields.ofdpa_mpls_l2_port;
-        flow->flowData.mplsL2PortFlowEntry.match_criteria.mplsL2PortMask = match->masks.ofdpa_mpls_l2_port;
-        flow->flowData.mplsL2PortFlowEntry.match_criteria.etherType      = match->fields.eth_type;
-        flow->flowData.mplsL2PortFlowEntry.match_criteria.etherTypeMask  = match->masks.eth_type;
-        flow->flowData.mplsL2PortFlowEntry.match_criteria.tunnelId       = match->fields.tunnel_id;
-      }
-      break;
+  if (flow->tableId >= AIM_ARRAYSIZE(ind_ofdpa_match_tables) ||
+      ind_ofdpa_match_tables[flow->tableId].fields == NULL)
+  {
+    LOG_ERROR("Invalid table id %d", flow->tableId);
+    return INDIGO_ERROR_PARAM;
+  }
+  table = &ind_ofdpa_match_tables[flow->tableId];
 
-    case OFDPA_FLOW_TABLE_ID_TERMINATION_MAC:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_TERM_MAC_FLOW_MATCH_BITMAP) != IND_OFDPA_TERM_MAC_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_TERM_MAC_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_TERM_MAC_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.terminationMacFlowEntry.match_criteria.inPort     = match->fields.in_port;
-        flow->flowData.terminationMacFlowEntry.match_criteria.inPortMask = match->masks.in_port;
-        flow->flowData.terminationMacFlowEntry.match_criteria.etherType  = match->fields.eth_type;
+  oxms.present = 0;
+  memset(oxms.value, 0, sizeof(oxms.value));
+  if (of_flow_mod_match_oxm_visit(flow_add, ind_ofdpa_match_oxm_collect, &oxms) < 0)
+  {
+    LOG_ERROR("Error getting openflow match criteria.");
+    return INDIGO_ERROR_UNKNOWN;
+  }
 
-        memcpy(flow->flowData.terminationMacFlowEntry.match_criteria.destMac.addr, &match->fields.eth_dst, OF_MAC_ADDR_BYTES);
-        memcpy(flow->flowData.terminationMacFlowEntry.match_criteria.destMacMask.addr, &match->masks.eth_dst, OF_MAC_ADDR_BYTES);
+  LOG_TRACE("match_fields_bitmask is 0x%llX", oxms.present);
 
-        flow->flowData.terminationMacFlowEntry.match_criteria.vlanId     = match->fields.vlan_vid;
-        flow->flowData.terminationMacFlowEntry.match_criteria.vlanIdMask = match->masks.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
-      }
-      break;
+  shape = ind_ofdpa_match_shape_get(flow->tableId, table, oxms.present,
+                                    ind_ofdpa_match_ip_proto(&oxms));
+  if (shape->result != INDIGO_ERROR_NONE)
+  {
+    LOG_ERROR("Incompatible match field(s) for table %d.", flow->tableId);
+    return shape->result;
+  }
 
-    case OFDPA_FLOW_TABLE_ID_MPLS_0:
-    case OFDPA_FLOW_TABLE_ID_MPLS_1:
-    case OFDPA_FLOW_TABLE_ID_MPLS_2:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_MPLS_FLOW_MATCH_BITMAP) != IND_OFDPA_MPLS_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_MPLS_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_MPLS_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.mplsFlowEntry.match_criteria.etherType               = match->fields.eth_type;
-        flow->flowData.mplsFlowEntry.match_criteria.mplsBos                 = match->fields.mpls_bos;
-        flow->flowData.mplsFlowEntry.match_criteria.mplsLabel               = match->fields.mpls_label;
-        flow->flowData.mplsFlowEntry.match_criteria.inPort                  = match->fields.in_port;
-        flow->flowData.mplsFlowEntry.match_criteria.inPortMask              = match->masks.in_port;
-        flow->flowData.mplsFlowEntry.match_criteria.mplsTtl                 = match->fields.ofdpa_mpls_ttl;
-        flow->flowData.mplsFlowEntry.match_criteria.mplsTtlMask             = match->masks.ofdpa_mpls_ttl;
-        flow->flowData.mplsFlowEntry.match_criteria.mplsDataFirstNibble     = match->fields.ofdpa_mpls_data_first_nibble;
-        flow->flowData.mplsFlowEntry.match_criteria.mplsDataFirstNibbleMask = match->masks.ofdpa_mpls_data_first_nibble;
-        flow->flowData.mplsFlowEntry.match_criteria.mplsAchChannel          = match->fields.ofdpa_mpls_ach_channel;
-        flow->flowData.mplsFlowEntry.match_criteria.mplsAchChannelMask      = match->masks.ofdpa_mpls_ach_channel;
-        flow->flowData.mplsFlowEntry.match_criteria.nextLabelIsGal          = match->fields.ofdpa_mpls_next_label_is_gal;
-        flow->flowData.mplsFlowEntry.match_criteria.nextLabelIsGalMask      = match->masks.ofdpa_mpls_next_label_is_gal;
-        flow->flowData.mplsFlowEntry.match_criteria.destIp4                 = match->fields.ipv4_dst;
-        flow->flowData.mplsFlowEntry.match_criteria.destIp4Mask             = match->masks.ipv4_dst;
-
-        memcpy(&flow->flowData.mplsFlowEntry.match_criteria.destIp6, &match->fields.ipv6_dst, OF_IPV6_BYTES);
-        memcpy(&flow->flowData.mplsFlowEntry.match_criteria.destIp6Mask, &match->masks.ipv6_dst, OF_IPV6_BYTES);
-
-        flow->flowData.mplsFlowEntry.match_criteria.ipProto        = match->fields.ip_proto;
-        flow->flowData.mplsFlowEntry.match_criteria.ipProtoMask    = match->masks.ip_proto;
-        flow->flowData.mplsFlowEntry.match_criteria.udpSrcPort     = match->fields.udp_src;
-        flow->flowData.mplsFlowEntry.match_criteria.udpSrcPortMask = match->masks.udp_src;
-        flow->flowData.mplsFlowEntry.match_criteria.udpDstPort     = match->fields.udp_dst;
-        flow->flowData.mplsFlowEntry.match_criteria.udpDstPortMask = match->masks.udp_dst;
-      }
-      break;
+  ind_ofdpa_match_fields_apply(table, shape, &oxms, flow);
 
-    case OFDPA_FLOW_TABLE_ID_MPLS_MAINTENANCE_POINT:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_MPLS_MP_FLOW_MATCH_BITMAP) != IND_OFDPA_MPLS_MP_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_MPLS_MP_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_MPLS_MP_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.mplsMpFlowEntry.match_criteria.lmepId         = match->fields.ofdpa_lmep_id;
-        flow->flowData.mplsMpFlowEntry.match_criteria.oamY1731Opcode = match->fields.ofdpa_oam_y1731_opcode;
-        flow->flowData.mplsMpFlowEntry.match_criteria.etherType      = match->fields.eth_type;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_UCAST_ROUTING_FLOW_MATCH_BITMAP) != IND_OFDPA_UCAST_ROUTING_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if (((ind_ofdpa_match_fields_bitmask & IND_OFDPA_UCAST_ROUTINGV4_FLOW_MATCH_MAND_BITMAP)
-                  != IND_OFDPA_UCAST_ROUTINGV4_FLOW_MATCH_MAND_BITMAP) &&
-               ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_UCAST_ROUTINGV6_FLOW_MATCH_MAND_BITMAP)
-                  != IND_OFDPA_UCAST_ROUTINGV6_FLOW_MATCH_MAND_BITMAP))
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.unicastRoutingFlowEntry.match_criteria.etherType  = match->fields.eth_type;
-        flow->flowData.unicastRoutingFlowEntry.match_criteria.vrf        = match->fields.ofdpa_vrf;
-        flow->flowData.unicastRoutingFlowEntry.match_criteria.vrfMask    = match->masks.ofdpa_vrf;
-        flow->flowData.unicastRoutingFlowEntry.match_criteria.dstIp4     = match->fields.ipv4_dst;
-        flow->flowData.unicastRoutingFlowEntry.match_criteria.dstIp4Mask = match->masks.ipv4_dst;
-
-        memcpy(&flow->flowData.unicastRoutingFlowEntry.match_criteria.dstIp6, &match->fields.ipv6_dst, OF_IPV6_BYTES);
-        memcpy(&flow->flowData.unicastRoutingFlowEntry.match_criteria.dstIp6Mask, &match->masks.ipv6_dst, OF_IPV6_BYTES);
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_MULTICAST_ROUTING:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_MCAST_ROUTING_FLOW_MATCH_BITMAP) != IND_OFDPA_MCAST_ROUTING_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if (((ind_ofdpa_match_fields_bitmask & IND_OFDPA_MCAST_ROUTINGV4_FLOW_MATCH_MAND_BITMAP)
-                  != IND_OFDPA_MCAST_ROUTINGV4_FLOW_MATCH_MAND_BITMAP) &&
-               ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_MCAST_ROUTINGV6_FLOW_MATCH_MAND_BITMAP)
-                  != IND_OFDPA_MCAST_ROUTINGV6_FLOW_MATCH_MAND_BITMAP))
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.multicastRoutingFlowEntry.match_criteria.etherType  = match->fields.eth_type;
-        flow->flowData.multicastRoutingFlowEntry.match_criteria.vlanId     = match->fields.vlan_vid;
-        flow->flowData.multicastRoutingFlowEntry.match_criteria.vrf        = match->fields.ofdpa_vrf;
-        flow->flowData.multicastRoutingFlowEntry.match_criteria.vrfMask    = match->masks.ofdpa_vrf;
-        flow->flowData.multicastRoutingFlowEntry.match_criteria.srcIp4     = match->fields.ipv4_src;
-        flow->flowData.multicastRoutingFlowEntry.match_criteria.srcIp4Mask = match->masks.ipv4_src;
-        flow->flowData.multicastRoutingFlowEntry.match_criteria.dstIp4     = match->fields.ipv4_dst;
-
-        memcpy(flow->flowData.multicastRoutingFlowEntry.match_criteria.srcIp6.s6_addr, match->fields.ipv6_src.addr, OF_IPV6_BYTES);
-        memcpy(flow->flowData.multicastRoutingFlowEntry.match_criteria.srcIp6Mask.s6_addr, match->masks.ipv6_src.addr, OF_IPV6_BYTES);
-        memcpy(flow->flowData.multicastRoutingFlowEntry.match_criteria.dstIp6.s6_addr, match->fields.ipv6_dst.addr, OF_IPV6_BYTES);
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_BRIDGING:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_BRIDGING_FLOW_MATCH_BITMAP) != IND_OFDPA_BRIDGING_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.bridgingFlowEntry.match_criteria.vlanId       = match->fields.vlan_vid;
-        flow->flowData.bridgingFlowEntry.match_criteria.vlanIdMask   = match->masks.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
-        flow->flowData.bridgingFlowEntry.match_criteria.tunnelId     = match->fields.tunnel_id;
-        flow->flowData.bridgingFlowEntry.match_criteria.tunnelIdMask = match->masks.tunnel_id;
-
-        memcpy(flow->flowData.bridgingFlowEntry.match_criteria.destMac.addr, &match->fields.eth_dst, OF_MAC_ADDR_BYTES);
-        memcpy(flow->flowData.bridgingFlowEntry.match_criteria.destMacMask.addr, &match->masks.eth_dst, OF_MAC_ADDR_BYTES);
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_L2_POLICER:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_L2_POLICER_FLOW_MATCH_BITMAP) != IND_OFDPA_L2_POLICER_FLOW_MATCH_BITMAP)
-      {
-       err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_L2_POLICER_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_L2_POLICER_FLOW_MATCH_MAND_BITMAP)
-      {
-       err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.l2PolicerFlowEntry.match_criteria.tunnelId       = match->fields.tunnel_id;
-        flow->flowData.l2PolicerFlowEntry.match_criteria.mplsL2Port     = match->fields.ofdpa_mpls_l2_port;
-        flow->flowData.l2PolicerFlowEntry.match_criteria.mplsL2PortMask = match->masks.ofdpa_mpls_l2_port;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_L2_POLICER_ACTIONS:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_L2_POLICER_ACTIONS_FLOW_MATCH_BITMAP) != IND_OFDPA_L2_POLICER_ACTIONS_FLOW_MATCH_BITMAP)
-      {
-       err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_L2_POLICER_ACTIONS_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_L2_POLICER_ACTIONS_FLOW_MATCH_MAND_BITMAP)
-      {
-       err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.l2PolicerActionsFlowEntry.match_criteria.color             = match->fields.ofdpa_color;
-        flow->flowData.l2PolicerActionsFlowEntry.match_criteria.colorActionsIndex = match->fields.ofdpa_color_actions_index;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_PORT_DSCP_TRUST:
-    case OFDPA_FLOW_TABLE_ID_TUNNEL_DSCP_TRUST:
-    case OFDPA_FLOW_TABLE_ID_MPLS_DSCP_TRUST:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_DSCP_TRUST_FLOW_MATCH_BITMAP) != IND_OFDPA_DSCP_TRUST_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_DSCP_TRUST_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_DSCP_TRUST_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.dscpTrustFlowEntry.match_criteria.qosIndex       = match->fields.ofdpa_qos_index;
-        flow->flowData.dscpTrustFlowEntry.match_criteria.dscpValue      = match->fields.ip_dscp;
-        flow->flowData.dscpTrustFlowEntry.match_criteria.mplsL2Port     = match->fields.ofdpa_mpls_l2_port;
-        flow->flowData.dscpTrustFlowEntry.match_criteria.mplsL2PortMask = match->masks.ofdpa_mpls_l2_port;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_PORT_PCP_TRUST:
-    case OFDPA_FLOW_TABLE_ID_TUNNEL_PCP_TRUST:
-    case OFDPA_FLOW_TABLE_ID_MPLS_PCP_TRUST:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_PCP_TRUST_FLOW_MATCH_BITMAP) != IND_OFDPA_PCP_TRUST_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_PCP_TRUST_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_PCP_TRUST_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.pcpTrustFlowEntry.match_criteria.qosIndex       = match->fields.ofdpa_qos_index;
-        flow->flowData.pcpTrustFlowEntry.match_criteria.pcpValue       = match->fields.vlan_pcp;
-        flow->flowData.pcpTrustFlowEntry.match_criteria.dei            = match->fields.ofdpa_dei;
-        flow->flowData.pcpTrustFlowEntry.match_criteria.mplsL2Port     = match->fields.ofdpa_mpls_l2_port;
-        flow->flowData.pcpTrustFlowEntry.match_criteria.mplsL2PortMask = match->masks.ofdpa_mpls_l2_port;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_ACL_POLICY:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_ACL_POLICY_FLOW_MATCH_BITMAP) != IND_OFDPA_ACL_POLICY_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.policyAclFlowEntry.match_criteria.inPort         = match->fields.in_port;
-        flow->flowData.policyAclFlowEntry.match_criteria.inPortMask     = match->masks.in_port;
-        flow->flowData.policyAclFlowEntry.match_criteria.mplsL2Port     = match->fields.ofdpa_mpls_l2_port;
-        flow->flowData.policyAclFlowEntry.match_criteria.mplsL2PortMask = match->masks.ofdpa_mpls_l2_port;
-
-        memcpy(flow->flowData.policyAclFlowEntry.match_criteria.srcMac.addr, &match->fields.eth_src, OF_MAC_ADDR_BYTES);
-        memcpy(flow->flowData.policyAclFlowEntry.match_criteria.srcMacMask.addr, &match->masks.eth_src, OF_MAC_ADDR_BYTES);
-        memcpy(flow->flowData.policyAclFlowEntry.match_criteria.destMac.addr, &match->fields.eth_dst, OF_MAC_ADDR_BYTES);
-        memcpy(flow->flowData.policyAclFlowEntry.match_criteria.destMacMask.addr, &match->masks.eth_dst, OF_MAC_ADDR_BYTES);
-
-        flow->flowData.policyAclFlowEntry.match_criteria.etherType     = match->fields.eth_type;
-        flow->flowData.policyAclFlowEntry.match_criteria.etherTypeMask = match->masks.eth_type;
-        flow->flowData.policyAclFlowEntry.match_criteria.vlanId        = match->fields.vlan_vid;
-        flow->flowData.policyAclFlowEntry.match_criteria.vlanIdMask    = match->masks.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
-        flow->flowData.policyAclFlowEntry.match_criteria.vlanPcp       = match->fields.vlan_pcp;
-        flow->flowData.policyAclFlowEntry.match_criteria.vlanPcpMask   = match->masks.vlan_pcp;
-        flow->flowData.policyAclFlowEntry.match_criteria.vlanDei       = match->fields.ofdpa_dei;
-        flow->flowData.policyAclFlowEntry.match_criteria.vlanDeiMask   = match->masks.ofdpa_dei;
-        flow->flowData.policyAclFlowEntry.match_criteria.tunnelId      = match->fields.tunnel_id;
-        flow->flowData.policyAclFlowEntry.match_criteria.tunnelIdMask  = match->masks.tunnel_id;
-        flow->flowData.policyAclFlowEntry.match_criteria.vrf           = match->fields.ofdpa_vrf;
-        flow->flowData.policyAclFlowEntry.match_criteria.vrfMask       = match->masks.ofdpa_vrf;
-        flow->flowData.policyAclFlowEntry.match_criteria.sourceIp4     = match->fields.ipv4_src;
-        flow->flowData.policyAclFlowEntry.match_criteria.sourceIp4Mask = match->masks.ipv4_src;
-        flow->flowData.policyAclFlowEntry.match_criteria.destIp4       = match->fields.ipv4_dst;
-        flow->flowData.policyAclFlowEntry.match_criteria.destIp4Mask   = match->masks.ipv4_dst;
-
-        memcpy(flow->flowData.policyAclFlowEntry.match_criteria.sourceIp6.s6_addr, match->fields.ipv6_src.addr, OF_IPV6_BYTES);
-        memcpy(flow->flowData.policyAclFlowEntry.match_criteria.sourceIp6Mask.s6_addr, match->masks.ipv6_src.addr, OF_IPV6_BYTES);
-        memcpy(flow->flowData.policyAclFlowEntry.match_criteria.destIp6.s6_addr, match->fields.ipv6_dst.addr, OF_IPV6_BYTES);
-        memcpy(flow->flowData.policyAclFlowEntry.match_criteria.destIp6Mask.s6_addr, match->masks.ipv6_dst.addr, OF_IPV6_BYTES);
-
-        flow->flowData.policyAclFlowEntry.match_criteria.ipv4ArpSpa     = match->fields.arp_spa;
-        flow->flowData.policyAclFlowEntry.match_criteria.ipv4ArpSpaMask = match->masks.arp_spa;
-        flow->flowData.policyAclFlowEntry.match_criteria.ipProto        = match->fields.ip_proto;
-        flow->flowData.policyAclFlowEntry.match_criteria.ipProtoMask    = match->masks.ip_proto;
-        flow->flowData.policyAclFlowEntry.match_criteria.dscp           = match->fields.ip_dscp;
-        flow->flowData.policyAclFlowEntry.match_criteria.dscpMask       = match->masks.ip_dscp;
-        flow->flowData.policyAclFlowEntry.match_criteria.ecn            = match->fields.ip_ecn;
-        flow->flowData.policyAclFlowEntry.match_criteria.ecnMask        = match->masks.ip_ecn;
-
-        if (match->fields.ip_proto == IPPROTO_TCP)
-        {
-          flow->flowData.policyAclFlowEntry.match_criteria.srcL4Port      = match->fields.tcp_src;
-          flow->flowData.policyAclFlowEntry.match_criteria.srcL4PortMask  = match->masks.tcp_src;
-          flow->flowData.policyAclFlowEntry.match_criteria.destL4Port     = match->fields.tcp_dst;
-          flow->flowData.policyAclFlowEntry.match_criteria.destL4PortMask = match->masks.tcp_dst;
-        }
-        else if (match->fields.ip_proto == IPPROTO_UDP)
-        {
-          flow->flowData.policyAclFlowEntry.match_criteria.srcL4Port      = match->fields.udp_src;
-          flow->flowData.policyAclFlowEntry.match_criteria.srcL4PortMask  = match->masks.udp_src;
-          flow->flowData.policyAclFlowEntry.match_criteria.destL4Port     = match->fields.udp_dst;
-          flow->flowData.policyAclFlowEntry.match_criteria.destL4PortMask = match->masks.udp_dst;
-        }
-        else if (match->fields.ip_proto == IPPROTO_SCTP)
-        {
-          flow->flowData.policyAclFlowEntry.match_criteria.srcL4Port      = match->fields.sctp_src;
-          flow->flowData.policyAclFlowEntry.match_criteria.srcL4PortMask  = match->masks.sctp_src;
-          flow->flowData.policyAclFlowEntry.match_criteria.destL4Port     = match->fields.sctp_dst;
-          flow->flowData.policyAclFlowEntry.match_criteria.destL4PortMask = match->masks.sctp_dst;
-        }
-
-        if (match->fields.ip_proto == IPPROTO_ICMP)
-        {
-          flow->flowData.policyAclFlowEntry.match_criteria.icmpType     = match->fields.icmpv4_type;
-          flow->flowData.policyAclFlowEntry.match_criteria.icmpTypeMask = match->masks.icmpv4_type;
-          flow->flowData.policyAclFlowEntry.match_criteria.icmpCode     = match->fields.icmpv4_code;
-          flow->flowData.policyAclFlowEntry.match_criteria.icmpCodeMask = match->masks.icmpv4_code;
-        }
-        else if (match->fields.ip_proto == IPPROTO_ICMPV6)
-        {
-          flow->flowData.policyAclFlowEntry.match_criteria.icmpType     = match->fields.icmpv6_type;
-          flow->flowData.policyAclFlowEntry.match_criteria.icmpTypeMask = match->masks.icmpv6_type;
-          flow->flowData.policyAclFlowEntry.match_criteria.icmpCode     = match->fields.icmpv6_code;
-          flow->flowData.policyAclFlowEntry.match_criteria.icmpCodeMask = match->masks.icmpv6_code;
-        }
-
-        flow->flowData.policyAclFlowEntry.match_criteria.ipv6FlowLabel     = match->fields.ipv6_flabel;
-        flow->flowData.policyAclFlowEntry.match_criteria.ipv6FlowLabelMask = match->masks.ipv6_flabel;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_COLOR_BASED_ACTIONS:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_COLOR_BASED_ACTIONS_FLOW_MATCH_BITMAP) != IND_OFDPA_COLOR_BASED_ACTIONS_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_COLOR_BASED_ACTIONS_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_COLOR_BASED_ACTIONS_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.colorActionsFlowEntry.match_criteria.color = match->fields.ofdpa_color;
-        flow->flowData.colorActionsFlowEntry.match_criteria.index  = match->fields.ofdpa_color_actions_index;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_EGRESS_VLAN:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_EGRESS_VLAN_FLOW_MATCH_BITMAP) != IND_OFDPA_EGRESS_VLAN_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_EGRESS_VLAN_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_EGRESS_VLAN_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.egressVlanFlowEntry.match_criteria.outPort = match->fields.onf_actset_output;
-        flow->flowData.egressVlanFlowEntry.match_criteria.vlanId  = match->fields.vlan_vid;
-        flow->flowData.egressVlanFlowEntry.match_criteria.allowVlanTranslation = match->fields.ofdpa_allow_vlan_translation;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_EGRESS_VLAN_1:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_EGRESS_VLAN1_FLOW_MATCH_BITMAP) != IND_OFDPA_EGRESS_VLAN1_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_EGRESS_VLAN1_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_EGRESS_VLAN1_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.egressVlan1FlowEntry.match_criteria.outPort = match->fields.onf_actset_output;
-        flow->flowData.egressVlan1FlowEntry.match_criteria.vlanId  = match->fields.vlan_vid;
-        flow->flowData.egressVlan1FlowEntry.match_criteria.ovid    = match->fields.ofdpa_ovid;
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_EGRESS_MAINTENANCE_POINT:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_EGRESS_MP_FLOW_MATCH_BITMAP) != IND_OFDPA_EGRESS_MP_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_EGRESS_MP_FLOW_MATCH_MAND_BITMAP)
-              != IND_OFDPA_EGRESS_MP_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.egressMpFlowEntry.match_criteria.outPort            = match->fields.onf_actset_output;
-        flow->flowData.egressMpFlowEntry.match_criteria.vlanId             = match->fields.vlan_vid;
-        flow->flowData.egressMpFlowEntry.match_criteria.vlanIdMask         = match->masks.vlan_vid & (OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK);
-        flow->flowData.egressMpFlowEntry.match_criteria.etherType          = match->fields.eth_type;
-        flow->flowData.egressMpFlowEntry.match_criteria.etherTypeMask      = match->masks.eth_type;
-        flow->flowData.egressMpFlowEntry.match_criteria.oamY1731Mdl        = match->fields.ofdpa_oam_y1731_mdl;
-        flow->flowData.egressMpFlowEntry.match_criteria.oamY1731MdlMask    = match->masks.ofdpa_oam_y1731_mdl & OFDPA_OAM_Y1731_MDL_EXACT_MASK;
-        flow->flowData.egressMpFlowEntry.match_criteria.oamY1731Opcode     = match->fields.ofdpa_oam_y1731_opcode;
-        flow->flowData.egressMpFlowEntry.match_criteria.oamY1731OpcodeMask = match->masks.ofdpa_oam_y1731_opcode;
-
-        memcpy(flow->flowData.egressMpFlowEntry.match_criteria.destMac.addr, &match->fields.eth_dst, OF_MAC_ADDR_BYTES);
-        memcpy(flow->flowData.egressMpFlowEntry.match_criteria.destMacMask.addr, &match->masks.eth_dst, OF_MAC_ADDR_BYTES);
-      }
-      break;
-
-    case OFDPA_FLOW_TABLE_ID_EGRESS_DSCP_PCP_REMARK:
-      if ((ind_ofdpa_match_fields_bitmask| IND_OFDPA_EGRESS_DSCP_PCP_REM_FLOW_MATCH_BITMAP)
-            != IND_OFDPA_EGRESS_DSCP_PCP_REM_FLOW_MATCH_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else if ((ind_ofdpa_match_fields_bitmask & IND_OFDPA_EGRESS_DSCP_PCP_REM_FLOW_MATCH_MAND_BITMAP)
-                != IND_OFDPA_EGRESS_DSCP_PCP_REM_FLOW_MATCH_MAND_BITMAP)
-      {
-        err = INDIGO_ERROR_COMPAT;
-      }
-      else
-      {
-        flow->flowData.egressDscpPcpRemarkFlowEntry.match_criteria.etherType      = match->fields.eth_type;
-        flow->flowData.egressDscpPcpRemarkFlowEntry.match_criteria.etherTypeMask  = match->masks.eth_type;
-        flow->flowData.egressDscpPcpRemarkFlowEntry.match_criteria.outPort        = match->fields.onf_actset_output;
-        flow->flowData.egressDscpPcpRemarkFlowEntry.match_criteria.trafficClass   = match->fields.ofdpa_traffic_class;
-        flow->flowData.egressDscpPcpRemarkFlowEntry.match_criteria.color          = match->fields.ofdpa_color;
-      }
-      break;
-
-    default:
-      LOG_ERROR("Invalid table id %d", flow->tableId);
-      err = INDIGO_ERROR_PARAM;
-      break;
-  }
-
-  if (err == INDIGO_ERROR_COMPAT)
-  {
-    LOG_ERROR("Incompatible match field(s) for table %d.", flow->tableId);
-  }
-
-  return err;
+  return INDIGO_ERROR_NONE;
 }
 
 static indigo_error_t ind_ofdpa_translate_openflow_actions(of_object_id_t type, of_list_action_t *actions, ofdpaFlowEntry_t *flow)
@@ -2268,9 +2153,11 @@ static indigo_error_t ind_ofdpa_packet_out_actions_get(of_list_action_t *of_list
         of_action_output_port_get(&act.output, &port_no);
         switch (port_no)
         {
-          case OF_PORT_DEST_CONTROLLER:
           case OF_PORT_DEST_FLOOD:
           case OF_PORT_DEST_ALL:
+            packetOutActions->flood = 1;
+            break;
+          case OF_PORT_DEST_CONTROLLER:
           case OF_PORT_DEST_LOCAL:
           case OF_PORT_DEST_IN_PORT:
           case OF_PORT_DEST_NORMAL:
@@ -2286,6 +2173,10 @@ static indigo_error_t ind_ofdpa_packet_out_actions_get(of_list_action_t *of_list
         }
         break;
       }
+      case OF_ACTION_GROUP:
+        packetOutActions->group = 1;
+        of_action_group_group_id_get(&act.group, &packetOutActions->groupId);
+        break;
       default:
         LOG_ERROR("Unsupported action for packet out: %s", of_object_id_str[act.header.object_id]);
         err = INDIGO_ERROR_NOT_SUPPORTED;
@@ -2296,10 +2187,85 @@ static indigo_error_t ind_ofdpa_packet_out_actions_get(of_list_action_t *of_list
   return err;
 }
 
+/*
+ * Applications send bursts of packet-outs with the same actions, so the
+ * last action list and its translation are kept and a byte-identical
+ * list is not parsed again.
+ */
+#define IND_OFDPA_PACKET_OUT_ACTIONS_MAX_BYTES 64
+
+static struct
+{
+  bool                  valid;
+  of_version_t          version;
+  int                   length;
+  uint8_t               actions[IND_OFDPA_PACKET_OUT_ACTIONS_MAX_BYTES];
+  indPacketOutActions_t packetOutActions;
+} ind_ofdpa_packet_out_last;
+
+static indigo_error_t ind_ofdpa_packet_out_actions_get_cached(of_list_action_t *of_list_actions,
+                                                              indPacketOutActions_t *packetOutActions)
+{
+  uint8_t *data = OF_OBJECT_BUFFER_INDEX(of_list_actions, 0);
+  int length = of_list_actions->length;
+  indigo_error_t err;
+
+  if (ind_ofdpa_packet_out_last.valid &&
+      ind_ofdpa_packet_out_last.version == of_list_actions->version &&
+      ind_ofdpa_packet_out_last.length == length &&
+      !memcmp(ind_ofdpa_packet_out_last.actions, data, length))
+  {
+    *packetOutActions = ind_ofdpa_packet_out_last.packetOutActions;
+    return INDIGO_ERROR_NONE;
+  }
+
+  err = ind_ofdpa_packet_out_actions_get(of_list_actions, packetOutActions);
+
+  /* Only successful translations are kept, so errors are always logged */
+  ind_ofdpa_packet_out_last.valid = (err == INDIGO_ERROR_NONE &&
+                                     length <= IND_OFDPA_PACKET_OUT_ACTIONS_MAX_BYTES);
+  if (ind_ofdpa_packet_out_last.valid)
+  {
+    ind_ofdpa_packet_out_last.version = of_list_actions->version;
+    ind_ofdpa_packet_out_last.length = length;
+    memcpy(ind_ofdpa_packet_out_last.actions, data, length);
+    ind_ofdpa_packet_out_last.packetOutActions = *packetOutActions;
+  }
+
+  return err;
+}
+
+
+/*
+ * Flow tables OF-DPA supports, in ID order. Only about twenty of the 255
+ * IDs exist, so the list is built once instead of probing every ID.
+ */
+static OFDPA_FLOW_TABLE_ID_t ind_ofdpa_flow_table_ids[255];
+static int ind_ofdpa_flow_table_count = -1;
+
+static int ind_ofdpa_flow_tables_get(const OFDPA_FLOW_TABLE_ID_t **tableIds)
+{
+  int tableId;
+
+  if (ind_ofdpa_flow_table_count < 0)
+  {
+    ind_ofdpa_flow_table_count = 0;
+    for (tableId = 0; tableId < 255; tableId++)
+    {
+      if (IND_OFDPA_RPC(ofdpaFlowTableSupported, tableId) == OFDPA_E_NONE)
+      {
+        ind_ofdpa_flow_table_ids[ind_ofdpa_flow_table_count++] = tableId;
+      }
+    }
+  }
+
+  *tableIds = ind_ofdpa_flow_table_ids;
+  return ind_ofdpa_flow_table_count;
+}
 
 indigo_error_t indigo_fwd_forwarding_features_get(of_features_reply_t *features_reply)
 {
-  uint32_t tableId, tableCount = 0;
+  const OFDPA_FLOW_TABLE_ID_t *tableIds;
 
   LOG_TRACE("%s() called", __FUNCTION__);
 
@@ -2310,242 +2276,2142 @@ indigo_error_t indigo_fwd_forwarding_features_get(of_features_reply_t *features_
   }
 
   /* Number of tables supported by datapath. */
-  for (tableId = 0; tableId < 255; tableId++)
+  of_features_reply_n_tables_set(features_reply,
+                                 ind_ofdpa_flow_tables_get(&tableIds));
+
+  return INDIGO_ERROR_NONE;
+}
+
+/*
+ * Flow adds are translated immediately but queued here and submitted to
+ * OF-DPA together by indigo_fwd_pending_flush(). The state manager
+ * flushes before barriers and before any message that is not a flow add,
+ * so the batch only ever holds a run of consecutive adds.
+ *
+ * If the flow worker is running, a submitted batch is programmed on the
+ * worker thread while the next one fills. The worker signals completion
+ * through an eventfd, and results are reported from the main loop.
+ *
+ * A modify of a queued add is folded into the add and a delete cancels
+ * it, so neither reaches OF-DPA. With a coalescing window configured, the
+ * batch is held until the window that its first add opened closes rather
+ * than submitted at the end of each burst, so a reactive controller that
+ * changes its mind within the window costs no hardware operations.
+ */
+#define IND_OFDPA_FLOW_BATCH_SIZE 256
+
+typedef struct ind_ofdpa_flow_batch_entry_s
+{
+  indigo_cookie_t  flow_id;
+  ofdpaFlowEntry_t flow;
+  OFDPA_ERROR_t    ofdpa_rv;
+} ind_ofdpa_flow_batch_entry_t;
+
+static ind_ofdpa_flow_batch_entry_t ind_ofdpa_flow_batches[2][IND_OFDPA_FLOW_BATCH_SIZE];
+
+/* Batch being filled */
+static ind_ofdpa_flow_batch_entry_t *ind_ofdpa_flow_batch = ind_ofdpa_flow_batches[0];
+static int ind_ofdpa_flow_batch_count = 0;
+
+/* Batch handed to the worker */
+static ind_ofdpa_flow_batch_entry_t *ind_ofdpa_flow_inflight = ind_ofdpa_flow_batches[1];
+static int ind_ofdpa_flow_inflight_count = 0;
+
+typedef enum ind_ofdpa_flow_worker_state_e
+{
+  IND_OFDPA_FLOW_WORKER_IDLE,
+  IND_OFDPA_FLOW_WORKER_BUSY, /* Worker owns the inflight batch */
+  IND_OFDPA_FLOW_WORKER_DONE, /* Results not yet reported */
+} ind_ofdpa_flow_worker_state_t;
+
+static bool ind_ofdpa_flow_worker_running = false;
+static bool ind_ofdpa_flow_worker_stopping = false;
+static ind_ofdpa_flow_worker_state_t ind_ofdpa_flow_worker_state = IND_OFDPA_FLOW_WORKER_IDLE;
+static pthread_t ind_ofdpa_flow_worker_thread;
+static pthread_mutex_t ind_ofdpa_flow_worker_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ind_ofdpa_flow_worker_cond = PTHREAD_COND_INITIALIZER;
+static int ind_ofdpa_flow_worker_eventfd = -1;
+
+static struct
+{
+  int      window_ms;  /* 0 submits at the end of each burst */
+  bool     timer_armed;
+  uint64_t queued;
+  uint64_t modified;   /* Folded into a queued add */
+  uint64_t cancelled;  /* Deleted while queued */
+} ind_ofdpa_flow_window;
+
+static void ind_ofdpa_flow_window_timer(void *cookie);
+
+/* ACL policy ordering; see ind_ofdpa_flow_batch_sort_acl() */
+static struct
+{
+  uint64_t batches;    /* Batches holding ACL policy adds */
+  uint64_t reordered;  /* Of those, batches not already in order */
+  uint64_t adds;
+  uint64_t moved;      /* Adds programmed at another position than queued */
+  int      last_adds;  /* In the last batch holding any */
+  int      last_moved;
+} ind_ofdpa_flow_acl_order;
+
+static ind_ofdpa_flow_batch_entry_t ind_ofdpa_flow_acl_scratch[IND_OFDPA_FLOW_BATCH_SIZE];
+
+static ind_ofdpa_flow_batch_entry_t *ind_ofdpa_flow_batch_find(indigo_cookie_t flow_id)
+{
+  int i;
+
+  for (i = 0; i < ind_ofdpa_flow_batch_count; i++)
   {
-    if (ofdpaFlowTableSupported(tableId) == OFDPA_E_NONE)
+    if (ind_ofdpa_flow_batch[i].flow_id == flow_id)
     {
-      tableCount++;
+      return &ind_ofdpa_flow_batch[i];
     }
   }
-  of_features_reply_n_tables_set(features_reply, tableCount);
+  return NULL;
+}
 
-  return INDIGO_ERROR_NONE;
+static void ind_ofdpa_flow_batch_remove(ind_ofdpa_flow_batch_entry_t *entry)
+{
+  int idx = entry - ind_ofdpa_flow_batch;
+
+  /* Keep the remaining adds in arrival order */
+  memmove(entry, entry + 1,
+          (ind_ofdpa_flow_batch_count - idx - 1) * sizeof(*entry));
+  ind_ofdpa_flow_batch_count--;
 }
 
-indigo_error_t indigo_fwd_flow_create(indigo_cookie_t flow_id,
-                                      of_flow_add_t *flow_add,
-                                      uint8_t *table_id)
+/*
+ * Capacity of each flow table, so an add to a full table is refused
+ * before it is translated and sent to OF-DPA. The state manager holds
+ * every flow, so its per-table count is the occupancy; maxEntries is read
+ * once per table. Tables can also fill before maxEntries when they share
+ * hardware, so a table is known full once OF-DPA refuses an add as full,
+ * until a flow leaves it.
+ */
+static struct
 {
-  indigo_error_t err = INDIGO_ERROR_NONE;
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  ofdpaFlowEntry_t flow;
-  uint16_t priority;
-  uint16_t idle_timeout, hard_timeout;
-  of_match_t of_match;
+  bool     valid;
+  bool     full;
+  uint32_t maxEntries;  /* 0 if unknown */
+  uint64_t rejected;
+} ind_ofdpa_table_capacity[256];
 
-  LOG_TRACE("Flow create called");
+static void ind_ofdpa_table_capacity_init(uint8_t tableId)
+{
+  ofdpaFlowTableInfo_t tableInfo;
 
-  if (flow_add->version < OF_VERSION_1_3)
+  ind_ofdpa_table_capacity[tableId].valid = true;
+  if (IND_OFDPA_RPC(ofdpaFlowTableInfoGet, tableId, &tableInfo) == OFDPA_E_NONE)
   {
-    LOG_ERROR("OpenFlow version 0x%x unsupported", flow_add->version);
-    return INDIGO_ERROR_VERSION;
+    ind_ofdpa_table_capacity[tableId].maxEntries = tableInfo.maxEntries;
   }
+}
 
-  memset(&flow, 0, sizeof(flow));
+/* Is there room for a flow the state manager has already counted? */
+static bool ind_ofdpa_table_capacity_check(uint8_t tableId)
+{
+  if (!ind_ofdpa_table_capacity[tableId].valid)
+  {
+    ind_ofdpa_table_capacity_init(tableId);
+  }
 
-  flow.cookie = flow_id;
+  if (ind_ofdpa_table_capacity[tableId].full ||
+      ((ind_ofdpa_table_capacity[tableId].maxEntries != 0) &&
+       (indigo_core_table_flow_count(tableId) >
+        ind_ofdpa_table_capacity[tableId].maxEntries)))
+  {
+    ind_ofdpa_table_capacity[tableId].rejected++;
+    return false;
+  }
+  return true;
+}
 
-  /* Get the Flow Table ID */
-  of_flow_add_table_id_get(flow_add, table_id);
-  flow.tableId = (uint32_t)*table_id;
+static void ind_ofdpa_table_capacity_freed(uint8_t tableId)
+{
+  ind_ofdpa_table_capacity[tableId].full = false;
+}
 
-  /* ofdpa Flow priority */
-  of_flow_add_priority_get(flow_add, &priority);
-  flow.priority = (uint32_t)priority;
+void ind_ofdpa_table_capacity_show(aim_pvs_t *pvs)
+{
+  uint32_t count;
+  int i;
+
+  aim_printf(pvs, "%-6s %10s %10s %10s %-5s %10s\n",
+             "table", "flows", "max", "headroom", "full", "rejected");
+  for (i = 0; i < 256; i++)
+  {
+    if (!ind_ofdpa_table_capacity[i].valid)
+    {
+      continue;
+    }
+    count = indigo_core_table_flow_count(i);
+    aim_printf(pvs, "%-6d %10u ", i, count);
+    if (ind_ofdpa_table_capacity[i].maxEntries != 0)
+    {
+      aim_printf(pvs, "%10u %10u ", ind_ofdpa_table_capacity[i].maxEntries,
+                 (count < ind_ofdpa_table_capacity[i].maxEntries) ?
+                 ind_ofdpa_table_capacity[i].maxEntries - count : 0);
+    }
+    else
+    {
+      aim_printf(pvs, "%10s %10s ", "-", "-");
+    }
+    aim_printf(pvs, "%-5s %10" PRIu64 "\n",
+               ind_ofdpa_table_capacity[i].full ? "yes" : "no",
+               ind_ofdpa_table_capacity[i].rejected);
+  }
+}
+
+/*
+ * Shadow of each flow programmed into OF-DPA, indexed by cookie (the
+ * Indigo flow id). Holds what ofdpaFlowModify needs beyond the match and
+ * instructions, which are rebuilt from the flow_modify message, so modify
+ * and delete do not have to fetch the entry back with ofdpaFlowByCookieGet.
+ */
+typedef struct ind_ofdpa_flow_shadow_s
+{
+  bighash_entry_t       hash_entry;
+  uint64_t              cookie;
+  OFDPA_FLOW_TABLE_ID_t tableId;
+  uint32_t              priority;
+  uint32_t              hard_time;
+  uint32_t              idle_time;
+  uint32_t              scrub_pass;   /* See ind_ofdpa_flow_scrub */
+} ind_ofdpa_flow_shadow_t;
+
+#define TEMPLATE_NAME ind_ofdpa_flow_shadow_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_flow_shadow_t
+#define TEMPLATE_KEY_FIELD cookie
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+#define IND_OFDPA_FLOW_SHADOW_BUCKETS 16384
+
+static bighash_table_t *ind_ofdpa_flow_shadow_table = NULL;
+
+/* Stamp of the scrubber's current pass, given to shadows as they change */
+static uint32_t ind_ofdpa_flow_scrub_pass = 0;
+
+/* Shadowed flows with a timeout in each table; only these raise flow events */
+static uint32_t ind_ofdpa_flow_timeout_count[256];
+
+static void ind_ofdpa_flow_shadow_timeout_count(ind_ofdpa_flow_shadow_t *shadow, int delta)
+{
+  if ((shadow->hard_time != 0) || (shadow->idle_time != 0))
+  {
+    ind_ofdpa_flow_timeout_count[shadow->tableId & 0xff] += delta;
+  }
+}
+
+static ind_ofdpa_flow_shadow_t *ind_ofdpa_flow_shadow_find(uint64_t cookie)
+{
+  if (ind_ofdpa_flow_shadow_table == NULL)
+  {
+    return NULL;
+  }
+  return ind_ofdpa_flow_shadow_hashtable_first(ind_ofdpa_flow_shadow_table, &cookie);
+}
+
+static void ind_ofdpa_flow_shadow_add(ofdpaFlowEntry_t *flow)
+{
+  ind_ofdpa_flow_shadow_t *shadow;
+
+  if (ind_ofdpa_flow_shadow_table == NULL)
+  {
+    ind_ofdpa_flow_shadow_table = bighash_table_create(IND_OFDPA_FLOW_SHADOW_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_flow_shadow_table != NULL);
+  }
+
+  shadow = ind_ofdpa_flow_shadow_find(flow->cookie);
+  if (shadow == NULL)
+  {
+    shadow = aim_zmalloc(sizeof(*shadow));
+    shadow->cookie = flow->cookie;
+    ind_ofdpa_flow_shadow_hashtable_insert(ind_ofdpa_flow_shadow_table, shadow);
+  }
+  else
+  {
+    ind_ofdpa_flow_shadow_timeout_count(shadow, -1);
+  }
+  shadow->tableId = flow->tableId;
+  shadow->priority = flow->priority;
+  shadow->hard_time = flow->hard_time;
+  shadow->idle_time = flow->idle_time;
+  shadow->scrub_pass = ind_ofdpa_flow_scrub_pass;
+  ind_ofdpa_flow_shadow_timeout_count(shadow, 1);
+}
+
+static void ind_ofdpa_flow_shadow_remove(ind_ofdpa_flow_shadow_t *shadow)
+{
+  ind_ofdpa_table_capacity_freed(shadow->tableId);
+  ind_ofdpa_flow_shadow_timeout_count(shadow, -1);
+  bighash_remove(ind_ofdpa_flow_shadow_table, &shadow->hash_entry);
+  aim_free(shadow);
+}
+
+/* Submit a batch to OF-DPA; there is no bulk add, so add back to back */
+static void ind_ofdpa_flow_batch_program(ind_ofdpa_flow_batch_entry_t *batch, int count)
+{
+  int i;
+
+  for (i = 0; i < count; i++)
+  {
+    batch[i].ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowAdd, &batch[i].flow);
+    if (batch[i].ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_TRACE("Failed to add flow. (ofdpa_rv = %d)", batch[i].ofdpa_rv);
+    }
+  }
+}
+
+static void ind_ofdpa_flow_batch_report(ind_ofdpa_flow_batch_entry_t *batch, int count)
+{
+  int i;
+
+  for (i = 0; i < count; i++)
+  {
+    if (batch[i].flow_id == 0)
+    {
+      /* Learned in the agent; see ind_ofdpa_flow_learned_queue() */
+    }
+    else if (batch[i].ofdpa_rv == OFDPA_E_NONE)
+    {
+      ind_ofdpa_flow_shadow_add(&batch[i].flow);
+    }
+    if (batch[i].ofdpa_rv == OFDPA_E_FULL)
+    {
+      ind_ofdpa_table_capacity[batch[i].flow.tableId & 0xff].full = true;
+    }
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    if (batch[i].flow_id == 0)
+    {
+      ind_ofdpa_learn_install_done(&batch[i].flow, batch[i].ofdpa_rv);
+      continue;
+    }
+    indigo_core_flow_create_done(batch[i].flow_id,
+                                 indigoConvertOfdpaRv(batch[i].ofdpa_rv));
+  }
+}
+
+/*
+ * Wait for the worker to finish the inflight batch and report its results.
+ * Must be called before touching OF-DPA flow state from the main thread.
+ */
+static void ind_ofdpa_flow_worker_wait(void)
+{
+  int count;
+
+  if (ind_ofdpa_flow_worker_state == IND_OFDPA_FLOW_WORKER_IDLE)
+  {
+    return;
+  }
+
+  pthread_mutex_lock(&ind_ofdpa_flow_worker_lock);
+  while (ind_ofdpa_flow_worker_state == IND_OFDPA_FLOW_WORKER_BUSY)
+  {
+    pthread_cond_wait(&ind_ofdpa_flow_worker_cond, &ind_ofdpa_flow_worker_lock);
+  }
+  pthread_mutex_unlock(&ind_ofdpa_flow_worker_lock);
+
+  /* Reporting may re-enter the driver, so retire the batch first */
+  count = ind_ofdpa_flow_inflight_count;
+  ind_ofdpa_flow_inflight_count = 0;
+  ind_ofdpa_flow_worker_state = IND_OFDPA_FLOW_WORKER_IDLE;
+
+  ind_ofdpa_flow_batch_report(ind_ofdpa_flow_inflight, count);
+}
+
+static void *ind_ofdpa_flow_worker(void *arg)
+{
+  uint64_t one = 1;
+
+  pthread_mutex_lock(&ind_ofdpa_flow_worker_lock);
+  for (;;)
+  {
+    while (ind_ofdpa_flow_worker_state != IND_OFDPA_FLOW_WORKER_BUSY &&
+           !ind_ofdpa_flow_worker_stopping)
+    {
+      pthread_cond_wait(&ind_ofdpa_flow_worker_cond, &ind_ofdpa_flow_worker_lock);
+    }
+
+    if (ind_ofdpa_flow_worker_state != IND_OFDPA_FLOW_WORKER_BUSY)
+    {
+      break;
+    }
+
+    pthread_mutex_unlock(&ind_ofdpa_flow_worker_lock);
+    ind_ofdpa_flow_batch_program(ind_ofdpa_flow_inflight, ind_ofdpa_flow_inflight_count);
+    pthread_mutex_lock(&ind_ofdpa_flow_worker_lock);
+
+    ind_ofdpa_flow_worker_state = IND_OFDPA_FLOW_WORKER_DONE;
+    pthread_cond_broadcast(&ind_ofdpa_flow_worker_cond);
+
+    if (write(ind_ofdpa_flow_worker_eventfd, &one, sizeof(one)) != sizeof(one))
+    {
+      LOG_ERROR("Failed to signal flow worker completion: %s", strerror(errno));
+    }
+  }
+  pthread_mutex_unlock(&ind_ofdpa_flow_worker_lock);
+
+  return NULL;
+}
+
+static void ind_ofdpa_flow_worker_ready(int socket_id, void *cookie,
+                                        int read_ready, int write_ready,
+                                        int error_seen)
+{
+  uint64_t value;
+
+  if (read(socket_id, &value, sizeof(value)) < 0 && errno != EAGAIN)
+  {
+    LOG_ERROR("Failed to read flow worker eventfd: %s", strerror(errno));
+  }
+
+  ind_ofdpa_flow_worker_wait();
+}
+
+/*
+ * Program the ACL policy adds of a batch highest priority first.
+ *
+ * The SDK keeps the ACL TCAM sorted by priority, so an add that outranks
+ * installed entries shifts them all down, while in descending order each
+ * add lands after the ones before it. Equal priorities keep their queued
+ * order, and adds to other tables keep their slots.
+ */
+static void ind_ofdpa_flow_batch_sort_acl(ind_ofdpa_flow_batch_entry_t *batch, int count)
+{
+  int slots[IND_OFDPA_FLOW_BATCH_SIZE];
+  int order[IND_OFDPA_FLOW_BATCH_SIZE];
+  int n = 0;
+  int moved = 0;
+  int i, j;
+
+  for (i = 0; i < count; i++)
+  {
+    if (batch[i].flow.tableId == OFDPA_FLOW_TABLE_ID_ACL_POLICY)
+    {
+      slots[n++] = i;
+    }
+  }
+
+  if (n == 0)
+  {
+    return;
+  }
+
+  /* Stable insertion sort; a batch from one controller push is mostly in order */
+  for (i = 0; i < n; i++)
+  {
+    for (j = i; (j > 0) &&
+           (batch[order[j - 1]].flow.priority < batch[slots[i]].flow.priority); j--)
+    {
+      order[j] = order[j - 1];
+    }
+    order[j] = slots[i];
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    if (order[i] != slots[i])
+    {
+      moved++;
+    }
+  }
+
+  ind_ofdpa_flow_acl_order.batches++;
+  ind_ofdpa_flow_acl_order.adds += n;
+  ind_ofdpa_flow_acl_order.moved += moved;
+  ind_ofdpa_flow_acl_order.last_adds = n;
+  ind_ofdpa_flow_acl_order.last_moved = moved;
+
+  if (moved == 0)
+  {
+    return;
+  }
+
+  ind_ofdpa_flow_acl_order.reordered++;
+  for (i = 0; i < n; i++)
+  {
+    ind_ofdpa_flow_acl_scratch[i] = batch[order[i]];
+  }
+  for (i = 0; i < n; i++)
+  {
+    batch[slots[i]] = ind_ofdpa_flow_acl_scratch[i];
+  }
+}
+
+/*
+ * Hand the filling batch to the worker, or program it here if the worker
+ * is not running.
+ */
+static void ind_ofdpa_flow_batch_submit(void)
+{
+  ind_ofdpa_flow_batch_entry_t *batch = ind_ofdpa_flow_batch;
+  int count = ind_ofdpa_flow_batch_count;
+
+  if (ind_ofdpa_flow_window.timer_armed)
+  {
+    ind_soc_timer_event_unregister(ind_ofdpa_flow_window_timer, NULL);
+    ind_ofdpa_flow_window.timer_armed = false;
+  }
+
+  if (count == 0)
+  {
+    return;
+  }
+
+  LOG_TRACE("Submitting %d queued flows", count);
+
+  ind_ofdpa_flow_batch_sort_acl(batch, count);
+
+  /* At most one batch is in flight */
+  ind_ofdpa_flow_worker_wait();
+
+  ind_ofdpa_flow_batch = ind_ofdpa_flow_inflight;
+  ind_ofdpa_flow_batch_count = 0;
+  ind_ofdpa_flow_inflight = batch;
+  ind_ofdpa_flow_inflight_count = count;
+
+  if (!ind_ofdpa_flow_worker_running)
+  {
+    ind_ofdpa_flow_batch_program(batch, count);
+    ind_ofdpa_flow_inflight_count = 0;
+    ind_ofdpa_flow_batch_report(batch, count);
+    return;
+  }
+
+  pthread_mutex_lock(&ind_ofdpa_flow_worker_lock);
+  ind_ofdpa_flow_worker_state = IND_OFDPA_FLOW_WORKER_BUSY;
+  pthread_cond_broadcast(&ind_ofdpa_flow_worker_cond);
+  pthread_mutex_unlock(&ind_ofdpa_flow_worker_lock);
+}
+
+static void ind_ofdpa_flow_window_timer(void *cookie)
+{
+  ind_ofdpa_flow_batch_submit();
+}
+
+void indigo_fwd_pending_submit(void)
+{
+  if (ind_ofdpa_flow_window.window_ms == 0)
+  {
+    ind_ofdpa_flow_batch_submit();
+  }
+  else if (!ind_ofdpa_flow_window.timer_armed && (ind_ofdpa_flow_batch_count != 0))
+  {
+    if (ind_soc_timer_event_register(ind_ofdpa_flow_window_timer, NULL,
+                                     ind_ofdpa_flow_window.window_ms) < 0)
+    {
+      LOG_ERROR("Failed to register flow coalescing timer");
+      ind_ofdpa_flow_batch_submit();
+      return;
+    }
+    ind_ofdpa_flow_window.timer_armed = true;
+  }
+}
+
+void indigo_fwd_pending_flush(void)
+{
+  ind_ofdpa_flow_batch_submit();
+  ind_ofdpa_flow_worker_wait();
+}
+
+void ind_ofdpa_flow_window_set(int window_ms)
+{
+  ind_ofdpa_flow_window.window_ms = window_ms > 0 ? window_ms : 0;
+
+  /* Don't hold back adds under the old window */
+  if (ind_ofdpa_flow_window.timer_armed)
+  {
+    ind_ofdpa_flow_batch_submit();
+  }
+}
+
+void ind_ofdpa_flow_window_show(aim_pvs_t *pvs)
+{
+  aim_printf(pvs, "Flow coalescing window %d ms, %d adds queued\n",
+             ind_ofdpa_flow_window.window_ms, ind_ofdpa_flow_batch_count);
+  aim_printf(pvs, "  queued %"PRIu64" modified while queued %"PRIu64
+             " deleted while queued %"PRIu64"\n",
+             ind_ofdpa_flow_window.queued, ind_ofdpa_flow_window.modified,
+             ind_ofdpa_flow_window.cancelled);
+  aim_printf(pvs, "ACL policy adds %"PRIu64" in %"PRIu64" batches, %"PRIu64
+             " reordered, %"PRIu64" moved; last batch %d adds, %d moved\n",
+             ind_ofdpa_flow_acl_order.adds, ind_ofdpa_flow_acl_order.batches,
+             ind_ofdpa_flow_acl_order.reordered, ind_ofdpa_flow_acl_order.moved,
+             ind_ofdpa_flow_acl_order.last_adds, ind_ofdpa_flow_acl_order.last_moved);
+}
+
+indigo_error_t ind_ofdpa_flow_worker_start(void)
+{
+  if (ind_ofdpa_flow_worker_running)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  ind_ofdpa_flow_worker_eventfd = eventfd(0, EFD_NONBLOCK);
+  if (ind_ofdpa_flow_worker_eventfd < 0)
+  {
+    LOG_ERROR("Failed to allocate flow worker eventfd: %s", strerror(errno));
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  if (ind_soc_socket_register(ind_ofdpa_flow_worker_eventfd,
+                              ind_ofdpa_flow_worker_ready, NULL) < 0)
+  {
+    LOG_ERROR("Failed to register flow worker eventfd");
+    close(ind_ofdpa_flow_worker_eventfd);
+    ind_ofdpa_flow_worker_eventfd = -1;
+    return INDIGO_ERROR_UNKNOWN;
+  }
+
+  ind_ofdpa_flow_worker_stopping = false;
+  if (pthread_create(&ind_ofdpa_flow_worker_thread, NULL,
+                     ind_ofdpa_flow_worker, NULL) != 0)
+  {
+    LOG_ERROR("Failed to create flow worker thread");
+    ind_soc_socket_unregister(ind_ofdpa_flow_worker_eventfd);
+    close(ind_ofdpa_flow_worker_eventfd);
+    ind_ofdpa_flow_worker_eventfd = -1;
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  ind_ofdpa_thread_register(INDIGO_THREAD_FLOW_WORKER, ind_ofdpa_flow_worker_thread);
+
+  ind_ofdpa_flow_worker_running = true;
+  LOG_INFO("Started flow worker thread");
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_flow_worker_stop(void)
+{
+  if (!ind_ofdpa_flow_worker_running)
+  {
+    return;
+  }
+
+  ind_ofdpa_flow_worker_wait();
+
+  pthread_mutex_lock(&ind_ofdpa_flow_worker_lock);
+  ind_ofdpa_flow_worker_stopping = true;
+  pthread_cond_broadcast(&ind_ofdpa_flow_worker_cond);
+  pthread_mutex_unlock(&ind_ofdpa_flow_worker_lock);
+
+  indigo_thread_unregister(ind_ofdpa_flow_worker_thread);
+  pthread_join(ind_ofdpa_flow_worker_thread, NULL);
+  ind_ofdpa_flow_worker_running = false;
+
+  ind_soc_socket_unregister(ind_ofdpa_flow_worker_eventfd);
+  close(ind_ofdpa_flow_worker_eventfd);
+  ind_ofdpa_flow_worker_eventfd = -1;
+}
+
+/*
+ * Translate a flow add into the OF-DPA flow entry without touching the
+ * hardware. The caller zeroes the entry and sets its cookie and table.
+ */
+indigo_error_t ind_ofdpa_flow_translate(of_flow_add_t *flow_add,
+                                        ofdpaFlowEntry_t *flow)
+{
+  indigo_error_t err;
+  uint16_t priority;
+  uint16_t idle_timeout, hard_timeout;
+
+  /* ofdpa Flow priority */
+  of_flow_add_priority_get(flow_add, &priority);
+  flow->priority = (uint32_t)priority;
+
+  /* Get the idle time and hard time */
+  (void)of_flow_modify_idle_timeout_get((of_flow_modify_t *)flow_add, &idle_timeout);
+  (void)of_flow_modify_hard_timeout_get((of_flow_modify_t *)flow_add, &hard_timeout);
+  flow->idle_time = (uint32_t)idle_timeout;
+  flow->hard_time = (uint32_t)hard_timeout;
+
+  /* Get the match fields and masks straight from the wire OXMs */
+  err = ind_ofdpa_match_fields_masks_get(flow_add, flow);
+  if (err != INDIGO_ERROR_NONE)
+  {
+    LOG_ERROR("Error getting match fields and masks. (err = %d)", err);
+    return err;
+  }
+
+  /* Get the instructions set from the LOCI flow add object */
+  err = ind_ofdpa_instructions_get(flow_add, flow);
+  if (err != INDIGO_ERROR_NONE)
+  {
+    LOG_TRACE("Failed to get flow instructions. (err = %d)", err);
+    return err;
+  }
+
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t indigo_fwd_flow_create(indigo_cookie_t flow_id,
+                                      of_flow_add_t *flow_add,
+                                      uint8_t *table_id)
+{
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  ofdpaFlowEntry_t flow;
+
+  LOG_TRACE("Flow create called");
+
+  if (flow_add->version < OF_VERSION_1_3)
+  {
+    LOG_ERROR("OpenFlow version 0x%x unsupported", flow_add->version);
+    return INDIGO_ERROR_VERSION;
+  }
+
+  memset(&flow, 0, sizeof(flow));
+
+  flow.cookie = flow_id;
+
+  /* Get the Flow Table ID */
+  of_flow_add_table_id_get(flow_add, table_id);
+  flow.tableId = (uint32_t)*table_id;
+
+  /* Refuse adds to a full table before translating them */
+  if (!ind_ofdpa_table_capacity_check(*table_id))
+  {
+    LOG_TRACE("Table %d full", *table_id);
+    return INDIGO_ERROR_TABLE_FULL;
+  }
+
+  err = ind_ofdpa_flow_translate(flow_add, &flow);
+  if (err != INDIGO_ERROR_NONE)
+  {
+    return err;
+  }
+  /* Queue the flow; the result is reported when the batch is flushed */
+  if (ind_ofdpa_flow_batch_count == IND_OFDPA_FLOW_BATCH_SIZE)
+  {
+    ind_ofdpa_flow_batch_submit();
+  }
+  ind_ofdpa_flow_batch[ind_ofdpa_flow_batch_count].flow_id = flow_id;
+  ind_ofdpa_flow_batch[ind_ofdpa_flow_batch_count].flow = flow;
+  ind_ofdpa_flow_batch_count++;
+  ind_ofdpa_flow_window.queued++;
+
+  LOG_TRACE("Flow queued. (batch = %d)", ind_ofdpa_flow_batch_count);
+  return INDIGO_ERROR_PENDING;
+}
+
+/*
+ * Flows learned in the agent go through the same batch as the controller's
+ * adds. They have no Indigo flow id or cookie, so the result goes to the
+ * learning module rather than the state manager.
+ */
+void ind_ofdpa_flow_learned_queue(const ofdpaFlowEntry_t *flow)
+{
+  if (ind_ofdpa_flow_batch_count == IND_OFDPA_FLOW_BATCH_SIZE)
+  {
+    ind_ofdpa_flow_batch_submit();
+  }
+  ind_ofdpa_flow_batch[ind_ofdpa_flow_batch_count].flow_id = 0;
+  ind_ofdpa_flow_batch[ind_ofdpa_flow_batch_count].flow = *flow;
+  ind_ofdpa_flow_batch_count++;
+}
+
+OFDPA_ERROR_t ind_ofdpa_flow_direct_add(ofdpaFlowEntry_t *flow)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ind_ofdpa_flow_worker_wait();
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowAdd, flow);
+  if (ofdpa_rv == OFDPA_E_FULL)
+  {
+    ind_ofdpa_table_capacity[flow->tableId & 0xff].full = true;
+  }
+  return ofdpa_rv;
+}
+
+OFDPA_ERROR_t ind_ofdpa_flow_learned_modify(ofdpaFlowEntry_t *flow)
+{
+  ind_ofdpa_flow_worker_wait();
+  return IND_OFDPA_RPC(ofdpaFlowModify, flow);
+}
+
+OFDPA_ERROR_t ind_ofdpa_flow_learned_delete(ofdpaFlowEntry_t *flow)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ind_ofdpa_flow_worker_wait();
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowDelete, flow);
+  if (ofdpa_rv == OFDPA_E_NONE)
+  {
+    ind_ofdpa_table_capacity_freed(flow->tableId & 0xff);
+  }
+  return ofdpa_rv;
+}
+
+indigo_error_t indigo_fwd_flow_modify(indigo_cookie_t flow_id,
+                                      of_flow_modify_t *flow_modify)
+{
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  ofdpaFlowEntry_t flow;
+  ofdpaFlowEntryStats_t flowStats;
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  ind_ofdpa_flow_batch_entry_t *queued;
+  ind_ofdpa_flow_shadow_t *shadow;
+
+  LOG_TRACE("Flow modify called");
+
+  if (flow_modify->version < OF_VERSION_1_3)
+  {
+    LOG_ERROR("OpenFlow version 0x%x unsupported", flow_modify->version);
+    return INDIGO_ERROR_VERSION;
+  }
+
+  memset(&flow, 0, sizeof(flow));
+  memset(&flowStats, 0, sizeof(flowStats));
+
+  /* Flows handed to the worker must be programmed first */
+  ind_ofdpa_flow_worker_wait();
+
+  /* A queued add is modified in place */
+  queued = ind_ofdpa_flow_batch_find(flow_id);
+  shadow = ind_ofdpa_flow_shadow_find(flow_id);
+  if (queued != NULL)
+  {
+    flow = queued->flow;
+  }
+  else if (shadow != NULL)
+  {
+    /* Match and instructions are rebuilt below */
+    flow.tableId = shadow->tableId;
+    flow.priority = shadow->priority;
+    flow.hard_time = shadow->hard_time;
+    flow.idle_time = shadow->idle_time;
+    flow.cookie = shadow->cookie;
+  }
+  else
+  {
+    /* Get the flow entries and flow stats from the indigo cookie */
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowByCookieGet, flow_id, &flow, &flowStats);
+  }
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    if (ofdpa_rv == OFDPA_E_NOT_FOUND)
+    {
+      LOG_ERROR("Request to modify non-existent flow. (ofdpa_rv = %d)", ofdpa_rv);
+    }
+    else
+    {
+      LOG_ERROR("Invalid flow. (ofdpa_rv = %d)", ofdpa_rv);
+    }
+    return (indigoConvertOfdpaRv(ofdpa_rv));
+  }
+
+  memset(&flow.flowData, 0, sizeof(flow.flowData));
+
+  /* Get the match fields and masks straight from the wire OXMs */
+  err = ind_ofdpa_match_fields_masks_get(flow_modify, &flow);
+  if (err != INDIGO_ERROR_NONE)
+  {
+    LOG_ERROR("Error getting match fields and masks. (err = %d)", err);
+    return err;
+  }
+
+  /* Get the modified instructions set from the LOCI flow add object */
+  err = ind_ofdpa_instructions_get(flow_modify, &flow);
+  if (err != INDIGO_ERROR_NONE)
+  {
+    LOG_TRACE("Failed to get flow instructions. (err = %d)", err);
+    return err;
+  }
+
+  if (queued != NULL)
+  {
+    queued->flow = flow;
+    ind_ofdpa_flow_window.modified++;
+    LOG_TRACE("Queued flow modified.");
+    return INDIGO_ERROR_NONE;
+  }
+
+  /* Submit the changes to ofdpa */
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowModify, &flow);
+  if (ofdpa_rv!= OFDPA_E_NONE)
+  {
+    LOG_TRACE("Failed to modify flow. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    LOG_TRACE("Flow modified successfully. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+
+  return (indigoConvertOfdpaRv(ofdpa_rv));
+}
+
+indigo_error_t indigo_fwd_flow_delete(indigo_cookie_t flow_id,
+                                      indigo_fi_flow_stats_t *flow_stats)
+{
+  ofdpaFlowEntry_t flow;
+  ofdpaFlowEntryStats_t flowStats;
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  ind_ofdpa_flow_batch_entry_t *queued;
+  ind_ofdpa_flow_shadow_t *shadow;
+
+
+  LOG_TRACE("Flow delete called");
+
+  memset(&flow, 0, sizeof(flow));
+  memset(&flowStats, 0, sizeof(flowStats));
+
+  ind_ofdpa_flow_worker_wait();
+
+  /* A queued add never reached OF-DPA; just drop it */
+  queued = ind_ofdpa_flow_batch_find(flow_id);
+  if (queued != NULL)
+  {
+    ind_ofdpa_flow_batch_remove(queued);
+    ind_ofdpa_flow_window.cancelled++;
+    if (flow_stats != NULL)
+    {
+      memset(flow_stats, 0, sizeof(*flow_stats));
+      flow_stats->flow_id = flow_id;
+    }
+    LOG_TRACE("Queued flow deleted.");
+    return INDIGO_ERROR_NONE;
+  }
+
+  /*
+   * Without a need for the final counters, a shadowed flow is deleted with
+   * a single RPC; the shadow has its table for the capacity accounting.
+   */
+  shadow = ind_ofdpa_flow_shadow_find(flow_id);
+  if ((shadow != NULL) && (flow_stats == NULL))
+  {
+    ind_ofdpa_flow_shadow_remove(shadow);
+
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowByCookieDelete, flow_id);
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_ERROR("Failed to delete flow. (ofdpa_rv = %d)", ofdpa_rv);
+    }
+    else
+    {
+      LOG_TRACE("Flow deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    }
+    return (indigoConvertOfdpaRv(ofdpa_rv));
+  }
+  if (shadow != NULL)
+  {
+    ind_ofdpa_flow_shadow_remove(shadow);
+  }
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowByCookieGet, flow_id, &flow, &flowStats);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    if (ofdpa_rv == OFDPA_E_NOT_FOUND)
+    {
+      LOG_ERROR("Request to delete non-existent flow. (ofdpa_rv = %d)", ofdpa_rv);
+    }
+    else
+    {
+      LOG_ERROR("Invalid flow. (ofdpa_rv = %d)", ofdpa_rv);
+    }
+
+    return (indigoConvertOfdpaRv(ofdpa_rv));
+  }
+
+  if (flow_stats != NULL)
+  {
+    flow_stats->flow_id = flow_id;
+    flow_stats->packets = flowStats.receivedPackets;
+    flow_stats->bytes = flowStats.receivedBytes;
+    flow_stats->duration_ns = (flowStats.durationSec)*(IND_OFDPA_NANO_SEC); /* Convert to nano seconds*/
+  }
+
+  /* Delete the flow entry */
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowByCookieDelete, flow_id);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to delete flow. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    ind_ofdpa_table_capacity_freed(flow.tableId & 0xff);
+    LOG_TRACE("Flow deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+
+  return (indigoConvertOfdpaRv(ofdpa_rv));
+}
+
+/*
+ * OF-DPA has no table purge, so each table is walked once and every flow
+ * with an Indigo cookie deleted by its key with ofdpaFlowDelete(), saving
+ * the search ofdpaFlowByCookieDelete() does per flow. Flows without an
+ * Indigo cookie were not added by this agent and are left alone, as in
+ * warm start.
+ */
+static int ind_ofdpa_flow_table_purge(OFDPA_FLOW_TABLE_ID_t tableId, int *failed)
+{
+  ofdpaFlowEntry_t flow, nextFlow;
+  ind_ofdpa_flow_shadow_t *shadow;
+  OFDPA_ERROR_t ofdpa_rv;
+  bool more;
+  int count = 0;
+
+  if (IND_OFDPA_RPC(ofdpaFlowEntryInit, tableId, &nextFlow) != OFDPA_E_NONE)
+  {
+    return 0;
+  }
+
+  more = (IND_OFDPA_RPC(ofdpaFlowNextGet, &nextFlow, &nextFlow) == OFDPA_E_NONE);
+  while (more)
+  {
+    /* Step past the flow before deleting it */
+    flow = nextFlow;
+    more = (IND_OFDPA_RPC(ofdpaFlowNextGet, &flow, &nextFlow) == OFDPA_E_NONE);
+
+    if (flow.cookie == 0)
+    {
+      continue;
+    }
+
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowDelete, &flow);
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_ERROR("Failed to delete flow 0x%llx from table %d. (ofdpa_rv = %d)",
+                (unsigned long long)flow.cookie, tableId, ofdpa_rv);
+      (*failed)++;
+      continue;
+    }
+
+    ind_ofdpa_table_capacity_freed(tableId);
+    shadow = ind_ofdpa_flow_shadow_find(flow.cookie);
+    if (shadow != NULL)
+    {
+      ind_ofdpa_flow_shadow_remove(shadow);
+    }
+    count++;
+  }
+
+  return count;
+}
+
+indigo_error_t indigo_fwd_flow_delete_all(uint8_t table_id)
+{
+  const OFDPA_FLOW_TABLE_ID_t *tableIds;
+  ind_ofdpa_flow_shadow_t *shadow;
+  bighash_iter_t iter;
+  bighash_entry_t *entry;
+  OFDPA_ERROR_t ofdpa_rv;
+  int tableCount;
+  int count = 0;
+  int failed = 0;
+  int i;
+
+  ind_ofdpa_flow_worker_wait();
+
+  /* Queued adds never reached OF-DPA; just drop them */
+  i = 0;
+  while (i < ind_ofdpa_flow_batch_count)
+  {
+    if ((table_id == 0xff) || (ind_ofdpa_flow_batch[i].flow.tableId == table_id))
+    {
+      ind_ofdpa_flow_batch_remove(&ind_ofdpa_flow_batch[i]);
+      count++;
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  tableCount = ind_ofdpa_flow_tables_get(&tableIds);
+  for (i = 0; i < tableCount; i++)
+  {
+    if ((table_id == 0xff) || (tableIds[i] == table_id))
+    {
+      count += ind_ofdpa_flow_table_purge(tableIds[i], &failed);
+    }
+  }
+
+  /* The walk does not return a flow equal to its initial key */
+  if (ind_ofdpa_flow_shadow_table != NULL)
+  {
+    for (entry = bighash_iter_start(ind_ofdpa_flow_shadow_table, &iter);
+         entry != NULL;
+         entry = bighash_iter_next(&iter))
+    {
+      shadow = container_of(entry, hash_entry, ind_ofdpa_flow_shadow_t);
+      if ((table_id != 0xff) && (shadow->tableId != table_id))
+      {
+        continue;
+      }
+
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowByCookieDelete, shadow->cookie);
+      if ((ofdpa_rv != OFDPA_E_NONE) && (ofdpa_rv != OFDPA_E_NOT_FOUND))
+      {
+        LOG_ERROR("Failed to delete flow 0x%llx. (ofdpa_rv = %d)",
+                  (unsigned long long)shadow->cookie, ofdpa_rv);
+        failed++;
+      }
+      else
+      {
+        count++;
+      }
+      ind_ofdpa_flow_shadow_remove(shadow);
+    }
+  }
+
+  LOG_TRACE("Deleted %d flows from table %d, %d failed", count, table_id, failed);
+
+  /* The core then deletes what is left one by one */
+  return (failed == 0) ? INDIGO_ERROR_NONE : INDIGO_ERROR_UNKNOWN;
+}
+
+/*
+ * Flow scrubber
+ *
+ * Drift between the shadow and OF-DPA, from a delete that failed or a
+ * flow the SDK dropped, otherwise only shows in a full table dump. The
+ * scrubber walks the OF-DPA flow tables in the background with
+ * ofdpaFlowNextGet(), making at most IND_OFDPA_FLOW_SCRUB_BATCH RPCs
+ * each interval, and checks every flow with an Indigo cookie against
+ * the shadow:
+ *  - a flow without a shadow is orphaned, e.g. its delete failed;
+ *  - a flow whose shadow has another table or priority is mismatched.
+ * Each shadow found, or changed during the pass, is stamped with the
+ * pass; at the end of a pass a shadow without the stamp is missing from
+ * OF-DPA.
+ *
+ * With repair on, orphaned flows are deleted from OF-DPA and missing
+ * flows are removed from the state manager, which sends the controller
+ * a flow_removed so it can add them again. Otherwise they are only
+ * logged and counted.
+ */
+#define IND_OFDPA_FLOW_SCRUB_BATCH 32
+
+static struct
+{
+  int              interval_ms;      /* 0 when stopped */
+  bool             repair;
+  int              tableId;          /* Table being walked */
+  bool             started;          /* Cursor is set for tableId */
+  ofdpaFlowEntry_t cursor;           /* Last flow checked */
+  indigo_time_t    pass_start;
+  indigo_time_t    pass_time;        /* Start of the last complete pass */
+  uint64_t         passes;
+  uint64_t         checked;
+  uint64_t         orphaned;
+  uint64_t         mismatched;
+  uint64_t         missing;
+  uint64_t         repaired;
+  uint64_t         deferred;
+} ind_ofdpa_flow_scrub;
+
+/* Adopted flows have no shadow until the warm start reaches them */
+static bool ind_ofdpa_warm_start_running = false;
+
+static void ind_ofdpa_flow_scrub_check(ofdpaFlowEntry_t *flow)
+{
+  ind_ofdpa_flow_shadow_t *shadow;
+
+  ind_ofdpa_flow_scrub.checked++;
+
+  /* Not added by this agent */
+  if (flow->cookie == 0)
+  {
+    return;
+  }
+
+  shadow = ind_ofdpa_flow_shadow_find(flow->cookie);
+  if (shadow == NULL)
+  {
+    ind_ofdpa_flow_scrub.orphaned++;
+    LOG_WARN("Flow 0x%llx in table %d is not known to the agent",
+             (unsigned long long)flow->cookie, flow->tableId);
+    if (ind_ofdpa_flow_scrub.repair &&
+        IND_OFDPA_RPC(ofdpaFlowDelete, flow) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_table_capacity_freed(flow->tableId & 0xff);
+      ind_ofdpa_flow_scrub.repaired++;
+    }
+    return;
+  }
+
+  shadow->scrub_pass = ind_ofdpa_flow_scrub_pass;
+  if ((shadow->tableId != flow->tableId) || (shadow->priority != flow->priority))
+  {
+    ind_ofdpa_flow_scrub.mismatched++;
+    LOG_WARN("Flow 0x%llx is in table %d at priority %u, expected table %d at priority %u",
+             (unsigned long long)flow->cookie, flow->tableId, flow->priority,
+             shadow->tableId, shadow->priority);
+  }
+}
+
+static void ind_ofdpa_flow_scrub_pass_finish(void)
+{
+  ind_ofdpa_flow_shadow_t *shadow;
+  bighash_iter_t iter;
+  bighash_entry_t *entry;
+  uint64_t *missing = NULL;
+  int count = 0, size = 0;
+  int i;
+
+  if (ind_ofdpa_flow_shadow_table != NULL)
+  {
+    for (entry = bighash_iter_start(ind_ofdpa_flow_shadow_table, &iter);
+         entry != NULL;
+         entry = bighash_iter_next(&iter))
+    {
+      shadow = container_of(entry, hash_entry, ind_ofdpa_flow_shadow_t);
+      if (shadow->scrub_pass == ind_ofdpa_flow_scrub_pass)
+      {
+        continue;
+      }
+      if (count == size)
+      {
+        size = size ? size * 2 : 64;
+        missing = aim_realloc(missing, size * sizeof(*missing));
+      }
+      missing[count++] = shadow->cookie;
+    }
+  }
+
+  /* Removing flows changes the shadow, so only after the walk */
+  for (i = 0; i < count; i++)
+  {
+    ind_ofdpa_flow_scrub.missing++;
+    LOG_WARN("Flow 0x%llx is missing from OF-DPA", (unsigned long long)missing[i]);
+    if (ind_ofdpa_flow_scrub.repair)
+    {
+      ind_core_flow_expiry_handler(missing[i], INDIGO_FLOW_REMOVED_DELETE);
+      ind_ofdpa_flow_scrub.repaired++;
+    }
+  }
+  aim_free(missing);
+
+  ind_ofdpa_flow_scrub.passes++;
+  ind_ofdpa_flow_scrub.pass_time = ind_ofdpa_flow_scrub.pass_start;
+  ind_ofdpa_flow_scrub.pass_start = INDIGO_CURRENT_TIME;
+  ind_ofdpa_flow_scrub.tableId = 0;
+  ind_ofdpa_flow_scrub.started = false;
+  ind_ofdpa_flow_scrub_pass++;
+}
+
+static void ind_ofdpa_flow_scrub_timer(void *cookie)
+{
+  ofdpaFlowEntry_t *flow = &ind_ofdpa_flow_scrub.cursor;
+  int budget = IND_OFDPA_FLOW_SCRUB_BATCH;
+
+  if (ind_ofdpa_warm_start_running)
+  {
+    ind_ofdpa_flow_scrub.deferred++;
+    return;
+  }
+
+  /* Flows the worker added get their shadows first */
+  ind_ofdpa_flow_worker_wait();
+
+  while (budget-- > 0)
+  {
+    if (ind_ofdpa_flow_scrub.tableId > 255)
+    {
+      ind_ofdpa_flow_scrub_pass_finish();
+      return;
+    }
+
+    if (!ind_ofdpa_flow_scrub.started)
+    {
+      if (IND_OFDPA_RPC(ofdpaFlowTableSupported, ind_ofdpa_flow_scrub.tableId) != OFDPA_E_NONE ||
+          IND_OFDPA_RPC(ofdpaFlowEntryInit, ind_ofdpa_flow_scrub.tableId, flow) != OFDPA_E_NONE)
+      {
+        ind_ofdpa_flow_scrub.tableId++;
+        continue;
+      }
+      ind_ofdpa_flow_scrub.started = true;
+    }
+
+    /* A flow deleted since the last tick is skipped, the walk carries on */
+    if (IND_OFDPA_RPC(ofdpaFlowNextGet, flow, flow) != OFDPA_E_NONE)
+    {
+      ind_ofdpa_flow_scrub.tableId++;
+      ind_ofdpa_flow_scrub.started = false;
+      continue;
+    }
+    ind_ofdpa_flow_scrub_check(flow);
+  }
+}
+
+indigo_error_t ind_ofdpa_flow_scrub_start(int interval_ms, int repair)
+{
+  if (interval_ms <= 0)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_flow_scrub_stop();
+
+  if (ind_soc_timer_event_register(ind_ofdpa_flow_scrub_timer, NULL, interval_ms) < 0)
+  {
+    LOG_ERROR("Failed to register flow scrub timer");
+    return INDIGO_ERROR_UNKNOWN;
+  }
+  ind_ofdpa_flow_scrub.interval_ms = interval_ms;
+  ind_ofdpa_flow_scrub.repair = repair;
+  ind_ofdpa_flow_scrub.tableId = 0;
+  ind_ofdpa_flow_scrub.started = false;
+  ind_ofdpa_flow_scrub.pass_start = INDIGO_CURRENT_TIME;
+  ind_ofdpa_flow_scrub.pass_time = 0;
+
+  /* Shadows stamped before now have not been found by this pass */
+  ind_ofdpa_flow_scrub_pass++;
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_flow_scrub_stop(void)
+{
+  if (ind_ofdpa_flow_scrub.interval_ms == 0)
+  {
+    return;
+  }
+
+  ind_soc_timer_event_unregister(ind_ofdpa_flow_scrub_timer, NULL);
+  ind_ofdpa_flow_scrub.interval_ms = 0;
+}
+
+void ind_ofdpa_flow_scrub_show(aim_pvs_t *pvs)
+{
+  if (ind_ofdpa_flow_scrub.interval_ms == 0)
+  {
+    aim_printf(pvs, "Flow scrubber off\n");
+  }
+  else
+  {
+    aim_printf(pvs, "Flow scrubber checks %d flows every %d ms%s, at table %d\n",
+               IND_OFDPA_FLOW_SCRUB_BATCH, ind_ofdpa_flow_scrub.interval_ms,
+               ind_ofdpa_flow_scrub.repair ? " and repairs" : "",
+               ind_ofdpa_flow_scrub.tableId);
+    if (ind_ofdpa_flow_scrub.pass_time != 0)
+    {
+      aim_printf(pvs, "  last pass started %u ms ago\n",
+                 INDIGO_TIME_DIFF_ms(ind_ofdpa_flow_scrub.pass_time, INDIGO_CURRENT_TIME));
+    }
+  }
+  aim_printf(pvs, "  passes %"PRIu64" checked %"PRIu64" deferred %"PRIu64"\n",
+             ind_ofdpa_flow_scrub.passes, ind_ofdpa_flow_scrub.checked,
+             ind_ofdpa_flow_scrub.deferred);
+  aim_printf(pvs, "  orphaned %"PRIu64" mismatched %"PRIu64" missing %"PRIu64" repaired %"PRIu64"\n",
+             ind_ofdpa_flow_scrub.orphaned, ind_ofdpa_flow_scrub.mismatched,
+             ind_ofdpa_flow_scrub.missing, ind_ofdpa_flow_scrub.repaired);
+}
+
+/*
+ * Flow stats snapshot, indexed by cookie. OF-DPA can only look a flow up
+ * by cookie with a search of its tables, so a stats request covering
+ * many flows is served from one walk of each table with
+ * ofdpaFlowNextGet()/ofdpaFlowStatsGet() instead.
+ *
+ * The snapshot exists between indigo_fwd_flow_stats_bulk_begin() and the
+ * matching indigo_fwd_flow_stats_bulk_end(). It is only built once a run
+ * has done IND_OFDPA_FLOW_STATS_BULK_THRESHOLD single lookups, so
+ * requests matching a few flows do not pay for a table walk. Flows not
+ * in the snapshot, e.g. added after the walk, fall back to
+ * ofdpaFlowByCookieGet().
+ *
+ * Runs overlap, e.g. several controllers polling or a dump held up by
+ * output backpressure, so the snapshot may outlive any one run. It is
+ * dropped and walked again once older than
+ * IND_OFDPA_FLOW_STATS_SNAP_MAX_AGE_MS, bounding how stale the counters
+ * it serves can be.
+ */
+#define IND_OFDPA_FLOW_STATS_BULK_THRESHOLD 64
+#define IND_OFDPA_FLOW_STATS_SNAP_BUCKETS 16384
+#define IND_OFDPA_FLOW_STATS_SNAP_MAX_AGE_MS 1000
+
+typedef struct ind_ofdpa_flow_stats_snap_s
+{
+  bighash_entry_t       hash_entry;
+  uint64_t              cookie;
+  ofdpaFlowEntryStats_t stats;
+} ind_ofdpa_flow_stats_snap_t;
+
+#define TEMPLATE_NAME ind_ofdpa_flow_stats_snap_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_flow_stats_snap_t
+#define TEMPLATE_KEY_FIELD cookie
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static bighash_table_t *ind_ofdpa_flow_stats_snap_table = NULL;
+static int ind_ofdpa_flow_stats_bulk_refcount = 0;
+static int ind_ofdpa_flow_stats_bulk_lookups = 0;
+static bool ind_ofdpa_flow_stats_bulk_tables[256]; /* Requested by a run */
+static bool ind_ofdpa_flow_stats_snap_tables[256]; /* Already walked */
+static indigo_time_t ind_ofdpa_flow_stats_snap_time; /* When the snapshot was started */
+
+static void ind_ofdpa_flow_stats_snap_add(uint64_t cookie, ofdpaFlowEntryStats_t *flowStats)
+{
+  ind_ofdpa_flow_stats_snap_t *snap;
+
+  snap = ind_ofdpa_flow_stats_snap_hashtable_first(ind_ofdpa_flow_stats_snap_table, &cookie);
+  if (snap == NULL)
+  {
+    snap = aim_zmalloc(sizeof(*snap));
+    snap->cookie = cookie;
+    ind_ofdpa_flow_stats_snap_hashtable_insert(ind_ofdpa_flow_stats_snap_table, snap);
+  }
+  snap->stats = *flowStats;
+}
+
+static void ind_ofdpa_flow_stats_snap_table_walk(OFDPA_FLOW_TABLE_ID_t tableId)
+{
+  ofdpaFlowEntry_t flow;
+  ofdpaFlowEntryStats_t flowStats;
+  int count = 0;
+
+  if (IND_OFDPA_RPC(ofdpaFlowTableSupported, tableId) != OFDPA_E_NONE)
+  {
+    return;
+  }
+  if (IND_OFDPA_RPC(ofdpaFlowEntryInit, tableId, &flow) != OFDPA_E_NONE)
+  {
+    return;
+  }
+
+  /* The initial key is itself a valid entry only if such a flow exists */
+  if (IND_OFDPA_RPC(ofdpaFlowStatsGet, &flow, &flowStats) == OFDPA_E_NONE)
+  {
+    ind_ofdpa_flow_stats_snap_add(flow.cookie, &flowStats);
+    count++;
+  }
+
+  while (IND_OFDPA_RPC(ofdpaFlowNextGet, &flow, &flow) == OFDPA_E_NONE)
+  {
+    /* A flow deleted meanwhile is skipped, the walk carries on */
+    if (IND_OFDPA_RPC(ofdpaFlowStatsGet, &flow, &flowStats) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_flow_stats_snap_add(flow.cookie, &flowStats);
+      count++;
+    }
+  }
+
+  LOG_TRACE("Flow stats snapshot of table %d has %d flows", tableId, count);
+}
+
+static void ind_ofdpa_flow_stats_snap_entry_free(bighash_entry_t *e)
+{
+  aim_free(container_of(e, hash_entry, ind_ofdpa_flow_stats_snap_t));
+}
+
+static void ind_ofdpa_flow_stats_snap_build(void)
+{
+  indigo_time_t now = INDIGO_CURRENT_TIME;
+  int tableId;
+
+  /* Too old to serve: walk the requested tables again */
+  if (ind_ofdpa_flow_stats_snap_table != NULL &&
+      INDIGO_TIME_DIFF_ms(ind_ofdpa_flow_stats_snap_time, now) >
+      IND_OFDPA_FLOW_STATS_SNAP_MAX_AGE_MS)
+  {
+    bighash_table_destroy(ind_ofdpa_flow_stats_snap_table,
+                          ind_ofdpa_flow_stats_snap_entry_free);
+    ind_ofdpa_flow_stats_snap_table = NULL;
+    memset(ind_ofdpa_flow_stats_snap_tables, 0, sizeof(ind_ofdpa_flow_stats_snap_tables));
+  }
+
+  if (ind_ofdpa_flow_stats_snap_table == NULL)
+  {
+    ind_ofdpa_flow_stats_snap_table = bighash_table_create(IND_OFDPA_FLOW_STATS_SNAP_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_flow_stats_snap_table != NULL);
+    ind_ofdpa_flow_stats_snap_time = now;
+  }
+
+  for (tableId = 0; tableId < 256; tableId++)
+  {
+    if (ind_ofdpa_flow_stats_bulk_tables[tableId] &&
+        !ind_ofdpa_flow_stats_snap_tables[tableId])
+    {
+      ind_ofdpa_flow_stats_snap_table_walk(tableId);
+      ind_ofdpa_flow_stats_snap_tables[tableId] = true;
+    }
+  }
+}
+
+static void ind_ofdpa_flow_stats_snap_free(void)
+{
+  if (ind_ofdpa_flow_stats_snap_table != NULL)
+  {
+    bighash_table_destroy(ind_ofdpa_flow_stats_snap_table,
+                          ind_ofdpa_flow_stats_snap_entry_free);
+    ind_ofdpa_flow_stats_snap_table = NULL;
+  }
+
+  memset(ind_ofdpa_flow_stats_bulk_tables, 0, sizeof(ind_ofdpa_flow_stats_bulk_tables));
+  memset(ind_ofdpa_flow_stats_snap_tables, 0, sizeof(ind_ofdpa_flow_stats_snap_tables));
+  ind_ofdpa_flow_stats_bulk_lookups = 0;
+}
+
+/* Find a flow's counters in the snapshot, building it when due */
+static ind_ofdpa_flow_stats_snap_t *ind_ofdpa_flow_stats_snap_find(uint64_t cookie)
+{
+  if (ind_ofdpa_flow_stats_bulk_refcount == 0)
+  {
+    return NULL;
+  }
+
+  if (ind_ofdpa_flow_stats_bulk_lookups < IND_OFDPA_FLOW_STATS_BULK_THRESHOLD)
+  {
+    ind_ofdpa_flow_stats_bulk_lookups++;
+    return NULL;
+  }
+
+  ind_ofdpa_flow_stats_snap_build();
+
+  return ind_ofdpa_flow_stats_snap_hashtable_first(ind_ofdpa_flow_stats_snap_table, &cookie);
+}
+
+void indigo_fwd_flow_stats_bulk_begin(uint8_t table_id)
+{
+  int tableId;
+
+  ind_ofdpa_flow_stats_bulk_refcount++;
+
+  if (table_id == 0xff)
+  {
+    for (tableId = 0; tableId < 256; tableId++)
+    {
+      ind_ofdpa_flow_stats_bulk_tables[tableId] = true;
+    }
+  }
+  else
+  {
+    ind_ofdpa_flow_stats_bulk_tables[table_id] = true;
+  }
+}
+
+void indigo_fwd_flow_stats_bulk_end(void)
+{
+  if (ind_ofdpa_flow_stats_bulk_refcount == 0)
+  {
+    LOG_ERROR("Unbalanced flow stats bulk end.");
+    return;
+  }
+
+  if (--ind_ofdpa_flow_stats_bulk_refcount == 0)
+  {
+    ind_ofdpa_flow_stats_snap_free();
+  }
+}
+
+indigo_error_t indigo_fwd_flow_stats_get(indigo_cookie_t flow_id,
+                                         indigo_fi_flow_stats_t *flow_stats)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  ofdpaFlowEntry_t flow;
+  ofdpaFlowEntryStats_t flowStats;
+  ind_ofdpa_flow_stats_snap_t *snap;
+
+  memset(&flow, 0, sizeof(flow));
+  memset(&flowStats, 0, sizeof(flowStats));
+
+  ind_ofdpa_flow_worker_wait();
+
+  /* A queued add has no counters yet */
+  if (ind_ofdpa_flow_batch_find(flow_id) != NULL)
+  {
+    memset(flow_stats, 0, sizeof(*flow_stats));
+    flow_stats->flow_id = flow_id;
+    return INDIGO_ERROR_NONE;
+  }
+
+  snap = ind_ofdpa_flow_stats_snap_find(flow_id);
+  if (snap != NULL)
+  {
+    flowStats = snap->stats;
+  }
+  else if (!ind_ofdpa_color_flow_stats_get(flow_id, &flowStats))
+  {
+    /* Get the flow and flow stats from flow id */
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowByCookieGet, flow_id, &flow, &flowStats);
+  }
+  if (ofdpa_rv == OFDPA_E_NONE)
+  {
+    flow_stats->flow_id = flow_id;
+    flow_stats->duration_ns = (flowStats.durationSec) * (IND_OFDPA_NANO_SEC); /* Convert to nsecs */
+    flow_stats->packets = flowStats.receivedPackets;
+    flow_stats->bytes = flowStats.receivedBytes;
+
+    LOG_TRACE("Flow stats get successful. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else if (ofdpa_rv == OFDPA_E_NOT_FOUND)
+  {
+    LOG_ERROR("Request to get stats of a non-existent flow. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    LOG_ERROR("Failed to get flow stats. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+
+  return (indigoConvertOfdpaRv(ofdpa_rv));
+}
+
+/*
+ * Warm start
+ *
+ * Flows already in the OF-DPA tables are rebuilt as flow_adds and adopted
+ * by the state manager under their cookie, which is the Indigo flow id.
+ * The match is read back through the per-table field layouts used to
+ * program it. Of the instructions only goto-table and the write-actions
+ * group are recovered, and the controller's cookie, which OF-DPA does not
+ * keep, reads back as zero. Nothing is written to the hardware.
+ */
+
+/* OXM header, unmasked form, of each match field bit */
+typedef struct ind_ofdpa_oxm_wire_s
+{
+  ind_ofdpa_fields_t field;
+  uint32_t           type_len;
+  uint32_t           experimenter;  /* 0 for the basic class */
+  uint8_t            maskable;      /* LOCI knows a masked form */
+} ind_ofdpa_oxm_wire_t;
+
+#define IND_OFDPA_OXM_BASIC(bit, type_len) { bit, type_len, 0, 1 }
+#define IND_OFDPA_OXM_OFDPA(bit, type_len, maskable) \
+  { bit, type_len, IND_OFDPA_OXM_EXPERIMENTER_OFDPA, maskable }
+
+static const ind_ofdpa_oxm_wire_t ind_ofdpa_oxm_wires[] =
+{
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_PORT,                0x80000004),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_DSTMAC,              0x80000606),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_SRCMAC,              0x80000806),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_ETHER_TYPE,          0x80000a02),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_VLANID,              0x80000c02),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_VLAN_PCP,            0x80000e01),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IP_DSCP,             0x80001001),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IP_ECN,              0x80001201),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IP_PROTO,            0x80001401),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IPV4_SRC,            0x80001604),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IPV4_DST,            0x80001804),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_TCP_L4_SRC_PORT,     0x80001a02),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_TCP_L4_DST_PORT,     0x80001c02),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_UDP_L4_SRC_PORT,     0x80001e02),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_UDP_L4_DST_PORT,     0x80002002),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_SCTP_L4_SRC_PORT,    0x80002202),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_SCTP_L4_DST_PORT,    0x80002402),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_ICMPV4_TYPE,         0x80002601),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_ICMPV4_CODE,         0x80002801),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IPV4_ARP_SPA,        0x80002c04),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IPV6_SRC,            0x80003410),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IPV6_DST,            0x80003610),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_IPV6_FLOW_LABEL,     0x80003804),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_ICMPV6_TYPE,         0x80003a01),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_ICMPV6_CODE,         0x80003c01),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_MPLS_LABEL,          0x80004404),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_MPLS_TC,             0x80004601),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_MPLS_BOS,            0x80004801),
+  IND_OFDPA_OXM_BASIC(IND_OFDPA_TUNNEL_ID,           0x80004c08),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_VRF,                 0xffff0206, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_TC,                  0xffff0405, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_COLOR,               0xffff0605, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_VLAN_DEI,            0xffff0805, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_QOS_INDEX,           0xffff0a05, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_LMEP_ID,             0xffff0c08, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_MPLS_TTL,            0xffff0e05, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_MPLS_L2_PORT,        0xffff1008, 1),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_L3_IN_PORT,          0xffff1208, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_OVID,                0xffff1406, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_MPLS_DATA_FIRST_NIBBLE, 0xffff1605, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_MPLS_ACH_CHANNEL,    0xffff1806, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_MPLS_NEXT_LABEL_IS_GAL, 0xffff1a05, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_OAM_Y1731_MDL,       0xffff1c05, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_OAM_Y1731_OPCODE,    0xffff1e05, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_COLOR_ACTIONS_INDEX, 0xffff2008, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_TXFCL,               0xffff220c, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_RXFCL,               0xffff240c, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_RX_TIMESTAMP,        0xffff260c, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_BFD_DISCRIMINATOR,   0xffff2808, 1),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_PROTECTION_INDEX,    0xffff2a05, 0),
+  IND_OFDPA_OXM_OFDPA(IND_OFDPA_ALLOW_VLAN_TRANSLATION, 0xffff3005, 0),
+  { IND_ONF_ACTSET_OUTPUT, 0xffff5608, IND_OFDPA_OXM_EXPERIMENTER_ONF, 0 },
+};
+
+/* Room for the largest match of any table */
+#define IND_OFDPA_WARM_MATCH_MAX 512
+
+static const ind_ofdpa_oxm_wire_t *ind_ofdpa_oxm_wire_find(ind_ofdpa_fields_t field)
+{
+  int i;
+
+  for (i = 0; i < AIM_ARRAYSIZE(ind_ofdpa_oxm_wires); i++)
+  {
+    if (ind_ofdpa_oxm_wires[i].field == field)
+    {
+      return &ind_ofdpa_oxm_wires[i];
+    }
+  }
+  return NULL;
+}
+
+static uint64_t ind_ofdpa_match_uint_get(const uint8_t *src, int size)
+{
+  uint8_t  v8;
+  uint16_t v16;
+  uint32_t v32;
+  uint64_t v64;
+
+  switch (size)
+  {
+    case 1:
+      memcpy(&v8, src, size);
+      return v8;
+    case 2:
+      memcpy(&v16, src, size);
+      return v16;
+    case 4:
+      memcpy(&v32, src, size);
+      return v32;
+    case 8:
+      memcpy(&v64, src, size);
+      return v64;
+    default:
+      return 0;
+  }
+}
+
+/*
+ * Encode one match field of a flow entry as an OXM, the reverse of
+ * ind_ofdpa_match_fields_apply. Wildcarded fields, and optional fields
+ * without a mask that are zero, write nothing. Returns the bytes written,
+ * or -1 if buf is too small.
+ */
+static int ind_ofdpa_match_field_encode(const ind_ofdpa_match_field_t *field,
+                                        const uint8_t *base, bool mandatory,
+                                        uint8_t *buf, int space)
+{
+  const ind_ofdpa_oxm_wire_t *wire;
+  uint8_t value[16], mask[16];
+  uint64_t full, v, m;
+  bool exact = true, zero = true, wild = true;
+  int width, len, i;
+
+  wire = ind_ofdpa_oxm_wire_find(field->field);
+  if (wire == NULL)
+  {
+    return 0;
+  }
+  width = (wire->type_len & 0xff) - ((wire->experimenter != 0) ? 4 : 0);
+
+  if (field->is_addr)
+  {
+    memset(value, 0, sizeof(value));
+    memset(mask, 0xff, sizeof(mask));
+    for (i = 0; i < width && i < field->size; i++)
+    {
+      value[i] = base[field->value_offset + i];
+      if (field->mask_offset != 0)
+      {
+        mask[i] = base[field->mask_offset + i];
+      }
+    }
+  }
+  else
+  {
+    full = (width < 8) ? ((1ULL << (8 * width)) - 1) : IND_OFDPA_MATCH_ALL;
+    v = ind_ofdpa_match_uint_get(base + field->value_offset, field->size) & full;
+    m = full;
+    if (field->mask_offset != 0)
+    {
+      m = ind_ofdpa_match_uint_get(base + field->mask_offset, field->size) & full;
+      /* Bits outside mask_and were never programmable; treat them as exact */
+      if (((m | ~field->mask_and) & full) == full)
+      {
+        m = full;
+      }
+    }
+    for (i = width - 1; i >= 0; i--)
+    {
+      value[i] = v;
+      mask[i] = m;
+      v >>= 8;
+      m >>= 8;
+    }
+  }
+
+  for (i = 0; i < width; i++)
+  {
+    value[i] &= mask[i];
+    zero = zero && (value[i] == 0);
+    exact = exact && (mask[i] == 0xff);
+    wild = wild && (mask[i] == 0);
+  }
+
+  if (wild || (field->mask_offset == 0 && zero && !mandatory))
+  {
+    return 0;
+  }
+
+  /* A partial mask on a field LOCI only knows exact is read as exact */
+  len = ind_ofdpa_oxm_write(buf, space, wire->type_len, wire->experimenter, value,
+                            (exact || !wire->maskable) ? NULL : mask);
+  return (len > 0) ? len : -1;
+}
+
+/* Build the OpenFlow 1.3 wire match of a flow entry; returns its padded length */
+static int ind_ofdpa_match_build(const ind_ofdpa_match_table_t *table,
+                                 const ofdpaFlowEntry_t *flow,
+                                 uint8_t *buf, int space)
+{
+  const uint8_t *base = (const uint8_t *)flow;
+  const ind_ofdpa_match_field_t *field;
+  ind_ofdpa_fields_t mandatory = table->mandatory | table->mandatory_alt;
+  uint64_t ip_proto = 0;
+  int len = 4;
+  int padded;
+  int rv;
+  int i;
+
+  for (i = 0; i < table->field_count; i++)
+  {
+    field = &table->fields[i];
+    if (field->field == IND_OFDPA_IP_PROTO)
+    {
+      ip_proto = ind_ofdpa_match_uint_get(base + field->value_offset, field->size);
+      if (field->mask_offset != 0)
+      {
+        ip_proto &= ind_ofdpa_match_uint_get(base + field->mask_offset, field->size);
+      }
+    }
+  }
+
+  for (i = 0; i < table->field_count; i++)
+  {
+    field = &table->fields[i];
+    if (field->ip_proto != 0 && field->ip_proto != ip_proto)
+    {
+      continue;
+    }
+    rv = ind_ofdpa_match_field_encode(field, base, (mandatory & field->field) != 0,
+                                      buf + len, space - len);
+    if (rv < 0)
+    {
+      return -1;
+    }
+    len += rv;
+  }
+
+  padded = (len + 7) & ~7;
+  if (padded > space)
+  {
+    return -1;
+  }
+
+  /* ofp_match of type OXM; the length excludes the padding */
+  buf[0] = 0;
+  buf[1] = 1;
+  buf[2] = len >> 8;
+  buf[3] = len;
+  memset(buf + len, 0, padded - len);
+
+  return padded;
+}
+
+/* The goto-table and write-actions group of a flow entry, 0 when absent */
+static void ind_ofdpa_flow_next_get(const ofdpaFlowEntry_t *flow,
+                                    uint32_t *goto_table, uint32_t *group_id)
+{
+  *goto_table = 0;
+  *group_id = 0;
+
+  switch (flow->tableId)
+  {
+    case OFDPA_FLOW_TABLE_ID_INGRESS_PORT:
+      *goto_table = flow->flowData.ingressPortFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_INJECTED_OAM:
+      *goto_table = flow->flowData.injectedOamFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_VLAN:
+      *goto_table = flow->flowData.vlanFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_VLAN_1:
+      *goto_table = flow->flowData.vlan1FlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_MAINTENANCE_POINT:
+      *goto_table = flow->flowData.mpFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_MPLS_L2_PORT:
+      *goto_table = flow->flowData.mplsL2PortFlowEntry.gotoTableId;
+      *group_id = flow->flowData.mplsL2PortFlowEntry.groupId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_TERMINATION_MAC:
+      *goto_table = flow->flowData.terminationMacFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_MPLS_0:
+    case OFDPA_FLOW_TABLE_ID_MPLS_1:
+    case OFDPA_FLOW_TABLE_ID_MPLS_2:
+      *goto_table = flow->flowData.mplsFlowEntry.gotoTableId;
+      *group_id = flow->flowData.mplsFlowEntry.groupID;
+      break;
+    case OFDPA_FLOW_TABLE_ID_MPLS_MAINTENANCE_POINT:
+      *goto_table = flow->flowData.mplsMpFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING:
+      *goto_table = flow->flowData.unicastRoutingFlowEntry.gotoTableId;
+      *group_id = flow->flowData.unicastRoutingFlowEntry.groupID;
+      break;
+    case OFDPA_FLOW_TABLE_ID_MULTICAST_ROUTING:
+      *goto_table = flow->flowData.multicastRoutingFlowEntry.gotoTableId;
+      *group_id = flow->flowData.multicastRoutingFlowEntry.groupID;
+      break;
+    case OFDPA_FLOW_TABLE_ID_BRIDGING:
+      *goto_table = flow->flowData.bridgingFlowEntry.gotoTableId;
+      *group_id = flow->flowData.bridgingFlowEntry.groupID;
+      break;
+    case OFDPA_FLOW_TABLE_ID_L2_POLICER:
+      *goto_table = flow->flowData.l2PolicerFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_L2_POLICER_ACTIONS:
+      *goto_table = flow->flowData.l2PolicerActionsFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_PORT_DSCP_TRUST:
+    case OFDPA_FLOW_TABLE_ID_TUNNEL_DSCP_TRUST:
+    case OFDPA_FLOW_TABLE_ID_MPLS_DSCP_TRUST:
+      *goto_table = flow->flowData.dscpTrustFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_PORT_PCP_TRUST:
+    case OFDPA_FLOW_TABLE_ID_TUNNEL_PCP_TRUST:
+    case OFDPA_FLOW_TABLE_ID_MPLS_PCP_TRUST:
+      *goto_table = flow->flowData.pcpTrustFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_ACL_POLICY:
+      *group_id = flow->flowData.policyAclFlowEntry.groupID;
+      break;
+    case OFDPA_FLOW_TABLE_ID_EGRESS_VLAN:
+      *goto_table = flow->flowData.egressVlanFlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_EGRESS_VLAN_1:
+      *goto_table = flow->flowData.egressVlan1FlowEntry.gotoTableId;
+      break;
+    case OFDPA_FLOW_TABLE_ID_EGRESS_DSCP_PCP_REMARK:
+      *goto_table = flow->flowData.egressDscpPcpRemarkFlowEntry.gotoTableId;
+      break;
+    default:
+      break;
+  }
+}
 
-  /* Get the idle time and hard time */
-  (void)of_flow_modify_idle_timeout_get((of_flow_modify_t *)flow_add, &idle_timeout);
-  (void)of_flow_modify_hard_timeout_get((of_flow_modify_t *)flow_add, &hard_timeout);
-  flow.idle_time = (uint32_t)idle_timeout;
-  flow.hard_time = (uint32_t)hard_timeout;
+static indigo_error_t ind_ofdpa_flow_restore(ofdpaFlowEntry_t *flow)
+{
+  indigo_error_t err = INDIGO_ERROR_RESOURCE;
+  uint8_t buf[IND_OFDPA_WARM_MATCH_MAX];
+  of_flow_add_t *flow_add = NULL;
+  of_list_instruction_t *insts = NULL;
+  of_instruction_goto_table_t *goto_table_inst = NULL;
+  of_instruction_write_actions_t *write_actions = NULL;
+  of_list_action_t *actions = NULL;
+  of_action_group_t *group = NULL;
+  uint32_t goto_table, group_id;
+  of_octets_t octets;
+  of_match_t match;
+  int len;
 
-  memset(&of_match, 0, sizeof(of_match));
-  if (of_flow_add_match_get(flow_add, &of_match) < 0)
+  if (flow->tableId >= AIM_ARRAYSIZE(ind_ofdpa_match_tables) ||
+      ind_ofdpa_match_tables[flow->tableId].fields == NULL)
   {
-    LOG_ERROR("Error getting openflow match criteria.");
-    return INDIGO_ERROR_UNKNOWN;
+    return INDIGO_ERROR_NOT_SUPPORTED;
   }
 
-  /* Get the match fields and masks from LOCI match structure */
-  err = ind_ofdpa_match_fields_masks_get(&of_match, &flow);
-  if (err != INDIGO_ERROR_NONE)
+  len = ind_ofdpa_match_build(&ind_ofdpa_match_tables[flow->tableId], flow, buf, sizeof(buf));
+  if (len < 0)
   {
-    LOG_ERROR("Error getting match fields and masks. (err = %d)", err);
-    return err;
+    return INDIGO_ERROR_UNKNOWN;
   }
-
-  /* Get the instructions set from the LOCI flow add object */
-  err = ind_ofdpa_instructions_get(flow_add, &flow);
-  if (err != INDIGO_ERROR_NONE)
+  octets.data = buf;
+  octets.bytes = len;
+  if (of_match_deserialize(OF_VERSION_1_3, &match, &octets) < 0)
   {
-    LOG_TRACE("Failed to get flow instructions. (err = %d)", err);
-    return err;
+    return INDIGO_ERROR_COMPAT;
   }
-  /* Submit the changes to ofdpa */
-  ofdpa_rv = ofdpaFlowAdd(&flow);
-  if (ofdpa_rv != OFDPA_E_NONE)
+
+  ind_ofdpa_flow_next_get(flow, &goto_table, &group_id);
+
+  if ((flow_add = of_flow_add_new(OF_VERSION_1_3)) == NULL ||
+      (insts = of_list_instruction_new(OF_VERSION_1_3)) == NULL)
   {
-    LOG_TRACE("Failed to add flow. (ofdpa_rv = %d)", ofdpa_rv);
+    goto done;
   }
-  else
+
+  of_flow_add_table_id_set(flow_add, flow->tableId);
+  of_flow_add_priority_set(flow_add, flow->priority);
+  of_flow_add_idle_timeout_set(flow_add, flow->idle_time);
+  of_flow_add_hard_timeout_set(flow_add, flow->hard_time);
+  of_flow_add_buffer_id_set(flow_add, OF_BUFFER_ID_NO_BUFFER);
+  of_flow_add_out_port_set(flow_add, OF_PORT_DEST_WILDCARD);
+  of_flow_add_out_group_set(flow_add, OF_GROUP_ANY);
+  if (of_flow_add_match_set(flow_add, &match) < 0)
   {
-    LOG_TRACE("Flow added successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    goto done;
   }
-  return (indigoConvertOfdpaRv(ofdpa_rv));
-}
-
-indigo_error_t indigo_fwd_flow_modify(indigo_cookie_t flow_id,
-                                      of_flow_modify_t *flow_modify)
-{
-  indigo_error_t err = INDIGO_ERROR_NONE;
-  ofdpaFlowEntry_t flow;
-  ofdpaFlowEntryStats_t flowStats;
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  of_match_t of_match;
-
-  LOG_TRACE("Flow modify called");
 
-  if (flow_modify->version < OF_VERSION_1_3)
+  if (group_id != 0)
   {
-    LOG_ERROR("OpenFlow version 0x%x unsupported", flow_modify->version);
-    return INDIGO_ERROR_VERSION;
+    if ((write_actions = of_instruction_write_actions_new(OF_VERSION_1_3)) == NULL ||
+        (actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+        (group = of_action_group_new(OF_VERSION_1_3)) == NULL)
+    {
+      goto done;
+    }
+    of_action_group_group_id_set(group, group_id);
+    if (of_list_append(actions, group) < 0 ||
+        of_instruction_write_actions_actions_set(write_actions, actions) < 0 ||
+        of_list_append(insts, write_actions) < 0)
+    {
+      goto done;
+    }
   }
 
-  memset(&flow, 0, sizeof(flow));
-  memset(&flowStats, 0, sizeof(flowStats));
-
-  /* Get the flow entries and flow stats from the indigo cookie */
-  ofdpa_rv = ofdpaFlowByCookieGet(flow_id, &flow, &flowStats);
-  if (ofdpa_rv != OFDPA_E_NONE)
+  if (goto_table != 0)
   {
-    if (ofdpa_rv == OFDPA_E_NOT_FOUND)
+    if ((goto_table_inst = of_instruction_goto_table_new(OF_VERSION_1_3)) == NULL)
     {
-      LOG_ERROR("Request to modify non-existent flow. (ofdpa_rv = %d)", ofdpa_rv);
+      goto done;
     }
-    else
+    of_instruction_goto_table_table_id_set(goto_table_inst, goto_table);
+    if (of_list_append(insts, goto_table_inst) < 0)
     {
-      LOG_ERROR("Invalid flow. (ofdpa_rv = %d)", ofdpa_rv);
+      goto done;
     }
-    return (indigoConvertOfdpaRv(ofdpa_rv));
   }
 
-  memset(&of_match, 0, sizeof(of_match));
-  if (of_flow_add_match_get(flow_modify, &of_match) < 0)
+  if (of_flow_add_instructions_set(flow_add, insts) < 0)
   {
-    LOG_ERROR("Error getting openflow match criteria.");
-    return INDIGO_ERROR_UNKNOWN;
+    goto done;
   }
 
-  memset(&flow.flowData, 0, sizeof(flow.flowData));
-
-  /* Get the match fields and masks from LOCI match structure */
-  err = ind_ofdpa_match_fields_masks_get(&of_match, &flow);
-  if (err != INDIGO_ERROR_NONE)
+  err = indigo_core_flow_restore(flow->cookie, flow_add);
+  if (err == INDIGO_ERROR_NONE)
   {
-    LOG_ERROR("Error getting match fields and masks. (err = %d)", err);
-    return err;
+    ind_ofdpa_flow_shadow_add(flow);
   }
 
-  /* Get the modified instructions set from the LOCI flow add object */
-  err = ind_ofdpa_instructions_get(flow_modify, &flow);
-  if (err != INDIGO_ERROR_NONE)
+done:
+  if (group != NULL)
   {
-    LOG_TRACE("Failed to get flow instructions. (err = %d)", err);
-    return err;
+    of_object_delete(group);
   }
-
-  /* Submit the changes to ofdpa */
-  ofdpa_rv = ofdpaFlowModify(&flow);
-  if (ofdpa_rv!= OFDPA_E_NONE)
+  if (actions != NULL)
   {
-    LOG_TRACE("Failed to modify flow. (ofdpa_rv = %d)", ofdpa_rv);
+    of_object_delete(actions);
   }
-  else
+  if (write_actions != NULL)
   {
-    LOG_TRACE("Flow modified successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    of_object_delete(write_actions);
   }
-
-  return (indigoConvertOfdpaRv(ofdpa_rv));
+  if (goto_table_inst != NULL)
+  {
+    of_object_delete(goto_table_inst);
+  }
+  if (insts != NULL)
+  {
+    of_object_delete(insts);
+  }
+  if (flow_add != NULL)
+  {
+    of_object_delete(flow_add);
+  }
+  return err;
 }
 
-indigo_error_t indigo_fwd_flow_delete(indigo_cookie_t flow_id,
-                                      indigo_fi_flow_stats_t *flow_stats)
+static void ind_ofdpa_flow_restore_table(OFDPA_FLOW_TABLE_ID_t tableId,
+                                         int *restored, int *skipped)
 {
   ofdpaFlowEntry_t flow;
-  ofdpaFlowEntryStats_t flowStats;
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
 
+  if (IND_OFDPA_RPC(ofdpaFlowTableSupported, tableId) != OFDPA_E_NONE)
+  {
+    return;
+  }
+  if (IND_OFDPA_RPC(ofdpaFlowEntryInit, tableId, &flow) != OFDPA_E_NONE)
+  {
+    return;
+  }
 
-  LOG_TRACE("Flow delete called");
-
-  memset(&flow, 0, sizeof(flow));
-  memset(&flowStats, 0, sizeof(flowStats));
-
-  ofdpa_rv = ofdpaFlowByCookieGet(flow_id, &flow, &flowStats);
-  if (ofdpa_rv != OFDPA_E_NONE)
+  /*
+   * Only the walk returns whole flows, so unlike the stats snapshot a flow
+   * equal to the initial key is not picked up. Flows without an Indigo
+   * cookie were not added by this agent and are left alone.
+   */
+  while (IND_OFDPA_RPC(ofdpaFlowNextGet, &flow, &flow) == OFDPA_E_NONE)
   {
-    if (ofdpa_rv == OFDPA_E_NOT_FOUND)
+    if (flow.cookie != 0 && ind_ofdpa_flow_restore(&flow) == INDIGO_ERROR_NONE)
     {
-      LOG_ERROR("Request to delete non-existent flow. (ofdpa_rv = %d)", ofdpa_rv);
+      (*restored)++;
     }
     else
     {
-      LOG_ERROR("Invalid flow. (ofdpa_rv = %d)", ofdpa_rv);
+      LOG_VERBOSE("Flow 0x%llx in table %d left in place without state",
+                  (unsigned long long)flow.cookie, tableId);
+      (*skipped)++;
     }
 
-    return (indigoConvertOfdpaRv(ofdpa_rv));
+    /* The core holds requests for this table, so the walk stays valid */
+    ind_soc_coroutine_maybe_yield();
   }
+}
 
-  flow_stats->flow_id = flow_id;
-  flow_stats->packets = flowStats.receivedPackets;
-  flow_stats->bytes = flowStats.receivedBytes;
-  flow_stats->duration_ns = (flowStats.durationSec)*(IND_OFDPA_NANO_SEC); /* Convert to nano seconds*/
+/*
+ * The warm start runs as a coroutine so the controller connections come
+ * up, and requests for the tables already read back are served, while
+ * the rest of the state is adopted.
+ */
+static ind_ofdpa_warm_start_done_f ind_ofdpa_warm_start_done;
 
-  /* Delete the flow entry */
-  ofdpa_rv = ofdpaFlowByCookieDelete(flow_id);
-  if (ofdpa_rv != OFDPA_E_NONE)
+static void ind_ofdpa_warm_start_coroutine(void *cookie)
+{
+  int groups = 0, groups_skipped = 0;
+  int flows = 0, flows_skipped = 0;
+  int tableId;
+
+  /* Groups first, so flows find the groups they reference */
+  ind_ofdpa_groups_restore(&groups, &groups_skipped);
+  indigo_core_groups_loaded();
+
+  for (tableId = 0; tableId < 256; tableId++)
   {
-    LOG_ERROR("Failed to delete flow. (ofdpa_rv = %d)", ofdpa_rv);
+    ind_ofdpa_flow_restore_table(tableId, &flows, &flows_skipped);
+    indigo_core_table_loaded(tableId);
   }
-  else
+  indigo_core_loading_done();
+  ind_ofdpa_preload_hold(false);
+  ind_ofdpa_warm_start_running = false;
+
+  LOG_INFO("Warm start adopted %d groups and %d flows (%d groups, %d flows not adopted)",
+           groups, flows, groups_skipped, flows_skipped);
+
+  if (ind_ofdpa_warm_start_done != NULL)
   {
-    LOG_TRACE("Flow deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    ind_ofdpa_warm_start_done();
   }
-
-  return (indigoConvertOfdpaRv(ofdpa_rv));
 }
 
-indigo_error_t indigo_fwd_flow_stats_get(indigo_cookie_t flow_id,
-                                         indigo_fi_flow_stats_t *flow_stats)
+indigo_error_t ind_ofdpa_warm_start(ind_ofdpa_warm_start_done_f done)
 {
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  ofdpaFlowEntry_t flow;
-  ofdpaFlowEntryStats_t flowStats;
+  indigo_error_t rv;
 
-  memset(&flow, 0, sizeof(flow));
-  memset(&flowStats, 0, sizeof(flowStats));
-
-  /* Get the flow and flow stats from flow id */
-  ofdpa_rv = ofdpaFlowByCookieGet(flow_id, &flow, &flowStats);
-  if (ofdpa_rv == OFDPA_E_NONE)
-  {
-    flow_stats->flow_id = flow_id;
-    flow_stats->duration_ns = (flowStats.durationSec) * (IND_OFDPA_NANO_SEC); /* Convert to nsecs */
-    flow_stats->packets = flowStats.receivedPackets;
-    flow_stats->bytes = flowStats.receivedBytes;
+  ind_ofdpa_warm_start_done = done;
+  ind_ofdpa_warm_start_running = true;
+  indigo_core_loading_start();
+  /* Preloaded entries the warm start adopts are not installed again */
+  ind_ofdpa_preload_hold(true);
 
-    LOG_TRACE("Flow stats get successful. (ofdpa_rv = %d)", ofdpa_rv);
-  }
-  else if (ofdpa_rv == OFDPA_E_NOT_FOUND)
-  {
-    LOG_ERROR("Request to get stats of a non-existent flow. (ofdpa_rv = %d)", ofdpa_rv);
-  }
-  else
+  rv = ind_soc_coroutine_spawn(ind_ofdpa_warm_start_coroutine, NULL,
+                               IND_SOC_DEFAULT_PRIORITY);
+  if (rv != INDIGO_ERROR_NONE)
   {
-    LOG_ERROR("Failed to get flow stats. (ofdpa_rv = %d)", ofdpa_rv);
+    LOG_ERROR("Failed to start the warm start: %s", indigo_strerror(rv));
+    ind_ofdpa_warm_start_running = false;
+    indigo_core_loading_done();
+    ind_ofdpa_preload_hold(false);
+    return rv;
   }
 
-  return (indigoConvertOfdpaRv(ofdpa_rv));
+  return INDIGO_ERROR_NONE;
 }
 
 void indigo_fwd_table_mod(of_table_mod_t *of_table_mod,
@@ -2555,13 +4421,39 @@ void indigo_fwd_table_mod(of_table_mod_t *of_table_mod,
   return;
 }
 
+/*
+ * Tables reported in table stats
+ *
+ * The OF-DPA pipeline is fixed, so the supported tables are found once.
+ */
+static struct
+{
+  bool    valid;
+  int     count;
+  uint8_t tableIds[255];
+} ind_ofdpa_tables;
+
+static void ind_ofdpa_tables_init(void)
+{
+  uint32_t i;
+
+  ind_ofdpa_tables.count = 0;
+  for (i = 0; i < 255; i++)
+  {
+    if (IND_OFDPA_RPC(ofdpaFlowTableSupported, i) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_tables.tableIds[ind_ofdpa_tables.count++] = i;
+    }
+  }
+  ind_ofdpa_tables.valid = true;
+}
+
 indigo_error_t indigo_fwd_table_stats_get(of_table_stats_request_t *table_stats_request,
                                           of_table_stats_reply_t **table_stats_reply)
 {
   of_version_t version = table_stats_request->version;
   uint32_t xid;
-  uint32_t i;
-  ofdpaFlowTableInfo_t tableInfo;
+  int i;
   of_table_stats_entry_t entry[1];
   of_table_stats_reply_t *reply;
   of_list_table_stats_entry_t list[1];
@@ -2587,131 +4479,315 @@ indigo_error_t indigo_fwd_table_stats_get(of_table_stats_request_t *table_stats_
 
   of_table_stats_reply_entries_bind(*table_stats_reply, list);
 
+  if (!ind_ofdpa_tables.valid)
+  {
+    ind_ofdpa_tables_init();
+  }
 
-  for (i = 0; i < 255; i++)
+  for (i = 0; i < ind_ofdpa_tables.count; i++)
   {
-    if (ofdpaFlowTableSupported(i) == OFDPA_E_NONE)
-    {
-      of_table_stats_entry_init(entry, version, -1, 1);
-      (void)of_list_table_stats_entry_append_bind(list, entry);
+    of_table_stats_entry_init(entry, version, -1, 1);
+    (void)of_list_table_stats_entry_append_bind(list, entry);
 
-      /* Table Id */
-      of_table_stats_entry_table_id_set(entry, i);
+    /* Table Id */
+    of_table_stats_entry_table_id_set(entry, ind_ofdpa_tables.tableIds[i]);
 
-      /* Number of entries in the table */
-      if (ofdpaFlowTableInfoGet(i, &tableInfo) == OFDPA_E_NONE)
-      {
-        of_table_stats_entry_active_count_set(entry, tableInfo.numEntries);
-      }
+    /* Number of entries in the table; every flow is programmed through the core */
+    of_table_stats_entry_active_count_set(entry,
+                                          indigo_core_table_flow_count(ind_ofdpa_tables.tableIds[i]));
 
-      /* Number of packets looked up in table not supported. */
-      of_table_stats_entry_lookup_count_set(entry, 0);
+    /* Number of packets looked up in table not supported. */
+    of_table_stats_entry_lookup_count_set(entry, 0);
 
-      /* Number of packets that hit table not supported. */
-      of_table_stats_entry_matched_count_set(entry, 0);
-    }
+    /* Number of packets that hit table not supported. */
+    of_table_stats_entry_matched_count_set(entry, 0);
   }
 
   return(INDIGO_ERROR_NONE);
 }
 
-indigo_error_t indigo_fwd_packet_out(of_packet_out_t *packet_out)
+indigo_error_t indigo_fwd_table_flow_count_get(uint8_t table_id, uint32_t *count)
+{
+  ofdpaFlowTableInfo_t tableInfo;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  *count = 0;
+  if (IND_OFDPA_RPC(ofdpaFlowTableSupported, table_id) != OFDPA_E_NONE)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaFlowTableInfoGet, table_id, &tableInfo);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to get table %d info, rv = %d", table_id, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+
+  *count = tableInfo.numEntries;
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t indigo_fwd_packet_out(of_packet_out_t *packet_out)
+{
+  OFDPA_ERROR_t  ofdpa_rv = OFDPA_E_NONE;
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  indPacketOutActions_t packetOutActions;
+  ofdpa_buffdesc pkt;
+
+  of_port_no_t   of_port_num;
+  of_list_action_t of_list_action[1];
+  of_octets_t    of_octets[1];
+  uint32_t       buffer_id;
+  uint32_t       buf_port;
+  uint32_t       buf_len;
+  uint8_t       *buf_data;
+
+  of_packet_out_in_port_get(packet_out, &of_port_num);
+  of_packet_out_buffer_id_get(packet_out, &buffer_id);
+  of_packet_out_data_get(packet_out, of_octets);
+  of_packet_out_actions_bind(packet_out, of_list_action);
+
+  /* A buffered frame replaces any data sent with the packet_out */
+  if (buffer_id != OF_BUFFER_ID_NO_BUFFER)
+  {
+    if (ind_ofdpa_pktbuf_take(buffer_id, &buf_data, &buf_len, &buf_port))
+    {
+      of_octets->data = buf_data;
+      of_octets->bytes = buf_len;
+      of_port_num = buf_port;
+    }
+    else if (of_octets->bytes == 0)
+    {
+      LOG_ERROR("Packet out buffer_id 0x%x not found", buffer_id);
+      return INDIGO_ERROR_NOT_FOUND;
+    }
+  }
+
+  pkt.pstart = (char *)of_octets->data;
+  pkt.size = of_octets->bytes;
+
+  IND_OFDPA_PCAP_TAP(IND_OFDPA_PCAP_DIR_PKTOUT, of_octets->data, of_octets->bytes);
+
+  memset(&packetOutActions, 0, sizeof(packetOutActions));
+  err = ind_ofdpa_packet_out_actions_get_cached(of_list_action, &packetOutActions);
+  if (err != INDIGO_ERROR_NONE)
+  {
+    LOG_ERROR("Failed to get packet out actions. (err = %d)", err);
+    return err;
+  }
+
+  /* One packet_out fans out here instead of the controller sending copies */
+  if (packetOutActions.flood)
+  {
+    return indigo_port_packet_emit_all(of_port_num, of_octets->data, of_octets->bytes);
+  }
+  if (packetOutActions.group)
+  {
+    return indigo_port_packet_emit_group(packetOutActions.groupId, of_port_num,
+                                         of_octets->data, of_octets->bytes);
+  }
+
+  if (packetOutActions.pipeline)
+  {
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaPktSend, &pkt, OFDPA_PKT_LOOKUP, packetOutActions.outputPort, of_port_num);
+  }
+  else
+  {
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaPktSend, &pkt, 0, packetOutActions.outputPort, 0);
+  }
+
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Packet send failed. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    LOG_TRACE("Packet sent out of output port (%d) successfully. (ofdpa_rv = %d)", packetOutActions.outputPort, ofdpa_rv);
+  }
+
+  return (indigoConvertOfdpaRv(ofdpa_rv));
+}
+
+/*
+ * The OF-DPA action table experimenter messages are registered with the
+ * core by ind_ofdpa_experimenter_register, which dispatches them by
+ * subtype without coming here.
+ */
+indigo_error_t indigo_fwd_experimenter(of_experimenter_t *experimenter,
+                                       indigo_cxn_id_t cxn_id)
+{
+  return INDIGO_ERROR_NOT_SUPPORTED;
+}
+
+/*
+ * Shadow of the MPLS set QoS, drop status and remark action table entries
+ * written through the experimenter mods below, so the experimenter
+ * multipart gets are answered without an OF-DPA call. An entry is
+ * updated only once OF-DPA has accepted the change. A get that misses
+ * the shadow, e.g. for an entry not written by this agent, reads OF-DPA
+ * and keeps the result.
+ */
+#define IND_OFDPA_MPLS_TC_MAX 8
+#define IND_OFDPA_ACTION_SHADOW_BUCKETS 1024
+
+typedef struct ind_ofdpa_mpls_qos_shadow_s
+{
+  bool                valid;
+  ofdpaMplsQosEntry_t entry;
+} ind_ofdpa_mpls_qos_shadow_t;
+
+/* Indexed by qosIndex and mpls_tc */
+static ind_ofdpa_mpls_qos_shadow_t ind_ofdpa_mpls_qos_shadow[256][IND_OFDPA_MPLS_TC_MAX];
+
+typedef struct ind_ofdpa_drop_status_shadow_s
+{
+  bighash_entry_t        hash_entry;
+  uint32_t               lmepId;
+  ofdpaDropStatusEntry_t entry;
+} ind_ofdpa_drop_status_shadow_t;
+
+#define TEMPLATE_NAME ind_ofdpa_drop_status_shadow_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_drop_status_shadow_t
+#define TEMPLATE_KEY_FIELD lmepId
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+typedef struct ind_ofdpa_remark_key_s
+{
+  uint32_t actionTableType;
+  uint32_t index;
+  uint32_t trafficClass;
+  uint32_t color;
+} ind_ofdpa_remark_key_t;
+
+typedef struct ind_ofdpa_remark_shadow_s
 {
-  OFDPA_ERROR_t  ofdpa_rv = OFDPA_E_NONE;
-  indigo_error_t err = INDIGO_ERROR_NONE;
-  indPacketOutActions_t packetOutActions;
-  ofdpa_buffdesc pkt;
+  bighash_entry_t          hash_entry;
+  ind_ofdpa_remark_key_t   key;
+  ofdpaRemarkActionEntry_t entry;
+} ind_ofdpa_remark_shadow_t;
 
-  of_port_no_t   of_port_num;
-  of_list_action_t of_list_action[1];
-  of_octets_t    of_octets[1];
+#define TEMPLATE_NAME ind_ofdpa_remark_shadow_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_remark_shadow_t
+#define TEMPLATE_KEY_FIELD key
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
 
-  of_packet_out_in_port_get(packet_out, &of_port_num);
-  of_packet_out_data_get(packet_out, of_octets);
-  of_packet_out_actions_bind(packet_out, of_list_action);
+static bighash_table_t *ind_ofdpa_drop_status_shadow_table = NULL;
+static bighash_table_t *ind_ofdpa_remark_shadow_table = NULL;
 
+static ind_ofdpa_mpls_qos_shadow_t *ind_ofdpa_mpls_qos_shadow_slot(uint8_t qosIndex, uint8_t mpls_tc)
+{
+  if (mpls_tc >= IND_OFDPA_MPLS_TC_MAX)
+  {
+    return NULL;
+  }
+  return &ind_ofdpa_mpls_qos_shadow[qosIndex][mpls_tc];
+}
 
-  pkt.pstart = (char *)of_octets->data;
-  pkt.size = of_octets->bytes;
+static void ind_ofdpa_mpls_qos_shadow_set(const ofdpaMplsQosEntry_t *entry, bool valid)
+{
+  ind_ofdpa_mpls_qos_shadow_t *slot = ind_ofdpa_mpls_qos_shadow_slot(entry->qosIndex, entry->mpls_tc);
 
-  memset(&packetOutActions, 0, sizeof(packetOutActions));
-  err = ind_ofdpa_packet_out_actions_get(of_list_action, &packetOutActions);
-  if (err != INDIGO_ERROR_NONE)
+  if (slot != NULL)
   {
-    LOG_ERROR("Failed to get packet out actions. (err = %d)", err);
-    return err;
+    slot->valid = valid;
+    slot->entry = *entry;
   }
+}
 
-  if (packetOutActions.pipeline)
+static void ind_ofdpa_drop_status_shadow_set(const ofdpaDropStatusEntry_t *entry)
+{
+  ind_ofdpa_drop_status_shadow_t *shadow;
+  uint32_t lmepId = entry->lmepId;
+
+  if (ind_ofdpa_drop_status_shadow_table == NULL)
   {
-    ofdpa_rv = ofdpaPktSend(&pkt, OFDPA_PKT_LOOKUP, packetOutActions.outputPort, of_port_num);
+    ind_ofdpa_drop_status_shadow_table = bighash_table_create(IND_OFDPA_ACTION_SHADOW_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_drop_status_shadow_table != NULL);
   }
-  else
+
+  shadow = ind_ofdpa_drop_status_shadow_hashtable_first(ind_ofdpa_drop_status_shadow_table, &lmepId);
+  if (shadow == NULL)
   {
-    ofdpa_rv = ofdpaPktSend(&pkt, 0, packetOutActions.outputPort, 0);
+    shadow = aim_zmalloc(sizeof(*shadow));
+    shadow->lmepId = lmepId;
+    ind_ofdpa_drop_status_shadow_hashtable_insert(ind_ofdpa_drop_status_shadow_table, shadow);
   }
+  shadow->entry = *entry;
+}
 
-  if (ofdpa_rv != OFDPA_E_NONE)
+static ind_ofdpa_drop_status_shadow_t *ind_ofdpa_drop_status_shadow_find(uint32_t lmepId)
+{
+  if (ind_ofdpa_drop_status_shadow_table == NULL)
   {
-    LOG_ERROR("Packet send failed. (ofdpa_rv = %d)", ofdpa_rv);
+    return NULL;
   }
-  else
+  return ind_ofdpa_drop_status_shadow_hashtable_first(ind_ofdpa_drop_status_shadow_table, &lmepId);
+}
+
+static void ind_ofdpa_drop_status_shadow_remove(uint32_t lmepId)
+{
+  ind_ofdpa_drop_status_shadow_t *shadow = ind_ofdpa_drop_status_shadow_find(lmepId);
+
+  if (shadow != NULL)
   {
-    LOG_TRACE("Packet sent out of output port (%d) successfully. (ofdpa_rv = %d)", packetOutActions.outputPort, ofdpa_rv);
+    bighash_remove(ind_ofdpa_drop_status_shadow_table, &shadow->hash_entry);
+    aim_free(shadow);
   }
-
-  return (indigoConvertOfdpaRv(ofdpa_rv));
 }
 
-indigo_error_t indigo_fwd_experimenter(of_experimenter_t *experimenter,
-                                       indigo_cxn_id_t cxn_id)
+static void ind_ofdpa_remark_key_get(const ofdpaRemarkActionEntry_t *entry, ind_ofdpa_remark_key_t *key)
 {
-  indigo_error_t err = INDIGO_ERROR_NONE;
-  of_experimenter_ofdpa_t *obj = experimenter;
-  uint32_t subtype;
-
-  ofdpa_mpls_set_qos_action_mod_msg_t *mpls_set_qos_action;
-  ofdpa_oam_dataplane_ctr_mod_msg_t *oam_dataplane_ctr;
-  ofdpa_oam_drop_status_mod_msg_t *oam_drop_status;
-  ofdpa_mpls_tunnel_label_remark_action_mod_msg_t *mpls_tunnel_label_remark;
+  memset(key, 0, sizeof(*key));
+  key->actionTableType = entry->actionTableType;
+  key->index = entry->index;
+  key->trafficClass = entry->trafficClass;
+  key->color = entry->color;
+}
 
-  LOG_TRACE("Action tables called");
+static ind_ofdpa_remark_shadow_t *ind_ofdpa_remark_shadow_find(const ofdpaRemarkActionEntry_t *entry)
+{
+  ind_ofdpa_remark_key_t key;
 
-  if (obj->version < OF_VERSION_1_3)
+  if (ind_ofdpa_remark_shadow_table == NULL)
   {
-    LOG_ERROR("OpenFlow version 0x%x unsupported", obj->version);
-    return INDIGO_ERROR_VERSION;
+    return NULL;
   }
+  ind_ofdpa_remark_key_get(entry, &key);
+  return ind_ofdpa_remark_shadow_hashtable_first(ind_ofdpa_remark_shadow_table, &key);
+}
 
-  of_experimenter_ofdpa_subtype_get(obj, &subtype);
+static void ind_ofdpa_remark_shadow_set(const ofdpaRemarkActionEntry_t *entry)
+{
+  ind_ofdpa_remark_shadow_t *shadow;
 
-  switch (subtype)
+  if (ind_ofdpa_remark_shadow_table == NULL)
   {
-    case OFDPA_ACTION_TABLE_TYPE_MPLS_SET_QOS:
-      mpls_set_qos_action = experimenter;
-      err = indigo_set_mpls_qos(mpls_set_qos_action);
-      break;
+    ind_ofdpa_remark_shadow_table = bighash_table_create(IND_OFDPA_ACTION_SHADOW_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_remark_shadow_table != NULL);
+  }
 
-    case OFDPA_ACTION_TABLE_TYPE_OAM_DATAPLANE_COUNTER:
-      oam_dataplane_ctr = experimenter;
-      err = indigo_oam_dataplane(oam_dataplane_ctr);
-      break;
+  shadow = ind_ofdpa_remark_shadow_find(entry);
+  if (shadow == NULL)
+  {
+    shadow = aim_zmalloc(sizeof(*shadow));
+    ind_ofdpa_remark_key_get(entry, &shadow->key);
+    ind_ofdpa_remark_shadow_hashtable_insert(ind_ofdpa_remark_shadow_table, shadow);
+  }
+  shadow->entry = *entry;
+}
 
-    case OFDPA_ACTION_TABLE_TYPE_DROP_STATUS:
-      oam_drop_status = experimenter;
-      err = indigo_drop_status(oam_drop_status);
-      break;
+static void ind_ofdpa_remark_shadow_remove(const ofdpaRemarkActionEntry_t *entry)
+{
+  ind_ofdpa_remark_shadow_t *shadow = ind_ofdpa_remark_shadow_find(entry);
 
-    case OFDPA_ACTION_TABLE_TYPE_MPLS_VPN_LABEL_REMARK:
-    case OFDPA_ACTION_TABLE_TYPE_MPLS_TUNNEL_LABEL_REMARK:
-      mpls_tunnel_label_remark = experimenter;
-      err = indigo_remark_action(mpls_tunnel_label_remark);
-      break;
-    default:
-    LOG_ERROR("experimenter subtype 0x%x unsupported", subtype);
-    return INDIGO_ERROR_NOT_SUPPORTED;
+  if (shadow != NULL)
+  {
+    bighash_remove(ind_ofdpa_remark_shadow_table, &shadow->hash_entry);
+    aim_free(shadow);
   }
- return err;
 }
 
 static indigo_error_t indigo_set_mpls_qos(ofdpa_mpls_set_qos_action_mod_msg_t *mpls_set_qos_action)
@@ -2738,7 +4814,7 @@ static indigo_error_t indigo_set_mpls_qos(ofdpa_mpls_set_qos_action_mod_msg_t *m
   switch (mod_command)
   {
     case OFDPA_MSG_MOD_ADD:
-      ofdpa_rv = ofdpaMplsQosActionAdd(&mplsQosEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaMplsQosActionAdd, &mplsQosEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to add table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2746,11 +4822,12 @@ static indigo_error_t indigo_set_mpls_qos(ofdpa_mpls_set_qos_action_mod_msg_t *m
       else
       {
         LOG_TRACE("Table entry added successfully. (ofdpa_rv = %d)", ofdpa_rv);
+        ind_ofdpa_mpls_qos_shadow_set(&mplsQosEntry, true);
       }
       break;
 
     case OFDPA_MSG_MOD_MODIFY:
-      ofdpa_rv = ofdpaMplsQosActionDelete(&mplsQosEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaMplsQosActionDelete, &mplsQosEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to delete  table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2760,7 +4837,7 @@ static indigo_error_t indigo_set_mpls_qos(ofdpa_mpls_set_qos_action_mod_msg_t *m
       {
         LOG_TRACE("Table entry deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
       }
-      ofdpa_rv = ofdpaMplsQosActionAdd(&mplsQosEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaMplsQosActionAdd, &mplsQosEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to add flow. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2769,10 +4846,11 @@ static indigo_error_t indigo_set_mpls_qos(ofdpa_mpls_set_qos_action_mod_msg_t *m
       {
         LOG_TRACE("Table entryw added successfully. (ofdpa_rv = %d)", ofdpa_rv);
       }
+      ind_ofdpa_mpls_qos_shadow_set(&mplsQosEntry, ofdpa_rv == OFDPA_E_NONE);
       break;
 
     case OFDPA_MSG_MOD_DELETE:
-      ofdpa_rv = ofdpaMplsQosActionDelete(&mplsQosEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaMplsQosActionDelete, &mplsQosEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to delete flow. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2781,6 +4859,7 @@ static indigo_error_t indigo_set_mpls_qos(ofdpa_mpls_set_qos_action_mod_msg_t *m
       else
       {
         LOG_TRACE("Table entry deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+        ind_ofdpa_mpls_qos_shadow_set(&mplsQosEntry, false);
       }
       break;
 
@@ -2806,7 +4885,7 @@ indigo_error_t indigo_oam_dataplane(ofdpa_oam_dataplane_ctr_mod_msg_t *oam_datap
   switch (mod_command)
     {
       case OFDPA_MSG_MOD_ADD:
-      ofdpa_rv = ofdpaOamDataCounterAdd(lmepId, trafficClass);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaOamDataCounterAdd, lmepId, trafficClass);
         if (ofdpa_rv != OFDPA_E_NONE)
         {
           LOG_ERROR("Failed to add table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2814,11 +4893,12 @@ indigo_error_t indigo_oam_dataplane(ofdpa_oam_dataplane_ctr_mod_msg_t *oam_datap
         else
         {
           LOG_TRACE("Table entry added successfully. (ofdpa_rv = %d)", ofdpa_rv);
+          ind_ofdpa_oam_data_counter_track(lmepId, trafficClass, 1);
         }
         break;
 
       case OFDPA_MSG_MOD_MODIFY:
-        ofdpa_rv = ofdpaOamDataCounterDelete(lmepId, trafficClass);
+        ofdpa_rv = IND_OFDPA_RPC(ofdpaOamDataCounterDelete, lmepId, trafficClass);
         if (ofdpa_rv != OFDPA_E_NONE)
         {
           LOG_ERROR("Failed to delete table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2829,7 +4909,7 @@ indigo_error_t indigo_oam_dataplane(ofdpa_oam_dataplane_ctr_mod_msg_t *oam_datap
           LOG_TRACE("Table entry deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
         }
 
-        ofdpa_rv = ofdpaOamDataCounterAdd(lmepId, trafficClass);
+        ofdpa_rv = IND_OFDPA_RPC(ofdpaOamDataCounterAdd, lmepId, trafficClass);
         if (ofdpa_rv != OFDPA_E_NONE)
         {
           LOG_ERROR("Failed to add table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2838,10 +4918,11 @@ indigo_error_t indigo_oam_dataplane(ofdpa_oam_dataplane_ctr_mod_msg_t *oam_datap
         {
           LOG_TRACE("Table entry added successfully. (ofdpa_rv = %d)", ofdpa_rv);
         }
+        ind_ofdpa_oam_data_counter_track(lmepId, trafficClass, ofdpa_rv == OFDPA_E_NONE);
         break;
 
       case OFDPA_MSG_MOD_DELETE:
-        ofdpa_rv = ofdpaOamDataCounterDelete(lmepId, trafficClass);
+        ofdpa_rv = IND_OFDPA_RPC(ofdpaOamDataCounterDelete, lmepId, trafficClass);
         if (ofdpa_rv != OFDPA_E_NONE)
         {
           LOG_ERROR("Failed to delete table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2849,6 +4930,7 @@ indigo_error_t indigo_oam_dataplane(ofdpa_oam_dataplane_ctr_mod_msg_t *oam_datap
         else
         {
           LOG_TRACE("Table entry deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+          ind_ofdpa_oam_data_counter_track(lmepId, trafficClass, 0);
         }
         break;
 
@@ -2881,7 +4963,7 @@ indigo_error_t indigo_drop_status(ofdpa_oam_drop_status_mod_msg_t *oam_drop_stat
   switch (mod_command)
   {
     case OFDPA_MSG_MOD_ADD:
-      ofdpa_rv = ofdpaDropStatusAdd(&dropEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaDropStatusAdd, &dropEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to add table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2889,11 +4971,12 @@ indigo_error_t indigo_drop_status(ofdpa_oam_drop_status_mod_msg_t *oam_drop_stat
       else
       {
         LOG_TRACE("Table entry added successfully. (ofdpa_rv = %d)", ofdpa_rv);
+        ind_ofdpa_drop_status_shadow_set(&dropEntry);
       }
       break;
 
     case OFDPA_MSG_MOD_MODIFY:
-      ofdpa_rv = ofdpaDropStatusDelete(lmepId);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaDropStatusDelete, lmepId);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to delete table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2902,11 +4985,12 @@ indigo_error_t indigo_drop_status(ofdpa_oam_drop_status_mod_msg_t *oam_drop_stat
       else
       {
         LOG_TRACE("Table entry deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+        ind_ofdpa_drop_status_shadow_remove(lmepId);
       }
       break;
 
     case OFDPA_MSG_MOD_DELETE:
-      ofdpa_rv = ofdpaDropStatusDelete(lmepId);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaDropStatusDelete, lmepId);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to delete table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2914,6 +4998,7 @@ indigo_error_t indigo_drop_status(ofdpa_oam_drop_status_mod_msg_t *oam_drop_stat
       else
       {
         LOG_TRACE("Table entry deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+        ind_ofdpa_drop_status_shadow_remove(lmepId);
       }
       break;
 
@@ -2960,7 +5045,7 @@ indigo_error_t indigo_remark_action(ofdpa_mpls_tunnel_label_remark_action_mod_ms
   switch (mod_command)
   {
     case OFDPA_MSG_MOD_ADD:
-      ofdpa_rv = ofdpaRemarkActionAdd(&remarkActionEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaRemarkActionAdd, &remarkActionEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to add table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2968,11 +5053,12 @@ indigo_error_t indigo_remark_action(ofdpa_mpls_tunnel_label_remark_action_mod_ms
       else
       {
         LOG_TRACE("Table entry added successfully. (ofdpa_rv = %d)", ofdpa_rv);
+        ind_ofdpa_remark_shadow_set(&remarkActionEntry);
       }
     break;
 
     case OFDPA_MSG_MOD_MODIFY:
-      ofdpa_rv = ofdpaRemarkActionDelete(&remarkActionEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaRemarkActionDelete, &remarkActionEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to delete table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2981,10 +5067,11 @@ indigo_error_t indigo_remark_action(ofdpa_mpls_tunnel_label_remark_action_mod_ms
       else
       {
         LOG_TRACE("Table entry deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+        ind_ofdpa_remark_shadow_remove(&remarkActionEntry);
       }
       break;
 
-      ofdpa_rv = ofdpaRemarkActionAdd(&remarkActionEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaRemarkActionAdd, &remarkActionEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to add table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -2996,7 +5083,7 @@ indigo_error_t indigo_remark_action(ofdpa_mpls_tunnel_label_remark_action_mod_ms
       break;
 
     case OFDPA_MSG_MOD_DELETE:
-      ofdpa_rv = ofdpaRemarkActionDelete(&remarkActionEntry);
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaRemarkActionDelete, &remarkActionEntry);
       if (ofdpa_rv != OFDPA_E_NONE)
       {
         LOG_ERROR("Failed to delete table entry. (ofdpa_rv = %d)", ofdpa_rv);
@@ -3004,6 +5091,7 @@ indigo_error_t indigo_remark_action(ofdpa_mpls_tunnel_label_remark_action_mod_ms
       else
       {
         LOG_TRACE("Table entry deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+        ind_ofdpa_remark_shadow_remove(&remarkActionEntry);
       }
       break;
 
@@ -3014,174 +5102,511 @@ indigo_error_t indigo_remark_action(ofdpa_mpls_tunnel_label_remark_action_mod_ms
   return (indigoConvertOfdpaRv(ofdpa_rv));
 }
 
-void indigo_set_mpls_qos_get_multipart(ofdpa_mpls_set_qos_action_multipart_request_t *request,
-        ofdpa_mpls_set_qos_action_multipart_reply_t *reply)
+static void indigo_set_mpls_qos_get_multipart(ofdpa_mpls_set_qos_action_multipart_request_t *request,
+        ofdpa_mpls_set_qos_action_multipart_reply_t *reply)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+
+  uint8_t qosIndex;
+  uint8_t mpls_tc;
+
+  ofdpaMplsQosEntry_t mplsQosEntry;
+  ind_ofdpa_mpls_qos_shadow_t *slot;
+
+  ofdpa_mpls_set_qos_action_multipart_request_qos_index_get(request, &qosIndex);
+  ofdpa_mpls_set_qos_action_multipart_request_mpls_tc_get(request, &mpls_tc);
+
+  slot = ind_ofdpa_mpls_qos_shadow_slot(qosIndex, mpls_tc);
+  if (slot != NULL && slot->valid)
+  {
+    mplsQosEntry = slot->entry;
+  }
+  else
+  {
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaMplsQosActionEntryGet, qosIndex, mpls_tc, &mplsQosEntry);
+    if (ofdpa_rv == OFDPA_E_NONE)
+    {
+      ind_ofdpa_mpls_qos_shadow_set(&mplsQosEntry, true);
+    }
+  }
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to read table entry. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    ofdpa_mpls_set_qos_action_multipart_reply_qos_index_set(reply, mplsQosEntry.qosIndex);
+    ofdpa_mpls_set_qos_action_multipart_reply_mpls_tc_set(reply, mplsQosEntry.mpls_tc);
+    ofdpa_mpls_set_qos_action_multipart_reply_traffic_class_set(reply, mplsQosEntry.trafficClass);
+    ofdpa_mpls_set_qos_action_multipart_reply_color_set(reply, mplsQosEntry.color);
+    LOG_TRACE("Table entry read successfully. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+}
+
+static void indigo_oam_dataplane_get_multipart(ofdpa_oam_dataplane_ctr_multipart_request_t *request,
+        ofdpa_oam_dataplane_ctr_multipart_reply_t *reply)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+
+  uint32_t lmepId;
+  uint8_t traffic_class;
+
+  ofdpaOamDataCounterIndex_t ofdpa_index;
+  uint32_t TxFCl;
+  uint32_t RxFCl;
+
+
+  ofdpa_oam_dataplane_ctr_multipart_request_lmep_id_get(request, &lmepId);
+  ofdpa_oam_dataplane_ctr_multipart_request_traffic_class_get(request, &traffic_class);
+  ofdpa_index.lmepId = lmepId;
+  ofdpa_index.trafficClass = traffic_class;
+
+  if (!ind_ofdpa_oam_data_counters_get(lmepId, traffic_class, &TxFCl, &RxFCl))
+  {
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaOamDataCountersLMGet, ofdpa_index, &TxFCl, &RxFCl);
+  }
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to read table entry. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    ofdpa_oam_dataplane_ctr_multipart_reply_lmep_id_set(reply, lmepId);
+    ofdpa_oam_dataplane_ctr_multipart_request_traffic_class_set(reply, traffic_class);
+    ofdpa_oam_dataplane_ctr_multipart_reply_receive_packets_set(reply, RxFCl);
+    ofdpa_oam_dataplane_ctr_multipart_reply_transmit_packets_set(reply, TxFCl);
+    LOG_TRACE("Table entry read successfully. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+}
+
+static void indigo_drop_status_get_multipart(ofdpa_oam_drop_status_multipart_request_t *request,
+        ofdpa_oam_drop_status_multipart_reply_t *reply)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  uint32_t lmepId;
+  ofdpaDropStatusEntry_t dropEntry;
+  ind_ofdpa_drop_status_shadow_t *shadow;
+
+  ofdpa_oam_drop_status_multipart_request_index_get(request, &lmepId);
+
+  shadow = ind_ofdpa_drop_status_shadow_find(lmepId);
+  if (shadow != NULL)
+  {
+    dropEntry = shadow->entry;
+  }
+  else
+  {
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaDropStatusGet, lmepId, &dropEntry);
+    if (ofdpa_rv == OFDPA_E_NONE)
+    {
+      ind_ofdpa_drop_status_shadow_set(&dropEntry);
+    }
+  }
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to read table entry. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    ofdpa_oam_drop_status_multipart_reply_index_set(reply, dropEntry.lmepId);
+    ofdpa_oam_drop_status_multipart_reply_entry_type_set(reply, dropEntry.type);
+    ofdpa_oam_drop_status_multipart_reply_drop_status_set(reply, dropEntry.dropAction);
+    LOG_TRACE("Table entry read successfully. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+}
+
+static void indigo_remark_action_get_multipart(ofdpa_mpls_vpn_label_remark_action_multipart_request_t *request,
+        ofdpa_mpls_vpn_label_remark_action_multipart_reply_t *reply)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  ofdpaRemarkActionEntry_t    remarkEntry;
+  ind_ofdpa_remark_shadow_t   *shadow;
+
+  uint32_t                    actionTableType;
+  uint8_t                     color;
+
+  memset(&remarkEntry, 0, sizeof(remarkEntry));
+  ofdpa_mpls_vpn_label_remark_action_multipart_request_subtype_get(request, &actionTableType);
+  ofdpa_mpls_vpn_label_remark_action_multipart_request_index_get(request, &remarkEntry.index);
+  ofdpa_mpls_vpn_label_remark_action_multipart_request_traffic_class_get(request, &remarkEntry.trafficClass);
+  ofdpa_mpls_vpn_label_remark_action_multipart_request_color_get(request, &color);
+  remarkEntry.actionTableType = actionTableType;
+  remarkEntry.color = color;
+
+  shadow = ind_ofdpa_remark_shadow_find(&remarkEntry);
+  if (shadow != NULL)
+  {
+    remarkEntry = shadow->entry;
+  }
+  else
+  {
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaRemarkActionEntryGet, &remarkEntry);
+    if (ofdpa_rv == OFDPA_E_NONE)
+    {
+      ind_ofdpa_remark_shadow_set(&remarkEntry);
+    }
+  }
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to read table entry. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    ofdpa_mpls_vpn_label_remark_action_multipart_request_subtype_set(reply, remarkEntry.actionTableType);
+    ofdpa_mpls_vpn_label_remark_action_multipart_request_index_set(reply, remarkEntry.index);
+    ofdpa_mpls_vpn_label_remark_action_multipart_request_traffic_class_set(reply, remarkEntry.trafficClass);
+    ofdpa_mpls_vpn_label_remark_action_multipart_request_color_set(reply, remarkEntry.color);
+    ofdpa_mpls_vpn_label_remark_action_multipart_request_mpls_tc_set(reply, remarkEntry.actions.remarkData);
+    ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_pcp_set(reply, remarkEntry.actions.vlanPcp);
+    ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_dei_set(reply, remarkEntry.actions.vlanDei);
+    LOG_TRACE("Table entry read successfully. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+}
+
+/*
+ * Handlers for the OF-DPA action table experimenter messages and
+ * multiparts, registered with the core by subtype
+ */
+static indigo_error_t ind_ofdpa_experimenter_version_check(of_object_t *obj)
+{
+  if (obj->version < OF_VERSION_1_3)
+  {
+    LOG_ERROR("OpenFlow version 0x%x unsupported", obj->version);
+    return INDIGO_ERROR_VERSION;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_mpls_qos_mod_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  indigo_error_t err = ind_ofdpa_experimenter_version_check(obj);
+
+  return err < 0 ? err : indigo_set_mpls_qos(obj);
+}
+
+static indigo_error_t ind_ofdpa_oam_dataplane_mod_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  indigo_error_t err = ind_ofdpa_experimenter_version_check(obj);
+
+  return err < 0 ? err : indigo_oam_dataplane(obj);
+}
+
+static indigo_error_t ind_ofdpa_drop_status_mod_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  indigo_error_t err = ind_ofdpa_experimenter_version_check(obj);
+
+  return err < 0 ? err : indigo_drop_status(obj);
+}
+
+static indigo_error_t ind_ofdpa_remark_mod_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  indigo_error_t err = ind_ofdpa_experimenter_version_check(obj);
+
+  return err < 0 ? err : indigo_remark_action(obj);
+}
+
+static indigo_error_t ind_ofdpa_mpls_qos_multipart_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  ofdpa_mpls_set_qos_action_multipart_reply_t reply;
+  uint32_t xid;
+
+  of_experimenter_stats_request_xid_get(obj, &xid);
+  indigo_set_mpls_qos_get_multipart(obj, &reply);
+  ofdpa_mpls_set_qos_action_multipart_reply_xid_set(&reply, xid);
+  indigo_cxn_send_controller_message(cxn_id, &reply);
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_oam_dataplane_multipart_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  ofdpa_oam_dataplane_ctr_multipart_reply_t reply;
+  uint32_t xid;
+
+  of_experimenter_stats_request_xid_get(obj, &xid);
+  indigo_oam_dataplane_get_multipart(obj, &reply);
+  ofdpa_oam_dataplane_ctr_multipart_reply_xid_set(&reply, xid);
+  indigo_cxn_send_controller_message(cxn_id, &reply);
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_drop_status_multipart_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  ofdpa_oam_drop_status_multipart_reply_t reply;
+  uint32_t xid;
+
+  of_experimenter_stats_request_xid_get(obj, &xid);
+  indigo_drop_status_get_multipart(obj, &reply);
+  ofdpa_oam_drop_status_multipart_reply_xid_set(&reply, xid);
+  indigo_cxn_send_controller_message(cxn_id, &reply);
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_remark_multipart_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  ofdpa_mpls_vpn_label_remark_action_multipart_reply_t reply;
+  uint32_t xid;
+
+  of_experimenter_stats_request_xid_get(obj, &xid);
+  indigo_remark_action_get_multipart(obj, &reply);
+  ofdpa_mpls_vpn_label_remark_action_multipart_reply_xid_set(&reply, xid);
+  indigo_cxn_send_controller_message(cxn_id, &reply);
+  return INDIGO_ERROR_NONE;
+}
+
+/* Read back like the other remark tables; OF-DPA has no enumerator for it */
+#define IND_OFDPA_ACTION_TABLE_TYPE_L2_INTERFACE_REMARK 6
+
+static const struct
+{
+  indigo_core_experimenter_kind_t    kind;
+  uint32_t                           subtype;
+  const char                        *name;
+  indigo_core_experimenter_handler_f handler;
+} ind_ofdpa_experimenter_handlers[] =
+{
+  { INDIGO_CORE_EXPERIMENTER_MESSAGE, OFDPA_ACTION_TABLE_TYPE_MPLS_SET_QOS,
+    "mpls_set_qos", ind_ofdpa_mpls_qos_mod_handler },
+  { INDIGO_CORE_EXPERIMENTER_MESSAGE, OFDPA_ACTION_TABLE_TYPE_OAM_DATAPLANE_COUNTER,
+    "oam_dataplane_ctr", ind_ofdpa_oam_dataplane_mod_handler },
+  { INDIGO_CORE_EXPERIMENTER_MESSAGE, OFDPA_ACTION_TABLE_TYPE_DROP_STATUS,
+    "drop_status", ind_ofdpa_drop_status_mod_handler },
+  { INDIGO_CORE_EXPERIMENTER_MESSAGE, OFDPA_ACTION_TABLE_TYPE_MPLS_VPN_LABEL_REMARK,
+    "mpls_vpn_label_remark", ind_ofdpa_remark_mod_handler },
+  { INDIGO_CORE_EXPERIMENTER_MESSAGE, OFDPA_ACTION_TABLE_TYPE_MPLS_TUNNEL_LABEL_REMARK,
+    "mpls_tunnel_label_remark", ind_ofdpa_remark_mod_handler },
+  { INDIGO_CORE_EXPERIMENTER_MESSAGE, IND_OFDPA_EXPERIMENTER_RANGE_FLOW_ADD,
+    "range_flow_add", ind_ofdpa_range_flow_add_handler },
+  { INDIGO_CORE_EXPERIMENTER_MULTIPART, OFDPA_ACTION_TABLE_TYPE_MPLS_SET_QOS,
+    "mpls_set_qos", ind_ofdpa_mpls_qos_multipart_handler },
+  { INDIGO_CORE_EXPERIMENTER_MULTIPART, OFDPA_ACTION_TABLE_TYPE_OAM_DATAPLANE_COUNTER,
+    "oam_dataplane_ctr", ind_ofdpa_oam_dataplane_multipart_handler },
+  { INDIGO_CORE_EXPERIMENTER_MULTIPART, OFDPA_ACTION_TABLE_TYPE_DROP_STATUS,
+    "drop_status", ind_ofdpa_drop_status_multipart_handler },
+  { INDIGO_CORE_EXPERIMENTER_MULTIPART, OFDPA_ACTION_TABLE_TYPE_MPLS_VPN_LABEL_REMARK,
+    "mpls_vpn_label_remark", ind_ofdpa_remark_multipart_handler },
+  { INDIGO_CORE_EXPERIMENTER_MULTIPART, OFDPA_ACTION_TABLE_TYPE_MPLS_TUNNEL_LABEL_REMARK,
+    "mpls_tunnel_label_remark", ind_ofdpa_remark_multipart_handler },
+  { INDIGO_CORE_EXPERIMENTER_MULTIPART, IND_OFDPA_ACTION_TABLE_TYPE_L2_INTERFACE_REMARK,
+    "l2_interface_remark", ind_ofdpa_remark_multipart_handler },
+};
+
+void ind_ofdpa_experimenter_register(void)
+{
+  int i;
+
+  for (i = 0; i < AIM_ARRAYSIZE(ind_ofdpa_experimenter_handlers); i++)
+  {
+    if (indigo_core_experimenter_register(ind_ofdpa_experimenter_handlers[i].kind,
+                                          IND_OFDPA_OXM_EXPERIMENTER_OFDPA,
+                                          ind_ofdpa_experimenter_handlers[i].subtype,
+                                          ind_ofdpa_experimenter_handlers[i].name,
+                                          ind_ofdpa_experimenter_handlers[i].handler) < 0)
+    {
+      LOG_ERROR("Failed to register the %s experimenter handler",
+                ind_ofdpa_experimenter_handlers[i].name);
+    }
+  }
+}
+
+/*
+ * OF-DPA ages out flows by the idle_time and hard_time they were added
+ * with and reports each one as a flow event, so expiration is always on.
+ */
+indigo_error_t indigo_fwd_expiration_enable_set(int is_enabled)
+{
+  if (!is_enabled)
+  {
+    LOG_TRACE("OF-DPA cannot stop expiring flows.");
+    return INDIGO_ERROR_NOT_SUPPORTED;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t indigo_fwd_expiration_enable_get(int *is_enabled)
+{
+  *is_enabled = 1;
+  return INDIGO_ERROR_NONE;
+}
+
+/*
+ * Flow events are drained table by table in batches of
+ * IND_OFDPA_FLOW_EVENT_BATCH. If a wakeup has more than a batch, the rest
+ * is drained from a SocketManager task that yields between batches. Each
+ * sweep visits the tables holding flows with timeouts first.
+ *
+ * Every expiry may send a flow_removed, so the sweep stops while the
+ * connections are backed up with them and resumes from the same position
+ * once they drain. Events not yet read stay queued in OF-DPA, and the
+ * flows outlive their timeouts by the delay.
+ */
+#define IND_OFDPA_FLOW_EVENT_BATCH 64
+
+static struct
 {
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  OFDPA_FLOW_TABLE_ID_t order[255]; /* Tables in the order swept */
+  int count;
+  int idx;                          /* Table being read */
+  bool started;                     /* event holds the position in order[idx] */
+  bool rescan;                      /* Events arrived during the sweep */
+  ofdpaFlowEvent_t event;
+} ind_ofdpa_flow_event_sweep;
 
-  uint8_t qosIndex;
-  uint8_t mpls_tc;
+static bool ind_ofdpa_flow_event_task_running = false;
+static bool ind_ofdpa_flow_event_waiting = false;  /* For flow_removed to drain */
 
-  ofdpaMplsQosEntry_t mplsQosEntry;
+static void ind_ofdpa_flow_event_ready(void *cookie);
 
-  ofdpa_mpls_set_qos_action_multipart_request_qos_index_get(request, &qosIndex);
-  ofdpa_mpls_set_qos_action_multipart_request_mpls_tc_get(request, &mpls_tc);
+static void ind_ofdpa_flow_event_sweep_start(void)
+{
+  const OFDPA_FLOW_TABLE_ID_t *tableIds;
+  int count, i;
 
-  ofdpa_rv = ofdpaMplsQosActionEntryGet(qosIndex, mpls_tc, &mplsQosEntry);
-  if (ofdpa_rv != OFDPA_E_NONE)
+  count = ind_ofdpa_flow_tables_get(&tableIds);
+
+  ind_ofdpa_flow_event_sweep.count = 0;
+  for (i = 0; i < count; i++)
   {
-    LOG_ERROR("Failed to read table entry. (ofdpa_rv = %d)", ofdpa_rv);
+    if (ind_ofdpa_flow_timeout_count[tableIds[i]] != 0)
+    {
+      ind_ofdpa_flow_event_sweep.order[ind_ofdpa_flow_event_sweep.count++] = tableIds[i];
+    }
   }
-  else
+  for (i = 0; i < count; i++)
   {
-    ofdpa_mpls_set_qos_action_multipart_reply_qos_index_set(reply, mplsQosEntry.qosIndex);
-    ofdpa_mpls_set_qos_action_multipart_reply_mpls_tc_set(reply, mplsQosEntry.mpls_tc);
-    ofdpa_mpls_set_qos_action_multipart_reply_traffic_class_set(reply, mplsQosEntry.trafficClass);
-    ofdpa_mpls_set_qos_action_multipart_reply_color_set(reply, mplsQosEntry.color);
-    LOG_TRACE("Table entry read successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    if (ind_ofdpa_flow_timeout_count[tableIds[i]] == 0)
+    {
+      ind_ofdpa_flow_event_sweep.order[ind_ofdpa_flow_event_sweep.count++] = tableIds[i];
+    }
   }
+  ind_ofdpa_flow_event_sweep.idx = 0;
+  ind_ofdpa_flow_event_sweep.started = false;
+  ind_ofdpa_flow_event_sweep.rescan = false;
 }
 
-void indigo_oam_dataplane_get_multipart(ofdpa_oam_dataplane_ctr_multipart_request_t *request,
-        ofdpa_oam_dataplane_ctr_multipart_reply_t *reply)
+/* Handle up to a batch of flow events; returns true if there may be more */
+static bool ind_ofdpa_flow_event_drain(void)
 {
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  ofdpaFlowEvent_t *flowEventData = &ind_ofdpa_flow_event_sweep.event;
+  int budget = IND_OFDPA_FLOW_EVENT_BATCH;
 
-  uint32_t lmepId;
-  uint8_t traffic_class;
+  while (ind_ofdpa_flow_event_sweep.idx < ind_ofdpa_flow_event_sweep.count)
+  {
+    if (!ind_ofdpa_flow_event_sweep.started)
+    {
+      memset(flowEventData, 0, sizeof(*flowEventData));
+      flowEventData->flowMatch.tableId =
+        ind_ofdpa_flow_event_sweep.order[ind_ofdpa_flow_event_sweep.idx];
+      ind_ofdpa_flow_event_sweep.started = true;
+    }
 
-  ofdpaOamDataCounterIndex_t ofdpa_index;
-  uint32_t TxFCl;
-  uint32_t RxFCl;
+    for (;;)
+    {
+      if (indigo_cxn_flow_removed_blocked())
+      {
+        if (!ind_ofdpa_flow_event_waiting &&
+            indigo_cxn_flow_removed_ready_register(ind_ofdpa_flow_event_ready,
+                                                   NULL) == INDIGO_ERROR_NONE)
+        {
+          ind_ofdpa_flow_event_waiting = true;
+        }
+        /* Otherwise the next flow event wakeup starts a new sweep */
+        return false;
+      }
 
+      if (IND_OFDPA_RPC(ofdpaFlowEventNextGet, flowEventData) != OFDPA_E_NONE)
+      {
+        break;
+      }
 
-  ofdpa_oam_dataplane_ctr_multipart_request_lmep_id_get(request, &lmepId);
-  ofdpa_oam_dataplane_ctr_multipart_request_traffic_class_get(request, &traffic_class);
-  ofdpa_index.lmepId = lmepId;
-  ofdpa_index.trafficClass = traffic_class;
+      if (ind_ofdpa_learn_flow_expired(&flowEventData->flowMatch))
+      {
+        LOG_TRACE("Learned MAC aged out.");
+      }
+      else if (flowEventData->eventMask & OFDPA_FLOW_EVENT_HARD_TIMEOUT)
+      {
+        LOG_TRACE("Received flow event on hard timeout.");
+        ind_core_flow_expiry_handler(flowEventData->flowMatch.cookie,
+                                     INDIGO_FLOW_REMOVED_HARD_TIMEOUT);
+      }
+      else
+      {
+        LOG_TRACE("Received flow event on idle timeout.");
+        ind_core_flow_expiry_handler(flowEventData->flowMatch.cookie,
+                                     INDIGO_FLOW_REMOVED_IDLE_TIMEOUT);
+      }
 
-  ofdpa_rv = ofdpaOamDataCountersLMGet(ofdpa_index, &TxFCl, &RxFCl);
-  if (ofdpa_rv != OFDPA_E_NONE)
-  {
-    LOG_ERROR("Failed to read table entry. (ofdpa_rv = %d)", ofdpa_rv);
+      if (--budget == 0)
+      {
+        return true;
+      }
+    }
+
+    ind_ofdpa_flow_event_sweep.idx++;
+    ind_ofdpa_flow_event_sweep.started = false;
   }
-  else
+
+  /* Tables already passed may have new events */
+  if (ind_ofdpa_flow_event_sweep.rescan)
   {
-    ofdpa_oam_dataplane_ctr_multipart_reply_lmep_id_set(reply, lmepId);
-    ofdpa_oam_dataplane_ctr_multipart_request_traffic_class_set(reply, traffic_class);
-    ofdpa_oam_dataplane_ctr_multipart_reply_receive_packets_set(reply, RxFCl);
-    ofdpa_oam_dataplane_ctr_multipart_reply_transmit_packets_set(reply, TxFCl);
-    LOG_TRACE("Table entry read successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    ind_ofdpa_flow_event_sweep_start();
+    return true;
   }
+
+  return false;
 }
 
-void indigo_drop_status_get_multipart(ofdpa_oam_drop_status_multipart_request_t *request,
-        ofdpa_oam_drop_status_multipart_reply_t *reply)
+static ind_soc_task_status_t ind_ofdpa_flow_event_task(void *cookie)
 {
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  uint32_t lmepId;
-  ofdpaDropStatusEntry_t dropEntry;
-
-  ofdpa_oam_drop_status_multipart_request_index_get(request, &lmepId);
-
-  ofdpa_rv = ofdpaDropStatusGet(lmepId, &dropEntry);
-  if (ofdpa_rv != OFDPA_E_NONE)
-  {
-    LOG_ERROR("Failed to read table entry. (ofdpa_rv = %d)", ofdpa_rv);
-  }
-  else
+  while (ind_ofdpa_flow_event_drain())
   {
-    ofdpa_oam_drop_status_multipart_reply_index_set(reply, dropEntry.lmepId);
-    ofdpa_oam_drop_status_multipart_reply_entry_type_set(reply, dropEntry.type);
-    ofdpa_oam_drop_status_multipart_reply_drop_status_set(reply, dropEntry.dropAction);
-    LOG_TRACE("Table entry read successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    if (ind_soc_should_yield())
+    {
+      return IND_SOC_TASK_CONTINUE;
+    }
   }
+
+  ind_ofdpa_flow_event_task_running = false;
+  return IND_SOC_TASK_FINISHED;
 }
 
-void indigo_remark_action_get_multipart(ofdpa_mpls_vpn_label_remark_action_multipart_request_t *request,
-        ofdpa_mpls_vpn_label_remark_action_multipart_reply_t *reply)
+/* Drain a batch now and leave the rest of the sweep to the task */
+static void ind_ofdpa_flow_event_run(void)
 {
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  ofdpaRemarkActionEntry_t    remarkEntry;
-
-  OFDPA_ACTION_TABLE_TYPE_t   actionTableType;
-  uint32_t                    index;
-  uint8_t                     trafficClass;
-  OFDPA_QOS_COLORS_t          color;
-  uint8_t                     remarkData;
-  uint8_t                     vlanPcp;
-  uint8_t                     vlanDei;
-
-  ofdpa_mpls_vpn_label_remark_action_multipart_request_subtype_get(request, &actionTableType);
-  ofdpa_mpls_vpn_label_remark_action_multipart_request_index_get(request, &index);
-  ofdpa_mpls_vpn_label_remark_action_multipart_request_traffic_class_get(request, &trafficClass);
-  ofdpa_mpls_vpn_label_remark_action_multipart_request_color_get(request, (uint8_t*)&color);
-  ofdpa_mpls_vpn_label_remark_action_multipart_request_traffic_class_get(request, &remarkData);
-  ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_pcp_get(request, &vlanPcp);
-  ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_dei_get(request, &vlanDei);
-
-  ofdpa_rv = ofdpaRemarkActionEntryGet(&remarkEntry);
-  if (ofdpa_rv != OFDPA_E_NONE)
+  if (!ind_ofdpa_flow_event_drain())
   {
-    LOG_ERROR("Failed to read table entry. (ofdpa_rv = %d)", ofdpa_rv);
+    return;
   }
-  else
+
+  if (ind_soc_task_register(ind_ofdpa_flow_event_task, NULL,
+                            IND_SOC_DEFAULT_PRIORITY) < 0)
   {
-    ofdpa_mpls_vpn_label_remark_action_multipart_request_subtype_set(reply, actionTableType);
-    ofdpa_mpls_vpn_label_remark_action_multipart_request_index_set(reply, index);
-    ofdpa_mpls_vpn_label_remark_action_multipart_request_traffic_class_set(reply, trafficClass);
-    ofdpa_mpls_vpn_label_remark_action_multipart_request_color_set(reply, color);
-    ofdpa_mpls_vpn_label_remark_action_multipart_request_traffic_class_set(reply, remarkData);
-    ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_pcp_set(reply, vlanPcp);
-    ofdpa_mpls_vpn_label_remark_action_multipart_request_vlan_dei_set(reply, vlanDei);
-    LOG_TRACE("Table entry read successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    LOG_ERROR("Failed to start flow event task; draining now");
+    while (ind_ofdpa_flow_event_drain())
+      ;
+    return;
   }
+  ind_ofdpa_flow_event_task_running = true;
 }
 
-indigo_error_t indigo_fwd_expiration_enable_set(int is_enabled)
-{
-  LOG_TRACE("indigo_fwd_expiration_enable_set() unsupported.");
-  return INDIGO_ERROR_NOT_SUPPORTED;
-}
-
-indigo_error_t indigo_fwd_expiration_enable_get(int *is_enabled)
+/* Flow removed messages drained; carry on with the stopped sweep */
+static void ind_ofdpa_flow_event_ready(void *cookie)
 {
-  LOG_TRACE("indigo_fwd_expiration_enable_get() unsupported.");
-  return INDIGO_ERROR_NOT_SUPPORTED;
+  ind_ofdpa_flow_event_waiting = false;
+  ind_ofdpa_flow_event_run();
 }
 
 void ind_ofdpa_flow_event_receive(void)
 {
-  int flowTableId;
-  ofdpaFlowEvent_t flowEventData;
-
   LOG_TRACE("Reading Flow Events");
 
-  for (flowTableId = 0; flowTableId < 255; flowTableId++)
+  if (ind_ofdpa_flow_event_task_running || ind_ofdpa_flow_event_waiting)
   {
-    if (ofdpaFlowTableSupported(flowTableId) == OFDPA_E_NONE)
-    {
-      memset(&flowEventData, 0, sizeof(flowEventData));
-      flowEventData.flowMatch.tableId = flowTableId;
-
-      while (ofdpaFlowEventNextGet(&flowEventData) == OFDPA_E_NONE)
-      {
-        if (flowEventData.eventMask & OFDPA_FLOW_EVENT_HARD_TIMEOUT)
-        {
-          LOG_TRACE("Received flow event on hard timeout.");
-          ind_core_flow_expiry_handler(flowEventData.flowMatch.cookie,
-                                       INDIGO_FLOW_REMOVED_HARD_TIMEOUT);
-        }
-        else
-        {
-          LOG_TRACE("Received flow event on idle timeout.");
-          ind_core_flow_expiry_handler(flowEventData.flowMatch.cookie,
-                                       INDIGO_FLOW_REMOVED_IDLE_TIMEOUT);
-        }
-      }
-    }
+    ind_ofdpa_flow_event_sweep.rescan = true;
+    return;
   }
-  return;
+
+  ind_ofdpa_flow_event_sweep_start();
+  ind_ofdpa_flow_event_run();
 }
 
 static void ind_ofdpa_key_to_match(uint32_t portNum, of_match_t *match)
@@ -3197,9 +5622,10 @@ static void ind_ofdpa_key_to_match(uint32_t portNum, of_match_t *match)
 static indigo_error_t
 ind_ofdpa_fwd_pkt_in(of_port_no_t in_port,
                      uint8_t *data, unsigned int len, unsigned reason,
-                     of_match_t *match, OFDPA_FLOW_TABLE_ID_t tableId)
+                     of_match_t *match, OFDPA_FLOW_TABLE_ID_t tableId,
+                     uint32_t buffer_id, unsigned int data_len)
 {
-  of_octets_t of_octets = { .data = data, .bytes = len };
+  of_octets_t of_octets = { .data = data, .bytes = data_len };
   of_packet_in_t *of_packet_in;
 
   LOG_TRACE("Sending packet-in");
@@ -3211,6 +5637,7 @@ ind_ofdpa_fwd_pkt_in(of_port_no_t in_port,
   }
 
   of_packet_in_total_len_set(of_packet_in, len);
+  of_packet_in_buffer_id_set(of_packet_in, buffer_id);
   of_packet_in_reason_set(of_packet_in, reason);
   of_packet_in_table_id_set(of_packet_in, tableId);
   of_packet_in_cookie_set(of_packet_in, 0xffffffffffffffffLL);
@@ -3232,61 +5659,343 @@ ind_ofdpa_fwd_pkt_in(of_port_no_t in_port,
   return indigo_core_packet_in(of_packet_in);
 }
 
-void ind_ofdpa_pkt_receive(void)
+/*
+ * Packet capture ring.
+ *
+ * When enabled, the metadata and leading bytes of each punted packet are
+ * recorded in a fixed ring so the most recent packets can be dumped on
+ * demand. When disabled the receive loop only pays for a flag test.
+ */
+#define IND_OFDPA_PKT_CAPTURE_COUNT    64
+#define IND_OFDPA_PKT_CAPTURE_SNAP_LEN 128
+
+typedef struct ind_ofdpa_pkt_capture_entry_s
+{
+  uint32_t seq;
+  uint32_t reason;
+  uint32_t tableId;
+  uint32_t inPortNum;
+  uint32_t size;
+  uint8_t  data[IND_OFDPA_PKT_CAPTURE_SNAP_LEN];
+} ind_ofdpa_pkt_capture_entry_t;
+
+static ind_ofdpa_pkt_capture_entry_t
+  ind_ofdpa_pkt_capture_ring[IND_OFDPA_PKT_CAPTURE_COUNT];
+static uint32_t ind_ofdpa_pkt_capture_seq = 0;
+static int ind_ofdpa_pkt_capture_enabled = 0;
+
+void ind_ofdpa_pkt_capture_enable_set(int enable)
+{
+  ind_ofdpa_pkt_capture_enabled = enable;
+}
+
+int ind_ofdpa_pkt_capture_enable_get(void)
+{
+  return ind_ofdpa_pkt_capture_enabled;
+}
+
+void ind_ofdpa_pkt_capture_clear(void)
+{
+  ind_ofdpa_pkt_capture_seq = 0;
+}
+
+static void ind_ofdpa_pkt_capture_record(const ofdpaPacket_t *pkt)
+{
+  ind_ofdpa_pkt_capture_entry_t *entry;
+  uint32_t len;
+
+  entry = &ind_ofdpa_pkt_capture_ring[ind_ofdpa_pkt_capture_seq %
+                                      IND_OFDPA_PKT_CAPTURE_COUNT];
+  entry->seq = ind_ofdpa_pkt_capture_seq++;
+  entry->reason = pkt->reason;
+  entry->tableId = pkt->tableId;
+  entry->inPortNum = pkt->inPortNum;
+  entry->size = pkt->pktData.size;
+
+  len = pkt->pktData.size;
+  if (len > IND_OFDPA_PKT_CAPTURE_SNAP_LEN)
+  {
+    len = IND_OFDPA_PKT_CAPTURE_SNAP_LEN;
+  }
+  memcpy(entry->data, pkt->pktData.pstart, len);
+}
+
+void ind_ofdpa_pkt_capture_show(aim_pvs_t *pvs, int show_data)
+{
+  ind_ofdpa_pkt_capture_entry_t *entry;
+  uint32_t first, seq, i, len;
+
+  aim_printf(pvs, "Packet capture %s, %u packets captured\n",
+             ind_ofdpa_pkt_capture_enabled ? "enabled" : "disabled",
+             ind_ofdpa_pkt_capture_seq);
+
+  first = 0;
+  if (ind_ofdpa_pkt_capture_seq > IND_OFDPA_PKT_CAPTURE_COUNT)
+  {
+    first = ind_ofdpa_pkt_capture_seq - IND_OFDPA_PKT_CAPTURE_COUNT;
+  }
+
+  for (seq = first; seq < ind_ofdpa_pkt_capture_seq; seq++)
+  {
+    entry = &ind_ofdpa_pkt_capture_ring[seq % IND_OFDPA_PKT_CAPTURE_COUNT];
+    aim_printf(pvs, "%u: reason %u table %u port %u size %u\n",
+               entry->seq, entry->reason, entry->tableId,
+               entry->inPortNum, entry->size);
+    if (!show_data)
+    {
+      continue;
+    }
+
+    len = entry->size;
+    if (len > IND_OFDPA_PKT_CAPTURE_SNAP_LEN)
+    {
+      len = IND_OFDPA_PKT_CAPTURE_SNAP_LEN;
+    }
+    for (i = 0; i < len; i++)
+    {
+      aim_printf(pvs, "%s%02x", (i % 16) ? " " : "    ", entry->data[i]);
+      if (((i % 16) == 15) || (i == len - 1))
+      {
+        aim_printf(pvs, "\n");
+      }
+    }
+  }
+}
+
+/*
+ * Packet-in receive path.
+ *
+ * Packets are received directly into a wire buffer that reserves headroom
+ * for the packet_in header and match. The header is built once in a
+ * template object and copied in front of the payload, and the buffer is
+ * then handed to LOCI and on to the connection output queue without
+ * copying the payload. The receive buffer is kept across wakeups and is
+ * only replaced once it has been handed off.
+ */
+static uint8_t *ind_ofdpa_rx_buf = NULL;
+static uint32_t ind_ofdpa_rx_max_pkt_size = 0;
+static of_packet_in_t *ind_ofdpa_pkt_in_hdr = NULL;
+static int ind_ofdpa_pkt_in_headroom = 0;
+
+static indigo_error_t ind_ofdpa_pkt_in_hdr_init(void)
 {
-  indigo_error_t rc;
-  uint32_t i;
-  uint32_t maxPktSize;
-  ofdpaPacket_t rxPkt;
   of_match_t match;
-  struct timeval timeout;
+
+  if (ind_ofdpa_pkt_in_hdr != NULL)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  ind_ofdpa_pkt_in_hdr = of_packet_in_new(ofagent_of_version);
+  if (ind_ofdpa_pkt_in_hdr == NULL)
+  {
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  of_packet_in_cookie_set(ind_ofdpa_pkt_in_hdr, 0xffffffffffffffffLL);
+
+  /* The match only carries in_port, so its length does not vary */
+  ind_ofdpa_key_to_match(0, &match);
+  if (of_packet_in_match_set(ind_ofdpa_pkt_in_hdr, &match) != OF_ERROR_NONE)
+  {
+    LOG_ERROR("Failed to write match to packet-in header template");
+    of_packet_in_delete(ind_ofdpa_pkt_in_hdr);
+    ind_ofdpa_pkt_in_hdr = NULL;
+    return INDIGO_ERROR_UNKNOWN;
+  }
+
+  ind_ofdpa_pkt_in_headroom = ind_ofdpa_pkt_in_hdr->length;
+  return INDIGO_ERROR_NONE;
+}
+
+/*
+ * Build a packet_in in place around len bytes of packet data already at
+ * buf + ind_ofdpa_pkt_in_headroom, of which the first data_len are sent.
+ * On success the returned object owns buf.
+ */
+static of_packet_in_t *
+ind_ofdpa_pkt_in_build(uint8_t *buf, unsigned int len, unsigned reason,
+                       of_match_t *match, OFDPA_FLOW_TABLE_ID_t tableId,
+                       uint32_t buffer_id, unsigned int data_len)
+{
+  int msg_len = ind_ofdpa_pkt_in_headroom + data_len;
+
+  if (msg_len > OF_WIRE_BUFFER_MAX_LENGTH)
+  {
+    return NULL;
+  }
+
+  of_packet_in_total_len_set(ind_ofdpa_pkt_in_hdr, len);
+  of_packet_in_buffer_id_set(ind_ofdpa_pkt_in_hdr, buffer_id);
+  of_packet_in_reason_set(ind_ofdpa_pkt_in_hdr, reason);
+  of_packet_in_table_id_set(ind_ofdpa_pkt_in_hdr, tableId);
+
+  if ((of_packet_in_match_set(ind_ofdpa_pkt_in_hdr, match) != OF_ERROR_NONE) ||
+      (ind_ofdpa_pkt_in_hdr->length != ind_ofdpa_pkt_in_headroom))
+  {
+    return NULL;
+  }
+
+  memcpy(buf, OF_OBJECT_BUFFER_INDEX(ind_ofdpa_pkt_in_hdr, 0),
+         ind_ofdpa_pkt_in_headroom);
+  of_message_length_set(buf, msg_len);
+
+  return of_object_new_from_message(buf, msg_len);
+}
+
+/*
+ * Build the packet-in header template and learn the largest frame OF-DPA
+ * will punt. Returns the headroom to leave in front of each frame in a
+ * receive buffer, or -1 on failure.
+ */
+int ind_ofdpa_pkt_receive_init(uint32_t *max_pkt_size)
+{
+  if (ind_ofdpa_pkt_in_hdr_init() != INDIGO_ERROR_NONE)
+  {
+    LOG_ERROR("\nFailed to initialize packet-in header\r\n");
+    return -1;
+  }
 
   /* Determine how large receive buffer must be */
-  if (ofdpaMaxPktSizeGet(&maxPktSize) != OFDPA_E_NONE)
+  if ((ind_ofdpa_rx_max_pkt_size == 0) &&
+      (IND_OFDPA_RPC(ofdpaMaxPktSizeGet, &ind_ofdpa_rx_max_pkt_size) != OFDPA_E_NONE))
   {
+    ind_ofdpa_rx_max_pkt_size = 0;
     LOG_ERROR("\nFailed to determine maximum receive packet size.\r\n");
-    return;
+    return -1;
+  }
+
+  *max_pkt_size = ind_ofdpa_rx_max_pkt_size;
+  return ind_ofdpa_pkt_in_headroom;
+}
+
+/*
+ * Send a frame received at buf + headroom to the controller, unless the
+ * packet-in meter drops it or PDU offload, the ARP responder or MAC
+ * learning consumes it. Returns 1 if buf was handed to the packet-in, or
+ * 0 if the caller still owns it.
+ */
+int ind_ofdpa_pkt_deliver(uint8_t *buf, ofdpaPacket_t *rxPkt)
+{
+  indigo_error_t rc;
+  of_match_t match;
+  of_packet_in_t *of_packet_in;
+  uint8_t *data = buf + ind_ofdpa_pkt_in_headroom;
+  unsigned int len;
+  unsigned int data_len;
+  uint32_t buffer_id;
+  uint16_t miss_send_len;
+  int handed_off = 0;
+
+  LOG_TRACE("Client received packet: reason %d, table %d, port %u, size %u",
+            rxPkt->reason, rxPkt->tableId, rxPkt->inPortNum,
+            rxPkt->pktData.size);
+
+  if (ind_ofdpa_pkt_capture_enabled)
+  {
+    ind_ofdpa_pkt_capture_record(rxPkt);
+  }
+
+  len = rxPkt->pktData.size - 4;
+
+  IND_OFDPA_PCAP_TAP(IND_OFDPA_PCAP_DIR_PKTIN, data, len);
+
+  /* Drop over-quota frames before any work is done for them */
+  if (ind_ofdpa_pimu_check(rxPkt, data, len))
+  {
+    return 0;
+  }
+
+  if (ind_ofdpa_pdu_receive(rxPkt->inPortNum, data, len) ||
+      ind_ofdpa_arp_receive(rxPkt->inPortNum, data, len) ||
+      ind_ofdpa_learn_receive(rxPkt, data, len))
+  {
+    return 0;
+  }
+
+  ind_ofdpa_key_to_match(rxPkt->inPortNum, &match);
+
+  /*
+   * A buffered frame is sent up to miss_send_len bytes. OF-DPA does not
+   * report the max_len of a controller output action, so miss_send_len
+   * applies whatever the reason.
+   */
+  data_len = len;
+  buffer_id = ind_ofdpa_pktbuf_store(rxPkt->inPortNum, data, len);
+  if (buffer_id != OF_BUFFER_ID_NO_BUFFER)
+  {
+    miss_send_len = indigo_core_miss_send_len_get();
+    if ((miss_send_len != OF_CONTROLLER_PKT_NO_BUFFER) &&
+        (miss_send_len < len))
+    {
+      data_len = miss_send_len;
+    }
+  }
+
+  of_packet_in = ind_ofdpa_pkt_in_build(buf, len, rxPkt->reason,
+                                        &match, rxPkt->tableId,
+                                        buffer_id, data_len);
+  if (of_packet_in != NULL)
+  {
+    /* The packet-in now owns the receive buffer */
+    handed_off = 1;
+    rc = indigo_core_packet_in(of_packet_in);
+  }
+  else
+  {
+    rc = ind_ofdpa_fwd_pkt_in(rxPkt->inPortNum, data, len, rxPkt->reason,
+                              &match, rxPkt->tableId, buffer_id, data_len);
+  }
+
+  if (rc != INDIGO_ERROR_NONE)
+  {
+    LOG_ERROR_RL("Could not send Packet-in message, rc = 0x%x", rc);
   }
+  return handed_off;
+}
+
+void ind_ofdpa_pkt_receive(void)
+{
+  ofdpaPacket_t rxPkt;
+  struct timeval timeout;
+  uint32_t max_pkt_size;
+  int headroom;
 
-  memset(&rxPkt, 0, sizeof(ofdpaPacket_t));
-  rxPkt.pktData.pstart = (char*) malloc(maxPktSize);
-  if (rxPkt.pktData.pstart == NULL)
+  headroom = ind_ofdpa_pkt_receive_init(&max_pkt_size);
+  if (headroom < 0)
   {
-    LOG_ERROR("\nFailed to allocate receive packet buffer\r\n");
     return;
   }
-  rxPkt.pktData.size = maxPktSize;
 
   timeout.tv_sec = 0;
   timeout.tv_usec = 0;
 
-  while (ofdpaPktReceive(&timeout, &rxPkt) == OFDPA_E_NONE)
+  for (;;)
   {
-    LOG_TRACE("Client received packet");
-    LOG_TRACE("Reason:  %d", rxPkt.reason);
-    LOG_TRACE("Table ID:  %d", rxPkt.tableId);
-    LOG_TRACE("Ingress port:  %u", rxPkt.inPortNum);
-    LOG_TRACE("Size:  %u\r\n", rxPkt.pktData.size);
-    for (i = 0; i < rxPkt.pktData.size; i++)
+    if (ind_ofdpa_rx_buf == NULL)
     {
-      if (i && ((i % 16) == 0))
-        LOG_TRACE("\r\n");
-      LOG_TRACE("%02x ", (unsigned int) *(rxPkt.pktData.pstart + i));
+      ind_ofdpa_rx_buf = malloc(headroom + max_pkt_size);
+      if (ind_ofdpa_rx_buf == NULL)
+      {
+        LOG_ERROR("\nFailed to allocate receive packet buffer\r\n");
+        return;
+      }
     }
-    LOG_TRACE("\r\n");
 
-    ind_ofdpa_key_to_match(rxPkt.inPortNum, &match);
+    memset(&rxPkt, 0, sizeof(ofdpaPacket_t));
+    rxPkt.pktData.pstart = (char *)(ind_ofdpa_rx_buf + headroom);
+    rxPkt.pktData.size = max_pkt_size;
 
-    rc = ind_ofdpa_fwd_pkt_in(rxPkt.inPortNum, rxPkt.pktData.pstart,
-                              (rxPkt.pktData.size - 4), rxPkt.reason,
-                              &match, rxPkt.tableId);
+    if (ofdpaPktReceive(&timeout, &rxPkt) != OFDPA_E_NONE)
+    {
+      break;
+    }
 
-    if (rc != INDIGO_ERROR_NONE)
+    if (ind_ofdpa_pkt_deliver(ind_ofdpa_rx_buf, &rxPkt))
     {
-      LOG_ERROR("Could not send Packet-in message, rc = 0x%x", rc);
+      ind_ofdpa_rx_buf = NULL;
     }
   }
-  free(rxPkt.pktData.pstart);
   return;
 }
 
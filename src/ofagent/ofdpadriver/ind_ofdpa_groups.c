@@ -31,8 +31,16 @@
 **********************************************************************/
 
 #include "indigo/forwarding.h"
+#include "indigo/of_state_manager.h"
 #include "ind_ofdpa_util.h"
 #include "ind_ofdpa_log.h"
+#include <AIM/aim_memory.h>
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include <murmur/murmur.h>
+#include <SocketManager/socketmanager.h>
+#include <stdbool.h>
+#include <inttypes.h>
 
 static indigo_error_t
 ind_ofdpa_translate_group_actions(of_list_action_t *actions,
@@ -289,10 +297,111 @@ ind_ofdpa_translate_group_actions(of_list_action_t *actions,
     return INDIGO_ERROR_NONE;
 }
 
+/*
+ * Translated bucket cache
+ *
+ * Controllers rebalancing ECMP groups resend mostly identical buckets on
+ * every group modify.  Translation depends only on the bucket's action
+ * list, so successful translations are remembered keyed by the action
+ * list wire bytes.  The cache is direct mapped; a slot holds a copy of
+ * the bytes it was built from and is only used on an exact match.
+ */
+#define IND_OFDPA_BUCKET_CACHE_SIZE      256
+#define IND_OFDPA_BUCKET_CACHE_MAX_BYTES 128
+
+typedef struct ind_ofdpa_bucket_cache_entry_s
+{
+  int valid;
+  of_version_t version;
+  uint16_t length;
+  uint8_t actions[IND_OFDPA_BUCKET_CACHE_MAX_BYTES];
+  ind_ofdpa_group_bucket_t group_bucket;
+  uint64_t group_action_bitmap;
+  uint64_t group_action_sf_bitmap;
+} ind_ofdpa_bucket_cache_entry_t;
+
+static ind_ofdpa_bucket_cache_entry_t ind_ofdpa_bucket_cache[IND_OFDPA_BUCKET_CACHE_SIZE];
+static ind_ofdpa_bucket_cache_stats_t ind_ofdpa_bucket_cache_stats;
+
 static indigo_error_t
-ind_ofdpa_translate_group_buckets(uint32_t group_id,
-                                  of_list_bucket_t *of_buckets,
-                                  uint16_t command)
+ind_ofdpa_translate_group_actions_cached(of_list_action_t *actions,
+                                         ind_ofdpa_group_bucket_t *group_bucket,
+                                         uint64_t *group_action_bitmap,
+                                         uint64_t *group_action_sf_bitmap)
+{
+  ind_ofdpa_bucket_cache_entry_t *entry;
+  uint8_t *data = OF_OBJECT_BUFFER_INDEX(actions, 0);
+  int length = actions->length;
+  uint64_t action_bitmap = 0;
+  uint64_t action_sf_bitmap = 0;
+  indigo_error_t err;
+
+  if (length > IND_OFDPA_BUCKET_CACHE_MAX_BYTES)
+  {
+    ind_ofdpa_bucket_cache_stats.bypass++;
+    return ind_ofdpa_translate_group_actions(actions, group_bucket,
+                                             group_action_bitmap, group_action_sf_bitmap);
+  }
+
+  entry = &ind_ofdpa_bucket_cache[murmur_hash(data, length, actions->version) %
+                                  IND_OFDPA_BUCKET_CACHE_SIZE];
+
+  if (entry->valid && entry->version == actions->version &&
+      entry->length == length && !memcmp(entry->actions, data, length))
+  {
+    ind_ofdpa_bucket_cache_stats.hits++;
+    *group_bucket = entry->group_bucket;
+    *group_action_bitmap |= entry->group_action_bitmap;
+    *group_action_sf_bitmap |= entry->group_action_sf_bitmap;
+    return INDIGO_ERROR_NONE;
+  }
+
+  ind_ofdpa_bucket_cache_stats.misses++;
+
+  err = ind_ofdpa_translate_group_actions(actions, group_bucket,
+                                          &action_bitmap, &action_sf_bitmap);
+  if (err < 0)
+  {
+    return err;
+  }
+
+  entry->valid = 1;
+  entry->version = actions->version;
+  entry->length = length;
+  memcpy(entry->actions, data, length);
+  entry->group_bucket = *group_bucket;
+  entry->group_action_bitmap = action_bitmap;
+  entry->group_action_sf_bitmap = action_sf_bitmap;
+
+  *group_action_bitmap |= action_bitmap;
+  *group_action_sf_bitmap |= action_sf_bitmap;
+
+  return INDIGO_ERROR_NONE;
+}
+
+void
+ind_ofdpa_bucket_cache_stats_get(ind_ofdpa_bucket_cache_stats_t *stats)
+{
+  *stats = ind_ofdpa_bucket_cache_stats;
+}
+
+void
+ind_ofdpa_bucket_cache_clear(void)
+{
+  memset(ind_ofdpa_bucket_cache, 0, sizeof(ind_ofdpa_bucket_cache));
+  memset(&ind_ofdpa_bucket_cache_stats, 0, sizeof(ind_ofdpa_bucket_cache_stats));
+}
+
+/*
+ * Translate a LOCI bucket list into OF-DPA bucket entries without touching
+ * the hardware.  On success *entries_out holds *count_out entries indexed
+ * by bucket position and must be released with aim_free.
+ */
+indigo_error_t
+ind_ofdpa_group_bucket_entries_build(uint32_t group_id,
+                                     of_list_bucket_t *of_buckets,
+                                     ofdpaGroupBucketEntry_t **entries_out,
+                                     int *count_out)
 {
   indigo_error_t err;
   uint16_t bucket_index = 0;
@@ -300,15 +409,29 @@ ind_ofdpa_translate_group_buckets(uint32_t group_id,
   of_bucket_t of_bucket;
   ind_ofdpa_group_bucket_t group_bucket;
   int rv;
+  int count = 0;
   uint32_t group_type, sub_group_type;
   uint64_t group_action_bitmap = 0;
   uint64_t group_action_sf_bitmap = 0;
-  ofdpaGroupEntry_t group_entry;
   ofdpaGroupBucketEntry_t group_bucket_entry;
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_FAIL;
-  int group_added = 0;
+  ofdpaGroupBucketEntry_t *entries;
   of_port_no_t watch_port;
 
+  OF_LIST_BUCKET_ITER(of_buckets, &of_bucket, rv)
+  {
+    count++;
+  }
+
+  if (count == 0)
+  {
+    LOG_ERROR("Group 0x%x has no buckets", group_id);
+    return INDIGO_ERROR_PARAM;
+  }
+
+  entries = aim_zmalloc(count * sizeof(*entries));
+
+  IND_OFDPA_RPC(ofdpaGroupTypeGet, group_id, &group_type);
+
   OF_LIST_BUCKET_ITER(of_buckets, &of_bucket, rv)
   {
     of_bucket_watch_port_get(&of_bucket,&watch_port);
@@ -317,21 +440,15 @@ ind_ofdpa_translate_group_buckets(uint32_t group_id,
 
     memset(&group_bucket, 0, sizeof(group_bucket));
 
-    err = ind_ofdpa_translate_group_actions(
+    err = ind_ofdpa_translate_group_actions_cached(
         &of_actions, &group_bucket, &group_action_bitmap, &group_action_sf_bitmap);
     if (err < 0)
     {
       LOG_ERROR("Error in translating group actions");
-      if (group_added == 1)
-      {
-        /* Delete the added group */
-        (void)ofdpaGroupDelete(group_id);
-      }
+      aim_free(entries);
       return err;
     }
 
-    ofdpaGroupTypeGet(group_id, &group_type);
-
     memset(&group_bucket_entry, 0, sizeof(group_bucket_entry));
     group_bucket_entry.groupId = group_id;
     group_bucket_entry.bucketIndex = bucket_index;
@@ -446,7 +563,7 @@ ind_ofdpa_translate_group_buckets(uint32_t group_id,
         break;
 
       case OFDPA_GROUP_ENTRY_TYPE_MPLS_LABEL:
-        ofdpaGroupMplsSubTypeGet(group_id, &sub_group_type);
+        IND_OFDPA_RPC(ofdpaGroupMplsSubTypeGet, group_id, &sub_group_type);
         switch (sub_group_type)
         {
           case OFDPA_MPLS_INTERFACE:
@@ -548,12 +665,13 @@ ind_ofdpa_translate_group_buckets(uint32_t group_id,
 
           default:
             LOG_ERROR("unsupported MPLS_SUBTYPE %d for GROUP_TYPE %d", sub_group_type, group_type);
-            return INDIGO_ERROR_COMPAT;
+            err = INDIGO_ERROR_COMPAT;
+            break;
         }
         break;
 
       case OFDPA_GROUP_ENTRY_TYPE_MPLS_FORWARDING:
-        ofdpaGroupMplsSubTypeGet(group_id, &sub_group_type);
+        IND_OFDPA_RPC(ofdpaGroupMplsSubTypeGet, group_id, &sub_group_type);
         switch (sub_group_type)
         {
           case OFDPA_MPLS_FAST_FAILOVER:
@@ -614,7 +732,8 @@ ind_ofdpa_translate_group_buckets(uint32_t group_id,
 
           default:
             LOG_ERROR("unsupported MPLS_SUBTYPE %d for GROUP_TYPE %d", sub_group_type, group_type);
-            return INDIGO_ERROR_COMPAT;
+            err = INDIGO_ERROR_COMPAT;
+            break;
         }
         break;
 
@@ -630,132 +749,1517 @@ ind_ofdpa_translate_group_buckets(uint32_t group_id,
       {
         LOG_ERROR("Incompatible fields for Group Type");
       }
-      if (group_added == 1)
-      {
-        /* Delete the added group */
-        (void)ofdpaGroupDelete(group_id);
-      }
+      aim_free(entries);
       return err;
     }
 
-    if (command == OF_GROUP_ADD)
+    entries[bucket_index] = group_bucket_entry;
+    bucket_index++;
+  }
+
+  *entries_out = entries;
+  *count_out = count;
+
+  return INDIGO_ERROR_NONE;
+}
+
+/* Rewrite one existing bucket */
+static OFDPA_ERROR_t
+ind_ofdpa_group_bucket_replace(ofdpaGroupBucketEntry_t *entry)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryModify, entry);
+  if (ofdpa_rv == OFDPA_E_NONE)
+  {
+    return ofdpa_rv;
+  }
+
+  /* Not every group type allows an in place modify */
+  LOG_TRACE("Replacing Group bucket %d, modify rv = %d", entry->bucketIndex, ofdpa_rv);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryDelete, entry->groupId, entry->bucketIndex);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Error in deleting Group bucket %d, rv = %d", entry->bucketIndex, ofdpa_rv);
+    return ofdpa_rv;
+  }
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryAdd, entry);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Error in adding Group bucket %d, rv = %d", entry->bucketIndex, ofdpa_rv);
+  }
+  return ofdpa_rv;
+}
+
+/*
+ * Bring the buckets of an existing group from old_entries to new_entries.
+ * Entries are built from zeroed storage, so a byte compare tells whether
+ * a bucket index changed.  Unchanged indices are left alone.
+ */
+static OFDPA_ERROR_t
+ind_ofdpa_group_buckets_diff_apply(uint32_t group_id,
+                                   ofdpaGroupBucketEntry_t *old_entries,
+                                   int old_count,
+                                   ofdpaGroupBucketEntry_t *new_entries,
+                                   int new_count)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  int i;
+
+  /* Shrink from the end so the remaining indices stay contiguous */
+  for (i = old_count - 1; i >= new_count; i--)
+  {
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryDelete, group_id, i);
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_ERROR("Error in deleting Group bucket %d, rv = %d", i, ofdpa_rv);
+      return ofdpa_rv;
+    }
+  }
+
+  for (i = 0; i < new_count; i++)
+  {
+    if (i < old_count)
     {
-      if (bucket_index == 0)
+      if (!memcmp(&old_entries[i], &new_entries[i], sizeof(new_entries[i])))
       {
-        /* First Bucket; Add Group first*/
-        group_entry.groupId = group_id;
-        ofdpa_rv = ofdpaGroupAdd(&group_entry);
-        if (ofdpa_rv != OFDPA_E_NONE)
-        {
-          LOG_ERROR("Error in adding Group, rv = %d",ofdpa_rv);
-          break;
-        }
-        group_added = 1;
+        continue;
       }
-    }
-    else /* OF_GROUP_MODIFY */
-    {
-      if (bucket_index == 0)
+
+      ofdpa_rv = ind_ofdpa_group_bucket_replace(&new_entries[i]);
+      if (ofdpa_rv != OFDPA_E_NONE)
       {
-        /* First Bucket; Delete all buckets first */
-        ofdpa_rv = ofdpaGroupBucketsDeleteAll(group_id);
-        if (ofdpa_rv != OFDPA_E_NONE)
-        {
-          LOG_ERROR("Error in deleting Group buckets, rv = %d",ofdpa_rv);
-          break;
-        }
+        return ofdpa_rv;
       }
+      continue;
     }
 
-    ofdpa_rv = ofdpaGroupBucketEntryAdd(&group_bucket_entry);
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryAdd, &new_entries[i]);
     if (ofdpa_rv != OFDPA_E_NONE)
     {
-      LOG_ERROR("Error in adding Group bucket, rv = %d",ofdpa_rv);
-      if (group_added == 1)
+      LOG_ERROR("Error in adding Group bucket %d, rv = %d", i, ofdpa_rv);
+      return ofdpa_rv;
+    }
+  }
+
+  return ofdpa_rv;
+}
+
+/*
+ * Fast failover assist
+ *
+ * An MPLS fast failover group forwards through its first bucket whose
+ * watch port is live, which needs liveness from the hardware. Each such
+ * group is kept here with the buckets the controller set, and each
+ * bucket is indexed by its watch port. With the assist on, a link down
+ * event rewrites the buckets watching the port to forward like the first
+ * bucket of the group whose watch port is up, before the port status is
+ * queued for the controller; link up puts them back. Ports found down are
+ * tracked whether or not the assist is on.
+ */
+#define IND_OFDPA_FF_MAX_BUCKETS 32
+#define IND_OFDPA_FF_BUCKETS     1024
+
+typedef struct ind_ofdpa_ff_watch_s
+{
+  bighash_entry_t             hash_entry;
+  uint32_t                    port;
+  struct ind_ofdpa_ff_group_s *group;
+  int                         bucket;
+} ind_ofdpa_ff_watch_t;
+
+#define TEMPLATE_NAME ind_ofdpa_ff_watch_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_ff_watch_t
+#define TEMPLATE_KEY_FIELD port
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+typedef struct ind_ofdpa_ff_group_s
+{
+  bighash_entry_t          hash_entry;
+  uint32_t                 group_id;
+  int                      count;
+  ofdpaGroupBucketEntry_t  entries[IND_OFDPA_FF_MAX_BUCKETS];  /* As the controller set them */
+  uint8_t                  target[IND_OFDPA_FF_MAX_BUCKETS];   /* Bucket each one forwards like */
+  ind_ofdpa_ff_watch_t     watches[IND_OFDPA_FF_MAX_BUCKETS];
+} ind_ofdpa_ff_group_t;
+
+#define TEMPLATE_NAME ind_ofdpa_ff_group_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_ff_group_t
+#define TEMPLATE_KEY_FIELD group_id
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static struct
+{
+  int              enabled;
+  bighash_table_t *groups;
+  bighash_table_t *watches;
+  uint32_t        *down_ports;
+  int              down_count;
+  int              down_size;
+  uint64_t         switches;
+  uint64_t         restores;
+  uint64_t         failures;
+} ind_ofdpa_ff;
+
+static int ind_ofdpa_ff_down_index(uint32_t port)
+{
+  int i;
+
+  for (i = 0; i < ind_ofdpa_ff.down_count; i++)
+  {
+    if (ind_ofdpa_ff.down_ports[i] == port)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static void ind_ofdpa_ff_down_set(uint32_t port, int down)
+{
+  int i = ind_ofdpa_ff_down_index(port);
+
+  if (down && i < 0)
+  {
+    if (ind_ofdpa_ff.down_count == ind_ofdpa_ff.down_size)
+    {
+      ind_ofdpa_ff.down_size = ind_ofdpa_ff.down_size ? ind_ofdpa_ff.down_size * 2 : 16;
+      ind_ofdpa_ff.down_ports = aim_realloc(ind_ofdpa_ff.down_ports,
+                                            ind_ofdpa_ff.down_size * sizeof(uint32_t));
+      AIM_TRUE_OR_DIE(ind_ofdpa_ff.down_ports != NULL);
+    }
+    ind_ofdpa_ff.down_ports[ind_ofdpa_ff.down_count++] = port;
+  }
+  else if (!down && i >= 0)
+  {
+    ind_ofdpa_ff.down_ports[i] = ind_ofdpa_ff.down_ports[--ind_ofdpa_ff.down_count];
+  }
+}
+
+static int ind_ofdpa_ff_watch_up(ind_ofdpa_ff_group_t *group, int bucket)
+{
+  uint32_t port = group->entries[bucket].bucketData.mplsFastFailOver.watchPort;
+
+  return (port == OF_PORT_DEST_WILDCARD) || (ind_ofdpa_ff_down_index(port) < 0);
+}
+
+/* Program each bucket of a group to forward like the bucket it should */
+static void ind_ofdpa_ff_group_apply(ind_ofdpa_ff_group_t *group)
+{
+  ofdpaGroupBucketEntry_t entry;
+  int i, want;
+
+  for (i = 0; i < group->count; i++)
+  {
+    want = i;
+    if (ind_ofdpa_ff.enabled && !ind_ofdpa_ff_watch_up(group, i))
+    {
+      for (want = 0; want < group->count; want++)
       {
-        /* Delete the added group */
-        (void)ofdpaGroupDelete(group_id);
+        if (want != i && ind_ofdpa_ff_watch_up(group, want))
+        {
+          break;
+        }
       }
-      else /* OF_GROUP_MODIFY */
+      if (want == group->count)
       {
-        /* Need to clean up and delete Group here as well.
-           Will be done by the caller as the Group also needs to
-           be deleted from the Indigo database. */
+        /* No live bucket to take over; leave it to the hardware */
+        want = i;
       }
-      break;
     }
 
-    bucket_index++;
+    if (want == group->target[i])
+    {
+      continue;
+    }
+
+    entry = group->entries[i];
+    entry.referenceGroupId = group->entries[want].referenceGroupId;
+    if (ind_ofdpa_group_bucket_replace(&entry) != OFDPA_E_NONE)
+    {
+      LOG_ERROR("Failed to switch bucket %d of fast failover group 0x%x", i, group->group_id);
+      ind_ofdpa_ff.failures++;
+      continue;
+    }
+
+    LOG_VERBOSE("Fast failover group 0x%x bucket %d now forwards like bucket %d",
+                group->group_id, i, want);
+    if (want == i)
+    {
+      ind_ofdpa_ff.restores++;
+    }
+    else
+    {
+      ind_ofdpa_ff.switches++;
+    }
+    group->target[i] = want;
   }
+}
 
-  return indigoConvertOfdpaRv(ofdpa_rv);
+static void ind_ofdpa_ff_group_free(ind_ofdpa_ff_group_t *group)
+{
+  int i;
+
+  for (i = 0; i < group->count; i++)
+  {
+    if (group->watches[i].group != NULL)
+    {
+      bighash_remove(ind_ofdpa_ff.watches, &group->watches[i].hash_entry);
+    }
+  }
+  bighash_remove(ind_ofdpa_ff.groups, &group->hash_entry);
+  aim_free(group);
 }
 
-indigo_error_t indigo_fwd_group_add(uint32_t id, uint8_t group_type, of_list_bucket_t *buckets)
+static void ind_ofdpa_ff_group_remove(uint32_t group_id)
 {
-  indigo_error_t err;
+  ind_ofdpa_ff_group_t *group;
 
-  if ((group_type != OF_GROUP_TYPE_INDIRECT) &&
-      (group_type != OF_GROUP_TYPE_SELECT) &&
-      (group_type != OF_GROUP_TYPE_FF) &&
-      (group_type != OF_GROUP_TYPE_ALL))
+  if (ind_ofdpa_ff.groups != NULL &&
+      (group = ind_ofdpa_ff_group_hashtable_first(ind_ofdpa_ff.groups, &group_id)) != NULL)
   {
-    return INDIGO_ERROR_NOT_SUPPORTED;
+    ind_ofdpa_ff_group_free(group);
+  }
+}
+
+/*
+ * Record the buckets just programmed for a group. When rewritten is
+ * false, buckets equal to the previous ones were left as they were in
+ * OF-DPA, so they keep any switch already applied.
+ */
+static void ind_ofdpa_ff_group_update(uint32_t group_id, ofdpaGroupBucketEntry_t *entries,
+                                      int count, int rewritten)
+{
+  ind_ofdpa_ff_group_t *group, *old;
+  uint32_t group_type, sub_type, port, state;
+  int i;
+
+  old = NULL;
+  if (ind_ofdpa_ff.groups != NULL)
+  {
+    old = ind_ofdpa_ff_group_hashtable_first(ind_ofdpa_ff.groups, &group_id);
+  }
+
+  if (IND_OFDPA_RPC(ofdpaGroupTypeGet, group_id, &group_type) != OFDPA_E_NONE ||
+      group_type != OFDPA_GROUP_ENTRY_TYPE_MPLS_FORWARDING ||
+      IND_OFDPA_RPC(ofdpaGroupMplsSubTypeGet, group_id, &sub_type) != OFDPA_E_NONE ||
+      sub_type != OFDPA_MPLS_FAST_FAILOVER ||
+      count > IND_OFDPA_FF_MAX_BUCKETS)
+  {
+    if (old != NULL)
+    {
+      ind_ofdpa_ff_group_free(old);
+    }
+    return;
   }
 
-  err = ind_ofdpa_translate_group_buckets(id, buckets, OF_GROUP_ADD);
+  if (ind_ofdpa_ff.groups == NULL)
+  {
+    ind_ofdpa_ff.groups = bighash_table_create(IND_OFDPA_FF_BUCKETS);
+    ind_ofdpa_ff.watches = bighash_table_create(IND_OFDPA_FF_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_ff.groups != NULL && ind_ofdpa_ff.watches != NULL);
+  }
 
-  return err;
+  group = aim_zmalloc(sizeof(*group));
+  group->group_id = group_id;
+  group->count = count;
+  memcpy(group->entries, entries, count * sizeof(*entries));
+  for (i = 0; i < count; i++)
+  {
+    group->target[i] = i;
+    if (!rewritten && old != NULL && i < old->count &&
+        !memcmp(&old->entries[i], &entries[i], sizeof(entries[i])))
+    {
+      group->target[i] = old->target[i];
+    }
+
+    port = entries[i].bucketData.mplsFastFailOver.watchPort;
+    if (port == OF_PORT_DEST_WILDCARD)
+    {
+      continue;
+    }
+    group->watches[i].port = port;
+    group->watches[i].group = group;
+    group->watches[i].bucket = i;
+    ind_ofdpa_ff_watch_hashtable_insert(ind_ofdpa_ff.watches, &group->watches[i]);
+
+    /* Learn the state of ports not seen in an event yet */
+    if (IND_OFDPA_RPC(ofdpaPortStateGet, port, &state) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_ff_down_set(port, (state & OFDPA_PORT_STATE_LINK_DOWN) != 0);
+    }
+  }
+
+  if (old != NULL)
+  {
+    ind_ofdpa_ff_group_free(old);
+  }
+  ind_ofdpa_ff_group_hashtable_insert(ind_ofdpa_ff.groups, group);
+
+  ind_ofdpa_ff_group_apply(group);
 }
 
-indigo_error_t indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *buckets)
+void ind_ofdpa_ff_port_state(uint32_t port, int up)
 {
-  indigo_error_t err;
+  ind_ofdpa_ff_watch_t *watch;
 
-  err = ind_ofdpa_translate_group_buckets(id, buckets, OF_GROUP_MODIFY);
+  if ((ind_ofdpa_ff_down_index(port) < 0) == (up != 0))
+  {
+    return;
+  }
+  ind_ofdpa_ff_down_set(port, !up);
 
-  return err;
+  if (!ind_ofdpa_ff.enabled || ind_ofdpa_ff.watches == NULL)
+  {
+    return;
+  }
+
+  for (watch = ind_ofdpa_ff_watch_hashtable_first(ind_ofdpa_ff.watches, &port);
+       watch != NULL;
+       watch = ind_ofdpa_ff_watch_hashtable_next(watch))
+  {
+    ind_ofdpa_ff_group_apply(watch->group);
+  }
 }
 
-#ifdef OFDPA_FIXUP
-indigo_error_t indigo_fwd_group_delete(uint32_t id)
-#else
-void indigo_fwd_group_delete(uint32_t id)
-#endif
+static void ind_ofdpa_ff_apply_all(void)
 {
-  OFDPA_ERROR_t ofdpa_rv;
+  bighash_iter_t iter;
+  bighash_entry_t *entry;
+
+  if (ind_ofdpa_ff.groups == NULL)
+  {
+    return;
+  }
+  for (entry = bighash_iter_start(ind_ofdpa_ff.groups, &iter);
+       entry != NULL;
+       entry = bighash_iter_next(&iter))
+  {
+    ind_ofdpa_ff_group_apply(container_of(entry, hash_entry, ind_ofdpa_ff_group_t));
+  }
+}
 
-  ofdpa_rv = ofdpaGroupDelete(id);
+indigo_error_t ind_ofdpa_ff_assist_start(void)
+{
+  ind_ofdpa_ff.enabled = 1;
+  ind_ofdpa_ff_apply_all();
+  LOG_INFO("Fast failover assist enabled");
+  return INDIGO_ERROR_NONE;
+}
 
-  if (ofdpa_rv != OFDPA_E_NONE)
+void ind_ofdpa_ff_assist_stop(void)
+{
+  if (!ind_ofdpa_ff.enabled)
   {
-    LOG_ERROR("Group Delete failed, rv = %d",ofdpa_rv);
+    return;
   }
+  ind_ofdpa_ff.enabled = 0;
+  ind_ofdpa_ff_apply_all();
+}
 
-#ifdef OFDPA_FIXUP
-  return indigoConvertOfdpaRv(ofdpa_rv);
-#else
-  return;
-#endif
+void ind_ofdpa_ff_assist_show(aim_pvs_t *pvs)
+{
+  bighash_iter_t iter;
+  bighash_entry_t *entry;
+  ind_ofdpa_ff_group_t *group;
+  int i, switched = 0;
+
+  if (ind_ofdpa_ff.groups != NULL)
+  {
+    for (entry = bighash_iter_start(ind_ofdpa_ff.groups, &iter);
+         entry != NULL;
+         entry = bighash_iter_next(&iter))
+    {
+      group = container_of(entry, hash_entry, ind_ofdpa_ff_group_t);
+      for (i = 0; i < group->count; i++)
+      {
+        if (group->target[i] != i)
+        {
+          aim_printf(pvs, "  group 0x%x bucket %d (watch port %u) forwards like bucket %d\n",
+                     group->group_id, i,
+                     group->entries[i].bucketData.mplsFastFailOver.watchPort,
+                     group->target[i]);
+          switched++;
+        }
+      }
+    }
+  }
+
+  aim_printf(pvs, "Fast failover assist %s, %d groups, %d buckets switched, %d ports down\n",
+             ind_ofdpa_ff.enabled ? "on" : "off",
+             ind_ofdpa_ff.groups ? bighash_entry_count(ind_ofdpa_ff.groups) : 0,
+             switched, ind_ofdpa_ff.down_count);
+  aim_printf(pvs, "  switches %" PRIu64 ", restores %" PRIu64 ", failures %" PRIu64 "\n",
+             ind_ofdpa_ff.switches, ind_ofdpa_ff.restores, ind_ofdpa_ff.failures);
 }
 
-void indigo_fwd_group_stats_get(uint32_t id, of_group_stats_entry_t *entry)
+/*
+ * Resilient ECMP
+ *
+ * With a table size set, an L3 ECMP group is programmed as that many
+ * buckets, each referencing one member, with members given a share of
+ * the table in proportion to the buckets the controller listed for them.
+ * The table of each group is kept, and a membership change only moves
+ * the slots of members that left or that hold more than their new share,
+ * to members under theirs, so flows hashed to the other slots keep their
+ * next hop. The bucket diff then programs only the slots that moved.
+ */
+#define IND_OFDPA_RESILIENT_MAX_SIZE 1024
+#define IND_OFDPA_RESILIENT_BUCKETS  1024
+
+typedef struct ind_ofdpa_resilient_group_s
 {
-  OFDPA_ERROR_t ofdpa_rv;
-  ofdpaGroupEntryStats_t groupStats;
+  bighash_entry_t          hash_entry;
+  uint32_t                 group_id;
+  int                      count;
+  ofdpaGroupBucketEntry_t *entries;   /* As programmed */
+} ind_ofdpa_resilient_group_t;
+
+#define TEMPLATE_NAME ind_ofdpa_resilient_group_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_resilient_group_t
+#define TEMPLATE_KEY_FIELD group_id
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static struct
+{
+  int              size;       /* 0 when off */
+  bighash_table_t *groups;
+  uint64_t         updates;
+  uint64_t         kept;       /* Slots left on their member */
+  uint64_t         moved;      /* Slots given to another member */
+} ind_ofdpa_resilient;
+
+static ind_ofdpa_resilient_group_t *ind_ofdpa_resilient_group_find(uint32_t group_id)
+{
+  if (ind_ofdpa_resilient.groups == NULL)
+  {
+    return NULL;
+  }
+  return ind_ofdpa_resilient_group_hashtable_first(ind_ofdpa_resilient.groups, &group_id);
+}
 
-  memset(&groupStats, 0, sizeof(groupStats));
-  ofdpa_rv = ofdpaGroupStatsGet(id, &groupStats);
+static void ind_ofdpa_resilient_group_remove(uint32_t group_id)
+{
+  ind_ofdpa_resilient_group_t *group = ind_ofdpa_resilient_group_find(group_id);
 
-  if (ofdpa_rv != OFDPA_E_NONE)
+  if (group != NULL)
   {
-    LOG_ERROR("Failed to get Group stats, rv = %d",ofdpa_rv);
+    bighash_remove(ind_ofdpa_resilient.groups, &group->hash_entry);
+    aim_free(group->entries);
+    aim_free(group);
   }
-  else
+}
+
+/* Remember the table programmed for a group, taking ownership of entries */
+static void ind_ofdpa_resilient_group_set(uint32_t group_id, ofdpaGroupBucketEntry_t *entries,
+                                          int count)
+{
+  ind_ofdpa_resilient_group_t *group = ind_ofdpa_resilient_group_find(group_id);
+
+  if (group == NULL)
   {
-    of_group_stats_entry_ref_count_set(entry, groupStats.refCount);
-    of_group_stats_entry_duration_sec_set(entry, groupStats.duration);
+    if (ind_ofdpa_resilient.groups == NULL)
+    {
+      ind_ofdpa_resilient.groups = bighash_table_create(IND_OFDPA_RESILIENT_BUCKETS);
+      AIM_TRUE_OR_DIE(ind_ofdpa_resilient.groups != NULL);
+    }
+    group = aim_zmalloc(sizeof(*group));
+    group->group_id = group_id;
+    ind_ofdpa_resilient_group_hashtable_insert(ind_ofdpa_resilient.groups, group);
   }
+  aim_free(group->entries);
+  group->entries = entries;
+  group->count = count;
+}
 
-  return;
+static int ind_ofdpa_resilient_member_index(uint32_t *refs, int count, uint32_t ref)
+{
+  int i;
+
+  for (i = 0; i < count; i++)
+  {
+    if (refs[i] == ref)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/*
+ * Spread the members over a table of size slots, keeping the slots of the
+ * previous table where the member is still wanted. Returns the new table.
+ */
+static ofdpaGroupBucketEntry_t *
+ind_ofdpa_resilient_table_build(uint32_t group_id, ofdpaGroupBucketEntry_t *members,
+                                int member_count, ind_ofdpa_resilient_group_t *prev, int size)
+{
+  ofdpaGroupBucketEntry_t *table;
+  uint32_t *refs;
+  int *weight, *quota, *have, *first;
+  int nrefs = 0, total = 0, left, i, m, cursor = 0;
+
+  refs = aim_zmalloc(member_count * sizeof(*refs));
+  weight = aim_zmalloc(member_count * sizeof(*weight));
+  quota = aim_zmalloc(member_count * sizeof(*quota));
+  have = aim_zmalloc(member_count * sizeof(*have));
+  first = aim_zmalloc(member_count * sizeof(*first));
+  table = aim_zmalloc(size * sizeof(*table));
+
+  /* Buckets listed more than once for a member weigh it */
+  for (i = 0; i < member_count; i++)
+  {
+    m = ind_ofdpa_resilient_member_index(refs, nrefs, members[i].referenceGroupId);
+    if (m < 0)
+    {
+      m = nrefs++;
+      refs[m] = members[i].referenceGroupId;
+      first[m] = i;
+    }
+    weight[m]++;
+    total++;
+  }
+
+  if (prev != NULL && prev->count != size)
+  {
+    prev = NULL;
+  }
+  if (prev != NULL)
+  {
+    for (i = 0; i < size; i++)
+    {
+      m = ind_ofdpa_resilient_member_index(refs, nrefs, prev->entries[i].referenceGroupId);
+      if (m >= 0)
+      {
+        have[m]++;
+      }
+    }
+  }
+
+  /* Shares; the rounding remainder goes first to members already over */
+  left = size;
+  for (m = 0; m < nrefs; m++)
+  {
+    quota[m] = size * weight[m] / total;
+    left -= quota[m];
+  }
+  for (m = 0; m < nrefs && left > 0; m++)
+  {
+    if (have[m] > quota[m])
+    {
+      quota[m]++;
+      left--;
+    }
+  }
+  for (m = 0; left > 0; m = (m + 1) % nrefs)
+  {
+    if (have[m] <= quota[m])
+    {
+      quota[m]++;
+      left--;
+    }
+  }
+
+  /* Keep slots up to each member's share, then fill the rest in turn */
+  memset(have, 0, nrefs * sizeof(*have));
+  for (i = 0; i < size; i++)
+  {
+    m = -1;
+    if (prev != NULL)
+    {
+      m = ind_ofdpa_resilient_member_index(refs, nrefs, prev->entries[i].referenceGroupId);
+    }
+    if (m >= 0 && have[m] < quota[m])
+    {
+      have[m]++;
+      table[i] = members[first[m]];
+      table[i].bucketIndex = i;
+      ind_ofdpa_resilient.kept++;
+    }
+    else
+    {
+      table[i].groupId = 0;   /* Free */
+    }
+  }
+  for (i = 0; i < size; i++)
+  {
+    if (table[i].groupId != 0)
+    {
+      continue;
+    }
+    while (have[cursor] >= quota[cursor])
+    {
+      cursor = (cursor + 1) % nrefs;
+    }
+    have[cursor]++;
+    table[i] = members[first[cursor]];
+    table[i].bucketIndex = i;
+    cursor = (cursor + 1) % nrefs;
+    ind_ofdpa_resilient.moved++;
+  }
+
+  ind_ofdpa_resilient.updates++;
+
+  aim_free(refs);
+  aim_free(weight);
+  aim_free(quota);
+  aim_free(have);
+  aim_free(first);
+  return table;
+}
+
+indigo_error_t ind_ofdpa_resilient_ecmp_set(int size)
+{
+  if (size < 0 || size > IND_OFDPA_RESILIENT_MAX_SIZE)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  /* Groups change over at their next modify */
+  ind_ofdpa_resilient.size = size;
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_resilient_ecmp_show(aim_pvs_t *pvs)
+{
+  if (ind_ofdpa_resilient.size == 0)
+  {
+    aim_printf(pvs, "Resilient ECMP off\n");
+  }
+  else
+  {
+    aim_printf(pvs, "Resilient ECMP table size %d\n", ind_ofdpa_resilient.size);
+  }
+  aim_printf(pvs, "  %d groups, updates %" PRIu64 ", slots kept %" PRIu64 ", moved %" PRIu64 "\n",
+             ind_ofdpa_resilient.groups ? bighash_entry_count(ind_ofdpa_resilient.groups) : 0,
+             ind_ofdpa_resilient.updates, ind_ofdpa_resilient.kept, ind_ofdpa_resilient.moved);
+}
+
+static indigo_error_t
+ind_ofdpa_translate_group_buckets(uint32_t group_id,
+                                  of_list_bucket_t *old_buckets,
+                                  of_list_bucket_t *of_buckets,
+                                  uint16_t command)
+{
+  indigo_error_t err;
+  ofdpaGroupEntry_t group_entry;
+  ofdpaGroupBucketEntry_t *entries;
+  ofdpaGroupBucketEntry_t *old_entries = NULL;
+  int count, old_count = 0;
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  ind_ofdpa_resilient_group_t *resilient;
+  uint32_t group_type;
+  int rewritten = 1;
+  int is_resilient = 0;
+  int i;
+
+  err = ind_ofdpa_group_bucket_entries_build(group_id, of_buckets, &entries, &count);
+  if (err < 0)
+  {
+    return err;
+  }
+
+  resilient = ind_ofdpa_resilient_group_find(group_id);
+  if (ind_ofdpa_resilient.size != 0 && count <= ind_ofdpa_resilient.size &&
+      IND_OFDPA_RPC(ofdpaGroupTypeGet, group_id, &group_type) == OFDPA_E_NONE &&
+      group_type == OFDPA_GROUP_ENTRY_TYPE_L3_ECMP)
+  {
+    ofdpaGroupBucketEntry_t *table;
+
+    table = ind_ofdpa_resilient_table_build(group_id, entries, count,
+                                            (command == OF_GROUP_ADD) ? NULL : resilient,
+                                            ind_ofdpa_resilient.size);
+    aim_free(entries);
+    entries = table;
+    count = ind_ofdpa_resilient.size;
+    is_resilient = 1;
+  }
+
+  if (command == OF_GROUP_ADD)
+  {
+    group_entry.groupId = group_id;
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupAdd, &group_entry);
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_ERROR("Error in adding Group, rv = %d",ofdpa_rv);
+      aim_free(entries);
+      return indigoConvertOfdpaRv(ofdpa_rv);
+    }
+
+    for (i = 0; i < count; i++)
+    {
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryAdd, &entries[i]);
+      if (ofdpa_rv != OFDPA_E_NONE)
+      {
+        LOG_ERROR("Error in adding Group bucket, rv = %d",ofdpa_rv);
+        /* Delete the added group */
+        (void)IND_OFDPA_RPC(ofdpaGroupDelete, group_id);
+        break;
+      }
+    }
+  }
+  else /* OF_GROUP_MODIFY */
+  {
+    if (resilient != NULL)
+    {
+      /* What OF-DPA holds is the table, not the controller's buckets */
+      old_count = resilient->count;
+      old_entries = aim_memdup(resilient->entries, old_count * sizeof(*old_entries));
+    }
+    else if (old_buckets != NULL &&
+             ind_ofdpa_group_bucket_entries_build(group_id, old_buckets,
+                                                  &old_entries, &old_count) < 0)
+    {
+      old_entries = NULL;
+    }
+
+    if (old_entries != NULL)
+    {
+      ofdpa_rv = ind_ofdpa_group_buckets_diff_apply(group_id, old_entries, old_count,
+                                                    entries, count);
+      aim_free(old_entries);
+      rewritten = 0;
+    }
+    else
+    {
+      /* No usable previous state; replace every bucket */
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketsDeleteAll, group_id);
+      if (ofdpa_rv != OFDPA_E_NONE)
+      {
+        LOG_ERROR("Error in deleting Group buckets, rv = %d",ofdpa_rv);
+      }
+      for (i = 0; i < count && ofdpa_rv == OFDPA_E_NONE; i++)
+      {
+        ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryAdd, &entries[i]);
+        if (ofdpa_rv != OFDPA_E_NONE)
+        {
+          LOG_ERROR("Error in adding Group bucket, rv = %d",ofdpa_rv);
+        }
+      }
+    }
+
+    /* On failure the caller deletes the group, from Indigo as well */
+  }
+
+  if (ofdpa_rv == OFDPA_E_NONE)
+  {
+    ind_ofdpa_ff_group_update(group_id, entries, count, rewritten);
+  }
+
+  if (ofdpa_rv == OFDPA_E_NONE && is_resilient)
+  {
+    ind_ofdpa_resilient_group_set(group_id, entries, count);
+    entries = NULL;
+  }
+  else
+  {
+    ind_ofdpa_resilient_group_remove(group_id);
+  }
+
+  aim_free(entries);
+
+  return indigoConvertOfdpaRv(ofdpa_rv);
+}
+
+indigo_error_t indigo_fwd_group_add(uint32_t id, uint8_t group_type, of_list_bucket_t *buckets)
+{
+  indigo_error_t err;
+
+  if ((group_type != OF_GROUP_TYPE_INDIRECT) &&
+      (group_type != OF_GROUP_TYPE_SELECT) &&
+      (group_type != OF_GROUP_TYPE_FF) &&
+      (group_type != OF_GROUP_TYPE_ALL))
+  {
+    return INDIGO_ERROR_NOT_SUPPORTED;
+  }
+
+  err = ind_ofdpa_translate_group_buckets(id, NULL, buckets, OF_GROUP_ADD);
+
+  return err;
+}
+
+#ifdef OFDPA_FIXUP
+indigo_error_t indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *old_buckets,
+                                       of_list_bucket_t *buckets)
+#else
+indigo_error_t indigo_fwd_group_modify(uint32_t id, of_list_bucket_t *buckets)
+#endif
+{
+  indigo_error_t err;
+#ifndef OFDPA_FIXUP
+  of_list_bucket_t *old_buckets = NULL;
+#endif
+
+  err = ind_ofdpa_translate_group_buckets(id, old_buckets, buckets, OF_GROUP_MODIFY);
+
+  return err;
+}
+
+/*
+ * Optional background refresh of group stats
+ *
+ * OF-DPA has no bulk group stats call, so an OFPG_ALL stats request
+ * costs one ofdpaGroupStatsGet RPC per group. With the sweep on, the
+ * groups are walked with ofdpaGroupNextGet once per interval, a batch
+ * per task run, and stats requests are answered from the result. Groups
+ * the last sweep did not see, such as ones added since, are read live.
+ */
+#define IND_OFDPA_GROUP_STATS_BUCKETS     4096
+#define IND_OFDPA_GROUP_STATS_SWEEP_BATCH 64
+
+typedef struct ind_ofdpa_group_stats_s
+{
+  bighash_entry_t        hash_entry;
+  uint32_t               group_id;
+  uint64_t               sweep;   /* Last sweep that read it */
+  ofdpaGroupEntryStats_t stats;
+} ind_ofdpa_group_stats_t;
+
+#define TEMPLATE_NAME ind_ofdpa_group_stats_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_group_stats_t
+#define TEMPLATE_KEY_FIELD group_id
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static struct
+{
+  int              interval_ms;  /* 0 when the sweep is off */
+  bool             sweeping;
+  bool             started;      /* Group 0 read; walking with NextGet */
+  uint32_t         sweep_id;     /* Last group read */
+  bighash_table_t *groups;
+  indigo_time_t    sweep_time;   /* When the last complete sweep started */
+  indigo_time_t    start_time;   /* When the running sweep started */
+  uint64_t         sweeps;
+  uint64_t         overruns;
+  uint64_t         hits;
+  uint64_t         misses;
+} ind_ofdpa_group_stats;
+
+static ind_ofdpa_group_stats_t *ind_ofdpa_group_stats_find(uint32_t group_id)
+{
+  if (ind_ofdpa_group_stats.groups == NULL)
+  {
+    return NULL;
+  }
+  return ind_ofdpa_group_stats_hashtable_first(ind_ofdpa_group_stats.groups, &group_id);
+}
+
+static void ind_ofdpa_group_stats_remove(uint32_t group_id)
+{
+  ind_ofdpa_group_stats_t *group = ind_ofdpa_group_stats_find(group_id);
+
+  if (group != NULL)
+  {
+    bighash_remove(ind_ofdpa_group_stats.groups, &group->hash_entry);
+    aim_free(group);
+  }
+}
+
+static void ind_ofdpa_group_stats_read(uint32_t group_id)
+{
+  ind_ofdpa_group_stats_t *group;
+  ofdpaGroupEntryStats_t groupStats;
+
+  memset(&groupStats, 0, sizeof(groupStats));
+  if (IND_OFDPA_RPC(ofdpaGroupStatsGet, group_id, &groupStats) != OFDPA_E_NONE)
+  {
+    return;
+  }
+
+  group = ind_ofdpa_group_stats_find(group_id);
+  if (group == NULL)
+  {
+    group = aim_zmalloc(sizeof(*group));
+    group->group_id = group_id;
+    ind_ofdpa_group_stats_hashtable_insert(ind_ofdpa_group_stats.groups, group);
+  }
+  group->stats = groupStats;
+  group->sweep = ind_ofdpa_group_stats.sweeps;
+}
+
+/* Drop the groups that are gone from OF-DPA */
+static void ind_ofdpa_group_stats_sweep_finish(void)
+{
+  ind_ofdpa_group_stats_t *group;
+  bighash_iter_t iter;
+
+  for (group = bighash_iter_start(ind_ofdpa_group_stats.groups, &iter);
+       group != NULL;
+       group = bighash_iter_next(&iter))
+  {
+    if (group->sweep != ind_ofdpa_group_stats.sweeps)
+    {
+      bighash_remove(ind_ofdpa_group_stats.groups, &group->hash_entry);
+      aim_free(group);
+    }
+  }
+}
+
+static ind_soc_task_status_t ind_ofdpa_group_stats_sweep_task(void *cookie)
+{
+  ofdpaGroupEntry_t group;
+  int i;
+
+  if (ind_ofdpa_group_stats.interval_ms == 0)
+  {
+    ind_ofdpa_group_stats.sweeping = false;
+    return IND_SOC_TASK_FINISHED;
+  }
+
+  /* Group id 0 is valid, and the walk only returns ids after the one given */
+  if (!ind_ofdpa_group_stats.started)
+  {
+    ind_ofdpa_group_stats.started = true;
+    ind_ofdpa_group_stats_read(0);
+  }
+
+  for (i = 0; i < IND_OFDPA_GROUP_STATS_SWEEP_BATCH; i++)
+  {
+    if (IND_OFDPA_RPC(ofdpaGroupNextGet, ind_ofdpa_group_stats.sweep_id, &group) != OFDPA_E_NONE)
+    {
+      ind_ofdpa_group_stats_sweep_finish();
+      ind_ofdpa_group_stats.sweeping = false;
+      ind_ofdpa_group_stats.sweep_time = ind_ofdpa_group_stats.start_time;
+      return IND_SOC_TASK_FINISHED;
+    }
+    ind_ofdpa_group_stats.sweep_id = group.groupId;
+    ind_ofdpa_group_stats_read(group.groupId);
+  }
+
+  return IND_SOC_TASK_CONTINUE;
+}
+
+static void ind_ofdpa_group_stats_timer(void *cookie)
+{
+  if (ind_ofdpa_group_stats.sweeping)
+  {
+    ind_ofdpa_group_stats.overruns++;
+    return;
+  }
+
+  ind_ofdpa_group_stats.sweep_id = 0;
+  ind_ofdpa_group_stats.started = false;
+  ind_ofdpa_group_stats.start_time = INDIGO_CURRENT_TIME;
+
+  if (ind_soc_task_register(ind_ofdpa_group_stats_sweep_task, NULL,
+                            IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    LOG_ERROR("Failed to start group stats sweep");
+    return;
+  }
+  ind_ofdpa_group_stats.sweeping = true;
+  ind_ofdpa_group_stats.sweeps++;
+}
+
+static void ind_ofdpa_group_stats_free(bighash_entry_t *e)
+{
+  aim_free(container_of(e, hash_entry, ind_ofdpa_group_stats_t));
+}
+
+indigo_error_t ind_ofdpa_group_stats_start(int interval_ms)
+{
+  if (interval_ms <= 0)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_group_stats_stop();
+
+  if (ind_soc_timer_event_register(ind_ofdpa_group_stats_timer, NULL, interval_ms) < 0)
+  {
+    LOG_ERROR("Failed to register group stats timer");
+    return INDIGO_ERROR_UNKNOWN;
+  }
+  ind_ofdpa_group_stats.interval_ms = interval_ms;
+  ind_ofdpa_group_stats.sweep_time = 0;
+  ind_ofdpa_group_stats.groups = bighash_table_create(IND_OFDPA_GROUP_STATS_BUCKETS);
+  AIM_TRUE_OR_DIE(ind_ofdpa_group_stats.groups != NULL);
+
+  ind_ofdpa_group_stats_timer(NULL);
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_group_stats_stop(void)
+{
+  if (ind_ofdpa_group_stats.interval_ms == 0)
+  {
+    return;
+  }
+
+  ind_soc_timer_event_unregister(ind_ofdpa_group_stats_timer, NULL);
+  ind_ofdpa_group_stats.interval_ms = 0;
+
+  /* A running sweep task sees interval_ms 0 and finishes on its next run */
+  bighash_table_destroy(ind_ofdpa_group_stats.groups, ind_ofdpa_group_stats_free);
+  ind_ofdpa_group_stats.groups = NULL;
+}
+
+void ind_ofdpa_group_stats_show(aim_pvs_t *pvs)
+{
+  if (ind_ofdpa_group_stats.interval_ms == 0)
+  {
+    aim_printf(pvs, "Group stats sweep off\n");
+    return;
+  }
+
+  aim_printf(pvs, "Group stats sweep every %d ms%s, %d groups cached\n",
+             ind_ofdpa_group_stats.interval_ms,
+             ind_ofdpa_group_stats.sweeping ? ", sweeping" : "",
+             bighash_entry_count(ind_ofdpa_group_stats.groups));
+  if (ind_ofdpa_group_stats.sweep_time != 0)
+  {
+    aim_printf(pvs, "  last sweep %u ms ago\n",
+               INDIGO_TIME_DIFF_ms(ind_ofdpa_group_stats.sweep_time, INDIGO_CURRENT_TIME));
+  }
+  aim_printf(pvs, "  sweeps %"PRIu64" overruns %"PRIu64"\n",
+             ind_ofdpa_group_stats.sweeps, ind_ofdpa_group_stats.overruns);
+  aim_printf(pvs, "  requests from cache %"PRIu64", read live %"PRIu64"\n",
+             ind_ofdpa_group_stats.hits, ind_ofdpa_group_stats.misses);
+}
+
+#ifdef OFDPA_FIXUP
+indigo_error_t indigo_fwd_group_delete(uint32_t id)
+#else
+void indigo_fwd_group_delete(uint32_t id)
+#endif
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupDelete, id);
+
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Group Delete failed, rv = %d",ofdpa_rv);
+  }
+  else
+  {
+    ind_ofdpa_ff_group_remove(id);
+    ind_ofdpa_resilient_group_remove(id);
+    ind_ofdpa_group_stats_remove(id);
+  }
+
+#ifdef OFDPA_FIXUP
+  return indigoConvertOfdpaRv(ofdpa_rv);
+#else
+  return;
+#endif
+}
+
+void indigo_fwd_group_stats_get(uint32_t id, of_group_stats_entry_t *entry)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+  ofdpaGroupEntryStats_t groupStats;
+  ind_ofdpa_group_stats_t *group = ind_ofdpa_group_stats_find(id);
+
+  if (group != NULL)
+  {
+    ind_ofdpa_group_stats.hits++;
+    groupStats = group->stats;
+  }
+  else
+  {
+    if (ind_ofdpa_group_stats.interval_ms != 0)
+    {
+      ind_ofdpa_group_stats.misses++;
+    }
+
+    memset(&groupStats, 0, sizeof(groupStats));
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupStatsGet, id, &groupStats);
+
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_ERROR("Failed to get Group stats, rv = %d",ofdpa_rv);
+      return;
+    }
+  }
+
+  of_group_stats_entry_ref_count_set(entry, groupStats.refCount);
+  of_group_stats_entry_duration_sec_set(entry, groupStats.duration);
+
+  return;
+}
+
+indigo_error_t indigo_fwd_group_count_get(uint32_t *count)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupTableTotalEntryCountGet, count);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to get group count, rv = %d", ofdpa_rv);
+  }
+
+  return indigoConvertOfdpaRv(ofdpa_rv);
+}
+
+/*
+ * Warm start
+ *
+ * OF-DPA groups are rebuilt as group_adds and handed to the state manager.
+ * Buckets are decoded back into the actions the translation above accepts
+ * for the L2 and L3 group types; MPLS group buckets are not decoded and
+ * such groups are adopted with an empty bucket list, so that a later
+ * modify replaces every bucket.
+ */
+
+static uint8_t
+ind_ofdpa_group_of_type(uint32_t group_id, uint32_t group_type)
+{
+  uint32_t sub_type = 0;
+
+  switch (group_type)
+  {
+    case OFDPA_GROUP_ENTRY_TYPE_L2_MULTICAST:
+    case OFDPA_GROUP_ENTRY_TYPE_L2_FLOOD:
+    case OFDPA_GROUP_ENTRY_TYPE_L3_MULTICAST:
+    case OFDPA_GROUP_ENTRY_TYPE_L2_OVERLAY:
+      return OF_GROUP_TYPE_ALL;
+    case OFDPA_GROUP_ENTRY_TYPE_L3_ECMP:
+      return OF_GROUP_TYPE_SELECT;
+    case OFDPA_GROUP_ENTRY_TYPE_MPLS_FORWARDING:
+      IND_OFDPA_RPC(ofdpaGroupMplsSubTypeGet, group_id, &sub_type);
+      switch (sub_type)
+      {
+        case OFDPA_MPLS_FAST_FAILOVER:
+          return OF_GROUP_TYPE_FF;
+        case OFDPA_MPLS_ECMP:
+          return OF_GROUP_TYPE_SELECT;
+        case OFDPA_MPLS_1_1_HEAD_END_PROTECT:
+        case OFDPA_MPLS_L2_TAG:
+          return OF_GROUP_TYPE_INDIRECT;
+        default:
+          return OF_GROUP_TYPE_ALL;
+      }
+    default:
+      return OF_GROUP_TYPE_INDIRECT;
+  }
+}
+
+static indigo_error_t
+ind_ofdpa_group_action_append(of_list_action_t *actions, of_object_t *action)
+{
+  int rv;
+
+  if (action == NULL)
+  {
+    return INDIGO_ERROR_RESOURCE;
+  }
+  rv = of_list_append(actions, action);
+  of_object_delete(action);
+
+  return (rv < 0) ? INDIGO_ERROR_RESOURCE : INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t
+ind_ofdpa_group_set_field_append(of_list_action_t *actions, uint32_t type_len,
+                                 uint32_t experimenter, const uint8_t *value)
+{
+  of_action_set_field_t *set_field;
+  uint8_t oxm[16];
+  of_octets_t octets;
+  int rv;
+
+  octets.data = oxm;
+  octets.bytes = ind_ofdpa_oxm_write(oxm, sizeof(oxm), type_len, experimenter, value, NULL);
+  if (octets.bytes == 0)
+  {
+    return INDIGO_ERROR_UNKNOWN;
+  }
+
+  if ((set_field = of_action_set_field_new(OF_VERSION_1_3)) == NULL)
+  {
+    return INDIGO_ERROR_RESOURCE;
+  }
+  rv = of_action_set_field_field_set(set_field, &octets);
+  if (rv < 0)
+  {
+    of_object_delete(set_field);
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  return ind_ofdpa_group_action_append(actions, set_field);
+}
+
+static indigo_error_t
+ind_ofdpa_group_mac_set_field_append(of_list_action_t *actions, uint32_t type_len,
+                                     ofdpaMacAddr_t *mac)
+{
+  static const ofdpaMacAddr_t zero_mac;
+
+  if (memcmp(mac, &zero_mac, sizeof(zero_mac)) == 0)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+  return ind_ofdpa_group_set_field_append(actions, type_len, 0, mac->addr);
+}
+
+static indigo_error_t
+ind_ofdpa_group_vlan_set_field_append(of_list_action_t *actions, uint32_t vlan_id)
+{
+  uint8_t value[2];
+
+  if (vlan_id == 0)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+  value[0] = vlan_id >> 8;
+  value[1] = vlan_id;
+  return ind_ofdpa_group_set_field_append(actions, 0x80000c02, 0, value);
+}
+
+/* Rebuild the OpenFlow actions of one OF-DPA bucket */
+static indigo_error_t
+ind_ofdpa_group_bucket_actions_restore(uint32_t group_type,
+                                       ofdpaGroupBucketEntry_t *entry,
+                                       of_list_action_t *actions)
+{
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  uint32_t output_port = 0;
+  int has_output = 0;
+  uint8_t allow;
+  of_object_t *action;
+
+  switch (group_type)
+  {
+    case OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE:
+      if (entry->bucketData.l2Interface.popVlanTag)
+      {
+        err = ind_ofdpa_group_action_append(actions, of_action_pop_vlan_new(OF_VERSION_1_3));
+      }
+      if (err == INDIGO_ERROR_NONE && entry->bucketData.l2Interface.allowVlanTranslation)
+      {
+        allow = 1;
+        err = ind_ofdpa_group_set_field_append(actions, 0xffff3005,
+                                               IND_OFDPA_OXM_EXPERIMENTER_OFDPA, &allow);
+      }
+      output_port = entry->bucketData.l2Interface.outputPort;
+      has_output = 1;
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_UNFILTERED_INTERFACE:
+      if (entry->bucketData.l2UnfilteredInterface.allowVlanTranslation)
+      {
+        allow = 1;
+        err = ind_ofdpa_group_set_field_append(actions, 0xffff3005,
+                                               IND_OFDPA_OXM_EXPERIMENTER_OFDPA, &allow);
+      }
+      output_port = entry->bucketData.l2UnfilteredInterface.outputPort;
+      has_output = 1;
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_OVERLAY:
+      output_port = entry->bucketData.l2Overlay.outputPort;
+      has_output = 1;
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_REWRITE:
+      err = ind_ofdpa_group_mac_set_field_append(actions, 0x80000806, &entry->bucketData.l2Rewrite.srcMac);
+      if (err == INDIGO_ERROR_NONE)
+      {
+        err = ind_ofdpa_group_mac_set_field_append(actions, 0x80000606, &entry->bucketData.l2Rewrite.dstMac);
+      }
+      if (err == INDIGO_ERROR_NONE)
+      {
+        err = ind_ofdpa_group_vlan_set_field_append(actions, entry->bucketData.l2Rewrite.vlanId);
+      }
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L3_UNICAST:
+      err = ind_ofdpa_group_mac_set_field_append(actions, 0x80000806, &entry->bucketData.l3Unicast.srcMac);
+      if (err == INDIGO_ERROR_NONE)
+      {
+        err = ind_ofdpa_group_mac_set_field_append(actions, 0x80000606, &entry->bucketData.l3Unicast.dstMac);
+      }
+      if (err == INDIGO_ERROR_NONE)
+      {
+        err = ind_ofdpa_group_vlan_set_field_append(actions, entry->bucketData.l3Unicast.vlanId);
+      }
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L3_INTERFACE:
+      err = ind_ofdpa_group_mac_set_field_append(actions, 0x80000806, &entry->bucketData.l3Interface.srcMac);
+      if (err == INDIGO_ERROR_NONE)
+      {
+        err = ind_ofdpa_group_vlan_set_field_append(actions, entry->bucketData.l3Interface.vlanId);
+      }
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_MULTICAST:
+    case OFDPA_GROUP_ENTRY_TYPE_L2_FLOOD:
+    case OFDPA_GROUP_ENTRY_TYPE_L3_MULTICAST:
+    case OFDPA_GROUP_ENTRY_TYPE_L3_ECMP:
+      break;
+
+    default:
+      return INDIGO_ERROR_NOT_SUPPORTED;
+  }
+
+  if (err == INDIGO_ERROR_NONE && has_output)
+  {
+    action = of_action_output_new(OF_VERSION_1_3);
+    if (action != NULL)
+    {
+      of_action_output_port_set(action, output_port);
+    }
+    err = ind_ofdpa_group_action_append(actions, action);
+  }
+  else if (err == INDIGO_ERROR_NONE && entry->referenceGroupId != 0)
+  {
+    action = of_action_group_new(OF_VERSION_1_3);
+    if (action != NULL)
+    {
+      of_action_group_group_id_set(action, entry->referenceGroupId);
+    }
+    err = ind_ofdpa_group_action_append(actions, action);
+  }
+
+  return err;
+}
+
+static indigo_error_t
+ind_ofdpa_group_buckets_restore(uint32_t group_id, uint32_t group_type,
+                                uint8_t of_type, of_list_bucket_t *buckets)
+{
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  ofdpaGroupBucketEntry_t entry;
+  of_list_action_t *actions;
+  of_bucket_t *bucket;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryFirstGet, group_id, &entry);
+  while (ofdpa_rv == OFDPA_E_NONE && err == INDIGO_ERROR_NONE)
+  {
+    bucket = of_bucket_new(OF_VERSION_1_3);
+    actions = of_list_action_new(OF_VERSION_1_3);
+    if (bucket == NULL || actions == NULL)
+    {
+      err = INDIGO_ERROR_RESOURCE;
+    }
+    else
+    {
+      of_bucket_weight_set(bucket, (of_type == OF_GROUP_TYPE_SELECT) ? 1 : 0);
+      of_bucket_watch_port_set(bucket, OF_PORT_DEST_WILDCARD);
+      of_bucket_watch_group_set(bucket, OF_GROUP_ANY);
+      err = ind_ofdpa_group_bucket_actions_restore(group_type, &entry, actions);
+    }
+    if (err == INDIGO_ERROR_NONE &&
+        (of_bucket_actions_set(bucket, actions) < 0 || of_list_append(buckets, bucket) < 0))
+    {
+      err = INDIGO_ERROR_RESOURCE;
+    }
+    if (actions != NULL)
+    {
+      of_object_delete(actions);
+    }
+    if (bucket != NULL)
+    {
+      of_object_delete(bucket);
+    }
+
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryNextGet, group_id, entry.bucketIndex, &entry);
+  }
+
+  return err;
+}
+
+static indigo_error_t
+ind_ofdpa_group_restore(uint32_t group_id)
+{
+  indigo_error_t err;
+  of_group_add_t *group_add;
+  of_list_bucket_t *buckets;
+  uint32_t group_type;
+  uint8_t of_type;
+
+  IND_OFDPA_RPC(ofdpaGroupTypeGet, group_id, &group_type);
+  of_type = ind_ofdpa_group_of_type(group_id, group_type);
+
+  group_add = of_group_add_new(OF_VERSION_1_3);
+  buckets = of_list_bucket_new(OF_VERSION_1_3);
+  if (group_add == NULL || buckets == NULL)
+  {
+    err = INDIGO_ERROR_RESOURCE;
+    goto done;
+  }
+
+  err = ind_ofdpa_group_buckets_restore(group_id, group_type, of_type, buckets);
+  if (err == INDIGO_ERROR_NOT_SUPPORTED)
+  {
+    /* Adopt the group with no buckets rather than with some of them */
+    LOG_VERBOSE("Buckets of group 0x%x not decoded", group_id);
+    of_object_delete(buckets);
+    buckets = of_list_bucket_new(OF_VERSION_1_3);
+    err = (buckets != NULL) ? INDIGO_ERROR_NONE : INDIGO_ERROR_RESOURCE;
+  }
+  if (err < 0)
+  {
+    goto done;
+  }
+
+  of_group_add_group_type_set(group_add, of_type);
+  of_group_add_group_id_set(group_add, group_id);
+  if (of_group_add_buckets_set(group_add, buckets) < 0)
+  {
+    err = INDIGO_ERROR_RESOURCE;
+    goto done;
+  }
+
+  err = indigo_core_group_restore(group_add);
+
+done:
+  if (buckets != NULL)
+  {
+    of_object_delete(buckets);
+  }
+  if (group_add != NULL)
+  {
+    of_object_delete(group_add);
+  }
+  return err;
+}
+
+void
+ind_ofdpa_groups_restore(int *restored, int *skipped)
+{
+  ofdpaGroupEntry_t group;
+  ofdpaGroupEntryStats_t groupStats;
+  uint32_t group_id = 0;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  *restored = 0;
+  *skipped = 0;
+
+  /* Group id 0 is valid, and the walk only returns ids after the one given */
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupStatsGet, group_id, &groupStats);
+  while (1)
+  {
+    if (ofdpa_rv == OFDPA_E_NONE)
+    {
+      if (ind_ofdpa_group_restore(group_id) == INDIGO_ERROR_NONE)
+      {
+        (*restored)++;
+      }
+      else
+      {
+        LOG_ERROR("Failed to restore group 0x%x", group_id);
+        (*skipped)++;
+      }
+    }
+
+    /* Only called from the warm start coroutine */
+    ind_soc_coroutine_maybe_yield();
+
+    if (IND_OFDPA_RPC(ofdpaGroupNextGet, group_id, &group) != OFDPA_E_NONE)
+    {
+      break;
+    }
+    group_id = group.groupId;
+    ofdpa_rv = OFDPA_E_NONE;
+  }
 }
@@ -0,0 +1,453 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_host.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "indigo/of_state_manager.h"
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim.h>
+#include <string.h>
+#include <stdbool.h>
+
+/*
+ * Host entry gentables
+ *
+ * MAC and host route entries are most of the flows a controller programs,
+ * and each costs a full match and instruction list as a flow_mod, plus a
+ * place in the state manager's flow table. These gentables program the
+ * same Bridging and Unicast Routing flows from a few TLVs, keep only what
+ * is needed to rebuild the flow, and resync with the gentable checksums.
+ *
+ * ofdpa_bridging
+ *
+ * Key:
+ *  - vlan_vid
+ *  - mac (unicast)
+ *
+ * Value:
+ *  - port: output through the L2 interface group for the VLAN and port
+ *
+ * ofdpa_unicast_routing_host
+ *
+ * Key:
+ *  - ipv4 (unicast), in any VRF
+ *
+ * Value:
+ *  - port: the L3 unicast or L3 ECMP group ID
+ *
+ * Stats:
+ *  - rx_packets, for the tables with flow counters
+ *
+ * The flows go to the Policy ACL table next, as the controller's do.
+ */
+#define IND_OFDPA_HOST_MAX          (128 * 1024)
+#define IND_OFDPA_HOST_BUCKETS      (16 * 1024)
+#define IND_OFDPA_HOST_PRIORITY     0
+
+typedef struct ind_ofdpa_bridging_entry_s
+{
+  uint16_t vlan_vid;
+  uint8_t  mac[OFDPA_MAC_ADDR_LEN];
+  uint32_t port;
+} ind_ofdpa_bridging_entry_t;
+
+typedef struct ind_ofdpa_routing_host_entry_s
+{
+  of_ipv4_t ipv4;
+  uint32_t  group_id;
+} ind_ofdpa_routing_host_entry_t;
+
+static indigo_core_gentable_t *ind_ofdpa_bridging_gentable = NULL;
+static indigo_core_gentable_t *ind_ofdpa_routing_host_gentable = NULL;
+
+static indigo_error_t ind_ofdpa_host_port_parse(of_list_bsn_tlv_t *tlvs, uint32_t *port)
+{
+  of_bsn_tlv_t tlv;
+  int loop_rv = 0;
+  int count_port = 0;
+
+  OF_LIST_BSN_TLV_ITER(tlvs, &tlv, loop_rv)
+  {
+    if (tlv.header.object_id == OF_BSN_TLV_PORT)
+    {
+      count_port++;
+      of_bsn_tlv_port_value_get(&tlv.port, port);
+    }
+    else
+    {
+      return INDIGO_ERROR_NOT_SUPPORTED;
+    }
+  }
+
+  return count_port == 1 ? INDIGO_ERROR_NONE : INDIGO_ERROR_PARAM;
+}
+
+static void ind_ofdpa_host_stats_append(ofdpaFlowEntry_t *flow, of_list_bsn_tlv_t *stats)
+{
+  ofdpaFlowEntryStats_t flowStats;
+  of_object_t *tlv;
+
+  memset(&flowStats, 0, sizeof(flowStats));
+  if (IND_OFDPA_RPC(ofdpaFlowStatsGet, flow, &flowStats) != OFDPA_E_NONE)
+  {
+    return;
+  }
+
+  tlv = of_bsn_tlv_rx_packets_new(stats->version);
+  of_bsn_tlv_rx_packets_value_set(tlv, flowStats.receivedPackets);
+  of_list_append(stats, tlv);
+  of_object_delete(tlv);
+}
+
+/* ofdpa_bridging */
+
+static indigo_error_t ind_ofdpa_bridging_key_parse(of_list_bsn_tlv_t *tlvs,
+                                                   ind_ofdpa_bridging_entry_t *entry)
+{
+  of_bsn_tlv_t tlv;
+  of_mac_addr_t mac;
+  int loop_rv = 0;
+  int count_vlan_vid = 0;
+  int count_mac = 0;
+
+  OF_LIST_BSN_TLV_ITER(tlvs, &tlv, loop_rv)
+  {
+    if (tlv.header.object_id == OF_BSN_TLV_VLAN_VID)
+    {
+      count_vlan_vid++;
+      of_bsn_tlv_vlan_vid_value_get(&tlv.port, &entry->vlan_vid);
+    }
+    else if (tlv.header.object_id == OF_BSN_TLV_MAC)
+    {
+      count_mac++;
+      of_bsn_tlv_mac_value_get(&tlv.port, &mac);
+      memcpy(entry->mac, mac.addr, OFDPA_MAC_ADDR_LEN);
+    }
+    else
+    {
+      return INDIGO_ERROR_NOT_SUPPORTED;
+    }
+  }
+
+  if (count_vlan_vid != 1 || count_mac != 1 ||
+      entry->vlan_vid == 0 || entry->vlan_vid >= 4095 || (entry->mac[0] & 1))
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_bridging_flow_build(const ind_ofdpa_bridging_entry_t *entry,
+                                          ofdpaFlowEntry_t *flow)
+{
+  ofdpaBridgingFlowEntry_t *bridging = &flow->flowData.bridgingFlowEntry;
+  uint32_t groupId = 0;
+
+  memset(flow, 0, sizeof(*flow));
+  flow->tableId = OFDPA_FLOW_TABLE_ID_BRIDGING;
+  flow->priority = IND_OFDPA_HOST_PRIORITY;
+
+  bridging->match_criteria.vlanId = OFDPA_VID_PRESENT | entry->vlan_vid;
+  bridging->match_criteria.vlanIdMask = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+  memcpy(bridging->match_criteria.destMac.addr, entry->mac, OFDPA_MAC_ADDR_LEN);
+  memset(bridging->match_criteria.destMacMask.addr, 0xff, OFDPA_MAC_ADDR_LEN);
+
+  ofdpaGroupTypeSet(&groupId, OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE);
+  ofdpaGroupVlanSet(&groupId, entry->vlan_vid);
+  ofdpaGroupPortIdSet(&groupId, entry->port);
+  bridging->groupID = groupId;
+  bridging->gotoTableId = OFDPA_FLOW_TABLE_ID_ACL_POLICY;
+}
+
+static indigo_error_t ind_ofdpa_bridging_add(void *table_priv, of_list_bsn_tlv_t *key,
+                                             of_list_bsn_tlv_t *value, void **entry_priv)
+{
+  ind_ofdpa_bridging_entry_t entry;
+  ofdpaFlowEntry_t flow;
+  OFDPA_ERROR_t ofdpa_rv;
+  indigo_error_t rv;
+
+  memset(&entry, 0, sizeof(entry));
+  if ((rv = ind_ofdpa_bridging_key_parse(key, &entry)) < 0 ||
+      (rv = ind_ofdpa_host_port_parse(value, &entry.port)) < 0)
+  {
+    return rv;
+  }
+
+  ind_ofdpa_bridging_flow_build(&entry, &flow);
+  ofdpa_rv = ind_ofdpa_flow_direct_add(&flow);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR_RL("Failed to add bridging entry for VLAN %u. (ofdpa_rv = %d)",
+                 entry.vlan_vid, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+
+  *entry_priv = aim_memdup(&entry, sizeof(entry));
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_bridging_modify(void *table_priv, void *entry_priv,
+                                                of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *value)
+{
+  ind_ofdpa_bridging_entry_t *entry = entry_priv;
+  ofdpaFlowEntry_t flow;
+  OFDPA_ERROR_t ofdpa_rv;
+  uint32_t port;
+  indigo_error_t rv;
+
+  if ((rv = ind_ofdpa_host_port_parse(value, &port)) < 0)
+  {
+    return rv;
+  }
+
+  if (port == entry->port)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  entry->port = port;
+  ind_ofdpa_bridging_flow_build(entry, &flow);
+  ofdpa_rv = ind_ofdpa_flow_learned_modify(&flow);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR_RL("Failed to modify bridging entry for VLAN %u. (ofdpa_rv = %d)",
+                 entry->vlan_vid, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_bridging_delete(void *table_priv, void *entry_priv,
+                                                of_list_bsn_tlv_t *key)
+{
+  ind_ofdpa_bridging_entry_t *entry = entry_priv;
+  ofdpaFlowEntry_t flow;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ind_ofdpa_bridging_flow_build(entry, &flow);
+  ofdpa_rv = ind_ofdpa_flow_learned_delete(&flow);
+  if (ofdpa_rv != OFDPA_E_NONE && ofdpa_rv != OFDPA_E_NOT_FOUND)
+  {
+    LOG_ERROR_RL("Failed to delete bridging entry for VLAN %u. (ofdpa_rv = %d)",
+                 entry->vlan_vid, ofdpa_rv);
+  }
+
+  aim_free(entry);
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_bridging_get_stats(void *table_priv, void *entry_priv,
+                                         of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *stats)
+{
+  ofdpaFlowEntry_t flow;
+
+  ind_ofdpa_bridging_flow_build(entry_priv, &flow);
+  ind_ofdpa_host_stats_append(&flow, stats);
+}
+
+static const indigo_core_gentable_ops_t ind_ofdpa_bridging_ops =
+{
+  .add = ind_ofdpa_bridging_add,
+  .modify = ind_ofdpa_bridging_modify,
+  .del = ind_ofdpa_bridging_delete,
+  .get_stats = ind_ofdpa_bridging_get_stats,
+};
+
+/* ofdpa_unicast_routing_host */
+
+static indigo_error_t ind_ofdpa_routing_host_key_parse(of_list_bsn_tlv_t *tlvs, of_ipv4_t *ipv4)
+{
+  of_bsn_tlv_t tlv;
+  int loop_rv = 0;
+  int count_ipv4 = 0;
+
+  OF_LIST_BSN_TLV_ITER(tlvs, &tlv, loop_rv)
+  {
+    if (tlv.header.object_id == OF_BSN_TLV_IPV4)
+    {
+      count_ipv4++;
+      of_bsn_tlv_ipv4_value_get(&tlv.port, ipv4);
+    }
+    else
+    {
+      return INDIGO_ERROR_NOT_SUPPORTED;
+    }
+  }
+
+  /* Not 0/8, multicast, reserved or broadcast */
+  if (count_ipv4 != 1 || (*ipv4 >> 24) == 0 || (*ipv4 >> 28) >= 0xe)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_routing_host_group_check(uint32_t group_id)
+{
+  uint32_t group_type;
+
+  if (IND_OFDPA_RPC(ofdpaGroupTypeGet, group_id, &group_type) != OFDPA_E_NONE ||
+      (group_type != OFDPA_GROUP_ENTRY_TYPE_L3_UNICAST &&
+       group_type != OFDPA_GROUP_ENTRY_TYPE_L3_ECMP))
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_routing_host_flow_build(const ind_ofdpa_routing_host_entry_t *entry,
+                                              ofdpaFlowEntry_t *flow)
+{
+  ofdpaUnicastRoutingFlowEntry_t *routing = &flow->flowData.unicastRoutingFlowEntry;
+
+  memset(flow, 0, sizeof(*flow));
+  flow->tableId = OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING;
+  flow->priority = IND_OFDPA_HOST_PRIORITY;
+
+  routing->match_criteria.etherType = 0x0800;
+  routing->match_criteria.dstIp4 = entry->ipv4;
+  routing->match_criteria.dstIp4Mask = 0xffffffff;
+
+  routing->groupID = entry->group_id;
+  routing->gotoTableId = OFDPA_FLOW_TABLE_ID_ACL_POLICY;
+}
+
+static indigo_error_t ind_ofdpa_routing_host_add(void *table_priv, of_list_bsn_tlv_t *key,
+                                                 of_list_bsn_tlv_t *value, void **entry_priv)
+{
+  ind_ofdpa_routing_host_entry_t entry;
+  ofdpaFlowEntry_t flow;
+  OFDPA_ERROR_t ofdpa_rv;
+  indigo_error_t rv;
+
+  memset(&entry, 0, sizeof(entry));
+  if ((rv = ind_ofdpa_routing_host_key_parse(key, &entry.ipv4)) < 0 ||
+      (rv = ind_ofdpa_host_port_parse(value, &entry.group_id)) < 0 ||
+      (rv = ind_ofdpa_routing_host_group_check(entry.group_id)) < 0)
+  {
+    return rv;
+  }
+
+  ind_ofdpa_routing_host_flow_build(&entry, &flow);
+  ofdpa_rv = ind_ofdpa_flow_direct_add(&flow);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR_RL("Failed to add host route to group 0x%x. (ofdpa_rv = %d)",
+                 entry.group_id, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+
+  *entry_priv = aim_memdup(&entry, sizeof(entry));
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_routing_host_modify(void *table_priv, void *entry_priv,
+                                                    of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *value)
+{
+  ind_ofdpa_routing_host_entry_t *entry = entry_priv;
+  ofdpaFlowEntry_t flow;
+  OFDPA_ERROR_t ofdpa_rv;
+  uint32_t group_id;
+  indigo_error_t rv;
+
+  if ((rv = ind_ofdpa_host_port_parse(value, &group_id)) < 0 ||
+      (rv = ind_ofdpa_routing_host_group_check(group_id)) < 0)
+  {
+    return rv;
+  }
+
+  if (group_id == entry->group_id)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  entry->group_id = group_id;
+  ind_ofdpa_routing_host_flow_build(entry, &flow);
+  ofdpa_rv = ind_ofdpa_flow_learned_modify(&flow);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR_RL("Failed to modify host route to group 0x%x. (ofdpa_rv = %d)",
+                 group_id, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_routing_host_delete(void *table_priv, void *entry_priv,
+                                                    of_list_bsn_tlv_t *key)
+{
+  ind_ofdpa_routing_host_entry_t *entry = entry_priv;
+  ofdpaFlowEntry_t flow;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ind_ofdpa_routing_host_flow_build(entry, &flow);
+  ofdpa_rv = ind_ofdpa_flow_learned_delete(&flow);
+  if (ofdpa_rv != OFDPA_E_NONE && ofdpa_rv != OFDPA_E_NOT_FOUND)
+  {
+    LOG_ERROR_RL("Failed to delete host route to group 0x%x. (ofdpa_rv = %d)",
+                 entry->group_id, ofdpa_rv);
+  }
+
+  aim_free(entry);
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_routing_host_get_stats(void *table_priv, void *entry_priv,
+                                             of_list_bsn_tlv_t *key, of_list_bsn_tlv_t *stats)
+{
+  ofdpaFlowEntry_t flow;
+
+  ind_ofdpa_routing_host_flow_build(entry_priv, &flow);
+  ind_ofdpa_host_stats_append(&flow, stats);
+}
+
+static const indigo_core_gentable_ops_t ind_ofdpa_routing_host_ops =
+{
+  .add = ind_ofdpa_routing_host_add,
+  .modify = ind_ofdpa_routing_host_modify,
+  .del = ind_ofdpa_routing_host_delete,
+  .get_stats = ind_ofdpa_routing_host_get_stats,
+};
+
+void ind_ofdpa_host_gentables_register(void)
+{
+  if (ind_ofdpa_bridging_gentable != NULL)
+  {
+    return;
+  }
+
+  indigo_core_gentable_register("ofdpa_bridging", &ind_ofdpa_bridging_ops, NULL,
+                                IND_OFDPA_HOST_MAX, IND_OFDPA_HOST_BUCKETS,
+                                &ind_ofdpa_bridging_gentable);
+  indigo_core_gentable_register("ofdpa_unicast_routing_host", &ind_ofdpa_routing_host_ops, NULL,
+                                IND_OFDPA_HOST_MAX, IND_OFDPA_HOST_BUCKETS,
+                                &ind_ofdpa_routing_host_gentable);
+}
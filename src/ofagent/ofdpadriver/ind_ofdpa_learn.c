@@ -0,0 +1,599 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_learn.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "indigo/time.h"
+#include "indigo/of_connection_manager.h"
+#include "indigo/forwarding.h"
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim.h>
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include <SocketManager/socketmanager.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+/*
+ * Source MAC learning
+ *
+ * With controller managed learning on, OF-DPA copies each frame with an
+ * unknown source address to the CPU as a Bridging table miss. Instead of
+ * a packet-in per frame for the controller to turn into a Bridging flow,
+ * the agent learns the address itself: the first frame from a (VLAN, MAC)
+ * queues a Bridging flow to the L2 interface group of its port on the
+ * flow batch, and the frames that follow before it lands, which a MAC
+ * move storm produces by the thousand, only update the table here. A
+ * frame from a learned address on another port moves its flow.
+ *
+ * The flows age out through their idle timeout, reported as flow events
+ * like the controller's. They carry no cookie, so warm start and table
+ * purges leave them alone. Learned, moved and aged addresses are reported
+ * to the controllers in batches, as BSN experimenter messages of subtype
+ * IND_OFDPA_LEARN_REPORT_SUBTYPE with data
+ *     uint16_t count; uint16_t pad;
+ *     count records of
+ *         uint16_t vlan_id; uint8_t event; uint8_t pad;
+ *         uint32_t port_no; uint8_t mac[6]; uint8_t pad[2];
+ * with event one of IND_OFDPA_LEARN_EVENT_*.
+ *
+ * Frames the agent cannot learn from (untagged, a full table, an address
+ * whose install failed recently) go to the controller as before.
+ */
+#define IND_OFDPA_LEARN_BUCKETS       4096
+#define IND_OFDPA_LEARN_MAX           16384
+#define IND_OFDPA_LEARN_PRIORITY      0
+#define IND_OFDPA_LEARN_RETRY_MS      1000   /* Before retrying a failed install */
+#define IND_OFDPA_LEARN_SWEEP_MS      10000  /* Forgetting failed installs */
+
+/* BSN experimenter subtype; the state manager uses up to 0x105 */
+#define IND_OFDPA_LEARN_REPORT_SUBTYPE 0x106
+#define IND_OFDPA_LEARN_REPORT_MAX     64
+#define IND_OFDPA_LEARN_REPORT_MS      100
+#define IND_OFDPA_LEARN_RECORD_LEN     16
+
+#define IND_OFDPA_LEARN_EVENT_LEARNED  0
+#define IND_OFDPA_LEARN_EVENT_MOVED    1
+#define IND_OFDPA_LEARN_EVENT_AGED     2
+
+typedef enum ind_ofdpa_learn_state_e
+{
+  IND_OFDPA_LEARN_QUEUED,     /* Flow add on the flow batch */
+  IND_OFDPA_LEARN_INSTALLED,
+  IND_OFDPA_LEARN_FAILED,     /* Frames go to the controller until retried */
+} ind_ofdpa_learn_state_t;
+
+typedef struct ind_ofdpa_learn_key_s
+{
+  uint16_t vlan_id;
+  uint8_t  mac[OFDPA_MAC_ADDR_LEN];
+} ind_ofdpa_learn_key_t;
+
+typedef struct ind_ofdpa_learn_entry_s
+{
+  bighash_entry_t         hash_entry;
+  ind_ofdpa_learn_key_t   key;
+  uint32_t                port;       /* In the flow, installed or queued */
+  uint32_t                seen_port;  /* Of the latest frame */
+  ind_ofdpa_learn_state_t state;
+  indigo_time_t           time;       /* Learned, or failed */
+} ind_ofdpa_learn_entry_t;
+
+#define TEMPLATE_NAME ind_ofdpa_learn_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_learn_entry_t
+#define TEMPLATE_KEY_FIELD key
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static bighash_table_t *ind_ofdpa_learn_table = NULL;
+
+static struct
+{
+  bool     running;
+  uint32_t aging_sec;
+  int      count;
+  bool     flush_armed;
+  bool     report_armed;
+  int      report_count;
+  uint8_t  report[IND_OFDPA_LEARN_REPORT_MAX * IND_OFDPA_LEARN_RECORD_LEN];
+  uint64_t punts;
+  uint64_t consumed;      /* Frames from addresses already learned or queued */
+  uint64_t learned;
+  uint64_t moved;
+  uint64_t aged;
+  uint64_t untagged;
+  uint64_t table_full;
+  uint64_t install_failed;
+  uint64_t move_failed;
+  uint64_t reports;
+} ind_ofdpa_learn;
+
+static void ind_ofdpa_learn_key_get(const ofdpaFlowEntry_t *flow, ind_ofdpa_learn_key_t *key)
+{
+  const ofdpaBridgingFlowMatch_t *match = &flow->flowData.bridgingFlowEntry.match_criteria;
+
+  memset(key, 0, sizeof(*key));
+  key->vlan_id = match->vlanId & OFDPA_VID_EXACT_MASK;
+  memcpy(key->mac, match->destMac.addr, OFDPA_MAC_ADDR_LEN);
+}
+
+static ind_ofdpa_learn_entry_t *ind_ofdpa_learn_find(const ind_ofdpa_learn_key_t *key)
+{
+  if (ind_ofdpa_learn_table == NULL)
+  {
+    return NULL;
+  }
+  return ind_ofdpa_learn_hashtable_first(ind_ofdpa_learn_table, key);
+}
+
+static void ind_ofdpa_learn_flow_build(const ind_ofdpa_learn_entry_t *entry, uint32_t port,
+                                       ofdpaFlowEntry_t *flow)
+{
+  ofdpaBridgingFlowEntry_t *bridging = &flow->flowData.bridgingFlowEntry;
+  uint32_t groupId = 0;
+
+  memset(flow, 0, sizeof(*flow));
+  flow->tableId = OFDPA_FLOW_TABLE_ID_BRIDGING;
+  flow->priority = IND_OFDPA_LEARN_PRIORITY;
+  flow->idle_time = ind_ofdpa_learn.aging_sec;
+
+  bridging->match_criteria.vlanId = OFDPA_VID_PRESENT | entry->key.vlan_id;
+  bridging->match_criteria.vlanIdMask = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+  memcpy(bridging->match_criteria.destMac.addr, entry->key.mac, OFDPA_MAC_ADDR_LEN);
+  memset(bridging->match_criteria.destMacMask.addr, 0xff, OFDPA_MAC_ADDR_LEN);
+
+  ofdpaGroupTypeSet(&groupId, OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE);
+  ofdpaGroupVlanSet(&groupId, entry->key.vlan_id);
+  ofdpaGroupPortIdSet(&groupId, port);
+  bridging->groupID = groupId;
+  bridging->gotoTableId = OFDPA_FLOW_TABLE_ID_ACL_POLICY;
+}
+
+static void ind_ofdpa_learn_report_timer(void *cookie);
+
+static void ind_ofdpa_learn_report_send(void)
+{
+  of_experimenter_t *msg;
+  of_octets_t octets;
+  of_version_t version;
+  uint8_t data[4 + sizeof(ind_ofdpa_learn.report)];
+  int count = ind_ofdpa_learn.report_count;
+
+  if (ind_ofdpa_learn.report_armed)
+  {
+    ind_soc_timer_event_unregister(ind_ofdpa_learn_report_timer, NULL);
+    ind_ofdpa_learn.report_armed = false;
+  }
+
+  if (count == 0)
+  {
+    return;
+  }
+  ind_ofdpa_learn.report_count = 0;
+
+  if (indigo_cxn_get_async_version(&version) < 0)
+  {
+    /* No controllers connected */
+    return;
+  }
+
+  if ((msg = of_experimenter_new(version)) == NULL)
+  {
+    LOG_ERROR("Failed to allocate learned MAC report");
+    return;
+  }
+
+  data[0] = count >> 8;
+  data[1] = count;
+  data[2] = data[3] = 0;
+  memcpy(data + 4, ind_ofdpa_learn.report, count * IND_OFDPA_LEARN_RECORD_LEN);
+  octets.data = data;
+  octets.bytes = 4 + count * IND_OFDPA_LEARN_RECORD_LEN;
+
+  of_experimenter_experimenter_set(msg, OF_EXPERIMENTER_ID_BSN);
+  of_experimenter_subtype_set(msg, IND_OFDPA_LEARN_REPORT_SUBTYPE);
+  if (of_experimenter_data_set(msg, &octets) < 0)
+  {
+    LOG_ERROR("Failed to set learned MAC report data");
+    of_object_delete(msg);
+    return;
+  }
+
+  ind_ofdpa_learn.reports++;
+  indigo_cxn_send_async_message(msg);
+}
+
+static void ind_ofdpa_learn_report_timer(void *cookie)
+{
+  ind_ofdpa_learn_report_send();
+}
+
+static void ind_ofdpa_learn_report_add(const ind_ofdpa_learn_entry_t *entry, uint8_t event)
+{
+  uint8_t *rec = ind_ofdpa_learn.report +
+    ind_ofdpa_learn.report_count * IND_OFDPA_LEARN_RECORD_LEN;
+
+  memset(rec, 0, IND_OFDPA_LEARN_RECORD_LEN);
+  rec[0] = entry->key.vlan_id >> 8;
+  rec[1] = entry->key.vlan_id;
+  rec[2] = event;
+  rec[4] = entry->port >> 24;
+  rec[5] = entry->port >> 16;
+  rec[6] = entry->port >> 8;
+  rec[7] = entry->port;
+  memcpy(rec + 8, entry->key.mac, OFDPA_MAC_ADDR_LEN);
+
+  if (++ind_ofdpa_learn.report_count == IND_OFDPA_LEARN_REPORT_MAX)
+  {
+    ind_ofdpa_learn_report_send();
+  }
+  else if (!ind_ofdpa_learn.report_armed)
+  {
+    if (ind_soc_timer_event_register(ind_ofdpa_learn_report_timer, NULL,
+                                     IND_OFDPA_LEARN_REPORT_MS) < 0)
+    {
+      ind_ofdpa_learn_report_send();
+      return;
+    }
+    ind_ofdpa_learn.report_armed = true;
+  }
+}
+
+/* Submit the learned flows queued by a burst of frames together */
+static void ind_ofdpa_learn_flush_timer(void *cookie)
+{
+  ind_soc_timer_event_unregister(ind_ofdpa_learn_flush_timer, NULL);
+  ind_ofdpa_learn.flush_armed = false;
+  indigo_fwd_pending_submit();
+}
+
+static void ind_ofdpa_learn_install(ind_ofdpa_learn_entry_t *entry)
+{
+  ofdpaFlowEntry_t flow;
+
+  ind_ofdpa_learn_flow_build(entry, entry->seen_port, &flow);
+  entry->port = entry->seen_port;
+  entry->state = IND_OFDPA_LEARN_QUEUED;
+  ind_ofdpa_flow_learned_queue(&flow);
+
+  if (!ind_ofdpa_learn.flush_armed)
+  {
+    if (ind_soc_timer_event_register(ind_ofdpa_learn_flush_timer, NULL,
+                                     IND_SOC_TIMER_IMMEDIATE) < 0)
+    {
+      indigo_fwd_pending_submit();
+      return;
+    }
+    ind_ofdpa_learn.flush_armed = true;
+  }
+}
+
+static void ind_ofdpa_learn_move(ind_ofdpa_learn_entry_t *entry)
+{
+  ofdpaFlowEntry_t flow;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ind_ofdpa_learn_flow_build(entry, entry->seen_port, &flow);
+  ofdpa_rv = ind_ofdpa_flow_learned_modify(&flow);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR_RL("Failed to move learned MAC on VLAN %u to port %u. (ofdpa_rv = %d)",
+                 entry->key.vlan_id, entry->seen_port, ofdpa_rv);
+    ind_ofdpa_learn.move_failed++;
+    return;
+  }
+
+  entry->port = entry->seen_port;
+  ind_ofdpa_learn.moved++;
+  ind_ofdpa_learn_report_add(entry, IND_OFDPA_LEARN_EVENT_MOVED);
+}
+
+static void ind_ofdpa_learn_remove(ind_ofdpa_learn_entry_t *entry)
+{
+  bighash_remove(ind_ofdpa_learn_table, &entry->hash_entry);
+  ind_ofdpa_learn.count--;
+  aim_free(entry);
+}
+
+int ind_ofdpa_learn_receive(const ofdpaPacket_t *rxPkt, const uint8_t *data, unsigned int len)
+{
+  ind_ofdpa_learn_entry_t *entry;
+  ind_ofdpa_learn_key_t key;
+
+  if (!ind_ofdpa_learn.running ||
+      rxPkt->tableId != OFDPA_FLOW_TABLE_ID_BRIDGING ||
+      rxPkt->reason != OFDPA_PACKET_IN_REASON_NO_MATCH)
+  {
+    return 0;
+  }
+
+  ind_ofdpa_learn.punts++;
+
+  /* Group and multicast sources are not learned */
+  if (len < 18 || data[6] & 0x01)
+  {
+    return 0;
+  }
+  if (data[12] != 0x81 || data[13] != 0x00)
+  {
+    ind_ofdpa_learn.untagged++;
+    return 0;
+  }
+
+  memset(&key, 0, sizeof(key));
+  key.vlan_id = ((data[14] << 8) | data[15]) & OFDPA_VID_EXACT_MASK;
+  memcpy(key.mac, data + 6, OFDPA_MAC_ADDR_LEN);
+
+  entry = ind_ofdpa_learn_find(&key);
+  if (entry == NULL)
+  {
+    if (ind_ofdpa_learn.count >= IND_OFDPA_LEARN_MAX)
+    {
+      ind_ofdpa_learn.table_full++;
+      return 0;
+    }
+
+    entry = aim_zmalloc(sizeof(*entry));
+    entry->key = key;
+    entry->seen_port = rxPkt->inPortNum;
+    ind_ofdpa_learn_hashtable_insert(ind_ofdpa_learn_table, entry);
+    ind_ofdpa_learn.count++;
+    ind_ofdpa_learn_install(entry);
+    return 1;
+  }
+
+  entry->seen_port = rxPkt->inPortNum;
+
+  switch (entry->state)
+  {
+    case IND_OFDPA_LEARN_QUEUED:
+      /* The move, if any, is made once the add lands */
+      ind_ofdpa_learn.consumed++;
+      return 1;
+    case IND_OFDPA_LEARN_INSTALLED:
+      ind_ofdpa_learn.consumed++;
+      if (entry->port != entry->seen_port)
+      {
+        ind_ofdpa_learn_move(entry);
+      }
+      return 1;
+    case IND_OFDPA_LEARN_FAILED:
+    default:
+      if (INDIGO_CURRENT_TIME - entry->time < IND_OFDPA_LEARN_RETRY_MS)
+      {
+        return 0;
+      }
+      ind_ofdpa_learn_install(entry);
+      return 1;
+  }
+}
+
+void ind_ofdpa_learn_install_done(const ofdpaFlowEntry_t *flow, OFDPA_ERROR_t ofdpa_rv)
+{
+  ind_ofdpa_learn_entry_t *entry;
+  ind_ofdpa_learn_key_t key;
+  ofdpaFlowEntry_t orphan;
+
+  ind_ofdpa_learn_key_get(flow, &key);
+  entry = ind_ofdpa_learn_find(&key);
+  if (entry == NULL || entry->state != IND_OFDPA_LEARN_QUEUED)
+  {
+    /* Learning stopped while the add was queued */
+    if (ofdpa_rv == OFDPA_E_NONE)
+    {
+      orphan = *flow;
+      (void)ind_ofdpa_flow_learned_delete(&orphan);
+    }
+    return;
+  }
+
+  entry->time = INDIGO_CURRENT_TIME;
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR_RL("Failed to install learned MAC on VLAN %u port %u. (ofdpa_rv = %d)",
+                 entry->key.vlan_id, entry->port, ofdpa_rv);
+    entry->state = IND_OFDPA_LEARN_FAILED;
+    ind_ofdpa_learn.install_failed++;
+    return;
+  }
+
+  entry->state = IND_OFDPA_LEARN_INSTALLED;
+  ind_ofdpa_learn.learned++;
+  ind_ofdpa_learn_report_add(entry, IND_OFDPA_LEARN_EVENT_LEARNED);
+
+  if (entry->port != entry->seen_port)
+  {
+    ind_ofdpa_learn_move(entry);
+  }
+}
+
+int ind_ofdpa_learn_flow_expired(const ofdpaFlowEntry_t *flow)
+{
+  ind_ofdpa_learn_entry_t *entry;
+  ind_ofdpa_learn_key_t key;
+  ofdpaFlowEntry_t expired;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  if (flow->tableId != OFDPA_FLOW_TABLE_ID_BRIDGING || flow->cookie != 0)
+  {
+    return 0;
+  }
+
+  ind_ofdpa_learn_key_get(flow, &key);
+  entry = ind_ofdpa_learn_find(&key);
+  if (entry == NULL || entry->state != IND_OFDPA_LEARN_INSTALLED)
+  {
+    return 0;
+  }
+
+  ind_ofdpa_learn_flow_build(entry, entry->port, &expired);
+  ofdpa_rv = ind_ofdpa_flow_learned_delete(&expired);
+  if (ofdpa_rv != OFDPA_E_NONE && ofdpa_rv != OFDPA_E_NOT_FOUND)
+  {
+    LOG_ERROR_RL("Failed to delete aged MAC on VLAN %u. (ofdpa_rv = %d)",
+                 entry->key.vlan_id, ofdpa_rv);
+  }
+
+  ind_ofdpa_learn.aged++;
+  ind_ofdpa_learn_report_add(entry, IND_OFDPA_LEARN_EVENT_AGED);
+  ind_ofdpa_learn_remove(entry);
+  return 1;
+}
+
+/* Forget the addresses whose install failed and that have not come back */
+static void ind_ofdpa_learn_sweep_timer(void *cookie)
+{
+  ind_ofdpa_learn_entry_t *entry;
+  bighash_iter_t iter;
+  indigo_time_t now = INDIGO_CURRENT_TIME;
+
+  for (entry = bighash_iter_start(ind_ofdpa_learn_table, &iter);
+       entry != NULL;
+       entry = bighash_iter_next(&iter))
+  {
+    if (entry->state == IND_OFDPA_LEARN_FAILED &&
+        now - entry->time >= IND_OFDPA_LEARN_SWEEP_MS)
+    {
+      ind_ofdpa_learn_remove(entry);
+    }
+  }
+}
+
+indigo_error_t ind_ofdpa_learn_start(uint32_t aging_sec)
+{
+  ofdpaSrcMacLearnModeCfg_t cfg;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  if (ind_ofdpa_learn.running)
+  {
+    ind_ofdpa_learn.aging_sec = aging_sec;
+    return INDIGO_ERROR_NONE;
+  }
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.destPortNum = OFDPA_PORT_CONTROLLER;
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaSourceMacLearningSet, OFDPA_ENABLE, &cfg);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to enable source MAC learning. (ofdpa_rv = %d)", ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+
+  if (ind_ofdpa_learn_table == NULL)
+  {
+    ind_ofdpa_learn_table = bighash_table_create(IND_OFDPA_LEARN_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_learn_table != NULL);
+  }
+
+  if (ind_soc_timer_event_register(ind_ofdpa_learn_sweep_timer, NULL,
+                                   IND_OFDPA_LEARN_SWEEP_MS) < 0)
+  {
+    LOG_ERROR("Failed to register learned MAC sweep timer");
+  }
+
+  ind_ofdpa_learn.aging_sec = aging_sec;
+  ind_ofdpa_learn.running = true;
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_learn_stop(void)
+{
+  ind_ofdpa_learn_entry_t *entry;
+  ofdpaFlowEntry_t flow;
+  ofdpaSrcMacLearnModeCfg_t cfg;
+  bighash_iter_t iter;
+
+  if (!ind_ofdpa_learn.running)
+  {
+    return;
+  }
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.destPortNum = OFDPA_PORT_CONTROLLER;
+  (void)IND_OFDPA_RPC(ofdpaSourceMacLearningSet, OFDPA_DISABLE, &cfg);
+  ind_soc_timer_event_unregister(ind_ofdpa_learn_sweep_timer, NULL);
+
+  /* Nothing would age the learned flows out; queued ones go when they land */
+  for (entry = bighash_iter_start(ind_ofdpa_learn_table, &iter);
+       entry != NULL;
+       entry = bighash_iter_next(&iter))
+  {
+    if (entry->state == IND_OFDPA_LEARN_INSTALLED)
+    {
+      ind_ofdpa_learn_flow_build(entry, entry->port, &flow);
+      (void)ind_ofdpa_flow_learned_delete(&flow);
+    }
+    ind_ofdpa_learn_remove(entry);
+  }
+
+  ind_ofdpa_learn_report_send();
+  ind_ofdpa_learn.running = false;
+}
+
+void ind_ofdpa_learn_show(aim_pvs_t *pvs, int detail)
+{
+  static const char *state_names[] = { "queued", "installed", "failed" };
+  ind_ofdpa_learn_entry_t *entry;
+  bighash_iter_t iter;
+
+  if (!ind_ofdpa_learn.running)
+  {
+    aim_printf(pvs, "MAC learning off\n");
+    return;
+  }
+
+  aim_printf(pvs, "MAC learning on, aging %u s, %d of %d addresses\n",
+             ind_ofdpa_learn.aging_sec, ind_ofdpa_learn.count, IND_OFDPA_LEARN_MAX);
+  aim_printf(pvs, "  punts %"PRIu64" consumed %"PRIu64" untagged %"PRIu64" table full %"PRIu64"\n",
+             ind_ofdpa_learn.punts, ind_ofdpa_learn.consumed,
+             ind_ofdpa_learn.untagged, ind_ofdpa_learn.table_full);
+  aim_printf(pvs, "  learned %"PRIu64" moved %"PRIu64" aged %"PRIu64" install failed %"PRIu64" move failed %"PRIu64" reports %"PRIu64"\n",
+             ind_ofdpa_learn.learned, ind_ofdpa_learn.moved, ind_ofdpa_learn.aged,
+             ind_ofdpa_learn.install_failed, ind_ofdpa_learn.move_failed,
+             ind_ofdpa_learn.reports);
+
+  if (!detail)
+  {
+    return;
+  }
+
+  for (entry = bighash_iter_start(ind_ofdpa_learn_table, &iter);
+       entry != NULL;
+       entry = bighash_iter_next(&iter))
+  {
+    aim_printf(pvs, "vlan %4u %02x:%02x:%02x:%02x:%02x:%02x port %u %s\n",
+               entry->key.vlan_id,
+               entry->key.mac[0], entry->key.mac[1], entry->key.mac[2],
+               entry->key.mac[3], entry->key.mac[4], entry->key.mac[5],
+               entry->port, state_names[entry->state]);
+  }
+}
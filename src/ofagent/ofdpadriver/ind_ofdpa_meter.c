@@ -30,21 +30,154 @@
 *
 **********************************************************************/
 #include "indigo/forwarding.h"
+#include "indigo/time.h"
 #include "ind_ofdpa_util.h"
 #include "ind_ofdpa_log.h"
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include <SocketManager/socketmanager.h>
+#include <stdbool.h>
+#include <inttypes.h>
 
 #ifdef OFDPA_FIXUP
-indigo_error_t indigo_fwd_meter_add(uint32_t id, uint16_t flag, of_list_meter_band_t *meters)
+/*
+ * Shadow of each meter programmed into OF-DPA, indexed by meter id. A
+ * modify that translates to the meter already programmed is dropped,
+ * since OF-DPA can only replace a meter by deleting and adding it.
+ *
+ * With the stats sweep running, a timer starts a walk of the OF-DPA
+ * meters every interval and a task reads a batch of them per turn of the
+ * event loop into the shadow, so meter stats requests are answered
+ * without an OF-DPA call per meter.
+ *
+ * The same pass then walks the color based actions table, caching the
+ * counters of each flow by cookie and summing them per color actions
+ * index, i.e. per tenant. Flow stats requests for those flows are served
+ * from the cache, so meter and color counters of all tenants come from
+ * one pass and share its timestamp. Totals are published when the pass
+ * ends; flows and tenants it did not see are dropped.
+ */
+typedef struct ind_ofdpa_meter_shadow_s
+{
+  bighash_entry_t        hash_entry;
+  uint32_t               id;
+  ofdpaMeterEntry_t      meter;   /* As programmed */
+  bool                   stats_valid;
+  ofdpaMeterEntryStats_t stats;   /* From the last sweep */
+} ind_ofdpa_meter_shadow_t;
+
+#define TEMPLATE_NAME ind_ofdpa_meter_shadow_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_meter_shadow_t
+#define TEMPLATE_KEY_FIELD id
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+typedef struct ind_ofdpa_color_flow_s
+{
+  bighash_entry_t       hash_entry;
+  uint64_t              cookie;
+  uint64_t              sweep;    /* Last pass that saw the flow */
+  ofdpaFlowEntryStats_t stats;
+} ind_ofdpa_color_flow_t;
+
+#define TEMPLATE_NAME ind_ofdpa_color_flow_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_color_flow_t
+#define TEMPLATE_KEY_FIELD cookie
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+#define IND_OFDPA_QOS_COLORS 3
+
+typedef struct ind_ofdpa_color_tenant_s
+{
+  bighash_entry_t hash_entry;
+  uint32_t        index;    /* Color actions index */
+  uint64_t        sweep;    /* Last pass that saw a flow of the tenant */
+  uint64_t        packets[IND_OFDPA_QOS_COLORS];  /* As of the last pass */
+  uint64_t        bytes[IND_OFDPA_QOS_COLORS];
+  uint64_t        sum_packets[IND_OFDPA_QOS_COLORS];  /* Running pass */
+  uint64_t        sum_bytes[IND_OFDPA_QOS_COLORS];
+} ind_ofdpa_color_tenant_t;
+
+#define TEMPLATE_NAME ind_ofdpa_color_tenant_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_color_tenant_t
+#define TEMPLATE_KEY_FIELD index
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+#define IND_OFDPA_METER_SHADOW_BUCKETS 4096
+#define IND_OFDPA_METER_STATS_SWEEP_BATCH 64
+#define IND_OFDPA_COLOR_FLOW_BUCKETS 16384
+#define IND_OFDPA_COLOR_TENANT_BUCKETS 4096
+
+static bighash_table_t *ind_ofdpa_meter_shadow_table = NULL;
+static bighash_table_t *ind_ofdpa_color_flow_table = NULL;
+static bighash_table_t *ind_ofdpa_color_tenant_table = NULL;
+
+static struct
+{
+  int           interval_ms;  /* 0 when the sweep is off */
+  bool          sweeping;
+  uint32_t      sweep_id;     /* Last meter read; 0 to start */
+  bool          color_phase;  /* Meters done, walking the color table */
+  bool          color_started;
+  ofdpaFlowEntry_t color_flow;  /* Last color table flow read */
+  indigo_time_t sweep_time;   /* When the last complete sweep started */
+  indigo_time_t start_time;   /* When the running sweep started */
+  uint64_t      sweeps;
+  uint64_t      overruns;
+  uint64_t      modify_noops;
+} ind_ofdpa_meter_stats;
+
+static ind_ofdpa_meter_shadow_t *ind_ofdpa_meter_shadow_find(uint32_t id)
+{
+  if (ind_ofdpa_meter_shadow_table == NULL)
+  {
+    return NULL;
+  }
+  return ind_ofdpa_meter_shadow_hashtable_first(ind_ofdpa_meter_shadow_table, &id);
+}
+
+static void ind_ofdpa_meter_shadow_set(uint32_t id, const ofdpaMeterEntry_t *meter)
+{
+  ind_ofdpa_meter_shadow_t *shadow = ind_ofdpa_meter_shadow_find(id);
+
+  if (shadow == NULL)
+  {
+    if (ind_ofdpa_meter_shadow_table == NULL)
+    {
+      ind_ofdpa_meter_shadow_table = bighash_table_create(IND_OFDPA_METER_SHADOW_BUCKETS);
+      AIM_TRUE_OR_DIE(ind_ofdpa_meter_shadow_table != NULL);
+    }
+    shadow = aim_zmalloc(sizeof(*shadow));
+    shadow->id = id;
+    ind_ofdpa_meter_shadow_hashtable_insert(ind_ofdpa_meter_shadow_table, shadow);
+  }
+
+  shadow->meter = *meter;
+  shadow->stats_valid = false;
+}
+
+static void ind_ofdpa_meter_shadow_remove(uint32_t id)
+{
+  ind_ofdpa_meter_shadow_t *shadow = ind_ofdpa_meter_shadow_find(id);
+
+  if (shadow != NULL)
+  {
+    bighash_remove(ind_ofdpa_meter_shadow_table, &shadow->hash_entry);
+    aim_free(shadow);
+  }
+}
+
+static indigo_error_t ind_ofdpa_meter_translate(uint16_t flag, of_list_meter_band_t *meters,
+                                                ofdpaMeterEntry_t *meter)
 {
-  indigo_error_t err = INDIGO_ERROR_NONE;
   of_meter_band_t of_meter_band;
   int rv;
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  ofdpaMeterEntry_t meter;
 
-  memset(&meter, 0, sizeof(meter));
+  /* Zeroed so translations compare equal with memcmp */
+  memset(meter, 0, sizeof(*meter));
 
-  LOG_TRACE("meter_add: id %d, flag 0x%x",id, flag);
   OF_LIST_METER_BAND_ITER(meters, &of_meter_band, rv)
   {
     switch (of_meter_band.header.object_id) {
@@ -70,11 +203,11 @@ indigo_error_t indigo_fwd_meter_add(uint32_t id, uint16_t flag, of_list_meter_ba
 
         if ((flag & OF_METER_FLAG_KBPS) == OF_METER_FLAG_KBPS)
         {
-          meter.u.tcmParameters.tcmRateUnit = OFDPA_METER_RATE_KBPS;
+          meter->u.tcmParameters.tcmRateUnit = OFDPA_METER_RATE_KBPS;
         }
         else if ((flag & OF_METER_FLAG_PKTPS) == OF_METER_FLAG_PKTPS)
         {
-          meter.u.tcmParameters.tcmRateUnit = OFDPA_METER_RATE_PKTPS;
+          meter->u.tcmParameters.tcmRateUnit = OFDPA_METER_RATE_PKTPS;
         }
 
         of_meter_band_ofdpa_color_set_rate_get(&of_meter_band.ofdpa_color_set, &rate);
@@ -84,18 +217,18 @@ indigo_error_t indigo_fwd_meter_add(uint32_t id, uint16_t flag, of_list_meter_ba
         of_meter_band_ofdpa_color_set_color_get(&of_meter_band.ofdpa_color_set, &color);
         LOG_TRACE("meter_band: %d, %d, %d, %d, %d",rate, burst, mode, color_aware, color);
 
-        meter.meterType = OFDPA_METER_TYPE_TCM;
-        meter.u.tcmParameters.tcmMode = mode;
-        meter.u.tcmParameters.colorAwareMode = color_aware;
+        meter->meterType = OFDPA_METER_TYPE_TCM;
+        meter->u.tcmParameters.tcmMode = mode;
+        meter->u.tcmParameters.colorAwareMode = color_aware;
         if (color == 1) /* Yellow */
         {
-          meter.u.tcmParameters.yellowRate = rate;
-          meter.u.tcmParameters.yellowBurst = burst;
+          meter->u.tcmParameters.yellowRate = rate;
+          meter->u.tcmParameters.yellowBurst = burst;
         }
         else if (color == 2) /* Red */
         {
-          meter.u.tcmParameters.redRate = rate;
-          meter.u.tcmParameters.redBurst = burst;
+          meter->u.tcmParameters.redRate = rate;
+          meter->u.tcmParameters.redBurst = burst;
         }
 
         break;
@@ -107,36 +240,76 @@ indigo_error_t indigo_fwd_meter_add(uint32_t id, uint16_t flag, of_list_meter_ba
 
   }
 
-  if (meter.meterType == OFDPA_METER_TYPE_TCM)
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_meter_program(uint32_t id, ofdpaMeterEntry_t *meter)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+
+  if (meter->meterType != OFDPA_METER_TYPE_TCM)
   {
-    /* Submit the changes to ofdpa */
-    ofdpa_rv = ofdpaMeterAdd(id, &meter);
-    if (ofdpa_rv != OFDPA_E_NONE)
-    {
-      LOG_ERROR("Failed to add Meter. (ofdpa_rv = %d)", ofdpa_rv);
-    }
-    else
-    {
-      LOG_TRACE("Meter added successfully. (ofdpa_rv = %d)", ofdpa_rv);
-    }
+    return INDIGO_ERROR_NONE;
+  }
 
-    rv = indigoConvertOfdpaRv(ofdpa_rv);
+  /* Submit the changes to ofdpa */
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaMeterAdd, id, meter);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to add Meter. (ofdpa_rv = %d)", ofdpa_rv);
+  }
+  else
+  {
+    LOG_TRACE("Meter added successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    ind_ofdpa_meter_shadow_set(id, meter);
   }
 
-  return err;
+  return indigoConvertOfdpaRv(ofdpa_rv);
+}
+
+indigo_error_t indigo_fwd_meter_add(uint32_t id, uint16_t flag, of_list_meter_band_t *meters)
+{
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  ofdpaMeterEntry_t meter;
+
+  LOG_TRACE("meter_add: id %d, flag 0x%x",id, flag);
+
+  err = ind_ofdpa_meter_translate(flag, meters, &meter);
+  if (err != INDIGO_ERROR_NONE)
+  {
+    return err;
+  }
+
+  return ind_ofdpa_meter_program(id, &meter);
 }
 indigo_error_t indigo_fwd_meter_modify(uint32_t id, uint16_t flag, of_list_meter_band_t *meters)
 {
   indigo_error_t err = INDIGO_ERROR_NONE;
+  ind_ofdpa_meter_shadow_t *shadow;
+  ofdpaMeterEntry_t meter;
 
   LOG_TRACE("meter_mod: id %d", id);
 
+  err = ind_ofdpa_meter_translate(flag, meters, &meter);
+  if (err != INDIGO_ERROR_NONE)
+  {
+    return err;
+  }
+
+  shadow = ind_ofdpa_meter_shadow_find(id);
+  if (shadow != NULL && !memcmp(&shadow->meter, &meter, sizeof(meter)))
+  {
+    LOG_TRACE("meter_mod: id %d unchanged", id);
+    ind_ofdpa_meter_stats.modify_noops++;
+    return INDIGO_ERROR_NONE;
+  }
+
   err = indigo_fwd_meter_delete(id);
   if (err != INDIGO_ERROR_NONE)
   {
     return err;
   }
-  err = indigo_fwd_meter_add(id, flag, meters);
+  err = ind_ofdpa_meter_program(id, &meter);
   if (err != INDIGO_ERROR_NONE)
   {
     return err;
@@ -151,7 +324,7 @@ indigo_error_t indigo_fwd_meter_delete(uint32_t id)
   LOG_TRACE("meter_del: id %d",id);
 
   /* Submit the changes to ofdpa */
-  ofdpa_rv = ofdpaMeterDelete(id);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaMeterDelete, id);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to delete meter. (ofdpa_rv = %d)", ofdpa_rv);
@@ -159,8 +332,396 @@ indigo_error_t indigo_fwd_meter_delete(uint32_t id)
   else
   {
     LOG_TRACE("Meter deleted successfully. (ofdpa_rv = %d)", ofdpa_rv);
+    ind_ofdpa_meter_shadow_remove(id);
   }
 
   return (indigoConvertOfdpaRv(ofdpa_rv));;
 }
+
+void indigo_fwd_meter_stats_get(uint32_t id, of_meter_stats_t *entry)
+{
+  ind_ofdpa_meter_shadow_t *shadow = ind_ofdpa_meter_shadow_find(id);
+  ofdpaMeterEntryStats_t stats;
+
+  if (shadow != NULL && shadow->stats_valid)
+  {
+    stats = shadow->stats;
+  }
+  else
+  {
+    memset(&stats, 0, sizeof(stats));
+    if (IND_OFDPA_RPC(ofdpaMeterStatsGet, id, &stats) != OFDPA_E_NONE)
+    {
+      return;
+    }
+  }
+
+  /* OF-DPA keeps no packet or byte counters for meters */
+  of_meter_stats_flow_count_set(entry, stats.refCount);
+}
+
+static ind_ofdpa_color_tenant_t *ind_ofdpa_color_tenant_get(uint32_t index)
+{
+  ind_ofdpa_color_tenant_t *tenant;
+
+  tenant = ind_ofdpa_color_tenant_hashtable_first(ind_ofdpa_color_tenant_table, &index);
+  if (tenant == NULL)
+  {
+    tenant = aim_zmalloc(sizeof(*tenant));
+    tenant->index = index;
+    ind_ofdpa_color_tenant_hashtable_insert(ind_ofdpa_color_tenant_table, tenant);
+  }
+  if (tenant->sweep != ind_ofdpa_meter_stats.sweeps)
+  {
+    tenant->sweep = ind_ofdpa_meter_stats.sweeps;
+    memset(tenant->sum_packets, 0, sizeof(tenant->sum_packets));
+    memset(tenant->sum_bytes, 0, sizeof(tenant->sum_bytes));
+  }
+  return tenant;
+}
+
+static void ind_ofdpa_color_flow_record(ofdpaFlowEntry_t *flow, ofdpaFlowEntryStats_t *stats)
+{
+  ofdpaColorActionsFlowMatch_t *match = &flow->flowData.colorActionsFlowEntry.match_criteria;
+  ind_ofdpa_color_flow_t *color_flow;
+  ind_ofdpa_color_tenant_t *tenant;
+
+  color_flow = ind_ofdpa_color_flow_hashtable_first(ind_ofdpa_color_flow_table, &flow->cookie);
+  if (color_flow == NULL)
+  {
+    color_flow = aim_zmalloc(sizeof(*color_flow));
+    color_flow->cookie = flow->cookie;
+    ind_ofdpa_color_flow_hashtable_insert(ind_ofdpa_color_flow_table, color_flow);
+  }
+  color_flow->sweep = ind_ofdpa_meter_stats.sweeps;
+  color_flow->stats = *stats;
+
+  if (match->color < IND_OFDPA_QOS_COLORS)
+  {
+    tenant = ind_ofdpa_color_tenant_get(match->index);
+    tenant->sum_packets[match->color] += stats->receivedPackets;
+    tenant->sum_bytes[match->color] += stats->receivedBytes;
+  }
+}
+
+/* Publish the totals of the pass and drop what it did not see */
+static void ind_ofdpa_color_sweep_finish(void)
+{
+  ind_ofdpa_color_flow_t *color_flow;
+  ind_ofdpa_color_tenant_t *tenant;
+  bighash_iter_t iter;
+
+  for (color_flow = bighash_iter_start(ind_ofdpa_color_flow_table, &iter);
+       color_flow != NULL;
+       color_flow = bighash_iter_next(&iter))
+  {
+    if (color_flow->sweep != ind_ofdpa_meter_stats.sweeps)
+    {
+      bighash_remove(ind_ofdpa_color_flow_table, &color_flow->hash_entry);
+      aim_free(color_flow);
+    }
+  }
+
+  for (tenant = bighash_iter_start(ind_ofdpa_color_tenant_table, &iter);
+       tenant != NULL;
+       tenant = bighash_iter_next(&iter))
+  {
+    if (tenant->sweep != ind_ofdpa_meter_stats.sweeps)
+    {
+      bighash_remove(ind_ofdpa_color_tenant_table, &tenant->hash_entry);
+      aim_free(tenant);
+      continue;
+    }
+    memcpy(tenant->packets, tenant->sum_packets, sizeof(tenant->packets));
+    memcpy(tenant->bytes, tenant->sum_bytes, sizeof(tenant->bytes));
+  }
+}
+
+/* Read the next batch of color table flows; false once the walk is done */
+static bool ind_ofdpa_color_sweep_batch(void)
+{
+  ofdpaFlowEntry_t *flow = &ind_ofdpa_meter_stats.color_flow;
+  ofdpaFlowEntryStats_t stats;
+  int i;
+
+  if (ind_ofdpa_color_flow_table == NULL)
+  {
+    ind_ofdpa_color_flow_table = bighash_table_create(IND_OFDPA_COLOR_FLOW_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_color_flow_table != NULL);
+    ind_ofdpa_color_tenant_table = bighash_table_create(IND_OFDPA_COLOR_TENANT_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_color_tenant_table != NULL);
+  }
+
+  if (!ind_ofdpa_meter_stats.color_started)
+  {
+    ind_ofdpa_meter_stats.color_started = true;
+    if (IND_OFDPA_RPC(ofdpaFlowEntryInit, OFDPA_FLOW_TABLE_ID_COLOR_BASED_ACTIONS,
+                      flow) != OFDPA_E_NONE)
+    {
+      return false;
+    }
+    /* The initial key is itself a valid entry only if such a flow exists */
+    memset(&stats, 0, sizeof(stats));
+    if (IND_OFDPA_RPC(ofdpaFlowStatsGet, flow, &stats) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_color_flow_record(flow, &stats);
+    }
+  }
+
+  for (i = 0; i < IND_OFDPA_METER_STATS_SWEEP_BATCH; i++)
+  {
+    if (IND_OFDPA_RPC(ofdpaFlowNextGet, flow, flow) != OFDPA_E_NONE)
+    {
+      return false;
+    }
+    /* A flow deleted meanwhile is skipped, the walk carries on */
+    memset(&stats, 0, sizeof(stats));
+    if (IND_OFDPA_RPC(ofdpaFlowStatsGet, flow, &stats) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_color_flow_record(flow, &stats);
+    }
+  }
+
+  return true;
+}
+
+static ind_soc_task_status_t ind_ofdpa_meter_stats_sweep_task(void *cookie)
+{
+  ind_ofdpa_meter_shadow_t *shadow;
+  ofdpaMeterEntryStats_t stats;
+  uint32_t id;
+  int i;
+
+  if (ind_ofdpa_meter_stats.interval_ms == 0)
+  {
+    ind_ofdpa_meter_stats.sweeping = false;
+    return IND_SOC_TASK_FINISHED;
+  }
+
+  if (ind_ofdpa_meter_stats.color_phase)
+  {
+    if (ind_ofdpa_color_sweep_batch())
+    {
+      return IND_SOC_TASK_CONTINUE;
+    }
+    ind_ofdpa_color_sweep_finish();
+    ind_ofdpa_meter_stats.sweeping = false;
+    ind_ofdpa_meter_stats.sweep_time = ind_ofdpa_meter_stats.start_time;
+    ind_ofdpa_meter_stats.sweeps++;
+    return IND_SOC_TASK_FINISHED;
+  }
+
+  for (i = 0; i < IND_OFDPA_METER_STATS_SWEEP_BATCH; i++)
+  {
+    if (IND_OFDPA_RPC(ofdpaMeterNextGet, ind_ofdpa_meter_stats.sweep_id, &id) != OFDPA_E_NONE)
+    {
+      ind_ofdpa_meter_stats.color_phase = true;
+      return IND_SOC_TASK_CONTINUE;
+    }
+    ind_ofdpa_meter_stats.sweep_id = id;
+
+    /* Meters not added through the driver are not reported */
+    shadow = ind_ofdpa_meter_shadow_find(id);
+    if (shadow == NULL)
+    {
+      continue;
+    }
+
+    memset(&stats, 0, sizeof(stats));
+    if (IND_OFDPA_RPC(ofdpaMeterStatsGet, id, &stats) == OFDPA_E_NONE)
+    {
+      shadow->stats = stats;
+      shadow->stats_valid = true;
+    }
+  }
+
+  return IND_SOC_TASK_CONTINUE;
+}
+
+static void ind_ofdpa_meter_stats_timer(void *cookie)
+{
+  if (ind_ofdpa_meter_stats.sweeping)
+  {
+    ind_ofdpa_meter_stats.overruns++;
+    return;
+  }
+
+  ind_ofdpa_meter_stats.sweep_id = 0;
+  ind_ofdpa_meter_stats.color_phase = false;
+  ind_ofdpa_meter_stats.color_started = false;
+  ind_ofdpa_meter_stats.start_time = INDIGO_CURRENT_TIME;
+
+  if (ind_soc_task_register(ind_ofdpa_meter_stats_sweep_task, NULL,
+                            IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    LOG_ERROR("Failed to start meter stats sweep");
+    return;
+  }
+  ind_ofdpa_meter_stats.sweeping = true;
+}
+
+static void ind_ofdpa_color_flow_free(bighash_entry_t *e)
+{
+  aim_free(container_of(e, hash_entry, ind_ofdpa_color_flow_t));
+}
+
+static void ind_ofdpa_color_tenant_free(bighash_entry_t *e)
+{
+  aim_free(container_of(e, hash_entry, ind_ofdpa_color_tenant_t));
+}
+
+static void ind_ofdpa_color_cache_free(void)
+{
+  if (ind_ofdpa_color_flow_table != NULL)
+  {
+    bighash_table_destroy(ind_ofdpa_color_flow_table, ind_ofdpa_color_flow_free);
+    bighash_table_destroy(ind_ofdpa_color_tenant_table, ind_ofdpa_color_tenant_free);
+    ind_ofdpa_color_flow_table = NULL;
+    ind_ofdpa_color_tenant_table = NULL;
+  }
+}
+
+indigo_error_t ind_ofdpa_meter_stats_start(int interval_ms)
+{
+  if (interval_ms <= 0)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_meter_stats_stop();
+
+  if (ind_soc_timer_event_register(ind_ofdpa_meter_stats_timer, NULL, interval_ms) < 0)
+  {
+    LOG_ERROR("Failed to register meter stats timer");
+    return INDIGO_ERROR_UNKNOWN;
+  }
+  ind_ofdpa_meter_stats.interval_ms = interval_ms;
+
+  ind_ofdpa_meter_stats_timer(NULL);
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_meter_stats_stop(void)
+{
+  ind_ofdpa_meter_shadow_t *shadow;
+  bighash_iter_t iter;
+
+  if (ind_ofdpa_meter_stats.interval_ms == 0)
+  {
+    return;
+  }
+
+  ind_soc_timer_event_unregister(ind_ofdpa_meter_stats_timer, NULL);
+  ind_ofdpa_meter_stats.interval_ms = 0;
+
+  /* Read live again rather than serve counters nothing refreshes */
+  if (ind_ofdpa_meter_shadow_table != NULL)
+  {
+    for (shadow = bighash_iter_start(ind_ofdpa_meter_shadow_table, &iter);
+         shadow != NULL;
+         shadow = bighash_iter_next(&iter))
+    {
+      shadow->stats_valid = false;
+    }
+  }
+
+  ind_ofdpa_color_cache_free();
+}
+
+/**
+ * Counters of a color based actions flow as of the last pass
+ *
+ * @returns 1 if the flow was seen by the last pass
+ */
+int ind_ofdpa_color_flow_stats_get(uint64_t cookie, ofdpaFlowEntryStats_t *stats)
+{
+  ind_ofdpa_color_flow_t *color_flow;
+
+  if (ind_ofdpa_color_flow_table == NULL || ind_ofdpa_meter_stats.interval_ms == 0)
+  {
+    return 0;
+  }
+
+  color_flow = ind_ofdpa_color_flow_hashtable_first(ind_ofdpa_color_flow_table, &cookie);
+  if (color_flow == NULL || color_flow->sweep + 1 < ind_ofdpa_meter_stats.sweeps)
+  {
+    return 0;
+  }
+
+  *stats = color_flow->stats;
+  return 1;
+}
+
+/**
+ * Show meter and per-color counters of each tenant from the last pass
+ */
+void ind_ofdpa_tenant_metering_show(aim_pvs_t *pvs)
+{
+  ind_ofdpa_meter_shadow_t *shadow;
+  ind_ofdpa_color_tenant_t *tenant;
+  bighash_iter_t iter;
+
+  if (ind_ofdpa_meter_stats.interval_ms == 0 || ind_ofdpa_meter_stats.sweeps == 0 ||
+      ind_ofdpa_meter_shadow_table == NULL || ind_ofdpa_color_tenant_table == NULL)
+  {
+    aim_printf(pvs, "No completed meter stats sweep\n");
+    return;
+  }
+
+  aim_printf(pvs, "As of %u ms ago\n",
+             INDIGO_TIME_DIFF_ms(ind_ofdpa_meter_stats.sweep_time, INDIGO_CURRENT_TIME));
+
+  aim_printf(pvs, "%-10s %-10s\n", "meter", "flows");
+  for (shadow = bighash_iter_start(ind_ofdpa_meter_shadow_table, &iter);
+       shadow != NULL;
+       shadow = bighash_iter_next(&iter))
+  {
+    if (shadow->stats_valid)
+    {
+      aim_printf(pvs, "%-10u %-10u\n", shadow->id, shadow->stats.refCount);
+    }
+  }
+
+  aim_printf(pvs, "%-10s %-20s %-20s %-20s\n", "index", "green pkts/bytes",
+             "yellow pkts/bytes", "red pkts/bytes");
+  for (tenant = bighash_iter_start(ind_ofdpa_color_tenant_table, &iter);
+       tenant != NULL;
+       tenant = bighash_iter_next(&iter))
+  {
+    if (tenant->sweep + 1 < ind_ofdpa_meter_stats.sweeps)
+    {
+      continue;
+    }
+    aim_printf(pvs, "%-10u %"PRIu64"/%"PRIu64" %"PRIu64"/%"PRIu64" %"PRIu64"/%"PRIu64"\n",
+               tenant->index,
+               tenant->packets[OFDPA_QOS_GREEN], tenant->bytes[OFDPA_QOS_GREEN],
+               tenant->packets[OFDPA_QOS_YELLOW], tenant->bytes[OFDPA_QOS_YELLOW],
+               tenant->packets[OFDPA_QOS_RED], tenant->bytes[OFDPA_QOS_RED]);
+  }
+}
+
+void ind_ofdpa_meter_stats_show(aim_pvs_t *pvs)
+{
+  aim_printf(pvs, "%d meters shadowed, %"PRIu64" no-op modifies skipped\n",
+             ind_ofdpa_meter_shadow_table ? bighash_entry_count(ind_ofdpa_meter_shadow_table) : 0,
+             ind_ofdpa_meter_stats.modify_noops);
+
+  if (ind_ofdpa_meter_stats.interval_ms == 0)
+  {
+    aim_printf(pvs, "Meter stats sweep off\n");
+    return;
+  }
+
+  aim_printf(pvs, "Meter stats sweep every %d ms%s\n",
+             ind_ofdpa_meter_stats.interval_ms,
+             ind_ofdpa_meter_stats.sweeping ? ", sweeping" : "");
+  if (ind_ofdpa_meter_stats.sweeps != 0)
+  {
+    aim_printf(pvs, "  last sweep %u ms ago\n",
+               INDIGO_TIME_DIFF_ms(ind_ofdpa_meter_stats.sweep_time, INDIGO_CURRENT_TIME));
+  }
+  aim_printf(pvs, "  sweeps %"PRIu64" overruns %"PRIu64"\n",
+             ind_ofdpa_meter_stats.sweeps, ind_ofdpa_meter_stats.overruns);
+}
 #endif
@@ -0,0 +1,719 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_oam.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "indigo/time.h"
+#include "indigo/of_connection_manager.h"
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include <SocketManager/socketmanager.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+/*
+ * OAM counter collector
+ *
+ * A timer starts a walk of the OF-DPA MEPs every interval and a task
+ * reads a batch of them per turn of the event loop. Each MEP keeps a
+ * ring of its last proactive LM and DM samples (the current 15 minute
+ * bins) and the data plane LM counters of the traffic classes added
+ * through the driver, so data plane counter requests are answered
+ * without an OF-DPA call.
+ *
+ * A sample whose average frame loss ratio or bidirectional frame delay
+ * crosses a threshold is logged once when it goes above and once when
+ * it comes back below, and reported to the controllers as an OAM event.
+ */
+#define IND_OFDPA_OAM_RING_SIZE 8
+#define IND_OFDPA_OAM_TRAFFIC_CLASSES 8
+#define IND_OFDPA_OAM_MEP_BUCKETS 4096
+#define IND_OFDPA_OAM_SWEEP_BATCH 64
+
+typedef struct ind_ofdpa_oam_sample_s
+{
+  indigo_time_t             time;
+  bool                      lm_valid;
+  bool                      dm_valid;
+  ofdpaOamProLmCounterBin_t lm;
+  ofdpaOamProDmCounterBin_t dm;
+} ind_ofdpa_oam_sample_t;
+
+typedef struct ind_ofdpa_oam_mep_s
+{
+  bighash_entry_t        hash_entry;
+  uint32_t               lmepId;
+  uint64_t               sweep;          /* Last sweep that found the MEP */
+  ind_ofdpa_oam_sample_t ring[IND_OFDPA_OAM_RING_SIZE];
+  int                    head;           /* Slot of the next sample */
+  int                    count;
+  bool                   loss_alarm;
+  bool                   delay_alarm;
+  uint8_t                data_classes;   /* Traffic classes with a data plane counter */
+  uint8_t                data_valid;     /* Traffic classes read by the last sweep */
+  struct
+  {
+    uint32_t tx;
+    uint32_t rx;
+  } data[IND_OFDPA_OAM_TRAFFIC_CLASSES];
+  indigo_time_t          data_time;
+} ind_ofdpa_oam_mep_t;
+
+#define TEMPLATE_NAME ind_ofdpa_oam_mep_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_oam_mep_t
+#define TEMPLATE_KEY_FIELD lmepId
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static bighash_table_t *ind_ofdpa_oam_mep_table = NULL;
+
+static struct
+{
+  int           interval_ms;     /* 0 when the collector is off */
+  bool          sweeping;
+  uint32_t      sweep_id;        /* Last MEP read; 0 to start */
+  uint32_t      loss_threshold;  /* Frame loss ratio; 0 for none */
+  uint32_t      delay_threshold; /* Bidirectional frame delay; 0 for none */
+  uint64_t      sweeps;
+  uint64_t      overruns;
+  uint64_t      alarms;
+  uint64_t      hits;
+  uint64_t      misses;
+} ind_ofdpa_oam_stats;
+
+static ind_ofdpa_oam_mep_t *ind_ofdpa_oam_mep_find(uint32_t lmepId)
+{
+  if (ind_ofdpa_oam_mep_table == NULL)
+  {
+    return NULL;
+  }
+  return ind_ofdpa_oam_mep_hashtable_first(ind_ofdpa_oam_mep_table, &lmepId);
+}
+
+static ind_ofdpa_oam_mep_t *ind_ofdpa_oam_mep_get(uint32_t lmepId)
+{
+  ind_ofdpa_oam_mep_t *mep = ind_ofdpa_oam_mep_find(lmepId);
+
+  if (mep == NULL)
+  {
+    if (ind_ofdpa_oam_mep_table == NULL)
+    {
+      ind_ofdpa_oam_mep_table = bighash_table_create(IND_OFDPA_OAM_MEP_BUCKETS);
+      AIM_TRUE_OR_DIE(ind_ofdpa_oam_mep_table != NULL);
+    }
+    mep = aim_zmalloc(sizeof(*mep));
+    mep->lmepId = lmepId;
+    ind_ofdpa_oam_mep_hashtable_insert(ind_ofdpa_oam_mep_table, mep);
+  }
+
+  return mep;
+}
+
+void ind_ofdpa_oam_data_counter_track(uint32_t lmepId, uint8_t trafficClass, int add)
+{
+  ind_ofdpa_oam_mep_t *mep;
+
+  if (trafficClass >= IND_OFDPA_OAM_TRAFFIC_CLASSES)
+  {
+    return;
+  }
+
+  if (add)
+  {
+    mep = ind_ofdpa_oam_mep_get(lmepId);
+    mep->data_classes |= 1 << trafficClass;
+  }
+  else if ((mep = ind_ofdpa_oam_mep_find(lmepId)) != NULL)
+  {
+    mep->data_classes &= ~(1 << trafficClass);
+  }
+  else
+  {
+    return;
+  }
+
+  /* Until the next sweep reads the counter anew */
+  mep->data_valid &= ~(1 << trafficClass);
+}
+
+int ind_ofdpa_oam_data_counters_get(uint32_t lmepId, uint8_t trafficClass,
+                                    uint32_t *txFCl, uint32_t *rxFCl)
+{
+  ind_ofdpa_oam_mep_t *mep = ind_ofdpa_oam_mep_find(lmepId);
+
+  if (ind_ofdpa_oam_stats.interval_ms == 0 ||
+      trafficClass >= IND_OFDPA_OAM_TRAFFIC_CLASSES ||
+      mep == NULL || !(mep->data_valid & (1 << trafficClass)) ||
+      INDIGO_TIME_DIFF_ms(mep->data_time, INDIGO_CURRENT_TIME) >
+      2 * ind_ofdpa_oam_stats.interval_ms)
+  {
+    ind_ofdpa_oam_stats.misses++;
+    return 0;
+  }
+
+  ind_ofdpa_oam_stats.hits++;
+  *txFCl = mep->data[trafficClass].tx;
+  *rxFCl = mep->data[trafficClass].rx;
+
+  return 1;
+}
+
+/*
+ * OAM events
+ *
+ * The OAM events OF-DPA raises on the event socket are drained at most
+ * IND_OFDPA_OAM_EVENT_BATCH per wakeup, the rest from a SocketManager
+ * task that yields between batches. Events, and the collector's
+ * threshold crossings, are coalesced per MEP for IND_OFDPA_OAM_REPORT_MS
+ * and sent to the controllers as BSN experimenter messages of subtype
+ * IND_OFDPA_OAM_REPORT_SUBTYPE with data
+ *     uint16_t count; uint16_t pad;
+ *     count records of
+ *         uint32_t megIndex; uint16_t mepId; uint16_t pad; uint32_t events;
+ * with events the OFDPA_OAM_EVENT_MASK_t bits OR'd with the
+ * IND_OFDPA_OAM_EVENT_* bits. An alarm and its clear within one report
+ * leave only the later.
+ */
+#define IND_OFDPA_OAM_EVENT_BATCH      64
+
+/* BSN experimenter subtype; the learned MAC report uses 0x106 */
+#define IND_OFDPA_OAM_REPORT_SUBTYPE   0x107
+#define IND_OFDPA_OAM_REPORT_MAX       64
+#define IND_OFDPA_OAM_REPORT_MS        100
+#define IND_OFDPA_OAM_RECORD_LEN       12
+
+#define IND_OFDPA_OAM_EVENT_LOSS_ALARM   (1 << 16)
+#define IND_OFDPA_OAM_EVENT_LOSS_CLEAR   (1 << 17)
+#define IND_OFDPA_OAM_EVENT_DELAY_ALARM  (1 << 18)
+#define IND_OFDPA_OAM_EVENT_DELAY_CLEAR  (1 << 19)
+
+static struct
+{
+  bool     task_running;
+  bool     report_armed;
+  int      report_count;
+  struct
+  {
+    uint32_t megIndex;
+    uint32_t mepId;
+    uint32_t events;
+  } report[IND_OFDPA_OAM_REPORT_MAX];
+  uint64_t events;
+  uint64_t coalesced;
+  uint64_t reports;
+} ind_ofdpa_oam_events;
+
+static void ind_ofdpa_oam_report_timer(void *cookie);
+
+static void ind_ofdpa_oam_report_send(void)
+{
+  of_experimenter_t *msg;
+  of_octets_t octets;
+  of_version_t version;
+  uint8_t data[4 + IND_OFDPA_OAM_REPORT_MAX * IND_OFDPA_OAM_RECORD_LEN];
+  uint8_t *rec;
+  int count = ind_ofdpa_oam_events.report_count;
+  int i;
+
+  if (ind_ofdpa_oam_events.report_armed)
+  {
+    ind_soc_timer_event_unregister(ind_ofdpa_oam_report_timer, NULL);
+    ind_ofdpa_oam_events.report_armed = false;
+  }
+
+  if (count == 0)
+  {
+    return;
+  }
+  ind_ofdpa_oam_events.report_count = 0;
+
+  if (indigo_cxn_get_async_version(&version) < 0)
+  {
+    /* No controllers connected */
+    return;
+  }
+
+  if ((msg = of_experimenter_new(version)) == NULL)
+  {
+    LOG_ERROR("Failed to allocate OAM event report");
+    return;
+  }
+
+  memset(data, 0, sizeof(data));
+  data[0] = count >> 8;
+  data[1] = count;
+  for (i = 0; i < count; i++)
+  {
+    rec = data + 4 + i * IND_OFDPA_OAM_RECORD_LEN;
+    rec[0] = ind_ofdpa_oam_events.report[i].megIndex >> 24;
+    rec[1] = ind_ofdpa_oam_events.report[i].megIndex >> 16;
+    rec[2] = ind_ofdpa_oam_events.report[i].megIndex >> 8;
+    rec[3] = ind_ofdpa_oam_events.report[i].megIndex;
+    rec[4] = ind_ofdpa_oam_events.report[i].mepId >> 8;
+    rec[5] = ind_ofdpa_oam_events.report[i].mepId;
+    rec[8] = ind_ofdpa_oam_events.report[i].events >> 24;
+    rec[9] = ind_ofdpa_oam_events.report[i].events >> 16;
+    rec[10] = ind_ofdpa_oam_events.report[i].events >> 8;
+    rec[11] = ind_ofdpa_oam_events.report[i].events;
+  }
+  octets.data = data;
+  octets.bytes = 4 + count * IND_OFDPA_OAM_RECORD_LEN;
+
+  of_experimenter_experimenter_set(msg, OF_EXPERIMENTER_ID_BSN);
+  of_experimenter_subtype_set(msg, IND_OFDPA_OAM_REPORT_SUBTYPE);
+  if (of_experimenter_data_set(msg, &octets) < 0)
+  {
+    LOG_ERROR("Failed to set OAM event report data");
+    of_object_delete(msg);
+    return;
+  }
+
+  ind_ofdpa_oam_events.reports++;
+  indigo_cxn_send_async_message(msg);
+}
+
+static void ind_ofdpa_oam_report_timer(void *cookie)
+{
+  ind_ofdpa_oam_report_send();
+}
+
+static void ind_ofdpa_oam_report_add(uint32_t megIndex, uint32_t mepId, uint32_t events)
+{
+  int i;
+
+  ind_ofdpa_oam_events.events++;
+
+  for (i = 0; i < ind_ofdpa_oam_events.report_count; i++)
+  {
+    if (ind_ofdpa_oam_events.report[i].megIndex == megIndex &&
+        ind_ofdpa_oam_events.report[i].mepId == mepId)
+    {
+      break;
+    }
+  }
+
+  if (i < ind_ofdpa_oam_events.report_count)
+  {
+    /* The later of an alarm and its clear wins */
+    if (events & (IND_OFDPA_OAM_EVENT_LOSS_ALARM | IND_OFDPA_OAM_EVENT_LOSS_CLEAR))
+    {
+      ind_ofdpa_oam_events.report[i].events &=
+        ~(IND_OFDPA_OAM_EVENT_LOSS_ALARM | IND_OFDPA_OAM_EVENT_LOSS_CLEAR);
+    }
+    if (events & (IND_OFDPA_OAM_EVENT_DELAY_ALARM | IND_OFDPA_OAM_EVENT_DELAY_CLEAR))
+    {
+      ind_ofdpa_oam_events.report[i].events &=
+        ~(IND_OFDPA_OAM_EVENT_DELAY_ALARM | IND_OFDPA_OAM_EVENT_DELAY_CLEAR);
+    }
+    ind_ofdpa_oam_events.report[i].events |= events;
+    ind_ofdpa_oam_events.coalesced++;
+    return;
+  }
+
+  ind_ofdpa_oam_events.report[i].megIndex = megIndex;
+  ind_ofdpa_oam_events.report[i].mepId = mepId;
+  ind_ofdpa_oam_events.report[i].events = events;
+
+  if (++ind_ofdpa_oam_events.report_count == IND_OFDPA_OAM_REPORT_MAX)
+  {
+    ind_ofdpa_oam_report_send();
+  }
+  else if (!ind_ofdpa_oam_events.report_armed)
+  {
+    if (ind_soc_timer_event_register(ind_ofdpa_oam_report_timer, NULL,
+                                     IND_OFDPA_OAM_REPORT_MS) < 0)
+    {
+      ind_ofdpa_oam_report_send();
+      return;
+    }
+    ind_ofdpa_oam_events.report_armed = true;
+  }
+}
+
+/* Read up to a batch of events. Returns true if the batch ran out first. */
+static bool ind_ofdpa_oam_event_drain(void)
+{
+  ofdpaOamEvent_t event;
+  int i;
+
+  for (i = 0; i < IND_OFDPA_OAM_EVENT_BATCH; i++)
+  {
+    memset(&event, 0, sizeof(event));
+    if (IND_OFDPA_RPC(ofdpaOamEventNextGet, &event) != OFDPA_E_NONE)
+    {
+      return false;
+    }
+
+    LOG_TRACE("OAM event: MEG %u MEP %u eventMask 0x%x",
+              event.megIndex, event.mepId, event.eventMask);
+    ind_ofdpa_oam_report_add(event.megIndex, event.mepId, event.eventMask);
+  }
+
+  return true;
+}
+
+static ind_soc_task_status_t ind_ofdpa_oam_event_task(void *cookie)
+{
+  if (ind_ofdpa_oam_event_drain())
+  {
+    return IND_SOC_TASK_CONTINUE;
+  }
+
+  ind_ofdpa_oam_events.task_running = false;
+  return IND_SOC_TASK_FINISHED;
+}
+
+void ind_ofdpa_oam_event_receive(void)
+{
+  LOG_TRACE("Reading OAM Events");
+
+  /* The task reads this wakeup's events too */
+  if (ind_ofdpa_oam_events.task_running)
+  {
+    return;
+  }
+
+  if (!ind_ofdpa_oam_event_drain())
+  {
+    return;
+  }
+
+  if (ind_soc_task_register(ind_ofdpa_oam_event_task, NULL,
+                            IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    LOG_ERROR("Failed to start OAM event task; draining now");
+    while (ind_ofdpa_oam_event_drain())
+      ;
+    return;
+  }
+  ind_ofdpa_oam_events.task_running = true;
+}
+
+/* Report a threshold crossing under the MEP's MEG and MEP ID */
+static void ind_ofdpa_oam_threshold_report(uint32_t lmepId, uint32_t events)
+{
+  ofdpaOamMepConfig_t config;
+  ofdpaOamMepStatus_t status;
+
+  memset(&config, 0, sizeof(config));
+  memset(&status, 0, sizeof(status));
+  if (IND_OFDPA_RPC(ofdpaOamMepGet, lmepId, &config, &status) != OFDPA_E_NONE)
+  {
+    LOG_ERROR_RL("Failed to get MEP %u to report a threshold crossing", lmepId);
+    return;
+  }
+
+  ind_ofdpa_oam_report_add(config.megIndex, config.mepId, events);
+}
+
+/* Log a threshold crossing in either direction */
+static void ind_ofdpa_oam_threshold_check(uint32_t lmepId, const char *what,
+                                          uint32_t value, uint32_t threshold, bool *alarm,
+                                          uint32_t alarm_event, uint32_t clear_event)
+{
+  bool above = (threshold != 0 && value > threshold);
+
+  if (above == *alarm)
+  {
+    return;
+  }
+  *alarm = above;
+
+  if (above)
+  {
+    ind_ofdpa_oam_stats.alarms++;
+    LOG_WARN("MEP %u %s %u above threshold %u", lmepId, what, value, threshold);
+    ind_ofdpa_oam_threshold_report(lmepId, alarm_event);
+  }
+  else
+  {
+    LOG_INFO("MEP %u %s %u back within threshold %u", lmepId, what, value, threshold);
+    ind_ofdpa_oam_threshold_report(lmepId, clear_event);
+  }
+}
+
+static void ind_ofdpa_oam_mep_sample(ind_ofdpa_oam_mep_t *mep)
+{
+  ind_ofdpa_oam_sample_t *sample = &mep->ring[mep->head];
+  ofdpaOamProLmCounters_t lm;
+  ofdpaOamProDmCounters_t dm;
+  ofdpaOamDataCounterIndex_t index;
+  uint32_t loss;
+  int tc;
+
+  memset(sample, 0, sizeof(*sample));
+  sample->time = INDIGO_CURRENT_TIME;
+
+  /* MEPs without proactive LM or DM fail these */
+  memset(&lm, 0, sizeof(lm));
+  if (IND_OFDPA_RPC(ofdpaOamProLmCountersGet, mep->lmepId, &lm) == OFDPA_E_NONE)
+  {
+    sample->lm_valid = true;
+    sample->lm = lm.bin_15min;
+  }
+  memset(&dm, 0, sizeof(dm));
+  if (IND_OFDPA_RPC(ofdpaOamProDmCountersGet, mep->lmepId, &dm) == OFDPA_E_NONE)
+  {
+    sample->dm_valid = true;
+    sample->dm = dm.bin_15min;
+  }
+
+  mep->head = (mep->head + 1) % IND_OFDPA_OAM_RING_SIZE;
+  if (mep->count < IND_OFDPA_OAM_RING_SIZE)
+  {
+    mep->count++;
+  }
+
+  if (sample->lm_valid)
+  {
+    loss = sample->lm.aN_FLR > sample->lm.aF_FLR ? sample->lm.aN_FLR : sample->lm.aF_FLR;
+    ind_ofdpa_oam_threshold_check(mep->lmepId, "frame loss ratio", loss,
+                                  ind_ofdpa_oam_stats.loss_threshold, &mep->loss_alarm,
+                                  IND_OFDPA_OAM_EVENT_LOSS_ALARM, IND_OFDPA_OAM_EVENT_LOSS_CLEAR);
+  }
+  if (sample->dm_valid)
+  {
+    ind_ofdpa_oam_threshold_check(mep->lmepId, "frame delay", sample->dm.aB_FD,
+                                  ind_ofdpa_oam_stats.delay_threshold, &mep->delay_alarm,
+                                  IND_OFDPA_OAM_EVENT_DELAY_ALARM, IND_OFDPA_OAM_EVENT_DELAY_CLEAR);
+  }
+
+  mep->data_valid = 0;
+  mep->data_time = sample->time;
+  for (tc = 0; tc < IND_OFDPA_OAM_TRAFFIC_CLASSES; tc++)
+  {
+    if (!(mep->data_classes & (1 << tc)))
+    {
+      continue;
+    }
+    index.lmepId = mep->lmepId;
+    index.trafficClass = tc;
+    if (IND_OFDPA_RPC(ofdpaOamDataCountersLMGet, index,
+                      &mep->data[tc].tx, &mep->data[tc].rx) == OFDPA_E_NONE)
+    {
+      mep->data_valid |= 1 << tc;
+    }
+  }
+}
+
+/* Drop MEPs the finished sweep did not find, unless a data counter is tracked */
+static void ind_ofdpa_oam_mep_purge(void)
+{
+  ind_ofdpa_oam_mep_t *mep;
+  bighash_iter_t iter;
+
+  for (mep = bighash_iter_start(ind_ofdpa_oam_mep_table, &iter);
+       mep != NULL;
+       mep = bighash_iter_next(&iter))
+  {
+    if (mep->sweep == ind_ofdpa_oam_stats.sweeps)
+    {
+      continue;
+    }
+    if (mep->data_classes == 0)
+    {
+      bighash_remove(ind_ofdpa_oam_mep_table, &mep->hash_entry);
+      aim_free(mep);
+    }
+    else
+    {
+      mep->count = 0;
+      mep->data_valid = 0;
+    }
+  }
+}
+
+static ind_soc_task_status_t ind_ofdpa_oam_sweep_task(void *cookie)
+{
+  ind_ofdpa_oam_mep_t *mep;
+  uint32_t lmepId;
+  int i;
+
+  if (ind_ofdpa_oam_stats.interval_ms == 0)
+  {
+    ind_ofdpa_oam_stats.sweeping = false;
+    return IND_SOC_TASK_FINISHED;
+  }
+
+  for (i = 0; i < IND_OFDPA_OAM_SWEEP_BATCH; i++)
+  {
+    if (IND_OFDPA_RPC(ofdpaOamMepNextGet, ind_ofdpa_oam_stats.sweep_id, &lmepId) != OFDPA_E_NONE)
+    {
+      if (ind_ofdpa_oam_mep_table != NULL)
+      {
+        ind_ofdpa_oam_mep_purge();
+      }
+      ind_ofdpa_oam_stats.sweeping = false;
+      ind_ofdpa_oam_stats.sweeps++;
+      return IND_SOC_TASK_FINISHED;
+    }
+    ind_ofdpa_oam_stats.sweep_id = lmepId;
+
+    mep = ind_ofdpa_oam_mep_get(lmepId);
+    mep->sweep = ind_ofdpa_oam_stats.sweeps;
+    ind_ofdpa_oam_mep_sample(mep);
+  }
+
+  return IND_SOC_TASK_CONTINUE;
+}
+
+static void ind_ofdpa_oam_timer(void *cookie)
+{
+  if (ind_ofdpa_oam_stats.sweeping)
+  {
+    ind_ofdpa_oam_stats.overruns++;
+    return;
+  }
+
+  ind_ofdpa_oam_stats.sweep_id = 0;
+
+  if (ind_soc_task_register(ind_ofdpa_oam_sweep_task, NULL,
+                            IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    LOG_ERROR("Failed to start OAM counter sweep");
+    return;
+  }
+  ind_ofdpa_oam_stats.sweeping = true;
+}
+
+indigo_error_t ind_ofdpa_oam_collector_start(int interval_ms)
+{
+  if (interval_ms <= 0)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_oam_collector_stop();
+
+  if (ind_soc_timer_event_register(ind_ofdpa_oam_timer, NULL, interval_ms) < 0)
+  {
+    LOG_ERROR("Failed to register OAM counter timer");
+    return INDIGO_ERROR_UNKNOWN;
+  }
+  ind_ofdpa_oam_stats.interval_ms = interval_ms;
+
+  ind_ofdpa_oam_timer(NULL);
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_oam_collector_stop(void)
+{
+  if (ind_ofdpa_oam_stats.interval_ms == 0)
+  {
+    return;
+  }
+
+  ind_soc_timer_event_unregister(ind_ofdpa_oam_timer, NULL);
+  ind_ofdpa_oam_stats.interval_ms = 0;
+}
+
+void ind_ofdpa_oam_thresholds_set(uint32_t loss, uint32_t delay)
+{
+  ind_ofdpa_oam_stats.loss_threshold = loss;
+  ind_ofdpa_oam_stats.delay_threshold = delay;
+}
+
+void ind_ofdpa_oam_collector_show(aim_pvs_t *pvs)
+{
+  aim_printf(pvs, "%d MEPs collected, thresholds loss %u delay %u\n",
+             ind_ofdpa_oam_mep_table ? bighash_entry_count(ind_ofdpa_oam_mep_table) : 0,
+             ind_ofdpa_oam_stats.loss_threshold, ind_ofdpa_oam_stats.delay_threshold);
+  aim_printf(pvs, "OAM events %"PRIu64" coalesced %"PRIu64" reports %"PRIu64"%s\n",
+             ind_ofdpa_oam_events.events, ind_ofdpa_oam_events.coalesced,
+             ind_ofdpa_oam_events.reports,
+             ind_ofdpa_oam_events.task_running ? ", draining" : "");
+
+  if (ind_ofdpa_oam_stats.interval_ms == 0)
+  {
+    aim_printf(pvs, "OAM counter collector off\n");
+    return;
+  }
+
+  aim_printf(pvs, "OAM counter collector every %d ms%s\n",
+             ind_ofdpa_oam_stats.interval_ms,
+             ind_ofdpa_oam_stats.sweeping ? ", sweeping" : "");
+  aim_printf(pvs, "  sweeps %"PRIu64" overruns %"PRIu64" alarms %"PRIu64" hits %"PRIu64" misses %"PRIu64"\n",
+             ind_ofdpa_oam_stats.sweeps, ind_ofdpa_oam_stats.overruns,
+             ind_ofdpa_oam_stats.alarms, ind_ofdpa_oam_stats.hits,
+             ind_ofdpa_oam_stats.misses);
+}
+
+void ind_ofdpa_oam_mep_show(aim_pvs_t *pvs, uint32_t lmepId)
+{
+  ind_ofdpa_oam_mep_t *mep = ind_ofdpa_oam_mep_find(lmepId);
+  ind_ofdpa_oam_sample_t *sample;
+  int i, tc;
+
+  if (mep == NULL)
+  {
+    aim_printf(pvs, "MEP %u not collected\n", lmepId);
+    return;
+  }
+
+  aim_printf(pvs, "MEP %u%s%s\n", lmepId,
+             mep->loss_alarm ? ", loss alarm" : "",
+             mep->delay_alarm ? ", delay alarm" : "");
+  aim_printf(pvs, "%8s %10s %10s %10s %10s %10s\n",
+             "age_ms", "aN_FLR", "aF_FLR", "aB_FD", "aN_FDV", "aF_FDV");
+
+  /* Newest first */
+  for (i = 1; i <= mep->count; i++)
+  {
+    sample = &mep->ring[(mep->head - i + IND_OFDPA_OAM_RING_SIZE) % IND_OFDPA_OAM_RING_SIZE];
+    aim_printf(pvs, "%8u ", INDIGO_TIME_DIFF_ms(sample->time, INDIGO_CURRENT_TIME));
+    if (sample->lm_valid)
+    {
+      aim_printf(pvs, "%10u %10u ", sample->lm.aN_FLR, sample->lm.aF_FLR);
+    }
+    else
+    {
+      aim_printf(pvs, "%10s %10s ", "-", "-");
+    }
+    if (sample->dm_valid)
+    {
+      aim_printf(pvs, "%10u %10u %10u\n", sample->dm.aB_FD, sample->dm.aN_FDV, sample->dm.aF_FDV);
+    }
+    else
+    {
+      aim_printf(pvs, "%10s %10s %10s\n", "-", "-", "-");
+    }
+  }
+
+  for (tc = 0; tc < IND_OFDPA_OAM_TRAFFIC_CLASSES; tc++)
+  {
+    if (mep->data_valid & (1 << tc))
+    {
+      aim_printf(pvs, "  traffic class %d: tx %u rx %u\n", tc, mep->data[tc].tx, mep->data[tc].rx);
+    }
+  }
+}
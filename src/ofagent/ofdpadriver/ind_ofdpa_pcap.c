@@ -0,0 +1,292 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_pcap.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <VPI/vpi.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <inttypes.h>
+
+#if VPI_CONFIG_INCLUDE_INTERFACE_PCAPDUMP == 1
+#include <pcap/pcap.h>
+#endif
+
+/*
+ * Packet tap
+ *
+ * Frames punted to the agent and frames the controller injects with
+ * packet_out are written to <prefix>-pktin.pcap and <prefix>-pktout.pcap
+ * through VPI pcapdump interfaces. A frame that passes the optional BPF
+ * filter is copied, up to the snap length, into a ring with a single
+ * producer, the main loop, and a single consumer, a writer thread that
+ * owns the VPIs, so no file I/O or lock is taken on the packet path. A
+ * frame arriving at a full ring is dropped from the capture and counted.
+ * The timestamps are those of the write, which trails the packet by the
+ * depth of the ring.
+ *
+ * When the tap is off, the packet paths only test ind_ofdpa_pcap_enabled.
+ */
+#define IND_OFDPA_PCAP_RING_SIZE     1024   /* Power of 2 */
+#define IND_OFDPA_PCAP_SNAPLEN_MAX   2048
+#define IND_OFDPA_PCAP_IDLE_US       1000
+
+typedef struct ind_ofdpa_pcap_slot_s
+{
+  uint8_t  dir;
+  uint32_t caplen;
+  uint8_t  data[IND_OFDPA_PCAP_SNAPLEN_MAX];
+} ind_ofdpa_pcap_slot_t;
+
+int ind_ofdpa_pcap_enabled = 0;
+
+static struct
+{
+  ind_ofdpa_pcap_slot_t *ring;
+  uint32_t               head;       /* Next slot to fill; written by the producer */
+  uint32_t               tail;       /* Next slot to write; written by the writer */
+  uint32_t               snaplen;
+  char                   prefix[256];
+  char                   filter_expr[256];
+  vpi_t                  vpi[IND_OFDPA_PCAP_DIR_COUNT];
+  pthread_t              writer;
+  volatile bool          stopping;
+#if VPI_CONFIG_INCLUDE_INTERFACE_PCAPDUMP == 1
+  struct bpf_program     filter;
+#endif
+  bool                   filtered;
+  uint64_t               tapped[IND_OFDPA_PCAP_DIR_COUNT];
+  uint64_t               filtered_out;
+  uint64_t               ring_drops;
+  uint64_t               written;
+  uint64_t               write_errors;
+} ind_ofdpa_pcap;
+
+static const char *ind_ofdpa_pcap_dir_names[IND_OFDPA_PCAP_DIR_COUNT] = { "pktin", "pktout" };
+
+void ind_ofdpa_pcap_tap(ind_ofdpa_pcap_dir_t dir, const uint8_t *data, uint32_t len)
+{
+  ind_ofdpa_pcap_slot_t *slot;
+  uint32_t head = ind_ofdpa_pcap.head;
+  uint32_t caplen;
+
+  ind_ofdpa_pcap.tapped[dir]++;
+
+#if VPI_CONFIG_INCLUDE_INTERFACE_PCAPDUMP == 1
+  if (ind_ofdpa_pcap.filtered &&
+      bpf_filter(ind_ofdpa_pcap.filter.bf_insns, data, len, len) == 0)
+  {
+    ind_ofdpa_pcap.filtered_out++;
+    return;
+  }
+#endif
+
+  if (head - __atomic_load_n(&ind_ofdpa_pcap.tail, __ATOMIC_ACQUIRE) >=
+      IND_OFDPA_PCAP_RING_SIZE)
+  {
+    ind_ofdpa_pcap.ring_drops++;
+    return;
+  }
+
+  caplen = (len < ind_ofdpa_pcap.snaplen) ? len : ind_ofdpa_pcap.snaplen;
+  slot = &ind_ofdpa_pcap.ring[head & (IND_OFDPA_PCAP_RING_SIZE - 1)];
+  slot->dir = dir;
+  slot->caplen = caplen;
+  memcpy(slot->data, data, caplen);
+
+  __atomic_store_n(&ind_ofdpa_pcap.head, head + 1, __ATOMIC_RELEASE);
+}
+
+static void *ind_ofdpa_pcap_writer(void *arg)
+{
+  ind_ofdpa_pcap_slot_t *slot;
+  uint32_t tail = ind_ofdpa_pcap.tail;
+  uint32_t head;
+
+  for (;;)
+  {
+    head = __atomic_load_n(&ind_ofdpa_pcap.head, __ATOMIC_ACQUIRE);
+    if (tail == head)
+    {
+      /* Stop only once the ring is drained */
+      if (ind_ofdpa_pcap.stopping)
+      {
+        break;
+      }
+      usleep(IND_OFDPA_PCAP_IDLE_US);
+      continue;
+    }
+
+    while (tail != head)
+    {
+      slot = &ind_ofdpa_pcap.ring[tail & (IND_OFDPA_PCAP_RING_SIZE - 1)];
+      if (vpi_send(ind_ofdpa_pcap.vpi[slot->dir], slot->data, slot->caplen) < 0)
+      {
+        ind_ofdpa_pcap.write_errors++;
+      }
+      else
+      {
+        ind_ofdpa_pcap.written++;
+      }
+      tail++;
+      __atomic_store_n(&ind_ofdpa_pcap.tail, tail, __ATOMIC_RELEASE);
+    }
+  }
+
+  return NULL;
+}
+
+static void ind_ofdpa_pcap_release(void)
+{
+  int dir;
+
+  for (dir = 0; dir < IND_OFDPA_PCAP_DIR_COUNT; dir++)
+  {
+    if (ind_ofdpa_pcap.vpi[dir] != NULL)
+    {
+      vpi_destroy(ind_ofdpa_pcap.vpi[dir]);
+      ind_ofdpa_pcap.vpi[dir] = NULL;
+    }
+  }
+#if VPI_CONFIG_INCLUDE_INTERFACE_PCAPDUMP == 1
+  if (ind_ofdpa_pcap.filtered)
+  {
+    pcap_freecode(&ind_ofdpa_pcap.filter);
+    ind_ofdpa_pcap.filtered = false;
+  }
+#endif
+  aim_free(ind_ofdpa_pcap.ring);
+  ind_ofdpa_pcap.ring = NULL;
+}
+
+indigo_error_t ind_ofdpa_pcap_start(const char *prefix, uint32_t snaplen, const char *filter)
+{
+#if VPI_CONFIG_INCLUDE_INTERFACE_PCAPDUMP == 1
+  char spec[300];
+  int dir;
+
+  if (snaplen == 0 || snaplen > IND_OFDPA_PCAP_SNAPLEN_MAX)
+  {
+    snaplen = IND_OFDPA_PCAP_SNAPLEN_MAX;
+  }
+
+  ind_ofdpa_pcap_stop();
+
+  memset(&ind_ofdpa_pcap, 0, sizeof(ind_ofdpa_pcap));
+  ind_ofdpa_pcap.snaplen = snaplen;
+  aim_strlcpy(ind_ofdpa_pcap.prefix, prefix, sizeof(ind_ofdpa_pcap.prefix));
+
+  if (filter != NULL && filter[0] != '\0')
+  {
+    if (pcap_compile_nopcap(snaplen, DLT_EN10MB, &ind_ofdpa_pcap.filter,
+                            filter, 1, PCAP_NETMASK_UNKNOWN) < 0)
+    {
+      LOG_ERROR("Invalid capture filter \"%s\"", filter);
+      return INDIGO_ERROR_PARAM;
+    }
+    ind_ofdpa_pcap.filtered = true;
+    aim_strlcpy(ind_ofdpa_pcap.filter_expr, filter, sizeof(ind_ofdpa_pcap.filter_expr));
+  }
+
+  vpi_init();
+  for (dir = 0; dir < IND_OFDPA_PCAP_DIR_COUNT; dir++)
+  {
+    snprintf(spec, sizeof(spec), "pcapdump|%s-%s.pcap", prefix, ind_ofdpa_pcap_dir_names[dir]);
+    ind_ofdpa_pcap.vpi[dir] = vpi_create(spec);
+    if (ind_ofdpa_pcap.vpi[dir] == NULL)
+    {
+      LOG_ERROR("Failed to create %s", spec);
+      ind_ofdpa_pcap_release();
+      return INDIGO_ERROR_UNKNOWN;
+    }
+  }
+
+  ind_ofdpa_pcap.ring = aim_malloc(IND_OFDPA_PCAP_RING_SIZE * sizeof(*ind_ofdpa_pcap.ring));
+  if (pthread_create(&ind_ofdpa_pcap.writer, NULL, ind_ofdpa_pcap_writer, NULL) != 0)
+  {
+    LOG_ERROR("Failed to create packet tap writer thread");
+    ind_ofdpa_pcap_release();
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  ind_ofdpa_thread_register(INDIGO_THREAD_PCAP, ind_ofdpa_pcap.writer);
+
+  ind_ofdpa_pcap_enabled = 1;
+  LOG_INFO("Packet tap writing to %s-{pktin,pktout}.pcap", prefix);
+  return INDIGO_ERROR_NONE;
+#else
+  LOG_ERROR("Packet tap needs the VPI pcapdump interface");
+  return INDIGO_ERROR_NOT_SUPPORTED;
+#endif
+}
+
+void ind_ofdpa_pcap_stop(void)
+{
+  if (!ind_ofdpa_pcap_enabled)
+  {
+    return;
+  }
+
+  /* Producers run on this thread, so nothing is added after this */
+  ind_ofdpa_pcap_enabled = 0;
+  ind_ofdpa_pcap.stopping = true;
+  indigo_thread_unregister(ind_ofdpa_pcap.writer);
+  pthread_join(ind_ofdpa_pcap.writer, NULL);
+
+  ind_ofdpa_pcap_release();
+}
+
+void ind_ofdpa_pcap_show(aim_pvs_t *pvs)
+{
+  int dir;
+
+  if (!ind_ofdpa_pcap_enabled)
+  {
+    aim_printf(pvs, "Packet tap off\n");
+    return;
+  }
+
+  aim_printf(pvs, "Packet tap to %s-{pktin,pktout}.pcap, snaplen %u, filter \"%s\"\n",
+             ind_ofdpa_pcap.prefix, ind_ofdpa_pcap.snaplen, ind_ofdpa_pcap.filter_expr);
+  for (dir = 0; dir < IND_OFDPA_PCAP_DIR_COUNT; dir++)
+  {
+    aim_printf(pvs, "  %-8s %" PRIu64 " seen\n",
+               ind_ofdpa_pcap_dir_names[dir], ind_ofdpa_pcap.tapped[dir]);
+  }
+  aim_printf(pvs, "  filtered out %" PRIu64 ", ring drops %" PRIu64
+             ", written %" PRIu64 ", write errors %" PRIu64 ", queued %u\n",
+             ind_ofdpa_pcap.filtered_out, ind_ofdpa_pcap.ring_drops,
+             ind_ofdpa_pcap.written, ind_ofdpa_pcap.write_errors,
+             ind_ofdpa_pcap.head - __atomic_load_n(&ind_ofdpa_pcap.tail, __ATOMIC_ACQUIRE));
+}
@@ -0,0 +1,475 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_pdu.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "indigo/time.h"
+#include "indigo/of_connection_manager.h"
+#include "indigo/of_state_manager.h"
+#include "indigo/port_manager.h"
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include <SocketManager/socketmanager.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+/*
+ * PDU offload
+ *
+ * Periodic control protocol PDUs (LLDP, LACP) are handled in the agent
+ * instead of going through packet-in and packet-out for every frame.
+ * The controller programs each port slot with bsn_pdu_tx_request, a
+ * frame the agent sends every interval, and bsn_pdu_rx_request, the
+ * frame the agent expects from the peer within a timeout.
+ *
+ * A received frame equal to the expected one of a slot on its port is
+ * consumed and restarts that slot's timeout. Any other frame goes to
+ * the controller as before, so the controller only sees the peer's
+ * state changes, and a bsn_pdu_rx_timeout when the peer goes quiet.
+ */
+#define IND_OFDPA_PDU_SLOTS 4
+#define IND_OFDPA_PDU_PORT_BUCKETS 256
+
+extern int ofagent_of_version;
+
+typedef struct ind_ofdpa_pdu_port_s ind_ofdpa_pdu_port_t;
+
+typedef struct ind_ofdpa_pdu_slot_s
+{
+  ind_ofdpa_pdu_port_t *port;
+  uint8_t               slot_num;
+  uint8_t              *data;         /* NULL when the slot is not programmed */
+  uint16_t              len;
+  uint32_t              ms;           /* tx interval or rx timeout */
+  bool                  timed_out;
+} ind_ofdpa_pdu_slot_t;
+
+struct ind_ofdpa_pdu_port_s
+{
+  bighash_entry_t      hash_entry;
+  of_port_no_t         port_no;
+  ind_ofdpa_pdu_slot_t tx[IND_OFDPA_PDU_SLOTS];
+  ind_ofdpa_pdu_slot_t rx[IND_OFDPA_PDU_SLOTS];
+};
+
+#define TEMPLATE_NAME ind_ofdpa_pdu_port_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_pdu_port_t
+#define TEMPLATE_KEY_FIELD port_no
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static bighash_table_t *ind_ofdpa_pdu_port_table = NULL;
+
+static struct
+{
+  bool     running;
+  int      rx_slots;       /* Programmed rx slots; 0 skips the receive lookup */
+  uint64_t tx_sent;
+  uint64_t tx_errors;
+  uint64_t rx_matched;
+  uint64_t rx_changed;
+  uint64_t rx_timeouts;
+} ind_ofdpa_pdu_stats;
+
+static ind_ofdpa_pdu_port_t *ind_ofdpa_pdu_port_find(of_port_no_t port_no)
+{
+  if (ind_ofdpa_pdu_port_table == NULL)
+  {
+    return NULL;
+  }
+  return ind_ofdpa_pdu_port_hashtable_first(ind_ofdpa_pdu_port_table, &port_no);
+}
+
+static ind_ofdpa_pdu_port_t *ind_ofdpa_pdu_port_get(of_port_no_t port_no)
+{
+  ind_ofdpa_pdu_port_t *port = ind_ofdpa_pdu_port_find(port_no);
+  int i;
+
+  if (port == NULL)
+  {
+    port = aim_zmalloc(sizeof(*port));
+    port->port_no = port_no;
+    for (i = 0; i < IND_OFDPA_PDU_SLOTS; i++)
+    {
+      port->tx[i].port = port;
+      port->tx[i].slot_num = i;
+      port->rx[i].port = port;
+      port->rx[i].slot_num = i;
+    }
+    ind_ofdpa_pdu_port_hashtable_insert(ind_ofdpa_pdu_port_table, port);
+  }
+
+  return port;
+}
+
+static void ind_ofdpa_pdu_tx_timer(void *cookie)
+{
+  ind_ofdpa_pdu_slot_t *slot = cookie;
+
+  if (indigo_port_packet_emit(slot->port->port_no, 0, slot->data, slot->len) != INDIGO_ERROR_NONE)
+  {
+    ind_ofdpa_pdu_stats.tx_errors++;
+    return;
+  }
+  ind_ofdpa_pdu_stats.tx_sent++;
+}
+
+static void ind_ofdpa_pdu_rx_timer(void *cookie)
+{
+  ind_ofdpa_pdu_slot_t *slot = cookie;
+  of_bsn_pdu_rx_timeout_t *msg;
+
+  /* Report once; the next matching frame rearms the timer */
+  ind_soc_timer_event_unregister(ind_ofdpa_pdu_rx_timer, slot);
+  slot->timed_out = true;
+  ind_ofdpa_pdu_stats.rx_timeouts++;
+
+  msg = of_bsn_pdu_rx_timeout_new(ofagent_of_version);
+  if (msg == NULL)
+  {
+    LOG_ERROR("Failed to allocate PDU rx timeout");
+    return;
+  }
+  of_bsn_pdu_rx_timeout_port_no_set(msg, slot->port->port_no);
+  of_bsn_pdu_rx_timeout_slot_num_set(msg, slot->slot_num);
+  indigo_cxn_send_async_message(msg);
+}
+
+static void ind_ofdpa_pdu_slot_clear(ind_ofdpa_pdu_slot_t *slot, ind_soc_timer_callback_f timer)
+{
+  if (slot->data == NULL)
+  {
+    return;
+  }
+
+  ind_soc_timer_event_unregister(timer, slot);
+  aim_free(slot->data);
+  slot->data = NULL;
+  slot->len = 0;
+  slot->ms = 0;
+  slot->timed_out = false;
+}
+
+/* A zero interval or empty frame clears the slot */
+static indigo_error_t ind_ofdpa_pdu_slot_set(ind_ofdpa_pdu_slot_t *slot, ind_soc_timer_callback_f timer,
+                                             uint32_t ms, of_octets_t *data)
+{
+  ind_ofdpa_pdu_slot_clear(slot, timer);
+  if (ms == 0 || data->bytes == 0)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  slot->data = aim_memdup(data->data, data->bytes);
+  slot->len = data->bytes;
+  slot->ms = ms;
+
+  if (ind_soc_timer_event_register(timer, slot, ms) < 0)
+  {
+    LOG_ERROR("Failed to register PDU timer for port %u slot %u",
+              slot->port->port_no, slot->slot_num);
+    aim_free(slot->data);
+    slot->data = NULL;
+    slot->len = 0;
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_pdu_tx_request(indigo_cxn_id_t cxn_id, of_bsn_pdu_tx_request_t *req)
+{
+  of_bsn_pdu_tx_reply_t *reply;
+  ind_ofdpa_pdu_port_t *port;
+  of_port_no_t port_no;
+  uint32_t xid, interval_ms;
+  uint8_t slot_num;
+  of_octets_t data;
+  uint32_t status = 1;
+
+  of_bsn_pdu_tx_request_xid_get(req, &xid);
+  of_bsn_pdu_tx_request_tx_interval_ms_get(req, &interval_ms);
+  of_bsn_pdu_tx_request_port_no_get(req, &port_no);
+  of_bsn_pdu_tx_request_slot_num_get(req, &slot_num);
+  of_bsn_pdu_tx_request_data_get(req, &data);
+
+  if (slot_num < IND_OFDPA_PDU_SLOTS)
+  {
+    port = ind_ofdpa_pdu_port_get(port_no);
+    if (ind_ofdpa_pdu_slot_set(&port->tx[slot_num], ind_ofdpa_pdu_tx_timer,
+                               interval_ms, &data) == INDIGO_ERROR_NONE)
+    {
+      status = 0;
+      /* Send the first PDU now rather than an interval from now */
+      if (port->tx[slot_num].data != NULL)
+      {
+        ind_ofdpa_pdu_tx_timer(&port->tx[slot_num]);
+      }
+    }
+  }
+  else
+  {
+    LOG_ERROR("PDU tx slot %u out of range for port %u", slot_num, port_no);
+  }
+
+  reply = of_bsn_pdu_tx_reply_new(req->version);
+  if (reply == NULL)
+  {
+    LOG_ERROR("Failed to allocate PDU tx reply");
+    return;
+  }
+  of_bsn_pdu_tx_reply_xid_set(reply, xid);
+  of_bsn_pdu_tx_reply_status_set(reply, status);
+  of_bsn_pdu_tx_reply_port_no_set(reply, port_no);
+  of_bsn_pdu_tx_reply_slot_num_set(reply, slot_num);
+  indigo_cxn_send_controller_message(cxn_id, reply);
+}
+
+static void ind_ofdpa_pdu_rx_request(indigo_cxn_id_t cxn_id, of_bsn_pdu_rx_request_t *req)
+{
+  of_bsn_pdu_rx_reply_t *reply;
+  ind_ofdpa_pdu_port_t *port;
+  ind_ofdpa_pdu_slot_t *slot;
+  of_port_no_t port_no;
+  uint32_t xid, timeout_ms;
+  uint8_t slot_num;
+  of_octets_t data;
+  uint32_t status = 1;
+
+  of_bsn_pdu_rx_request_xid_get(req, &xid);
+  of_bsn_pdu_rx_request_timeout_ms_get(req, &timeout_ms);
+  of_bsn_pdu_rx_request_port_no_get(req, &port_no);
+  of_bsn_pdu_rx_request_slot_num_get(req, &slot_num);
+  of_bsn_pdu_rx_request_data_get(req, &data);
+
+  if (slot_num < IND_OFDPA_PDU_SLOTS)
+  {
+    port = ind_ofdpa_pdu_port_get(port_no);
+    slot = &port->rx[slot_num];
+    if (slot->data != NULL)
+    {
+      ind_ofdpa_pdu_stats.rx_slots--;
+    }
+    if (ind_ofdpa_pdu_slot_set(slot, ind_ofdpa_pdu_rx_timer, timeout_ms, &data) == INDIGO_ERROR_NONE)
+    {
+      status = 0;
+    }
+    if (slot->data != NULL)
+    {
+      ind_ofdpa_pdu_stats.rx_slots++;
+    }
+  }
+  else
+  {
+    LOG_ERROR("PDU rx slot %u out of range for port %u", slot_num, port_no);
+  }
+
+  reply = of_bsn_pdu_rx_reply_new(req->version);
+  if (reply == NULL)
+  {
+    LOG_ERROR("Failed to allocate PDU rx reply");
+    return;
+  }
+  of_bsn_pdu_rx_reply_xid_set(reply, xid);
+  of_bsn_pdu_rx_reply_status_set(reply, status);
+  of_bsn_pdu_rx_reply_port_no_set(reply, port_no);
+  of_bsn_pdu_rx_reply_slot_num_set(reply, slot_num);
+  indigo_cxn_send_controller_message(cxn_id, reply);
+}
+
+/* The only messages the listener takes */
+static const of_object_id_t ind_ofdpa_pdu_message_ids[] =
+{
+  OF_BSN_PDU_TX_REQUEST,
+  OF_BSN_PDU_RX_REQUEST,
+};
+
+static indigo_core_listener_result_t ind_ofdpa_pdu_message_listener(indigo_cxn_id_t cxn_id, of_object_t *msg)
+{
+  switch (msg->object_id)
+  {
+    case OF_BSN_PDU_TX_REQUEST:
+      ind_ofdpa_pdu_tx_request(cxn_id, msg);
+      return INDIGO_CORE_LISTENER_RESULT_DROP;
+    case OF_BSN_PDU_RX_REQUEST:
+      ind_ofdpa_pdu_rx_request(cxn_id, msg);
+      return INDIGO_CORE_LISTENER_RESULT_DROP;
+    default:
+      return INDIGO_CORE_LISTENER_RESULT_PASS;
+  }
+}
+
+int ind_ofdpa_pdu_receive(uint32_t portNum, uint8_t *data, unsigned int len)
+{
+  ind_ofdpa_pdu_port_t *port;
+  ind_ofdpa_pdu_slot_t *slot;
+  bool changed = false;
+  int i;
+
+  if (ind_ofdpa_pdu_stats.rx_slots == 0 ||
+      (port = ind_ofdpa_pdu_port_find(portNum)) == NULL)
+  {
+    return 0;
+  }
+
+  for (i = 0; i < IND_OFDPA_PDU_SLOTS; i++)
+  {
+    slot = &port->rx[i];
+    if (slot->data == NULL)
+    {
+      continue;
+    }
+
+    if (slot->len == len && !memcmp(slot->data, data, len))
+    {
+      /* Rearm the timeout; after a timeout the controller hears the peer again */
+      ind_soc_timer_event_register(ind_ofdpa_pdu_rx_timer, slot, slot->ms);
+      if (slot->timed_out)
+      {
+        slot->timed_out = false;
+        ind_ofdpa_pdu_stats.rx_changed++;
+        return 0;
+      }
+      ind_ofdpa_pdu_stats.rx_matched++;
+      return 1;
+    }
+
+    /* Same protocol, different content: the peer's state changed */
+    if (!changed && slot->len >= 14 && len >= 14 && !memcmp(slot->data + 12, data + 12, 2))
+    {
+      changed = true;
+    }
+  }
+
+  if (changed)
+  {
+    ind_ofdpa_pdu_stats.rx_changed++;
+  }
+  return 0;
+}
+
+indigo_error_t ind_ofdpa_pdu_offload_start(void)
+{
+  if (ind_ofdpa_pdu_stats.running)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  if (ind_ofdpa_pdu_port_table == NULL)
+  {
+    ind_ofdpa_pdu_port_table = bighash_table_create(IND_OFDPA_PDU_PORT_BUCKETS);
+    AIM_TRUE_OR_DIE(ind_ofdpa_pdu_port_table != NULL);
+  }
+
+  if (indigo_core_message_listener_register_with_filter(ind_ofdpa_pdu_message_listener,
+                                                       ind_ofdpa_pdu_message_ids,
+                                                       AIM_ARRAYSIZE(ind_ofdpa_pdu_message_ids),
+                                                       INDIGO_CORE_LISTENER_PRIORITY_DEFAULT) < 0)
+  {
+    LOG_ERROR("Failed to register PDU offload message listener");
+    return INDIGO_ERROR_UNKNOWN;
+  }
+  ind_ofdpa_pdu_stats.running = true;
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_pdu_offload_stop(void)
+{
+  ind_ofdpa_pdu_port_t *port;
+  bighash_iter_t iter;
+  int i;
+
+  if (!ind_ofdpa_pdu_stats.running)
+  {
+    return;
+  }
+
+  indigo_core_message_listener_unregister(ind_ofdpa_pdu_message_listener);
+
+  /* The controller falls back to packet-in and packet-out */
+  for (port = bighash_iter_start(ind_ofdpa_pdu_port_table, &iter);
+       port != NULL;
+       port = bighash_iter_next(&iter))
+  {
+    for (i = 0; i < IND_OFDPA_PDU_SLOTS; i++)
+    {
+      ind_ofdpa_pdu_slot_clear(&port->tx[i], ind_ofdpa_pdu_tx_timer);
+      ind_ofdpa_pdu_slot_clear(&port->rx[i], ind_ofdpa_pdu_rx_timer);
+    }
+    bighash_remove(ind_ofdpa_pdu_port_table, &port->hash_entry);
+    aim_free(port);
+  }
+  ind_ofdpa_pdu_stats.rx_slots = 0;
+  ind_ofdpa_pdu_stats.running = false;
+}
+
+void ind_ofdpa_pdu_offload_show(aim_pvs_t *pvs)
+{
+  ind_ofdpa_pdu_port_t *port;
+  ind_ofdpa_pdu_slot_t *slot;
+  bighash_iter_t iter;
+  int i;
+
+  if (!ind_ofdpa_pdu_stats.running)
+  {
+    aim_printf(pvs, "PDU offload off\n");
+    return;
+  }
+
+  aim_printf(pvs, "PDU offload on, %d rx slots\n", ind_ofdpa_pdu_stats.rx_slots);
+  aim_printf(pvs, "  tx %"PRIu64" tx errors %"PRIu64" rx matched %"PRIu64" rx changed %"PRIu64" rx timeouts %"PRIu64"\n",
+             ind_ofdpa_pdu_stats.tx_sent, ind_ofdpa_pdu_stats.tx_errors,
+             ind_ofdpa_pdu_stats.rx_matched, ind_ofdpa_pdu_stats.rx_changed,
+             ind_ofdpa_pdu_stats.rx_timeouts);
+
+  for (port = bighash_iter_start(ind_ofdpa_pdu_port_table, &iter);
+       port != NULL;
+       port = bighash_iter_next(&iter))
+  {
+    for (i = 0; i < IND_OFDPA_PDU_SLOTS; i++)
+    {
+      slot = &port->tx[i];
+      if (slot->data != NULL)
+      {
+        aim_printf(pvs, "port %u slot %d tx every %u ms, %u bytes\n",
+                   port->port_no, i, slot->ms, slot->len);
+      }
+      slot = &port->rx[i];
+      if (slot->data != NULL)
+      {
+        aim_printf(pvs, "port %u slot %d rx timeout %u ms, %u bytes%s\n",
+                   port->port_no, i, slot->ms, slot->len,
+                   slot->timed_out ? ", timed out" : "");
+      }
+    }
+  }
+}
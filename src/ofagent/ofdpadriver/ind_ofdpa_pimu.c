@@ -0,0 +1,430 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_pimu.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim.h>
+#include <Configuration/configuration.h>
+#include <pimu/pimu.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+/*
+ * Per-port packet-in fairness
+ *
+ * Every punted frame goes through a PIMU before anything is allocated or
+ * encoded for it, so one port with a looped or misbehaving host cannot
+ * use up the punt budget of the others. There is a PIMU per punt reason
+ * (table miss, controller action, anything else), and in each a PIMU
+ * group per ingress port carries that port's quota. LLDP and slow
+ * protocol frames are prioritized and never dropped here.
+ *
+ * Ports get a group when they first punt, up to PIMU_CONFIG_GROUP_COUNT;
+ * frames from ports past that are only subject to the flow limit.
+ *
+ * The quotas come from the "pktin_meter" section of the configuration:
+ *     "pktin_meter": {
+ *         "port_pps": 200, "port_burst": 100,
+ *         "flow_pps": 0,
+ *         "ports": { "<port>": { "pps": 1000, "burst": 200 }, ... }
+ *     }
+ * port_pps and port_burst apply to every port not listed in ports, and
+ * flow_pps limits each distinct frame from a port. Metering is off
+ * while every rate is 0.
+ */
+#define IND_OFDPA_PIMU_SECTION       "pktin_meter"
+#define IND_OFDPA_PIMU_OVERRIDES_MAX 64
+#define IND_OFDPA_PIMU_PORT_MAP      1024   /* Ports below are found directly */
+#define IND_OFDPA_PIMU_CACHE_BLOCK   8
+#define IND_OFDPA_PIMU_CACHE_ENTRIES 4096
+
+#define IND_OFDPA_ETHERTYPE_LLDP     0x88cc
+#define IND_OFDPA_ETHERTYPE_SLOW     0x8809
+
+enum
+{
+  IND_OFDPA_PIMU_REASON_MISS,
+  IND_OFDPA_PIMU_REASON_ACTION,
+  IND_OFDPA_PIMU_REASON_OTHER,
+  IND_OFDPA_PIMU_REASON_COUNT,
+};
+
+static const char *ind_ofdpa_pimu_reason_names[IND_OFDPA_PIMU_REASON_COUNT] =
+{
+  "miss", "action", "other",
+};
+
+typedef struct ind_ofdpa_pimu_quota_s
+{
+  uint32_t port;
+  uint32_t pps;
+  uint32_t burst;
+} ind_ofdpa_pimu_quota_t;
+
+typedef struct ind_ofdpa_pimu_config_s
+{
+  uint32_t               port_pps;
+  uint32_t               port_burst;
+  uint32_t               flow_pps;
+  int                    override_count;
+  ind_ofdpa_pimu_quota_t overrides[IND_OFDPA_PIMU_OVERRIDES_MAX];
+} ind_ofdpa_pimu_config_t;
+
+typedef struct ind_ofdpa_pimu_slot_s
+{
+  uint32_t port;
+  uint64_t packets[IND_OFDPA_PIMU_REASON_COUNT];
+  uint64_t drops[IND_OFDPA_PIMU_REASON_COUNT];
+} ind_ofdpa_pimu_slot_t;
+
+static ind_ofdpa_pimu_config_t ind_ofdpa_pimu_staged;
+
+static struct
+{
+  ind_ofdpa_pimu_config_t config;
+  pimu_t                  *pimu[IND_OFDPA_PIMU_REASON_COUNT]; /* NULL while off */
+  ind_ofdpa_pimu_slot_t   slots[PIMU_CONFIG_GROUP_COUNT];
+  int                     slot_count;
+  int16_t                 port_map[IND_OFDPA_PIMU_PORT_MAP];  /* Slot + 1, or 0 */
+  uint64_t                unslotted;  /* Frames from ports without a group */
+} ind_ofdpa_pimu;
+
+static void ind_ofdpa_pimu_group_set(int slot)
+{
+  const ind_ofdpa_pimu_config_t *config = &ind_ofdpa_pimu.config;
+  uint32_t pps = config->port_pps;
+  uint32_t burst = config->port_burst;
+  int i;
+
+  for (i = 0; i < config->override_count; i++)
+  {
+    if (config->overrides[i].port == ind_ofdpa_pimu.slots[slot].port)
+    {
+      pps = config->overrides[i].pps;
+      burst = config->overrides[i].burst;
+      break;
+    }
+  }
+
+  for (i = 0; i < IND_OFDPA_PIMU_REASON_COUNT; i++)
+  {
+    pimu_group_pps_set(ind_ofdpa_pimu.pimu[i], slot, pps, burst);
+  }
+}
+
+/* The port's group, assigning one on its first frame; -1 if none are left */
+static int ind_ofdpa_pimu_slot_get(uint32_t port)
+{
+  int slot;
+
+  if (port < IND_OFDPA_PIMU_PORT_MAP)
+  {
+    if (ind_ofdpa_pimu.port_map[port] != 0)
+    {
+      return ind_ofdpa_pimu.port_map[port] - 1;
+    }
+  }
+  else
+  {
+    for (slot = 0; slot < ind_ofdpa_pimu.slot_count; slot++)
+    {
+      if (ind_ofdpa_pimu.slots[slot].port == port)
+      {
+        return slot;
+      }
+    }
+  }
+
+  if (ind_ofdpa_pimu.slot_count == PIMU_CONFIG_GROUP_COUNT)
+  {
+    return -1;
+  }
+
+  slot = ind_ofdpa_pimu.slot_count++;
+  memset(&ind_ofdpa_pimu.slots[slot], 0, sizeof(ind_ofdpa_pimu.slots[slot]));
+  ind_ofdpa_pimu.slots[slot].port = port;
+  if (port < IND_OFDPA_PIMU_PORT_MAP)
+  {
+    ind_ofdpa_pimu.port_map[port] = slot + 1;
+  }
+  ind_ofdpa_pimu_group_set(slot);
+
+  return slot;
+}
+
+/*
+ * Meter a punted frame. Returns 1 if it is to be dropped, before anything
+ * else is done with it.
+ */
+int ind_ofdpa_pimu_check(const ofdpaPacket_t *rxPkt, uint8_t *data, unsigned int len)
+{
+  int reason, slot;
+  pimu_action_t action;
+
+  if (ind_ofdpa_pimu.pimu[0] == NULL)
+  {
+    return 0;
+  }
+
+  switch (rxPkt->reason)
+  {
+    case OFDPA_PACKET_IN_REASON_NO_MATCH:
+      reason = IND_OFDPA_PIMU_REASON_MISS;
+      break;
+    case OFDPA_PACKET_IN_REASON_ACTION:
+      reason = IND_OFDPA_PIMU_REASON_ACTION;
+      break;
+    default:
+      reason = IND_OFDPA_PIMU_REASON_OTHER;
+      break;
+  }
+
+  slot = ind_ofdpa_pimu_slot_get(rxPkt->inPortNum);
+  if (slot < 0)
+  {
+    ind_ofdpa_pimu.unslotted++;
+  }
+
+  /* The rate limiters count in microseconds */
+  action = pimu_packet_in(ind_ofdpa_pimu.pimu[reason], rxPkt->inPortNum, slot,
+                          data, len, ind_ofdpa_rpc_now_ns() / 1000);
+
+  if (slot >= 0)
+  {
+    ind_ofdpa_pimu.slots[slot].packets[reason]++;
+    if (action == PIMU_ACTION_DROP)
+    {
+      ind_ofdpa_pimu.slots[slot].drops[reason]++;
+    }
+  }
+
+  return action == PIMU_ACTION_DROP;
+}
+
+static void ind_ofdpa_pimu_apply(void)
+{
+  int i, slot;
+  bool enabled = (ind_ofdpa_pimu.config.port_pps != 0 ||
+                  ind_ofdpa_pimu.config.flow_pps != 0 ||
+                  ind_ofdpa_pimu.config.override_count != 0);
+
+  if (!enabled)
+  {
+    for (i = 0; i < IND_OFDPA_PIMU_REASON_COUNT; i++)
+    {
+      if (ind_ofdpa_pimu.pimu[i] != NULL)
+      {
+        pimu_destroy(ind_ofdpa_pimu.pimu[i]);
+        ind_ofdpa_pimu.pimu[i] = NULL;
+      }
+    }
+    return;
+  }
+
+  for (i = 0; i < IND_OFDPA_PIMU_REASON_COUNT; i++)
+  {
+    if (ind_ofdpa_pimu.pimu[i] == NULL)
+    {
+      ind_ofdpa_pimu.pimu[i] = pimu_create(IND_OFDPA_PIMU_CACHE_BLOCK,
+                                           IND_OFDPA_PIMU_CACHE_ENTRIES);
+      pimu_prio_ether_type_add(ind_ofdpa_pimu.pimu[i], IND_OFDPA_ETHERTYPE_LLDP);
+      pimu_prio_ether_type_add(ind_ofdpa_pimu.pimu[i], IND_OFDPA_ETHERTYPE_SLOW);
+    }
+    pimu_flow_pps_set(ind_ofdpa_pimu.pimu[i], ind_ofdpa_pimu.config.flow_pps);
+    pimu_cache_clear(ind_ofdpa_pimu.pimu[i]);
+  }
+
+  for (slot = 0; slot < ind_ofdpa_pimu.slot_count; slot++)
+  {
+    ind_ofdpa_pimu_group_set(slot);
+  }
+}
+
+static indigo_error_t ind_ofdpa_pimu_parse_rate(cJSON *root, const char *path,
+                                                uint32_t *result)
+{
+  indigo_error_t err;
+  int value;
+
+  err = ind_cfg_lookup_int(root, path, &value);
+  if (err == INDIGO_ERROR_NOT_FOUND)
+  {
+    *result = 0;
+    return INDIGO_ERROR_NONE;
+  }
+  if (err != INDIGO_ERROR_NONE || value < 0)
+  {
+    LOG_ERROR("Config: %s must be a number of at least 0", path);
+    return INDIGO_ERROR_PARAM;
+  }
+
+  *result = value;
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_pimu_cfg_stage(cJSON *config)
+{
+  ind_ofdpa_pimu_config_t *staged = &ind_ofdpa_pimu_staged;
+  ind_ofdpa_pimu_quota_t *quota;
+  cJSON *section, *ports, *node;
+  indigo_error_t err;
+  char *end;
+
+  memset(staged, 0, sizeof(*staged));
+
+  if (ind_cfg_lookup(config, IND_OFDPA_PIMU_SECTION, &section) != INDIGO_ERROR_NONE)
+  {
+    /* Metering off */
+    return INDIGO_ERROR_NONE;
+  }
+
+  if ((err = ind_ofdpa_pimu_parse_rate(section, "port_pps", &staged->port_pps)) < 0 ||
+      (err = ind_ofdpa_pimu_parse_rate(section, "port_burst", &staged->port_burst)) < 0 ||
+      (err = ind_ofdpa_pimu_parse_rate(section, "flow_pps", &staged->flow_pps)) < 0)
+  {
+    return err;
+  }
+
+  if (ind_cfg_lookup(section, "ports", &ports) != INDIGO_ERROR_NONE)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+  if (ports->type != cJSON_Object)
+  {
+    LOG_ERROR("Config: " IND_OFDPA_PIMU_SECTION ".ports must be an object");
+    return INDIGO_ERROR_PARAM;
+  }
+
+  for (node = ports->child; node != NULL; node = node->next)
+  {
+    if (staged->override_count == IND_OFDPA_PIMU_OVERRIDES_MAX)
+    {
+      LOG_ERROR("Config: at most %d ports in " IND_OFDPA_PIMU_SECTION ".ports",
+                    IND_OFDPA_PIMU_OVERRIDES_MAX);
+      return INDIGO_ERROR_PARAM;
+    }
+    quota = &staged->overrides[staged->override_count];
+
+    quota->port = strtoul(node->string, &end, 0);
+    if (*node->string == '\0' || *end != '\0')
+    {
+      LOG_ERROR("Config: invalid port \"%s\" in " IND_OFDPA_PIMU_SECTION ".ports",
+                    node->string);
+      return INDIGO_ERROR_PARAM;
+    }
+
+    if ((err = ind_ofdpa_pimu_parse_rate(node, "pps", &quota->pps)) < 0 ||
+        (err = ind_ofdpa_pimu_parse_rate(node, "burst", &quota->burst)) < 0)
+    {
+      return err;
+    }
+    staged->override_count++;
+  }
+
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_pimu_cfg_commit(void)
+{
+  ind_ofdpa_pimu.config = ind_ofdpa_pimu_staged;
+  ind_ofdpa_pimu_apply();
+}
+
+static const char * const ind_ofdpa_pimu_cfg_paths[] = {
+  IND_OFDPA_PIMU_SECTION,
+  NULL
+};
+
+static const struct ind_cfg_ops ind_ofdpa_pimu_cfg_ops = {
+  .stage = ind_ofdpa_pimu_cfg_stage,
+  .commit = ind_ofdpa_pimu_cfg_commit,
+  .paths = ind_ofdpa_pimu_cfg_paths,
+};
+
+void ind_ofdpa_pimu_init(void)
+{
+  ind_cfg_register(&ind_ofdpa_pimu_cfg_ops);
+}
+
+void ind_ofdpa_pimu_clear(void)
+{
+  int slot;
+
+  for (slot = 0; slot < ind_ofdpa_pimu.slot_count; slot++)
+  {
+    memset(ind_ofdpa_pimu.slots[slot].packets, 0, sizeof(ind_ofdpa_pimu.slots[slot].packets));
+    memset(ind_ofdpa_pimu.slots[slot].drops, 0, sizeof(ind_ofdpa_pimu.slots[slot].drops));
+  }
+  ind_ofdpa_pimu.unslotted = 0;
+}
+
+void ind_ofdpa_pimu_show(aim_pvs_t *pvs)
+{
+  const ind_ofdpa_pimu_config_t *config = &ind_ofdpa_pimu.config;
+  ind_ofdpa_pimu_slot_t *s;
+  int slot, i;
+
+  if (ind_ofdpa_pimu.pimu[0] == NULL)
+  {
+    aim_printf(pvs, "Packet-in metering off\n");
+    return;
+  }
+
+  aim_printf(pvs, "Packet-in metering: port %u pps burst %u, flow %u pps, "
+             "%d port overrides, %d/%d ports grouped\n",
+             config->port_pps, config->port_burst, config->flow_pps,
+             config->override_count, ind_ofdpa_pimu.slot_count, PIMU_CONFIG_GROUP_COUNT);
+  if (ind_ofdpa_pimu.unslotted != 0)
+  {
+    aim_printf(pvs, "  %"PRIu64" frames from ports without a group\n",
+               ind_ofdpa_pimu.unslotted);
+  }
+
+  aim_printf(pvs, "  %-10s", "port");
+  for (i = 0; i < IND_OFDPA_PIMU_REASON_COUNT; i++)
+  {
+    aim_printf(pvs, " %12s %12s", ind_ofdpa_pimu_reason_names[i], "dropped");
+  }
+  aim_printf(pvs, "\n");
+
+  for (slot = 0; slot < ind_ofdpa_pimu.slot_count; slot++)
+  {
+    s = &ind_ofdpa_pimu.slots[slot];
+    aim_printf(pvs, "  %-10u", s->port);
+    for (i = 0; i < IND_OFDPA_PIMU_REASON_COUNT; i++)
+    {
+      aim_printf(pvs, " %12"PRIu64" %12"PRIu64, s->packets[i], s->drops[i]);
+    }
+    aim_printf(pvs, "\n");
+  }
+}
@@ -0,0 +1,246 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_pktbuf.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include "indigo/time.h"
+#include <AIM/aim.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+/*
+ * Packet-in buffers
+ *
+ * When enabled, each punted frame is copied into one of a fixed number of
+ * slots and the packet_in carries the slot's buffer_id and only the first
+ * miss_send_len bytes. A packet_out naming the buffer_id sends the stored
+ * frame. Slots are reused round robin, so the oldest frame is evicted
+ * when all are in use, and a frame older than the timeout is not sent.
+ *
+ * The buffer_id is the slot index with a generation in the upper 16 bits,
+ * so an id whose slot has since been reused misses instead of sending a
+ * different frame.
+ *
+ * Everything runs on the main loop, so no locking is done.
+ */
+#define IND_OFDPA_PKTBUF_COUNT_MAX       0x8000
+#define IND_OFDPA_PKTBUF_TIMEOUT_DEFAULT 5000
+
+typedef struct ind_ofdpa_pktbuf_s
+{
+  uint32_t      buffer_id;  /* OF_BUFFER_ID_NO_BUFFER when free */
+  indigo_time_t stored;
+  uint32_t      in_port;
+  uint32_t      len;
+  uint32_t      size;       /* Bytes allocated at data */
+  uint8_t      *data;
+} ind_ofdpa_pktbuf_t;
+
+static struct
+{
+  ind_ofdpa_pktbuf_t *slots;
+  uint32_t            count;     /* 0 when buffering is off */
+  uint32_t            next;      /* Next slot to fill */
+  uint16_t            generation;
+  int                 timeout_ms;
+  uint64_t            stored;
+  uint64_t            hits;
+  uint64_t            misses;
+  uint64_t            expired;
+  uint64_t            evicted;
+} ind_ofdpa_pktbuf = { .timeout_ms = IND_OFDPA_PKTBUF_TIMEOUT_DEFAULT };
+
+static void ind_ofdpa_pktbuf_free(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < ind_ofdpa_pktbuf.count; i++)
+  {
+    aim_free(ind_ofdpa_pktbuf.slots[i].data);
+  }
+  aim_free(ind_ofdpa_pktbuf.slots);
+  ind_ofdpa_pktbuf.slots = NULL;
+  ind_ofdpa_pktbuf.count = 0;
+}
+
+/**
+ * Set the number of packet-in buffers and how long a frame is kept
+ *
+ * @param count Number of buffers; 0 turns buffering off
+ * @param timeout_ms Age after which a frame is not sent; 0 keeps the current
+ */
+indigo_error_t ind_ofdpa_pktbuf_config(uint32_t count, int timeout_ms)
+{
+  uint32_t i;
+
+  if (count > IND_OFDPA_PKTBUF_COUNT_MAX || timeout_ms < 0)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  if (timeout_ms > 0)
+  {
+    ind_ofdpa_pktbuf.timeout_ms = timeout_ms;
+  }
+
+  if (count == ind_ofdpa_pktbuf.count)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  ind_ofdpa_pktbuf_free();
+  if (count == 0)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  ind_ofdpa_pktbuf.slots = aim_zmalloc(count * sizeof(ind_ofdpa_pktbuf_t));
+  for (i = 0; i < count; i++)
+  {
+    ind_ofdpa_pktbuf.slots[i].buffer_id = OF_BUFFER_ID_NO_BUFFER;
+  }
+  ind_ofdpa_pktbuf.count = count;
+  ind_ofdpa_pktbuf.next = 0;
+  ind_ofdpa_pktbuf.generation++;
+
+  return INDIGO_ERROR_NONE;
+}
+
+int ind_ofdpa_pktbuf_enabled(void)
+{
+  return ind_ofdpa_pktbuf.count != 0;
+}
+
+/**
+ * Store a punted frame
+ *
+ * @returns The buffer_id for the packet_in, or OF_BUFFER_ID_NO_BUFFER if
+ * the frame was not stored
+ */
+uint32_t ind_ofdpa_pktbuf_store(uint32_t in_port, const uint8_t *data, uint32_t len)
+{
+  ind_ofdpa_pktbuf_t *slot;
+  uint32_t index;
+
+  if (ind_ofdpa_pktbuf.count == 0)
+  {
+    return OF_BUFFER_ID_NO_BUFFER;
+  }
+
+  index = ind_ofdpa_pktbuf.next;
+  slot = &ind_ofdpa_pktbuf.slots[index];
+  if (++ind_ofdpa_pktbuf.next == ind_ofdpa_pktbuf.count)
+  {
+    ind_ofdpa_pktbuf.next = 0;
+    ind_ofdpa_pktbuf.generation++;
+  }
+
+  if (slot->buffer_id != OF_BUFFER_ID_NO_BUFFER)
+  {
+    if (INDIGO_TIME_DIFF_ms(slot->stored, INDIGO_CURRENT_TIME) > ind_ofdpa_pktbuf.timeout_ms)
+    {
+      ind_ofdpa_pktbuf.expired++;
+    }
+    else
+    {
+      ind_ofdpa_pktbuf.evicted++;
+    }
+  }
+
+  /* Slots grow to the largest frame they have held */
+  if (slot->size < len)
+  {
+    aim_free(slot->data);
+    slot->data = aim_malloc(len);
+    slot->size = len;
+  }
+  memcpy(slot->data, data, len);
+  slot->len = len;
+  slot->in_port = in_port;
+  slot->stored = INDIGO_CURRENT_TIME;
+  slot->buffer_id = ((uint32_t)ind_ofdpa_pktbuf.generation << 16) | index;
+  ind_ofdpa_pktbuf.stored++;
+
+  return slot->buffer_id;
+}
+
+/**
+ * Take the frame stored under a buffer_id
+ *
+ * The buffer is released; the frame stays valid until the next store.
+ *
+ * @returns 1 if the frame was found and not too old
+ */
+int ind_ofdpa_pktbuf_take(uint32_t buffer_id, uint8_t **data, uint32_t *len, uint32_t *in_port)
+{
+  ind_ofdpa_pktbuf_t *slot;
+  uint32_t index = buffer_id & 0xffff;
+
+  if (index >= ind_ofdpa_pktbuf.count ||
+      ind_ofdpa_pktbuf.slots[index].buffer_id != buffer_id)
+  {
+    ind_ofdpa_pktbuf.misses++;
+    return 0;
+  }
+
+  slot = &ind_ofdpa_pktbuf.slots[index];
+  slot->buffer_id = OF_BUFFER_ID_NO_BUFFER;
+
+  if (INDIGO_TIME_DIFF_ms(slot->stored, INDIGO_CURRENT_TIME) > ind_ofdpa_pktbuf.timeout_ms)
+  {
+    ind_ofdpa_pktbuf.expired++;
+    return 0;
+  }
+
+  ind_ofdpa_pktbuf.hits++;
+  *data = slot->data;
+  *len = slot->len;
+  *in_port = slot->in_port;
+  return 1;
+}
+
+void ind_ofdpa_pktbuf_show(aim_pvs_t *pvs)
+{
+  if (ind_ofdpa_pktbuf.count == 0)
+  {
+    aim_printf(pvs, "Packet-in buffering off\n");
+  }
+  else
+  {
+    aim_printf(pvs, "%u packet-in buffers, timeout %d ms\n",
+               ind_ofdpa_pktbuf.count, ind_ofdpa_pktbuf.timeout_ms);
+  }
+  aim_printf(pvs, "  stored %"PRIu64" hits %"PRIu64" misses %"PRIu64"\n",
+             ind_ofdpa_pktbuf.stored, ind_ofdpa_pktbuf.hits, ind_ofdpa_pktbuf.misses);
+  aim_printf(pvs, "  expired %"PRIu64" evicted %"PRIu64"\n",
+             ind_ofdpa_pktbuf.expired, ind_ofdpa_pktbuf.evicted);
+}
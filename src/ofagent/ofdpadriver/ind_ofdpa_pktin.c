@@ -0,0 +1,522 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_pktin.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "indigo/time.h"
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <OFStateManager/ofstatemanager.h>
+#include <PPE/ppe.h>
+#include <murmur/murmur.h>
+#include <inttypes.h>
+#include <string.h>
+
+/*
+ * Packet-in classifier
+ *
+ * A packet-in listener sorts punted frames into protocol classes and
+ * applies the class policy before the frame goes to the controller:
+ * the class may be handled locally (consumed here), rate limited with
+ * a token bucket, or deduplicated so that repeats of the same flow
+ * within a window are only sent once.
+ *
+ * Headers are located lazily. ARP, LLDP and LACP are told apart from
+ * the Ethernet header alone; the IP and L4 headers are only set in the
+ * PPE packet for IP frames, and the dedup key is only built when the
+ * class has a dedup window. The key includes the in_port, table and
+ * reason, so the same flow missing on another port or in another table
+ * still reaches the controller once.
+ */
+#define IND_OFDPA_PKTIN_DEDUP_SLOTS 4096
+
+#define IND_OFDPA_ETHERTYPE_VLAN   0x8100
+#define IND_OFDPA_ETHERTYPE_QINQ   0x88a8
+#define IND_OFDPA_ETHERTYPE_ARP    0x0806
+#define IND_OFDPA_ETHERTYPE_IP4    0x0800
+#define IND_OFDPA_ETHERTYPE_IP6    0x86dd
+#define IND_OFDPA_ETHERTYPE_LLDP   0x88cc
+#define IND_OFDPA_ETHERTYPE_SLOW   0x8809
+
+#define IND_OFDPA_SLOW_SUBTYPE_LACP 1
+
+#define IND_OFDPA_IP_PROTO_TCP     6
+#define IND_OFDPA_IP_PROTO_UDP     17
+#define IND_OFDPA_IP_PROTO_ICMP6   58
+
+typedef struct ind_ofdpa_pktin_key_s
+{
+  uint8_t  cls;
+  uint8_t  proto;
+  uint16_t ethertype;
+  uint16_t sport;
+  uint16_t dport;
+  uint32_t in_port;
+  uint8_t  table_id;
+  uint8_t  reason;
+  uint8_t  src[16];
+  uint8_t  dst[16];
+} ind_ofdpa_pktin_key_t;
+
+typedef struct ind_ofdpa_pktin_dedup_slot_s
+{
+  ind_ofdpa_pktin_key_t key;
+  indigo_time_t         time;
+  int                   valid;
+} ind_ofdpa_pktin_dedup_slot_t;
+
+typedef struct ind_ofdpa_pktin_class_state_s
+{
+  ind_ofdpa_pktin_policy_t policy;
+  uint64_t      tokens;         /* thousandths of a packet */
+  indigo_time_t refill_time;
+
+  uint64_t      packets;
+  uint64_t      passed;
+  uint64_t      local;
+  uint64_t      rate_drops;
+  uint64_t      dedup_drops;
+} ind_ofdpa_pktin_class_state_t;
+
+static const char *ind_ofdpa_pktin_class_names[IND_OFDPA_PKTIN_CLASS_COUNT] =
+{
+  "arp", "nd", "lldp", "lacp", "dhcp", "bfd", "flow", "other",
+};
+
+/* Defaults keep every class going to the controller, bounding the
+   chatty control protocols and sending each new flow up once per 100ms */
+static const ind_ofdpa_pktin_policy_t ind_ofdpa_pktin_default_policy[IND_OFDPA_PKTIN_CLASS_COUNT] =
+{
+  [IND_OFDPA_PKTIN_CLASS_ARP]   = { .rate_pps = 1000, .burst = 200 },
+  [IND_OFDPA_PKTIN_CLASS_ND]    = { .rate_pps = 1000, .burst = 200 },
+  [IND_OFDPA_PKTIN_CLASS_LLDP]  = { .rate_pps = 200,  .burst = 100 },
+  [IND_OFDPA_PKTIN_CLASS_LACP]  = { .rate_pps = 200,  .burst = 100 },
+  [IND_OFDPA_PKTIN_CLASS_DHCP]  = { .rate_pps = 500,  .burst = 100 },
+  [IND_OFDPA_PKTIN_CLASS_BFD]   = { 0 },
+  [IND_OFDPA_PKTIN_CLASS_FLOW]  = { .dedup_ms = 100 },
+  [IND_OFDPA_PKTIN_CLASS_OTHER] = { 0 },
+};
+
+static ind_ofdpa_pktin_class_state_t ind_ofdpa_pktin_classes[IND_OFDPA_PKTIN_CLASS_COUNT];
+static ind_ofdpa_pktin_dedup_slot_t *ind_ofdpa_pktin_dedup;
+static int ind_ofdpa_pktin_running;
+static int ind_ofdpa_pktin_policy_init;
+
+static uint16_t ind_ofdpa_pktin_get16(const uint8_t *p)
+{
+  return (p[0] << 8) | p[1];
+}
+
+static void ind_ofdpa_pktin_ports_get(ppe_packet_t *ppep, uint8_t *l4, int l4_len,
+                                      ind_ofdpa_pktin_key_t *key)
+{
+  uint32_t port;
+
+  if (l4_len < 4)
+  {
+    return;
+  }
+
+  ppe_header_set(ppep, PPE_HEADER_L4, l4);
+  ppe_field_get(ppep, PPE_FIELD_L4_SRC_PORT, &port);
+  key->sport = port;
+  ppe_field_get(ppep, PPE_FIELD_L4_DST_PORT, &port);
+  key->dport = port;
+}
+
+static ind_ofdpa_pktin_class_t ind_ofdpa_pktin_udp_classify(const ind_ofdpa_pktin_key_t *key)
+{
+  if ((key->sport == 67 || key->sport == 68) && (key->dport == 67 || key->dport == 68))
+  {
+    return IND_OFDPA_PKTIN_CLASS_DHCP;
+  }
+  if ((key->sport == 546 || key->sport == 547) && (key->dport == 546 || key->dport == 547))
+  {
+    return IND_OFDPA_PKTIN_CLASS_DHCP;
+  }
+  /* Single hop, echo and multihop BFD */
+  if (key->dport == 3784 || key->dport == 3785 || key->dport == 4784)
+  {
+    return IND_OFDPA_PKTIN_CLASS_BFD;
+  }
+  return IND_OFDPA_PKTIN_CLASS_FLOW;
+}
+
+static ind_ofdpa_pktin_class_t ind_ofdpa_pktin_ip4_classify(ppe_packet_t *ppep, uint8_t *l3, int len,
+                                                            ind_ofdpa_pktin_key_t *key)
+{
+  uint32_t value;
+  int hlen;
+
+  if (len < 20)
+  {
+    return IND_OFDPA_PKTIN_CLASS_OTHER;
+  }
+
+  ppe_header_set(ppep, PPE_HEADER_IP4, l3);
+  ppe_field_get(ppep, PPE_FIELD_IP4_HEADER_SIZE, &value);
+  hlen = value * 4;
+  if (hlen < 20 || hlen > len)
+  {
+    return IND_OFDPA_PKTIN_CLASS_OTHER;
+  }
+
+  ppe_field_get(ppep, PPE_FIELD_IP4_PROTOCOL, &value);
+  key->proto = value;
+  memcpy(key->src, ppe_fieldp_get(ppep, PPE_FIELD_IP4_SRC_ADDR), 4);
+  memcpy(key->dst, ppe_fieldp_get(ppep, PPE_FIELD_IP4_DST_ADDR), 4);
+
+  /* Later fragments carry no L4 header */
+  if (ind_ofdpa_pktin_get16(l3 + 6) & 0x1fff)
+  {
+    return IND_OFDPA_PKTIN_CLASS_FLOW;
+  }
+
+  if (key->proto == IND_OFDPA_IP_PROTO_UDP)
+  {
+    ind_ofdpa_pktin_ports_get(ppep, l3 + hlen, len - hlen, key);
+    return ind_ofdpa_pktin_udp_classify(key);
+  }
+  if (key->proto == IND_OFDPA_IP_PROTO_TCP)
+  {
+    ind_ofdpa_pktin_ports_get(ppep, l3 + hlen, len - hlen, key);
+  }
+  return IND_OFDPA_PKTIN_CLASS_FLOW;
+}
+
+static ind_ofdpa_pktin_class_t ind_ofdpa_pktin_ip6_classify(ppe_packet_t *ppep, uint8_t *l3, int len,
+                                                            ind_ofdpa_pktin_key_t *key)
+{
+  uint32_t value;
+
+  if (len < 40)
+  {
+    return IND_OFDPA_PKTIN_CLASS_OTHER;
+  }
+
+  ppe_header_set(ppep, PPE_HEADER_IP6, l3);
+  ppe_field_get(ppep, PPE_FIELD_IP6_NEXT_HEADER, &value);
+  key->proto = value;
+  ppe_wide_field_get(ppep, PPE_FIELD_IP6_SRC_ADDR, key->src);
+  ppe_wide_field_get(ppep, PPE_FIELD_IP6_DST_ADDR, key->dst);
+
+  /* Extension headers are not walked; such frames are keyed on addresses only */
+  if (key->proto == IND_OFDPA_IP_PROTO_ICMP6)
+  {
+    if (len < 41)
+    {
+      return IND_OFDPA_PKTIN_CLASS_FLOW;
+    }
+    /* ICMPv6 shares the ICMP type/code layout */
+    ppe_header_set(ppep, PPE_HEADER_ICMP, l3 + 40);
+    ppe_field_get(ppep, PPE_FIELD_ICMP_TYPE, &value);
+    key->sport = value;
+    /* Router and neighbor solicitation/advertisement, redirect */
+    if (value >= 133 && value <= 137)
+    {
+      return IND_OFDPA_PKTIN_CLASS_ND;
+    }
+    return IND_OFDPA_PKTIN_CLASS_FLOW;
+  }
+  if (key->proto == IND_OFDPA_IP_PROTO_UDP)
+  {
+    ind_ofdpa_pktin_ports_get(ppep, l3 + 40, len - 40, key);
+    return ind_ofdpa_pktin_udp_classify(key);
+  }
+  if (key->proto == IND_OFDPA_IP_PROTO_TCP)
+  {
+    ind_ofdpa_pktin_ports_get(ppep, l3 + 40, len - 40, key);
+  }
+  return IND_OFDPA_PKTIN_CLASS_FLOW;
+}
+
+/* Fills in the fields of key that the class needs beyond the ethertype */
+static ind_ofdpa_pktin_class_t ind_ofdpa_pktin_classify(uint8_t *data, int len,
+                                                        ind_ofdpa_pktin_key_t *key)
+{
+  ppe_packet_t ppep;
+  uint16_t ethertype;
+  int offset = 12;
+  int tags = 0;
+
+  if (len < 14)
+  {
+    return IND_OFDPA_PKTIN_CLASS_OTHER;
+  }
+
+  ethertype = ind_ofdpa_pktin_get16(data + offset);
+  while ((ethertype == IND_OFDPA_ETHERTYPE_VLAN || ethertype == IND_OFDPA_ETHERTYPE_QINQ) &&
+         tags < 2 && offset + 6 <= len)
+  {
+    offset += 4;
+    tags++;
+    ethertype = ind_ofdpa_pktin_get16(data + offset);
+  }
+  offset += 2;
+  key->ethertype = ethertype;
+
+  switch (ethertype)
+  {
+    case IND_OFDPA_ETHERTYPE_ARP:
+      return IND_OFDPA_PKTIN_CLASS_ARP;
+    case IND_OFDPA_ETHERTYPE_LLDP:
+      return IND_OFDPA_PKTIN_CLASS_LLDP;
+    case IND_OFDPA_ETHERTYPE_SLOW:
+      if (offset < len && data[offset] == IND_OFDPA_SLOW_SUBTYPE_LACP)
+      {
+        return IND_OFDPA_PKTIN_CLASS_LACP;
+      }
+      return IND_OFDPA_PKTIN_CLASS_OTHER;
+    case IND_OFDPA_ETHERTYPE_IP4:
+      ppe_packet_init(&ppep, data, len);
+      ppe_header_set(&ppep, PPE_HEADER_ETHERNET, data);
+      return ind_ofdpa_pktin_ip4_classify(&ppep, data + offset, len - offset, key);
+    case IND_OFDPA_ETHERTYPE_IP6:
+      ppe_packet_init(&ppep, data, len);
+      ppe_header_set(&ppep, PPE_HEADER_ETHERNET, data);
+      return ind_ofdpa_pktin_ip6_classify(&ppep, data + offset, len - offset, key);
+    default:
+      return IND_OFDPA_PKTIN_CLASS_OTHER;
+  }
+}
+
+static int ind_ofdpa_pktin_rate_allow(ind_ofdpa_pktin_class_state_t *state, indigo_time_t now)
+{
+  uint64_t burst = (state->policy.burst ? state->policy.burst : state->policy.rate_pps) * 1000ULL;
+
+  state->tokens += INDIGO_TIME_DIFF_ms(state->refill_time, now) * (uint64_t)state->policy.rate_pps;
+  state->refill_time = now;
+  if (state->tokens > burst)
+  {
+    state->tokens = burst;
+  }
+
+  if (state->tokens < 1000)
+  {
+    return 0;
+  }
+  state->tokens -= 1000;
+  return 1;
+}
+
+/* Returns 1 if the same key was let through within the window */
+static int ind_ofdpa_pktin_dedup_hit(of_packet_in_t *packet_in,
+                                     uint8_t *data, int len, ind_ofdpa_pktin_class_t cls,
+                                     ind_ofdpa_pktin_key_t *key, uint32_t window_ms,
+                                     indigo_time_t now)
+{
+  ind_ofdpa_pktin_dedup_slot_t *slot;
+  of_match_t match;
+
+  key->cls = cls;
+  of_packet_in_table_id_get(packet_in, &key->table_id);
+  of_packet_in_reason_get(packet_in, &key->reason);
+  if (of_packet_in_match_get(packet_in, &match) == OF_ERROR_NONE)
+  {
+    key->in_port = match.fields.in_port;
+  }
+
+  /* Non-IP classes have no addresses yet; key them on the MACs */
+  if (key->proto == 0 && cls != IND_OFDPA_PKTIN_CLASS_FLOW && len >= 12)
+  {
+    memcpy(key->dst, data, 6);
+    memcpy(key->src, data + 6, 6);
+  }
+
+  slot = &ind_ofdpa_pktin_dedup[murmur_hash(key, sizeof(*key), 0) % IND_OFDPA_PKTIN_DEDUP_SLOTS];
+  if (slot->valid && !memcmp(&slot->key, key, sizeof(*key)) &&
+      INDIGO_TIME_DIFF_ms(slot->time, now) < window_ms)
+  {
+    return 1;
+  }
+
+  slot->key = *key;
+  slot->time = now;
+  slot->valid = 1;
+  return 0;
+}
+
+static indigo_core_listener_result_t ind_ofdpa_pktin_listener(of_packet_in_t *packet_in)
+{
+  ind_ofdpa_pktin_class_state_t *state;
+  ind_ofdpa_pktin_class_t cls;
+  ind_ofdpa_pktin_key_t key;
+  of_octets_t octets;
+  indigo_time_t now;
+
+  of_packet_in_data_get(packet_in, &octets);
+
+  memset(&key, 0, sizeof(key));
+  cls = ind_ofdpa_pktin_classify(octets.data, octets.bytes, &key);
+  state = &ind_ofdpa_pktin_classes[cls];
+  state->packets++;
+
+  if (state->policy.local)
+  {
+    state->local++;
+    return INDIGO_CORE_LISTENER_RESULT_DROP;
+  }
+
+  if (state->policy.rate_pps == 0 && state->policy.dedup_ms == 0)
+  {
+    state->passed++;
+    return INDIGO_CORE_LISTENER_RESULT_PASS;
+  }
+
+  now = INDIGO_CURRENT_TIME;
+
+  if (state->policy.dedup_ms &&
+      ind_ofdpa_pktin_dedup_hit(packet_in, octets.data, octets.bytes, cls, &key,
+                                state->policy.dedup_ms, now))
+  {
+    state->dedup_drops++;
+    return INDIGO_CORE_LISTENER_RESULT_DROP;
+  }
+
+  if (state->policy.rate_pps && !ind_ofdpa_pktin_rate_allow(state, now))
+  {
+    state->rate_drops++;
+    return INDIGO_CORE_LISTENER_RESULT_DROP;
+  }
+
+  state->passed++;
+  return INDIGO_CORE_LISTENER_RESULT_PASS;
+}
+
+static void ind_ofdpa_pktin_policy_apply(ind_ofdpa_pktin_class_state_t *state,
+                                         const ind_ofdpa_pktin_policy_t *policy)
+{
+  state->policy = *policy;
+  state->tokens = (policy->burst ? policy->burst : policy->rate_pps) * 1000ULL;
+  state->refill_time = INDIGO_CURRENT_TIME;
+}
+
+static void ind_ofdpa_pktin_policy_defaults(void)
+{
+  int cls;
+
+  if (ind_ofdpa_pktin_policy_init)
+  {
+    return;
+  }
+
+  for (cls = 0; cls < IND_OFDPA_PKTIN_CLASS_COUNT; cls++)
+  {
+    ind_ofdpa_pktin_policy_apply(&ind_ofdpa_pktin_classes[cls],
+                                 &ind_ofdpa_pktin_default_policy[cls]);
+  }
+  ind_ofdpa_pktin_policy_init = 1;
+}
+
+indigo_error_t ind_ofdpa_pktin_classifier_start(void)
+{
+  if (ind_ofdpa_pktin_running)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  ind_ofdpa_pktin_policy_defaults();
+
+  ind_ofdpa_pktin_dedup = aim_zmalloc(IND_OFDPA_PKTIN_DEDUP_SLOTS * sizeof(*ind_ofdpa_pktin_dedup));
+
+  if (indigo_core_packet_in_listener_register(ind_ofdpa_pktin_listener) < 0)
+  {
+    LOG_ERROR("Failed to register packet-in classifier");
+    aim_free(ind_ofdpa_pktin_dedup);
+    ind_ofdpa_pktin_dedup = NULL;
+    return INDIGO_ERROR_UNKNOWN;
+  }
+  ind_ofdpa_pktin_running = 1;
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_pktin_classifier_stop(void)
+{
+  if (!ind_ofdpa_pktin_running)
+  {
+    return;
+  }
+
+  indigo_core_packet_in_listener_unregister(ind_ofdpa_pktin_listener);
+  aim_free(ind_ofdpa_pktin_dedup);
+  ind_ofdpa_pktin_dedup = NULL;
+  ind_ofdpa_pktin_running = 0;
+}
+
+indigo_error_t ind_ofdpa_pktin_policy_set(ind_ofdpa_pktin_class_t cls,
+                                          const ind_ofdpa_pktin_policy_t *policy)
+{
+  if (cls < 0 || cls >= IND_OFDPA_PKTIN_CLASS_COUNT)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_pktin_policy_defaults();
+  ind_ofdpa_pktin_policy_apply(&ind_ofdpa_pktin_classes[cls], policy);
+
+  return INDIGO_ERROR_NONE;
+}
+
+int ind_ofdpa_pktin_class_lookup(const char *name)
+{
+  int cls;
+
+  for (cls = 0; cls < IND_OFDPA_PKTIN_CLASS_COUNT; cls++)
+  {
+    if (!strcmp(name, ind_ofdpa_pktin_class_names[cls]))
+    {
+      return cls;
+    }
+  }
+  return -1;
+}
+
+void ind_ofdpa_pktin_classifier_show(aim_pvs_t *pvs)
+{
+  ind_ofdpa_pktin_class_state_t *state;
+  int cls;
+
+  ind_ofdpa_pktin_policy_defaults();
+
+  aim_printf(pvs, "Packet-in classifier %s\n", ind_ofdpa_pktin_running ? "on" : "off");
+  aim_printf(pvs, "%-6s %5s %8s %6s %8s %10s %10s %10s %10s %10s\n",
+             "class", "local", "rate_pps", "burst", "dedup_ms",
+             "packets", "passed", "local", "rate_drop", "dedup_drop");
+
+  for (cls = 0; cls < IND_OFDPA_PKTIN_CLASS_COUNT; cls++)
+  {
+    state = &ind_ofdpa_pktin_classes[cls];
+    aim_printf(pvs, "%-6s %5s %8u %6u %8u %10"PRIu64" %10"PRIu64" %10"PRIu64" %10"PRIu64" %10"PRIu64"\n",
+               ind_ofdpa_pktin_class_names[cls], state->policy.local ? "yes" : "no",
+               state->policy.rate_pps, state->policy.burst, state->policy.dedup_ms,
+               state->packets, state->passed, state->local,
+               state->rate_drops, state->dedup_drops);
+  }
+}
@@ -39,6 +39,10 @@
 #include "loci/of_match.h"
 #include "loci/loci.h"
 #include "ofdpa_api.h"
+#include "indigo/time.h"
+#include <SocketManager/socketmanager.h>
+#include <stdbool.h>
+#include <inttypes.h>
 
 extern int ofagent_of_version;
 
@@ -48,16 +52,10 @@ static indigo_error_t ind_ofdpa_queue_stats_set(of_port_no_t req_of_port_num,
 
 static indigo_error_t ind_ofdpa_port_stats_set(uint32_t port, of_list_port_stats_entry_t *list);
 
-static indigo_error_t ind_ofdpa_queue_config_queue_set(of_packet_queue_t *of_packet_queue,
-                                                       of_port_no_t port,
-                                                       uint32_t queueId);
-
-static indigo_error_t ind_ofdpa_queue_config_queue_set(of_packet_queue_t *of_packet_queue,
-                                                       uint32_t port, uint32_t queueId)
+static void ind_ofdpa_queue_config_queue_set(of_packet_queue_t *of_packet_queue,
+                                             uint32_t port, uint32_t queueId,
+                                             uint32_t minRate, uint32_t maxRate)
 {
-  indigo_error_t err = INDIGO_ERROR_NONE;
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  uint32_t minRate, maxRate;
   of_list_queue_prop_t of_list_queue_prop;
   of_queue_prop_t of_queue_prop;
   of_queue_prop_min_rate_t *min_rate;
@@ -72,35 +70,151 @@ static indigo_error_t ind_ofdpa_queue_config_queue_set(of_packet_queue_t *of_pac
   /* Set the port: Port this queue is attached to. */
   of_packet_queue_port_set(of_packet_queue, port);
 
-  ofdpa_rv = ofdpaQueueRateGet(port, queueId, &minRate, &maxRate);
-  if (ofdpa_rv != OFDPA_E_NONE)
+  of_packet_queue_properties_bind(of_packet_queue, &of_list_queue_prop);
+
+  of_queue_prop_min_rate_init(min_rate, of_packet_queue->version, -1, 1);
+  of_list_queue_prop_append_bind(&of_list_queue_prop, (of_queue_prop_t *)min_rate);
+  of_queue_prop_min_rate_rate_set(min_rate, (uint16_t)minRate);
+
+  of_queue_prop_max_rate_init(max_rate, of_packet_queue->version, -1, 1);
+  of_list_queue_prop_append_bind(&of_list_queue_prop, (of_queue_prop_t *)max_rate);
+  of_queue_prop_max_rate_rate_set(max_rate, (uint16_t)maxRate);
+}
+
+/*
+ * Queue config cache
+ *
+ * Queue rates only change through ofdpaQueueRateSet, so the queue count
+ * and rates of a port are read once and kept until the port is created
+ * or deleted or a rate is set with ind_ofdpa_queue_rate_set(). Rates set
+ * by another OF-DPA client are not seen until then.
+ */
+typedef struct ind_ofdpa_queue_config_cache_entry_s
+{
+  uint32_t port;
+  uint32_t numQueues;
+  struct
   {
-    LOG_ERROR("Failed to get port queue min and max rates. (ofdpa_rv = %d)", ofdpa_rv);
-    err = (indigoConvertOfdpaRv(ofdpa_rv));
+    uint32_t minRate;
+    uint32_t maxRate;
+  } *rates;
+} ind_ofdpa_queue_config_cache_entry_t;
+
+static struct
+{
+  ind_ofdpa_queue_config_cache_entry_t *entries;
+  int                                  count;
+  int                                  size;
+  uint64_t                             hits;
+  uint64_t                             misses;
+} ind_ofdpa_queue_config_cache;
+
+static ind_ofdpa_queue_config_cache_entry_t *ind_ofdpa_queue_config_cache_find(uint32_t port)
+{
+  int i;
+
+  for (i = 0; i < ind_ofdpa_queue_config_cache.count; i++)
+  {
+    if (ind_ofdpa_queue_config_cache.entries[i].port == port)
+    {
+      return &ind_ofdpa_queue_config_cache.entries[i];
+    }
   }
-  else
+
+  return NULL;
+}
+
+static void ind_ofdpa_queue_config_cache_invalidate(uint32_t port)
+{
+  ind_ofdpa_queue_config_cache_entry_t *entry = ind_ofdpa_queue_config_cache_find(port);
+
+  if (entry != NULL)
   {
-    of_packet_queue_properties_bind(of_packet_queue, &of_list_queue_prop);
+    aim_free(entry->rates);
+    *entry = ind_ofdpa_queue_config_cache.entries[--ind_ofdpa_queue_config_cache.count];
+  }
+}
 
-    of_queue_prop_min_rate_init(min_rate, of_packet_queue->version, -1, 1);
-    of_list_queue_prop_append_bind(&of_list_queue_prop, (of_queue_prop_t *)min_rate);
-    of_queue_prop_min_rate_rate_set(min_rate, (uint16_t)minRate);
+/* Look up the queues of a port, reading them from OF-DPA on a miss */
+static indigo_error_t ind_ofdpa_queue_config_cache_get(uint32_t port,
+                                                       ind_ofdpa_queue_config_cache_entry_t **result)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  ind_ofdpa_queue_config_cache_entry_t *entry;
+  uint32_t queueId;
 
+  entry = ind_ofdpa_queue_config_cache_find(port);
+  if (entry != NULL)
+  {
+    ind_ofdpa_queue_config_cache.hits++;
+    *result = entry;
+    return INDIGO_ERROR_NONE;
+  }
+  ind_ofdpa_queue_config_cache.misses++;
 
-    of_queue_prop_max_rate_init(max_rate, of_packet_queue->version, -1, 1);
-    of_list_queue_prop_append_bind(&of_list_queue_prop, (of_queue_prop_t *)max_rate);
-    of_queue_prop_max_rate_rate_set(max_rate, (uint16_t)maxRate);
+  if (ind_ofdpa_queue_config_cache.count == ind_ofdpa_queue_config_cache.size)
+  {
+    int size = ind_ofdpa_queue_config_cache.size ? ind_ofdpa_queue_config_cache.size * 2 : 64;
+    ind_ofdpa_queue_config_cache.entries =
+      aim_realloc(ind_ofdpa_queue_config_cache.entries, size * sizeof(*entry));
+    AIM_TRUE_OR_DIE(ind_ofdpa_queue_config_cache.entries != NULL);
+    ind_ofdpa_queue_config_cache.size = size;
+  }
+  entry = &ind_ofdpa_queue_config_cache.entries[ind_ofdpa_queue_config_cache.count];
+  memset(entry, 0, sizeof(*entry));
+  entry->port = port;
 
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaNumQueuesGet, port, &entry->numQueues);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Error getting maximum queues supported on port %d. (ofdpa_rv = %d)", port, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
   }
 
-  return err;
+  if (entry->numQueues > 0)
+  {
+    entry->rates = aim_zmalloc(entry->numQueues * sizeof(*entry->rates));
+  }
+  for (queueId = 0; queueId < entry->numQueues; queueId++)
+  {
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaQueueRateGet, port, queueId,
+                             &entry->rates[queueId].minRate, &entry->rates[queueId].maxRate);
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_ERROR("Failed to get port queue min and max rates. (ofdpa_rv = %d)", ofdpa_rv);
+      aim_free(entry->rates);
+      return indigoConvertOfdpaRv(ofdpa_rv);
+    }
+  }
+
+  /* Only keep what was read in full, so a failure is retried next time */
+  ind_ofdpa_queue_config_cache.count++;
+  *result = entry;
+
+  return INDIGO_ERROR_NONE;
 }
 
+indigo_error_t ind_ofdpa_queue_rate_set(uint32_t port, uint32_t queueId,
+                                        uint32_t minRate, uint32_t maxRate)
+{
+  OFDPA_ERROR_t ofdpa_rv;
 
-static indigo_error_t ind_ofdpa_port_stats_set(uint32_t port, of_list_port_stats_entry_t *list)
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaQueueRateSet, port, queueId, minRate, maxRate);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to set rates of queue %d on port %d. (ofdpa_rv = %d)", queueId, port, ofdpa_rv);
+  }
+
+  /* Reread even on failure; OF-DPA may have applied one of the rates */
+  ind_ofdpa_queue_config_cache_invalidate(port);
+
+  return indigoConvertOfdpaRv(ofdpa_rv);
+}
+
+static indigo_error_t ind_ofdpa_port_stats_entry_append(uint32_t port,
+                                                       const ofdpaPortStats_t *portStats,
+                                                       of_list_port_stats_entry_t *list)
 {
-  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  ofdpaPortStats_t portStats;
   of_port_stats_entry_t entry[1];
 
   of_port_stats_entry_init(entry, list->version, -1, 1);
@@ -110,29 +224,434 @@ static indigo_error_t ind_ofdpa_port_stats_set(uint32_t port, of_list_port_stats
     return INDIGO_ERROR_UNKNOWN;
   }
 
+  of_port_stats_entry_port_no_set(entry, port);
+  of_port_stats_entry_rx_packets_set(entry, portStats->rx_packets);
+  of_port_stats_entry_tx_packets_set(entry, portStats->tx_packets);
+  of_port_stats_entry_rx_bytes_set(entry, portStats->rx_bytes);
+  of_port_stats_entry_tx_bytes_set(entry, portStats->tx_bytes);
+  of_port_stats_entry_rx_errors_set(entry, portStats->rx_errors);
+  of_port_stats_entry_tx_errors_set(entry, portStats->tx_errors);
+  of_port_stats_entry_rx_dropped_set(entry, portStats->rx_drops);
+  of_port_stats_entry_tx_dropped_set(entry, portStats->tx_drops);
+  of_port_stats_entry_rx_frame_err_set(entry, portStats->rx_frame_err);
+  of_port_stats_entry_rx_over_err_set(entry, portStats->rx_over_err);
+  of_port_stats_entry_rx_crc_err_set(entry, portStats->rx_crc_err);
+  of_port_stats_entry_collisions_set(entry, portStats->collisions);
+
+  return INDIGO_ERROR_NONE;
+}
+
+static indigo_error_t ind_ofdpa_port_stats_set(uint32_t port, of_list_port_stats_entry_t *list)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  ofdpaPortStats_t portStats;
+
   memset(&portStats, 0, sizeof(portStats));
-  ofdpa_rv = ofdpaPortStatsGet(port, &portStats);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortStatsGet, port, &portStats);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to get stats on port %d.", port);
     return (indigoConvertOfdpaRv(ofdpa_rv));
   }
 
-  of_port_stats_entry_port_no_set(entry, port);
-  of_port_stats_entry_rx_packets_set(entry, portStats.rx_packets);
-  of_port_stats_entry_tx_packets_set(entry, portStats.tx_packets);
-  of_port_stats_entry_rx_bytes_set(entry, portStats.rx_bytes);
-  of_port_stats_entry_tx_bytes_set(entry, portStats.tx_bytes);
-  of_port_stats_entry_rx_errors_set(entry, portStats.rx_errors);
-  of_port_stats_entry_tx_errors_set(entry, portStats.tx_errors);
-  of_port_stats_entry_rx_dropped_set(entry, portStats.rx_drops);
-  of_port_stats_entry_tx_dropped_set(entry, portStats.tx_drops);
-  of_port_stats_entry_rx_frame_err_set(entry, portStats.rx_frame_err);
-  of_port_stats_entry_rx_over_err_set(entry, portStats.rx_over_err);
-  of_port_stats_entry_rx_crc_err_set(entry, portStats.rx_crc_err);
-  of_port_stats_entry_collisions_set(entry, portStats.collisions);
-
-  return (indigoConvertOfdpaRv(ofdpa_rv));
+  return ind_ofdpa_port_stats_entry_append(port, &portStats, list);
+}
+
+/*
+ * Port statistics cache
+ *
+ * A periodic timer starts a sweep over the OF-DPA ports. A task reads a
+ * few ports per turn of the event loop into the next snapshot, which
+ * replaces the served one when the sweep completes, so a reply never
+ * mixes two sweeps. All-port requests are answered from the snapshot
+ * while it is younger than two intervals; single-port requests, and
+ * all-port requests while there is no usable snapshot, read OF-DPA.
+ *
+ * With the asynchronous OF-DPA client running, a client thread reads the
+ * whole sweep instead of the task, and the snapshots are swapped when it
+ * completes back on the event loop.
+ *
+ * The snapshot before the served one is kept too, and the difference
+ * between the two gives per-port rates for the BSN port counter stats.
+ */
+#define IND_OFDPA_PORT_STATS_SWEEP_BATCH 8
+
+typedef struct ind_ofdpa_port_stats_snapshot_s
+{
+  struct
+  {
+    uint32_t         port;
+    ofdpaPortStats_t stats;
+  } *entries;
+  int           count;
+  int           size;
+  indigo_time_t time;   /* When the sweep that filled it started */
+} ind_ofdpa_port_stats_snapshot_t;
+
+static struct
+{
+  int                             interval_ms; /* 0 when the cache is off */
+  ind_ofdpa_port_stats_snapshot_t snapshots[3];
+  ind_ofdpa_port_stats_snapshot_t *current;    /* Served; NULL before the first sweep */
+  ind_ofdpa_port_stats_snapshot_t *previous;   /* Sweep before current, for rates */
+  ind_ofdpa_port_stats_snapshot_t *next;       /* Filled by the sweep */
+  bool                            sweeping;
+  uint32_t                        sweep_port;  /* Last port read; 0 to start */
+  uint64_t                        sweeps;
+  uint64_t                        overruns;    /* Sweep still running at the next interval */
+  uint64_t                        hits;
+  uint64_t                        misses;
+} ind_ofdpa_port_stats_cache = {
+  .next = &ind_ofdpa_port_stats_cache.snapshots[0],
+};
+
+/*
+ * Read the next port into the next snapshot. Returns false once every port
+ * has been read. Touches only the next snapshot and the sweep position, so
+ * it can run on an OF-DPA client thread.
+ */
+static bool ind_ofdpa_port_stats_sweep_step(void)
+{
+  ind_ofdpa_port_stats_snapshot_t *next = ind_ofdpa_port_stats_cache.next;
+  OFDPA_ERROR_t ofdpa_rv;
+  uint32_t port;
+
+  if (IND_OFDPA_RPC(ofdpaPortNextGet, ind_ofdpa_port_stats_cache.sweep_port, &port) != OFDPA_E_NONE)
+  {
+    return false;
+  }
+  ind_ofdpa_port_stats_cache.sweep_port = port;
+
+  if (next->count == next->size)
+  {
+    int size = next->size ? next->size * 2 : 64;
+    next->entries = aim_realloc(next->entries, size * sizeof(*next->entries));
+    AIM_TRUE_OR_DIE(next->entries != NULL);
+    next->size = size;
+  }
+
+  memset(&next->entries[next->count].stats, 0, sizeof(next->entries[0].stats));
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortStatsGet, port, &next->entries[next->count].stats);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_TRACE("Failed to get stats on port %d. (ofdpa_rv = %d)", port, ofdpa_rv);
+    return true;
+  }
+  next->entries[next->count].port = port;
+  next->count++;
+
+  return true;
+}
+
+/* Sweep complete; serve it and fill the oldest snapshot next time */
+static void ind_ofdpa_port_stats_sweep_done(void)
+{
+  ind_ofdpa_port_stats_snapshot_t *next = ind_ofdpa_port_stats_cache.next;
+  ind_ofdpa_port_stats_snapshot_t *spare = ind_ofdpa_port_stats_cache.previous;
+
+  ind_ofdpa_port_stats_cache.sweeping = false;
+  if (ind_ofdpa_port_stats_cache.interval_ms == 0)
+  {
+    return;
+  }
+
+  if (spare == NULL)
+  {
+    for (spare = ind_ofdpa_port_stats_cache.snapshots;
+         spare == next || spare == ind_ofdpa_port_stats_cache.current;
+         spare++);
+  }
+  ind_ofdpa_port_stats_cache.previous = ind_ofdpa_port_stats_cache.current;
+  ind_ofdpa_port_stats_cache.current = next;
+  ind_ofdpa_port_stats_cache.next = spare;
+  ind_ofdpa_port_stats_cache.sweeps++;
+}
+
+static ind_soc_task_status_t ind_ofdpa_port_stats_sweep_task(void *cookie)
+{
+  int i;
+
+  if (ind_ofdpa_port_stats_cache.interval_ms == 0)
+  {
+    ind_ofdpa_port_stats_cache.sweeping = false;
+    return IND_SOC_TASK_FINISHED;
+  }
+
+  for (i = 0; i < IND_OFDPA_PORT_STATS_SWEEP_BATCH; i++)
+  {
+    if (!ind_ofdpa_port_stats_sweep_step())
+    {
+      ind_ofdpa_port_stats_sweep_done();
+      return IND_SOC_TASK_FINISHED;
+    }
+  }
+
+  return IND_SOC_TASK_CONTINUE;
+}
+
+/* With the asynchronous client, a client thread reads the whole sweep */
+static OFDPA_ERROR_t ind_ofdpa_port_stats_sweep_op(void *cookie)
+{
+  while (ind_ofdpa_port_stats_sweep_step());
+  return OFDPA_E_NONE;
+}
+
+static void ind_ofdpa_port_stats_sweep_op_done(void *cookie, OFDPA_ERROR_t rv)
+{
+  ind_ofdpa_port_stats_sweep_done();
+}
+
+static void ind_ofdpa_port_stats_cache_timer(void *cookie)
+{
+  ind_ofdpa_port_stats_snapshot_t *next = ind_ofdpa_port_stats_cache.next;
+
+  if (ind_ofdpa_port_stats_cache.sweeping)
+  {
+    ind_ofdpa_port_stats_cache.overruns++;
+    return;
+  }
+
+  next->count = 0;
+  next->time = INDIGO_CURRENT_TIME;
+  ind_ofdpa_port_stats_cache.sweep_port = 0;
+  ind_ofdpa_port_stats_cache.sweeping = true;
+
+  if (ind_ofdpa_async_running())
+  {
+    ind_ofdpa_async_submit(ind_ofdpa_port_stats_sweep_op,
+                           ind_ofdpa_port_stats_sweep_op_done, NULL);
+    return;
+  }
+
+  if (ind_soc_task_register(ind_ofdpa_port_stats_sweep_task, NULL,
+                            IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    LOG_ERROR("Failed to start port stats sweep");
+    ind_ofdpa_port_stats_cache.sweeping = false;
+  }
+}
+
+indigo_error_t ind_ofdpa_port_stats_cache_start(int interval_ms)
+{
+  if (interval_ms <= 0)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_port_stats_cache_stop();
+
+  if (ind_soc_timer_event_register_with_priority(ind_ofdpa_port_stats_cache_timer, NULL,
+                                                 interval_ms, IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    LOG_ERROR("Failed to register port stats cache timer");
+    return INDIGO_ERROR_UNKNOWN;
+  }
+  ind_ofdpa_port_stats_cache.interval_ms = interval_ms;
+
+  /* Have a snapshot soon rather than one interval from now */
+  ind_ofdpa_port_stats_cache_timer(NULL);
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_port_stats_cache_stop(void)
+{
+  if (ind_ofdpa_port_stats_cache.interval_ms == 0)
+  {
+    return;
+  }
+
+  ind_soc_timer_event_unregister(ind_ofdpa_port_stats_cache_timer, NULL);
+  ind_ofdpa_port_stats_cache.interval_ms = 0;
+  ind_ofdpa_port_stats_cache.current = NULL;
+  ind_ofdpa_port_stats_cache.previous = NULL;
+}
+
+/* The served snapshot, or NULL if the cache is off or its snapshot is stale */
+static ind_ofdpa_port_stats_snapshot_t *ind_ofdpa_port_stats_cache_fresh(void)
+{
+  ind_ofdpa_port_stats_snapshot_t *current = ind_ofdpa_port_stats_cache.current;
+
+  if (current == NULL ||
+      INDIGO_TIME_DIFF_ms(current->time, INDIGO_CURRENT_TIME) >
+      2 * ind_ofdpa_port_stats_cache.interval_ms)
+  {
+    return NULL;
+  }
+
+  return current;
+}
+
+/* Entries are in ofdpaPortNextGet order, which is ascending */
+static ofdpaPortStats_t *ind_ofdpa_port_stats_snapshot_find(ind_ofdpa_port_stats_snapshot_t *snapshot,
+                                                            uint32_t port)
+{
+  int lo = 0, hi = snapshot->count - 1;
+
+  while (lo <= hi)
+  {
+    int mid = lo + (hi - lo) / 2;
+
+    if (snapshot->entries[mid].port == port)
+    {
+      return &snapshot->entries[mid].stats;
+    }
+    else if (snapshot->entries[mid].port < port)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid - 1;
+    }
+  }
+
+  return NULL;
+}
+
+/* Per second, or -1 if the counter went backwards (port reset) */
+static uint64_t ind_ofdpa_port_stats_rate(uint64_t older, uint64_t newer, uint32_t interval_ms)
+{
+  if (newer < older || interval_ms == 0)
+  {
+    return (uint64_t)-1;
+  }
+
+  return (newer - older) * 1000 / interval_ms;
+}
+
+/*
+ * Rates for a port between the previous and current snapshots. Returns
+ * false if the port is not in both or the current snapshot is stale.
+ */
+static bool ind_ofdpa_port_stats_rates_get(uint32_t port, ind_ofdpa_port_rates_t *rates)
+{
+  ind_ofdpa_port_stats_snapshot_t *current = ind_ofdpa_port_stats_cache_fresh();
+  ind_ofdpa_port_stats_snapshot_t *previous = ind_ofdpa_port_stats_cache.previous;
+  ofdpaPortStats_t *newer, *older;
+  uint32_t interval_ms;
+
+  if (current == NULL || previous == NULL ||
+      (newer = ind_ofdpa_port_stats_snapshot_find(current, port)) == NULL ||
+      (older = ind_ofdpa_port_stats_snapshot_find(previous, port)) == NULL)
+  {
+    return false;
+  }
+
+  interval_ms = INDIGO_TIME_DIFF_ms(previous->time, current->time);
+
+  rates->rx_packets = ind_ofdpa_port_stats_rate(older->rx_packets, newer->rx_packets, interval_ms);
+  rates->rx_bits = ind_ofdpa_port_stats_rate(older->rx_bytes * 8, newer->rx_bytes * 8, interval_ms);
+  rates->rx_errors = ind_ofdpa_port_stats_rate(older->rx_errors, newer->rx_errors, interval_ms);
+  rates->tx_packets = ind_ofdpa_port_stats_rate(older->tx_packets, newer->tx_packets, interval_ms);
+  rates->tx_bits = ind_ofdpa_port_stats_rate(older->tx_bytes * 8, newer->tx_bytes * 8, interval_ms);
+  rates->tx_errors = ind_ofdpa_port_stats_rate(older->tx_errors, newer->tx_errors, interval_ms);
+  rates->interval_ms = interval_ms;
+  rates->age_ms = INDIGO_TIME_DIFF_ms(current->time, INDIGO_CURRENT_TIME);
+
+  return true;
+}
+
+/* Add every port from the snapshot; false if there is no usable snapshot */
+static bool ind_ofdpa_port_stats_cache_reply(of_list_port_stats_entry_t *list,
+                                             indigo_error_t *err)
+{
+  ind_ofdpa_port_stats_snapshot_t *current = ind_ofdpa_port_stats_cache_fresh();
+  int i;
+
+  if (current == NULL)
+  {
+    ind_ofdpa_port_stats_cache.misses++;
+    return false;
+  }
+
+  ind_ofdpa_port_stats_cache.hits++;
+
+  *err = INDIGO_ERROR_NONE;
+  for (i = 0; i < current->count && *err == INDIGO_ERROR_NONE; i++)
+  {
+    *err = ind_ofdpa_port_stats_entry_append(current->entries[i].port,
+                                             &current->entries[i].stats, list);
+  }
+
+  return true;
+}
+
+void ind_ofdpa_port_stats_cache_show(aim_pvs_t *pvs)
+{
+  ind_ofdpa_port_stats_snapshot_t *current = ind_ofdpa_port_stats_cache.current;
+
+  if (ind_ofdpa_port_stats_cache.interval_ms == 0)
+  {
+    aim_printf(pvs, "Port stats cache off\n");
+    return;
+  }
+
+  aim_printf(pvs, "Port stats cache every %d ms%s\n",
+             ind_ofdpa_port_stats_cache.interval_ms,
+             ind_ofdpa_port_stats_cache.sweeping ? ", sweeping" : "");
+  if (current != NULL)
+  {
+    aim_printf(pvs, "  snapshot of %d ports, %u ms old\n", current->count,
+               INDIGO_TIME_DIFF_ms(current->time, INDIGO_CURRENT_TIME));
+  }
+  aim_printf(pvs, "  sweeps %"PRIu64" overruns %"PRIu64" hits %"PRIu64" misses %"PRIu64"\n",
+             ind_ofdpa_port_stats_cache.sweeps, ind_ofdpa_port_stats_cache.overruns,
+             ind_ofdpa_port_stats_cache.hits, ind_ofdpa_port_stats_cache.misses);
+}
+
+void ind_ofdpa_port_stats_rates_show(aim_pvs_t *pvs)
+{
+  ind_ofdpa_port_stats_snapshot_t *current = ind_ofdpa_port_stats_cache_fresh();
+  ind_ofdpa_port_rates_t rates;
+  int i;
+
+  if (current == NULL || ind_ofdpa_port_stats_cache.previous == NULL)
+  {
+    aim_printf(pvs, "No port rates; the port stats cache needs two recent sweeps\n");
+    return;
+  }
+
+  aim_printf(pvs, "%-10s %12s %14s %10s %12s %14s %10s\n", "port",
+             "rx_pps", "rx_bps", "rx_err/s", "tx_pps", "tx_bps", "tx_err/s");
+  for (i = 0; i < current->count; i++)
+  {
+    if (!ind_ofdpa_port_stats_rates_get(current->entries[i].port, &rates))
+    {
+      continue;
+    }
+    aim_printf(pvs, "0x%08x %12"PRId64" %14"PRId64" %10"PRId64" %12"PRId64" %14"PRId64" %10"PRId64"\n",
+               current->entries[i].port,
+               (int64_t)rates.rx_packets, (int64_t)rates.rx_bits, (int64_t)rates.rx_errors,
+               (int64_t)rates.tx_packets, (int64_t)rates.tx_bits, (int64_t)rates.tx_errors);
+  }
+  aim_printf(pvs, "Over %u ms, sampled %u ms ago\n",
+             INDIGO_TIME_DIFF_ms(ind_ofdpa_port_stats_cache.previous->time, current->time),
+             INDIGO_TIME_DIFF_ms(current->time, INDIGO_CURRENT_TIME));
+}
+
+static indigo_error_t ind_ofdpa_queue_stats_entry_append(uint32_t port, uint32_t queueId,
+                                                         const ofdpaPortQueueStats_t *queueStats,
+                                                         of_list_queue_stats_entry_t *list)
+{
+  of_queue_stats_entry_t entry[1];
+
+  of_queue_stats_entry_init(entry, list->version, -1, 1);
+  if (of_list_queue_stats_entry_append_bind(list, entry) < 0)
+  {
+    LOG_ERROR("Too many queue stats replies.");
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  of_queue_stats_entry_port_no_set(entry, port);
+  of_queue_stats_entry_queue_id_set(entry, queueId);
+  of_queue_stats_entry_tx_bytes_set(entry, queueStats->txBytes);
+  of_queue_stats_entry_tx_packets_set(entry, queueStats->txPkts);
+  of_queue_stats_entry_tx_errors_set(entry, 0);
+  of_queue_stats_entry_duration_sec_set(entry, queueStats->duration_seconds);
+  of_queue_stats_entry_duration_nsec_set(entry, (queueStats->duration_seconds)*IND_OFDPA_NANO_SEC);
+
+  return INDIGO_ERROR_NONE;
 }
 
 static indigo_error_t ind_ofdpa_queue_stats_set(of_port_no_t port,
@@ -145,7 +664,6 @@ static indigo_error_t ind_ofdpa_queue_stats_set(of_port_no_t port,
   uint32_t numQueues;
   uint32_t queueId;
   uint32_t all_queues = 0;
-  of_queue_stats_entry_t entry[1];
 
 
   /* Check if the request if for all queues (OFPQ_ALL) */
@@ -159,7 +677,7 @@ static indigo_error_t ind_ofdpa_queue_stats_set(of_port_no_t port,
     queueId = req_of_port_queue_id;
   }
 
-  ofdpa_rv = ofdpaNumQueuesGet(port, &numQueues);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaNumQueuesGet, port, &numQueues);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to get no. of port queues. (ofdpa_rv = %d)", ofdpa_rv);
@@ -174,27 +692,19 @@ static indigo_error_t ind_ofdpa_queue_stats_set(of_port_no_t port,
 
   while (queueId < numQueues)
   {
-    of_queue_stats_entry_init(entry, list->version, -1, 1);
-    if (of_list_queue_stats_entry_append_bind(list, entry) < 0)
-    {
-      LOG_ERROR("Too many queue stats replies.");
-      return INDIGO_ERROR_RESOURCE;
-    }
-    ofdpa_rv = ofdpaQueueStatsGet(port, queueId, &queueStats);
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaQueueStatsGet, port, queueId, &queueStats);
     if (ofdpa_rv != OFDPA_E_NONE)
     {
       LOG_ERROR("Failed to queue stats for port %d on queue %d.", port, queueId);
       err = indigoConvertOfdpaRv(ofdpa_rv);
       break;
     }
-    of_queue_stats_entry_port_no_set(entry, port);
-    of_queue_stats_entry_queue_id_set(entry, queueId);
-    of_queue_stats_entry_tx_bytes_set(entry, queueStats.txBytes);
-    of_queue_stats_entry_tx_packets_set(entry, queueStats.txPkts);
-    of_queue_stats_entry_tx_errors_set(entry, 0);
-    of_queue_stats_entry_duration_sec_set(entry, queueStats.duration_seconds);
-    of_queue_stats_entry_duration_nsec_set(entry, (queueStats.duration_seconds)*IND_OFDPA_NANO_SEC);
 
+    err = ind_ofdpa_queue_stats_entry_append(port, queueId, &queueStats, list);
+    if (err != INDIGO_ERROR_NONE)
+    {
+      break;
+    }
 
     /* Check if the queueId is all queues OFPQ_ALL */
     if (!all_queues)
@@ -208,6 +718,284 @@ static indigo_error_t ind_ofdpa_queue_stats_set(of_port_no_t port,
   return err;
 }
 
+/*
+ * Queue stats cache
+ *
+ * Works like the port stats cache: a timer starts a sweep that reads
+ * every queue of a few ports per task tick into the spare snapshot, and
+ * queue stats requests are answered from the last complete sweep while
+ * it is at most two intervals old. A port is only kept if all its queues
+ * were read, so a queue missing from a listed port does not exist.
+ */
+#define IND_OFDPA_QUEUE_STATS_SWEEP_BATCH 8
+
+typedef struct ind_ofdpa_queue_stats_snapshot_s
+{
+  struct
+  {
+    uint32_t              port;
+    uint32_t              queueId;
+    ofdpaPortQueueStats_t stats;
+  } *entries;
+  int           count;
+  int           size;
+  indigo_time_t time;   /* When the sweep that filled it started */
+} ind_ofdpa_queue_stats_snapshot_t;
+
+static struct
+{
+  int                              interval_ms; /* 0 when the cache is off */
+  ind_ofdpa_queue_stats_snapshot_t snapshots[2];
+  ind_ofdpa_queue_stats_snapshot_t *current;    /* Served; NULL before the first sweep */
+  ind_ofdpa_queue_stats_snapshot_t *next;       /* Filled by the sweep */
+  bool                             sweeping;
+  uint32_t                         sweep_port;  /* Last port read; 0 to start */
+  uint64_t                         sweeps;
+  uint64_t                         overruns;    /* Sweep still running at the next interval */
+  uint64_t                         hits;
+  uint64_t                         misses;
+} ind_ofdpa_queue_stats_cache = {
+  .next = &ind_ofdpa_queue_stats_cache.snapshots[0],
+};
+
+static ind_soc_task_status_t ind_ofdpa_queue_stats_sweep_task(void *cookie)
+{
+  ind_ofdpa_queue_stats_snapshot_t *next = ind_ofdpa_queue_stats_cache.next;
+  OFDPA_ERROR_t ofdpa_rv;
+  uint32_t port, numQueues, queueId;
+  int i;
+
+  if (ind_ofdpa_queue_stats_cache.interval_ms == 0)
+  {
+    ind_ofdpa_queue_stats_cache.sweeping = false;
+    return IND_SOC_TASK_FINISHED;
+  }
+
+  for (i = 0; i < IND_OFDPA_QUEUE_STATS_SWEEP_BATCH; i++)
+  {
+    if (IND_OFDPA_RPC(ofdpaPortNextGet, ind_ofdpa_queue_stats_cache.sweep_port, &port) != OFDPA_E_NONE)
+    {
+      /* Sweep complete; serve it and fill the other snapshot next time */
+      ind_ofdpa_queue_stats_cache.next = (next == &ind_ofdpa_queue_stats_cache.snapshots[0]) ?
+        &ind_ofdpa_queue_stats_cache.snapshots[1] : &ind_ofdpa_queue_stats_cache.snapshots[0];
+      ind_ofdpa_queue_stats_cache.current = next;
+      ind_ofdpa_queue_stats_cache.sweeping = false;
+      ind_ofdpa_queue_stats_cache.sweeps++;
+      return IND_SOC_TASK_FINISHED;
+    }
+    ind_ofdpa_queue_stats_cache.sweep_port = port;
+
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaNumQueuesGet, port, &numQueues);
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_TRACE("Failed to get no. of queues on port %d. (ofdpa_rv = %d)", port, ofdpa_rv);
+      continue;
+    }
+
+    if (next->count + numQueues > next->size)
+    {
+      int size = next->size ? next->size : 256;
+      while (next->count + numQueues > size)
+      {
+        size *= 2;
+      }
+      next->entries = aim_realloc(next->entries, size * sizeof(*next->entries));
+      AIM_TRUE_OR_DIE(next->entries != NULL);
+      next->size = size;
+    }
+
+    for (queueId = 0; queueId < numQueues; queueId++)
+    {
+      memset(&next->entries[next->count + queueId], 0, sizeof(next->entries[0]));
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaQueueStatsGet, port, queueId,
+                               &next->entries[next->count + queueId].stats);
+      if (ofdpa_rv != OFDPA_E_NONE)
+      {
+        LOG_TRACE("Failed to get stats of queue %d on port %d. (ofdpa_rv = %d)",
+                  queueId, port, ofdpa_rv);
+        break;
+      }
+      next->entries[next->count + queueId].port = port;
+      next->entries[next->count + queueId].queueId = queueId;
+    }
+    if (queueId == numQueues)
+    {
+      next->count += numQueues;
+    }
+  }
+
+  return IND_SOC_TASK_CONTINUE;
+}
+
+static void ind_ofdpa_queue_stats_cache_timer(void *cookie)
+{
+  ind_ofdpa_queue_stats_snapshot_t *next = ind_ofdpa_queue_stats_cache.next;
+
+  if (ind_ofdpa_queue_stats_cache.sweeping)
+  {
+    ind_ofdpa_queue_stats_cache.overruns++;
+    return;
+  }
+
+  next->count = 0;
+  next->time = INDIGO_CURRENT_TIME;
+  ind_ofdpa_queue_stats_cache.sweep_port = 0;
+
+  if (ind_soc_task_register(ind_ofdpa_queue_stats_sweep_task, NULL,
+                            IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    LOG_ERROR("Failed to start queue stats sweep");
+    return;
+  }
+  ind_ofdpa_queue_stats_cache.sweeping = true;
+}
+
+indigo_error_t ind_ofdpa_queue_stats_cache_start(int interval_ms)
+{
+  if (interval_ms <= 0)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_queue_stats_cache_stop();
+
+  if (ind_soc_timer_event_register_with_priority(ind_ofdpa_queue_stats_cache_timer, NULL,
+                                                 interval_ms, IND_SOC_DEFAULT_PRIORITY) < 0)
+  {
+    LOG_ERROR("Failed to register queue stats cache timer");
+    return INDIGO_ERROR_UNKNOWN;
+  }
+  ind_ofdpa_queue_stats_cache.interval_ms = interval_ms;
+
+  /* Have a snapshot soon rather than one interval from now */
+  ind_ofdpa_queue_stats_cache_timer(NULL);
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_queue_stats_cache_stop(void)
+{
+  if (ind_ofdpa_queue_stats_cache.interval_ms == 0)
+  {
+    return;
+  }
+
+  ind_soc_timer_event_unregister(ind_ofdpa_queue_stats_cache_timer, NULL);
+  ind_ofdpa_queue_stats_cache.interval_ms = 0;
+  ind_ofdpa_queue_stats_cache.current = NULL;
+}
+
+/*
+ * Add the requested queues from the last sweep. Returns false if there
+ * is no usable snapshot or a single requested port is not in it, so the
+ * caller reads OF-DPA instead.
+ */
+static bool ind_ofdpa_queue_stats_cache_reply(uint32_t port, int all_ports,
+                                              uint32_t req_of_port_queue_id,
+                                              of_list_queue_stats_entry_t *list,
+                                              indigo_error_t *err)
+{
+  ind_ofdpa_queue_stats_snapshot_t *current = ind_ofdpa_queue_stats_cache.current;
+  int all_queues = (req_of_port_queue_id == OF_QUEUE_ALL_BY_VERSION(list->version));
+  bool found;
+  int i = 0;
+
+  if (current == NULL ||
+      INDIGO_TIME_DIFF_ms(current->time, INDIGO_CURRENT_TIME) >
+      2 * ind_ofdpa_queue_stats_cache.interval_ms)
+  {
+    ind_ofdpa_queue_stats_cache.misses++;
+    return false;
+  }
+
+  if (!all_ports)
+  {
+    /* Entries are in ofdpaPortNextGet order, which is ascending */
+    int hi = current->count;
+
+    while (i < hi)
+    {
+      int mid = i + (hi - i) / 2;
+
+      if (current->entries[mid].port < port)
+      {
+        i = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+    if (i == current->count || current->entries[i].port != port)
+    {
+      ind_ofdpa_queue_stats_cache.misses++;
+      return false;
+    }
+  }
+
+  ind_ofdpa_queue_stats_cache.hits++;
+
+  *err = INDIGO_ERROR_NONE;
+  while (i < current->count && *err == INDIGO_ERROR_NONE)
+  {
+    port = current->entries[i].port;
+    found = false;
+    for (; i < current->count && current->entries[i].port == port; i++)
+    {
+      if (*err != INDIGO_ERROR_NONE ||
+          (!all_queues && current->entries[i].queueId != req_of_port_queue_id))
+      {
+        continue;
+      }
+      *err = ind_ofdpa_queue_stats_entry_append(port, current->entries[i].queueId,
+                                                &current->entries[i].stats, list);
+      found = true;
+    }
+
+    /* Same as reading OF-DPA: a port without the queue fails the request */
+    if (!found && *err == INDIGO_ERROR_NONE)
+    {
+      LOG_ERROR("Invalid queue Id (queueId = %d)", req_of_port_queue_id);
+      *err = INDIGO_ERROR_RANGE;
+    }
+
+    if (!all_ports)
+    {
+      break;
+    }
+  }
+
+  return true;
+}
+
+void ind_ofdpa_queue_stats_cache_show(aim_pvs_t *pvs)
+{
+  ind_ofdpa_queue_stats_snapshot_t *current = ind_ofdpa_queue_stats_cache.current;
+
+  if (ind_ofdpa_queue_stats_cache.interval_ms == 0)
+  {
+    aim_printf(pvs, "Queue stats cache off\n");
+  }
+  else
+  {
+    aim_printf(pvs, "Queue stats cache every %d ms%s\n",
+               ind_ofdpa_queue_stats_cache.interval_ms,
+               ind_ofdpa_queue_stats_cache.sweeping ? ", sweeping" : "");
+    if (current != NULL)
+    {
+      aim_printf(pvs, "  snapshot of %d queues, %u ms old\n", current->count,
+                 INDIGO_TIME_DIFF_ms(current->time, INDIGO_CURRENT_TIME));
+    }
+    aim_printf(pvs, "  sweeps %"PRIu64" overruns %"PRIu64" hits %"PRIu64" misses %"PRIu64"\n",
+               ind_ofdpa_queue_stats_cache.sweeps, ind_ofdpa_queue_stats_cache.overruns,
+               ind_ofdpa_queue_stats_cache.hits, ind_ofdpa_queue_stats_cache.misses);
+  }
+
+  aim_printf(pvs, "Queue config cache of %d ports, hits %"PRIu64" misses %"PRIu64"\n",
+             ind_ofdpa_queue_config_cache.count,
+             ind_ofdpa_queue_config_cache.hits, ind_ofdpa_queue_config_cache.misses);
+}
+
 /* Set the port features in LOCI structure
  * Parameters:
  *    port          (input)   Port number
@@ -219,7 +1007,7 @@ static indigo_error_t ind_ofdpa_port_features_set(of_port_no_t port,
   OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
   ofdpaPortFeature_t  features;
 
-  ofdpa_rv = ofdpaPortFeatureGet(port, &features);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortFeatureGet, port, &features);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Error getting port features");
@@ -238,50 +1026,153 @@ static indigo_error_t ind_ofdpa_port_features_set(of_port_no_t port,
   return INDIGO_ERROR_NONE;
 }
 
-/* Set the port description in LOCI structure
- * Parameters:
- *    port          (input)   Port number
- *    of_port_desc  (output)  Port description LOCI object
+/*
+ * Port description cache
+ *
+ * The MAC, name and maximum speed of a port do not change while it
+ * exists, so they are read from OF-DPA once and dropped when the port
+ * is created or deleted. Config, state, features and current speed
+ * change with the link and are always read.
  */
-static indigo_error_t ind_ofdpa_port_desc_set(of_port_no_t port, of_port_desc_t *of_port_desc)
+typedef struct ind_ofdpa_port_desc_cache_entry_s
+{
+  uint32_t       port;
+  of_mac_addr_t  mac;
+  char           name[OFDPA_PORT_NAME_STRING_SIZE];
+  uint32_t       max_speed;
+} ind_ofdpa_port_desc_cache_entry_t;
+
+static struct
+{
+  ind_ofdpa_port_desc_cache_entry_t *entries;
+  int                               count;
+  int                               size;
+  uint64_t                          hits;
+  uint64_t                          misses;
+} ind_ofdpa_port_desc_cache;
+
+static ind_ofdpa_port_desc_cache_entry_t *ind_ofdpa_port_desc_cache_find(uint32_t port)
+{
+  int i;
+
+  for (i = 0; i < ind_ofdpa_port_desc_cache.count; i++)
+  {
+    if (ind_ofdpa_port_desc_cache.entries[i].port == port)
+    {
+      return &ind_ofdpa_port_desc_cache.entries[i];
+    }
+  }
+
+  return NULL;
+}
+
+static void ind_ofdpa_port_desc_cache_invalidate(uint32_t port)
+{
+  ind_ofdpa_port_desc_cache_entry_t *entry = ind_ofdpa_port_desc_cache_find(port);
+
+  if (entry != NULL)
+  {
+    *entry = ind_ofdpa_port_desc_cache.entries[--ind_ofdpa_port_desc_cache.count];
+  }
+}
+
+/* Read the fields that do not change while the port exists */
+static ind_ofdpa_port_desc_cache_entry_t *ind_ofdpa_port_desc_cache_get(uint32_t port)
 {
   OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
-  indigo_error_t err = INDIGO_ERROR_NONE;
+  ind_ofdpa_port_desc_cache_entry_t *entry;
   ofdpaMacAddr_t mac;
-  of_mac_addr_t of_mac;
   ofdpa_buffdesc nameDesc;
-  OFDPA_PORT_STATE_t  state = 0;
-  OFDPA_PORT_CONFIG_t config = 0;
-  char buff[64];
-  uint32_t speed;
+  bool complete = true;
 
-  /* Set the port description parameters in LOCI structure */
+  entry = ind_ofdpa_port_desc_cache_find(port);
+  if (entry != NULL)
+  {
+    ind_ofdpa_port_desc_cache.hits++;
+    return entry;
+  }
+  ind_ofdpa_port_desc_cache.misses++;
 
-  /* Port ID */
-  of_port_desc_port_no_set(of_port_desc, port);
+  if (ind_ofdpa_port_desc_cache.count == ind_ofdpa_port_desc_cache.size)
+  {
+    int size = ind_ofdpa_port_desc_cache.size ? ind_ofdpa_port_desc_cache.size * 2 : 64;
+    ind_ofdpa_port_desc_cache.entries =
+      aim_realloc(ind_ofdpa_port_desc_cache.entries, size * sizeof(*entry));
+    AIM_TRUE_OR_DIE(ind_ofdpa_port_desc_cache.entries != NULL);
+    ind_ofdpa_port_desc_cache.size = size;
+  }
+  entry = &ind_ofdpa_port_desc_cache.entries[ind_ofdpa_port_desc_cache.count];
+  memset(entry, 0, sizeof(*entry));
+  entry->port = port;
 
   /* Port MAC */
-  ofdpa_rv = ofdpaPortMacGet(port, &mac);
+  memset(&mac, 0, sizeof(mac));
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortMacGet, port, &mac);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to get Port MAC. (ofdpa_rv = %d)\n", ofdpa_rv);
+    complete = false;
   }
-  memcpy(&of_mac, &mac, sizeof(of_mac));
-  of_port_desc_hw_addr_set(of_port_desc, of_mac);
+  memcpy(&entry->mac, &mac, sizeof(entry->mac));
 
   /* Port Name */
-  memset(buff, 0, sizeof(buff));
-  nameDesc.pstart = buff;
+  nameDesc.pstart = entry->name;
   nameDesc.size = OFDPA_PORT_NAME_STRING_SIZE;
-  ofdpa_rv = ofdpaPortNameGet(port, &nameDesc);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortNameGet, port, &nameDesc);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to get Port Name. (ofdpa_rv = %d)\n", ofdpa_rv);
+    complete = false;
   }
-  of_port_desc_name_set(of_port_desc, nameDesc.pstart);
+  entry->name[OFDPA_PORT_NAME_STRING_SIZE - 1] = '\0';
+
+  /* Port Maximum Speed in kbps */
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortMaxSpeedGet, port, &entry->max_speed);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to get Port Max Speed. (ofdpa_rv = %d)\n", ofdpa_rv);
+    complete = false;
+  }
+
+  /* Only keep what was read in full, so a failure is retried next time */
+  if (complete)
+  {
+    ind_ofdpa_port_desc_cache.count++;
+  }
+
+  return entry;
+}
+
+/* Set the port description in LOCI structure
+ * Parameters:
+ *    port          (input)   Port number
+ *    of_port_desc  (output)  Port description LOCI object
+ */
+static indigo_error_t ind_ofdpa_port_desc_set(of_port_no_t port, of_port_desc_t *of_port_desc)
+{
+  OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  ind_ofdpa_port_desc_cache_entry_t *cached;
+  of_port_name_t name;
+  OFDPA_PORT_STATE_t  state = 0;
+  OFDPA_PORT_CONFIG_t config = 0;
+  uint32_t speed;
+
+  /* Set the port description parameters in LOCI structure */
+
+  /* Port ID */
+  of_port_desc_port_no_set(of_port_desc, port);
+
+  /* Port MAC, Name and Maximum Speed in kbps */
+  cached = ind_ofdpa_port_desc_cache_get(port);
+  of_port_desc_hw_addr_set(of_port_desc, cached->mac);
+  memset(name, 0, sizeof(name));
+  memcpy(name, cached->name, sizeof(cached->name));
+  of_port_desc_name_set(of_port_desc, name);
+  of_port_desc_max_speed_set(of_port_desc, cached->max_speed);
 
   /* Port Config*/
-  ofdpa_rv = ofdpaPortConfigGet(port, &config);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortConfigGet, port, &config);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to get Port Admin State. (ofdpa_rv = %d)\n", ofdpa_rv);
@@ -289,7 +1180,7 @@ static indigo_error_t ind_ofdpa_port_desc_set(of_port_no_t port, of_port_desc_t
   of_port_desc_config_set(of_port_desc, config);
 
   /* Port State */
-  ofdpa_rv = ofdpaPortStateGet(port, &state);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortStateGet, port, &state);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to get Port State. (ofdpa_rv = %d)\n", ofdpa_rv);
@@ -305,23 +1196,13 @@ static indigo_error_t ind_ofdpa_port_desc_set(of_port_no_t port, of_port_desc_t
   }
 
   /* Port Current Speed in kbps */
-  ofdpa_rv = ofdpaPortCurrSpeedGet(port, &speed);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortCurrSpeedGet, port, &speed);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to get Port Current Speed. (ofdpa_rv = %d)\n", ofdpa_rv);
   }
   of_port_desc_curr_speed_set(of_port_desc, speed);
 
-
-  /* Port Maximum Speed in kbps */
-  speed = 0;
-  ofdpa_rv = ofdpaPortMaxSpeedGet(port, &speed);
-  if (ofdpa_rv != OFDPA_E_NONE)
-  {
-    LOG_ERROR("Failed to get Port Max Speed. (ofdpa_rv = %d)\n", ofdpa_rv);
-  }
-  of_port_desc_max_speed_set(of_port_desc, speed);
-
   return INDIGO_ERROR_NONE;
 }
 
@@ -346,7 +1227,46 @@ indigo_error_t indigo_port_features_get(of_features_reply_t *features)
 }
 
 
-indigo_error_t indigo_port_desc_stats_get(of_port_desc_stats_reply_t *port_desc_stats_reply)
+/*
+ * Serialized port list for port_desc replies. It is built on the first
+ * request and reused until a port event or port mod invalidates it, so
+ * controller reconnects copy a buffer instead of querying every port.
+ */
+static struct
+{
+  of_list_port_desc_t *list;
+  uint64_t            hits;
+  uint64_t            builds;
+} ind_ofdpa_port_desc_reply;
+
+/*
+ * Ports that software flooding sends to: physical ports that are not
+ * administratively down and have link. Built on first use and rebuilt
+ * after port events or port mods, so flooding a packet costs one
+ * ofdpaPktSend per port and no lookups.
+ */
+static struct
+{
+  uint32_t *ports;
+  int      count;
+  int      size;
+  bool     valid;
+} ind_ofdpa_flood_ports;
+
+static void ind_ofdpa_port_desc_reply_invalidate(void)
+{
+  if (ind_ofdpa_port_desc_reply.list != NULL)
+  {
+    of_list_port_desc_delete(ind_ofdpa_port_desc_reply.list);
+    ind_ofdpa_port_desc_reply.list = NULL;
+  }
+
+  /* Changes with the same port events and port mods */
+  ind_ofdpa_flood_ports.valid = false;
+}
+
+static indigo_error_t ind_ofdpa_port_desc_list_build(of_version_t version,
+                                                     of_list_port_desc_t **list)
 {
   indigo_error_t err = INDIGO_ERROR_NONE;
   OFDPA_ERROR_t ofdpa_rv = OFDPA_E_NONE;
@@ -354,50 +1274,82 @@ indigo_error_t indigo_port_desc_stats_get(of_port_desc_stats_reply_t *port_desc_
   of_list_port_desc_t *of_list_port_desc = 0;
   uint32_t port= 0, nextPort = 0;
 
-  LOG_TRACE("%s() called.", __FUNCTION__);
-
-  if (port_desc_stats_reply->version < OF_VERSION_1_3)
-  {
-    return INDIGO_ERROR_VERSION;
-  }
-
   /* Allocates memory for of_port_desc */
-  of_port_desc = of_port_desc_new(port_desc_stats_reply->version);
+  of_port_desc = of_port_desc_new(version);
   if (of_port_desc == NULL)
   {
     LOG_ERROR("of_port_desc_new() failed");
     return INDIGO_ERROR_RESOURCE;
   }
 
-  /* Allocates memory for of_list_port_desc */
-  of_list_port_desc = of_list_port_desc_new(port_desc_stats_reply->version);
-  if (of_list_port_desc == NULL)
+  /* Allocates memory for of_list_port_desc */
+  of_list_port_desc = of_list_port_desc_new(version);
+  if (of_list_port_desc == NULL)
+  {
+    LOG_ERROR("of_list_port_desc_new() failed");
+    of_port_desc_delete(of_port_desc);
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortNextGet, port, &nextPort);
+  while(ofdpa_rv == OFDPA_E_NONE)
+  {
+    /* Set the port description parameters in LOCI structure (of_port_desc)
+       to be sent in the reply message */
+    err = ind_ofdpa_port_desc_set(nextPort, of_port_desc);
+    if (err != INDIGO_ERROR_NONE)
+    {
+      LOG_ERROR("Failed to get OpenFlow port description for port %d.", nextPort);
+      break;
+    }
+
+    if (of_list_port_desc_append(of_list_port_desc, of_port_desc) < 0)
+    {
+      LOG_ERROR("of_list_port_desc_append() failed");
+      err = INDIGO_ERROR_UNKNOWN;
+      break;
+    }
+    port = nextPort;
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaPortNextGet, port, &nextPort);
+  }
+
+  of_port_desc_delete(of_port_desc);
+
+  *list = of_list_port_desc;
+  return err;
+}
+
+indigo_error_t indigo_port_desc_stats_get(of_port_desc_stats_reply_t *port_desc_stats_reply)
+{
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  of_list_port_desc_t *of_list_port_desc = 0;
+
+  LOG_TRACE("%s() called.", __FUNCTION__);
+
+  if (port_desc_stats_reply->version < OF_VERSION_1_3)
+  {
+    return INDIGO_ERROR_VERSION;
+  }
+
+  if (ind_ofdpa_port_desc_reply.list != NULL &&
+      ind_ofdpa_port_desc_reply.list->version != port_desc_stats_reply->version)
   {
-    LOG_ERROR("of_list_port_desc_new() failed");
-    of_port_desc_delete(of_port_desc);
-    return INDIGO_ERROR_RESOURCE;
+    ind_ofdpa_port_desc_reply_invalidate();
   }
 
-  ofdpa_rv = ofdpaPortNextGet(port, &nextPort);
-  while(ofdpa_rv == OFDPA_E_NONE)
+  if (ind_ofdpa_port_desc_reply.list != NULL)
   {
-    /* Set the port description parameters in LOCI structure (of_port_desc)
-       to be sent in the reply message */
-    err = ind_ofdpa_port_desc_set(nextPort, of_port_desc);
-    if (err != INDIGO_ERROR_NONE)
-    {
-      LOG_ERROR("Failed to get OpenFlow port description for port %d.", nextPort);
-      break;
-    }
-
-    if (of_list_port_desc_append(of_list_port_desc, of_port_desc) < 0)
+    ind_ofdpa_port_desc_reply.hits++;
+    of_list_port_desc = ind_ofdpa_port_desc_reply.list;
+  }
+  else
+  {
+    ind_ofdpa_port_desc_reply.builds++;
+    err = ind_ofdpa_port_desc_list_build(port_desc_stats_reply->version, &of_list_port_desc);
+    if (err == INDIGO_ERROR_RESOURCE)
     {
-      LOG_ERROR("of_list_port_desc_append() failed");
-      err = INDIGO_ERROR_UNKNOWN;
-      break;
+      return err;
     }
-    port = nextPort;
-    ofdpa_rv = ofdpaPortNextGet(port, &nextPort);
   }
 
   if (of_port_desc_stats_reply_entries_set(port_desc_stats_reply, of_list_port_desc) < 0)
@@ -406,9 +1358,18 @@ indigo_error_t indigo_port_desc_stats_get(of_port_desc_stats_reply_t *port_desc_
     err = INDIGO_ERROR_UNKNOWN;
   }
 
-  /* free the allocated memory */
-  of_port_desc_delete(of_port_desc);
-  of_list_port_desc_delete(of_list_port_desc);
+  /* Keep a complete list for the next request; a partial one is rebuilt */
+  if (of_list_port_desc != ind_ofdpa_port_desc_reply.list)
+  {
+    if (err == INDIGO_ERROR_NONE)
+    {
+      ind_ofdpa_port_desc_reply.list = of_list_port_desc;
+    }
+    else
+    {
+      of_list_port_desc_delete(of_list_port_desc);
+    }
+  }
 
   return err;
 }
@@ -428,7 +1389,7 @@ indigo_error_t indigo_port_modify(of_port_mod_t *port_mod)
   of_port_mod_port_no_get(port_mod, &of_port_no);
 
   /* Check if the port hardware address is the same. Sanity check */
-  ofdpa_rv = ofdpaPortMacGet(of_port_no, &mac);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortMacGet, of_port_no, &mac);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to get MAC address on port %d. (ofdpa_rv = %d)", of_port_no, ofdpa_rv);
@@ -447,7 +1408,10 @@ indigo_error_t indigo_port_modify(of_port_mod_t *port_mod)
 
   of_config &= of_mask;
 
-  ofdpa_rv = ofdpaPortConfigSet(of_port_no, of_config);
+  /* Config and advertised features change below */
+  ind_ofdpa_port_desc_reply_invalidate();
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortConfigSet, of_port_no, of_config);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to set config state on port %d. (ofdpa_rv = %d)", of_port_no, ofdpa_rv);
@@ -456,7 +1420,7 @@ indigo_error_t indigo_port_modify(of_port_mod_t *port_mod)
 
   /* Set advertise features */
   of_port_mod_advertise_get(port_mod, &of_advertise);
-  ofdpa_rv = ofdpaPortAdvertiseFeatureSet(of_port_no, of_advertise);
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaPortAdvertiseFeatureSet, of_port_no, of_advertise);
   if (ofdpa_rv != OFDPA_E_NONE)
   {
     LOG_ERROR("Failed to set advertise features on port %d. (ofdpa_rv = %d)", of_port_no, ofdpa_rv);
@@ -497,12 +1461,27 @@ indigo_error_t indigo_port_stats_get(of_port_stats_request_t *port_stats_request
   *port_stats_reply = reply;
 
   of_list_port_stats_entry_t list;
+  of_list_builder_t builder;
   of_port_stats_reply_entries_bind(*port_stats_reply, &list);
+  of_list_builder_start(&builder, &list);
 
   of_port_stats_request_port_no_get(port_stats_request, &req_of_port_num);
+  if (req_of_port_num == OF_PORT_DEST_NONE_BY_VERSION(port_stats_request->version) &&
+      ind_ofdpa_port_stats_cache.interval_ms != 0 &&
+      ind_ofdpa_port_stats_cache_reply(&list, &err))
+  {
+    of_list_builder_finish(&builder);
+    if (err != INDIGO_ERROR_NONE)
+    {
+      of_port_stats_reply_delete(*port_stats_reply);
+      *port_stats_reply = NULL;
+    }
+    return err;
+  }
+
   if (req_of_port_num == OF_PORT_DEST_NONE_BY_VERSION(port_stats_request->version))
   {
-    ofdpa_rv = ofdpaPortNextGet(0, &port);
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaPortNextGet, 0, &port);
     if (ofdpa_rv != OFDPA_E_NONE)
     {
       LOG_ERROR("Failed to get first port.");
@@ -532,7 +1511,9 @@ indigo_error_t indigo_port_stats_get(of_port_stats_request_t *port_stats_request
       break;
     }
 
-  }while((ofdpaPortNextGet(port, &port) == OFDPA_E_NONE));
+  }while((IND_OFDPA_RPC(ofdpaPortNextGet, port, &port) == OFDPA_E_NONE));
+
+  of_list_builder_finish(&builder);
 
   /* Free the reply message only on failure.
      Reply message is freed by the caller on success */
@@ -555,8 +1536,8 @@ indigo_error_t indigo_port_queue_config_get(of_queue_get_config_request_t *queue
   of_packet_queue_t *of_packet_queue;
   of_list_packet_queue_t *of_list_packet_queue;
 
+  ind_ofdpa_queue_config_cache_entry_t *config;
   uint32_t queueId = 0;
-  uint32_t numQueues = 0;
   uint32_t dump_all = 0;
   uint32_t port;
 
@@ -606,7 +1587,7 @@ indigo_error_t indigo_port_queue_config_get(of_queue_get_config_request_t *queue
   /* Check if the port is OFPP_ANY */
   if (req_of_port_num == OF_PORT_DEST_WILDCARD_BY_VERSION(queue_config_request->version))
   {
-    ofdpa_rv = ofdpaPortNextGet(0, &port);
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaPortNextGet, 0, &port);
     if (ofdpa_rv != OFDPA_E_NONE)
     {
       LOG_ERROR("Error geting first port. (ofdpa_rv = %d)", ofdpa_rv);
@@ -625,23 +1606,16 @@ indigo_error_t indigo_port_queue_config_get(of_queue_get_config_request_t *queue
     {
       of_queue_get_config_reply_port_set(*queue_config_reply, port);
       /* Set the of_packet_queue struct elements */
-      ofdpa_rv = ofdpaNumQueuesGet(port, &numQueues);
-      if (ofdpa_rv != OFDPA_E_NONE)
+      err = ind_ofdpa_queue_config_cache_get(port, &config);
+      if (err != INDIGO_ERROR_NONE)
       {
-        LOG_ERROR("Error getting maximum queues supported on port %d. (ofdpa_rv = %d)", port, ofdpa_rv);
-        err = indigoConvertOfdpaRv(ofdpa_rv);
         break;
       }
-      for (queueId = 0; queueId < numQueues; queueId++)
+      for (queueId = 0; queueId < config->numQueues; queueId++)
       {
-        err = ind_ofdpa_queue_config_queue_set(of_packet_queue, port, queueId);
-        if (err != INDIGO_ERROR_NONE)
-        {
-          LOG_ERROR("Error setting of_packet_queue. (err = %d)", err);
-          err = indigoConvertOfdpaRv(ofdpa_rv);
-          break;
-        }
-
+        ind_ofdpa_queue_config_queue_set(of_packet_queue, port, queueId,
+                                         config->rates[queueId].minRate,
+                                         config->rates[queueId].maxRate);
         of_list_packet_queue_append(of_list_packet_queue, of_packet_queue);
       }
 
@@ -649,7 +1623,7 @@ indigo_error_t indigo_port_queue_config_get(of_queue_get_config_request_t *queue
       {
         break;
       }
-    }while((ofdpaPortNextGet(port, &port) == OFDPA_E_NONE) && (err == INDIGO_ERROR_NONE));
+    }while((IND_OFDPA_RPC(ofdpaPortNextGet, port, &port) == OFDPA_E_NONE) && (err == INDIGO_ERROR_NONE));
   }
 
   of_packet_queue_delete(of_packet_queue);
@@ -698,7 +1672,9 @@ indigo_error_t indigo_port_queue_stats_get(of_queue_stats_request_t *queue_stats
   *queue_stats_reply = reply;
 
   of_list_queue_stats_entry_t list[1];
+  of_list_builder_t builder;
   of_queue_stats_reply_entries_bind(*queue_stats_reply, list);
+  of_list_builder_start(&builder, list);
 
   /* Get the port id from request message */
   of_queue_stats_request_port_no_get(queue_stats_request, &req_of_port_num);
@@ -707,24 +1683,36 @@ indigo_error_t indigo_port_queue_stats_get(of_queue_stats_request_t *queue_stats
   of_queue_stats_request_queue_id_get(queue_stats_request, &req_of_port_queue_id);
 
   /* Check if the queue stats request is for ALL ports (OFPP_ANY) */
-  if (req_of_port_num == OF_PORT_DEST_WILDCARD_BY_VERSION(queue_stats_request->version))
+  all_ports = (req_of_port_num == OF_PORT_DEST_WILDCARD_BY_VERSION(queue_stats_request->version));
+
+  if (ind_ofdpa_queue_stats_cache.interval_ms != 0 &&
+      ind_ofdpa_queue_stats_cache_reply(req_of_port_num, all_ports, req_of_port_queue_id, list, &err))
+  {
+    of_list_builder_finish(&builder);
+    if (err != INDIGO_ERROR_NONE)
+    {
+      of_queue_stats_reply_delete(*queue_stats_reply);
+      *queue_stats_reply = NULL;
+    }
+    return err;
+  }
+
+  if (all_ports)
   {
     /* Get the first port if the queue stats message is for all the ports*/
-    ofdpa_rv = ofdpaPortNextGet(0, &port);
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaPortNextGet, 0, &port);
     if (ofdpa_rv != OFDPA_E_NONE)
     {
       LOG_ERROR("Failed to get first port. (ofdpa_rv = %d)", ofdpa_rv);
       of_queue_stats_reply_delete(*queue_stats_reply);
       return (indigoConvertOfdpaRv(ofdpa_rv));
     }
-    all_ports = 1;
   }
   else
   {
     port = req_of_port_num;
   }
 
-
   do
   {
     err = ind_ofdpa_queue_stats_set(port, req_of_port_queue_id, list);
@@ -739,7 +1727,9 @@ indigo_error_t indigo_port_queue_stats_get(of_queue_stats_request_t *queue_stats
       break;
     }
 
-  }while(ofdpaPortNextGet(port, &port) == OFDPA_E_NONE);
+  }while(IND_OFDPA_RPC(ofdpaPortNextGet, port, &port) == OFDPA_E_NONE);
+
+  of_list_builder_finish(&builder);
 
   /* Free the reply message only on failure.
      Reply message is freed by the caller on success */
@@ -775,14 +1765,87 @@ indigo_error_t indigo_port_interface_remove(indigo_port_name_t port_name)
 
 indigo_error_t indigo_port_interface_list(indigo_port_info_t** list)
 {
-  LOG_ERROR("indigo_port_interface_list() unsupported.");
-  return INDIGO_ERROR_NOT_SUPPORTED;
+  OFDPA_ERROR_t ofdpa_rv;
+  ofdpa_buffdesc nameDesc;
+  char buff[OFDPA_PORT_NAME_STRING_SIZE];
+  indigo_port_info_t *head = NULL, **tail = &head;
+  uint32_t port = 0;
+
+  while (IND_OFDPA_RPC(ofdpaPortNextGet, port, &port) == OFDPA_E_NONE)
+  {
+    indigo_port_info_t *info = aim_zmalloc(sizeof(*info));
+
+    info->of_port = port;
+
+    memset(buff, 0, sizeof(buff));
+    nameDesc.pstart = buff;
+    nameDesc.size = OFDPA_PORT_NAME_STRING_SIZE;
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaPortNameGet, port, &nameDesc);
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_TRACE("Failed to get Port Name. (ofdpa_rv = %d)", ofdpa_rv);
+    }
+    strncpy(info->port_name, buff, sizeof(info->port_name) - 1);
+
+    *tail = info;
+    tail = &info->next;
+  }
+
+  *list = head;
+  return INDIGO_ERROR_NONE;
 }
 
 void indigo_port_interface_list_destroy(indigo_port_info_t* list)
 {
-  LOG_ERROR("indigo_port_interface_list_destroy() unsupported.");
-  return;
+  indigo_port_info_t *next;
+
+  for (; list != NULL; list = next)
+  {
+    next = list->next;
+    aim_free(list);
+  }
+}
+
+void indigo_port_extended_stats_get(of_port_no_t port_no,
+                                    indigo_fi_port_stats_t *port_stats)
+{
+  ind_ofdpa_port_stats_snapshot_t *current = ind_ofdpa_port_stats_cache_fresh();
+  ofdpaPortStats_t live, *stats = NULL;
+  ind_ofdpa_port_rates_t rates;
+
+  if (current != NULL)
+  {
+    stats = ind_ofdpa_port_stats_snapshot_find(current, port_no);
+  }
+  if (stats == NULL)
+  {
+    memset(&live, 0, sizeof(live));
+    if (IND_OFDPA_RPC(ofdpaPortStatsGet, port_no, &live) != OFDPA_E_NONE)
+    {
+      return;
+    }
+    stats = &live;
+  }
+
+  /* OF-DPA does not split packets by destination type */
+  port_stats->rx_bytes = stats->rx_bytes;
+  port_stats->rx_dropped = stats->rx_drops;
+  port_stats->rx_errors = stats->rx_errors;
+  port_stats->tx_bytes = stats->tx_bytes;
+  port_stats->tx_dropped = stats->tx_drops;
+  port_stats->tx_errors = stats->tx_errors;
+
+  if (ind_ofdpa_port_stats_rates_get(port_no, &rates))
+  {
+    port_stats->rx_packets_rate = rates.rx_packets;
+    port_stats->rx_bits_rate = rates.rx_bits;
+    port_stats->rx_errors_rate = rates.rx_errors;
+    port_stats->tx_packets_rate = rates.tx_packets;
+    port_stats->tx_bits_rate = rates.tx_bits;
+    port_stats->tx_errors_rate = rates.tx_errors;
+    port_stats->rate_interval_ms = rates.interval_ms;
+    port_stats->rate_age_ms = rates.age_ms;
+  }
 }
 
 indigo_error_t indigo_port_experimenter(of_experimenter_t *experimenter,
@@ -792,94 +1855,445 @@ indigo_error_t indigo_port_experimenter(of_experimenter_t *experimenter,
   return INDIGO_ERROR_NOT_SUPPORTED;
 }
 
+static void ind_ofdpa_flood_ports_build(void)
+{
+  OFDPA_PORT_CONFIG_t config;
+  OFDPA_PORT_STATE_t state;
+  uint32_t port = 0;
+  uint32_t type;
+
+  ind_ofdpa_flood_ports.count = 0;
+
+  while (IND_OFDPA_RPC(ofdpaPortNextGet, port, &port) == OFDPA_E_NONE)
+  {
+    ofdpaPortTypeGet(port, &type);
+    if (type != OFDPA_PORT_TYPE_PHYSICAL)
+    {
+      continue;
+    }
+
+    config = 0;
+    state = 0;
+    if (IND_OFDPA_RPC(ofdpaPortConfigGet, port, &config) != OFDPA_E_NONE ||
+        IND_OFDPA_RPC(ofdpaPortStateGet, port, &state) != OFDPA_E_NONE ||
+        (config & OFDPA_PORT_CONFIG_DOWN) ||
+        (state & (OFDPA_PORT_STATE_LINK_DOWN | OFDPA_PORT_STATE_BLOCKED)))
+    {
+      continue;
+    }
+
+    if (ind_ofdpa_flood_ports.count == ind_ofdpa_flood_ports.size)
+    {
+      int size = ind_ofdpa_flood_ports.size ? ind_ofdpa_flood_ports.size * 2 : 64;
+      ind_ofdpa_flood_ports.ports =
+        aim_realloc(ind_ofdpa_flood_ports.ports, size * sizeof(uint32_t));
+      AIM_TRUE_OR_DIE(ind_ofdpa_flood_ports.ports != NULL);
+      ind_ofdpa_flood_ports.size = size;
+    }
+    ind_ofdpa_flood_ports.ports[ind_ofdpa_flood_ports.count++] = port;
+  }
+
+  ind_ofdpa_flood_ports.valid = true;
+}
+
 indigo_error_t indigo_port_packet_emit(of_port_no_t egress_port,
                                        unsigned queue_id,
                                        uint8_t *data,
                                        unsigned length)
 {
-  LOG_ERROR("indigo_port_packet_emit() unsupported.");
-  return INDIGO_ERROR_NOT_SUPPORTED;
+  ofdpa_buffdesc pkt;
+
+  pkt.pstart = (char *)data;
+  pkt.size = length;
+
+  return indigoConvertOfdpaRv(IND_OFDPA_RPC(ofdpaPktSend, &pkt, 0, egress_port, 0));
 }
 
 indigo_error_t indigo_port_packet_emit_all(of_port_no_t skip_egress_port,
                                            uint8_t *data,
                                            unsigned length)
 {
-  LOG_ERROR("indigo_port_packet_emit_all() unsupported.");
-  return INDIGO_ERROR_NOT_SUPPORTED;
+  OFDPA_ERROR_t ofdpa_rv;
+  OFDPA_ERROR_t last_rv = OFDPA_E_NONE;
+  ofdpa_buffdesc pkt;
+  int i;
+
+  if (!ind_ofdpa_flood_ports.valid)
+  {
+    ind_ofdpa_flood_ports_build();
+  }
+
+  pkt.pstart = (char *)data;
+  pkt.size = length;
+
+  for (i = 0; i < ind_ofdpa_flood_ports.count; i++)
+  {
+    if (ind_ofdpa_flood_ports.ports[i] == skip_egress_port)
+    {
+      continue;
+    }
+
+    ofdpa_rv = IND_OFDPA_RPC(ofdpaPktSend, &pkt, 0, ind_ofdpa_flood_ports.ports[i], 0);
+    if (ofdpa_rv != OFDPA_E_NONE)
+    {
+      LOG_TRACE("Packet send to port %d failed. (ofdpa_rv = %d)",
+                ind_ofdpa_flood_ports.ports[i], ofdpa_rv);
+      last_rv = ofdpa_rv;
+    }
+  }
+
+  return indigoConvertOfdpaRv(last_rv);
+}
+
+/* Output port of an L2 (unfiltered) interface group, from its single bucket */
+static OFDPA_ERROR_t ind_ofdpa_group_output_port_get(uint32_t group_id, uint32_t *port,
+                                                     uint32_t *pop_vlan)
+{
+  ofdpaGroupBucketEntry_t bucket;
+  OFDPA_ERROR_t ofdpa_rv;
+  uint32_t type;
+
+  ofdpaGroupTypeGet(group_id, &type);
+  if (type != OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE &&
+      type != OFDPA_GROUP_ENTRY_TYPE_L2_UNFILTERED_INTERFACE)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  memset(&bucket, 0, sizeof(bucket));
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryFirstGet, group_id, &bucket);
+  if (ofdpa_rv == OFDPA_E_NONE)
+  {
+    if (type == OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE)
+    {
+      *port = bucket.bucketData.l2Interface.outputPort;
+      *pop_vlan = bucket.bucketData.l2Interface.popVlanTag;
+    }
+    else
+    {
+      *port = bucket.bucketData.l2UnfilteredInterface.outputPort;
+      *pop_vlan = 0;
+    }
+  }
+
+  return ofdpa_rv;
+}
+
+/* Bytes of the 802.1Q tag after the MAC addresses */
+#define IND_OFDPA_VLAN_TAG_LEN 4
+
+/*
+ * Packet to send through an L2 interface group. If the group pops the
+ * VLAN tag and the packet has one, the untagged copy is built into
+ * *untagged on first use and returned.
+ */
+static ofdpa_buffdesc *ind_ofdpa_group_pkt_get(ofdpa_buffdesc *pkt,
+                                               ofdpa_buffdesc *untagged,
+                                               uint32_t pop_vlan)
+{
+  uint8_t *data = (uint8_t *)pkt->pstart;
+
+  if (!pop_vlan ||
+      pkt->size < ETH_HLEN + IND_OFDPA_VLAN_TAG_LEN ||
+      ((data[12] << 8) | data[13]) != ETH_P_8021Q)
+  {
+    return pkt;
+  }
+
+  if (untagged->pstart == NULL)
+  {
+    untagged->pstart = aim_malloc(pkt->size - IND_OFDPA_VLAN_TAG_LEN);
+    AIM_TRUE_OR_DIE(untagged->pstart != NULL);
+    untagged->size = pkt->size - IND_OFDPA_VLAN_TAG_LEN;
+    memcpy(untagged->pstart, data, 2 * ETH_ALEN);
+    memcpy(untagged->pstart + 2 * ETH_ALEN,
+           data + 2 * ETH_ALEN + IND_OFDPA_VLAN_TAG_LEN,
+           pkt->size - 2 * ETH_ALEN - IND_OFDPA_VLAN_TAG_LEN);
+  }
+
+  return untagged;
 }
 
+/*
+ * Sends to the ports of an L2 interface group, or of the L2 interface
+ * groups an L2 flood or multicast group references, skipping the ingress
+ * port. An interface group that pops the VLAN tag gets the packet with
+ * its 802.1Q tag removed. Other group types need the pipeline.
+ */
 indigo_error_t indigo_port_packet_emit_group(uint32_t group_id,
                                              of_port_no_t ingress_port_num,
                                              uint8_t *data,
                                              unsigned len)
 {
-  LOG_ERROR("indigo_port_packet_emit_group() unsupported.");
-  return INDIGO_ERROR_NOT_SUPPORTED;
+  OFDPA_ERROR_t ofdpa_rv;
+  OFDPA_ERROR_t last_rv = OFDPA_E_NONE;
+  ofdpaGroupBucketEntry_t bucket;
+  ofdpa_buffdesc pkt;
+  ofdpa_buffdesc untagged = { 0 };
+  uint32_t type;
+  uint32_t port;
+  uint32_t pop_vlan;
+
+  pkt.pstart = (char *)data;
+  pkt.size = len;
+
+  ofdpaGroupTypeGet(group_id, &type);
+  switch (type)
+  {
+    case OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE:
+    case OFDPA_GROUP_ENTRY_TYPE_L2_UNFILTERED_INTERFACE:
+      ofdpa_rv = ind_ofdpa_group_output_port_get(group_id, &port, &pop_vlan);
+      if (ofdpa_rv != OFDPA_E_NONE)
+      {
+        return indigoConvertOfdpaRv(ofdpa_rv);
+      }
+      if (port == ingress_port_num)
+      {
+        return INDIGO_ERROR_NONE;
+      }
+      last_rv = IND_OFDPA_RPC(ofdpaPktSend,
+                              ind_ofdpa_group_pkt_get(&pkt, &untagged, pop_vlan),
+                              0, port, 0);
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_FLOOD:
+    case OFDPA_GROUP_ENTRY_TYPE_L2_MULTICAST:
+      memset(&bucket, 0, sizeof(bucket));
+      ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryFirstGet, group_id, &bucket);
+      while (ofdpa_rv == OFDPA_E_NONE)
+      {
+        if (ind_ofdpa_group_output_port_get(bucket.referenceGroupId,
+                                            &port, &pop_vlan) == OFDPA_E_NONE &&
+            port != ingress_port_num)
+        {
+          ofdpa_rv = IND_OFDPA_RPC(ofdpaPktSend,
+                                   ind_ofdpa_group_pkt_get(&pkt, &untagged, pop_vlan),
+                                   0, port, 0);
+          if (ofdpa_rv != OFDPA_E_NONE)
+          {
+            LOG_TRACE("Packet send to port %d failed. (ofdpa_rv = %d)", port, ofdpa_rv);
+            last_rv = ofdpa_rv;
+          }
+        }
+        ofdpa_rv = IND_OFDPA_RPC(ofdpaGroupBucketEntryNextGet, group_id,
+                                 bucket.bucketIndex, &bucket);
+      }
+      break;
+
+    default:
+      LOG_ERROR("Cannot emit to group 0x%x of type %d", group_id, type);
+      return INDIGO_ERROR_NOT_SUPPORTED;
+  }
+
+  aim_free(untagged.pstart);
+  return indigoConvertOfdpaRv(last_rv);
 }
 
-void
-ind_ofdpa_port_event_receive(void)
+/*
+ * Port status coalescing
+ *
+ * Port events are collected per port and a single port_status with the
+ * latest state is sent for each port, either at the end of the batch of
+ * events or, with a window configured, when the window that the first
+ * event opened closes. A create or delete outranks a state change.
+ */
+typedef struct ind_ofdpa_port_status_pending_s
 {
-  of_port_desc_t   *of_port_desc   = 0;
-  of_port_status_t *of_port_status = 0;
-  ofdpaPortEvent_t portEventData;
-  int reason = 0;
+  uint32_t port;
+  int      reason;
+} ind_ofdpa_port_status_pending_t;
 
-  LOG_TRACE("Reading Port Events");
+static struct
+{
+  int                             window_ms;  /* 0 sends at the end of each batch */
+  ind_ofdpa_port_status_pending_t *pending;
+  int                             count;
+  int                             size;
+  bool                            timer_armed;
+  uint64_t                        events;
+  uint64_t                        sent;
+} ind_ofdpa_port_status;
+
+static void ind_ofdpa_port_status_add(uint32_t port, uint32_t eventMask)
+{
+  ind_ofdpa_port_status_pending_t *pending = NULL;
+  int reason;
+  int i;
 
-  memset(&portEventData, 0, sizeof(portEventData));
-  while (ofdpaPortEventNextGet(&portEventData) == OFDPA_E_NONE)
+  if (eventMask & OFDPA_EVENT_PORT_CREATE)
   {
-    LOG_TRACE("client_event: retrieved port event: port no = %d, eventMask = 0x%x, state = %d\n",
-              portEventData.portNum, portEventData.eventMask, portEventData.state);
+    reason = OF_PORT_CHANGE_REASON_ADD;
+    ind_ofdpa_port_desc_cache_invalidate(port);
+    ind_ofdpa_queue_config_cache_invalidate(port);
+  }
+  else if (eventMask & OFDPA_EVENT_PORT_DELETE)
+  {
+    reason = OF_PORT_CHANGE_REASON_DELETE;
+  }
+  else
+  {
+    reason = OF_PORT_CHANGE_REASON_MODIFY;
+  }
 
-    of_port_desc = of_port_desc_new(ofagent_of_version);
-    if (of_port_desc == 0)
+  for (i = 0; i < ind_ofdpa_port_status.count; i++)
+  {
+    if (ind_ofdpa_port_status.pending[i].port == port)
     {
-      LOG_ERROR("of_port_desc_new() failed");
+      pending = &ind_ofdpa_port_status.pending[i];
       break;
     }
+  }
 
-    if ((ind_ofdpa_port_desc_set(portEventData.portNum, of_port_desc)) < 0)
+  if (pending == NULL)
+  {
+    if (ind_ofdpa_port_status.count == ind_ofdpa_port_status.size)
     {
-      LOG_ERROR("ind_ofdpa_port_desc_set() failed");
-      break;
+      int size = ind_ofdpa_port_status.size ? ind_ofdpa_port_status.size * 2 : 64;
+      ind_ofdpa_port_status.pending =
+        aim_realloc(ind_ofdpa_port_status.pending, size * sizeof(*pending));
+      AIM_TRUE_OR_DIE(ind_ofdpa_port_status.pending != NULL);
+      ind_ofdpa_port_status.size = size;
     }
+    pending = &ind_ofdpa_port_status.pending[ind_ofdpa_port_status.count++];
+    pending->port = port;
+    pending->reason = reason;
+  }
+  else if (reason != OF_PORT_CHANGE_REASON_MODIFY)
+  {
+    pending->reason = reason;
+  }
+}
 
-    of_port_status = of_port_status_new(ofagent_of_version);
-    if (of_port_status == 0)
-    {
-      LOG_ERROR("of_port_status_new() failed");
-      break;
-    }
+static void ind_ofdpa_port_status_send(uint32_t port, int reason)
+{
+  of_port_desc_t   *of_port_desc;
+  of_port_status_t *of_port_status;
 
-    if (portEventData.eventMask & OFDPA_EVENT_PORT_CREATE)
-    {
-      reason = OF_PORT_CHANGE_REASON_ADD;
-    }
-    else if (portEventData.eventMask & OFDPA_EVENT_PORT_DELETE)
+  of_port_desc = of_port_desc_new(ofagent_of_version);
+  if (of_port_desc == 0)
+  {
+    LOG_ERROR("of_port_desc_new() failed");
+    return;
+  }
+
+  if ((ind_ofdpa_port_desc_set(port, of_port_desc)) < 0)
+  {
+    LOG_ERROR("ind_ofdpa_port_desc_set() failed");
+    of_port_desc_delete(of_port_desc);
+    return;
+  }
+
+  of_port_status = of_port_status_new(ofagent_of_version);
+  if (of_port_status == 0)
+  {
+    LOG_ERROR("of_port_status_new() failed");
+    of_port_desc_delete(of_port_desc);
+    return;
+  }
+
+  of_port_status_reason_set(of_port_status, reason);
+  of_port_status_desc_set(of_port_status, of_port_desc);
+  of_port_desc_delete(of_port_desc);
+
+  indigo_core_port_status_update(of_port_status);  /* Takes ownership */
+  ind_ofdpa_port_status.sent++;
+}
+
+static void ind_ofdpa_port_status_flush(void)
+{
+  int i;
+
+  ind_ofdpa_port_desc_reply_invalidate();
+
+  for (i = 0; i < ind_ofdpa_port_status.count; i++)
+  {
+    ind_ofdpa_port_status_send(ind_ofdpa_port_status.pending[i].port,
+                               ind_ofdpa_port_status.pending[i].reason);
+    if (ind_ofdpa_port_status.pending[i].reason == OF_PORT_CHANGE_REASON_DELETE)
     {
-      reason = OF_PORT_CHANGE_REASON_DELETE;
+      ind_ofdpa_port_desc_cache_invalidate(ind_ofdpa_port_status.pending[i].port);
+      ind_ofdpa_queue_config_cache_invalidate(ind_ofdpa_port_status.pending[i].port);
     }
-    else if (portEventData.eventMask & OFDPA_EVENT_PORT_STATE)
+  }
+  ind_ofdpa_port_status.count = 0;
+}
+
+static void ind_ofdpa_port_status_timer(void *cookie)
+{
+  ind_soc_timer_event_unregister(ind_ofdpa_port_status_timer, NULL);
+  ind_ofdpa_port_status.timer_armed = false;
+  ind_ofdpa_port_status_flush();
+}
+
+void ind_ofdpa_port_status_window_set(int window_ms)
+{
+  ind_ofdpa_port_status.window_ms = window_ms > 0 ? window_ms : 0;
+
+  /* Don't hold back events under the old window */
+  if (ind_ofdpa_port_status.timer_armed)
+  {
+    ind_ofdpa_port_status_timer(NULL);
+  }
+}
+
+void ind_ofdpa_port_status_show(aim_pvs_t *pvs)
+{
+  aim_printf(pvs, "Port status window %d ms, %d ports pending\n",
+             ind_ofdpa_port_status.window_ms, ind_ofdpa_port_status.count);
+  aim_printf(pvs, "  events %"PRIu64" port_status sent %"PRIu64"\n",
+             ind_ofdpa_port_status.events, ind_ofdpa_port_status.sent);
+  aim_printf(pvs, "  desc cache %d ports, hits %"PRIu64" misses %"PRIu64"\n",
+             ind_ofdpa_port_desc_cache.count,
+             ind_ofdpa_port_desc_cache.hits, ind_ofdpa_port_desc_cache.misses);
+  aim_printf(pvs, "  port_desc reply %s, hits %"PRIu64" builds %"PRIu64"\n",
+             ind_ofdpa_port_desc_reply.list != NULL ? "cached" : "not cached",
+             ind_ofdpa_port_desc_reply.hits, ind_ofdpa_port_desc_reply.builds);
+}
+
+void
+ind_ofdpa_port_event_receive(void)
+{
+  ofdpaPortEvent_t portEventData;
+
+  LOG_TRACE("Reading Port Events");
+
+  memset(&portEventData, 0, sizeof(portEventData));
+  while (IND_OFDPA_RPC(ofdpaPortEventNextGet, &portEventData) == OFDPA_E_NONE)
+  {
+    LOG_TRACE("client_event: retrieved port event: port no = %d, eventMask = 0x%x, state = %d\n",
+              portEventData.portNum, portEventData.eventMask, portEventData.state);
+
+    ind_ofdpa_port_status.events++;
+
+    /* Fail over locally before the controller hears of it */
+    if (portEventData.eventMask & OFDPA_EVENT_PORT_STATE)
     {
-      reason = OF_PORT_CHANGE_REASON_MODIFY;
+      ind_ofdpa_ff_port_state(portEventData.portNum,
+                              !(portEventData.state & OFDPA_PORT_STATE_LINK_DOWN));
     }
 
-    of_port_status_reason_set(of_port_status, reason);
-    of_port_status_desc_set(of_port_status, of_port_desc);
-    of_port_desc_delete(of_port_desc);
-
-    indigo_core_port_status_update(of_port_status);
+    ind_ofdpa_port_status_add(portEventData.portNum, portEventData.eventMask);
+  }
 
-    of_port_desc   = 0;     /* No longer owned */
-    of_port_status = 0;     /* No longer owned */
+  if (ind_ofdpa_port_status.count == 0)
+  {
+    return;
   }
 
-  if (of_port_desc)
+  if (ind_ofdpa_port_status.window_ms == 0)
   {
-    of_port_desc_delete(of_port_desc);
+    ind_ofdpa_port_status_flush();
+  }
+  else if (!ind_ofdpa_port_status.timer_armed)
+  {
+    if (ind_soc_timer_event_register(ind_ofdpa_port_status_timer, NULL,
+                                     ind_ofdpa_port_status.window_ms) < 0)
+    {
+      LOG_ERROR("Failed to register port status timer");
+      ind_ofdpa_port_status_flush();
+      return;
+    }
+    ind_ofdpa_port_status.timer_armed = true;
   }
 
   return;
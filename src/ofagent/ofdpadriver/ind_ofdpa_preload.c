@@ -0,0 +1,648 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_preload.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include "ofdpa_datatypes.h"
+#include <AIM/aim.h>
+#include <Configuration/configuration.h>
+#include <indigo/of_state_manager.h>
+#include <loci/loci.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+/*
+ * Static pipeline preload from the configuration
+ *
+ * The "preload" section lists groups and flows the switch installs
+ * itself at startup, before or without a controller:
+ *     "preload": {
+ *       "cookie": "0x7072656c6f616400",
+ *       "file": "/etc/ofagent/preload.bin",
+ *       "l2_interface_groups": [ { "port": 1, "vlan": 10, "untagged": true } ],
+ *       "vlan": [ { "port": 1, "vlan": 10 } ],
+ *       "termination_mac": [ { "mac": "00:11:22:33:44:55", "vlan": 10, "port": 1 } ]
+ *     }
+ * The file is a stream of OpenFlow 1.3 group_mod and flow_mod add
+ * messages, as a controller would send them; its flows are given the
+ * cookie too. The entries built from the lists are those of the OF-DPA
+ * L2 interface group, untagged VLAN assignment and IPv4 termination MAC
+ * flows.
+ *
+ * Groups are installed before flows, and flows go through the batched
+ * forwarding path. Every preloaded flow carries the cookie, so a
+ * controller resyncing its tables can leave them alone with a cookie
+ * mask, and a flow ID in the preload range. Entries already installed,
+ * e.g. adopted by a warm start, are skipped. A reload installs the
+ * entries that were added; entries dropped from the configuration stay
+ * installed until a controller deletes them.
+ */
+
+#define IND_OFDPA_PRELOAD_SECTION "preload"
+#define IND_OFDPA_PRELOAD_COOKIE_DEFAULT 0x7072656c6f616400ULL
+
+typedef struct ind_ofdpa_preload_config_s
+{
+  of_object_t **groups;
+  int group_count;
+  of_object_t **flows;
+  int flow_count;
+} ind_ofdpa_preload_config_t;
+
+static ind_ofdpa_preload_config_t ind_ofdpa_preload_staged;
+static ind_ofdpa_preload_config_t ind_ofdpa_preload_current;
+static uint64_t ind_ofdpa_preload_cookie;
+
+/* Installing waits for a warm start to finish */
+static bool ind_ofdpa_preload_held;
+static bool ind_ofdpa_preload_waiting;
+
+static void ind_ofdpa_preload_config_clear(ind_ofdpa_preload_config_t *config)
+{
+  int i;
+
+  for (i = 0; i < config->group_count; i++)
+  {
+    of_object_delete(config->groups[i]);
+  }
+  for (i = 0; i < config->flow_count; i++)
+  {
+    of_object_delete(config->flows[i]);
+  }
+  free(config->groups);
+  free(config->flows);
+  memset(config, 0, sizeof(*config));
+}
+
+/* Takes obj */
+static indigo_error_t ind_ofdpa_preload_append(of_object_t ***objs, int *count, of_object_t *obj)
+{
+  of_object_t **grown;
+
+  if (obj == NULL)
+  {
+    return INDIGO_ERROR_RESOURCE;
+  }
+  if ((grown = realloc(*objs, (*count + 1) * sizeof(*grown))) == NULL)
+  {
+    of_object_delete(obj);
+    return INDIGO_ERROR_RESOURCE;
+  }
+  grown[(*count)++] = obj;
+  *objs = grown;
+  return INDIGO_ERROR_NONE;
+}
+
+/* Appends obj to list and frees it */
+static int ind_ofdpa_preload_list_append(of_object_t *list, of_object_t *obj)
+{
+  int rv;
+
+  if (obj == NULL)
+  {
+    return -1;
+  }
+  rv = of_list_append(list, obj);
+  of_object_delete(obj);
+  return rv;
+}
+
+/* A set-field action carrying the wire form of oxm, which is freed */
+static of_object_t *ind_ofdpa_preload_set_field_action(of_object_t *oxm)
+{
+  of_action_set_field_t *action = NULL;
+  of_octets_t octets;
+
+  if (oxm == NULL)
+  {
+    return NULL;
+  }
+  octets.data = OF_OBJECT_BUFFER_INDEX(oxm, 0);
+  octets.bytes = oxm->length;
+  if ((action = of_action_set_field_new(OF_VERSION_1_3)) != NULL &&
+      of_action_set_field_field_set(action, &octets) < 0)
+  {
+    of_object_delete(action);
+    action = NULL;
+  }
+  of_object_delete(oxm);
+  return action;
+}
+
+static of_flow_add_t *ind_ofdpa_preload_flow_new(uint8_t table_id, uint16_t priority,
+                                                 of_match_t *match,
+                                                 of_list_instruction_t *insts)
+{
+  of_flow_add_t *flow_add;
+
+  if ((flow_add = of_flow_add_new(OF_VERSION_1_3)) == NULL)
+  {
+    return NULL;
+  }
+  of_flow_add_table_id_set(flow_add, table_id);
+  of_flow_add_priority_set(flow_add, priority);
+  of_flow_add_cookie_set(flow_add, ind_ofdpa_preload_cookie);
+  of_flow_add_buffer_id_set(flow_add, OF_BUFFER_ID_NO_BUFFER);
+  of_flow_add_out_port_set(flow_add, OF_PORT_DEST_WILDCARD);
+  of_flow_add_out_group_set(flow_add, OF_GROUP_ANY);
+  if (of_flow_add_match_set(flow_add, match) < 0 ||
+      of_flow_add_instructions_set(flow_add, insts) < 0)
+  {
+    of_object_delete(flow_add);
+    return NULL;
+  }
+  return flow_add;
+}
+
+static indigo_error_t ind_ofdpa_preload_port_vlan_parse(cJSON *entry, const char *list,
+                                                        int *port, int *vlan)
+{
+  if (ind_cfg_lookup_int(entry, "port", port) != INDIGO_ERROR_NONE ||
+      ind_cfg_lookup_int(entry, "vlan", vlan) != INDIGO_ERROR_NONE ||
+      *port <= 0 || *port > 0xffff || *vlan <= 0 || *vlan > OFDPA_VID_EXACT_MASK)
+  {
+    LOG_ERROR("Config: each of " IND_OFDPA_PRELOAD_SECTION ".%s needs a port "
+              "and a vlan from 1 to 4095", list);
+    return INDIGO_ERROR_PARAM;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+static of_group_add_t *ind_ofdpa_preload_l2_interface_build(cJSON *entry)
+{
+  of_group_add_t *group_add = NULL;
+  of_list_bucket_t *buckets = NULL;
+  of_list_action_t *actions = NULL;
+  of_bucket_t *bucket = NULL;
+  of_action_output_t *output;
+  int port, vlan, untagged = 0;
+
+  if (ind_ofdpa_preload_port_vlan_parse(entry, "l2_interface_groups", &port, &vlan) < 0)
+  {
+    return NULL;
+  }
+  (void)ind_cfg_lookup_bool(entry, "untagged", &untagged);
+
+  if ((actions = of_list_action_new(OF_VERSION_1_3)) == NULL ||
+      (buckets = of_list_bucket_new(OF_VERSION_1_3)) == NULL ||
+      (bucket = of_bucket_new(OF_VERSION_1_3)) == NULL ||
+      (group_add = of_group_add_new(OF_VERSION_1_3)) == NULL)
+  {
+    goto error;
+  }
+  if ((output = of_action_output_new(OF_VERSION_1_3)) != NULL)
+  {
+    of_action_output_port_set(output, port);
+  }
+  if (ind_ofdpa_preload_list_append(actions, output) < 0 ||
+      (untagged &&
+       ind_ofdpa_preload_list_append(actions, of_action_pop_vlan_new(OF_VERSION_1_3)) < 0))
+  {
+    goto error;
+  }
+  of_bucket_watch_port_set(bucket, OF_PORT_DEST_WILDCARD);
+  of_bucket_watch_group_set(bucket, OF_GROUP_ANY);
+  if (of_bucket_actions_set(bucket, actions) < 0 ||
+      of_list_append(buckets, bucket) < 0)
+  {
+    goto error;
+  }
+
+  of_group_add_group_type_set(group_add, OF_GROUP_TYPE_INDIRECT);
+  of_group_add_group_id_set(group_add,
+                            (OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE << 28) | (vlan << 16) | port);
+  if (of_group_add_buckets_set(group_add, buckets) < 0)
+  {
+    goto error;
+  }
+
+  of_object_delete(bucket);
+  of_object_delete(buckets);
+  of_object_delete(actions);
+  return group_add;
+
+error:
+  LOG_ERROR("Config: failed to build an L2 interface group for port %d vlan %d", port, vlan);
+  if (group_add != NULL)
+  {
+    of_object_delete(group_add);
+  }
+  if (bucket != NULL)
+  {
+    of_object_delete(bucket);
+  }
+  if (buckets != NULL)
+  {
+    of_object_delete(buckets);
+  }
+  if (actions != NULL)
+  {
+    of_object_delete(actions);
+  }
+  return NULL;
+}
+
+/* Untagged frames on a port are assigned a VLAN */
+static of_flow_add_t *ind_ofdpa_preload_vlan_build(cJSON *entry)
+{
+  of_flow_add_t *flow_add = NULL;
+  of_list_instruction_t *insts;
+  of_list_action_t *actions;
+  of_instruction_apply_actions_t *apply;
+  of_instruction_goto_table_t *goto_table;
+  of_oxm_vlan_vid_t *oxm;
+  of_match_t match;
+  int port, vlan;
+
+  if (ind_ofdpa_preload_port_vlan_parse(entry, "vlan", &port, &vlan) < 0)
+  {
+    return NULL;
+  }
+
+  memset(&match, 0, sizeof(match));
+  match.version = OF_VERSION_1_3;
+  match.fields.in_port = port;
+  OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+  match.fields.vlan_vid = 0;
+  match.masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+
+  if ((insts = of_list_instruction_new(OF_VERSION_1_3)) == NULL)
+  {
+    return NULL;
+  }
+  if ((actions = of_list_action_new(OF_VERSION_1_3)) != NULL)
+  {
+    if ((oxm = of_oxm_vlan_vid_new(OF_VERSION_1_3)) != NULL)
+    {
+      of_oxm_vlan_vid_value_set(oxm, OFDPA_VID_PRESENT | vlan);
+    }
+    if (ind_ofdpa_preload_list_append(actions, ind_ofdpa_preload_set_field_action(oxm)) == 0 &&
+        (apply = of_instruction_apply_actions_new(OF_VERSION_1_3)) != NULL)
+    {
+      if (of_instruction_apply_actions_actions_set(apply, actions) < 0)
+      {
+        of_object_delete(apply);
+        apply = NULL;
+      }
+      if ((goto_table = of_instruction_goto_table_new(OF_VERSION_1_3)) != NULL)
+      {
+        of_instruction_goto_table_table_id_set(goto_table, OFDPA_FLOW_TABLE_ID_TERMINATION_MAC);
+      }
+      if (ind_ofdpa_preload_list_append(insts, apply) == 0 &&
+          ind_ofdpa_preload_list_append(insts, goto_table) == 0)
+      {
+        flow_add = ind_ofdpa_preload_flow_new(OFDPA_FLOW_TABLE_ID_VLAN, 1000, &match, insts);
+      }
+      else if (goto_table != NULL)
+      {
+        of_object_delete(goto_table);
+      }
+    }
+    of_object_delete(actions);
+  }
+  of_object_delete(insts);
+
+  if (flow_add == NULL)
+  {
+    LOG_ERROR("Config: failed to build a VLAN flow for port %d vlan %d", port, vlan);
+  }
+  return flow_add;
+}
+
+/* IPv4 frames to the router MAC on a VLAN go to routing */
+static of_flow_add_t *ind_ofdpa_preload_termination_mac_build(cJSON *entry)
+{
+  of_flow_add_t *flow_add = NULL;
+  of_list_instruction_t *insts;
+  of_instruction_goto_table_t *goto_table;
+  of_match_t match;
+  int port = 0, vlan;
+
+  memset(&match, 0, sizeof(match));
+  match.version = OF_VERSION_1_3;
+
+  if (ind_cfg_parse_mac_addr(entry, "mac", &match.fields.eth_dst) != INDIGO_ERROR_NONE ||
+      ind_cfg_lookup_int(entry, "vlan", &vlan) != INDIGO_ERROR_NONE ||
+      vlan <= 0 || vlan > OFDPA_VID_EXACT_MASK)
+  {
+    LOG_ERROR("Config: each of " IND_OFDPA_PRELOAD_SECTION ".termination_mac needs "
+              "a mac and a vlan from 1 to 4095");
+    return NULL;
+  }
+  if (ind_cfg_lookup_int(entry, "port", &port) == INDIGO_ERROR_NONE)
+  {
+    match.fields.in_port = port;
+    OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+  }
+  match.fields.eth_type = 0x0800;
+  match.masks.eth_type = 0xffff;
+  match.fields.vlan_vid = OFDPA_VID_PRESENT | vlan;
+  match.masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+  memset(match.masks.eth_dst.addr, 0xff, OF_MAC_ADDR_BYTES);
+
+  if ((insts = of_list_instruction_new(OF_VERSION_1_3)) == NULL)
+  {
+    return NULL;
+  }
+  if ((goto_table = of_instruction_goto_table_new(OF_VERSION_1_3)) != NULL)
+  {
+    of_instruction_goto_table_table_id_set(goto_table, OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING);
+  }
+  if (ind_ofdpa_preload_list_append(insts, goto_table) == 0)
+  {
+    flow_add = ind_ofdpa_preload_flow_new(OFDPA_FLOW_TABLE_ID_TERMINATION_MAC, 1000,
+                                          &match, insts);
+  }
+  of_object_delete(insts);
+
+  if (flow_add == NULL)
+  {
+    LOG_ERROR("Config: failed to build a termination MAC flow for vlan %d", vlan);
+  }
+  return flow_add;
+}
+
+typedef void *(*ind_ofdpa_preload_build_f)(cJSON *entry);
+
+static indigo_error_t ind_ofdpa_preload_list_stage(cJSON *section, const char *list,
+                                                   ind_ofdpa_preload_build_f build,
+                                                   of_object_t ***objs, int *count)
+{
+  cJSON *array, *entry;
+
+  if (ind_cfg_lookup(section, list, &array) != INDIGO_ERROR_NONE)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+  if (array->type != cJSON_Array)
+  {
+    LOG_ERROR("Config: " IND_OFDPA_PRELOAD_SECTION ".%s must be an array", list);
+    return INDIGO_ERROR_PARAM;
+  }
+
+  for (entry = array->child; entry != NULL; entry = entry->next)
+  {
+    if (entry->type != cJSON_Object)
+    {
+      LOG_ERROR("Config: each of " IND_OFDPA_PRELOAD_SECTION ".%s must be an object", list);
+      return INDIGO_ERROR_PARAM;
+    }
+    if (ind_ofdpa_preload_append(objs, count, build(entry)) < 0)
+    {
+      return INDIGO_ERROR_PARAM;
+    }
+  }
+
+  return INDIGO_ERROR_NONE;
+}
+
+/* Read the group and flow adds from a file of OpenFlow messages */
+static indigo_error_t ind_ofdpa_preload_file_stage(const char *path,
+                                                   ind_ofdpa_preload_config_t *staged)
+{
+  of_object_storage_t storage;
+  of_object_t *obj;
+  of_flow_add_t *flow_add;
+  uint8_t *buf = NULL;
+  long size;
+  int offset, len;
+  indigo_error_t rv = INDIGO_ERROR_PARAM;
+  FILE *file;
+
+  if ((file = fopen(path, "rb")) == NULL)
+  {
+    LOG_ERROR("Config: cannot open the preload file %s", path);
+    return INDIGO_ERROR_NOT_FOUND;
+  }
+  if (fseek(file, 0, SEEK_END) < 0 || (size = ftell(file)) < 0 ||
+      fseek(file, 0, SEEK_SET) < 0 ||
+      (size > 0 && ((buf = malloc(size)) == NULL ||
+                    fread(buf, 1, size, file) != (size_t)size)))
+  {
+    LOG_ERROR("Config: cannot read the preload file %s", path);
+    goto done;
+  }
+
+  for (offset = 0; offset < size; offset += len)
+  {
+    if (size - offset < OF_MESSAGE_MIN_LENGTH ||
+        (len = of_message_length_get(buf + offset)) < OF_MESSAGE_MIN_LENGTH ||
+        len > size - offset ||
+        (obj = of_object_new_from_message_preallocated(&storage, buf + offset, len)) == NULL ||
+        obj->version != OF_VERSION_1_3)
+    {
+      LOG_ERROR("Config: bad OpenFlow 1.3 message at offset %d of %s", offset, path);
+      goto done;
+    }
+
+    if (obj->object_id == OF_GROUP_ADD)
+    {
+      rv = ind_ofdpa_preload_append(&staged->groups, &staged->group_count,
+                                    of_object_dup(obj));
+    }
+    else if (obj->object_id == OF_FLOW_ADD)
+    {
+      if ((flow_add = of_object_dup(obj)) != NULL)
+      {
+        of_flow_add_cookie_set(flow_add, ind_ofdpa_preload_cookie);
+      }
+      rv = ind_ofdpa_preload_append(&staged->flows, &staged->flow_count, flow_add);
+    }
+    else
+    {
+      LOG_ERROR("Config: %s at offset %d of %s is not a group or flow add",
+                of_object_id_str[obj->object_id], offset, path);
+      rv = INDIGO_ERROR_PARAM;
+    }
+    if (rv < 0)
+    {
+      goto done;
+    }
+  }
+  rv = INDIGO_ERROR_NONE;
+
+done:
+  free(buf);
+  fclose(file);
+  return rv;
+}
+
+static indigo_error_t ind_ofdpa_preload_cfg_stage(cJSON *config)
+{
+  ind_ofdpa_preload_config_t *staged = &ind_ofdpa_preload_staged;
+  cJSON *section;
+  char *text, *end;
+  indigo_error_t rv;
+
+  ind_ofdpa_preload_config_clear(staged);
+
+  if (ind_cfg_lookup(config, IND_OFDPA_PRELOAD_SECTION, &section) != INDIGO_ERROR_NONE)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+  if (section->type != cJSON_Object)
+  {
+    LOG_ERROR("Config: " IND_OFDPA_PRELOAD_SECTION " must be an object");
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_preload_cookie = IND_OFDPA_PRELOAD_COOKIE_DEFAULT;
+  if (ind_cfg_lookup_string(section, "cookie", &text) == INDIGO_ERROR_NONE)
+  {
+    ind_ofdpa_preload_cookie = strtoull(text, &end, 0);
+    if (*text == '\0' || *end != '\0')
+    {
+      LOG_ERROR("Config: " IND_OFDPA_PRELOAD_SECTION ".cookie must be a number like \"0x1234\"");
+      return INDIGO_ERROR_PARAM;
+    }
+  }
+
+  if (ind_cfg_lookup_string(section, "file", &text) == INDIGO_ERROR_NONE &&
+      (rv = ind_ofdpa_preload_file_stage(text, staged)) < 0)
+  {
+    return rv;
+  }
+
+  if ((rv = ind_ofdpa_preload_list_stage(section, "l2_interface_groups",
+                                         (ind_ofdpa_preload_build_f)ind_ofdpa_preload_l2_interface_build,
+                                         &staged->groups, &staged->group_count)) < 0 ||
+      (rv = ind_ofdpa_preload_list_stage(section, "vlan",
+                                         (ind_ofdpa_preload_build_f)ind_ofdpa_preload_vlan_build,
+                                         &staged->flows, &staged->flow_count)) < 0 ||
+      (rv = ind_ofdpa_preload_list_stage(section, "termination_mac",
+                                         (ind_ofdpa_preload_build_f)ind_ofdpa_preload_termination_mac_build,
+                                         &staged->flows, &staged->flow_count)) < 0)
+  {
+    return rv;
+  }
+
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_preload_install(void)
+{
+  ind_ofdpa_preload_config_t *current = &ind_ofdpa_preload_current;
+  int installed_groups = 0, installed_flows = 0;
+  int present = 0, failed = 0;
+  indigo_error_t rv;
+  int i;
+
+  for (i = 0; i < current->group_count; i++)
+  {
+    rv = indigo_core_group_preload(current->groups[i]);
+    if (rv == INDIGO_ERROR_NONE)
+    {
+      installed_groups++;
+    }
+    else if (rv == INDIGO_ERROR_EXISTS)
+    {
+      present++;
+    }
+    else
+    {
+      uint32_t group_id;
+
+      of_group_add_group_id_get(current->groups[i], &group_id);
+      LOG_ERROR("Failed to preload group 0x%x: %s", group_id, indigo_strerror(rv));
+      failed++;
+    }
+  }
+
+  for (i = 0; i < current->flow_count; i++)
+  {
+    rv = indigo_core_flow_preload(current->flows[i]);
+    if (rv == INDIGO_ERROR_NONE)
+    {
+      installed_flows++;
+    }
+    else if (rv == INDIGO_ERROR_EXISTS)
+    {
+      present++;
+    }
+    else
+    {
+      uint8_t table_id;
+
+      of_flow_add_table_id_get(current->flows[i], &table_id);
+      LOG_ERROR("Failed to preload a flow in table %d: %s", table_id, indigo_strerror(rv));
+      failed++;
+    }
+  }
+
+  if (current->group_count + current->flow_count > 0)
+  {
+    LOG_INFO("Preloaded %d groups and %d flows (%d already installed, %d failed)",
+             installed_groups, installed_flows, present, failed);
+  }
+}
+
+static void ind_ofdpa_preload_cfg_commit(void)
+{
+  ind_ofdpa_preload_config_clear(&ind_ofdpa_preload_current);
+  ind_ofdpa_preload_current = ind_ofdpa_preload_staged;
+  memset(&ind_ofdpa_preload_staged, 0, sizeof(ind_ofdpa_preload_staged));
+
+  if (ind_ofdpa_preload_held)
+  {
+    ind_ofdpa_preload_waiting = true;
+    return;
+  }
+  ind_ofdpa_preload_install();
+}
+
+void ind_ofdpa_preload_hold(int hold)
+{
+  ind_ofdpa_preload_held = hold;
+  if (!hold && ind_ofdpa_preload_waiting)
+  {
+    ind_ofdpa_preload_waiting = false;
+    ind_ofdpa_preload_install();
+  }
+}
+
+static const char * const ind_ofdpa_preload_cfg_paths[] = {
+  IND_OFDPA_PRELOAD_SECTION,
+  NULL
+};
+
+static const struct ind_cfg_ops ind_ofdpa_preload_cfg_ops = {
+  .stage = ind_ofdpa_preload_cfg_stage,
+  .commit = ind_ofdpa_preload_cfg_commit,
+  .paths = ind_ofdpa_preload_cfg_paths,
+};
+
+void ind_ofdpa_preload_init(void)
+{
+  ind_cfg_register(&ind_ofdpa_preload_cfg_ops);
+}
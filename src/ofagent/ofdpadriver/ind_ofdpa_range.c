@@ -0,0 +1,204 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_range.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include "ofdpa_datatypes.h"
+#include <AIM/aim.h>
+#include <indigo/of_state_manager.h>
+#include <loci/loci.h>
+#include <arpa/inet.h>
+#include <inttypes.h>
+#include <string.h>
+
+/*
+ * Range flow add
+ *
+ * Provisioning the VLAN and Termination MAC tables takes one flow per
+ * port and VLAN, all alike apart from in_port and vlan_vid. This OF-DPA
+ * experimenter message carries the ranges and one flow_add to use as
+ * the template, in network byte order:
+ *
+ *     uint32_t port_first, port_last;   both 0: in_port as in the template
+ *     uint16_t vlan_first, vlan_last;   both 0: vlan_vid as in the template
+ *     uint8_t  pad[4];
+ *     an OpenFlow 1.3 flow_add
+ *
+ * Each port and VLAN pair is added as the template with in_port and
+ * vlan_vid matched exactly. The adds go through the state manager as if
+ * the controller had sent them with the experimenter message's xid, so
+ * each is tracked in the flow table, queued on the batched create path
+ * and reported on like any other flow. They are all queued before the
+ * next message is handled, so a barrier after this one covers them.
+ */
+
+#define IND_OFDPA_RANGE_HEADER_LEN  16
+
+/* Keeps a malformed message from flooding the flow table */
+#define IND_OFDPA_RANGE_FLOWS_MAX   (64 * 1024)
+
+static indigo_error_t ind_ofdpa_range_error(indigo_cxn_id_t cxn_id, of_object_t *obj,
+                                            uint16_t type, uint16_t code)
+{
+  indigo_cxn_send_error_reply(cxn_id, obj, type, code);
+  return INDIGO_ERROR_PARAM;
+}
+
+indigo_error_t ind_ofdpa_range_flow_add_handler(of_object_t *obj, indigo_cxn_id_t cxn_id)
+{
+  of_object_storage_t storage;
+  of_object_t *template;
+  of_flow_add_t *flow_add;
+  of_octets_t data;
+  of_match_t match;
+  uint32_t xid, port_first, port_last, u32;
+  uint16_t vlan_first, vlan_last, u16;
+  uint64_t port, vlan, count;
+  of_version_t ver = obj->version;
+  int len;
+
+  if (ver < OF_VERSION_1_3)
+  {
+    LOG_ERROR("OpenFlow version 0x%x unsupported", ver);
+    return INDIGO_ERROR_VERSION;
+  }
+
+  of_experimenter_xid_get(obj, &xid);
+  of_experimenter_data_get(obj, &data);
+
+  if (data.bytes < IND_OFDPA_RANGE_HEADER_LEN + OF_MESSAGE_MIN_LENGTH)
+  {
+    LOG_ERROR("Range flow add too short: %d bytes", data.bytes);
+    return ind_ofdpa_range_error(cxn_id, obj,
+                                 OF_ERROR_TYPE_BAD_REQUEST_BY_VERSION(ver),
+                                 OF_REQUEST_FAILED_BAD_LEN_BY_VERSION(ver));
+  }
+
+  memcpy(&u32, data.data, sizeof(u32));
+  port_first = ntohl(u32);
+  memcpy(&u32, data.data + 4, sizeof(u32));
+  port_last = ntohl(u32);
+  memcpy(&u16, data.data + 8, sizeof(u16));
+  vlan_first = ntohs(u16);
+  memcpy(&u16, data.data + 10, sizeof(u16));
+  vlan_last = ntohs(u16);
+
+  if ((port_first == 0) != (port_last == 0) || port_first > port_last ||
+      (vlan_first == 0) != (vlan_last == 0) || vlan_first > vlan_last ||
+      vlan_last > OFDPA_VID_EXACT_MASK)
+  {
+    LOG_ERROR("Range flow add has bad ranges: ports %u-%u, VLANs %u-%u",
+              port_first, port_last, vlan_first, vlan_last);
+    return ind_ofdpa_range_error(cxn_id, obj,
+                                 OF_ERROR_TYPE_BAD_MATCH_BY_VERSION(ver),
+                                 OF_MATCH_FAILED_BAD_VALUE_BY_VERSION(ver));
+  }
+
+  count = (uint64_t)(port_last - port_first + 1) * (vlan_last - vlan_first + 1);
+  if (count > IND_OFDPA_RANGE_FLOWS_MAX)
+  {
+    LOG_ERROR("Range flow add of %" PRIu64 " flows is over the limit of %d",
+              count, IND_OFDPA_RANGE_FLOWS_MAX);
+    return ind_ofdpa_range_error(cxn_id, obj,
+                                 OF_ERROR_TYPE_FLOW_MOD_FAILED_BY_VERSION(ver),
+                                 OF_FLOW_MOD_FAILED_TABLE_FULL_BY_VERSION(ver));
+  }
+
+  len = data.bytes - IND_OFDPA_RANGE_HEADER_LEN;
+  if (of_message_length_get(data.data + IND_OFDPA_RANGE_HEADER_LEN) != len ||
+      (template = of_object_new_from_message_preallocated(
+         &storage, data.data + IND_OFDPA_RANGE_HEADER_LEN, len)) == NULL)
+  {
+    LOG_ERROR("Range flow add template does not parse");
+    return ind_ofdpa_range_error(cxn_id, obj,
+                                 OF_ERROR_TYPE_BAD_REQUEST_BY_VERSION(ver),
+                                 OF_REQUEST_FAILED_BAD_LEN_BY_VERSION(ver));
+  }
+
+  if (template->version != OF_VERSION_1_3 || template->object_id != OF_FLOW_ADD)
+  {
+    LOG_ERROR("Range flow add template is %s, version 0x%x",
+              of_object_id_str[template->object_id], template->version);
+    return ind_ofdpa_range_error(cxn_id, obj,
+                                 OF_ERROR_TYPE_BAD_REQUEST_BY_VERSION(ver),
+                                 OF_REQUEST_FAILED_BAD_TYPE_BY_VERSION(ver));
+  }
+
+  if ((flow_add = of_object_dup(template)) == NULL)
+  {
+    return ind_ofdpa_range_error(cxn_id, obj,
+                                 OF_ERROR_TYPE_FLOW_MOD_FAILED_BY_VERSION(ver),
+                                 OF_FLOW_MOD_FAILED_UNKNOWN_BY_VERSION(ver));
+  }
+  of_flow_add_xid_set(flow_add, xid);
+
+  if (of_flow_add_match_get(flow_add, &match) < 0)
+  {
+    of_object_delete(flow_add);
+    return ind_ofdpa_range_error(cxn_id, obj,
+                                 OF_ERROR_TYPE_BAD_MATCH_BY_VERSION(ver),
+                                 OF_MATCH_FAILED_BAD_TYPE_BY_VERSION(ver));
+  }
+
+  LOG_TRACE("Range flow add: %" PRIu64 " flows, ports %u-%u, VLANs %u-%u",
+            count, port_first, port_last, vlan_first, vlan_last);
+
+  /* The core copies what it keeps, so one object serves every flow */
+  for (port = port_first; port <= port_last; port++)
+  {
+    if (port_first != 0)
+    {
+      match.fields.in_port = port;
+      OF_MATCH_MASK_IN_PORT_EXACT_SET(&match);
+    }
+    for (vlan = vlan_first; vlan <= vlan_last; vlan++)
+    {
+      if (vlan_first != 0)
+      {
+        match.fields.vlan_vid = OFDPA_VID_PRESENT | vlan;
+        match.masks.vlan_vid = OFDPA_VID_PRESENT | OFDPA_VID_EXACT_MASK;
+      }
+      if (of_flow_add_match_set(flow_add, &match) < 0)
+      {
+        LOG_ERROR("Range flow add match does not fit, port %" PRIu64 " VLAN %" PRIu64,
+                  port, vlan);
+        of_object_delete(flow_add);
+        return ind_ofdpa_range_error(cxn_id, obj,
+                                     OF_ERROR_TYPE_BAD_MATCH_BY_VERSION(ver),
+                                     OF_MATCH_FAILED_BAD_LEN_BY_VERSION(ver));
+      }
+      indigo_core_receive_controller_message(cxn_id, flow_add);
+    }
+  }
+
+  of_object_delete(flow_add);
+  return INDIGO_ERROR_NONE;
+}
@@ -0,0 +1,298 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_rx.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE             /* pthread_setaffinity_np */
+#endif
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim.h>
+#include <SocketManager/socketmanager.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <sys/eventfd.h>
+
+/*
+ * Packet receive thread
+ *
+ * When started, a thread of its own waits in ofdpaPktReceive() instead of
+ * the main loop reading the packet socket. Each frame is received into a
+ * buffer with packet-in headroom and placed in a ring with a single
+ * producer, the receive thread, and a single consumer, the main loop,
+ * which an eventfd wakes. The main loop turns the frames into packet-ins
+ * with ind_ofdpa_pkt_deliver(), so PDU offload, packet-in buffers and the
+ * packet-in listeners keep running on the thread that owns their state,
+ * while the receive RPC and the copy out of the socket no longer hold up
+ * flow programming. A frame arriving at a full ring is dropped and
+ * counted, which bounds the punt work the main loop takes on per wakeup.
+ */
+#define IND_OFDPA_RX_RING_SIZE   1024   /* Power of 2 */
+#define IND_OFDPA_RX_WAIT_US     100000 /* How often the thread checks for stop */
+
+typedef struct ind_ofdpa_rx_slot_s
+{
+  uint8_t      *buf;
+  ofdpaPacket_t pkt;
+} ind_ofdpa_rx_slot_t;
+
+static struct
+{
+  ind_ofdpa_rx_slot_t ring[IND_OFDPA_RX_RING_SIZE];
+  uint32_t            head;       /* Next slot to fill; written by the thread */
+  uint32_t            tail;       /* Next slot to deliver; written by the main loop */
+  int                 headroom;
+  uint32_t            max_pkt_size;
+  int                 eventfd;
+  int                 cpu;
+  pthread_t           thread;
+  volatile bool       stopping;
+  bool                running;
+  uint64_t            received;
+  uint64_t            delivered;
+  uint64_t            ring_drops;
+  uint64_t            alloc_failures;
+} ind_ofdpa_rx = { .eventfd = -1, .cpu = -1 };
+
+static void *ind_ofdpa_rx_thread(void *arg)
+{
+  ind_ofdpa_rx_slot_t *slot;
+  struct timeval timeout;
+  ofdpaPacket_t pkt;
+  uint8_t *buf = NULL;
+  uint32_t head;
+  uint64_t one = 1;
+
+  while (!ind_ofdpa_rx.stopping)
+  {
+    if (buf == NULL)
+    {
+      buf = malloc(ind_ofdpa_rx.headroom + ind_ofdpa_rx.max_pkt_size);
+      if (buf == NULL)
+      {
+        __atomic_fetch_add(&ind_ofdpa_rx.alloc_failures, 1, __ATOMIC_RELAXED);
+        usleep(IND_OFDPA_RX_WAIT_US);
+        continue;
+      }
+    }
+
+    /*
+     * Received into a frame of our own: with the ring full, the slot at
+     * head is the tail slot the main loop may be reading.
+     */
+    memset(&pkt, 0, sizeof(pkt));
+    pkt.pktData.pstart = (char *)(buf + ind_ofdpa_rx.headroom);
+    pkt.pktData.size = ind_ofdpa_rx.max_pkt_size;
+
+    timeout.tv_sec = 0;
+    timeout.tv_usec = IND_OFDPA_RX_WAIT_US;
+    if (ofdpaPktReceive(&timeout, &pkt) != OFDPA_E_NONE)
+    {
+      continue;
+    }
+    __atomic_fetch_add(&ind_ofdpa_rx.received, 1, __ATOMIC_RELAXED);
+
+    /* The slot is only written and published once there is room for it */
+    head = ind_ofdpa_rx.head;
+    if (head - __atomic_load_n(&ind_ofdpa_rx.tail, __ATOMIC_ACQUIRE) >=
+        IND_OFDPA_RX_RING_SIZE)
+    {
+      __atomic_fetch_add(&ind_ofdpa_rx.ring_drops, 1, __ATOMIC_RELAXED);
+      continue;
+    }
+
+    slot = &ind_ofdpa_rx.ring[head & (IND_OFDPA_RX_RING_SIZE - 1)];
+    slot->pkt = pkt;
+    slot->buf = buf;
+    buf = NULL;
+    __atomic_store_n(&ind_ofdpa_rx.head, head + 1, __ATOMIC_RELEASE);
+
+    if (write(ind_ofdpa_rx.eventfd, &one, sizeof(one)) != sizeof(one))
+    {
+      LOG_ERROR("Failed to signal received packet: %s", strerror(errno));
+    }
+  }
+
+  free(buf);
+  return NULL;
+}
+
+/* Deliver everything in the ring; called from the main loop */
+static void ind_ofdpa_rx_drain(void)
+{
+  ind_ofdpa_rx_slot_t *slot;
+  uint32_t head = __atomic_load_n(&ind_ofdpa_rx.head, __ATOMIC_ACQUIRE);
+  uint32_t tail = ind_ofdpa_rx.tail;
+
+  while (tail != head)
+  {
+    slot = &ind_ofdpa_rx.ring[tail & (IND_OFDPA_RX_RING_SIZE - 1)];
+    if (!ind_ofdpa_pkt_deliver(slot->buf, &slot->pkt))
+    {
+      free(slot->buf);
+    }
+    slot->buf = NULL;
+    ind_ofdpa_rx.delivered++;
+    __atomic_store_n(&ind_ofdpa_rx.tail, ++tail, __ATOMIC_RELEASE);
+  }
+}
+
+static void ind_ofdpa_rx_ready(int socket_id, void *cookie,
+                               int read_ready, int write_ready,
+                               int error_seen)
+{
+  uint64_t value;
+
+  if (read(socket_id, &value, sizeof(value)) < 0 && errno != EAGAIN)
+  {
+    LOG_ERROR("Failed to read packet receive eventfd: %s", strerror(errno));
+  }
+
+  ind_ofdpa_rx_drain();
+}
+
+/**
+ * Start receiving packets on a thread of their own
+ *
+ * The caller must not also register the packet socket with the main loop.
+ *
+ * @param cpu CPU to pin the thread to, or -1 to leave it unpinned
+ */
+indigo_error_t ind_ofdpa_rx_thread_start(int cpu)
+{
+  cpu_set_t cpus;
+
+  if (ind_ofdpa_rx.running)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  ind_ofdpa_rx.headroom = ind_ofdpa_pkt_receive_init(&ind_ofdpa_rx.max_pkt_size);
+  if (ind_ofdpa_rx.headroom < 0)
+  {
+    return INDIGO_ERROR_UNKNOWN;
+  }
+
+  ind_ofdpa_rx.eventfd = eventfd(0, EFD_NONBLOCK);
+  if (ind_ofdpa_rx.eventfd < 0)
+  {
+    LOG_ERROR("Failed to allocate packet receive eventfd: %s", strerror(errno));
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  if (ind_soc_socket_register(ind_ofdpa_rx.eventfd, ind_ofdpa_rx_ready, NULL) < 0)
+  {
+    LOG_ERROR("Failed to register packet receive eventfd");
+    close(ind_ofdpa_rx.eventfd);
+    ind_ofdpa_rx.eventfd = -1;
+    return INDIGO_ERROR_UNKNOWN;
+  }
+
+  ind_ofdpa_rx.stopping = false;
+  if (pthread_create(&ind_ofdpa_rx.thread, NULL, ind_ofdpa_rx_thread, NULL) != 0)
+  {
+    LOG_ERROR("Failed to create packet receive thread");
+    ind_soc_socket_unregister(ind_ofdpa_rx.eventfd);
+    close(ind_ofdpa_rx.eventfd);
+    ind_ofdpa_rx.eventfd = -1;
+    return INDIGO_ERROR_RESOURCE;
+  }
+
+  ind_ofdpa_rx.cpu = -1;
+  if (cpu >= 0)
+  {
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    if (pthread_setaffinity_np(ind_ofdpa_rx.thread, sizeof(cpus), &cpus) != 0)
+    {
+      LOG_ERROR("Failed to pin packet receive thread to CPU %d", cpu);
+    }
+    else
+    {
+      ind_ofdpa_rx.cpu = cpu;
+    }
+  }
+
+  /* A placement for the rx role replaces the --rxthread pin */
+  ind_ofdpa_thread_register(INDIGO_THREAD_PACKET_RX, ind_ofdpa_rx.thread);
+
+  ind_ofdpa_rx.running = true;
+  LOG_INFO("Started packet receive thread");
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_rx_thread_stop(void)
+{
+  if (!ind_ofdpa_rx.running)
+  {
+    return;
+  }
+
+  ind_ofdpa_rx.stopping = true;
+  indigo_thread_unregister(ind_ofdpa_rx.thread);
+  pthread_join(ind_ofdpa_rx.thread, NULL);
+  ind_ofdpa_rx.running = false;
+
+  ind_soc_socket_unregister(ind_ofdpa_rx.eventfd);
+  close(ind_ofdpa_rx.eventfd);
+  ind_ofdpa_rx.eventfd = -1;
+
+  ind_ofdpa_rx_drain();
+}
+
+void ind_ofdpa_rx_thread_show(aim_pvs_t *pvs)
+{
+  if (!ind_ofdpa_rx.running)
+  {
+    aim_printf(pvs, "Packet receive thread off\n");
+    return;
+  }
+
+  aim_printf(pvs, "Packet receive thread on");
+  if (ind_ofdpa_rx.cpu >= 0)
+  {
+    aim_printf(pvs, ", CPU %d", ind_ofdpa_rx.cpu);
+  }
+  aim_printf(pvs, "\n");
+  aim_printf(pvs, "  received %" PRIu64 ", delivered %" PRIu64
+             ", ring drops %" PRIu64 ", alloc failures %" PRIu64 ", queued %u\n",
+             __atomic_load_n(&ind_ofdpa_rx.received, __ATOMIC_RELAXED),
+             ind_ofdpa_rx.delivered,
+             __atomic_load_n(&ind_ofdpa_rx.ring_drops, __ATOMIC_RELAXED),
+             __atomic_load_n(&ind_ofdpa_rx.alloc_failures, __ATOMIC_RELAXED),
+             __atomic_load_n(&ind_ofdpa_rx.head, __ATOMIC_ACQUIRE) - ind_ofdpa_rx.tail);
+}
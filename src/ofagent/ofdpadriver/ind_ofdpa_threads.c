@@ -0,0 +1,183 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2014-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_threads.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim.h>
+#include <Configuration/configuration.h>
+#include <indigo/thread.h>
+#include <string.h>
+#include <stdbool.h>
+
+/*
+ * Thread placement from the command line and the configuration
+ *
+ * Placements given with --thread are the defaults. The "threads" section
+ * of the configuration overrides them per role:
+ *     "threads": { "event_loop": "0/fifo/10", "rx": "1", ... }
+ * A role dropped from the configuration goes back to its default; one
+ * with no default keeps the placement its threads last had.
+ */
+
+#define IND_OFDPA_THREADS_SECTION "threads"
+
+typedef struct ind_ofdpa_threads_config_s
+{
+  indigo_thread_placement_t placement[INDIGO_THREAD_ROLE_COUNT];
+  bool set[INDIGO_THREAD_ROLE_COUNT];
+} ind_ofdpa_threads_config_t;
+
+static ind_ofdpa_threads_config_t ind_ofdpa_threads_defaults;
+static ind_ofdpa_threads_config_t ind_ofdpa_threads_staged;
+
+static void ind_ofdpa_thread_placement_apply(indigo_thread_role_t role,
+                                             const indigo_thread_placement_t *placement)
+{
+  if (indigo_thread_placement_set(role, placement) < 0)
+  {
+    LOG_ERROR("Failed to apply the %s thread placement",
+              indigo_thread_role_name(role));
+  }
+}
+
+indigo_error_t ind_ofdpa_thread_option_parse(const char *text)
+{
+  indigo_thread_placement_t placement;
+  indigo_thread_role_t role;
+  const char *at = strchr(text, '@');
+  char name[32];
+
+  if (at == NULL || (size_t)(at - text) >= sizeof(name))
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+  memcpy(name, text, at - text);
+  name[at - text] = '\0';
+
+  if (indigo_thread_role_parse(name, &role) < 0 ||
+      indigo_thread_placement_parse(at + 1, &placement) < 0)
+  {
+    return INDIGO_ERROR_PARAM;
+  }
+
+  ind_ofdpa_threads_defaults.placement[role] = placement;
+  ind_ofdpa_threads_defaults.set[role] = true;
+  ind_ofdpa_thread_placement_apply(role, &placement);
+
+  return INDIGO_ERROR_NONE;
+}
+
+void ind_ofdpa_thread_register(indigo_thread_role_t role, pthread_t thread)
+{
+  if (indigo_thread_register(role, thread) < 0)
+  {
+    LOG_ERROR("Failed to apply the %s thread placement to a new thread",
+              indigo_thread_role_name(role));
+  }
+}
+
+static indigo_error_t ind_ofdpa_threads_cfg_stage(cJSON *config)
+{
+  ind_ofdpa_threads_config_t *staged = &ind_ofdpa_threads_staged;
+  indigo_thread_role_t role;
+  cJSON *section, *node;
+
+  memset(staged, 0, sizeof(*staged));
+
+  if (ind_cfg_lookup(config, IND_OFDPA_THREADS_SECTION, &section) != INDIGO_ERROR_NONE)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+  if (section->type != cJSON_Object)
+  {
+    LOG_ERROR("Config: " IND_OFDPA_THREADS_SECTION " must be an object");
+    return INDIGO_ERROR_PARAM;
+  }
+
+  for (node = section->child; node != NULL; node = node->next)
+  {
+    if (indigo_thread_role_parse(node->string, &role) < 0)
+    {
+      LOG_ERROR("Config: unknown thread role \"%s\" in " IND_OFDPA_THREADS_SECTION,
+                node->string);
+      return INDIGO_ERROR_PARAM;
+    }
+    if (node->type != cJSON_String ||
+        indigo_thread_placement_parse(node->valuestring,
+                                      &staged->placement[role]) < 0)
+    {
+      LOG_ERROR("Config: " IND_OFDPA_THREADS_SECTION ".%s must be a placement "
+                "like \"0-1/fifo/10\"", node->string);
+      return INDIGO_ERROR_PARAM;
+    }
+    staged->set[role] = true;
+  }
+
+  return INDIGO_ERROR_NONE;
+}
+
+static void ind_ofdpa_threads_cfg_commit(void)
+{
+  ind_ofdpa_threads_config_t *staged = &ind_ofdpa_threads_staged;
+  int role;
+
+  for (role = 0; role < INDIGO_THREAD_ROLE_COUNT; role++)
+  {
+    if (staged->set[role])
+    {
+      ind_ofdpa_thread_placement_apply(role, &staged->placement[role]);
+    }
+    else if (ind_ofdpa_threads_defaults.set[role])
+    {
+      ind_ofdpa_thread_placement_apply(role, &ind_ofdpa_threads_defaults.placement[role]);
+    }
+    else
+    {
+      ind_ofdpa_thread_placement_apply(role, NULL);
+    }
+  }
+}
+
+static const char * const ind_ofdpa_threads_cfg_paths[] = {
+  IND_OFDPA_THREADS_SECTION,
+  NULL
+};
+
+static const struct ind_cfg_ops ind_ofdpa_threads_cfg_ops = {
+  .stage = ind_ofdpa_threads_cfg_stage,
+  .commit = ind_ofdpa_threads_cfg_commit,
+  .paths = ind_ofdpa_threads_cfg_paths,
+};
+
+void ind_ofdpa_threads_init(void)
+{
+  ind_cfg_register(&ind_ofdpa_threads_cfg_ops);
+}
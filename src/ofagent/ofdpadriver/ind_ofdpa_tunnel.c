@@ -0,0 +1,1079 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename   ind_ofdpa_tunnel.c
+*
+* @purpose    OF-DPA Driver for Indigo
+*
+* @component  OF-DPA
+*
+* @comments   none
+*
+* @create     15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+#include "ind_ofdpa_log.h"
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include <arpa/inet.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <inttypes.h>
+
+/*
+ * Tunnel object cache
+ *
+ * Copies of the OF-DPA tenants, tunnel logical ports, tunnel next hops
+ * and ECMP next hop groups, indexed by id, with each tenant/port
+ * membership linked into both its tenant and its port. The cache is read
+ * from OF-DPA in one walk on first use and then kept current by the
+ * ind_ofdpa_tunnel_* create and delete calls, so dumps and lookups do not
+ * walk the OF-DPA tables. Objects changed by another OF-DPA client are not
+ * seen until the cache is cleared and read again.
+ *
+ * Only configuration is cached. Reference counts move with the flows and
+ * groups using the objects, so status is read from OF-DPA when asked for.
+ */
+#define IND_OFDPA_TUNNEL_BUCKETS 4096
+
+typedef struct ind_ofdpa_tunnel_tenant_s
+{
+  bighash_entry_t           hash_entry;
+  uint32_t                  id;
+  ofdpaTunnelTenantConfig_t config;
+  list_head_t               ports;      /* ind_ofdpa_tunnel_member_t.tenant_links */
+  uint32_t                  port_count;
+} ind_ofdpa_tunnel_tenant_t;
+
+#define TEMPLATE_NAME ind_ofdpa_tunnel_tenant_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_tunnel_tenant_t
+#define TEMPLATE_KEY_FIELD id
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+typedef struct ind_ofdpa_tunnel_port_s
+{
+  bighash_entry_t         hash_entry;
+  uint32_t                id;
+  ofdpaTunnelPortConfig_t config;
+  list_head_t             tenants;      /* ind_ofdpa_tunnel_member_t.port_links */
+  uint32_t                tenant_count;
+} ind_ofdpa_tunnel_port_t;
+
+#define TEMPLATE_NAME ind_ofdpa_tunnel_port_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_tunnel_port_t
+#define TEMPLATE_KEY_FIELD id
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+/* A tenant on a tunnel port, keyed by port << 32 | tenant */
+typedef struct ind_ofdpa_tunnel_member_s
+{
+  bighash_entry_t            hash_entry;
+  uint64_t                   key;
+  list_links_t               tenant_links;
+  list_links_t               port_links;
+  ind_ofdpa_tunnel_tenant_t *tenant;
+  ind_ofdpa_tunnel_port_t   *port;
+} ind_ofdpa_tunnel_member_t;
+
+#define TEMPLATE_NAME ind_ofdpa_tunnel_member_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_tunnel_member_t
+#define TEMPLATE_KEY_FIELD key
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+typedef struct ind_ofdpa_tunnel_next_hop_s
+{
+  bighash_entry_t            hash_entry;
+  uint32_t                   id;
+  ofdpaTunnelNextHopConfig_t config;
+} ind_ofdpa_tunnel_next_hop_t;
+
+#define TEMPLATE_NAME ind_ofdpa_tunnel_next_hop_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_tunnel_next_hop_t
+#define TEMPLATE_KEY_FIELD id
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+typedef struct ind_ofdpa_tunnel_ecmp_s
+{
+  bighash_entry_t                     hash_entry;
+  uint32_t                            id;
+  ofdpaTunnelEcmpNextHopGroupConfig_t config;
+  uint32_t                           *members;   /* Next hop ids, ascending */
+  uint32_t                            member_count;
+  uint32_t                            member_size;
+} ind_ofdpa_tunnel_ecmp_t;
+
+#define TEMPLATE_NAME ind_ofdpa_tunnel_ecmp_hashtable
+#define TEMPLATE_OBJ_TYPE ind_ofdpa_tunnel_ecmp_t
+#define TEMPLATE_KEY_FIELD id
+#define TEMPLATE_ENTRY_FIELD hash_entry
+#include <BigHash/bighash_template.h>
+
+static struct
+{
+  bool             loaded;
+  bighash_table_t *tenants;
+  bighash_table_t *ports;
+  bighash_table_t *members;
+  bighash_table_t *next_hops;
+  bighash_table_t *ecmps;
+  uint32_t         max_members;   /* Per ECMP group, 0 until read */
+  uint64_t         loads;
+  uint64_t         lookups;
+} ind_ofdpa_tunnel_cache;
+
+static inline uint64_t ind_ofdpa_tunnel_member_key(uint32_t portNum, uint32_t tunnelId)
+{
+  return ((uint64_t)portNum << 32) | tunnelId;
+}
+
+static ind_ofdpa_tunnel_tenant_t *ind_ofdpa_tunnel_tenant_find(uint32_t tunnelId)
+{
+  return ind_ofdpa_tunnel_tenant_hashtable_first(ind_ofdpa_tunnel_cache.tenants, &tunnelId);
+}
+
+static ind_ofdpa_tunnel_port_t *ind_ofdpa_tunnel_port_find(uint32_t portNum)
+{
+  return ind_ofdpa_tunnel_port_hashtable_first(ind_ofdpa_tunnel_cache.ports, &portNum);
+}
+
+static ind_ofdpa_tunnel_member_t *ind_ofdpa_tunnel_member_find(uint32_t portNum, uint32_t tunnelId)
+{
+  uint64_t key = ind_ofdpa_tunnel_member_key(portNum, tunnelId);
+
+  return ind_ofdpa_tunnel_member_hashtable_first(ind_ofdpa_tunnel_cache.members, &key);
+}
+
+static ind_ofdpa_tunnel_next_hop_t *ind_ofdpa_tunnel_next_hop_find(uint32_t nextHopId)
+{
+  return ind_ofdpa_tunnel_next_hop_hashtable_first(ind_ofdpa_tunnel_cache.next_hops, &nextHopId);
+}
+
+static ind_ofdpa_tunnel_ecmp_t *ind_ofdpa_tunnel_ecmp_find(uint32_t ecmpNextHopGroupId)
+{
+  return ind_ofdpa_tunnel_ecmp_hashtable_first(ind_ofdpa_tunnel_cache.ecmps, &ecmpNextHopGroupId);
+}
+
+static void ind_ofdpa_tunnel_tenant_insert(uint32_t tunnelId, ofdpaTunnelTenantConfig_t *config)
+{
+  ind_ofdpa_tunnel_tenant_t *tenant = ind_ofdpa_tunnel_tenant_find(tunnelId);
+
+  if (tenant == NULL)
+  {
+    tenant = aim_zmalloc(sizeof(*tenant));
+    tenant->id = tunnelId;
+    list_init(&tenant->ports);
+    ind_ofdpa_tunnel_tenant_hashtable_insert(ind_ofdpa_tunnel_cache.tenants, tenant);
+  }
+  tenant->config = *config;
+}
+
+static void ind_ofdpa_tunnel_port_insert(uint32_t portNum, ofdpaTunnelPortConfig_t *config)
+{
+  ind_ofdpa_tunnel_port_t *port = ind_ofdpa_tunnel_port_find(portNum);
+
+  if (port == NULL)
+  {
+    port = aim_zmalloc(sizeof(*port));
+    port->id = portNum;
+    list_init(&port->tenants);
+    ind_ofdpa_tunnel_port_hashtable_insert(ind_ofdpa_tunnel_cache.ports, port);
+  }
+  port->config = *config;
+}
+
+static void ind_ofdpa_tunnel_member_insert(uint32_t portNum, uint32_t tunnelId)
+{
+  ind_ofdpa_tunnel_member_t *member;
+  ind_ofdpa_tunnel_tenant_t *tenant;
+  ind_ofdpa_tunnel_port_t *port;
+
+  tenant = ind_ofdpa_tunnel_tenant_find(tunnelId);
+  port = ind_ofdpa_tunnel_port_find(portNum);
+  if ((tenant == NULL) || (port == NULL) ||
+      (ind_ofdpa_tunnel_member_find(portNum, tunnelId) != NULL))
+  {
+    return;
+  }
+
+  member = aim_zmalloc(sizeof(*member));
+  member->key = ind_ofdpa_tunnel_member_key(portNum, tunnelId);
+  member->tenant = tenant;
+  member->port = port;
+  list_push(&tenant->ports, &member->tenant_links);
+  list_push(&port->tenants, &member->port_links);
+  tenant->port_count++;
+  port->tenant_count++;
+  ind_ofdpa_tunnel_member_hashtable_insert(ind_ofdpa_tunnel_cache.members, member);
+}
+
+static void ind_ofdpa_tunnel_member_remove(ind_ofdpa_tunnel_member_t *member)
+{
+  list_remove(&member->tenant_links);
+  list_remove(&member->port_links);
+  member->tenant->port_count--;
+  member->port->tenant_count--;
+  bighash_remove(ind_ofdpa_tunnel_cache.members, &member->hash_entry);
+  aim_free(member);
+}
+
+static void ind_ofdpa_tunnel_tenant_remove(ind_ofdpa_tunnel_tenant_t *tenant)
+{
+  list_links_t *cur, *next;
+
+  LIST_FOREACH_SAFE(&tenant->ports, cur, next)
+  {
+    ind_ofdpa_tunnel_member_remove(container_of(cur, tenant_links, ind_ofdpa_tunnel_member_t));
+  }
+  bighash_remove(ind_ofdpa_tunnel_cache.tenants, &tenant->hash_entry);
+  aim_free(tenant);
+}
+
+static void ind_ofdpa_tunnel_port_remove(ind_ofdpa_tunnel_port_t *port)
+{
+  list_links_t *cur, *next;
+
+  LIST_FOREACH_SAFE(&port->tenants, cur, next)
+  {
+    ind_ofdpa_tunnel_member_remove(container_of(cur, port_links, ind_ofdpa_tunnel_member_t));
+  }
+  bighash_remove(ind_ofdpa_tunnel_cache.ports, &port->hash_entry);
+  aim_free(port);
+}
+
+static void ind_ofdpa_tunnel_next_hop_insert(uint32_t nextHopId, ofdpaTunnelNextHopConfig_t *config)
+{
+  ind_ofdpa_tunnel_next_hop_t *next_hop = ind_ofdpa_tunnel_next_hop_find(nextHopId);
+
+  if (next_hop == NULL)
+  {
+    next_hop = aim_zmalloc(sizeof(*next_hop));
+    next_hop->id = nextHopId;
+    ind_ofdpa_tunnel_next_hop_hashtable_insert(ind_ofdpa_tunnel_cache.next_hops, next_hop);
+  }
+  next_hop->config = *config;
+}
+
+static void ind_ofdpa_tunnel_ecmp_insert(uint32_t ecmpNextHopGroupId,
+                                         ofdpaTunnelEcmpNextHopGroupConfig_t *config)
+{
+  ind_ofdpa_tunnel_ecmp_t *ecmp = ind_ofdpa_tunnel_ecmp_find(ecmpNextHopGroupId);
+
+  if (ecmp == NULL)
+  {
+    ecmp = aim_zmalloc(sizeof(*ecmp));
+    ecmp->id = ecmpNextHopGroupId;
+    ind_ofdpa_tunnel_ecmp_hashtable_insert(ind_ofdpa_tunnel_cache.ecmps, ecmp);
+  }
+  ecmp->config = *config;
+}
+
+static int ind_ofdpa_tunnel_ecmp_member_index(ind_ofdpa_tunnel_ecmp_t *ecmp, uint32_t nextHopId)
+{
+  int lo = 0, hi = ecmp->member_count;
+
+  /* First member not below nextHopId */
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+
+    if (ecmp->members[mid] < nextHopId)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+static int ind_ofdpa_tunnel_u32_cmp(const void *a, const void *b)
+{
+  uint32_t x = *(const uint32_t *)a;
+  uint32_t y = *(const uint32_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+static void ind_ofdpa_tunnel_ecmp_member_insert(ind_ofdpa_tunnel_ecmp_t *ecmp, uint32_t nextHopId)
+{
+  int i = ind_ofdpa_tunnel_ecmp_member_index(ecmp, nextHopId);
+
+  if ((i < ecmp->member_count) && (ecmp->members[i] == nextHopId))
+  {
+    return;
+  }
+  if (ecmp->member_count == ecmp->member_size)
+  {
+    ecmp->member_size = ecmp->member_size ? ecmp->member_size * 2 : 8;
+    ecmp->members = aim_realloc(ecmp->members, ecmp->member_size * sizeof(*ecmp->members));
+    AIM_TRUE_OR_DIE(ecmp->members != NULL);
+  }
+  memmove(&ecmp->members[i + 1], &ecmp->members[i],
+          (ecmp->member_count - i) * sizeof(*ecmp->members));
+  ecmp->members[i] = nextHopId;
+  ecmp->member_count++;
+}
+
+static void ind_ofdpa_tunnel_ecmp_member_remove(ind_ofdpa_tunnel_ecmp_t *ecmp, uint32_t nextHopId)
+{
+  int i = ind_ofdpa_tunnel_ecmp_member_index(ecmp, nextHopId);
+
+  if ((i < ecmp->member_count) && (ecmp->members[i] == nextHopId))
+  {
+    ecmp->member_count--;
+    memmove(&ecmp->members[i], &ecmp->members[i + 1],
+            (ecmp->member_count - i) * sizeof(*ecmp->members));
+  }
+}
+
+static void ind_ofdpa_tunnel_ecmp_remove(ind_ofdpa_tunnel_ecmp_t *ecmp)
+{
+  bighash_remove(ind_ofdpa_tunnel_cache.ecmps, &ecmp->hash_entry);
+  aim_free(ecmp->members);
+  aim_free(ecmp);
+}
+
+static void ind_ofdpa_tunnel_tenant_free(bighash_entry_t *entry)
+{
+  aim_free(container_of(entry, hash_entry, ind_ofdpa_tunnel_tenant_t));
+}
+
+static void ind_ofdpa_tunnel_port_free(bighash_entry_t *entry)
+{
+  aim_free(container_of(entry, hash_entry, ind_ofdpa_tunnel_port_t));
+}
+
+static void ind_ofdpa_tunnel_member_free(bighash_entry_t *entry)
+{
+  aim_free(container_of(entry, hash_entry, ind_ofdpa_tunnel_member_t));
+}
+
+static void ind_ofdpa_tunnel_next_hop_free(bighash_entry_t *entry)
+{
+  aim_free(container_of(entry, hash_entry, ind_ofdpa_tunnel_next_hop_t));
+}
+
+static void ind_ofdpa_tunnel_ecmp_free(bighash_entry_t *entry)
+{
+  ind_ofdpa_tunnel_ecmp_t *ecmp = container_of(entry, hash_entry, ind_ofdpa_tunnel_ecmp_t);
+
+  aim_free(ecmp->members);
+  aim_free(ecmp);
+}
+
+void ind_ofdpa_tunnel_cache_clear(void)
+{
+  if (ind_ofdpa_tunnel_cache.tenants == NULL)
+  {
+    return;
+  }
+
+  /* Members first; the tenant and port lists are not walked on free */
+  bighash_table_destroy(ind_ofdpa_tunnel_cache.members, ind_ofdpa_tunnel_member_free);
+  bighash_table_destroy(ind_ofdpa_tunnel_cache.tenants, ind_ofdpa_tunnel_tenant_free);
+  bighash_table_destroy(ind_ofdpa_tunnel_cache.ports, ind_ofdpa_tunnel_port_free);
+  bighash_table_destroy(ind_ofdpa_tunnel_cache.next_hops, ind_ofdpa_tunnel_next_hop_free);
+  bighash_table_destroy(ind_ofdpa_tunnel_cache.ecmps, ind_ofdpa_tunnel_ecmp_free);
+  ind_ofdpa_tunnel_cache.tenants = NULL;
+  ind_ofdpa_tunnel_cache.ports = NULL;
+  ind_ofdpa_tunnel_cache.members = NULL;
+  ind_ofdpa_tunnel_cache.next_hops = NULL;
+  ind_ofdpa_tunnel_cache.ecmps = NULL;
+  ind_ofdpa_tunnel_cache.loaded = false;
+}
+
+/*
+ * The OF-DPA walks return the entry after the given id, so id 0 is
+ * tried with a get before walking, as the example clients do.
+ */
+indigo_error_t ind_ofdpa_tunnel_cache_load(void)
+{
+  ofdpaTunnelTenantConfig_t tenantConfig;
+  ofdpaTunnelPortConfig_t portConfig;
+  ofdpaTunnelNextHopConfig_t nextHopConfig;
+  ofdpaTunnelEcmpNextHopGroupConfig_t ecmpConfig;
+  ind_ofdpa_tunnel_ecmp_t *ecmp;
+  uint32_t id, tunnelId, nextHopId;
+  bool more;
+
+  if (ind_ofdpa_tunnel_cache.loaded)
+  {
+    return INDIGO_ERROR_NONE;
+  }
+
+  ind_ofdpa_tunnel_cache_clear();
+  ind_ofdpa_tunnel_cache.tenants = bighash_table_create(IND_OFDPA_TUNNEL_BUCKETS);
+  ind_ofdpa_tunnel_cache.ports = bighash_table_create(IND_OFDPA_TUNNEL_BUCKETS);
+  ind_ofdpa_tunnel_cache.members = bighash_table_create(IND_OFDPA_TUNNEL_BUCKETS);
+  ind_ofdpa_tunnel_cache.next_hops = bighash_table_create(IND_OFDPA_TUNNEL_BUCKETS);
+  ind_ofdpa_tunnel_cache.ecmps = bighash_table_create(IND_OFDPA_TUNNEL_BUCKETS);
+  AIM_TRUE_OR_DIE((ind_ofdpa_tunnel_cache.tenants != NULL) &&
+                  (ind_ofdpa_tunnel_cache.ports != NULL) &&
+                  (ind_ofdpa_tunnel_cache.members != NULL) &&
+                  (ind_ofdpa_tunnel_cache.next_hops != NULL) &&
+                  (ind_ofdpa_tunnel_cache.ecmps != NULL));
+
+  /* Tenants before ports, so memberships find both ends */
+  id = 0;
+  more = (IND_OFDPA_RPC(ofdpaTunnelTenantGet, id, NULL, NULL) == OFDPA_E_NONE) ||
+    (IND_OFDPA_RPC(ofdpaTunnelTenantNextGet, id, &id) == OFDPA_E_NONE);
+  while (more)
+  {
+    if (IND_OFDPA_RPC(ofdpaTunnelTenantGet, id, &tenantConfig, NULL) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_tunnel_tenant_insert(id, &tenantConfig);
+    }
+    more = (IND_OFDPA_RPC(ofdpaTunnelTenantNextGet, id, &id) == OFDPA_E_NONE);
+  }
+
+  id = 0;
+  more = (IND_OFDPA_RPC(ofdpaTunnelPortGet, id, NULL, NULL) == OFDPA_E_NONE) ||
+    (IND_OFDPA_RPC(ofdpaTunnelPortNextGet, id, &id) == OFDPA_E_NONE);
+  while (more)
+  {
+    if (IND_OFDPA_RPC(ofdpaTunnelPortGet, id, &portConfig, NULL) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_tunnel_port_insert(id, &portConfig);
+
+      tunnelId = 0;
+      if ((IND_OFDPA_RPC(ofdpaTunnelPortTenantGet, id, tunnelId, NULL) == OFDPA_E_NONE) ||
+          (IND_OFDPA_RPC(ofdpaTunnelPortTenantNextGet, id, tunnelId, &tunnelId) == OFDPA_E_NONE))
+      {
+        do
+        {
+          ind_ofdpa_tunnel_member_insert(id, tunnelId);
+        } while (IND_OFDPA_RPC(ofdpaTunnelPortTenantNextGet, id, tunnelId, &tunnelId) == OFDPA_E_NONE);
+      }
+    }
+    more = (IND_OFDPA_RPC(ofdpaTunnelPortNextGet, id, &id) == OFDPA_E_NONE);
+  }
+
+  id = 0;
+  more = (IND_OFDPA_RPC(ofdpaTunnelNextHopGet, id, NULL, NULL) == OFDPA_E_NONE) ||
+    (IND_OFDPA_RPC(ofdpaTunnelNextHopNextGet, id, &id) == OFDPA_E_NONE);
+  while (more)
+  {
+    if (IND_OFDPA_RPC(ofdpaTunnelNextHopGet, id, &nextHopConfig, NULL) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_tunnel_next_hop_insert(id, &nextHopConfig);
+    }
+    more = (IND_OFDPA_RPC(ofdpaTunnelNextHopNextGet, id, &id) == OFDPA_E_NONE);
+  }
+
+  id = 0;
+  more = (IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupGet, id, NULL, NULL) == OFDPA_E_NONE) ||
+    (IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupNextGet, id, &id) == OFDPA_E_NONE);
+  while (more)
+  {
+    if (IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupGet, id, &ecmpConfig, NULL) == OFDPA_E_NONE)
+    {
+      ind_ofdpa_tunnel_ecmp_insert(id, &ecmpConfig);
+      ecmp = ind_ofdpa_tunnel_ecmp_find(id);
+
+      nextHopId = 0;
+      if ((IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupMemberGet, id, nextHopId) == OFDPA_E_NONE) ||
+          (IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupMemberNextGet, id, nextHopId, &nextHopId) == OFDPA_E_NONE))
+      {
+        do
+        {
+          ind_ofdpa_tunnel_ecmp_member_insert(ecmp, nextHopId);
+        } while (IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupMemberNextGet, id, nextHopId, &nextHopId) == OFDPA_E_NONE);
+      }
+    }
+    more = (IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupNextGet, id, &id) == OFDPA_E_NONE);
+  }
+
+  ind_ofdpa_tunnel_cache.loaded = true;
+  ind_ofdpa_tunnel_cache.loads++;
+  LOG_INFO("Tunnel cache loaded: %d tenants, %d ports, %d next hops, %d ECMP groups",
+           bighash_entry_count(ind_ofdpa_tunnel_cache.tenants),
+           bighash_entry_count(ind_ofdpa_tunnel_cache.ports),
+           bighash_entry_count(ind_ofdpa_tunnel_cache.next_hops),
+           bighash_entry_count(ind_ofdpa_tunnel_cache.ecmps));
+  return INDIGO_ERROR_NONE;
+}
+
+/*
+ * Create and delete
+ *
+ * These call OF-DPA and update the cache on success. Before the cache is
+ * loaded there is nothing to update; the load reads the result.
+ */
+indigo_error_t ind_ofdpa_tunnel_tenant_create(uint32_t tunnelId, ofdpaTunnelTenantConfig_t *config)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelTenantCreate, tunnelId, config);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to create tunnel tenant 0x%x. (ofdpa_rv = %d)", tunnelId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded)
+  {
+    ind_ofdpa_tunnel_tenant_insert(tunnelId, config);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_tenant_delete(uint32_t tunnelId)
+{
+  ind_ofdpa_tunnel_tenant_t *tenant;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelTenantDelete, tunnelId);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to delete tunnel tenant 0x%x. (ofdpa_rv = %d)", tunnelId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded &&
+      ((tenant = ind_ofdpa_tunnel_tenant_find(tunnelId)) != NULL))
+  {
+    ind_ofdpa_tunnel_tenant_remove(tenant);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_port_create(uint32_t portNum, ofdpa_buffdesc *name,
+                                            ofdpaTunnelPortConfig_t *config)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelPortCreate, portNum, name, config);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to create tunnel port 0x%x. (ofdpa_rv = %d)", portNum, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded)
+  {
+    ind_ofdpa_tunnel_port_insert(portNum, config);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_port_delete(uint32_t portNum)
+{
+  ind_ofdpa_tunnel_port_t *port;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelPortDelete, portNum);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to delete tunnel port 0x%x. (ofdpa_rv = %d)", portNum, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded &&
+      ((port = ind_ofdpa_tunnel_port_find(portNum)) != NULL))
+  {
+    ind_ofdpa_tunnel_port_remove(port);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_port_tenant_add(uint32_t portNum, uint32_t tunnelId)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelPortTenantAdd, portNum, tunnelId);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to add tenant 0x%x to tunnel port 0x%x. (ofdpa_rv = %d)",
+              tunnelId, portNum, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded)
+  {
+    ind_ofdpa_tunnel_member_insert(portNum, tunnelId);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_port_tenant_delete(uint32_t portNum, uint32_t tunnelId)
+{
+  ind_ofdpa_tunnel_member_t *member;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelPortTenantDelete, portNum, tunnelId);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to delete tenant 0x%x from tunnel port 0x%x. (ofdpa_rv = %d)",
+              tunnelId, portNum, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded &&
+      ((member = ind_ofdpa_tunnel_member_find(portNum, tunnelId)) != NULL))
+  {
+    ind_ofdpa_tunnel_member_remove(member);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_next_hop_create(uint32_t nextHopId, ofdpaTunnelNextHopConfig_t *config)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelNextHopCreate, nextHopId, config);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to create tunnel next hop %u. (ofdpa_rv = %d)", nextHopId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded)
+  {
+    ind_ofdpa_tunnel_next_hop_insert(nextHopId, config);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_next_hop_modify(uint32_t nextHopId, ofdpaTunnelNextHopConfig_t *config)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelNextHopModify, nextHopId, config);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to modify tunnel next hop %u. (ofdpa_rv = %d)", nextHopId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded)
+  {
+    ind_ofdpa_tunnel_next_hop_insert(nextHopId, config);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_next_hop_delete(uint32_t nextHopId)
+{
+  ind_ofdpa_tunnel_next_hop_t *next_hop;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelNextHopDelete, nextHopId);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to delete tunnel next hop %u. (ofdpa_rv = %d)", nextHopId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded &&
+      ((next_hop = ind_ofdpa_tunnel_next_hop_find(nextHopId)) != NULL))
+  {
+    bighash_remove(ind_ofdpa_tunnel_cache.next_hops, &next_hop->hash_entry);
+    aim_free(next_hop);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_ecmp_create(uint32_t ecmpNextHopGroupId,
+                                            ofdpaTunnelEcmpNextHopGroupConfig_t *config)
+{
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupCreate, ecmpNextHopGroupId, config);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to create tunnel ECMP next hop group %u. (ofdpa_rv = %d)",
+              ecmpNextHopGroupId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded)
+  {
+    ind_ofdpa_tunnel_ecmp_insert(ecmpNextHopGroupId, config);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_ecmp_delete(uint32_t ecmpNextHopGroupId)
+{
+  ind_ofdpa_tunnel_ecmp_t *ecmp;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupDelete, ecmpNextHopGroupId);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to delete tunnel ECMP next hop group %u. (ofdpa_rv = %d)",
+              ecmpNextHopGroupId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded &&
+      ((ecmp = ind_ofdpa_tunnel_ecmp_find(ecmpNextHopGroupId)) != NULL))
+  {
+    ind_ofdpa_tunnel_ecmp_remove(ecmp);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_ecmp_member_add(uint32_t ecmpNextHopGroupId, uint32_t nextHopId)
+{
+  ind_ofdpa_tunnel_ecmp_t *ecmp;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupMemberAdd, ecmpNextHopGroupId, nextHopId);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to add next hop %u to tunnel ECMP next hop group %u. (ofdpa_rv = %d)",
+              nextHopId, ecmpNextHopGroupId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded &&
+      ((ecmp = ind_ofdpa_tunnel_ecmp_find(ecmpNextHopGroupId)) != NULL))
+  {
+    ind_ofdpa_tunnel_ecmp_member_insert(ecmp, nextHopId);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_ecmp_member_delete(uint32_t ecmpNextHopGroupId, uint32_t nextHopId)
+{
+  ind_ofdpa_tunnel_ecmp_t *ecmp;
+  OFDPA_ERROR_t ofdpa_rv;
+
+  ofdpa_rv = IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupMemberDelete, ecmpNextHopGroupId, nextHopId);
+  if (ofdpa_rv != OFDPA_E_NONE)
+  {
+    LOG_ERROR("Failed to delete next hop %u from tunnel ECMP next hop group %u. (ofdpa_rv = %d)",
+              nextHopId, ecmpNextHopGroupId, ofdpa_rv);
+    return indigoConvertOfdpaRv(ofdpa_rv);
+  }
+  if (ind_ofdpa_tunnel_cache.loaded &&
+      ((ecmp = ind_ofdpa_tunnel_ecmp_find(ecmpNextHopGroupId)) != NULL))
+  {
+    ind_ofdpa_tunnel_ecmp_member_remove(ecmp, nextHopId);
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+/*
+ * Set the members of an ECMP next hop group to the given next hops. Only
+ * the difference from the cached membership is sent to OF-DPA, and new
+ * members are added before old ones are deleted so the group is never
+ * left without a path. When the group would go over the OF-DPA member
+ * limit, adds up to the limit go first, then the deletes, then the rest.
+ */
+indigo_error_t ind_ofdpa_tunnel_ecmp_members_set(uint32_t ecmpNextHopGroupId,
+                                                 const uint32_t *nextHopIds, int count)
+{
+  ind_ofdpa_tunnel_ecmp_t *ecmp;
+  indigo_error_t err = INDIGO_ERROR_NONE;
+  uint32_t *want, *add, *del;
+  int nwant = 0, nadd = 0, ndel = 0, room, i, j;
+
+  ind_ofdpa_tunnel_cache_load();
+  if ((ecmp = ind_ofdpa_tunnel_ecmp_find(ecmpNextHopGroupId)) == NULL)
+  {
+    return INDIGO_ERROR_NOT_FOUND;
+  }
+
+  if (ind_ofdpa_tunnel_cache.max_members == 0 &&
+      IND_OFDPA_RPC(ofdpaTunnelEcmpNextHopGroupMaxMembersGet,
+                    &ind_ofdpa_tunnel_cache.max_members) != OFDPA_E_NONE)
+  {
+    ind_ofdpa_tunnel_cache.max_members = 0;
+  }
+
+  /* Sorted and without repeats, to merge against the cached members */
+  want = aim_malloc((count + 1) * sizeof(*want));
+  memcpy(want, nextHopIds, count * sizeof(*want));
+  qsort(want, count, sizeof(*want), ind_ofdpa_tunnel_u32_cmp);
+  for (i = 0; i < count; i++)
+  {
+    if (nwant == 0 || want[nwant - 1] != want[i])
+    {
+      want[nwant++] = want[i];
+    }
+  }
+
+  add = aim_malloc((nwant + 1) * sizeof(*add));
+  del = aim_malloc((ecmp->member_count + 1) * sizeof(*del));
+  for (i = 0, j = 0; i < nwant || j < ecmp->member_count; )
+  {
+    if (j == ecmp->member_count || (i < nwant && want[i] < ecmp->members[j]))
+    {
+      add[nadd++] = want[i++];
+    }
+    else if (i == nwant || ecmp->members[j] < want[i])
+    {
+      del[ndel++] = ecmp->members[j++];
+    }
+    else
+    {
+      i++;
+      j++;
+    }
+  }
+
+  room = nadd;
+  if (ind_ofdpa_tunnel_cache.max_members != 0 &&
+      ecmp->member_count + nadd > ind_ofdpa_tunnel_cache.max_members)
+  {
+    room = ind_ofdpa_tunnel_cache.max_members - ecmp->member_count;
+  }
+
+  for (i = 0; i < room && err == INDIGO_ERROR_NONE; i++)
+  {
+    err = ind_ofdpa_tunnel_ecmp_member_add(ecmpNextHopGroupId, add[i]);
+  }
+  for (j = 0; j < ndel && err == INDIGO_ERROR_NONE; j++)
+  {
+    err = ind_ofdpa_tunnel_ecmp_member_delete(ecmpNextHopGroupId, del[j]);
+  }
+  for (; i < nadd && err == INDIGO_ERROR_NONE; i++)
+  {
+    err = ind_ofdpa_tunnel_ecmp_member_add(ecmpNextHopGroupId, add[i]);
+  }
+
+  LOG_TRACE("ECMP next hop group %u: %d added, %d deleted, %d unchanged",
+            ecmpNextHopGroupId, nadd, ndel, nwant - nadd);
+
+  aim_free(want);
+  aim_free(add);
+  aim_free(del);
+  return err;
+}
+
+/* Lookups, loading the cache on first use */
+indigo_error_t ind_ofdpa_tunnel_tenant_get(uint32_t tunnelId, ofdpaTunnelTenantConfig_t *config)
+{
+  ind_ofdpa_tunnel_tenant_t *tenant;
+
+  ind_ofdpa_tunnel_cache_load();
+  ind_ofdpa_tunnel_cache.lookups++;
+  if ((tenant = ind_ofdpa_tunnel_tenant_find(tunnelId)) == NULL)
+  {
+    return INDIGO_ERROR_NOT_FOUND;
+  }
+  if (config != NULL)
+  {
+    *config = tenant->config;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_port_get(uint32_t portNum, ofdpaTunnelPortConfig_t *config)
+{
+  ind_ofdpa_tunnel_port_t *port;
+
+  ind_ofdpa_tunnel_cache_load();
+  ind_ofdpa_tunnel_cache.lookups++;
+  if ((port = ind_ofdpa_tunnel_port_find(portNum)) == NULL)
+  {
+    return INDIGO_ERROR_NOT_FOUND;
+  }
+  if (config != NULL)
+  {
+    *config = port->config;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+indigo_error_t ind_ofdpa_tunnel_next_hop_get(uint32_t nextHopId, ofdpaTunnelNextHopConfig_t *config)
+{
+  ind_ofdpa_tunnel_next_hop_t *next_hop;
+
+  ind_ofdpa_tunnel_cache_load();
+  ind_ofdpa_tunnel_cache.lookups++;
+  if ((next_hop = ind_ofdpa_tunnel_next_hop_find(nextHopId)) == NULL)
+  {
+    return INDIGO_ERROR_NOT_FOUND;
+  }
+  if (config != NULL)
+  {
+    *config = next_hop->config;
+  }
+  return INDIGO_ERROR_NONE;
+}
+
+int ind_ofdpa_tunnel_port_tenant_is_member(uint32_t portNum, uint32_t tunnelId)
+{
+  ind_ofdpa_tunnel_cache_load();
+  ind_ofdpa_tunnel_cache.lookups++;
+  return (ind_ofdpa_tunnel_member_find(portNum, tunnelId) != NULL);
+}
+
+int ind_ofdpa_tunnel_tenant_ports_get(uint32_t tunnelId, uint32_t *ports, int max)
+{
+  ind_ofdpa_tunnel_tenant_t *tenant;
+  ind_ofdpa_tunnel_member_t *member;
+  list_links_t *cur;
+  int count = 0;
+
+  ind_ofdpa_tunnel_cache_load();
+  ind_ofdpa_tunnel_cache.lookups++;
+  if ((tenant = ind_ofdpa_tunnel_tenant_find(tunnelId)) == NULL)
+  {
+    return 0;
+  }
+
+  LIST_FOREACH(&tenant->ports, cur)
+  {
+    member = container_of(cur, tenant_links, ind_ofdpa_tunnel_member_t);
+    if (count < max)
+    {
+      ports[count] = member->port->id;
+    }
+    count++;
+  }
+  return count;
+}
+
+/* Show, in id order */
+static int ind_ofdpa_tunnel_id_cmp(const void *a, const void *b)
+{
+  uint32_t x = **(const uint32_t * const *)a;
+  uint32_t y = **(const uint32_t * const *)b;
+
+  return (x > y) - (x < y);
+}
+
+/* Entries of a table sorted by id; id is the first field after the hash entry */
+static void **ind_ofdpa_tunnel_sorted(bighash_table_t *table, size_t id_offset, int *count)
+{
+  bighash_iter_t iter;
+  bighash_entry_t *entry;
+  void **entries;
+  int n = 0;
+
+  *count = bighash_entry_count(table);
+  entries = aim_malloc((*count + 1) * sizeof(*entries));
+  for (entry = bighash_iter_start(table, &iter); entry != NULL; entry = bighash_iter_next(&iter))
+  {
+    entries[n++] = (uint8_t *)entry + id_offset;
+  }
+  qsort(entries, n, sizeof(*entries), ind_ofdpa_tunnel_id_cmp);
+  return entries;
+}
+
+#define IND_OFDPA_TUNNEL_SORTED(_table, _type, _count)                       \
+  ind_ofdpa_tunnel_sorted((_table),                                          \
+                          offsetof(_type, id) - offsetof(_type, hash_entry), \
+                          (_count))
+
+#define IND_OFDPA_TUNNEL_ENTRY(_ptr, _type) \
+  ((_type *)((uint8_t *)(_ptr) - offsetof(_type, id)))
+
+void ind_ofdpa_tunnel_cache_show(aim_pvs_t *pvs, int detail)
+{
+  ind_ofdpa_tunnel_tenant_t *tenant;
+  ind_ofdpa_tunnel_port_t *port;
+  ind_ofdpa_tunnel_next_hop_t *next_hop;
+  ind_ofdpa_tunnel_ecmp_t *ecmp;
+  ind_ofdpa_tunnel_member_t *member;
+  list_links_t *cur;
+  struct in_addr addr;
+  void **entries;
+  int count, i, j;
+
+  if (ind_ofdpa_tunnel_cache_load() != INDIGO_ERROR_NONE)
+  {
+    aim_printf(pvs, "Tunnel cache not loaded\n");
+    return;
+  }
+
+  aim_printf(pvs, "Tunnel cache: %d tenants, %d ports, %d memberships, %d next hops, %d ECMP groups\n",
+             bighash_entry_count(ind_ofdpa_tunnel_cache.tenants),
+             bighash_entry_count(ind_ofdpa_tunnel_cache.ports),
+             bighash_entry_count(ind_ofdpa_tunnel_cache.members),
+             bighash_entry_count(ind_ofdpa_tunnel_cache.next_hops),
+             bighash_entry_count(ind_ofdpa_tunnel_cache.ecmps));
+  aim_printf(pvs, "  loads %" PRIu64 ", lookups %" PRIu64 "\n",
+             ind_ofdpa_tunnel_cache.loads, ind_ofdpa_tunnel_cache.lookups);
+  if (!detail)
+  {
+    return;
+  }
+
+  entries = IND_OFDPA_TUNNEL_SORTED(ind_ofdpa_tunnel_cache.tenants, ind_ofdpa_tunnel_tenant_t, &count);
+  aim_printf(pvs, "Tenants:\n");
+  for (i = 0; i < count; i++)
+  {
+    tenant = IND_OFDPA_TUNNEL_ENTRY(entries[i], ind_ofdpa_tunnel_tenant_t);
+    addr.s_addr = htonl(tenant->config.mcastIp);
+    aim_printf(pvs, "  0x%x vni %u mcast %s next hop %u, %u ports:",
+               tenant->id, tenant->config.virtualNetworkId, inet_ntoa(addr),
+               tenant->config.mcastNextHopId, tenant->port_count);
+    LIST_FOREACH(&tenant->ports, cur)
+    {
+      member = container_of(cur, tenant_links, ind_ofdpa_tunnel_member_t);
+      aim_printf(pvs, " 0x%x", member->port->id);
+    }
+    aim_printf(pvs, "\n");
+  }
+  aim_free(entries);
+
+  entries = IND_OFDPA_TUNNEL_SORTED(ind_ofdpa_tunnel_cache.ports, ind_ofdpa_tunnel_port_t, &count);
+  aim_printf(pvs, "Ports:\n");
+  for (i = 0; i < count; i++)
+  {
+    port = IND_OFDPA_TUNNEL_ENTRY(entries[i], ind_ofdpa_tunnel_port_t);
+    if (port->config.type == OFDPA_TUNNEL_PORT_TYPE_ACCESS)
+    {
+      aim_printf(pvs, "  0x%x access port %u vlan %u%s, %u tenants\n",
+                 port->id, port->config.configData.access.physicalPortNum,
+                 port->config.configData.access.vlanId,
+                 port->config.configData.access.untagged ? " untagged" : "",
+                 port->tenant_count);
+    }
+    else
+    {
+      addr.s_addr = htonl(port->config.configData.endpoint.remoteEndpoint);
+      aim_printf(pvs, "  0x%x endpoint remote %s %s %u, %u tenants\n",
+                 port->id, inet_ntoa(addr),
+                 port->config.configData.endpoint.ecmp ? "ecmp group" : "next hop",
+                 port->config.configData.endpoint.nextHopId, port->tenant_count);
+    }
+  }
+  aim_free(entries);
+
+  entries = IND_OFDPA_TUNNEL_SORTED(ind_ofdpa_tunnel_cache.next_hops, ind_ofdpa_tunnel_next_hop_t, &count);
+  aim_printf(pvs, "Next hops:\n");
+  for (i = 0; i < count; i++)
+  {
+    next_hop = IND_OFDPA_TUNNEL_ENTRY(entries[i], ind_ofdpa_tunnel_next_hop_t);
+    aim_printf(pvs, "  %u port %u vlan %u dst %02x:%02x:%02x:%02x:%02x:%02x\n",
+               next_hop->id, next_hop->config.physicalPortNum, next_hop->config.vlanId,
+               next_hop->config.dstAddr.addr[0], next_hop->config.dstAddr.addr[1],
+               next_hop->config.dstAddr.addr[2], next_hop->config.dstAddr.addr[3],
+               next_hop->config.dstAddr.addr[4], next_hop->config.dstAddr.addr[5]);
+  }
+  aim_free(entries);
+
+  entries = IND_OFDPA_TUNNEL_SORTED(ind_ofdpa_tunnel_cache.ecmps, ind_ofdpa_tunnel_ecmp_t, &count);
+  aim_printf(pvs, "ECMP next hop groups:\n");
+  for (i = 0; i < count; i++)
+  {
+    ecmp = IND_OFDPA_TUNNEL_ENTRY(entries[i], ind_ofdpa_tunnel_ecmp_t);
+    aim_printf(pvs, "  %u, %u members:", ecmp->id, ecmp->member_count);
+    for (j = 0; j < ecmp->member_count; j++)
+    {
+      aim_printf(pvs, " %u", ecmp->members[j]);
+    }
+    aim_printf(pvs, "\n");
+  }
+  aim_free(entries);
+}
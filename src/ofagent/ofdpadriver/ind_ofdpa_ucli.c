@@ -0,0 +1,1151 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     ind_ofdpa_ucli.c
+*
+* @purpose      Indigo OF-DPA driver debug commands
+*
+* @component    OF-DPA
+*
+* @comments     none
+*
+* @create       14 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include "ind_ofdpa_util.h"
+
+#if IND_OFDPA_CONFIG_INCLUDE_UCLI == 1
+
+#include <stdio.h>
+#include <string.h>
+#include <uCli/ucli.h>
+#include <uCli/ucli_argparse.h>
+#include <uCli/ucli_handler_macros.h>
+#include "indigo/mem_budget.h"
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__pktcap__(ucli_context_t* uc)
+{
+  char *str;
+  int show_data = 0;
+
+  UCLI_COMMAND_INFO(uc,
+                    "pktcap", -1,
+                    "$summary#Capture punted packets."
+                    "$args#[on|off|clear|data]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "on"))
+    {
+      ind_ofdpa_pkt_capture_enable_set(1);
+      return UCLI_STATUS_OK;
+    }
+    else if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_pkt_capture_enable_set(0);
+      return UCLI_STATUS_OK;
+    }
+    else if (!strcmp(str, "clear"))
+    {
+      ind_ofdpa_pkt_capture_clear();
+      return UCLI_STATUS_OK;
+    }
+    else if (!strcmp(str, "data"))
+    {
+      show_data = 1;
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_pkt_capture_show(&uc->pvs, show_data);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__bucketcache__(ucli_context_t* uc)
+{
+  char *str;
+  ind_ofdpa_bucket_cache_stats_t stats;
+
+  UCLI_COMMAND_INFO(uc,
+                    "bucketcache", -1,
+                    "$summary#Show the translated group bucket cache."
+                    "$args#[clear]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (strcmp(str, "clear"))
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    ind_ofdpa_bucket_cache_clear();
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_bucket_cache_stats_get(&stats);
+  ucli_printf(uc, "hits %"PRIu64" misses %"PRIu64" bypass %"PRIu64"\n",
+              stats.hits, stats.misses, stats.bypass);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__rpcstats__(ucli_context_t* uc)
+{
+  char *str;
+
+  UCLI_COMMAND_INFO(uc,
+                    "rpcstats", -1,
+                    "$summary#Count OF-DPA API calls, errors and latency."
+                    "$args#[on|off|clear]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "on"))
+    {
+      ind_ofdpa_rpc_stats_enable_set(1);
+    }
+    else if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_rpc_stats_enable_set(0);
+    }
+    else if (!strcmp(str, "clear"))
+    {
+      ind_ofdpa_rpc_stats_clear();
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_rpc_stats_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__portstats__(ucli_context_t* uc)
+{
+  char *str;
+  int interval_ms;
+
+  UCLI_COMMAND_INFO(uc,
+                    "portstats", -1,
+                    "$summary#Show or set the port stats cache refresh interval, or show port rates."
+                    "$args#[off|rates|<interval_ms>]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_port_stats_cache_stop();
+    }
+    else if (!strcmp(str, "rates"))
+    {
+      ind_ofdpa_port_stats_rates_show(&uc->pvs);
+    }
+    else if (sscanf(str, "%d", &interval_ms) == 1 && interval_ms > 0)
+    {
+      if (ind_ofdpa_port_stats_cache_start(interval_ms) < 0)
+      {
+        return ucli_error(uc, "failed to start the port stats cache");
+      }
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_port_stats_cache_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__portstatus__(ucli_context_t* uc)
+{
+  int window_ms;
+
+  UCLI_COMMAND_INFO(uc,
+                    "portstatus", -1,
+                    "$summary#Show or set the port status coalescing window."
+                    "$args#[<window_ms>]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "i", &window_ms);
+    if (window_ms < 0)
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    ind_ofdpa_port_status_window_set(window_ms);
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_port_status_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__flowwindow__(ucli_context_t* uc)
+{
+  int window_ms;
+
+  UCLI_COMMAND_INFO(uc,
+                    "flowwindow", -1,
+                    "$summary#Show or set the flow add coalescing window."
+                    "$args#[<window_ms>]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "i", &window_ms);
+    if (window_ms < 0)
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    ind_ofdpa_flow_window_set(window_ms);
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_flow_window_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__ofdpaclient__(ucli_context_t* uc)
+{
+  UCLI_COMMAND_INFO(uc,
+                    "ofdpaclient", 0,
+                    "$summary#Show the asynchronous OF-DPA client threads.");
+
+  ind_ofdpa_async_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__meterstats__(ucli_context_t* uc)
+{
+  char *str;
+  int interval_ms;
+
+  UCLI_COMMAND_INFO(uc,
+                    "meterstats", -1,
+                    "$summary#Show or set the meter stats refresh interval."
+                    "$args#[off|<interval_ms>]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_meter_stats_stop();
+    }
+    else if (sscanf(str, "%d", &interval_ms) == 1 && interval_ms > 0)
+    {
+      if (ind_ofdpa_meter_stats_start(interval_ms) < 0)
+      {
+        return ucli_error(uc, "failed to start the meter stats sweep");
+      }
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_meter_stats_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__groupstats__(ucli_context_t* uc)
+{
+  char *str;
+  int interval_ms;
+
+  UCLI_COMMAND_INFO(uc,
+                    "groupstats", -1,
+                    "$summary#Show or set the group stats refresh interval."
+                    "$args#[off|<interval_ms>]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_group_stats_stop();
+    }
+    else if (sscanf(str, "%d", &interval_ms) == 1 && interval_ms > 0)
+    {
+      if (ind_ofdpa_group_stats_start(interval_ms) < 0)
+      {
+        return ucli_error(uc, "failed to start the group stats sweep");
+      }
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_group_stats_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__scrub__(ucli_context_t* uc)
+{
+  char *str;
+  char *mode = NULL;
+  int interval_ms;
+
+  UCLI_COMMAND_INFO(uc,
+                    "scrub", -1,
+                    "$summary#Show or set the background flow scrubber."
+                    "$args#[off|<interval_ms> [repair]]");
+
+  if (uc->pargs->count == 0)
+  {
+    ind_ofdpa_flow_scrub_show(&uc->pvs);
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_flow_scrub_stop();
+      return UCLI_STATUS_OK;
+    }
+  }
+  else if (uc->pargs->count == 2)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "ss", &str, &mode);
+    if (strcmp(mode, "repair"))
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+  }
+  else
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  if (sscanf(str, "%d", &interval_ms) != 1 || interval_ms <= 0)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+  if (ind_ofdpa_flow_scrub_start(interval_ms, mode != NULL) < 0)
+  {
+    return ucli_error(uc, "failed to start the flow scrubber");
+  }
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__tenantmeter__(ucli_context_t* uc)
+{
+  UCLI_COMMAND_INFO(uc,
+                    "tenantmeter", 0,
+                    "$summary#Show meter and color table counters from the last meter stats sweep.");
+
+  ind_ofdpa_tenant_metering_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__queuestats__(ucli_context_t* uc)
+{
+  char *str;
+  int interval_ms;
+
+  UCLI_COMMAND_INFO(uc,
+                    "queuestats", -1,
+                    "$summary#Show or set the queue stats cache refresh interval."
+                    "$args#[off|<interval_ms>]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_queue_stats_cache_stop();
+    }
+    else if (sscanf(str, "%d", &interval_ms) == 1 && interval_ms > 0)
+    {
+      if (ind_ofdpa_queue_stats_cache_start(interval_ms) < 0)
+      {
+        return ucli_error(uc, "failed to start the queue stats cache");
+      }
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_queue_stats_cache_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__queuerate__(ucli_context_t* uc)
+{
+  uint32_t port, queueId, minRate, maxRate;
+
+  UCLI_COMMAND_INFO(uc,
+                    "queuerate", 4,
+                    "$summary#Set the minimum and maximum rates of a port queue."
+                    "$args#<port> <queue> <min_rate> <max_rate>");
+
+  UCLI_ARGPARSE_OR_RETURN(uc, "iiii", &port, &queueId, &minRate, &maxRate);
+
+  if (ind_ofdpa_queue_rate_set(port, queueId, minRate, maxRate) < 0)
+  {
+    return ucli_error(uc, "failed to set the queue rates");
+  }
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__oamstats__(ucli_context_t* uc)
+{
+  char *str;
+  int interval_ms;
+  uint32_t lmepId, loss, delay;
+
+  UCLI_COMMAND_INFO(uc,
+                    "oamstats", -1,
+                    "$summary#Show or set the OAM counter collector, its thresholds, or a MEP's samples."
+                    "$args#[off|<interval_ms>|mep <lmep_id>|thresholds <loss> <delay>]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_oam_collector_stop();
+    }
+    else if (sscanf(str, "%d", &interval_ms) == 1 && interval_ms > 0)
+    {
+      if (ind_ofdpa_oam_collector_start(interval_ms) < 0)
+      {
+        return ucli_error(uc, "failed to start the OAM counter collector");
+      }
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count == 2)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "si", &str, &lmepId);
+    if (strcmp(str, "mep"))
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    ind_ofdpa_oam_mep_show(&uc->pvs, lmepId);
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count == 3)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "sii", &str, &loss, &delay);
+    if (strcmp(str, "thresholds"))
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    ind_ofdpa_oam_thresholds_set(loss, delay);
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 3)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_oam_collector_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__pktinclass__(ucli_context_t* uc)
+{
+  char *str, *local;
+  int cls;
+  ind_ofdpa_pktin_policy_t policy;
+
+  UCLI_COMMAND_INFO(uc,
+                    "pktinclass", -1,
+                    "$summary#Show or set the packet-in classifier and its class policies."
+                    "$args#[on|off|<class> local|<class> <rate_pps> <burst> <dedup_ms>]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "on"))
+    {
+      if (ind_ofdpa_pktin_classifier_start() < 0)
+      {
+        return ucli_error(uc, "failed to start the packet-in classifier");
+      }
+    }
+    else if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_pktin_classifier_stop();
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count == 2 || uc->pargs->count == 4)
+  {
+    memset(&policy, 0, sizeof(policy));
+    if (uc->pargs->count == 2)
+    {
+      UCLI_ARGPARSE_OR_RETURN(uc, "ss", &str, &local);
+      if (strcmp(local, "local"))
+      {
+        return UCLI_STATUS_E_ARG;
+      }
+      policy.local = 1;
+    }
+    else
+    {
+      UCLI_ARGPARSE_OR_RETURN(uc, "siii", &str, &policy.rate_pps,
+                              &policy.burst, &policy.dedup_ms);
+    }
+    if ((cls = ind_ofdpa_pktin_class_lookup(str)) < 0)
+    {
+      return ucli_error(uc, "unknown class %s", str);
+    }
+    ind_ofdpa_pktin_policy_set(cls, &policy);
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count != 0)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_pktin_classifier_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__pktinmeter__(ucli_context_t* uc)
+{
+  char *str;
+
+  UCLI_COMMAND_INFO(uc,
+                    "pktinmeter", -1,
+                    "$summary#Show or clear the per-port packet-in meter counters."
+                    "$args#[clear]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (strcmp(str, "clear"))
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    ind_ofdpa_pimu_clear();
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_pimu_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__pdu__(ucli_context_t* uc)
+{
+  char *str;
+
+  UCLI_COMMAND_INFO(uc,
+                    "pdu", -1,
+                    "$summary#Show or set the PDU offload and its programmed slots."
+                    "$args#[on|off]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "on"))
+    {
+      if (ind_ofdpa_pdu_offload_start() < 0)
+      {
+        return ucli_error(uc, "failed to start the PDU offload");
+      }
+    }
+    else if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_pdu_offload_stop();
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count != 0)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_pdu_offload_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__arpresponder__(ucli_context_t* uc)
+{
+  char *str;
+
+  UCLI_COMMAND_INFO(uc,
+                    "arpresponder", -1,
+                    "$summary#Show or set the ARP responder and its addresses."
+                    "$args#[on|off]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "on"))
+    {
+      if (ind_ofdpa_arp_responder_start() < 0)
+      {
+        return ucli_error(uc, "failed to start the ARP responder");
+      }
+    }
+    else if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_arp_responder_stop();
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count != 0)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  ind_ofdpa_arp_responder_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__maclearn__(ucli_context_t* uc)
+{
+  char *str;
+  int aging_sec = IND_OFDPA_LEARN_AGING_DEFAULT;
+
+  UCLI_COMMAND_INFO(uc,
+                    "maclearn", -1,
+                    "$summary#Show or set source MAC learning in the agent."
+                    "$args#[on [AGING_SEC]|off|detail]");
+
+  if (uc->pargs->count == 1)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (!strcmp(str, "detail"))
+    {
+      ind_ofdpa_learn_show(&uc->pvs, 1);
+      return UCLI_STATUS_OK;
+    }
+    else if (!strcmp(str, "off"))
+    {
+      ind_ofdpa_learn_stop();
+      return UCLI_STATUS_OK;
+    }
+    else if (strcmp(str, "on"))
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+  }
+  else if (uc->pargs->count == 2)
+  {
+    UCLI_ARGPARSE_OR_RETURN(uc, "si", &str, &aging_sec);
+    if (strcmp(str, "on") || aging_sec <= 0)
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+  }
+  else if (uc->pargs->count != 0)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+  else
+  {
+    ind_ofdpa_learn_show(&uc->pvs, 0);
+    return UCLI_STATUS_OK;
+  }
+
+  if (ind_ofdpa_learn_start(aging_sec) < 0)
+  {
+    return ucli_error(uc, "failed to start MAC learning");
+  }
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__pcap__(ucli_context_t* uc)
+{
+  char filter[256];
+  const char *prefix;
+  uint32_t snaplen = 0;
+  int i, n = 0;
+
+  UCLI_COMMAND_INFO(uc,
+                    "pcap", -1,
+                    "$summary#Write punted and packet_out frames to pcap files."
+                    "$args#[off|<file prefix> [<snaplen> [<filter expression>]]]");
+
+  if (uc->pargs->count == 0)
+  {
+    ind_ofdpa_pcap_show(&uc->pvs);
+    return UCLI_STATUS_OK;
+  }
+
+  prefix = uc->pargs->args[0];
+  if (!strcmp(prefix, "off") && uc->pargs->count == 1)
+  {
+    ind_ofdpa_pcap_stop();
+    return UCLI_STATUS_OK;
+  }
+
+  if (uc->pargs->count > 1 &&
+      sscanf(uc->pargs->args[1], "%u", &snaplen) != 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  /* The rest of the line is the filter */
+  filter[0] = '\0';
+  for (i = 2; i < uc->pargs->count; i++)
+  {
+    n += snprintf(filter + n, sizeof(filter) - n, "%s%s",
+                  (i > 2) ? " " : "", uc->pargs->args[i]);
+    if (n >= sizeof(filter))
+    {
+      return ucli_error(uc, "filter too long");
+    }
+  }
+
+  if (ind_ofdpa_pcap_start(prefix, snaplen, filter) < 0)
+  {
+    return ucli_error(uc, "failed to start the packet tap");
+  }
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__tablecap__(ucli_context_t* uc)
+{
+  UCLI_COMMAND_INFO(uc,
+                    "tablecap", 0,
+                    "$summary#Show flow table occupancy, capacity and adds refused as full.");
+
+  ind_ofdpa_table_capacity_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__rxthread__(ucli_context_t* uc)
+{
+  UCLI_COMMAND_INFO(uc,
+                    "rxthread", 0,
+                    "$summary#Show the packet receive thread counters.");
+
+  ind_ofdpa_rx_thread_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__membudget__(ucli_context_t* uc)
+{
+  UCLI_COMMAND_INFO(uc,
+                    "membudget", 0,
+                    "$summary#Show the memory budget by class.");
+
+  indigo_mem_budget_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__threads__(ucli_context_t* uc)
+{
+  UCLI_COMMAND_INFO(uc,
+                    "threads", -1,
+                    "$summary#Show the thread placements, or set the default placement of a role."
+                    "$args#[<role>@<cpus>[/<policy>[/<priority>]]]");
+
+  if (uc->pargs->count == 1)
+  {
+    char *str;
+
+    UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+    if (ind_ofdpa_thread_option_parse(str) < 0)
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+    return UCLI_STATUS_OK;
+  }
+  else if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  indigo_thread_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__logwriter__(ucli_context_t* uc)
+{
+  UCLI_COMMAND_INFO(uc,
+                    "logwriter", 0,
+                    "$summary#Show the asynchronous log writer counters.");
+
+  indigo_log_async_show(&uc->pvs);
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__pktbuf__(ucli_context_t* uc)
+{
+  uint32_t count;
+  int timeout_ms = 0;
+
+  UCLI_COMMAND_INFO(uc,
+                    "pktbuf", -1,
+                    "$summary#Show or set the packet-in buffers."
+                    "$args#[off|<count> [<timeout_ms>]]");
+
+  if (uc->pargs->count == 0)
+  {
+    ind_ofdpa_pktbuf_show(&uc->pvs);
+    return UCLI_STATUS_OK;
+  }
+
+  if (!strcmp(uc->pargs->args[0], "off"))
+  {
+    count = 0;
+  }
+  else if (sscanf(uc->pargs->args[0], "%u", &count) != 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  if (uc->pargs->count > 1 &&
+      sscanf(uc->pargs->args[1], "%d", &timeout_ms) != 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  if (ind_ofdpa_pktbuf_config(count, timeout_ms) != INDIGO_ERROR_NONE)
+  {
+    return ucli_error(uc, "invalid buffer count or timeout");
+  }
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__tunnels__(ucli_context_t* uc)
+{
+  int detail = 0;
+
+  UCLI_COMMAND_INFO(uc,
+                    "tunnels", -1,
+                    "$summary#Show the cached tenants, tunnel ports and next hops."
+                    "$args#[detail|reload]");
+
+  if (uc->pargs->count > 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+  if (uc->pargs->count == 1)
+  {
+    if (!strcmp(uc->pargs->args[0], "detail"))
+    {
+      detail = 1;
+    }
+    else if (!strcmp(uc->pargs->args[0], "reload"))
+    {
+      ind_ofdpa_tunnel_cache_clear();
+    }
+    else
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+  }
+
+  ind_ofdpa_tunnel_cache_show(&uc->pvs, detail);
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__ecmpmembers__(ucli_context_t* uc)
+{
+  uint32_t groupId, nextHopIds[256];
+  int i;
+
+  UCLI_COMMAND_INFO(uc,
+                    "ecmpmembers", -1,
+                    "$summary#Set the members of a tunnel ECMP next hop group."
+                    "$args#<group> [<next_hop>...]");
+
+  if (uc->pargs->count < 1 || uc->pargs->count - 1 > AIM_ARRAYSIZE(nextHopIds) ||
+      sscanf(uc->pargs->args[0], "%u", &groupId) != 1)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+  for (i = 1; i < uc->pargs->count; i++)
+  {
+    if (sscanf(uc->pargs->args[i], "%u", &nextHopIds[i - 1]) != 1)
+    {
+      return UCLI_STATUS_E_ARG;
+    }
+  }
+
+  if (ind_ofdpa_tunnel_ecmp_members_set(groupId, nextHopIds, uc->pargs->count - 1) < 0)
+  {
+    return ucli_error(uc, "failed to set the ECMP group members");
+  }
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__ffassist__(ucli_context_t* uc)
+{
+  char *str;
+
+  UCLI_COMMAND_INFO(uc,
+                    "ffassist", -1,
+                    "$summary#Show or set local bucket switching of fast failover groups."
+                    "$args#[on|off]");
+
+  if (uc->pargs->count == 0)
+  {
+    ind_ofdpa_ff_assist_show(&uc->pvs);
+    return UCLI_STATUS_OK;
+  }
+
+  UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+  if (!strcmp(str, "on"))
+  {
+    if (ind_ofdpa_ff_assist_start() < 0)
+    {
+      return ucli_error(uc, "failed to start the fast failover assist");
+    }
+  }
+  else if (!strcmp(str, "off"))
+  {
+    ind_ofdpa_ff_assist_stop();
+  }
+  else
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  return UCLI_STATUS_OK;
+}
+
+static ucli_status_t
+ind_ofdpa_ucli_ucli__resilientecmp__(ucli_context_t* uc)
+{
+  char *str;
+  int size;
+
+  UCLI_COMMAND_INFO(uc,
+                    "resilientecmp", -1,
+                    "$summary#Show or set the bucket table size of L3 ECMP groups."
+                    "$args#[off|<size>]");
+
+  if (uc->pargs->count == 0)
+  {
+    ind_ofdpa_resilient_ecmp_show(&uc->pvs);
+    return UCLI_STATUS_OK;
+  }
+
+  UCLI_ARGPARSE_OR_RETURN(uc, "s", &str);
+  if (!strcmp(str, "off"))
+  {
+    size = 0;
+  }
+  else if (sscanf(str, "%d", &size) != 1 || size <= 0)
+  {
+    return UCLI_STATUS_E_ARG;
+  }
+
+  if (ind_ofdpa_resilient_ecmp_set(size) < 0)
+  {
+    return ucli_error(uc, "failed to set the ECMP table size");
+  }
+
+  return UCLI_STATUS_OK;
+}
+
+/* <auto.ucli.handlers.start> */
+/******************************************************************************
+ *
+ * These handler table(s) were autogenerated from the symbols in this
+ * source file.
+ *
+ *****************************************************************************/
+static ucli_command_handler_f ind_ofdpa_ucli_ucli_handlers__[] =
+{
+  ind_ofdpa_ucli_ucli__pktcap__,
+  ind_ofdpa_ucli_ucli__bucketcache__,
+  ind_ofdpa_ucli_ucli__rpcstats__,
+  ind_ofdpa_ucli_ucli__portstats__,
+  ind_ofdpa_ucli_ucli__portstatus__,
+  ind_ofdpa_ucli_ucli__flowwindow__,
+  ind_ofdpa_ucli_ucli__ofdpaclient__,
+  ind_ofdpa_ucli_ucli__meterstats__,
+  ind_ofdpa_ucli_ucli__groupstats__,
+  ind_ofdpa_ucli_ucli__scrub__,
+  ind_ofdpa_ucli_ucli__tenantmeter__,
+  ind_ofdpa_ucli_ucli__queuestats__,
+  ind_ofdpa_ucli_ucli__queuerate__,
+  ind_ofdpa_ucli_ucli__oamstats__,
+  ind_ofdpa_ucli_ucli__pktinclass__,
+  ind_ofdpa_ucli_ucli__pktinmeter__,
+  ind_ofdpa_ucli_ucli__pdu__,
+  ind_ofdpa_ucli_ucli__arpresponder__,
+  ind_ofdpa_ucli_ucli__maclearn__,
+  ind_ofdpa_ucli_ucli__pcap__,
+  ind_ofdpa_ucli_ucli__pktbuf__,
+  ind_ofdpa_ucli_ucli__rxthread__,
+  ind_ofdpa_ucli_ucli__tablecap__,
+  ind_ofdpa_ucli_ucli__logwriter__,
+  ind_ofdpa_ucli_ucli__threads__,
+  ind_ofdpa_ucli_ucli__membudget__,
+  ind_ofdpa_ucli_ucli__tunnels__,
+  ind_ofdpa_ucli_ucli__ecmpmembers__,
+  ind_ofdpa_ucli_ucli__ffassist__,
+  ind_ofdpa_ucli_ucli__resilientecmp__,
+  NULL
+};
+/******************************************************************************/
+/* <auto.ucli.handlers.end> */
+
+static ucli_module_t
+ind_ofdpa_ucli_module__ =
+  {
+    "ind_ofdpa_ucli",
+    NULL,
+    ind_ofdpa_ucli_ucli_handlers__,
+    NULL,
+    NULL,
+  };
+
+ucli_node_t*
+ind_ofdpa_ucli_node_create(void)
+{
+  ucli_node_t* n;
+  ucli_module_init(&ind_ofdpa_ucli_module__);
+  n = ucli_node_create("ofdpa", NULL, &ind_ofdpa_ucli_module__);
+  ucli_node_subnode_add(n, ucli_module_log_node_create("ofdpa"));
+  return n;
+}
+
+#endif /* IND_OFDPA_CONFIG_INCLUDE_UCLI */
@@ -29,8 +29,14 @@
 * @end
 *
 **********************************************************************/
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#include <AIM/aim.h>
 #include "ind_ofdpa_util.h"
 #include "ind_ofdpa_log.h"
+#include "OFConnectionManager/ofconnectionmanager.h"
+#include "indigo/debug_counter.h"
 
 indigo_error_t indigoConvertOfdpaRv(OFDPA_ERROR_t result)
 {
@@ -74,3 +80,224 @@ indigo_error_t indigoConvertOfdpaRv(OFDPA_ERROR_t result)
 }
 
 
+/*
+ * Append an OXM TLV to buf. type_len is the unmasked header, whose length
+ * covers the experimenter id if there is one; mask may be NULL. Value and
+ * mask are in network order. Returns the bytes written, 0 if they do not
+ * fit.
+ */
+int ind_ofdpa_oxm_write(uint8_t *buf, int space, uint32_t type_len, uint32_t experimenter,
+                        const uint8_t *value, const uint8_t *mask)
+{
+  int exp_len = (experimenter != 0) ? 4 : 0;
+  int value_len = (type_len & 0xff) - exp_len;
+  int len = 4 + exp_len + value_len;
+  int offset = 4;
+
+  if (mask != NULL)
+  {
+    type_len = (type_len & 0xfffffe00) | 0x100 | (exp_len + 2 * value_len);
+    len += value_len;
+  }
+  if (value_len <= 0 || len > space)
+  {
+    return 0;
+  }
+
+  buf[0] = type_len >> 24;
+  buf[1] = type_len >> 16;
+  buf[2] = type_len >> 8;
+  buf[3] = type_len;
+  if (experimenter != 0)
+  {
+    buf[4] = experimenter >> 24;
+    buf[5] = experimenter >> 16;
+    buf[6] = experimenter >> 8;
+    buf[7] = experimenter;
+    offset += 4;
+  }
+  memcpy(buf + offset, value, value_len);
+  if (mask != NULL)
+  {
+    memcpy(buf + offset + value_len, mask, value_len);
+  }
+
+  return len;
+}
+
+
+/*
+ * OF-DPA API call statistics. Calls are made from the main loop and the
+ * flow worker thread, so the counters are updated atomically.
+ */
+int ind_ofdpa_rpc_stats_enabled = 0;
+
+static ind_ofdpa_rpc_stats_t ind_ofdpa_rpc_stats[IND_OFDPA_RPC_COUNT];
+
+#define IND_OFDPA_RPC_NAME(_api) #_api,
+static const char *ind_ofdpa_rpc_names[IND_OFDPA_RPC_COUNT] =
+{
+  IND_OFDPA_RPC_APIS(IND_OFDPA_RPC_NAME)
+};
+#undef IND_OFDPA_RPC_NAME
+
+/*
+ * The call counts are also debug counters, ofdpa.rpc.<api>, so a
+ * controller or benchmark can read them with the BSN debug counter
+ * multipart messages. They are registered the first time stats are
+ * enabled.
+ */
+#define IND_OFDPA_RPC_COUNTER_NAME(_api) "ofdpa.rpc." #_api,
+static const char *ind_ofdpa_rpc_counter_names[IND_OFDPA_RPC_COUNT] =
+{
+  IND_OFDPA_RPC_APIS(IND_OFDPA_RPC_COUNTER_NAME)
+};
+#undef IND_OFDPA_RPC_COUNTER_NAME
+
+static debug_counter_t ind_ofdpa_rpc_counters[IND_OFDPA_RPC_COUNT];
+static int ind_ofdpa_rpc_counters_registered = 0;
+
+static uint64_t ind_ofdpa_rpc_counter_get(debug_counter_t *counter)
+{
+  ind_ofdpa_rpc_stats_t *stats = counter->cookie;
+
+  return __atomic_load_n(&stats->calls, __ATOMIC_RELAXED);
+}
+
+static void ind_ofdpa_rpc_counters_register(void)
+{
+  int i;
+
+  if (ind_ofdpa_rpc_counters_registered)
+  {
+    return;
+  }
+
+  for (i = 0; i < IND_OFDPA_RPC_COUNT; i++)
+  {
+    debug_counter_register_get(&ind_ofdpa_rpc_counters[i],
+                               ind_ofdpa_rpc_counter_names[i],
+                               "OF-DPA API calls while call stats are enabled",
+                               ind_ofdpa_rpc_counter_get, &ind_ofdpa_rpc_stats[i]);
+  }
+  ind_ofdpa_rpc_counters_registered = 1;
+}
+
+uint64_t ind_ofdpa_rpc_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * IND_OFDPA_NANO_SEC + ts.tv_nsec;
+}
+
+void ind_ofdpa_rpc_record(ind_ofdpa_rpc_t api, uint64_t start_ns, OFDPA_ERROR_t rv)
+{
+  ind_ofdpa_rpc_stats_t *stats = &ind_ofdpa_rpc_stats[api];
+  uint64_t elapsed = ind_ofdpa_rpc_now_ns() - start_ns;
+  uint64_t max = __atomic_load_n(&stats->max_ns, __ATOMIC_RELAXED);
+  indigo_error_t err;
+
+  __atomic_fetch_add(&stats->calls, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&stats->total_ns, elapsed, __ATOMIC_RELAXED);
+  while (elapsed > max &&
+         !__atomic_compare_exchange_n(&stats->max_ns, &max, elapsed, 1,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+  {
+  }
+
+  if (rv != OFDPA_E_NONE)
+  {
+    err = indigoConvertOfdpaRv(rv);
+    __atomic_fetch_add(&stats->errors, 1, __ATOMIC_RELAXED);
+    if (err == INDIGO_ERROR_NOT_FOUND)
+    {
+      __atomic_fetch_add(&stats->not_found, 1, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&stats->last_error, err, __ATOMIC_RELAXED);
+  }
+}
+
+/* Not found is how lookups and iterations end, so it is not worth noting */
+void ind_ofdpa_rpc_error(ind_ofdpa_rpc_t api, OFDPA_ERROR_t rv)
+{
+  if (rv != OFDPA_E_NOT_FOUND)
+  {
+    ind_cxn_flight_fwd_error(ind_ofdpa_rpc_names[api], rv);
+  }
+}
+
+const char *ind_ofdpa_rpc_name(ind_ofdpa_rpc_t api)
+{
+  return (api < IND_OFDPA_RPC_COUNT) ? ind_ofdpa_rpc_names[api] : "unknown";
+}
+
+void ind_ofdpa_rpc_stats_enable_set(int enable)
+{
+  if (enable)
+  {
+    ind_ofdpa_rpc_counters_register();
+  }
+  __atomic_store_n(&ind_ofdpa_rpc_stats_enabled, enable ? 1 : 0, __ATOMIC_RELAXED);
+}
+
+int ind_ofdpa_rpc_stats_enable_get(void)
+{
+  return __atomic_load_n(&ind_ofdpa_rpc_stats_enabled, __ATOMIC_RELAXED);
+}
+
+void ind_ofdpa_rpc_stats_get(ind_ofdpa_rpc_t api, ind_ofdpa_rpc_stats_t *stats)
+{
+  ind_ofdpa_rpc_stats_t *src = &ind_ofdpa_rpc_stats[api];
+
+  stats->calls = __atomic_load_n(&src->calls, __ATOMIC_RELAXED);
+  stats->errors = __atomic_load_n(&src->errors, __ATOMIC_RELAXED);
+  stats->not_found = __atomic_load_n(&src->not_found, __ATOMIC_RELAXED);
+  stats->total_ns = __atomic_load_n(&src->total_ns, __ATOMIC_RELAXED);
+  stats->max_ns = __atomic_load_n(&src->max_ns, __ATOMIC_RELAXED);
+  stats->last_error = __atomic_load_n(&src->last_error, __ATOMIC_RELAXED);
+}
+
+/* Counts may be off by a call or two if the flow worker is busy meanwhile */
+void ind_ofdpa_rpc_stats_clear(void)
+{
+  int i;
+
+  for (i = 0; i < IND_OFDPA_RPC_COUNT; i++)
+  {
+    ind_ofdpa_rpc_stats_t *stats = &ind_ofdpa_rpc_stats[i];
+
+    __atomic_store_n(&stats->calls, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&stats->errors, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&stats->not_found, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&stats->total_ns, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&stats->max_ns, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&stats->last_error, INDIGO_ERROR_NONE, __ATOMIC_RELAXED);
+  }
+}
+
+void ind_ofdpa_rpc_stats_show(aim_pvs_t *pvs)
+{
+  ind_ofdpa_rpc_stats_t stats;
+  int i;
+
+  aim_printf(pvs, "OF-DPA call stats %s\n",
+             ind_ofdpa_rpc_stats_enable_get() ? "enabled" : "disabled");
+  aim_printf(pvs, "%-30s %10s %8s %8s %10s %10s %12s  %s\n",
+             "api", "calls", "errors", "notfound", "avg_us", "max_us",
+             "total_ms", "last error");
+
+  for (i = 0; i < IND_OFDPA_RPC_COUNT; i++)
+  {
+    ind_ofdpa_rpc_stats_get(i, &stats);
+    if (stats.calls == 0)
+    {
+      continue;
+    }
+    aim_printf(pvs, "%-30s %10"PRIu64" %8"PRIu64" %8"PRIu64" %10.1f %10.1f %12.1f  %s\n",
+               ind_ofdpa_rpc_name(i), stats.calls, stats.errors, stats.not_found,
+               stats.total_ns / 1000.0 / stats.calls, stats.max_ns / 1000.0,
+               stats.total_ns / 1000000.0,
+               stats.errors ? indigo_strerror(stats.last_error) : "-");
+  }
+}
@@ -0,0 +1,99 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     ofdpa_sim.h
+*
+* @purpose      Software OF-DPA dataplane
+*
+* @component    OF-DPA
+*
+* @comments     The simulator implements the part of the OF-DPA client
+*               API that the Indigo driver uses, so ofagent and the
+*               benchmarks can be linked against it instead of the
+*               client library and run on a host without a switch.
+*
+*               Ports are VPI interfaces. They are taken from the
+*               OFDPA_SIM_PORTS environment variable when the client is
+*               initialized, as whitespace separated "<port>=<vpi spec>"
+*               items, e.g. "1=veth|veth0 2=udp|recv:127.0.0.1:7001",
+*               or added with ofdpa_sim_port_add().
+*
+*               Frames received on a port are run through an emulation
+*               of the Ingress Port, VLAN, MPLS L2 Port, Termination MAC,
+*               Unicast Routing, Bridging and Policy ACL tables and the
+*               group chain they select. Flows in other tables are kept
+*               and reported but not matched. See ofdpa_sim_flow.c.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#ifndef INCLUDE_OFDPA_SIM_H
+#define INCLUDE_OFDPA_SIM_H
+
+#include <stdint.h>
+#include "ofdpa_datatypes.h"
+
+/** Environment variable listing the ports created at initialization */
+#define OFDPA_SIM_PORTS_ENV        "OFDPA_SIM_PORTS"
+
+/** Packet-ins queued for ofdpaPktReceive() before new ones are dropped */
+#define OFDPA_SIM_PKTIN_QUEUE_MAX  4096
+
+/** Largest frame a port receives or sends */
+#define OFDPA_SIM_MAX_PKT_SIZE     9216
+
+/** Entries per flow table before ofdpaFlowAdd() reports OFDPA_E_FULL */
+#define OFDPA_SIM_FLOW_TABLE_MAX   (1 << 20)
+
+typedef struct ofdpa_sim_stats_s
+{
+  uint64_t rx_frames;       /* Frames received on any port */
+  uint64_t injected;        /* Frames passed to ofdpa_sim_inject() */
+  uint64_t lookups;         /* Table lookups done by the pipeline */
+  uint64_t pktin_queued;
+  uint64_t pktin_dropped;   /* Packet-in queue full */
+  uint64_t forwarded;       /* Frames sent out of a port by a group */
+  uint64_t dropped;         /* Frames the pipeline left without output */
+  uint64_t flow_events;
+  uint64_t port_events;
+} ofdpa_sim_stats_t;
+
+/**
+ * Create port portNum on the VPI interface described by spec. Ports may
+ * be added before or after ofdpaClientInitialize(); a port added after
+ * raises a port create event.
+ */
+OFDPA_ERROR_t ofdpa_sim_port_add(uint32_t portNum, const char *spec);
+
+/** Destroy a port and raise a port delete event. */
+OFDPA_ERROR_t ofdpa_sim_port_delete(uint32_t portNum);
+
+/** Set the link state of a port and raise a port state event. */
+OFDPA_ERROR_t ofdpa_sim_port_link_set(uint32_t portNum, int up);
+
+/**
+ * Run a frame through the pipeline as if it had been received on
+ * inPortNum, in the calling thread. The port need not exist.
+ */
+OFDPA_ERROR_t ofdpa_sim_inject(uint32_t inPortNum, const uint8_t *data, uint32_t len);
+
+void ofdpa_sim_stats_get(ofdpa_sim_stats_t *stats);
+
+#endif /* INCLUDE_OFDPA_SIM_H */
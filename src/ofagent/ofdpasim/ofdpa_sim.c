@@ -0,0 +1,497 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     ofdpa_sim.c
+*
+* @purpose      Software OF-DPA dataplane: client, events and packet-in
+*
+* @component    OF-DPA
+*
+* @comments     The event and packet sockets of the client library are
+*               eventfds here. Each is readable while its queue holds
+*               something, which is all the socket manager callbacks
+*               in ofagent rely on.
+*
+*               Features the simulator does not model (meters, OAM,
+*               QoS and remark tables) report OFDPA_E_UNAVAIL, and their
+*               walks find nothing.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <BigList/biglist_queue.h>
+#include "ofdpa_sim_int.h"
+
+AIM_LOG_STRUCT_DEFINE(
+                      AIM_LOG_OPTIONS_DEFAULT,
+                      AIM_LOG_BITS_DEFAULT,
+                      NULL,     /* Custom Log Map */
+                      0
+                      );
+
+pthread_rwlock_t ofdpa_sim_lock = PTHREAD_RWLOCK_INITIALIZER;
+ofdpa_sim_stats_t ofdpa_sim_stats;
+
+static int ofdpa_sim_initialized;
+
+/* Events, guarded by ofdpa_sim_event_lock */
+static pthread_mutex_t ofdpa_sim_event_lock = PTHREAD_MUTEX_INITIALIZER;
+static int ofdpa_sim_event_fd = -1;
+static biglist_queue_t ofdpa_sim_port_events;
+static biglist_queue_t ofdpa_sim_flow_events[256];   /* By table */
+static int ofdpa_sim_flow_event_count;
+
+/* Packet-ins, guarded by ofdpa_sim_pktin_lock */
+static pthread_mutex_t ofdpa_sim_pktin_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t ofdpa_sim_pktin_cond = PTHREAD_COND_INITIALIZER;
+static int ofdpa_sim_pkt_fd = -1;
+static biglist_queue_t ofdpa_sim_pktins;
+
+typedef struct ofdpa_sim_pktin_s
+{
+  OFDPA_PACKET_IN_REASON_t reason;
+  OFDPA_FLOW_TABLE_ID_t    tableId;
+  uint32_t                 inPortNum;
+  uint32_t                 len;
+  uint8_t                  data[];
+} ofdpa_sim_pktin_t;
+
+uint64_t ofdpa_sim_now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec;
+}
+
+static void ofdpa_sim_fd_set(int fd)
+{
+  uint64_t one = 1;
+
+  if (write(fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+  {
+    AIM_LOG_ERROR("eventfd write failed: %s", strerror(errno));
+  }
+}
+
+static void ofdpa_sim_fd_clear(int fd)
+{
+  uint64_t value;
+
+  if (read(fd, &value, sizeof(value)) < 0 && errno != EAGAIN)
+  {
+    AIM_LOG_ERROR("eventfd read failed: %s", strerror(errno));
+  }
+}
+
+OFDPA_ERROR_t ofdpaClientInitialize(char *clientName)
+{
+  OFDPA_ERROR_t rv;
+
+  if (ofdpa_sim_initialized)
+  {
+    return OFDPA_E_NONE;
+  }
+
+  AIM_LOG_STRUCT_REGISTER();
+
+  biglist_queue_init(&ofdpa_sim_port_events, 16);
+  biglist_queue_init(&ofdpa_sim_pktins, 64);
+
+  ofdpa_sim_flow_init();
+  ofdpa_sim_group_init();
+  ofdpa_sim_initialized = 1;
+
+  rv = ofdpa_sim_port_init();
+  if (rv != OFDPA_E_NONE)
+  {
+    return rv;
+  }
+
+  AIM_LOG_INFO("OF-DPA simulator initialized for %s", clientName);
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaClientEventSockBind(void)
+{
+  if (ofdpa_sim_event_fd < 0)
+  {
+    ofdpa_sim_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (ofdpa_sim_event_fd < 0)
+    {
+      return OFDPA_E_FAIL;
+    }
+    pthread_mutex_lock(&ofdpa_sim_event_lock);
+    if (ofdpa_sim_port_events.count || ofdpa_sim_flow_event_count)
+    {
+      ofdpa_sim_fd_set(ofdpa_sim_event_fd);
+    }
+    pthread_mutex_unlock(&ofdpa_sim_event_lock);
+  }
+  return OFDPA_E_NONE;
+}
+
+int ofdpaClientEventSockFdGet(void)
+{
+  return ofdpa_sim_event_fd;
+}
+
+OFDPA_ERROR_t ofdpaClientPktSockBind(void)
+{
+  if (ofdpa_sim_pkt_fd < 0)
+  {
+    ofdpa_sim_pkt_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (ofdpa_sim_pkt_fd < 0)
+    {
+      return OFDPA_E_FAIL;
+    }
+  }
+  return OFDPA_E_NONE;
+}
+
+int ofdpaClientPktSockFdGet(void)
+{
+  return ofdpa_sim_pkt_fd;
+}
+
+/*
+ * Events
+ */
+
+void ofdpa_sim_event_signal(void)
+{
+  if (ofdpa_sim_event_fd >= 0)
+  {
+    ofdpa_sim_fd_set(ofdpa_sim_event_fd);
+  }
+}
+
+void ofdpa_sim_port_event_add(uint32_t portNum, OFDPA_PORT_EVENT_MASK_t mask,
+                              OFDPA_PORT_STATE_t state)
+{
+  ofdpaPortEvent_t *event = aim_zmalloc(sizeof(*event));
+
+  event->eventMask = mask;
+  event->portNum = portNum;
+  event->state = state;
+
+  pthread_mutex_lock(&ofdpa_sim_event_lock);
+  biglist_queue_push(&ofdpa_sim_port_events, event);
+  ofdpa_sim_event_signal();
+  pthread_mutex_unlock(&ofdpa_sim_event_lock);
+  OFDPA_SIM_STAT_INC(port_events);
+}
+
+void ofdpa_sim_flow_event_add(OFDPA_FLOW_EVENT_MASK_t mask, ofdpaFlowEntry_t *flow)
+{
+  ofdpaFlowEvent_t *event = aim_zmalloc(sizeof(*event));
+
+  event->eventMask = mask;
+  event->flowMatch = *flow;
+
+  pthread_mutex_lock(&ofdpa_sim_event_lock);
+  biglist_queue_push(&ofdpa_sim_flow_events[flow->tableId & 0xff], event);
+  ofdpa_sim_flow_event_count++;
+  ofdpa_sim_event_signal();
+  pthread_mutex_unlock(&ofdpa_sim_event_lock);
+  OFDPA_SIM_STAT_INC(flow_events);
+}
+
+OFDPA_ERROR_t ofdpaEventReceive(struct timeval *timeout)
+{
+  uint64_t value;
+  fd_set fds;
+
+  if (ofdpa_sim_event_fd < 0)
+  {
+    return OFDPA_E_FAIL;
+  }
+
+  if (read(ofdpa_sim_event_fd, &value, sizeof(value)) == sizeof(value))
+  {
+    return OFDPA_E_NONE;
+  }
+
+  if (timeout != NULL && timeout->tv_sec == 0 && timeout->tv_usec == 0)
+  {
+    return OFDPA_E_TIMEOUT;
+  }
+
+  FD_ZERO(&fds);
+  FD_SET(ofdpa_sim_event_fd, &fds);
+  if (select(ofdpa_sim_event_fd + 1, &fds, NULL, NULL, timeout) <= 0)
+  {
+    return OFDPA_E_TIMEOUT;
+  }
+  ofdpa_sim_fd_clear(ofdpa_sim_event_fd);
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortEventNextGet(ofdpaPortEvent_t *eventData)
+{
+  ofdpaPortEvent_t *event;
+
+  pthread_mutex_lock(&ofdpa_sim_event_lock);
+  event = biglist_queue_shift(&ofdpa_sim_port_events);
+  pthread_mutex_unlock(&ofdpa_sim_event_lock);
+
+  if (event == NULL)
+  {
+    return OFDPA_E_EMPTY;
+  }
+  *eventData = *event;
+  aim_free(event);
+  return OFDPA_E_NONE;
+}
+
+/* Returns the next event of the table given in eventData->flowMatch */
+OFDPA_ERROR_t ofdpaFlowEventNextGet(ofdpaFlowEvent_t *eventData)
+{
+  ofdpaFlowEvent_t *event;
+
+  pthread_mutex_lock(&ofdpa_sim_event_lock);
+  event = biglist_queue_shift(&ofdpa_sim_flow_events[eventData->flowMatch.tableId & 0xff]);
+  if (event != NULL)
+  {
+    ofdpa_sim_flow_event_count--;
+  }
+  pthread_mutex_unlock(&ofdpa_sim_event_lock);
+
+  if (event == NULL)
+  {
+    return OFDPA_E_EMPTY;
+  }
+  *eventData = *event;
+  aim_free(event);
+  return OFDPA_E_NONE;
+}
+
+/*
+ * Packet-in
+ */
+
+void ofdpa_sim_pktin_add(ofdpa_sim_pkt_t *pkt, OFDPA_PACKET_IN_REASON_t reason,
+                         OFDPA_FLOW_TABLE_ID_t tableId)
+{
+  ofdpa_sim_pktin_t *pktin;
+
+  pthread_mutex_lock(&ofdpa_sim_pktin_lock);
+  if (ofdpa_sim_pktins.count >= OFDPA_SIM_PKTIN_QUEUE_MAX)
+  {
+    pthread_mutex_unlock(&ofdpa_sim_pktin_lock);
+    OFDPA_SIM_STAT_INC(pktin_dropped);
+    return;
+  }
+  pthread_mutex_unlock(&ofdpa_sim_pktin_lock);
+
+  pktin = aim_malloc(sizeof(*pktin) + pkt->len);
+  pktin->reason = reason;
+  pktin->tableId = tableId;
+  pktin->inPortNum = pkt->inPort;
+  pktin->len = pkt->len;
+  memcpy(pktin->data, pkt->data, pkt->len);
+
+  pthread_mutex_lock(&ofdpa_sim_pktin_lock);
+  biglist_queue_push(&ofdpa_sim_pktins, pktin);
+  if (ofdpa_sim_pktins.count == 1)
+  {
+    if (ofdpa_sim_pkt_fd >= 0)
+    {
+      ofdpa_sim_fd_set(ofdpa_sim_pkt_fd);
+    }
+    pthread_cond_signal(&ofdpa_sim_pktin_cond);
+  }
+  pthread_mutex_unlock(&ofdpa_sim_pktin_lock);
+  OFDPA_SIM_STAT_INC(pktin_queued);
+}
+
+OFDPA_ERROR_t ofdpaPktReceive(struct timeval *timeout, ofdpaPacket_t *pkt)
+{
+  ofdpa_sim_pktin_t *pktin;
+  struct timespec deadline;
+
+  if (pkt == NULL || pkt->pktData.pstart == NULL)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  if (timeout != NULL)
+  {
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += timeout->tv_sec;
+    deadline.tv_nsec += timeout->tv_usec * 1000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000;
+    }
+  }
+
+  pthread_mutex_lock(&ofdpa_sim_pktin_lock);
+  while (ofdpa_sim_pktins.count == 0)
+  {
+    if (timeout == NULL)
+    {
+      pthread_cond_wait(&ofdpa_sim_pktin_cond, &ofdpa_sim_pktin_lock);
+    }
+    else if (pthread_cond_timedwait(&ofdpa_sim_pktin_cond, &ofdpa_sim_pktin_lock,
+                                    &deadline) == ETIMEDOUT)
+    {
+      pthread_mutex_unlock(&ofdpa_sim_pktin_lock);
+      return OFDPA_E_TIMEOUT;
+    }
+  }
+  pktin = biglist_queue_shift(&ofdpa_sim_pktins);
+  if (ofdpa_sim_pktins.count == 0 && ofdpa_sim_pkt_fd >= 0)
+  {
+    ofdpa_sim_fd_clear(ofdpa_sim_pkt_fd);
+  }
+  pthread_mutex_unlock(&ofdpa_sim_pktin_lock);
+
+  pkt->reason = pktin->reason;
+  pkt->tableId = pktin->tableId;
+  pkt->inPortNum = pktin->inPortNum;
+  /* Truncated to the caller's buffer, as the client library does */
+  if (pktin->len < pkt->pktData.size)
+  {
+    pkt->pktData.size = pktin->len;
+  }
+  memcpy(pkt->pktData.pstart, pktin->data, pkt->pktData.size);
+  aim_free(pktin);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaMaxPktSizeGet(uint32_t *pktSize)
+{
+  *pktSize = OFDPA_SIM_MAX_PKT_SIZE;
+  return OFDPA_E_NONE;
+}
+
+void ofdpa_sim_stats_get(ofdpa_sim_stats_t *stats)
+{
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  *stats = ofdpa_sim_stats;
+}
+
+/*
+ * Features that are not modelled
+ */
+
+OFDPA_ERROR_t ofdpaMeterAdd(uint32_t meterId, ofdpaMeterEntry_t *meter)
+{
+  return OFDPA_E_UNAVAIL;
+}
+
+OFDPA_ERROR_t ofdpaMeterDelete(uint32_t meterId)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaMeterNextGet(uint32_t meterId, uint32_t *nextMeterId)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaMeterStatsGet(uint32_t meterId, ofdpaMeterEntryStats_t *meterStats)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaOamDataCounterAdd(uint32_t lmepId, uint8_t trafficClass)
+{
+  return OFDPA_E_UNAVAIL;
+}
+
+OFDPA_ERROR_t ofdpaOamDataCounterDelete(uint32_t lmepId, uint8_t trafficClass)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaOamDataCountersLMGet(ofdpaOamDataCounterIndex_t index,
+                                        uint32_t *TxFCl, uint32_t *RxFCl)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaOamMepNextGet(uint32_t lmepId, uint32_t *nextLmepId)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaOamProDmCountersGet(uint32_t lmepId, ofdpaOamProDmCounters_t *counters)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaOamProLmCountersGet(uint32_t lmepId, ofdpaOamProLmCounters_t *counters)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaDropStatusAdd(ofdpaDropStatusEntry_t *dropEntry)
+{
+  return OFDPA_E_UNAVAIL;
+}
+
+OFDPA_ERROR_t ofdpaDropStatusDelete(uint32_t lmepId)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaDropStatusGet(uint32_t lmepId, ofdpaDropStatusEntry_t *dropEntry)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaMplsQosActionAdd(ofdpaMplsQosEntry_t *mplsQosEntry)
+{
+  return OFDPA_E_UNAVAIL;
+}
+
+OFDPA_ERROR_t ofdpaMplsQosActionDelete(ofdpaMplsQosEntry_t *mplsQosEntry)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaMplsQosActionEntryGet(uint8_t qosIndex, uint8_t mpls_tc,
+                                         ofdpaMplsQosEntry_t *mplsQosEntry)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaRemarkActionAdd(ofdpaRemarkActionEntry_t *remarkEntry)
+{
+  return OFDPA_E_UNAVAIL;
+}
+
+OFDPA_ERROR_t ofdpaRemarkActionDelete(ofdpaRemarkActionEntry_t *remarkEntry)
+{
+  return OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaRemarkActionEntryGet(ofdpaRemarkActionEntry_t *remarkEntry)
+{
+  return OFDPA_E_NOT_FOUND;
+}
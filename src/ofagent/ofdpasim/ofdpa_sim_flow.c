@@ -0,0 +1,874 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     ofdpa_sim_flow.c
+*
+* @purpose      Software OF-DPA dataplane: flow tables and pipeline
+*
+* @component    OF-DPA
+*
+* @comments     A flow's key is its table, priority and match criteria,
+*               as in OF-DPA. Each table keeps its flows in an array
+*               sorted by key, which gives ofdpaFlowNextGet() its order
+*               and the pipeline its lookup order: walking the array
+*               backwards visits higher priorities first. Flows are also
+*               hashed by cookie.
+*
+*               The pipeline follows the OF-DPA table graph for bridged
+*               and routed traffic: Ingress Port, VLAN, MPLS L2 Port,
+*               Termination MAC, Unicast Routing or Bridging, then Policy
+*               ACL. A goto to any other table continues at the Policy
+*               ACL table. A miss in the VLAN table drops the frame, as
+*               do flows with no goto, except in the Policy ACL table,
+*               where the action set is executed. Header changes made
+*               by the tables are limited to the VLAN tag.
+*
+*               Flows are not removed when they time out; a flow event
+*               is raised once and the agent deletes the flow.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "ofdpa_sim_int.h"
+
+typedef struct ofdpa_sim_flow_s
+{
+  bighash_entry_t  hash_entry;   /* By cookie */
+  ofdpaFlowEntry_t entry;
+  uint64_t         added;
+  uint64_t         last_hit;
+  uint64_t         packets;
+  uint64_t         bytes;
+  int              expired;      /* Flow event raised */
+} ofdpa_sim_flow_t;
+
+typedef struct ofdpa_sim_table_s
+{
+  int                 supported;
+  size_t              match_size;
+  ofdpa_sim_flow_t  **flows;     /* Ascending by key */
+  int                 count;
+  int                 alloc;
+} ofdpa_sim_table_t;
+
+static ofdpa_sim_table_t ofdpa_sim_tables[256];
+static bighash_table_t *ofdpa_sim_cookies;
+
+#define OFDPA_SIM_MATCH_SIZE(_entry) \
+  sizeof(((ofdpaFlowEntry_t *)0)->flowData._entry.match_criteria)
+
+static const struct
+{
+  OFDPA_FLOW_TABLE_ID_t tableId;
+  size_t                match_size;
+} ofdpa_sim_table_defs[] =
+{
+  { OFDPA_FLOW_TABLE_ID_INGRESS_PORT,             OFDPA_SIM_MATCH_SIZE(ingressPortFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_PORT_DSCP_TRUST,          OFDPA_SIM_MATCH_SIZE(dscpTrustFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_PORT_PCP_TRUST,           OFDPA_SIM_MATCH_SIZE(pcpTrustFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_TUNNEL_DSCP_TRUST,        OFDPA_SIM_MATCH_SIZE(dscpTrustFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_TUNNEL_PCP_TRUST,         OFDPA_SIM_MATCH_SIZE(pcpTrustFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_INJECTED_OAM,             OFDPA_SIM_MATCH_SIZE(injectedOamFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_VLAN,                     OFDPA_SIM_MATCH_SIZE(vlanFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_VLAN_1,                   OFDPA_SIM_MATCH_SIZE(vlan1FlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MAINTENANCE_POINT,        OFDPA_SIM_MATCH_SIZE(mpFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MPLS_L2_PORT,             OFDPA_SIM_MATCH_SIZE(mplsL2PortFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MPLS_DSCP_TRUST,          OFDPA_SIM_MATCH_SIZE(dscpTrustFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MPLS_PCP_TRUST,           OFDPA_SIM_MATCH_SIZE(pcpTrustFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_L2_POLICER,               OFDPA_SIM_MATCH_SIZE(l2PolicerFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_L2_POLICER_ACTIONS,       OFDPA_SIM_MATCH_SIZE(l2PolicerActionsFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_TERMINATION_MAC,          OFDPA_SIM_MATCH_SIZE(terminationMacFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MPLS_0,                   OFDPA_SIM_MATCH_SIZE(mplsFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MPLS_1,                   OFDPA_SIM_MATCH_SIZE(mplsFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MPLS_2,                   OFDPA_SIM_MATCH_SIZE(mplsFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MPLS_MAINTENANCE_POINT,   OFDPA_SIM_MATCH_SIZE(mplsMpFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING,          OFDPA_SIM_MATCH_SIZE(unicastRoutingFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_MULTICAST_ROUTING,        OFDPA_SIM_MATCH_SIZE(multicastRoutingFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_BRIDGING,                 OFDPA_SIM_MATCH_SIZE(bridgingFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_ACL_POLICY,               OFDPA_SIM_MATCH_SIZE(policyAclFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_COLOR_BASED_ACTIONS,      OFDPA_SIM_MATCH_SIZE(colorActionsFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_EGRESS_VLAN,              OFDPA_SIM_MATCH_SIZE(egressVlanFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_EGRESS_VLAN_1,            OFDPA_SIM_MATCH_SIZE(egressVlan1FlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_EGRESS_MAINTENANCE_POINT, OFDPA_SIM_MATCH_SIZE(egressMpFlowEntry) },
+  { OFDPA_FLOW_TABLE_ID_EGRESS_DSCP_PCP_REMARK,   OFDPA_SIM_MATCH_SIZE(egressDscpPcpRemarkFlowEntry) },
+};
+
+void ofdpa_sim_flow_init(void)
+{
+  int i;
+
+  for (i = 0; i < AIM_ARRAYSIZE(ofdpa_sim_table_defs); i++)
+  {
+    ofdpa_sim_tables[ofdpa_sim_table_defs[i].tableId].supported = 1;
+    ofdpa_sim_tables[ofdpa_sim_table_defs[i].tableId].match_size =
+      ofdpa_sim_table_defs[i].match_size;
+  }
+
+  ofdpa_sim_cookies = bighash_table_create(1024);
+  bighash_table_autogrow_set(ofdpa_sim_cookies, 4);
+}
+
+static uint32_t ofdpa_sim_cookie_hash(uint64_t cookie)
+{
+  cookie ^= cookie >> 33;
+  cookie *= 0xff51afd7ed558ccdULL;
+  cookie ^= cookie >> 33;
+  return (uint32_t)cookie;
+}
+
+static ofdpa_sim_table_t *ofdpa_sim_table_get(OFDPA_FLOW_TABLE_ID_t tableId)
+{
+  if ((unsigned)tableId >= AIM_ARRAYSIZE(ofdpa_sim_tables) ||
+      !ofdpa_sim_tables[tableId].supported)
+  {
+    return NULL;
+  }
+  return &ofdpa_sim_tables[tableId];
+}
+
+static int ofdpa_sim_flow_cmp(ofdpa_sim_table_t *table,
+                              const ofdpaFlowEntry_t *a, const ofdpaFlowEntry_t *b)
+{
+  if (a->priority != b->priority)
+  {
+    return (a->priority < b->priority) ? -1 : 1;
+  }
+  return memcmp(&a->flowData, &b->flowData, table->match_size);
+}
+
+/* Index of the first flow whose key is not below flow's */
+static int ofdpa_sim_flow_search(ofdpa_sim_table_t *table, const ofdpaFlowEntry_t *flow)
+{
+  int lo = 0, hi = table->count;
+  int mid;
+
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (ofdpa_sim_flow_cmp(table, &table->flows[mid]->entry, flow) < 0)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+static ofdpa_sim_flow_t *ofdpa_sim_flow_find(ofdpa_sim_table_t *table,
+                                             const ofdpaFlowEntry_t *flow, int *index)
+{
+  int i = ofdpa_sim_flow_search(table, flow);
+
+  if (index != NULL)
+  {
+    *index = i;
+  }
+  if (i < table->count && ofdpa_sim_flow_cmp(table, &table->flows[i]->entry, flow) == 0)
+  {
+    return table->flows[i];
+  }
+  return NULL;
+}
+
+static ofdpa_sim_flow_t *ofdpa_sim_flow_by_cookie(uint64_t cookie)
+{
+  uint32_t hash = ofdpa_sim_cookie_hash(cookie);
+  bighash_entry_t *e;
+  ofdpa_sim_flow_t *flow;
+
+  for (e = bighash_first(ofdpa_sim_cookies, hash); e != NULL; e = bighash_next(e))
+  {
+    flow = container_of(e, hash_entry, ofdpa_sim_flow_t);
+    if (flow->entry.cookie == cookie)
+    {
+      return flow;
+    }
+  }
+  return NULL;
+}
+
+/* The group a flow writes to the action set, or 0 */
+static uint32_t ofdpa_sim_flow_group(const ofdpaFlowEntry_t *flow)
+{
+  switch (flow->tableId)
+  {
+    case OFDPA_FLOW_TABLE_ID_MPLS_L2_PORT:
+      return flow->flowData.mplsL2PortFlowEntry.groupId;
+    case OFDPA_FLOW_TABLE_ID_MPLS_0:
+    case OFDPA_FLOW_TABLE_ID_MPLS_1:
+    case OFDPA_FLOW_TABLE_ID_MPLS_2:
+      return flow->flowData.mplsFlowEntry.groupID;
+    case OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING:
+      return flow->flowData.unicastRoutingFlowEntry.groupID;
+    case OFDPA_FLOW_TABLE_ID_MULTICAST_ROUTING:
+      return flow->flowData.multicastRoutingFlowEntry.groupID;
+    case OFDPA_FLOW_TABLE_ID_BRIDGING:
+      return flow->flowData.bridgingFlowEntry.groupID;
+    case OFDPA_FLOW_TABLE_ID_ACL_POLICY:
+      return flow->flowData.policyAclFlowEntry.groupID;
+    default:
+      return 0;
+  }
+}
+
+static void ofdpa_sim_flow_stats_fill(ofdpa_sim_flow_t *flow, ofdpaFlowEntryStats_t *flowStats)
+{
+  if (flowStats == NULL)
+  {
+    return;
+  }
+  flowStats->durationSec = ofdpa_sim_now() - flow->added;
+  flowStats->receivedPackets = __atomic_load_n(&flow->packets, __ATOMIC_RELAXED);
+  flowStats->receivedBytes = __atomic_load_n(&flow->bytes, __ATOMIC_RELAXED);
+}
+
+OFDPA_ERROR_t ofdpaFlowEntryInit(OFDPA_FLOW_TABLE_ID_t tableId, ofdpaFlowEntry_t *flow)
+{
+  if (ofdpa_sim_table_get(tableId) == NULL)
+  {
+    return OFDPA_E_PARAM;
+  }
+  memset(flow, 0, sizeof(*flow));
+  flow->tableId = tableId;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaFlowTableSupported(OFDPA_FLOW_TABLE_ID_t tableId)
+{
+  return (ofdpa_sim_table_get(tableId) != NULL) ? OFDPA_E_NONE : OFDPA_E_NOT_FOUND;
+}
+
+OFDPA_ERROR_t ofdpaFlowTableInfoGet(OFDPA_FLOW_TABLE_ID_t tableId, ofdpaFlowTableInfo_t *info)
+{
+  ofdpa_sim_table_t *table = ofdpa_sim_table_get(tableId);
+
+  if (table == NULL)
+  {
+    return OFDPA_E_NOT_FOUND;
+  }
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  info->numEntries = table->count;
+  info->maxEntries = OFDPA_SIM_FLOW_TABLE_MAX;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaFlowAdd(ofdpaFlowEntry_t *flow)
+{
+  ofdpa_sim_table_t *table = ofdpa_sim_table_get(flow->tableId);
+  ofdpa_sim_flow_t *entry;
+  int i;
+
+  if (table == NULL)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  if (ofdpa_sim_flow_find(table, flow, &i) != NULL ||
+      (flow->cookie != 0 && ofdpa_sim_flow_by_cookie(flow->cookie) != NULL))
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_EXISTS;
+  }
+  if (table->count >= OFDPA_SIM_FLOW_TABLE_MAX)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_FULL;
+  }
+
+  if (table->count == table->alloc)
+  {
+    table->alloc = table->alloc ? table->alloc * 2 : 64;
+    table->flows = aim_realloc(table->flows, table->alloc * sizeof(*table->flows));
+  }
+
+  entry = aim_zmalloc(sizeof(*entry));
+  entry->entry = *flow;
+  entry->added = ofdpa_sim_now();
+  entry->last_hit = entry->added;
+
+  memmove(&table->flows[i + 1], &table->flows[i],
+          (table->count - i) * sizeof(*table->flows));
+  table->flows[i] = entry;
+  table->count++;
+
+  bighash_insert(ofdpa_sim_cookies, &entry->hash_entry,
+                 ofdpa_sim_cookie_hash(flow->cookie));
+  ofdpa_sim_group_ref(ofdpa_sim_flow_group(flow), 1);
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaFlowModify(ofdpaFlowEntry_t *flow)
+{
+  ofdpa_sim_table_t *table = ofdpa_sim_table_get(flow->tableId);
+  ofdpa_sim_flow_t *entry;
+
+  if (table == NULL)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  entry = ofdpa_sim_flow_find(table, flow, NULL);
+  if (entry == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+
+  if (entry->entry.cookie != flow->cookie)
+  {
+    bighash_remove(ofdpa_sim_cookies, &entry->hash_entry);
+    bighash_insert(ofdpa_sim_cookies, &entry->hash_entry,
+                   ofdpa_sim_cookie_hash(flow->cookie));
+  }
+  ofdpa_sim_group_ref(ofdpa_sim_flow_group(&entry->entry), -1);
+  ofdpa_sim_group_ref(ofdpa_sim_flow_group(flow), 1);
+  entry->entry = *flow;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+/* Unlink the flow at index i of table; called with the lock held */
+static void ofdpa_sim_flow_remove(ofdpa_sim_table_t *table, int i)
+{
+  ofdpa_sim_flow_t *entry = table->flows[i];
+
+  memmove(&table->flows[i], &table->flows[i + 1],
+          (table->count - i - 1) * sizeof(*table->flows));
+  table->count--;
+
+  bighash_remove(ofdpa_sim_cookies, &entry->hash_entry);
+  ofdpa_sim_group_ref(ofdpa_sim_flow_group(&entry->entry), -1);
+}
+
+OFDPA_ERROR_t ofdpaFlowDelete(ofdpaFlowEntry_t *flow)
+{
+  ofdpa_sim_table_t *table = ofdpa_sim_table_get(flow->tableId);
+  ofdpa_sim_flow_t *entry;
+  int i;
+
+  if (table == NULL)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  entry = ofdpa_sim_flow_find(table, flow, &i);
+  if (entry == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  ofdpa_sim_flow_remove(table, i);
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  aim_free(entry);
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaFlowByCookieDelete(uint64_t cookie)
+{
+  ofdpa_sim_flow_t *entry;
+  ofdpa_sim_table_t *table;
+  int i;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  entry = ofdpa_sim_flow_by_cookie(cookie);
+  if (entry == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+
+  table = &ofdpa_sim_tables[entry->entry.tableId];
+  ofdpa_sim_flow_find(table, &entry->entry, &i);
+  ofdpa_sim_flow_remove(table, i);
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  aim_free(entry);
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaFlowByCookieGet(uint64_t cookie, ofdpaFlowEntry_t *flow,
+                                   ofdpaFlowEntryStats_t *flowStats)
+{
+  ofdpa_sim_flow_t *entry;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  entry = ofdpa_sim_flow_by_cookie(cookie);
+  if (entry == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  if (flow != NULL)
+  {
+    *flow = entry->entry;
+  }
+  ofdpa_sim_flow_stats_fill(entry, flowStats);
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaFlowStatsGet(ofdpaFlowEntry_t *flow, ofdpaFlowEntryStats_t *flowStats)
+{
+  ofdpa_sim_table_t *table = ofdpa_sim_table_get(flow->tableId);
+  ofdpa_sim_flow_t *entry;
+
+  if (table == NULL)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  entry = ofdpa_sim_flow_find(table, flow, NULL);
+  if (entry == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  ofdpa_sim_flow_stats_fill(entry, flowStats);
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+/* The flow after flow's key in its table; flow need not exist */
+OFDPA_ERROR_t ofdpaFlowNextGet(ofdpaFlowEntry_t *flow, ofdpaFlowEntry_t *nextFlow)
+{
+  ofdpa_sim_table_t *table = ofdpa_sim_table_get(flow->tableId);
+  int i;
+
+  if (table == NULL)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  if (ofdpa_sim_flow_find(table, flow, &i) != NULL)
+  {
+    i++;
+  }
+  if (i >= table->count)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  *nextFlow = table->flows[i]->entry;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+/* Raise a flow event for each flow past its timeout */
+void ofdpa_sim_flow_expire(void)
+{
+  uint64_t now = ofdpa_sim_now();
+  ofdpa_sim_table_t *table;
+  ofdpa_sim_flow_t *flow;
+  int t, i;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  for (t = 0; t < AIM_ARRAYSIZE(ofdpa_sim_tables); t++)
+  {
+    table = &ofdpa_sim_tables[t];
+    for (i = 0; i < table->count; i++)
+    {
+      flow = table->flows[i];
+      if (flow->expired)
+      {
+        continue;
+      }
+      if (flow->entry.hard_time != 0 && now - flow->added >= flow->entry.hard_time)
+      {
+        flow->expired = 1;
+        ofdpa_sim_flow_event_add(OFDPA_FLOW_EVENT_HARD_TIMEOUT, &flow->entry);
+      }
+      else if (flow->entry.idle_time != 0 &&
+               now - __atomic_load_n(&flow->last_hit, __ATOMIC_RELAXED) >= flow->entry.idle_time)
+      {
+        flow->expired = 1;
+        ofdpa_sim_flow_event_add(OFDPA_FLOW_EVENT_IDLE_TIMEOUT, &flow->entry);
+      }
+    }
+  }
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+}
+
+/*
+ * Pipeline
+ */
+
+#define OFDPA_SIM_MASKED_EQ(_a, _b, _mask) ((((_a) ^ (_b)) & (_mask)) == 0)
+
+static int ofdpa_sim_mac_match(const uint8_t *pkt_mac, const ofdpaMacAddr_t *mac,
+                               const ofdpaMacAddr_t *mask)
+{
+  int i;
+
+  for (i = 0; i < OFDPA_MAC_ADDR_LEN; i++)
+  {
+    if ((pkt_mac[i] ^ mac->addr[i]) & mask->addr[i])
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static uint16_t ofdpa_sim_be16(const uint8_t *p)
+{
+  return (p[0] << 8) | p[1];
+}
+
+static uint32_t ofdpa_sim_be32(const uint8_t *p)
+{
+  return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static int ofdpa_sim_parse(ofdpa_sim_pkt_t *pkt)
+{
+  const uint8_t *data = pkt->data;
+  uint32_t off = 14;
+  uint32_t ihl;
+
+  if (pkt->len < 14)
+  {
+    return -1;
+  }
+
+  pkt->etherType = ofdpa_sim_be16(data + 12);
+  if ((pkt->etherType == 0x8100 || pkt->etherType == 0x88a8) && pkt->len >= 18)
+  {
+    pkt->tagVid = OFDPA_VID_PRESENT | (ofdpa_sim_be16(data + 14) & OFDPA_VID_EXACT_MASK);
+    pkt->etherType = ofdpa_sim_be16(data + 16);
+    off = 18;
+  }
+  pkt->l3Offset = off;
+
+  if (pkt->etherType == 0x0800 && pkt->len >= off + 20)
+  {
+    ihl = (data[off] & 0x0f) * 4;
+    pkt->dscp = data[off + 1] >> 2;
+    pkt->ipProto = data[off + 9];
+    pkt->srcIp4 = ofdpa_sim_be32(data + off + 12);
+    pkt->dstIp4 = ofdpa_sim_be32(data + off + 16);
+    if ((pkt->ipProto == 6 || pkt->ipProto == 17 || pkt->ipProto == 132) &&
+        pkt->len >= off + ihl + 4)
+    {
+      pkt->srcL4Port = ofdpa_sim_be16(data + off + ihl);
+      pkt->dstL4Port = ofdpa_sim_be16(data + off + ihl + 2);
+    }
+  }
+  return 0;
+}
+
+static int ofdpa_sim_ingress_port_match(const ofdpaFlowEntry_t *flow, const ofdpa_sim_pkt_t *pkt)
+{
+  const ofdpaIngressPortFlowMatch_t *m = &flow->flowData.ingressPortFlowEntry.match_criteria;
+
+  return OFDPA_SIM_MASKED_EQ(m->inPort, pkt->inPort, m->inPortMask) &&
+    OFDPA_SIM_MASKED_EQ(m->etherType, pkt->etherType, m->etherTypeMask) &&
+    OFDPA_SIM_MASKED_EQ(m->tunnelId, pkt->tunnelId, m->tunnelIdMask);
+}
+
+static int ofdpa_sim_vlan_match(const ofdpaFlowEntry_t *flow, const ofdpa_sim_pkt_t *pkt)
+{
+  const ofdpaVlanFlowMatch_t *m = &flow->flowData.vlanFlowEntry.match_criteria;
+
+  return m->inPort == pkt->inPort &&
+    OFDPA_SIM_MASKED_EQ(m->vlanId, pkt->tagVid, m->vlanIdMask);
+}
+
+static int ofdpa_sim_mpls_l2_port_match(const ofdpaFlowEntry_t *flow, const ofdpa_sim_pkt_t *pkt)
+{
+  const ofdpaMplsL2PortFlowMatch_t *m = &flow->flowData.mplsL2PortFlowEntry.match_criteria;
+
+  return OFDPA_SIM_MASKED_EQ(m->mplsL2Port, pkt->mplsL2Port, m->mplsL2PortMask) &&
+    (m->tunnelId == 0 || m->tunnelId == pkt->tunnelId) &&
+    OFDPA_SIM_MASKED_EQ(m->etherType, pkt->etherType, m->etherTypeMask);
+}
+
+static int ofdpa_sim_termination_mac_match(const ofdpaFlowEntry_t *flow, const ofdpa_sim_pkt_t *pkt)
+{
+  const ofdpaTerminationMacFlowMatch_t *m = &flow->flowData.terminationMacFlowEntry.match_criteria;
+
+  return OFDPA_SIM_MASKED_EQ(m->inPort, pkt->inPort, m->inPortMask) &&
+    (m->etherType == 0 || m->etherType == pkt->etherType) &&
+    OFDPA_SIM_MASKED_EQ(m->vlanId, pkt->vlanId, m->vlanIdMask) &&
+    ofdpa_sim_mac_match(pkt->data, &m->destMac, &m->destMacMask);
+}
+
+static int ofdpa_sim_unicast_routing_match(const ofdpaFlowEntry_t *flow, const ofdpa_sim_pkt_t *pkt)
+{
+  const ofdpaUnicastRoutingFlowMatch_t *m = &flow->flowData.unicastRoutingFlowEntry.match_criteria;
+
+  return m->etherType == 0x0800 && pkt->etherType == 0x0800 &&
+    OFDPA_SIM_MASKED_EQ(m->vrf, pkt->vrf, m->vrfMask) &&
+    OFDPA_SIM_MASKED_EQ(m->dstIp4, pkt->dstIp4, m->dstIp4Mask);
+}
+
+static int ofdpa_sim_bridging_match(const ofdpaFlowEntry_t *flow, const ofdpa_sim_pkt_t *pkt)
+{
+  const ofdpaBridgingFlowMatch_t *m = &flow->flowData.bridgingFlowEntry.match_criteria;
+
+  return OFDPA_SIM_MASKED_EQ(m->vlanId, pkt->vlanId, m->vlanIdMask) &&
+    OFDPA_SIM_MASKED_EQ(m->tunnelId, pkt->tunnelId, m->tunnelIdMask) &&
+    ofdpa_sim_mac_match(pkt->data, &m->destMac, &m->destMacMask);
+}
+
+static int ofdpa_sim_acl_match(const ofdpaFlowEntry_t *flow, const ofdpa_sim_pkt_t *pkt)
+{
+  const ofdpaPolicyAclFlowMatch_t *m = &flow->flowData.policyAclFlowEntry.match_criteria;
+
+  if (!OFDPA_SIM_MASKED_EQ(m->inPort, pkt->inPort, m->inPortMask) ||
+      !OFDPA_SIM_MASKED_EQ(m->mplsL2Port, pkt->mplsL2Port, m->mplsL2PortMask) ||
+      !OFDPA_SIM_MASKED_EQ(m->etherType, pkt->etherType, m->etherTypeMask) ||
+      !OFDPA_SIM_MASKED_EQ(m->vlanId, pkt->vlanId, m->vlanIdMask) ||
+      !OFDPA_SIM_MASKED_EQ(m->tunnelId, pkt->tunnelId, m->tunnelIdMask) ||
+      !OFDPA_SIM_MASKED_EQ(m->vrf, pkt->vrf, m->vrfMask) ||
+      !ofdpa_sim_mac_match(pkt->data, &m->destMac, &m->destMacMask) ||
+      !ofdpa_sim_mac_match(pkt->data + 6, &m->srcMac, &m->srcMacMask))
+  {
+    return 0;
+  }
+
+  if (pkt->etherType != 0x0800)
+  {
+    /* IPv4 fields only match IPv4 frames */
+    return (m->sourceIp4Mask | m->destIp4Mask | m->ipProtoMask | m->dscpMask |
+            m->srcL4PortMask | m->destL4PortMask) == 0;
+  }
+
+  return OFDPA_SIM_MASKED_EQ(m->sourceIp4, pkt->srcIp4, m->sourceIp4Mask) &&
+    OFDPA_SIM_MASKED_EQ(m->destIp4, pkt->dstIp4, m->destIp4Mask) &&
+    OFDPA_SIM_MASKED_EQ(m->ipProto, pkt->ipProto, m->ipProtoMask) &&
+    OFDPA_SIM_MASKED_EQ(m->dscp, pkt->dscp, m->dscpMask) &&
+    OFDPA_SIM_MASKED_EQ(m->srcL4Port, pkt->srcL4Port, m->srcL4PortMask) &&
+    OFDPA_SIM_MASKED_EQ(m->destL4Port, pkt->dstL4Port, m->destL4PortMask);
+}
+
+typedef int (*ofdpa_sim_match_f)(const ofdpaFlowEntry_t *flow, const ofdpa_sim_pkt_t *pkt);
+
+/* Highest priority flow of a table matching pkt; counts the hit */
+static ofdpa_sim_flow_t *ofdpa_sim_lookup(OFDPA_FLOW_TABLE_ID_t tableId,
+                                          ofdpa_sim_match_f match, ofdpa_sim_pkt_t *pkt)
+{
+  ofdpa_sim_table_t *table = &ofdpa_sim_tables[tableId];
+  ofdpa_sim_flow_t *flow;
+  int i;
+
+  OFDPA_SIM_STAT_INC(lookups);
+  for (i = table->count - 1; i >= 0; i--)
+  {
+    flow = table->flows[i];
+    if (match(&flow->entry, pkt))
+    {
+      __atomic_add_fetch(&flow->packets, 1, __ATOMIC_RELAXED);
+      __atomic_add_fetch(&flow->bytes, pkt->len, __ATOMIC_RELAXED);
+      __atomic_store_n(&flow->last_hit, ofdpa_sim_now(), __ATOMIC_RELAXED);
+      return flow;
+    }
+  }
+  return NULL;
+}
+
+static void ofdpa_sim_to_controller(ofdpa_sim_pkt_t *pkt, uint32_t outputPort,
+                                    OFDPA_FLOW_TABLE_ID_t tableId)
+{
+  if (outputPort == OFDPA_PORT_CONTROLLER && !pkt->toController)
+  {
+    pkt->toController = 1;
+    pkt->controllerTable = tableId;
+  }
+}
+
+void ofdpa_sim_pipeline(ofdpa_sim_pkt_t *pkt)
+{
+  OFDPA_FLOW_TABLE_ID_t tableId = OFDPA_FLOW_TABLE_ID_INGRESS_PORT;
+  OFDPA_FLOW_TABLE_ID_t gotoTableId;
+  ofdpa_sim_flow_t *flow;
+  const ofdpaFlowEntry_t *e;
+
+  if (ofdpa_sim_parse(pkt) < 0)
+  {
+    OFDPA_SIM_STAT_INC(dropped);
+    return;
+  }
+  pkt->vlanId = pkt->tagVid;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+
+  for (;;)
+  {
+    switch (tableId)
+    {
+      case OFDPA_FLOW_TABLE_ID_INGRESS_PORT:
+        flow = ofdpa_sim_lookup(tableId, ofdpa_sim_ingress_port_match, pkt);
+        /* The default ingress port flows go to the VLAN table */
+        gotoTableId = flow ? flow->entry.flowData.ingressPortFlowEntry.gotoTableId
+          : OFDPA_FLOW_TABLE_ID_VLAN;
+        if (flow != NULL && flow->entry.flowData.ingressPortFlowEntry.vrfAction)
+        {
+          pkt->vrf = flow->entry.flowData.ingressPortFlowEntry.vrf;
+        }
+        break;
+
+      case OFDPA_FLOW_TABLE_ID_VLAN:
+        flow = ofdpa_sim_lookup(tableId, ofdpa_sim_vlan_match, pkt);
+        if (flow == NULL)
+        {
+          gotoTableId = 0;
+          break;
+        }
+        e = &flow->entry;
+        gotoTableId = e->flowData.vlanFlowEntry.gotoTableId;
+        if (e->flowData.vlanFlowEntry.setVlanIdAction)
+        {
+          pkt->vlanId = OFDPA_VID_PRESENT | e->flowData.vlanFlowEntry.newVlanId;
+        }
+        if (e->flowData.vlanFlowEntry.vrfAction)
+        {
+          pkt->vrf = e->flowData.vlanFlowEntry.vrf;
+        }
+        if (e->flowData.vlanFlowEntry.mplsL2PortAction)
+        {
+          pkt->mplsL2Port = e->flowData.vlanFlowEntry.mplsL2Port;
+        }
+        if (e->flowData.vlanFlowEntry.tunnelIdAction)
+        {
+          pkt->tunnelId = e->flowData.vlanFlowEntry.tunnelId;
+        }
+        break;
+
+      case OFDPA_FLOW_TABLE_ID_MPLS_L2_PORT:
+        flow = ofdpa_sim_lookup(tableId, ofdpa_sim_mpls_l2_port_match, pkt);
+        gotoTableId = flow ? flow->entry.flowData.mplsL2PortFlowEntry.gotoTableId : 0;
+        if (flow != NULL && flow->entry.flowData.mplsL2PortFlowEntry.groupId != 0)
+        {
+          pkt->groupId = flow->entry.flowData.mplsL2PortFlowEntry.groupId;
+        }
+        break;
+
+      case OFDPA_FLOW_TABLE_ID_TERMINATION_MAC:
+        flow = ofdpa_sim_lookup(tableId, ofdpa_sim_termination_mac_match, pkt);
+        if (flow == NULL)
+        {
+          gotoTableId = OFDPA_FLOW_TABLE_ID_BRIDGING;
+          break;
+        }
+        gotoTableId = flow->entry.flowData.terminationMacFlowEntry.gotoTableId;
+        ofdpa_sim_to_controller(pkt, flow->entry.flowData.terminationMacFlowEntry.outputPort,
+                                tableId);
+        break;
+
+      case OFDPA_FLOW_TABLE_ID_UNICAST_ROUTING:
+        flow = ofdpa_sim_lookup(tableId, ofdpa_sim_unicast_routing_match, pkt);
+        if (flow == NULL)
+        {
+          gotoTableId = OFDPA_FLOW_TABLE_ID_ACL_POLICY;
+          break;
+        }
+        e = &flow->entry;
+        gotoTableId = e->flowData.unicastRoutingFlowEntry.gotoTableId;
+        if (e->flowData.unicastRoutingFlowEntry.groupID != 0)
+        {
+          pkt->groupId = e->flowData.unicastRoutingFlowEntry.groupID;
+        }
+        ofdpa_sim_to_controller(pkt, e->flowData.unicastRoutingFlowEntry.outputPort, tableId);
+        break;
+
+      case OFDPA_FLOW_TABLE_ID_BRIDGING:
+        flow = ofdpa_sim_lookup(tableId, ofdpa_sim_bridging_match, pkt);
+        if (flow == NULL)
+        {
+          gotoTableId = OFDPA_FLOW_TABLE_ID_ACL_POLICY;
+          break;
+        }
+        e = &flow->entry;
+        gotoTableId = e->flowData.bridgingFlowEntry.gotoTableId;
+        if (e->flowData.bridgingFlowEntry.groupID != 0)
+        {
+          pkt->groupId = e->flowData.bridgingFlowEntry.groupID;
+        }
+        ofdpa_sim_to_controller(pkt, e->flowData.bridgingFlowEntry.outputPort, tableId);
+        break;
+
+      case OFDPA_FLOW_TABLE_ID_ACL_POLICY:
+        flow = ofdpa_sim_lookup(tableId, ofdpa_sim_acl_match, pkt);
+        if (flow != NULL)
+        {
+          e = &flow->entry;
+          if (e->flowData.policyAclFlowEntry.clearAction)
+          {
+            pkt->groupId = 0;
+          }
+          if (e->flowData.policyAclFlowEntry.groupID != 0)
+          {
+            pkt->groupId = e->flowData.policyAclFlowEntry.groupID;
+          }
+          ofdpa_sim_to_controller(pkt, e->flowData.policyAclFlowEntry.outputPort, tableId);
+        }
+        /* Last table: execute the action set */
+        if (pkt->groupId != 0)
+        {
+          ofdpa_sim_group_apply(pkt);
+        }
+        else if (!pkt->toController)
+        {
+          OFDPA_SIM_STAT_INC(dropped);
+        }
+        pthread_rwlock_unlock(&ofdpa_sim_lock);
+        goto done;
+
+      default:
+        /* Not modelled; the ACL table still applies */
+        gotoTableId = OFDPA_FLOW_TABLE_ID_ACL_POLICY;
+        break;
+    }
+
+    /* Tables only go forward; anything else ends the pipeline */
+    if (gotoTableId <= tableId)
+    {
+      break;
+    }
+    tableId = gotoTableId;
+  }
+
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+  OFDPA_SIM_STAT_INC(dropped);
+
+done:
+  if (pkt->toController)
+  {
+    ofdpa_sim_pktin_add(pkt, OFDPA_PACKET_IN_REASON_ACTION, pkt->controllerTable);
+  }
+}
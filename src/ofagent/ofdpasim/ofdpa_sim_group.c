@@ -0,0 +1,732 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     ofdpa_sim_group.c
+*
+* @purpose      Software OF-DPA dataplane: group table
+*
+* @component    OF-DPA
+*
+* @comments     Groups are kept in an array sorted by id and their buckets
+*               in arrays sorted by index. A group's reference count
+*               covers flows and buckets that name it; a referenced group
+*               cannot be deleted.
+*
+*               Applying a group walks the chain of referenced groups,
+*               collecting the MAC and VLAN rewrites of the L2 Rewrite,
+*               L3 Unicast, L3 Interface and MPLS Interface buckets, and
+*               builds the frame when it reaches an interface group.
+*               Flood and multicast groups replicate to every bucket,
+*               except back out of the ingress port; ECMP groups pick a
+*               bucket by a hash of the frame's addresses; fast failover
+*               groups use the first bucket whose watch port is live.
+*               MPLS labels are not pushed: MPLS Label buckets only pass
+*               the frame on to the group they reference.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <string.h>
+#include "ofdpa_sim_int.h"
+
+/* Bound on the length of a group chain */
+#define OFDPA_SIM_GROUP_DEPTH_MAX 8
+
+typedef struct ofdpa_sim_group_s
+{
+  uint32_t                 groupId;
+  uint32_t                 refCount;
+  uint64_t                 added;
+  ofdpaGroupBucketEntry_t *buckets;   /* Ascending by bucketIndex */
+  int                      bucketCount;
+  int                      bucketAlloc;
+} ofdpa_sim_group_t;
+
+static ofdpa_sim_group_t **ofdpa_sim_groups;   /* Ascending by groupId */
+static int ofdpa_sim_group_count;
+static int ofdpa_sim_group_alloc;
+
+/* Rewrites collected along a group chain */
+typedef struct ofdpa_sim_egress_s
+{
+  uint8_t  srcMac[OFDPA_MAC_ADDR_LEN];
+  uint8_t  dstMac[OFDPA_MAC_ADDR_LEN];
+  int      setSrcMac;
+  int      setDstMac;
+  uint16_t vlanId;                    /* 0 to keep the frame's tag */
+  int      replicated;                /* Below a flood or multicast group */
+} ofdpa_sim_egress_t;
+
+void ofdpa_sim_group_init(void)
+{
+}
+
+static int ofdpa_sim_group_search(uint32_t groupId)
+{
+  int lo = 0, hi = ofdpa_sim_group_count;
+  int mid;
+
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (ofdpa_sim_groups[mid]->groupId < groupId)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+static ofdpa_sim_group_t *ofdpa_sim_group_find(uint32_t groupId)
+{
+  int i = ofdpa_sim_group_search(groupId);
+
+  if (i < ofdpa_sim_group_count && ofdpa_sim_groups[i]->groupId == groupId)
+  {
+    return ofdpa_sim_groups[i];
+  }
+  return NULL;
+}
+
+static int ofdpa_sim_bucket_search(ofdpa_sim_group_t *group, uint32_t bucketIndex)
+{
+  int lo = 0, hi = group->bucketCount;
+  int mid;
+
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (group->buckets[mid].bucketIndex < bucketIndex)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+static ofdpaGroupBucketEntry_t *ofdpa_sim_bucket_find(ofdpa_sim_group_t *group,
+                                                      uint32_t bucketIndex)
+{
+  int i = ofdpa_sim_bucket_search(group, bucketIndex);
+
+  if (i < group->bucketCount && group->buckets[i].bucketIndex == bucketIndex)
+  {
+    return &group->buckets[i];
+  }
+  return NULL;
+}
+
+/* Called with ofdpa_sim_lock held for writing */
+void ofdpa_sim_group_ref(uint32_t groupId, int delta)
+{
+  ofdpa_sim_group_t *group;
+
+  if (groupId == 0)
+  {
+    return;
+  }
+  group = ofdpa_sim_group_find(groupId);
+  if (group != NULL)
+  {
+    group->refCount += delta;
+  }
+}
+
+OFDPA_ERROR_t ofdpaGroupTypeGet(uint32_t groupId, uint32_t *type)
+{
+  *type = groupId >> 28;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupMplsSubTypeGet(uint32_t groupId, uint32_t *subType)
+{
+  uint32_t type = groupId >> 28;
+
+  if (type != OFDPA_GROUP_ENTRY_TYPE_MPLS_LABEL &&
+      type != OFDPA_GROUP_ENTRY_TYPE_MPLS_FORWARDING)
+  {
+    return OFDPA_E_UNAVAIL;
+  }
+  *subType = (groupId >> 24) & 0xf;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupAdd(ofdpaGroupEntry_t *group)
+{
+  ofdpa_sim_group_t *entry;
+  int i;
+
+  if ((group->groupId >> 28) >= OFDPA_GROUP_ENTRY_TYPE_LAST)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  i = ofdpa_sim_group_search(group->groupId);
+  if (i < ofdpa_sim_group_count && ofdpa_sim_groups[i]->groupId == group->groupId)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_EXISTS;
+  }
+
+  if (ofdpa_sim_group_count == ofdpa_sim_group_alloc)
+  {
+    ofdpa_sim_group_alloc = ofdpa_sim_group_alloc ? ofdpa_sim_group_alloc * 2 : 64;
+    ofdpa_sim_groups = aim_realloc(ofdpa_sim_groups,
+                                   ofdpa_sim_group_alloc * sizeof(*ofdpa_sim_groups));
+  }
+
+  entry = aim_zmalloc(sizeof(*entry));
+  entry->groupId = group->groupId;
+  entry->added = ofdpa_sim_now();
+
+  memmove(&ofdpa_sim_groups[i + 1], &ofdpa_sim_groups[i],
+          (ofdpa_sim_group_count - i) * sizeof(*ofdpa_sim_groups));
+  ofdpa_sim_groups[i] = entry;
+  ofdpa_sim_group_count++;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+static void ofdpa_sim_buckets_clear(ofdpa_sim_group_t *group)
+{
+  int i;
+
+  for (i = 0; i < group->bucketCount; i++)
+  {
+    ofdpa_sim_group_ref(group->buckets[i].referenceGroupId, -1);
+  }
+  group->bucketCount = 0;
+}
+
+OFDPA_ERROR_t ofdpaGroupDelete(uint32_t groupId)
+{
+  ofdpa_sim_group_t *group;
+  int i;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  i = ofdpa_sim_group_search(groupId);
+  if (i >= ofdpa_sim_group_count || ofdpa_sim_groups[i]->groupId != groupId)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  group = ofdpa_sim_groups[i];
+  if (group->refCount != 0)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_FAIL;
+  }
+
+  ofdpa_sim_buckets_clear(group);
+  memmove(&ofdpa_sim_groups[i], &ofdpa_sim_groups[i + 1],
+          (ofdpa_sim_group_count - i - 1) * sizeof(*ofdpa_sim_groups));
+  ofdpa_sim_group_count--;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  aim_free(group->buckets);
+  aim_free(group);
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupNextGet(uint32_t groupId, ofdpaGroupEntry_t *nextGroup)
+{
+  int i;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  i = ofdpa_sim_group_search(groupId);
+  if (i < ofdpa_sim_group_count && ofdpa_sim_groups[i]->groupId == groupId)
+  {
+    i++;
+  }
+  if (i >= ofdpa_sim_group_count)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  nextGroup->groupId = ofdpa_sim_groups[i]->groupId;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupStatsGet(uint32_t groupId, ofdpaGroupEntryStats_t *groupStats)
+{
+  ofdpa_sim_group_t *group;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  group = ofdpa_sim_group_find(groupId);
+  if (group == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  groupStats->refCount = group->refCount;
+  groupStats->duration = ofdpa_sim_now() - group->added;
+  groupStats->bucketCount = group->bucketCount;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupTableTotalEntryCountGet(uint32_t *entryCount)
+{
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  *entryCount = ofdpa_sim_group_count;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupBucketEntryAdd(ofdpaGroupBucketEntry_t *bucket)
+{
+  ofdpa_sim_group_t *group;
+  int i;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  group = ofdpa_sim_group_find(bucket->groupId);
+  if (group == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  if (bucket->referenceGroupId != 0 &&
+      ofdpa_sim_group_find(bucket->referenceGroupId) == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  i = ofdpa_sim_bucket_search(group, bucket->bucketIndex);
+  if (i < group->bucketCount && group->buckets[i].bucketIndex == bucket->bucketIndex)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_EXISTS;
+  }
+
+  if (group->bucketCount == group->bucketAlloc)
+  {
+    group->bucketAlloc = group->bucketAlloc ? group->bucketAlloc * 2 : 4;
+    group->buckets = aim_realloc(group->buckets,
+                                 group->bucketAlloc * sizeof(*group->buckets));
+  }
+  memmove(&group->buckets[i + 1], &group->buckets[i],
+          (group->bucketCount - i) * sizeof(*group->buckets));
+  group->buckets[i] = *bucket;
+  group->bucketCount++;
+  ofdpa_sim_group_ref(bucket->referenceGroupId, 1);
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupBucketEntryModify(ofdpaGroupBucketEntry_t *bucket)
+{
+  ofdpa_sim_group_t *group;
+  ofdpaGroupBucketEntry_t *entry;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  group = ofdpa_sim_group_find(bucket->groupId);
+  entry = group ? ofdpa_sim_bucket_find(group, bucket->bucketIndex) : NULL;
+  if (entry == NULL ||
+      (bucket->referenceGroupId != 0 &&
+       ofdpa_sim_group_find(bucket->referenceGroupId) == NULL))
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  ofdpa_sim_group_ref(entry->referenceGroupId, -1);
+  ofdpa_sim_group_ref(bucket->referenceGroupId, 1);
+  *entry = *bucket;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupBucketEntryDelete(uint32_t groupId, uint32_t bucketIndex)
+{
+  ofdpa_sim_group_t *group;
+  int i;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  group = ofdpa_sim_group_find(groupId);
+  if (group == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  i = ofdpa_sim_bucket_search(group, bucketIndex);
+  if (i >= group->bucketCount || group->buckets[i].bucketIndex != bucketIndex)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  ofdpa_sim_group_ref(group->buckets[i].referenceGroupId, -1);
+  memmove(&group->buckets[i], &group->buckets[i + 1],
+          (group->bucketCount - i - 1) * sizeof(*group->buckets));
+  group->bucketCount--;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupBucketsDeleteAll(uint32_t groupId)
+{
+  ofdpa_sim_group_t *group;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_lock);
+  group = ofdpa_sim_group_find(groupId);
+  if (group == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  ofdpa_sim_buckets_clear(group);
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupBucketEntryGet(uint32_t groupId, uint32_t bucketIndex,
+                                       ofdpaGroupBucketEntry_t *groupBucket)
+{
+  ofdpa_sim_group_t *group;
+  ofdpaGroupBucketEntry_t *entry;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  group = ofdpa_sim_group_find(groupId);
+  entry = group ? ofdpa_sim_bucket_find(group, bucketIndex) : NULL;
+  if (entry == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  *groupBucket = *entry;
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupBucketEntryFirstGet(uint32_t groupId,
+                                            ofdpaGroupBucketEntry_t *firstGroupBucket)
+{
+  ofdpa_sim_group_t *group;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  group = ofdpa_sim_group_find(groupId);
+  if (group == NULL || group->bucketCount == 0)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  *firstGroupBucket = group->buckets[0];
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaGroupBucketEntryNextGet(uint32_t groupId, uint32_t bucketIndex,
+                                           ofdpaGroupBucketEntry_t *nextBucketEntry)
+{
+  ofdpa_sim_group_t *group;
+  int i;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_lock);
+  group = ofdpa_sim_group_find(groupId);
+  if (group == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  i = ofdpa_sim_bucket_search(group, bucketIndex);
+  if (i < group->bucketCount && group->buckets[i].bucketIndex == bucketIndex)
+  {
+    i++;
+  }
+  if (i >= group->bucketCount)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  *nextBucketEntry = group->buckets[i];
+  pthread_rwlock_unlock(&ofdpa_sim_lock);
+
+  return OFDPA_E_NONE;
+}
+
+/*
+ * Group application; called from the pipeline with ofdpa_sim_lock held
+ * for reading
+ */
+
+static void ofdpa_sim_egress_rewrite(ofdpa_sim_egress_t *egress, const ofdpaMacAddr_t *srcMac,
+                                     const ofdpaMacAddr_t *dstMac, uint32_t vlanId)
+{
+  static const uint8_t zero[OFDPA_MAC_ADDR_LEN];
+
+  if (srcMac != NULL && memcmp(srcMac->addr, zero, OFDPA_MAC_ADDR_LEN))
+  {
+    memcpy(egress->srcMac, srcMac->addr, OFDPA_MAC_ADDR_LEN);
+    egress->setSrcMac = 1;
+  }
+  if (dstMac != NULL && memcmp(dstMac->addr, zero, OFDPA_MAC_ADDR_LEN))
+  {
+    memcpy(egress->dstMac, dstMac->addr, OFDPA_MAC_ADDR_LEN);
+    egress->setDstMac = 1;
+  }
+  if (vlanId & OFDPA_VID_EXACT_MASK)
+  {
+    egress->vlanId = OFDPA_VID_PRESENT | (vlanId & OFDPA_VID_EXACT_MASK);
+  }
+}
+
+/* Build the frame for an interface bucket and send it */
+static void ofdpa_sim_egress_output(ofdpa_sim_pkt_t *pkt, ofdpa_sim_egress_t *egress,
+                                    uint32_t portNum, int tagged, int keepTag)
+{
+  uint8_t frame[OFDPA_SIM_MAX_PKT_SIZE + 4];
+  const uint8_t *payload = pkt->data + 12;
+  uint32_t payloadLen = pkt->len - 12;
+  uint16_t vid;
+  uint32_t len;
+
+  if (egress->replicated && portNum == pkt->inPort)
+  {
+    return;
+  }
+
+  memcpy(frame, egress->setDstMac ? egress->dstMac : pkt->data, OFDPA_MAC_ADDR_LEN);
+  memcpy(frame + 6, egress->setSrcMac ? egress->srcMac : pkt->data + 6, OFDPA_MAC_ADDR_LEN);
+  len = 12;
+
+  if (pkt->tagVid != 0)
+  {
+    if (keepTag)
+    {
+      /* Keep the received tag as it is */
+      memcpy(frame + len, payload, 4);
+      len += 4;
+    }
+    payload += 4;
+    payloadLen -= 4;
+  }
+  else if (keepTag)
+  {
+    tagged = 0;
+  }
+
+  if (tagged)
+  {
+    vid = egress->vlanId ? egress->vlanId : pkt->vlanId;
+    frame[len++] = 0x81;
+    frame[len++] = 0x00;
+    frame[len++] = (vid >> 8) & 0x0f;
+    frame[len++] = vid & 0xff;
+  }
+
+  if (len + payloadLen > sizeof(frame))
+  {
+    OFDPA_SIM_STAT_INC(dropped);
+    return;
+  }
+  memcpy(frame + len, payload, payloadLen);
+  len += payloadLen;
+
+  ofdpa_sim_port_output(portNum, frame, len);
+}
+
+static uint32_t ofdpa_sim_pkt_hash(const ofdpa_sim_pkt_t *pkt)
+{
+  uint32_t hash = 2166136261u;
+  uint32_t words[4];
+  const uint8_t *p;
+  int i;
+
+  words[0] = pkt->srcIp4;
+  words[1] = pkt->dstIp4;
+  words[2] = ((uint32_t)pkt->srcL4Port << 16) | pkt->dstL4Port;
+  words[3] = pkt->ipProto;
+  p = (const uint8_t *)words;
+  for (i = 0; i < sizeof(words); i++)
+  {
+    hash = (hash ^ p[i]) * 16777619u;
+  }
+  for (i = 0; i < 2 * OFDPA_MAC_ADDR_LEN; i++)
+  {
+    hash = (hash ^ pkt->data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static void ofdpa_sim_group_chain(ofdpa_sim_pkt_t *pkt, uint32_t groupId,
+                                  ofdpa_sim_egress_t egress, int depth)
+{
+  ofdpa_sim_group_t *group;
+  ofdpaGroupBucketEntry_t *bucket;
+  uint32_t type = groupId >> 28;
+  uint32_t subType = (groupId >> 24) & 0xf;
+  int i;
+
+  group = ofdpa_sim_group_find(groupId);
+  if (group == NULL || group->bucketCount == 0 || depth >= OFDPA_SIM_GROUP_DEPTH_MAX)
+  {
+    OFDPA_SIM_STAT_INC(dropped);
+    return;
+  }
+  bucket = &group->buckets[0];
+
+  switch (type)
+  {
+    case OFDPA_GROUP_ENTRY_TYPE_L2_INTERFACE:
+      ofdpa_sim_egress_output(pkt, &egress, bucket->bucketData.l2Interface.outputPort,
+                              !bucket->bucketData.l2Interface.popVlanTag, 0);
+      return;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_UNFILTERED_INTERFACE:
+      ofdpa_sim_egress_output(pkt, &egress,
+                              bucket->bucketData.l2UnfilteredInterface.outputPort, 1, 1);
+      return;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_OVERLAY:
+      egress.replicated = 1;
+      for (i = 0; i < group->bucketCount; i++)
+      {
+        ofdpa_sim_egress_output(pkt, &egress,
+                                group->buckets[i].bucketData.l2Overlay.outputPort, 1, 1);
+      }
+      return;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_REWRITE:
+      ofdpa_sim_egress_rewrite(&egress, &bucket->bucketData.l2Rewrite.srcMac,
+                               &bucket->bucketData.l2Rewrite.dstMac,
+                               bucket->bucketData.l2Rewrite.vlanId);
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L3_UNICAST:
+      ofdpa_sim_egress_rewrite(&egress, &bucket->bucketData.l3Unicast.srcMac,
+                               &bucket->bucketData.l3Unicast.dstMac,
+                               bucket->bucketData.l3Unicast.vlanId);
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L3_INTERFACE:
+      ofdpa_sim_egress_rewrite(&egress, &bucket->bucketData.l3Interface.srcMac, NULL,
+                               bucket->bucketData.l3Interface.vlanId);
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L2_MULTICAST:
+    case OFDPA_GROUP_ENTRY_TYPE_L2_FLOOD:
+    case OFDPA_GROUP_ENTRY_TYPE_L3_MULTICAST:
+      egress.replicated = 1;
+      for (i = 0; i < group->bucketCount; i++)
+      {
+        ofdpa_sim_group_chain(pkt, group->buckets[i].referenceGroupId, egress, depth + 1);
+      }
+      return;
+
+    case OFDPA_GROUP_ENTRY_TYPE_L3_ECMP:
+      bucket = &group->buckets[ofdpa_sim_pkt_hash(pkt) % group->bucketCount];
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_MPLS_LABEL:
+      if (subType == OFDPA_MPLS_INTERFACE)
+      {
+        ofdpa_sim_egress_rewrite(&egress, &bucket->bucketData.mplsInterface.srcMac,
+                                 &bucket->bucketData.mplsInterface.dstMac,
+                                 bucket->bucketData.mplsInterface.vlanId);
+      }
+      break;
+
+    case OFDPA_GROUP_ENTRY_TYPE_MPLS_FORWARDING:
+      switch (subType)
+      {
+        case OFDPA_MPLS_L2_FLOOD:
+        case OFDPA_MPLS_L2_MULTICAST:
+        case OFDPA_MPLS_L2_LOCAL_FLOOD:
+        case OFDPA_MPLS_L2_LOCAL_MULTICAST:
+        case OFDPA_MPLS_L2_FLOOD_SPLIT_HORIZON:
+        case OFDPA_MPLS_L2_MULTICAST_SPLIT_HORIZON:
+          egress.replicated = 1;
+          for (i = 0; i < group->bucketCount; i++)
+          {
+            ofdpa_sim_group_chain(pkt, group->buckets[i].referenceGroupId, egress, depth + 1);
+          }
+          return;
+
+        case OFDPA_MPLS_FAST_FAILOVER:
+        case OFDPA_MPLS_1_1_HEAD_END_PROTECT:
+          for (i = 0; i < group->bucketCount; i++)
+          {
+            if (ofdpa_sim_port_live(group->buckets[i].bucketData.mplsFastFailOver.watchPort))
+            {
+              break;
+            }
+          }
+          if (i == group->bucketCount)
+          {
+            OFDPA_SIM_STAT_INC(dropped);
+            return;
+          }
+          bucket = &group->buckets[i];
+          break;
+
+        case OFDPA_MPLS_ECMP:
+          bucket = &group->buckets[ofdpa_sim_pkt_hash(pkt) % group->bucketCount];
+          break;
+
+        case OFDPA_MPLS_L2_TAG:
+          if (bucket->bucketData.mplsL2Tag.pushVlan)
+          {
+            egress.vlanId = OFDPA_VID_PRESENT |
+              (bucket->bucketData.mplsL2Tag.vlanId & OFDPA_VID_EXACT_MASK);
+          }
+          break;
+
+        default:
+          break;
+      }
+      break;
+
+    default:
+      OFDPA_SIM_STAT_INC(dropped);
+      return;
+  }
+
+  if (bucket->referenceGroupId == 0)
+  {
+    OFDPA_SIM_STAT_INC(dropped);
+    return;
+  }
+  ofdpa_sim_group_chain(pkt, bucket->referenceGroupId, egress, depth + 1);
+}
+
+void ofdpa_sim_group_apply(ofdpa_sim_pkt_t *pkt)
+{
+  ofdpa_sim_egress_t egress;
+
+  memset(&egress, 0, sizeof(egress));
+  ofdpa_sim_group_chain(pkt, pkt->groupId, egress, 0);
+}
@@ -0,0 +1,110 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     ofdpa_sim_int.h
+*
+* @purpose      Software OF-DPA dataplane internals
+*
+* @component    OF-DPA
+*
+* @comments     Flow and group state is guarded by ofdpa_sim_lock. API
+*               calls that change it take it for writing; the pipeline
+*               takes it for reading, so frames from the port thread and
+*               ofdpa_sim_inject() callers are processed concurrently.
+*               Counters updated under the read lock are atomic.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#ifndef INCLUDE_OFDPA_SIM_INT_H
+#define INCLUDE_OFDPA_SIM_INT_H
+
+#define AIM_LOG_MODULE_NAME ofdpa_sim
+#include <AIM/aim_log.h>
+
+#include <pthread.h>
+#include <time.h>
+#include <AIM/aim.h>
+#include <AIM/aim_list.h>
+#include <BigHash/bighash.h>
+#include "ofdpa_api.h"
+#include "ofdpa_sim.h"
+
+#define OFDPA_SIM_STAT_INC(_field) \
+  __atomic_add_fetch(&ofdpa_sim_stats._field, 1, __ATOMIC_RELAXED)
+
+extern pthread_rwlock_t ofdpa_sim_lock;
+extern ofdpa_sim_stats_t ofdpa_sim_stats;
+
+/* A frame on its way through the pipeline */
+typedef struct ofdpa_sim_pkt_s
+{
+  const uint8_t *data;      /* Not modified; groups build the frames they send */
+  uint32_t  len;
+  uint32_t  inPort;
+
+  /* Parsed from the frame */
+  uint16_t  tagVid;         /* OFDPA_VID_PRESENT | VID of the outer tag, or 0 */
+  uint16_t  etherType;      /* After any VLAN tag */
+  uint32_t  l3Offset;
+  uint32_t  srcIp4;         /* Host byte order */
+  uint32_t  dstIp4;
+  uint8_t   ipProto;
+  uint8_t   dscp;
+  uint16_t  srcL4Port;
+  uint16_t  dstL4Port;
+
+  /* Pipeline metadata */
+  uint16_t  vlanId;         /* OFDPA_VID_PRESENT | VID assigned by the VLAN table */
+  uint16_t  vrf;
+  uint32_t  tunnelId;
+  uint32_t  mplsL2Port;
+
+  /* Action set */
+  uint32_t  groupId;        /* 0 when no group is written */
+  int       toController;
+  OFDPA_FLOW_TABLE_ID_t controllerTable;
+} ofdpa_sim_pkt_t;
+
+/* ofdpa_sim.c */
+uint64_t ofdpa_sim_now(void);
+void ofdpa_sim_event_signal(void);
+void ofdpa_sim_port_event_add(uint32_t portNum, OFDPA_PORT_EVENT_MASK_t mask,
+                              OFDPA_PORT_STATE_t state);
+void ofdpa_sim_flow_event_add(OFDPA_FLOW_EVENT_MASK_t mask, ofdpaFlowEntry_t *flow);
+void ofdpa_sim_pktin_add(ofdpa_sim_pkt_t *pkt, OFDPA_PACKET_IN_REASON_t reason,
+                         OFDPA_FLOW_TABLE_ID_t tableId);
+
+/* ofdpa_sim_flow.c */
+void ofdpa_sim_flow_init(void);
+void ofdpa_sim_pipeline(ofdpa_sim_pkt_t *pkt);
+void ofdpa_sim_flow_expire(void);
+
+/* ofdpa_sim_group.c */
+void ofdpa_sim_group_init(void);
+void ofdpa_sim_group_ref(uint32_t groupId, int delta);
+void ofdpa_sim_group_apply(ofdpa_sim_pkt_t *pkt);
+
+/* ofdpa_sim_port.c */
+OFDPA_ERROR_t ofdpa_sim_port_init(void);
+int ofdpa_sim_port_live(uint32_t portNum);
+void ofdpa_sim_port_output(uint32_t portNum, uint8_t *data, uint32_t len);
+
+#endif /* INCLUDE_OFDPA_SIM_INT_H */
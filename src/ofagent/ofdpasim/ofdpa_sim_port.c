@@ -0,0 +1,686 @@
+/*********************************************************************
+*
+* (C) Copyright Broadcom Corporation 2013-2016
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*
+**********************************************************************
+*
+* @filename     ofdpa_sim_port.c
+*
+* @purpose      Software OF-DPA dataplane: VPI ports
+*
+* @component    OF-DPA
+*
+* @comments     A single thread receives on all ports and runs each frame
+*               through the pipeline; it also checks flow timeouts once a
+*               second. VPI interfaces without a descriptor are polled.
+*
+*               Ports report 10G full duplex. A port is live when its
+*               link is up and it is not administratively down.
+*
+* @create       15 Oct 2026
+*
+* @end
+*
+**********************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include <poll.h>
+#include <VPI/vpi.h>
+#include "ofdpa_sim_int.h"
+
+#define OFDPA_SIM_PORT_MAX      256
+#define OFDPA_SIM_POLL_MS       100
+#define OFDPA_SIM_PORT_SPEED    10000000   /* kbps */
+#define OFDPA_SIM_PORT_FEATURES (OFDPA_PORT_FEAT_10GB_FD | OFDPA_PORT_FEAT_FIBER)
+
+typedef struct ofdpa_sim_port_s
+{
+  uint32_t portNum;
+  vpi_t    vpi;
+  uint32_t config;                /* OFDPA_PORT_CONFIG_t */
+  int      linkUp;
+  uint32_t advertised;
+  uint64_t added;
+  uint32_t minRate;
+  uint32_t maxRate;
+  uint64_t rx_packets;
+  uint64_t rx_bytes;
+  uint64_t tx_packets;
+  uint64_t tx_bytes;
+  uint64_t tx_errors;
+} ofdpa_sim_port_t;
+
+/* Guards the port array; ports are only read under the read lock */
+static pthread_rwlock_t ofdpa_sim_port_lock = PTHREAD_RWLOCK_INITIALIZER;
+static ofdpa_sim_port_t *ofdpa_sim_ports[OFDPA_SIM_PORT_MAX];   /* Ascending by portNum */
+static int ofdpa_sim_port_count;
+static int ofdpa_sim_port_started;
+static pthread_t ofdpa_sim_rx_thread;
+
+static int ofdpa_sim_port_search(uint32_t portNum)
+{
+  int lo = 0, hi = ofdpa_sim_port_count;
+  int mid;
+
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (ofdpa_sim_ports[mid]->portNum < portNum)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+static ofdpa_sim_port_t *ofdpa_sim_port_find(uint32_t portNum)
+{
+  int i = ofdpa_sim_port_search(portNum);
+
+  if (i < ofdpa_sim_port_count && ofdpa_sim_ports[i]->portNum == portNum)
+  {
+    return ofdpa_sim_ports[i];
+  }
+  return NULL;
+}
+
+static OFDPA_PORT_STATE_t ofdpa_sim_port_state(ofdpa_sim_port_t *port)
+{
+  if (!port->linkUp)
+  {
+    return OFDPA_PORT_STATE_LINK_DOWN;
+  }
+  return (port->config & OFDPA_PORT_CONFIG_DOWN) ? 0 : OFDPA_PORT_STATE_LIVE;
+}
+
+OFDPA_ERROR_t ofdpa_sim_port_add(uint32_t portNum, const char *spec)
+{
+  ofdpa_sim_port_t *port;
+  vpi_t vpi;
+  int i;
+
+  if (portNum == 0 || portNum >= OFDPA_PORT_CONTROLLER)
+  {
+    return OFDPA_E_PARAM;
+  }
+
+  vpi_init();
+  vpi = vpi_create(spec);
+  if (vpi == NULL)
+  {
+    AIM_LOG_ERROR("Cannot create port %u on '%s'", portNum, spec);
+    return OFDPA_E_FAIL;
+  }
+
+  pthread_rwlock_wrlock(&ofdpa_sim_port_lock);
+  i = ofdpa_sim_port_search(portNum);
+  if (i < ofdpa_sim_port_count && ofdpa_sim_ports[i]->portNum == portNum)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    vpi_destroy(vpi);
+    return OFDPA_E_EXISTS;
+  }
+  if (ofdpa_sim_port_count == OFDPA_SIM_PORT_MAX)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    vpi_destroy(vpi);
+    return OFDPA_E_FULL;
+  }
+
+  port = aim_zmalloc(sizeof(*port));
+  port->portNum = portNum;
+  port->vpi = vpi;
+  port->linkUp = 1;
+  port->advertised = OFDPA_SIM_PORT_FEATURES;
+  port->added = ofdpa_sim_now();
+
+  memmove(&ofdpa_sim_ports[i + 1], &ofdpa_sim_ports[i],
+          (ofdpa_sim_port_count - i) * sizeof(*ofdpa_sim_ports));
+  ofdpa_sim_ports[i] = port;
+  ofdpa_sim_port_count++;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  AIM_LOG_INFO("Port %u on %s", portNum, vpi_name_get(vpi));
+  if (ofdpa_sim_port_started)
+  {
+    ofdpa_sim_port_event_add(portNum, OFDPA_EVENT_PORT_CREATE, OFDPA_PORT_STATE_LIVE);
+  }
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpa_sim_port_delete(uint32_t portNum)
+{
+  ofdpa_sim_port_t *port;
+  int i;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_port_lock);
+  i = ofdpa_sim_port_search(portNum);
+  if (i >= ofdpa_sim_port_count || ofdpa_sim_ports[i]->portNum != portNum)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  port = ofdpa_sim_ports[i];
+  memmove(&ofdpa_sim_ports[i], &ofdpa_sim_ports[i + 1],
+          (ofdpa_sim_port_count - i - 1) * sizeof(*ofdpa_sim_ports));
+  ofdpa_sim_port_count--;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  vpi_destroy(port->vpi);
+  aim_free(port);
+
+  if (ofdpa_sim_port_started)
+  {
+    ofdpa_sim_port_event_add(portNum, OFDPA_EVENT_PORT_DELETE, OFDPA_PORT_STATE_LINK_DOWN);
+  }
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpa_sim_port_link_set(uint32_t portNum, int up)
+{
+  ofdpa_sim_port_t *port;
+  OFDPA_PORT_STATE_t state;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  port->linkUp = up ? 1 : 0;
+  state = ofdpa_sim_port_state(port);
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  if (ofdpa_sim_port_started)
+  {
+    ofdpa_sim_port_event_add(portNum, OFDPA_EVENT_PORT_STATE, state);
+  }
+  return OFDPA_E_NONE;
+}
+
+int ofdpa_sim_port_live(uint32_t portNum)
+{
+  ofdpa_sim_port_t *port;
+  int live;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  live = (port != NULL && ofdpa_sim_port_state(port) == OFDPA_PORT_STATE_LIVE);
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return live;
+}
+
+void ofdpa_sim_port_output(uint32_t portNum, uint8_t *data, uint32_t len)
+{
+  ofdpa_sim_port_t *port;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL || ofdpa_sim_port_state(port) != OFDPA_PORT_STATE_LIVE)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    OFDPA_SIM_STAT_INC(dropped);
+    return;
+  }
+  if (vpi_send(port->vpi, data, len) < 0)
+  {
+    __atomic_add_fetch(&port->tx_errors, 1, __ATOMIC_RELAXED);
+  }
+  else
+  {
+    __atomic_add_fetch(&port->tx_packets, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&port->tx_bytes, len, __ATOMIC_RELAXED);
+    OFDPA_SIM_STAT_INC(forwarded);
+  }
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+}
+
+static void ofdpa_sim_process(uint32_t inPortNum, const uint8_t *data, uint32_t len)
+{
+  ofdpa_sim_pkt_t pkt;
+
+  memset(&pkt, 0, sizeof(pkt));
+  pkt.data = data;
+  pkt.len = len;
+  pkt.inPort = inPortNum;
+  ofdpa_sim_pipeline(&pkt);
+}
+
+OFDPA_ERROR_t ofdpa_sim_inject(uint32_t inPortNum, const uint8_t *data, uint32_t len)
+{
+  if (len > OFDPA_SIM_MAX_PKT_SIZE)
+  {
+    return OFDPA_E_PARAM;
+  }
+  OFDPA_SIM_STAT_INC(injected);
+  ofdpa_sim_process(inPortNum, data, len);
+  return OFDPA_E_NONE;
+}
+
+/* Receive at most one frame from each port that has one waiting */
+static void ofdpa_sim_rx_poll(uint8_t *buf)
+{
+  struct pollfd fds[OFDPA_SIM_PORT_MAX];
+  uint32_t portNums[OFDPA_SIM_PORT_MAX];
+  ofdpa_sim_port_t *port;
+  int count, polled = 0;
+  int i, len, rv;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  count = ofdpa_sim_port_count;
+  for (i = 0; i < count; i++)
+  {
+    portNums[i] = ofdpa_sim_ports[i]->portNum;
+    fds[i].fd = vpi_descriptor_get(ofdpa_sim_ports[i]->vpi);
+    fds[i].events = POLLIN;
+    fds[i].revents = 0;
+    polled |= (fds[i].fd < 0);
+  }
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  /* Interfaces without a descriptor are checked every few milliseconds */
+  rv = poll(fds, count, polled ? 5 : OFDPA_SIM_POLL_MS);
+  if (rv < 0 || (rv == 0 && !polled))
+  {
+    return;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    if (fds[i].fd >= 0 && !(fds[i].revents & POLLIN))
+    {
+      continue;
+    }
+
+    pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+    port = ofdpa_sim_port_find(portNums[i]);
+    len = port ? vpi_recv(port->vpi, buf, OFDPA_SIM_MAX_PKT_SIZE, 0) : 0;
+    if (len > 0)
+    {
+      __atomic_add_fetch(&port->rx_packets, 1, __ATOMIC_RELAXED);
+      __atomic_add_fetch(&port->rx_bytes, len, __ATOMIC_RELAXED);
+    }
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+    if (len > 0)
+    {
+      OFDPA_SIM_STAT_INC(rx_frames);
+      ofdpa_sim_process(portNums[i], buf, len);
+    }
+  }
+}
+
+static void *ofdpa_sim_rx_main(void *arg)
+{
+  uint8_t *buf = aim_malloc(OFDPA_SIM_MAX_PKT_SIZE);
+  uint64_t expired = ofdpa_sim_now();
+
+  (void)arg;
+  for (;;)
+  {
+    ofdpa_sim_rx_poll(buf);
+    if (ofdpa_sim_now() != expired)
+    {
+      expired = ofdpa_sim_now();
+      ofdpa_sim_flow_expire();
+    }
+  }
+  return NULL;
+}
+
+OFDPA_ERROR_t ofdpa_sim_port_init(void)
+{
+  char *ports, *item, *save = NULL;
+  char *spec, *end;
+  unsigned long portNum;
+  OFDPA_ERROR_t rv;
+
+  ports = getenv(OFDPA_SIM_PORTS_ENV);
+  if (ports != NULL)
+  {
+    ports = aim_strdup(ports);
+    for (item = strtok_r(ports, " \t\n", &save); item != NULL;
+         item = strtok_r(NULL, " \t\n", &save))
+    {
+      portNum = strtoul(item, &end, 0);
+      if (*end != '=')
+      {
+        AIM_LOG_ERROR("Bad port '%s' in %s", item, OFDPA_SIM_PORTS_ENV);
+        aim_free(ports);
+        return OFDPA_E_PARAM;
+      }
+      spec = end + 1;
+      rv = ofdpa_sim_port_add(portNum, spec);
+      if (rv != OFDPA_E_NONE)
+      {
+        aim_free(ports);
+        return rv;
+      }
+    }
+    aim_free(ports);
+  }
+
+  if (pthread_create(&ofdpa_sim_rx_thread, NULL, ofdpa_sim_rx_main, NULL) != 0)
+  {
+    AIM_LOG_ERROR("Cannot start the port thread");
+    return OFDPA_E_FAIL;
+  }
+  ofdpa_sim_port_started = 1;
+  return OFDPA_E_NONE;
+}
+
+/*
+ * OF-DPA port API
+ */
+
+void ofdpaPortTypeGet(uint32_t portNum, uint32_t *type)
+{
+  *type = portNum >> 16;
+}
+
+void ofdpaPortIndexGet(uint32_t portNum, uint32_t *index)
+{
+  *index = portNum & 0xffff;
+}
+
+OFDPA_ERROR_t ofdpaPortNextGet(uint32_t portNum, uint32_t *nextPortNum)
+{
+  int i;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  i = ofdpa_sim_port_search(portNum);
+  if (i < ofdpa_sim_port_count && ofdpa_sim_ports[i]->portNum == portNum)
+  {
+    i++;
+  }
+  if (i >= ofdpa_sim_port_count)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_FAIL;
+  }
+  *nextPortNum = ofdpa_sim_ports[i]->portNum;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+static int ofdpa_sim_port_exists(uint32_t portNum)
+{
+  int exists;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  exists = (ofdpa_sim_port_find(portNum) != NULL);
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return exists;
+}
+
+OFDPA_ERROR_t ofdpaPortMacGet(uint32_t portNum, ofdpaMacAddr_t *mac)
+{
+  if (!ofdpa_sim_port_exists(portNum))
+  {
+    return OFDPA_E_NOT_FOUND;
+  }
+  memset(mac, 0, sizeof(*mac));
+  mac->addr[0] = 0x02;
+  mac->addr[4] = (portNum >> 8) & 0xff;
+  mac->addr[5] = portNum & 0xff;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortNameGet(uint32_t portNum, ofdpa_buffdesc *name)
+{
+  ofdpa_sim_port_t *port;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  snprintf(name->pstart, name->size, "port%u", portNum);
+  name->size = strlen(name->pstart) + 1;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortStateGet(uint32_t portNum, uint32_t *state)
+{
+  ofdpa_sim_port_t *port;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  *state = ofdpa_sim_port_state(port);
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortConfigSet(uint32_t portNum, OFDPA_PORT_CONFIG_t config)
+{
+  ofdpa_sim_port_t *port;
+  OFDPA_PORT_STATE_t state;
+  int changed;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  changed = (port->config != config);
+  port->config = config;
+  state = ofdpa_sim_port_state(port);
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  if (changed)
+  {
+    ofdpa_sim_port_event_add(portNum, OFDPA_EVENT_PORT_STATE, state);
+  }
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortConfigGet(uint32_t portNum, uint32_t *config)
+{
+  ofdpa_sim_port_t *port;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  *config = port->config;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortMaxSpeedGet(uint32_t portNum, uint32_t *maxSpeed)
+{
+  *maxSpeed = OFDPA_SIM_PORT_SPEED;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortCurrSpeedGet(uint32_t portNum, uint32_t *currSpeed)
+{
+  *currSpeed = OFDPA_SIM_PORT_SPEED;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortFeatureGet(uint32_t portNum, ofdpaPortFeature_t *feature)
+{
+  ofdpa_sim_port_t *port;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  feature->curr = OFDPA_SIM_PORT_FEATURES;
+  feature->advertised = port->advertised;
+  feature->supported = OFDPA_SIM_PORT_FEATURES;
+  feature->peer = OFDPA_SIM_PORT_FEATURES;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortAdvertiseFeatureSet(uint32_t portNum, uint32_t advertise)
+{
+  ofdpa_sim_port_t *port;
+
+  pthread_rwlock_wrlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  port->advertised = advertise;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPortStatsGet(uint32_t portNum, ofdpaPortStats_t *stats)
+{
+  ofdpa_sim_port_t *port;
+
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  memset(stats, 0, sizeof(*stats));
+  stats->rx_packets = __atomic_load_n(&port->rx_packets, __ATOMIC_RELAXED);
+  stats->rx_bytes = __atomic_load_n(&port->rx_bytes, __ATOMIC_RELAXED);
+  stats->tx_packets = __atomic_load_n(&port->tx_packets, __ATOMIC_RELAXED);
+  stats->tx_bytes = __atomic_load_n(&port->tx_bytes, __ATOMIC_RELAXED);
+  stats->tx_errors = __atomic_load_n(&port->tx_errors, __ATOMIC_RELAXED);
+  stats->duration_seconds = ofdpa_sim_now() - port->added;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaNumQueuesGet(uint32_t portNum, uint32_t *numQueues)
+{
+  *numQueues = 1;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaQueueStatsGet(uint32_t portNum, uint32_t queueId, ofdpaPortQueueStats_t *stats)
+{
+  ofdpaPortStats_t portStats;
+  OFDPA_ERROR_t rv;
+
+  if (queueId != 0)
+  {
+    return OFDPA_E_PARAM;
+  }
+  rv = ofdpaPortStatsGet(portNum, &portStats);
+  if (rv != OFDPA_E_NONE)
+  {
+    return rv;
+  }
+  stats->txBytes = portStats.tx_bytes;
+  stats->txPkts = portStats.tx_packets;
+  stats->duration_seconds = portStats.duration_seconds;
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaQueueRateSet(uint32_t portNum, uint32_t queueId, uint32_t minRate, uint32_t maxRate)
+{
+  ofdpa_sim_port_t *port;
+
+  if (queueId != 0)
+  {
+    return OFDPA_E_PARAM;
+  }
+  pthread_rwlock_wrlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  /* Recorded only; ports are not shaped */
+  port->minRate = minRate;
+  port->maxRate = maxRate;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaQueueRateGet(uint32_t portNum, uint32_t queueId, uint32_t *minRate, uint32_t *maxRate)
+{
+  ofdpa_sim_port_t *port;
+
+  if (queueId != 0)
+  {
+    return OFDPA_E_PARAM;
+  }
+  pthread_rwlock_rdlock(&ofdpa_sim_port_lock);
+  port = ofdpa_sim_port_find(portNum);
+  if (port == NULL)
+  {
+    pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+    return OFDPA_E_NOT_FOUND;
+  }
+  *minRate = port->minRate;
+  *maxRate = port->maxRate;
+  pthread_rwlock_unlock(&ofdpa_sim_port_lock);
+
+  return OFDPA_E_NONE;
+}
+
+OFDPA_ERROR_t ofdpaPktSend(ofdpa_buffdesc *pkt, uint32_t flags, uint32_t outPortNum, uint32_t inPortNum)
+{
+  if (pkt->size > OFDPA_SIM_MAX_PKT_SIZE)
+  {
+    return OFDPA_E_PARAM;
+  }
+  if (flags & OFDPA_PKT_LOOKUP)
+  {
+    ofdpa_sim_process(inPortNum, (uint8_t *)pkt->pstart, pkt->size);
+    return OFDPA_E_NONE;
+  }
+  if (!ofdpa_sim_port_exists(outPortNum))
+  {
+    return OFDPA_E_NOT_FOUND;
+  }
+  ofdpa_sim_port_output(outPortNum, (uint8_t *)pkt->pstart, pkt->size);
+  return OFDPA_E_NONE;
+}